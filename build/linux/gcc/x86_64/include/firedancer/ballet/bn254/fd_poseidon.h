@@ -0,0 +1,79 @@
+#ifndef HEADER_fd_src_ballet_bn254_fd_poseidon_h
+#define HEADER_fd_src_ballet_bn254_fd_poseidon_h
+
+/* fd_poseidon implements the Poseidon hash over the bn254 scalar field,
+   with the parameters of Solana's sol_poseidon syscall (light-poseidon,
+   x^5 S-box, 8 full rounds, a zero domain tag and 1 to 12 inputs). */
+
+#include "../fd_ballet_base.h"
+
+#define FD_POSEIDON_HASH_SIZE (32UL)
+
+/* FD_POSEIDON_MAX_INPUT_CNT is the maximum number of field elements
+   that can be hashed together. */
+
+#define FD_POSEIDON_MAX_INPUT_CNT (12UL)
+
+/* Hash result. Actually a value in the bn254 field */
+struct fd_poseidon_hash_result {
+  uchar v[ FD_POSEIDON_HASH_SIZE ];
+};
+typedef struct fd_poseidon_hash_result fd_poseidon_hash_result_t;
+
+/* fd_bn254_scalar_t is an element of the bn254 scalar field, in the
+   Montgomery domain of the fiat-crypto bn254_scalar arithmetic. */
+
+struct fd_bn254_scalar {
+  ulong el[4];
+};
+typedef struct fd_bn254_scalar fd_bn254_scalar_t;
+
+/* fd_poseidon_t is the state of an incremental Poseidon hash.  It is
+   meant to be declared by the caller, e.g. on the stack. */
+
+struct fd_poseidon {
+  fd_bn254_scalar_t state[ 1UL+FD_POSEIDON_MAX_INPUT_CNT ];
+  ulong             cnt;        /* Number of inputs appended so far */
+  int               big_endian;
+};
+typedef struct fd_poseidon fd_poseidon_t;
+
+FD_PROTOTYPES_BEGIN
+
+/* fd_poseidon_init starts a new hash of inputs encoded in big endian
+   (big_endian non-zero) or little endian.  Returns pos. */
+
+fd_poseidon_t *
+fd_poseidon_init( fd_poseidon_t * pos,
+                  int             big_endian );
+
+/* fd_poseidon_append appends the field element encoded in the sz bytes
+   at data to the inputs of the hash.  sz should be in [1,32], shorter
+   encodings are zero extended.  Returns pos on success, and NULL if sz
+   is out of range, if the value is not less than the field modulus, or
+   if FD_POSEIDON_MAX_INPUT_CNT inputs were already appended (pos is
+   unchanged in all these cases). */
+
+fd_poseidon_t *
+fd_poseidon_append( fd_poseidon_t * pos,
+                    uchar const *   data,
+                    ulong           sz );
+
+/* fd_poseidon_fini computes the hash of the inputs appended to pos and
+   stores it at hash, in the endianness of the inputs.  Returns hash, or
+   NULL if no input was appended. */
+
+uchar *
+fd_poseidon_fini( fd_poseidon_t * pos,
+                  uchar           hash[ FD_POSEIDON_HASH_SIZE ] );
+
+/* Hash a series of bytes. Generally speaking, the input should be a
+   sequence of bn254 field values in 32 byte chunks.  If the input
+   doesn't exactly conform, we zero-fill and modulo to make it
+   work. Non-zero is returned on failure. */
+int fd_poseidon_hash( const uchar * bytes, ulong bytes_len,
+                      int big_endian, fd_poseidon_hash_result_t * result );
+
+FD_PROTOTYPES_END
+
+#endif /* HEADER_fd_src_ballet_bn254_fd_poseidon_h */
@@ -0,0 +1,298 @@
+#ifndef HEADER_fd_src_ballet_pack_fd_pack_shard_h
+#define HEADER_fd_src_ballet_pack_fd_pack_shard_h
+
+/* A single pack object schedules every microblock for every bank tile
+   serially, so at high bank tile counts pack itself becomes the
+   bottleneck.  fd_pack_shard allows splitting the work across several
+   pack objects (typically each in its own pack tile), each scheduling
+   for a disjoint subset of the bank tiles.
+
+   Transactions are partitioned across the shards by the hash of their
+   fee payer (which is always a writable account), see
+   fd_pack_shard_home.  Each shard resolves conflicts between its own
+   transactions as usual, but its transactions may also touch accounts
+   that transactions scheduled by other shards touch.  To arbitrate
+   this, every shard also acquires its accounts in a table shared by all
+   shards before including a transaction in a microblock, and releases
+   them when the microblock completes.
+
+   The table is indexed by a hash of the account address, and each
+   bucket holds a reader/writer lock and the cost of all transactions
+   that have written to the accounts in the bucket during the current
+   block, which is how the consensus critical per account write cost
+   limit is enforced across shards.  Collisions between accounts only
+   ever cause spurious conflicts or spuriously hitting the cost limit
+   (never over admitting), so the table is sized to make them rare.
+
+   Block wide limits (total cost, vote cost, data bytes, microblocks)
+   are not shared and should be split between the shards by the caller
+   when creating the pack objects. */
+
+#include "../fd_ballet_base.h"
+#include "../txn/fd_txn.h"
+
+#define FD_PACK_SHARD_ALIGN (128UL)
+
+/* FD_PACK_SHARD_MAX is the maximum number of shards. */
+
+#define FD_PACK_SHARD_MAX (64UL)
+
+/* FD_PACK_SHARD_LG_BUCKET_CNT_{MIN,MAX} bound the number of buckets in
+   the shared table. */
+
+#define FD_PACK_SHARD_LG_BUCKET_CNT_MIN (10)
+#define FD_PACK_SHARD_LG_BUCKET_CNT_MAX (30)
+
+/* Layout of a bucket lock word: the msb indicates the bucket is write
+   locked, in which case bits [32,48) hold the owner tag of the locker.
+   The low 32 bits hold the number of outstanding acquisitions. */
+
+#define FD_PACK_SHARD_LOCK_WRITE     (0x8000000000000000UL)
+#define FD_PACK_SHARD_LOCK_CNT_MASK  (0x00000000ffffffffUL)
+#define FD_PACK_SHARD_LOCK_OWNER(o)  ((ulong)(o)<<32)
+
+struct fd_pack_shard_bucket {
+  ulong lock;  /* see above */
+  ulong cost;  /* tag of the block in the high 32 bits, cost in the low 32 bits */
+};
+
+typedef struct fd_pack_shard_bucket fd_pack_shard_bucket_t;
+
+struct __attribute__((aligned(FD_PACK_SHARD_ALIGN))) fd_pack_shard_private {
+  ulong magic;       /* == FD_PACK_SHARD_MAGIC */
+  ulong shard_cnt;   /* in [1,FD_PACK_SHARD_MAX] */
+  ulong bucket_cnt;  /* power of 2 */
+  ulong max_write_cost_per_acct;
+
+  /* bucket_cnt fd_pack_shard_bucket_t follow here, aligned to
+     FD_PACK_SHARD_ALIGN */
+};
+
+typedef struct fd_pack_shard_private fd_pack_shard_t;
+
+FD_PROTOTYPES_BEGIN
+
+/* fd_pack_shard_{align,footprint} return the alignment and footprint of
+   a memory region suitable for use as a shard table with 2^lg_bucket_cnt
+   buckets.  footprint returns 0 if lg_bucket_cnt is out of range. */
+
+FD_FN_CONST ulong
+fd_pack_shard_align( void );
+
+FD_FN_CONST ulong
+fd_pack_shard_footprint( ulong lg_bucket_cnt );
+
+/* fd_pack_shard_{new,join,leave,delete} have the usual persistent shared
+   memory object semantics.  shard_cnt is the number of pack objects
+   that will share the table, and max_write_cost_per_acct the limit of
+   cost of transactions writing to an account (or bucket) each block. */
+
+void *
+fd_pack_shard_new( void * shmem,
+                   ulong  shard_cnt,
+                   ulong  lg_bucket_cnt,
+                   ulong  max_write_cost_per_acct );
+
+fd_pack_shard_t *
+fd_pack_shard_join( void * shshard );
+
+void *
+fd_pack_shard_leave( fd_pack_shard_t const * shard );
+
+void *
+fd_pack_shard_delete( void * shshard );
+
+FD_FN_PURE static inline ulong fd_pack_shard_cnt( fd_pack_shard_t const * shard ) { return shard->shard_cnt; }
+
+/* fd_pack_shard_limit returns the part of a per block limit of max
+   that shard shard_idx of shard_cnt may use.  The first
+   max%shard_cnt shards get one more than the others, so the parts sum
+   to max exactly. */
+
+FD_FN_CONST static inline ulong
+fd_pack_shard_limit( ulong max,
+                     ulong shard_cnt,
+                     ulong shard_idx ) {
+  return max/shard_cnt + (ulong)( shard_idx<max%shard_cnt );
+}
+
+/* fd_pack_shard_acct_hash returns the hash of an account address used
+   both to pick its shard and its bucket in the table.  Account
+   addresses are public keys (or hashes), so the first 8 bytes are
+   already uniformly distributed. */
+
+FD_FN_PURE static inline ulong
+fd_pack_shard_acct_hash( fd_acct_addr_t const * acct ) {
+  return fd_ulong_hash( fd_ulong_load_8( acct->b ) );
+}
+
+/* fd_pack_shard_of returns the shard in [0,shard_cnt) that owns acct. */
+
+FD_FN_PURE static inline ulong
+fd_pack_shard_of( ulong                  shard_cnt,
+                  fd_acct_addr_t const * acct ) {
+  return (fd_pack_shard_acct_hash( acct )>>32) % shard_cnt;
+}
+
+/* fd_pack_shard_home returns the shard that should schedule txn, which
+   is the shard owning its fee payer.  payload is the transaction
+   payload txn was parsed from. */
+
+FD_FN_PURE static inline ulong
+fd_pack_shard_home( ulong            shard_cnt,
+                    fd_txn_t const * txn,
+                    uchar const *    payload ) {
+  return fd_pack_shard_of( shard_cnt, fd_txn_get_acct_addrs( txn, payload ) );
+}
+
+/* fd_pack_shard_mask returns a bitmask of the shards owning the
+   writable accounts of txn.  A transaction with more than one bit set
+   is a multi shard transaction. */
+
+FD_FN_PURE ulong
+fd_pack_shard_mask( ulong            shard_cnt,
+                    fd_txn_t const * txn,
+                    uchar const *    payload );
+
+/* fd_pack_shard_owner returns the owner tag used to lock buckets on
+   behalf of bank tile bank_tile of shard shard_idx.  Owner tags are
+   non-zero and unique for each (shard,bank tile) pair. */
+
+FD_FN_CONST static inline ulong
+fd_pack_shard_owner( ulong shard_idx,
+                     ulong bank_tile ) {
+  return shard_idx*FD_PACK_SHARD_MAX + bank_tile + 1UL;
+}
+
+FD_FN_PURE static inline fd_pack_shard_bucket_t *
+fd_pack_shard_bucket( fd_pack_shard_t *      shard,
+                      fd_acct_addr_t const * acct ) {
+  fd_pack_shard_bucket_t * bucket = (fd_pack_shard_bucket_t *)(shard+1);
+  return bucket + (fd_pack_shard_acct_hash( acct ) & (shard->bucket_cnt-1UL));
+}
+
+/* fd_pack_shard_lock_{write,read} try to acquire the bucket of acct for
+   writing or reading on behalf of owner.  A bucket write locked by an
+   owner can be acquired again (for reading or writing) by the same
+   owner, which happens when two accounts in the same microblock share a
+   bucket.  A bucket that is read locked can be acquired by anyone for
+   reading, but not for writing.  Returns 1 on success and 0 if the
+   bucket is in use in a conflicting way.  Every successful lock must be
+   matched by a fd_pack_shard_unlock. */
+
+static inline int
+fd_pack_shard_lock_private( ulong * lock,
+                            ulong   owner,
+                            int     write ) {
+  ulong mine = FD_PACK_SHARD_LOCK_WRITE | FD_PACK_SHARD_LOCK_OWNER( owner );
+  for(;;) {
+    ulong cur = FD_VOLATILE_CONST( *lock );
+    ulong nxt;
+    if( FD_LIKELY( !cur ) ) {
+      nxt = fd_ulong_if( write, mine, 0UL ) | 1UL;
+    } else if( (cur & ~FD_PACK_SHARD_LOCK_CNT_MASK)==mine ) {
+      nxt = cur+1UL;                         /* Re-entrant for the writer */
+    } else if( !write & !(cur & FD_PACK_SHARD_LOCK_WRITE) ) {
+      nxt = cur+1UL;                         /* Another reader */
+    } else {
+      return 0;
+    }
+#   if FD_HAS_ATOMIC
+    if( FD_LIKELY( FD_ATOMIC_CAS( lock, cur, nxt )==cur ) ) return 1;
+    FD_SPIN_PAUSE();
+#   else
+    *lock = nxt;
+    return 1;
+#   endif
+  }
+}
+
+static inline int
+fd_pack_shard_lock_write( fd_pack_shard_t *      shard,
+                          fd_acct_addr_t const * acct,
+                          ulong                  owner ) {
+  return fd_pack_shard_lock_private( &fd_pack_shard_bucket( shard, acct )->lock, owner, 1 );
+}
+
+static inline int
+fd_pack_shard_lock_read( fd_pack_shard_t *      shard,
+                         fd_acct_addr_t const * acct,
+                         ulong                  owner ) {
+  return fd_pack_shard_lock_private( &fd_pack_shard_bucket( shard, acct )->lock, owner, 0 );
+}
+
+/* fd_pack_shard_unlock releases one acquisition of the bucket of acct.
+   The bucket becomes free when the last acquisition is released. */
+
+static inline void
+fd_pack_shard_unlock( fd_pack_shard_t *      shard,
+                      fd_acct_addr_t const * acct ) {
+  ulong * lock = &fd_pack_shard_bucket( shard, acct )->lock;
+  for(;;) {
+    ulong cur = FD_VOLATILE_CONST( *lock );
+    ulong nxt = fd_ulong_if( (cur & FD_PACK_SHARD_LOCK_CNT_MASK)>1UL, cur-1UL, 0UL );
+#   if FD_HAS_ATOMIC
+    if( FD_LIKELY( FD_ATOMIC_CAS( lock, cur, nxt )==cur ) ) return;
+    FD_SPIN_PAUSE();
+#   else
+    *lock = nxt;
+    return;
+#   endif
+  }
+}
+
+/* fd_pack_shard_charge tries to add cost to the write cost of the
+   bucket of acct for the block identified by tag.  Costs recorded for
+   an older block are discarded.  Returns 1 on success and 0 if that
+   would exceed max_write_cost_per_acct, or if another shard already
+   moved on to a newer block (in which case the caller's block is about
+   to end anyway).  fd_pack_shard_refund undoes a successful charge. */
+
+static inline int
+fd_pack_shard_charge( fd_pack_shard_t *      shard,
+                      fd_acct_addr_t const * acct,
+                      ulong                  tag,
+                      ulong                  cost ) {
+  ulong * word = &fd_pack_shard_bucket( shard, acct )->cost;
+  uint    mine = (uint)tag;
+  for(;;) {
+    ulong cur     = FD_VOLATILE_CONST( *word );
+    uint  cur_tag = (uint)(cur>>32);
+    if( FD_UNLIKELY( (int)(cur_tag-mine)>0 ) ) return 0;
+    ulong used    = fd_ulong_if( cur_tag==mine, cur & 0xffffffffUL, 0UL );
+    if( FD_UNLIKELY( used+cost>shard->max_write_cost_per_acct ) ) return 0;
+    ulong nxt     = ((ulong)mine<<32) | (used+cost);
+#   if FD_HAS_ATOMIC
+    if( FD_LIKELY( FD_ATOMIC_CAS( word, cur, nxt )==cur ) ) return 1;
+    FD_SPIN_PAUSE();
+#   else
+    *word = nxt;
+    return 1;
+#   endif
+  }
+}
+
+static inline void
+fd_pack_shard_refund( fd_pack_shard_t *      shard,
+                      fd_acct_addr_t const * acct,
+                      ulong                  tag,
+                      ulong                  cost ) {
+  ulong * word = &fd_pack_shard_bucket( shard, acct )->cost;
+  uint    mine = (uint)tag;
+  for(;;) {
+    ulong cur = FD_VOLATILE_CONST( *word );
+    if( FD_UNLIKELY( (uint)(cur>>32)!=mine ) ) return; /* Block already over */
+    ulong nxt = cur - fd_ulong_min( cost, cur & 0xffffffffUL );
+#   if FD_HAS_ATOMIC
+    if( FD_LIKELY( FD_ATOMIC_CAS( word, cur, nxt )==cur ) ) return;
+    FD_SPIN_PAUSE();
+#   else
+    *word = nxt;
+    return;
+#   endif
+  }
+}
+
+FD_PROTOTYPES_END
+
+#endif /* HEADER_fd_src_ballet_pack_fd_pack_shard_h */
@@ -0,0 +1,59 @@
+#ifndef HEADER_fd_src_choreo_commitment_fd_commitment_h
+#define HEADER_fd_src_choreo_commitment_fd_commitment_h
+
+#include "../fd_choreo_base.h"
+
+/* fd_slot_commitment is a representation of a block's commitment status.
+
+   Equivocation-safe: A (slot, hash) pair is equivocation-safe once it has reached 52%
+   of vote stake.
+
+   Optimistically-confirmed: A (slot, hash) pair is optimistically-confirmed once it has reached 2/3
+   of vote stake.
+*/
+
+#define FD_SUPERMAJORITY ( 2.0 / 3.0 )
+
+struct fd_slot_commitment {
+  ulong     slot;                  /* map key */
+  ulong     next;                  /* reserved for internal use by fd_pool, fd_map_chain (and the linked list) */
+  fd_hash_t hash;                  /* bank hash */
+  ulong     confirmed_stake[32UL]; /* how much stake has voted on this slot */
+  ulong     rooted_stake;          /* how much stake has rooted this slot or any descendant */
+  int       confirmed;             /* confirmed ie. optimistically-confirmed in ghost  */
+  int       finalized;             /* finalized ie. super-majority root */
+};
+typedef struct fd_slot_commitment fd_slot_commitment_t;
+
+#define POOL_NAME fd_slot_commitment_pool
+#define POOL_T    fd_slot_commitment_t
+#include "../../util/tmpl/fd_pool.c"
+
+#define MAP_NAME  fd_slot_commitment_map
+#define MAP_ELE_T fd_slot_commitment_t
+#define MAP_KEY   slot
+#include "../../util/tmpl/fd_map_chain.c"
+
+struct fd_commitment {
+  ulong                      slot; /* the last slot at which commitment was computed */
+  fd_slot_commitment_t *     pool;
+  fd_slot_commitment_map_t * map;
+};
+typedef struct fd_commitment fd_commitment_t;
+
+/* fd_commitment_slot_insert inserts a slot. */
+fd_slot_commitment_t *
+fd_commitment_slot_insert( fd_commitment_t * commitment, ulong slot );
+
+fd_slot_commitment_t *
+fd_commitment_slot_query( fd_commitment_t * commitment, ulong slot );
+
+/* fd_commitment_highest_confirmed_query returns the highest confirmed slot. */
+ulong
+fd_commitment_highest_confirmed_query( fd_commitment_t const * commitment );
+
+/* fd_commitment_highest_finalized_query returns the highest finalized slot. */
+ulong
+fd_commitment_highest_finalized_query( fd_commitment_t const * commitment );
+
+#endif /* HEADER_fd_src_choreo_commitment_fd_commitment_h */
@@ -0,0 +1,11 @@
+#ifndef HEADER_fd_src_choreo_fd_choreo_h
+#define HEADER_fd_src_choreo_fd_choreo_h
+
+// #include "fd_choreo_base.h"  /* Includes ../util/fd_util.h */
+#include "bft/fd_bft.h"               /* Includes fd_choreo_base.h */
+#include "commitment/fd_commitment.h" /* Includes fd_choreo_base.h */
+#include "forks/fd_forks.h"           /* Includes fd_choreo_base.h */
+#include "ghost/fd_ghost.h"           /* Includes fd_choreo_base.h */
+#include "voter/fd_voter.h"           /* Includes fd_choreo_base.h */
+
+#endif /* HEADER_fd_src_choreo_fd_choreo_h */
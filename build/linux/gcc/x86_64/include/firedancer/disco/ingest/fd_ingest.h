@@ -0,0 +1,220 @@
+#ifndef HEADER_fd_src_disco_ingest_fd_ingest_h
+#define HEADER_fd_src_disco_ingest_fd_ingest_h
+
+/* fd_ingest provides a shared memory transaction ingress for trusted
+   order flow sources running on the same host as the validator, like
+   block engines and relayers.  Instead of sending transactions over
+   QUIC to localhost, such a process joins the ingest workspace of the
+   validator and publishes serialized transactions directly into a
+   tango ring (an mcache and dcache pair), which the ingest tile copies
+   into the verify stage.
+
+   The ingest workspace (`<app>_ingest_ext.wksp`) holds an fd_ingest_t
+   directory followed by ring_cnt rings.  Each ring has exactly one
+   producer, a client process, and one reliable consumer, the ingest
+   tile, which returns flow control credits to the client through an
+   fseq.  The directory is the first object in the workspace, so a
+   client only needs the workspace name to find everything else.  The
+   ingest tile writes the location of the rings into the directory on
+   boot and then marks it ready.
+
+   A ring is claimed by a client with the pid of the process, so that
+   two clients do not publish into the same ring concurrently.  A claim
+   held by a process that no longer exists is taken over.  A client
+   that takes over a ring resumes the sequence numbers and the dcache
+   position of the previous client, so the ingest tile does not need to
+   be restarted.
+
+   The ingest tile does not trust the client: frags with a bad chunk or
+   size are dropped (and counted), and transactions are copied out of
+   the ring before being parsed and verified like any other.  Clients
+   are still required to be able to join the workspace, which is only
+   accessible to the user the validator runs as. */
+
+#include "../fd_disco_base.h"
+
+/* FD_INGEST_RING_MAX is the maximum number of rings of an ingest. */
+
+#define FD_INGEST_RING_MAX (16UL)
+
+/* FD_INGEST_{ALIGN,FOOTPRINT} specify the alignment and footprint
+   needed for an ingest directory. */
+
+#define FD_INGEST_ALIGN     (128UL)
+#define FD_INGEST_FOOTPRINT (sizeof(fd_ingest_t))
+
+/* FD_INGEST_{SUCCESS,ERR_*} are the results of publishing a
+   transaction with a client. */
+
+#define FD_INGEST_SUCCESS   ( 0) /* Transaction was published */
+#define FD_INGEST_ERR_AGAIN (-1) /* Ring is full, the ingest tile is backpressured, try again later */
+#define FD_INGEST_ERR_INVAL (-2) /* Transaction is empty or larger than the ring MTU */
+
+/* fd_ingest_ring_t describes one ring of an ingest.  The gaddrs are
+   relative to the ingest workspace. */
+
+struct __attribute__((aligned(64UL))) fd_ingest_ring {
+  ulong mcache_gaddr; /* Frag metadata published by the client */
+  ulong dcache_gaddr; /* Transaction payloads written by the client, compact with burst 1 */
+  ulong fseq_gaddr;   /* Position of the ingest tile in the ring, for flow control */
+  ulong mtu;          /* Largest transaction the ring accepts, FD_TPU_MTU */
+  ulong owner;        /* pid of the client that claimed the ring, 0 if unclaimed */
+};
+
+typedef struct fd_ingest_ring fd_ingest_ring_t;
+
+struct __attribute__((aligned(FD_INGEST_ALIGN))) fd_ingest_private {
+  ulong            magic;    /* == FD_INGEST_MAGIC */
+  ulong            ring_cnt; /* Number of rings, in [1,FD_INGEST_RING_MAX] */
+  ulong            ready;    /* 1 once the ingest tile filled in the rings, 0 before */
+  fd_ingest_ring_t ring[ FD_INGEST_RING_MAX ];
+};
+
+typedef struct fd_ingest_private fd_ingest_t;
+
+/* fd_ingest_client_t is a local join of a client to a ring.  It is
+   meant to be declared by the client (e.g. on the stack) and is not
+   shared. */
+
+struct fd_ingest_client {
+  fd_ingest_t *      ingest;
+  fd_ingest_ring_t * ring;
+  ulong              owner;
+
+  fd_wksp_t *        wksp;
+  fd_frag_meta_t *   mcache;
+  ulong *            sync;
+  ulong              depth;
+  ulong              mtu;
+  ulong              chunk0;
+  ulong              wmark;
+  ulong              chunk;
+  ulong              seq;
+
+  fd_fctl_t *        fctl;
+  ulong              cr_avail;
+  ulong              slow_cnt; /* Number of times the client found the ring full */
+
+  uchar fctl_mem[ FD_FCTL_FOOTPRINT( 1UL ) ] __attribute__((aligned(FD_FCTL_ALIGN)));
+};
+
+typedef struct fd_ingest_client fd_ingest_client_t;
+
+FD_PROTOTYPES_BEGIN
+
+/* fd_ingest_{align,footprint} return the required alignment and
+   footprint of a memory region suitable for use as an ingest
+   directory. */
+
+FD_FN_CONST ulong
+fd_ingest_align( void );
+
+FD_FN_CONST ulong
+fd_ingest_footprint( void );
+
+/* fd_ingest_{new,join,leave,delete} have the usual persistent shared
+   memory object semantics.  ring_cnt should be in
+   [1,FD_INGEST_RING_MAX].  The directory is created not ready, with
+   every ring unclaimed. */
+
+void *
+fd_ingest_new( void * shmem,
+               ulong  ring_cnt );
+
+fd_ingest_t *
+fd_ingest_join( void * shingest );
+
+void *
+fd_ingest_leave( fd_ingest_t const * ingest );
+
+void *
+fd_ingest_delete( void * shingest );
+
+/* fd_ingest_ring_set records the location of ring ring_idx, made of the
+   given mcache, dcache and fseq joins in wksp with the given mtu, in
+   the directory.  fd_ingest_ready marks the directory ready once every
+   ring has been set.  These are only called by the ingest tile. */
+
+void
+fd_ingest_ring_set( fd_ingest_t *          ingest,
+                    ulong                  ring_idx,
+                    fd_wksp_t *            wksp,
+                    fd_frag_meta_t const * mcache,
+                    uchar const *          dcache,
+                    ulong const *          fseq,
+                    ulong                  mtu );
+
+static inline void
+fd_ingest_ready( fd_ingest_t * ingest ) {
+  FD_COMPILER_MFENCE();
+  FD_VOLATILE( ingest->ready ) = 1UL;
+  FD_COMPILER_MFENCE();
+}
+
+FD_FN_PURE static inline ulong fd_ingest_ring_cnt( fd_ingest_t const * ingest ) { return ingest->ring_cnt; }
+
+static inline int
+fd_ingest_is_ready( fd_ingest_t const * ingest ) {
+  FD_COMPILER_MFENCE();
+  ulong ready = FD_VOLATILE_CONST( ingest->ready );
+  FD_COMPILER_MFENCE();
+  return !!ready;
+}
+
+/* fd_ingest_attach attaches the caller to the ingest workspace with the
+   given name (e.g. "fdctl_ingest_ext.wksp") and returns a join to its
+   directory, or NULL on failure (logs details).  fd_ingest_detach
+   leaves the directory and detaches from the workspace. */
+
+fd_ingest_t *
+fd_ingest_attach( char const * wksp_name );
+
+void
+fd_ingest_detach( fd_ingest_t * ingest );
+
+/* fd_ingest_client_join claims ring ring_idx of the ingest directory
+   for the calling process and joins client to it.  Returns client on
+   success and NULL on failure (logs details).  Reasons for failure
+   include the directory not being ready yet (the validator is still
+   booting), a bad ring_idx, or the ring being claimed by another live
+   process. */
+
+fd_ingest_client_t *
+fd_ingest_client_join( fd_ingest_client_t * client,
+                       fd_ingest_t *        ingest,
+                       ulong                ring_idx );
+
+/* fd_ingest_client_leave releases the ring claimed by client.  Every
+   transaction published so far will still be consumed. */
+
+void
+fd_ingest_client_leave( fd_ingest_client_t * client );
+
+/* fd_ingest_client_publish publishes the serialized transaction of sz
+   bytes at txn into the ring.  Returns FD_INGEST_SUCCESS if published,
+   FD_INGEST_ERR_AGAIN if the ingest tile has not yet consumed enough of
+   the ring for the transaction to fit (nothing is published and the
+   caller should retry later, this is how backpressure from the
+   validator reaches the client), and FD_INGEST_ERR_INVAL if sz is zero
+   or larger than the ring MTU.  Never blocks. */
+
+int
+fd_ingest_client_publish( fd_ingest_client_t * client,
+                          uchar const *        txn,
+                          ulong                sz );
+
+/* fd_ingest_client_publish_batch publishes up to cnt transactions, the
+   i-th being the sz[i] bytes at txn[i], in order.  Stops at the first
+   transaction that cannot be published.  Returns the number of
+   transactions published.  This refreshes flow control credits at most
+   once and is cheaper per transaction than publish. */
+
+ulong
+fd_ingest_client_publish_batch( fd_ingest_client_t *  client,
+                                uchar const * const * txn,
+                                ulong const *         sz,
+                                ulong                 cnt );
+
+FD_PROTOTYPES_END
+
+#endif /* HEADER_fd_src_disco_ingest_fd_ingest_h */
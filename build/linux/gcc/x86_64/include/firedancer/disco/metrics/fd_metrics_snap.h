@@ -0,0 +1,257 @@
+#ifndef HEADER_fd_src_disco_metrics_fd_metrics_snap_h
+#define HEADER_fd_src_disco_metrics_fd_metrics_snap_h
+
+/* fd_metrics_snap provides point in time copies of the metrics of every
+   tile, and a compact binary delta encoding of them for streaming to a
+   collector at a high rate, without rendering text.
+
+   A snap is a persistent shared memory object holding two snapshot
+   buffers of word_cnt ulongs.  It is written by exactly one writer (the
+   metric tile) and read by any number of observers.  The writer copies
+   the metrics regions of all tiles back to back into the buffer not
+   holding the latest snapshot, then publishes it with a timestamp.  The
+   tiles are never stalled or coordinated with: metrics are ulongs
+   written with single stores (see fd_metrics.h), so each word of a
+   snapshot is a value the tile actually wrote, but words of different
+   tiles (or of one tile) are not taken at exactly the same instant.
+
+   Because of the double buffering, a reader has a full snapshot period
+   to copy out the latest snapshot.  Readers detect the rare case where
+   they were too slow by checking the sequence number of the snapshot
+   being written did not reach the buffer they copied.
+
+   The layout of a snapshot is the metrics region of tile 0 of the
+   topology, then of tile 1, and so on.  Each region starts with its in
+   and out link counts (see fd_metrics.h), so a snapshot can be split
+   back into tiles without any other information. */
+
+#include "fd_metrics.h"
+
+/* FD_METRICS_SNAP_{ALIGN,FOOTPRINT} specify the alignment and footprint
+   needed for a snap of word_cnt words.  ALIGN is double cache line so
+   the header does not share lines with the buffers.  word_cnt is
+   assumed to be valid (see fd_metrics_snap_footprint). */
+
+#define FD_METRICS_SNAP_ALIGN               (128UL)
+#define FD_METRICS_SNAP_FOOTPRINT(word_cnt) (128UL + FD_ULONG_ALIGN_UP( 16UL*(word_cnt), 128UL ))
+
+/* FD_METRICS_SNAP_TILE_WORD_CNT is the number of words the metrics
+   region of a tile with the given in and out link counts takes up in a
+   snapshot.  This is the metrics region without its alignment
+   padding. */
+
+#define FD_METRICS_SNAP_TILE_WORD_CNT(in_link_cnt, out_link_reliable_consumer_cnt) \
+  (2UL + (in_link_cnt)*FD_METRICS_ALL_LINK_IN_TOTAL + (out_link_reliable_consumer_cnt)*FD_METRICS_ALL_LINK_OUT_TOTAL + FD_METRICS_TOTAL_SZ/sizeof(ulong))
+
+struct __attribute__((aligned(FD_METRICS_SNAP_ALIGN))) fd_metrics_snap_private {
+  ulong magic;     /* == FD_METRICS_SNAP_MAGIC */
+  ulong word_cnt;  /* Number of words in each snapshot */
+  ulong seq;       /* Sequence number of the latest published snapshot, 0 if none */
+  ulong wseq;      /* Sequence number of the snapshot being written, seq or seq+1 */
+  long  ts  [ 2 ]; /* fd_log_wallclock when the snapshot in each buffer was taken */
+  long  tick[ 2 ]; /* fd_tickcount when the snapshot in each buffer was taken */
+
+  /* Two buffers of word_cnt ulongs follow here, snapshot seq is in
+     buffer seq&1. */
+};
+
+typedef struct fd_metrics_snap_private fd_metrics_snap_t;
+
+/* A snapshot is streamed as one or more messages.  Each message covers
+   the words [word_lo,word_hi) of the snapshot, the messages of a
+   snapshot cover it in order, and the last one has the LAST flag set.
+   The payload of a message is a sequence of (gap,delta) pairs, one for
+   each word in the range that changed, in increasing word order.  gap
+   is the number of unchanged words skipped since the previous changed
+   word (or since word_lo), and delta is the difference between the new
+   and old value of the word, zigzag encoded so small decreases of
+   gauges are as compact as small increases of counters.  Both are
+   LEB128 varints.
+
+   A message with the KEY flag is a keyframe: the deltas are against
+   zero instead of the previous snapshot, so it can be applied without
+   any prior state.  Otherwise the message is against the snapshot with
+   sequence number seq-1, which the receiver must have applied in full.
+   The writer sends keyframes to new receivers and to receivers it had
+   to drop messages for, so a receiver on a reliable transport never
+   needs to ask for one. */
+
+#define FD_METRICS_SNAP_MSG_MAGIC (0xf17eda2c3a5a0000UL) /* firedancer metrics snap msg ver 0 */
+
+#define FD_METRICS_SNAP_MSG_FLAG_KEY  (1U)
+#define FD_METRICS_SNAP_MSG_FLAG_LAST (2U)
+
+struct fd_metrics_snap_msg_hdr {
+  ulong magic;    /* == FD_METRICS_SNAP_MSG_MAGIC */
+  ulong seq;      /* Sequence number of the snapshot */
+  long  ts;       /* fd_log_wallclock when the snapshot was taken */
+  long  tick;     /* fd_tickcount when the snapshot was taken */
+  uint  word_cnt; /* Number of words in a full snapshot */
+  uint  word_lo;  /* First word covered by this message */
+  uint  word_hi;  /* One past the last word covered by this message */
+  uint  flags;    /* FD_METRICS_SNAP_MSG_FLAG_* */
+};
+
+typedef struct fd_metrics_snap_msg_hdr fd_metrics_snap_msg_hdr_t;
+
+/* FD_METRICS_SNAP_MSG_MIN is the smallest buffer a message can be
+   encoded into, the header and one worst case (gap,delta) pair. */
+
+#define FD_METRICS_SNAP_MSG_MIN (sizeof(fd_metrics_snap_msg_hdr_t)+20UL)
+
+FD_PROTOTYPES_BEGIN
+
+/* fd_metrics_snap_{align,footprint} return the required alignment and
+   footprint of a memory region suitable for use as a snap of word_cnt
+   words.  footprint returns 0 if word_cnt is zero or does not fit in a
+   message header (UINT_MAX). */
+
+FD_FN_CONST ulong
+fd_metrics_snap_align( void );
+
+FD_FN_CONST ulong
+fd_metrics_snap_footprint( ulong word_cnt );
+
+/* fd_metrics_snap_{new,join,leave,delete} have the usual persistent
+   shared memory object semantics.  The snap is created with no
+   snapshot published and both buffers zero. */
+
+void *
+fd_metrics_snap_new( void * shmem,
+                     ulong  word_cnt );
+
+fd_metrics_snap_t *
+fd_metrics_snap_join( void * shsnap );
+
+void *
+fd_metrics_snap_leave( fd_metrics_snap_t const * snap );
+
+void *
+fd_metrics_snap_delete( void * shsnap );
+
+/* Accessors.  seq_query returns the sequence number of the latest
+   published snapshot (0 if none has been published yet).  buf returns
+   the buffer holding snapshot seq (only meaningful to the writer, or
+   to a reader that checks for overrun, see fd_metrics_snap_read). */
+
+FD_FN_PURE static inline ulong fd_metrics_snap_word_cnt( fd_metrics_snap_t const * snap ) { return snap->word_cnt; }
+
+static inline ulong
+fd_metrics_snap_seq_query( fd_metrics_snap_t const * snap ) {
+  FD_COMPILER_MFENCE();
+  ulong seq = FD_VOLATILE_CONST( snap->seq );
+  FD_COMPILER_MFENCE();
+  return seq;
+}
+
+static inline ulong *
+fd_metrics_snap_buf( fd_metrics_snap_t * snap,
+                     ulong               seq ) {
+  return (ulong *)(snap+1) + (seq&1UL)*snap->word_cnt;
+}
+
+FD_FN_PURE static inline ulong const *
+fd_metrics_snap_buf_const( fd_metrics_snap_t const * snap,
+                           ulong                     seq ) {
+  return (ulong const *)(snap+1) + (seq&1UL)*snap->word_cnt;
+}
+
+/* fd_metrics_snap_prepare starts writing the next snapshot and returns
+   the buffer to write it into.  The previous contents of the buffer
+   are the snapshot before the latest.  Only the single writer of the
+   snap should call this, and every prepare must be followed by a
+   publish. */
+
+static inline ulong *
+fd_metrics_snap_prepare( fd_metrics_snap_t * snap ) {
+  ulong seq = snap->seq + 1UL;
+  FD_COMPILER_MFENCE();
+  FD_VOLATILE( snap->wseq ) = seq;
+  FD_COMPILER_MFENCE();
+  return fd_metrics_snap_buf( snap, seq );
+}
+
+/* fd_metrics_snap_copy copies the metrics region of a tile into a
+   snapshot buffer at dst.  Every word is read with a single load, so
+   concurrent updates by the tile are never torn.  Returns the word
+   after the last one written. */
+
+static inline ulong *
+fd_metrics_snap_copy( ulong *       dst,
+                      ulong const * metrics ) {
+  ulong cnt = FD_METRICS_SNAP_TILE_WORD_CNT( metrics[ 0 ], metrics[ 1 ] );
+  for( ulong i=0UL; i<cnt; i++ ) dst[ i ] = FD_VOLATILE_CONST( metrics[ i ] );
+  return dst + cnt;
+}
+
+/* fd_metrics_snap_publish publishes the prepared snapshot, which was
+   taken at wallclock ts and tickcount tick.  Returns its sequence
+   number. */
+
+static inline ulong
+fd_metrics_snap_publish( fd_metrics_snap_t * snap,
+                         long                ts,
+                         long                tick ) {
+  ulong seq = snap->wseq;
+  snap->ts  [ seq&1UL ] = ts;
+  snap->tick[ seq&1UL ] = tick;
+  FD_COMPILER_MFENCE();
+  FD_VOLATILE( snap->seq ) = seq;
+  FD_COMPILER_MFENCE();
+  return seq;
+}
+
+/* fd_metrics_snap_read copies the latest published snapshot into out,
+   which has room for word_cnt words, and its timestamps into the
+   optional opt_ts and opt_tick.  Returns the sequence number of the
+   snapshot copied, or 0 if no snapshot has been published yet (out is
+   untouched).  Retries if the writer overran the snapshot while it
+   was being copied, which requires the reader to be slower than a
+   snapshot period. */
+
+ulong
+fd_metrics_snap_read( fd_metrics_snap_t const * snap,
+                      ulong *                   out,
+                      long *                    opt_ts,
+                      long *                    opt_tick );
+
+/* fd_metrics_snap_msg_encode encodes the message of a snapshot
+   starting at word word_lo into out, which has room for out_max bytes
+   (at least FD_METRICS_SNAP_MSG_MIN).  cur is the snapshot of word_cnt
+   words with sequence number seq taken at ts and tick, and prev is the
+   snapshot before it, or NULL to encode a keyframe.  The message
+   covers as many words as fit.  On return, *out_sz is the size of the
+   message, and the return value is the first word not covered by it,
+   which is word_cnt for the last message of the snapshot.  The first
+   message of a snapshot has word_lo zero. */
+
+ulong
+fd_metrics_snap_msg_encode( ulong const * prev,
+                            ulong const * cur,
+                            ulong         word_cnt,
+                            ulong         word_lo,
+                            ulong         seq,
+                            long          ts,
+                            long          tick,
+                            uchar *       out,
+                            ulong         out_max,
+                            ulong *       out_sz );
+
+/* fd_metrics_snap_msg_apply applies the message of sz bytes at msg to
+   the snapshot of word_cnt words at words, which holds the snapshot
+   before it (or anything, if the message is a keyframe).  If opt_hdr
+   is non-NULL, it gets the header of the message.  Returns 0 on
+   success, and -1 if the message is malformed or is for a snapshot of
+   a different size, in which case words may have been partially
+   updated and the receiver should wait for a keyframe. */
+
+int
+fd_metrics_snap_msg_apply( uchar const *               msg,
+                           ulong                       sz,
+                           ulong *                     words,
+                           ulong                       word_cnt,
+                           fd_metrics_snap_msg_hdr_t * opt_hdr );
+
+FD_PROTOTYPES_END
+
+#endif /* HEADER_fd_src_disco_metrics_fd_metrics_snap_h */
@@ -0,0 +1,241 @@
+#ifndef HEADER_fd_src_disco_prof_fd_prof_h
+#define HEADER_fd_src_disco_prof_fd_prof_h
+
+/* fd_prof provides a low overhead, always available way of attributing
+   CPU time of a tile to the run loop callbacks it executes, without
+   needing perf, kernel privileges or any syscalls (so it works from
+   inside the fd_sandbox seccomp filter).
+
+   A prof is a persistent shared memory object written by exactly one
+   tile and read by any number of observers (e.g. `fdctl prof`).  The
+   tile records a TSC stamped (enter,duration) event for every callback
+   invocation into a ring of depth records.  Alongside the ring, the
+   prof keeps running per event totals of invocation counts and ticks,
+   so observers that fall behind the ring (it is expected this will
+   happen on busy tiles) still get exact time breakdowns, and only lose
+   the per event detail (per in link attribution, maximum durations).
+
+   The ring uses the same speculative read protocol as an mcache: the
+   writer marks a record as being updated by writing its sequence number
+   minus one, writes the payload, then publishes the record by writing
+   its sequence number.  Readers copy the record and then verify the
+   sequence number was not changed underneath them. */
+
+#include "../fd_disco_base.h"
+
+/* FD_PROF_EVT_* identify the run loop regions that are profiled.
+   HOUSEKEEPING covers the entire housekeeping event of the run loop and
+   the DURING_HOUSEKEEPING and METRICS_WRITE callbacks are nested inside
+   of it.  All other events are top level and never nested. */
+
+#define FD_PROF_EVT_HOUSEKEEPING        (0UL)
+#define FD_PROF_EVT_DURING_HOUSEKEEPING (1UL)
+#define FD_PROF_EVT_METRICS_WRITE       (2UL)
+#define FD_PROF_EVT_BEFORE_CREDIT       (3UL)
+#define FD_PROF_EVT_AFTER_CREDIT        (4UL)
+#define FD_PROF_EVT_BEFORE_FRAG         (5UL)
+#define FD_PROF_EVT_DURING_FRAG         (6UL)
+#define FD_PROF_EVT_AFTER_FRAG          (7UL)
+#define FD_PROF_EVT_CNT                 (8UL)
+
+/* FD_PROF_IN_IDX_NONE is the in_idx recorded for events that are not
+   associated with a particular in link. */
+
+#define FD_PROF_IN_IDX_NONE (UINT_MAX)
+
+/* FD_PROF_{ALIGN,FOOTPRINT} specify the alignment and footprint needed
+   for a prof with depth records.  ALIGN is double cache line to
+   mitigate false sharing between the writer's sequence number and the
+   records.  depth is assumed to be a valid depth (see fd_prof_new). */
+
+#define FD_PROF_ALIGN            (128UL)
+#define FD_PROF_FOOTPRINT(depth) (384UL + 32UL*(depth))
+
+/* FD_PROF_DEPTH_MIN is the minimum depth of a prof ring. */
+
+#define FD_PROF_DEPTH_MIN (32UL)
+
+/* An fd_prof_rec_t is a single profiled event.  seq is the sequence
+   number of the event, ts is the fd_tickcount when the event started
+   and dur the number of ticks it took.  evt is one of FD_PROF_EVT_* and
+   in_idx is the index of the in link being handled or
+   FD_PROF_IN_IDX_NONE. */
+
+struct fd_prof_rec {
+  ulong seq;
+  long  ts;
+  ulong dur;
+  uint  evt;
+  uint  in_idx;
+};
+
+typedef struct fd_prof_rec fd_prof_rec_t;
+
+/* fd_prof_t is the shared memory layout of a prof.  Readers should only
+   access it through the accessors below. */
+
+struct __attribute__((aligned(FD_PROF_ALIGN))) fd_prof_private {
+  ulong magic;     /* == FD_PROF_MAGIC */
+  ulong depth;     /* Number of records in the ring, a power of two */
+  long  ts0;       /* fd_tickcount when the writer registered, 0 if never registered */
+
+  /* Written only by the producer, on cache lines of its own */
+  ulong seq __attribute__((aligned(FD_PROF_ALIGN)));
+  ulong evt_cnt  [ FD_PROF_EVT_CNT ];
+  ulong evt_ticks[ FD_PROF_EVT_CNT ];
+
+  /* depth fd_prof_rec_t follow here */
+};
+
+typedef struct fd_prof_private fd_prof_t;
+
+FD_STATIC_ASSERT( sizeof(fd_prof_rec_t)==32UL,  fd_prof );
+FD_STATIC_ASSERT( sizeof(fd_prof_t)    ==384UL, fd_prof );
+
+FD_PROTOTYPES_BEGIN
+
+/* fd_prof_tl is the prof registered by the calling thread, or NULL if
+   the thread is not profiled.  It is read by the mux run loop when it
+   boots to determine if it should record callback events. */
+
+extern FD_TL fd_prof_t * fd_prof_tl;
+
+/* fd_prof_{align,footprint} return the required alignment and footprint
+   of a memory region suitable for use as a prof with depth records.
+   footprint returns 0 if depth is not a power of two of at least
+   FD_PROF_DEPTH_MIN. */
+
+FD_FN_CONST ulong
+fd_prof_align( void );
+
+FD_FN_CONST ulong
+fd_prof_footprint( ulong depth );
+
+/* fd_prof_{new,join,leave,delete} have the usual persistent shared
+   memory object semantics.  The prof will be created with all totals
+   zero and no records published. */
+
+void *
+fd_prof_new( void * shmem,
+             ulong  depth );
+
+fd_prof_t *
+fd_prof_join( void * shprof );
+
+void *
+fd_prof_leave( fd_prof_t const * prof );
+
+void *
+fd_prof_delete( void * shprof );
+
+/* fd_prof_register sets the calling thread's fd_prof_tl to prof and
+   stamps the time the writer started recording.  prof may be NULL to
+   disable profiling for the calling thread.  Returns prof. */
+
+fd_prof_t *
+fd_prof_register( fd_prof_t * prof );
+
+/* fd_prof_record publishes an event which started at tickcount t0 and
+   finished at tickcount t1.  Only the single writer of the prof should
+   call this.  This is a handful of stores to cache lines owned by the
+   writer and is safe to call in the hot loop. */
+
+static inline void
+fd_prof_record( fd_prof_t * prof,
+                ulong       evt,
+                ulong       in_idx,
+                long        t0,
+                long        t1 ) {
+  ulong           seq = prof->seq;
+  ulong           dur = (ulong)fd_long_max( t1-t0, 0L );
+  fd_prof_rec_t * rec = (fd_prof_rec_t *)(prof+1) + (seq & (prof->depth-1UL));
+
+  FD_COMPILER_MFENCE();
+  FD_VOLATILE( rec->seq ) = fd_seq_dec( seq, 1UL );
+  FD_COMPILER_MFENCE();
+  rec->ts     = t0;
+  rec->dur    = dur;
+  rec->evt    = (uint)evt;
+  rec->in_idx = (uint)in_idx;
+  FD_COMPILER_MFENCE();
+  FD_VOLATILE( rec->seq ) = seq;
+  FD_COMPILER_MFENCE();
+
+  prof->evt_cnt  [ evt ]++;
+  prof->evt_ticks[ evt ] += dur;
+  FD_VOLATILE( prof->seq ) = fd_seq_inc( seq, 1UL );
+}
+
+/* fd_prof_{depth,ts0} return the ring depth and the time the writer
+   registered with the prof (0 if it has not yet). */
+
+FD_FN_PURE static inline ulong fd_prof_depth( fd_prof_t const * prof ) { return prof->depth; }
+static inline long fd_prof_ts0( fd_prof_t const * prof ) { return FD_VOLATILE_CONST( prof->ts0 ); }
+
+/* fd_prof_seq_query returns the sequence number of the next event the
+   writer will publish.  Events in [seq-depth,seq) are potentially
+   readable. */
+
+static inline ulong
+fd_prof_seq_query( fd_prof_t const * prof ) {
+  FD_COMPILER_MFENCE();
+  ulong seq = FD_VOLATILE_CONST( prof->seq );
+  FD_COMPILER_MFENCE();
+  return seq;
+}
+
+/* fd_prof_totals copies the running invocation counts and tick totals
+   of every event into cnt and ticks (indexed by FD_PROF_EVT_*).  The
+   totals are observed non-atomically at some point during the call,
+   which is fine for diagnostic use. */
+
+static inline void
+fd_prof_totals( fd_prof_t const * prof,
+                ulong             cnt  [ FD_PROF_EVT_CNT ],
+                ulong             ticks[ FD_PROF_EVT_CNT ] ) {
+  FD_COMPILER_MFENCE();
+  for( ulong i=0UL; i<FD_PROF_EVT_CNT; i++ ) {
+    cnt  [ i ] = FD_VOLATILE_CONST( prof->evt_cnt  [ i ] );
+    ticks[ i ] = FD_VOLATILE_CONST( prof->evt_ticks[ i ] );
+  }
+  FD_COMPILER_MFENCE();
+}
+
+/* fd_prof_read speculatively copies the record with sequence number seq
+   into rec.  Returns 0 on success, a negative value if the record has
+   not been published yet, and a positive value if the reader was
+   overrun (the record was overwritten by a newer event, in which case
+   the caller should resume from fd_prof_seq_query( prof )-depth or
+   later). */
+
+static inline int
+fd_prof_read( fd_prof_t const * prof,
+              ulong             seq,
+              fd_prof_rec_t *   rec ) {
+  fd_prof_rec_t const * src = (fd_prof_rec_t const *)(prof+1) + (seq & (prof->depth-1UL));
+
+  FD_COMPILER_MFENCE();
+  ulong seq0 = FD_VOLATILE_CONST( src->seq );
+  FD_COMPILER_MFENCE();
+  rec->ts     = src->ts;
+  rec->dur    = src->dur;
+  rec->evt    = src->evt;
+  rec->in_idx = src->in_idx;
+  FD_COMPILER_MFENCE();
+  ulong seq1 = FD_VOLATILE_CONST( src->seq );
+  FD_COMPILER_MFENCE();
+
+  rec->seq = seq;
+  if( FD_LIKELY( (seq0==seq) & (seq1==seq) ) ) return 0;
+  return fd_int_if( fd_seq_gt( seq1, seq ), 1, -1 );
+}
+
+/* fd_prof_evt_cstr returns a static cstr with the name of the event,
+   suitable for use as a frame in folded stack output. */
+
+FD_FN_CONST char const *
+fd_prof_evt_cstr( ulong evt );
+
+FD_PROTOTYPES_END
+
+#endif /* HEADER_fd_src_disco_prof_fd_prof_h */
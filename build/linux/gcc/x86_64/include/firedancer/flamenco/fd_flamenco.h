@@ -0,0 +1,17 @@
+#ifndef HEADER_fd_src_flamenco_fd_flamenco_h
+#define HEADER_fd_src_flamenco_fd_flamenco_h
+
+#include "fd_flamenco_base.h"
+
+FD_PROTOTYPES_BEGIN
+
+void
+fd_flamenco_boot( int *    pargc,
+                  char *** pargv );
+
+void
+fd_flamenco_halt( void );
+
+FD_PROTOTYPES_END
+
+#endif /* HEADER_fd_src_flamenco_fd_flamenco_h */
@@ -18,13 +18,14 @@ $(OBJDIR)/obj/app/fdctl/version.d: src/app/fdctl/version.h
 .PHONY: fdctl cargo-validator cargo-solana rust solana check-solana-hash
 
 # fdctl core
-$(call add-objs,main1 config caps utility keys ready mem spy help version,fd_fdctl)
+$(call add-objs,main1 config caps utility keys ready mem prof layout spy help version,fd_fdctl)
 $(call add-objs,run/run run/run1 run/run_solana run/topos/topos,fd_fdctl)
 $(call add-objs,monitor/monitor monitor/helper,fd_fdctl)
 
 # fdctl tiles
 $(call add-objs,run/tiles/fd_net,fd_fdctl)
 $(call add-objs,run/tiles/fd_metric,fd_fdctl)
+$(call add-objs,run/tiles/fd_ingest,fd_fdctl)
 $(call add-objs,run/tiles/fd_netmux,fd_fdctl)
 $(call add-objs,run/tiles/fd_dedup,fd_fdctl)
 $(call add-objs,run/tiles/fd_pack,fd_fdctl)
@@ -83,6 +84,7 @@ $(OBJDIR)/obj/app/fdctl/run/tiles/fd_shred.o: src/app/fdctl/run/tiles/generated/
 $(OBJDIR)/obj/app/fdctl/run/tiles/fd_verify.o: src/app/fdctl/run/tiles/generated/verify_seccomp.h
 $(OBJDIR)/obj/app/fdctl/run/tiles/fd_metric.o: src/app/fdctl/run/tiles/generated/metric_seccomp.h
 $(OBJDIR)/obj/app/fdctl/run/tiles/fd_sign.o: src/app/fdctl/run/tiles/generated/sign_seccomp.h
+$(OBJDIR)/obj/app/fdctl/run/tiles/fd_ingest.o: src/app/fdctl/run/tiles/generated/ingest_seccomp.h
 ifdef FD_HAS_NO_SOLANA
 $(OBJDIR)/obj/app/fdctl/run/tiles/fd_repair.o: src/app/fdctl/run/tiles/generated/repair_seccomp.h
 $(OBJDIR)/obj/app/fdctl/run/tiles/fd_gossip.o: src/app/fdctl/run/tiles/generated/gossip_seccomp.h
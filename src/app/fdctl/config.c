@@ -18,6 +18,7 @@
 #include <arpa/inet.h>
 #include <sys/mman.h>
 #include <sys/stat.h>
+#include <sys/un.h>
 #include <sys/sysinfo.h>
 #include <sys/ioctl.h>
 #include <sys/utsname.h>
@@ -235,6 +236,7 @@ static int parse_key_value( config_t *   config,
   ENTRY_UINT  ( ., layout,              net_tile_count                                            );
   ENTRY_UINT  ( ., layout,              quic_tile_count                                           );
   ENTRY_UINT  ( ., layout,              verify_tile_count                                         );
+  ENTRY_UINT  ( ., layout,              pack_tile_count                                           );
   ENTRY_UINT  ( ., layout,              bank_tile_count                                           );
   ENTRY_UINT  ( ., layout,              shred_tile_count                                          );
 
@@ -270,6 +272,12 @@ static int parse_key_value( config_t *   config,
   ENTRY_USHORT( ., tiles.shred,         shred_listen_port                                         );
 
   ENTRY_USHORT( ., tiles.metric,        prometheus_listen_port                                    );
+  ENTRY_UINT  ( ., tiles.metric,        profile_ring_depth                                        );
+  ENTRY_UINT  ( ., tiles.metric,        snapshot_hz                                               );
+  ENTRY_STR   ( ., tiles.metric,        snapshot_socket_path                                      );
+
+  ENTRY_UINT  ( ., tiles.ingest,        ring_count                                                );
+  ENTRY_UINT  ( ., tiles.ingest,        ring_depth                                                );
 
   ENTRY_BOOL  ( ., development,         sandbox                                                   );
   ENTRY_BOOL  ( ., development,         no_clone                                                  );
@@ -308,9 +316,11 @@ static int parse_key_value( config_t *   config,
   ENTRY_STR   ( ., tiles.replay,        genesis                                                   );
   ENTRY_STR   ( ., tiles.replay,        capture                                                   );
   ENTRY_ULONG ( ., tiles.replay,        tpool_thread_count                                        );
+  ENTRY_ULONG ( ., tiles.replay,        tpool_worker_scratch_mb                                   );
   ENTRY_ULONG ( ., tiles.replay,        funk_sz_gb                                                );
   ENTRY_ULONG ( ., tiles.replay,        funk_txn_max                                              );
   ENTRY_ULONG ( ., tiles.replay,        funk_rec_max                                              );
+  ENTRY_BOOL  ( ., tiles.replay,        stream_entry_batches                                      );
 
   ENTRY_USHORT( ., tiles.gossip,        gossip_listen_port                                        );
   ENTRY_VUINT ( ., tiles.gossip,        peer_ports                                                );
@@ -601,6 +611,14 @@ fdctl_obj_align( fd_topo_t const *     topo,
     return fd_fseq_align();
   } else if( FD_UNLIKELY( !strcmp( obj->name, "metrics" ) ) ) {
     return FD_METRICS_ALIGN;
+  } else if( FD_UNLIKELY( !strcmp( obj->name, "metrics_snap" ) ) ) {
+    return fd_metrics_snap_align();
+  } else if( FD_UNLIKELY( !strcmp( obj->name, "prof" ) ) ) {
+    return fd_prof_align();
+  } else if( FD_UNLIKELY( !strcmp( obj->name, "pack_shard" ) ) ) {
+    return fd_pack_shard_align();
+  } else if( FD_UNLIKELY( !strcmp( obj->name, "ingest" ) ) ) {
+    return fd_ingest_align();
   } else {
     FD_LOG_ERR(( "unknown object `%s`", obj->name ));
     return 0UL;
@@ -643,6 +661,14 @@ fdctl_obj_footprint( fd_topo_t const *     topo,
     return fd_fseq_footprint();
   } else if( FD_UNLIKELY( !strcmp( obj->name, "metrics" ) ) ) {
     return FD_METRICS_FOOTPRINT( VAL("in_cnt"), VAL("out_cnt") );
+  } else if( FD_UNLIKELY( !strcmp( obj->name, "metrics_snap" ) ) ) {
+    return fd_metrics_snap_footprint( VAL("word_cnt") );
+  } else if( FD_UNLIKELY( !strcmp( obj->name, "prof" ) ) ) {
+    return fd_prof_footprint( VAL("depth") );
+  } else if( FD_UNLIKELY( !strcmp( obj->name, "pack_shard" ) ) ) {
+    return fd_pack_shard_footprint( VAL("lg_bucket_cnt") );
+  } else if( FD_UNLIKELY( !strcmp( obj->name, "ingest" ) ) ) {
+    return fd_ingest_footprint();
   } else {
     FD_LOG_ERR(( "unknown object `%s`", obj->name ));
     return 0UL;
@@ -1032,6 +1058,32 @@ config_parse( int *      pargc,
                                    config->scratch_directory ) );
   }
 
+  if( FD_UNLIKELY( config->tiles.metric.profile_ring_depth && !fd_prof_footprint( config->tiles.metric.profile_ring_depth ) ) )
+    FD_LOG_ERR(( "configuration specifies invalid [tiles.metric.profile_ring_depth] `%u`. "
+                 "This must be zero to disable profiling, or a power of two of at least %lu",
+                 config->tiles.metric.profile_ring_depth, FD_PROF_DEPTH_MIN ));
+
+  if( FD_UNLIKELY( config->tiles.metric.snapshot_hz>10000U ) )
+    FD_LOG_ERR(( "configuration specifies invalid [tiles.metric.snapshot_hz] `%u`. "
+                 "This must be zero to disable snapshots, or at most 10000",
+                 config->tiles.metric.snapshot_hz ));
+  if( FD_UNLIKELY( strcmp( config->tiles.metric.snapshot_socket_path, "" ) ) ) {
+    if( FD_UNLIKELY( !config->tiles.metric.snapshot_hz ) )
+      FD_LOG_ERR(( "configuration specifies [tiles.metric.snapshot_socket_path] but snapshots are disabled with [tiles.metric.snapshot_hz] of zero" ));
+    if( FD_UNLIKELY( strlen( config->tiles.metric.snapshot_socket_path )>=sizeof(((struct sockaddr_un *)NULL)->sun_path) ) )
+      FD_LOG_ERR(( "configuration specifies [tiles.metric.snapshot_socket_path] `%s` which is too long for a Unix socket path",
+                   config->tiles.metric.snapshot_socket_path ));
+  }
+
+  if( FD_UNLIKELY( config->tiles.ingest.ring_count>FD_INGEST_RING_MAX ) )
+    FD_LOG_ERR(( "configuration specifies invalid [tiles.ingest.ring_count] `%u`. "
+                 "This must be zero to disable shared memory ingest, or at most %lu",
+                 config->tiles.ingest.ring_count, FD_INGEST_RING_MAX ));
+  if( FD_UNLIKELY( config->tiles.ingest.ring_count && !fd_mcache_footprint( config->tiles.ingest.ring_depth, 0UL ) ) )
+    FD_LOG_ERR(( "configuration specifies invalid [tiles.ingest.ring_depth] `%u`. "
+                 "This must be a power of two of at least %lu",
+                 config->tiles.ingest.ring_depth, FD_MCACHE_BLOCK ));
+
   validate_ports( config );
   topo_initialize( config );
 }
@@ -121,6 +121,7 @@ typedef struct {
     uint net_tile_count;
     uint quic_tile_count;
     uint verify_tile_count;
+    uint pack_tile_count;
     uint bank_tile_count;
     uint shred_tile_count;
   } layout;
@@ -223,8 +224,16 @@ typedef struct {
 
     struct {
       ushort prometheus_listen_port;
+      uint   profile_ring_depth;
+      uint   snapshot_hz;
+      char   snapshot_socket_path[ PATH_MAX ];
     } metric;
 
+    struct {
+      uint ring_count;
+      uint ring_depth;
+    } ingest;
+
     /* Firedancer-only tile configs */
     struct {
       ushort gossip_listen_port;
@@ -245,9 +254,11 @@ typedef struct {
       char  genesis[ PATH_MAX ];
       char  capture[ PATH_MAX ];
       ulong tpool_thread_count;
+      ulong tpool_worker_scratch_mb;
       ulong funk_sz_gb;
       ulong funk_txn_max;
       ulong funk_rec_max;
+      int   stream_entry_batches;
     } replay;
 
   } tiles;
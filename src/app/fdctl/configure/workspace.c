@@ -59,6 +59,14 @@ fdctl_obj_new( fd_topo_t const *     topo,
     fd_fseq_new( laddr, ULONG_MAX );
   } else if( FD_UNLIKELY( !strcmp( obj->name, "metrics" ) ) ) {
     fd_metrics_new( laddr, VAL("in_cnt"), VAL("out_cnt") );
+  } else if( FD_UNLIKELY( !strcmp( obj->name, "metrics_snap" ) ) ) {
+    fd_metrics_snap_new( laddr, VAL("word_cnt") );
+  } else if( FD_UNLIKELY( !strcmp( obj->name, "prof" ) ) ) {
+    fd_prof_new( laddr, VAL("depth") );
+  } else if( FD_UNLIKELY( !strcmp( obj->name, "pack_shard" ) ) ) {
+    fd_pack_shard_new( laddr, VAL("shard_cnt"), VAL("lg_bucket_cnt"), VAL("max_write_cost") );
+  } else if( FD_UNLIKELY( !strcmp( obj->name, "ingest" ) ) ) {
+    fd_ingest_new( laddr, VAL("ring_cnt") );
   } else {
     FD_LOG_ERR(( "unknown object `%s`", obj->name ));
   }
@@ -73,6 +73,16 @@ typedef union {
     char name[ 13UL ];
   } flame;
 
+  struct {
+    long duration;
+    int  folded;
+  } prof;
+
+  struct {
+    int  metrics;
+    char cpus[ AFFINITY_SZ ];
+  } layout;
+
   struct {
     char    affinity[ AFFINITY_SZ ];
     uint    tpu_ip;
@@ -113,7 +123,7 @@ fdctl_obj_loose( fd_topo_t const *     topo,
 fd_topo_run_tile_t
 fdctl_tile_run( fd_topo_tile_t * tile );
 
-#define ACTIONS_CNT (11UL)
+#define ACTIONS_CNT (13UL)
 extern action_t ACTIONS[ ACTIONS_CNT ];
 
 void fdctl_boot( int *        pargc,
@@ -193,6 +203,34 @@ void
 mem_cmd_fn( args_t *         args,
             config_t * const config );
 
+void
+prof_cmd_args( int *    pargc,
+               char *** pargv,
+               args_t * args );
+
+void
+prof_cmd_fn( args_t *         args,
+             config_t * const config );
+
+void
+layout_cmd_args( int *    pargc,
+                 char *** pargv,
+                 args_t * args );
+
+void
+layout_cmd_fn( args_t *         args,
+               config_t * const config );
+
+/* layout_auto_tiles places the tiles of the topology on CPUs and
+   layout_auto_wksps places the workspaces on NUMA nodes, for an
+   affinity of "auto".  See fd_topo_place.h. */
+
+void
+layout_auto_tiles( config_t * config );
+
+void
+layout_auto_wksps( config_t * config );
+
 void
 spy_cmd_fn( args_t *         args,
             config_t * const config );
@@ -0,0 +1,184 @@
+#include "fdctl.h"
+
+#include "../../disco/topo/fd_topo_place.h"
+#include "../../util/tile/fd_tile_private.h"
+
+#include <stdio.h>
+
+/* layout places the tiles of the topology on CPUs, and the workspaces
+   on NUMA nodes, according to the CPU and cache topology of the host
+   and the traffic between the tiles (see fd_topo_place.h).
+
+   With [layout.affinity] set to "auto" this is done at boot with the
+   bandwidth hints of the topology.  The `layout` command instead
+   reports the cost of the configured layout against the proposed one,
+   optionally using the link metrics of a running (or previous) instance
+   as the traffic, and prints an affinity string which can be pasted
+   into the configuration file. */
+
+static fd_topo_place_t place;
+
+void
+layout_cmd_args( int *    pargc,
+                 char *** pargv,
+                 args_t * args ) {
+  args->layout.metrics = fd_env_strip_cmdline_contains( pargc, pargv, "--metrics" );
+
+  char const * cpus = fd_env_strip_cmdline_cstr( pargc, pargv, "--cpus", NULL, "" );
+  if( FD_UNLIKELY( strlen( cpus )>=sizeof(args->layout.cpus) ) ) FD_LOG_ERR(( "--cpus too long" ));
+  strncpy( args->layout.cpus, cpus, sizeof(args->layout.cpus) );
+}
+
+/* layout_cpus fills cpu_idx with the CPUs the tiles may be placed on
+   and returns their count.  If cpus is a non-empty CPU list, these are
+   the CPUs in it.  Otherwise they are all the online CPUs, except for
+   the core of CPU 0 (which is left for the kernel) and the Solana Labs
+   CPUs, using only one CPU of each core if that leaves enough CPUs for
+   the tiles. */
+
+static ulong
+layout_cpus( config_t const * config,
+             char const *     cpus,
+             ulong *          cpu_idx ) {
+  fd_topo_cpus_t const * host = &place.cpus;
+
+  ushort parsed[ FD_TILE_MAX ];
+  if( FD_UNLIKELY( strcmp( cpus, "" ) ) ) {
+    ulong cnt = fd_tile_private_cpus_parse( cpus, parsed );
+    for( ulong i=0UL; i<cnt; i++ ) {
+      if( FD_UNLIKELY( parsed[ i ]==USHORT_MAX ) ) FD_LOG_ERR(( "floating CPUs are not supported in --cpus" ));
+      cpu_idx[ i ] = parsed[ i ];
+    }
+    return cnt;
+  }
+
+  uchar excluded[ FD_SHMEM_CPU_MAX ] = {0};
+  if( FD_LIKELY( strcmp( config->layout.solana_labs_affinity, "" ) ) ) {
+    ulong cnt = fd_tile_private_cpus_parse( config->layout.solana_labs_affinity, parsed );
+    for( ulong i=0UL; i<cnt; i++ ) if( FD_LIKELY( parsed[ i ]<FD_SHMEM_CPU_MAX ) ) excluded[ parsed[ i ] ] = 1;
+  }
+
+  ulong cnt = 0UL;
+  for( int all=0; all<2 && cnt<config->topo.tile_cnt; all++ ) {
+    cnt = 0UL;
+    for( ulong i=0UL; i<host->cpu_cnt; i++ ) {
+      if( FD_UNLIKELY( !host->cpu[ i ].online || excluded[ i ] || host->cpu[ i ].core_idx==host->cpu[ 0 ].core_idx ) ) continue;
+      if( FD_UNLIKELY( !all && host->cpu[ i ].core_idx!=i ) ) continue;
+      cpu_idx[ cnt++ ] = i;
+    }
+  }
+  return cnt;
+}
+
+static void
+layout_init( config_t * config,
+             int        metrics ) {
+  if( FD_UNLIKELY( !fd_topo_cpus_init( &place.cpus ) ) ) FD_LOG_ERR(( "unable to determine the CPU topology of the host" ));
+  place.nic_numa_idx = fd_topo_nic_numa_idx( config->tiles.net.interface );
+
+  if( FD_LIKELY( !metrics ) ) {
+    fd_topo_place_bw_hint( &place, &config->topo );
+  } else {
+    fd_topo_t * topo = &config->topo;
+    ulong wksp_id = fd_topo_find_wksp( topo, "metric_in" );
+    FD_TEST( wksp_id!=ULONG_MAX );
+
+    fd_topo_join_workspace( topo, &topo->workspaces[ wksp_id ], FD_SHMEM_JOIN_MODE_READ_ONLY );
+    fd_topo_workspace_fill( topo, &topo->workspaces[ wksp_id ] );
+    fd_topo_place_bw_metrics( &place, topo );
+  }
+}
+
+void
+layout_auto_tiles( config_t * config ) {
+  layout_init( config, 0 );
+
+  ulong cpu_idx[ FD_SHMEM_CPU_MAX ];
+  ulong cpu_cnt = layout_cpus( config, "", cpu_idx );
+  fd_topo_place_tiles( &place, &config->topo, cpu_idx, cpu_cnt );
+}
+
+void
+layout_auto_wksps( config_t * config ) {
+  fd_topo_place_wksps( &place, &config->topo );
+}
+
+/* print_affinity prints the CPUs of the tiles in tile order as an
+   affinity string, collapsing runs of consecutive CPUs. */
+
+static void
+print_affinity( fd_topo_t const * topo ) {
+  printf( "affinity = \"" );
+  for( ulong i=0UL; i<topo->tile_cnt; ) {
+    ulong j = i+1UL;
+    while( j<topo->tile_cnt && topo->tiles[ j ].cpu_idx==topo->tiles[ j-1UL ].cpu_idx+1UL ) j++;
+    if( i ) printf( "," );
+    if( j-i>1UL ) printf( "%lu-%lu", topo->tiles[ i ].cpu_idx, topo->tiles[ j-1UL ].cpu_idx );
+    else          printf( "%lu", topo->tiles[ i ].cpu_idx );
+    i = j;
+  }
+  printf( "\"\n" );
+}
+
+static void
+print_cpu( fd_topo_cpus_t const * cpus,
+           ulong                  cpu_idx ) {
+  if( FD_UNLIKELY( cpu_idx>=cpus->cpu_cnt ) ) printf( " %6s %6s %6s", "float", "-", "-" );
+  else printf( " %6lu %6lu %6lu", cpu_idx, cpus->cpu[ cpu_idx ].numa_idx, cpus->cpu[ cpu_idx ].l3_idx );
+}
+
+void
+layout_cmd_fn( args_t *         args,
+               config_t * const config ) {
+  fd_topo_t * topo = &config->topo;
+
+  layout_init( config, args->layout.metrics );
+
+  fd_topo_cpus_t const * cpus = &place.cpus;
+  ulong online_cnt = 0UL;
+  for( ulong i=0UL; i<cpus->cpu_cnt; i++ ) online_cnt += (ulong)cpus->cpu[ i ].online;
+  printf( "host: %lu CPUs online, %lu NUMA nodes, %lu L3 caches", online_cnt, cpus->numa_cnt, cpus->l3_cnt );
+  if( FD_LIKELY( place.nic_numa_idx!=ULONG_MAX ) ) printf( ", %s on NUMA node %lu\n", config->tiles.net.interface, place.nic_numa_idx );
+  else                                             printf( "\n" );
+  printf( "traffic: %s\n\n", args->layout.metrics ? "link metrics of the running instance" : "bandwidth hints of the topology" );
+
+  ulong cur_cpu [ FD_TOPO_MAX_TILES ];
+  ulong cur_numa[ FD_TOPO_MAX_WKSPS ];
+  for( ulong i=0UL; i<topo->tile_cnt; i++ ) cur_cpu [ i ] = topo->tiles[ i ].cpu_idx;
+  for( ulong i=0UL; i<topo->wksp_cnt; i++ ) cur_numa[ i ] = topo->workspaces[ i ].numa_idx;
+
+  ulong cur_l3, cur_cross_numa;
+  ulong cur_cost = fd_topo_place_cost( &place, topo, &cur_l3, &cur_cross_numa );
+
+  ulong cpu_idx[ FD_SHMEM_CPU_MAX ];
+  ulong cpu_cnt = layout_cpus( config, args->layout.cpus, cpu_idx );
+  fd_topo_place_tiles( &place, topo, cpu_idx, cpu_cnt );
+  fd_topo_place_wksps( &place, topo );
+
+  ulong new_l3, new_cross_numa;
+  ulong new_cost = fd_topo_place_cost( &place, topo, &new_l3, &new_cross_numa );
+
+  printf( "%-10s %16s %16s %16s\n", "layout", "cost", "cross-L3", "cross-NUMA" );
+  printf( "%-10s %16lu %16lu %16lu\n", "current",  cur_cost, cur_l3, cur_cross_numa );
+  printf( "%-10s %16lu %16lu %16lu\n\n", "proposed", new_cost, new_l3, new_cross_numa );
+
+  printf( "%-14s %20s   %20s\n", "", "current", "proposed" );
+  printf( "%-14s %6s %6s %6s   %6s %6s %6s\n", "tile", "cpu", "numa", "l3", "cpu", "numa", "l3" );
+  for( ulong i=0UL; i<topo->tile_cnt; i++ ) {
+    char name[ 32 ];
+    printf( "%-14s", fd_cstr_printf( name, sizeof(name), NULL, "%s:%lu", topo->tiles[ i ].name, topo->tiles[ i ].kind_id ) );
+    print_cpu( cpus, cur_cpu[ i ] );
+    printf( "  " );
+    print_cpu( cpus, topo->tiles[ i ].cpu_idx );
+    printf( "\n" );
+  }
+
+  printf( "\n%-14s %8s %8s\n", "wksp", "current", "proposed" );
+  for( ulong i=0UL; i<topo->wksp_cnt; i++ ) {
+    if( FD_LIKELY( cur_numa[ i ]==topo->workspaces[ i ].numa_idx ) ) continue;
+    printf( "%-14s %8lu %8lu\n", topo->workspaces[ i ].name, cur_numa[ i ], topo->workspaces[ i ].numa_idx );
+  }
+
+  printf( "\n[layout]\n    " );
+  print_affinity( topo );
+}
@@ -16,6 +16,8 @@ action_t ACTIONS[ ACTIONS_CNT ] = {
   { .name = "keys",       .args = keys_cmd_args,      .fn = keys_cmd_fn,       .perm = NULL,                .description = "Generate new keypairs for use with the validator or print a public key" },
   { .name = "ready",      .args = NULL,               .fn = ready_cmd_fn,      .perm = NULL,                .description = "Wait for all tiles to be running" },
   { .name = "mem",        .args = NULL,               .fn = mem_cmd_fn,        .perm = NULL,                .description = "Print workspace memory and tile topology information" },
+  { .name = "prof",       .args = prof_cmd_args,      .fn = prof_cmd_fn,       .perm = NULL,                .description = "Print a breakdown of where each tile spends its time" },
+  { .name = "layout",     .args = layout_cmd_args,    .fn = layout_cmd_fn,     .perm = NULL,                .description = "Report the CPU and NUMA placement of the tiles and propose a better one" },
   { .name = "spy",        .args = NULL,               .fn = spy_cmd_fn,        .perm = NULL,                .description = "Spy on and print out gossip traffic" },
   { .name = "help",       .args = NULL,               .fn = help_cmd_fn,       .perm = NULL,                .description = "Print this help message" },
   { .name = "version",    .args = NULL,               .fn = version_cmd_fn,    .perm = NULL,                .description = "Show the current software version" },
@@ -218,7 +220,10 @@ fdctl_boot( int *        pargc,
      boot. */
 
   if( FD_LIKELY( -1==config_fd ) ) {
+    int auto_layout = !strcmp( config->layout.affinity, "auto" );
+    if( FD_UNLIKELY( auto_layout ) ) layout_auto_tiles( config );
     initialize_numa_assignments( &config->topo );
+    if( FD_UNLIKELY( auto_layout ) ) layout_auto_wksps( config );
   }
 }
 
@@ -0,0 +1,217 @@
+#include "fdctl.h"
+
+#include "../../disco/prof/fd_prof.h"
+#include "../../tango/tempo/fd_tempo.h"
+
+#include <stdio.h>
+
+/* prof reads the per tile callback profiling rings (see fd_prof.h) of a
+   locally running validator for a while and then prints, for each tile,
+   a breakdown of where the tile spent its time, or with --folded, the
+   same data in folded stack format, suitable for feeding to
+   flamegraph.pl.
+
+   Exact time totals come from the running totals maintained by each
+   tile, the ring records are only used to attribute frag callbacks to
+   in links and to find the worst case duration of each callback, so it
+   is not a problem if the reader gets overrun on busy tiles. */
+
+#define PROF_TILE_MAX (128UL)
+#define PROF_IN_MAX   (FD_TOPO_MAX_TILE_IN_LINKS+1UL) /* last is no in link */
+
+typedef struct {
+  fd_prof_t const * prof;
+  ulong             seq;
+  ulong             overrun_cnt;
+
+  ulong cnt0  [ FD_PROF_EVT_CNT ];
+  ulong ticks0[ FD_PROF_EVT_CNT ];
+  ulong cnt1  [ FD_PROF_EVT_CNT ];
+  ulong ticks1[ FD_PROF_EVT_CNT ];
+
+  ulong max_ticks[ FD_PROF_EVT_CNT ];
+  ulong in_ticks [ FD_PROF_EVT_CNT ][ PROF_IN_MAX ];
+} prof_tile_t;
+
+void
+prof_cmd_args( int *    pargc,
+               char *** pargv,
+               args_t * args ) {
+  args->prof.duration = fd_env_strip_cmdline_long( pargc, pargv, "--duration", NULL, 10e9 );
+  args->prof.folded   = fd_env_strip_cmdline_contains( pargc, pargv, "--folded" );
+
+  if( FD_UNLIKELY( args->prof.duration<=0L ) ) FD_LOG_ERR(( "--duration should be positive" ));
+}
+
+static void
+prof_poll( prof_tile_t * t ) {
+  ulong depth = fd_prof_depth( t->prof );
+  for(;;) {
+    fd_prof_rec_t rec[1];
+    int err = fd_prof_read( t->prof, t->seq, rec );
+    if( FD_UNLIKELY( err<0 ) ) break;
+    if( FD_UNLIKELY( err>0 ) ) {
+      t->overrun_cnt++;
+      t->seq = fd_seq_dec( fd_prof_seq_query( t->prof ), depth );
+      continue;
+    }
+
+    ulong evt = fd_ulong_min( (ulong)rec->evt, FD_PROF_EVT_CNT-1UL );
+    ulong in  = fd_ulong_min( (ulong)rec->in_idx, PROF_IN_MAX-1UL );
+    t->max_ticks[ evt ]       = fd_ulong_max( t->max_ticks[ evt ], rec->dur );
+    t->in_ticks [ evt ][ in ] += rec->dur;
+    t->seq = fd_seq_inc( t->seq, 1UL );
+  }
+}
+
+/* prof_in_link_name returns the name of the in link of tile that the
+   mux polls as in_idx.  The mux only polls the in links marked
+   in_link_poll and numbers them in order, skipping the others. */
+
+static char const *
+prof_in_link_name( fd_topo_t const *      topo,
+                   fd_topo_tile_t const * tile,
+                   ulong                  in_idx ) {
+  for( ulong in=0UL; in<tile->in_cnt; in++ ) {
+    if( FD_UNLIKELY( !tile->in_link_poll[ in ] ) ) continue;
+    if( !in_idx-- ) return topo->links[ tile->in_link_id[ in ] ].name;
+  }
+  return "unknown";
+}
+
+static void
+prof_print_tile( fd_topo_t const *    topo,
+                 fd_topo_tile_t const * tile,
+                 prof_tile_t const *  t,
+                 double               wall_ticks,
+                 double               ns_per_tic ) {
+  printf( "\n%s:%lu (%lu ring overruns)\n", tile->name, tile->kind_id, t->overrun_cnt );
+  printf( "  %-20s %8s %14s %12s %12s\n", "event", "% time", "count", "avg ns", "max ns" );
+
+  double busy = 0.;
+  for( ulong evt=0UL; evt<FD_PROF_EVT_CNT; evt++ ) {
+    ulong cnt   = t->cnt1  [ evt ] - t->cnt0  [ evt ];
+    ulong ticks = t->ticks1[ evt ] - t->ticks0[ evt ];
+    if( FD_LIKELY( (evt!=FD_PROF_EVT_DURING_HOUSEKEEPING) & (evt!=FD_PROF_EVT_METRICS_WRITE) ) ) busy += (double)ticks;
+    if( FD_UNLIKELY( !cnt ) ) continue;
+
+    printf( "  %-20s %7.3f%% %14lu %12.1f %12.1f\n",
+            fd_prof_evt_cstr( evt ),
+            100. * (double)ticks / wall_ticks,
+            cnt,
+            ns_per_tic * (double)ticks / (double)cnt,
+            ns_per_tic * (double)t->max_ticks[ evt ] );
+
+    for( ulong in=0UL; in<PROF_IN_MAX-1UL; in++ ) {
+      if( FD_LIKELY( !t->in_ticks[ evt ][ in ] ) ) continue;
+      printf( "    %-18s %7.3f%% (sampled)\n",
+              prof_in_link_name( topo, tile, in ),
+              100. * (double)t->in_ticks[ evt ][ in ] / wall_ticks );
+    }
+  }
+  printf( "  %-20s %7.3f%%\n", "other", 100. * fd_double_if( wall_ticks - busy>0., wall_ticks - busy, 0. ) / wall_ticks );
+}
+
+/* prof_print_folded prints one line per leaf frame.  Sampled per in
+   link ticks are scaled so that the frames of each event add up to the
+   exact total for that event. */
+
+static void
+prof_print_folded( fd_topo_t const *      topo,
+                   fd_topo_tile_t const * tile,
+                   prof_tile_t const *    t,
+                   double                 wall_ticks,
+                   double                 ns_per_tic ) {
+  double busy = 0.;
+  for( ulong evt=0UL; evt<FD_PROF_EVT_CNT; evt++ ) {
+    double ticks = (double)(t->ticks1[ evt ] - t->ticks0[ evt ]);
+    if( evt==FD_PROF_EVT_HOUSEKEEPING ) {
+      double nested = (double)(t->ticks1[ FD_PROF_EVT_DURING_HOUSEKEEPING ] - t->ticks0[ FD_PROF_EVT_DURING_HOUSEKEEPING ]) +
+                      (double)(t->ticks1[ FD_PROF_EVT_METRICS_WRITE       ] - t->ticks0[ FD_PROF_EVT_METRICS_WRITE       ]);
+      busy += ticks;
+      ticks = fd_double_if( ticks - nested>0., ticks - nested, 0. );
+      if( ticks>0. ) printf( "%s:%lu;housekeeping %lu\n", tile->name, tile->kind_id, (ulong)(0.5 + ns_per_tic*ticks) );
+      continue;
+    }
+
+    int nested = (evt==FD_PROF_EVT_DURING_HOUSEKEEPING) | (evt==FD_PROF_EVT_METRICS_WRITE);
+    if( !nested ) busy += ticks;
+    if( ticks<=0. ) continue;
+
+    char const * parent = nested ? ";housekeeping" : "";
+
+    double sampled = 0.;
+    for( ulong in=0UL; in<PROF_IN_MAX; in++ ) sampled += (double)t->in_ticks[ evt ][ in ];
+
+    int per_link = 0;
+    if( FD_LIKELY( sampled>0. ) ) {
+      for( ulong in=0UL; in<PROF_IN_MAX-1UL; in++ ) {
+        if( FD_LIKELY( !t->in_ticks[ evt ][ in ] ) ) continue;
+        per_link = 1;
+        double share = ticks * (double)t->in_ticks[ evt ][ in ] / sampled;
+        printf( "%s:%lu%s;%s;%s %lu\n", tile->name, tile->kind_id, parent, fd_prof_evt_cstr( evt ),
+                prof_in_link_name( topo, tile, in ), (ulong)(0.5 + ns_per_tic*share) );
+      }
+    }
+    if( !per_link ) printf( "%s:%lu%s;%s %lu\n", tile->name, tile->kind_id, parent, fd_prof_evt_cstr( evt ), (ulong)(0.5 + ns_per_tic*ticks) );
+  }
+
+  double other = fd_double_if( wall_ticks - busy>0., wall_ticks - busy, 0. );
+  if( other>0. ) printf( "%s:%lu;other %lu\n", tile->name, tile->kind_id, (ulong)(0.5 + ns_per_tic*other) );
+}
+
+void
+prof_cmd_fn( args_t *         args,
+             config_t * const config ) {
+  fd_topo_t * topo = &config->topo;
+
+  ulong wksp_id = fd_topo_find_wksp( topo, "metric_in" );
+  FD_TEST( wksp_id!=ULONG_MAX );
+
+  fd_topo_join_workspace( topo, &topo->workspaces[ wksp_id ], FD_SHMEM_JOIN_MODE_READ_ONLY );
+  fd_topo_workspace_fill( topo, &topo->workspaces[ wksp_id ] );
+
+  static prof_tile_t tiles[ PROF_TILE_MAX ];
+  ulong tile_idx[ PROF_TILE_MAX ];
+  ulong tile_cnt = 0UL;
+
+  for( ulong i=0UL; i<topo->tile_cnt; i++ ) {
+    fd_topo_tile_t const * tile = &topo->tiles[ i ];
+    if( FD_UNLIKELY( !tile->prof ) ) continue;
+    FD_TEST( tile_cnt<PROF_TILE_MAX );
+
+    prof_tile_t * t = &tiles[ tile_cnt ];
+    fd_memset( t, 0, sizeof(prof_tile_t) );
+    t->prof = tile->prof;
+    t->seq  = fd_prof_seq_query( t->prof );
+    fd_prof_totals( t->prof, t->cnt0, t->ticks0 );
+    tile_idx[ tile_cnt ] = i;
+    tile_cnt++;
+  }
+
+  if( FD_UNLIKELY( !tile_cnt ) )
+    FD_LOG_ERR(( "no tiles are being profiled, set [tiles.metric.profile_ring_depth] in your configuration file and restart" ));
+
+  double ns_per_tic = 1./fd_tempo_tick_per_ns( NULL );
+  FD_LOG_NOTICE(( "profiling %lu tiles for %.3f s", tile_cnt, (double)args->prof.duration/1e9 ));
+
+  long then = fd_tickcount();
+  long stop = fd_log_wallclock() + args->prof.duration;
+  while( fd_log_wallclock()<stop ) {
+    for( ulong i=0UL; i<tile_cnt; i++ ) prof_poll( &tiles[ i ] );
+    FD_SPIN_PAUSE();
+  }
+  for( ulong i=0UL; i<tile_cnt; i++ ) {
+    prof_poll( &tiles[ i ] );
+    fd_prof_totals( tiles[ i ].prof, tiles[ i ].cnt1, tiles[ i ].ticks1 );
+  }
+  double wall_ticks = (double)fd_long_max( fd_tickcount() - then, 1L );
+
+  if( FD_LIKELY( !args->prof.folded ) ) {
+    for( ulong i=0UL; i<tile_cnt; i++ ) prof_print_tile( topo, &topo->tiles[ tile_idx[ i ] ], &tiles[ i ], wall_ticks, ns_per_tic );
+  } else {
+    for( ulong i=0UL; i<tile_cnt; i++ ) prof_print_folded( topo, &topo->tiles[ tile_idx[ i ] ], &tiles[ i ], wall_ticks, ns_per_tic );
+  }
+
+  fd_topo_leave_workspaces( topo );
+}
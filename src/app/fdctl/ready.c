@@ -22,6 +22,10 @@ ready_cmd_fn( args_t *         args,
        long time, and aren't needed to start sending transactions
        anyway. */
     if( FD_UNLIKELY( tile->is_labs ) ) continue;
+
+    /* Replay tpool threads are run by the replay tile and don't have a
+       run loop of their own. */
+    if( FD_UNLIKELY( fdctl_tile_run( tile ).for_tpool ) ) continue;
     
     long start = fd_log_wallclock();
     int printed = 0;
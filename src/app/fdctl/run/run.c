@@ -233,6 +233,9 @@ main_pid_namespace( void * _args ) {
   for( ulong i=0; i<config->topo.tile_cnt; i++ ) {
     fd_topo_tile_t * tile = &config->topo.tiles[ i ];
     if( FD_UNLIKELY( tile->is_labs ) ) continue;
+    /* Replay tpool threads are started by the replay tile, as in
+       fd_topo_run_single_process. */
+    if( FD_UNLIKELY( fdctl_tile_run( tile ).for_tpool ) ) continue;
 
     int pipefd[ 2 ];
     if( FD_UNLIKELY( pipe2( pipefd, O_CLOEXEC ) ) ) FD_LOG_ERR(( "pipe2() failed (%i-%s)", errno, fd_io_strerror( errno ) ));
@@ -0,0 +1,201 @@
+#include "../../../../disco/tiles.h"
+
+#include "generated/ingest_seccomp.h"
+#include <linux/unistd.h>
+
+/* The ingest tile receives transactions published by trusted order flow
+   sources running on the same host, like block engines and relayers,
+   into shared memory rings (see fd_ingest.h), and forwards them to the
+   verify tiles exactly like the QUIC tile does for transactions from
+   the network.
+
+   Each ring is an "ingest_ext" link of the topology with no producer
+   tile, the client process is the producer.  The tile is a reliable
+   consumer of every ring, so clients are backpressured when verify
+   can't keep up, instead of dropping transactions like QUIC would.
+
+   The clients are not trusted any more than the network is.  The
+   metadata they publish is bounds checked and bad fragments are
+   dropped, and the payload is copied out of the ring before anything
+   downstream looks at it, so a client cannot change a transaction while
+   it is being verified. */
+
+typedef struct {
+  fd_wksp_t * mem;
+  ulong       chunk0;
+  ulong       wmark;
+} fd_ingest_in_ctx_t;
+
+typedef struct {
+  fd_ingest_in_ctx_t in[ FD_INGEST_RING_MAX ];
+
+  fd_wksp_t * out_mem;
+  ulong       out_chunk0;
+  ulong       out_wmark;
+  ulong       out_chunk;
+
+  struct {
+    ulong received_cnt;
+    ulong dropped_cnt;
+  } metrics;
+} fd_ingest_ctx_t;
+
+FD_FN_CONST static inline ulong
+scratch_align( void ) {
+  return alignof( fd_ingest_ctx_t );
+}
+
+FD_FN_PURE static inline ulong
+scratch_footprint( fd_topo_tile_t const * tile ) {
+  (void)tile;
+  ulong l = FD_LAYOUT_INIT;
+  l = FD_LAYOUT_APPEND( l, alignof( fd_ingest_ctx_t ), sizeof( fd_ingest_ctx_t ) );
+  return FD_LAYOUT_FINI( l, scratch_align() );
+}
+
+FD_FN_CONST static inline void *
+mux_ctx( void * scratch ) {
+  return (void*)fd_ulong_align_up( (ulong)scratch, alignof( fd_ingest_ctx_t ) );
+}
+
+static inline void
+metrics_write( void * _ctx ) {
+  fd_ingest_ctx_t * ctx = (fd_ingest_ctx_t *)_ctx;
+
+  FD_MCNT_SET( INGEST_TILE, TRANSACTIONS_RECEIVED, ctx->metrics.received_cnt );
+  FD_MCNT_SET( INGEST_TILE, TRANSACTIONS_DROPPED,  ctx->metrics.dropped_cnt  );
+}
+
+/* Unlike the other tiles, a bad chunk or size here is not a sign that
+   a tile of the validator has been compromised, just of a buggy
+   client, so the frag is dropped rather than bringing down the
+   validator.  See fd_dedup.c for why the frag is copied. */
+
+static inline void
+during_frag( void * _ctx,
+             ulong  in_idx,
+             ulong  seq,
+             ulong  sig,
+             ulong  chunk,
+             ulong  sz,
+             int *  opt_filter ) {
+  (void)seq;
+  (void)sig;
+
+  fd_ingest_ctx_t * ctx = (fd_ingest_ctx_t *)_ctx;
+
+  if( FD_UNLIKELY( chunk<ctx->in[ in_idx ].chunk0 || chunk>ctx->in[ in_idx ].wmark || !sz || sz>FD_TPU_MTU ) ) {
+    ctx->metrics.dropped_cnt++;
+    *opt_filter = 1;
+    return;
+  }
+
+  uchar * src = (uchar *)fd_chunk_to_laddr( ctx->in[ in_idx ].mem, chunk );
+  uchar * dst = (uchar *)fd_chunk_to_laddr( ctx->out_mem, ctx->out_chunk );
+
+  fd_memcpy( dst, src, sz );
+}
+
+static inline void
+after_frag( void *             _ctx,
+            ulong              in_idx,
+            ulong              seq,
+            ulong *            opt_sig,
+            ulong *            opt_chunk,
+            ulong *            opt_sz,
+            ulong *            opt_tsorig,
+            int   *            opt_filter,
+            fd_mux_context_t * mux ) {
+  (void)in_idx;
+  (void)seq;
+  (void)opt_tsorig;
+  (void)opt_filter;
+  (void)mux;
+
+  fd_ingest_ctx_t * ctx = (fd_ingest_ctx_t *)_ctx;
+
+  ctx->metrics.received_cnt++;
+  *opt_chunk     = ctx->out_chunk;
+  *opt_sig       = 0UL;
+  ctx->out_chunk = fd_dcache_compact_next( ctx->out_chunk, *opt_sz, ctx->out_chunk0, ctx->out_wmark );
+}
+
+static void
+unprivileged_init( fd_topo_t *      topo,
+                   fd_topo_tile_t * tile,
+                   void *           scratch ) {
+  FD_SCRATCH_ALLOC_INIT( l, scratch );
+  fd_ingest_ctx_t * ctx = FD_SCRATCH_ALLOC_APPEND( l, alignof( fd_ingest_ctx_t ), sizeof( fd_ingest_ctx_t ) );
+  fd_memset( ctx, 0, sizeof( fd_ingest_ctx_t ) );
+
+  ulong ingest_obj_id = fd_pod_query_ulong( topo->props, "ingest", ULONG_MAX );
+  FD_TEST( ingest_obj_id!=ULONG_MAX );
+  fd_ingest_t * ingest = fd_ingest_join( fd_topo_obj_laddr( topo, ingest_obj_id ) );
+  FD_TEST( ingest );
+  FD_TEST( tile->in_cnt==fd_ingest_ring_cnt( ingest ) );
+
+  /* Publish where each ring lives for the clients, then let them in.
+     The rings are empty at this point, the mux starts consuming them
+     from the initial sequence number of their mcache. */
+
+  for( ulong i=0UL; i<tile->in_cnt; i++ ) {
+    fd_topo_link_t * link = &topo->links[ tile->in_link_id[ i ] ];
+    fd_topo_wksp_t * link_wksp = &topo->workspaces[ topo->objs[ link->dcache_obj_id ].wksp_id ];
+    FD_TEST( !strcmp( link->name, "ingest_ext" ) );
+
+    ctx->in[ i ].mem    = link_wksp->wksp;
+    ctx->in[ i ].chunk0 = fd_dcache_compact_chunk0( ctx->in[ i ].mem, link->dcache );
+    ctx->in[ i ].wmark  = fd_dcache_compact_wmark ( ctx->in[ i ].mem, link->dcache, link->mtu );
+
+    fd_ingest_ring_set( ingest, i, link_wksp->wksp, link->mcache, link->dcache, tile->in_link_fseq[ i ], link->mtu );
+  }
+  fd_ingest_ready( ingest );
+
+  ctx->out_mem    = topo->workspaces[ topo->objs[ topo->links[ tile->out_link_id_primary ].dcache_obj_id ].wksp_id ].wksp;
+  ctx->out_chunk0 = fd_dcache_compact_chunk0( ctx->out_mem, topo->links[ tile->out_link_id_primary ].dcache );
+  ctx->out_wmark  = fd_dcache_compact_wmark ( ctx->out_mem, topo->links[ tile->out_link_id_primary ].dcache, topo->links[ tile->out_link_id_primary ].mtu );
+  ctx->out_chunk  = ctx->out_chunk0;
+
+  ulong scratch_top = FD_SCRATCH_ALLOC_FINI( l, 1UL );
+  if( FD_UNLIKELY( scratch_top > (ulong)scratch + scratch_footprint( tile ) ) )
+    FD_LOG_ERR(( "scratch overflow %lu %lu %lu", scratch_top - (ulong)scratch - scratch_footprint( tile ), scratch_top, (ulong)scratch + scratch_footprint( tile ) ));
+}
+
+static ulong
+populate_allowed_seccomp( void *               scratch,
+                          ulong                out_cnt,
+                          struct sock_filter * out ) {
+  (void)scratch;
+  populate_sock_filter_policy_ingest( out_cnt, out, (uint)fd_log_private_logfile_fd() );
+  return sock_filter_policy_ingest_instr_cnt;
+}
+
+static ulong
+populate_allowed_fds( void * scratch,
+                      ulong  out_fds_cnt,
+                      int *  out_fds ) {
+  (void)scratch;
+  if( FD_UNLIKELY( out_fds_cnt < 2 ) ) FD_LOG_ERR(( "out_fds_cnt %lu", out_fds_cnt ));
+
+  ulong out_cnt = 0;
+  out_fds[ out_cnt++ ] = 2; /* stderr */
+  if( FD_LIKELY( -1!=fd_log_private_logfile_fd() ) )
+    out_fds[ out_cnt++ ] = fd_log_private_logfile_fd(); /* logfile */
+  return out_cnt;
+}
+
+fd_topo_run_tile_t fd_tile_ingest = {
+  .name                     = "ingest",
+  .mux_flags                = FD_MUX_FLAG_COPY,
+  .burst                    = 1UL,
+  .mux_ctx                  = mux_ctx,
+  .mux_during_frag          = during_frag,
+  .mux_after_frag           = after_frag,
+  .mux_metrics_write        = metrics_write,
+  .populate_allowed_seccomp = populate_allowed_seccomp,
+  .populate_allowed_fds     = populate_allowed_fds,
+  .scratch_align            = scratch_align,
+  .scratch_footprint        = scratch_footprint,
+  .privileged_init          = NULL,
+  .unprivileged_init        = unprivileged_init,
+};
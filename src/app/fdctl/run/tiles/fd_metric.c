@@ -1,12 +1,15 @@
+#define _GNU_SOURCE
 #include "../../../../disco/tiles.h"
 
+#include <sys/socket.h> /* SOCK_NONBLOCK and MSG_NOSIGNAL needed before importing the metric seccomp filter */
 #include "generated/metric_seccomp.h"
 
 #include "../../../../ballet/http/picohttpparser.h"
 
 #include <errno.h>
 #include <sys/types.h>
-#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/stat.h>
 #include <netinet/in.h>
 #include <unistd.h>
 #include <string.h>
@@ -15,9 +18,16 @@
 
 #define MAX_CONNS 128
 
+#define MAX_SNAP_CLIENTS 8
+#define SNAP_MSG_MAX     (32768UL)
+
 /* The metric tile reads metrics updates from other tiles, maybe
    presents them on a local HTTP endpoint, and maybe uploads them to
-   a server InfluxDB endpoint. */
+   a server InfluxDB endpoint.
+
+   It also periodically snapshots the metrics of every tile (see
+   fd_metrics_snap.h), and maybe streams the snapshots as binary deltas
+   to clients of a local Unix socket. */
 
 typedef struct {
   ulong bytes_read;
@@ -37,6 +47,25 @@ typedef struct {
   struct pollfd            fds[ MAX_CONNS+1 ];
 
   ulong conn_id;
+
+  fd_metrics_snap_t * snap;        /* NULL if snapshots are disabled */
+  long                snap_period; /* In ticks */
+  long                snap_next;   /* Tickcount of the next snapshot */
+
+  int snap_socket_fd; /* -1 if the snapshot stream is disabled */
+  struct {
+    int fd;       /* -1 if the slot is free */
+    int need_key; /* Client must be sent a keyframe next */
+  } snap_clients[ MAX_SNAP_CLIENTS ];
+
+  ulong      snap_cnt;
+  ulong      stream_bytes;
+  ulong      stream_keyframes;
+  ulong      stream_resync;
+  fd_histf_t snap_copy_duration  [ 1 ];
+  fd_histf_t snap_stream_duration[ 1 ];
+
+  uchar snap_msg[ SNAP_MSG_MAX ];
 } fd_metric_ctx_t;
 
 FD_FN_CONST static inline ulong
@@ -267,6 +296,12 @@ prometheus_print( fd_topo_t * topo,
   PRINT( "\n" );
   result = prometheus_print1( topo, out, out_len, "store", FD_METRICS_STORE_TOTAL, FD_METRICS_STORE, PRINT_TILE );
   if( FD_UNLIKELY( result<0 ) ) return result;
+  PRINT( "\n" );
+  result = prometheus_print1( topo, out, out_len, "ingest", FD_METRICS_INGEST_TOTAL, FD_METRICS_INGEST, PRINT_TILE );
+  if( FD_UNLIKELY( result<0 ) ) return result;
+  PRINT( "\n" );
+  result = prometheus_print1( topo, out, out_len, "metric", FD_METRICS_METRIC_TOTAL, FD_METRICS_METRIC, PRINT_TILE );
+  if( FD_UNLIKELY( result<0 ) ) return result;
 
   /* Now backfill Content-Length */
   ulong printed;
@@ -381,6 +416,143 @@ write_conn( fd_metric_ctx_t *        ctx,
   }
 }
 
+static void
+close_snap_client( fd_metric_ctx_t * ctx,
+                   ulong             idx ) {
+  if( FD_UNLIKELY( -1==close( ctx->snap_clients[ idx ].fd ) ) ) FD_LOG_ERR(( "close failed (%i-%s)", errno, strerror( errno ) ));
+  ctx->snap_clients[ idx ].fd = -1;
+}
+
+static void
+accept_snap_clients( fd_metric_ctx_t * ctx ) {
+  for(;;) {
+    int fd = accept4( ctx->snap_socket_fd, NULL, NULL, SOCK_NONBLOCK );
+
+    if( FD_UNLIKELY( -1==fd ) ) {
+      if( FD_LIKELY( EAGAIN==errno ) ) break;
+      else if( FD_LIKELY( ECONNABORTED==errno || EINTR==errno ) ) continue;
+      else FD_LOG_ERR(( "accept4 failed (%i-%s)", errno, strerror( errno ) ));
+    }
+
+    ulong idx = MAX_SNAP_CLIENTS;
+    for( ulong i=0UL; i<MAX_SNAP_CLIENTS; i++ ) {
+      if( FD_LIKELY( -1==ctx->snap_clients[ i ].fd ) ) {
+        idx = i;
+        break;
+      }
+    }
+
+    /* Turn away clients beyond the limit, the ones already streaming
+       are not slow, unlike stale HTTP connections. */
+    if( FD_UNLIKELY( idx==MAX_SNAP_CLIENTS ) ) {
+      if( FD_UNLIKELY( -1==close( fd ) ) ) FD_LOG_ERR(( "close failed (%i-%s)", errno, strerror( errno ) ));
+      continue;
+    }
+
+    ctx->snap_clients[ idx ].fd       = fd;
+    ctx->snap_clients[ idx ].need_key = 1;
+  }
+}
+
+/* stream_snap sends the latest snapshot to the stream clients, as a
+   keyframe to the ones that need one and as a delta against the
+   previous snapshot to the others.  Messages are sent without
+   blocking, and a client whose socket buffer is full misses the rest
+   of the snapshot and is sent a keyframe instead. */
+
+static void
+stream_snap( fd_metric_ctx_t * ctx ) {
+  fd_metrics_snap_t * snap     = ctx->snap;
+  ulong               seq      = fd_metrics_snap_seq_query( snap );
+  ulong               word_cnt = fd_metrics_snap_word_cnt( snap );
+  ulong const *       cur      = fd_metrics_snap_buf( snap, seq     );
+  ulong const *       prev     = fd_metrics_snap_buf( snap, seq-1UL );
+  long                ts       = snap->ts  [ seq&1UL ];
+  long                tick     = snap->tick[ seq&1UL ];
+
+  /* Deltas first, so clients that fall behind while being sent one get
+     the keyframe of the same snapshot. */
+  for( int key=0; key<2; key++ ) {
+    int   send_to[ MAX_SNAP_CLIENTS ];
+    ulong send_cnt = 0UL;
+    for( ulong i=0UL; i<MAX_SNAP_CLIENTS; i++ ) {
+      send_to[ i ] = -1!=ctx->snap_clients[ i ].fd && key==ctx->snap_clients[ i ].need_key;
+      send_cnt    += (ulong)send_to[ i ];
+    }
+
+    ulong lo = 0UL;
+    while( send_cnt && lo<word_cnt ) {
+      ulong sz;
+      lo = fd_metrics_snap_msg_encode( key ? NULL : prev, cur, word_cnt, lo, seq, ts, tick, ctx->snap_msg, sizeof(ctx->snap_msg), &sz );
+
+      for( ulong i=0UL; i<MAX_SNAP_CLIENTS; i++ ) {
+        if( FD_LIKELY( !send_to[ i ] ) ) continue;
+
+        long n = send( ctx->snap_clients[ i ].fd, ctx->snap_msg, sz, MSG_NOSIGNAL );
+        if( FD_UNLIKELY( -1==n ) ) {
+          if( FD_LIKELY( EAGAIN==errno ) ) {
+            ctx->snap_clients[ i ].need_key = 1;
+            ctx->stream_resync++;
+          } else if( FD_LIKELY( EPIPE==errno || ECONNRESET==errno ) ) {
+            close_snap_client( ctx, i ); /* Peer closed connection */
+          } else {
+            FD_LOG_ERR(( "send failed (%i-%s)", errno, strerror( errno ) ));
+          }
+          send_to[ i ] = 0;
+          send_cnt--;
+          continue;
+        }
+        ctx->stream_bytes += (ulong)n;
+      }
+    }
+
+    for( ulong i=0UL; i<MAX_SNAP_CLIENTS; i++ ) {
+      if( FD_LIKELY( !send_to[ i ] ) ) continue;
+      ctx->snap_clients[ i ].need_key = 0;
+      ctx->stream_keyframes += (ulong)key;
+    }
+  }
+}
+
+/* snapshot copies the metrics of all tiles into the next snapshot
+   and streams it.  now is the tickcount when the snapshot started. */
+
+static void
+snapshot( fd_metric_ctx_t * ctx,
+          long              now ) {
+  fd_topo_t * topo = ctx->topo;
+
+  ulong * dst = fd_metrics_snap_prepare( ctx->snap );
+  for( ulong i=0UL; i<topo->tile_cnt; i++ ) dst = fd_metrics_snap_copy( dst, topo->tiles[ i ].metrics );
+  long tick = fd_tickcount();
+  fd_metrics_snap_publish( ctx->snap, fd_log_wallclock(), tick );
+
+  fd_histf_sample( ctx->snap_copy_duration, (ulong)(tick-now) );
+  ctx->snap_cnt++;
+
+  if( FD_LIKELY( -1!=ctx->snap_socket_fd ) ) {
+    accept_snap_clients( ctx );
+    stream_snap( ctx );
+    fd_histf_sample( ctx->snap_stream_duration, (ulong)(fd_tickcount()-tick) );
+  }
+}
+
+static void
+metrics_write( void * _ctx ) {
+  fd_metric_ctx_t * ctx = (fd_metric_ctx_t *)_ctx;
+
+  ulong client_cnt = 0UL;
+  for( ulong i=0UL; i<MAX_SNAP_CLIENTS; i++ ) client_cnt += (ulong)( -1!=ctx->snap_clients[ i ].fd );
+
+  FD_MCNT_SET  ( METRIC, SNAPSHOT_COUNT,                   ctx->snap_cnt             );
+  FD_MHIST_COPY( METRIC, SNAPSHOT_COPY_DURATION_SECONDS,   ctx->snap_copy_duration   );
+  FD_MHIST_COPY( METRIC, SNAPSHOT_STREAM_DURATION_SECONDS, ctx->snap_stream_duration );
+  FD_MGAUGE_SET( METRIC, SNAPSHOT_STREAM_CLIENTS,          client_cnt                );
+  FD_MCNT_SET  ( METRIC, SNAPSHOT_STREAM_BYTES,            ctx->stream_bytes         );
+  FD_MCNT_SET  ( METRIC, SNAPSHOT_STREAM_KEYFRAMES,        ctx->stream_keyframes     );
+  FD_MCNT_SET  ( METRIC, SNAPSHOT_STREAM_RESYNC,           ctx->stream_resync        );
+}
+
 static void
 before_credit( void *             _ctx,
                fd_mux_context_t * mux ) {
@@ -388,6 +560,16 @@ before_credit( void *             _ctx,
 
   fd_metric_ctx_t * ctx = (fd_metric_ctx_t *)_ctx;
 
+  if( FD_LIKELY( ctx->snap ) ) {
+    long now = fd_tickcount();
+    if( FD_UNLIKELY( now>=ctx->snap_next ) ) {
+      snapshot( ctx, now );
+      /* Keep to the configured rate, but don't burst to catch up if
+         the tile was descheduled for more than a period. */
+      ctx->snap_next = fd_long_max( ctx->snap_next+ctx->snap_period, now );
+    }
+  }
+
   int nfds = poll( ctx->fds, MAX_CONNS+1, 0 );
   if( FD_UNLIKELY( 0==nfds ) ) return;
   else if( FD_UNLIKELY( -1==nfds && errno==EINTR ) ) return;
@@ -432,6 +614,29 @@ privileged_init( fd_topo_t *      topo,
   if( FD_UNLIKELY( -1==listen( sockfd, 128 ) ) ) FD_LOG_ERR(( "listen failed (%i-%s)", errno, strerror( errno ) ));
 
   ctx->socket_fd = sockfd;
+
+  ctx->snap_socket_fd = -1;
+  char const * snap_path = tile->metric.snapshot_socket_path;
+  if( FD_UNLIKELY( strcmp( snap_path, "" ) ) ) {
+    int snap_fd = socket( AF_UNIX, SOCK_SEQPACKET | SOCK_NONBLOCK, 0 );
+    if( FD_UNLIKELY( -1==snap_fd ) ) FD_LOG_ERR(( "socket failed (%i-%s)", errno, strerror( errno ) ));
+
+    struct sockaddr_un snap_addr = { .sun_family = AF_UNIX };
+    if( FD_UNLIKELY( strlen( snap_path )>=sizeof(snap_addr.sun_path) ) ) FD_LOG_ERR(( "snapshot socket path `%s` too long", snap_path ));
+    strncpy( snap_addr.sun_path, snap_path, sizeof(snap_addr.sun_path)-1UL );
+
+    /* Remove the socket left behind by a previous run. */
+    if( FD_UNLIKELY( -1==unlink( snap_path ) && errno!=ENOENT ) ) FD_LOG_ERR(( "unlink `%s` failed (%i-%s)", snap_path, errno, strerror( errno ) ));
+    if( FD_UNLIKELY( -1==bind( snap_fd, fd_type_pun( &snap_addr ), sizeof( snap_addr ) ) ) ) FD_LOG_ERR(( "bind `%s` failed (%i-%s)", snap_path, errno, strerror( errno ) ));
+    if( FD_UNLIKELY( -1==listen( snap_fd, MAX_SNAP_CLIENTS ) ) ) FD_LOG_ERR(( "listen failed (%i-%s)", errno, strerror( errno ) ));
+
+    /* The socket is created by the privileged user, but the metrics are
+       no more sensitive than the unauthenticated Prometheus endpoint,
+       so let any local user connect. */
+    if( FD_UNLIKELY( -1==chmod( snap_path, 0666 ) ) ) FD_LOG_ERR(( "chmod `%s` failed (%i-%s)", snap_path, errno, strerror( errno ) ));
+
+    ctx->snap_socket_fd = snap_fd;
+  }
 }
 
 static void
@@ -452,11 +657,32 @@ unprivileged_init( fd_topo_t *      topo,
   ctx->fds[ MAX_CONNS ].fd = ctx->socket_fd;
   ctx->fds[ MAX_CONNS ].events = POLLIN | POLLOUT;
 
+  ctx->snap = NULL;
+  ulong snap_obj_id = fd_pod_query_ulong( topo->props, "metrics_snap", ULONG_MAX );
+  if( FD_LIKELY( snap_obj_id!=ULONG_MAX && tile->metric.snapshot_hz ) ) {
+    ctx->snap = fd_metrics_snap_join( fd_topo_obj_laddr( topo, snap_obj_id ) );
+    if( FD_UNLIKELY( !ctx->snap ) ) FD_LOG_ERR(( "fd_metrics_snap_join failed" ));
+  }
+  ctx->snap_period = (long)(fd_tempo_tick_per_ns( NULL )*1e9/(double)fd_uint_max( tile->metric.snapshot_hz, 1U ));
+  ctx->snap_next   = fd_tickcount();
+
+  for( ulong i=0UL; i<MAX_SNAP_CLIENTS; i++ ) ctx->snap_clients[ i ].fd = -1;
+  ctx->snap_cnt         = 0UL;
+  ctx->stream_bytes     = 0UL;
+  ctx->stream_keyframes = 0UL;
+  ctx->stream_resync    = 0UL;
+  fd_histf_join( fd_histf_new( ctx->snap_copy_duration,   FD_MHIST_SECONDS_MIN( METRIC, SNAPSHOT_COPY_DURATION_SECONDS   ),
+                                                          FD_MHIST_SECONDS_MAX( METRIC, SNAPSHOT_COPY_DURATION_SECONDS   ) ) );
+  fd_histf_join( fd_histf_new( ctx->snap_stream_duration, FD_MHIST_SECONDS_MIN( METRIC, SNAPSHOT_STREAM_DURATION_SECONDS ),
+                                                          FD_MHIST_SECONDS_MAX( METRIC, SNAPSHOT_STREAM_DURATION_SECONDS ) ) );
+
   ulong scratch_top = FD_SCRATCH_ALLOC_FINI( l, 1UL );
   if( FD_UNLIKELY( scratch_top > (ulong)scratch + scratch_footprint( tile ) ) )
     FD_LOG_ERR(( "scratch overflow %lu %lu %lu", scratch_top - (ulong)scratch - scratch_footprint( tile ), scratch_top, (ulong)scratch + scratch_footprint( tile ) ));
 
   FD_LOG_NOTICE(( "Prometheus metrics endpoint listening on port %u", tile->metric.prometheus_listen_port ));
+  if( FD_UNLIKELY( -1!=ctx->snap_socket_fd ) )
+    FD_LOG_NOTICE(( "metrics snapshot stream listening on `%s` at %u Hz", tile->metric.snapshot_socket_path, tile->metric.snapshot_hz ));
 }
 
 static ulong
@@ -466,7 +692,7 @@ populate_allowed_seccomp( void *               scratch,
   FD_SCRATCH_ALLOC_INIT( l, scratch );
   fd_metric_ctx_t * ctx = FD_SCRATCH_ALLOC_APPEND( l, alignof( fd_metric_ctx_t ), sizeof( fd_metric_ctx_t ) );
 
-  populate_sock_filter_policy_metric( out_cnt, out, (uint)fd_log_private_logfile_fd(), (uint)ctx->socket_fd );
+  populate_sock_filter_policy_metric( out_cnt, out, (uint)fd_log_private_logfile_fd(), (uint)ctx->socket_fd, (uint)ctx->snap_socket_fd );
   return sock_filter_policy_metric_instr_cnt;
 }
 
@@ -477,13 +703,15 @@ populate_allowed_fds( void * scratch,
   FD_SCRATCH_ALLOC_INIT( l, scratch );
   fd_metric_ctx_t * ctx = FD_SCRATCH_ALLOC_APPEND( l, alignof( fd_metric_ctx_t ), sizeof( fd_metric_ctx_t ) );
 
-  if( FD_UNLIKELY( out_fds_cnt<3 ) ) FD_LOG_ERR(( "out_fds_cnt %lu", out_fds_cnt ));
+  if( FD_UNLIKELY( out_fds_cnt<4 ) ) FD_LOG_ERR(( "out_fds_cnt %lu", out_fds_cnt ));
 
   ulong out_cnt = 0;
   out_fds[ out_cnt++ ] = 2; /* stderr */
   if( FD_LIKELY( -1!=fd_log_private_logfile_fd() ) )
     out_fds[ out_cnt++ ] = fd_log_private_logfile_fd(); /* logfile */
   out_fds[ out_cnt++ ] = ctx->socket_fd; /* listen socket */
+  if( FD_UNLIKELY( -1!=ctx->snap_socket_fd ) )
+    out_fds[ out_cnt++ ] = ctx->snap_socket_fd; /* snapshot stream listen socket */
   return out_cnt;
 }
 
@@ -491,9 +719,10 @@ fd_topo_run_tile_t fd_tile_metric = {
   .name                     = "metric",
   .mux_flags                = FD_MUX_FLAG_MANUAL_PUBLISH | FD_MUX_FLAG_COPY,
   .burst                    = 1UL,
-  .rlimit_file_cnt          = MAX_CONNS+1,
+  .rlimit_file_cnt          = MAX_CONNS+1+1+MAX_SNAP_CLIENTS,
   .mux_ctx                  = mux_ctx,
   .mux_before_credit        = before_credit,
+  .mux_metrics_write        = metrics_write,
   .populate_allowed_seccomp = populate_allowed_seccomp,
   .populate_allowed_fds     = populate_allowed_fds,
   .scratch_align            = scratch_align,
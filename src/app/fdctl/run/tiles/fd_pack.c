@@ -91,6 +91,14 @@ typedef struct {
   fd_pack_t *  pack;
   fd_txn_p_t * cur_spot;
 
+  /* If the topology has several pack tiles, the pack objects share a
+     shard table (see fd_pack_shard.h), and this tile only schedules the
+     transactions whose home shard is shard_idx.  Otherwise shard is
+     NULL, shard_cnt is 1, and shard_idx is 0. */
+  fd_pack_shard_t * shard;
+  ulong             shard_cnt;
+  ulong             shard_idx;
+
   /* The value passed to fd_pack_new, etc. */
   ulong    max_pending_transactions;
 
@@ -390,7 +398,8 @@ after_credit( void *             _ctx,
       fd_microblock_bank_trailer_t * trailer = (fd_microblock_bank_trailer_t*)((uchar*)microblock_dst+msg_sz);
       trailer->bank = ctx->leader_bank;
 
-      ulong sig = fd_disco_poh_sig( ctx->leader_slot, POH_PKT_TYPE_MICROBLOCK, (ulong)i );
+      /* Bank tiles are numbered across all the pack tiles */
+      ulong sig = fd_disco_poh_sig( ctx->leader_slot, POH_PKT_TYPE_MICROBLOCK, ctx->shard_idx*ctx->bank_cnt+(ulong)i );
       fd_mux_publish( mux, sig, chunk, msg_sz+sizeof(fd_microblock_bank_trailer_t), 0UL, 0UL, tspub );
       ctx->bank_expect[ i ] = *mux->seq-1UL;
       ctx->bank_ready_at[i] = now + (long)ctx->microblock_duration_ticks;
@@ -479,6 +488,7 @@ during_frag( void * _ctx,
       fd_pack_end_block( ctx->pack );
     }
     ctx->leader_slot = fd_disco_poh_sig_slot( sig );
+    fd_pack_set_shard_tag( ctx->pack, ctx->leader_slot );
 
     fd_became_leader_t * became_leader = (fd_became_leader_t *)dcache_entry;
     ctx->leader_bank          = became_leader->bank;
@@ -552,6 +562,15 @@ during_frag( void * _ctx,
     ctx->cur_spot->payload_sz = payload_sz;
   }
 
+  if( FD_UNLIKELY( ctx->shard && fd_pack_shard_home( ctx->shard_cnt, TXN(ctx->cur_spot), ctx->cur_spot->payload )!=ctx->shard_idx ) ) {
+    /* Another pack tile schedules this transaction */
+    if( FD_LIKELY( !ctx->insert_to_extra ) ) fd_pack_insert_txn_cancel( ctx->pack, ctx->cur_spot );
+    else                                     extra_txn_deq_remove_tail( ctx->extra_txn_deq       );
+    ctx->cur_spot = NULL;
+    *opt_filter = 1;
+    return;
+  }
+
 #if DETAILED_LOGGING
   FD_LOG_NOTICE(( "Pack got a packet. Payload size: %lu, txn footprint: %lu", payload_sz,
         fd_txn_footprint( txn->instr_cnt, txn->addr_table_lookup_cnt )
@@ -585,7 +604,8 @@ after_frag( void *             _ctx,
 
   if( FD_UNLIKELY( in_idx==POH_IN_IDX ) ) {
     ctx->slot_end_ns = ctx->_slot_end_ns;
-    fd_pack_set_block_limits( ctx->pack, ctx->slot_max_microblocks, ctx->slot_max_data );
+    fd_pack_set_block_limits( ctx->pack, fd_pack_shard_limit( ctx->slot_max_microblocks, ctx->shard_cnt, ctx->shard_idx ),
+                                         fd_pack_shard_limit( ctx->slot_max_data,        ctx->shard_cnt, ctx->shard_idx ) );
   } else {
     /* Normal transaction case */
     if( FD_LIKELY( !ctx->insert_to_extra ) ) {
@@ -612,11 +632,25 @@ unprivileged_init( fd_topo_t *      topo,
   if( FD_UNLIKELY( out_cnt>FD_PACK_PACK_MAX_OUT ) ) FD_LOG_ERR(( "pack tile connects to too many banking tiles" ));
   if( FD_UNLIKELY( out_cnt!=tile->pack.bank_tile_count+1UL ) ) FD_LOG_ERR(( "pack tile connects to %lu banking tiles, but tile->pack.bank_tile_count is %lu", out_cnt, tile->pack.bank_tile_count ));
 
+  fd_pack_shard_t * shard     = NULL;
+  ulong             shard_cnt = 1UL;
+  ulong shard_obj_id = fd_pod_query_ulong( topo->props, "pack_shard", ULONG_MAX );
+  if( FD_UNLIKELY( shard_obj_id!=ULONG_MAX ) ) {
+    shard = fd_pack_shard_join( fd_topo_obj_laddr( topo, shard_obj_id ) );
+    if( FD_UNLIKELY( !shard ) ) FD_LOG_ERR(( "fd_pack_shard_join failed" ));
+    shard_cnt = fd_pack_shard_cnt( shard );
+    if( FD_UNLIKELY( tile->kind_id>=shard_cnt ) ) FD_LOG_ERR(( "pack tile %lu but only %lu pack shards", tile->kind_id, shard_cnt ));
+  }
+  ulong shard_idx = fd_ulong_if( !!shard, tile->kind_id, 0UL );
+
+  /* Block wide limits are split between the shards such that the parts
+     sum to the limit.  The per account write cost limit is enforced by
+     the shard table. */
   fd_pack_limits_t limits[1] = {{
-    .max_cost_per_block        = tile->pack.larger_max_cost_per_block ? LARGER_MAX_COST_PER_BLOCK : FD_PACK_MAX_COST_PER_BLOCK,
-    .max_vote_cost_per_block   = FD_PACK_MAX_VOTE_COST_PER_BLOCK,
+    .max_cost_per_block        = fd_pack_shard_limit( tile->pack.larger_max_cost_per_block ? LARGER_MAX_COST_PER_BLOCK : FD_PACK_MAX_COST_PER_BLOCK, shard_cnt, shard_idx ),
+    .max_vote_cost_per_block   = fd_pack_shard_limit( FD_PACK_MAX_VOTE_COST_PER_BLOCK, shard_cnt, shard_idx ),
     .max_write_cost_per_acct   = FD_PACK_MAX_WRITE_COST_PER_ACCT,
-    .max_data_bytes_per_block  = tile->pack.larger_shred_limits_per_block ? LARGER_MAX_DATA_PER_BLOCK : FD_PACK_MAX_DATA_PER_BLOCK,
+    .max_data_bytes_per_block  = fd_pack_shard_limit( tile->pack.larger_shred_limits_per_block ? LARGER_MAX_DATA_PER_BLOCK : FD_PACK_MAX_DATA_PER_BLOCK, shard_cnt, shard_idx ),
     .max_txn_per_microblock    = MAX_TXN_PER_MICROBLOCK,
     .max_microblocks_per_block = (ulong)UINT_MAX, /* Limit not known yet */
   }};
@@ -633,6 +667,11 @@ unprivileged_init( fd_topo_t *      topo,
                                          limits, rng ) );
   if( FD_UNLIKELY( !ctx->pack ) ) FD_LOG_ERR(( "fd_pack_new failed" ));
 
+  ctx->shard     = shard;
+  ctx->shard_cnt = shard_cnt;
+  ctx->shard_idx = shard_idx;
+  if( FD_UNLIKELY( shard ) ) fd_pack_set_shard( ctx->pack, shard, ctx->shard_idx );
+
   ctx->extra_txn_deq = extra_txn_deq_join( extra_txn_deq_new( FD_SCRATCH_ALLOC_APPEND( l, extra_txn_deq_align(),
                                                                                           extra_txn_deq_footprint() ) ) );
 
@@ -660,7 +699,7 @@ unprivileged_init( fd_topo_t *      topo,
   ctx->poll_cursor      = 0;
   ctx->bank_idle_bitset = fd_ulong_mask_lsb( (int)tile->pack.bank_tile_count );
   for( ulong i=0UL; i<tile->pack.bank_tile_count; i++ ) {
-    ulong busy_obj_id = fd_pod_queryf_ulong( topo->props, ULONG_MAX, "bank_busy.%lu", i );
+    ulong busy_obj_id = fd_pod_queryf_ulong( topo->props, ULONG_MAX, "bank_busy.%lu", ctx->shard_idx*tile->pack.bank_tile_count+i );
     FD_TEST( busy_obj_id!=ULONG_MAX );
     ctx->bank_current[ i ] = fd_fseq_join( fd_topo_obj_laddr( topo, busy_obj_id ) );
     ctx->bank_expect[ i ] = ULONG_MAX;
@@ -460,7 +460,12 @@ typedef struct {
   ulong stake_in_idx;
   fd_stake_ci_t * stake_ci;
 
+  /* The ins from the pack tiles are [pack_in_idx,pack_in_idx+pack_cnt).
+     With more than one pack tile, pack tile i schedules at most
+     fd_pack_shard_limit( max_microblocks_per_slot, pack_cnt, i )
+     microblocks per slot, see fd_pack_shard.h. */
   ulong pack_in_idx;
+  ulong pack_cnt;
 
   fd_pubkey_t identity_key;
 
@@ -1376,9 +1381,9 @@ during_frag( void * _ctx,
     uchar const * dcache_entry = fd_chunk_to_laddr_const( ctx->stake_in.mem, chunk );
     fd_stake_ci_stake_msg_init( ctx->stake_ci, dcache_entry );
     return;
-  } else if( FD_UNLIKELY( in_idx==ctx->pack_in_idx ) ) {
-    /* We now know the real amount of microblocks published, so set an
-       exact bound for once we receive them. */
+  } else if( FD_UNLIKELY( in_idx>=ctx->pack_in_idx ) ) {
+    /* We now know the real amount of microblocks published by this pack
+       tile, so set an exact bound for once we receive them. */
     if( fd_disco_poh_sig_pkt_type( sig )==POH_PKT_TYPE_DONE_PACKING ) {
       FD_TEST( ctx->microblocks_lower_bound<=ctx->max_microblocks_per_slot );
       fd_done_packing_t const * done_packing = fd_chunk_to_laddr( ctx->pack_in.mem, chunk );
@@ -1386,7 +1391,8 @@ during_frag( void * _ctx,
                     ctx->slot,
                     ctx->microblocks_lower_bound,
                     done_packing->microblocks_in_slot ));
-      ctx->microblocks_lower_bound += ctx->max_microblocks_per_slot - done_packing->microblocks_in_slot;
+      ulong pack_max_microblocks = fd_pack_shard_limit( ctx->max_microblocks_per_slot, ctx->pack_cnt, in_idx-ctx->pack_in_idx );
+      ctx->microblocks_lower_bound += pack_max_microblocks - done_packing->microblocks_in_slot;
     }
     *opt_filter = 1;
     return;
@@ -1742,9 +1748,11 @@ unprivileged_init( fd_topo_t *      topo,
 
   ctx->microblocks_lower_bound = 0UL;
 
-  ctx->bank_cnt     = tile->in_cnt-2UL;
-  ctx->stake_in_idx = tile->in_cnt-2UL;
-  ctx->pack_in_idx  = tile->in_cnt-1UL;
+  ctx->bank_cnt     = tile->poh.bank_cnt;
+  ctx->stake_in_idx = tile->poh.bank_cnt;
+  ctx->pack_in_idx  = tile->poh.bank_cnt+1UL;
+  FD_TEST( tile->in_cnt>ctx->pack_in_idx );
+  ctx->pack_cnt     = tile->in_cnt-ctx->pack_in_idx;
 
   FD_TEST( ctx->bank_cnt<=sizeof(ctx->bank_busy)/sizeof(ctx->bank_busy[0]) );
   for( ulong i=0UL; i<ctx->bank_cnt; i++ ) {
@@ -1789,7 +1797,8 @@ unprivileged_init( fd_topo_t *      topo,
   fd_histf_join( fd_histf_new( ctx->slot_done_delay, FD_MHIST_SECONDS_MIN( POH_TILE, SLOT_DONE_DELAY_SECONDS  ),
                                                      FD_MHIST_SECONDS_MAX( POH_TILE, SLOT_DONE_DELAY_SECONDS  ) ) );
 
-  for( ulong i=0; i<tile->in_cnt-1; i++ ) {
+  FD_TEST( ctx->bank_cnt<=sizeof(ctx->bank_in)/sizeof(ctx->bank_in[0]) );
+  for( ulong i=0; i<ctx->bank_cnt; i++ ) {
     fd_topo_link_t * link = &topo->links[ tile->in_link_id[ i ] ];
     fd_topo_wksp_t * link_wksp = &topo->workspaces[ topo->objs[ link->dcache_obj_id ].wksp_id ];
 
@@ -1807,6 +1816,10 @@ unprivileged_init( fd_topo_t *      topo,
   ctx->pack_in.mem    = topo->workspaces[ topo->objs[ topo->links[ tile->in_link_id[ ctx->pack_in_idx ] ].dcache_obj_id ].wksp_id ].wksp;
   ctx->pack_in.chunk0 = fd_dcache_compact_chunk0( ctx->stake_in.mem, topo->links[ tile->in_link_id[ ctx->pack_in_idx ] ].dcache );
   ctx->pack_in.wmark  = fd_dcache_compact_wmark ( ctx->stake_in.mem, topo->links[ tile->in_link_id[ ctx->pack_in_idx ] ].dcache, topo->links[ tile->in_link_id[ ctx->pack_in_idx ] ].mtu );
+  /* The links from all the pack tiles are in the same workspace */
+  for( ulong i=1UL; i<ctx->pack_cnt; i++ ) {
+    FD_TEST( topo->workspaces[ topo->objs[ topo->links[ tile->in_link_id[ ctx->pack_in_idx+i ] ].dcache_obj_id ].wksp_id ].wksp==ctx->pack_in.mem );
+  }
 
   ctx->shred_out_mem    = topo->workspaces[ topo->objs[ topo->links[ tile->out_link_id_primary ].dcache_obj_id ].wksp_id ].wksp;
   ctx->shred_out_chunk0 = fd_dcache_compact_chunk0( ctx->shred_out_mem, topo->links[ tile->out_link_id_primary ].dcache );
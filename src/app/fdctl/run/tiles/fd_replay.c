@@ -4,6 +4,7 @@
 #include "../../../../disco/shred/fd_stake_ci.h"
 #include "../../../../disco/topo/fd_pod_format.h"
 #include "../../../../disco/tvu/fd_replay.h"
+#include "../../../../disco/tvu/fd_replay_sched.h"
 #include "../../../../disco/tvu/fd_tvu.h"
 #include "../../../../flamenco/fd_flamenco.h"
 #include "../../../../flamenco/runtime/context/fd_exec_epoch_ctx.h"
@@ -52,11 +53,47 @@
 #define SCRATCH_MAX    (1024UL /*MiB*/ << 21)
 #define SCRATCH_DEPTH  (128UL) /* 128 scratch frames */
 
+/* Worker scratch is painted with TPOOL_SCRATCH_PAINT at boot so its
+   high water mark can be found by looking for the highest page that
+   was written to, one worker at a time.  Every
+   TPOOL_SCRATCH_CHECK_INTERVAL ns, housekeeping looks at no more than
+   TPOOL_SCRATCH_CHECK_PAGE_MAX pages, so a large scratch is scanned
+   over several calls instead of stalling the tile. */
+#define TPOOL_SCRATCH_PAINT          (0x5a5a5a5a5a5a5a5aUL)
+#define TPOOL_SCRATCH_CHECK_INTERVAL (10000000L)
+#define TPOOL_SCRATCH_CHECK_PAGE_MAX (256UL)
+
 #define VOTE_ACC_MAX   (2000000UL)
 #define FORKS_MAX      (fd_ulong_pow2_up( FD_DEFAULT_SLOTS_PER_EPOCH ))
 
 #define BANK_HASH_CMP_LG_MAX 16
 
+/* Sizing of the queue of batches from the store tile (see replay_drain).
+   Batches larger than SCHED_TXN_MAX txns are executed right away.  Each
+   lane executing a fork concurrently gets at least SCHED_LANE_WORKER_MIN
+   tpool workers. */
+#define SCHED_ITEM_MAX        (256UL)
+#define SCHED_TXN_MAX         (1UL<<14)
+#define SCHED_DELAY_NS        (200000L)
+#define SCHED_EXPIRE_NS       (10L*1000000000L)
+#define SCHED_LANE_WORKER_MIN (2UL)
+
+/* A fd_replay_lane_t describes a batch being executed concurrently with
+   batches of other forks on workers [t0,t1) of the replay tpool. */
+
+struct fd_replay_lane {
+  fd_fork_t *        fork;
+  fd_txn_p_t *       txns;
+  ulong              txn_cnt;
+  fd_capture_ctx_t * capture_ctx;
+  fd_tpool_t *       tpool;
+  ulong              t0;
+  ulong              t1;
+  int                res;
+  uchar              slice_mem[ FD_TPOOL_FOOTPRINT( FD_TILE_MAX ) ] __attribute__( ( aligned( FD_TPOOL_ALIGN ) ) );
+};
+typedef struct fd_replay_lane fd_replay_lane_t;
+
 struct fd_replay_tile_ctx {
   fd_wksp_t * wksp;
 
@@ -126,12 +163,23 @@ struct fd_replay_tile_ctx {
   fd_tpool_t * tpool;
   ulong        max_workers;
 
+  /* Indexed by worker idx in [1,max_workers).  Stacks and scratch are
+     on the NUMA node of the worker's CPU (see fd_replay_thread.c). */
+  void *       tpool_stack      [ FD_TILE_MAX ];
+  uchar *      tpool_scratch    [ FD_TILE_MAX ];
+  ulong        tpool_scratch_sz [ FD_TILE_MAX ];
+  ulong        tpool_scratch_hwm[ FD_TILE_MAX ];
+  ulong        tpool_scratch_check_idx;
+  ulong        tpool_scratch_check_off; /* ULONG_MAX if not mid scan */
+  long         tpool_scratch_check_next;
+
   ulong funk_seed;
   fd_capture_ctx_t * capture_ctx;
   FILE *             capture_file;
 
   fd_bank_hash_cmp_t * bank_hash_cmp;
   fd_latest_vote_t *   latest_votes;
+  fd_latest_vote_t *   fork_latest_votes[ FD_REPLAY_SCHED_ACTIVE_MAX ];
   fd_bft_t *           bft;
   fd_ghost_t *         ghost;
 
@@ -139,6 +187,10 @@ struct fd_replay_tile_ctx {
 
   ulong * bank_busy;
   uint poh_init_done;
+
+  fd_replay_sched_t * sched;
+  ulong               lane_max;
+  fd_replay_lane_t    lanes[ FD_REPLAY_SCHED_LANE_MAX ];
 };
 typedef struct fd_replay_tile_ctx fd_replay_tile_ctx_t;
 
@@ -163,6 +215,10 @@ scratch_footprint( fd_topo_tile_t const * tile FD_PARAM_UNUSED ) {
   l = FD_LAYOUT_APPEND( l, fd_replay_align(), fd_replay_footprint() );
   l = FD_LAYOUT_APPEND( l, fd_forks_align(), fd_forks_footprint( FORKS_MAX ) );
   l = FD_LAYOUT_APPEND( l, fd_latest_vote_deque_align(), fd_latest_vote_deque_footprint() );
+  for( ulong i=0UL; i<FD_REPLAY_SCHED_ACTIVE_MAX; i++ ) {
+    l = FD_LAYOUT_APPEND( l, fd_latest_vote_deque_align(), fd_latest_vote_deque_footprint() );
+  }
+  l = FD_LAYOUT_APPEND( l, fd_replay_sched_align(), fd_replay_sched_footprint( SCHED_ITEM_MAX, SCHED_TXN_MAX ) );
   l = FD_LAYOUT_APPEND( l, FD_CAPTURE_CTX_ALIGN, FD_CAPTURE_CTX_FOOTPRINT );
 
   l = FD_LAYOUT_APPEND( l, fd_bank_hash_cmp_align(), fd_bank_hash_cmp_footprint( ) );
@@ -319,136 +375,167 @@ during_frag( void * _ctx,
   fd_blockstore_end_read( ctx->replay->blockstore );
 }
 
-static void
-after_frag( void *             _ctx,
-            ulong              in_idx     FD_PARAM_UNUSED,
-            ulong              seq,
-            ulong *            opt_sig    FD_PARAM_UNUSED,
-            ulong *            opt_chunk  FD_PARAM_UNUSED,
-            ulong *            opt_sz     FD_PARAM_UNUSED,
-            ulong *            opt_tsorig FD_PARAM_UNUSED,
-            int *              opt_filter,
-            fd_mux_context_t * mux ) {
-  fd_replay_tile_ctx_t * ctx = (fd_replay_tile_ctx_t *)_ctx;
+/* replay_parent_executing returns non-zero if the fork of parent_slot
+   exists and its block is not finished yet, in which case a child
+   block cannot be started on top of it. */
 
-  /* do a replay */
-  ulong txn_cnt = ctx->txn_cnt;
-  fd_txn_p_t * txns       = (fd_txn_p_t *)fd_chunk_to_laddr( ctx->poh_out_mem, ctx->poh_out_chunk );
-  fd_microblock_trailer_t * microblock_trailer = (fd_microblock_trailer_t *)(txns + txn_cnt);
-  
-  // ctx->curr_slot = fd_disco_replay_sig_slot( *opt_sig );
-  // ctx->flags = fd_disco_replay_sig_flags( *opt_sig );
+static int
+replay_parent_executing( fd_replay_tile_ctx_t * ctx,
+                         ulong                  parent_slot ) {
+  fd_fork_t * parent_fork = fd_fork_frontier_ele_query(
+        ctx->replay->forks->frontier, &parent_slot, NULL, ctx->replay->forks->pool );
+  return parent_fork != NULL && parent_fork->executing;
+}
 
-  FD_SCRATCH_SCOPE_BEGIN {
-    /* If the parent fork exists && is executing, give up */
-    fd_fork_t * parent_fork = fd_fork_frontier_ele_query(
-          ctx->replay->forks->frontier, &ctx->parent_slot, NULL, ctx->replay->forks->pool );
-    if( parent_fork != NULL && parent_fork->executing ) {
-      FD_LOG_WARNING(( "parent fork is still executing, cannot process block right now - slot: %lu, parent_slot: %lu", ctx->curr_slot, ctx->parent_slot ));
-      return;
+/* replay_fork_begin returns the fork the current batch (ctx->curr_slot,
+   ctx->parent_slot, ...) should be executed on.  If this is the first
+   batch of the slot, a new fork is created on top of the parent fork,
+   using latest_votes as its latest vote deque.  The caller guarantees
+   the parent fork is not executing (see replay_parent_executing). */
+
+static fd_fork_t *
+replay_fork_begin( fd_replay_tile_ctx_t * ctx,
+                   fd_latest_vote_t *     latest_votes,
+                   fd_mux_context_t *     mux ) {
+  if( FD_UNLIKELY( replay_parent_executing( ctx, ctx->parent_slot ) ) ) {
+    FD_LOG_ERR(( "invariant violation: parent fork is still executing - slot: %lu, parent_slot: %lu", ctx->curr_slot, ctx->parent_slot ));
+  }
+
+  fd_fork_t * fork = fd_fork_frontier_ele_query(
+        ctx->replay->forks->frontier, &ctx->curr_slot, NULL, ctx->replay->forks->pool );
+  if( fork == NULL ) {
+    fork = fd_replay_prepare_ctx( ctx->replay, ctx->parent_slot );
+    fork->executing = 1;
+    // Remove slot ctx from frontier
+    fd_fork_t * child = fd_fork_frontier_ele_remove( ctx->replay->forks->frontier, &fork->slot, NULL, ctx->replay->forks->pool );
+    child->slot = ctx->curr_slot;
+    if( FD_UNLIKELY( fd_fork_frontier_ele_query(
+        ctx->replay->forks->frontier, &ctx->curr_slot, NULL, ctx->replay->forks->pool ) ) ) {
+      FD_LOG_ERR( ( "invariant violation: child slot %lu was already in the frontier", ctx->curr_slot ) );
     }
+    fd_fork_frontier_ele_insert( ctx->replay->forks->frontier, child, ctx->replay->forks->pool );
+    FD_TEST( fork == child );
 
-    fd_fork_t * fork = fd_fork_frontier_ele_query(
-          ctx->replay->forks->frontier, &ctx->curr_slot, NULL, ctx->replay->forks->pool );
-    if( fork == NULL ) {
-      fork = fd_replay_prepare_ctx( ctx->replay, ctx->parent_slot );
-      fork->executing = 1;
-      // Remove slot ctx from frontier
-      fd_fork_t * child = fd_fork_frontier_ele_remove( ctx->replay->forks->frontier, &fork->slot, NULL, ctx->replay->forks->pool );
-      child->slot = ctx->curr_slot;
-      if( FD_UNLIKELY( fd_fork_frontier_ele_query(
-          ctx->replay->forks->frontier, &ctx->curr_slot, NULL, ctx->replay->forks->pool ) ) ) {
-        FD_LOG_ERR( ( "invariant violation: child slot %lu was already in the frontier", ctx->curr_slot ) );
-      }
-      fd_fork_frontier_ele_insert( ctx->replay->forks->frontier, child, ctx->replay->forks->pool );
-      FD_TEST( fork == child );
+    // fork is advancing
+    FD_LOG_NOTICE(( "new block execution - slot: %lu, parent_slot: %lu", ctx->curr_slot, ctx->parent_slot ));
 
-      // fork is advancing
-      FD_LOG_NOTICE(( "new block execution - slot: %lu, parent_slot: %lu", ctx->curr_slot, ctx->parent_slot ));
+    fork->slot_ctx.slot_bank.prev_slot = fork->slot_ctx.slot_bank.slot;
+    fork->slot_ctx.slot_bank.slot      = ctx->curr_slot;
 
-      fork->slot_ctx.slot_bank.prev_slot = fork->slot_ctx.slot_bank.slot;
-      fork->slot_ctx.slot_bank.slot      = ctx->curr_slot;
+    fork->slot_ctx.latest_votes        = latest_votes;
+    fd_latest_vote_deque_remove_all( fork->slot_ctx.latest_votes );
 
-      fork->slot_ctx.latest_votes        = ctx->latest_votes;
-      fd_latest_vote_deque_remove_all( fork->slot_ctx.latest_votes );
+    fd_funk_txn_xid_t xid;
 
-      fd_funk_txn_xid_t xid;
+    fd_memcpy(xid.uc, ctx->blockhash.uc, sizeof(fd_funk_txn_xid_t));
+    xid.ul[0] = fork->slot_ctx.slot_bank.slot;
+    /* push a new transaction on the stack */
+    fd_funk_start_write( ctx->replay->funk );
+    fork->slot_ctx.funk_txn = fd_funk_txn_prepare(ctx->replay->funk, fork->slot_ctx.funk_txn, &xid, 1);
+    fd_funk_end_write( ctx->replay->funk );
 
-      fd_memcpy(xid.uc, ctx->blockhash.uc, sizeof(fd_funk_txn_xid_t));
-      xid.ul[0] = fork->slot_ctx.slot_bank.slot;
-      /* push a new transaction on the stack */
-      fd_funk_start_write( ctx->replay->funk );
-      fork->slot_ctx.funk_txn = fd_funk_txn_prepare(ctx->replay->funk, fork->slot_ctx.funk_txn, &xid, 1);
-      fd_funk_end_write( ctx->replay->funk );
+    int res = fd_runtime_publish_old_txns( &fork->slot_ctx, ctx->capture_ctx, ctx->tpool, ctx->max_workers );
+    if( res != FD_RUNTIME_EXECUTE_SUCCESS ) {
+      FD_LOG_ERR(( "txn publishing failed" ));
+    }
 
-      int res = fd_runtime_publish_old_txns( &fork->slot_ctx, ctx->capture_ctx );
-      if( res != FD_RUNTIME_EXECUTE_SUCCESS ) {
-        FD_LOG_ERR(( "txn publishing failed" ));
-      }
-
-      /* if it is an epoch boundary, push out stake weights */
-      int is_new_epoch = 0;
-      if( fork->slot_ctx.slot_bank.slot != 0 ) {
-        ulong slot_idx;
-        fd_epoch_bank_t * epoch_bank = fd_exec_epoch_ctx_epoch_bank( fork->slot_ctx.epoch_ctx );
-        ulong prev_epoch = fd_slot_to_epoch( &epoch_bank->epoch_schedule, fork->slot_ctx.slot_bank.prev_slot, &slot_idx );
-        ulong new_epoch = fd_slot_to_epoch( &epoch_bank->epoch_schedule, fork->slot_ctx.slot_bank.slot, &slot_idx );
-
-        if( prev_epoch < new_epoch || slot_idx == 0 ) {
-          FD_LOG_DEBUG(("Epoch boundary"));
-          is_new_epoch = 1;
-        }
+    /* if it is an epoch boundary, push out stake weights */
+    int is_new_epoch = 0;
+    if( fork->slot_ctx.slot_bank.slot != 0 ) {
+      ulong slot_idx;
+      fd_epoch_bank_t * epoch_bank = fd_exec_epoch_ctx_epoch_bank( fork->slot_ctx.epoch_ctx );
+      ulong prev_epoch = fd_slot_to_epoch( &epoch_bank->epoch_schedule, fork->slot_ctx.slot_bank.prev_slot, &slot_idx );
+      ulong new_epoch = fd_slot_to_epoch( &epoch_bank->epoch_schedule, fork->slot_ctx.slot_bank.slot, &slot_idx );
+
+      if( prev_epoch < new_epoch || slot_idx == 0 ) {
+        FD_LOG_DEBUG(("Epoch boundary"));
+        is_new_epoch = 1;
       }
+    }
 
-      res = fd_runtime_block_execute_prepare( &fork->slot_ctx );
+    res = fd_runtime_block_execute_prepare( &fork->slot_ctx );
 
-      if( is_new_epoch ) {
-        publish_stake_weights( ctx, mux, &fork->slot_ctx );
-      }
+    if( is_new_epoch ) {
+      publish_stake_weights( ctx, mux, &fork->slot_ctx );
+    }
 
-      if( res != FD_RUNTIME_EXECUTE_SUCCESS ) {
-        FD_LOG_ERR(( "block prep execute failed" ));
-      }
+    if( res != FD_RUNTIME_EXECUTE_SUCCESS ) {
+      FD_LOG_ERR(( "block prep execute failed" ));
     }
+  }
 
-    if( ctx->capture_ctx )
-      fd_solcap_writer_set_slot( ctx->capture_ctx->capture, fork->slot_ctx.slot_bank.slot );
-    // Exeecute all txns which were succesfully prepared
-    int res = fd_runtime_execute_txns_in_waves_tpool( &fork->slot_ctx, ctx->capture_ctx,
-                                                      txns, txn_cnt,
-                                                      ctx->tpool, ctx->max_workers );
-    if( res != 0 && !( ctx->flags & REPLAY_FLAG_PACKED_MICROBLOCK ) ) {
-      FD_LOG_WARNING(( "block invalid - slot: %lu", ctx->curr_slot ));
-      *opt_filter = 1;
-      return;
+  if( ctx->capture_ctx )
+    fd_solcap_writer_set_slot( ctx->capture_ctx->capture, fork->slot_ctx.slot_bank.slot );
+
+  return fork;
+}
+
+/* replay_fork_end finishes the current batch once its txns (in the poh
+   out chunk) have been executed on fork with result exec_res: finalizes
+   the block if this was its last batch, runs fork choice and forwards
+   the batch to poh.  seq and in_tsorig are those of the in frag the
+   batch came from.  Returns 0 on success and non-zero if the block is
+   invalid. */
+
+static int
+replay_fork_end( fd_replay_tile_ctx_t * ctx,
+                 fd_fork_t *            fork,
+                 int                    exec_res,
+                 ulong                  seq,
+                 ulong                  in_tsorig ) {
+  ulong txn_cnt = ctx->txn_cnt;
+  fd_txn_p_t * txns       = (fd_txn_p_t *)fd_chunk_to_laddr( ctx->poh_out_mem, ctx->poh_out_chunk );
+  fd_microblock_trailer_t * microblock_trailer = (fd_microblock_trailer_t *)(txns + txn_cnt);
+
+  if( exec_res != 0 && !( ctx->flags & REPLAY_FLAG_PACKED_MICROBLOCK ) ) {
+    FD_LOG_WARNING(( "block invalid - slot: %lu", ctx->curr_slot ));
+    return 1;
+  }
+
+  if( ctx->flags & REPLAY_FLAG_FINISHED_BLOCK ) {
+    FD_LOG_INFO(( "finalizing block - slot: %lu, parent_slot: %lu, blockhash: %32J", ctx->curr_slot, ctx->parent_slot, ctx->blockhash.uc ));
+    // Copy over latest blockhash to slot_bank poh for updating the sysvars
+    fd_memcpy( fork->slot_ctx.slot_bank.poh.uc, ctx->blockhash.uc, sizeof(fd_hash_t) );
+
+    /* The funk txn of a block streamed by the store tile was created
+       before its block hash was known (it is keyed by the poh hash of
+       the first batch).  Finish the block in a child txn keyed by the
+       block hash, which is what restoring the fork later expects. */
+    fd_funk_txn_xid_t xid;
+    fd_memcpy( xid.uc, ctx->blockhash.uc, sizeof(fd_funk_txn_xid_t) );
+    xid.ul[0] = fork->slot_ctx.slot_bank.slot;
+    if( FD_UNLIKELY( !fd_funk_txn_xid_eq( &xid, fd_funk_txn_xid( fork->slot_ctx.funk_txn ) ) ) ) {
+      fd_funk_start_write( ctx->replay->funk );
+      fork->slot_ctx.funk_txn = fd_funk_txn_prepare( ctx->replay->funk, fork->slot_ctx.funk_txn, &xid, 1 );
+      fd_funk_end_write( ctx->replay->funk );
+      if( FD_UNLIKELY( !fork->slot_ctx.funk_txn ) ) FD_LOG_ERR(( "failed to prepare funk txn for streamed block - slot: %lu", ctx->curr_slot ));
     }
 
-    if( ctx->flags & REPLAY_FLAG_FINISHED_BLOCK ) {
-      FD_LOG_INFO(( "finalizing block - slot: %lu, parent_slot: %lu, blockhash: %32J", ctx->curr_slot, ctx->parent_slot, ctx->blockhash.uc ));
-      // Copy over latest blockhash to slot_bank poh for updating the sysvars
-      fd_memcpy( fork->slot_ctx.slot_bank.poh.uc, ctx->blockhash.uc, sizeof(fd_hash_t) );
-      fd_block_info_t block_info[1];
-      block_info->signature_cnt = fork->slot_ctx.signature_cnt;
-      int res = fd_runtime_block_execute_finalize_tpool( &fork->slot_ctx, ctx->capture_ctx, block_info, NULL, 1UL );
-      if( res != FD_RUNTIME_EXECUTE_SUCCESS ) {
-        FD_LOG_WARNING(("block finalize failed"));
-        *opt_filter = 1;
-        return;
-      }
+    fd_block_info_t block_info[1];
+    block_info->signature_cnt = fork->slot_ctx.signature_cnt;
+    int res = fd_runtime_block_execute_finalize_tpool( &fork->slot_ctx, ctx->capture_ctx, block_info, NULL, 1UL );
+    if( res != FD_RUNTIME_EXECUTE_SUCCESS ) {
+      FD_LOG_WARNING(("block finalize failed"));
+      return 1;
+    }
 
-      // Notify for all the updated accounts
+    // Notify for all the updated accounts
 #define NOTIFY_START msg = fd_chunk_to_laddr( ctx->notif_out_mem, ctx->notif_out_chunk )
 #define NOTIFY_END                                                      \
-      fd_mcache_publish( ctx->notif_out_mcache, ctx->notif_out_depth, ctx->notif_out_seq, \
-                         0UL, ctx->notif_out_chunk, sizeof(fd_replay_notif_msg_t), 0UL, tsorig, tsorig ); \
-      ctx->notif_out_seq   = fd_seq_inc( ctx->notif_out_seq, 1UL );     \
-      ctx->notif_out_chunk = fd_dcache_compact_next( ctx->notif_out_chunk, sizeof(fd_replay_notif_msg_t), \
-                                                     ctx->notif_out_chunk0, ctx->notif_out_wmark ); \
-      msg = NULL
-
-      ulong tsorig = fd_frag_meta_ts_comp( fd_tickcount() );
-      fd_replay_notif_msg_t * msg = NULL;
-      for( fd_funk_rec_t const * rec = fd_funk_txn_first_rec( ctx->replay->funk, fork->slot_ctx.funk_txn );
+    fd_mcache_publish( ctx->notif_out_mcache, ctx->notif_out_depth, ctx->notif_out_seq, \
+                       0UL, ctx->notif_out_chunk, sizeof(fd_replay_notif_msg_t), 0UL, tsorig, tsorig ); \
+    ctx->notif_out_seq   = fd_seq_inc( ctx->notif_out_seq, 1UL );     \
+    ctx->notif_out_chunk = fd_dcache_compact_next( ctx->notif_out_chunk, sizeof(fd_replay_notif_msg_t), \
+                                                   ctx->notif_out_chunk0, ctx->notif_out_wmark ); \
+    msg = NULL
+
+    ulong tsorig = fd_frag_meta_ts_comp( fd_tickcount() );
+    fd_replay_notif_msg_t * msg = NULL;
+    fd_funk_txn_t * txn_map = fd_funk_txn_map( ctx->replay->funk, fd_funk_wksp( ctx->replay->funk ) );
+    for( fd_funk_txn_t * txn = fork->slot_ctx.funk_txn;
+         txn != NULL && fd_funk_txn_xid( txn )->ul[0] == fork->slot_ctx.slot_bank.slot;
+         txn = fd_funk_txn_parent( txn, txn_map ) ) {
+      for( fd_funk_rec_t const * rec = fd_funk_txn_first_rec( ctx->replay->funk, txn );
            rec != NULL;
            rec = fd_funk_txn_next_rec( ctx->replay->funk, rec ) ) {
         if( !fd_funk_key_is_acc( rec->pair.key ) ) continue;
@@ -466,163 +553,412 @@ after_frag( void *             _ctx,
       if( msg ) {
         NOTIFY_END;
       }
+    }
 
-      {
-        NOTIFY_START;
-        msg->type = FD_REPLAY_SLOT_TYPE;
-        msg->slot_exec.slot = fork->slot_ctx.slot_bank.slot;
-        msg->slot_exec.parent = fork->slot_ctx.slot_bank.prev_slot;
-        msg->slot_exec.root = ctx->replay->blockstore->smr;
-        memcpy( &msg->slot_exec.bank_hash, &fork->slot_ctx.slot_bank.banks_hash, sizeof( fd_hash_t ) );
-        NOTIFY_END;
-      }
+    {
+      NOTIFY_START;
+      msg->type = FD_REPLAY_SLOT_TYPE;
+      msg->slot_exec.slot = fork->slot_ctx.slot_bank.slot;
+      msg->slot_exec.parent = fork->slot_ctx.slot_bank.prev_slot;
+      msg->slot_exec.root = ctx->replay->blockstore->smr;
+      memcpy( &msg->slot_exec.bank_hash, &fork->slot_ctx.slot_bank.banks_hash, sizeof( fd_hash_t ) );
+      NOTIFY_END;
+    }
 
 #undef NOTIFY_START
 #undef NOTIFY_END
 
-      fd_blockstore_start_write( ctx->replay->blockstore );
+    fd_blockstore_start_write( ctx->replay->blockstore );
 
-      fd_block_t * block_ = fd_blockstore_block_query( ctx->replay->blockstore, ctx->curr_slot );
-      if( FD_LIKELY( block_ ) ) {
-        block_->flags = fd_uchar_set_bit( block_->flags, FD_BLOCK_FLAG_PROCESSED );
-        memcpy( &block_->bank_hash, &fork->slot_ctx.slot_bank.banks_hash, sizeof( fd_hash_t ) );
-      }
+    fd_block_t * block_ = fd_blockstore_block_query( ctx->replay->blockstore, ctx->curr_slot );
+    long         shred_ts = 0L;
+    if( FD_LIKELY( block_ ) ) {
+      block_->flags = fd_uchar_set_bit( block_->flags, FD_BLOCK_FLAG_PROCESSED );
+      memcpy( &block_->bank_hash, &fork->slot_ctx.slot_bank.banks_hash, sizeof( fd_hash_t ) );
+      shred_ts = block_->ts;
+    }
 
-      fd_blockstore_end_write( ctx->replay->blockstore );
+    fd_blockstore_end_write( ctx->replay->blockstore );
 
-      fork->executing = 0;
-      // Remove slot ctx from frontier once block is finalized
-      fd_fork_t * child = fd_fork_frontier_ele_remove( ctx->replay->forks->frontier, &fork->slot, NULL, ctx->replay->forks->pool );
-      child->slot = ctx->curr_slot;
-      if( FD_UNLIKELY( fd_fork_frontier_ele_query(
-          ctx->replay->forks->frontier, &ctx->curr_slot, NULL, ctx->replay->forks->pool ) ) ) {
-        FD_LOG_ERR( ( "invariant violation: child slot %lu was already in the frontier", ctx->curr_slot ) );
-      }
-      fd_fork_frontier_ele_insert( ctx->replay->forks->frontier, child, ctx->replay->forks->pool );
+    /* block_->ts is when the last shred of the block was received */
+    if( FD_LIKELY( shred_ts ) ) {
+      long lat = fd_log_wallclock() - shred_ts;
+      FD_LOG_NOTICE(( "bank hash - slot: %lu, hash: %32J, last shred to bank hash: %.3f ms",
+                      ctx->curr_slot, fork->slot_ctx.slot_bank.banks_hash.hash, (double)lat / 1e6 ));
+    }
 
-      /* Consensus */
+    fork->executing = 0;
+    // Remove slot ctx from frontier once block is finalized
+    fd_fork_t * child = fd_fork_frontier_ele_remove( ctx->replay->forks->frontier, &fork->slot, NULL, ctx->replay->forks->pool );
+    child->slot = ctx->curr_slot;
+    if( FD_UNLIKELY( fd_fork_frontier_ele_query(
+        ctx->replay->forks->frontier, &ctx->curr_slot, NULL, ctx->replay->forks->pool ) ) ) {
+      FD_LOG_ERR( ( "invariant violation: child slot %lu was already in the frontier", ctx->curr_slot ) );
+    }
+    fd_fork_frontier_ele_insert( ctx->replay->forks->frontier, child, ctx->replay->forks->pool );
 
-      FD_PARAM_UNUSED long tic_ = fd_log_wallclock();
-      fd_bft_fork_update( ctx->bft, fork );
-      long        tic         = fd_log_wallclock();
-      fd_fork_t * fork_choice = fd_bft_fork_choice( ctx->replay->bft );
-      long        toc         = fd_log_wallclock();
-      ulong       vote_cnt    = fd_latest_vote_deque_cnt( ctx->latest_votes );
-      if( FD_UNLIKELY( fork_choice->slot < fork->slot - 32 ) ) {
-        FD_LOG_WARNING( ( "Fork choice slot is too far behind executed slot. Likely there is a "
-                          "bug in execution that is interfering with our ability to process recent votes." ) );
+    /* Consensus */
 
-        /* Don't try to proceed with fork choice and voting as our view of where the stake is probably wrong */
+    FD_PARAM_UNUSED long tic_ = fd_log_wallclock();
+    fd_bft_fork_update( ctx->bft, fork );
+    long        tic         = fd_log_wallclock();
+    fd_fork_t * fork_choice = fd_bft_fork_choice( ctx->replay->bft );
+    long        toc         = fd_log_wallclock();
+    ulong       vote_cnt    = fd_latest_vote_deque_cnt( fork->slot_ctx.latest_votes );
+    if( FD_UNLIKELY( fork_choice->slot < fork->slot - 32 ) ) {
+      FD_LOG_WARNING( ( "Fork choice slot is too far behind executed slot. Likely there is a "
+                        "bug in execution that is interfering with our ability to process recent votes." ) );
 
-      } else {
+      /* Don't try to proceed with fork choice and voting as our view of where the stake is probably wrong */
 
-        /* TODO add voting and select_vote_and_reset_bank logic here if we have a valid picked fork */
-
-        FD_LOG_NOTICE( ( "\n\n[Fork Selection]\n"
-                         "vote count:    %lu \n"
-                         "selected fork: %lu\n"
-                         "took:          %.2lf ms (%ld ns)\n",
-                         vote_cnt,
-                         fork_choice->slot,
-                         (double)( toc - tic ) / 1e6,
-                         toc - tic ) );
-        memcpy( microblock_trailer->hash, fork_choice->slot_ctx.slot_bank.block_hash_queue.last_hash->uc, sizeof(fd_hash_t) );
-        if( ctx->poh_init_done == 1 ) {
-          ulong parent_slot = fork_choice->slot_ctx.slot_bank.prev_slot;
-          ulong curr_slot = fork_choice->slot_ctx.slot_bank.slot;
-          FD_LOG_INFO(( "publishing mblk to poh - slot: %lu, parent_slot: %lu, flags: %lx", curr_slot, parent_slot, ctx->flags ));
-          ulong tspub = fd_frag_meta_ts_comp( fd_tickcount() );
-          ulong sig = fd_disco_replay_sig( curr_slot, ctx->flags );
-          fd_mcache_publish( ctx->poh_out_mcache, ctx->poh_out_depth, ctx->poh_out_seq, sig, ctx->poh_out_chunk, txn_cnt, 0UL, *opt_tsorig, tspub );
-          ctx->poh_out_chunk = fd_dcache_compact_next( ctx->poh_out_chunk, (txn_cnt * sizeof(fd_txn_p_t)) + sizeof(fd_microblock_trailer_t), ctx->poh_out_chunk0, ctx->poh_out_wmark );
-          ctx->poh_out_seq = fd_seq_inc( ctx->poh_out_seq, 1UL );
-        } else {
-          FD_LOG_INFO(( "NOT publishing mblk to poh - slot: %lu, parent_slot: %lu, flags: %lx", ctx->curr_slot, ctx->parent_slot, ctx->flags ));
-        }
+    } else {
+
+      /* TODO add voting and select_vote_and_reset_bank logic here if we have a valid picked fork */
+
+      FD_LOG_NOTICE( ( "\n\n[Fork Selection]\n"
+                       "vote count:    %lu \n"
+                       "selected fork: %lu\n"
+                       "took:          %.2lf ms (%ld ns)\n",
+                       vote_cnt,
+                       fork_choice->slot,
+                       (double)( toc - tic ) / 1e6,
+                       toc - tic ) );
+      memcpy( microblock_trailer->hash, fork_choice->slot_ctx.slot_bank.block_hash_queue.last_hash->uc, sizeof(fd_hash_t) );
+      if( ctx->poh_init_done == 1 ) {
+        ulong parent_slot = fork_choice->slot_ctx.slot_bank.prev_slot;
+        ulong curr_slot = fork_choice->slot_ctx.slot_bank.slot;
+        FD_LOG_INFO(( "publishing mblk to poh - slot: %lu, parent_slot: %lu, flags: %lx", curr_slot, parent_slot, ctx->flags ));
+        ulong tspub = fd_frag_meta_ts_comp( fd_tickcount() );
+        ulong sig = fd_disco_replay_sig( curr_slot, ctx->flags );
+        fd_mcache_publish( ctx->poh_out_mcache, ctx->poh_out_depth, ctx->poh_out_seq, sig, ctx->poh_out_chunk, txn_cnt, 0UL, in_tsorig, tspub );
+        ctx->poh_out_chunk = fd_dcache_compact_next( ctx->poh_out_chunk, (txn_cnt * sizeof(fd_txn_p_t)) + sizeof(fd_microblock_trailer_t), ctx->poh_out_chunk0, ctx->poh_out_wmark );
+        ctx->poh_out_seq = fd_seq_inc( ctx->poh_out_seq, 1UL );
+      } else {
+        FD_LOG_INFO(( "NOT publishing mblk to poh - slot: %lu, parent_slot: %lu, flags: %lx", ctx->curr_slot, ctx->parent_slot, ctx->flags ));
       }
+    }
+
+    fd_slot_hash_t    curr_slot_hash = { .slot = child->slot,
+                                         .hash = fork->slot_ctx.slot_bank.banks_hash };
+    fd_ghost_node_t * curr           = fd_ghost_node_query( ctx->ghost, &curr_slot_hash );
+    fd_ghost_node_t * prev           = curr;
+    for( ulong i = 0; i < 8; i++ ) {
+      if( !curr ) break;
+      prev = curr;
+      curr = curr->parent;
+    }
+    fd_ghost_node_t * root = fd_ptr_if( !!curr, curr, prev );
+    fd_ghost_print( ctx->ghost, root );
+
+    /* Prepare bank for next execution. */
+
+    child->slot_ctx.slot_bank.slot           = ctx->curr_slot;
+    child->slot_ctx.slot_bank.collected_fees = 0;
+    child->slot_ctx.slot_bank.collected_rent = 0;
+
+
+    fd_hash_t const * bank_hash = &child->slot_ctx.slot_bank.banks_hash;
 
-      fd_slot_hash_t    curr_slot_hash = { .slot = child->slot,
-                                           .hash = fork->slot_ctx.slot_bank.banks_hash };
-      fd_ghost_node_t * curr           = fd_ghost_node_query( ctx->ghost, &curr_slot_hash );
-      fd_ghost_node_t * prev           = curr;
-      for( ulong i = 0; i < 8; i++ ) {
-        if( !curr ) break;
-        prev = curr;
-        curr = curr->parent;
+    fd_bank_hash_cmp_t * bank_hash_cmp = child->slot_ctx.epoch_ctx->bank_hash_cmp;
+    fd_bank_hash_cmp_lock( bank_hash_cmp );
+    fd_bank_hash_cmp_insert( bank_hash_cmp, ctx->curr_slot, bank_hash, 1, 0 );
+
+    /* Try to move the bank hash comparison watermark forward */
+
+    for( ulong cmp_slot = bank_hash_cmp->watermark + 1; cmp_slot < ctx->curr_slot; cmp_slot++ ) {
+      if( FD_LIKELY( fd_bank_hash_cmp_check( bank_hash_cmp, cmp_slot ) ) ) {
+        bank_hash_cmp->watermark = cmp_slot;
       }
-      fd_ghost_node_t * root = fd_ptr_if( !!curr, curr, prev );
-      fd_ghost_print( ctx->ghost, root );
+    }
+
+    fd_bank_hash_cmp_unlock( bank_hash_cmp );
+
+    if (NULL != ctx->capture_ctx)
+      fd_solcap_writer_flush( ctx->capture_ctx->capture );
+  }
+
+  /* Indicate to pack tile we are done processing the transactions so it
+   can pack new microblocks using these accounts.  DO NOT USE THE
+   SANITIZED TRANSACTIONS AFTER THIS POINT, THEY ARE NO LONGER VALID. */
+  fd_fseq_update( ctx->bank_busy, seq );
+
+  if( FD_UNLIKELY( !(ctx->flags & REPLAY_FLAG_CATCHING_UP) && ctx->poh_init_done == 0 && ctx->slot_ctx->blockstore ) ) {
+    FD_LOG_INFO(( "sending init msg" ));
+    fd_poh_init_msg_t * msg = fd_chunk_to_laddr(ctx->poh_out_mem, ctx->poh_out_chunk);
+    fd_epoch_bank_t * epoch_bank = fd_exec_epoch_ctx_epoch_bank( ctx->epoch_ctx );
+    msg->hashcnt_per_tick = ctx->epoch_ctx->epoch_bank.hashes_per_tick;
+    msg->ticks_per_slot   = ctx->epoch_ctx->epoch_bank.ticks_per_slot;
+    msg->hashcnt_duration_ns = (double)(epoch_bank->ns_per_slot / epoch_bank->ticks_per_slot) / (double) msg->hashcnt_per_tick;
+    if( ctx->slot_ctx->slot_bank.block_hash_queue.last_hash ) {
+      memcpy(msg->last_entry_hash, ctx->slot_ctx->slot_bank.block_hash_queue.last_hash->uc, sizeof(fd_hash_t));
+    } else {
+      memset(msg->last_entry_hash, 0UL, sizeof(fd_hash_t));
+    }
+    msg->tick_height = ctx->slot_ctx->slot_bank.slot * msg->ticks_per_slot;
+
+    ulong sig = fd_disco_replay_sig( ctx->slot_ctx->slot_bank.slot, REPLAY_FLAG_INIT );
+    fd_mcache_publish(ctx->poh_out_mcache, ctx->poh_out_depth, ctx->poh_out_seq, sig, ctx->poh_out_chunk, sizeof(fd_poh_init_msg_t), 0UL, in_tsorig, 0UL);
+    ctx->poh_out_chunk = fd_dcache_compact_next(ctx->poh_out_chunk, sizeof(fd_poh_init_msg_t), ctx->poh_out_chunk0, ctx->poh_out_wmark);
+    ctx->poh_out_seq = fd_seq_inc(ctx->poh_out_seq, 1UL);
+    ctx->poh_init_done = 1;
+  }
+  /* Publish mblk to POH. */
+
+  if( ctx->poh_init_done == 1 && !( ctx->flags & REPLAY_FLAG_FINISHED_BLOCK ) 
+      && ( ( ctx->flags & REPLAY_FLAG_MICROBLOCK ) || ( ctx->flags & REPLAY_FLAG_PACKED_MICROBLOCK ) ) ) {
+    FD_LOG_INFO(( "publishing mblk to poh - slot: %lu, parent_slot: %lu", ctx->curr_slot, ctx->parent_slot ));
+    ulong tspub = fd_frag_meta_ts_comp( fd_tickcount() );
+    ulong sig = fd_disco_replay_sig( ctx->curr_slot, ctx->flags );
+    fd_mcache_publish( ctx->poh_out_mcache, ctx->poh_out_depth, ctx->poh_out_seq, sig, ctx->poh_out_chunk, txn_cnt, 0UL, in_tsorig, tspub );
+    ctx->poh_out_chunk = fd_dcache_compact_next( ctx->poh_out_chunk, (txn_cnt * sizeof(fd_txn_p_t)) + sizeof(fd_microblock_trailer_t), ctx->poh_out_chunk0, ctx->poh_out_wmark );
+    ctx->poh_out_seq = fd_seq_inc( ctx->poh_out_seq, 1UL );
+  } else {
+    FD_LOG_INFO(( "NOT publishing mblk to poh - slot: %lu, parent_slot: %lu, flags: %lx", ctx->curr_slot, ctx->parent_slot, ctx->flags ));
+  }
+
+  return 0;
+}
+
+/* Concurrent replay of sibling forks.
+
+   Batches from the store tile are not executed right away, they are
+   queued in ctx->sched and executed in rounds.  Each round picks up to
+   lane_max ready batches of distinct slots (i.e. on distinct forks,
+   heaviest forks first according to ghost), splits the tpool workers
+   between them and executes them concurrently, each on its own slice of
+   the tpool.  Creating the forks before the round and finalizing and
+   publishing the batches after it is done serially by the tile.
+   Children of a slot that is still executing wait in the queue until
+   their parent is done.
+
+   A round starts as soon as there are enough ready batches to keep
+   all the lanes busy, or when the oldest queued batch has waited for
+   SCHED_DELAY_NS (to give batches of sibling forks a chance to
+   arrive). */
+
+static void
+replay_lane_exec( fd_replay_lane_t * lane ) {
+  fd_tpool_t * slice = fd_tpool_slice_init( lane->slice_mem, lane->tpool, lane->t0, lane->t1 );
+  if( FD_UNLIKELY( !slice ) ) FD_LOG_ERR(( "failed to slice tpool" ));
+
+  /* Lanes read funk (txn and rec maps, record values) directly while
+     other lanes update it, so each lane runs in a funk read section:
+     a write section of a lane waits for the other lanes to be in a
+     write section of their own or done. */
+  fd_funk_t * funk = lane->fork->slot_ctx.acc_mgr->funk;
+  fd_funk_start_read( funk );
+  lane->res = fd_runtime_execute_txns_in_waves_tpool( &lane->fork->slot_ctx, lane->capture_ctx,
+                                                      lane->txns, lane->txn_cnt,
+                                                      slice, lane->t1 - lane->t0 );
+  fd_funk_end_read( funk );
+}
+
+static void
+replay_lane_task( void * tpool,
+                  ulong  t0,     ulong t1,
+                  void * args,
+                  void * reduce, ulong stride,
+                  ulong  l0,     ulong l1,
+                  ulong  m0,     ulong m1,
+                  ulong  n0,     ulong n1 ) {
+  (void)tpool; (void)t0; (void)t1; (void)reduce; (void)stride; (void)l0; (void)l1; (void)m0; (void)m1; (void)n0; (void)n1;
+  replay_lane_exec( (fd_replay_lane_t *)args );
+}
 
-      /* Prepare bank for next execution. */
+/* replay_fork_weight returns the ghost weight of the fork that a batch
+   with parent parent_slot extends. */
 
-      child->slot_ctx.slot_bank.slot           = ctx->curr_slot;
-      child->slot_ctx.slot_bank.collected_fees = 0;
-      child->slot_ctx.slot_bank.collected_rent = 0;
+static ulong
+replay_fork_weight( fd_replay_tile_ctx_t * ctx,
+                    ulong                  parent_slot ) {
+  fd_slot_hash_t key = { .slot = parent_slot };
+  int found = 0;
+  fd_blockstore_start_read( ctx->replay->blockstore );
+  fd_block_t * block = fd_blockstore_block_query( ctx->replay->blockstore, parent_slot );
+  if( FD_LIKELY( block ) ) {
+    key.hash = block->bank_hash;
+    found    = 1;
+  }
+  fd_blockstore_end_read( ctx->replay->blockstore );
+  if( FD_UNLIKELY( !found ) ) return 0UL;
 
+  fd_ghost_node_t const * node = fd_ghost_node_query( ctx->ghost, &key );
+  return node ? node->weight : 0UL;
+}
 
-      fd_hash_t const * bank_hash = &child->slot_ctx.slot_bank.banks_hash;
+static void
+replay_load_item( fd_replay_tile_ctx_t *         ctx,
+                  fd_replay_sched_item_t const * item ) {
+  ctx->curr_slot   = item->slot;
+  ctx->parent_slot = item->parent_slot;
+  ctx->flags       = item->flags;
+  ctx->txn_cnt     = item->txn_cnt;
+  fd_memcpy( ctx->blockhash.uc, item->blockhash, sizeof(fd_hash_t) );
+}
 
-      fd_bank_hash_cmp_t * bank_hash_cmp = child->slot_ctx.epoch_ctx->bank_hash_cmp;
-      fd_bank_hash_cmp_lock( bank_hash_cmp );
-      fd_bank_hash_cmp_insert( bank_hash_cmp, ctx->curr_slot, bank_hash, 1, 0 );
+/* replay_drain executes rounds of queued batches until there is
+   nothing ready to execute or, unless force is set, it is better to
+   wait for more batches. */
 
-      /* Try to move the bank hash comparison watermark forward */
+static void
+replay_drain( fd_replay_tile_ctx_t * ctx,
+              fd_mux_context_t *     mux,
+              int                    force ) {
+  fd_replay_sched_t *      sched = ctx->sched;
+  fd_replay_sched_item_t * ready[ FD_REPLAY_SCHED_SLOT_MAX ];
+  ulong                    lane_t0[ FD_REPLAY_SCHED_LANE_MAX+1UL ];
+
+  while( fd_replay_sched_pending_cnt( sched ) ) {
+    ulong ready_cnt = fd_replay_sched_ready( sched, ready, FD_REPLAY_SCHED_SLOT_MAX );
+
+    /* The parent of a slot can also be executing outside of the
+       scheduler (our own leader slot), its children wait in the queue
+       until it is done */
+    ulong keep_cnt = 0UL;
+    for( ulong i=0UL; i<ready_cnt; i++ ) {
+      if( FD_UNLIKELY( replay_parent_executing( ctx, ready[ i ]->parent_slot ) ) ) continue;
+      ready[ keep_cnt++ ] = ready[ i ];
+    }
+    ready_cnt = keep_cnt;
+    if( !ready_cnt ) break;
+    if( !force && ready_cnt<ctx->lane_max &&
+        fd_log_wallclock()-fd_replay_sched_oldest_ts( sched )<SCHED_DELAY_NS ) break;
+
+    for( ulong i=0UL; i<ready_cnt; i++ ) ready[ i ]->weight = replay_fork_weight( ctx, ready[ i ]->parent_slot );
+    ulong lane_cnt = fd_replay_sched_plan( ready, ready_cnt, ctx->max_workers, ctx->lane_max, lane_t0 );
+
+    FD_SCRATCH_SCOPE_BEGIN {
+      for( ulong i=0UL; i<lane_cnt; i++ ) {
+        fd_replay_sched_item_t * item = ready[ i ];
+        fd_replay_lane_t *       lane = &ctx->lanes[ i ];
+        fd_replay_sched_start( sched, item );
+        replay_load_item( ctx, item );
+        lane->fork        = replay_fork_begin( ctx, ctx->fork_latest_votes[ item->active_idx ], mux );
+        lane->tpool       = ctx->tpool;
+        lane->t0          = lane_t0[ i     ];
+        lane->t1          = lane_t0[ i+1UL ];
+        lane->capture_ctx = ctx->capture_ctx;
+        lane->txns        = item->txns;
+        lane->txn_cnt     = item->txn_cnt;
+        lane->res         = -1;
+      }
 
-      for( ulong cmp_slot = bank_hash_cmp->watermark + 1; cmp_slot < ctx->curr_slot; cmp_slot++ ) {
-        if( FD_LIKELY( fd_bank_hash_cmp_check( bank_hash_cmp, cmp_slot ) ) ) {
-          bank_hash_cmp->watermark = cmp_slot;
+      for( ulong i=1UL; i<lane_cnt; i++ )
+        fd_tpool_exec( ctx->tpool, lane_t0[ i ], replay_lane_task, NULL, 0UL, 1UL, &ctx->lanes[ i ], NULL, 0UL, 0UL, 0UL, 0UL, 1UL, 0UL, 1UL );
+      replay_lane_exec( &ctx->lanes[ 0 ] );
+      for( ulong i=1UL; i<lane_cnt; i++ ) fd_tpool_wait( ctx->tpool, lane_t0[ i ] );
+
+      for( ulong i=0UL; i<lane_cnt; i++ ) {
+        fd_replay_sched_item_t * item = ready[ i ];
+        fd_replay_lane_t *       lane = &ctx->lanes[ i ];
+        replay_load_item( ctx, item );
+        fd_memcpy( fd_chunk_to_laddr( ctx->poh_out_mem, ctx->poh_out_chunk ), item->txns, item->txn_cnt*sizeof(fd_txn_p_t) );
+        int invalid = replay_fork_end( ctx, lane->fork, lane->res, item->seq, item->tsorig );
+        ulong slot  = item->slot;
+        fd_replay_sched_done( sched, item );
+        if( FD_UNLIKELY( invalid ) ) {
+          ulong drop_cnt = fd_replay_sched_cancel( sched, slot );
+          if( drop_cnt ) FD_LOG_WARNING(( "dropped %lu queued batches of slot %lu and its descendants", drop_cnt, slot ));
         }
       }
+    } FD_SCRATCH_SCOPE_END;
+  }
+}
 
-      fd_bank_hash_cmp_unlock( bank_hash_cmp );
+static void
+after_frag( void *             _ctx,
+            ulong              in_idx,
+            ulong              seq,
+            ulong *            opt_sig    FD_PARAM_UNUSED,
+            ulong *            opt_chunk  FD_PARAM_UNUSED,
+            ulong *            opt_sz     FD_PARAM_UNUSED,
+            ulong *            opt_tsorig,
+            int *              opt_filter,
+            fd_mux_context_t * mux ) {
+  fd_replay_tile_ctx_t * ctx = (fd_replay_tile_ctx_t *)_ctx;
 
-      if (NULL != ctx->capture_ctx)
-        fd_solcap_writer_flush( ctx->capture_ctx->capture );
+  ulong txn_cnt = ctx->txn_cnt;
+  fd_txn_p_t * txns = (fd_txn_p_t *)fd_chunk_to_laddr( ctx->poh_out_mem, ctx->poh_out_chunk );
+
+  /* Queue batches from the store tile, see replay_drain */
+
+  if( FD_LIKELY( in_idx==STORE_IN_IDX && txn_cnt<=fd_replay_sched_txn_max( ctx->sched ) ) ) {
+    long now = fd_log_wallclock();
+    int  last = !!( ctx->flags & REPLAY_FLAG_FINISHED_BLOCK );
+    fd_replay_sched_item_t * item = fd_replay_sched_push( ctx->sched, ctx->curr_slot, ctx->parent_slot, last, txn_cnt, now );
+    if( FD_UNLIKELY( !item ) ) {
+      /* Make room by executing everything that can be executed and
+         forgetting about slots that stopped receiving batches */
+      replay_drain( ctx, mux, 1 );
+      fd_replay_sched_expire( ctx->sched, now, SCHED_EXPIRE_NS );
+      item = fd_replay_sched_push( ctx->sched, ctx->curr_slot, ctx->parent_slot, last, txn_cnt, now );
+    }
+    if( FD_UNLIKELY( !item ) ) {
+      FD_LOG_WARNING(( "replay queue full, cannot process block right now - slot: %lu, parent_slot: %lu", ctx->curr_slot, ctx->parent_slot ));
+      *opt_filter = 1;
+      return;
     }
 
-    /* Indicate to pack tile we are done processing the transactions so it
-     can pack new microblocks using these accounts.  DO NOT USE THE
-     SANITIZED TRANSACTIONS AFTER THIS POINT, THEY ARE NO LONGER VALID. */
-    fd_fseq_update( ctx->bank_busy, seq );
-
-    if( FD_UNLIKELY( !(ctx->flags & REPLAY_FLAG_CATCHING_UP) && ctx->poh_init_done == 0 && ctx->slot_ctx->blockstore ) ) {
-      FD_LOG_INFO(( "sending init msg" ));
-      fd_poh_init_msg_t * msg = fd_chunk_to_laddr(ctx->poh_out_mem, ctx->poh_out_chunk);
-      fd_epoch_bank_t * epoch_bank = fd_exec_epoch_ctx_epoch_bank( ctx->epoch_ctx );
-      msg->hashcnt_per_tick = ctx->epoch_ctx->epoch_bank.hashes_per_tick;
-      msg->ticks_per_slot   = ctx->epoch_ctx->epoch_bank.ticks_per_slot;
-      msg->hashcnt_duration_ns = (double)(epoch_bank->ns_per_slot / epoch_bank->ticks_per_slot) / (double) msg->hashcnt_per_tick;
-      if( ctx->slot_ctx->slot_bank.block_hash_queue.last_hash ) {
-        memcpy(msg->last_entry_hash, ctx->slot_ctx->slot_bank.block_hash_queue.last_hash->uc, sizeof(fd_hash_t));
-      } else {
-        memset(msg->last_entry_hash, 0UL, sizeof(fd_hash_t));
-      }
-      msg->tick_height = ctx->slot_ctx->slot_bank.slot * msg->ticks_per_slot;
+    item->flags  = ctx->flags;
+    item->seq    = seq;
+    item->tsorig = *opt_tsorig;
+    fd_memcpy( item->blockhash, ctx->blockhash.uc, sizeof(fd_hash_t) );
+    fd_memcpy( item->txns, txns, txn_cnt*sizeof(fd_txn_p_t) );
 
-      ulong sig = fd_disco_replay_sig( ctx->slot_ctx->slot_bank.slot, REPLAY_FLAG_INIT );
-      fd_mcache_publish(ctx->poh_out_mcache, ctx->poh_out_depth, ctx->poh_out_seq, sig, ctx->poh_out_chunk, sizeof(fd_poh_init_msg_t), 0UL, *opt_tsorig, 0UL);
-      ctx->poh_out_chunk = fd_dcache_compact_next(ctx->poh_out_chunk, sizeof(fd_poh_init_msg_t), ctx->poh_out_chunk0, ctx->poh_out_wmark);
-      ctx->poh_out_seq = fd_seq_inc(ctx->poh_out_seq, 1UL);
-      ctx->poh_init_done = 1;
+    replay_drain( ctx, mux, 0 );
+    return;
+  }
+
+  /* Everything else (packed microblocks for our own leader slots and
+     batches too large to be queued) is executed right away on the whole
+     tpool, after anything queued that can be executed. */
+
+  FD_SCRATCH_SCOPE_BEGIN {
+    if( FD_UNLIKELY( fd_replay_sched_pending_cnt( ctx->sched ) ) ) {
+      /* Draining reuses the poh out chunk, so stash the txns and the
+         batch while doing so */
+      fd_txn_p_t * stash = fd_scratch_alloc( alignof(fd_txn_p_t), txn_cnt*sizeof(fd_txn_p_t) );
+      fd_memcpy( stash, txns, txn_cnt*sizeof(fd_txn_p_t) );
+      ulong     curr_slot   = ctx->curr_slot;
+      ulong     parent_slot = ctx->parent_slot;
+      ulong     flags       = ctx->flags;
+      fd_hash_t blockhash   = ctx->blockhash;
+
+      replay_drain( ctx, mux, 1 );
+
+      ctx->curr_slot   = curr_slot;
+      ctx->parent_slot = parent_slot;
+      ctx->flags       = flags;
+      ctx->blockhash   = blockhash;
+      ctx->txn_cnt     = txn_cnt;
+      txns = (fd_txn_p_t *)fd_chunk_to_laddr( ctx->poh_out_mem, ctx->poh_out_chunk );
+      fd_memcpy( txns, stash, txn_cnt*sizeof(fd_txn_p_t) );
     }
-    /* Publish mblk to POH. */
-
-    if( ctx->poh_init_done == 1 && !( ctx->flags & REPLAY_FLAG_FINISHED_BLOCK ) 
-        && ( ( ctx->flags & REPLAY_FLAG_MICROBLOCK ) || ( ctx->flags & REPLAY_FLAG_PACKED_MICROBLOCK ) ) ) {
-      FD_LOG_INFO(( "publishing mblk to poh - slot: %lu, parent_slot: %lu", ctx->curr_slot, ctx->parent_slot ));
-      ulong tspub = fd_frag_meta_ts_comp( fd_tickcount() );
-      ulong sig = fd_disco_replay_sig( ctx->curr_slot, ctx->flags );
-      fd_mcache_publish( ctx->poh_out_mcache, ctx->poh_out_depth, ctx->poh_out_seq, sig, ctx->poh_out_chunk, txn_cnt, 0UL, *opt_tsorig, tspub );
-      ctx->poh_out_chunk = fd_dcache_compact_next( ctx->poh_out_chunk, (txn_cnt * sizeof(fd_txn_p_t)) + sizeof(fd_microblock_trailer_t), ctx->poh_out_chunk0, ctx->poh_out_wmark );
-      ctx->poh_out_seq = fd_seq_inc( ctx->poh_out_seq, 1UL );
-    } else {
-      FD_LOG_INFO(( "NOT publishing mblk to poh - slot: %lu, parent_slot: %lu, flags: %lx", ctx->curr_slot, ctx->parent_slot, ctx->flags ));
+
+    if( FD_UNLIKELY( fd_replay_sched_is_open( ctx->sched, ctx->curr_slot ) ) ) {
+      FD_LOG_WARNING(( "earlier batches of the slot are still queued, cannot process block right now - slot: %lu, parent_slot: %lu", ctx->curr_slot, ctx->parent_slot ));
+      *opt_filter = 1;
+      return;
+    }
+
+    if( FD_UNLIKELY( replay_parent_executing( ctx, ctx->parent_slot ) ) ) {
+      FD_LOG_WARNING(( "parent fork is still executing, cannot process block right now - slot: %lu, parent_slot: %lu", ctx->curr_slot, ctx->parent_slot ));
+      *opt_filter = 1;
+      return;
     }
+
+    fd_fork_t * fork = replay_fork_begin( ctx, ctx->latest_votes, mux );
+
+    // Exeecute all txns which were succesfully prepared
+    int res = fd_runtime_execute_txns_in_waves_tpool( &fork->slot_ctx, ctx->capture_ctx,
+                                                      txns, txn_cnt,
+                                                      ctx->tpool, ctx->max_workers );
+    if( replay_fork_end( ctx, fork, res, seq, *opt_tsorig ) ) *opt_filter = 1;
   } FD_SCRATCH_SCOPE_END;
 }
 
 void
-tpool_boot( fd_topo_t * topo, ulong total_thread_count ) {
+tpool_boot( fd_topo_t * topo, ulong total_thread_count, void * const * stack ) {
   ushort tile_to_cpu[ FD_TILE_MAX ] = { 0 };
   ulong thread_count = 0;
   ulong main_thread_seen = 0;
@@ -645,7 +981,7 @@ tpool_boot( fd_topo_t * topo, ulong total_thread_count ) {
   if( thread_count != total_thread_count )
     FD_LOG_ERR(( "thread count mismatch thread_count=%lu total_thread_count=%lu main_thread_seen=%lu", thread_count, total_thread_count, main_thread_seen ));
 
-  fd_tile_private_map_boot( tile_to_cpu, thread_count );
+  fd_tile_private_map_boot( tile_to_cpu, stack, thread_count );
 }
 
 static void
@@ -790,7 +1126,44 @@ after_credit( void *             _ctx,
         publish_stake_weights( ctx, mux_ctx, ctx->slot_ctx );
       } FD_SCRATCH_SCOPE_END;
     }
+    return;
+  }
+
+  /* Run batches that have been waiting for siblings long enough */
+  replay_drain( ctx, mux_ctx, 0 );
+}
+
+/* tpool_scratch_scan continues the search for the high water mark of
+   a painted worker scratch region of sz bytes whose high water mark
+   was last found to be hwm.  The search goes down from the page at
+   offset *_off and looks at no more than TPOOL_SCRATCH_CHECK_PAGE_MAX
+   pages.  Returns the updated high water mark and sets *_off to the
+   offset to resume from, or to ULONG_MAX once the search is done.
+   Only the first word of each page is looked at, so it is accurate to
+   a page, which is enough to size the scratch with
+   [tiles.replay.tpool_worker_scratch_mb]. */
+
+static ulong
+tpool_scratch_scan( uchar const * scratch,
+                    ulong         sz,
+                    ulong         hwm,
+                    ulong *       _off ) {
+  ulong off = *_off;
+  ulong rem = TPOOL_SCRATCH_CHECK_PAGE_MAX;
+  while( off>=hwm ) {
+    if( FD_UNLIKELY( FD_VOLATILE_CONST( *(ulong const *)(scratch+off) )!=TPOOL_SCRATCH_PAINT ) ) {
+      *_off = ULONG_MAX;
+      return fd_ulong_min( off+FD_SHMEM_NORMAL_PAGE_SZ, sz );
+    }
+    if( FD_UNLIKELY( !off ) ) break;
+    off -= FD_SHMEM_NORMAL_PAGE_SZ;
+    if( FD_UNLIKELY( !--rem ) ) {
+      *_off = off;
+      return hwm;
+    }
   }
+  *_off = ULONG_MAX;
+  return hwm;
 }
 
 static void
@@ -798,17 +1171,47 @@ during_housekeeping( void * _ctx ) {
   fd_replay_tile_ctx_t * ctx = (fd_replay_tile_ctx_t *)_ctx;
   fd_mcache_seq_update( ctx->poh_out_sync, ctx->poh_out_seq );
   // fd_mcache_seq_update( ctx->store_out_sync, ctx->store_out_seq );
+
+  long now = fd_log_wallclock();
+  if( FD_UNLIKELY( ctx->max_workers>1UL && now>=ctx->tpool_scratch_check_next ) ) {
+    ctx->tpool_scratch_check_next = now + TPOOL_SCRATCH_CHECK_INTERVAL;
+    ulong i   = ctx->tpool_scratch_check_idx;
+    ulong sz  = ctx->tpool_scratch_sz[ i ];
+    ulong old = ctx->tpool_scratch_hwm[ i ];
+
+    if( ctx->tpool_scratch_check_off==ULONG_MAX ) ctx->tpool_scratch_check_off = fd_ulong_align_dn( sz-1UL, FD_SHMEM_NORMAL_PAGE_SZ );
+    ulong hwm = tpool_scratch_scan( ctx->tpool_scratch[ i ], sz, old, &ctx->tpool_scratch_check_off );
+    if( ctx->tpool_scratch_check_off==ULONG_MAX ) ctx->tpool_scratch_check_idx = fd_ulong_if( i+1UL<ctx->max_workers, i+1UL, 1UL );
+
+    if( FD_UNLIKELY( hwm>old ) ) {
+      ctx->tpool_scratch_hwm[ i ] = hwm;
+      if( FD_UNLIKELY( hwm>(sz/4UL)*3UL && old<=(sz/4UL)*3UL ) )
+        FD_LOG_WARNING(( "tpool worker %lu used %lu of %lu KiB of scratch, consider increasing [tiles.replay.tpool_worker_scratch_mb]", i, hwm>>10, sz>>10 ));
+      else
+        FD_LOG_INFO(( "tpool worker %lu used %lu of %lu KiB of scratch", i, hwm>>10, sz>>10 ));
+    }
+  }
 }
 
 static void
-privileged_init( fd_topo_t *      topo    FD_PARAM_UNUSED,
-                 fd_topo_tile_t * tile    FD_PARAM_UNUSED,
+privileged_init( fd_topo_t *      topo,
+                 fd_topo_tile_t * tile,
                  void *           scratch ) {
 
   FD_SCRATCH_ALLOC_INIT( l, scratch );
   fd_replay_tile_ctx_t * ctx = FD_SCRATCH_ALLOC_APPEND( l, alignof(fd_replay_tile_ctx_t), sizeof(fd_replay_tile_ctx_t) );
 
   FD_TEST( sizeof(ulong) == getrandom( &ctx->funk_seed, sizeof(ulong), 0 ) );
+
+  /* The tpool worker stacks are created here, while we can still
+     create files in the hugetlbfs mount.  They use the stack pages
+     reserved for each thread tile, on the NUMA node of its CPU, with
+     guard regions on both sides. */
+  for( ulong i=1UL; i<tile->replay.tpool_thread_count; i++ ) {
+    fd_topo_tile_t const * thread_tile = &topo->tiles[ fd_topo_find_tile( topo, "thread", i-1UL ) ];
+    ulong cpu_idx = fd_ulong_if( thread_tile->cpu_idx<65535UL, thread_tile->cpu_idx, 0UL );
+    ctx->tpool_stack[ i ] = fd_topo_tile_stack_new( 1, topo->app_name, thread_tile->name, thread_tile->kind_id, cpu_idx );
+  }
 }
 
 static void
@@ -832,6 +1235,11 @@ unprivileged_init( fd_topo_t *      topo,
   void * replay_mem          = FD_SCRATCH_ALLOC_APPEND( l, fd_replay_align(), fd_replay_footprint() );
   void * forks_mem           = FD_SCRATCH_ALLOC_APPEND( l, fd_forks_align(), fd_forks_footprint( FORKS_MAX ) );
   void * latest_votes_mem    = FD_SCRATCH_ALLOC_APPEND( l, fd_latest_vote_deque_align(), fd_latest_vote_deque_footprint() );
+  void * fork_latest_votes_mem[ FD_REPLAY_SCHED_ACTIVE_MAX ];
+  for( ulong i=0UL; i<FD_REPLAY_SCHED_ACTIVE_MAX; i++ ) {
+    fork_latest_votes_mem[ i ] = FD_SCRATCH_ALLOC_APPEND( l, fd_latest_vote_deque_align(), fd_latest_vote_deque_footprint() );
+  }
+  void * sched_mem           = FD_SCRATCH_ALLOC_APPEND( l, fd_replay_sched_align(), fd_replay_sched_footprint( SCHED_ITEM_MAX, SCHED_TXN_MAX ) );
   void * capture_ctx_mem     = FD_SCRATCH_ALLOC_APPEND( l, FD_CAPTURE_CTX_ALIGN, FD_CAPTURE_CTX_FOOTPRINT );
 
   void * bank_hash_cmp_mem = FD_SCRATCH_ALLOC_APPEND(
@@ -948,20 +1356,27 @@ unprivileged_init( fd_topo_t *      topo,
 
   ctx->max_workers = tile->replay.tpool_thread_count;
   if( FD_LIKELY( ctx->max_workers > 1 ) ) {
-    tpool_boot( topo, ctx->max_workers );
+    tpool_boot( topo, ctx->max_workers, ctx->tpool_stack );
   }
   ctx->tpool = fd_tpool_init( ctx->tpool_mem, ctx->max_workers );
 
   if( FD_LIKELY( ctx->max_workers > 1 ) ) {
-    /* start the tpool workers */
-    ulong tpool_worker_stack_sz = (1UL<<28UL); /* 256MB */
-    uchar * tpool_worker_mem   = fd_wksp_alloc_laddr( ctx->wksp, FD_SCRATCH_ALIGN_DEFAULT, tpool_worker_stack_sz*ctx->max_workers, 421UL ); /* 256MB per thread */
+    /* start the tpool workers, each with the scratch in the workspace
+       of its thread tile */
     for( ulong i =1; i<ctx->max_workers; i++ ) {
-      if( fd_tpool_worker_push( ctx->tpool, i, tpool_worker_mem + tpool_worker_stack_sz*(i - 1U), tpool_worker_stack_sz ) == NULL ) {
+      fd_topo_tile_t const * thread_tile = &topo->tiles[ fd_topo_find_tile( topo, "thread", i-1UL ) ];
+      ctx->tpool_scratch    [ i ] = fd_topo_obj_laddr( topo, thread_tile->tile_obj_id );
+      ctx->tpool_scratch_sz [ i ] = thread_tile->thread.scratch_sz;
+      ctx->tpool_scratch_hwm[ i ] = 0UL;
+      fd_memset( ctx->tpool_scratch[ i ], (int)(TPOOL_SCRATCH_PAINT & 0xffUL), ctx->tpool_scratch_sz[ i ] );
+      if( fd_tpool_worker_push( ctx->tpool, i, ctx->tpool_scratch[ i ], ctx->tpool_scratch_sz[ i ] ) == NULL ) {
         FD_LOG_ERR(( "failed to launch worker" ));
       }
     }
   }
+  ctx->tpool_scratch_check_idx  = 1UL;
+  ctx->tpool_scratch_check_off  = ULONG_MAX;
+  ctx->tpool_scratch_check_next = 0L;
 
   ctx->replay->tpool = ctx->tpool;
   ctx->replay->max_workers = ctx->max_workers;
@@ -990,6 +1405,16 @@ unprivileged_init( fd_topo_t *      topo,
 
   ctx->bank_hash_cmp = fd_bank_hash_cmp_join( fd_bank_hash_cmp_new( bank_hash_cmp_mem ) );
   ctx->latest_votes  = fd_latest_vote_deque_join( fd_latest_vote_deque_new( latest_votes_mem ) );
+  for( ulong i=0UL; i<FD_REPLAY_SCHED_ACTIVE_MAX; i++ ) {
+    ctx->fork_latest_votes[ i ] = fd_latest_vote_deque_join( fd_latest_vote_deque_new( fork_latest_votes_mem[ i ] ) );
+  }
+
+  /* Forks are only replayed concurrently if there are enough workers
+     for it.  solcap captures need txns to be executed in order. */
+  ctx->sched    = fd_replay_sched_join( fd_replay_sched_new( sched_mem, SCHED_ITEM_MAX, SCHED_TXN_MAX, FD_REPLAY_SCHED_ACTIVE_MAX ) );
+  ctx->lane_max = fd_ulong_min( fd_ulong_max( ctx->max_workers / SCHED_LANE_WORKER_MIN, 1UL ), FD_REPLAY_SCHED_LANE_MAX );
+  if( ctx->capture_ctx ) ctx->lane_max = 1UL;
+  FD_TEST( ctx->sched );
   ctx->bft           = fd_bft_join( fd_bft_new( bft_mem ) );
   ctx->ghost         = fd_ghost_join( fd_ghost_new( ghost_mem, 1 << FD_BFT_LG_SLOT_MAX, 1 << FD_BFT_LG_NODE_PUBKEY_MAX, 42 ) );
 
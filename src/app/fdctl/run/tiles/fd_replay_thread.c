@@ -1,3 +1,24 @@
 #include "../../../../disco/tiles.h"
 
-fd_topo_run_tile_t fd_tile_replay_thread = { .name = "thread", .for_tpool = 1 };
+/* A thread tile does not run on its own.  It is a worker of the replay
+   tile's tpool, and its tile object is the worker's scratch memory.
+   Each thread tile has a workspace of its own, so the scratch is
+   placed on the NUMA node of the CPU the worker runs on.  The replay
+   tile maps it and attaches it when it pushes the worker. */
+
+FD_FN_CONST static inline ulong
+scratch_align( void ) {
+  return fd_scratch_smem_align();
+}
+
+FD_FN_PURE static inline ulong
+scratch_footprint( fd_topo_tile_t const * tile ) {
+  return fd_scratch_smem_footprint( tile->thread.scratch_sz );
+}
+
+fd_topo_run_tile_t fd_tile_replay_thread = {
+  .name              = "thread",
+  .for_tpool         = 1,
+  .scratch_align     = scratch_align,
+  .scratch_footprint = scratch_footprint,
+};
@@ -39,8 +39,10 @@
 
    From bank: Every FEC set triggers at least two mcache entries (one
    for parity and one for data), so at most, we have ceil(mcache
-   depth/2) FEC sets exposed.  This means we need to decompose dcache
-   into at least ceil(mcache depth/2)+1 FEC sets.
+   depth/2) FEC sets exposed.  On top of those, one FEC set may be
+   shredded but held back waiting for its turn (see below) while the
+   next one is being written.  This means we need to decompose dcache
+   into at least ceil(mcache depth/2)+2 FEC sets.
 
    From the network: The FEC resolver doesn't use a cyclic order, but it
    does promise that once it returns an FEC set, it will return at least
@@ -52,8 +54,9 @@
    shred to all its destinations as soon as we get it, we don't need
    that functionality, so we set partial_depth=1.
 
-   Adding these up, we get 2*ceil(mcache_depth/2)+3+fec_resolver_depth
-   FEC sets, which is no more than mcache_depth+4+fec_resolver_depth.
+   Adding these up, we get 2*ceil(mcache_depth/2)+4+fec_resolver_depth
+   FEC sets, which is exactly mcache_depth+4+fec_resolver_depth since
+   the mcache depth is a power of two.
    Each FEC is paired with 4 fd_shred34_t structs, so that means we need
    to decompose the dcache into 4*mcache_depth + 4*fec_resolver_depth +
    16 fd_shred34_t structs. */
@@ -102,6 +105,22 @@ FD_STATIC_ASSERT( sizeof(fd_entry_batch_meta_t)==24UL, poh_shred_mtu );
 
 #define FD_SHRED_ADD_SHRED_EXTRA_RETVAL_CNT 2
 
+/* When we are leader and there are several shred tiles, entry batches
+   are shredded round-robin: batch i of a slot is shredded by tile
+   i%round_robin_cnt, and every other tile just skips over its shred
+   indices.  The tiles shred in parallel, but they publish the
+   resulting FEC sets in batch order, so that the store tile and the
+   first hop of Turbine see the shred indices of a slot arrive
+   contiguously.  The tiles coordinate through a shared fseq, which
+   holds the TURN_KEY of the next batch allowed to publish (or
+   ULONG_MAX if none has been published yet).  A tile whose FEC set
+   isn't up yet holds it (at most one at a time) until its turn comes,
+   or until TURN_TIMEOUT_NS passes, e.g. because the tile that had the
+   previous batch was overrun and will never publish it.  The first
+   batch of a slot never waits. */
+#define TURN_KEY( slot, batch ) (((slot)<<16) | fd_ulong_min( (batch), 0xFFFFUL ))
+#define TURN_TIMEOUT_NS         (2L*1000L*1000L)
+
 typedef struct {
   fd_shredder_t      * shredder;
   fd_fec_resolver_t  * resolver;
@@ -143,8 +162,22 @@ typedef struct {
   ulong shredder_max_fec_set_idx; /* exclusive */
 
   ulong send_fec_set_idx;
+  ulong send_key; /* TURN_KEY of the batch in send_fec_set_idx */
   ulong tsorig;  /* timestamp of the last packet in compressed form */
 
+  ulong * shred_turn;   /* shared by all the shred tiles, see TURN_KEY */
+  long    turn_timeout; /* in ticks */
+
+  /* The FEC set we shredded that is waiting for its turn to be
+     published, if fec_set_idx!=ULONG_MAX */
+  struct {
+    ulong fec_set_idx;
+    ulong key;
+    ulong txn_cnt;
+    ulong tsorig;
+    long  deadline;
+  } held_set;
+
   /* Includes Ethernet, IP, UDP headers */
   ulong shred_buffer_sz;
   uchar shred_buffer[ FD_NET_MTU ];
@@ -248,6 +281,17 @@ metrics_write( void * _ctx ) {
   FD_MCNT_ENUM_COPY( SHRED, SHRED_PROCESSED, ctx->metrics->shred_processing_result      );
 }
 
+/* The leader schedule and shred destinations for a new epoch are
+   generated a little at a time here rather than all at once when the
+   stake message arrives, which would stall the tile for tens of
+   milliseconds.  See fd_stake_ci_precompute. */
+static void
+during_housekeeping( void * _ctx ) {
+  fd_shred_ctx_t * ctx = (fd_shred_ctx_t *)_ctx;
+
+  fd_stake_ci_precompute( ctx->stake_ci );
+}
+
 static inline void
 handle_new_cluster_contact_info( fd_shred_ctx_t * ctx,
                                  uchar const    * buf ) {
@@ -413,6 +457,7 @@ during_frag( void * _ctx,
         ctx->shredded_txn_cnt = ctx->pending_batch.txn_cnt;
 
         ctx->send_fec_set_idx = ctx->shredder_fec_set_idx;
+        ctx->send_key         = TURN_KEY( target_slot, ctx->batch_cnt );
 
         /* Update metrics */
         fd_histf_sample( ctx->metrics->batch_sz,             batch_sz                          );
@@ -500,6 +545,123 @@ send_shred( fd_shred_ctx_t *      ctx,
   ctx->net_out_chunk = fd_dcache_compact_next( ctx->net_out_chunk, pkt_sz, ctx->net_out_chunk0, ctx->net_out_wmark );
 }
 
+/* publish_fec_set sends a full FEC set, either one that was completed
+   by a shred from the network or one we shredded ourself from a
+   microblock batch, to the blockstore and on the network (skipping any
+   shreds we already sent).  Publishes at most 4 frags to the store. */
+static void
+publish_fec_set( fd_shred_ctx_t *   ctx,
+                 ulong              in_idx,
+                 ulong              fec_set_idx,
+                 ulong              txn_cnt,
+                 ulong              tsorig,
+                 fd_mux_context_t * mux ) {
+  const ulong fanout = 200UL;
+  fd_shred_dest_idx_t _dests[ 200*(FD_REEDSOL_DATA_SHREDS_MAX+FD_REEDSOL_PARITY_SHREDS_MAX) ];
+
+  fd_fec_set_t * set = ctx->fec_sets + fec_set_idx;
+  fd_shred34_t * s34 = ctx->shred34 + 4UL*fec_set_idx;
+
+  s34[ 0 ].shred_cnt =                         fd_ulong_min( set->data_shred_cnt,   34UL );
+  s34[ 1 ].shred_cnt = set->data_shred_cnt   - fd_ulong_min( set->data_shred_cnt,   34UL );
+  s34[ 2 ].shred_cnt =                         fd_ulong_min( set->parity_shred_cnt, 34UL );
+  s34[ 3 ].shred_cnt = set->parity_shred_cnt - fd_ulong_min( set->parity_shred_cnt, 34UL );
+
+  ulong s34_cnt     = 2UL + !!(s34[ 1 ].shred_cnt) + !!(s34[ 3 ].shred_cnt);
+  ulong txn_per_s34 = txn_cnt / s34_cnt;
+
+  /* Attribute the transactions evenly to the non-empty shred34s */
+  for( ulong j=0UL; j<4UL; j++ ) s34[ j ].est_txn_cnt = fd_ulong_if( s34[ j ].shred_cnt>0UL, txn_per_s34, 0UL );
+
+  /* Add whatever is left to the last shred34 */
+  s34[ fd_ulong_if( s34[ 3 ].shred_cnt>0UL, 3, 2 ) ].est_txn_cnt += txn_cnt - txn_per_s34*s34_cnt;
+
+  /* Send to the blockstore, skipping any empty shred34_t s. */
+  ulong sig = in_idx!=NET_IN_IDX; /* sig==0 means the store tile will do extra checks */
+  ulong tspub = fd_frag_meta_ts_comp( fd_tickcount() );
+  fd_mux_publish( mux, sig, fd_laddr_to_chunk( ctx->store_out_mem, s34+0UL ), sizeof(fd_shred34_t), 0UL, tsorig, tspub );
+  if( FD_UNLIKELY( s34[ 1 ].shred_cnt ) )
+    fd_mux_publish( mux, sig, fd_laddr_to_chunk( ctx->store_out_mem, s34+1UL ), sizeof(fd_shred34_t), 0UL, tsorig, tspub );
+  fd_mux_publish( mux, sig, fd_laddr_to_chunk( ctx->store_out_mem, s34+2UL), sizeof(fd_shred34_t), 0UL, tsorig, tspub );
+  if( FD_UNLIKELY( s34[ 3 ].shred_cnt ) )
+    fd_mux_publish( mux, sig, fd_laddr_to_chunk( ctx->store_out_mem, s34+3UL ), sizeof(fd_shred34_t), 0UL, tsorig, tspub );
+
+  /* Compute all the destinations for all the new shreds */
+
+  fd_shred_t const * new_shreds[ FD_REEDSOL_DATA_SHREDS_MAX+FD_REEDSOL_PARITY_SHREDS_MAX ];
+  ulong k=0UL;
+  for( ulong i=0UL; i<set->data_shred_cnt; i++ )
+    if( !d_rcvd_test( set->data_shred_rcvd,   i ) )  new_shreds[ k++ ] = (fd_shred_t const *)set->data_shreds  [ i ];
+  for( ulong i=0UL; i<set->parity_shred_cnt; i++ )
+    if( !p_rcvd_test( set->parity_shred_rcvd, i ) )  new_shreds[ k++ ] = (fd_shred_t const *)set->parity_shreds[ i ];
+
+  if( FD_UNLIKELY( !k ) ) return;
+  fd_shred_dest_t * sdest = fd_stake_ci_get_sdest_for_slot( ctx->stake_ci, new_shreds[ 0 ]->slot );
+  if( FD_UNLIKELY( !sdest ) ) return;
+
+  ulong out_stride;
+  ulong max_dest_cnt[1];
+  fd_shred_dest_idx_t * dests;
+  if( FD_LIKELY( in_idx==NET_IN_IDX ) ) {
+    out_stride = k;
+    dests = fd_shred_dest_compute_children( sdest, new_shreds, k, _dests, k, fanout, fanout, max_dest_cnt );
+  } else {
+    out_stride = 1UL;
+    *max_dest_cnt = 1UL;
+    dests = fd_shred_dest_compute_first   ( sdest, new_shreds, k, _dests );
+  }
+  FD_TEST( dests );
+
+  /* Send only the ones we didn't receive. */
+  for( ulong i=0UL; i<k; i++ ) for( ulong j=0UL; j<*max_dest_cnt; j++ ) send_shred( ctx, new_shreds[ i ], sdest, dests[ j*out_stride+i ], tsorig );
+}
+
+static inline int
+turn_ready( fd_shred_ctx_t const * ctx,
+            ulong                  key ) {
+  ulong turn = FD_VOLATILE_CONST( *ctx->shred_turn );
+  return (ctx->round_robin_cnt==1UL) | (turn==ULONG_MAX) | (turn>=key) | !(key&0xFFFFUL);
+}
+
+static inline void
+turn_advance( fd_shred_ctx_t * ctx,
+              ulong            key ) {
+  if( FD_LIKELY( ctx->round_robin_cnt==1UL ) ) return;
+  ulong turn = FD_VOLATILE_CONST( *ctx->shred_turn );
+  while( (turn==ULONG_MAX) | (turn<=key) ) {
+    ulong prev = FD_ATOMIC_CAS( ctx->shred_turn, turn, key+1UL );
+    if( FD_LIKELY( prev==turn ) ) break;
+    turn = prev;
+  }
+}
+
+static inline void
+publish_held_set( fd_shred_ctx_t *   ctx,
+                  fd_mux_context_t * mux ) {
+  publish_fec_set( ctx, POH_IN_IDX, ctx->held_set.fec_set_idx, ctx->held_set.txn_cnt, ctx->held_set.tsorig, mux );
+  turn_advance( ctx, ctx->held_set.key );
+  ctx->held_set.fec_set_idx = ULONG_MAX;
+}
+
+static inline void
+hold_set( fd_shred_ctx_t * ctx ) {
+  ctx->held_set.fec_set_idx = ctx->send_fec_set_idx;
+  ctx->held_set.key         = ctx->send_key;
+  ctx->held_set.txn_cnt     = ctx->shredded_txn_cnt;
+  ctx->held_set.tsorig      = ctx->tsorig;
+  ctx->held_set.deadline    = fd_tickcount() + ctx->turn_timeout;
+}
+
+static void
+after_credit( void *             _ctx,
+              fd_mux_context_t * mux ) {
+  fd_shred_ctx_t * ctx = (fd_shred_ctx_t *)_ctx;
+
+  if( FD_LIKELY( ctx->held_set.fec_set_idx==ULONG_MAX ) ) return;
+  if( FD_LIKELY( turn_ready( ctx, ctx->held_set.key ) ) || FD_UNLIKELY( fd_tickcount()>=ctx->held_set.deadline ) )
+    publish_held_set( ctx, mux );
+}
+
 static void
 after_frag( void *             _ctx,
             ulong              in_idx,
@@ -525,7 +687,7 @@ after_frag( void *             _ctx,
   }
 
   if( FD_UNLIKELY( in_idx==STAKE_IN_IDX ) ) {
-    fd_stake_ci_stake_msg_fini( ctx->stake_ci );
+    fd_stake_ci_stake_msg_fini_async( ctx->stake_ci );
     return;
   }
 
@@ -534,10 +696,9 @@ after_frag( void *             _ctx,
     return;
   }
 
-  const ulong fanout = 200UL;
-  fd_shred_dest_idx_t _dests[ 200*(FD_REEDSOL_DATA_SHREDS_MAX+FD_REEDSOL_PARITY_SHREDS_MAX) ];
-
   if( FD_LIKELY( in_idx==NET_IN_IDX ) ) {
+    fd_shred_dest_idx_t _dests[ 200UL ];
+
     uchar * shred_buffer    = ctx->shred_buffer;
     ulong   shred_buffer_sz = ctx->shred_buffer_sz;
 
@@ -574,72 +735,26 @@ after_frag( void *             _ctx,
     if( FD_LIKELY( rv!=FD_FEC_RESOLVER_SHRED_COMPLETES ) ) return;
 
     FD_TEST( ctx->fec_sets <= *out_fec_set );
-    ctx->send_fec_set_idx = (ulong)(*out_fec_set - ctx->fec_sets);
-    ctx->shredded_txn_cnt = 0UL;
-  } else {
-    /* We know we didn't get overrun, so advance the index */
-    ctx->shredder_fec_set_idx = (ctx->shredder_fec_set_idx+1UL)%ctx->shredder_max_fec_set_idx;
+    publish_fec_set( ctx, in_idx, (ulong)(*out_fec_set - ctx->fec_sets), 0UL, ctx->tsorig, mux );
+    return;
   }
-  /* If this was the shred that completed an FEC set or this was a
-     microblock we shredded ourself, we now have a full FEC set that we
-     need to send to the blockstore and on the network (skipping any
-     shreds we already sent). */
-
-  fd_fec_set_t * set = ctx->fec_sets + ctx->send_fec_set_idx;
-  fd_shred34_t * s34 = ctx->shred34 + 4UL*ctx->send_fec_set_idx;
-
-  s34[ 0 ].shred_cnt =                         fd_ulong_min( set->data_shred_cnt,   34UL );
-  s34[ 1 ].shred_cnt = set->data_shred_cnt   - fd_ulong_min( set->data_shred_cnt,   34UL );
-  s34[ 2 ].shred_cnt =                         fd_ulong_min( set->parity_shred_cnt, 34UL );
-  s34[ 3 ].shred_cnt = set->parity_shred_cnt - fd_ulong_min( set->parity_shred_cnt, 34UL );
-
-  ulong s34_cnt     = 2UL + !!(s34[ 1 ].shred_cnt) + !!(s34[ 3 ].shred_cnt);
-  ulong txn_per_s34 = ctx->shredded_txn_cnt / s34_cnt;
-
-  /* Attribute the transactions evenly to the non-empty shred34s */
-  for( ulong j=0UL; j<4UL; j++ ) s34[ j ].est_txn_cnt = fd_ulong_if( s34[ j ].shred_cnt>0UL, txn_per_s34, 0UL );
-
-  /* Add whatever is left to the last shred34 */
-  s34[ fd_ulong_if( s34[ 3 ].shred_cnt>0UL, 3, 2 ) ].est_txn_cnt += ctx->shredded_txn_cnt - txn_per_s34*s34_cnt;
 
-  /* Send to the blockstore, skipping any empty shred34_t s. */
-  ulong sig = in_idx!=NET_IN_IDX; /* sig==0 means the store tile will do extra checks */
-  ulong tspub = fd_frag_meta_ts_comp( fd_tickcount() );
-  fd_mux_publish( mux, sig, fd_laddr_to_chunk( ctx->store_out_mem, s34+0UL ), sizeof(fd_shred34_t), 0UL, ctx->tsorig, tspub );
-  if( FD_UNLIKELY( s34[ 1 ].shred_cnt ) )
-    fd_mux_publish( mux, sig, fd_laddr_to_chunk( ctx->store_out_mem, s34+1UL ), sizeof(fd_shred34_t), 0UL, ctx->tsorig, tspub );
-  fd_mux_publish( mux, sig, fd_laddr_to_chunk( ctx->store_out_mem, s34+2UL), sizeof(fd_shred34_t), 0UL, ctx->tsorig, tspub );
-  if( FD_UNLIKELY( s34[ 3 ].shred_cnt ) )
-    fd_mux_publish( mux, sig, fd_laddr_to_chunk( ctx->store_out_mem, s34+3UL ), sizeof(fd_shred34_t), 0UL, ctx->tsorig, tspub );
-
-  /* Compute all the destinations for all the new shreds */
-
-  fd_shred_t const * new_shreds[ FD_REEDSOL_DATA_SHREDS_MAX+FD_REEDSOL_PARITY_SHREDS_MAX ];
-  ulong k=0UL;
-  for( ulong i=0UL; i<set->data_shred_cnt; i++ )
-    if( !d_rcvd_test( set->data_shred_rcvd,   i ) )  new_shreds[ k++ ] = (fd_shred_t const *)set->data_shreds  [ i ];
-  for( ulong i=0UL; i<set->parity_shred_cnt; i++ )
-    if( !p_rcvd_test( set->parity_shred_rcvd, i ) )  new_shreds[ k++ ] = (fd_shred_t const *)set->parity_shreds[ i ];
-
-  if( FD_UNLIKELY( !k ) ) return;
-  fd_shred_dest_t * sdest = fd_stake_ci_get_sdest_for_slot( ctx->stake_ci, new_shreds[ 0 ]->slot );
-  if( FD_UNLIKELY( !sdest ) ) return;
-
-  ulong out_stride;
-  ulong max_dest_cnt[1];
-  fd_shred_dest_idx_t * dests;
-  if( FD_LIKELY( in_idx==NET_IN_IDX ) ) {
-    out_stride = k;
-    dests = fd_shred_dest_compute_children( sdest, new_shreds, k, _dests, k, fanout, fanout, max_dest_cnt );
+  /* We know we didn't get overrun, so advance the index */
+  ctx->shredder_fec_set_idx = (ctx->shredder_fec_set_idx+1UL)%ctx->shredder_max_fec_set_idx;
+
+  if( FD_UNLIKELY( ctx->held_set.fec_set_idx!=ULONG_MAX ) ) {
+    /* We already shredded our next batch and the previous one still
+       hasn't had its turn, so stop waiting for it.  Only one FEC set
+       is published per callback to stay within burst, so the new one
+       is held until after_credit. */
+    publish_held_set( ctx, mux );
+    hold_set( ctx );
+  } else if( FD_LIKELY( turn_ready( ctx, ctx->send_key ) ) ) {
+    publish_fec_set( ctx, in_idx, ctx->send_fec_set_idx, ctx->shredded_txn_cnt, ctx->tsorig, mux );
+    turn_advance( ctx, ctx->send_key );
   } else {
-    out_stride = 1UL;
-    *max_dest_cnt = 1UL;
-    dests = fd_shred_dest_compute_first   ( sdest, new_shreds, k, _dests );
+    hold_set( ctx );
   }
-  FD_TEST( dests );
-
-  /* Send only the ones we didn't receive. */
-  for( ulong i=0UL; i<k; i++ ) for( ulong j=0UL; j<*max_dest_cnt; j++ ) send_shred( ctx, new_shreds[ i ], sdest, dests[ j*out_stride+i ], ctx->tsorig );
 }
 
 static void
@@ -778,7 +893,7 @@ unprivileged_init( fd_topo_t *      topo,
                                                             sign_in->mcache,
                                                             sign_in->dcache ) ) );
 
-  fd_fec_set_t * resolver_sets = fec_sets + (shred_store_mcache_depth+1UL)/2UL + 1UL;
+  fd_fec_set_t * resolver_sets = fec_sets + (shred_store_mcache_depth+1UL)/2UL + 2UL;
   ctx->shredder = NONNULL( fd_shredder_join     ( fd_shredder_new     ( _shredder, fd_shred_signer, ctx->keyguard_client, (ushort)expected_shred_version ) ) );
   ctx->resolver = NONNULL( fd_fec_resolver_join ( fd_fec_resolver_new ( _resolver, tile->shred.fec_resolver_depth, 1UL,
                                                                          (shred_store_mcache_depth+3UL)/2UL,
@@ -836,9 +951,16 @@ unprivileged_init( fd_topo_t *      topo,
   ctx->store_out_chunk  = ctx->store_out_chunk0;
 
   ctx->shredder_fec_set_idx = 0UL;
-  ctx->shredder_max_fec_set_idx = (shred_store_mcache_depth+1UL)/2UL + 1UL;
+  ctx->shredder_max_fec_set_idx = (shred_store_mcache_depth+1UL)/2UL + 2UL;
 
   ctx->send_fec_set_idx    = ULONG_MAX;
+  ctx->send_key            = 0UL;
+
+  ulong turn_obj_id = fd_pod_query_ulong( topo->props, "shred_turn", ULONG_MAX );
+  FD_TEST( turn_obj_id!=ULONG_MAX );
+  ctx->shred_turn   = fd_fseq_join( fd_topo_obj_laddr( topo, turn_obj_id ) );
+  ctx->turn_timeout = (long)(fd_tempo_tick_per_ns( NULL )*(double)TURN_TIMEOUT_NS);
+  ctx->held_set.fec_set_idx = ULONG_MAX;
 
   ctx->shred_buffer_sz  = 0UL;
   fd_memset( ctx->shred_buffer, 0xFF, FD_NET_MTU );
@@ -903,8 +1025,10 @@ lazy( fd_topo_tile_t * tile ) {
 fd_topo_run_tile_t fd_tile_shred = {
   .name                     = "shred",
   .mux_flags                = FD_MUX_FLAG_MANUAL_PUBLISH | FD_MUX_FLAG_COPY,
-  .burst                    = 4UL,
+  .burst                    = 8UL, /* One FEC set in after_credit and one in after_frag */
   .mux_ctx                  = mux_ctx,
+  .mux_during_housekeeping  = during_housekeeping,
+  .mux_after_credit         = after_credit,
   .mux_before_frag          = before_frag,
   .mux_during_frag          = during_frag,
   .mux_after_frag           = after_frag,
@@ -11,6 +11,9 @@
 
 #define MAX_IN (32UL)
 
+FD_STATIC_ASSERT( FD_KEYGUARD_SIGN_BATCH_MAX<=FD_ED25519_SIGN_BATCH_MAX,     sign_batch );
+FD_STATIC_ASSERT( FD_KEYGUARD_SIGN_BATCH_MAX*32UL<=FD_KEYGUARD_SIGN_REQ_MTU, sign_batch );
+
 /* fd_sign_in_ctx_t is a context object for each in (producer) mcache
    connected to the sign tile. */
 
@@ -22,6 +25,7 @@ typedef struct {
 
 typedef struct {
   uchar             _data[ FD_KEYGUARD_SIGN_REQ_MTU ];
+  ulong             _cnt; /* number of payloads in _data */
 
   ulong             in_role [ MAX_IN ];
   uchar *           in_data[ MAX_IN ];
@@ -65,17 +69,28 @@ during_frag( void * _ctx,
              ulong  sz,
              int *  opt_filter ) {
   (void)seq;
-  (void)sig;
   (void)chunk;
-  (void)sz;
-  (void)opt_filter;
 
   fd_sign_ctx_t * ctx = (fd_sign_ctx_t *)_ctx;
   FD_TEST( in_idx<MAX_IN );
 
+  /* sig is the number of payloads in the request.  Only the leader
+     role signs more than one at a time. */
+  ctx->_cnt = sig;
+  if( FD_UNLIKELY( ctx->in_role[ in_idx ]!=FD_KEYGUARD_ROLE_LEADER && sig!=1UL ) ) {
+    FD_LOG_WARNING(("Corrupt signing message with %lu payloads", sig));
+    *opt_filter = 1;
+    return;
+  }
+
   switch( ctx->in_role[ in_idx ] ) {
     case FD_KEYGUARD_ROLE_LEADER:
-      fd_memcpy( ctx->_data, ctx->in_data[ in_idx ], 32UL );
+      if( sig==0UL || sig>FD_KEYGUARD_SIGN_BATCH_MAX || sz!=32UL*sig ) {
+        FD_LOG_WARNING(("Corrupt leader signing message with %lu payloads and size %lu", sig, sz));
+        *opt_filter = 1;
+        return;
+      }
+      fd_memcpy( ctx->_data, ctx->in_data[ in_idx ], sz );
       break;
     case FD_KEYGUARD_ROLE_TLS:
       fd_memcpy( ctx->_data, ctx->in_data[ in_idx ], 130UL );
@@ -114,7 +129,6 @@ after_frag( void *             _ctx,
   (void)seq;
   (void)opt_sig;
   (void)opt_chunk;
-  (void)opt_sz;
   (void)opt_tsorig;
   (void)opt_filter;
   (void)mux;
@@ -125,10 +139,16 @@ after_frag( void *             _ctx,
 
   switch( ctx->in_role[ in_idx ] ) {
     case FD_KEYGUARD_ROLE_LEADER: {
-      if( FD_UNLIKELY( !fd_keyguard_payload_authorize( ctx->_data, 32UL, FD_KEYGUARD_ROLE_LEADER ) ) ) {
-        FD_LOG_EMERG(( "fd_keyguard_payload_authorize failed" ));
+      uchar const * msgs   [ FD_KEYGUARD_SIGN_BATCH_MAX ];
+      ulong         msg_szs[ FD_KEYGUARD_SIGN_BATCH_MAX ];
+      for( ulong i=0UL; i<ctx->_cnt; i++ ) {
+        msgs   [ i ] = ctx->_data + 32UL*i;
+        msg_szs[ i ] = 32UL;
+        if( FD_UNLIKELY( !fd_keyguard_payload_authorize( msgs[ i ], 32UL, FD_KEYGUARD_ROLE_LEADER ) ) ) {
+          FD_LOG_EMERG(( "fd_keyguard_payload_authorize failed" ));
+        }
       }
-      fd_ed25519_sign( ctx->out[ in_idx ].data, ctx->_data, 32UL, ctx->public_key, ctx->private_key, ctx->sha512 );
+      fd_ed25519_sign_batch( ctx->out[ in_idx ].data, msgs, msg_szs, ctx->_cnt, ctx->public_key, ctx->private_key, ctx->sha512 );
       break;
     }
     case FD_KEYGUARD_ROLE_TLS: {
@@ -165,7 +185,7 @@ after_frag( void *             _ctx,
       FD_LOG_CRIT(( "unexpected link role %lu", ctx->in_role[ in_idx ] ));
   }
 
-  fd_mcache_publish( ctx->out[ in_idx ].mcache, 128UL, ctx->out[ in_idx ].seq, 0UL, 0UL, 0UL, 0UL, 0UL, 0UL );
+  fd_mcache_publish( ctx->out[ in_idx ].mcache, 128UL, ctx->out[ in_idx ].seq, 0UL, 0UL, 64UL*ctx->_cnt, 0UL, 0UL, 0UL );
   ctx->out[ in_idx ].seq = fd_seq_inc( ctx->out[ in_idx ].seq, 1UL );
 }
 
@@ -239,8 +259,8 @@ unprivileged_init( fd_topo_t *      topo,
     if( !strcmp( in_link->name, "shred_sign" ) ) {
       ctx->in_role[ i ] = FD_KEYGUARD_ROLE_LEADER;
       FD_TEST( !strcmp( out_link->name, "sign_shred" ) );
-      FD_TEST( in_link->mtu==32UL );
-      FD_TEST( out_link->mtu==64UL );
+      FD_TEST( in_link->mtu==32UL*FD_KEYGUARD_SIGN_BATCH_MAX );
+      FD_TEST( out_link->mtu==64UL*FD_KEYGUARD_SIGN_BATCH_MAX );
     } else if( !strcmp( in_link->name, "quic_sign" ) ) {
       ctx->in_role[ i ] = FD_KEYGUARD_ROLE_TLS;
       FD_TEST( !strcmp( out_link->name, "sign_quic" ) );
@@ -104,6 +104,8 @@ struct fd_store_tile_ctx {
   fd_stake_ci_t * stake_ci;
 
   ulong blockstore_seed;
+
+  int stream_entry_batches;
 };
 typedef struct fd_store_tile_ctx fd_store_tile_ctx_t;
 
@@ -174,6 +176,63 @@ during_frag( void * _ctx,
   }
 }
 
+/* fd_store_tile_slot_stream publishes to replay the entry batches of
+   slot that are contiguous from the start of the slot and that were not
+   published yet (see fd_store_slot_stream), so replay can execute them
+   while the rest of the block is still being received.  Returns the
+   number of batches published.  Slots we are the leader of are not
+   streamed. */
+
+static ulong
+fd_store_tile_slot_stream( fd_store_tile_ctx_t * ctx,
+                           ulong                 slot ) {
+  fd_epoch_leaders_t const * lsched = fd_stake_ci_get_lsched_for_slot( ctx->stake_ci, slot );
+  if( FD_UNLIKELY( !lsched ) ) return 0UL;
+  fd_pubkey_t const * slot_leader = fd_epoch_leaders_get( lsched, slot );
+  if( FD_UNLIKELY( !slot_leader || !memcmp( ctx->identity_key, slot_leader, sizeof(fd_pubkey_t) ) ) ) return 0UL;
+
+  ulong pub_cnt = 0UL;
+  FD_SCRATCH_SCOPE_BEGIN {
+    uchar * buf = fd_scratch_alloc( 128UL, FD_BLOCKSTORE_BLOCK_SZ_MAX );
+    for(;;) {
+      ulong tsorig = fd_frag_meta_ts_comp( fd_tickcount() );
+      int   rc;
+      FD_SCRATCH_SCOPE_BEGIN {
+        fd_store_batch_t batch[1];
+        rc = fd_store_slot_stream( ctx->store, slot, buf, FD_BLOCKSTORE_BLOCK_SZ_MAX, fd_scratch_virtual(), batch );
+
+        /* Batches that only contain ticks have nothing to execute, the
+           last batch is always published so replay finishes the block */
+
+        if( rc==FD_STORE_STREAM_BATCH && ( batch->info.txn_cnt || batch->last ) ) {
+          ulong txn_cnt = batch->info.txn_cnt;
+          uchar * out_buf = fd_chunk_to_laddr( ctx->replay_out_mem, ctx->replay_out_chunk );
+          FD_STORE( ulong, out_buf, batch->parent_slot );
+          out_buf += sizeof(ulong);
+          memcpy( out_buf, batch->poh.uc, sizeof(fd_hash_t) );
+          out_buf += sizeof(fd_hash_t);
+          fd_runtime_microblock_batch_collect_txns( &batch->info, fd_type_pun( out_buf ) );
+
+          ulong caught_up_flag = (ctx->store->curr_turbine_slot - slot)==0 ? 0UL : REPLAY_FLAG_CATCHING_UP;
+          ulong flags          = REPLAY_FLAG_MICROBLOCK | caught_up_flag | fd_ulong_if( batch->last, REPLAY_FLAG_FINISHED_BLOCK, 0UL );
+          ulong replay_sig     = fd_disco_replay_sig( slot, flags );
+          FD_LOG_DEBUG(( "streaming entry batch - slot: %lu, batch: %lu, txns: %lu, last: %d", slot, batch->batch_idx, txn_cnt, batch->last ));
+
+          ulong out_sz = sizeof(ulong) + sizeof(fd_hash_t) + ( txn_cnt * sizeof(fd_txn_p_t) );
+          ulong tspub  = fd_frag_meta_ts_comp( fd_tickcount() );
+          fd_mcache_publish( ctx->replay_out_mcache, ctx->replay_out_depth, ctx->replay_out_seq, replay_sig, ctx->replay_out_chunk, txn_cnt, 0UL, tsorig, tspub );
+          ctx->replay_out_seq   = fd_seq_inc( ctx->replay_out_seq, 1UL );
+          ctx->replay_out_chunk = fd_dcache_compact_next( ctx->replay_out_chunk, out_sz, ctx->replay_out_chunk0, ctx->replay_out_wmark );
+          pub_cnt++;
+        }
+      } FD_SCRATCH_SCOPE_END;
+      if( rc!=FD_STORE_STREAM_BATCH ) break;
+    }
+  } FD_SCRATCH_SCOPE_END;
+
+  return pub_cnt;
+}
+
 static void
 after_frag( void *             _ctx,
             ulong              in_idx,
@@ -203,12 +262,27 @@ after_frag( void *             _ctx,
 
       fd_store_shred_update_with_shred_from_turbine( ctx->store, &ctx->s34_buffer->pkts[i].shred );
     }
+
+    if( ctx->stream_entry_batches ) {
+      ulong slot = FD_SLOT_NULL;
+      for( ulong i = 0; i < ctx->s34_buffer->shred_cnt; i++ ) {
+        fd_shred_t const * shred = &ctx->s34_buffer->pkts[i].shred;
+        if( !( fd_shred_type( shred->variant ) & FD_SHRED_TYPEMASK_DATA ) || shred->slot == slot ) continue;
+        slot = shred->slot;
+        fd_store_tile_slot_stream( ctx, slot );
+      }
+    }
   }
 
   if( FD_UNLIKELY( in_idx==REPAIR_IN_IDX ) ) {
-    if( fd_store_shred_insert( ctx->store, fd_type_pun_const( ctx->shred_buffer ) ) < FD_BLOCKSTORE_OK ) {
+    fd_shred_t const * shred = fd_type_pun_const( ctx->shred_buffer );
+    if( fd_store_shred_insert( ctx->store, shred ) < FD_BLOCKSTORE_OK ) {
       FD_LOG_ERR(( "failed inserting to blockstore" ));
     }
+
+    if( ctx->stream_entry_batches && ( fd_shred_type( shred->variant ) & FD_SHRED_TYPEMASK_DATA ) ) {
+      fd_store_tile_slot_stream( ctx, shred->slot );
+    }
   }
 }
 
@@ -296,6 +370,14 @@ fd_store_tile_slot_prepare( fd_store_tile_ctx_t * ctx,
     }
   }
 
+  /* Blocks that were streamed are done here, just make sure the batches
+     that completed the block were published */
+  if( store_slot_prepare_mode == FD_STORE_SLOT_PREPARE_CONTINUE &&
+      fd_store_slot_stream_query( ctx->store, slot ) ) {
+    fd_store_tile_slot_stream( ctx, slot );
+    store_slot_prepare_mode = FD_STORE_SLOT_PREPARE_ALREADY_EXECUTED;
+  }
+
   if( store_slot_prepare_mode == FD_STORE_SLOT_PREPARE_CONTINUE ) {
 
     FD_LOG_NOTICE( ( "\n\n[Store]\n"
@@ -432,6 +514,8 @@ unprivileged_init( fd_topo_t *      topo,
   // TODO: set the lo_mark_slot to the actual snapshot slot!
   ctx->store = fd_store_join( fd_store_new( FD_SCRATCH_ALLOC_APPEND( l, fd_store_align(), fd_store_footprint() ), 1 ) );
   ctx->repair_req_buffer = FD_SCRATCH_ALLOC_APPEND( l, alignof(fd_repair_request_t), MAX_REPAIR_REQS * sizeof(fd_repair_request_t) );
+  ctx->stream_entry_batches = tile->store_int.stream_entry_batches;
+
   ctx->stake_ci = fd_stake_ci_join( fd_stake_ci_new( FD_SCRATCH_ALLOC_APPEND( l, fd_stake_ci_align(), fd_stake_ci_footprint() ), ctx->identity_key ) );
   void * smem = FD_SCRATCH_ALLOC_APPEND( l, fd_scratch_smem_align(), fd_scratch_smem_footprint( SCRATCH_SMAX ) );
   void * fmem = FD_SCRATCH_ALLOC_APPEND( l, fd_scratch_fmem_align(), fd_scratch_fmem_footprint( SCRATCH_SDEPTH ) );
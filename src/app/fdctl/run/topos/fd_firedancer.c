@@ -6,6 +6,7 @@
 #include "../../fdctl.h"
 #include "../../config.h"
 #include "../../../../ballet/shred/fd_shred.h"
+#include "../../../../disco/keyguard/fd_keyguard.h"
 #include "../../../../disco/topo/fd_topob.h"
 #include "../../../../disco/topo/fd_pod_format.h"
 #include "../../../../flamenco/runtime/fd_blockstore.h"
@@ -22,8 +23,16 @@ fd_topo_firedancer( config_t * _config ) {
   ulong shred_tile_cnt  = config->layout.shred_tile_count;
   ulong quic_tile_cnt   = config->layout.quic_tile_count;
   ulong verify_tile_cnt = config->layout.verify_tile_count;
+  ulong ingest_ring_cnt = config->tiles.ingest.ring_count;
+
+  /* Pack feeds the replay tile rather than bank tiles here, so there is
+     nothing to split between several pack tiles. */
+  if( FD_UNLIKELY( config->layout.pack_tile_count!=1U ) )
+    FD_LOG_ERR(( "[layout.pack_tile_count] must be 1 with this topology" ));
 
   ulong replay_tpool_thread_count = config->tiles.replay.tpool_thread_count;
+  if( FD_UNLIKELY( !replay_tpool_thread_count || replay_tpool_thread_count>FD_TILE_MAX ) )
+    FD_LOG_ERR(( "bad tpool_thread_count %lu", replay_tpool_thread_count ));
 
   fd_topo_t * topo = { fd_topob_new( &config->topo, config->name ) };
 
@@ -38,6 +47,7 @@ fd_topo_firedancer( config_t * _config ) {
   fd_topob_wksp( topo, "dedup_pack"   );
 
   fd_topob_wksp( topo, "shred_storei" );
+  fd_topob_wksp( topo, "shred_turn"   );
   fd_topob_wksp( topo, "stake_out"    );
   fd_topob_wksp( topo, "metric_in"    );
 
@@ -77,14 +87,34 @@ fd_topo_firedancer( config_t * _config ) {
   fd_topob_wksp( topo, "gossip"     );
   fd_topob_wksp( topo, "metric"     );
   fd_topob_wksp( topo, "replay"     );
-  fd_topob_wksp( topo, "thread"     );
   fd_topob_wksp( topo, "bhole"      );
   fd_topob_wksp( topo, "bstore"     );
   fd_topob_wksp( topo, "funk"       );
   fd_topob_wksp( topo, "pohi"       );
 
+  /* The shared memory ingest rings are published to by processes outside
+     of the topology, which find them through the ingest directory, so
+     it must be the first object of the ingest_ext workspace. */
+  if( FD_UNLIKELY( ingest_ring_cnt ) ) {
+    fd_topob_wksp( topo, "ingest_ext" );
+    fd_topob_wksp( topo, "ingest_out" );
+    fd_topob_wksp( topo, "ingest"     );
+    fd_topob_ingest( topo, "ingest_ext", ingest_ring_cnt );
+  }
+
   #define FOR(cnt) for( ulong i=0UL; i<cnt; i++ )
 
+  /* Each replay tpool thread gets a workspace of its own for its
+     scratch, so that it is placed on the NUMA node of the CPU the
+     thread runs on.  Scratch sizes are not a multiple of the gigantic
+     page size, so these are backed by huge pages. */
+  char thread_wksp[ FD_TILE_MAX ][ 13 ];
+  FOR(replay_tpool_thread_count-1) {
+    FD_TEST( fd_cstr_printf_check( thread_wksp[ i ], sizeof(thread_wksp[ i ]), NULL, "thread%lu", i ) );
+    fd_topob_wksp( topo, thread_wksp[ i ] );
+    FD_TEST( fd_pod_insertf_ulong( topo->props, FD_SHMEM_HUGE_PAGE_SZ, "wksp.%lu.page_sz", topo->wksp_cnt-1UL ) );
+  }
+
   /*                                  topo, link_name,      wksp_name,      is_reasm, depth,                                    mtu,                           burst */
   FOR(net_tile_cnt)    fd_topob_link( topo, "net_gossip",   "net_gossip",   0,        config->tiles.net.send_buffer_size,       FD_NET_MTU,                    1UL );
   FOR(net_tile_cnt)    fd_topob_link( topo, "net_repair",   "net_repair",   0,        config->tiles.net.send_buffer_size,       FD_NET_MTU,                    1UL );
@@ -102,8 +132,8 @@ fd_topo_firedancer( config_t * _config ) {
 
   FOR(quic_tile_cnt)   fd_topob_link( topo, "quic_sign",    "quic_sign",    0,        128UL,                                    130UL,                         1UL );
   FOR(quic_tile_cnt)   fd_topob_link( topo, "sign_quic",    "sign_quic",    0,        128UL,                                    64UL,                          1UL );
-  FOR(shred_tile_cnt)  fd_topob_link( topo, "shred_sign",   "shred_sign",   0,        128UL,                                    32UL,                          1UL );
-  FOR(shred_tile_cnt)  fd_topob_link( topo, "sign_shred",   "sign_shred",   0,        128UL,                                    64UL,                          1UL );
+  FOR(shred_tile_cnt)  fd_topob_link( topo, "shred_sign",   "shred_sign",   0,        128UL,                                    32UL*FD_KEYGUARD_SIGN_BATCH_MAX, 1UL );
+  FOR(shred_tile_cnt)  fd_topob_link( topo, "sign_shred",   "sign_shred",   0,        128UL,                                    64UL*FD_KEYGUARD_SIGN_BATCH_MAX, 1UL );
 
   /**/                 fd_topob_link( topo, "gossip_sign",  "gossip_sign",  0,        128UL,                                    2048UL,                        1UL );
   /**/                 fd_topob_link( topo, "sign_gossip",  "sign_gossip",  0,        128UL,                                    64UL,                          1UL );
@@ -125,11 +155,38 @@ fd_topo_firedancer( config_t * _config ) {
   /**/                 fd_topob_link( topo, "pack_replay",  "pack_replay",  0,        128UL,                                    USHORT_MAX,                    1UL   );
   /**/                 fd_topob_link( topo, "poh_pack",     "replay_poh",   0,        128UL,                                    sizeof(fd_became_leader_t),    1UL   );
 
+  /* Rough relative bandwidth of the busy links, per link, in bytes per
+     transaction flowing through the TPU or replayed.  Only used to
+     place the tiles with an affinity of "auto" or by `fdctl layout`. */
+  ulong txn_bw = FD_TPU_MTU;
+  /*                  topo, link_name,      bw */
+  fd_topob_link_bw(   topo, "net_quic",     txn_bw/net_tile_cnt       );
+  fd_topob_link_bw(   topo, "quic_verify",  txn_bw/quic_tile_cnt      );
+  fd_topob_link_bw(   topo, "verify_dedup", txn_bw/verify_tile_cnt    );
+  fd_topob_link_bw(   topo, "dedup_pack",   txn_bw                    );
+  fd_topob_link_bw(   topo, "net_shred",    txn_bw/net_tile_cnt       );
+  fd_topob_link_bw(   topo, "shred_storei", txn_bw/shred_tile_cnt     );
+  fd_topob_link_bw(   topo, "shred_net",    2UL*txn_bw/shred_tile_cnt );
+  fd_topob_link_bw(   topo, "store_replay", txn_bw                    );
+  fd_topob_link_bw(   topo, "pack_replay",  txn_bw                    );
+  fd_topob_link_bw(   topo, "poh_shred",    txn_bw                    );
+
+  if( FD_UNLIKELY( ingest_ring_cnt ) ) {
+    FOR(ingest_ring_cnt) fd_topob_link( topo, "ingest_ext", "ingest_ext", 0,      config->tiles.ingest.ring_depth,          FD_TPU_MTU,                    1UL );
+    /**/                 fd_topob_link( topo, "ingest_out", "ingest_out", 0,      config->tiles.verify.receive_buffer_size, FD_TPU_MTU,                    1UL );
+  }
+
+  /* With an affinity of "auto", tiles are created floating and placed
+     on CPUs at boot, see fd_topo_place.h. */
+  int auto_affinity = !strcmp( config->layout.affinity, "auto" );
+
   ushort parsed_tile_to_cpu[ FD_TILE_MAX ];
   for( ulong i=0UL; i<FD_TILE_MAX; i++ ) parsed_tile_to_cpu[ i ] = USHORT_MAX; /* Unassigned tiles will be floating. */
-  ulong affinity_tile_cnt = fd_tile_private_cpus_parse( config->layout.affinity, parsed_tile_to_cpu );
+  ulong affinity_tile_cnt = 0UL;
+  if( FD_LIKELY( !auto_affinity ) ) affinity_tile_cnt = fd_tile_private_cpus_parse( config->layout.affinity, parsed_tile_to_cpu );
 
   ulong tile_to_cpu[ FD_TILE_MAX ];
+  for( ulong i=0UL; i<FD_TILE_MAX; i++ ) tile_to_cpu[ i ] = ULONG_MAX;
   for( ulong i=0UL; i<affinity_tile_cnt; i++ ) {
     if( FD_UNLIKELY( parsed_tile_to_cpu[ i ]!=65535 && parsed_tile_to_cpu[ i ]>=get_nprocs() ) )
       FD_LOG_ERR(( "The CPU affinity string in the configuration file under [layout.affinity] specifies a CPU index of %hu, but the system "
@@ -150,17 +207,26 @@ fd_topo_firedancer( config_t * _config ) {
   /**/                             fd_topob_tile( topo, "storei",  "storei",  "metric_in", "metric_in",  tile_to_cpu[ topo->tile_cnt ], 0,       NULL,           0UL );
   /**/                             fd_topob_tile( topo, "replay",  "replay",  "metric_in", "metric_in",  tile_to_cpu[ topo->tile_cnt ], 0,       "stake_out",    0UL );
   /* These thread tiles must be defined immediately after the replay tile.  We subtract one because the replay tile acts as a thread in the tpool as well. */
-  FOR(replay_tpool_thread_count-1) fd_topob_tile( topo, "thread",  "thread",  "metric_in", "metric_in",  tile_to_cpu[ topo->tile_cnt ], 0,       NULL,           0UL );
+  FOR(replay_tpool_thread_count-1) fd_topob_tile( topo, "thread",  thread_wksp[ i ], "metric_in", "metric_in", tile_to_cpu[ topo->tile_cnt ], 0,  NULL,           0UL );
   /**/                             fd_topob_tile( topo, "bhole",   "bhole",   "metric_in", "metric_in",  tile_to_cpu[ topo->tile_cnt ], 0,       NULL,           0UL );
   /**/                             fd_topob_tile( topo, "sign",    "sign",    "metric_in", "metric_in",  tile_to_cpu[ topo->tile_cnt ], 0,       NULL,           0UL );
   /**/                             fd_topob_tile( topo, "metric",  "metric",  "metric_in", "metric_in",  tile_to_cpu[ topo->tile_cnt ], 0,       NULL,           0UL );
   /**/                             fd_topob_tile( topo, "pack",    "pack",    "metric_in", "metric_in",  tile_to_cpu[ topo->tile_cnt ], 0,       "pack_replay",  0UL );
   /**/                             fd_topob_tile( topo, "pohi",    "pohi",    "metric_in", "metric_in",  tile_to_cpu[ topo->tile_cnt ], 0,       "poh_shred",    0UL );
+  if( FD_UNLIKELY( ingest_ring_cnt ) )
+    /**/               fd_topob_tile( topo, "ingest",  "ingest",  "metric_in", "metric_in",  tile_to_cpu[ topo->tile_cnt ], 0,       "ingest_out",   0UL );
 
   fd_topo_tile_t * store_tile  = &topo->tiles[ fd_topo_find_tile( topo, "storei",  0UL ) ];
   fd_topo_tile_t * replay_tile = &topo->tiles[ fd_topo_find_tile( topo, "replay", 0UL ) ];
   fd_topo_tile_t * repair_tile = &topo->tiles[ fd_topo_find_tile( topo, "repair", 0UL ) ];
 
+  /* The replay tile attaches the scratch of each of its tpool threads
+     when it starts them. */
+  FOR(replay_tpool_thread_count-1) {
+    fd_topo_tile_t * thread_tile = &topo->tiles[ fd_topo_find_tile( topo, "thread", i ) ];
+    fd_topob_tile_uses( topo, replay_tile, &topo->objs[ thread_tile->tile_obj_id ], FD_SHMEM_JOIN_MODE_READ_WRITE );
+  }
+
   /* Create a shared blockstore to be used by store and replay. */
   fd_topo_obj_t * blockstore_obj = fd_topob_obj_concrete( topo, "blockstore", "bstore", fd_blockstore_align(), fd_blockstore_footprint(), 32UL * FD_SHMEM_GIGANTIC_PAGE_SZ );
   fd_topob_tile_uses( topo, store_tile,  blockstore_obj, FD_SHMEM_JOIN_MODE_READ_WRITE );
@@ -195,13 +261,22 @@ fd_topo_firedancer( config_t * _config ) {
   }
   FD_TEST( fd_pod_insertf_ulong( topo->props, poh_shred_obj->id, "poh_shred" ) );
 
-  if( FD_UNLIKELY( affinity_tile_cnt<topo->tile_cnt ) ) {
+  /* And one that the shred tiles use to publish the FEC sets they
+     shred as leader in order.  See TURN_KEY in fd_shred.c. */
+  fd_topo_obj_t * shred_turn_obj = fd_topob_obj( topo, "fseq", "shred_turn" );
+  for( ulong i=0UL; i<shred_tile_cnt; i++ ) {
+    fd_topo_tile_t * shred_tile = &topo->tiles[ fd_topo_find_tile( topo, "shred", i ) ];
+    fd_topob_tile_uses( topo, shred_tile, shred_turn_obj, FD_SHMEM_JOIN_MODE_READ_WRITE );
+  }
+  FD_TEST( fd_pod_insertf_ulong( topo->props, shred_turn_obj->id, "shred_turn" ) );
+
+  if( FD_UNLIKELY( !auto_affinity && affinity_tile_cnt<topo->tile_cnt ) ) {
     FD_LOG_ERR(( "The topology you are using has %lu tiles, but the CPU affinity specified in the config tile as [layout.affinity] only provides for %lu cores. "
                  "You should either increase the number of cores dedicated to Firedancer in the affinity string, or decrease the number of cores needed by reducing "
                  "the total tile count. You can reduce the tile count by decreasing individual tile counts in the [layout] section of the configuration file.",
                  topo->tile_cnt, affinity_tile_cnt ));
   }
-  if( FD_UNLIKELY( affinity_tile_cnt>topo->tile_cnt ) ) {
+  if( FD_UNLIKELY( !auto_affinity && affinity_tile_cnt>topo->tile_cnt ) ) {
     FD_LOG_WARNING(( "The topology you are using has %lu tiles, but the CPU affinity specified in the config tile as [layout.affinity] provides for %lu cores. "
                      "Not all cores in the affinity will be used by Firedancer. You may wish to increase the number of tiles in the system by increasing "
                      "individual tile counts in the [layout] section of the configuration file.",
@@ -223,6 +298,16 @@ fd_topo_firedancer( config_t * _config ) {
                        fd_topob_tile_in(  topo, "verify",  i,            "metric_in", "quic_verify",  j,            FD_TOPOB_UNRELIABLE, FD_TOPOB_POLLED ); /* No reliable consumers, verify tiles may be overrun */
   FOR(verify_tile_cnt) fd_topob_tile_in(  topo, "dedup",   0UL,          "metric_in", "verify_dedup", i,            FD_TOPOB_RELIABLE,   FD_TOPOB_POLLED );
 
+  /* The ingest tile is a reliable consumer of the rings, so clients are
+     backpressured, and its output is reliable for verify so that it is
+     in turn backpressured instead of overrunning verify. */
+  if( FD_UNLIKELY( ingest_ring_cnt ) ) {
+    FOR(ingest_ring_cnt) fd_topob_tile_in(  topo, "ingest",  0UL,          "ingest_ext", "ingest_ext", i,            FD_TOPOB_RELIABLE,   FD_TOPOB_POLLED );
+    FOR(verify_tile_cnt) fd_topob_tile_in(  topo, "verify",  i,            "metric_in",  "ingest_out", 0UL,          FD_TOPOB_RELIABLE,   FD_TOPOB_POLLED );
+    fd_topo_tile_t * ingest_tile = &topo->tiles[ fd_topo_find_tile( topo, "ingest", 0UL ) ];
+    fd_topob_tile_uses( topo, ingest_tile, &topo->objs[ fd_pod_query_ulong( topo->props, "ingest", ULONG_MAX ) ], FD_SHMEM_JOIN_MODE_READ_WRITE );
+  }
+
   FOR(net_tile_cnt)    fd_topob_tile_in(  topo, "net",     i,            "metric_in", "gossip_net",   0UL,          FD_TOPOB_UNRELIABLE, FD_TOPOB_POLLED ); /* No reliable consumers of networking fragments, may be dropped or overrun */
   FOR(net_tile_cnt)    fd_topob_tile_in(  topo, "net",     i,            "metric_in", "repair_net",   0UL,          FD_TOPOB_UNRELIABLE, FD_TOPOB_POLLED ); /* No reliable consumers of networking fragments, may be dropped or overrun */
 
@@ -350,6 +435,7 @@ fd_topo_firedancer( config_t * _config ) {
 
     } else if( FD_UNLIKELY( !strcmp( tile->name, "storei" ) ) ) {
       strncpy( tile->store_int.identity_key_path, config->consensus.identity_path, sizeof(tile->store_int.identity_key_path) );
+      tile->store_int.stream_entry_batches = config->tiles.replay.stream_entry_batches;
     } else if( FD_UNLIKELY( !strcmp( tile->name, "gossip" ) ) ) {
       tile->gossip.ip_addr = config->tiles.net.ip_addr;
       memcpy( tile->gossip.src_mac_addr, config->tiles.net.mac_addr, 6UL );
@@ -398,9 +484,12 @@ fd_topo_firedancer( config_t * _config ) {
 
     } else if( FD_UNLIKELY( !strcmp( tile->name, "metric" ) ) ) {
       tile->metric.prometheus_listen_port = config->tiles.metric.prometheus_listen_port;
+      tile->metric.snapshot_hz            = config->tiles.metric.snapshot_hz;
+      strncpy( tile->metric.snapshot_socket_path, config->tiles.metric.snapshot_socket_path, sizeof(tile->metric.snapshot_socket_path) );
 
     } else if( FD_UNLIKELY( !strcmp( tile->name, "thread" ) ) ) {
-      /* Nothing for now */
+      ulong scratch_mb = config->tiles.replay.tpool_worker_scratch_mb;
+      tile->thread.scratch_sz = fd_ulong_if( !!scratch_mb, scratch_mb, 256UL ) << 20;
     } else if( FD_UNLIKELY( !strcmp( tile->name, "pack" ) ) ) {
       strncpy( tile->pack.identity_key_path, config->consensus.identity_path, sizeof(tile->pack.identity_key_path) );
 
@@ -412,11 +501,27 @@ fd_topo_firedancer( config_t * _config ) {
       strncpy( tile->poh.identity_key_path, config->consensus.identity_path, sizeof(tile->poh.identity_key_path) );
 
       tile->poh.bank_cnt = config->layout.bank_tile_count;
+    } else if( FD_UNLIKELY( !strcmp( tile->name, "ingest" ) ) ) {
+
     } else {
       FD_LOG_ERR(( "unknown tile name %lu `%s`", i, tile->name ));
     }
   }
 
+  /* Optionally give every tile a profiling ring, which `fdctl prof`
+     reads out of the metric_in workspace. */
+  if( FD_UNLIKELY( config->tiles.metric.profile_ring_depth ) ) {
+    for( ulong i=0UL; i<topo->tile_cnt; i++ ) fd_topob_tile_prof( topo, &topo->tiles[ i ], "metric_in", config->tiles.metric.profile_ring_depth );
+  }
+
+  /* Optionally let the metric tile periodically snapshot the metrics of
+     every tile, for streaming and for other readers of metric_in. */
+  if( FD_LIKELY( config->tiles.metric.snapshot_hz ) ) {
+    ulong metric_tile_idx = fd_topo_find_tile( topo, "metric", 0UL );
+    FD_TEST( metric_tile_idx!=ULONG_MAX );
+    fd_topob_metrics_snap( topo, &topo->tiles[ metric_tile_idx ], "metric_in" );
+  }
+
   fd_topob_finish( topo, fdctl_obj_align, fdctl_obj_footprint, fdctl_obj_loose );
 
   const char * snapshot = config->tiles.replay.snapshot;
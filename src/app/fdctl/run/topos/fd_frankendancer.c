@@ -2,6 +2,7 @@
 #include "../../fdctl.h"
 #include "../../config.h"
 #include "../../../../ballet/shred/fd_shred.h"
+#include "../../../../disco/keyguard/fd_keyguard.h"
 #include "../../../../disco/topo/fd_topob.h"
 #include "../../../../disco/topo/fd_pod_format.h"
 #include "../../../../util/tile/fd_tile_private.h"
@@ -13,8 +14,18 @@ fd_topo_frankendancer( config_t * config ) {
   ulong net_tile_cnt    = config->layout.net_tile_count;
   ulong quic_tile_cnt   = config->layout.quic_tile_count;
   ulong verify_tile_cnt = config->layout.verify_tile_count;
+  ulong pack_tile_cnt   = config->layout.pack_tile_count;
   ulong bank_tile_cnt   = config->layout.bank_tile_count;
   ulong shred_tile_cnt  = config->layout.shred_tile_count;
+  ulong ingest_ring_cnt = config->tiles.ingest.ring_count;
+
+  /* Each pack tile schedules for its own equal share of the bank
+     tiles, see fd_pack_shard.h. */
+  if( FD_UNLIKELY( !pack_tile_cnt || pack_tile_cnt>FD_PACK_SHARD_MAX ) )
+    FD_LOG_ERR(( "[layout.pack_tile_count] must be in [1,%lu]", FD_PACK_SHARD_MAX ));
+  if( FD_UNLIKELY( bank_tile_cnt%pack_tile_cnt ) )
+    FD_LOG_ERR(( "[layout.bank_tile_count] %lu must be a multiple of [layout.pack_tile_count] %lu", bank_tile_cnt, pack_tile_cnt ));
+  ulong pack_bank_cnt = bank_tile_cnt/pack_tile_cnt;
 
   fd_topo_t * topo = { fd_topob_new( &config->topo, config->name ) };
 
@@ -25,10 +36,13 @@ fd_topo_frankendancer( config_t * config ) {
   fd_topob_wksp( topo, "verify_dedup" );
   fd_topob_wksp( topo, "dedup_pack"   );
   fd_topob_wksp( topo, "pack_bank"    );
+  if( FD_UNLIKELY( pack_tile_cnt>1UL ) )
+    fd_topob_wksp( topo, "pack_shard"   );
   fd_topob_wksp( topo, "bank_poh"     );
   fd_topob_wksp( topo, "bank_busy"    );
   fd_topob_wksp( topo, "poh_shred"    );
   fd_topob_wksp( topo, "shred_store"  );
+  fd_topob_wksp( topo, "shred_turn"   );
   fd_topob_wksp( topo, "stake_out"    );
   fd_topob_wksp( topo, "metric_in"    );
 
@@ -49,6 +63,16 @@ fd_topo_frankendancer( config_t * config ) {
   fd_topob_wksp( topo, "sign"   );
   fd_topob_wksp( topo, "metric" );
 
+  /* The shared memory ingest rings are published to by processes outside
+     of the topology, which find them through the ingest directory, so
+     it must be the first object of the ingest_ext workspace. */
+  if( FD_UNLIKELY( ingest_ring_cnt ) ) {
+    fd_topob_wksp( topo, "ingest_ext" );
+    fd_topob_wksp( topo, "ingest_out" );
+    fd_topob_wksp( topo, "ingest"     );
+    fd_topob_ingest( topo, "ingest_ext", ingest_ring_cnt );
+  }
+
   #define FOR(cnt) for( ulong i=0UL; i<cnt; i++ )
 
   /*                                  topo, link_name,      wksp_name,      is_reasm, depth,                                    mtu,                    burst */
@@ -64,9 +88,9 @@ fd_topo_frankendancer( config_t * config ) {
   /* gossip_pack could be FD_TPU_MTU for now, since txns are not parsed, but better to just share one size for all the ins of pack */
   /**/                 fd_topob_link( topo, "gossip_pack",  "dedup_pack",   0,        config->tiles.verify.receive_buffer_size, FD_TPU_DCACHE_MTU,      1UL );
   /**/                 fd_topob_link( topo, "stake_out",    "stake_out",    0,        128UL,                                    32UL + 40200UL * 40UL,  1UL );
-  /* pack_bank is shared across all banks, so if one bank stalls due to complex transactions, the buffer neeeds to be large so that
-     other banks can keep proceeding. */
-  /**/                 fd_topob_link( topo, "pack_bank",    "pack_bank",    0,        65536UL,                                  USHORT_MAX,             1UL );
+  /* pack_bank is shared across all banks of a pack tile, so if one bank stalls due to complex transactions, the buffer neeeds to be
+     large so that other banks can keep proceeding. */
+  FOR(pack_tile_cnt)   fd_topob_link( topo, "pack_bank",    "pack_bank",    0,        65536UL,                                  USHORT_MAX,             1UL );
   FOR(bank_tile_cnt)   fd_topob_link( topo, "bank_poh",     "bank_poh",     0,        128UL,                                    USHORT_MAX,             1UL );
   /**/                 fd_topob_link( topo, "poh_pack",     "bank_poh",     0,        128UL,                                    sizeof(fd_became_leader_t), 1UL );
   /**/                 fd_topob_link( topo, "poh_shred",    "poh_shred",    0,        16384UL,                                  USHORT_MAX,             1UL );
@@ -76,14 +100,41 @@ fd_topo_frankendancer( config_t * config ) {
 
   FOR(quic_tile_cnt)   fd_topob_link( topo, "quic_sign",    "quic_sign",    0,        128UL,                                    130UL,                  1UL );
   FOR(quic_tile_cnt)   fd_topob_link( topo, "sign_quic",    "sign_quic",    0,        128UL,                                    64UL,                   1UL );
-  FOR(shred_tile_cnt)  fd_topob_link( topo, "shred_sign",   "shred_sign",   0,        128UL,                                    32UL,                   1UL );
-  FOR(shred_tile_cnt)  fd_topob_link( topo, "sign_shred",   "sign_shred",   0,        128UL,                                    64UL,                   1UL );
+  FOR(shred_tile_cnt)  fd_topob_link( topo, "shred_sign",   "shred_sign",   0,        128UL,                                    32UL*FD_KEYGUARD_SIGN_BATCH_MAX, 1UL );
+  FOR(shred_tile_cnt)  fd_topob_link( topo, "sign_shred",   "sign_shred",   0,        128UL,                                    64UL*FD_KEYGUARD_SIGN_BATCH_MAX, 1UL );
+
+  /* Rough relative bandwidth of the busy links, per link, in bytes per
+     transaction flowing through the TPU.  Only used to place the tiles
+     with an affinity of "auto" or by `fdctl layout`. */
+  ulong txn_bw = FD_TPU_MTU;
+  /*                  topo, link_name,      bw */
+  fd_topob_link_bw(   topo, "net_quic",     txn_bw/net_tile_cnt       );
+  fd_topob_link_bw(   topo, "quic_verify",  txn_bw/quic_tile_cnt      );
+  fd_topob_link_bw(   topo, "verify_dedup", txn_bw/verify_tile_cnt    );
+  fd_topob_link_bw(   topo, "dedup_pack",   txn_bw                    );
+  fd_topob_link_bw(   topo, "pack_bank",    txn_bw/pack_tile_cnt      );
+  fd_topob_link_bw(   topo, "bank_poh",     txn_bw/bank_tile_cnt      );
+  fd_topob_link_bw(   topo, "poh_shred",    txn_bw                    );
+  fd_topob_link_bw(   topo, "net_shred",    txn_bw/net_tile_cnt       );
+  fd_topob_link_bw(   topo, "shred_store",  txn_bw/shred_tile_cnt     );
+  fd_topob_link_bw(   topo, "shred_net",    2UL*txn_bw/shred_tile_cnt );
+
+  if( FD_UNLIKELY( ingest_ring_cnt ) ) {
+    FOR(ingest_ring_cnt) fd_topob_link( topo, "ingest_ext", "ingest_ext", 0,      config->tiles.ingest.ring_depth,          FD_TPU_MTU,                    1UL );
+    /**/                 fd_topob_link( topo, "ingest_out", "ingest_out", 0,      config->tiles.verify.receive_buffer_size, FD_TPU_MTU,                    1UL );
+  }
+
+  /* With an affinity of "auto", tiles are created floating and placed
+     on CPUs at boot, see fd_topo_place.h. */
+  int auto_affinity = !strcmp( config->layout.affinity, "auto" );
 
   ushort parsed_tile_to_cpu[ FD_TILE_MAX ];
   for( ulong i=0UL; i<FD_TILE_MAX; i++ ) parsed_tile_to_cpu[ i ] = USHORT_MAX; /* Unassigned tiles will be floating. */
-  ulong affinity_tile_cnt = fd_tile_private_cpus_parse( config->layout.affinity, parsed_tile_to_cpu );
+  ulong affinity_tile_cnt = 0UL;
+  if( FD_LIKELY( !auto_affinity ) ) affinity_tile_cnt = fd_tile_private_cpus_parse( config->layout.affinity, parsed_tile_to_cpu );
 
   ulong tile_to_cpu[ FD_TILE_MAX ];
+  for( ulong i=0UL; i<FD_TILE_MAX; i++ ) tile_to_cpu[ i ] = ULONG_MAX;
   for( ulong i=0UL; i<affinity_tile_cnt; i++ ) {
     if( FD_UNLIKELY( parsed_tile_to_cpu[ i ]!=65535 && parsed_tile_to_cpu[ i ]>=get_nprocs() ) )
       FD_LOG_ERR(( "The CPU affinity string in the configuration file under [layout.affinity] specifies a CPU index of %hu, but the system "
@@ -98,20 +149,22 @@ fd_topo_frankendancer( config_t * config ) {
   FOR(quic_tile_cnt)   fd_topob_tile( topo, "quic",    "quic",    "metric_in", "metric_in",  tile_to_cpu[ topo->tile_cnt ], 0,       "quic_verify",  i   );
   FOR(verify_tile_cnt) fd_topob_tile( topo, "verify",  "verify",  "metric_in", "metric_in",  tile_to_cpu[ topo->tile_cnt ], 0,       "verify_dedup", i   );
   /**/                 fd_topob_tile( topo, "dedup",   "dedup",   "metric_in", "metric_in",  tile_to_cpu[ topo->tile_cnt ], 0,       "dedup_pack",   0UL );
-  /**/                 fd_topob_tile( topo, "pack",    "pack",    "metric_in", "metric_in",  tile_to_cpu[ topo->tile_cnt ], 0,       "pack_bank",    0UL );
+  FOR(pack_tile_cnt)   fd_topob_tile( topo, "pack",    "pack",    "metric_in", "metric_in",  tile_to_cpu[ topo->tile_cnt ], 0,       "pack_bank",    i   );
   FOR(bank_tile_cnt)   fd_topob_tile( topo, "bank",    "bank",    "metric_in", "metric_in",  tile_to_cpu[ topo->tile_cnt ], 1,       "bank_poh",     i   );
   /**/                 fd_topob_tile( topo, "poh",     "poh",     "metric_in", "metric_in",  tile_to_cpu[ topo->tile_cnt ], 1,       "poh_shred",    0UL );
   FOR(shred_tile_cnt)  fd_topob_tile( topo, "shred",   "shred",   "metric_in", "metric_in",  tile_to_cpu[ topo->tile_cnt ], 0,       "shred_store",  i   );
   /**/                 fd_topob_tile( topo, "store",   "store",   "metric_in", "metric_in",  tile_to_cpu[ topo->tile_cnt ], 1,       NULL,           0UL );
   /**/                 fd_topob_tile( topo, "sign",    "sign",    "metric_in", "metric_in",  tile_to_cpu[ topo->tile_cnt ], 0,       NULL,           0UL );
   /**/                 fd_topob_tile( topo, "metric",  "metric",  "metric_in", "metric_in",  tile_to_cpu[ topo->tile_cnt ], 0,       NULL,           0UL );
+  if( FD_UNLIKELY( ingest_ring_cnt ) )
+    /**/               fd_topob_tile( topo, "ingest",  "ingest",  "metric_in", "metric_in",  tile_to_cpu[ topo->tile_cnt ], 0,       "ingest_out",   0UL );
 
-  if( FD_UNLIKELY( affinity_tile_cnt<topo->tile_cnt ) )
+  if( FD_UNLIKELY( !auto_affinity && affinity_tile_cnt<topo->tile_cnt ) )
     FD_LOG_ERR(( "The topology you are using has %lu tiles, but the CPU affinity specified in the config tile as [layout.affinity] only provides for %lu cores. "
                  "You should either increase the number of cores dedicated to Firedancer in the affinity string, or decrease the number of cores needed by reducing "
                  "the total tile count. You can reduce the tile count by decreasing individual tile counts in the [layout] section of the configuration file.",
                  topo->tile_cnt, affinity_tile_cnt ));
-  if( FD_UNLIKELY( affinity_tile_cnt>topo->tile_cnt ) )
+  if( FD_UNLIKELY( !auto_affinity && affinity_tile_cnt>topo->tile_cnt ) )
     FD_LOG_WARNING(( "The topology you are using has %lu tiles, but the CPU affinity specified in the config tile as [layout.affinity] provides for %lu cores. "
                      "Not all cores in the affinity will be used by Firedancer. You may wish to increase the number of tiles in the system by increasing "
                      "individual tile counts in the [layout] section of the configuration file.",
@@ -132,8 +185,21 @@ fd_topo_frankendancer( config_t * config ) {
   FOR(verify_tile_cnt) for( ulong j=0UL; j<quic_tile_cnt; j++ )
                        fd_topob_tile_in(  topo, "verify",  i,            "metric_in", "quic_verify",  j,            FD_TOPOB_UNRELIABLE, FD_TOPOB_POLLED ); /* No reliable consumers, verify tiles may be overrun */
   FOR(verify_tile_cnt) fd_topob_tile_in(  topo, "dedup",   0UL,          "metric_in", "verify_dedup", i,            FD_TOPOB_RELIABLE,   FD_TOPOB_POLLED );
-  /**/                 fd_topob_tile_in(  topo, "pack",    0UL,          "metric_in", "dedup_pack",   0UL,          FD_TOPOB_RELIABLE,   FD_TOPOB_POLLED );
-  /**/                 fd_topob_tile_in(  topo, "pack",    0UL,          "metric_in", "gossip_pack",  0UL,          FD_TOPOB_RELIABLE,   FD_TOPOB_POLLED );
+
+  /* The ingest tile is a reliable consumer of the rings, so clients are
+     backpressured, and its output is reliable for verify so that it is
+     in turn backpressured instead of overrunning verify. */
+  if( FD_UNLIKELY( ingest_ring_cnt ) ) {
+    FOR(ingest_ring_cnt) fd_topob_tile_in(  topo, "ingest",  0UL,          "ingest_ext", "ingest_ext", i,            FD_TOPOB_RELIABLE,   FD_TOPOB_POLLED );
+    FOR(verify_tile_cnt) fd_topob_tile_in(  topo, "verify",  i,            "metric_in",  "ingest_out", 0UL,          FD_TOPOB_RELIABLE,   FD_TOPOB_POLLED );
+    fd_topo_tile_t * ingest_tile = &topo->tiles[ fd_topo_find_tile( topo, "ingest", 0UL ) ];
+    fd_topob_tile_uses( topo, ingest_tile, &topo->objs[ fd_pod_query_ulong( topo->props, "ingest", ULONG_MAX ) ], FD_SHMEM_JOIN_MODE_READ_WRITE );
+  }
+
+  /* Every pack tile sees every transaction, and drops the ones that
+     another pack tile schedules. */
+  FOR(pack_tile_cnt)   fd_topob_tile_in(  topo, "pack",    i,            "metric_in", "dedup_pack",   0UL,          FD_TOPOB_RELIABLE,   FD_TOPOB_POLLED );
+  FOR(pack_tile_cnt)   fd_topob_tile_in(  topo, "pack",    i,            "metric_in", "gossip_pack",  0UL,          FD_TOPOB_RELIABLE,   FD_TOPOB_POLLED );
   /* The PoH to pack link is reliable, and must be.  The fragments going
      across here are "you became leader" which pack must respond to
      by publishing microblocks, otherwise the leader TPU will hang
@@ -144,12 +210,12 @@ fd_topo_frankendancer( config_t * config ) {
      will never send more than one leader message until the pack tile
      must acknowledge it with a packing done frag, so there will be at
      most one in flight at any time. */
-  /**/                 fd_topob_tile_in(  topo, "pack",   0UL,           "metric_in", "poh_pack",     0UL,          FD_TOPOB_UNRELIABLE, FD_TOPOB_POLLED );
-  FOR(bank_tile_cnt)   fd_topob_tile_in(  topo, "bank",   i,             "metric_in", "pack_bank",    0UL,          FD_TOPOB_RELIABLE,   FD_TOPOB_POLLED );
+  FOR(pack_tile_cnt)   fd_topob_tile_in(  topo, "pack",   i,             "metric_in", "poh_pack",     0UL,          FD_TOPOB_UNRELIABLE, FD_TOPOB_POLLED );
+  FOR(bank_tile_cnt)   fd_topob_tile_in(  topo, "bank",   i,             "metric_in", "pack_bank",    i/pack_bank_cnt, FD_TOPOB_RELIABLE, FD_TOPOB_POLLED );
   FOR(bank_tile_cnt)   fd_topob_tile_in(  topo, "poh",    0UL,           "metric_in", "bank_poh",     i,            FD_TOPOB_RELIABLE,   FD_TOPOB_POLLED );
   /**/                 fd_topob_tile_in(  topo, "poh",    0UL,           "metric_in", "stake_out",    0UL,          FD_TOPOB_RELIABLE,   FD_TOPOB_POLLED );
-  /**/                 fd_topob_tile_in(  topo, "poh",    0UL,           "metric_in", "pack_bank",    0UL,          FD_TOPOB_RELIABLE,   FD_TOPOB_POLLED );
-                       fd_topob_tile_out( topo, "poh",    0UL,                        "poh_pack",     0UL                                                );
+  FOR(pack_tile_cnt)   fd_topob_tile_in(  topo, "poh",    0UL,           "metric_in", "pack_bank",    i,            FD_TOPOB_RELIABLE,   FD_TOPOB_POLLED );
+  /**/                 fd_topob_tile_out( topo, "poh",    0UL,                        "poh_pack",     0UL                                                );
   FOR(shred_tile_cnt) for( ulong j=0UL; j<net_tile_cnt; j++ )
                        fd_topob_tile_in(  topo, "shred",  i,             "metric_in", "net_shred",    j,            FD_TOPOB_UNRELIABLE, FD_TOPOB_POLLED ); /* No reliable consumers of networking fragments, may be dropped or overrun */
   FOR(shred_tile_cnt)  fd_topob_tile_in(  topo, "shred",  i,             "metric_in", "poh_shred",    0UL,          FD_TOPOB_RELIABLE,   FD_TOPOB_POLLED );
@@ -193,12 +259,26 @@ fd_topo_frankendancer( config_t * config ) {
     fd_topo_obj_t * busy_obj = fd_topob_obj( topo, "fseq", "bank_busy" );
 
     fd_topo_tile_t * poh_tile = &topo->tiles[ fd_topo_find_tile( topo, "poh", 0UL ) ];
-    fd_topo_tile_t * pack_tile = &topo->tiles[ fd_topo_find_tile( topo, "pack", 0UL ) ];
+    fd_topo_tile_t * pack_tile = &topo->tiles[ fd_topo_find_tile( topo, "pack", i/pack_bank_cnt ) ];
     fd_topob_tile_uses( topo, poh_tile, busy_obj, FD_SHMEM_JOIN_MODE_READ_WRITE );
     fd_topob_tile_uses( topo, pack_tile, busy_obj, FD_SHMEM_JOIN_MODE_READ_ONLY );
     FD_TEST( fd_pod_insertf_ulong( topo->props, busy_obj->id, "bank_busy.%lu", i ) );
   }
 
+  /* With more than one pack tile, the pack tiles arbitrate conflicts
+     between the transactions they schedule through a shared table of
+     account locks and write costs, sized to make spurious conflicts
+     between accounts hashing to the same bucket rare. */
+  if( FD_UNLIKELY( pack_tile_cnt>1UL ) ) {
+    ulong lg_bucket_cnt = (ulong)fd_ulong_find_msb( fd_ulong_pow2_up( config->tiles.pack.max_pending_transactions ) ) + 6UL;
+    lg_bucket_cnt = fd_ulong_max( fd_ulong_min( lg_bucket_cnt, FD_PACK_SHARD_LG_BUCKET_CNT_MAX ), FD_PACK_SHARD_LG_BUCKET_CNT_MIN );
+    fd_topo_obj_t * shard_obj = fd_topob_pack_shard( topo, "pack_shard", pack_tile_cnt, lg_bucket_cnt, FD_PACK_MAX_WRITE_COST_PER_ACCT );
+    for( ulong i=0UL; i<pack_tile_cnt; i++ ) {
+      fd_topo_tile_t * pack_tile = &topo->tiles[ fd_topo_find_tile( topo, "pack", i ) ];
+      fd_topob_tile_uses( topo, pack_tile, shard_obj, FD_SHMEM_JOIN_MODE_READ_WRITE );
+    }
+  }
+
   /* There's another special fseq that's used to communicate the shred
      version from the Solana Labs boot path to the shred tile. */
   fd_topo_obj_t * poh_shred_obj = fd_topob_obj( topo, "fseq", "poh_shred" );
@@ -210,6 +290,15 @@ fd_topo_frankendancer( config_t * config ) {
   }
   FD_TEST( fd_pod_insertf_ulong( topo->props, poh_shred_obj->id, "poh_shred" ) );
 
+  /* And one that the shred tiles use to publish the FEC sets they
+     shred as leader in order.  See TURN_KEY in fd_shred.c. */
+  fd_topo_obj_t * shred_turn_obj = fd_topob_obj( topo, "fseq", "shred_turn" );
+  for( ulong i=0UL; i<shred_tile_cnt; i++ ) {
+    fd_topo_tile_t * shred_tile = &topo->tiles[ fd_topo_find_tile( topo, "shred", i ) ];
+    fd_topob_tile_uses( topo, shred_tile, shred_turn_obj, FD_SHMEM_JOIN_MODE_READ_WRITE );
+  }
+  FD_TEST( fd_pod_insertf_ulong( topo->props, shred_turn_obj->id, "shred_turn" ) );
+
   for( ulong i=0UL; i<topo->tile_cnt; i++ ) {
     fd_topo_tile_t * tile = &topo->tiles[ i ];
 
@@ -256,7 +345,7 @@ fd_topo_frankendancer( config_t * config ) {
       strncpy( tile->pack.identity_key_path, config->consensus.identity_path, sizeof(tile->pack.identity_key_path) );
 
       tile->pack.max_pending_transactions      = config->tiles.pack.max_pending_transactions;
-      tile->pack.bank_tile_count               = config->layout.bank_tile_count;
+      tile->pack.bank_tile_count               = pack_bank_cnt;
       tile->pack.larger_max_cost_per_block     = config->development.bench.larger_max_cost_per_block;
       tile->pack.larger_shred_limits_per_block = config->development.bench.larger_shred_limits_per_block;
 
@@ -284,12 +373,30 @@ fd_topo_frankendancer( config_t * config ) {
 
     } else if( FD_UNLIKELY( !strcmp( tile->name, "metric" ) ) ) {
       tile->metric.prometheus_listen_port = config->tiles.metric.prometheus_listen_port;
+      tile->metric.snapshot_hz            = config->tiles.metric.snapshot_hz;
+      strncpy( tile->metric.snapshot_socket_path, config->tiles.metric.snapshot_socket_path, sizeof(tile->metric.snapshot_socket_path) );
+
+    } else if( FD_UNLIKELY( !strcmp( tile->name, "ingest" ) ) ) {
 
     } else {
       FD_LOG_ERR(( "unknown tile name %lu `%s`", i, tile->name ));
     }
   }
 
+  /* Optionally give every tile a profiling ring, which `fdctl prof`
+     reads out of the metric_in workspace. */
+  if( FD_UNLIKELY( config->tiles.metric.profile_ring_depth ) ) {
+    for( ulong i=0UL; i<topo->tile_cnt; i++ ) fd_topob_tile_prof( topo, &topo->tiles[ i ], "metric_in", config->tiles.metric.profile_ring_depth );
+  }
+
+  /* Optionally let the metric tile periodically snapshot the metrics of
+     every tile, for streaming and for other readers of metric_in. */
+  if( FD_LIKELY( config->tiles.metric.snapshot_hz ) ) {
+    ulong metric_tile_idx = fd_topo_find_tile( topo, "metric", 0UL );
+    FD_TEST( metric_tile_idx!=ULONG_MAX );
+    fd_topob_metrics_snap( topo, &topo->tiles[ metric_tile_idx ], "metric_in" );
+  }
+
   fd_topob_finish( topo, fdctl_obj_align, fdctl_obj_footprint, fdctl_obj_loose );
   config->topo = *topo;
 }
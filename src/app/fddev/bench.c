@@ -111,6 +111,14 @@ add_bench_topo( fd_topo_t  * topo,
     }
   }
 
+  /* bencho also watches what the shred tiles send to the store, if
+     they exist in this topology, to report the shred rate with
+     [layout.shred_tile_count] tiles shredding in parallel. */
+  for( ulong i=0UL; i<fd_topo_tile_name_cnt( topo, "shred" ); i++ ) {
+    if( FD_UNLIKELY( fd_topo_find_link( topo, "shred_store", i )==ULONG_MAX ) ) break;
+    fd_topob_tile_in( topo, "bencho", 0UL, "bench", "shred_store", i, FD_TOPOB_UNRELIABLE, FD_TOPOB_POLLED );
+  }
+
   fd_topob_finish( topo, fdctl_obj_align, fdctl_obj_footprint, fdctl_obj_loose );
 }
 
@@ -45,6 +45,7 @@ extern fd_topo_run_tile_t fd_tile_shred;
 extern fd_topo_run_tile_t fd_tile_store;
 extern fd_topo_run_tile_t fd_tile_sign;
 extern fd_topo_run_tile_t fd_tile_metric;
+extern fd_topo_run_tile_t fd_tile_ingest;
 extern fd_topo_run_tile_t fd_tile_blackhole;
 extern fd_topo_run_tile_t fd_tile_bencho;
 extern fd_topo_run_tile_t fd_tile_benchg;
@@ -72,6 +73,7 @@ fd_topo_run_tile_t * TILES[] = {
   &fd_tile_store,
   &fd_tile_sign,
   &fd_tile_metric,
+  &fd_tile_ingest,
   &fd_tile_blackhole,
   &fd_tile_bencho,
   &fd_tile_benchg,
@@ -30,6 +30,14 @@ typedef struct {
 
   ulong txncount_prev;
 
+  /* Shreds the shred tiles produced as leader, counted from their
+     output to the store.  The links are unreliable, so this is a lower
+     bound if we fall behind. */
+  ulong       shred_tile_cnt;
+  ulong       shred_cnt;
+  ulong       shred_cnt_prev;
+  fd_wksp_t * shred_in_mem;
+
   fd_rpc_client_t rpc[ 1 ];
 
   fd_wksp_t * mem;
@@ -133,10 +141,17 @@ service_txn_count( fd_bencho_ctx_t * ctx ) {
       FD_LOG_ERR(( "RPC server returned error %ld", response->status ));
     
     ulong txns = response->result.transaction_count.transaction_count;
-    if( FD_LIKELY( ctx->txncount_measured1 ) )
-      FD_LOG_NOTICE(( "%lu txn/s", (ulong)((double)(txns - ctx->txncount_prev)/1.2 )));
+    ulong shreds = ctx->shred_cnt;
+    if( FD_LIKELY( ctx->txncount_measured1 ) ) {
+      if( FD_LIKELY( ctx->shred_tile_cnt ) )
+        FD_LOG_NOTICE(( "%lu txn/s, %lu shreds/s (%lu shred tiles)", (ulong)((double)(txns - ctx->txncount_prev)/1.2 ),
+                        (ulong)((double)(shreds - ctx->shred_cnt_prev)/1.2 ), ctx->shred_tile_cnt ));
+      else
+        FD_LOG_NOTICE(( "%lu txn/s", (ulong)((double)(txns - ctx->txncount_prev)/1.2 )));
+    }
     ctx->txncount_measured1 = 1;
     ctx->txncount_prev      = txns;
+    ctx->shred_cnt_prev     = shreds;
     ctx->txncount_nextprint += 1200L * 1000L * 1000L; /* 1.2 seconds til we print again, multiple of slot duration to prevent jitter */
 
     fd_rpc_client_close( ctx->rpc, ctx->txncount_request );
@@ -155,6 +170,29 @@ after_credit( void *             _ctx,
   service_txn_count( ctx );
 }
 
+static inline void
+during_frag( void * _ctx,
+             ulong  in_idx,
+             ulong  seq,
+             ulong  sig,
+             ulong  chunk,
+             ulong  sz,
+             int *  opt_filter ) {
+  (void)in_idx;
+  (void)seq;
+  (void)sz;
+  (void)opt_filter;
+
+  fd_bencho_ctx_t * ctx = (fd_bencho_ctx_t *)_ctx;
+
+  /* sig==0 is an FEC set that was retransmitted from the network
+     rather than one we shredded ourself. */
+  if( FD_UNLIKELY( !sig ) ) return;
+
+  fd_shred34_t const * s34 = fd_chunk_to_laddr_const( ctx->shred_in_mem, chunk );
+  ctx->shred_cnt += s34->shred_cnt;
+}
+
 static void
 unprivileged_init( fd_topo_t *      topo,
                    fd_topo_tile_t * tile,
@@ -173,6 +211,12 @@ unprivileged_init( fd_topo_t *      topo,
   ctx->txncount_state     = FD_BENCHO_STATE_READY;
   ctx->txncount_measured1 = 0;
 
+  ctx->shred_tile_cnt = tile->in_cnt;
+  ctx->shred_cnt      = 0UL;
+  ctx->shred_cnt_prev = 0UL;
+  ctx->shred_in_mem   = NULL;
+  if( FD_LIKELY( tile->in_cnt ) ) ctx->shred_in_mem = topo->workspaces[ topo->objs[ topo->links[ tile->in_link_id[ 0UL ] ].dcache_obj_id ].wksp_id ].wksp;
+
   FD_LOG_NOTICE(( "connecting to RPC server " FD_IP4_ADDR_FMT ":%u", FD_IP4_ADDR_FMT_ARGS( tile->bencho.rpc_ip_addr ), tile->bencho.rpc_port ));
   FD_TEST( fd_rpc_client_join( fd_rpc_client_new( ctx->rpc, tile->bencho.rpc_ip_addr, tile->bencho.rpc_port ) ) );
 
@@ -187,6 +231,7 @@ fd_topo_run_tile_t fd_tile_bencho = {
   .burst                    = 1UL,
   .mux_ctx                  = mux_ctx,
   .mux_after_credit         = after_credit,
+  .mux_during_frag          = during_frag,
   .scratch_align            = scratch_align,
   .scratch_footprint        = scratch_footprint,
   .unprivileged_init        = unprivileged_init,
@@ -42,6 +42,9 @@ static void usage( char const * progname ) {
   fprintf( stderr, " --capture-txns <int>                       capture transactions\n" );
   fprintf( stderr, " --check-acc-hash <uint>                    check account hash against hash generated by data\n" );
   fprintf( stderr, " --checkpt <checkpoint file>                checkpoint wksp into file after execution\n" ); /* Capture context tool for runtime checkpoints */
+  fprintf( stderr, " --checkpt-base <checkpoint file>           paged checkpoint to write --checkpt incrementally against\n" );
+  fprintf( stderr, " --checkpt-funk-base <checkpoint file>      paged checkpoint to write --checkpt-funk incrementally against\n" );
+  fprintf( stderr, " --checkpt-paged <int>                      write paged checkpoints (written and restored with all tiles)\n" );
   fprintf( stderr, " --checkpt-freq <ulong>                     checkpoint frequency\n" );
   fprintf( stderr, " --checkpt-mismatch <int>                   checkpoint on mismatch at last rooted slot\n" );
   fprintf( stderr, " --checkpt-path <checkpoint path>           path to checkpoint\n" );
@@ -93,6 +96,9 @@ struct fd_ledger_args {
   uint              hashseed;
   char const *      checkpt;
   char const *      checkpt_funk;
+  char const *      checkpt_base;
+  char const *      checkpt_funk_base;
+  int               checkpt_paged;
   char const *      restore;
   char const *      restore_funk;
   char const *      allocator;
@@ -573,6 +579,53 @@ init_blockstore( fd_ledger_args_t * args ) {
   }
 }
 
+/* Checkpoints are written and restored with a tpool of all the tiles
+   (the runtime tpool is not running at these points) */
+
+static uchar io_tpool_mem[ FD_TPOOL_FOOTPRINT( FD_TILE_MAX ) ] __attribute__( ( aligned( FD_TPOOL_ALIGN ) ) );
+
+static fd_tpool_t *
+io_tpool_init( void ) {
+  ulong tile_cnt = fd_tile_cnt();
+  if( tile_cnt < 2UL ) return NULL;
+  fd_tpool_t * tpool = fd_tpool_init( io_tpool_mem, tile_cnt );
+  if( tpool == NULL ) {
+    FD_LOG_ERR(( "failed to create io tpool" ));
+  }
+  for( ulong i = 1UL; i < tile_cnt; ++i ) {
+    if( fd_tpool_worker_push( tpool, i, NULL, 0UL ) == NULL ) {
+      FD_LOG_ERR(( "failed to launch io worker" ));
+    }
+  }
+  return tpool;
+}
+
+static int
+wksp_checkpt( fd_ledger_args_t * args, fd_wksp_t * wksp, char const * path, char const * base ) {
+  unlink( path );
+  if( !args->checkpt_paged && base == NULL ) {
+    return fd_wksp_checkpt( wksp, path, 0666, 0, NULL );
+  }
+  fd_tpool_t * tpool = io_tpool_init();
+  long dt = -fd_log_wallclock();
+  int err = fd_wksp_checkpt_tpool( tpool, 0UL, fd_tile_cnt(), wksp, path, 0666, base, NULL );
+  dt += fd_log_wallclock();
+  if( tpool ) fd_tpool_fini( tpool );
+  FD_LOG_NOTICE(( "checkpt %s took %.3f s", path, 1e-9*(double)dt ));
+  return err;
+}
+
+static int
+wksp_restore( fd_wksp_t * wksp, char const * path, uint seed ) {
+  fd_tpool_t * tpool = io_tpool_init();
+  long dt = -fd_log_wallclock();
+  int err = fd_wksp_restore_tpool( tpool, 0UL, fd_tile_cnt(), wksp, path, seed );
+  dt += fd_log_wallclock();
+  if( tpool ) fd_tpool_fini( tpool );
+  FD_LOG_NOTICE(( "restore %s took %.3f s", path, 1e-9*(double)dt ));
+  return err;
+}
+
 void
 checkpt( fd_ledger_args_t * args, fd_exec_slot_ctx_t * slot_ctx ) {
   if( !args->checkpt && !args->checkpt_funk ) {
@@ -591,16 +644,14 @@ checkpt( fd_ledger_args_t * args, fd_exec_slot_ctx_t * slot_ctx ) {
       FD_LOG_ERR(( "funk_wksp is NULL" ));
     }
     FD_LOG_NOTICE(( "writing funk checkpt %s", args->checkpt_funk ));
-    unlink( args->checkpt_funk );
-    int err = fd_wksp_checkpt( args->funk_wksp, args->checkpt_funk, 0666, 0, NULL );
+    int err = wksp_checkpt( args, args->funk_wksp, args->checkpt_funk, args->checkpt_funk_base );
     if( err ) {
       FD_LOG_ERR(( "funk checkpt failed: error %d", err ));
     }
   }
   if( args->checkpt ) {
     FD_LOG_NOTICE(( "writing %s", args->checkpt ));
-    unlink( args->checkpt );
-    int err = fd_wksp_checkpt( args->wksp, args->checkpt, 0666, 0, NULL );
+    int err = wksp_checkpt( args, args->wksp, args->checkpt, args->checkpt_base );
     if( err ) {
       FD_LOG_ERR(( "checkpt failed: error %d", err ));
     }
@@ -610,10 +661,10 @@ checkpt( fd_ledger_args_t * args, fd_exec_slot_ctx_t * slot_ctx ) {
 void
 restore( fd_ledger_args_t * args ) {
   if( args->restore_funk != NULL ) {
-    fd_wksp_restore( args->funk_wksp, args->restore_funk, args->hashseed );
+    wksp_restore( args->funk_wksp, args->restore_funk, args->hashseed );
   }
   if( args->restore != NULL ) {
-    fd_wksp_restore( args->wksp, args->restore, args->hashseed );
+    wksp_restore( args->wksp, args->restore, args->hashseed );
   }
 }
 
@@ -986,7 +1037,7 @@ prune( fd_ledger_args_t * args ) {
   }
 
   if( args->restore || args->restore_funk ) {
-    fd_wksp_restore( args->funk_wksp == NULL ? args->wksp : args->funk_wksp, args->restore_funk == NULL ? args->restore : args->restore_funk, args->hashseed );
+    wksp_restore( args->funk_wksp == NULL ? args->wksp : args->funk_wksp, args->restore_funk == NULL ? args->restore : args->restore_funk, args->hashseed );
   }
 
   init_funk( args );
@@ -1177,7 +1228,7 @@ prune( fd_ledger_args_t * args ) {
 
 
   if( args->restore != NULL || args->restore_funk != NULL ) {
-    fd_wksp_restore( args->funk_wksp == NULL ? args->wksp : args->funk_wksp, args->restore_funk == NULL ? args->restore : args->restore_funk, args->hashseed );
+    wksp_restore( args->funk_wksp == NULL ? args->wksp : args->funk_wksp, args->restore_funk == NULL ? args->restore : args->restore_funk, args->hashseed );
     init_funk( args );
     unpruned_wksp = args->funk_wksp == NULL ? args->wksp : args->funk_wksp;
     unpruned_funk = args->funk;
@@ -1331,6 +1382,9 @@ initial_setup( int argc, char ** argv, fd_ledger_args_t * args ) {
   int          funk_only               = fd_env_strip_cmdline_int  ( &argc, &argv, "--funk-only",               NULL, 0         );
   char const * checkpt                 = fd_env_strip_cmdline_cstr ( &argc, &argv, "--checkpt",                 NULL, NULL      );
   char const * checkpt_funk            = fd_env_strip_cmdline_cstr ( &argc, &argv, "--checkpt-funk",            NULL, NULL      );
+  char const * checkpt_base            = fd_env_strip_cmdline_cstr ( &argc, &argv, "--checkpt-base",            NULL, NULL      );
+  char const * checkpt_funk_base       = fd_env_strip_cmdline_cstr ( &argc, &argv, "--checkpt-funk-base",       NULL, NULL      );
+  int          checkpt_paged           = fd_env_strip_cmdline_int  ( &argc, &argv, "--checkpt-paged",           NULL, 0         );
   char const * capture_fpath           = fd_env_strip_cmdline_cstr ( &argc, &argv, "--capture-solcap",          NULL, NULL      );
   int          capture_txns            = fd_env_strip_cmdline_int  ( &argc, &argv, "--capture-txns",            NULL, 1         );
   char const * checkpt_path            = fd_env_strip_cmdline_cstr ( &argc, &argv, "--checkpt-path",            NULL, NULL      );
@@ -1415,6 +1469,9 @@ initial_setup( int argc, char ** argv, fd_ledger_args_t * args ) {
   args->end_slot                = end_slot;
   args->checkpt                 = checkpt;
   args->checkpt_funk            = checkpt_funk;
+  args->checkpt_base            = checkpt_base;
+  args->checkpt_funk_base       = checkpt_funk_base;
+  args->checkpt_paged           = checkpt_paged;
   args->shred_max               = shred_max;
   args->slot_history_max        = slot_history_max;
   args->txns_max                = txns_max;
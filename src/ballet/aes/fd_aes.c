@@ -305,5 +305,9 @@ fd_aes_gcm_aead_decrypt( fd_aes_gcm_t * aes_gcm,
 
   /* CRYPTO_gcm128_finish */
   fd_gcm128_finish( aes_gcm );
-  return 0==memcmp( aes_gcm->Xi.c, tag, 16 );  /* TODO USE CONSTANT TIME COMPARE */
+
+  /* constant time tag compare */
+  ulong diff = 0UL;
+  for( ulong i=0UL; i<16UL; i++ ) diff |= (ulong)( aes_gcm->Xi.c[ i ] ^ tag[ i ] );
+  return diff==0UL;
 }
@@ -16,9 +16,10 @@
 
    ### Optimization Notes
 
-   Currently supports 'all-in-one' API only, wherein the entire plain-
-   text is encrypted/decrypted in a single blocking call.  API may
-   change in the future to support a batched 'multi block' API or
+   Supports an 'all-in-one' API, wherein the entire plaintext is
+   encrypted/decrypted in a single blocking call, and a batched API for
+   AES-128-GCM, wherein many independent messages are processed in one
+   call (see below).  API may change in the future to support a
    streaming mode of operation.
 
    AES-GCM offers opportunity for processing of multiple AES blocks in
@@ -106,4 +107,113 @@ fd_aes_gcm_aead_decrypt( fd_aes_gcm_t * aes_gcm,
 
 FD_PROTOTYPES_END
 
+/* AES-128-GCM batch API **********************************************/
+
+/* fd_aes_128_gcm_aead_{encrypt,decrypt}_batch process a batch of up to
+   FD_AES_GCM_BATCH_MAX independent AES-128-GCM messages (e.g. the
+   packets of an aio batch).  Each message has its own key and iv, so
+   messages of different connections can be mixed freely.
+
+   With FD_AES_GCM_BATCH_IMPL==1 (AVX-512 targets with VAES and
+   VPCLMULQDQ), each 128-bit lane of a zmm register holds the state of
+   one message (counter block, round keys, GHASH accumulator and hash
+   key) and all messages are advanced one block at a time, with up to
+   four zmm registers in flight to hide the AES and CLMUL latencies.
+   This makes short messages (where the sequential GHASH chain and the
+   per-message key setup dominate) much cheaper than processing them
+   one at a time.  Messages advance in lock step, so it helps
+   performance to batch messages of similar size together.  Otherwise,
+   falls back to processing the messages one at a time with the single
+   message API (AES-NI accelerated where available). */
+
+#ifndef FD_AES_GCM_BATCH_IMPL
+#if FD_HAS_AVX512 && defined(__VAES__) && defined(__VPCLMULQDQ__)
+#define FD_AES_GCM_BATCH_IMPL 1
+#else
+#define FD_AES_GCM_BATCH_IMPL 0
+#endif
+#endif
+
+#define FD_AES_GCM_BATCH_MAX (16UL)
+
+/* fd_aes_gcm_msg_t describes one message of a batch.  key points to the
+   16 byte AES-128 key and iv to the 12 byte initialization vector.  in
+   points to the sz byte input (plaintext for encrypt, ciphertext for
+   decrypt) and out to the sz byte output.  in and out may be equal
+   (in-place operation) but should not otherwise overlap.  aad points to
+   the aad_sz byte associated data.  tag points to the 16 byte auth tag
+   (written by encrypt, read by decrypt).  There are no alignment
+   requirements. */
+
+struct fd_aes_gcm_msg {
+  uchar const * key;
+  uchar const * iv;
+  uchar const * in;
+  uchar *       out;
+  ulong         sz;
+  uchar const * aad;
+  ulong         aad_sz;
+  uchar *       tag;
+};
+
+typedef struct fd_aes_gcm_msg fd_aes_gcm_msg_t;
+
+FD_PROTOTYPES_BEGIN
+
+/* fd_aes_128_gcm_aead_encrypt_batch encrypts the batch_cnt messages
+   pointed to by msg (batch_cnt in [0,FD_AES_GCM_BATCH_MAX]).  Equivalent
+   to calling fd_aes_128_gcm_init and fd_aes_gcm_aead_encrypt for each
+   message.  Cannot fail. */
+
+void
+fd_aes_128_gcm_aead_encrypt_batch( fd_aes_gcm_msg_t const * msg,
+                                   ulong                    batch_cnt );
+
+/* fd_aes_128_gcm_aead_decrypt_batch decrypts the batch_cnt messages
+   pointed to by msg (batch_cnt in [0,FD_AES_GCM_BATCH_MAX]).  Returns a
+   bit mask with bit i set if message i passed authentication and clear
+   if not (in which case the contents of its output are undefined, as
+   with fd_aes_gcm_aead_decrypt).  The tags are compared in constant
+   time. */
+
+ulong
+fd_aes_128_gcm_aead_decrypt_batch( fd_aes_gcm_msg_t const * msg,
+                                   ulong                    batch_cnt );
+
+/* fd_aes_128_ecb_encrypt_batch encrypts batch_cnt independent 16 byte
+   blocks with AES-128 in ECB mode (e.g. the samples used to compute the
+   QUIC header protection masks of a batch of packets).  Block i is read
+   from in[i], encrypted with the 16 byte key pointed to by key[i] and
+   written to out[i] (in[i] and out[i] may be equal).  batch_cnt is in
+   [0,FD_AES_GCM_BATCH_MAX].  The key schedules are expanded on the fly
+   (four at a time per zmm register with FD_AES_GCM_BATCH_IMPL==1). */
+
+void
+fd_aes_128_ecb_encrypt_batch( uchar const * const * key,
+                              uchar const * const * in,
+                              uchar * const *       out,
+                              ulong                 batch_cnt );
+
+#if FD_AES_GCM_BATCH_IMPL==1
+
+/* Internal use only */
+
+void
+fd_aes_128_gcm_private_encrypt_batch_avx512( fd_aes_gcm_msg_t const * msg,
+                                             ulong                    batch_cnt );
+
+ulong
+fd_aes_128_gcm_private_decrypt_batch_avx512( fd_aes_gcm_msg_t const * msg,
+                                             ulong                    batch_cnt );
+
+void
+fd_aes_128_private_ecb_encrypt_batch_avx512( uchar const * const * key,
+                                             uchar const * const * in,
+                                             uchar * const *       out,
+                                             ulong                 batch_cnt );
+
+#endif
+
+FD_PROTOTYPES_END
+
 #endif /* HEADER_fd_src_ballet_aes_fd_aes_gcm_h */
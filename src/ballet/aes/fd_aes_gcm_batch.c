@@ -0,0 +1,48 @@
+#include "fd_aes_gcm.h"
+
+void
+fd_aes_128_gcm_aead_encrypt_batch( fd_aes_gcm_msg_t const * msg,
+                                   ulong                    batch_cnt ) {
+# if FD_AES_GCM_BATCH_IMPL==1
+  if( FD_LIKELY( batch_cnt ) ) fd_aes_128_gcm_private_encrypt_batch_avx512( msg, batch_cnt );
+# else
+  for( ulong i=0UL; i<batch_cnt; i++ ) {
+    fd_aes_gcm_t gcm[1];
+    fd_aes_128_gcm_init( gcm, msg[i].key, msg[i].iv );
+    fd_aes_gcm_aead_encrypt( gcm, msg[i].out, msg[i].in, msg[i].sz, msg[i].aad, msg[i].aad_sz, msg[i].tag );
+  }
+# endif
+}
+
+ulong
+fd_aes_128_gcm_aead_decrypt_batch( fd_aes_gcm_msg_t const * msg,
+                                   ulong                    batch_cnt ) {
+# if FD_AES_GCM_BATCH_IMPL==1
+  if( FD_UNLIKELY( !batch_cnt ) ) return 0UL;
+  return fd_aes_128_gcm_private_decrypt_batch_avx512( msg, batch_cnt );
+# else
+  ulong ok = 0UL;
+  for( ulong i=0UL; i<batch_cnt; i++ ) {
+    fd_aes_gcm_t gcm[1];
+    fd_aes_128_gcm_init( gcm, msg[i].key, msg[i].iv );
+    ok |= (ulong)fd_aes_gcm_aead_decrypt( gcm, msg[i].in, msg[i].out, msg[i].sz, msg[i].aad, msg[i].aad_sz, msg[i].tag ) << i;
+  }
+  return ok;
+# endif
+}
+
+void
+fd_aes_128_ecb_encrypt_batch( uchar const * const * key,
+                              uchar const * const * in,
+                              uchar * const *       out,
+                              ulong                 batch_cnt ) {
+# if FD_AES_GCM_BATCH_IMPL==1
+  if( FD_LIKELY( batch_cnt ) ) fd_aes_128_private_ecb_encrypt_batch_avx512( key, in, out, batch_cnt );
+# else
+  for( ulong i=0UL; i<batch_cnt; i++ ) {
+    fd_aes_key_t ks[1];
+    fd_aes_set_encrypt_key( key[i], 128UL, ks );
+    fd_aes_encrypt( in[i], out[i], ks );
+  }
+# endif
+}
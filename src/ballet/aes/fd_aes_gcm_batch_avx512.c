@@ -0,0 +1,319 @@
+#include "fd_aes_gcm.h"
+
+#if FD_AES_GCM_BATCH_IMPL==1
+
+#include <x86intrin.h>
+
+/* Each 128-bit lane of a zmm register holds the state of one message.
+   A batch of up to FD_AES_GCM_BATCH_MAX messages is processed with up
+   to VEC_MAX zmm registers of LANE_CNT lanes each.  Lanes not used by
+   the batch are given an all zero key and empty input and their
+   results are discarded. */
+
+#define LANE_CNT (4UL)
+#define VEC_MAX  (FD_AES_GCM_BATCH_MAX/LANE_CNT)
+#define RK_CNT   (11UL) /* AES-128 round key count */
+
+FD_STATIC_ASSERT( FD_AES_GCM_BATCH_MAX==16UL, compat );
+
+#define ALWAYS_INLINE __attribute__((always_inline)) static inline
+
+static uchar const zero_blk[ 16 ] __attribute__((aligned(16)));
+
+/* bswap128 reverses the bytes of each lane (GHASH operates on the byte
+   reflected blocks).  ctr_swap reverses the bytes of the last dword of
+   each lane (counter blocks are kept with a little endian counter in
+   the last dword to make incrementing them a single add). */
+
+#define BSWAP128 _mm512_set4_epi32( 0x00010203, 0x04050607, 0x08090a0b, 0x0c0d0e0f )
+#define CTR_SWAP _mm512_set4_epi32( 0x0c0d0e0f, 0x0b0a0908, 0x07060504, 0x03020100 )
+#define CTR_INC  _mm512_set4_epi32( 1, 0, 0, 0 )
+
+ALWAYS_INLINE __m512i
+zmm_from_lanes( __m128i a,
+                __m128i b,
+                __m128i c,
+                __m128i d ) {
+  __m512i x = _mm512_castsi128_si512( a );
+  x = _mm512_inserti32x4( x, b, 1 );
+  x = _mm512_inserti32x4( x, c, 2 );
+  return _mm512_inserti32x4( x, d, 3 );
+}
+
+/* lane_mask returns the byte mask of the part of the 16 byte block at
+   offset off of a sz byte message that is in the message. */
+
+ALWAYS_INLINE __mmask16
+lane_mask( ulong sz,
+           ulong off ) {
+  ulong n = sz>off ? fd_ulong_min( sz-off, 16UL ) : 0UL;
+  return (__mmask16)( (1UL<<n)-1UL );
+}
+
+/* lane_load loads the block at offset off of the sz byte message at
+   p of each lane, zero padded.  Returns the blocks and the lane byte
+   masks in *m. */
+
+ALWAYS_INLINE __m512i
+lane_load( uchar const * const * p,
+           ulong const *         sz,
+           ulong                 off,
+           __mmask64 *           m ) {
+  __mmask16 m0 = lane_mask( sz[0], off ); __mmask16 m1 = lane_mask( sz[1], off );
+  __mmask16 m2 = lane_mask( sz[2], off ); __mmask16 m3 = lane_mask( sz[3], off );
+  *m = (__mmask64)m0 | ((__mmask64)m1<<16) | ((__mmask64)m2<<32) | ((__mmask64)m3<<48);
+  return zmm_from_lanes( _mm_maskz_loadu_epi8( m0, m0 ? p[0]+off : p[0] ),
+                         _mm_maskz_loadu_epi8( m1, m1 ? p[1]+off : p[1] ),
+                         _mm_maskz_loadu_epi8( m2, m2 ? p[2]+off : p[2] ),
+                         _mm_maskz_loadu_epi8( m3, m3 ? p[3]+off : p[3] ) );
+}
+
+ALWAYS_INLINE void
+lane_store( uchar * const * p,
+            ulong           off,
+            __mmask64       m,
+            __m512i         x ) {
+  __mmask16 m0 = (__mmask16)m; __mmask16 m1 = (__mmask16)(m>>16);
+  __mmask16 m2 = (__mmask16)(m>>32); __mmask16 m3 = (__mmask16)(m>>48);
+  if( m0 ) _mm_mask_storeu_epi8( p[0]+off, m0, _mm512_castsi512_si128( x ) );
+  if( m1 ) _mm_mask_storeu_epi8( p[1]+off, m1, _mm512_extracti32x4_epi32( x, 1 ) );
+  if( m2 ) _mm_mask_storeu_epi8( p[2]+off, m2, _mm512_extracti32x4_epi32( x, 2 ) );
+  if( m3 ) _mm_mask_storeu_epi8( p[3]+off, m3, _mm512_extracti32x4_epi32( x, 3 ) );
+}
+
+/* load_blk loads the 16 byte block at p (zeros if p is NULL). */
+
+ALWAYS_INLINE __m128i
+load_blk( uchar const * p ) {
+  return _mm_loadu_si128( (__m128i const *)( p ? p : zero_blk ) );
+}
+
+/* lanes_mask returns the byte mask of the first n lanes. */
+
+ALWAYS_INLINE __mmask64
+lanes_mask( ulong n ) {
+  return (__mmask64)( n>=LANE_CNT ? ULONG_MAX : (1UL<<(16UL*n))-1UL );
+}
+
+/* qword_mask converts a lane byte mask to the corresponding qword
+   mask (a lane is active if any of its bytes is). */
+
+ALWAYS_INLINE __mmask8
+qword_mask( __mmask64 m ) {
+  uint k = 0U;
+  for( uint l=0U; l<4U; l++ ) k |= ( (uint)!!(ushort)(m>>(16U*l)) * 3U ) << (2U*l);
+  return (__mmask8)k;
+}
+
+/* aes128_expand expands the AES-128 key of each lane.  The SubWord /
+   RotWord / Rcon step of the key schedule is done with aesenclast on
+   a block whose columns are all RotWord(w3) (ShiftRows is then the
+   identity), as there is no 512-bit aeskeygenassist. */
+
+#define EXPAND( i, rcon ) do {                                                     \
+    __m512i t = _mm512_aesenclast_epi128( _mm512_shuffle_epi8( k, rot ),           \
+                                          _mm512_set1_epi32( (rcon) ) );           \
+    k = _mm512_xor_si512( k, _mm512_bslli_epi128( k, 4 ) );                        \
+    k = _mm512_ternarylogic_epi64( k, _mm512_bslli_epi128( k, 8 ), t, 0x96 );      \
+    rk[ (i) ] = k;                                                                 \
+  } while(0)
+
+ALWAYS_INLINE void
+aes128_expand( __m512i k,
+               __m512i rk[ RK_CNT ] ) {
+  __m512i const rot = _mm512_set1_epi32( 0x0c0f0e0d );
+  rk[0] = k;
+  EXPAND(  1, 0x01 ); EXPAND(  2, 0x02 ); EXPAND(  3, 0x04 ); EXPAND(  4, 0x08 ); EXPAND(  5, 0x10 );
+  EXPAND(  6, 0x20 ); EXPAND(  7, 0x40 ); EXPAND(  8, 0x80 ); EXPAND(  9, 0x1b ); EXPAND( 10, 0x36 );
+}
+
+#undef EXPAND
+
+ALWAYS_INLINE __m512i
+aes128_enc( __m512i         x,
+            __m512i const * rk ) {
+  x = _mm512_xor_si512( x, rk[0] );
+  for( ulong r=1UL; r<RK_CNT-1UL; r++ ) x = _mm512_aesenc_epi128( x, rk[r] );
+  return _mm512_aesenclast_epi128( x, rk[RK_CNT-1UL] );
+}
+
+/* gfmul multiplies the byte reflected GF(2^128) elements of each lane
+   (Intel's carry-less multiplication white paper, algorithm 5: 4
+   partial products, shift left by one, reduce). */
+
+ALWAYS_INLINE __m512i
+gfmul( __m512i a,
+       __m512i b ) {
+  __m512i lo  = _mm512_clmulepi64_epi128( a, b, 0x00 );
+  __m512i hi  = _mm512_clmulepi64_epi128( a, b, 0x11 );
+  __m512i mid = _mm512_xor_si512( _mm512_clmulepi64_epi128( a, b, 0x10 ),
+                                  _mm512_clmulepi64_epi128( a, b, 0x01 ) );
+  lo = _mm512_xor_si512( lo, _mm512_bslli_epi128( mid, 8 ) );
+  hi = _mm512_xor_si512( hi, _mm512_bsrli_epi128( mid, 8 ) );
+
+  /* <hi:lo> <<= 1 */
+  __m512i lo_c = _mm512_srli_epi32( lo, 31 );
+  __m512i hi_c = _mm512_srli_epi32( hi, 31 );
+  lo = _mm512_or_si512( _mm512_slli_epi32( lo, 1 ), _mm512_bslli_epi128( lo_c, 4 ) );
+  hi = _mm512_ternarylogic_epi64( _mm512_slli_epi32( hi, 1 ), _mm512_bslli_epi128( hi_c, 4 ),
+                                  _mm512_bsrli_epi128( lo_c, 12 ), 0xfe );
+
+  /* reduce modulo x^128 + x^7 + x^2 + x + 1 */
+  __m512i t  = _mm512_ternarylogic_epi64( _mm512_slli_epi32( lo, 31 ), _mm512_slli_epi32( lo, 30 ),
+                                          _mm512_slli_epi32( lo, 25 ), 0x96 );
+  __m512i t8 = _mm512_bsrli_epi128( t, 4 );
+  lo = _mm512_xor_si512( lo, _mm512_bslli_epi128( t, 12 ) );
+  __m512i u  = _mm512_ternarylogic_epi64( _mm512_srli_epi32( lo, 1 ), _mm512_srli_epi32( lo, 2 ),
+                                          _mm512_srli_epi32( lo, 7 ), 0x96 );
+  return _mm512_ternarylogic_epi64( hi, lo, _mm512_xor_si512( u, t8 ), 0x96 );
+}
+
+/* gcm_batch processes the cnt messages at msg (cnt in [1,4*vec_cnt])
+   using vec_cnt zmm registers.  vec_cnt is a compile time constant at
+   each call site so the loops over the registers unroll and the
+   independent AES and GHASH chains of the registers interleave.
+   Returns the mask of messages that passed authentication (decrypt). */
+
+ALWAYS_INLINE ulong
+gcm_batch( fd_aes_gcm_msg_t const * msg,
+           ulong                    cnt,
+           ulong                    vec_cnt,
+           int                      decrypt ) {
+
+  uchar const * key   [ FD_AES_GCM_BATCH_MAX ];
+  uchar const * iv    [ FD_AES_GCM_BATCH_MAX ];
+  uchar const * in    [ FD_AES_GCM_BATCH_MAX ];
+  uchar *       out   [ FD_AES_GCM_BATCH_MAX ];
+  ulong         sz    [ FD_AES_GCM_BATCH_MAX ];
+  uchar const * aad   [ FD_AES_GCM_BATCH_MAX ];
+  ulong         aad_sz[ FD_AES_GCM_BATCH_MAX ];
+  uchar *       tag   [ FD_AES_GCM_BATCH_MAX ];
+
+  ulong sz_max     = 0UL;
+  ulong aad_sz_max = 0UL;
+  for( ulong i=0UL; i<vec_cnt*LANE_CNT; i++ ) {
+    if( i<cnt ) {
+      key[i] = msg[i].key; iv [i] = msg[i].iv;  in    [i] = msg[i].in;     out[i] = msg[i].out;
+      sz [i] = msg[i].sz;  aad[i] = msg[i].aad; aad_sz[i] = msg[i].aad_sz; tag[i] = msg[i].tag;
+    } else {
+      key[i] = zero_blk;   iv [i] = zero_blk;   in    [i] = zero_blk;      out[i] = NULL;
+      sz [i] = 0UL;        aad[i] = zero_blk;   aad_sz[i] = 0UL;           tag[i] = NULL;
+    }
+    sz_max     = fd_ulong_max( sz_max,     sz    [i] );
+    aad_sz_max = fd_ulong_max( aad_sz_max, aad_sz[i] );
+  }
+
+  __m512i rk [ VEC_MAX ][ RK_CNT ];
+  __m512i ctr[ VEC_MAX ]; /* next counter block (little endian counter) */
+  __m512i h  [ VEC_MAX ]; /* hash key (byte reflected) */
+  __m512i ek0[ VEC_MAX ]; /* encrypted initial counter block */
+  __m512i x  [ VEC_MAX ]; /* GHASH accumulator (byte reflected) */
+
+  for( ulong v=0UL; v<vec_cnt; v++ ) {
+    ulong l = v*LANE_CNT;
+    aes128_expand( zmm_from_lanes( _mm_loadu_si128( (__m128i const *)key[l  ] ), _mm_loadu_si128( (__m128i const *)key[l+1] ),
+                                   _mm_loadu_si128( (__m128i const *)key[l+2] ), _mm_loadu_si128( (__m128i const *)key[l+3] ) ),
+                   rk[v] );
+    __m512i j0 = zmm_from_lanes( _mm_maskz_loadu_epi8( 0x0fff, iv[l  ] ), _mm_maskz_loadu_epi8( 0x0fff, iv[l+1] ),
+                                 _mm_maskz_loadu_epi8( 0x0fff, iv[l+2] ), _mm_maskz_loadu_epi8( 0x0fff, iv[l+3] ) );
+    j0     = _mm512_add_epi32( j0, CTR_INC );
+    ek0[v] = aes128_enc( _mm512_shuffle_epi8( j0, CTR_SWAP ), rk[v] );
+    h  [v] = _mm512_shuffle_epi8( aes128_enc( _mm512_setzero_si512(), rk[v] ), BSWAP128 );
+    ctr[v] = _mm512_add_epi32( j0, CTR_INC );
+    x  [v] = _mm512_setzero_si512();
+  }
+
+  /* GHASH the associated data */
+
+  for( ulong off=0UL; off<aad_sz_max; off+=16UL ) {
+    for( ulong v=0UL; v<vec_cnt; v++ ) {
+      __mmask64 m;
+      __m512i   a = lane_load( aad+v*LANE_CNT, aad_sz+v*LANE_CNT, off, &m );
+      x[v] = _mm512_mask_mov_epi64( x[v], qword_mask( m ),
+                                    gfmul( _mm512_xor_si512( x[v], _mm512_shuffle_epi8( a, BSWAP128 ) ), h[v] ) );
+    }
+  }
+
+  /* CTR encrypt/decrypt and GHASH the ciphertext */
+
+  for( ulong off=0UL; off<sz_max; off+=16UL ) {
+    for( ulong v=0UL; v<vec_cnt; v++ ) {
+      __m512i ks = aes128_enc( _mm512_shuffle_epi8( ctr[v], CTR_SWAP ), rk[v] );
+      ctr[v] = _mm512_add_epi32( ctr[v], CTR_INC );
+
+      __mmask64 m;
+      __m512i   d = lane_load( in+v*LANE_CNT, sz+v*LANE_CNT, off, &m );
+      __m512i   o = _mm512_xor_si512( d, ks );
+      lane_store( out+v*LANE_CNT, off, m, o );
+
+      __m512i c = decrypt ? d : _mm512_maskz_mov_epi8( m, o );
+      x[v] = _mm512_mask_mov_epi64( x[v], qword_mask( m ),
+                                    gfmul( _mm512_xor_si512( x[v], _mm512_shuffle_epi8( c, BSWAP128 ) ), h[v] ) );
+    }
+  }
+
+  /* GHASH the lengths and compute the tags */
+
+  ulong ok = 0UL;
+  for( ulong v=0UL; v<vec_cnt; v++ ) {
+    ulong l = v*LANE_CNT;
+    __m512i len = zmm_from_lanes( _mm_set_epi64x( (long)(aad_sz[l  ]<<3), (long)(sz[l  ]<<3) ),
+                                  _mm_set_epi64x( (long)(aad_sz[l+1]<<3), (long)(sz[l+1]<<3) ),
+                                  _mm_set_epi64x( (long)(aad_sz[l+2]<<3), (long)(sz[l+2]<<3) ),
+                                  _mm_set_epi64x( (long)(aad_sz[l+3]<<3), (long)(sz[l+3]<<3) ) );
+    x[v] = gfmul( _mm512_xor_si512( x[v], len ), h[v] );
+    __m512i t = _mm512_xor_si512( _mm512_shuffle_epi8( x[v], BSWAP128 ), ek0[v] );
+
+    if( decrypt ) {
+      __m512i expected = zmm_from_lanes( load_blk( tag[l  ] ), load_blk( tag[l+1] ),
+                                         load_blk( tag[l+2] ), load_blk( tag[l+3] ) );
+      __m512i diff = _mm512_xor_si512( t, expected );
+      uint bad = (uint)_mm512_test_epi64_mask( diff, diff );
+      bad |= bad>>1;
+      for( ulong j=0UL; j<LANE_CNT; j++ ) ok |= (ulong)( ~(bad>>(2UL*j)) & 1U ) << (l+j);
+    } else {
+      lane_store( tag+l, 0UL, lanes_mask( fd_ulong_min( cnt-fd_ulong_min( cnt, l ), LANE_CNT ) ), t );
+    }
+  }
+
+  return ok & ( (1UL<<cnt)-1UL );
+}
+
+#undef ALWAYS_INLINE
+
+void
+fd_aes_128_gcm_private_encrypt_batch_avx512( fd_aes_gcm_msg_t const * msg,
+                                             ulong                    batch_cnt ) {
+  if(      batch_cnt<=4UL ) gcm_batch( msg, batch_cnt, 1UL, 0 );
+  else if( batch_cnt<=8UL ) gcm_batch( msg, batch_cnt, 2UL, 0 );
+  else                      gcm_batch( msg, batch_cnt, 4UL, 0 );
+}
+
+ulong
+fd_aes_128_gcm_private_decrypt_batch_avx512( fd_aes_gcm_msg_t const * msg,
+                                             ulong                    batch_cnt ) {
+  if(      batch_cnt<=4UL ) return gcm_batch( msg, batch_cnt, 1UL, 1 );
+  else if( batch_cnt<=8UL ) return gcm_batch( msg, batch_cnt, 2UL, 1 );
+  else                      return gcm_batch( msg, batch_cnt, 4UL, 1 );
+}
+
+void
+fd_aes_128_private_ecb_encrypt_batch_avx512( uchar const * const * key,
+                                             uchar const * const * in,
+                                             uchar * const *       out,
+                                             ulong                 batch_cnt ) {
+  for( ulong i=0UL; i<batch_cnt; i+=LANE_CNT ) {
+    ulong n = fd_ulong_min( batch_cnt-i, LANE_CNT );
+    __m128i k[ LANE_CNT ]; __m128i b[ LANE_CNT ];
+    for( ulong j=0UL; j<LANE_CNT; j++ ) {
+      k[j] = j<n ? _mm_loadu_si128( (__m128i const *)key[i+j] ) : _mm_setzero_si128();
+      b[j] = j<n ? _mm_loadu_si128( (__m128i const *)in [i+j] ) : _mm_setzero_si128();
+    }
+    __m512i rk[ RK_CNT ];
+    aes128_expand( zmm_from_lanes( k[0], k[1], k[2], k[3] ), rk );
+    __m512i c = aes128_enc( zmm_from_lanes( b[0], b[1], b[2], b[3] ), rk );
+    lane_store( out+i, 0UL, lanes_mask( n ), c );
+  }
+}
+
+#endif /* FD_AES_GCM_BATCH_IMPL==1 */
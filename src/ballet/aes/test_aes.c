@@ -483,6 +483,222 @@ test_aes_128_gcm_unroll( void ) {
   }
 }
 
+/* AES-128-GCM batch tests ********************************************/
+
+#define MSG_SZ_MAX (1300UL)
+
+static uchar batch_key[ FD_AES_GCM_BATCH_MAX ][ 16 ];
+static uchar batch_iv [ FD_AES_GCM_BATCH_MAX ][ 12 ];
+static uchar batch_aad[ FD_AES_GCM_BATCH_MAX ][ 64 ];
+static uchar batch_pt [ FD_AES_GCM_BATCH_MAX ][ MSG_SZ_MAX ];
+static uchar batch_ct [ FD_AES_GCM_BATCH_MAX ][ MSG_SZ_MAX ];
+static uchar batch_out[ FD_AES_GCM_BATCH_MAX ][ MSG_SZ_MAX ];
+static uchar batch_tag[ FD_AES_GCM_BATCH_MAX ][ 16 ];
+
+static void
+fill_rand( fd_rng_t * rng,
+           uchar *    p,
+           ulong      sz ) {
+  for( ulong i=0UL; i<sz; i++ ) p[ i ] = fd_rng_uchar( rng );
+}
+
+static void
+test_aes_128_gcm_batch( fd_rng_t * rng ) {
+
+  for( ulong iter=0UL; iter<4096UL; iter++ ) {
+
+    ulong            cnt = fd_rng_ulong_roll( rng, FD_AES_GCM_BATCH_MAX+1UL );
+    fd_aes_gcm_msg_t msg[ FD_AES_GCM_BATCH_MAX ];
+    uchar            ref_ct [ FD_AES_GCM_BATCH_MAX ][ MSG_SZ_MAX ];
+    uchar            ref_tag[ FD_AES_GCM_BATCH_MAX ][ 16 ];
+
+    /* Mix short messages (most of a QUIC packet rx batch) with full
+       size ones and empty ones */
+
+    for( ulong i=0UL; i<cnt; i++ ) {
+      ulong sz;
+      switch( fd_rng_uint_roll( rng, 4U ) ) {
+      case 0:  sz = 0UL;                                     break;
+      case 1:  sz = fd_rng_ulong_roll( rng, 64UL );          break;
+      default: sz = fd_rng_ulong_roll( rng, MSG_SZ_MAX+1UL ); break;
+      }
+      ulong aad_sz = fd_rng_ulong_roll( rng, 65UL );
+      fill_rand( rng, batch_key[i], 16UL   );
+      fill_rand( rng, batch_iv [i], 12UL   );
+      fill_rand( rng, batch_aad[i], aad_sz );
+      fill_rand( rng, batch_pt [i], sz     );
+      msg[i] = (fd_aes_gcm_msg_t) {
+        .key = batch_key[i], .iv  = batch_iv [i],
+        .in  = batch_pt [i], .out = batch_ct [i], .sz  = sz,
+        .aad = batch_aad[i], .aad_sz = aad_sz,
+        .tag = batch_tag[i]
+      };
+
+      fd_aes_gcm_t gcm[1];
+      fd_aes_128_gcm_init( gcm, batch_key[i], batch_iv[i] );
+      fd_aes_gcm_aead_encrypt( gcm, ref_ct[i], batch_pt[i], sz, batch_aad[i], aad_sz, ref_tag[i] );
+    }
+
+    /* Encrypt matches the single message API */
+
+    fd_aes_128_gcm_aead_encrypt_batch( msg, cnt );
+    for( ulong i=0UL; i<cnt; i++ ) {
+      FD_TEST( 0==memcmp( batch_ct [i], ref_ct [i], msg[i].sz ) );
+      FD_TEST( 0==memcmp( batch_tag[i], ref_tag[i], 16UL      ) );
+    }
+
+    /* Decrypt in place round trips */
+
+    for( ulong i=0UL; i<cnt; i++ ) {
+      fd_memcpy( batch_out[i], batch_ct[i], msg[i].sz );
+      msg[i].in  = batch_out[i];
+      msg[i].out = batch_out[i];
+    }
+    FD_TEST( fd_aes_128_gcm_aead_decrypt_batch( msg, cnt )==fd_ulong_mask_lsb( (int)cnt ) );
+    for( ulong i=0UL; i<cnt; i++ ) FD_TEST( 0==memcmp( batch_out[i], batch_pt[i], msg[i].sz ) );
+
+    /* Corrupt the tag, ciphertext or associated data of some messages */
+
+    ulong expected = 0UL;
+    for( ulong i=0UL; i<cnt; i++ ) {
+      msg[i].in  = batch_ct [i];
+      msg[i].out = batch_out[i];
+      uint r = fd_rng_uint_roll( rng, 4U );
+      if(      r==1U                  ) batch_tag[i][ fd_rng_ulong_roll( rng, 16UL ) ] ^= (uchar)( 1U<<fd_rng_uint_roll( rng, 8U ) );
+      else if( r==2U && msg[i].sz     ) batch_ct [i][ fd_rng_ulong_roll( rng, msg[i].sz ) ] ^= (uchar)( 1U<<fd_rng_uint_roll( rng, 8U ) );
+      else if( r==3U && msg[i].aad_sz ) batch_aad[i][ fd_rng_ulong_roll( rng, msg[i].aad_sz ) ] ^= (uchar)( 1U<<fd_rng_uint_roll( rng, 8U ) );
+      else expected |= 1UL<<i;
+    }
+    FD_TEST( fd_aes_128_gcm_aead_decrypt_batch( msg, cnt )==expected );
+  }
+
+  FD_LOG_NOTICE(( "OK: AES-128-GCM batch (impl %d)", FD_AES_GCM_BATCH_IMPL ));
+}
+
+static void
+test_aes_128_ecb_batch( fd_rng_t * rng ) {
+  for( ulong iter=0UL; iter<4096UL; iter++ ) {
+    ulong         cnt = fd_rng_ulong_roll( rng, FD_AES_GCM_BATCH_MAX+1UL );
+    uchar const * key[ FD_AES_GCM_BATCH_MAX ];
+    uchar const * in [ FD_AES_GCM_BATCH_MAX ];
+    uchar *       out[ FD_AES_GCM_BATCH_MAX ];
+    for( ulong i=0UL; i<cnt; i++ ) {
+      fill_rand( rng, batch_key[i], 16UL );
+      fill_rand( rng, batch_pt [i], 16UL );
+      key[i] = batch_key[i]; in[i] = batch_pt[i]; out[i] = batch_out[i];
+    }
+    fd_aes_128_ecb_encrypt_batch( key, in, out, cnt );
+    for( ulong i=0UL; i<cnt; i++ ) {
+      fd_aes_key_t ks[1];
+      uchar        ref[ 16 ];
+      fd_aes_set_encrypt_key( key[i], 128UL, ks );
+      fd_aes_encrypt( in[i], ref, ks );
+      FD_TEST( 0==memcmp( out[i], ref, 16UL ) );
+    }
+  }
+
+  FD_LOG_NOTICE(( "OK: AES-128-ECB batch (impl %d)", FD_AES_GCM_BATCH_IMPL ));
+}
+
+/* Benchmarks a rx batch of FD_AES_GCM_BATCH_MAX packets of sz bytes
+   (short header sized associated data) decrypted one packet at a time
+   (as fd_quic_crypto_decrypt does) and with the batch API. */
+
+static void
+bench_aes_128_gcm_decrypt( fd_rng_t * rng,
+                           ulong      sz ) {
+  ulong const cnt    = FD_AES_GCM_BATCH_MAX;
+  ulong const aad_sz = 20UL;
+  fd_aes_gcm_msg_t msg[ FD_AES_GCM_BATCH_MAX ];
+  for( ulong i=0UL; i<cnt; i++ ) {
+    fill_rand( rng, batch_key[i], 16UL );
+    fill_rand( rng, batch_iv [i], 12UL );
+    fill_rand( rng, batch_aad[i], aad_sz );
+    fill_rand( rng, batch_pt [i], sz );
+    msg[i] = (fd_aes_gcm_msg_t) {
+      .key = batch_key[i], .iv  = batch_iv [i],
+      .in  = batch_pt [i], .out = batch_ct [i], .sz  = sz,
+      .aad = batch_aad[i], .aad_sz = aad_sz,
+      .tag = batch_tag[i]
+    };
+  }
+  fd_aes_128_gcm_aead_encrypt_batch( msg, cnt );
+  for( ulong i=0UL; i<cnt; i++ ) { msg[i].in = batch_ct[i]; msg[i].out = batch_out[i]; }
+
+  ulong iter_cnt = fd_ulong_max( (1UL<<24) / (cnt*sz), 16UL );
+
+  ulong ok = ULONG_MAX;
+  long  dt = -fd_log_wallclock();
+  for( ulong iter=0UL; iter<iter_cnt; iter++ ) {
+    for( ulong i=0UL; i<cnt; i++ ) {
+      fd_aes_gcm_t gcm[1];
+      fd_aes_128_gcm_init( gcm, batch_key[i], batch_iv[i] );
+      ok &= (ulong)fd_aes_gcm_aead_decrypt( gcm, batch_ct[i], batch_out[i], sz, batch_aad[i], aad_sz, batch_tag[i] );
+    }
+  }
+  dt += fd_log_wallclock();
+  FD_TEST( ok==1UL );
+  double single_ns = (double)dt / (double)(iter_cnt*cnt);
+
+  ok = ULONG_MAX;
+  dt = -fd_log_wallclock();
+  for( ulong iter=0UL; iter<iter_cnt; iter++ ) ok &= fd_aes_128_gcm_aead_decrypt_batch( msg, cnt );
+  dt += fd_log_wallclock();
+  FD_TEST( ok==fd_ulong_mask_lsb( (int)cnt ) );
+  double batch_ns = (double)dt / (double)(iter_cnt*cnt);
+
+  /* batches of one, as used by fd_quic_crypto_decrypt */
+
+  ok = ULONG_MAX;
+  dt = -fd_log_wallclock();
+  for( ulong iter=0UL; iter<iter_cnt; iter++ ) {
+    for( ulong i=0UL; i<cnt; i++ ) ok &= fd_aes_128_gcm_aead_decrypt_batch( msg+i, 1UL );
+  }
+  dt += fd_log_wallclock();
+  FD_TEST( ok==1UL );
+  double one_ns = (double)dt / (double)(iter_cnt*cnt);
+
+  FD_LOG_NOTICE(( "AES-128-GCM decrypt %4lu B pkts: single %7.1f ns/pkt (%6.2f Gbps), batch of 1 %7.1f ns/pkt (%6.2f Gbps), batch of %lu %7.1f ns/pkt (%6.2f Gbps)",
+                  sz, single_ns, (double)(8UL*sz)/single_ns, one_ns, (double)(8UL*sz)/one_ns, cnt, batch_ns, (double)(8UL*sz)/batch_ns ));
+}
+
+static void
+bench_aes_128_ecb_hp( fd_rng_t * rng ) {
+  ulong const   cnt = FD_AES_GCM_BATCH_MAX;
+  uchar const * key[ FD_AES_GCM_BATCH_MAX ];
+  uchar const * in [ FD_AES_GCM_BATCH_MAX ];
+  uchar *       out[ FD_AES_GCM_BATCH_MAX ];
+  for( ulong i=0UL; i<cnt; i++ ) {
+    fill_rand( rng, batch_key[i], 16UL );
+    fill_rand( rng, batch_pt [i], 16UL );
+    key[i] = batch_key[i]; in[i] = batch_pt[i]; out[i] = batch_out[i];
+  }
+
+  ulong iter_cnt = 1UL<<14;
+
+  long dt = -fd_log_wallclock();
+  for( ulong iter=0UL; iter<iter_cnt; iter++ ) {
+    for( ulong i=0UL; i<cnt; i++ ) {
+      fd_aes_key_t ks[1];
+      fd_aes_set_encrypt_key( key[i], 128UL, ks );
+      fd_aes_encrypt( in[i], out[i], ks );
+    }
+    FD_COMPILER_MFENCE();
+  }
+  dt += fd_log_wallclock();
+  double single_ns = (double)dt / (double)(iter_cnt*cnt);
+
+  dt = -fd_log_wallclock();
+  for( ulong iter=0UL; iter<iter_cnt; iter++ ) {
+    fd_aes_128_ecb_encrypt_batch( key, in, out, cnt );
+    FD_COMPILER_MFENCE();
+  }
+  dt += fd_log_wallclock();
+  double batch_ns = (double)dt / (double)(iter_cnt*cnt);
+
+  FD_LOG_NOTICE(( "AES-128-ECB header protection mask: single %.1f ns/pkt, batch %.1f ns/pkt", single_ns, batch_ns ));
+}
+
 /* Main ***************************************************************/
 
 int
@@ -498,6 +714,17 @@ main( int     argc,
   //test_aes_128_gcm();
   test_aes_128_gcm_unroll();
 
+  fd_rng_t _rng[1]; fd_rng_t * rng = fd_rng_join( fd_rng_new( _rng, 0U, 0UL ) );
+
+  test_aes_128_gcm_batch( rng );
+  test_aes_128_ecb_batch( rng );
+
+  static ulong const bench_sz[] = { 64UL, 128UL, 256UL, 512UL, 1024UL, 1232UL };
+  for( ulong i=0UL; i<sizeof(bench_sz)/sizeof(ulong); i++ ) bench_aes_128_gcm_decrypt( rng, bench_sz[i] );
+  bench_aes_128_ecb_hp( rng );
+
+  fd_rng_delete( fd_rng_leave( rng ) );
+
   FD_LOG_NOTICE(( "pass" ));
   fd_halt();
   return 0;
@@ -4,6 +4,15 @@
 #include "fd_base58_avx.h"
 #endif
 
+/* The batch conversions need IFMA (FD_HAS_AVX512) and VBMI */
+
+#if FD_HAS_AVX512 && defined(__AVX512VBMI__)
+#define BASE58_BATCH_AVX512 1
+#include "fd_base58_avx512.h"
+#else
+#define BASE58_BATCH_AVX512 0
+#endif
+
 /* base58_chars maps [0, 58) to the base58 character.  In the AVX case,
    this lookup table is contained implicitly in raw_to_base58 */
 
@@ -57,6 +57,51 @@ char * fd_base58_encode_64( uchar const * bytes, ulong * opt_len, char * out );
 uchar * fd_base58_decode_32( char const * encoded, uchar * out );
 uchar * fd_base58_decode_64( char const * encoded, uchar * out );
 
+/* fd_base58_{encode,decode}_{32,64}_batch convert cnt independent
+   values at once.  They are equivalent to calling the corresponding
+   single value conversion for each i in [0,cnt):
+
+     fd_base58_encode_32( bytes[i], opt_len ? opt_len+i : NULL, out[i] )
+     fd_base58_decode_32( encoded[i], out[i] )
+
+   opt_len, if non-NULL, points to an array of cnt ulongs.  decode
+   returns the number of strings successfully decoded.  opt_ok, if
+   non-NULL, points to an array of cnt uchars and opt_ok[i] is set to 1
+   if encoded[i] was decoded successfully and 0 if not (in which case
+   the contents of out[i] are undefined).
+
+   These are meant for tools that print or parse a lot of account
+   addresses and signatures (ledger and capture dumps, RPC).  On targets
+   with AVX-512 IFMA and VBMI, 8 values are converted at a time, one per
+   64-bit lane.  For full batches on Ice Lake, this is ~2x the
+   throughput of the single value AVX2 conversions for encode and ~2.5x
+   (32 bytes) to ~3.5x (64 bytes) for decode.  Otherwise, these loop
+   over the single value conversions. */
+
+void
+fd_base58_encode_32_batch( uchar const * const * bytes,
+                           ulong *               opt_len,
+                           char * const *        out,
+                           ulong                 cnt );
+
+void
+fd_base58_encode_64_batch( uchar const * const * bytes,
+                           ulong *               opt_len,
+                           char * const *        out,
+                           ulong                 cnt );
+
+ulong
+fd_base58_decode_32_batch( char const * const * encoded,
+                           uchar * const *      out,
+                           uchar *              opt_ok,
+                           ulong                cnt );
+
+ulong
+fd_base58_decode_64_batch( char const * const * encoded,
+                           uchar * const *      out,
+                           uchar *              opt_ok,
+                           ulong                cnt );
+
 FD_PROTOTYPES_END
 
 #endif /* HEADER_fd_src_ballet_base58_fd_base58_h */
@@ -0,0 +1,146 @@
+#include "../../util/simd/fd_avx512.h"
+
+/* This is not a proper header and so should not be included from
+   anywhere besides fd_base58.c.  As such, it has no include guard.
+   Requires AVX-512 with IFMA and VBMI.
+
+   The batch conversions keep one value per 64-bit lane, so each wwv_t
+   holds the same limb (or digit) of 8 independent values.  This makes
+   all the steps of the conversion lane-wise (no cross lane shuffles),
+   which is what makes the batch faster than 8 calls to the AVX2
+   single value conversion. */
+
+/* divmod_58_5 computes q=floor(x/58^5) and r=x%58^5 for 8 arbitrary
+   ulongs x.  There is no vector 64-bit integer division, so we
+   estimate the quotient with a 52x52->104 bit IFMA multiply of the top
+   52 bits of x by floor(2^64/58^5) and then fix it up.  The estimate is
+   at most 2 too small (the truncation of x and the multiplier each
+   contribute less than 1), so two conditional corrections suffice. */
+
+static inline void
+divmod_58_5( wwv_t   x,
+             wwv_t * _q,
+             wwv_t * _r ) {
+  wwv_t R = wwv_bcast( 656356768UL   ); /* 58^5 */
+  wwv_t M = wwv_bcast( 28104751825UL ); /* floor(2^64/58^5) < 2^52 */
+
+  wwv_t q = wwv_madd52hi( wwv_zero(), wwv_shr( x, 12 ), M );
+  wwv_t r = wwv_sub( x, wwv_mul( q, R ) );
+
+  int c;
+  c = wwv_ge( r, R ); q = wwv_add_if( c, q, wwv_one(), q ); r = wwv_sub_if( c, r, R, r );
+  c = wwv_ge( r, R ); q = wwv_add_if( c, q, wwv_one(), q ); r = wwv_sub_if( c, r, R, r );
+
+  *_q = q;
+  *_r = r;
+}
+
+/* intermediate_to_raw_8 splits 8 terms in intermediate form (in
+   [0,58^5)) into 5 raw base58 digits each, most significant first:
+   raw[j] holds floor(x/58^(4-j)) % 58.  The divisions by 58 are done
+   with the same magic multiplication as the AVX2 version. */
+
+static inline void
+intermediate_to_raw_8( wwv_t   x,
+                       wwv_t * raw ) {
+  wwv_t cA  = wwv_bcast( 2369637129UL ); /* =2^37/58 */
+  wwv_t _58 = wwv_bcast( 58UL );
+
+# define DIV58(r) wwv_shr( wwv_mul_ll( (r), cA ), 37 )
+
+  wwv_t div1 = DIV58( x    );
+  wwv_t div2 = DIV58( div1 );
+  wwv_t div3 = DIV58( div2 );
+  wwv_t div4 = DIV58( div3 );
+
+# undef DIV58
+
+  raw[ 4 ] = wwv_sub( x,    wwv_mul_ll( div1, _58 ) );
+  raw[ 3 ] = wwv_sub( div1, wwv_mul_ll( div2, _58 ) );
+  raw[ 2 ] = wwv_sub( div2, wwv_mul_ll( div3, _58 ) );
+  raw[ 1 ] = wwv_sub( div3, wwv_mul_ll( div4, _58 ) );
+  raw[ 0 ] = div4; /* We know the values are less than 58 at this point */
+}
+
+/* load_be32x8 loads 8 big endian uints from p (no alignment
+   requirements) and returns them zero extended to ulongs. */
+
+static inline wwv_t
+load_be32x8( uchar const * p ) {
+  __m256i bswap = _mm256_set_epi8( 12,13,14,15, 8, 9,10,11, 4, 5, 6, 7, 0, 1, 2, 3,
+                                   12,13,14,15, 8, 9,10,11, 4, 5, 6, 7, 0, 1, 2, 3 );
+  return _mm512_cvtepu32_epi64( _mm256_shuffle_epi8( _mm256_loadu_si256( (__m256i const *)p ), bswap ) );
+}
+
+/* raw_to_base58_64 maps 64 raw digits in [0,58), one per byte, to their
+   base58 characters with a single VBMI byte permute. */
+
+static inline wwv_t
+raw_to_base58_64( wwv_t d ) {
+  __m512i lut = _mm512_set_epi8( 0,  0,  0,  0,  0,  0,'z','y','x','w','v','u','t','s','r','q',
+                                'p','o','n','m','k','j','i','h','g','f','e','d','c','b','a','Z',
+                                'Y','X','W','V','U','T','S','R','Q','P','N','M','L','K','J','H',
+                                'G','F','E','D','C','B','A','9','8','7','6','5','4','3','2','1' );
+  return _mm512_permutexvar_epi8( d, lut );
+}
+
+/* store_be32x8 stores the low 32 bits of each lane of v to p as 8 big
+   endian uints (no alignment requirements). */
+
+static inline void
+store_be32x8( uchar * p,
+              wwv_t   v ) {
+  __m256i bswap = _mm256_set_epi8( 12,13,14,15, 8, 9,10,11, 4, 5, 6, 7, 0, 1, 2, 3,
+                                   12,13,14,15, 8, 9,10,11, 4, 5, 6, 7, 0, 1, 2, 3 );
+  _mm256_storeu_si256( (__m256i *)p, _mm256_shuffle_epi8( _mm512_cvtepi64_epi32( v ), bswap ) );
+}
+
+/* base58_to_raw_64 maps 64 base58 characters, one per byte, to their
+   raw digits in [0,58).  *_bad gets a mask of the bytes that are not
+   base58 characters (their digits are garbage).  This is the inverse
+   of raw_to_base58_64: '1'+d minus the gaps below the character. */
+
+static inline __m512i
+base58_to_raw_64( __m512i     c,
+                  __mmask64 * _bad ) {
+# define GE(x) _mm512_cmpge_epu8_mask( c, _mm512_set1_epi8( (x) ) )
+# define LE(x) _mm512_cmple_epu8_mask( c, _mm512_set1_epi8( (x) ) )
+# define NE(x) _mm512_cmpneq_epu8_mask( c, _mm512_set1_epi8( (x) ) )
+  __mmask64 digit = GE('1') & LE('9');
+  __mmask64 upper = GE('A') & LE('Z') & NE('I') & NE('O');
+  __mmask64 lower = GE('a') & LE('z') & NE('l');
+  *_bad = ~( digit | upper | lower );
+
+  __m512i one = _mm512_set1_epi8( 1 );
+  __m512i d   = _mm512_sub_epi8( c, _mm512_set1_epi8( '1' ) );
+  d = _mm512_mask_sub_epi8( d, upper|lower, d, _mm512_set1_epi8( 7 ) ); /* 'A' -> ':' */
+  d = _mm512_mask_sub_epi8( d, GE('J'),     d, one                   ); /* skip 'I'   */
+  d = _mm512_mask_sub_epi8( d, GE('P'),     d, one                   ); /* skip 'O'   */
+  d = _mm512_mask_sub_epi8( d, lower,       d, _mm512_set1_epi8( 6 ) ); /* 'a' -> '[' */
+  d = _mm512_mask_sub_epi8( d, GE('m'),     d, one                   ); /* skip 'l'   */
+# undef NE
+# undef LE
+# undef GE
+  return d;
+}
+
+/* raw_to_intermediate_8 combines the raw digits 40g+5i+[0,5) of the
+   128 digits in lo (digits [0,64)) and hi (digits [64,128)) into term
+   i in [0,8) of the intermediate form (lane i of the result).  The 5
+   digits of each term are gathered into the low bytes of its lane and
+   then combined with multiply-adds: (d0*58+d1)*3364+(d2*58+d3) and
+   then *58+d4.  Terms that read past digit 127 are garbage. */
+
+static inline wwv_t
+raw_to_intermediate_8( __m512i lo,
+                       __m512i hi,
+                       ulong   g ) {
+  __m512i idx = _mm512_set_epi8( 0,0,0,39,38,37,36,35, 0,0,0,34,33,32,31,30, 0,0,0,29,28,27,26,25, 0,0,0,24,23,22,21,20,
+                                 0,0,0,19,18,17,16,15, 0,0,0,14,13,12,11,10, 0,0,0, 9, 8, 7, 6, 5, 0,0,0, 4, 3, 2, 1, 0 );
+  idx = _mm512_add_epi8( idx, _mm512_set1_epi8( (char)(40UL*g) ) );
+  __m512i d = _mm512_maskz_permutex2var_epi8( (__mmask64)0x1f1f1f1f1f1f1f1fUL, lo, idx, hi );
+
+  __m512i w = _mm512_maddubs_epi16( d, _mm512_set1_epi64( 0x00000001013a013aL ) ); /* byte weights 58,1,58,1,1,0,0,0 */
+  __m512i x = _mm512_madd_epi16   ( w, _mm512_set1_epi64( 0x0000000100010d24L ) ); /* word weights 3364,1,1,0 */
+  return wwv_add( wwv_mul_ll( x, wwv_bcast( 58UL ) ), wwv_shr( x, 32 ) );
+}
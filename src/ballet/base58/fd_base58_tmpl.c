@@ -19,10 +19,11 @@
 
    This file is safe for inclusion multiple times. */
 
-#define BYTE_CNT     ((ulong) N)
-#define SUFFIX(s)    FD_EXPAND_THEN_CONCAT3(s,_,N)
-#define ENCODED_SZ() FD_EXPAND_THEN_CONCAT3(FD_BASE58_ENCODED_, N, _SZ)
-#define RAW58_SZ     (INTERMEDIATE_SZ*5UL)
+#define BYTE_CNT        ((ulong) N)
+#define SUFFIX(s)       FD_EXPAND_THEN_CONCAT3(s,_,N)
+#define BATCH_SUFFIX(s) FD_EXPAND_THEN_CONCAT4(s,_,N,_batch)
+#define ENCODED_SZ()    FD_EXPAND_THEN_CONCAT3(FD_BASE58_ENCODED_, N, _SZ)
+#define RAW58_SZ        (INTERMEDIATE_SZ*5UL)
 
 #if FD_HAS_AVX
 #define INTERMEDIATE_SZ_W_PADDING FD_ULONG_ALIGN_UP( INTERMEDIATE_SZ, 4UL )
@@ -392,8 +393,304 @@ SUFFIX(fd_base58_decode)( char const * encoded,
   return out;
 }
 
+#if BASE58_BATCH_AVX512
+
+/* Batch conversion of 8 values at a time, one value per 64-bit lane
+   (see fd_base58_avx512.h).  cnt in [1,8]; lanes at or above cnt are
+   computed from a copy of lane 0 (encode) or zeros (decode) and their
+   results are discarded. */
+
+static void
+SUFFIX(fd_base58_private_encode_batch8)( uchar const * const * bytes,
+                                         ulong *               opt_len,
+                                         char * const *        out,
+                                         ulong                 cnt ) {
+
+  /* Load the values as 32-bit limbs, one value per lane (binary[i]
+     holds limb i of each value) and count the leading zero bytes of
+     each value */
+
+  wwv_t binary[ BINARY_SZ ];
+  ulong in_leading_0s[ 8 ];
+  for( ulong h=0UL; h<BINARY_SZ; h+=8UL ) {
+    wwv_t r[ 8 ];
+    for( ulong k=0UL; k<8UL; k++ ) r[ k ] = load_be32x8( bytes[ fd_ulong_if( k<cnt, k, 0UL ) ] + 4UL*h );
+    wwv_transpose_8x8( r[0], r[1], r[2], r[3], r[4], r[5], r[6], r[7],
+                       binary[h+0UL], binary[h+1UL], binary[h+2UL], binary[h+3UL],
+                       binary[h+4UL], binary[h+5UL], binary[h+6UL], binary[h+7UL] );
+  }
+  for( ulong k=0UL; k<8UL; k++ ) {
+    uchar const * b  = bytes[ fd_ulong_if( k<cnt, k, 0UL ) ];
+    ulong         lz = BYTE_CNT;
+    for( ulong i=0UL; i<BYTE_CNT; i+=8UL ) {
+      ulong w = fd_ulong_bswap( fd_ulong_load_8( b+i ) );
+      if( w ) { lz = i + ( 63UL-(ulong)fd_ulong_find_msb( w ) )/8UL; break; }
+    }
+    in_leading_0s[ k ] = lz;
+  }
+
+  /* Convert to the intermediate format (same bounds as the single
+     value conversion above).  The tables are upper triangular. */
+
+  wwv_t intermediate[ INTERMEDIATE_SZ ];
+  for( ulong j=0UL; j<INTERMEDIATE_SZ; j++ ) intermediate[ j ] = wwv_zero();
+
+# if N==32
+  for( ulong i=0UL; i<BINARY_SZ; i++ ) {
+    for( ulong j=i; j<INTERMEDIATE_SZ-1UL; j++ )
+      intermediate[ j+1UL ] = wwv_add( intermediate[ j+1UL ], wwv_mul_ll( binary[ i ], wwv_bcast( (ulong)SUFFIX(enc_table)[ i ][ j ] ) ) );
+  }
+# elif N==64
+  for( ulong i=0UL; i<8UL; i++ ) {
+    for( ulong j=i; j<INTERMEDIATE_SZ-1UL; j++ )
+      intermediate[ j+1UL ] = wwv_add( intermediate[ j+1UL ], wwv_mul_ll( binary[ i ], wwv_bcast( (ulong)SUFFIX(enc_table)[ i ][ j ] ) ) );
+  }
+  /* Mini-reduction */
+  wwv_t q, r;
+  divmod_58_5( intermediate[ 16 ], &q, &r );
+  intermediate[ 15 ] = wwv_add( intermediate[ 15 ], q );
+  intermediate[ 16 ] = r;
+  for( ulong i=8UL; i<BINARY_SZ; i++ ) {
+    for( ulong j=i; j<INTERMEDIATE_SZ-1UL; j++ )
+      intermediate[ j+1UL ] = wwv_add( intermediate[ j+1UL ], wwv_mul_ll( binary[ i ], wwv_bcast( (ulong)SUFFIX(enc_table)[ i ][ j ] ) ) );
+  }
+# endif
+
+  for( ulong i=INTERMEDIATE_SZ-1UL; i>0UL; i-- ) {
+    wwv_t q, r;
+    divmod_58_5( intermediate[ i ], &q, &r );
+    intermediate[ i-1UL ] = wwv_add( intermediate[ i-1UL ], q );
+    intermediate[ i     ] = r;
+  }
+
+  /* Convert to raw base58 digits and pack them 8 per ulong:
+     byte j%8 of lane k of block[j/8] is raw digit j of value k.  As the
+     digits are less than 58, packing is just shifts and ors. */
+
+# define BLOCK_CNT ((RAW58_SZ+7UL)/8UL)
+  wwv_t block[ BLOCK_CNT ];
+  for( ulong b=0UL; b<BLOCK_CNT; b++ ) block[ b ] = wwv_zero();
+  for( ulong i=0UL; i<INTERMEDIATE_SZ; i++ ) {
+    wwv_t raw[ 5 ];
+    intermediate_to_raw_8( intermediate[ i ], raw );
+    for( ulong m=0UL; m<5UL; m++ ) {
+      ulong j = 5UL*i+m;
+      block[ j/8UL ] = wwv_or( block[ j/8UL ], wwv_shl( raw[ m ], 8UL*(j%8UL) ) );
+    }
+  }
+
+  /* Find the leading zero digits of each value and map the digits to
+     characters */
+
+  ulong nz[ BLOCK_CNT ]; /* bit 8k+r set if digit 8b+r of value k is non-zero */
+  for( ulong b=0UL; b<BLOCK_CNT; b++ ) {
+    nz   [ b ] = (ulong)_mm512_test_epi8_mask( block[ b ], block[ b ] );
+    block[ b ] = raw_to_base58_64( block[ b ] );
+  }
+
+  /* Transpose so that each value's characters are contiguous, drop the
+     leading zero digits (see the single value conversion for why
+     skip>=0) and store */
+
+# if N==32
+  wwv_t lane[ 8 ];
+  wwv_transpose_8x8( block[0], block[1], block[2], block[3], block[4], block[5], wwv_zero(), wwv_zero(),
+                     lane[0], lane[1], lane[2], lane[3], lane[4], lane[5], lane[6], lane[7] );
+# elif N==64
+  wwv_t lane_lo[ 8 ], lane_hi[ 8 ];
+  wwv_transpose_8x8( block[0], block[1], block[ 2], block[ 3], block[4], block[5], block[6], block[7],
+                     lane_lo[0], lane_lo[1], lane_lo[2], lane_lo[3], lane_lo[4], lane_lo[5], lane_lo[6], lane_lo[7] );
+  wwv_transpose_8x8( block[8], block[9], block[10], block[11], wwv_zero(), wwv_zero(), wwv_zero(), wwv_zero(),
+                     lane_hi[0], lane_hi[1], lane_hi[2], lane_hi[3], lane_hi[4], lane_hi[5], lane_hi[6], lane_hi[7] );
+# endif
+
+  __m512i iota = _mm512_set_epi8( 63,62,61,60,59,58,57,56,55,54,53,52,51,50,49,48,47,46,45,44,43,42,41,40,39,38,37,36,35,34,33,32,
+                                  31,30,29,28,27,26,25,24,23,22,21,20,19,18,17,16,15,14,13,12,11,10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0 );
+
+  for( ulong k=0UL; k<cnt; k++ ) {
+    ulong raw_leading_0s = RAW58_SZ;
+    for( ulong b=0UL; b<BLOCK_CNT; b++ ) {
+      ulong m = (nz[ b ]>>(8UL*k)) & 0xffUL;
+      if( m ) { raw_leading_0s = 8UL*b + (ulong)fd_ulong_find_lsb( m ); break; }
+    }
+
+    ulong  skip = raw_leading_0s - in_leading_0s[ k ];
+    ulong  len  = RAW58_SZ - skip;
+    char * o    = out[ k ];
+    __m512i idx = _mm512_add_epi8( iota, _mm512_set1_epi8( (char)skip ) );
+#   if N==32
+    _mm512_mask_storeu_epi8( o, (__mmask64)( (1UL<<len)-1UL ), _mm512_permutexvar_epi8( idx, lane[ k ] ) );
+#   elif N==64
+    __m512i idx_hi = _mm512_add_epi8( idx, _mm512_set1_epi8( 64 ) );
+    _mm512_storeu_si512( o, _mm512_permutex2var_epi8( lane_lo[ k ], idx, lane_hi[ k ] ) );
+    _mm512_mask_storeu_epi8( o+64, (__mmask64)( (1UL<<(len-64UL))-1UL ), _mm512_permutex2var_epi8( lane_lo[ k ], idx_hi, lane_hi[ k ] ) );
+#   endif
+    o[ len ] = '\0';
+    if( opt_len ) opt_len[ k ] = len;
+  }
+# undef BLOCK_CNT
+}
+
+static ulong
+SUFFIX(fd_base58_private_decode_batch8)( char const * const * encoded,
+                                         uchar * const *      out,
+                                         uchar *              opt_ok,
+                                         ulong                cnt ) {
+
+  /* For each string, convert the characters to raw digits, right align
+     them to RAW58_SZ digits and gather the digits of each intermediate
+     term into a ulong (group[g] lane i is term 8g+i).  The digits live
+     in up to 128 bytes (lo and hi).  Then transpose so that
+     intermediate[i] holds term i of each value.  Invalid strings and
+     unused lanes decode zeros. */
+
+# define GROUP_CNT ((INTERMEDIATE_SZ+7UL)/8UL)
+  __m512i iota = _mm512_set_epi8( 63,62,61,60,59,58,57,56,55,54,53,52,51,50,49,48,47,46,45,44,43,42,41,40,39,38,37,36,35,34,33,32,
+                                  31,30,29,28,27,26,25,24,23,22,21,20,19,18,17,16,15,14,13,12,11,10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0 );
+
+  wwv_t group[ GROUP_CNT ][ 8 ];
+  ulong valid = 0UL; /* bit k set if the characters of lane k are valid */
+  ulong lead1[ 8 ]; /* number of leading '1's of lane k */
+  for( ulong k=0UL; k<8UL; k++ ) {
+    for( ulong g=0UL; g<GROUP_CNT; g++ ) group[ g ][ k ] = wwv_zero();
+    if( k>=cnt ) continue;
+
+    char const * e = encoded[ k ];
+    ulong char_cnt = 0UL;
+    while( char_cnt<ENCODED_SZ() && e[ char_cnt ] ) char_cnt++;
+    if( FD_UNLIKELY( char_cnt==ENCODED_SZ() ) ) continue; /* too long */
+
+    ulong     prepend_0 = RAW58_SZ-char_cnt;
+    __mmask64 bad;
+#   if N==32
+    __mmask64 m_lo = (__mmask64)( (1UL<<char_cnt)-1UL );
+    __m512i   c_lo = _mm512_maskz_loadu_epi8( m_lo, e );
+    __m512i   d_lo = base58_to_raw_64( c_lo, &bad );
+    if( FD_UNLIKELY( bad & m_lo ) ) continue;
+    ulong nz = (ulong)_mm512_test_epi8_mask( d_lo, d_lo ) & m_lo;
+    lead1[ k ] = nz ? (ulong)fd_ulong_find_lsb( nz ) : char_cnt;
+
+    /* right align (raw_lo[j] = d_lo[j-prepend_0]) */
+    __mmask64 m_align = (__mmask64)( ~0UL<<prepend_0 );
+    __m512i   raw_lo  = _mm512_maskz_permutexvar_epi8( m_align, _mm512_sub_epi8( iota, _mm512_set1_epi8( (char)prepend_0 ) ), d_lo );
+    __m512i   raw_hi  = _mm512_setzero_si512();
+#   elif N==64
+    __mmask64 m_lo = (__mmask64)( char_cnt>=64UL ? ~0UL : (1UL<<char_cnt)-1UL );
+    __mmask64 m_hi = (__mmask64)( char_cnt> 64UL ? (1UL<<(char_cnt-64UL))-1UL : 0UL );
+    __m512i   c_lo = _mm512_maskz_loadu_epi8( m_lo, e      );
+    __m512i   c_hi = _mm512_maskz_loadu_epi8( m_hi, e+64UL );
+    __mmask64 bad_hi;
+    __m512i   d_lo = base58_to_raw_64( c_lo, &bad    );
+    __m512i   d_hi = base58_to_raw_64( c_hi, &bad_hi );
+    if( FD_UNLIKELY( (bad & m_lo) | (bad_hi & m_hi) ) ) continue;
+    ulong nz_lo = (ulong)_mm512_test_epi8_mask( d_lo, d_lo ) & m_lo;
+    ulong nz_hi = (ulong)_mm512_test_epi8_mask( d_hi, d_hi ) & m_hi;
+    lead1[ k ] = nz_lo ? (ulong)fd_ulong_find_lsb( nz_lo ) : nz_hi ? 64UL+(ulong)fd_ulong_find_lsb( nz_hi ) : char_cnt;
+
+    /* right align (raw[j] = d[j-prepend_0]), prepend_0 in [2,90] */
+    __m512i   shift   = _mm512_set1_epi8( (char)prepend_0 );
+    __mmask64 m_align = (__mmask64)( prepend_0>=64UL ? 0UL : ~0UL<<prepend_0 );
+    __mmask64 m_align_hi = (__mmask64)( prepend_0>64UL ? ~0UL<<(prepend_0-64UL) : ~0UL );
+    __m512i   raw_lo  = _mm512_maskz_permutex2var_epi8( m_align, d_lo, _mm512_sub_epi8( iota, shift ), d_hi );
+    __m512i   raw_hi  = _mm512_maskz_permutex2var_epi8( m_align_hi, d_lo, _mm512_sub_epi8( _mm512_add_epi8( iota, _mm512_set1_epi8( 64 ) ), shift ), d_hi );
+#   endif
+
+    for( ulong g=0UL; g<GROUP_CNT; g++ ) group[ g ][ k ] = raw_to_intermediate_8( raw_lo, raw_hi, g );
+    valid |= 1UL<<k;
+  }
+
+  wwv_t intermediate[ 8UL*GROUP_CNT ];
+  for( ulong g=0UL; g<GROUP_CNT; g++ ) {
+    wwv_t * r = group[ g ];
+    wwv_t * c = intermediate + 8UL*g;
+    wwv_transpose_8x8( r[0], r[1], r[2], r[3], r[4], r[5], r[6], r[7], c[0], c[1], c[2], c[3], c[4], c[5], c[6], c[7] );
+  }
+# undef GROUP_CNT
+
+  /* Convert to overcomplete base 2^32 and reduce (same bounds as the
+     single value conversion above) */
+
+  wwv_t binary[ BINARY_SZ ];
+  for( ulong j=0UL; j<BINARY_SZ; j++ ) binary[ j ] = wwv_zero();
+  for( ulong i=0UL; i<INTERMEDIATE_SZ; i++ ) {
+    for( ulong j=0UL; j<BINARY_SZ; j++ )
+      binary[ j ] = wwv_add( binary[ j ], wwv_mul_ll( intermediate[ i ], wwv_bcast( (ulong)SUFFIX(dec_table)[ i ][ j ] ) ) );
+  }
+
+  wwv_t mask32 = wwv_bcast( (ulong)UINT_MAX );
+  for( ulong i=BINARY_SZ-1UL; i>0UL; i-- ) {
+    binary[ i-1UL ] = wwv_add( binary[ i-1UL ], wwv_shr( binary[ i ], 32 ) );
+    binary[ i     ] = wwv_and( binary[ i ], mask32 );
+  }
+  valid &= (ulong)(uint)~wwv_gt( binary[ 0 ], mask32 ); /* too large */
+
+  /* Transpose back to one value per vector and store big endian.  The
+     number of leading '1's has to match the number of leading zero
+     bytes. */
+
+  wwv_t limbs[ BINARY_SZ ];
+  for( ulong h=0UL; h<BINARY_SZ; h+=8UL ) {
+    wwv_t * r = binary + h;
+    wwv_t * c = limbs  + h;
+    wwv_transpose_8x8( r[0], r[1], r[2], r[3], r[4], r[5], r[6], r[7], c[0], c[1], c[2], c[3], c[4], c[5], c[6], c[7] );
+  }
+
+  ulong ok_cnt = 0UL;
+  for( ulong k=0UL; k<cnt; k++ ) {
+    int ok = (int)( (valid>>k) & 1UL );
+    if( ok ) {
+      for( ulong h=0UL; h<BINARY_SZ; h+=8UL ) store_be32x8( out[ k ]+4UL*h, limbs[ h+k ] );
+      uchar const * o  = out[ k ];
+      ulong         lz = BYTE_CNT;
+      for( ulong i=0UL; i<BYTE_CNT; i+=8UL ) {
+        ulong w = fd_ulong_bswap( fd_ulong_load_8( o+i ) );
+        if( w ) { lz = i + ( 63UL-(ulong)fd_ulong_find_msb( w ) )/8UL; break; }
+      }
+      ok = lz==lead1[ k ];
+    }
+    if( opt_ok ) opt_ok[ k ] = (uchar)ok;
+    ok_cnt += (ulong)ok;
+  }
+  return ok_cnt;
+}
+
+#endif /* BASE58_BATCH_AVX512 */
+
+void
+BATCH_SUFFIX(fd_base58_encode)( uchar const * const * bytes,
+                                ulong *               opt_len,
+                                char * const *        out,
+                                ulong                 cnt ) {
+#if BASE58_BATCH_AVX512
+  for( ulong i=0UL; i<cnt; i+=8UL )
+    SUFFIX(fd_base58_private_encode_batch8)( bytes+i, opt_len ? opt_len+i : NULL, out+i, fd_ulong_min( cnt-i, 8UL ) );
+#else
+  for( ulong i=0UL; i<cnt; i++ ) SUFFIX(fd_base58_encode)( bytes[ i ], opt_len ? opt_len+i : NULL, out[ i ] );
+#endif
+}
+
+ulong
+BATCH_SUFFIX(fd_base58_decode)( char const * const * encoded,
+                                uchar * const *      out,
+                                uchar *              opt_ok,
+                                ulong                cnt ) {
+  ulong ok_cnt = 0UL;
+#if BASE58_BATCH_AVX512
+  for( ulong i=0UL; i<cnt; i+=8UL )
+    ok_cnt += SUFFIX(fd_base58_private_decode_batch8)( encoded+i, out+i, opt_ok ? opt_ok+i : NULL, fd_ulong_min( cnt-i, 8UL ) );
+#else
+  for( ulong i=0UL; i<cnt; i++ ) {
+    int ok = !!SUFFIX(fd_base58_decode)( encoded[ i ], out[ i ] );
+    if( opt_ok ) opt_ok[ i ] = (uchar)ok;
+    ok_cnt += (ulong)ok;
+  }
+#endif
+  return ok_cnt;
+}
+
 #undef RAW58_SZ
 #undef ENCODED_SZ
+#undef BATCH_SUFFIX
 #undef SUFFIX
 
 #undef BINARY_SZ
@@ -535,6 +535,135 @@ MAKE_TESTS(64,64    )
 
 #undef MAKE_TESTS
 
+/* Batch conversions are checked against the single value conversions
+   on batches with random numbers of leading zeros (including all zero
+   values) and with corrupted strings.  The batch size is deliberately
+   not a multiple of 8. */
+
+#define BATCH_CNT (37UL)
+
+#define MAKE_BATCH_TESTS(n)                                                                          \
+static void                                                                                          \
+test_batch##n( fd_rng_t * rng,                                                                       \
+               ulong      iter_cnt ) {                                                               \
+  static uchar bytes   [ BATCH_CNT ][ n ];                                                           \
+  static uchar decoded [ BATCH_CNT ][ n ];                                                           \
+  static char  enc     [ BATCH_CNT ][ FD_BASE58_ENCODED_##n##_SZ ];                                  \
+  static char  enc_ref [ BATCH_CNT ][ FD_BASE58_ENCODED_##n##_SZ ];                                  \
+  uchar const * in_p   [ BATCH_CNT ];                                                                \
+  uchar *       dec_p  [ BATCH_CNT ];                                                                \
+  char *        enc_p  [ BATCH_CNT ];                                                                \
+  char const *  encc_p [ BATCH_CNT ];                                                                \
+  ulong         len    [ BATCH_CNT ];                                                                \
+  uchar         ok     [ BATCH_CNT ];                                                                \
+  for( ulong i=0UL; i<BATCH_CNT; i++ ) {                                                             \
+    in_p[ i ] = bytes[ i ]; dec_p[ i ] = decoded[ i ]; enc_p[ i ] = enc[ i ]; encc_p[ i ] = enc[ i ]; \
+  }                                                                                                  \
+                                                                                                     \
+  for( ulong iter=0UL; iter<iter_cnt; iter++ ) {                                                     \
+    ulong cnt = fd_rng_ulong_roll( rng, BATCH_CNT+1UL );                                             \
+    for( ulong i=0UL; i<cnt; i++ ) {                                                                 \
+      ulong zero_cnt = fd_rng_uint_roll( rng, 8U ) ? fd_rng_ulong_roll( rng, 4UL )                   \
+                                                   : fd_rng_ulong_roll( rng, n+1UL );                \
+      for( ulong j=0UL; j<n; j++ ) bytes[ i ][ j ] = j<zero_cnt ? (uchar)0 : fd_rng_uchar( rng );    \
+      ulong ref_len;                                                                                 \
+      fd_base58_encode_##n( bytes[ i ], &ref_len, enc_ref[ i ] );                                    \
+      FD_TEST( ref_len==strlen( enc_ref[ i ] ) );                                                    \
+    }                                                                                                \
+                                                                                                     \
+    fd_base58_encode_##n##_batch( in_p, len, enc_p, cnt );                                           \
+    for( ulong i=0UL; i<cnt; i++ ) {                                                                 \
+      FD_TEST( !strcmp( enc[ i ], enc_ref[ i ] ) );                                                  \
+      FD_TEST( len[ i ]==strlen( enc_ref[ i ] ) );                                                   \
+    }                                                                                                \
+                                                                                                     \
+    FD_TEST( fd_base58_decode_##n##_batch( encc_p, dec_p, ok, cnt )==cnt );                          \
+    for( ulong i=0UL; i<cnt; i++ ) {                                                                 \
+      FD_TEST( ok[ i ] );                                                                            \
+      FD_TEST( !memcmp( decoded[ i ], bytes[ i ], n ) );                                             \
+    }                                                                                                \
+                                                                                                     \
+    /* Corrupt some strings: invalid characters, extra leading '1's,                                 \
+       overflow and too long strings */                                                              \
+    for( ulong i=0UL; i<cnt; i++ ) {                                                                 \
+      ulong l = strlen( enc[ i ] );                                                                  \
+      switch( fd_rng_uint_roll( rng, 6U ) ) {                                                        \
+      case 0: enc[ i ][ fd_rng_ulong_roll( rng, l ) ] = "0IOl+"[ fd_rng_uint_roll( rng, 5U ) ]; break; \
+      case 1: if( l<FD_BASE58_ENCODED_##n##_LEN ) { memmove( enc[ i ]+1, enc[ i ], l+1UL ); enc[ i ][ 0 ] = '1'; } break; \
+      case 2: memset( enc[ i ], 'z', FD_BASE58_ENCODED_##n##_LEN ); enc[ i ][ FD_BASE58_ENCODED_##n##_LEN ] = '\0'; break; \
+      case 3: enc[ i ][ fd_rng_ulong_roll( rng, l ) ] = '\0'; break;                                 \
+      default: break;                                                                                \
+      }                                                                                              \
+    }                                                                                                \
+    ulong ok_cnt = 0UL;                                                                              \
+    for( ulong i=0UL; i<cnt; i++ ) ok_cnt += !!fd_base58_decode_##n( enc[ i ], bytes[ i ] );         \
+    FD_TEST( fd_base58_decode_##n##_batch( encc_p, dec_p, ok, cnt )==ok_cnt );                       \
+    for( ulong i=0UL; i<cnt; i++ ) {                                                                 \
+      uchar ref[ n ];                                                                                \
+      int   ref_ok = !!fd_base58_decode_##n( enc[ i ], ref );                                        \
+      FD_TEST( ok[ i ]==ref_ok );                                                                    \
+      if( ref_ok ) FD_TEST( !memcmp( decoded[ i ], ref, n ) );                                       \
+    }                                                                                                \
+    FD_TEST( fd_base58_decode_##n##_batch( encc_p, dec_p, NULL, cnt )==ok_cnt );                     \
+  }                                                                                                  \
+}                                                                                                    \
+                                                                                                     \
+static void                                                                                          \
+test_batch_performance##n( fd_rng_t * rng ) {                                                        \
+  ulong const batch_cnt  = 256UL;                                                                    \
+  ulong const iter_cnt   = 200UL;                                                                    \
+  static uchar bytes[ 256UL ][ n ];                                                                  \
+  static char  enc  [ 256UL ][ FD_BASE58_ENCODED_##n##_SZ ];                                         \
+  uchar const * in_p  [ 256UL ];                                                                     \
+  uchar *       dec_p [ 256UL ];                                                                     \
+  char *        enc_p [ 256UL ];                                                                     \
+  char const *  encc_p[ 256UL ];                                                                     \
+  for( ulong i=0UL; i<batch_cnt; i++ ) {                                                             \
+    for( ulong j=0UL; j<n; j++ ) bytes[ i ][ j ] = fd_rng_uchar( rng );                             \
+    in_p[ i ] = bytes[ i ]; dec_p[ i ] = bytes[ i ]; enc_p[ i ] = enc[ i ]; encc_p[ i ] = enc[ i ];  \
+  }                                                                                                  \
+                                                                                                     \
+  long dt_enc = -fd_log_wallclock();                                                                 \
+  for( ulong iter=0UL; iter<iter_cnt; iter++ ) {                                                     \
+    for( ulong i=0UL; i<batch_cnt; i++ ) fd_base58_encode_##n( bytes[ i ], NULL, enc[ i ] );         \
+    FD_COMPILER_MFENCE();                                                                            \
+  }                                                                                                  \
+  dt_enc += fd_log_wallclock();                                                                      \
+                                                                                                     \
+  long dt_enc_batch = -fd_log_wallclock();                                                           \
+  for( ulong iter=0UL; iter<iter_cnt; iter++ ) {                                                     \
+    fd_base58_encode_##n##_batch( in_p, NULL, enc_p, batch_cnt );                                    \
+    FD_COMPILER_MFENCE();                                                                            \
+  }                                                                                                  \
+  dt_enc_batch += fd_log_wallclock();                                                                \
+                                                                                                     \
+  long dt_dec = -fd_log_wallclock();                                                                 \
+  for( ulong iter=0UL; iter<iter_cnt; iter++ ) {                                                     \
+    for( ulong i=0UL; i<batch_cnt; i++ ) FD_TEST( fd_base58_decode_##n( enc[ i ], bytes[ i ] ) );    \
+    FD_COMPILER_MFENCE();                                                                            \
+  }                                                                                                  \
+  dt_dec += fd_log_wallclock();                                                                      \
+                                                                                                     \
+  long dt_dec_batch = -fd_log_wallclock();                                                           \
+  for( ulong iter=0UL; iter<iter_cnt; iter++ ) {                                                     \
+    FD_TEST( fd_base58_decode_##n##_batch( encc_p, dec_p, NULL, batch_cnt )==batch_cnt );            \
+    FD_COMPILER_MFENCE();                                                                            \
+  }                                                                                                  \
+  dt_dec_batch += fd_log_wallclock();                                                                \
+                                                                                                     \
+  double cnt = (double)( batch_cnt*iter_cnt );                                                       \
+  FD_LOG_NOTICE(( "encode_" #n ": %.1f ns/value single, %.1f ns/value batch; "                       \
+                  "decode_" #n ": %.1f ns/value single, %.1f ns/value batch",                        \
+                  (double)dt_enc/cnt, (double)dt_enc_batch/cnt,                                      \
+                  (double)dt_dec/cnt, (double)dt_dec_batch/cnt ));                                   \
+}
+
+MAKE_BATCH_TESTS(32)
+MAKE_BATCH_TESTS(64)
+
+#undef MAKE_BATCH_TESTS
+#undef BATCH_CNT
+
 #if FD_HAS_AVX
 
 #include "fd_base58_avx.h"
@@ -743,6 +872,12 @@ main( int     argc,
   test_match64( rng, cnt );
   test_performance64( rng );
 
+  FD_LOG_NOTICE(( "Testing batch conversion" ));
+  test_batch32( rng, cnt/100UL );
+  test_batch64( rng, cnt/100UL );
+  test_batch_performance32( rng );
+  test_batch_performance64( rng );
+
   fd_rng_delete( fd_rng_leave( rng ) );
 
   FD_LOG_NOTICE(( "pass" ));
@@ -1,12 +1,14 @@
-ifneq ($(FD_HAS_LIBFF),)
-
+ifdef FD_HAS_INT128
 $(call add-hdrs,fd_bn254.h fd_poseidon.h)
-$(call add-objs,fd_bn254 fd_poseidon_params fd_poseidon,fd_ballet)
+$(call add-objs,fd_bn254 fd_poseidon,fd_ballet)
 $(call make-unit-test,test_bn254,test_bn254,fd_ballet fd_util)
 $(call make-unit-test,test_poseidon,test_poseidon,fd_ballet fd_util)
+$(call run-unit-test,test_bn254)
+$(call run-unit-test,test_poseidon)
 
-else
-
-$(info bn254 disabled due to lack of libff)
-
+ifneq ($(FD_HAS_LIBFF),)
+$(call add-objs,fd_bn254_libff fd_poseidon_libff_params fd_poseidon_libff,fd_ballet)
+$(call make-unit-test,test_bn254_libff,test_bn254_libff,fd_ballet fd_util)
+$(call run-unit-test,test_bn254_libff)
+endif
 endif
@@ -0,0 +1,770 @@
+#include "fd_bn254.h"
+#include "fd_bn254_field.c"
+
+/* G1 is the group of points of y^2 = x^3 + 3 over Fp (of prime order r,
+   the cofactor is 1).  G2 is the order r subgroup of the D-type sextic
+   twist y^2 = x^3 + 3/xi over Fp2.
+
+   Points are kept in Jacobian coordinates, (X,Y,Z) representing
+   (X/Z^2,Y/Z^3), with Z==0 for the point at infinity. */
+
+struct fd_bn254_g1 {
+  fd_bn254_fp_t X, Y, Z;
+};
+typedef struct fd_bn254_g1 fd_bn254_g1_t;
+
+struct fd_bn254_g2 {
+  fd_bn254_fp2_t X, Y, Z;
+};
+typedef struct fd_bn254_g2 fd_bn254_g2_t;
+
+/* b = 3 */
+static const fd_bn254_fp_t fd_bn254_const_b[1] = {{{
+  0x7a17caa950ad28d7UL, 0x1f6ac17ae15521b9UL, 0x334bea4e696bd284UL, 0x2a1f6744ce179d8eUL
+}}};
+
+/* b' = 3/xi, and 3b' */
+static const fd_bn254_fp2_t fd_bn254_const_twist_b[1] = {{{
+  {{ 0x3bf938e377b802a8UL, 0x020b1b273633535dUL, 0x26b7edf049755260UL, 0x2514c6324384a86dUL }},
+  {{ 0x38e7ecccd1dcff67UL, 0x65f0b37d93ce0d3eUL, 0xd749d0dd22ac00aaUL, 0x0141b9ce4a688d4dUL }}
+}}};
+static const fd_bn254_fp2_t fd_bn254_const_twist_b3[1] = {{{
+  {{ 0x3baa927cb62e0d6aUL, 0xd71e7c52d1b664fdUL, 0x03873e63d95d4664UL, 0x0e75b5b1082ab8f4UL }},
+  {{ 0xaab7c6667596fe35UL, 0x31d21a78bb6a27baUL, 0x85dd7297680401ffUL, 0x03c52d6adf39a7e9UL }}
+}}};
+
+/* The bn254 parameter u, and 6u^2 (little endian), for the final
+   exponentiation and the G2 membership test */
+#define FD_BN254_CONST_U (0x44e992b44a6909f1UL)
+static const ulong fd_bn254_const_6u2[2] = { 0xf83e9682e87cfd46UL, 0x6f4d8248eeb859fbUL };
+
+/* Signed binary (NAF) digits of 6u+2, most significant first, without
+   the leading 1 */
+static const schar fd_bn254_const_ate_naf[65] = {
+  0, -1, 0, 1, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 1,
+  0, 0, -1, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, -1, 0, -1, 0, 0, 1, 0, 0, 0, -1, 0, 0, -1, 0, 1, 0, 1, 0, 0, 0
+};
+
+static inline int
+fd_bn254_is_zero_bytes( uchar const * buf,
+                        ulong         sz ) {
+  ulong acc = 0UL;
+  for( ulong i=0UL; i<sz; i++ ) acc |= buf[ i ];
+  return !acc;
+}
+
+/* G1 ****************************************************************/
+
+static inline int
+fd_bn254_g1_is_inf( fd_bn254_g1_t const * p ) {
+  return fd_bn254_fp_is_zero( &p->Z );
+}
+
+static inline fd_bn254_g1_t *
+fd_bn254_g1_set_inf( fd_bn254_g1_t * r ) {
+  fd_bn254_fp_set_one ( &r->X );
+  fd_bn254_fp_set_one ( &r->Y );
+  fd_bn254_fp_set_zero( &r->Z );
+  return r;
+}
+
+/* fd_bn254_g1_on_curve returns 1 if the affine point (x,y) satisfies
+   y^2 = x^3 + 3. */
+
+static inline int
+fd_bn254_g1_on_curve( fd_bn254_fp_t const * x,
+                      fd_bn254_fp_t const * y ) {
+  fd_bn254_fp_t l[1], r[1];
+  fd_bn254_fp_sqr( l, y );
+  fd_bn254_fp_sqr( r, x );
+  fd_bn254_fp_mul( r, r, x );
+  fd_bn254_fp_add( r, r, fd_bn254_const_b );
+  return fd_bn254_fp_eq( l, r );
+}
+
+/* fd_bn254_g1_frombytes decodes the 64 byte G1 point at buf into r.
+   Returns r on success and NULL if buf is not a valid point. */
+
+static fd_bn254_g1_t *
+fd_bn254_g1_frombytes( fd_bn254_g1_t * r,
+                       uchar const     buf[ 64 ] ) {
+  if( fd_bn254_is_zero_bytes( buf, 64UL ) ) return fd_bn254_g1_set_inf( r );
+  if( FD_UNLIKELY( !fd_bn254_fp_frombytes_be_nm( &r->X, buf       ) ) ) return NULL;
+  if( FD_UNLIKELY( !fd_bn254_fp_frombytes_be_nm( &r->Y, buf+32UL  ) ) ) return NULL;
+  if( FD_UNLIKELY( !fd_bn254_g1_on_curve( &r->X, &r->Y ) ) ) return NULL;
+  fd_bn254_fp_set_one( &r->Z );
+  return r;
+}
+
+static uchar *
+fd_bn254_g1_tobytes( uchar                 out[ 64 ],
+                     fd_bn254_g1_t const * p ) {
+  if( fd_bn254_g1_is_inf( p ) ) {
+    fd_memset( out, 0, 64UL );
+    return out;
+  }
+  fd_bn254_fp_t zi[1], zi2[1], x[1], y[1];
+  fd_bn254_fp_inv( zi, &p->Z );
+  fd_bn254_fp_sqr( zi2, zi );
+  fd_bn254_fp_mul( x, &p->X, zi2 );
+  fd_bn254_fp_mul( zi2, zi2, zi );
+  fd_bn254_fp_mul( y, &p->Y, zi2 );
+  fd_bn254_fp_tobytes_be_nm( out,      x );
+  fd_bn254_fp_tobytes_be_nm( out+32UL, y );
+  return out;
+}
+
+static fd_bn254_g1_t *
+fd_bn254_g1_dbl( fd_bn254_g1_t *       r,
+                 fd_bn254_g1_t const * p ) {
+  /* dbl-2009-l, https://hyperelliptic.org/EFD/g1p/auto-shortw-jacobian-0.html */
+  fd_bn254_fp_t a[1], b[1], c[1], d[1], e[1], f[1], t[1];
+  fd_bn254_fp_sqr( a, &p->X );
+  fd_bn254_fp_sqr( b, &p->Y );
+  fd_bn254_fp_sqr( c, b );
+  fd_bn254_fp_add( d, &p->X, b );
+  fd_bn254_fp_sqr( d, d );
+  fd_bn254_fp_sub( d, d, a );
+  fd_bn254_fp_sub( d, d, c );
+  fd_bn254_fp_dbl( d, d );
+  fd_bn254_fp_dbl( e, a );
+  fd_bn254_fp_add( e, e, a );
+  fd_bn254_fp_sqr( f, e );
+
+  fd_bn254_fp_mul( &r->Z, &p->Y, &p->Z );
+  fd_bn254_fp_dbl( &r->Z, &r->Z );
+  fd_bn254_fp_dbl( t, d );
+  fd_bn254_fp_sub( &r->X, f, t );
+  fd_bn254_fp_sub( t, d, &r->X );
+  fd_bn254_fp_mul( t, e, t );
+  fd_bn254_fp_dbl( c, c ); fd_bn254_fp_dbl( c, c ); fd_bn254_fp_dbl( c, c );
+  fd_bn254_fp_sub( &r->Y, t, c );
+  return r;
+}
+
+static fd_bn254_g1_t *
+fd_bn254_g1_add_private( fd_bn254_g1_t *       r,
+                         fd_bn254_g1_t const * p,
+                         fd_bn254_g1_t const * q ) {
+  if( fd_bn254_g1_is_inf( p ) ) { *r = *q; return r; }
+  if( fd_bn254_g1_is_inf( q ) ) { *r = *p; return r; }
+
+  /* add-2007-bl, https://hyperelliptic.org/EFD/g1p/auto-shortw-jacobian-0.html */
+  fd_bn254_fp_t z1z1[1], z2z2[1], u1[1], u2[1], s1[1], s2[1], h[1], i[1], j[1], rr[1], v[1], t[1];
+  fd_bn254_fp_sqr( z1z1, &p->Z );
+  fd_bn254_fp_sqr( z2z2, &q->Z );
+  fd_bn254_fp_mul( u1, &p->X, z2z2 );
+  fd_bn254_fp_mul( u2, &q->X, z1z1 );
+  fd_bn254_fp_mul( s1, &p->Y, &q->Z );
+  fd_bn254_fp_mul( s1, s1, z2z2 );
+  fd_bn254_fp_mul( s2, &q->Y, &p->Z );
+  fd_bn254_fp_mul( s2, s2, z1z1 );
+  fd_bn254_fp_sub( h, u2, u1 );
+  fd_bn254_fp_sub( rr, s2, s1 );
+  if( FD_UNLIKELY( fd_bn254_fp_is_zero( h ) ) ) {
+    if( fd_bn254_fp_is_zero( rr ) ) return fd_bn254_g1_dbl( r, p );
+    return fd_bn254_g1_set_inf( r );
+  }
+  fd_bn254_fp_dbl( rr, rr );
+  fd_bn254_fp_dbl( i, h );
+  fd_bn254_fp_sqr( i, i );
+  fd_bn254_fp_mul( j, h, i );
+  fd_bn254_fp_mul( v, u1, i );
+
+  fd_bn254_fp_add( t, &p->Z, &q->Z );
+  fd_bn254_fp_sqr( t, t );
+  fd_bn254_fp_sub( t, t, z1z1 );
+  fd_bn254_fp_sub( t, t, z2z2 );
+  fd_bn254_fp_mul( &r->Z, t, h );
+
+  fd_bn254_fp_sqr( t, rr );
+  fd_bn254_fp_sub( t, t, j );
+  fd_bn254_fp_sub( t, t, v );
+  fd_bn254_fp_sub( &r->X, t, v );
+
+  fd_bn254_fp_sub( t, v, &r->X );
+  fd_bn254_fp_mul( t, rr, t );
+  fd_bn254_fp_mul( s1, s1, j );
+  fd_bn254_fp_dbl( s1, s1 );
+  fd_bn254_fp_sub( &r->Y, t, s1 );
+  return r;
+}
+
+/* fd_bn254_g1_scalar_mul computes r = [s] p, with s a big endian 256-bit
+   integer, using a fixed window of 4 bits. */
+
+static fd_bn254_g1_t *
+fd_bn254_g1_scalar_mul( fd_bn254_g1_t *       r,
+                        fd_bn254_g1_t const * p,
+                        uchar const           s[ 32 ] ) {
+  fd_bn254_g1_t tbl[ 16 ]; /* tbl[i] = [i] p */
+  fd_bn254_g1_set_inf( tbl );
+  tbl[1] = *p;
+  for( ulong i=2UL; i<16UL; i++ ) fd_bn254_g1_add_private( tbl+i, tbl+i-1, p );
+
+  fd_bn254_g1_t acc[1];
+  fd_bn254_g1_set_inf( acc );
+  for( ulong i=0UL; i<64UL; i++ ) {
+    if( i ) for( ulong j=0UL; j<4UL; j++ ) fd_bn254_g1_dbl( acc, acc );
+    ulong nib = (ulong)( s[ i>>1 ] >> ( (i&1UL) ? 0 : 4 ) ) & 0xfUL;
+    if( nib ) fd_bn254_g1_add_private( acc, acc, tbl+nib );
+  }
+  *r = *acc;
+  return r;
+}
+
+/* G2 ****************************************************************/
+
+static inline int
+fd_bn254_g2_is_inf( fd_bn254_g2_t const * p ) {
+  return fd_bn254_fp2_is_zero( &p->Z );
+}
+
+static inline fd_bn254_g2_t *
+fd_bn254_g2_set_inf( fd_bn254_g2_t * r ) {
+  fd_bn254_fp2_set_one ( &r->X );
+  fd_bn254_fp2_set_one ( &r->Y );
+  fd_bn254_fp2_set_zero( &r->Z );
+  return r;
+}
+
+static inline int
+fd_bn254_g2_on_curve( fd_bn254_fp2_t const * x,
+                      fd_bn254_fp2_t const * y ) {
+  fd_bn254_fp2_t l[1], r[1];
+  fd_bn254_fp2_sqr( l, y );
+  fd_bn254_fp2_sqr( r, x );
+  fd_bn254_fp2_mul( r, r, x );
+  fd_bn254_fp2_add( r, r, fd_bn254_const_twist_b );
+  return fd_bn254_fp2_eq( l, r );
+}
+
+static inline fd_bn254_fp2_t *
+fd_bn254_fp2_frombytes_be_nm( fd_bn254_fp2_t * r,
+                              uchar const      buf[ 64 ] ) {
+  if( FD_UNLIKELY( !fd_bn254_fp_frombytes_be_nm( &r->el[1], buf      ) ) ) return NULL;
+  if( FD_UNLIKELY( !fd_bn254_fp_frombytes_be_nm( &r->el[0], buf+32UL ) ) ) return NULL;
+  return r;
+}
+
+static inline uchar *
+fd_bn254_fp2_tobytes_be_nm( uchar                  out[ 64 ],
+                            fd_bn254_fp2_t const * a ) {
+  fd_bn254_fp_tobytes_be_nm( out,      &a->el[1] );
+  fd_bn254_fp_tobytes_be_nm( out+32UL, &a->el[0] );
+  return out;
+}
+
+static fd_bn254_g2_t *
+fd_bn254_g2_dbl( fd_bn254_g2_t *       r,
+                 fd_bn254_g2_t const * p ) {
+  /* dbl-2009-l */
+  fd_bn254_fp2_t a[1], b[1], c[1], d[1], e[1], f[1], t[1];
+  fd_bn254_fp2_sqr( a, &p->X );
+  fd_bn254_fp2_sqr( b, &p->Y );
+  fd_bn254_fp2_sqr( c, b );
+  fd_bn254_fp2_add( d, &p->X, b );
+  fd_bn254_fp2_sqr( d, d );
+  fd_bn254_fp2_sub( d, d, a );
+  fd_bn254_fp2_sub( d, d, c );
+  fd_bn254_fp2_dbl( d, d );
+  fd_bn254_fp2_dbl( e, a );
+  fd_bn254_fp2_add( e, e, a );
+  fd_bn254_fp2_sqr( f, e );
+
+  fd_bn254_fp2_mul( &r->Z, &p->Y, &p->Z );
+  fd_bn254_fp2_dbl( &r->Z, &r->Z );
+  fd_bn254_fp2_dbl( t, d );
+  fd_bn254_fp2_sub( &r->X, f, t );
+  fd_bn254_fp2_sub( t, d, &r->X );
+  fd_bn254_fp2_mul( t, e, t );
+  fd_bn254_fp2_dbl( c, c ); fd_bn254_fp2_dbl( c, c ); fd_bn254_fp2_dbl( c, c );
+  fd_bn254_fp2_sub( &r->Y, t, c );
+  return r;
+}
+
+static fd_bn254_g2_t *
+fd_bn254_g2_add_private( fd_bn254_g2_t *       r,
+                         fd_bn254_g2_t const * p,
+                         fd_bn254_g2_t const * q ) {
+  if( fd_bn254_g2_is_inf( p ) ) { *r = *q; return r; }
+  if( fd_bn254_g2_is_inf( q ) ) { *r = *p; return r; }
+
+  /* add-2007-bl */
+  fd_bn254_fp2_t z1z1[1], z2z2[1], u1[1], u2[1], s1[1], s2[1], h[1], i[1], j[1], rr[1], v[1], t[1];
+  fd_bn254_fp2_sqr( z1z1, &p->Z );
+  fd_bn254_fp2_sqr( z2z2, &q->Z );
+  fd_bn254_fp2_mul( u1, &p->X, z2z2 );
+  fd_bn254_fp2_mul( u2, &q->X, z1z1 );
+  fd_bn254_fp2_mul( s1, &p->Y, &q->Z );
+  fd_bn254_fp2_mul( s1, s1, z2z2 );
+  fd_bn254_fp2_mul( s2, &q->Y, &p->Z );
+  fd_bn254_fp2_mul( s2, s2, z1z1 );
+  fd_bn254_fp2_sub( h, u2, u1 );
+  fd_bn254_fp2_sub( rr, s2, s1 );
+  if( FD_UNLIKELY( fd_bn254_fp2_is_zero( h ) ) ) {
+    if( fd_bn254_fp2_is_zero( rr ) ) return fd_bn254_g2_dbl( r, p );
+    return fd_bn254_g2_set_inf( r );
+  }
+  fd_bn254_fp2_dbl( rr, rr );
+  fd_bn254_fp2_dbl( i, h );
+  fd_bn254_fp2_sqr( i, i );
+  fd_bn254_fp2_mul( j, h, i );
+  fd_bn254_fp2_mul( v, u1, i );
+
+  fd_bn254_fp2_add( t, &p->Z, &q->Z );
+  fd_bn254_fp2_sqr( t, t );
+  fd_bn254_fp2_sub( t, t, z1z1 );
+  fd_bn254_fp2_sub( t, t, z2z2 );
+  fd_bn254_fp2_mul( &r->Z, t, h );
+
+  fd_bn254_fp2_sqr( t, rr );
+  fd_bn254_fp2_sub( t, t, j );
+  fd_bn254_fp2_sub( t, t, v );
+  fd_bn254_fp2_sub( &r->X, t, v );
+
+  fd_bn254_fp2_sub( t, v, &r->X );
+  fd_bn254_fp2_mul( t, rr, t );
+  fd_bn254_fp2_mul( s1, s1, j );
+  fd_bn254_fp2_dbl( s1, s1 );
+  fd_bn254_fp2_sub( &r->Y, t, s1 );
+  return r;
+}
+
+static int
+fd_bn254_g2_eq( fd_bn254_g2_t const * p,
+                fd_bn254_g2_t const * q ) {
+  int pi = fd_bn254_g2_is_inf( p );
+  int qi = fd_bn254_g2_is_inf( q );
+  if( pi | qi ) return pi & qi;
+
+  fd_bn254_fp2_t z1z1[1], z2z2[1], a[1], b[1];
+  fd_bn254_fp2_sqr( z1z1, &p->Z );
+  fd_bn254_fp2_sqr( z2z2, &q->Z );
+  fd_bn254_fp2_mul( a, &p->X, z2z2 );
+  fd_bn254_fp2_mul( b, &q->X, z1z1 );
+  if( !fd_bn254_fp2_eq( a, b ) ) return 0;
+  fd_bn254_fp2_mul( a, &p->Y, z2z2 );
+  fd_bn254_fp2_mul( a, a, &q->Z );
+  fd_bn254_fp2_mul( b, &q->Y, z1z1 );
+  fd_bn254_fp2_mul( b, b, &p->Z );
+  return fd_bn254_fp2_eq( a, b );
+}
+
+/* fd_bn254_g2_frob computes r = psi(p), the untwist-Frobenius-twist
+   endomorphism (x,y) -> (conj(x) xi^((p-1)/3), conj(y) xi^((p-1)/2)). */
+
+static fd_bn254_g2_t *
+fd_bn254_g2_frob( fd_bn254_g2_t *       r,
+                  fd_bn254_g2_t const * p ) {
+  fd_bn254_fp2_conj( &r->X, &p->X );
+  fd_bn254_fp2_conj( &r->Y, &p->Y );
+  fd_bn254_fp2_conj( &r->Z, &p->Z );
+  fd_bn254_fp2_mul( &r->X, &r->X, &fd_bn254_const_gamma1[1] );
+  fd_bn254_fp2_mul( &r->Y, &r->Y, &fd_bn254_const_gamma1[2] );
+  return r;
+}
+
+/* fd_bn254_g2_in_subgroup returns 1 if p, a point on the twist, is in
+   the order r subgroup G2.  This uses psi(p) == [6u^2] p, which only
+   holds on G2 (El Housni, Guillevic and Piellard, "Co-factor clearing
+   and subgroup membership testing on pairing-friendly curves"), and
+   costs about half of checking [r] p == 0. */
+
+static int
+fd_bn254_g2_in_subgroup( fd_bn254_g2_t const * p ) {
+  fd_bn254_g2_t acc[1], psi[1];
+  *acc = *p;
+  for( int i=fd_ulong_find_msb( fd_bn254_const_6u2[1] )+64-1; i>=0; i-- ) {
+    fd_bn254_g2_dbl( acc, acc );
+    if( (fd_bn254_const_6u2[ i>>6 ] >> (i&63)) & 1UL ) fd_bn254_g2_add_private( acc, acc, p );
+  }
+  fd_bn254_g2_frob( psi, p );
+  return fd_bn254_g2_eq( acc, psi );
+}
+
+/* fd_bn254_g2_frombytes_affine decodes the 128 byte G2 point at buf
+   into the affine coordinates (x,y), checking that it is in G2.
+   Returns 1 on success, 0 if the point is the point at infinity
+   (x and y are not set), and -1 if buf is not a valid point. */
+
+static int
+fd_bn254_g2_frombytes_affine( fd_bn254_fp2_t * x,
+                              fd_bn254_fp2_t * y,
+                              uchar const      buf[ 128 ] ) {
+  if( fd_bn254_is_zero_bytes( buf, 128UL ) ) return 0;
+  if( FD_UNLIKELY( !fd_bn254_fp2_frombytes_be_nm( x, buf      ) ) ) return -1;
+  if( FD_UNLIKELY( !fd_bn254_fp2_frombytes_be_nm( y, buf+64UL ) ) ) return -1;
+  if( FD_UNLIKELY( !fd_bn254_g2_on_curve( x, y ) ) ) return -1;
+  fd_bn254_g2_t p[1] = {{ .X = *x, .Y = *y }};
+  fd_bn254_fp2_set_one( &p->Z );
+  if( FD_UNLIKELY( !fd_bn254_g2_in_subgroup( p ) ) ) return -1;
+  return 1;
+}
+
+/* Pairing ***********************************************************/
+
+/* The optimal ate pairing, with the Miller loop in homogeneous
+   projective coordinates on the twist, and the line functions of
+   Costello, Lange and Naehrig, "Faster pairing computations on curves
+   with high-degree twists", as in Aranha et al., "High-speed software
+   implementation of the optimal ate pairing over Barreto-Naehrig
+   curves".  A line evaluated at P is l0 + l1 w + l3 w^3. */
+
+#define FD_BN254_PAIRING_BATCH_MAX (16UL)
+
+struct fd_bn254_pairing_pair {
+  fd_bn254_fp_t  px, py;     /* P in G1, affine */
+  fd_bn254_fp2_t qx, qy;     /* Q in G2, affine */
+  fd_bn254_fp2_t tx, ty, tz; /* T, homogeneous projective */
+};
+typedef struct fd_bn254_pairing_pair fd_bn254_pairing_pair_t;
+
+static inline void
+fd_bn254_miller_dbl( fd_bn254_fp12_t *         f,
+                     fd_bn254_pairing_pair_t * s ) {
+  fd_bn254_fp2_t a[1], b[1], c[1], e[1], ff[1], g[1], h[1], x2[1], t[1];
+  fd_bn254_fp2_t l0[1], l1[1], l3[1];
+
+  fd_bn254_fp2_mul( a, &s->tx, &s->ty );
+  fd_bn254_fp2_mul_fp( a, a, fd_bn254_const_half );
+  fd_bn254_fp2_sqr( b, &s->ty );
+  fd_bn254_fp2_sqr( c, &s->tz );
+  fd_bn254_fp2_mul( e, c, fd_bn254_const_twist_b3 );
+  fd_bn254_fp2_dbl( ff, e );
+  fd_bn254_fp2_add( ff, ff, e );
+  fd_bn254_fp2_add( g, b, ff );
+  fd_bn254_fp2_mul_fp( g, g, fd_bn254_const_half );
+  fd_bn254_fp2_add( h, &s->ty, &s->tz );
+  fd_bn254_fp2_sqr( h, h );
+  fd_bn254_fp2_sub( h, h, b );
+  fd_bn254_fp2_sub( h, h, c );
+  fd_bn254_fp2_sqr( x2, &s->tx );
+
+  /* l0 = -H yP, l1 = 3 X^2 xP, l3 = E - B */
+  fd_bn254_fp2_mul_fp( l0, h, &s->py );
+  fd_bn254_fp2_neg( l0, l0 );
+  fd_bn254_fp2_dbl( l1, x2 );
+  fd_bn254_fp2_add( l1, l1, x2 );
+  fd_bn254_fp2_mul_fp( l1, l1, &s->px );
+  fd_bn254_fp2_sub( l3, e, b );
+
+  /* X3 = A (B - F), Y3 = G^2 - 3 E^2, Z3 = B H */
+  fd_bn254_fp2_sub( t, b, ff );
+  fd_bn254_fp2_mul( &s->tx, a, t );
+  fd_bn254_fp2_sqr( t, e );
+  fd_bn254_fp2_dbl( a, t );
+  fd_bn254_fp2_add( a, a, t );
+  fd_bn254_fp2_sqr( &s->ty, g );
+  fd_bn254_fp2_sub( &s->ty, &s->ty, a );
+  fd_bn254_fp2_mul( &s->tz, b, h );
+
+  fd_bn254_fp12_mul_sparse( f, f, l0, l1, l3 );
+}
+
+/* fd_bn254_miller_add adds the affine point (x2,y2) to T. */
+
+static inline void
+fd_bn254_miller_add( fd_bn254_fp12_t *         f,
+                     fd_bn254_pairing_pair_t * s,
+                     fd_bn254_fp2_t const *    x2,
+                     fd_bn254_fp2_t const *    y2 ) {
+  fd_bn254_fp2_t th[1], la[1], c[1], d[1], e[1], ff[1], g[1], h[1], t[1];
+  fd_bn254_fp2_t l0[1], l1[1], l3[1];
+
+  fd_bn254_fp2_mul( t, y2, &s->tz );
+  fd_bn254_fp2_sub( th, &s->ty, t );
+  fd_bn254_fp2_mul( t, x2, &s->tz );
+  fd_bn254_fp2_sub( la, &s->tx, t );
+
+  /* l0 = lambda yP, l1 = -theta xP, l3 = theta x2 - lambda y2 */
+  fd_bn254_fp2_mul_fp( l0, la, &s->py );
+  fd_bn254_fp2_mul_fp( l1, th, &s->px );
+  fd_bn254_fp2_neg( l1, l1 );
+  fd_bn254_fp2_mul( l3, th, x2 );
+  fd_bn254_fp2_mul( t, la, y2 );
+  fd_bn254_fp2_sub( l3, l3, t );
+
+  fd_bn254_fp2_sqr( c, th );
+  fd_bn254_fp2_sqr( d, la );
+  fd_bn254_fp2_mul( e, la, d );
+  fd_bn254_fp2_mul( ff, &s->tz, c );
+  fd_bn254_fp2_mul( g, &s->tx, d );
+  fd_bn254_fp2_add( h, e, ff );
+  fd_bn254_fp2_sub( h, h, g );
+  fd_bn254_fp2_sub( h, h, g );
+
+  /* X3 = lambda H, Y3 = theta (G - H) - Y E, Z3 = Z E */
+  fd_bn254_fp2_mul( &s->tx, la, h );
+  fd_bn254_fp2_sub( t, g, h );
+  fd_bn254_fp2_mul( t, th, t );
+  fd_bn254_fp2_mul( g, &s->ty, e );
+  fd_bn254_fp2_sub( &s->ty, t, g );
+  fd_bn254_fp2_mul( &s->tz, &s->tz, e );
+
+  fd_bn254_fp12_mul_sparse( f, f, l0, l1, l3 );
+}
+
+/* fd_bn254_miller_loop multiplies f by the Miller loop of the optimal
+   ate pairing of every pair, sharing the squarings of f. */
+
+static void
+fd_bn254_miller_loop( fd_bn254_fp12_t *         f,
+                      fd_bn254_pairing_pair_t * pair,
+                      ulong                     cnt ) {
+  fd_bn254_fp12_t acc[1];
+  fd_bn254_fp12_set_one( acc );
+  for( ulong k=0UL; k<cnt; k++ ) {
+    pair[ k ].tx = pair[ k ].qx;
+    pair[ k ].ty = pair[ k ].qy;
+    fd_bn254_fp2_set_one( &pair[ k ].tz );
+  }
+
+  for( ulong i=0UL; i<sizeof(fd_bn254_const_ate_naf); i++ ) {
+    fd_bn254_fp12_sqr( acc, acc );
+    for( ulong k=0UL; k<cnt; k++ ) {
+      fd_bn254_miller_dbl( acc, pair+k );
+      if( fd_bn254_const_ate_naf[ i ]==1 ) {
+        fd_bn254_miller_add( acc, pair+k, &pair[ k ].qx, &pair[ k ].qy );
+      } else if( fd_bn254_const_ate_naf[ i ]==-1 ) {
+        fd_bn254_fp2_t nqy[1];
+        fd_bn254_fp2_neg( nqy, &pair[ k ].qy );
+        fd_bn254_miller_add( acc, pair+k, &pair[ k ].qx, nqy );
+      }
+    }
+  }
+
+  /* T += psi(Q), T -= psi^2(Q) */
+  for( ulong k=0UL; k<cnt; k++ ) {
+    fd_bn254_fp2_t x[1], y[1];
+    fd_bn254_fp2_conj( x, &pair[ k ].qx );
+    fd_bn254_fp2_mul ( x, x, &fd_bn254_const_gamma1[1] );
+    fd_bn254_fp2_conj( y, &pair[ k ].qy );
+    fd_bn254_fp2_mul ( y, y, &fd_bn254_const_gamma1[2] );
+    fd_bn254_miller_add( acc, pair+k, x, y );
+
+    fd_bn254_fp2_mul_fp( x, &pair[ k ].qx, &fd_bn254_const_gamma2[1] );
+    fd_bn254_fp2_mul_fp( y, &pair[ k ].qy, &fd_bn254_const_gamma2[2] );
+    fd_bn254_fp2_neg   ( y, y );
+    fd_bn254_miller_add( acc, pair+k, x, y );
+  }
+
+  fd_bn254_fp12_mul( f, f, acc );
+}
+
+/* fd_bn254_fp12_pow_u computes r = a^u, for a in the cyclotomic
+   subgroup. */
+
+static fd_bn254_fp12_t *
+fd_bn254_fp12_pow_u( fd_bn254_fp12_t *       r,
+                     fd_bn254_fp12_t const * a ) {
+  fd_bn254_fp12_t t[1];
+  *t = *a;
+  for( int i=fd_ulong_find_msb( FD_BN254_CONST_U )-1; i>=0; i-- ) {
+    fd_bn254_fp12_sqr_cyclotomic( t, t );
+    if( (FD_BN254_CONST_U >> i) & 1UL ) fd_bn254_fp12_mul( t, t, a );
+  }
+  *r = *t;
+  return r;
+}
+
+/* fd_bn254_final_exp computes r = f^((p^12-1)/r).  The hard part uses
+   the addition chain of Scott et al., "On the final exponentiation for
+   calculating pairings on ordinary elliptic curves". */
+
+static fd_bn254_fp12_t *
+fd_bn254_final_exp( fd_bn254_fp12_t *       r,
+                    fd_bn254_fp12_t const * f ) {
+  fd_bn254_fp12_t t0[1], t1[1], fp[1], fp2[1], fp3[1], fu[1], fu2[1], fu3[1];
+  fd_bn254_fp12_t y0[1], y1[1], y2[1], y3[1], y4[1], y5[1], y6[1];
+
+  /* Easy part: f^((p^6-1)(p^2+1)) */
+  fd_bn254_fp12_inv ( t0, f );
+  fd_bn254_fp12_conj( t1, f );
+  fd_bn254_fp12_mul ( t1, t1, t0 );
+  fd_bn254_fp12_frob2( t0, t1 );
+  fd_bn254_fp12_mul ( t1, t1, t0 );
+
+  /* Hard part: f^((p^4-p^2+1)/r) */
+  fd_bn254_fp12_frob  ( fp,  t1  );
+  fd_bn254_fp12_frob2 ( fp2, t1  );
+  fd_bn254_fp12_frob  ( fp3, fp2 );
+  fd_bn254_fp12_pow_u ( fu,  t1  );
+  fd_bn254_fp12_pow_u ( fu2, fu  );
+  fd_bn254_fp12_pow_u ( fu3, fu2 );
+
+  fd_bn254_fp12_frob ( y3, fu  );
+  fd_bn254_fp12_frob ( y4, fu2 ); /* fu2^p */
+  fd_bn254_fp12_frob ( y6, fu3 ); /* fu3^p */
+  fd_bn254_fp12_frob2( y2, fu2 );
+
+  fd_bn254_fp12_mul ( y0, fp, fp2 );
+  fd_bn254_fp12_mul ( y0, y0, fp3 );
+  fd_bn254_fp12_conj( y1, t1 );
+  fd_bn254_fp12_conj( y5, fu2 );
+  fd_bn254_fp12_conj( y3, y3 );
+  fd_bn254_fp12_mul ( y4, fu, y4 );
+  fd_bn254_fp12_conj( y4, y4 );
+  fd_bn254_fp12_mul ( y6, fu3, y6 );
+  fd_bn254_fp12_conj( y6, y6 );
+
+  fd_bn254_fp12_sqr_cyclotomic( t0, y6 );
+  fd_bn254_fp12_mul( t0, t0, y4 );
+  fd_bn254_fp12_mul( t0, t0, y5 );
+  fd_bn254_fp12_mul( t1, y3, y5 );
+  fd_bn254_fp12_mul( t1, t1, t0 );
+  fd_bn254_fp12_mul( t0, t0, y2 );
+  fd_bn254_fp12_sqr_cyclotomic( t1, t1 );
+  fd_bn254_fp12_mul( t1, t1, t0 );
+  fd_bn254_fp12_sqr_cyclotomic( t1, t1 );
+  fd_bn254_fp12_mul( t0, t1, y1 );
+  fd_bn254_fp12_mul( t1, t1, y0 );
+  fd_bn254_fp12_sqr_cyclotomic( t0, t0 );
+  fd_bn254_fp12_mul( r, t0, t1 );
+  return r;
+}
+
+/* Public API ********************************************************/
+
+int
+fd_bn254_g1_check( fd_bn254_point_g1_t const * p ) {
+  fd_bn254_g1_t t[1];
+  return !!fd_bn254_g1_frombytes( t, p->v );
+}
+
+void
+fd_bn254_g1_compress( fd_bn254_point_g1_t const * in, fd_bn254_point_g1_compressed_t * out ) {
+  /* Just pick off the X coordinate */
+  fd_memcpy( out->v, in->v, 32UL );
+  /* Use the flag to indicate whether Y is odd */
+  if( in->v[ 63 ] & 1 ) out->v[0] |= (uchar)0x80;
+}
+
+fd_bn254_point_g1_t *
+fd_bn254_g1_decompress( fd_bn254_point_g1_compressed_t const * in, fd_bn254_point_g1_t * out ) {
+  if( fd_bn254_is_zero_bytes( in->v, 32UL ) ) {
+    fd_memset( out->v, 0, 64UL );
+    return out;
+  }
+
+  uchar buf[ 32 ];
+  fd_memcpy( buf, in->v, 32UL );
+  int odd = !!(buf[0] & 0x80);
+  buf[0] &= (uchar)0x7f;
+
+  /* Recover Y from X */
+  fd_bn254_fp_t x[1], y[1];
+  if( FD_UNLIKELY( !fd_bn254_fp_frombytes_be_nm( x, buf ) ) ) return NULL;
+  fd_bn254_fp_sqr( y, x );
+  fd_bn254_fp_mul( y, y, x );
+  fd_bn254_fp_add( y, y, fd_bn254_const_b );
+  if( FD_UNLIKELY( !fd_bn254_fp_sqrt( y, y ) ) ) return NULL;
+  if( fd_bn254_fp_is_odd( y )!=odd ) fd_bn254_fp_neg( y, y );
+
+  fd_bn254_fp_tobytes_be_nm( out->v,      x );
+  fd_bn254_fp_tobytes_be_nm( out->v+32UL, y );
+  return out;
+}
+
+int
+fd_bn254_g2_check( fd_bn254_point_g2_t const * p ) {
+  fd_bn254_fp2_t x[1], y[1];
+  return fd_bn254_g2_frombytes_affine( x, y, p->v )>=0;
+}
+
+void
+fd_bn254_g2_compress( fd_bn254_point_g2_t const * in, fd_bn254_point_g2_compressed_t * out ) {
+  /* Just pick off the X coordinate */
+  fd_memcpy( out->v, in->v, 64UL );
+  /* Use the flag to indicate whether Y.c1 is odd */
+  if( in->v[ 95 ] & 1 ) out->v[0] |= (uchar)0x80;
+}
+
+fd_bn254_point_g2_t *
+fd_bn254_g2_decompress( fd_bn254_point_g2_compressed_t const * in, fd_bn254_point_g2_t * out ) {
+  if( fd_bn254_is_zero_bytes( in->v, 64UL ) ) {
+    fd_memset( out->v, 0, 128UL );
+    return out;
+  }
+
+  uchar buf[ 64 ];
+  fd_memcpy( buf, in->v, 64UL );
+  int odd = !!(buf[0] & 0x80);
+  buf[0] &= (uchar)0x7f;
+
+  /* Recover Y from X */
+  fd_bn254_fp2_t x[1], y[1];
+  if( FD_UNLIKELY( !fd_bn254_fp2_frombytes_be_nm( x, buf ) ) ) return NULL;
+  fd_bn254_fp2_sqr( y, x );
+  fd_bn254_fp2_mul( y, y, x );
+  fd_bn254_fp2_add( y, y, fd_bn254_const_twist_b );
+  if( FD_UNLIKELY( !fd_bn254_fp2_sqrt( y, y ) ) ) return NULL;
+  if( fd_bn254_fp_is_odd( &y->el[1] )!=odd ) fd_bn254_fp2_neg( y, y );
+
+  fd_bn254_fp2_tobytes_be_nm( out->v,      x );
+  fd_bn254_fp2_tobytes_be_nm( out->v+64UL, y );
+  return out;
+}
+
+fd_bn254_point_g1_t *
+fd_bn254_g1_add( fd_bn254_point_g1_t const * x, fd_bn254_point_g1_t const * y, fd_bn254_point_g1_t * z ) {
+  fd_bn254_g1_t a[1], b[1];
+  if( FD_UNLIKELY( !fd_bn254_g1_frombytes( a, x->v ) ) ) return NULL;
+  if( FD_UNLIKELY( !fd_bn254_g1_frombytes( b, y->v ) ) ) return NULL;
+  fd_bn254_g1_add_private( a, a, b );
+  fd_bn254_g1_tobytes( z->v, a );
+  return z;
+}
+
+fd_bn254_point_g1_t *
+fd_bn254_g1_mult( fd_bn254_point_g1_t const * x, fd_bn254_bigint_t const * y, fd_bn254_point_g1_t * z ) {
+  fd_bn254_g1_t a[1];
+  if( FD_UNLIKELY( !fd_bn254_g1_frombytes( a, x->v ) ) ) return NULL;
+  fd_bn254_g1_scalar_mul( a, a, y->v );
+  fd_bn254_g1_tobytes( z->v, a );
+  return z;
+}
+
+int
+fd_bn254_pairing_batch( uchar const * in, ulong cnt ) {
+  fd_bn254_pairing_pair_t pair[ FD_BN254_PAIRING_BATCH_MAX ];
+  fd_bn254_fp12_t f[1];
+  fd_bn254_fp12_set_one( f );
+
+  ulong pair_cnt = 0UL;
+  for( ulong i=0UL; i<cnt; i++ ) {
+    uchar const * g1 = in + i*FD_BN254_PAIRING_ELEMENT_FOOTPRINT;
+    uchar const * g2 = g1 + FD_BN254_G1_FOOTPRINT;
+
+    fd_bn254_g1_t p[1];
+    if( FD_UNLIKELY( !fd_bn254_g1_frombytes( p, g1 ) ) ) return -1;
+    int q_ok = fd_bn254_g2_frombytes_affine( &pair[ pair_cnt ].qx, &pair[ pair_cnt ].qy, g2 );
+    if( FD_UNLIKELY( q_ok<0 ) ) return -1;
+
+    /* e(P,0) = e(0,Q) = 1 */
+    if( fd_bn254_g1_is_inf( p ) | !q_ok ) continue;
+    pair[ pair_cnt ].px = p->X;
+    pair[ pair_cnt ].py = p->Y;
+    pair_cnt++;
+
+    if( pair_cnt==FD_BN254_PAIRING_BATCH_MAX ) {
+      fd_bn254_miller_loop( f, pair, pair_cnt );
+      pair_cnt = 0UL;
+    }
+  }
+  if( pair_cnt ) fd_bn254_miller_loop( f, pair, pair_cnt );
+
+  fd_bn254_final_exp( f, f );
+  return fd_bn254_fp12_is_one( f );
+}
+
+int
+fd_bn254_pairing( fd_bn254_point_g1_t const * p_1, fd_bn254_point_g2_t const * q_1,
+                  fd_bn254_point_g1_t const * p_2, fd_bn254_point_g2_t const * q_2 ) {
+  uchar in[ 2UL*FD_BN254_PAIRING_ELEMENT_FOOTPRINT ];
+  fd_memcpy( in,                                                        p_1->v, FD_BN254_G1_FOOTPRINT );
+  fd_memcpy( in+FD_BN254_G1_FOOTPRINT,                                  q_1->v, FD_BN254_G2_FOOTPRINT );
+  fd_memcpy( in+FD_BN254_PAIRING_ELEMENT_FOOTPRINT,                     p_2->v, FD_BN254_G1_FOOTPRINT );
+  fd_memcpy( in+FD_BN254_PAIRING_ELEMENT_FOOTPRINT+FD_BN254_G1_FOOTPRINT, q_2->v, FD_BN254_G2_FOOTPRINT );
+  return fd_bn254_pairing_batch( in, 2UL )==1;
+}
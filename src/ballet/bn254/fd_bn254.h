@@ -1,7 +1,19 @@
 #ifndef HEADER_fd_src_ballet_bn254_fd_bn254_h
 #define HEADER_fd_src_ballet_bn254_fd_bn254_h
 
-/* fd_bn254 implements utility functions for the bn254 (alt_bn128) curve. It currently wraps libff. */
+/* fd_bn254 implements the operations on the bn254 (alt_bn128) curve
+   needed by the alt_bn128 syscalls: G1 validation, addition and scalar
+   multiplication, G2 validation, point compression, and the optimal ate
+   pairing.  The field arithmetic is the formally verified Montgomery
+   arithmetic of fiat-crypto.
+
+   Points are encoded like the syscalls (and EIP-196/197) do: field
+   elements are 32-byte big endian integers less than the base field
+   modulus, a G1 point is x || y, a G2 point is x.c1 || x.c0 || y.c1 ||
+   y.c0 (imaginary part first), and the point at infinity is all zeros.
+
+   None of the functions below are constant time, their inputs are
+   assumed to be public. */
 
 #include "../fd_ballet_base.h"
 
@@ -14,6 +26,11 @@ FD_PROTOTYPES_BEGIN
 #define FD_BN254_G2_COMPRESSED_FOOTPRINT (64UL)
 #define FD_BN254_BIGINT_FOOTPRINT        (32UL)
 
+/* FD_BN254_PAIRING_ELEMENT_FOOTPRINT is the size of one (G1,G2) pair in
+   the input of fd_bn254_pairing_batch. */
+
+#define FD_BN254_PAIRING_ELEMENT_FOOTPRINT (FD_BN254_G1_FOOTPRINT+FD_BN254_G2_FOOTPRINT)
+
 struct __attribute__((aligned(FD_BN254_ALIGN))) fd_bn254_point_g1 {
   uchar v[ FD_BN254_G1_FOOTPRINT ];
 };
@@ -39,34 +56,56 @@ struct __attribute__((aligned(FD_BN254_ALIGN))) fd_bn254_bigint {
 };
 typedef struct fd_bn254_bigint fd_bn254_bigint_t;
 
-/* Return true if the point is on the curve */
+/* Return true if the point is on the curve (or is the point at
+   infinity) */
 int fd_bn254_g1_check( fd_bn254_point_g1_t const * p );
 
-/* Extract the X coordinate from the point */
+/* Extract the X coordinate from the point.  The top bit of the result
+   is set if Y is odd. */
 void fd_bn254_g1_compress( fd_bn254_point_g1_t const * in, fd_bn254_point_g1_compressed_t * out );
 
-/* Recover the X,Y pair from X */
-void fd_bn254_g1_decompress( fd_bn254_point_g1_compressed_t const * in, fd_bn254_point_g1_t * out );
+/* Recover the X,Y pair from X.  Returns out, or NULL if X is not the X
+   coordinate of a point on the curve. */
+fd_bn254_point_g1_t * fd_bn254_g1_decompress( fd_bn254_point_g1_compressed_t const * in, fd_bn254_point_g1_t * out );
 
-/* Return true if the point is on the curve */
+/* Return true if the point is on the twist and in the order r subgroup
+   (or is the point at infinity) */
 int fd_bn254_g2_check( fd_bn254_point_g2_t const * p );
 
-/* Extract the X coordinate from the point */
+/* Extract the X coordinate from the point.  The top bit of the result
+   is set if Y.c1 is odd. */
 void fd_bn254_g2_compress( fd_bn254_point_g2_t const * in, fd_bn254_point_g2_compressed_t * out );
 
-/* Recover the X,Y pair from X */
-void fd_bn254_g2_decompress( fd_bn254_point_g2_compressed_t const * in, fd_bn254_point_g2_t * out );
+/* Recover the X,Y pair from X.  Returns out, or NULL if X is not the X
+   coordinate of a point on the twist. */
+fd_bn254_point_g2_t * fd_bn254_g2_decompress( fd_bn254_point_g2_compressed_t const * in, fd_bn254_point_g2_t * out );
 
-/* Add two points */
-void fd_bn254_g1_add( fd_bn254_point_g1_t const * x, fd_bn254_point_g1_t const * y, fd_bn254_point_g1_t * z );
+/* Add two points.  Returns z, or NULL if x or y is not a valid G1
+   point.  z may alias x or y. */
+fd_bn254_point_g1_t * fd_bn254_g1_add( fd_bn254_point_g1_t const * x, fd_bn254_point_g1_t const * y, fd_bn254_point_g1_t * z );
 
-/* Multiply a point by an integer */
-void fd_bn254_g1_mult( fd_bn254_point_g1_t const * x, fd_bn254_bigint_t const * y, fd_bn254_point_g1_t * z );
+/* Multiply a point by a big endian 256-bit integer (not necessarily
+   reduced mod r).  Returns z, or NULL if x is not a valid G1 point.  z
+   may alias x. */
+fd_bn254_point_g1_t * fd_bn254_g1_mult( fd_bn254_point_g1_t const * x, fd_bn254_bigint_t const * y, fd_bn254_point_g1_t * z );
 
-/* Return true if the points are a pairing */
+/* Return true if e(g1_1,g2_1) e(g1_2,g2_2) == 1, false if not or if
+   any of the points is invalid */
 int fd_bn254_pairing( fd_bn254_point_g1_t const * g1_1, fd_bn254_point_g2_t const * g2_1,
                       fd_bn254_point_g1_t const * g1_2, fd_bn254_point_g2_t const * g2_2);
 
+/* fd_bn254_pairing_batch computes the product of the pairings of the
+   cnt (G1,G2) pairs at in, each FD_BN254_PAIRING_ELEMENT_FOOTPRINT
+   bytes long (a G1 point followed by a G2 point, the format of the
+   alt_bn128 pairing syscall input; in has no alignment requirement).
+   Returns 1 if the product is one (in particular if cnt is zero), 0 if
+   not, and -1 if any of the points is invalid.
+
+   All the pairs share a single Miller loop and a single final
+   exponentiation, so checking a product of n pairings costs much less
+   than n pairings. */
+int fd_bn254_pairing_batch( uchar const * in, ulong cnt );
+
 FD_PROTOTYPES_END
 
 #endif /* HEADER_fd_src_ballet_bn254_fd_bn254_h */
@@ -0,0 +1,955 @@
+#ifndef HEADER_fd_src_ballet_bn254_fd_bn254_h
+#error "Do not include this directly; use fd_bn254.h"
+#endif
+
+/* fd_bn254_field implements the tower of fields of the bn254 pairing:
+
+     Fp   integers mod p, with p the bn254 base field modulus
+     Fp2  Fp[i]/(i^2+1)
+     Fp6  Fp2[v]/(v^3-xi), with xi=9+i
+     Fp12 Fp6[w]/(w^2-v)
+
+   Fp elements are kept in the Montgomery domain of the fiat-crypto
+   implementation, and are fully reduced at all times.  Every function
+   below allows its output to alias its inputs.
+
+   This file is included by fd_bn254.c, the functions are private to
+   it. */
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wsign-conversion"
+#include "../fiat-crypto/bn254_64.c"
+#pragma GCC diagnostic pop
+
+struct fd_bn254_fp {
+  ulong el[4];
+};
+typedef struct fd_bn254_fp fd_bn254_fp_t;
+
+struct fd_bn254_fp2 {
+  fd_bn254_fp_t el[2];
+};
+typedef struct fd_bn254_fp2 fd_bn254_fp2_t;
+
+struct fd_bn254_fp6 {
+  fd_bn254_fp2_t el[3];
+};
+typedef struct fd_bn254_fp6 fd_bn254_fp6_t;
+
+struct fd_bn254_fp12 {
+  fd_bn254_fp6_t el[2];
+};
+typedef struct fd_bn254_fp12 fd_bn254_fp12_t;
+
+/* Constants, in the Montgomery domain unless noted otherwise */
+
+static const fd_bn254_fp_t fd_bn254_const_one[1] = {{{
+  0xd35d438dc58f0d9dUL, 0x0a78eb28f5c70b3dUL, 0x666ea36f7879462cUL, 0x0e0a77c19a07df2fUL
+}}};
+
+/* 1/2 */
+static const fd_bn254_fp_t fd_bn254_const_half[1] = {{{
+  0x87bee7d24f060572UL, 0xd0fd2add2f1c6ae5UL, 0x8f5f7492fcfd4f44UL, 0x1f37631a3d9cbfacUL
+}}};
+
+/* R^3 mod p with R=2^256, as a plain integer (see fd_bn254_fp_inv) */
+static const fd_bn254_fp_t fd_bn254_const_r3[1] = {{{
+  0xb1cd6dafda1530dfUL, 0x62f210e6a7283db6UL, 0xef7f0b0c0ada0afbUL, 0x20fd6e902d592544UL
+}}};
+
+/* The modulus p and the exponents used for square roots, as plain
+   integers */
+static const ulong fd_bn254_const_p[4] = {
+  0x3c208c16d87cfd47UL, 0x97816a916871ca8dUL, 0xb85045b68181585dUL, 0x30644e72e131a029UL
+};
+static const ulong fd_bn254_const_p_plus_1_div_4[4] = {
+  0x4f082305b61f3f52UL, 0x65e05aa45a1c72a3UL, 0x6e14116da0605617UL, 0x0c19139cb84c680aUL
+};
+static const ulong fd_bn254_const_p_minus_3_div_4[4] = {
+  0x4f082305b61f3f51UL, 0x65e05aa45a1c72a3UL, 0x6e14116da0605617UL, 0x0c19139cb84c680aUL
+};
+static const ulong fd_bn254_const_p_minus_1_div_2[4] = {
+  0x9e10460b6c3e7ea3UL, 0xcbc0b548b438e546UL, 0xdc2822db40c0ac2eUL, 0x183227397098d014UL
+};
+
+/* Frobenius coefficients, gamma_k[j] = xi^(j (p^k-1)/6), j in [1,5].
+   gamma_2 is in Fp. */
+static const fd_bn254_fp2_t fd_bn254_const_gamma1[5] = {
+  {{ {{ 0xaf9ba69633144907UL, 0xca6b1d7387afb78aUL, 0x11bded5ef08a2087UL, 0x02f34d751a1f3a7cUL }},
+     {{ 0xa222ae234c492d72UL, 0xd00f02a4565de15bUL, 0xdc2ff3a253dfc926UL, 0x10a75716b3899551UL }} }},
+  {{ {{ 0xb5773b104563ab30UL, 0x347f91c8a9aa6454UL, 0x7a007127242e0991UL, 0x1956bcd8118214ecUL }},
+     {{ 0x6e849f1ea0aa4757UL, 0xaa1c7b6d89f89141UL, 0xb6e713cdfae0ca3aUL, 0x26694fbb4e82ebc3UL }} }},
+  {{ {{ 0xe4bbdd0c2936b629UL, 0xbb30f162e133bacbUL, 0x31a9d1b6f9645366UL, 0x253570bea500f8ddUL }},
+     {{ 0xa1d77ce45ffe77c7UL, 0x07affd117826d1dbUL, 0x6d16bd27bb7edc6bUL, 0x2c87200285defeccUL }} }},
+  {{ {{ 0x7361d77f843abe92UL, 0xa5bb2bd3273411fbUL, 0x9c941f314b3e2399UL, 0x15df9cddbb9fd3ecUL }},
+     {{ 0x5dddfd154bd8c949UL, 0x62cb29a5a4445b60UL, 0x37bc870a0c7dd2b9UL, 0x24830a9d3171f0fdUL }} }},
+  {{ {{ 0xc970692f41690fe7UL, 0xe240342127694b0bUL, 0x32bee66b83c459e8UL, 0x12aabced0ab08841UL }},
+     {{ 0x0d485d2340aebfa9UL, 0x05193418ab2fcc57UL, 0xd3b0a40b8a4910f5UL, 0x2f21ebb535d2925aUL }} }},
+};
+
+static const fd_bn254_fp_t fd_bn254_const_gamma2[5] = {
+  {{ 0xca8d800500fa1bf2UL, 0xf0c5d61468b39769UL, 0x0e201271ad0d4418UL, 0x04290f65bad856e6UL }},
+  {{ 0x3350c88e13e80b9cUL, 0x7dce557cdb5e56b9UL, 0x6001b4b8b615564aUL, 0x2682e617020217e0UL }},
+  {{ 0x68c3488912edefaaUL, 0x8d087f6872aabf4fUL, 0x51e1a24709081231UL, 0x2259d6b14729c0faUL }},
+  {{ 0x71930c11d782e155UL, 0xa6bb947cffbe3323UL, 0xaa303344d4741444UL, 0x2c3b3f0d26594943UL }},
+  {{ 0x08cfc388c494f1abUL, 0x19b315148d1373d4UL, 0x584e90fdcb6c0213UL, 0x09e1685bdf2f8849UL }},
+};
+
+static const fd_bn254_fp2_t fd_bn254_const_gamma3[5] = {
+  {{ {{ 0x365316184e46d97dUL, 0x0af7129ed4c96d9fUL, 0x659da72fca1009b5UL, 0x08116d8983a20d23UL }},
+     {{ 0xb1df4af7c39c1939UL, 0x3d9f02878a73bf7fUL, 0x9b2220928caf0ae0UL, 0x26684515eff054a6UL }} }},
+  {{ {{ 0xc9af22f716ad6badUL, 0xb311782a4aa662b2UL, 0x19eeaf64e248c7f4UL, 0x20273e77e3439f82UL }},
+     {{ 0xacc02860f7ce93acUL, 0x3933d5817ba76b4cUL, 0x69e6188b446c8467UL, 0x0a46036d4417cc55UL }} }},
+  {{ {{ 0x5764af0aaf46471eUL, 0xdc50792e873e0fc1UL, 0x86a673ff881d04f6UL, 0x0b2eddb43c30a74cUL }},
+     {{ 0x9a490f32787e8580UL, 0x8fd16d7ff04af8b1UL, 0x4b39888ec6027bf2UL, 0x03dd2e705b52a15dUL }} }},
+  {{ {{ 0x448a93a57b6762dfUL, 0xbfd62df528fdeadfUL, 0xd858f5d00e9bd47aUL, 0x06b03d4d3476ec58UL }},
+     {{ 0x2b19daf4bcc936d1UL, 0xa1a54e7a56f4299fUL, 0xb533eee05adeaef1UL, 0x170c812b84dda0b2UL }} }},
+  {{ {{ 0xe0bc4b2275cf559fUL, 0xc238b945c154e60fUL, 0x803982a5929a7d5eUL, 0x15ce052df7e4a37eUL }},
+     {{ 0x2d28efbdbf3799a7UL, 0x9b097e3c1ad60773UL, 0x982d4113af4a535bUL, 0x24e18991e3056063UL }} }},
+};
+
+/* Fp ****************************************************************/
+
+static inline fd_bn254_fp_t *
+fd_bn254_fp_set_zero( fd_bn254_fp_t * r ) {
+  r->el[0] = 0UL; r->el[1] = 0UL; r->el[2] = 0UL; r->el[3] = 0UL;
+  return r;
+}
+
+static inline fd_bn254_fp_t *
+fd_bn254_fp_set_one( fd_bn254_fp_t * r ) {
+  *r = *fd_bn254_const_one;
+  return r;
+}
+
+static inline int
+fd_bn254_fp_is_zero( fd_bn254_fp_t const * a ) {
+  return !( a->el[0] | a->el[1] | a->el[2] | a->el[3] );
+}
+
+static inline int
+fd_bn254_fp_eq( fd_bn254_fp_t const * a,
+                fd_bn254_fp_t const * b ) {
+  return !( (a->el[0]^b->el[0]) | (a->el[1]^b->el[1]) | (a->el[2]^b->el[2]) | (a->el[3]^b->el[3]) );
+}
+
+static inline fd_bn254_fp_t *
+fd_bn254_fp_add( fd_bn254_fp_t *       r,
+                 fd_bn254_fp_t const * a,
+                 fd_bn254_fp_t const * b ) {
+  fiat_bn254_add( r->el, a->el, b->el );
+  return r;
+}
+
+static inline fd_bn254_fp_t *
+fd_bn254_fp_sub( fd_bn254_fp_t *       r,
+                 fd_bn254_fp_t const * a,
+                 fd_bn254_fp_t const * b ) {
+  fiat_bn254_sub( r->el, a->el, b->el );
+  return r;
+}
+
+static inline fd_bn254_fp_t *
+fd_bn254_fp_neg( fd_bn254_fp_t *       r,
+                 fd_bn254_fp_t const * a ) {
+  fiat_bn254_opp( r->el, a->el );
+  return r;
+}
+
+static inline fd_bn254_fp_t *
+fd_bn254_fp_dbl( fd_bn254_fp_t *       r,
+                 fd_bn254_fp_t const * a ) {
+  fiat_bn254_add( r->el, a->el, a->el );
+  return r;
+}
+
+static inline fd_bn254_fp_t *
+fd_bn254_fp_mul( fd_bn254_fp_t *       r,
+                 fd_bn254_fp_t const * a,
+                 fd_bn254_fp_t const * b ) {
+  fiat_bn254_mul( r->el, a->el, b->el );
+  return r;
+}
+
+static inline fd_bn254_fp_t *
+fd_bn254_fp_sqr( fd_bn254_fp_t *       r,
+                 fd_bn254_fp_t const * a ) {
+  fiat_bn254_square( r->el, a->el );
+  return r;
+}
+
+/* fd_bn254_fp_pow computes r = a^e, with e a 256-bit little endian
+   integer.  Not constant time, only used with public exponents. */
+
+static fd_bn254_fp_t *
+fd_bn254_fp_pow( fd_bn254_fp_t *       r,
+                 fd_bn254_fp_t const * a,
+                 ulong const           e[ 4 ] ) {
+  fd_bn254_fp_t t[1];
+  fd_bn254_fp_set_one( t );
+  for( int i=255; i>=0; i-- ) {
+    fd_bn254_fp_sqr( t, t );
+    if( (e[ i>>6 ] >> (i&63)) & 1UL ) fd_bn254_fp_mul( t, t, a );
+  }
+  *r = *t;
+  return r;
+}
+
+/* Helpers for fd_bn254_fp_inv, on plain 256-bit integers */
+
+static inline int
+fd_bn254_u256_is_even( ulong const a[4] ) {
+  return !(a[0] & 1UL);
+}
+
+static inline int
+fd_bn254_u256_is_one( ulong const a[4] ) {
+  return !( (a[0]^1UL) | a[1] | a[2] | a[3] );
+}
+
+static inline int
+fd_bn254_u256_ge( ulong const a[4],
+                  ulong const b[4] ) {
+  for( int i=3; i>=0; i-- ) if( a[ i ]!=b[ i ] ) return a[ i ]>b[ i ];
+  return 1;
+}
+
+/* fd_bn254_u256_sub computes a -= b and returns the borrow. */
+
+static inline ulong
+fd_bn254_u256_sub( ulong       a[4],
+                   ulong const b[4] ) {
+  ulong borrow = 0UL;
+  for( ulong i=0UL; i<4UL; i++ ) {
+    uint128 d = (uint128)a[ i ] - (uint128)b[ i ] - (uint128)borrow;
+    a[ i ]  = (ulong)d;
+    borrow  = (ulong)(d>>64) & 1UL;
+  }
+  return borrow;
+}
+
+static inline void
+fd_bn254_u256_add( ulong       a[4],
+                   ulong const b[4] ) {
+  ulong carry = 0UL;
+  for( ulong i=0UL; i<4UL; i++ ) {
+    uint128 s = (uint128)a[ i ] + (uint128)b[ i ] + (uint128)carry;
+    a[ i ]  = (ulong)s;
+    carry   = (ulong)(s>>64);
+  }
+}
+
+static inline void
+fd_bn254_u256_shr1( ulong a[4] ) {
+  a[0] = (a[0]>>1) | (a[1]<<63);
+  a[1] = (a[1]>>1) | (a[2]<<63);
+  a[2] = (a[2]>>1) | (a[3]<<63);
+  a[3] =  a[3]>>1;
+}
+
+/* fd_bn254_u256_half_mod computes x = x/2 mod p in place, x in [0,p).
+   p < 2^254, so x+p does not overflow. */
+
+static inline void
+fd_bn254_u256_half_mod( ulong x[4] ) {
+  if( !fd_bn254_u256_is_even( x ) ) fd_bn254_u256_add( x, fd_bn254_const_p );
+  fd_bn254_u256_shr1( x );
+}
+
+/* fd_bn254_fp_inv computes r = 1/a.  r is zero if a is zero.
+
+   This uses the binary extended Euclidean algorithm (HAC 14.61) on the
+   Montgomery representation aR of a, which gives (aR)^-1 as a plain
+   integer, and a Montgomery multiplication by R^3 turns that into
+   a^-1 R, the Montgomery representation of 1/a.  This is several times
+   faster than a^(p-2), but not constant time, so it must only be used
+   on public inputs (all the inputs of this library are public). */
+
+static inline fd_bn254_fp_t *
+fd_bn254_fp_inv( fd_bn254_fp_t *       r,
+                 fd_bn254_fp_t const * a ) {
+  if( FD_UNLIKELY( fd_bn254_fp_is_zero( a ) ) ) return fd_bn254_fp_set_zero( r );
+
+  ulong u[4], v[4], x1[4] = { 1UL, 0UL, 0UL, 0UL }, x2[4] = { 0UL, 0UL, 0UL, 0UL };
+  fd_memcpy( u, a->el, sizeof(u) );
+  fd_memcpy( v, fd_bn254_const_p, sizeof(v) );
+
+  while( !fd_bn254_u256_is_one( u ) && !fd_bn254_u256_is_one( v ) ) {
+    while( fd_bn254_u256_is_even( u ) ) { fd_bn254_u256_shr1( u ); fd_bn254_u256_half_mod( x1 ); }
+    while( fd_bn254_u256_is_even( v ) ) { fd_bn254_u256_shr1( v ); fd_bn254_u256_half_mod( x2 ); }
+    if( fd_bn254_u256_ge( u, v ) ) {
+      fd_bn254_u256_sub( u, v );
+      if( fd_bn254_u256_sub( x1, x2 ) ) fd_bn254_u256_add( x1, fd_bn254_const_p );
+    } else {
+      fd_bn254_u256_sub( v, u );
+      if( fd_bn254_u256_sub( x2, x1 ) ) fd_bn254_u256_add( x2, fd_bn254_const_p );
+    }
+  }
+
+  fiat_bn254_mul( r->el, fd_bn254_u256_is_one( u ) ? x1 : x2, fd_bn254_const_r3->el );
+  return r;
+}
+
+/* fd_bn254_fp_sqrt computes a square root of a into r.  Returns r on
+   success and NULL if a is not a square. */
+
+static inline fd_bn254_fp_t *
+fd_bn254_fp_sqrt( fd_bn254_fp_t *       r,
+                  fd_bn254_fp_t const * a ) {
+  /* p = 3 mod 4 */
+  fd_bn254_fp_t t[1], t2[1];
+  fd_bn254_fp_pow( t, a, fd_bn254_const_p_plus_1_div_4 );
+  fd_bn254_fp_sqr( t2, t );
+  if( FD_UNLIKELY( !fd_bn254_fp_eq( t2, a ) ) ) return NULL;
+  *r = *t;
+  return r;
+}
+
+/* fd_bn254_fp_frombytes_be_nm deserializes the 32-byte big endian
+   integer at buf into r.  Returns r on success, and NULL if the integer
+   is not less than p. */
+
+static inline fd_bn254_fp_t *
+fd_bn254_fp_frombytes_be_nm( fd_bn254_fp_t * r,
+                             uchar const     buf[ 32 ] ) {
+  ulong t[4];
+  for( ulong i=0UL; i<4UL; i++ ) t[ i ] = fd_ulong_bswap( fd_ulong_load_8( buf + 8UL*(3UL-i) ) );
+
+  /* Compare with p, most significant limb first */
+  int lt = 0;
+  for( int i=3; i>=0; i-- ) {
+    if( t[ i ]!=fd_bn254_const_p[ i ] ) { lt = t[ i ]<fd_bn254_const_p[ i ]; break; }
+  }
+  if( FD_UNLIKELY( !lt ) ) return NULL;
+
+  fiat_bn254_to_montgomery( r->el, t );
+  return r;
+}
+
+/* fd_bn254_fp_tobytes_be_nm serializes a into the 32-byte big endian
+   buffer out and returns out. */
+
+static inline uchar *
+fd_bn254_fp_tobytes_be_nm( uchar                 out[ 32 ],
+                           fd_bn254_fp_t const * a ) {
+  ulong t[4];
+  fiat_bn254_from_montgomery( t, a->el );
+  for( ulong i=0UL; i<4UL; i++ ) FD_STORE( ulong, out + 8UL*(3UL-i), fd_ulong_bswap( t[ i ] ) );
+  return out;
+}
+
+/* fd_bn254_fp_is_odd returns 1 if the integer in [0,p) represented by
+   a is odd, 0 otherwise. */
+
+static inline int
+fd_bn254_fp_is_odd( fd_bn254_fp_t const * a ) {
+  ulong t[4];
+  fiat_bn254_from_montgomery( t, a->el );
+  return (int)(t[0] & 1UL);
+}
+
+/* Fp2 ***************************************************************/
+
+static inline fd_bn254_fp2_t *
+fd_bn254_fp2_set_zero( fd_bn254_fp2_t * r ) {
+  fd_bn254_fp_set_zero( &r->el[0] );
+  fd_bn254_fp_set_zero( &r->el[1] );
+  return r;
+}
+
+static inline fd_bn254_fp2_t *
+fd_bn254_fp2_set_one( fd_bn254_fp2_t * r ) {
+  fd_bn254_fp_set_one ( &r->el[0] );
+  fd_bn254_fp_set_zero( &r->el[1] );
+  return r;
+}
+
+static inline int
+fd_bn254_fp2_is_zero( fd_bn254_fp2_t const * a ) {
+  return fd_bn254_fp_is_zero( &a->el[0] ) & fd_bn254_fp_is_zero( &a->el[1] );
+}
+
+static inline int
+fd_bn254_fp2_eq( fd_bn254_fp2_t const * a,
+                 fd_bn254_fp2_t const * b ) {
+  return fd_bn254_fp_eq( &a->el[0], &b->el[0] ) & fd_bn254_fp_eq( &a->el[1], &b->el[1] );
+}
+
+static inline fd_bn254_fp2_t *
+fd_bn254_fp2_add( fd_bn254_fp2_t *       r,
+                  fd_bn254_fp2_t const * a,
+                  fd_bn254_fp2_t const * b ) {
+  fd_bn254_fp_add( &r->el[0], &a->el[0], &b->el[0] );
+  fd_bn254_fp_add( &r->el[1], &a->el[1], &b->el[1] );
+  return r;
+}
+
+static inline fd_bn254_fp2_t *
+fd_bn254_fp2_sub( fd_bn254_fp2_t *       r,
+                  fd_bn254_fp2_t const * a,
+                  fd_bn254_fp2_t const * b ) {
+  fd_bn254_fp_sub( &r->el[0], &a->el[0], &b->el[0] );
+  fd_bn254_fp_sub( &r->el[1], &a->el[1], &b->el[1] );
+  return r;
+}
+
+static inline fd_bn254_fp2_t *
+fd_bn254_fp2_neg( fd_bn254_fp2_t *       r,
+                  fd_bn254_fp2_t const * a ) {
+  fd_bn254_fp_neg( &r->el[0], &a->el[0] );
+  fd_bn254_fp_neg( &r->el[1], &a->el[1] );
+  return r;
+}
+
+static inline fd_bn254_fp2_t *
+fd_bn254_fp2_dbl( fd_bn254_fp2_t *       r,
+                  fd_bn254_fp2_t const * a ) {
+  fd_bn254_fp_dbl( &r->el[0], &a->el[0] );
+  fd_bn254_fp_dbl( &r->el[1], &a->el[1] );
+  return r;
+}
+
+static inline fd_bn254_fp2_t *
+fd_bn254_fp2_conj( fd_bn254_fp2_t *       r,
+                   fd_bn254_fp2_t const * a ) {
+  r->el[0] = a->el[0];
+  fd_bn254_fp_neg( &r->el[1], &a->el[1] );
+  return r;
+}
+
+static inline fd_bn254_fp2_t *
+fd_bn254_fp2_mul( fd_bn254_fp2_t *       r,
+                  fd_bn254_fp2_t const * a,
+                  fd_bn254_fp2_t const * b ) {
+  /* Karatsuba */
+  fd_bn254_fp_t v0[1], v1[1], sa[1], sb[1];
+  fd_bn254_fp_mul( v0, &a->el[0], &b->el[0] );
+  fd_bn254_fp_mul( v1, &a->el[1], &b->el[1] );
+  fd_bn254_fp_add( sa, &a->el[0], &a->el[1] );
+  fd_bn254_fp_add( sb, &b->el[0], &b->el[1] );
+  fd_bn254_fp_mul( &r->el[1], sa, sb );
+  fd_bn254_fp_sub( &r->el[1], &r->el[1], v0 );
+  fd_bn254_fp_sub( &r->el[1], &r->el[1], v1 );
+  fd_bn254_fp_sub( &r->el[0], v0, v1 );
+  return r;
+}
+
+static inline fd_bn254_fp2_t *
+fd_bn254_fp2_sqr( fd_bn254_fp2_t *       r,
+                  fd_bn254_fp2_t const * a ) {
+  /* (a0+a1 i)^2 = (a0+a1)(a0-a1) + 2 a0 a1 i */
+  fd_bn254_fp_t s[1], d[1], m[1];
+  fd_bn254_fp_add( s, &a->el[0], &a->el[1] );
+  fd_bn254_fp_sub( d, &a->el[0], &a->el[1] );
+  fd_bn254_fp_mul( m, &a->el[0], &a->el[1] );
+  fd_bn254_fp_mul( &r->el[0], s, d );
+  fd_bn254_fp_dbl( &r->el[1], m );
+  return r;
+}
+
+/* fd_bn254_fp2_mul_fp computes r = a * b, with b in Fp. */
+
+static inline fd_bn254_fp2_t *
+fd_bn254_fp2_mul_fp( fd_bn254_fp2_t *       r,
+                     fd_bn254_fp2_t const * a,
+                     fd_bn254_fp_t const *  b ) {
+  fd_bn254_fp_mul( &r->el[0], &a->el[0], b );
+  fd_bn254_fp_mul( &r->el[1], &a->el[1], b );
+  return r;
+}
+
+/* fd_bn254_fp2_mul_xi computes r = a * xi = a * (9+i). */
+
+static inline fd_bn254_fp2_t *
+fd_bn254_fp2_mul_xi( fd_bn254_fp2_t *       r,
+                     fd_bn254_fp2_t const * a ) {
+  /* (a0 + a1 i)(9 + i) = (9 a0 - a1) + (a0 + 9 a1) i */
+  fd_bn254_fp_t t0[1], t1[1];
+  fd_bn254_fp_dbl( t0, &a->el[0] ); fd_bn254_fp_dbl( t0, t0 ); fd_bn254_fp_dbl( t0, t0 );
+  fd_bn254_fp_add( t0, t0, &a->el[0] );
+  fd_bn254_fp_dbl( t1, &a->el[1] ); fd_bn254_fp_dbl( t1, t1 ); fd_bn254_fp_dbl( t1, t1 );
+  fd_bn254_fp_add( t1, t1, &a->el[1] );
+  fd_bn254_fp_sub( t0, t0, &a->el[1] );
+  fd_bn254_fp_add( &r->el[1], t1, &a->el[0] );
+  r->el[0] = *t0;
+  return r;
+}
+
+static inline fd_bn254_fp2_t *
+fd_bn254_fp2_inv( fd_bn254_fp2_t *       r,
+                  fd_bn254_fp2_t const * a ) {
+  /* 1/(a0 + a1 i) = (a0 - a1 i) / (a0^2 + a1^2) */
+  fd_bn254_fp_t t0[1], t1[1];
+  fd_bn254_fp_sqr( t0, &a->el[0] );
+  fd_bn254_fp_sqr( t1, &a->el[1] );
+  fd_bn254_fp_add( t0, t0, t1 );
+  fd_bn254_fp_inv( t0, t0 );
+  fd_bn254_fp_mul( &r->el[0], &a->el[0], t0 );
+  fd_bn254_fp_mul( &r->el[1], &a->el[1], t0 );
+  fd_bn254_fp_neg( &r->el[1], &r->el[1] );
+  return r;
+}
+
+static fd_bn254_fp2_t *
+fd_bn254_fp2_pow( fd_bn254_fp2_t *       r,
+                  fd_bn254_fp2_t const * a,
+                  ulong const            e[ 4 ] ) {
+  fd_bn254_fp2_t t[1];
+  fd_bn254_fp2_set_one( t );
+  for( int i=255; i>=0; i-- ) {
+    fd_bn254_fp2_sqr( t, t );
+    if( (e[ i>>6 ] >> (i&63)) & 1UL ) fd_bn254_fp2_mul( t, t, a );
+  }
+  *r = *t;
+  return r;
+}
+
+/* fd_bn254_fp2_sqrt computes a square root of a into r.  Returns r on
+   success and NULL if a is not a square.  This is algorithm 9 of Adj
+   and Rodriguez-Henriquez, "Square root computation over even extension
+   fields", for p = 3 mod 4. */
+
+static fd_bn254_fp2_t *
+fd_bn254_fp2_sqrt( fd_bn254_fp2_t *       r,
+                   fd_bn254_fp2_t const * a ) {
+  fd_bn254_fp2_t a1[1], alpha[1], a0[1], x0[1], x[1], minus_one[1];
+  fd_bn254_fp2_set_one( minus_one );
+  fd_bn254_fp2_neg( minus_one, minus_one );
+
+  fd_bn254_fp2_pow( a1, a, fd_bn254_const_p_minus_3_div_4 );
+  fd_bn254_fp2_sqr( alpha, a1 );
+  fd_bn254_fp2_mul( alpha, alpha, a );
+  fd_bn254_fp2_conj( a0, alpha );
+  fd_bn254_fp2_mul( a0, a0, alpha );
+  if( FD_UNLIKELY( fd_bn254_fp2_eq( a0, minus_one ) ) ) return NULL;
+
+  fd_bn254_fp2_mul( x0, a1, a );
+  if( FD_UNLIKELY( fd_bn254_fp2_eq( alpha, minus_one ) ) ) {
+    /* x = i x0 */
+    fd_bn254_fp_neg( &x->el[0], &x0->el[1] );
+    x->el[1] = x0->el[0];
+  } else {
+    fd_bn254_fp2_t b[1];
+    fd_bn254_fp2_set_one( b );
+    fd_bn254_fp2_add( b, b, alpha );
+    fd_bn254_fp2_pow( b, b, fd_bn254_const_p_minus_1_div_2 );
+    fd_bn254_fp2_mul( x, b, x0 );
+  }
+
+  /* Catches a==0 with alpha==0 as well as any non-square that slipped
+     through above */
+  fd_bn254_fp2_t x2[1];
+  fd_bn254_fp2_sqr( x2, x );
+  if( FD_UNLIKELY( !fd_bn254_fp2_eq( x2, a ) ) ) return NULL;
+  *r = *x;
+  return r;
+}
+
+/* Fp6 ***************************************************************/
+
+static inline fd_bn254_fp6_t *
+fd_bn254_fp6_set_zero( fd_bn254_fp6_t * r ) {
+  fd_bn254_fp2_set_zero( &r->el[0] );
+  fd_bn254_fp2_set_zero( &r->el[1] );
+  fd_bn254_fp2_set_zero( &r->el[2] );
+  return r;
+}
+
+static inline fd_bn254_fp6_t *
+fd_bn254_fp6_set_one( fd_bn254_fp6_t * r ) {
+  fd_bn254_fp2_set_one ( &r->el[0] );
+  fd_bn254_fp2_set_zero( &r->el[1] );
+  fd_bn254_fp2_set_zero( &r->el[2] );
+  return r;
+}
+
+static inline int
+fd_bn254_fp6_eq( fd_bn254_fp6_t const * a,
+                 fd_bn254_fp6_t const * b ) {
+  return fd_bn254_fp2_eq( &a->el[0], &b->el[0] ) &
+         fd_bn254_fp2_eq( &a->el[1], &b->el[1] ) &
+         fd_bn254_fp2_eq( &a->el[2], &b->el[2] );
+}
+
+static inline fd_bn254_fp6_t *
+fd_bn254_fp6_add( fd_bn254_fp6_t *       r,
+                  fd_bn254_fp6_t const * a,
+                  fd_bn254_fp6_t const * b ) {
+  fd_bn254_fp2_add( &r->el[0], &a->el[0], &b->el[0] );
+  fd_bn254_fp2_add( &r->el[1], &a->el[1], &b->el[1] );
+  fd_bn254_fp2_add( &r->el[2], &a->el[2], &b->el[2] );
+  return r;
+}
+
+static inline fd_bn254_fp6_t *
+fd_bn254_fp6_sub( fd_bn254_fp6_t *       r,
+                  fd_bn254_fp6_t const * a,
+                  fd_bn254_fp6_t const * b ) {
+  fd_bn254_fp2_sub( &r->el[0], &a->el[0], &b->el[0] );
+  fd_bn254_fp2_sub( &r->el[1], &a->el[1], &b->el[1] );
+  fd_bn254_fp2_sub( &r->el[2], &a->el[2], &b->el[2] );
+  return r;
+}
+
+static inline fd_bn254_fp6_t *
+fd_bn254_fp6_neg( fd_bn254_fp6_t *       r,
+                  fd_bn254_fp6_t const * a ) {
+  fd_bn254_fp2_neg( &r->el[0], &a->el[0] );
+  fd_bn254_fp2_neg( &r->el[1], &a->el[1] );
+  fd_bn254_fp2_neg( &r->el[2], &a->el[2] );
+  return r;
+}
+
+/* fd_bn254_fp6_mul_v computes r = a * v. */
+
+static inline fd_bn254_fp6_t *
+fd_bn254_fp6_mul_v( fd_bn254_fp6_t *       r,
+                    fd_bn254_fp6_t const * a ) {
+  fd_bn254_fp2_t t[1];
+  fd_bn254_fp2_mul_xi( t, &a->el[2] );
+  r->el[2] = a->el[1];
+  r->el[1] = a->el[0];
+  r->el[0] = *t;
+  return r;
+}
+
+static inline fd_bn254_fp6_t *
+fd_bn254_fp6_mul( fd_bn254_fp6_t *       r,
+                  fd_bn254_fp6_t const * a,
+                  fd_bn254_fp6_t const * b ) {
+  /* Karatsuba, see Devegili et al., "Multiplication and squaring on
+     pairing-friendly fields" */
+  fd_bn254_fp2_t v0[1], v1[1], v2[1], sa[1], sb[1], c0[1], c1[1], c2[1];
+  fd_bn254_fp2_mul( v0, &a->el[0], &b->el[0] );
+  fd_bn254_fp2_mul( v1, &a->el[1], &b->el[1] );
+  fd_bn254_fp2_mul( v2, &a->el[2], &b->el[2] );
+
+  /* c0 = v0 + xi((a1+a2)(b1+b2) - v1 - v2) */
+  fd_bn254_fp2_add( sa, &a->el[1], &a->el[2] );
+  fd_bn254_fp2_add( sb, &b->el[1], &b->el[2] );
+  fd_bn254_fp2_mul( c0, sa, sb );
+  fd_bn254_fp2_sub( c0, c0, v1 );
+  fd_bn254_fp2_sub( c0, c0, v2 );
+  fd_bn254_fp2_mul_xi( c0, c0 );
+  fd_bn254_fp2_add( c0, c0, v0 );
+
+  /* c1 = (a0+a1)(b0+b1) - v0 - v1 + xi v2 */
+  fd_bn254_fp2_add( sa, &a->el[0], &a->el[1] );
+  fd_bn254_fp2_add( sb, &b->el[0], &b->el[1] );
+  fd_bn254_fp2_mul( c1, sa, sb );
+  fd_bn254_fp2_sub( c1, c1, v0 );
+  fd_bn254_fp2_sub( c1, c1, v1 );
+  fd_bn254_fp2_mul_xi( sa, v2 );
+  fd_bn254_fp2_add( c1, c1, sa );
+
+  /* c2 = (a0+a2)(b0+b2) - v0 - v2 + v1 */
+  fd_bn254_fp2_add( sa, &a->el[0], &a->el[2] );
+  fd_bn254_fp2_add( sb, &b->el[0], &b->el[2] );
+  fd_bn254_fp2_mul( c2, sa, sb );
+  fd_bn254_fp2_sub( c2, c2, v0 );
+  fd_bn254_fp2_sub( c2, c2, v2 );
+  fd_bn254_fp2_add( c2, c2, v1 );
+
+  r->el[0] = *c0;
+  r->el[1] = *c1;
+  r->el[2] = *c2;
+  return r;
+}
+
+static inline fd_bn254_fp6_t *
+fd_bn254_fp6_sqr( fd_bn254_fp6_t *       r,
+                  fd_bn254_fp6_t const * a ) {
+  /* CH-SQR2 of Chung and Hasan */
+  fd_bn254_fp2_t s0[1], s1[1], s2[1], s3[1], s4[1], t[1];
+  fd_bn254_fp2_sqr( s0, &a->el[0] );
+  fd_bn254_fp2_mul( s1, &a->el[0], &a->el[1] );
+  fd_bn254_fp2_dbl( s1, s1 );
+  fd_bn254_fp2_sub( t, &a->el[0], &a->el[1] );
+  fd_bn254_fp2_add( t, t, &a->el[2] );
+  fd_bn254_fp2_sqr( s2, t );
+  fd_bn254_fp2_mul( s3, &a->el[1], &a->el[2] );
+  fd_bn254_fp2_dbl( s3, s3 );
+  fd_bn254_fp2_sqr( s4, &a->el[2] );
+
+  /* c0 = s0 + xi s3 */
+  fd_bn254_fp2_mul_xi( t, s3 );
+  fd_bn254_fp2_add( &r->el[0], s0, t );
+  /* c2 = s1 + s2 + s3 - s0 - s4 */
+  fd_bn254_fp2_add( t, s1, s2 );
+  fd_bn254_fp2_add( t, t, s3 );
+  fd_bn254_fp2_sub( t, t, s0 );
+  fd_bn254_fp2_sub( &r->el[2], t, s4 );
+  /* c1 = s1 + xi s4 */
+  fd_bn254_fp2_mul_xi( t, s4 );
+  fd_bn254_fp2_add( &r->el[1], s1, t );
+  return r;
+}
+
+static inline fd_bn254_fp6_t *
+fd_bn254_fp6_inv( fd_bn254_fp6_t *       r,
+                  fd_bn254_fp6_t const * a ) {
+  fd_bn254_fp2_t t0[1], t1[1], t2[1], d[1], s[1];
+
+  /* t0 = a0^2 - xi a1 a2 */
+  fd_bn254_fp2_sqr( t0, &a->el[0] );
+  fd_bn254_fp2_mul( s, &a->el[1], &a->el[2] );
+  fd_bn254_fp2_mul_xi( s, s );
+  fd_bn254_fp2_sub( t0, t0, s );
+  /* t1 = xi a2^2 - a0 a1 */
+  fd_bn254_fp2_sqr( t1, &a->el[2] );
+  fd_bn254_fp2_mul_xi( t1, t1 );
+  fd_bn254_fp2_mul( s, &a->el[0], &a->el[1] );
+  fd_bn254_fp2_sub( t1, t1, s );
+  /* t2 = a1^2 - a0 a2 */
+  fd_bn254_fp2_sqr( t2, &a->el[1] );
+  fd_bn254_fp2_mul( s, &a->el[0], &a->el[2] );
+  fd_bn254_fp2_sub( t2, t2, s );
+  /* d = a0 t0 + xi (a2 t1 + a1 t2) */
+  fd_bn254_fp2_mul( d, &a->el[2], t1 );
+  fd_bn254_fp2_mul( s, &a->el[1], t2 );
+  fd_bn254_fp2_add( d, d, s );
+  fd_bn254_fp2_mul_xi( d, d );
+  fd_bn254_fp2_mul( s, &a->el[0], t0 );
+  fd_bn254_fp2_add( d, d, s );
+  fd_bn254_fp2_inv( d, d );
+
+  fd_bn254_fp2_mul( &r->el[0], t0, d );
+  fd_bn254_fp2_mul( &r->el[1], t1, d );
+  fd_bn254_fp2_mul( &r->el[2], t2, d );
+  return r;
+}
+
+/* Fp12 **************************************************************/
+
+static inline fd_bn254_fp12_t *
+fd_bn254_fp12_set_one( fd_bn254_fp12_t * r ) {
+  fd_bn254_fp6_set_one ( &r->el[0] );
+  fd_bn254_fp6_set_zero( &r->el[1] );
+  return r;
+}
+
+static inline int
+fd_bn254_fp12_is_one( fd_bn254_fp12_t const * a ) {
+  fd_bn254_fp12_t one[1];
+  fd_bn254_fp12_set_one( one );
+  return fd_bn254_fp6_eq( &a->el[0], &one->el[0] ) & fd_bn254_fp6_eq( &a->el[1], &one->el[1] );
+}
+
+static inline int
+fd_bn254_fp12_eq( fd_bn254_fp12_t const * a,
+                  fd_bn254_fp12_t const * b ) {
+  return fd_bn254_fp6_eq( &a->el[0], &b->el[0] ) & fd_bn254_fp6_eq( &a->el[1], &b->el[1] );
+}
+
+static inline fd_bn254_fp12_t *
+fd_bn254_fp12_conj( fd_bn254_fp12_t *       r,
+                    fd_bn254_fp12_t const * a ) {
+  r->el[0] = a->el[0];
+  fd_bn254_fp6_neg( &r->el[1], &a->el[1] );
+  return r;
+}
+
+static inline fd_bn254_fp12_t *
+fd_bn254_fp12_mul( fd_bn254_fp12_t *       r,
+                   fd_bn254_fp12_t const * a,
+                   fd_bn254_fp12_t const * b ) {
+  fd_bn254_fp6_t t0[1], t1[1], sa[1], sb[1];
+  fd_bn254_fp6_mul( t0, &a->el[0], &b->el[0] );
+  fd_bn254_fp6_mul( t1, &a->el[1], &b->el[1] );
+  fd_bn254_fp6_add( sa, &a->el[0], &a->el[1] );
+  fd_bn254_fp6_add( sb, &b->el[0], &b->el[1] );
+  fd_bn254_fp6_mul( &r->el[1], sa, sb );
+  fd_bn254_fp6_sub( &r->el[1], &r->el[1], t0 );
+  fd_bn254_fp6_sub( &r->el[1], &r->el[1], t1 );
+  fd_bn254_fp6_mul_v( t1, t1 );
+  fd_bn254_fp6_add( &r->el[0], t0, t1 );
+  return r;
+}
+
+static inline fd_bn254_fp12_t *
+fd_bn254_fp12_sqr( fd_bn254_fp12_t *       r,
+                   fd_bn254_fp12_t const * a ) {
+  /* Complex squaring: (a0 + a1 w)^2 = (a0+a1)(a0+v a1) - a0 a1 - v a0 a1
+     + 2 a0 a1 w */
+  fd_bn254_fp6_t ab[1], s0[1], s1[1];
+  fd_bn254_fp6_mul( ab, &a->el[0], &a->el[1] );
+  fd_bn254_fp6_add( s0, &a->el[0], &a->el[1] );
+  fd_bn254_fp6_mul_v( s1, &a->el[1] );
+  fd_bn254_fp6_add( s1, s1, &a->el[0] );
+  fd_bn254_fp6_mul( s0, s0, s1 );
+  fd_bn254_fp6_sub( s0, s0, ab );
+  fd_bn254_fp6_mul_v( s1, ab );
+  fd_bn254_fp6_sub( &r->el[0], s0, s1 );
+  fd_bn254_fp6_add( &r->el[1], ab, ab );
+  return r;
+}
+
+static inline fd_bn254_fp12_t *
+fd_bn254_fp12_inv( fd_bn254_fp12_t *       r,
+                   fd_bn254_fp12_t const * a ) {
+  /* 1/(a0 + a1 w) = (a0 - a1 w) / (a0^2 - v a1^2) */
+  fd_bn254_fp6_t t0[1], t1[1];
+  fd_bn254_fp6_sqr( t0, &a->el[0] );
+  fd_bn254_fp6_sqr( t1, &a->el[1] );
+  fd_bn254_fp6_mul_v( t1, t1 );
+  fd_bn254_fp6_sub( t0, t0, t1 );
+  fd_bn254_fp6_inv( t0, t0 );
+  fd_bn254_fp6_mul( &r->el[0], &a->el[0], t0 );
+  fd_bn254_fp6_mul( &r->el[1], &a->el[1], t0 );
+  fd_bn254_fp6_neg( &r->el[1], &r->el[1] );
+  return r;
+}
+
+/* fd_bn254_fp12_mul_sparse computes r = a * l, with l = l0 + l1 w +
+   l3 w^3, i.e. l->el[0] = (l0,0,0), l->el[1] = (l1,l3,0).  This is the
+   shape of the line functions of the Miller loop. */
+
+static inline fd_bn254_fp12_t *
+fd_bn254_fp12_mul_sparse( fd_bn254_fp12_t *       r,
+                          fd_bn254_fp12_t const * a,
+                          fd_bn254_fp2_t const *  l0,
+                          fd_bn254_fp2_t const *  l1,
+                          fd_bn254_fp2_t const *  l3 ) {
+  fd_bn254_fp6_t t0[1], t1[1], s[1];
+  fd_bn254_fp2_t u[1], m0[1], m1[1];
+
+  /* t0 = a0 * l0 */
+  fd_bn254_fp2_mul( &t0->el[0], &a->el[0].el[0], l0 );
+  fd_bn254_fp2_mul( &t0->el[1], &a->el[0].el[1], l0 );
+  fd_bn254_fp2_mul( &t0->el[2], &a->el[0].el[2], l0 );
+
+  /* t1 = a1 * (l1 + l3 v) */
+  fd_bn254_fp2_mul( m0, &a->el[1].el[2], l3 );
+  fd_bn254_fp2_mul_xi( m0, m0 );
+  fd_bn254_fp2_mul( &t1->el[0], &a->el[1].el[0], l1 );
+  fd_bn254_fp2_add( &t1->el[0], &t1->el[0], m0 );
+  fd_bn254_fp2_mul( m0, &a->el[1].el[0], l3 );
+  fd_bn254_fp2_mul( m1, &a->el[1].el[1], l1 );
+  fd_bn254_fp2_add( m0, m0, m1 );
+  fd_bn254_fp2_mul( m1, &a->el[1].el[1], l3 );
+  fd_bn254_fp2_mul( &t1->el[2], &a->el[1].el[2], l1 );
+  fd_bn254_fp2_add( &t1->el[2], &t1->el[2], m1 );
+  t1->el[1] = *m0;
+
+  /* r1 = (a0 + a1) * ((l0 + l1) + l3 v) - t0 - t1 */
+  fd_bn254_fp6_add( s, &a->el[0], &a->el[1] );
+  fd_bn254_fp2_add( u, l0, l1 );
+  fd_bn254_fp2_mul( m0, &s->el[2], l3 );
+  fd_bn254_fp2_mul_xi( m0, m0 );
+  fd_bn254_fp2_mul( m1, &s->el[0], u );
+  fd_bn254_fp2_add( &r->el[1].el[0], m1, m0 );
+  fd_bn254_fp2_mul( m0, &s->el[0], l3 );
+  fd_bn254_fp2_mul( m1, &s->el[1], u );
+  fd_bn254_fp2_add( &r->el[1].el[1], m0, m1 );
+  fd_bn254_fp2_mul( m0, &s->el[1], l3 );
+  fd_bn254_fp2_mul( m1, &s->el[2], u );
+  fd_bn254_fp2_add( &r->el[1].el[2], m0, m1 );
+  fd_bn254_fp6_sub( &r->el[1], &r->el[1], t0 );
+  fd_bn254_fp6_sub( &r->el[1], &r->el[1], t1 );
+
+  /* r0 = t0 + v t1 */
+  fd_bn254_fp6_mul_v( t1, t1 );
+  fd_bn254_fp6_add( &r->el[0], t0, t1 );
+  return r;
+}
+
+/* fd_bn254_fp12_sqr_cyclotomic computes r = a^2 for a in the cyclotomic
+   subgroup of Fp12 (i.e. after the easy part of the final
+   exponentiation).  This is the squaring of Granger and Scott, "Faster
+   squaring in the cyclotomic subgroup of sixth degree extensions". */
+
+static inline void
+fd_bn254_fp4_sqr( fd_bn254_fp2_t *       r0,
+                  fd_bn254_fp2_t *       r1,
+                  fd_bn254_fp2_t const * a0,
+                  fd_bn254_fp2_t const * a1 ) {
+  /* (a0 + a1 y)^2 with y^2 = xi */
+  fd_bn254_fp2_t m[1], s[1], t[1];
+  fd_bn254_fp2_mul( m, a0, a1 );
+  fd_bn254_fp2_add( s, a0, a1 );
+  fd_bn254_fp2_mul_xi( t, a1 );
+  fd_bn254_fp2_add( t, t, a0 );
+  fd_bn254_fp2_mul( s, s, t );
+  fd_bn254_fp2_sub( s, s, m );
+  fd_bn254_fp2_mul_xi( t, m );
+  fd_bn254_fp2_sub( r0, s, t );
+  fd_bn254_fp2_dbl( r1, m );
+}
+
+static inline fd_bn254_fp12_t *
+fd_bn254_fp12_sqr_cyclotomic( fd_bn254_fp12_t *       r,
+                              fd_bn254_fp12_t const * a ) {
+  fd_bn254_fp2_t z0[1], z1[1], z2[1], z3[1], z4[1], z5[1];
+  fd_bn254_fp2_t t0[1], t1[1], t2[1], t3[1], t4[1], t5[1], t[1];
+  *z0 = a->el[0].el[0]; *z4 = a->el[0].el[1]; *z3 = a->el[0].el[2];
+  *z2 = a->el[1].el[0]; *z1 = a->el[1].el[1]; *z5 = a->el[1].el[2];
+
+  fd_bn254_fp4_sqr( t0, t1, z0, z1 );
+  fd_bn254_fp4_sqr( t2, t3, z2, z3 );
+  fd_bn254_fp4_sqr( t4, t5, z4, z5 );
+
+  /* 3 t0 - 2 z0 */
+  fd_bn254_fp2_sub( t, t0, z0 ); fd_bn254_fp2_dbl( t, t ); fd_bn254_fp2_add( &r->el[0].el[0], t, t0 );
+  /* 3 t1 + 2 z1 */
+  fd_bn254_fp2_add( t, t1, z1 ); fd_bn254_fp2_dbl( t, t ); fd_bn254_fp2_add( &r->el[1].el[1], t, t1 );
+  /* 3 xi t5 + 2 z2 */
+  fd_bn254_fp2_mul_xi( t5, t5 );
+  fd_bn254_fp2_add( t, t5, z2 ); fd_bn254_fp2_dbl( t, t ); fd_bn254_fp2_add( &r->el[1].el[0], t, t5 );
+  /* 3 t4 - 2 z3 */
+  fd_bn254_fp2_sub( t, t4, z3 ); fd_bn254_fp2_dbl( t, t ); fd_bn254_fp2_add( &r->el[0].el[2], t, t4 );
+  /* 3 t2 - 2 z4 */
+  fd_bn254_fp2_sub( t, t2, z4 ); fd_bn254_fp2_dbl( t, t ); fd_bn254_fp2_add( &r->el[0].el[1], t, t2 );
+  /* 3 t3 + 2 z5 */
+  fd_bn254_fp2_add( t, t3, z5 ); fd_bn254_fp2_dbl( t, t ); fd_bn254_fp2_add( &r->el[1].el[2], t, t3 );
+  return r;
+}
+
+/* fd_bn254_fp12_frob{,2,3} compute r = a^p, a^(p^2), a^(p^3).  With a
+   written as sum_j g_j w^j, g_j in Fp2, a^(p^k) = sum_j g_j^(p^k)
+   gamma_k[j] w^j. */
+
+static inline fd_bn254_fp12_t *
+fd_bn254_fp12_frob( fd_bn254_fp12_t *       r,
+                    fd_bn254_fp12_t const * a ) {
+  fd_bn254_fp2_conj( &r->el[0].el[0], &a->el[0].el[0] );
+  fd_bn254_fp2_conj( &r->el[1].el[0], &a->el[1].el[0] );
+  fd_bn254_fp2_conj( &r->el[0].el[1], &a->el[0].el[1] );
+  fd_bn254_fp2_conj( &r->el[1].el[1], &a->el[1].el[1] );
+  fd_bn254_fp2_conj( &r->el[0].el[2], &a->el[0].el[2] );
+  fd_bn254_fp2_conj( &r->el[1].el[2], &a->el[1].el[2] );
+  fd_bn254_fp2_mul( &r->el[1].el[0], &r->el[1].el[0], &fd_bn254_const_gamma1[0] );
+  fd_bn254_fp2_mul( &r->el[0].el[1], &r->el[0].el[1], &fd_bn254_const_gamma1[1] );
+  fd_bn254_fp2_mul( &r->el[1].el[1], &r->el[1].el[1], &fd_bn254_const_gamma1[2] );
+  fd_bn254_fp2_mul( &r->el[0].el[2], &r->el[0].el[2], &fd_bn254_const_gamma1[3] );
+  fd_bn254_fp2_mul( &r->el[1].el[2], &r->el[1].el[2], &fd_bn254_const_gamma1[4] );
+  return r;
+}
+
+static inline fd_bn254_fp12_t *
+fd_bn254_fp12_frob2( fd_bn254_fp12_t *       r,
+                     fd_bn254_fp12_t const * a ) {
+  r->el[0].el[0] = a->el[0].el[0];
+  fd_bn254_fp2_mul_fp( &r->el[1].el[0], &a->el[1].el[0], &fd_bn254_const_gamma2[0] );
+  fd_bn254_fp2_mul_fp( &r->el[0].el[1], &a->el[0].el[1], &fd_bn254_const_gamma2[1] );
+  fd_bn254_fp2_mul_fp( &r->el[1].el[1], &a->el[1].el[1], &fd_bn254_const_gamma2[2] );
+  fd_bn254_fp2_mul_fp( &r->el[0].el[2], &a->el[0].el[2], &fd_bn254_const_gamma2[3] );
+  fd_bn254_fp2_mul_fp( &r->el[1].el[2], &a->el[1].el[2], &fd_bn254_const_gamma2[4] );
+  return r;
+}
+
+static inline fd_bn254_fp12_t *
+fd_bn254_fp12_frob3( fd_bn254_fp12_t *       r,
+                     fd_bn254_fp12_t const * a ) {
+  fd_bn254_fp2_conj( &r->el[0].el[0], &a->el[0].el[0] );
+  fd_bn254_fp2_conj( &r->el[1].el[0], &a->el[1].el[0] );
+  fd_bn254_fp2_conj( &r->el[0].el[1], &a->el[0].el[1] );
+  fd_bn254_fp2_conj( &r->el[1].el[1], &a->el[1].el[1] );
+  fd_bn254_fp2_conj( &r->el[0].el[2], &a->el[0].el[2] );
+  fd_bn254_fp2_conj( &r->el[1].el[2], &a->el[1].el[2] );
+  fd_bn254_fp2_mul( &r->el[1].el[0], &r->el[1].el[0], &fd_bn254_const_gamma3[0] );
+  fd_bn254_fp2_mul( &r->el[0].el[1], &r->el[0].el[1], &fd_bn254_const_gamma3[1] );
+  fd_bn254_fp2_mul( &r->el[1].el[1], &r->el[1].el[1], &fd_bn254_const_gamma3[2] );
+  fd_bn254_fp2_mul( &r->el[0].el[2], &r->el[0].el[2], &fd_bn254_const_gamma3[3] );
+  fd_bn254_fp2_mul( &r->el[1].el[2], &r->el[1].el[2], &fd_bn254_const_gamma3[4] );
+  return r;
+}
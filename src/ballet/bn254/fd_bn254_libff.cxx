@@ -1,5 +1,5 @@
 extern "C" {
-#include "fd_bn254.h"
+#include "fd_bn254_libff.h"
 }
 
 #include <libff/algebra/curves/alt_bn128/alt_bn128_fields.hpp>
@@ -94,7 +94,7 @@ fd_bn254_bigint_sol_to_libff(fd_bn254_bigint_t const * sol) {
 }
 
 int
-fd_bn254_g1_check( fd_bn254_point_g1_t const * p ) {
+fd_bn254_libff_g1_check( fd_bn254_point_g1_t const * p ) {
   if (!didinit) {
     libff::init_alt_bn128_params();
     didinit = true;
@@ -103,7 +103,7 @@ fd_bn254_g1_check( fd_bn254_point_g1_t const * p ) {
 }
 
 void
-fd_bn254_g1_compress( fd_bn254_point_g1 const * in, fd_bn254_point_g1_compressed * out ) {
+fd_bn254_libff_g1_compress( fd_bn254_point_g1 const * in, fd_bn254_point_g1_compressed * out ) {
   /* Just pick off the X coordinate */
   fd_memcpy(out->v, in->v, FD_BN254_FIELD_FOOTPRINT);
   /* Use the flag to indicate whether Y is negative */
@@ -112,7 +112,7 @@ fd_bn254_g1_compress( fd_bn254_point_g1 const * in, fd_bn254_point_g1_compressed
 }
 
 void
-fd_bn254_g1_decompress( fd_bn254_point_g1_compressed const * in, fd_bn254_point_g1 * out ) {
+fd_bn254_libff_g1_decompress( fd_bn254_point_g1_compressed const * in, fd_bn254_point_g1 * out ) {
   if (!didinit) {
     libff::init_alt_bn128_params();
     didinit = true;
@@ -131,7 +131,7 @@ fd_bn254_g1_decompress( fd_bn254_point_g1_compressed const * in, fd_bn254_point_
 }
 
 int
-fd_bn254_g2_check( fd_bn254_point_g2_t const * p ) {
+fd_bn254_libff_g2_check( fd_bn254_point_g2_t const * p ) {
   if (!didinit) {
     libff::init_alt_bn128_params();
     didinit = true;
@@ -140,7 +140,7 @@ fd_bn254_g2_check( fd_bn254_point_g2_t const * p ) {
 }
 
 void
-fd_bn254_g2_compress( fd_bn254_point_g2 const * in, fd_bn254_point_g2_compressed * out ) {
+fd_bn254_libff_g2_compress( fd_bn254_point_g2 const * in, fd_bn254_point_g2_compressed * out ) {
   /* Just pick off the X coordinate */
   fd_memcpy(out->v, in->v, 2U*FD_BN254_FIELD_FOOTPRINT);
   /* Use the flag to indicate whether Y.c0 is negative */
@@ -149,7 +149,7 @@ fd_bn254_g2_compress( fd_bn254_point_g2 const * in, fd_bn254_point_g2_compressed
 }
 
 void
-fd_bn254_g2_decompress( fd_bn254_point_g2_compressed const * in, fd_bn254_point_g2 * out ) {
+fd_bn254_libff_g2_decompress( fd_bn254_point_g2_compressed const * in, fd_bn254_point_g2 * out ) {
   if (!didinit) {
     libff::init_alt_bn128_params();
     didinit = true;
@@ -168,7 +168,7 @@ fd_bn254_g2_decompress( fd_bn254_point_g2_compressed const * in, fd_bn254_point_
 }
 
 void
-fd_bn254_g1_add( fd_bn254_point_g1_t const * x, fd_bn254_point_g1_t const * y, fd_bn254_point_g1_t * z ) {
+fd_bn254_libff_g1_add( fd_bn254_point_g1_t const * x, fd_bn254_point_g1_t const * y, fd_bn254_point_g1_t * z ) {
   if (!didinit) {
     libff::init_alt_bn128_params();
     didinit = true;
@@ -177,7 +177,7 @@ fd_bn254_g1_add( fd_bn254_point_g1_t const * x, fd_bn254_point_g1_t const * y, f
 }
 
 void
-fd_bn254_g1_mult( fd_bn254_point_g1_t const * x, fd_bn254_bigint_t const * y, fd_bn254_point_g1_t * z ) {
+fd_bn254_libff_g1_mult( fd_bn254_point_g1_t const * x, fd_bn254_bigint_t const * y, fd_bn254_point_g1_t * z ) {
   if (!didinit) {
     libff::init_alt_bn128_params();
     didinit = true;
@@ -186,7 +186,7 @@ fd_bn254_g1_mult( fd_bn254_point_g1_t const * x, fd_bn254_bigint_t const * y, fd
 }
 
 int
-fd_bn254_pairing( fd_bn254_point_g1_t const * p_1, fd_bn254_point_g2_t const * q_1,
+fd_bn254_libff_pairing( fd_bn254_point_g1_t const * p_1, fd_bn254_point_g2_t const * q_1,
                   fd_bn254_point_g1_t const * p_2, fd_bn254_point_g2_t const * q_2) {
   if (!didinit) {
     libff::init_alt_bn128_params();
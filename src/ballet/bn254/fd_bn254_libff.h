@@ -0,0 +1,32 @@
+#ifndef HEADER_fd_src_ballet_bn254_fd_bn254_libff_h
+#define HEADER_fd_src_ballet_bn254_fd_bn254_libff_h
+
+/* fd_bn254_libff is the previous implementation of fd_bn254 and
+   fd_poseidon on top of libff.  It is only built if libff is available
+   and is only used as the reference of the differential tests of the
+   native implementation (test_bn254_libff).  The functions have the
+   same semantics as their fd_bn254 and fd_poseidon counterparts, except
+   that the points are not validated by add, mult and pairing. */
+
+#include "fd_bn254.h"
+#include "fd_poseidon.h"
+
+FD_PROTOTYPES_BEGIN
+
+int  fd_bn254_libff_g1_check( fd_bn254_point_g1_t const * p );
+void fd_bn254_libff_g1_compress( fd_bn254_point_g1_t const * in, fd_bn254_point_g1_compressed_t * out );
+void fd_bn254_libff_g1_decompress( fd_bn254_point_g1_compressed_t const * in, fd_bn254_point_g1_t * out );
+int  fd_bn254_libff_g2_check( fd_bn254_point_g2_t const * p );
+void fd_bn254_libff_g2_compress( fd_bn254_point_g2_t const * in, fd_bn254_point_g2_compressed_t * out );
+void fd_bn254_libff_g2_decompress( fd_bn254_point_g2_compressed_t const * in, fd_bn254_point_g2_t * out );
+void fd_bn254_libff_g1_add( fd_bn254_point_g1_t const * x, fd_bn254_point_g1_t const * y, fd_bn254_point_g1_t * z );
+void fd_bn254_libff_g1_mult( fd_bn254_point_g1_t const * x, fd_bn254_bigint_t const * y, fd_bn254_point_g1_t * z );
+int  fd_bn254_libff_pairing( fd_bn254_point_g1_t const * g1_1, fd_bn254_point_g2_t const * g2_1,
+                             fd_bn254_point_g1_t const * g1_2, fd_bn254_point_g2_t const * g2_2 );
+
+int  fd_poseidon_libff_hash( uchar const * bytes, ulong bytes_len,
+                             int big_endian, fd_poseidon_hash_result_t * result );
+
+FD_PROTOTYPES_END
+
+#endif /* HEADER_fd_src_ballet_bn254_fd_bn254_libff_h */
@@ -0,0 +1,176 @@
+#define HEADER_fd_src_ballet_bn254_fd_poseidon_c
+#include "fd_poseidon.h"
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wsign-conversion"
+#include "../fiat-crypto/bn254_scalar_64.c"
+#pragma GCC diagnostic pop
+
+/* Generic poseidon implementation based on
+   https://docs.rs/crate/light-poseidon/0.1.2/source/src/lib.rs on top
+   of the fiat-crypto bn254 scalar field arithmetic. */
+
+#define FD_POSEIDON_FULL_ROUNDS (8UL)
+#define FD_POSEIDON_MAX_WIDTH   (1UL+FD_POSEIDON_MAX_INPUT_CNT)
+
+struct fd_poseidon_par {
+  ulong                     partial_rounds;
+  fd_bn254_scalar_t const * ark; /* (FD_POSEIDON_FULL_ROUNDS+partial_rounds)*width round constants */
+  fd_bn254_scalar_t const * mds; /* width*width MDS matrix, row major */
+};
+typedef struct fd_poseidon_par fd_poseidon_par_t;
+
+#include "fd_poseidon_params.c"
+
+/* The bn254 scalar field modulus r, little endian limbs */
+static const ulong fd_bn254_scalar_const_r[4] = {
+  0x43e1f593f0000001UL, 0x2833e84879b97091UL, 0xb85045b68181585dUL, 0x30644e72e131a029UL
+};
+
+/* fd_bn254_scalar_lt_r returns 1 if the integer with little endian
+   limbs t is less than r. */
+
+static inline int
+fd_bn254_scalar_lt_r( ulong const t[4] ) {
+  for( int i=3; i>=0; i-- ) {
+    if( t[ i ]!=fd_bn254_scalar_const_r[ i ] ) return t[ i ]<fd_bn254_scalar_const_r[ i ];
+  }
+  return 0;
+}
+
+/* fd_bn254_scalar_sub_r computes t -= r in place (t must be >= r). */
+
+static inline void
+fd_bn254_scalar_sub_r( ulong t[4] ) {
+  ulong borrow = 0UL;
+  for( ulong i=0UL; i<4UL; i++ ) {
+    ulong a = t[ i ];
+    ulong b = fd_bn254_scalar_const_r[ i ];
+    ulong d = a - b - borrow;
+    borrow  = (ulong)( (a<b) | ((a==b) & (borrow!=0UL)) );
+    t[ i ]  = d;
+  }
+}
+
+/* fd_poseidon_load loads the sz<=32 bytes at data, an integer in the
+   given endianness, into the little endian limbs t. */
+
+static inline void
+fd_poseidon_load( ulong         t[4],
+                  uchar const * data,
+                  ulong         sz,
+                  int           big_endian ) {
+  uchar buf[ 32 ] = {0};
+  if( big_endian ) for( ulong i=0UL; i<sz; i++ ) buf[ i ] = data[ sz-1UL-i ];
+  else             fd_memcpy( buf, data, sz );
+  for( ulong i=0UL; i<4UL; i++ ) t[ i ] = fd_ulong_load_8( buf + 8UL*i );
+}
+
+static inline void
+fd_poseidon_sbox( fd_bn254_scalar_t * s ) {
+  ulong t[4];
+  fiat_bn254_scalar_square( t, s->el );
+  fiat_bn254_scalar_square( t, t );
+  fiat_bn254_scalar_mul( s->el, s->el, t );
+}
+
+static void
+fd_poseidon_permute( fd_bn254_scalar_t * state,
+                     ulong               width ) {
+  fd_poseidon_par_t const * par = &fd_poseidon_params[ width ];
+  ulong half_rounds = FD_POSEIDON_FULL_ROUNDS/2UL;
+  ulong round_cnt   = FD_POSEIDON_FULL_ROUNDS + par->partial_rounds;
+
+  for( ulong round=0UL; round<round_cnt; round++ ) {
+    fd_bn254_scalar_t const * ark = par->ark + round*width;
+    for( ulong i=0UL; i<width; i++ ) fiat_bn254_scalar_add( state[ i ].el, state[ i ].el, ark[ i ].el );
+
+    if( round<half_rounds || round>=half_rounds+par->partial_rounds ) {
+      for( ulong i=0UL; i<width; i++ ) fd_poseidon_sbox( state+i );
+    } else {
+      fd_poseidon_sbox( state );
+    }
+
+    fd_bn254_scalar_t tmp[ FD_POSEIDON_MAX_WIDTH ];
+    for( ulong i=0UL; i<width; i++ ) {
+      fd_bn254_scalar_t const * row = par->mds + i*width;
+      ulong acc[4] = {0};
+      for( ulong j=0UL; j<width; j++ ) {
+        ulong t[4];
+        fiat_bn254_scalar_mul( t, row[ j ].el, state[ j ].el );
+        fiat_bn254_scalar_add( acc, acc, t );
+      }
+      fd_memcpy( tmp[ i ].el, acc, sizeof(acc) );
+    }
+    fd_memcpy( state, tmp, width*sizeof(fd_bn254_scalar_t) );
+  }
+}
+
+fd_poseidon_t *
+fd_poseidon_init( fd_poseidon_t * pos,
+                  int             big_endian ) {
+  fd_memset( pos->state, 0, sizeof(pos->state) ); /* domain tag, always zero */
+  pos->cnt        = 0UL;
+  pos->big_endian = big_endian;
+  return pos;
+}
+
+fd_poseidon_t *
+fd_poseidon_append( fd_poseidon_t * pos,
+                    uchar const *   data,
+                    ulong           sz ) {
+  if( FD_UNLIKELY( !sz || sz>32UL || pos->cnt>=FD_POSEIDON_MAX_INPUT_CNT ) ) return NULL;
+
+  ulong t[4];
+  fd_poseidon_load( t, data, sz, pos->big_endian );
+  if( FD_UNLIKELY( !fd_bn254_scalar_lt_r( t ) ) ) return NULL;
+
+  fiat_bn254_scalar_to_montgomery( pos->state[ 1UL+pos->cnt ].el, t );
+  pos->cnt++;
+  return pos;
+}
+
+uchar *
+fd_poseidon_fini( fd_poseidon_t * pos,
+                  uchar           hash[ FD_POSEIDON_HASH_SIZE ] ) {
+  if( FD_UNLIKELY( !pos->cnt ) ) return NULL;
+
+  fd_poseidon_permute( pos->state, 1UL+pos->cnt );
+
+  ulong t[4];
+  uchar buf[ 32 ];
+  fiat_bn254_scalar_from_montgomery( t, pos->state[0].el );
+  fiat_bn254_scalar_to_bytes( buf, t );
+  if( pos->big_endian ) for( ulong i=0UL; i<32UL; i++ ) hash[ i ] = buf[ 31UL-i ];
+  else                  fd_memcpy( hash, buf, 32UL );
+  return hash;
+}
+
+int
+fd_poseidon_hash( const uchar * bytes, ulong bytes_len,
+                  int big_endian, fd_poseidon_hash_result_t * result ) {
+  // Round up. width is number of fields in the state vector.
+  ulong width = 1UL + (bytes_len + 31UL)/32UL;
+  if( FD_UNLIKELY( width<2UL || width>FD_POSEIDON_MAX_WIDTH ) ) return -1;
+
+  fd_poseidon_t pos[1];
+  fd_poseidon_init( pos, big_endian );
+  while( bytes_len ) {
+    /* A partial last chunk is zero filled after the data, before the
+       byte order is applied */
+    ulong j = fd_ulong_min( bytes_len, 32UL );
+    uchar chunk[ 32 ] = {0};
+    fd_memcpy( chunk, bytes, j );
+
+    ulong t[4];
+    fd_poseidon_load( t, chunk, 32UL, big_endian );
+    while( !fd_bn254_scalar_lt_r( t ) ) fd_bn254_scalar_sub_r( t );
+    fiat_bn254_scalar_to_montgomery( pos->state[ 1UL+pos->cnt ].el, t );
+    pos->cnt++;
+
+    bytes     += j;
+    bytes_len -= j;
+  }
+
+  fd_poseidon_fini( pos, result->v );
+  return 0;
+}
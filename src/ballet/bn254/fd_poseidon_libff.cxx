@@ -3,9 +3,9 @@
 */
   
 extern "C" {
-#include "fd_poseidon.h"
+#include "fd_bn254_libff.h"
 }
-#include "fd_poseidon_params.hxx"
+#include "fd_poseidon_libff_params.hxx"
 #include <libff/algebra/curves/alt_bn128/alt_bn128_init.hpp>
 
 /*
@@ -67,7 +67,7 @@ byte_swap_32(uchar * v) {
 }
 
 int
-fd_poseidon_hash( const uchar * bytes, ulong bytes_len,
+fd_poseidon_libff_hash( const uchar * bytes, ulong bytes_len,
                   int big_endian, fd_poseidon_hash_result_t * result ) {
   static bool didinit = false;
   if (!didinit) {
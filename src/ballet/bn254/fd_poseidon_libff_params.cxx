@@ -5,7 +5,7 @@
   by input width from 2 to 13.
 */
 
-#include "fd_poseidon_params.hxx"
+#include "fd_poseidon_libff_params.hxx"
 
 struct BI { uchar v[32]; };
 
@@ -0,0 +1,7214 @@
+/* Poseidon parameters for the bn254 scalar field, x^5 S-box, 8 full
+   rounds, for widths 2 to 13 (1 to 12 inputs), as used by Solana
+   (light-poseidon, https://github.com/Lightprotocol/light-poseidon,
+   parameters/bn254_x5.rs).  The round constants and the MDS matrices
+   are stored in the Montgomery domain of the fiat-crypto bn254_scalar
+   arithmetic.  This file is generated from fd_poseidon_libff_params.cxx
+   and is meant to be included by fd_poseidon.c. */
+
+#ifndef HEADER_fd_src_ballet_bn254_fd_poseidon_c
+#error "Do not compile this file directly, it is included by fd_poseidon.c"
+#endif
+
+static const fd_bn254_scalar_t fd_poseidon_ark_2[] = {
+  {{ 0xa96c453dc58aca67UL, 0x73eb0f4319a6fa1bUL, 0xc1584c4902cfebe6UL, 0x0258feaeab003c81UL }},
+  {{ 0x999f128f883214eeUL, 0x3812d56244476181UL, 0xf1c713591a60e735UL, 0x1d29e209ed432b39UL }},
+  {{ 0x10245a461f9886f9UL, 0xc1f6a382a4af9cd7UL, 0x43dc54de7be4216cUL, 0x08dde7787782a71dUL }},
+  {{ 0x86d4b4dfcfcc4182UL, 0xb39eadc24bb31793UL, 0xf2eb1492aa7b0c79UL, 0x14adb8ab12efc7fcUL }},
+  {{ 0x5ac9777b239d7f99UL, 0x2de9df1a6b10a565UL, 0x0fbbf650052bad6bUL, 0x1d9e1fcdfdd4cd35UL }},
+  {{ 0x610101865edf14abUL, 0x10cc90a9e968ec10UL, 0xbc3715a205fc111aUL, 0x2f07f1e20f67d489UL }},
+  {{ 0xd1b7a8a6f159c12eUL, 0x36243b2a680a4228UL, 0x20d439cec6a8e4a8UL, 0x228c467513fc8cefUL }},
+  {{ 0xd78a36ba6e65a009UL, 0x27b2c19d400613f7UL, 0xb3eba82561a94f58UL, 0x1a07ef8d266420adUL }},
+  {{ 0x8099c7d930553dfeUL, 0x87c661d6077c15b7UL, 0x5a5ac36a76bd32d3UL, 0x27889e1d793f840cUL }},
+  {{ 0x29388f35439e8c4bUL, 0x42a07b4da45f0bbbUL, 0x411b6d19b6611e22UL, 0x0a6d920746a04c15UL }},
+  {{ 0x2d7e1c1027534ec9UL, 0xd55601d295ff74c4UL, 0xb43d00710721d217UL, 0x012686ab8ae93cd2UL }},
+  {{ 0xa489be9a31841db1UL, 0xcfe42b63851ee28bUL, 0x78a78fff698a5272UL, 0x156e33ea2de332a2UL }},
+  {{ 0x2b52a7172d84bd84UL, 0xc37eac07823d04f8UL, 0x2dd4d10602284e03UL, 0x291941dd0ceea4f1UL }},
+  {{ 0x2d132ca948aa3564UL, 0x0d69b2b0a0f323c9UL, 0xbd135b98e5ac170cUL, 0x2eb17bec78df7294UL }},
+  {{ 0xb27b508ae5174737UL, 0xed83bd8e6f1891b5UL, 0x9fff519abdc159b6UL, 0x18accd26da500d5cUL }},
+  {{ 0x72f41170e9789115UL, 0x97b50e3d46c3b143UL, 0xd3a82a78be4cd18eUL, 0x0d135f73a0b59e10UL }},
+  {{ 0xf8f813168475e2d7UL, 0xac8729148900dd99UL, 0x47c245f73ad542b9UL, 0x0d4eaa0cc86c4bc5UL }},
+  {{ 0xf0eb00af61b508a8UL, 0x1d8ef8cd804e5816UL, 0xff7ddf4367629878UL, 0x2bca06cf8ed0ac37UL }},
+  {{ 0xca6ad2283d19de16UL, 0x44bac763338950e6UL, 0xb9d829d89c4ff430UL, 0x1c59e2d366b057deUL }},
+  {{ 0x6893946bd9d1bed1UL, 0x5194597e219e8861UL, 0xcfb879490d8ae06bUL, 0x2067c27e7817da48UL }},
+  {{ 0xe1d516357166ba33UL, 0xb7d9765678be6da4UL, 0xede788ac21265799UL, 0x301ec35d6c040fbfUL }},
+  {{ 0x10869851c117a901UL, 0xe3b9a765195dc3f7UL, 0x4c6cdbd3e4c5cf3eUL, 0x1dbfee289a219d25UL }},
+  {{ 0xc27e269170bbd4caUL, 0xb2699884b935068dUL, 0x85d09b6f47461a9aUL, 0x0765e3eb4ee29d1aUL }},
+  {{ 0xb80972bc0a3d4a9aUL, 0x6a95e82385221a89UL, 0x29de2e17845075b1UL, 0x2e0bac69061e5aa4UL }},
+  {{ 0xd9dc3367c6c215d2UL, 0x2aa49878b5b9449eUL, 0xc2b96cf438cc73ecUL, 0x0f8ffda334845f74UL }},
+  {{ 0x9ea9a08f13bc2971UL, 0x9e6b7a1b24884e5bUL, 0xa5ec85eb1e6cb18fUL, 0x2e381f3cbe57c88dUL }},
+  {{ 0xcf6f0f63166dc32eUL, 0xb111cc4db3db063bUL, 0x6c58727ffe90a1d7UL, 0x05e624ff82e2b944UL }},
+  {{ 0x595827549e31edb7UL, 0xd3bde7cf17abef70UL, 0xfac533a72d527a24UL, 0x060ece5235787b72UL }},
+  {{ 0x30d8f27f0080a33dUL, 0x691103220aa85284UL, 0x3c11003092bf61d2UL, 0x1342a4cfd901a295UL }},
+  {{ 0x61b87beb719426c1UL, 0x34ba95d60eb9ebbdUL, 0xee6280441a829247UL, 0x23fad23a17da49d5UL }},
+  {{ 0x2d5671a0fac38f4cUL, 0xbba9fcc1c1b1a449UL, 0x4da9096bfaaf9c19UL, 0x05b4ec45dc045007UL }},
+  {{ 0x037436a1aa8c7f8cUL, 0x18b3bf03001c7301UL, 0xde9a6fc8b7e5a635UL, 0x1869c170d9259cb6UL }},
+  {{ 0xf72c49c01bc31bd6UL, 0x195c10b2304e1f0cUL, 0x15f734f15b8fdbebUL, 0x0d3c0e250d2020feUL }},
+  {{ 0x0fcff73552b2e2d9UL, 0xd0414e687c4850d5UL, 0x00744ae01cd04142UL, 0x1619ea74ff1794c1UL }},
+  {{ 0x28500b6a73d405b7UL, 0xb4c2f96ac4fb355aUL, 0x1dc6a7f3394d3d12UL, 0x156e721c51da53c9UL }},
+  {{ 0x5e3d132739468327UL, 0xf372b54e51b2722dUL, 0x9b29355985fe2518UL, 0x17a81a0bc574d844UL }},
+  {{ 0x176a569a42051a56UL, 0xaf6a331b261f3277UL, 0xe08d06ec2b469f7eUL, 0x1662a55b8a8c2cbfUL }},
+  {{ 0x3bc085dedf786323UL, 0x178e5df39e4fd5faUL, 0x98f7befec8dd5467UL, 0x1374c3f62b7cd78bUL }},
+  {{ 0x9c93097b9ed507f4UL, 0x0e7691672a42fe66UL, 0x13c16032896a115eUL, 0x1eda5a3d1db230bcUL }},
+  {{ 0x36a3664797689721UL, 0xd83062984cb25e9fUL, 0xeb62da57ead47c18UL, 0x240c42cb8898c9deUL }},
+  {{ 0x6ef4b4e511843d3dUL, 0xca8edb3ecb6ee554UL, 0x6ebd407bb39e22ffUL, 0x2bf5eb2db5c78e6eUL }},
+  {{ 0xfd07c7c3ec0aa2c6UL, 0xb5eecf9dcaae86c9UL, 0xa345338900c1ac8bUL, 0x00d3ab5b3cee349cUL }},
+  {{ 0x25c0667f20608a97UL, 0xd7de20ae5011ca43UL, 0x3bc6c7aff1f021c3UL, 0x2f14c8114561b4b6UL }},
+  {{ 0x5b1bfc0f8c8a6097UL, 0x79f9b35d24ba2022UL, 0x7da661b039ed6645UL, 0x05aa835dfd00eedbUL }},
+  {{ 0x6e690c1c90403affUL, 0x55e412a440b9cff8UL, 0xbb7ea2b4af3e4cd7UL, 0x00568e83d40efc8dUL }},
+  {{ 0x43af3e266373b671UL, 0x127f969e3f3814e7UL, 0x2a75164a578e552cUL, 0x2175fac47f74fffeUL }},
+  {{ 0xeb4c476d65ea944dUL, 0xe947cd8484aa5664UL, 0x260b6908aeadc54aUL, 0x025e4f0ca5d6b0b8UL }},
+  {{ 0xb2bb86f30f8ef8b3UL, 0x503e0262637bdf9eUL, 0xf45a8a04de2f07bbUL, 0x22a549157c02d6e8UL }},
+  {{ 0xb7720222d9a506b9UL, 0x8b03d26c07561bc7UL, 0x0c997d272bcc0fcbUL, 0x214bec2670b36742UL }},
+  {{ 0x6db0ef8b7577bb86UL, 0xd487ffebe2bdef59UL, 0x8fccdcdab81b9491UL, 0x0d2c4e919b4e9067UL }},
+  {{ 0xbc373e8cf5a00e6bUL, 0xca5f9450feacdb15UL, 0xf02e25111abf5533UL, 0x2eda54e9fc8ef2e1UL }},
+  {{ 0x54a9f39c28361ddeUL, 0x43f7f6c28e9bd7d4UL, 0xd5a7772607458591UL, 0x1a88852df6658bf2UL }},
+  {{ 0x9667b08e4e0129b2UL, 0x1b82df4fbc2802e0UL, 0x2667926acfa6d069UL, 0x0ef12dac48270df6UL }},
+  {{ 0x099e78a54b060dd6UL, 0x941beb22cff80798UL, 0x01f6da3b766400e2UL, 0x0ad1ca2c2e4d9c93UL }},
+  {{ 0xf20c0e76519dd82cUL, 0x5dd02cdfd2ac3c96UL, 0xe391867f83ae55d4UL, 0x30068131c4fe95d1UL }},
+  {{ 0x4dc7005ff1f30413UL, 0xcdb270162845cfbbUL, 0xe161cc2901758391UL, 0x093f1cff3bbac7d4UL }},
+  {{ 0x3a82a99f7d37e7caUL, 0x86ca9972a31b215fUL, 0xe0508aa7e0e12531UL, 0x2b21602b9c0ab846UL }},
+  {{ 0xc8e755540a0959c2UL, 0x1c7873e82d6c91f9UL, 0x1fb10bb098913a15UL, 0x2bd2e3bee55bc94eUL }},
+  {{ 0xa8cc4d5980fba8a1UL, 0x738008832215497dUL, 0xcb613bd535c93170UL, 0x1928e9ed1a2fe728UL }},
+  {{ 0x4792d3a4b7086125UL, 0xd6fca8f840d3912bUL, 0x157c8bf89713a132UL, 0x2ddbc6bdd197a327UL }},
+  {{ 0xf658ea6e8ce21945UL, 0x9f8edc049bdf695fUL, 0x334a7227b37ffe84UL, 0x03aa0ace0b3934d8UL }},
+  {{ 0x3be0c64e6178fc72UL, 0x8258af153376a5a5UL, 0x01bbc50c72632835UL, 0x05c5c5f078461126UL }},
+  {{ 0xca5ca78d5ceb88c8UL, 0xd58ccd5f3af51eadUL, 0xac6f13a94ff64d28UL, 0x2571325d7770d676UL }},
+  {{ 0x227f5268901865aaUL, 0xbf1d22d3298454deUL, 0x7a477e52e2de015fUL, 0x2a8bf714ae1dc826UL }},
+  {{ 0xabe800c56c03f53fUL, 0x99a08bbfe62a8eb9UL, 0x858e0814814b855bUL, 0x17a98d6f0420500aUL }},
+  {{ 0x2452da7b2cf0b07fUL, 0xa1dff84a6c89a4eeUL, 0xec02277ada8f2e3bUL, 0x209688255f5ce1d5UL }},
+  {{ 0xe16ec3401066f7c6UL, 0x52123b4dd78c72f3UL, 0xfc415ba388773994UL, 0x0bab3f3f454240a6UL }},
+  {{ 0x6e9ebc16180a3588UL, 0x30117fc8c4d6f90bUL, 0xda57687662607c64UL, 0x04b4939350e75c9aUL }},
+  {{ 0x9b9f8362205afd38UL, 0xaeeae293cc4f42b9UL, 0x71501b1659929038UL, 0x0a3f23046ae6a2d7UL }},
+  {{ 0xd6ed03ca90af264aUL, 0xcf5c0afcafac7d63UL, 0x8a4de575cb0936e8UL, 0x15c15d2fe6f3e596UL }},
+  {{ 0xd0fbe11de3480394UL, 0xe1be34783fa42cd2UL, 0x93319f25b5a6722aUL, 0x1869731f363e9dd7UL }},
+  {{ 0x58588f426e2e4b8dUL, 0x7782f8ee21b7db86UL, 0xb09873d755316d82UL, 0x062c9c115f1756fcUL }},
+  {{ 0xd578aa2d0df955d1UL, 0xcac9e4c0b7bb2f4dUL, 0x2df3abb87d1d1cf2UL, 0x10f37453cb26cc86UL }},
+  {{ 0x081adcba817d2585UL, 0x04bd653a16609511UL, 0xd786f82986a07e73UL, 0x097539324da6e547UL }},
+  {{ 0x22067d793a2f2111UL, 0x350dacf14c6099e5UL, 0xacdd32b97b92afbcUL, 0x2904fc3d1fe4e00aUL }},
+  {{ 0xae8170a72a249ea4UL, 0x2235d0ab974fef79UL, 0x8eb0d58e246167eeUL, 0x1b4f6fb228b3a319UL }},
+  {{ 0x7d4277609ab89908UL, 0xc760540e2a371046UL, 0xfdc83134696d841aUL, 0x1164089ffa58ee8eUL }},
+  {{ 0x80b7adf037719afeUL, 0xa735ad9fce70583dUL, 0x4a75bea6a8c9ad5cUL, 0x2e4ecb3f3f762d9dUL }},
+  {{ 0x259acb862fd474a2UL, 0x073886ef9ba1916eUL, 0xc802704907a41f84UL, 0x08e2f76537a6e17bUL }},
+  {{ 0xdad474ea271c64c5UL, 0x0ce090579a0bf079UL, 0xd2977827dacf278cUL, 0x13d6b108d5fb574bUL }},
+  {{ 0x5bec0d135534eb08UL, 0x35f87916caf4413fUL, 0x8d4780843c3eb953UL, 0x16b926368af93572UL }},
+  {{ 0xd469e8807658bbdeUL, 0x52e82f71abcf90e9UL, 0xfbf44e8d9f7a3f0dUL, 0x2955a30b699a1590UL }},
+  {{ 0x827984e87fad1d25UL, 0xbb4137dfc693d285UL, 0x704df2cb3cf270ceUL, 0x1236a1b85bb3f192UL }},
+  {{ 0xaf33d0dc023b92a2UL, 0xc57e582bee5c16fbUL, 0x86a304056bd38136UL, 0x078a23edd53dc21fUL }},
+  {{ 0x9819429567f57ccbUL, 0xfccc6ae5d18da9a0UL, 0x0ecf99931504b678UL, 0x1922c2e1c13ab432UL }},
+  {{ 0x4ad4e8a49343564eUL, 0xd1d7d501dfec3ffcUL, 0x9a3ac36e0081ade5UL, 0x030ab3a38e826bc4UL }},
+  {{ 0x4ae04ce54880e2baUL, 0xdc5508ffc76c5942UL, 0x96edcd2992883e2fUL, 0x20ed45e0ef92c894UL }},
+  {{ 0xe76348d044099ea7UL, 0x1073d63cca9eaafcUL, 0xf943a911a69e0124UL, 0x24fcca8299b0375aUL }},
+  {{ 0x208138cb8d4f0c10UL, 0x389e47554c382680UL, 0x13f51598f0479087UL, 0x260acb76fbea33d6UL }},
+  {{ 0xb7fe10031373fa78UL, 0xcb860bab386bc9eaUL, 0x492b21b9deede016UL, 0x06db317136495a76UL }},
+  {{ 0x09d8320ab74dd787UL, 0xd7c4723f7b0e25a4UL, 0xeab1c048f21ebd79UL, 0x236357b190ac727aUL }},
+  {{ 0xc4083600527e3215UL, 0x42acae0f31046702UL, 0x0c6a547917ff8d18UL, 0x1557a3718d2b9b9fUL }},
+  {{ 0xe88dce07c87bdce7UL, 0x1edeb660ea8eb7bbUL, 0x1d66d98f5c773050UL, 0x130248c16a4a1346UL }},
+  {{ 0x5966ed45e22e2820UL, 0x1e241d39f87c34c7UL, 0x42f36e8638b4e8b6UL, 0x1d75cf9b53f0d90eUL }},
+  {{ 0x10b89d3eed7e0493UL, 0xa7267442f5f5eec8UL, 0x07fe125f7dcb378bUL, 0x154c7f9dcfeaed1aUL }},
+  {{ 0x35a01ad30be2189dUL, 0xea0b16441ce534b4UL, 0x50c3f778ffea07a1UL, 0x224a498ebc3d0fd2UL }},
+  {{ 0x2a4024a32701befaUL, 0x635f8cc66dd8f9fbUL, 0x3440055e755cb3ffUL, 0x3062ccee0ea9d0ebUL }},
+  {{ 0x8412bd1b3fc9d7d2UL, 0x3d0110d081cee8acUL, 0x659272dd3bcde728UL, 0x1c75a64f3407e7bdUL }},
+  {{ 0x3ddc48ebcd9adaa0UL, 0x38ffa9615eb1d16eUL, 0x971dae7ce2399f3bUL, 0x1422bd1ed884efcfUL }},
+  {{ 0xd47f8d20d5923ba5UL, 0x7998aefb7e3d5004UL, 0xf89ee272f9171b73UL, 0x25e4a90d9d763866UL }},
+  {{ 0x57acd54b5cfdb84dUL, 0xd836c01e5df5bc85UL, 0x99d2c5e30f555dbcUL, 0x250da1e50c8a177eUL }},
+  {{ 0xeec0d3a033743268UL, 0x657be6a7e0e977f4UL, 0xc5a723b1b54de88aUL, 0x2d53d1366ac55a3aUL }},
+  {{ 0xdec99f7cc06e7d93UL, 0x1dd282d88b7a6665UL, 0xe40a282e6e8ffa48UL, 0x25610eef16398286UL }},
+  {{ 0x39c553dcd85da6eaUL, 0xd111c0c7f825ffceUL, 0x68d05a1d227adfadUL, 0x1693a918a92a76f5UL }},
+  {{ 0x4492541b73aeac1cUL, 0x5c79f154ebd2102aUL, 0x1a7c99d42b52da09UL, 0x18cdf528be2509f6UL }},
+  {{ 0xa3a87ce9872064bcUL, 0x7994b2dfb2aceaa7UL, 0xde6ea0806aa7738fUL, 0x16e9a7a3ff5117b3UL }},
+  {{ 0xcc7c0aa9fddec10cUL, 0xd0de91abf3ebb0c7UL, 0xa051850a540beb7aUL, 0x280ce29b8dd03be4UL }},
+  {{ 0xc7bfd28cf032e9b3UL, 0xc6bde0d880b48cf4UL, 0x8ac51749cb87e44eUL, 0x0597e35ef23fc51eUL }},
+  {{ 0x11120a81bd4ebe3dUL, 0xfc50b8c3b823c188UL, 0xe44fe1b51bc75375UL, 0x068e843d58475e60UL }},
+  {{ 0xa79ec978c1457592UL, 0xfb00d1597d614f0fUL, 0x62ea7d65d0e5af5fUL, 0x1e65acc785ee9199UL }},
+  {{ 0xb8096280e871a0ebUL, 0x2a7d1c005f3baa04UL, 0xaf93d5ed0a17b7bfUL, 0x1472e8880402e32cUL }},
+  {{ 0xfe341858f21c3477UL, 0x643761da7dbb12a2UL, 0x97384532cff92169UL, 0x2777154d9b4c560dUL }},
+  {{ 0x6748ac3b137f7860UL, 0x47a2492d87113820UL, 0x115b9d2f19600046UL, 0x1340300874f05188UL }},
+  {{ 0x0878dae5836e5ccdUL, 0x2667a188678b6d48UL, 0x55344c91baaad2a4UL, 0x1e8fed868be1ca31UL }},
+  {{ 0x13228cab8d949453UL, 0x846be289b707560aUL, 0xba2619c569c8f1d0UL, 0x2952702ed95c558fUL }},
+  {{ 0x426b0fa48727d4beUL, 0x9db4ca19f27ceafdUL, 0x213eb7988e2d48c8UL, 0x132980f520071a37UL }},
+  {{ 0x34674ca4ca94d7c5UL, 0x8f6afc0af496c69eUL, 0x4868065fedaa0808UL, 0x0929fda6b5e72bb7UL }},
+  {{ 0x8902efc527f52609UL, 0xe9aa56ccfe3dc1c4UL, 0xff6fd0ce51cebbd3UL, 0x10b0dc574715efe1UL }},
+  {{ 0x7aa4933f8219bf72UL, 0xc7cc0a989549b1d5UL, 0x340d182cc118477aUL, 0x1943e33ad576d4bfUL }},
+  {{ 0x1b7d780d5a150f33UL, 0x36dbaf0b2cfa65c0UL, 0xbf5b5ae39a03536bUL, 0x169c86af210ddc9aUL }},
+  {{ 0x45a813e18f800d08UL, 0xc4c498f84421ec4aUL, 0x8ba1b818dcb30bd8UL, 0x0df22e762caa2a76UL }},
+  {{ 0xd061f9b14b3d772dUL, 0xbdcb5e4c5bef4d12UL, 0x4182db0c1f6f5c80UL, 0x2903ba01be5ecb9cUL }},
+  {{ 0xc3a035c446078ca0UL, 0xc3d93a7c06652d88UL, 0x2891dce14afedadbUL, 0x11ca78ead50c54e8UL }},
+  {{ 0xb70aa4de0ff71ea9UL, 0x5942f27ad66b06d8UL, 0x0ac4ef4dcb0e641dUL, 0x1eab113c43f1c2b1UL }},
+  {{ 0xee8912eca70be677UL, 0xe3a7409d57dd2c63UL, 0xf90ac8da833eeda6UL, 0x1a3b7b91e37b80f7UL }},
+  {{ 0xe92f38d29ba56926UL, 0x8e0a150d2483ded8UL, 0x4fd611cf60236eddUL, 0x1e632f5a8b3b40caUL }},
+  {{ 0x5fac88052c64d41cUL, 0xd67de3853b6e6f72UL, 0x052ba632bfadf075UL, 0x0fcffe454993c77aUL }},
+  {{ 0x5a73392a70e1b830UL, 0xd35f28be438a1271UL, 0xf39dc381d25a1b07UL, 0x2e63deb22f01c740UL }},
+};
+
+static const fd_bn254_scalar_t fd_poseidon_mds_2[] = {
+  {{ 0xf8b2f47577922da4UL, 0x49c37c46f4fa97b6UL, 0xead42bc5207ce75bUL, 0x1e6197b9dc74448bUL }},
+  {{ 0xc91fea8d2d7f6eadUL, 0x4443f72e7c6ff1e2UL, 0x03a88bce6ac257ffUL, 0x264b0b0f2fad086dUL }},
+  {{ 0x536d530e1905be54UL, 0x53cc09060b99f372UL, 0xfe8b92243f7d9e58UL, 0x2e82e796daea67c3UL }},
+  {{ 0xe2e3947380b63a9cUL, 0x6780f80ec0391debUL, 0x4b955057a5d7a0b5UL, 0x12df481b6fddc490UL }},
+};
+
+static const fd_bn254_scalar_t fd_poseidon_ark_3[] = {
+  {{ 0x83bbbac36534a858UL, 0x0971619601250a07UL, 0x27a219050e23910cUL, 0x1638bf18c8507442UL }},
+  {{ 0x5e2bb0e6bb25631aUL, 0x56b042b8def5875eUL, 0x01bc3e10a8e9b451UL, 0x17bfe16092ef1d7eUL }},
+  {{ 0xa4fef9b954508d89UL, 0xafeb6b7d4ee4c69eUL, 0xd8ebe8a7fc301c39UL, 0x1840976e07ad780cUL }},
+  {{ 0x18b8e553a04b72cbUL, 0x4d654fb8ec90df10UL, 0x3f8dafc39d1b9658UL, 0x1a72c6a50e4e6a8aUL }},
+  {{ 0x44f18fdd12c7177aUL, 0x43d28a9b520bd0eeUL, 0x440b83130192f008UL, 0x13c53f3b277b2fdeUL }},
+  {{ 0xfc116b6c9e33b756UL, 0x933e67d042eb5320UL, 0xabc0d9f2c9d9bdcfUL, 0x23b0bd1fabcb64b0UL }},
+  {{ 0xde8ebdf8535243afUL, 0x1e851377b3d81387UL, 0xdfa4b107ef127fb9UL, 0x1e12da839a042314UL }},
+  {{ 0xe25ff0a9dd264f6bUL, 0x0215e509d49d08b2UL, 0xc2cf093542425093UL, 0x0baaf53d85cb02e0UL }},
+  {{ 0x6eaa462f90cf8115UL, 0xaf07e5d221dd2e13UL, 0x9a0b65abec88aa63UL, 0x1fcea175624b262fUL }},
+  {{ 0x99aa70f04fe89c1eUL, 0xdc11129d80826695UL, 0x1a68006fcc353aeeUL, 0x299ea7eabe5d4996UL }},
+  {{ 0x413df2c8c5541138UL, 0xeb469618c9de6bb3UL, 0x1a668e52b76fe275UL, 0x0fed7116657d8da5UL }},
+  {{ 0x4c5cd4085911f6dfUL, 0xa69c3b9c95ae98e6UL, 0xf308d88c93d19608UL, 0x079c79c9cffd5ad4UL }},
+  {{ 0xdd5d50a6115b6ae6UL, 0x3e2079ce31994482UL, 0x0beac0a93142d7a6UL, 0x29838a07888323b4UL }},
+  {{ 0x3031a7c21bf4f9f8UL, 0xf093c1cc653a991aUL, 0x092a0cd128aac7c2UL, 0x1e230e4aa7c4c266UL }},
+  {{ 0x2a72b06d29407105UL, 0x281dbf7148ac7771UL, 0x175c5083bc22a44dUL, 0x08c912947cf53b92UL }},
+  {{ 0x7eb180a889ee3c2dUL, 0xd38343a986d44c8cUL, 0x286bdbe0472b1d0eUL, 0x24f6be203117cc53UL }},
+  {{ 0xe221229550b8eb66UL, 0x9ffe52fabfc796ebUL, 0x1b9eef2ed361ed14UL, 0x0c575104fa7034f4UL }},
+  {{ 0xf9b28f842a2e4643UL, 0x4d5c080bd2ca1317UL, 0xcd76ae812c271eb9UL, 0x0ea4878f3b96e943UL }},
+  {{ 0x1b12a0ead7ee00cdUL, 0x794461ec0d8acd32UL, 0x3abb3e24c75e20a7UL, 0x27cb85854f2c16dbUL }},
+  {{ 0xc34a0ce29e5c844aUL, 0xbae3900198f23f61UL, 0xf582e09985e6d0c4UL, 0x055c6d26a35cf2deUL }},
+  {{ 0x33e1751f74f74c21UL, 0xdef83f5279f2ec1aUL, 0x3ce7d0bd374490baUL, 0x0eecc29342805119UL }},
+  {{ 0xe45772c6259d3e58UL, 0x4c683f93ebeab683UL, 0xfb8c13b607a4642eUL, 0x2e3e8ef03eeaed41UL }},
+  {{ 0xd197c44c630c5eb4UL, 0x053857ab70186b79UL, 0x18ee44c7bdb0d26aUL, 0x18b94e2583a0557bUL }},
+  {{ 0xd27736b000acdc77UL, 0x258b4b227cbcb7f5UL, 0x40df2e84269de616UL, 0x209aa4bbc966b500UL }},
+  {{ 0x5aafe5dc0720254fUL, 0x0e91a580f18d1016UL, 0x11a00abff154d5b7UL, 0x28083140319b0d09UL }},
+  {{ 0x624ed13efd7f2bcaUL, 0xcc9e53bcf2c28b13UL, 0x7ca39c04d885ccfaUL, 0x032c7e9c1ed0d643UL }},
+  {{ 0xbee575ac208c3258UL, 0x8976d09923790363UL, 0xeac3c4d39b58eaafUL, 0x28585586ade6e3d5UL }},
+  {{ 0x275e64927c987248UL, 0x1023453306381ce9UL, 0xd90511a7cb2159f6UL, 0x2997881a59a4151bUL }},
+  {{ 0x96ea7b645b7ee005UL, 0x12e49ee4759a80d5UL, 0x3ff0710c0c7c209cUL, 0x1207d4f65a29a973UL }},
+  {{ 0x225570d6a943095fUL, 0xa11ab5832d54aa69UL, 0x5ed544b9dc72feacUL, 0x16ba83b29fa0dfdeUL }},
+  {{ 0xd35fe784498f8347UL, 0x448e2c74dc5c310bUL, 0x8bc35d4158df81d3UL, 0x11a01d27b058a3b8UL }},
+  {{ 0xcf4dac5594af2d83UL, 0xc6f6531b8cc21243UL, 0x6e65adc157b9548fUL, 0x082a1067f00d6dfbUL }},
+  {{ 0x173fc30b103a6dcfUL, 0xc91b63e498d301c3UL, 0xb8f7ea4064eea1f2UL, 0x06548827d7df35e4UL }},
+  {{ 0xf1dcdd1866e91665UL, 0xaf44edb31bfcc76eUL, 0x69a2f851bc5fdeb1UL, 0x16a3add7fd6847e5UL }},
+  {{ 0x277fa19569af0ab3UL, 0x28e4a94421550cd3UL, 0x8b1893dc1510def2UL, 0x152b3eebf2e3b9afUL }},
+  {{ 0x82a43eaade461743UL, 0x4bd307501a719bfdUL, 0x94e914f0f35fb5eaUL, 0x2d45e6c07093f3ecUL }},
+  {{ 0x1307c7dfcdec9d68UL, 0x569ed7de9138f494UL, 0x3345109c6374a0b6UL, 0x21b5a1904b9d9fa1UL }},
+  {{ 0xeb775b5909a98dc7UL, 0x54a57335128a23bfUL, 0x5b11e52888015162UL, 0x212a6cfdd608fde8UL }},
+  {{ 0x4c04265f18d146f1UL, 0x10d10bc4c7853d4eUL, 0xa8e2a51db14f2f2cUL, 0x0f5fd95645106055UL }},
+  {{ 0x68dd43d7b51c37ddUL, 0x1e46476089e1d073UL, 0x58e04cf38f805754UL, 0x0b0bbf5b8688b08bUL }},
+  {{ 0x1b14f57c4122a309UL, 0xe02913572e132548UL, 0x8d3c17048b7c32dbUL, 0x22434cd0616dbf37UL }},
+  {{ 0xa0a5d482a6154db8UL, 0xd1c8cb01ba422f45UL, 0xb8a57919e05a3d45UL, 0x285a24a238af96cbUL }},
+  {{ 0x1aaa1405fafbd364UL, 0xb8d8b685230034b7UL, 0x0b7aef992fcc0854UL, 0x28d85f4b9f36af66UL }},
+  {{ 0x21fc148d2efde136UL, 0xc0a3008d29eeb0a8UL, 0xf3914ca16745a3c9UL, 0x0856523236dd2341UL }},
+  {{ 0xa14a336112fbf9f3UL, 0xb1ff289ba2eae970UL, 0x32a2feccaf57f78dUL, 0x003726ecc0267f6cUL }},
+  {{ 0x65e4051e623a8231UL, 0x3de6d47d48c406d3UL, 0xa9bbd406bdb8ead2UL, 0x0d600d159a165a0cUL }},
+  {{ 0x50648feb424d5e04UL, 0x78694de6ef267969UL, 0x5aa8b3580718f950UL, 0x1b044d4e05de9b70UL }},
+  {{ 0x2a796e5ea8f4e119UL, 0x946bbb44d739483aUL, 0xe21604d22b7ff1bbUL, 0x0c4327027869e663UL }},
+  {{ 0xe85e117615b09542UL, 0x96ce582e170967b3UL, 0x065b39840af36d54UL, 0x11b11f0e477f05b0UL }},
+  {{ 0x0d74f0994cb254bfUL, 0x4f4e4871fc63bd6dUL, 0x89d7b727ebdad559UL, 0x2cf20283390eb822UL }},
+  {{ 0xa30b526823bdb058UL, 0x886bb7b6f8eccd0dUL, 0x1f437e6dbc295914UL, 0x29ad2879e6833325UL }},
+  {{ 0xec3b39410fe43a5dUL, 0x3fb9d90ddcfa176aUL, 0x5fcaa229a47556d0UL, 0x07a583162e51b6d8UL }},
+  {{ 0x5b3fe2630608396eUL, 0x1e4496112e954403UL, 0x855a9daaa37c42a9UL, 0x10f643f4b4fa5128UL }},
+  {{ 0x28590d0004f98e35UL, 0xe13a159fc2cc8cf6UL, 0x8d22be85be68317aUL, 0x085a637b8618db96UL }},
+  {{ 0x5588c6954188d4d5UL, 0x28bdcaed360f0373UL, 0x67cc7a411974cf44UL, 0x27ab756e2cc849acUL }},
+  {{ 0x32a0c18f088e99adUL, 0x22795c50dd9cc1f3UL, 0x39c0855c6dc26a51UL, 0x12388feb2e428a82UL }},
+  {{ 0xaddbd56d19cb859cUL, 0x2f7ceda49032fb62UL, 0xebdf3719874c459eUL, 0x036d7aa8bc44149dUL }},
+  {{ 0x2caa41d785b941c8UL, 0x971e4e4c154f2c6bUL, 0x7874a8d468e0e6c8UL, 0x07b4735d54f5d234UL }},
+  {{ 0x01f51a3aa044c8f2UL, 0x7a636b4bfcab2c29UL, 0xb31eb377a96a00ceUL, 0x0f0c53f00bb104acUL }},
+  {{ 0xd79328003e9566e7UL, 0xed5f36c07d3074baUL, 0x8a2da6c60a9e4cb8UL, 0x28bd60c78f4c27c2UL }},
+  {{ 0xfffebd8720631bbcUL, 0x8efe2a4219d8aba5UL, 0x6bdf4ded7ef1b62dUL, 0x1ff6c9e06d6cf68eUL }},
+  {{ 0x22a696d457b8106dUL, 0x8b98ffed5d4905f8UL, 0x5edf9329bbef0232UL, 0x1392824c46ea4c39UL }},
+  {{ 0xab107cfef787c8a0UL, 0x278e7c4207fb3230UL, 0x99b9ea6ce46d8256UL, 0x0d682fd0fb31a00eUL }},
+  {{ 0x4ecef90fb11c850cUL, 0x84e45781c9eec3a9UL, 0x8ec25128e2f1f4f8UL, 0x2a2c1a8412a70cceUL }},
+  {{ 0x8f369a4d332e2cc7UL, 0xb22c513234251590UL, 0x706ac3aeb811231fUL, 0x19740e5e8ade8979UL }},
+  {{ 0x221080f029f28b75UL, 0xa437450974cb1e94UL, 0x87926f33c69f3da2UL, 0x029cf616ee2ad166UL }},
+  {{ 0x02442c4fee11e91dUL, 0x5dc410e07fdcbe17UL, 0x1a867232b63d9457UL, 0x1a1c9a07b2782748UL }},
+  {{ 0x1edb82dae474f114UL, 0xd3bc7df0735a0a00UL, 0x03b3817d280da899UL, 0x0701ed4f517f4c79UL }},
+  {{ 0xe14d649a6bf08497UL, 0xa3ea3ec2fba171b1UL, 0x8f61083e65c736bdUL, 0x1ac1a9fdf38c7ebbUL }},
+  {{ 0xcf49198274ef25d7UL, 0x562c05e01036644eUL, 0x3f41976e276e258cUL, 0x1f5be530194ef994UL }},
+  {{ 0x82c0529d3b0c6560UL, 0xce8537e7cb3d788cUL, 0x92494f9d3bd8e8bcUL, 0x132c81f43fd33e53UL }},
+  {{ 0x3f40cc1629cd3111UL, 0xb9f9665b8d257da8UL, 0x185f61f8e8e16198UL, 0x021adba7bd33ab21UL }},
+  {{ 0x342f2a113fd36130UL, 0x9ceccbd5349c530aUL, 0x617bd57533444841UL, 0x1648cdf733eee1d3UL }},
+  {{ 0x9efbd552827fcf73UL, 0xfaebeb1c6ab69375UL, 0x464172e7be8e88a8UL, 0x0847931e0d042c0fUL }},
+  {{ 0x120193648a28dc6cUL, 0x988a6302e7370526UL, 0xa78edb0d97474b0cUL, 0x19959641a1b547faUL }},
+  {{ 0x8e6dfb112427c2d2UL, 0x20c25819e588e384UL, 0x1d88377d30897cb6UL, 0x2a508af373b9729aUL }},
+  {{ 0x1d14c873ddc51680UL, 0x0e0da86908009656UL, 0xbf4ec9ba1340d6a4UL, 0x0098bdf65a0afb9cUL }},
+  {{ 0x50d73614f3243e60UL, 0x45209e69e50c537eUL, 0xbf44d99fc759be13UL, 0x279f34df0724a583UL }},
+  {{ 0x219cffe63c3aa682UL, 0xa6dd59c7425acf48UL, 0x444cb706acccec8fUL, 0x2e8c17deff5b9dd4UL }},
+  {{ 0x9997c91436bf5d0bUL, 0x1629fb48677678beUL, 0x49c4d97bdb9eb29aUL, 0x2035dd09daa0d61eUL }},
+  {{ 0x10168e7c8e51546bUL, 0x507ec1516ab22d0cUL, 0x1a194fcaa4bf09c0UL, 0x0c637dc86849f4fdUL }},
+  {{ 0x57fe04691ea6f531UL, 0x2190682e353d037bUL, 0x72e47ef9e904d3b9UL, 0x211f475dfb3c75edUL }},
+  {{ 0x7e838b86503617d0UL, 0xe6bad1948ae1955eUL, 0x707e58fad5b30483UL, 0x0a0972982b764b31UL }},
+  {{ 0x03bb8a08fc34185cUL, 0x7697ad2d4d810bfdUL, 0xfd12136fc816f501UL, 0x120d076c88279b56UL }},
+  {{ 0xee24105eeb22800cUL, 0xb7cbe7af82283d5eUL, 0x6191e1e38cd71bb5UL, 0x1aeaf2e491efd9a9UL }},
+  {{ 0xa04e07018cc9237aUL, 0x5361733b3151e0b6UL, 0x40e61ee38ddf97c3UL, 0x227af916f8b30fd4UL }},
+  {{ 0x3a89c2121dbc8729UL, 0xbc8fbdb3d8db1a87UL, 0xe86e48af8d840b86UL, 0x2ce7a4cb0acf31c8UL }},
+  {{ 0x5034a090dc3af464UL, 0x6ed46f82617008aaUL, 0x358e71ffd819f7e3UL, 0x26c8080ae116e13bUL }},
+  {{ 0x788952cfb8b52e37UL, 0xefc72a5be7fb7fbcUL, 0xc77bac4f9459447aUL, 0x001040af8a6d261eUL }},
+  {{ 0x16e6d600d2ff7426UL, 0xca5f5816acfc9401UL, 0xe38beefe9a0e0072UL, 0x21938b191a7bc331UL }},
+  {{ 0xd5b44d21a21f9297UL, 0x86167973aa7d0743UL, 0x79bd6f4550d4e54fUL, 0x03cfdb40ac6940caUL }},
+  {{ 0x9c929ba1d69d55fcUL, 0x87d64dfc151271aeUL, 0x2d27e3179fac9536UL, 0x1a90b4df9101e879UL }},
+  {{ 0x7499664fc0ebe7ecUL, 0x09716f8e84931303UL, 0x4cc0dccb94634b45UL, 0x1a32f5ff8519e33cUL }},
+  {{ 0x870877b73b9bcaa9UL, 0x1881870f75379e4fUL, 0x9f3f06e451a7e672UL, 0x1151fe3bb41dcb29UL }},
+  {{ 0x0b7cb1a81cac0430UL, 0x271f481c441f88f9UL, 0xeda16949984a6294UL, 0x073cc8fe043bb91cUL }},
+  {{ 0x5d4c4bfe348cbfe4UL, 0xcfd654c4476c9489UL, 0xdd48f53cf0b1efcdUL, 0x06c975ea69621011UL }},
+  {{ 0x39fb6c74184c9024UL, 0x80e79b39a143fe21UL, 0xb1253d509d48cbfcUL, 0x1a4900be8c52124dUL }},
+  {{ 0x190a59d14d51b5c0UL, 0xa444e21ad8bdb73aUL, 0xb2259807fe061798UL, 0x271a2e9bbfcf2f6aUL }},
+  {{ 0xc0af13dc96417133UL, 0x1cb1c8979c88420dUL, 0x353f8e5673b9f841UL, 0x0ad2874818ce1183UL }},
+  {{ 0x5eae10d5fd0f7d29UL, 0x7da0cc2beaa853e4UL, 0xb844b04ad2a3b6e2UL, 0x0b184f0b40c038eeUL }},
+  {{ 0xe5e995b4b1d54591UL, 0x19548f28b12e5099UL, 0xe0da5976f40f1c72UL, 0x1c55359d2d014456UL }},
+  {{ 0x68c411465f6f87d8UL, 0xa3a18882c980c957UL, 0x5c79518c4fabcf20UL, 0x26edc29497bc5cb3UL }},
+  {{ 0xb50f63c3948b6732UL, 0x9c160bd71ae1dbb4UL, 0x24cfd9385abff66aUL, 0x02063a7ceced9ea6UL }},
+  {{ 0xdb0cbc35d22245b0UL, 0xfe86319a55232e6dUL, 0x6105fbfdf3add538UL, 0x2c2dc27c38d94255UL }},
+  {{ 0xf1895d988a8c8995UL, 0xdedefbad0c1b5a82UL, 0x5f3fb8bc0bd416d8UL, 0x0e2a4c7d21d78dc2UL }},
+  {{ 0x72f59f40b87cd518UL, 0x619b20e02d8b3ee3UL, 0xd6ebb896f7d9329fUL, 0x211c1fdf6141dd3aUL }},
+  {{ 0xd6e372c64f54c992UL, 0x99827b2bf785abe0UL, 0xb67492d94fbeae14UL, 0x0288174a915f1cb7UL }},
+  {{ 0x0cee89601a4ad1c5UL, 0x66dee7acd570e8b4UL, 0x237331b25471fc2cUL, 0x0f79a3dc068020d0UL }},
+  {{ 0x898fee0b8f31bc12UL, 0x5c8954aa2da1961cUL, 0x77326678c3da12afUL, 0x144313217a7f389fUL }},
+  {{ 0x05f342cad3b4864aUL, 0xe2c7d39d0656a010UL, 0x61b8bef5da62a23fUL, 0x195806ad7b6696efUL }},
+  {{ 0x76c6fbf50cbdef02UL, 0xf535ea975a6b40f4UL, 0x0c5fe2383fe86bceUL, 0x117abeb34b8688b9UL }},
+  {{ 0x722fcd9132e35924UL, 0x8d991c0f2fa40665UL, 0xab060365a33bc385UL, 0x0b61468d5f2060aaUL }},
+  {{ 0xf37de77a8f1be22aUL, 0x427159a97577781eUL, 0x14e99813266148d9UL, 0x138e8d0f0e5be0c4UL }},
+  {{ 0xe1543733c9bb6fc7UL, 0xd8c9704535e21c8cUL, 0xd433edc282de438cUL, 0x11466ae0f81b3763UL }},
+  {{ 0x2cbd8cdb39524874UL, 0xf9855b644afce00eUL, 0xb290cb62abfbd66cUL, 0x25acd478b1084494UL }},
+  {{ 0x8ebc6672b41dcee8UL, 0x606f0745849196a1UL, 0xe55ae090bd88d82aUL, 0x009470554167249dUL }},
+  {{ 0x062094bcc7a6418bUL, 0x2803495b8583c637UL, 0x53eb48b97437c010UL, 0x0c7a1222e9138165UL }},
+  {{ 0x27eab79c36018a4eUL, 0xbd1864c1d0c4068dUL, 0xf902113a25a237e3UL, 0x128d87abeb1e9c1fUL }},
+  {{ 0xdb7fc417f7652d14UL, 0x58bd4f3aaac09e67UL, 0x728f58664d60e85cUL, 0x0f85a634b96fdda0UL }},
+  {{ 0xe32fe000e302eadcUL, 0x7d23c3dd3c7df083UL, 0x5bd45107b443a012UL, 0x2acca27428d1a73cUL }},
+  {{ 0xbf727ded10944264UL, 0x4ebf249fe7df1f42UL, 0x9ae7e1ea5448317cUL, 0x098478d1386f06d1UL }},
+  {{ 0x41702faeb62c6d90UL, 0x5dea60565d31eda6UL, 0x99144c98f362ec45UL, 0x0666d88648f73f04UL }},
+  {{ 0x83b3ca7e199d699cUL, 0x32ebc3b0c43d5f81UL, 0x14a61edd1a1d5f6bUL, 0x2cb5c8fea1103978UL }},
+  {{ 0x5d05e3ae54a68bc4UL, 0x4faa9d463460a6f2UL, 0x7f3ed5cd074f3aafUL, 0x2d280f20dae67de3UL }},
+  {{ 0xd2efe4ca6dada240UL, 0x85c3424c91e6e450UL, 0x67ded928e819912fUL, 0x2a47110115ad187eUL }},
+  {{ 0xfd689c88325914baUL, 0x217ccba0c4f678a8UL, 0x775c3aa0caac332bUL, 0x0237eeffadb3dc0bUL }},
+  {{ 0x951cba230d48ab5aUL, 0xac60fef56f7dcd80UL, 0xee0e118c667a107aUL, 0x286963de12abebebUL }},
+  {{ 0xd5bf474c37545102UL, 0x8df0210724a7bbf7UL, 0x2869e00fd06cee5cUL, 0x10a5a9a9e9679a80UL }},
+  {{ 0xb756d548a7c1fc31UL, 0x91a8ff87ec937a72UL, 0xc052832f337e9900UL, 0x0529844a975226c0UL }},
+  {{ 0xd6bd6219ea723ea7UL, 0xb15ef75a47a73dbcUL, 0xce0d24f3bcdba423UL, 0x00f2c9c00b75da95UL }},
+  {{ 0x8839b8e43934561bUL, 0xeed5c479997614afUL, 0x8e13af4ce37ec975UL, 0x1c11b1381a0da7d1UL }},
+  {{ 0xf38903221b52a70dUL, 0x57941bad5616f0b4UL, 0x79e0e60ac24d695aUL, 0x28196a6e4dc51202UL }},
+  {{ 0x064ebe0c3dd24eb6UL, 0x3802fd84feb04f9dUL, 0x86b2d2b0907fa843UL, 0x2c574ff686c617aaUL }},
+  {{ 0x4350bfc9d26b3c37UL, 0x21c07f7c582555a7UL, 0xc26f0a1a39e61d98UL, 0x23e04b5b20773885UL }},
+  {{ 0x9ecdf0801c4960f1UL, 0x90455ea0aa5c29bdUL, 0x7a4f7128a78bbda6UL, 0x08a72f2200068a14UL }},
+  {{ 0x8e78423055561239UL, 0xc68657f8b6a9b0c3UL, 0x3c1f30023e9a9859UL, 0x020a5307957c386bUL }},
+  {{ 0xc2b2ec89df413870UL, 0x698417646a3cbfa5UL, 0x85b88d3108e46241UL, 0x1153cf64cd3c1731UL }},
+  {{ 0xd3c742f41b1facfdUL, 0x48cc11f7ce5600d8UL, 0xd924a20425ad06caUL, 0x2b92d896b64a36f0UL }},
+  {{ 0x47e3641e16232e80UL, 0xb5b83d38f4118ce6UL, 0x9c757d818e9fe957UL, 0x0f040021849b01ecUL }},
+  {{ 0xbf3cd76e39709602UL, 0xe2d93e6cf717615fUL, 0x4e5f8607aa4aa483UL, 0x1fcceb2264ae4e31UL }},
+  {{ 0xcad7b25f437a38d9UL, 0xf66dcd4743bd617aUL, 0x75627910ca985f41UL, 0x1c2d962253a27827UL }},
+  {{ 0x3eca0791994cce65UL, 0x059234b17e8476d9UL, 0x8403f0cd92adc262UL, 0x2116c5244c9f73b9UL }},
+  {{ 0x7ebcbcd0ece065e3UL, 0xc1a06905a0139ff9UL, 0xf0e0a214eafcce74UL, 0x102221a24bb3f1adUL }},
+  {{ 0xc73946d2fd0793c6UL, 0xd684e968a7714ca9UL, 0x4516892656a0baddUL, 0x2bb1a1d769bcf7e8UL }},
+  {{ 0x6b45148d7b52e3c9UL, 0x030bfb6edf8c0734UL, 0x78374b448edd38c4UL, 0x05ba2d1f46a5b689UL }},
+  {{ 0x96a850062bca34d6UL, 0x1af76c923852014eUL, 0xad93ce5cfda5d027UL, 0x1c592caf1ab3d348UL }},
+  {{ 0xafbb1743f0bb4932UL, 0x6a7696e10bda8c0cUL, 0x07a07831609bf58eUL, 0x2d35e80598271115UL }},
+  {{ 0xdc24c33ffdafcabcUL, 0xf4dd4a38331852d4UL, 0x5ed1b79ac97e8d89UL, 0x07fcc7dca8d2fa83UL }},
+  {{ 0xe41041004d1b83f0UL, 0x09933bdb3497d06aUL, 0xa3a268100bbdd441UL, 0x2dacd4f6ccf638f4UL }},
+  {{ 0x41e818cce281e4e9UL, 0xdacb05da4c9f0b3cUL, 0x9c98e80797123b9eUL, 0x05c2785171cf9893UL }},
+  {{ 0x8bb70713661dd3efUL, 0xa3219b41e1e866e4UL, 0x4841aeae94dbafcbUL, 0x1f04ab075b343c2eUL }},
+  {{ 0x09877b99da1ed4d8UL, 0x3e1b13bebb562ab7UL, 0xfd0a453abc796707UL, 0x1b08caf18fe542b6UL }},
+  {{ 0x8772776c35ed4ddbUL, 0xd1e483c46dca8f20UL, 0x3d6ef5b0ece3cb77UL, 0x04350d60ac3cdedaUL }},
+  {{ 0xd59789d52dfd828dUL, 0xd0d4f5c7c7c66b69UL, 0x4184bf91b5309734UL, 0x0e09dedd81137365UL }},
+  {{ 0x3c46a5ad6730c5ceUL, 0x5c7bd37bda525007UL, 0xd57d1e170a707411UL, 0x13e189b521197bddUL }},
+  {{ 0xa6343ee1f304a26fUL, 0xca33c793d2ba7228UL, 0x25dad12500d4d448UL, 0x09cf827625852c46UL }},
+  {{ 0x797a8602c63a54d9UL, 0x1ac2bc433aa0e827UL, 0x7c3fbe7f580b7789UL, 0x03174635b882d894UL }},
+  {{ 0x4f16dab5318908d8UL, 0x618709ae9bb33e9bUL, 0x79f6ce9d1fcccdb9UL, 0x2a42c258663e5559UL }},
+  {{ 0x9352c66f8db85bedUL, 0xf76a6cfc91216ae2UL, 0xecadbbeeab6ddebaUL, 0x0501860d019acbefUL }},
+  {{ 0x33bbf7559b633beaUL, 0x59bc392c36c8c252UL, 0x13a0563e80b1aebcUL, 0x15fa97680663b761UL }},
+  {{ 0xd34b76cc7ce56662UL, 0x4637562052f0c797UL, 0x121bc99292d6f09eUL, 0x0a694fce552ddc2dUL }},
+  {{ 0x2c91b8df8e961db5UL, 0xe0847837f14b5eb8UL, 0xdfa9bfc0600b988aUL, 0x0e88c05fa2dd61ecUL }},
+  {{ 0x062b0126d1594ed2UL, 0xf6b8ef949360c8f3UL, 0x88685c33681f9b19UL, 0x057ca2cedc6147f2UL }},
+  {{ 0xbc4cb8237d1d6988UL, 0x40a88f0ac02628edUL, 0x38d89898d686d929UL, 0x2333cd11b0515c31UL }},
+  {{ 0xb242031f673208b5UL, 0x144ef3dff309ec58UL, 0x74d56678e4dc599fUL, 0x2ca99301804984efUL }},
+  {{ 0x5131dba233a4bed1UL, 0x8a8e1b36d8400bacUL, 0x21e59e8865901cd2UL, 0x0e5c8ec6f3fab0a5UL }},
+  {{ 0x2a4bb5fd88edc047UL, 0x5b86f3ebc68d0c2aUL, 0x54882f2a5688b04fUL, 0x05a94e75507cbe33UL }},
+  {{ 0x2b1caac2f8ecdb92UL, 0x1fc9ccb8dee0c00dUL, 0x132b98f93676a1fcUL, 0x26683390479088d2UL }},
+  {{ 0x35366d726512589dUL, 0x1a3e6b999132d200UL, 0xde087c496782aa42UL, 0x19bd0fcb4d53dd00UL }},
+  {{ 0x047cb750ec6c0762UL, 0x24d6a46e5dabb47bUL, 0xc919256c1ba14cabUL, 0x273396a78c4b62c4UL }},
+  {{ 0xf0b98c2b57687d8eUL, 0x80147c912063365eUL, 0x59b461ea91ba1607UL, 0x28c3fc150c32ff50UL }},
+  {{ 0xf5eccf1c3d434232UL, 0x473330d9dd3d1536UL, 0xade583c6c46d86b2UL, 0x2c598c961ec58e70UL }},
+  {{ 0x03b800160def6797UL, 0xc4cf4ab9a943177eUL, 0xcde7b62ac1588f3cUL, 0x06eecbd051cf7c34UL }},
+  {{ 0x0369b2583c6bd1fdUL, 0x0dbdc1a076d43177UL, 0xcb0dd179adcedd3dUL, 0x0bbe0370470abd29UL }},
+  {{ 0x7cef46f570a500c7UL, 0xd5c89d2b7ae0671eUL, 0x32a472d2e25b5d5dUL, 0x1819574a6430cd10UL }},
+  {{ 0x6f7de7d7f2113dc2UL, 0x9bad7676e26494ccUL, 0x59b77b7b4f7cb546UL, 0x2624ebdd096c1e37UL }},
+  {{ 0x11a5cdddfca66b49UL, 0x768bcc294debebe3UL, 0x852080c87fbfda18UL, 0x1c7d91a619b633eeUL }},
+  {{ 0xaae5e35d8145efadUL, 0xce1d50cae0bbe5f3UL, 0x36970cefb2134e9fUL, 0x1280d61543c46cfeUL }},
+  {{ 0xbaaef2d36b5468c6UL, 0x498f7feb859e85a0UL, 0xfbbe4f4fef131eacUL, 0x0b321fd2bfd3b824UL }},
+  {{ 0x73cf2dd7fb1b7a9aUL, 0xfa91136de4c46704UL, 0x7477293dd0a4ef08UL, 0x1b2e2f421e0c4760UL }},
+  {{ 0xb4af5805db788bf2UL, 0x4c06654190ce9257UL, 0x3c0942be862b0413UL, 0x19358aa7ecb1ffdcUL }},
+  {{ 0x1a5f2289be6e42d5UL, 0xb8558e89c40d8a7aUL, 0x6db403e0d417290aUL, 0x0df8c12d84359369UL }},
+  {{ 0x2c1623378fa50e7bUL, 0x334709d38676a013UL, 0x424966dfeb1a23e8UL, 0x13f728b84aee75c8UL }},
+  {{ 0x58cf088ebda25f34UL, 0x7a5d6a37c20a05fcUL, 0xc3e67e0e8ef2478fUL, 0x28cf15d813041154UL }},
+  {{ 0xcd9b371660e26854UL, 0xa798e006bde7c2a5UL, 0xa589cbbf8f0cde4eUL, 0x0cc83461e6654fc6UL }},
+  {{ 0x5aa5df881cf08b7aUL, 0x854536b686b10afaUL, 0x54fbdc7acbaf9ae0UL, 0x2267e5792b131883UL }},
+  {{ 0x6800c90673d40313UL, 0x370cc2be065355bbUL, 0x48b361af98b894c4UL, 0x1574397ef2d5da4dUL }},
+  {{ 0x980463e7193ce68cUL, 0xae87dc9d1a4abf45UL, 0x038a72f6f99cdb5eUL, 0x169da4f52a8f168cUL }},
+  {{ 0xc837d64534683bb9UL, 0xa1c5ad4757898b12UL, 0xc4eb6597a3d9aa3fUL, 0x10551f64e930629aUL }},
+  {{ 0xc276f1f23fa3dfdaUL, 0x07be179d0f4e390fUL, 0xef2cc368f6a7932dUL, 0x169888fd256ea6c8UL }},
+  {{ 0x0933f9e69fdb4920UL, 0x757798d2cb552ac2UL, 0x44617531aff8a6e8UL, 0x1c88dc66ae439deeUL }},
+  {{ 0x84d6faa1219d011aUL, 0x6c621fc73f57d413UL, 0x06661776bd78cbf4UL, 0x0d40569eac57478dUL }},
+  {{ 0x65a764cb33746490UL, 0xd857618b6d3d133bUL, 0x597d95e1bcb82d7cUL, 0x1999b22a5b250c0dUL }},
+  {{ 0x09913f64ed0f55ebUL, 0x71f4b894b1d49b95UL, 0xe64f2d869782046bUL, 0x2ac51c6d3b362aaaUL }},
+  {{ 0x4e1f1fb6f3864524UL, 0x183aa6e52734a295UL, 0x7a585dc7414a772dUL, 0x0e2e7f46b2e96900UL }},
+};
+
+static const fd_bn254_scalar_t fd_poseidon_mds_3[] = {
+  {{ 0xf2e8909a56fcf3d7UL, 0x8019ce3145ed8c1dUL, 0xdda896a228616418UL, 0x0e5ed723ffc885e1UL }},
+  {{ 0x3158f311d66c0469UL, 0x9511d96f69f040a0UL, 0xbc6996e5b22127bfUL, 0x07e69e17a7c9122aUL }},
+  {{ 0x28f45876169969b0UL, 0x3d6ded69e30a7649UL, 0x79aed6124c9b23ddUL, 0x03cf3048ffadf517UL }},
+  {{ 0x670d8bd946474dd5UL, 0x56daed800bf07baeUL, 0x5c98d51ecca20e6dUL, 0x1a3491eda18b0028UL }},
+  {{ 0xf0193e572ba79c47UL, 0x5fb2e46a6ee2dac5UL, 0x6892f0d5b6ffb984UL, 0x0df1dabd49661413UL }},
+  {{ 0x3293bffccaab272dUL, 0x85cbae38b11c4e1fUL, 0x67208956c8757b3cUL, 0x17ca537ab6c9d981UL }},
+  {{ 0xcc226561d2802757UL, 0xfcfbd22f5bb9f4edUL, 0xc8ef58acce2b8678UL, 0x05984bb41bae9c88UL }},
+  {{ 0x17561a5176bfeefdUL, 0x1cd5d7be100061afUL, 0x714cefb2dce7646cUL, 0x0043bf61f2173fe9UL }},
+  {{ 0x4c72e3c51c729128UL, 0xd35b9fd9170d616cUL, 0x4d095dc74ab700a6UL, 0x1282bdf76dc5d39bUL }},
+};
+
+static const fd_bn254_scalar_t fd_poseidon_ark_4[] = {
+  {{ 0x40e29857eccba526UL, 0x78b5d11f628bb63cUL, 0x90a91f8124d71c1dUL, 0x22b90b99257c701fUL }},
+  {{ 0xdda103bcd5e88168UL, 0xcadec275563908dfUL, 0xcb42faa49bda666aUL, 0x12c1e60e14878465UL }},
+  {{ 0xe2ee3f59de1800c2UL, 0xc7979d60539090baUL, 0xb17490108efd09c7UL, 0x157ae4cd6c889238UL }},
+  {{ 0x8d47060cfdf35e56UL, 0x24d3c6c56012e0bbUL, 0x23e529e2d9c7f211UL, 0x0ca313c0e7feeb7cUL }},
+  {{ 0x969ae5874ec24b7cUL, 0x178d4318d4b3aa33UL, 0x6c88dcc609ed64f8UL, 0x2f010ac693dc51cfUL }},
+  {{ 0x57fb28a4e65e43e8UL, 0x8879374e40bb2e20UL, 0x2edbd9642db3a00bUL, 0x03519d1e42f98e5eUL }},
+  {{ 0x6cd497820ea1bdeaUL, 0x7547fcc6a94b2b4dUL, 0xd170eabdd0b9a60bUL, 0x2d4d4875bba571b3UL }},
+  {{ 0x6ef12da5bec195b2UL, 0x1949053b40632693UL, 0x52a07adc23aaa26cUL, 0x2462f2ed9e08bb84UL }},
+  {{ 0x86b215d7eed56c26UL, 0x8e8a775ab44e8536UL, 0x4b28315db24328acUL, 0x2284e6859b91a22bUL }},
+  {{ 0x24435d7bbcecf683UL, 0x30558031784b101aUL, 0x8152ba72043ca93aUL, 0x2ef0fea092a1bf2fUL }},
+  {{ 0x31f7ebe8ea71df23UL, 0x5a40c44d8b396ad0UL, 0x12103e68c9964844UL, 0x2fbf0a0711796f09UL }},
+  {{ 0xd171b165b9a474d2UL, 0xde9cc2290d05e663UL, 0xaaa87c63209d7a7aUL, 0x138033c1c13594caUL }},
+  {{ 0x7bfd9fcbd4ed1036UL, 0x5d413eaa832eba40UL, 0xb509d471e9b81cf4UL, 0x1287cef711f48909UL }},
+  {{ 0xaa8460cf946b6f1fUL, 0xd383ed881df9301dUL, 0x13dab19464f23a61UL, 0x03edc8f24d94f496UL }},
+  {{ 0x8fb0a2baec4a0545UL, 0x62950a986fa7e269UL, 0x8b2e63ef08420ccbUL, 0x24357c1c0ff8ad46UL }},
+  {{ 0xebc3984647d708deUL, 0xfa8876a528054f45UL, 0x529aa21b353025aeUL, 0x11e5fb7b548a5daaUL }},
+  {{ 0x1c447b0131825829UL, 0x6eea85c396cfd279UL, 0x906fa66e44792b70UL, 0x0f417b2b1192fc58UL }},
+  {{ 0x893dc44ff4ab8c3dUL, 0xdc5162ae7480b4d7UL, 0xd2d2263cef2ce577UL, 0x2bff5bd4cf84da5bUL }},
+  {{ 0xb77ac980d5b4b49bUL, 0x333a038690498325UL, 0x7d075bd47648701eUL, 0x14e2b4d3be83b2acUL }},
+  {{ 0x529b26c9e1e7fee7UL, 0xe3b9ce82471f6c16UL, 0x7b784e18fc148e9aUL, 0x0af58ae3a7d121adUL }},
+  {{ 0xf8d1c651163db662UL, 0x1e3bceb597676b5aUL, 0x2e280d1a469bd269UL, 0x1cc9d2eaf4da683bUL }},
+  {{ 0x284f1e6a5e8c3243UL, 0xdf6e2c5fa443c438UL, 0xa141ac6c13990c9cUL, 0x2406d65ed9963ebfUL }},
+  {{ 0x833da6aed5e8b643UL, 0xf6e1ac68d94bbf99UL, 0x92e1ab49bac7591fUL, 0x1f14ec7cf779855eUL }},
+  {{ 0x1f360ba6b2dbe89cUL, 0x39a6bfcefa7aa570UL, 0x7f9114a8abd3c437UL, 0x241559c0a38ff005UL }},
+  {{ 0x82f0f015e32b0fa5UL, 0x15b14571a9827bdfUL, 0xb77fbead604b82fbUL, 0x084368258f1bd0ddUL }},
+  {{ 0x6e0151e98341eaabUL, 0x347e8c0f39d2ae2bUL, 0x2f6a4f01fd8e7354UL, 0x1224728eae4780c7UL }},
+  {{ 0xa64a59e07277da93UL, 0xec9ffe497e750319UL, 0xf8de0d292fd81230UL, 0x200ba0070e4cf7e7UL }},
+  {{ 0x3eee8ca147f74c1eUL, 0xb459e1c13d394847UL, 0xad3a506f72dfc6e9UL, 0x0024a1a4a98cdf30UL }},
+  {{ 0x4677744f22ba290cUL, 0x9665c3069828d067UL, 0x47a5ab4a08482095UL, 0x050856d34a7b53a1UL }},
+  {{ 0xe9ac990036447fd5UL, 0x67e1d967ff728f98UL, 0x520db222d8f9b85bUL, 0x300d753949da28d0UL }},
+  {{ 0xe0a4d3db3031c219UL, 0xbdfc328b9599d375UL, 0x11f23cd7fe507de4UL, 0x1bf0b2f3b0ae16c8UL }},
+  {{ 0x18018546eeba2623UL, 0x1de71123707f1b9cUL, 0x7f6c0e2ad000f8e9UL, 0x28f46b322d82057fUL }},
+  {{ 0x3ac593da4e5db6ebUL, 0x3ff4bba0193a3b2dUL, 0xe0ad26ec69346ef2UL, 0x24849ad2c138914eUL }},
+  {{ 0xa68ceacc9a188251UL, 0x905a4a607ab50758UL, 0xdeba6d539f998afaUL, 0x1fff49f7df96654fUL }},
+  {{ 0xc067c30e7cc3a431UL, 0x34d758f9cd522f83UL, 0x3435beccd217edebUL, 0x2a89e5139fbdf039UL }},
+  {{ 0xd5a6847c60a8f7ccUL, 0xd5aff503c7ba7883UL, 0x8b2bfd2ad28ddd20UL, 0x101835888a279fc0UL }},
+  {{ 0x50fa7503e3eb3735UL, 0xd8495c79cd5e9211UL, 0x7b7e2a5040c3544bUL, 0x197e6d90a94415a4UL }},
+  {{ 0x6ea1d22532ef2471UL, 0x4e96177082af0ac7UL, 0xed2f1dfb1189f2bbUL, 0x27fbb36a7bd9b353UL }},
+  {{ 0xa7ee25387ddb3c34UL, 0xf30145444d0fe612UL, 0x9c0473e043c5762bUL, 0x2bfa2b7461fc9c12UL }},
+  {{ 0xe74c0280a8d7a2d8UL, 0x15b2fc08d1baac9fUL, 0x7ef491cb5fda8359UL, 0x2622426d179ee045UL }},
+  {{ 0xfeea8798b783f986UL, 0x21f8b55837df791cUL, 0x4715c04841f1f926UL, 0x100ebb18ec5c3f93UL }},
+  {{ 0x122aa722f6947206UL, 0x522b121946ac0feeUL, 0x45b9250f69dac1c0UL, 0x25293cd27572f636UL }},
+  {{ 0x936f54ff136b08abUL, 0x700dd002430020ccUL, 0xd06242f794739877UL, 0x2268c9c162417cabUL }},
+  {{ 0x1c9b445dd0a2241aUL, 0xc11cb47b21df29cdUL, 0xf7a492c3594f0f09UL, 0x034b38a7146edc66UL }},
+  {{ 0x1dfe4ac0183b8133UL, 0x1ef0319b13fb779aUL, 0x11dbf892ab5f926eUL, 0x17a856c53659a7eeUL }},
+  {{ 0x059e222bcd5307a6UL, 0xccfaf000d2effb7cUL, 0x1fd59fef9a8cf932UL, 0x0c4ce24e93909eaeUL }},
+  {{ 0x42d0cafee2301d0eUL, 0x79696ca22bdcb93fUL, 0x5bacb0d63592018bUL, 0x29294687e7715542UL }},
+  {{ 0x42a5414804c7099bUL, 0x6fe76c6243e5c38aUL, 0x254493c8af4e6367UL, 0x1e3fcd8156bc983dUL }},
+  {{ 0xa7ff7255f2412486UL, 0x7501ca14401795c0UL, 0x2d0e3a0db6e4b1ffUL, 0x0096d162a3cc320fUL }},
+  {{ 0x789c20e48b1125f9UL, 0x528ce70d5612a45cUL, 0x8d645f61a75e2b38UL, 0x26549dc15b1fa715UL }},
+  {{ 0x775b5e0fba5758e9UL, 0xd39a069c41c98c95UL, 0x68a784316ed9fd47UL, 0x2dd54f4070bcfbe6UL }},
+  {{ 0x9d57dffcd1ba98baUL, 0x2554bc6bf0d32b4fUL, 0xfaa1a29bff5eaaccUL, 0x1bf848fcc8ea6c31UL }},
+  {{ 0x3264c88684b1bcb6UL, 0xb5e9ff4335f99477UL, 0x81aca7593bdc6348UL, 0x1a6338f428a0b816UL }},
+  {{ 0x24779cc69cba1deaUL, 0x308776f8218f1be6UL, 0x3a9e52d12b3f619eUL, 0x06d8d604ce3e2de3UL }},
+  {{ 0xc7b00cf37e64dc49UL, 0x06d1c1802949bc23UL, 0xfd608a1fa1b25168UL, 0x22ebae49ba188f7aUL }},
+  {{ 0xca1469d4458d8a3dUL, 0x7623fb53afb084b6UL, 0xa0abc7e8d556d8f0UL, 0x2a8b5c3b5f3dfadfUL }},
+  {{ 0x33f5eadd9c1595c3UL, 0x54d6810e1d084193UL, 0xa13eb5c950c2db99UL, 0x1ac1693fb6209dfcUL }},
+  {{ 0x57b804a8493ffadbUL, 0xf4ecda7bda07b05eUL, 0x365ad26d1dde9556UL, 0x26840fe4f165a935UL }},
+  {{ 0xcb958721444341c1UL, 0xd202fc009bbb1137UL, 0xe10a117befbfbaefUL, 0x2fefe67ccff0718bUL }},
+  {{ 0x57166a5f56a5da25UL, 0x9651ac4d559f2de5UL, 0xe0a3ce57440d7536UL, 0x1d7d8da39c2e8df9UL }},
+  {{ 0x955694cf7e751759UL, 0x1f19c299b2bf9669UL, 0x891a562d7d697b72UL, 0x25b1eb3a2c62c131UL }},
+  {{ 0x27d15e03d244680eUL, 0x52a139938503b16bUL, 0xa60293987e1780d7UL, 0x27bdf8da7f79736cUL }},
+  {{ 0x116f555634550fcdUL, 0x3df9127a2fff7266UL, 0xf3cd0bf9d381aa33UL, 0x16c19d6f034f31b9UL }},
+  {{ 0x66d80999699047aeUL, 0xd3be6bda729fbcebUL, 0xcfabbd2afaf882beUL, 0x05b5d05f43fd6e3fUL }},
+  {{ 0x2c74114e481ddafaUL, 0x807434126e9f472bUL, 0xab570928cd20418aUL, 0x283d4a89a200a5afUL }},
+  {{ 0xd411d7242d41f6b9UL, 0x2633b38dce58b2a3UL, 0xb88e71e3b9f250f6UL, 0x1fd33b9c3927530cUL }},
+  {{ 0x97b472e62acef0f6UL, 0x14790dc3fcd93bbcUL, 0x5400b0481e349424UL, 0x2ceaf69d01ac2e60UL }},
+  {{ 0x668c4cd514449780UL, 0x43c5c8d06641b850UL, 0x4f75ba88b2b749e2UL, 0x267a187cac4732f2UL }},
+  {{ 0xb085fdc4f9a8fb0bUL, 0x71be2e0129e44e36UL, 0xe6b0eeb850b499a4UL, 0x02b354c2103cddbaUL }},
+  {{ 0x0597e2d67467dcbfUL, 0xfb80c331cfc45fb9UL, 0xdac61e4a03d6a081UL, 0x1a11b729bcdb094aUL }},
+  {{ 0xf3fee4e36f25bfbdUL, 0x2e1ebc2bb09c65b3UL, 0xe2e0496cea732590UL, 0x0880a9b301012352UL }},
+  {{ 0x71df5a89af984d00UL, 0x7edb46887d56dd30UL, 0xec05215acaf42515UL, 0x18ff6fdc4fcf3d35UL }},
+  {{ 0xd452149f1a7623baUL, 0x13d73472905865d9UL, 0x68860941a82dff72UL, 0x00f33f4676757a07UL }},
+  {{ 0x0e60a44a6d294f41UL, 0x03b13324ddc4baa0UL, 0x4c7ce58cc39ab341UL, 0x139be6cb2abe19c0UL }},
+  {{ 0x9ee46be37fa5c783UL, 0x4b80d6e92fa0605dUL, 0xe18d39eaa0b58710UL, 0x019935cf03fe6d3bUL }},
+  {{ 0xa11eecbd6f646befUL, 0xdf805be13d0c2ba1UL, 0xb1843fb18f8d6723UL, 0x0ecac0e06c90fbd4UL }},
+  {{ 0x20ca3789db7f08aaUL, 0x8d4280081bb2f0dfUL, 0x37f8a0a772d173e5UL, 0x2704fea2f81ae93bUL }},
+  {{ 0x0b57a210d5ab61aaUL, 0xb5bcedca8189a1eaUL, 0x1cdbbf1ab293e0acUL, 0x100b4344f9ed48aeUL }},
+  {{ 0x907e5f4a9c057fc4UL, 0x575a1e1729d2396bUL, 0x2f81eb61b02a0d47UL, 0x201c9d0d354d25f3UL }},
+  {{ 0x6e0d1e92b19775e8UL, 0x1b0ff212c85487aeUL, 0x77fa05e5ed730bb5UL, 0x0da570e83ab6b8d0UL }},
+  {{ 0xe33228d2d96b8f30UL, 0xb89a3bb8fb9be93aUL, 0x35e9eca0bee565b1UL, 0x273df6b0ae156020UL }},
+  {{ 0xa436a2acdb5ac551UL, 0x8514ac3b41c606e4UL, 0xc28036d7cdf04c60UL, 0x1ea071117eb66e66UL }},
+  {{ 0x6126235d108821f4UL, 0x4a7765cfee75f731UL, 0x743ed0ff07674e14UL, 0x05925bb80a3cc48cUL }},
+  {{ 0x7a92010e5b2e74a1UL, 0xfee649f03b0684dbUL, 0x7aa7ccf81a3caab2UL, 0x23720c2cfdfbc79dUL }},
+  {{ 0x460a85496e304e37UL, 0xdd8f527562040055UL, 0x40a70979fd5a7579UL, 0x1f03fbf1087a3e1cUL }},
+  {{ 0x0b43e0bf81c186edUL, 0x47ce7c0961079afbUL, 0xb9f3357e2e55217dUL, 0x17e4fd8d6775a696UL }},
+  {{ 0xb74d133c633b1599UL, 0x4bf76b0fba2d94e2UL, 0xfec7cce4c5cd67f8UL, 0x183bceaeea7f1aaaUL }},
+  {{ 0x62a251f58bfc0bd8UL, 0xa47572f6ebc5885bUL, 0x37c60ff8efcf2b6dUL, 0x1fd8d931dc1b5f33UL }},
+  {{ 0x75b3e54a5cdaaffeUL, 0x7ec80dc1562dc345UL, 0x6a48129759a833acUL, 0x2fc9974a82a07fb8UL }},
+  {{ 0xeba8b0eb2795f017UL, 0xdba5a4f2a2641feeUL, 0x5792dd59f90eb5c8UL, 0x252e817931c59366UL }},
+  {{ 0x6a94198f6802fc00UL, 0x4af4f6a80279ac2fUL, 0x32916f9784f358fbUL, 0x07d6b6afbe4419aaUL }},
+  {{ 0x5970f06a69059757UL, 0x7f3029c3839f1ca4UL, 0x07aef1800e191c11UL, 0x0e5b98f37b97d967UL }},
+  {{ 0xc43dff0434b7997eUL, 0x949a692bb405c21fUL, 0x710c0ad545eef327UL, 0x2e519c190d8ab005UL }},
+  {{ 0x743edc296a356c08UL, 0xbcb91cac24d38adcUL, 0xd9056eb212ec5c9eUL, 0x1010f747fd0c8463UL }},
+  {{ 0x66efcd4ce7fe3608UL, 0x9c833d7d7e46175aUL, 0x92febc92e7776bd5UL, 0x1787e89c1708200eUL }},
+  {{ 0x36c3d3ee449ad781UL, 0xe2515055c4b45997UL, 0x9042908f4fde7f86UL, 0x020f985d6e9d8d45UL }},
+  {{ 0x1dac1abd3b5a9001UL, 0x51dd7fe0d39a3ca3UL, 0x6dfa5641c34e9b8eUL, 0x2a761370bb92e183UL }},
+  {{ 0x8466c220c3ee6bbcUL, 0x236705ae2b8fcb3eUL, 0x1d108ea940aabccdUL, 0x1982ea7529643450UL }},
+  {{ 0x7fb2b43005d6931cUL, 0x7a4dc146052eba7eUL, 0xfc7bb5a058187dbeUL, 0x26f223404d134585UL }},
+  {{ 0x4ab70f4d178b4763UL, 0x8efe6ff9b4a51f59UL, 0xfe541d4324ef4f5cUL, 0x1d7e9c034dd10b4eUL }},
+  {{ 0x5eff84b09e0720dcUL, 0x70eb23f4336b0dd0UL, 0xb7b4c6dc394e9b94UL, 0x06313b7f836cd6f3UL }},
+  {{ 0xe1680367db603c6fUL, 0xec1ce37c703f167bUL, 0x77ed16f9edfb76baUL, 0x0db1223727e76a84UL }},
+  {{ 0x4184dcb0878e2f8eUL, 0xcaf76e5617e33395UL, 0x87973035120f160aUL, 0x1088ea4553b89702UL }},
+  {{ 0x1c1283981a986fbbUL, 0xa13559c59b084bd1UL, 0xcc3c843e804902b9UL, 0x05e81d80059329d8UL }},
+  {{ 0x6df846ad0897371dUL, 0xa0796b766d196ddbUL, 0x5521d7577d5e3451UL, 0x0dfbed052e7b1647UL }},
+  {{ 0x9bab92f979900231UL, 0xcc80cfebe4155c90UL, 0x0e14275034b23244UL, 0x16f0e04a48a71270UL }},
+  {{ 0x2032deeaa7f58ce3UL, 0x3398acd7f11bb5b7UL, 0x40182bee98c7124bUL, 0x2908ce21f17b9ddaUL }},
+  {{ 0x26b529936e4e2024UL, 0xa6c0ba64325b75a8UL, 0x1a2d97ddf301b13cUL, 0x0eb8d9eb541d3f8cUL }},
+  {{ 0xa10fa19afc14b912UL, 0xf76a7f8a6f7855a2UL, 0x905092133a7ac212UL, 0x0d224b168ea449f3UL }},
+  {{ 0x117464a50cdedc98UL, 0x3e406a52a4268c95UL, 0x0126ca9694762708UL, 0x17d093b8a3617092UL }},
+  {{ 0x801b01c017642829UL, 0xa0b3023f43cb1f10UL, 0xd2aed0975dcff391UL, 0x263dbe17b136f6aeUL }},
+  {{ 0xd9a4dc784bf504b9UL, 0x6b05ed147aeafcaeUL, 0x935f49627e64a8c5UL, 0x05bbcffeb0b92465UL }},
+  {{ 0x1256268ad7fdb21bUL, 0x06aacdf761242e78UL, 0xe7db68bc2ae776efUL, 0x1ba84a7a415606d8UL }},
+  {{ 0xfd43d0d9d099820bUL, 0x06077f2baed24a23UL, 0x11d9802b12e6a913UL, 0x0be45209652872c8UL }},
+  {{ 0x034a9dc5fe163ac8UL, 0x2d97e79a0a31c6d7UL, 0xffb80347a58ef610UL, 0x02160c48234cb223UL }},
+  {{ 0xfe607de9d92ba63bUL, 0x3bed90225e7f8bd9UL, 0x064d316348f68edaUL, 0x025fc12ce1fff9edUL }},
+  {{ 0x1df0dcc9b51e7999UL, 0xa564d60294f84a23UL, 0x60b6e2ce83d15fccUL, 0x19f1177d7deae419UL }},
+  {{ 0x7ecd8ffb36470beaUL, 0x2fb06c445557e893UL, 0x4cb8dfe0ee46a90dUL, 0x1868500123758f74UL }},
+  {{ 0x7d8e5ab384f73409UL, 0xb593b7b0b050cad9UL, 0xb1924234400dc16cUL, 0x283087f13259a45bUL }},
+  {{ 0x2b66c69e9a0f2bceUL, 0x7653879192b49538UL, 0xdd007e2669a05982UL, 0x18e2c37c3751293aUL }},
+  {{ 0x147ed539b5d85283UL, 0x88b8a79b91fce245UL, 0x58e9a33d8e8b4dc8UL, 0x0d9a113b51de2c8aUL }},
+  {{ 0xa086069e4d8a9fa1UL, 0x70af385c48320ac7UL, 0x8b55b8fef6099ccdUL, 0x2f51e57ef8952c9aUL }},
+  {{ 0x831443febe187254UL, 0xd8924e571f9155b4UL, 0x69c8fd977fc6e36cUL, 0x1de83d37b03ad0f9UL }},
+  {{ 0xdd4aabf7d59175b4UL, 0xe73df9ec4cf87ad3UL, 0x32e31d50df40e181UL, 0x1d5d9ac1044306abUL }},
+  {{ 0xc335124cee1b0a5dUL, 0x3ff32a69b4482890UL, 0x5f29b5cf9b2492c9UL, 0x06af7afac9a91933UL }},
+  {{ 0x9bc610fb60af9764UL, 0x5ce2f2df666ca827UL, 0x31428fdde9eb1622UL, 0x24e70a88f666c829UL }},
+  {{ 0x3c70d30489532c2fUL, 0xdf4dab327b1eeff9UL, 0x6fc476f8bdd6f6b9UL, 0x10dabb4fbda6281bUL }},
+  {{ 0x44d6dd7a51c3a458UL, 0x9e0bed358e72c257UL, 0x5c7dd63672f8626fUL, 0x105d42ef5ce39fabUL }},
+  {{ 0xf382274f1863892aUL, 0xb5e2d928d1e734b2UL, 0xe7f87063e7714186UL, 0x2e6c5ee40605d941UL }},
+  {{ 0x92530fd8cbca66e9UL, 0x1b3dce1349ddc807UL, 0x39619225fa60bebeUL, 0x00bb70efa5f4f11aUL }},
+  {{ 0xa2526e6b73a9aba5UL, 0xfdb94d44b70a897dUL, 0xa2ad7a254b305224UL, 0x16b5ad8323ab4b5bUL }},
+  {{ 0x4a8a6f6f626ef31cUL, 0xe7b7b26351f6d494UL, 0x388f0acd4ff778f1UL, 0x2b4ec7658e75beb4UL }},
+  {{ 0xf21495f95224c9bcUL, 0x6ee58caf4ffade1eUL, 0xd69a41b9de6394e4UL, 0x1ba85426f3beb860UL }},
+  {{ 0x9a468233f3361de7UL, 0x0e68d30254540a8fUL, 0xb65c03e02881c652UL, 0x09845abf4c947294UL }},
+  {{ 0xb8c95930f8b1667cUL, 0xec0a3b3d34894bc5UL, 0x6f89407634760ab5UL, 0x1fd6752701d61fa0UL }},
+  {{ 0x60c0d62da39724a8UL, 0x51660377a910681aUL, 0xa62c8a24dc74501bUL, 0x26858b8c95ff42fbUL }},
+  {{ 0x146b20091a89f67fUL, 0xde82f27aeedb31ebUL, 0x9d7e97860dfd065bUL, 0x163fab8d2f843c1dUL }},
+  {{ 0x667d67c7962e3613UL, 0xe3e056caed1a2e8aUL, 0x2668622ab832a037UL, 0x163413785dae738fUL }},
+  {{ 0xbd2f11c7611b8323UL, 0xd560a347ad41ae3aUL, 0xeeb481f7ca7b46f0UL, 0x093037838049b5abUL }},
+  {{ 0xd6679340ec154896UL, 0xc46be00a1c338c96UL, 0xc70f07c89ba92315UL, 0x17a464bf902d0a7fUL }},
+  {{ 0x8e76b4adf7810eb5UL, 0x8351475eec8ef140UL, 0x339230e70c331053UL, 0x160c7e1895d64ca1UL }},
+  {{ 0xb4d86bad828fb23cUL, 0x75b6e8147b1e4872UL, 0xd5e02e89d97e3c63UL, 0x16632423973b38c7UL }},
+  {{ 0xe81a6d943d383005UL, 0xb517a6ab182a4151UL, 0x50ad4cced88806ffUL, 0x2526f4db0ec6553fUL }},
+  {{ 0x979978adee93c1f6UL, 0x3250b54516534693UL, 0x0e25170062bc549cUL, 0x01dd58d4d255ed50UL }},
+  {{ 0x3e2a93c501570f0fUL, 0x3a2c2f39c6192691UL, 0x4bd50b1cc96208b6UL, 0x09ca9c6a1a661b65UL }},
+  {{ 0x0fd90ff4a02f8476UL, 0xe8dc15488aa15682UL, 0xce574ea4c3888596UL, 0x17365f9d339d403fUL }},
+  {{ 0xe1288b51d12050adUL, 0x651365d3efb1512cUL, 0xbe6014fc6df33a53UL, 0x19507fe7c01c0bcfUL }},
+  {{ 0x3dd4b6f3971de823UL, 0xb484480b0ce78321UL, 0x373c8c22768cca36UL, 0x17525880874646dcUL }},
+  {{ 0x68dd6821a0f54491UL, 0x652d7fd195e356dfUL, 0xf455e22a567196b5UL, 0x067807ca5211c77fUL }},
+  {{ 0xec6697515316260dUL, 0x0e2c431cc0946c37UL, 0x068f85458efa7954UL, 0x1cc36cc242f72a89UL }},
+  {{ 0x61a7290860189ed1UL, 0x9ba99004d5ce1f03UL, 0x5104e651295eb3f7UL, 0x20b9ad7bd168d4e0UL }},
+  {{ 0x2ab32d7082d964f5UL, 0xe51899b22b0a6055UL, 0x46827a7d3485005bUL, 0x199e3e2a5ed2a04eUL }},
+  {{ 0xe6263c938ca24f78UL, 0xd9e7996e78cccd8cUL, 0xaacc2f02d0b2a3c9UL, 0x1b78c3b0e080a092UL }},
+  {{ 0x5d66a561a72d371aUL, 0xf60042c903a08f6dUL, 0xd5bb7dd4fd7fdf87UL, 0x0b96896c752172a6UL }},
+  {{ 0xbf06388854608359UL, 0xde2af4866ae71888UL, 0x27abd2c795b125eeUL, 0x14b8105179e71c9bUL }},
+  {{ 0x84d23eddfddb3cefUL, 0xbde22f49c46046b6UL, 0x35e3758a134822a0UL, 0x2f529b7764a414f0UL }},
+  {{ 0x56ff193760840b76UL, 0xf24934593a527dfeUL, 0xfb544530fc4a024aUL, 0x25736c030637c884UL }},
+  {{ 0x8c4ad64ca93ade0eUL, 0xc5f7ac6242ef21c2UL, 0xbef611c87d3ecad4UL, 0x253d3c65cd58044aUL }},
+  {{ 0x6144cd25837f0e4cUL, 0x9a1c9cb221d87a2aUL, 0x3f5979c89a610541UL, 0x11196d97894f9837UL }},
+  {{ 0xd14456aa185a9650UL, 0x0145b8eb3d85d370UL, 0x2efcfdb4f6e72543UL, 0x0294249ef94e1db8UL }},
+  {{ 0x671827bf8917c0f9UL, 0x5b86025369e6b69dUL, 0x19d3639730deb86aUL, 0x1934196b67f34e4cUL }},
+  {{ 0xa962783bcdd97138UL, 0xc528d85220dc358aUL, 0x2e1585818ef2aa72UL, 0x2d078c7771e4dd41UL }},
+  {{ 0x96d0b2add8b35089UL, 0x7887575eb5cfd36aUL, 0x9d8173d33cb98f58UL, 0x28011bf2ab562e65UL }},
+  {{ 0xf1e5c4e98612bcb8UL, 0xb9554806fbb61763UL, 0x097e746598f8b3baUL, 0x1d31df8587ea2428UL }},
+  {{ 0xdf545ca231cf854dUL, 0x281896bc314064e0UL, 0x9477d091490f3e78UL, 0x00e73b85a66b8d24UL }},
+  {{ 0xb4d7c16cf401b088UL, 0x83bfceec36e1ac56UL, 0x3bffe8faeec959c2UL, 0x1b97eb9cfcfdcb87UL }},
+  {{ 0x4c8e32d0177c5a0eUL, 0x04844a3a5b5551dcUL, 0x2f5e23a629c3d9caUL, 0x21faaaed0c4f27ceUL }},
+  {{ 0x0f87127a80a4268fUL, 0x3f822dbfe6a8e09bUL, 0x2922afe764d3fd8aUL, 0x300438bf20c2064fUL }},
+  {{ 0x271ed8b378bdccb1UL, 0xcb0e116361cee0f7UL, 0x5c7b19803a122740UL, 0x0dee59bea749473bUL }},
+  {{ 0x056ac2448e0c717dUL, 0x676f5949b2d20f95UL, 0x9d2ea637dab53c33UL, 0x206dbc64092a66dbUL }},
+  {{ 0x2caf7db6d65e424cUL, 0x31a422f542d69836UL, 0xed0f5a79bdc18e52UL, 0x07698445d45687a0UL }},
+  {{ 0xbb5847440340f148UL, 0x51ae65088a72b07fUL, 0x532d3b259ed44ecbUL, 0x22c9e2be1e5b6c55UL }},
+  {{ 0x8b11bd1f7fc3f9d8UL, 0x857df3396475a639UL, 0x614af4806a50f861UL, 0x0c62cde32aef1dd4UL }},
+  {{ 0x50faebac3d8ec827UL, 0x0728f280fcc21a93UL, 0xdfb078b375877d8dUL, 0x1aa850fcdafec702UL }},
+  {{ 0xa08c6f37a78a29afUL, 0xcb79f81c2ff2877cUL, 0xfef3cbd169836ba3UL, 0x1e67ae3bb879b64dUL }},
+  {{ 0x24d8a59d45fa4168UL, 0x70e1f10214f0473bUL, 0xbb8fb1aeae5bbff7UL, 0x0e04752ec3d334b3UL }},
+  {{ 0xdbfd58d72c50186dUL, 0xd5c3514ca425a6dbUL, 0xcad0fadf2d85bb61UL, 0x1813b5e7bb6af0e9UL }},
+  {{ 0x10a59479ce4c5045UL, 0xc8e8485c5f43470eUL, 0x637d5a9cb79f888aUL, 0x25cc7baf1dd457cbUL }},
+  {{ 0xa9aeb1d22e42a348UL, 0x4104562fa8d46dddUL, 0x5405b9d3be418785UL, 0x02497f892db2eee4UL }},
+  {{ 0x2371c525915188a0UL, 0xd0ebabdcb09f27f6UL, 0x98bdc587a4509f32UL, 0x297e85ff07f576d9UL }},
+  {{ 0x2f481080398f4ff9UL, 0xd9663e11821d8f32UL, 0x12e4fef28b6ca141UL, 0x066ac523b87243a5UL }},
+  {{ 0x48e624147a4ca810UL, 0x627a47f9a871a1d7UL, 0xebc31b190a00a4ccUL, 0x19c7bbcc6a4d3a87UL }},
+  {{ 0x6e71424a2ad865f0UL, 0xf16f4d7e7fc84654UL, 0xa95bb0b3d19d9ca8UL, 0x03fc4aa5db1e7dafUL }},
+  {{ 0x064e3ea36344a728UL, 0xb37a8d3ee1ea3581UL, 0xca746178eeec669fUL, 0x27a30712391b3e5dUL }},
+  {{ 0xdd3ed4716a1c3fd0UL, 0x79edcd0fd6495aaaUL, 0x5200966d3eacb648UL, 0x07f1ce6304822a54UL }},
+  {{ 0xc809b41cdace1623UL, 0x7a33a604d367bfe3UL, 0x27797cd40951477aUL, 0x0b075dc4f543cbd1UL }},
+  {{ 0x262c515a6cecd4d8UL, 0x6130235443ad5d7fUL, 0x9aa8f881e1999effUL, 0x1a42229d5c044403UL }},
+  {{ 0xd475e0dc22f987e0UL, 0xfa54dc5b2fdcb996UL, 0x5ae38b138d578ffaUL, 0x2940c682acf88df5UL }},
+  {{ 0x118562b24a46cdfbUL, 0x2f75c498d6b8823bUL, 0x843d2e0d74fe6032UL, 0x27986838de90e9a2UL }},
+  {{ 0x947e1fff0f48a70bUL, 0x52688f33c2ff7dfdUL, 0xd47d9a0ca998f361UL, 0x2c292d440e0ae012UL }},
+  {{ 0x06e476f5923f2726UL, 0xe6595a037d9cc616UL, 0x076915d7cb8f06feUL, 0x1e679943e405e672UL }},
+  {{ 0x24229b88e9f72cb4UL, 0xd9873103e3bc8100UL, 0xe8a734cc6c50d550UL, 0x16caaeddb4165727UL }},
+  {{ 0x4f1ca735f72d519eUL, 0x70e37623856c45fbUL, 0x472763041429adbcUL, 0x25ea6dc7946272efUL }},
+  {{ 0x8146a418c3a184d2UL, 0x88cdf8dbb2d11d5fUL, 0x4f9971bb5558fcb4UL, 0x1adf59e78604ba46UL }},
+  {{ 0xa13ec3e625af38baUL, 0xe4f205e60c8ec7b2UL, 0x6eac32334fb7a468UL, 0x27b2b0aab4f6514aUL }},
+  {{ 0x9c5f28e753433c26UL, 0x113aac989d3047aeUL, 0xb736a85ebf28d166UL, 0x0d74e61b07d3ad7eUL }},
+  {{ 0xf1d1269cfc2e7c5aUL, 0xb0e9d9ab49677167UL, 0xd0a084d47ea1dc50UL, 0x06853a10d0d9c0d0UL }},
+  {{ 0x23b52007844dbb88UL, 0x95e3bffedc5c5dd5UL, 0x6ef8cf7dee53eb28UL, 0x20b445fccd4abf08UL }},
+  {{ 0x7c6bc903d2070c89UL, 0xd962817946105e6bUL, 0xfd50354547caa058UL, 0x2db4d424372c0d81UL }},
+  {{ 0x65cd36f7d03ca08bUL, 0xb3dafd94e0db95dfUL, 0xb06c88a7f154b16bUL, 0x1d38376208cdf0f6UL }},
+  {{ 0x1d5771152bea8cd5UL, 0x055a008a0fad7acbUL, 0x716692892364d1adUL, 0x031b484482b3898cUL }},
+  {{ 0xaa06d9de7526e008UL, 0x8613ed97893eeb9eUL, 0x2c5abd526ede31bdUL, 0x225e893c3fdbb992UL }},
+  {{ 0x56b5042afe4f2662UL, 0xca2c6637fb24d7f0UL, 0xb85752e5f7c2f2b7UL, 0x2b177d825c1ac151UL }},
+  {{ 0xf9545f2f50cad376UL, 0x7c775ebdac9f6801UL, 0x4420fa082207d9f4UL, 0x1ced167c26db8cd1UL }},
+  {{ 0x7192a56206a2f520UL, 0xbfd4804b6f0835e5UL, 0x340d1a4123050befUL, 0x1fbda6eb83faf80bUL }},
+  {{ 0xa6a697bd73602d88UL, 0x1b46f18d21d3818dUL, 0xc4992ecf34eac00cUL, 0x0368cbedd4edd2a1UL }},
+  {{ 0x562c3049163cb5b3UL, 0x212be8682e88c4baUL, 0x80de222519d49f28UL, 0x26f3c1852983a311UL }},
+  {{ 0xad3e474fa50ecef6UL, 0xf574c8f9ad01ff72UL, 0x309a3fac8f081188UL, 0x0f501edfd6afc296UL }},
+  {{ 0x06f5dd9674825210UL, 0x32f5eacb3348aa70UL, 0xdad574de82785351UL, 0x162044e689925d91UL }},
+  {{ 0xdfb894b0f8af8e01UL, 0x4a055857c08c34fbUL, 0x4962d001dffec0f4UL, 0x09fd178acb519c84UL }},
+  {{ 0x5785198dd2c07bfcUL, 0x2857e45dc96f9735UL, 0x483a11dbe85cd7f8UL, 0x04b11d3670adc4ceUL }},
+  {{ 0x71bb7258772e3f06UL, 0x65c0369e85c66e98UL, 0x666b9b89e0d2aeb9UL, 0x212695ef8d051305UL }},
+  {{ 0x8a5849b671510c9cUL, 0xedb281f07227786bUL, 0x23908c4bb3e6ae92UL, 0x0886de4a9efe13dfUL }},
+  {{ 0x5f72f14df6c576f1UL, 0x084eaf309979e0d1UL, 0x028422a851767e60UL, 0x2f8a764139c3b57fUL }},
+  {{ 0xab53676186d4f463UL, 0x70069e50c2274281UL, 0x02bee7c120a9a6a6UL, 0x2704dd8d6700b893UL }},
+  {{ 0xe78d93c4f4455718UL, 0xe4e080bbe606c47aUL, 0xc79b27129a052ac9UL, 0x2363d5a69ab69f05UL }},
+  {{ 0xb30ed22502385858UL, 0xd17b7ff2e9572b3bUL, 0x18f51dcbe27232b6UL, 0x009d5a8be5c21709UL }},
+  {{ 0x852aff9a40c1d0e1UL, 0xf9424d6262de511bUL, 0xcef6cf901c4340a2UL, 0x0a27bd434d1e8ee3UL }},
+  {{ 0x4a7de9a21243f6c7UL, 0x92583d6684220a28UL, 0x3eff7a7f335d8c56UL, 0x2d3c178cb59087fdUL }},
+  {{ 0xec38f3f10804ff1bUL, 0x27c2b2def899d460UL, 0x462cf1ca34a1f056UL, 0x12bacdf20485d681UL }},
+  {{ 0x0fbf53da39b68907UL, 0xbb19b1a015ac2b28UL, 0x0dbba45ab80287f5UL, 0x089a3067c21545acUL }},
+  {{ 0x2e5f73a6a827cd7dUL, 0xb16e9064002ec97aUL, 0x41818dcb4f0c0dfcUL, 0x241c10a0a5e62305UL }},
+  {{ 0x54276ad3606c689eUL, 0xeb22529803cb4714UL, 0x6de6ab8df1c07d9cUL, 0x095e9babf1cf37aaUL }},
+  {{ 0x8b716aa364147ea2UL, 0x045f07a022e97de1UL, 0xe9308a9514ed9a49UL, 0x2d5eae853f9bdd40UL }},
+  {{ 0x16f5c213efc97f18UL, 0x8365a12aa2887d11UL, 0xe65dfeef9ba9d743UL, 0x140a73d75e29db16UL }},
+  {{ 0xc247ac4364828aedUL, 0x64cdd086d0facb57UL, 0xb8ee706558d1be74UL, 0x0872eeff92dd9267UL }},
+  {{ 0x5f0fe25f78229b78UL, 0xd49ec2c3be8ea7cdUL, 0xf26d6f41e8b78baeUL, 0x13d232f3a2f1a390UL }},
+  {{ 0x6030f24e3cff157aUL, 0x3e0a538fe0bba63fUL, 0xfa54c6c88b738623UL, 0x016bf25300f2f69cUL }},
+  {{ 0x14d85e8df9ccf27dUL, 0xeee670723c3a8188UL, 0x711fc54af7ae23afUL, 0x23b09c9376ac072cUL }},
+  {{ 0x4484ac24c6fe8fb5UL, 0xaef8dd48af2202eeUL, 0xcfd24e2e1e259f70UL, 0x1e70df590d8b27d4UL }},
+  {{ 0x4d9b739ec82f7a2dUL, 0x8c86c40aa6e8d6c7UL, 0x7066937404caad4fUL, 0x28305a578b1549cfUL }},
+  {{ 0x5c10457c8e634bf1UL, 0x4d3056587102511cUL, 0xc58960ddcc7317dfUL, 0x0ab592a418d120a6UL }},
+  {{ 0x3a4fa2ee5cd4e901UL, 0x1fad0396381b4b45UL, 0xa1a216c4bf898888UL, 0x1888054e81e2ddacUL }},
+  {{ 0x01c084b6f0df2c28UL, 0xc90848506ce269feUL, 0xc284f97a839801a6UL, 0x23f05ed0f47ba81eUL }},
+  {{ 0x274ba4ee4b493f4bUL, 0x206288ade6d5e2baUL, 0x6847e58f1c3734f2UL, 0x16925c4877c3ee38UL }},
+  {{ 0x17b70ed31e8cd819UL, 0xa35af94b37ac28c8UL, 0x209fbb2f209320cbUL, 0x11b9a36bd80295e9UL }},
+  {{ 0xe132a14eed063f3dUL, 0x6c0371e40b6b8f71UL, 0x997a9833d4d77a76UL, 0x2c4d3110e49200efUL }},
+  {{ 0xaf77dbf0f4e882faUL, 0x581337d438f6706dUL, 0x1f350b68eda6847fUL, 0x23426a5cba59e064UL }},
+  {{ 0xd905ddc68b7bb8f0UL, 0x6194d3dc94d8322bUL, 0xbedf52823466286cUL, 0x2b4567b9fa227ac2UL }},
+  {{ 0x2aaca58769e6583cUL, 0xe7be1cabfcd27c27UL, 0xc884e167e69e91d2UL, 0x1b547d1ce6392136UL }},
+  {{ 0x7b219467382ab782UL, 0xd70c8b2df24334cbUL, 0x9cf1b13e02b67972UL, 0x2e7084f35b17dd17UL }},
+  {{ 0x40ab0d720c69df1dUL, 0xd9a490647d1bbb56UL, 0x109cda61a1768bf7UL, 0x07be33b2f7c444aaUL }},
+  {{ 0xfaa27f11d951fd73UL, 0xa0ebdfb5be4b2be9UL, 0xf48aac128824d06eUL, 0x163a2f397fc2c580UL }},
+  {{ 0xb84022403b0665caUL, 0x8dc8d0b451da4b05UL, 0xa38fa09b3c7eef28UL, 0x22cf98676b9e54fcUL }},
+  {{ 0x50054222fdad8a3fUL, 0xd872d046f35f42f5UL, 0xe2ff644afe5d2494UL, 0x003ee1bd7437daddUL }},
+  {{ 0xe5b1ed4648bba081UL, 0x9c7bab3ae8419a4cUL, 0x36b5495c7f471856UL, 0x06702f4862e41535UL }},
+  {{ 0xab892dcfedbee2f4UL, 0x8d3580b9734f7605UL, 0xbe7ab77561fb37d8UL, 0x18bc5f9a2eec6ee3UL }},
+  {{ 0x3e209b14c3b0d092UL, 0xb26774da542c328eUL, 0xcac95d3019df2c5cUL, 0x1385099c0f7fec62UL }},
+  {{ 0x2bc039db6718ce5cUL, 0xfdd2f0788d85722dUL, 0xa5a456e83e2efa06UL, 0x184d1b4f8e3759d3UL }},
+  {{ 0xd4e139a00c563beaUL, 0xfee50bad68ec34afUL, 0xbf7b9f4531f958e3UL, 0x124cdaa7f933dd89UL }},
+  {{ 0xc723d7f39cc6ecc2UL, 0xa851bf747afea447UL, 0x14db504403a9ba7cUL, 0x127614761019d477UL }},
+  {{ 0xc0d30d47bbf2488dUL, 0xd8f1027c2dda8335UL, 0xa853dc518c57dc60UL, 0x284405373f563d59UL }},
+  {{ 0x459b62eb3088fd48UL, 0x21ae32a424bd8eb6UL, 0x5db2e821b1c760f4UL, 0x084173a63034523bUL }},
+  {{ 0x5808e7afe0927ba5UL, 0x9a117acb61c04115UL, 0x79975fc2d5834662UL, 0x2f434e85b9b0935cUL }},
+  {{ 0x53cdc44c9841b4ccUL, 0x7458febc9f9ab7e1UL, 0x7a0071be148390d6UL, 0x13fe55a1079cc141UL }},
+  {{ 0xc446f1f9dc1bca8cUL, 0x059a569291cc9a75UL, 0x813cddf359f77af0UL, 0x0ed5034097ff57eeUL }},
+};
+
+static const fd_bn254_scalar_t fd_poseidon_mds_4[] = {
+  {{ 0xc746d3a1ea1cc193UL, 0x6909fa60cbf91537UL, 0x5b41f9011d64f292UL, 0x163fd60c1936197dUL }},
+  {{ 0x0181d5313bbdbfdbUL, 0xe18378c86214909eUL, 0xcc39e35f710ea822UL, 0x214f5455afa43479UL }},
+  {{ 0x582d922f6dc48b16UL, 0x38c8cb41c45cff82UL, 0x7df9249ce4429252UL, 0x007ab9de1893f215UL }},
+  {{ 0x9cff2c0f6412a4c4UL, 0x30fb90c591f50925UL, 0x6e6ab78411b6fcb9UL, 0x1b77cf0ecb224202UL }},
+  {{ 0xc8c85e8ccec69c00UL, 0xbe0283254c087a25UL, 0xe7e873d447f84ea7UL, 0x006de5b38e5fd49eUL }},
+  {{ 0x437c9035a82c8a7eUL, 0x2cc53efa3fc81999UL, 0x16a3050a16ec5fefUL, 0x1405c2ce761b1ffeUL }},
+  {{ 0x8100aebd55865e63UL, 0x4efac234996ba0f3UL, 0xd7620cc74699967aUL, 0x1910150019158192UL }},
+  {{ 0x6339508f8d23fda0UL, 0xff4e29746759d717UL, 0xc9d745285d69fd3cUL, 0x1c752d58c2ef9d67UL }},
+  {{ 0xbb83fa3e0a031edfUL, 0xa247540e9ab2abdeUL, 0x10ce1ad9c5a34aa0UL, 0x0e0d7c4459fde200UL }},
+  {{ 0x742a45e4beba79e2UL, 0x262159b82a5d52b2UL, 0x67c2c32c9a7262fbUL, 0x1a016e5249486d11UL }},
+  {{ 0x032ee49d3f46f8e3UL, 0x9581df46402300b5UL, 0xb073993fd3900255UL, 0x2ff42c980d018110UL }},
+  {{ 0xef89cf7680de46a2UL, 0xaf9fb3890c2afe43UL, 0xc6241b343d910469UL, 0x2906a4070cbc228fUL }},
+  {{ 0x37d7866bffe26d19UL, 0x6ced6607b03ae067UL, 0x68fce24891c473c7UL, 0x0bb889c2fd6eac56UL }},
+  {{ 0x6135f5062b5b2e93UL, 0x6f938788c83dcb7fUL, 0x4fc8df2d97896992UL, 0x077d3ed0c2de7b50UL }},
+  {{ 0xaafcf1bd4770a975UL, 0xfd91630f7b3a8546UL, 0x789e7c4c49ebb73cUL, 0x0018a0fab8043422UL }},
+  {{ 0xd2e8592dd30a25b5UL, 0x4f626b2e7f68559eUL, 0xa8ca8234e9a2e036UL, 0x03b26515166e9d76UL }},
+};
+
+static const fd_bn254_scalar_t fd_poseidon_ark_5[] = {
+  {{ 0x878a9569334498e4UL, 0x4641e4a29d08274fUL, 0xf2713820fea6f0c4UL, 0x0898c94bd2c76331UL }},
+  {{ 0xd6dec67b3646bdbcUL, 0x626a9e071b154f27UL, 0x71a61cb1f9d90cbeUL, 0x134dd09bc5dffaa7UL }},
+  {{ 0xc24d9503f8682c8cUL, 0x9cf5f5abe19fedffUL, 0x125f8816cdb2d9f1UL, 0x05954a7a4436fd78UL }},
+  {{ 0xc306f8ed4ba6732dUL, 0x5b187030689573d0UL, 0xb0a9df5b5120771dUL, 0x05513e9e64511461UL }},
+  {{ 0x84b301dccd446ff0UL, 0x59d0332079fd0d4cUL, 0xcb69fbff03ebf775UL, 0x1582477fe7736802UL }},
+  {{ 0x5362fc5c9a7c42f4UL, 0xb8b364f0155ab1f0UL, 0xb30654c42656c7c1UL, 0x2c5a02372db008fcUL }},
+  {{ 0x96b72aad17e84cc8UL, 0x951de8b3af900172UL, 0x019e8182aa706e63UL, 0x2698ae703c1abe1aUL }},
+  {{ 0x00d42e1221436b0eUL, 0xf2664ef30c6cd002UL, 0xedf50acc3d8616aeUL, 0x0f0f24531734899bUL }},
+  {{ 0x8b729e9643b2f886UL, 0x0d9d69a737bec5d9UL, 0x13f8477d2a2dc7dfUL, 0x2f801ef1125e22eeUL }},
+  {{ 0x48e414c85ea0124dUL, 0xadf36e25585ad3b6UL, 0x01fd905aa908ce96UL, 0x12ae1d5c33dd8585UL }},
+  {{ 0xd9400c663f46fb1cUL, 0xc367fbfcb74e14e9UL, 0x263a31f53539a9a8UL, 0x2c14ea3e70ece3d6UL }},
+  {{ 0x8205091fcff4185eUL, 0x15b16c04f93c6171UL, 0xe81d72eaa617fc83UL, 0x1188c21d9ce9974dUL }},
+  {{ 0x8eac4395aa681654UL, 0x164ca0ba11b427ebUL, 0x35554a8d4dd43c78UL, 0x25884483e90fd08cUL }},
+  {{ 0xe7263d68cd48cf9aUL, 0xdfbbd8be5db5ba79UL, 0xda0fce3e869b03f1UL, 0x06cddd417a334e35UL }},
+  {{ 0xa0c5bf320595fc16UL, 0xf49f2260daad1d81UL, 0xb75bb40c6c4ad890UL, 0x0eed000c77ed4842UL }},
+  {{ 0xaecd15b6a4000350UL, 0x87fac0171084f2b6UL, 0x8d5c807f13f5c80cUL, 0x2af2a0fdc8846217UL }},
+  {{ 0x2864cfd614d0d590UL, 0xb408241676c9080aUL, 0x9080fa2f363b966fUL, 0x0af9bc0066eeb20aUL }},
+  {{ 0x0f99ec2d9c7f5c46UL, 0xc68c8a74c8fa9784UL, 0x082b8e29d87f91ccUL, 0x251594e3ce0b5ebdUL }},
+  {{ 0x406e8b6a120194daUL, 0x115b890c7f641047UL, 0x6752259870a05fa0UL, 0x0a4c706bb8417105UL }},
+  {{ 0x149a1b98952f0443UL, 0x7c9198b7d88b08daUL, 0xb342f127f00655a8UL, 0x248b7b9b0c55787aUL }},
+  {{ 0x3af8d053046780e4UL, 0x3614ef0c253cec2eUL, 0xce3861bb8d06d02aUL, 0x0c1f2be6c18f032dUL }},
+  {{ 0x6fcf69d0a67c195aUL, 0x39d597ee0bae3c31UL, 0xd5442c99bb0750e4UL, 0x2032ec38d1dc6c70UL }},
+  {{ 0x36c3b5b1458e56f2UL, 0xa6ab19d26e8c77beUL, 0x7ea17893f365b20fUL, 0x10691bce5b521d2fUL }},
+  {{ 0x9b6b4c808a224350UL, 0xb1a995f0f8f7dfa1UL, 0xb11d550562133bf0UL, 0x2842fdf05ad8f43bUL }},
+  {{ 0x5d0bb8e16ee958e7UL, 0x9d0ee403d02451b5UL, 0xe06f678dabf8d1caUL, 0x135df6826cb5631cUL }},
+  {{ 0xd1287d6e72805c15UL, 0xf50ffffa5807b974UL, 0xd1df630fb95ed3b8UL, 0x026ba33898a91d2fUL }},
+  {{ 0x0d3d274100f30799UL, 0x6049cdb06abe61adUL, 0x88cf6be341686e54UL, 0x0865d2b1a2dce2b1UL }},
+  {{ 0xbc0489a9907d3cb0UL, 0x1d8e718238e40ae1UL, 0xb717b8c529e8aec8UL, 0x25326846f39943c0UL }},
+  {{ 0x9d8248d4155b0fc5UL, 0x87b60b0e75d3f8c7UL, 0xf31fe5dd564a286bUL, 0x1621a6bb722e8d7bUL }},
+  {{ 0x68b9aae2a328df44UL, 0x16c257f026b30af4UL, 0xf4fb6aeecd769eabUL, 0x017e173ffd31ceb4UL }},
+  {{ 0x4acfbb3a0ab1f3afUL, 0xcea57df3614f599dUL, 0xa690574499abf0f4UL, 0x1ac5b7f1fca6daedUL }},
+  {{ 0x31d90575e2d7eefaUL, 0xf980315c753fbd71UL, 0x8973af88e9860147UL, 0x1ae623170a16aaa6UL }},
+  {{ 0x4e035b8837167083UL, 0x7cb27b17484ebcf0UL, 0x106d9221bd85c992UL, 0x1311510bd5c3ffbaUL }},
+  {{ 0xd0b913b89c8b591dUL, 0x283637c85de72e1dUL, 0x3ab46dca1ed10eccUL, 0x0ebbc06fbbfb1a29UL }},
+  {{ 0x1cd247a161f6d784UL, 0xe9ec0ef890468906UL, 0x4503b30d08dfb071UL, 0x271a41fee8f62a99UL }},
+  {{ 0xb95ab597bbc45967UL, 0x383fa8dba9e16989UL, 0x5295c5835c17d12cUL, 0x1f61f338ec158b0aUL }},
+  {{ 0x8b8a25bbccf10b14UL, 0x1ed6268b11ceb7eaUL, 0xd380344a54ef979fUL, 0x1eead5bc0fd5924eUL }},
+  {{ 0xceabe5b248a077e3UL, 0xcd6be0ebbec2326bUL, 0x24b760e4bce6ce62UL, 0x141a908a6d27f698UL }},
+  {{ 0x62e7ce178b30c88aUL, 0x835b2f0c43c4852fUL, 0xef27746250bd7876UL, 0x300dcbcb6f2aa657UL }},
+  {{ 0x2e1ad2dbb8e83c27UL, 0xc2860d2eabcec4f6UL, 0x3be3fa4cc0b160a8UL, 0x2bf92f3fe61f1232UL }},
+  {{ 0x47719788cbccebe2UL, 0x4edb4bb6db9f29e2UL, 0x21f92d8f1fb7eb63UL, 0x28deb83e98fa211cUL }},
+  {{ 0xd9a0180c0b1cdbafUL, 0x8863c3c471f69245UL, 0x7f11fe3ad3fee8c2UL, 0x160fdc2b4558c21cUL }},
+  {{ 0x1c77bf07af072cabUL, 0x91991afbbd12154dUL, 0x0dde94cb7c0d5a92UL, 0x24eb431b12db1b0eUL }},
+  {{ 0x4e9f1258182ba056UL, 0xf953557b7083b6caUL, 0xe7940dacb035f381UL, 0x2f76b4408948eb23UL }},
+  {{ 0xfcce96724694244fUL, 0x109488ef26c6bf00UL, 0xe6d8fd8554c907edUL, 0x2a1aa167b3c1d370UL }},
+  {{ 0xe3db4323e596559dUL, 0xcb243fa371987f27UL, 0x61d4edf5855d81b3UL, 0x15da7b124ced0fe3UL }},
+  {{ 0x7108addbc90c712aUL, 0x72abefae6e8506fcUL, 0x8613f0c133c634cfUL, 0x053679f8c0431334UL }},
+  {{ 0x3cf98afc0fcfcf56UL, 0xad18915e610c8a89UL, 0xc352625b7b74018fUL, 0x1338a38250a2eae2UL }},
+  {{ 0x1dea74549e83599bUL, 0x7e92f66af4254a88UL, 0x70c1b47bd2703132UL, 0x19ed37df27b27592UL }},
+  {{ 0x228607bcc1a41f16UL, 0x0abf12885201bc36UL, 0x1fcf698e7d85860cUL, 0x2507b3680c3d5c60UL }},
+  {{ 0x68dff76afcbebb94UL, 0x115a3fbe38d8798dUL, 0x2411ecadb9b26692UL, 0x19f31c5c19cee1edUL }},
+  {{ 0xefa41cc0bcf817a9UL, 0x58244d1d6978224bUL, 0xde20ee01ef3a3ab6UL, 0x0c32dac0cf3d1e0eUL }},
+  {{ 0x1ab51e2b39f5d7b6UL, 0xfecbb5939b623af7UL, 0x655bd9dfa4c6cbb1UL, 0x0a3f8bc7a082f5cfUL }},
+  {{ 0x49e7c4e977a85aa2UL, 0x0f334d5ff12aa382UL, 0x96c8bb2c420e3b98UL, 0x2c4cbffa8acdbdebUL }},
+  {{ 0x825cb2f28a8c1e7cUL, 0xb19867377b71bd69UL, 0x7d1106032b26bd25UL, 0x30263798ec8c94b3UL }},
+  {{ 0x7e9a787542333054UL, 0x9ed2026bcce5daefUL, 0xb94cfda3b19aa18aUL, 0x2aef388e6fde243eUL }},
+  {{ 0xdec165892c94bfb4UL, 0x329cf08d419fd17dUL, 0xc782558cef565f52UL, 0x107e2bd0a01a9bd1UL }},
+  {{ 0x1e3617c341f737ddUL, 0xeec05d4004fc56ffUL, 0x9fcb2eec469e1defUL, 0x17d7ef155407534cUL }},
+  {{ 0xbc2e3c78ddc790a7UL, 0x4f2c8974fe39df1eUL, 0xc1fa27471562cd24UL, 0x03c3abd8dd76e013UL }},
+  {{ 0xb6718921c68b5bf3UL, 0xba4407209c0e858cUL, 0xaff2f22be243e66dUL, 0x1597dc6965c1d817UL }},
+  {{ 0x72e23890fd41a8b1UL, 0x20ae67fc3e5054c5UL, 0x0b17c6ddeea6f4bcUL, 0x0b484f64ff2eb9eeUL }},
+  {{ 0x1ba1ed783ebc3ccdUL, 0xf8ec74a93556259aUL, 0xf6b8df50e3999e23UL, 0x0a575b9987bce9daUL }},
+  {{ 0x6eb7507d2f380c81UL, 0x706bff2d37993e4bUL, 0x5490dd35553df267UL, 0x1b4ce24fbfd5173dUL }},
+  {{ 0xef208235df8e5c80UL, 0xd3018f9a778b1ba5UL, 0x0567e27bbb6a94e3UL, 0x07e1962013fac5abUL }},
+  {{ 0x2bef9b8d26453de8UL, 0x783a4aedb77217d1UL, 0xd1d0204bbe4363c3UL, 0x252aed5a7f967a2aUL }},
+  {{ 0x767e910fd7b1d113UL, 0x64d3025621dc2bf8UL, 0x014848e166fb75ceUL, 0x1e1878fa93dd581bUL }},
+  {{ 0x74b547568b0b9ca6UL, 0x820752b8883e6af5UL, 0x571dc27a11f58de2UL, 0x0782ebb59653fc84UL }},
+  {{ 0xe24f568e1423a243UL, 0xa2c0c8cbb0b437a2UL, 0x90173ce12fdbf453UL, 0x1bb605b963e6819eUL }},
+  {{ 0x424258a0395d5c6aUL, 0x2e3b982b53d799f3UL, 0xe1caebe15898eb96UL, 0x2ecc7aa78cab1cf2UL }},
+  {{ 0xbe609bfb2d77d073UL, 0xc2e8b49a0fb971beUL, 0xfc3f29f72e7c6a02UL, 0x0a2b4f397bcf9583UL }},
+  {{ 0xa5b2d83c372a5ee4UL, 0xce669dfa91c515baUL, 0x3d6952ba735dd19bUL, 0x142cd30377108060UL }},
+  {{ 0x60c5069959733fe5UL, 0xea5b12d915a075acUL, 0x5894d4b277436a2bUL, 0x1ae3719bd175bd2eUL }},
+  {{ 0xeebda1b5058baed7UL, 0xf4e9c9c5064fa02cUL, 0x3e2fb0e622e4ab3dUL, 0x118ebc22997e996fUL }},
+  {{ 0x81aab5decfde8a1fUL, 0xfaee7498bf1f1ee2UL, 0xc80649d2d0ce7c07UL, 0x229c38125a51f2eaUL }},
+  {{ 0x985798acf36f6dfaUL, 0x9e2748a7fd62be49UL, 0x6778706b49970da2UL, 0x018c1e02e85993a6UL }},
+  {{ 0x8efe1a26d380e662UL, 0xde5aaa7b41a784f4UL, 0x1556052098327318UL, 0x17f9f1318cea6698UL }},
+  {{ 0xa2f259bc5d1fae3dUL, 0x659ef5c9d71cad42UL, 0xe923b54fa8d0258bUL, 0x03671edf5785b875UL }},
+  {{ 0x522adc4e474f6465UL, 0xa61be19bb4af4babUL, 0x63fbcaccdd0624b3UL, 0x19d2382d5d50ec5aUL }},
+  {{ 0xe4b8176417c5b011UL, 0xe9111b9c9116f47cUL, 0x31fec42826b9b737UL, 0x15815cf4d4c29970UL }},
+  {{ 0x2d3df64d4cc2af8bUL, 0x8df6d640ad061121UL, 0xee745dc93e0abc89UL, 0x1c470d0e1d502236UL }},
+  {{ 0xc61d1549f24f7aa6UL, 0xb0b9980daf650c2dUL, 0xc7e378f87562d8adUL, 0x13fc40a1e5880c11UL }},
+  {{ 0x67d132dbfc543847UL, 0x2acb1a2d09cd8b3aUL, 0x2cc8ac43f65c39fcUL, 0x00e539944f8812f9UL }},
+  {{ 0x2a650c1e112d61d5UL, 0xa094d7a998570d6eUL, 0x3fb61809d34fa3f6UL, 0x1ccfb9311d38da8cUL }},
+  {{ 0xedf9c6538dd77409UL, 0x2ff942bf1d7857edUL, 0x65fd59c9d45c0db2UL, 0x2aa40867a469c80bUL }},
+  {{ 0xd427338021a545ddUL, 0x7da6580b3362643cUL, 0x980a22b76f9889dbUL, 0x123988c2835a9a24UL }},
+  {{ 0x8b6cc56fc4a76a71UL, 0xadb2f3e02fd063a2UL, 0x0bedaba09c4dd557UL, 0x0b1608caab628954UL }},
+  {{ 0x456b34ab0915b1b6UL, 0xcb35fb5dfe479b6dUL, 0xbe5affaee0f02ffbUL, 0x04ab07cefb144ee3UL }},
+  {{ 0x78dd414ae4f7b61aUL, 0xa501d3572ef1cd14UL, 0xbc6d4580db92fdf4UL, 0x0faabe5df613978aUL }},
+  {{ 0xddb52cf62323987dUL, 0xb973b8fe44d14732UL, 0xfa94838f95c33f24UL, 0x071c6d0b09104a8cUL }},
+  {{ 0x556cb74f80958c8cUL, 0x1326cf75aea004daUL, 0x73ea834fa867569bUL, 0x1a7a1d35e343d6d6UL }},
+  {{ 0x3fd1e5a02371b5afUL, 0x9c7c08f0a0acab1bUL, 0xcfc13ca10c1a429cUL, 0x1c7ed01fe7a7cc99UL }},
+  {{ 0x65077690ae397f68UL, 0x9a0a194dc1f39b21UL, 0x0d402bdffec6708bUL, 0x06dfcdc908172898UL }},
+  {{ 0x594057b7e3efdd33UL, 0x1bcff8f9b420c2ebUL, 0x75d85b723a6772d4UL, 0x0ab0c47938e78af9UL }},
+  {{ 0xf12f6fd0f545630bUL, 0x39271bd6d2eea9a4UL, 0x879f22b58867f2d2UL, 0x02f399407f57ee41UL }},
+  {{ 0xe90c8bc7b3a4ca9bUL, 0x0e9451f3c6a47db4UL, 0xc1bfff8303becb17UL, 0x1c89980423c0e7fdUL }},
+  {{ 0x850277e063c37b0dUL, 0x5a1ec8cf872088e9UL, 0xa9187636ff4e7c1dUL, 0x11bf93e921c76865UL }},
+  {{ 0xca727e287aa107f3UL, 0x8ad0fd863f4a2994UL, 0xb81f12b15680ff26UL, 0x2f3b02faa9e2283fUL }},
+  {{ 0xe315d409289a3102UL, 0xd2af0f05b44e14d0UL, 0x37192d8727f960b5UL, 0x23f59ad717371256UL }},
+  {{ 0x703f2e5faaa00b28UL, 0x79a9177e081b6014UL, 0xbbab285beca97a99UL, 0x0f60e5597a6e59f0UL }},
+  {{ 0xebf3648071aa12f6UL, 0xa4f544819636d793UL, 0xbb1904ff84234d4aUL, 0x0d1a7c76aaa9d653UL }},
+  {{ 0xb4f61ddb5efe775cUL, 0xbcbab6f0fbbd58e5UL, 0x2ae426a9a2be2018UL, 0x24dd801cf2f45716UL }},
+  {{ 0x91c7251108bb269eUL, 0xecc3dcaf2a43e282UL, 0x89e159517c2874dbUL, 0x1b77fa98c8e136cbUL }},
+  {{ 0xa76625f84556a6d2UL, 0x0ddf47e35bf922cfUL, 0x894b9011e1427fe1UL, 0x0ce0209cf5321212UL }},
+  {{ 0x0a261aa52b3455f0UL, 0x1408302a90e94238UL, 0x70469145b20d69a1UL, 0x0aabb98394429573UL }},
+  {{ 0x0a5dd9f92266bbd6UL, 0x9b4ff705a29d1f79UL, 0x88bb67e33444fce0UL, 0x05ccb7329777c838UL }},
+  {{ 0xc5b0b815fec4067eUL, 0xc2bf2ecf135b8265UL, 0xe422a048e71a2a9eUL, 0x1e86da97264a4809UL }},
+  {{ 0x77896a472d57c5d7UL, 0x4c01659d6cb7307dUL, 0x6d604465d6ae4195UL, 0x259a279222caf245UL }},
+  {{ 0xeec7c8d3c9d05669UL, 0x403cac10f52e5ed3UL, 0x7d286f43634fc4a8UL, 0x170ccf1409884506UL }},
+  {{ 0xbf45ec883a64a1e0UL, 0xe656c3c04fcdd3eeUL, 0x4da3e25c02f0cd07UL, 0x2e92f647578260ceUL }},
+  {{ 0xf07c35524b1c69b3UL, 0xdcbea469cffa2beaUL, 0x3319b3e7626434d2UL, 0x050473b25d9627f6UL }},
+  {{ 0x71ae812c01df78cdUL, 0x8e42ac99ea7b9de8UL, 0xa2b891b1fe42553bUL, 0x16df9032ff3b678dUL }},
+  {{ 0x7be10854d92f366cUL, 0x88d02eee3ebb1717UL, 0x1de04ba845924d19UL, 0x1672eb7cb2f7cea2UL }},
+  {{ 0xd53686face6d1a94UL, 0x57a2abe2fb9bdb6fUL, 0xd4466126890d3ff8UL, 0x169e5c32fcb12a1aUL }},
+  {{ 0x2b8ffe0e028fab58UL, 0x79f2259ad4a7598fUL, 0xae9e1e6d37ec58a0UL, 0x0360de92f5d0fcf4UL }},
+  {{ 0xf9c12f1a674e0eefUL, 0x925dd455a1ce50d8UL, 0x0f565f5cda9cc8e0UL, 0x08b17aece2905e79UL }},
+  {{ 0x21fb8e0647d40d5dUL, 0xd8dc830623a71f77UL, 0x17c0551c8acf8aaeUL, 0x2694844861621ce8UL }},
+  {{ 0x68748cd83770f6d4UL, 0x3eed11b90479faccUL, 0x4e06a8320f30819bUL, 0x2f5decf20bea441cUL }},
+  {{ 0xd3087fa57e280102UL, 0xe99c6d809a79d218UL, 0xfe0e285307b369a7UL, 0x1ff7d670edb42335UL }},
+  {{ 0xe42ea6ade883578aUL, 0xdb841d736aacdc59UL, 0xafbc39f661961241UL, 0x2e286d586bf36f73UL }},
+  {{ 0xc082fd6317b120b4UL, 0xe23011069f300b47UL, 0x0b782e5541f3c64aUL, 0x0735bfaa4e96d0fbUL }},
+  {{ 0xa989f12ac7ea4110UL, 0x1d2ab07c09772de4UL, 0x93bab326db527582UL, 0x09102ec7ba7ea44eUL }},
+  {{ 0x98d3ff67f305789eUL, 0x3127595225299aeeUL, 0x57254e4d4484c7e0UL, 0x0c1e884b0fcc2e31UL }},
+  {{ 0xf134b08e02024ff3UL, 0x0a4ab6f42842828fUL, 0x634e64a526bbf3a6UL, 0x1100e0613865f4baUL }},
+  {{ 0xa3a6ccbf0d49f756UL, 0x345fc8f27a5d2387UL, 0x2ddea52cd3969df3UL, 0x2a6b21ff4c95d015UL }},
+  {{ 0xb98c608ff29f2f56UL, 0xadbd9a24ce238e22UL, 0x5ad7533cf5ea087bUL, 0x04990bdd0180fa57UL }},
+  {{ 0xd69dd26465503121UL, 0x1fa76a9b49d89e55UL, 0xe9688595f7287d0aUL, 0x13b473bc49f7e9e7UL }},
+  {{ 0x5fff47d6bf555f70UL, 0x3a3a538f4403d5d4UL, 0x4ea8fb4169059e80UL, 0x301c263212c77179UL }},
+  {{ 0x9d73e39e1bc8207bUL, 0xc66f499f87d7361cUL, 0xeb9b233b4498afdaUL, 0x1202e9aff9a9f48aUL }},
+  {{ 0x29ad13e72c99554fUL, 0x37e732f4608bd0edUL, 0x450fa35fcad3e8cfUL, 0x267498bd3dd14816UL }},
+  {{ 0x78dd745921cdaa06UL, 0xc2fa4e760b0bd002UL, 0x730c68208a40352fUL, 0x03109476f0109626UL }},
+  {{ 0x41cbcd71f3abb777UL, 0xe582dd40dda04995UL, 0x980eeba3de5a793dUL, 0x081ee281e92f0ce0UL }},
+  {{ 0x794523182d81b2bfUL, 0xfec9c95df8c569bfUL, 0x1a378b90323612edUL, 0x22c10df10deab182UL }},
+  {{ 0x1863e0beab9e8707UL, 0x3fb9357d4ca3c3e0UL, 0x8be1de3a9ad6ffb6UL, 0x24b05d41abf0bd40UL }},
+  {{ 0x8e9d429d5dd0d532UL, 0xd95b801bbc973739UL, 0x868c85e9888db57bUL, 0x0575ee9d3a474eefUL }},
+  {{ 0xceeaff93c7c0c95aUL, 0xbcde7b2f12bc3614UL, 0xc41db9f28b38bf36UL, 0x184359a1ae0f4a47UL }},
+  {{ 0x4fc998ed1ddcec25UL, 0xb089fdab4f657f4cUL, 0x30404c2d33ecd21cUL, 0x11b2163a0a90992dUL }},
+  {{ 0x508f2637f6bcdeb6UL, 0x68e03688139a2b75UL, 0x18343368e4fa64d3UL, 0x188c9ae0cf76d95aUL }},
+  {{ 0xcc85ad5d5a797414UL, 0xa38c86fd60139313UL, 0x33e81695fd3026f5UL, 0x0a6ec3a211a3f60cUL }},
+  {{ 0x15422b856727d2aeUL, 0x09d77047a31659e2UL, 0xb0b1e7a613ce7b07UL, 0x0f38cf2c91abd244UL }},
+  {{ 0xdc6d4b011bfb6f33UL, 0x5a9de497fc11123fUL, 0x7ed4781a5f5baeb8UL, 0x0f556e267386b10aUL }},
+  {{ 0x3cb34674384c595fUL, 0xba0c202373c4cf6cUL, 0xf71cd2d7f9519111UL, 0x1880171d34dc6c21UL }},
+  {{ 0x7bbf92b5a94a78f0UL, 0x581bf9fca97b1ec0UL, 0xdf3167248b40cf46UL, 0x1d15590a903c2c26UL }},
+  {{ 0x64e8eb865d4b3b4cUL, 0xbd1894070189c394UL, 0x292eb0c7dde16552UL, 0x20d7fba49951d2cdUL }},
+  {{ 0xf93097bd8c92262fUL, 0xfac4e71bf44e6758UL, 0x3c524519a013b3c4UL, 0x094d37aaaa712f28UL }},
+  {{ 0x5677cfccbd612156UL, 0x5e480dc85c78f191UL, 0x0169787a39b70b0bUL, 0x2ef06707ee10a21dUL }},
+  {{ 0x81093a19b3a8f00cUL, 0x94622405b1d7ad2cUL, 0x818fa1001f728e48UL, 0x303e038300021a82UL }},
+  {{ 0x88aa978c0d927b95UL, 0x492d8d45d1404ba1UL, 0x35d4feb55eece5f9UL, 0x2f0b5c95669aedccUL }},
+  {{ 0xea8f5ed5c8930283UL, 0xeb145895efcf1951UL, 0xdb9e7b46aa8688d3UL, 0x225532cc60ad4b46UL }},
+  {{ 0x4929a7791be7c62cUL, 0xb1d934da8e2d9f5eUL, 0x4f36e7b1bdcb6a49UL, 0x0f7557be447e4104UL }},
+  {{ 0xd380ae526f3af66fUL, 0x7a3397f39af4d548UL, 0xff67c0e77c175bfaUL, 0x13d7c200c3965533UL }},
+  {{ 0xbd2537401be3944bUL, 0x9861eaac6d10c465UL, 0xfa9dee9430a6a7fbUL, 0x22358c2f6e6c2aa7UL }},
+  {{ 0xfaba48cb92359344UL, 0x266c07e8cf543934UL, 0xff9976ec73924e29UL, 0x0d1c95ef146f2623UL }},
+  {{ 0xf319a92c36026b2eUL, 0xfd362bc33a7b315cUL, 0xdc161701b094e3e0UL, 0x29929e9ec76d5c61UL }},
+  {{ 0x7b78491dd4372788UL, 0x4ea3c88de6e59df1UL, 0x790bffaf3780a075UL, 0x158d3f8dc8a67644UL }},
+  {{ 0xcc4150c9c339d440UL, 0x4c5751913a379ad2UL, 0x2ee5998671e35e63UL, 0x09a6049e220e675aUL }},
+  {{ 0x67a512a6ff1703d0UL, 0xe82105cdaa2947dbUL, 0x7d9011967988b49fUL, 0x0e3cc24e617010c4UL }},
+  {{ 0xfb71128b1194b909UL, 0x8fa44cc7b267f1e1UL, 0x309f309498ec27e3UL, 0x2ec64495af5e87ccUL }},
+  {{ 0x6db4056eda369d38UL, 0xdc88877d2b9a369aUL, 0x73bf6d4fe9463d40UL, 0x0746c3155c732288UL }},
+  {{ 0xd4028d93c9297edfUL, 0x693c98fcea914200UL, 0x0761c875db80d333UL, 0x1821ad905515cb71UL }},
+  {{ 0x1c90d17e3bc84dd0UL, 0x4fde4a7ff5982aa1UL, 0x98cd6ff33d171473UL, 0x2b49d4ced162dd8bUL }},
+  {{ 0x30ec25e262b067e1UL, 0x9038b7fbff41e895UL, 0x4a19965e4be86d7eUL, 0x29a1cbdfe71b5415UL }},
+  {{ 0x4e6e766ac76a82f6UL, 0xcd929231e383d9cbUL, 0xdd3b4a4a5bd5e446UL, 0x2982db83c32bdaa3UL }},
+  {{ 0x9f6304a26a4e91b3UL, 0xfdfd67fa807018c2UL, 0x66bb3561af772560UL, 0x0255932acf2b8d13UL }},
+  {{ 0x6850ed4937dabe3fUL, 0x5f87791fcfaf0f3dUL, 0x31995428bf67976bUL, 0x2f67ea937511e10eUL }},
+  {{ 0xf064519170724e46UL, 0x446d824e7deb3effUL, 0xbc1a46d7038cc8b4UL, 0x0f86068edfb84115UL }},
+  {{ 0x9d8e409b4578cdbfUL, 0x537ecdcd756854a0UL, 0xfcb796dfd81b44faUL, 0x010e8d93a7b7c6c8UL }},
+  {{ 0x7917621743eadb65UL, 0x1f34d499bb74967cUL, 0x92dab8898b4eacceUL, 0x1751b7025b63d0adUL }},
+  {{ 0xde1e39a791209d23UL, 0x7f5492d709e02a13UL, 0x865c42b83fcfceefUL, 0x024c52c936cfbcf5UL }},
+  {{ 0x426677674a93c751UL, 0x0db3d43f3567928bUL, 0x4558af4be907ccc6UL, 0x05a68ca51c6db0eeUL }},
+  {{ 0xc42816e4180f84e5UL, 0x440f526cde08e797UL, 0xb76701ddd74e2901UL, 0x212c68b31e7bf3aeUL }},
+  {{ 0x73eab4e25344972aUL, 0x6f0bb36534de3297UL, 0x0d6a8049cb1ff7fbUL, 0x05e7a2e2157fedd2UL }},
+  {{ 0xfa45c9e2bd330a08UL, 0x54d20e2de3dbe05aUL, 0x84dd16705e296afdUL, 0x0ce2bd1420083dc1UL }},
+  {{ 0x2af12c96de27345bUL, 0xf675ccfb24fc5ff4UL, 0x9d37ed01d66e00ccUL, 0x1f90842016dffbb7UL }},
+  {{ 0x58d8746bcd3b1dcbUL, 0x08e8776132080686UL, 0x868e950c589220f7UL, 0x2265d5455c3add5aUL }},
+  {{ 0xbef008943d053a91UL, 0x5c23fa0a553b87edUL, 0xa1c937f66324c375UL, 0x280528d263712122UL }},
+  {{ 0x1497a44949494c9eUL, 0x7b78eeda10b014fdUL, 0xa8481162cae2ec7dUL, 0x1b0aa6b2eaddd1f3UL }},
+  {{ 0x73c7db1a0144bc5cUL, 0x53a7d7fd26289015UL, 0xd03921c476159262UL, 0x232f83cbaf78e1dcUL }},
+  {{ 0xa2f148a72097229cUL, 0x6e81ff6ffcd9af00UL, 0x71b684b412aad11fUL, 0x181070f340e3b699UL }},
+  {{ 0xde64454e65be5f29UL, 0xd4e20a0599026de3UL, 0x6c01062e20b2dfa2UL, 0x170bf9a382b352c9UL }},
+  {{ 0xc2a6e9665da985b9UL, 0x8e0efc2dabbee109UL, 0x42d917c308c90e45UL, 0x14158062c6ed87bbUL }},
+  {{ 0x4df3f32864020c6dUL, 0xe6d76127ee72eeaeUL, 0xdb6ee54466fa2460UL, 0x288dea8ff700de22UL }},
+  {{ 0xa95300e9d51de6b1UL, 0x530325ae77a05c64UL, 0x966957f059c669eeUL, 0x0477e3652f25c267UL }},
+  {{ 0xc202c7afbc4289feUL, 0xb5c9f910b59b091fUL, 0x24cd78014ffb3b50UL, 0x22f6423e0a80cae8UL }},
+  {{ 0x8127837ffc28f3cfUL, 0xb4111183ee027141UL, 0xd0a1f3620cb1fd42UL, 0x2414bbb76b8af88dUL }},
+  {{ 0xb15d0da34874485eUL, 0xbfa2cf3f5486ace1UL, 0x5f6ec9c0cfca20f0UL, 0x2ac55c7ab544afe0UL }},
+  {{ 0xdc00e3613b460d33UL, 0x9364c74610ba0abaUL, 0x748086843f7e8a9aUL, 0x239e1a731a2ad6e7UL }},
+  {{ 0xfb378f8a793c155cUL, 0x6ed80c1bb06d561cUL, 0x54e80a06b72b0a19UL, 0x2f3e1771befe5224UL }},
+  {{ 0x933c5a890a290c2eUL, 0xbf369ede89e1f71dUL, 0x6a7fd4cca88f380aUL, 0x0c41993855ec6f4fUL }},
+  {{ 0x2cc26b3184259df1UL, 0xd212a9885fc96f3eUL, 0x842104ea2bdc5e1bUL, 0x1a6f60d275d0b8d8UL }},
+  {{ 0x89bd14b444ed5d3fUL, 0x1d297dda5aee9993UL, 0xc6a7789086b5a014UL, 0x0130fbd0445d73daUL }},
+  {{ 0xf291e795d978bf00UL, 0x90276e35d6a04981UL, 0x99d405aba0ba12faUL, 0x055038290f0dbc34UL }},
+  {{ 0x7469e178c29c20ffUL, 0x8fd08072ce54d353UL, 0xe5e2cdbac1ddeb13UL, 0x0f82298fd67a4b90UL }},
+  {{ 0x9cf4d58354a8d392UL, 0x3eb76d20828afc5aUL, 0xb6d2d65cd9ccb7baUL, 0x1c5414dab32784fcUL }},
+  {{ 0xf0a311f53014cd59UL, 0xa94f4a8c105e7c26UL, 0xf30c8f7c5be7fe4bUL, 0x2285dcaef23d05fdUL }},
+  {{ 0x16c5469ee7d3c837UL, 0x4a4d70772dbd3c6fUL, 0xfd17c91710973055UL, 0x06e0a97399ba2d58UL }},
+  {{ 0xcab2c41737fbb6dcUL, 0xa1e83754d9796129UL, 0xd2ee8a5f98d7bf9cUL, 0x17c24db40f1cec8cUL }},
+  {{ 0xcca2a5657c6e8da9UL, 0xafd57a506e2bca77UL, 0x9ca57834be2da4bcUL, 0x071a0ac54577b165UL }},
+  {{ 0xb3d9e4680bb4cb73UL, 0x4ed91d13001412cfUL, 0x514b6370d17996b3UL, 0x21eb0792b78ffeb6UL }},
+  {{ 0x3ba959d3c8732ea1UL, 0x952a702996e2b796UL, 0xc45f83663a80953cUL, 0x0c256cb16a91dce4UL }},
+  {{ 0x3d5877bce5f26fb9UL, 0x7cc1ddc68e0aa3ffUL, 0xbca5bbe57456431eUL, 0x0ce6b0593eb8151dUL }},
+  {{ 0xcd3bc337fa008fa1UL, 0x7601adf611acd524UL, 0xfd90abfc3d41d204UL, 0x282aa66a61509994UL }},
+  {{ 0x6ac40016f0326d83UL, 0x30a3fcf6c5132f31UL, 0x9c2a5997ad9ec4b7UL, 0x01500b51d22068bfUL }},
+  {{ 0x46c8df62256d60deUL, 0x482395a9f35ccf91UL, 0xce4a3f1bf8d781bdUL, 0x20a456f09a197de2UL }},
+  {{ 0x4de77f13a0f30c20UL, 0x239af94fa75e3a2cUL, 0x0ee9b5be860dacf1UL, 0x1c1ea86d4091a36bUL }},
+  {{ 0x5e902a596bb6d9dfUL, 0x136da47e715822b9UL, 0x32525cef28ddc7bbUL, 0x150701cc4e7bc83aUL }},
+  {{ 0x7b7e0be926969bb4UL, 0xa10a1d8fa1d20b8aUL, 0xb75a24947f050d8bUL, 0x1c1ddbd69e2f266fUL }},
+  {{ 0xadadc9b28e3651deUL, 0xd6ed5d90d5185d08UL, 0x0518c9e48c734eeeUL, 0x073ce38550e0418dUL }},
+  {{ 0xfc4d579035eb7492UL, 0xa18ba48559397708UL, 0x2191d2fa413e16acUL, 0x0608af7178d9ddd5UL }},
+  {{ 0x5c77fbcdba4ad6b0UL, 0xc9930b0366a91213UL, 0xd9d5f670050425fcUL, 0x24f7c7ae8deb788aUL }},
+  {{ 0x869abf12402fc7aeUL, 0x7411020760a9d758UL, 0xd01295d913376448UL, 0x015329e8b4453b0bUL }},
+  {{ 0x74a1ed2a19e18e0eUL, 0xe762cf9b0e018a92UL, 0x4936b3fddc5e6d7aUL, 0x07607132809b8323UL }},
+  {{ 0xfa234593dedd1d05UL, 0x92e86e9b3ea5f7fcUL, 0x11c8a154aece5744UL, 0x0c550415d466454bUL }},
+  {{ 0x5892c1d31caff13aUL, 0x6a542fed580a85e0UL, 0xb56668ce6ccd57e2UL, 0x0e61f8e72756a987UL }},
+  {{ 0x71844594462c21b5UL, 0x488af1f2f931daf1UL, 0xadd4a5dddefe5888UL, 0x21636076cf956fc1UL }},
+  {{ 0x23e78fbbc6a32a1bUL, 0x6f5fa329cd0991d1UL, 0xbb4abb718dd8f455UL, 0x2bcfbfa5e6cd40ccUL }},
+  {{ 0x0808e0ce628624cbUL, 0xecd0e19a0a73bd8aUL, 0xbd7d87436139e967UL, 0x280b5a0cc2bb5816UL }},
+  {{ 0x3cff1714d68e8d72UL, 0x534bdf1d429bff8dUL, 0x5809ab0c50bc2ed1UL, 0x14d045b98ed5c329UL }},
+  {{ 0xb93e3c39f6a985adUL, 0x9389555a40064049UL, 0xa8950c8cbb8ddfadUL, 0x173cd6bacf604287UL }},
+  {{ 0xaf9ac6edc684750fUL, 0x0846f4e627d89d37UL, 0x10e7b1743aa64625UL, 0x22b807f206ebed35UL }},
+  {{ 0x9908704fd85cfd9fUL, 0x59c69d60ac1a2fc7UL, 0x02fcbb185c51fd9bUL, 0x2a165b20fe194c1cUL }},
+  {{ 0xa99a2175e3244e6dUL, 0x9a6dab1e4d9ed982UL, 0xc06a275c7e9e49b5UL, 0x0b797dec795e19c3UL }},
+  {{ 0xb8d4c54c740aa4e0UL, 0xd3926f418db1c55dUL, 0x51b30e1a4a7aa4d0UL, 0x1b4fc743c0bf5454UL }},
+  {{ 0xf0b12bc56dd185b8UL, 0x82415e2c23c0315eUL, 0xaf6e94b09e59634cUL, 0x0ebdb449a73d43efUL }},
+  {{ 0x35ec8659e800b04fUL, 0x43b48df13d76b59bUL, 0x4a88ad3cb7d7d4b7UL, 0x2c29e8429c50a35eUL }},
+  {{ 0xb22a0be1ff80c622UL, 0xad24c279a4b292f0UL, 0xdbace07b2b405ee5UL, 0x188dc2b37414f6e0UL }},
+  {{ 0x854fbedfc6812b82UL, 0xe114f6cae4f1be19UL, 0xb302c97771564a5bUL, 0x114df50adf15caceUL }},
+  {{ 0xe0790f0d2c2016f4UL, 0x9cbf563518ca6ca2UL, 0xb17084e5718902fcUL, 0x10a14bb19c5aa476UL }},
+  {{ 0x81366a956da0dedfUL, 0xa59d99f64cd45ca7UL, 0xe2b6cf4c4c75ffb4UL, 0x2019a466867c90b6UL }},
+  {{ 0x217a061c77d96ceaUL, 0xd5757880bf412318UL, 0x4afd5c8e76865d25UL, 0x0e510f9fb5ce1807UL }},
+  {{ 0x4e80f1691625b1a2UL, 0x7272645cbd611728UL, 0x5d8b0ff1c4d732d0UL, 0x2108cff86c22c765UL }},
+  {{ 0x0852bbbc2ed04b76UL, 0x78586fe8ae649077UL, 0xaa2ef1e436f3bcb5UL, 0x269683e08d24af59UL }},
+  {{ 0x1f65272a50a5a9a9UL, 0x9014d4ef9e15a910UL, 0x2edfa637e91c7093UL, 0x0e97879fb3eb72beUL }},
+  {{ 0x2f90a84b9840f8e2UL, 0x1044b28500c767beUL, 0xee5859b5772a557cUL, 0x09f1c7e818f87272UL }},
+  {{ 0x5f77a4bcc8d0e3d2UL, 0xc0dc6053804c6117UL, 0xe788b42c22246e25UL, 0x02dc34c216472c4aUL }},
+  {{ 0x9321a802d463f3d5UL, 0x83bee316e6217264UL, 0x911899e8c28b626aUL, 0x10365af0f6bf6aedUL }},
+  {{ 0x7fec064766cd1a6eUL, 0x046138816210957bUL, 0x6a6f3fef61d89deeUL, 0x0ab910a8636eb60bUL }},
+  {{ 0x17a95ea5901d4b4bUL, 0xbf8e75143d9cbf69UL, 0x3b9223c11bc9a755UL, 0x0d7564c6c4ca54e1UL }},
+  {{ 0xbc5c42f07ef7a405UL, 0x7daca377d41381e1UL, 0xab8a7c54bc1afbc2UL, 0x1e0420480d3601dbUL }},
+  {{ 0xa44af9e83e706a72UL, 0x30467cc6889c68afUL, 0x64fadc31a380f886UL, 0x0c6a44b133ce5468UL }},
+  {{ 0x419632d8447fbbacUL, 0x5b160f32939cb250UL, 0xee8943f1c95f0506UL, 0x040d52be69f2ba2eUL }},
+  {{ 0x9fb340c109120444UL, 0xa3b53a70cee1b541UL, 0xe178d19117964e79UL, 0x1c316b3637a2d117UL }},
+  {{ 0x228e93bfbfe7b701UL, 0xe600eb51f58b7173UL, 0x1780bb02c4a7a7a7UL, 0x17207b2240a0ed38UL }},
+  {{ 0xa136f0dc41a2c061UL, 0x5750fef1394380b1UL, 0xa85d8e513997747fUL, 0x0a9690842279da9dUL }},
+  {{ 0xadc82accb4da0421UL, 0xb2caad1b413968edUL, 0xc8a3281e29135dd0UL, 0x2e4e84eccf8e640dUL }},
+  {{ 0x0fdec635e98bc3c4UL, 0x8ef9ac8744b1e318UL, 0xc79be46ad692d392UL, 0x07d4e90415338a67UL }},
+  {{ 0x24b234f059c39fa0UL, 0xcf2ae865ff76e7d5UL, 0x13987a15fbacb417UL, 0x0bcebec43aec0fe4UL }},
+  {{ 0x22d4ce4d385ef866UL, 0xd6506c3b58201178UL, 0x83c51106691dd37fUL, 0x084bea5184e9bfa4UL }},
+  {{ 0x9c77d747263244c1UL, 0x659019a11195b6a9UL, 0x9511a61ec902de91UL, 0x184048c60a83e06bUL }},
+  {{ 0xb68afb7d17ca7f74UL, 0x17ced1fe273051bdUL, 0x3351e20e1b303ffcUL, 0x1bf06a7ea1655033UL }},
+  {{ 0x33f3e61940f148c5UL, 0x45a1da3e22bbd5e6UL, 0x9f1b6cca298e2385UL, 0x1758fd7f5a703fd6UL }},
+  {{ 0x1a929fe79e54eabcUL, 0xeb7a4050f23efb0eUL, 0xe25079a2ef3a4399UL, 0x24377e4f8c161340UL }},
+  {{ 0xd7eaf8cd38c7e4c3UL, 0x9d688ad8e3b18d4fUL, 0x3059007f8e528db3UL, 0x2ba5812b9a603154UL }},
+  {{ 0x347eefb756ac1cd3UL, 0xcf154053cabb2dd3UL, 0x40662cdec5906a43UL, 0x24f8c0dfb5a57c88UL }},
+  {{ 0x83a8b78cdf45ae1dUL, 0xc35a68eddc447d67UL, 0x1e0631f731313cf5UL, 0x0695de707e5015b5UL }},
+  {{ 0x899501116739a0b9UL, 0xf41302caaabda74eUL, 0x9daf05fa51e2b577UL, 0x00a1823ed5cab6c3UL }},
+  {{ 0xcd573c0b9ddb7d23UL, 0xe2330b36994c8bc8UL, 0x3610a9a7975d8c5eUL, 0x03b957e376d3b540UL }},
+  {{ 0x1a9e14d51c7ca94dUL, 0x30bf943e1a14619eUL, 0x1417b62b1593a092UL, 0x24f07dcc09f05c17UL }},
+  {{ 0x3786ae29f089ee8fUL, 0x14aab5e99ed71801UL, 0x2af4f353a483b985UL, 0x29555d4ed1fe4fbdUL }},
+  {{ 0x8c7e6599c82266f5UL, 0x8450eefe131bfeebUL, 0x2141aa50ae9c1560UL, 0x1ee3d5f34f25a97dUL }},
+  {{ 0x10939cbcf5f2ac91UL, 0x48fae156719c7ed6UL, 0x9bb952c265573087UL, 0x272673388c49a89fUL }},
+  {{ 0x1987c905ef781f7cUL, 0x8b0b57252a061c91UL, 0x8daef0652916aeccUL, 0x0d695d161817c12cUL }},
+  {{ 0x9b33ef9bd4d5d3a1UL, 0x06c73061272cbb8aUL, 0x54aeb39ec55c7d9eUL, 0x17302c913cef778eUL }},
+  {{ 0x7743f9d77edc84a9UL, 0x0837dea3a918265cUL, 0xe083feca62c33d42UL, 0x0838d05886b1128eUL }},
+  {{ 0x20248167321622afUL, 0x925b50a1c0ac0630UL, 0x4999b53dc984ba90UL, 0x11dd2d0e2bc5e00dUL }},
+  {{ 0x0d246427c28da3eeUL, 0x949eff9804df6a12UL, 0xdb5f49b2f04ff98eUL, 0x07419b83608220baUL }},
+  {{ 0x18836051a3dcfd42UL, 0x59cbcb56f2750e1dUL, 0x414992bb17367459UL, 0x0f97423e94ff3f15UL }},
+  {{ 0xebdcda471a54f684UL, 0x0d5b255729f4bce8UL, 0x8da5fb1439c21843UL, 0x1e4fa6abc631b4d9UL }},
+  {{ 0xa34c7cabbf77bff3UL, 0x7ed19d45e0cbd265UL, 0x552569b3976abf9bUL, 0x2102a42d31e65219UL }},
+  {{ 0xa71ea9feb2976fe7UL, 0x0bcbbc71bdbf3efdUL, 0x7c1de527a92b6749UL, 0x10bba45bc3c2b257UL }},
+  {{ 0xf9d6194270590ec8UL, 0xe32ae87ab03c6133UL, 0x0a79ee024465ed7dUL, 0x13ad9a7d9b5c4e18UL }},
+  {{ 0x993e031c5692c315UL, 0x954559258ffdd98eUL, 0xae079dda309985d8UL, 0x2f2118e35c224d0bUL }},
+  {{ 0x6c0c4a3ec0f29525UL, 0x40d6a04330fb0272UL, 0x04277ef7f8310f89UL, 0x1be9af9d3f3cfee8UL }},
+  {{ 0x2ef36c1ed645075cUL, 0x75020dd17b209435UL, 0x46d2d88cf270ddafUL, 0x092f58dea8634aabUL }},
+  {{ 0xd1d946bdebc3168aUL, 0x50c19dc2ebcd5a66UL, 0x2c1ff6a7048b8dfdUL, 0x20f11793efb546bfUL }},
+  {{ 0xe5fe88403a2eeb08UL, 0x7e137ccf641d5355UL, 0x3e07224f16e015b6UL, 0x051aa72bbb280bd0UL }},
+  {{ 0x4e9878750691087eUL, 0xfa3cca7a6703170bUL, 0xaedcef07fe48b4f7UL, 0x0ffca06f7ba1d9adUL }},
+  {{ 0x046580ad1e787eb7UL, 0x821d475374e3caa0UL, 0x570d693273ce7432UL, 0x098bee97eec22e0cUL }},
+  {{ 0xee01be092608ca38UL, 0x9ae8db97ec7213f0UL, 0xcd94e9911498661fUL, 0x063cebc9d48c4b16UL }},
+  {{ 0xc9f0f4202f5302f1UL, 0x9f095124684e5590UL, 0x77f7877d1af0b7aeUL, 0x2102a686942ed886UL }},
+  {{ 0xa922f27f28abdbefUL, 0xce9d05a501c4a686UL, 0x93af2c647cd9f97eUL, 0x15122514d38426a7UL }},
+  {{ 0x40096998f6d0958eUL, 0x6c9067883a006f2cUL, 0x47c12fa2b3df349cUL, 0x01e1206fd7a499b7UL }},
+  {{ 0x09a576cfc3ed0135UL, 0xc2a8ec597cda2043UL, 0x1e71fabe8885be3fUL, 0x12ffc9a6438ca230UL }},
+  {{ 0x3dfe98919729d14eUL, 0x2d1a830be6a7d93aUL, 0xd4b50f79ac794e45UL, 0x1609b588e4b6255aUL }},
+  {{ 0xfe0f03062f910a79UL, 0x12b30f8c764aacb1UL, 0x071e359c68255f5cUL, 0x05ad045acb0a6de5UL }},
+  {{ 0x8cac1102b2cfcafeUL, 0xf8641260ba9ff7b4UL, 0x5d408afe6356b7fcUL, 0x1043e7f9b8c42e63UL }},
+  {{ 0x8553014b785010b7UL, 0xf5110e3a0be2fe70UL, 0x7525dcae2a87117eUL, 0x08b4b93f80c28df6UL }},
+  {{ 0x0351052268ae14a8UL, 0x2143bff152810d7eUL, 0x3ba34068873880e7UL, 0x1a27593714889c67UL }},
+  {{ 0x17a2b5bd2973e07cUL, 0xc2adb8e2cee7fa22UL, 0x310f8de36e110362UL, 0x297d94b76f76534eUL }},
+  {{ 0x51d81fecad91be7fUL, 0x91e296b75fed0f14UL, 0xffb2f2fe9fa9003bUL, 0x033fa4e84c6e92aaUL }},
+  {{ 0x2b1d49f32f0b0a2aUL, 0x684821a554f5a304UL, 0x7d5412dfa7668473UL, 0x190fb522bec2c138UL }},
+  {{ 0xae690bdf16c838a1UL, 0xe0739bf7c039a838UL, 0xd6a0b76d0f102e7aUL, 0x1796dc30c3f70ce5UL }},
+  {{ 0x1c7e2cddb2a6b28fUL, 0xb1f864b85b8532d0UL, 0x6625e36443287b36UL, 0x056506367354a3b7UL }},
+  {{ 0x2049bfbcfd6d6a28UL, 0x7bb4303d8fe81185UL, 0x127dffc4f0755310UL, 0x07d45d0757035ca3UL }},
+  {{ 0x9a97fc22bec1eaafUL, 0x99b2914b133d0a3cUL, 0x0b3303d9730f13dcUL, 0x0a1a930ed357c473UL }},
+  {{ 0x20b55d2bcbdb3803UL, 0x8b6d6827e85599f3UL, 0x9cd20f39c515325eUL, 0x2347c266123dc523UL }},
+  {{ 0x9b51e3ba2ec67900UL, 0xc28fcb69601ce480UL, 0xddf62f3c201ec992UL, 0x1fa93e2f249f1654UL }},
+  {{ 0xe943d3aeb953c01dUL, 0x1f213d4759df3a59UL, 0x30120876a9a18dc5UL, 0x2e935d6c61eb0b0cUL }},
+  {{ 0x474a1da3de1f1503UL, 0x74548e96ca496b0cUL, 0x09d52791d4720de0UL, 0x287c6b0f41a01467UL }},
+  {{ 0xde16e2e8d1926b38UL, 0x64df4a6554e07f8eUL, 0xa1fb13776df1fe5dUL, 0x1df9d6c9bc67b3b5UL }},
+  {{ 0x290c14f0b6bbbb52UL, 0xec655f07fa1a6ab2UL, 0x17209b5800230840UL, 0x2bcafcaf1e5c23e8UL }},
+  {{ 0xc9692a287a3a4a41UL, 0x3f0236b75b1a5fd2UL, 0xd7a37108023f3112UL, 0x21dfaa273c3c49a9UL }},
+  {{ 0x22efb83e46a2c0d5UL, 0x81d6dda51c8cd637UL, 0xece59d1ed0b018feUL, 0x1a2b0b4e5e72603bUL }},
+  {{ 0x6dc9066fa1149517UL, 0x0e99467d5b969478UL, 0x0932a4ccf44e25c6UL, 0x0229273fa914e12dUL }},
+  {{ 0xa8d254dbf311d474UL, 0xa1c9abd8fccc263fUL, 0x936223ae609ea10bUL, 0x25a33a3a18ad9b95UL }},
+  {{ 0x3ba57c39fe16e1d0UL, 0xaa9caacc92542499UL, 0x63b371a57ea9d439UL, 0x203a0099556072b4UL }},
+  {{ 0xbfd1e6093770dedcUL, 0x7c61f5d15aec7adcUL, 0xab8c467264b182b7UL, 0x0ac513dce3098f42UL }},
+  {{ 0x09556764d13dce43UL, 0x789b6b398ecf3ca2UL, 0x71e1625ae8cc5d65UL, 0x1b9b78909989620bUL }},
+  {{ 0xbaf9b099361f4566UL, 0xad09d1eb348485ecUL, 0xb47e86241e7fd8dbUL, 0x07cecc143e7d6575UL }},
+  {{ 0x42a2d8bf759fa82cUL, 0xced734cd2133b372UL, 0xe0024cd88930e2aeUL, 0x22318af5182b6ca1UL }},
+  {{ 0xc354d05b1e3564e2UL, 0xfd7188670b9643ccUL, 0x14fd18729642b4a0UL, 0x0d51272bfa735857UL }},
+  {{ 0xb348063f00c99814UL, 0xa5412848daaee43cUL, 0xaf55ed76215373ceUL, 0x124e428f009d373eUL }},
+  {{ 0xe57c360aae3f34a8UL, 0xf42de83ed2de316bUL, 0x30897a6c5757d3b4UL, 0x04e995db28ad4d2aUL }},
+  {{ 0xe13e119bc37d6c8fUL, 0x02f61b5d76f759b0UL, 0xc6b47d236891e176UL, 0x0008b17e2a72a2aeUL }},
+  {{ 0x2fd8a24755180b46UL, 0x0a5ebff9fa6f6f10UL, 0x1dfc8b1c4773faccUL, 0x00d822599162dfdfUL }},
+  {{ 0xb0a0b5dcfa3b9c38UL, 0xc1e38c7e2e80c619UL, 0x30f65a8c3959e3c5UL, 0x21debd0d608920baUL }},
+  {{ 0x9793629a20e98afaUL, 0xb0f9a2eaea103653UL, 0x2120c27bba6653b2UL, 0x2d12eee484a0036fUL }},
+  {{ 0xceeb2c202b1fbe1fUL, 0x2fe541acbf8c0498UL, 0x2aba3e57e10506a1UL, 0x08ba122fcb735020UL }},
+  {{ 0x9828204e8e2b6a9cUL, 0x5a3a6f15eeb867e0UL, 0x32454dd332b17a31UL, 0x0b31858317cb478cUL }},
+  {{ 0xd8b13dfb140e44ecUL, 0x96c29b6ffe448479UL, 0x9b635302d1a0c781UL, 0x086661ac08af1243UL }},
+  {{ 0x111a91f7ca2de5feUL, 0xed1c30d4bc5f9da7UL, 0xace7a99a136179c6UL, 0x1af7af57638f7afcUL }},
+  {{ 0xf2ebc65a68301f70UL, 0x098438fc5cfb70faUL, 0x1804b70dbc7519faUL, 0x1d22f3c500139637UL }},
+  {{ 0x5448cb4bc2899170UL, 0xf7fe3031d6326ee3UL, 0x78948b2f4ee9574dUL, 0x1005a13172350117UL }},
+  {{ 0x682b542cad358ff3UL, 0x5724e9dd9fc8f36bUL, 0x2ba5e23128ed1f4aUL, 0x11c31ebae126fd4fUL }},
+  {{ 0x477f38901e5952b2UL, 0x9d1a3f4d707c35e0UL, 0x91302c538bb1afaaUL, 0x063894ace6abbc7eUL }},
+  {{ 0x6074b47ef0006e30UL, 0x5986d0b36ae50101UL, 0x20d19dafa473c211UL, 0x2f173440a4883865UL }},
+  {{ 0xaa20964deafe0b91UL, 0xe2a7e6ca5edd4a1fUL, 0x057ba486f576e66dUL, 0x205bf32d4e1481c5UL }},
+  {{ 0x8e742f9ec6841d0bUL, 0x31061ccfad5a5217UL, 0x7b71500b33057f2aUL, 0x16daea714103de31UL }},
+  {{ 0x11abbad157bd1752UL, 0x086b0bfa4ca1a650UL, 0x620544b4b2dc4a34UL, 0x0bc77c690c4727e9UL }},
+  {{ 0xd592b3bd0452454eUL, 0xfcb2a667b4f8a458UL, 0xb0591d7fa9013240UL, 0x181ad6d3181e4869UL }},
+  {{ 0x75df9ada1c6e61c7UL, 0xe7865ac098d96a8dUL, 0x4e79b52ca624a1bbUL, 0x2eb9734444d29531UL }},
+  {{ 0x56252281af9dd325UL, 0x2b56cd8ca643e6aaUL, 0x001bdcf70d097969UL, 0x050fcb4ec2ddeb58UL }},
+  {{ 0xc520cddd629cf7cfUL, 0x1dfe1f44cce3fc7fUL, 0x82e70c14357cc3caUL, 0x1e529e7b2aad97eaUL }},
+  {{ 0xad0e31cb9df06818UL, 0x981d398bf7cbcb97UL, 0xb27a6760ea88d928UL, 0x29acb22cdc4819ccUL }},
+  {{ 0x018bb277e22b3484UL, 0x5112b64eddb72d72UL, 0xf78b3bcffa1ad009UL, 0x11829e68b5f4754bUL }},
+  {{ 0x7479e5e3057e0adfUL, 0xde6f62ade16366acUL, 0x5dafb1e94b75a7a3UL, 0x05439e7c6850556dUL }},
+  {{ 0x429db1686714e521UL, 0x4069a1ff88a85207UL, 0xa771b0afd8bee2dfUL, 0x03fce5510d8086a4UL }},
+  {{ 0x38b2bf4062f50734UL, 0xe9ce00492ef1cae8UL, 0x327429d62062a64aUL, 0x1cc78575b13144a3UL }},
+  {{ 0x8fe7bf8806045b99UL, 0x0eaf5157e1a05477UL, 0x509622ea5ead2b6eUL, 0x0348bc748879507cUL }},
+  {{ 0xa10163a768b038fbUL, 0x8c2d3eabdce9be3fUL, 0xb2bbe02028e58741UL, 0x20d27adef4ab0768UL }},
+  {{ 0x7233916fa65363e1UL, 0x67395b53fbf62a40UL, 0x877b9c7ee0adb055UL, 0x2260000302501716UL }},
+};
+
+static const fd_bn254_scalar_t fd_poseidon_mds_5[] = {
+  {{ 0x77464b55cd95efcaUL, 0x68ba7a74ae0e5894UL, 0xbd4dc1c2266c359dUL, 0x2967c834940e37a0UL }},
+  {{ 0x9d7560eab0fe4046UL, 0x35aebb7e1cbabfdeUL, 0x046f4c2b5ffaab98UL, 0x10c9d5b18c43b9eaUL }},
+  {{ 0xb866652e4f26da85UL, 0xb9e2d4c767608cb5UL, 0x7266982acf0812ffUL, 0x1075bbdae372b70dUL }},
+  {{ 0x6190b23770183886UL, 0x101d044302cb2858UL, 0xecd03dccfbeaf617UL, 0x0b084598422035a5UL }},
+  {{ 0x71d451ca47c3e06fUL, 0x1a4dc1da0d245f85UL, 0x4812497a20f7afceUL, 0x02d1c2ecb1969e4bUL }},
+  {{ 0x6907e36200995439UL, 0xb9f80b5666c65169UL, 0x7ba328f07ebc2640UL, 0x152d921c334deb59UL }},
+  {{ 0x9de26ee0faaa6230UL, 0x8b3cedd3678272c4UL, 0xbf689106033676ecUL, 0x0a4f014b431ef663UL }},
+  {{ 0x0abe2754c2279be8UL, 0xf34d6acdb0ef8be1UL, 0x638c985fb12509f5UL, 0x0ce4a0756717cd0dUL }},
+  {{ 0x4ff66343628de773UL, 0x8669e3967283e9d5UL, 0xdbdb4492fd9478a1UL, 0x2a172f4971297058UL }},
+  {{ 0xa96b93484bd7274bUL, 0xb6ffb6120bbc6f39UL, 0x4f8cc3b20738a669UL, 0x26d0dab233956299UL }},
+  {{ 0x235bc3071b88c57fUL, 0x1edd9e8b512a928bUL, 0x4eba9db9a285a5dbUL, 0x208c85cecd6e86b2UL }},
+  {{ 0x8b7a04145ef1d11aUL, 0xed5ccb60d2f55df9UL, 0xc0463074d5d84b7cUL, 0x0fc883bdcf417770UL }},
+  {{ 0x16ef19d92023860dUL, 0x97313a990cdaa693UL, 0xfa536002a38deb76UL, 0x157c584bf12b5fc2UL }},
+  {{ 0x26b36d6f81141445UL, 0x46db4e5f5c0c0592UL, 0x1c8ff6641950ef7fUL, 0x03831bb3c0404ec0UL }},
+  {{ 0xe693b6e9a4a622a4UL, 0xd3c7b489ce3e9706UL, 0x97a65d65e20440ebUL, 0x01c50a5a391d3e7fUL }},
+  {{ 0xd7e96fada4cc7131UL, 0xe05eeb104bdd4f26UL, 0xd629a31acc8b39c6UL, 0x292e987009256cb4UL }},
+  {{ 0xc7a0f540e19091ebUL, 0xd6b9fc0427f1efb4UL, 0xd709082fce71505bUL, 0x2c2f39bf3fb689c1UL }},
+  {{ 0x32ec79c4fa39b5e0UL, 0x07e1d8f6dc66882fUL, 0xdafcf6f32b1b7f1fUL, 0x0b80626e4af5efe5UL }},
+  {{ 0x48268958c0294633UL, 0xe32eaddae7cd0cfbUL, 0x83f515af535c5f73UL, 0x0eb68faa42851083UL }},
+  {{ 0xde28a4428ec83e3aUL, 0xc302d6eb2a211388UL, 0x78e5ca7195aeb86eUL, 0x1f159c9528951410UL }},
+  {{ 0x9337ce2160d27631UL, 0xb7603b2e38f0d93eUL, 0xba04b96b55dfec38UL, 0x25c45b9bb527b189UL }},
+  {{ 0x570517f8d7bf3625UL, 0x06f64bcced634dafUL, 0x85747cad8e788981UL, 0x240f49cb93d117d5UL }},
+  {{ 0x74572ba3822678b6UL, 0x1178400143204c5fUL, 0x46e8e28cd12c3a6fUL, 0x10b1d99213e5666eUL }},
+  {{ 0x1c641486ade67a7aUL, 0x4b50719a5e10222cUL, 0x9f5dd44f4cc1d827UL, 0x01b5b9eef181679fUL }},
+  {{ 0xfeb302a5110d9eb0UL, 0xc251af52f6c4abc6UL, 0xff454cd9ef575da7UL, 0x1ab6f8eace913fdbUL }},
+};
+
+static const fd_bn254_scalar_t fd_poseidon_ark_6[] = {
+  {{ 0x3966746eb3b06f10UL, 0x67c6466fc0f39fd5UL, 0x3a03de41c85d5250UL, 0x0d857a86544d1217UL }},
+  {{ 0xbc41a286da885facUL, 0x7a38ffb857aba248UL, 0xb512f7291d795ad9UL, 0x10fb7fec7c13d076UL }},
+  {{ 0x6d1d4964dea84ce0UL, 0x8d4a87dec2f648e3UL, 0xa40f4401414bfd32UL, 0x2dc186390ef4dbe9UL }},
+  {{ 0x18a8327c512ca337UL, 0xb086d4a532ea851fUL, 0x9ccdfb6b34619d2fUL, 0x2e597226b701f891UL }},
+  {{ 0x08bc1e357682efd7UL, 0x32233461245550baUL, 0xaafed5b7566b525cUL, 0x1df63ae07aad0a7cUL }},
+  {{ 0x7a670fa6bdd0b678UL, 0x47d788f24768646cUL, 0xd9afdd5fad8e8097UL, 0x16a41755958b58b4UL }},
+  {{ 0xfa09f8fd4fec24b2UL, 0x7c86bf4afea6877eUL, 0xced393878bc5e9d5UL, 0x13b6ef9e4cf5c5ebUL }},
+  {{ 0x14fc85d26b0c98d8UL, 0x9dfb5edb70d6ce88UL, 0xdfe52d5b1a8fde5eUL, 0x061561e143f89d53UL }},
+  {{ 0xeeef2d6c9f6dd59aUL, 0x4d13164bc058d0d3UL, 0xe6d2d0921cb2d1f4UL, 0x04e0e31791feaeb1UL }},
+  {{ 0x59e30550bffe6a58UL, 0xd550a71c9628c9b4UL, 0x3b965dd504b2002fUL, 0x143c1bf1ecd0981dUL }},
+  {{ 0xc2470349d0ad2648UL, 0x7be94ea485ca5e3dUL, 0xcf87727fb96160dcUL, 0x21044b0fbfb309a0UL }},
+  {{ 0x898b515a5242c73eUL, 0xbc2b51061fcf8bc3UL, 0x973294b5cbe8bf0fUL, 0x276d0e6ece729a62UL }},
+  {{ 0x2b54a5be69a29b1aUL, 0x28d2518158ea41fcUL, 0x34108a13f040c523UL, 0x21b88876e30bfdebUL }},
+  {{ 0x49e60f91c94e64d2UL, 0x2f5eb5f89547ba60UL, 0xe3b288a6c1316752UL, 0x11aa0660f8898ae6UL }},
+  {{ 0xd10525422c953f27UL, 0x93a1222500746945UL, 0xacf92f6e40837dbaUL, 0x2844326b34953a5aUL }},
+  {{ 0xd41c0d968d1e18abUL, 0x5193652f94293a4fUL, 0xcc7349c778ecc8caUL, 0x07b27037105e8d5dUL }},
+  {{ 0x15efffbb876ef744UL, 0xe7133aee8786a855UL, 0xe38d4fdc47127677UL, 0x0dcf3d9e7533e8acUL }},
+  {{ 0x04e4386a4a540c8bUL, 0x1520a4e61f8bff70UL, 0x1a2638fda40e74d4UL, 0x015f720959224d2bUL }},
+  {{ 0xc88889fae9f82abeUL, 0x58daef106ed2ee81UL, 0x9005c3a61ecaa234UL, 0x155b25beaf58fcb2UL }},
+  {{ 0x15c0a6ac9601d55aUL, 0x1000105f46049eb5UL, 0x9a48a748b3a5c2c1UL, 0x168dadbabff828f5UL }},
+  {{ 0xc116b063fe2801ccUL, 0x0226b88a33ac22e8UL, 0xe88900ba454329dcUL, 0x0c308695fc71f971UL }},
+  {{ 0x5e13fe575cebe35eUL, 0x167c9d035a466f56UL, 0xcee78ae549d9005cUL, 0x08bb37b90fc51b05UL }},
+  {{ 0x10cdc00f55d77bb8UL, 0xe7f4fb9c27abb969UL, 0x05ace3cdec49500eUL, 0x0fda420f14b51566UL }},
+  {{ 0x311a3344ae2dda59UL, 0xb15e2fd088035ff1UL, 0x0b6d75ea3c3244a7UL, 0x1f56ab0efc7a0a92UL }},
+  {{ 0xc33efa2df19f808eUL, 0x260ceca7d573366eUL, 0x3954875915c159b1UL, 0x12069dd43d34df85UL }},
+  {{ 0xd05f2e16e3caf7f8UL, 0x68b3c85f3c5af7c5UL, 0xe9df071c065cece0UL, 0x197d30d853620048UL }},
+  {{ 0xb7e2125258a3db90UL, 0x0274e5391e04740eUL, 0xd2567fbbc6bf0e3aUL, 0x24e7a6e6a6d223dcUL }},
+  {{ 0xfa160bc705598c62UL, 0x9fc1698c64e6db47UL, 0xe8bb75f84ab7161bUL, 0x1439260b0147bff8UL }},
+  {{ 0x934fd1cdc2005a39UL, 0x130bc16a8ad1135dUL, 0x9c091934871bfd55UL, 0x089c021f59a5a392UL }},
+  {{ 0x55da838c29e8312eUL, 0x16ced810d5b89262UL, 0xb5d75190b60eb107UL, 0x110d368299b3b668UL }},
+  {{ 0xe525e62416d160b5UL, 0x47f58bb9af3e9361UL, 0x02bdd699744d6cf9UL, 0x06a535fccff51935UL }},
+  {{ 0xeca04c8077ca63a3UL, 0xa110f854aea7bd4dUL, 0xcccdaa160187aa8dUL, 0x11b1126725ef8b0dUL }},
+  {{ 0x135c6f285cd41183UL, 0xc8d21fafcf602f08UL, 0xe992102b5f1ea435UL, 0x1c50c6da5f0d77b7UL }},
+  {{ 0xa78dbecac0380d59UL, 0x004e7c6ab74aa092UL, 0x5e8832ad44acfe90UL, 0x2e5e5a0fa00b2b30UL }},
+  {{ 0x22c38a2cf9408578UL, 0x6ebb7d7b201056a8UL, 0x275495c75f47121bUL, 0x22a544ea6f04e856UL }},
+  {{ 0xa360744dd7be81eeUL, 0x6edd12f5e4c3becdUL, 0x0202ff666f560304UL, 0x0b93b94c18430b1cUL }},
+  {{ 0xc8afbc39fab52714UL, 0x48037109eba47d93UL, 0xdd99f961e632b3deUL, 0x1b20501edc0c9595UL }},
+  {{ 0xb3993f2ce4dfcae2UL, 0xce9ca4f4914dde52UL, 0x2f14f00b416fa8d4UL, 0x1f49a13e308d6016UL }},
+  {{ 0xbc89f0fb7e9ec6a8UL, 0x40218cb2f0a67c4bUL, 0x563de2dfe1bca64fUL, 0x0ec938ef826afad0UL }},
+  {{ 0x645913ac7122d4aeUL, 0xe93f6711d07d9772UL, 0x4e47357277715f73UL, 0x07b2f0e22b967957UL }},
+  {{ 0x16303f114dbc348cUL, 0xd9117cf9ebba297fUL, 0xcf8002ade4b3d67fUL, 0x0bf55bb81aa5862aUL }},
+  {{ 0xfc9926771bf31c67UL, 0xd165d0339741778aUL, 0xa9bb96d5d7f314eeUL, 0x039a2848412d3e51UL }},
+  {{ 0xb622d21971efcadaUL, 0xbfa59e318f07f4cbUL, 0xf551a400ced54121UL, 0x2f225ebe738fd44aUL }},
+  {{ 0x846dba88e639a470UL, 0xce9a420fcddf7d86UL, 0x4a6c37d9e65c6d70UL, 0x165dcd650c31760eUL }},
+  {{ 0x8692b2b556ac1197UL, 0xb6b2b5d5b409e047UL, 0xc2d1048de1d2b24fUL, 0x21212652245277f2UL }},
+  {{ 0x5e8b6e88576a8e7cUL, 0x74ba1d3e0ea3f242UL, 0xd00f55ed6a0f60b6UL, 0x2dd77fa60c6bcc6bUL }},
+  {{ 0xa3e0d70675f5a756UL, 0xbe726d72570628a2UL, 0xff17cdb00bf654cfUL, 0x16aa7bd9b08ab8beUL }},
+  {{ 0x81b1b2495fba7724UL, 0xfadc75a483313058UL, 0xe407cd27413a3a01UL, 0x128bb8cf48c07d37UL }},
+  {{ 0xf0c88645a6613c7cUL, 0x004962e560f47b81UL, 0x663d9cbd92bbed7fUL, 0x09d5748c6e8ce64aUL }},
+  {{ 0x4014740cd582e07bUL, 0x96ac206fd5b04f3cUL, 0x11169550e852fb13UL, 0x25526ff83d1c2b22UL }},
+  {{ 0x0740a89f0a4b6fc0UL, 0xa9ab92c87b3d0a58UL, 0xd9ccf64e80a941c6UL, 0x222bccc922ebae2bUL }},
+  {{ 0x4f1dd43452ae2dedUL, 0x59f7f44924cac5e0UL, 0xe6bc8e95ddb8748bUL, 0x0771d802cd7a858cUL }},
+  {{ 0x7673d0af9b80ed2aUL, 0x14308d25e693f4e0UL, 0x096c5fbbfd0e7f8cUL, 0x0c197d1b4bc854c6UL }},
+  {{ 0x3af887a77d1f2d63UL, 0xefa7b30889215160UL, 0x999a270da24e1ca1UL, 0x0e0e5452bffbdb09UL }},
+  {{ 0xe3de08d3a3d70d65UL, 0x2a29d443c40ab416UL, 0x0a0900ec06c1c92bUL, 0x1290aa4e1aa4850cUL }},
+  {{ 0x07bb16d83f7cc02cUL, 0x0fd983cbefcacb99UL, 0x619c65c5ba4b1cd5UL, 0x0bd1502578be54c7UL }},
+  {{ 0xfc7d550228d7946aUL, 0x1584ae094fe97876UL, 0x333cdc2c12a3bb9cUL, 0x2eac9c20d1c5c982UL }},
+  {{ 0xe8a3fa35fce80ca6UL, 0x920d1d45b11e017dUL, 0x9a588bcacb1c290fUL, 0x1b1002c8d6dbb210UL }},
+  {{ 0xededf131dc7606dcUL, 0x50187d69e3fc1702UL, 0x3fc5d363b4cc47ceUL, 0x0a2b5c8dd12d578bUL }},
+  {{ 0x128635fafb44da34UL, 0x1c9cffa122d8791eUL, 0xae6fdb98cdcd84e0UL, 0x1d51eafae880249fUL }},
+  {{ 0x103af6dc560068a5UL, 0x0064895fee71537dUL, 0x8e741f4dca8be343UL, 0x07d77b34c89986ddUL }},
+  {{ 0x79dda1ac698a3070UL, 0xf872642863bd2acdUL, 0x09f13ab20f30fb37UL, 0x303890c8762bc959UL }},
+  {{ 0xa15aa91e352a82eeUL, 0x55d23e7414e90c0bUL, 0xaa48e3b487d62f66UL, 0x2f1ca54a9ef35245UL }},
+  {{ 0xf0b2ab0be33f3f82UL, 0x40a4dd1f110af669UL, 0x1002994e0aa6878bUL, 0x1fda2a496cf27c4aUL }},
+  {{ 0xe3b699733f2df159UL, 0x27560485d5f20207UL, 0x27aef4a0aa7e0782UL, 0x26c60630a267a257UL }},
+  {{ 0x5ff2f174b89f34c2UL, 0x88e58153f83a3a6aUL, 0x086667e3e6df1f38UL, 0x214abff5ac11f473UL }},
+  {{ 0x7aa04291eb6ad5afUL, 0x30b564783d2dd3edUL, 0x423444641ab124acUL, 0x25c10e5850fb5be6UL }},
+  {{ 0x171b7f8d84ee2cd5UL, 0x45e0d2e9fb3ab93dUL, 0xa9e7f4c1be01eec6UL, 0x165d9103bf7393f0UL }},
+  {{ 0xb96b856dca8b4e66UL, 0x01a84a73d4c7974aUL, 0xce7dbaaa84c22b2bUL, 0x009731117bf58661UL }},
+  {{ 0xe08a3405f5d07170UL, 0xb50acad59a75d210UL, 0x1de6bc641f1e850cUL, 0x2dd9b85f969e8d19UL }},
+  {{ 0x7f2d5fd41a1a22f2UL, 0x449124b656df4aa1UL, 0x779a78704ef0caafUL, 0x2cf012e850ffbc65UL }},
+  {{ 0x06ec1014f1ab363fUL, 0x77a433eec391778aUL, 0xf5f64719c7dc30d7UL, 0x0cf1ddd3ecefb1daUL }},
+  {{ 0x4ac03a56ea9d802eUL, 0xa37e87dd4a540d4dUL, 0xb87309ac3c722585UL, 0x22d8548fa17b290aUL }},
+  {{ 0x5ad539a20ad343afUL, 0xcfa75f4615b8df03UL, 0x77529563d3fbb74eUL, 0x11eb63cb243754c2UL }},
+  {{ 0x2ded37be1fee523aUL, 0x40acc26c28af1f98UL, 0x3ef0fbe137b2e459UL, 0x252b318d26248256UL }},
+  {{ 0xd5e754451f1138d9UL, 0x1ab7237b2c6b35f8UL, 0x439620a6336add76UL, 0x06e67392922cc115UL }},
+  {{ 0xa6849c8285cf1f81UL, 0xda0b177af3c39933UL, 0x0f1969b505527f55UL, 0x1568e7e9fbe529deUL }},
+  {{ 0xb775df8e922d1bf5UL, 0x1810284a65475d50UL, 0xef78dcaa4df0874dUL, 0x10ca3e02218b4689UL }},
+  {{ 0xacd8a65b68fa76a0UL, 0x049ba43f0563e87eUL, 0xb4ed07860bb34b69UL, 0x2d1ed7a62e9d9f2fUL }},
+  {{ 0x078a59c511bd7c13UL, 0x857612f5dfc32b7eUL, 0x258870fb4a19bd99UL, 0x278f0ecf51bc570dUL }},
+  {{ 0xbb3df6901c04bee7UL, 0x8bb2de5aa2311a58UL, 0x8a7a73c1eff6a7f1UL, 0x2cc296c338ab9c9cUL }},
+  {{ 0x3a4974bb25c8bfd9UL, 0x53043bd3d0280f41UL, 0xc24c49006bf1ec58UL, 0x0e4062bcd577e68fUL }},
+  {{ 0x0ed0e35fafb8d6efUL, 0xbbd8299e771dcf5fUL, 0x9c1ee7b04e79aa51UL, 0x28a16aa9e7c86209UL }},
+  {{ 0x043a40ecd3fc8cc0UL, 0xa46aceb76e868700UL, 0x81146a83f2c92d5aUL, 0x0cc69fc35bc4a50dUL }},
+  {{ 0x3fd640b81c4b9d42UL, 0x94fefa09eb516a30UL, 0x1782209400fcedeaUL, 0x0df7245c0f072bd9UL }},
+  {{ 0x000663e99a7a4061UL, 0x68a260fb7991a637UL, 0x381d8d88db78cb58UL, 0x28e7ca5a3e136d15UL }},
+  {{ 0xed4b6f38eeeffae6UL, 0xd8cd0a7b3521ba4dUL, 0x76a38303088871bbUL, 0x1ae7292e736931dcUL }},
+  {{ 0x311f234d23667c9aUL, 0xb48a324000232ab4UL, 0xeb00aa901bb09c9eUL, 0x13870f90a791b184UL }},
+  {{ 0x9f992b482a28d8b1UL, 0x4fe93a70af49537dUL, 0xe11ce322e8e44cfeUL, 0x117ab2671237e974UL }},
+  {{ 0x21593d6b9aaa2c83UL, 0xd8bb02a756c3363dUL, 0x1ec88e15ab1b62c8UL, 0x01d3b94afe96d8a6UL }},
+  {{ 0x31e552c5650b81dbUL, 0x1a056dbe240b3027UL, 0xf4bc5246ee613608UL, 0x22b572966309a1ccUL }},
+  {{ 0x00585bcab74468bcUL, 0xede6d007da17de0bUL, 0xc1a736609cbb28ffUL, 0x013e80e4bde075cfUL }},
+  {{ 0x5a7d05b43e4c6c02UL, 0x5c04baf06c8222a2UL, 0xc935e0b7b3981b58UL, 0x149a451b1606939cUL }},
+  {{ 0x9503faf9da57357fUL, 0xa0118e10bcc74d8dUL, 0xe71cde657e5e75a1UL, 0x1a97d2bc3ba8b0bfUL }},
+  {{ 0x447b39ad23a5b1a1UL, 0xa3742bd3b2e305d2UL, 0x816f5cd595b8198aUL, 0x00ccfdda024879b8UL }},
+  {{ 0xc4c0d371e3e9a866UL, 0xd91c43e598b626eeUL, 0x09a5ae619e3931d2UL, 0x209919e39e5ad5a1UL }},
+  {{ 0x7b0b3cc2ac0dddbaUL, 0xf5d7c0062ddcf2c9UL, 0xfceaf8318718ff5dUL, 0x25ec66821efc529bUL }},
+  {{ 0x569eca1e93174241UL, 0x5371e8227e462c07UL, 0x674cade026b19be8UL, 0x177f9eddfb269187UL }},
+  {{ 0x485622c51c21a075UL, 0x8b17a8b193df6029UL, 0x4ce7bb04739acbd3UL, 0x09fdb275ca2aab34UL }},
+  {{ 0x4f90752c7c593ad5UL, 0xbc4cc28bc36af37aUL, 0xc8acd005f3e38dd4UL, 0x2f1d89d693f47a86UL }},
+  {{ 0x5002ea9dae0d395fUL, 0x0a4e12a9d94d5450UL, 0x027e473d3417a16fUL, 0x1fefdf8b1b8cdf94UL }},
+  {{ 0x005063fae14e22eaUL, 0x0fe32b4f80a4c1a6UL, 0x39e04bed3508c93eUL, 0x2d3e49d2d5414138UL }},
+  {{ 0xe8c6d98ea0fde024UL, 0x413dd1391fc8965eUL, 0x20c71a5152638000UL, 0x02c90e3952ae8e2bUL }},
+  {{ 0xe8fec068162a98c7UL, 0x794b71225c49f12cUL, 0x323329aac80c38fcUL, 0x2ec39c53c50af2d0UL }},
+  {{ 0x21d0ac2d9d5228d1UL, 0xe3831744112996e9UL, 0x453af13ae52b5d34UL, 0x2dc81d1dd6168171UL }},
+  {{ 0x2f9603f7c54066b4UL, 0xf1b97d69fecfe2b4UL, 0x248286b67ea24602UL, 0x0a8164d74812e45fUL }},
+  {{ 0x0f0120093056314dUL, 0x162df9ee1105e29cUL, 0xdf1d96dafbe3b286UL, 0x2e0dfa81d5bec5d4UL }},
+  {{ 0xfb1931f1d37a89b3UL, 0xc7d858a5908932adUL, 0x2540f663e36d0dcbUL, 0x18620335ec4e2f3aUL }},
+  {{ 0xea6169dc42fa2252UL, 0xf6a08e15a9742ae3UL, 0x355b0bfc085ba5afUL, 0x0d118bcd1d1fbbcbUL }},
+  {{ 0xcc7471981c237251UL, 0x9aa2a38624a1a0d8UL, 0x29af15f45749de3eUL, 0x0d44ba94c2596da1UL }},
+  {{ 0x8a28bcef9c32ffdcUL, 0xbb13b698aa6af22bUL, 0x041be70979cdca2cUL, 0x1607b1f4f008b006UL }},
+  {{ 0xd0bc062cab73d3f1UL, 0x2d37834ee314886fUL, 0xedfb9d06715fd3a1UL, 0x1ea64cdc9234dc3eUL }},
+  {{ 0x3c9dc62f2ba0c429UL, 0x093e063a3d5c66bcUL, 0x2e507be2fb29b5c6UL, 0x155520e31638d4a8UL }},
+  {{ 0xf85a648269d9ec25UL, 0x3a15e2a2b7b3bc05UL, 0xc30ab76eb1ea7f20UL, 0x033ffbd4f27850e8UL }},
+  {{ 0x94884acc5f51e3bcUL, 0xc8334b1d0502a106UL, 0x8684b172fd56fd47UL, 0x14ddaf43b15eeb6bUL }},
+  {{ 0xdaeb76bfe0ec414dUL, 0x267b221ea3d606a2UL, 0xa8f3161dd88d001dUL, 0x18c4179c402a4d0fUL }},
+  {{ 0xbca149bfdb0b4fc1UL, 0x0350bb9eaca90928UL, 0x29753db0edf9185dUL, 0x0a7d93572ae38fdaUL }},
+  {{ 0xb88cc8b12a989021UL, 0xafd15b21f6e4fc12UL, 0x5b713752c9e2501cUL, 0x28bd4b96bbf8ee62UL }},
+  {{ 0x5639ad50ae38f1b9UL, 0x8fe74e35043432fcUL, 0xfb32ea7edfed4155UL, 0x059061b1222d0977UL }},
+  {{ 0xd76396eae397f0ceUL, 0x19ae313a5d4cff43UL, 0xf8616bf3eff23b3cUL, 0x1ea6840b4b5b0cc4UL }},
+  {{ 0xf5cc5b3c68bf51a2UL, 0x5d9493c20ee1286aUL, 0xb22e83d111586bf4UL, 0x0f0ecb1b6a45c7e8UL }},
+  {{ 0xc2b6f32f643fd997UL, 0x43df2c7a28fb88f6UL, 0x9b5fb4a7473ad881UL, 0x0d1e85e45f65c460UL }},
+  {{ 0x751cf2df28774d30UL, 0x1663a72415a159a4UL, 0xf222485a091f2d1bUL, 0x065959a163643798UL }},
+  {{ 0xde06d5a623c39460UL, 0xc869d1c300c93a1cUL, 0x174f3c282bacc26eUL, 0x2536ebb273367a8aUL }},
+  {{ 0xeb8312268e02b892UL, 0xca5b54aa33c6315dUL, 0x1336bea3f04d819aUL, 0x0c49e3174bd8179eUL }},
+  {{ 0xe20f9114d872df14UL, 0x3c76671f7e1d4efdUL, 0xd46ea9183fa5c87bUL, 0x2031de796c011155UL }},
+  {{ 0xf5438b617cbfd46eUL, 0xdc33bad0196ca937UL, 0xb3d87b57193ed66dUL, 0x028ef92edb9d026eUL }},
+  {{ 0xd212a881adf15cd6UL, 0xd76e3af001a65700UL, 0x3f8eca48013ec96bUL, 0x18237ab4b68d441aUL }},
+  {{ 0x36747eeb7b28be68UL, 0x255da0d7f5ef2aacUL, 0x87e8aea54c2eeef9UL, 0x0e691ff74ce6b9c4UL }},
+  {{ 0x793d917f67de45ebUL, 0xbecd27f3d87a8adaUL, 0x2c4b3905231b8f54UL, 0x08837185fbd76794UL }},
+  {{ 0xfbaa7bdcf81b55c4UL, 0x05322904845d45c0UL, 0x9a2eeb3450aad710UL, 0x19e5db3588aaee91UL }},
+  {{ 0x2f8bcc3bf5fd22d8UL, 0x8a767f1c297092a2UL, 0x6522ab7178fd0cffUL, 0x22c378d5436a817dUL }},
+  {{ 0x9603c51dd5657619UL, 0xea6bad6851461e39UL, 0x05afcb55b2340e89UL, 0x1c3a81e122d86060UL }},
+  {{ 0x4ea46765d995e710UL, 0x0cb463dc6ba8096cUL, 0xdd4ad8320d827cd4UL, 0x1b62db516fc95fc3UL }},
+  {{ 0x5406f042683f5ce3UL, 0x4c2dbb3659d62586UL, 0x6c1732cebb56b305UL, 0x18edd1f7885e52e2UL }},
+  {{ 0x26b623daa7268b10UL, 0x5954901d56c2a2cbUL, 0x31d9555d3fa3f378UL, 0x12241f2aad5c071eUL }},
+  {{ 0x5d6b307668493638UL, 0x33cbd08562342c04UL, 0xa545fa08f04b11f5UL, 0x0ab6d59676fad3cdUL }},
+  {{ 0x623ce369ff716218UL, 0x7081a93e5f93126fUL, 0xd73c531e8a187c81UL, 0x08c0aa36803e40faUL }},
+  {{ 0xfadecd5055ff408dUL, 0x0fda49dfd9aa3780UL, 0xb92d92ecfe364065UL, 0x2bc5bd58aaad02d2UL }},
+  {{ 0x83c1b9c3687da909UL, 0x04def1d47161b156UL, 0x6ebb0f6026dd862bUL, 0x1d5681899f8c2f15UL }},
+  {{ 0xa1b4c1a5ef03988aUL, 0x41b7a9512e1d13b8UL, 0x58abe6205ee341ddUL, 0x15fc432514efdbc9UL }},
+  {{ 0x6635bc4453a463afUL, 0x889f1c023b2e83b4UL, 0x4d7209a0e3cc8bb6UL, 0x018e40bfc4ab0718UL }},
+  {{ 0x043e33c17b254273UL, 0x06236b59a230e3f1UL, 0xea0532faca717c37UL, 0x0fc4512f90e14356UL }},
+  {{ 0x587fcd22b336d8fdUL, 0xd59f994db4866d6fUL, 0xbb8ad77b22a8ffe1UL, 0x095800dc370e6b6dUL }},
+  {{ 0x8bc943e9da425ff8UL, 0xee30aafdfb30c6ffUL, 0xb0c0bd7ea60d9224UL, 0x0574b0495bf14c88UL }},
+  {{ 0x2f562b391a4e8620UL, 0xea99b60cb39d9cebUL, 0x9b6267325608902eUL, 0x09bf75f6474b766cUL }},
+  {{ 0xacd0e5dfcbbfd861UL, 0x02a20bfe37873ffdUL, 0x79688efc24afa84dUL, 0x2152eb08ba93b454UL }},
+  {{ 0x845b68d3c5308647UL, 0xb489e0da7d466476UL, 0x3d00aca8db9176f3UL, 0x1187901a8f9e1070UL }},
+  {{ 0x9eb6fdc7a5b31fa5UL, 0xfe4bd582353e4859UL, 0x4e635c28762dd1eaUL, 0x18a658472f10f4ceUL }},
+  {{ 0x1f37e2d59202fef0UL, 0xd9f1343541a0e348UL, 0x30ec8730f40b442cUL, 0x02e1e8ae280d00e3UL }},
+  {{ 0xaa8b89d8e18421d9UL, 0xfd4452557bb273cfUL, 0xb5c59007133cb739UL, 0x0253b6ca330e52b8UL }},
+  {{ 0x655152bb88cfc480UL, 0x922b0d225e1f6536UL, 0xad01ac27b5f13274UL, 0x04db7d3761d14f5aUL }},
+  {{ 0xf2d88cee5661fdbcUL, 0x652c4a29707ebc98UL, 0x3832ae5a1c8f8842UL, 0x27fe1af5b0910c01UL }},
+  {{ 0x8a9a1f85cff51415UL, 0x285f3dad5060d402UL, 0xddbbe8b8429cc0f4UL, 0x21f4d0e5d111dccfUL }},
+  {{ 0xb6dcaae05e30a2eaUL, 0x1245fc6d28bd9e8fUL, 0xb7930bd6abb83fc5UL, 0x00cf4c2a7b20abfcUL }},
+  {{ 0xb736a9564295d887UL, 0xcbcb99668f8c9cdaUL, 0x4f6c339a2dfffa57UL, 0x0799cddcef0ae80bUL }},
+  {{ 0x88c61688d89253eeUL, 0x4994f8bd0327ffeeUL, 0x29cd0591153cfd01UL, 0x14f21e1b4ffa14cfUL }},
+  {{ 0xc0da92678ab2d475UL, 0x93eff9eeba268a32UL, 0xce5b0a25090ac979UL, 0x07dca652ea22bb5bUL }},
+  {{ 0x23f32fcb654d8529UL, 0x902e538d0964af94UL, 0x62533d456c89dd56UL, 0x28d6002bed0108e4UL }},
+  {{ 0x796547571e5becbfUL, 0xee605a58eea861d2UL, 0xb75686c1dc232c74UL, 0x20b9a7db4f79be94UL }},
+  {{ 0x6c5d574d3241cce1UL, 0xf4ff57be69788500UL, 0x90bc551b1f18c624UL, 0x282e05d73e225ee5UL }},
+  {{ 0xfc1804b7f4b5d4f7UL, 0xadea519384ce2dfdUL, 0xfe7a918ce15a7667UL, 0x100969de44fb5abfUL }},
+  {{ 0x6b8d3a8008d48042UL, 0x0732bd0543531b6aUL, 0x0a2616c79aad93e6UL, 0x07b7fbddc3039b9eUL }},
+  {{ 0xefa37f23e42a0ca6UL, 0xa739b49099fd489bUL, 0xa2de7c3ac5497253UL, 0x244b89d7c4237683UL }},
+  {{ 0x5f860c45a335725dUL, 0x792a35118a0d037eUL, 0xb8f6ea4d61b03928UL, 0x2c1fa4d1af130125UL }},
+  {{ 0xb38791e061e5e710UL, 0x18248e0b010652afUL, 0xd1ee9d08592f580fUL, 0x13dae509da34d54dUL }},
+  {{ 0x5f56153898f5b41fUL, 0xa63b4c7578dce489UL, 0x2599c336f77d1afaUL, 0x26856b51e73a1b9bUL }},
+  {{ 0x0af0e32511a4555bUL, 0x06a59a2d97b00cb3UL, 0x822223b2cd719989UL, 0x2850e6a483a749f2UL }},
+  {{ 0xfee51a1d8bbd7a27UL, 0xc4ae7c249f78bbf5UL, 0x754c8afa1592c11fUL, 0x0edf0b8f3007723aUL }},
+  {{ 0x9877b8408aa5d57eUL, 0xa98e8d40c51a277fUL, 0x61f3f325dc813421UL, 0x2eec759e0227174eUL }},
+  {{ 0x46c9a5541b6e4d07UL, 0x2d329e0a7a42944fUL, 0x48cf54c90c47c2a0UL, 0x0877650f6eb357a8UL }},
+  {{ 0xfe429045b83367e8UL, 0xf6fefcc17eab6eddUL, 0x359268bcadd27231UL, 0x276a1a9bceaa80b1UL }},
+  {{ 0xa6a3788246538294UL, 0x7877f8b3e5b0675cUL, 0xfc7e1d24a815ef6cUL, 0x0ec67f0198c3fc72UL }},
+  {{ 0x40e7d553ead9a892UL, 0x2f425edd9f9eaa6bUL, 0xa9db997b948814abUL, 0x0cd222910ef8a3e0UL }},
+  {{ 0x3496a8eaa4b0209bUL, 0x55ea2cd29f752d2eUL, 0x642715c9ec0fad73UL, 0x15fc2006e9966ae3UL }},
+  {{ 0x2fe46d888fd96595UL, 0x98d289cb6fc6ccd4UL, 0x72baf5738fa1cf04UL, 0x233c75efe91709c1UL }},
+  {{ 0x987898e54fced68bUL, 0xb0b8a66fc39fe934UL, 0x986b6901d674b79eUL, 0x0efa47aa3347cd60UL }},
+  {{ 0x5b314b9ee9fd9384UL, 0xae69ea85323b2d5eUL, 0xb4cbef7d253ca975UL, 0x1c7f850ef640821bUL }},
+  {{ 0x4524aff4f32e96f6UL, 0x3a8704be820a3df4UL, 0x23e4394a931cf0cdUL, 0x19ae72243295ace4UL }},
+  {{ 0x58c0db4a6447de0bUL, 0xf2d8a25341226514UL, 0x25ab3fadbc376c44UL, 0x25e9fbd8fc8d03fbUL }},
+  {{ 0x1ef1b3bb660fd8ccUL, 0xebb655ae310d04d0UL, 0xe7c986e3577a61c8UL, 0x1565c50b05b7382aUL }},
+  {{ 0xd6c3b1defee1264eUL, 0xf115030d47a1362fUL, 0x3a9d8e8044c1da66UL, 0x27ba367ff3000edbUL }},
+  {{ 0x48ccd05a40d38206UL, 0xca849cfdd9b44398UL, 0xccc00163ba8f1580UL, 0x1390b89a14157c8cUL }},
+  {{ 0x3663bc85ab9b4c4dUL, 0x140b590532236cd1UL, 0x82d0cbfeb4fe36f5UL, 0x2e5496e7e4dcc5deUL }},
+  {{ 0x725749955e9d2e7cUL, 0x3b221ce0a47d97fbUL, 0x7b849f2dfd348192UL, 0x05384965967126e4UL }},
+  {{ 0xe4914e96e8be9ed2UL, 0x53b40a9a3d79c4daUL, 0xa7b3ec9d305214ecUL, 0x15fb54d5a79e3117UL }},
+  {{ 0x0b6f6f224da003c8UL, 0x132fa489ed324234UL, 0xc258d11a99f9cd94UL, 0x29b8500bcb392b00UL }},
+  {{ 0x6cd8f26fc5a85480UL, 0xdb72bb7c4599e994UL, 0xfa3d92e1fcb23761UL, 0x2b4ec4f247017253UL }},
+  {{ 0xe65cdf8d28670e8dUL, 0xc5484c7dcf7b56e7UL, 0x5f1217b4d82f398bUL, 0x251b77876eb9431dUL }},
+  {{ 0x586fdc6122984605UL, 0xe88fc85ee664c429UL, 0xd1816ecb64314398UL, 0x1153fd1cf4d1aef5UL }},
+  {{ 0x5427a9c1cc491ac8UL, 0xa48834582b733a48UL, 0x22cbb38a95bfd4b7UL, 0x1ac69e518f01f46dUL }},
+  {{ 0x80faa88769b79ca2UL, 0x1306a6c070fdbcf9UL, 0xdf94f666d172330cUL, 0x1f6b8aeb614ead33UL }},
+  {{ 0x460a434ffbc9aa16UL, 0xe677da6bb0d4fbd7UL, 0xb6c25225f4ef87e9UL, 0x0c347c07e50165b1UL }},
+  {{ 0xf7b2bdfdb4de222fUL, 0xf288f23ecde20887UL, 0x36fefe95af0e0918UL, 0x245b0adcb916344fUL }},
+  {{ 0x2ed9915e05d4ab11UL, 0x8337b76855f62c0aUL, 0xfc0be59e3e7b3d2aUL, 0x0bf0b7b416ee9d6aUL }},
+  {{ 0x9d64a3eccf938eecUL, 0xcfcd18e6796717e5UL, 0x8ac639b9cfc676a3UL, 0x29d18cb8140cbb91UL }},
+  {{ 0xe564d910b579b46bUL, 0x66fe274af53b0873UL, 0x95ee328ffda36e99UL, 0x2e01d29489dfdbc1UL }},
+  {{ 0xe90d21029f65c915UL, 0x341ad4b6a58c195fUL, 0xb099c1fa0d5bdfa3UL, 0x2005120bd5943b6eUL }},
+  {{ 0xbdad7283e39e68b6UL, 0xd84474f5d3ca343aUL, 0xd76fb9fc208c7985UL, 0x08803685bdd89ab4UL }},
+  {{ 0x8fedc904b4b1fba3UL, 0xeae9f56cc03c3c63UL, 0x618df9f29d76482aUL, 0x212fcc65f9fb7d13UL }},
+  {{ 0xa21b090723b60a06UL, 0xa536074a573543e0UL, 0x2eb45a325730b5dcUL, 0x085f4df3f5afd5e0UL }},
+  {{ 0x1450611adc1974c2UL, 0xd7a5280e1a07fae3UL, 0xfa72070b63423687UL, 0x26df9c4de35bc282UL }},
+  {{ 0x8ea3e37a7ad111b1UL, 0xcf443bda9ac33adcUL, 0xe08fa99fc24fbd0cUL, 0x1ed666d74b58fa9dUL }},
+  {{ 0x5344909ab978e027UL, 0xed9dcb7c511dd446UL, 0xec6bb7c7143492e5UL, 0x2fca0c0ee6d3d8f4UL }},
+  {{ 0xd6364288704590ccUL, 0xae5fd971db1d01f4UL, 0x2fb261a079e33901UL, 0x1f5ed2a118c02e97UL }},
+  {{ 0xdc837e4b50cac7b5UL, 0x3e918e089707e16eUL, 0x2b199a82db4221e4UL, 0x05360ce495bd1f9aUL }},
+  {{ 0xb28151afa7b3886bUL, 0x7a90972656c2db00UL, 0x548f4a2fd32b3c2bUL, 0x186e8fbe14d692eeUL }},
+  {{ 0x4f75c5e33b2ece56UL, 0xce2da160bc20a13dUL, 0xa36ee657bf2f6485UL, 0x19be32bba21db8aeUL }},
+  {{ 0x6bb8c796ed46b044UL, 0x8e3fd8532b68f8fbUL, 0xabc746376478d8b5UL, 0x0a7aba9980321a9aUL }},
+  {{ 0x76d8475b1ce07a1dUL, 0xb45ae7ea3143a9ceUL, 0x7f48d8b16cb80147UL, 0x116cd2932195fe0bUL }},
+  {{ 0xa01fd9644b02de21UL, 0xb37648764848bf69UL, 0x4fcb80c966acf45fUL, 0x19423a591149cc30UL }},
+  {{ 0xbd562fe2638916baUL, 0xe2e30fdbc036ca21UL, 0x851a179db15f166cUL, 0x20e2adf2d5fbbec5UL }},
+  {{ 0xd03c806746a29886UL, 0x97261915cd4d06c7UL, 0xff064edceab1225dUL, 0x281695a5ef68896cUL }},
+  {{ 0x448111fe25300fb6UL, 0xd7f62b472a7c5ffaUL, 0x104905e404522c40UL, 0x0f993e7fa0b98ec4UL }},
+  {{ 0xc70ead753d7c51d6UL, 0xea163ac21f1e8758UL, 0xc5c861252eea7e06UL, 0x10a0ad4330a89a0bUL }},
+  {{ 0xc13fad2daf6ae876UL, 0xb0adc061491fd288UL, 0x91dc2ba7a40be968UL, 0x2e13ca97520d5cacUL }},
+  {{ 0x19ef42003440116dUL, 0xa7c0985342f5943cUL, 0x6d6139582f04dba0UL, 0x2f3b2543f6a9dc99UL }},
+  {{ 0xbc968863a757c4ccUL, 0x28d9d5f03a0cc9ccUL, 0x4bc890c257d096ccUL, 0x0d237f97e2d0bf8fUL }},
+  {{ 0x521067c3306e3bbbUL, 0x879086a1f0c17f1aUL, 0x68d91f66a3c2b626UL, 0x0b854c13c61840f4UL }},
+  {{ 0x0585d8e1a9f15e62UL, 0xbabd5ef7a6321651UL, 0x103fca6c8e490b61UL, 0x04c734c0e6809bdfUL }},
+  {{ 0xdc74817c7cede367UL, 0xcd5b769998c01bc1UL, 0xdc25ca21b524231eUL, 0x09c90e27cf8e1279UL }},
+  {{ 0x450c7b10972615bdUL, 0x9a1a345c53dd5749UL, 0x5675730c47ebef0fUL, 0x2d20bf895cd8e4d2UL }},
+  {{ 0x197411c2a1e62d88UL, 0x86a3eee28809b7e5UL, 0x1252adcf83895d54UL, 0x278431b497aff011UL }},
+  {{ 0xe454e891d27be324UL, 0x672d88b9d56d09dfUL, 0x62caccd9198ab2c6UL, 0x133a42a48e1e0beeUL }},
+  {{ 0x998d56d9010bcb6fUL, 0x2351cfd902fdb3c5UL, 0x5f822112825e6699UL, 0x138617bd07997da6UL }},
+  {{ 0x31d476a1a03905c3UL, 0x1247470c5b756cd1UL, 0x5053416c9f1553ccUL, 0x1195cc2173ba5600UL }},
+  {{ 0x9baf5662338cf8a4UL, 0xc5267eebc6ff0702UL, 0x8d5a2bc16868dff4UL, 0x267b20dcdb83b73bUL }},
+  {{ 0x43497cac40843601UL, 0x587f4faa00ab367eUL, 0x9c8323f06b4460b8UL, 0x2df10a456153a045UL }},
+  {{ 0x40f114797b351909UL, 0x15e6634977498319UL, 0x96e809dab866e83aUL, 0x0bdb61b36fe2e015UL }},
+  {{ 0x447e8b1e7f90d72bUL, 0xf0712b3a1766e702UL, 0xfc110742a04d1c00UL, 0x0fdde8ba44883516UL }},
+  {{ 0x2d6f74a5015a0618UL, 0xf699d533d45f48c3UL, 0x632cb67b0089573dUL, 0x2aa4103ce054cfe6UL }},
+  {{ 0x1e176950b2771747UL, 0x7d435cf829a04684UL, 0xa79e80bce8dc5228UL, 0x2471066f893afcf3UL }},
+  {{ 0x7d2ce6f8c413b3a1UL, 0xb867568c0f6dbca5UL, 0xfb92afc369795c96UL, 0x1da371c6c52ba6dfUL }},
+  {{ 0xd267f7598786ff8fUL, 0x3b8144e4561f5ab1UL, 0xd515ba08bf00a528UL, 0x00cb385a1dfa5af3UL }},
+  {{ 0x747c94ec5c073ee0UL, 0x9e71bc955be76145UL, 0x53fc807b72692a06UL, 0x12deb4fcc299db88UL }},
+  {{ 0x3cd1a18318b19608UL, 0xc85cc63842f71729UL, 0x841253519d4bce26UL, 0x23c2006753c3522eUL }},
+  {{ 0xfd3d31d41fc44aa2UL, 0xe55f7e1b2f3175a6UL, 0x723b35ac9dd3baa2UL, 0x015c8e07d7d9ec65UL }},
+  {{ 0xeb55eb877c9e9494UL, 0xaf0ba7e88bf418a4UL, 0x972a0eab1f8811d3UL, 0x0aafe708612f6acbUL }},
+  {{ 0x7371e8f90c09cacaUL, 0xf3c1a9cc388bc381UL, 0x88158dfefa0263b5UL, 0x1893cb4d66a7a1f4UL }},
+  {{ 0x28b31da745a35176UL, 0xd337f7bf2b4ccfd4UL, 0xec930d7cc69e1ebbUL, 0x1e6772c7f7c4682eUL }},
+  {{ 0x733101758d6fe482UL, 0xe67ca1a3e9d681e1UL, 0x585bdbbcdfffaec4UL, 0x2f4cb6155ac1ae99UL }},
+  {{ 0x86cc8136eed5f9ecUL, 0x78dc7dbd42698ab5UL, 0xf699e90c96b60884UL, 0x2df00414e02c3281UL }},
+  {{ 0x44df753561441b99UL, 0x1656250a9eb51917UL, 0x3fe27f95a54ab25cUL, 0x0b7d94db461be1aeUL }},
+  {{ 0x421afc442f55cc8eUL, 0x0b8b55877ad059c6UL, 0x532920fbf6ecded3UL, 0x17619f692d9bf7b8UL }},
+  {{ 0xdddceede29cd4e13UL, 0x008166fe2bef3241UL, 0x09bfd5e10ec2395eUL, 0x12066d57f44cde33UL }},
+  {{ 0xcaf34dece7718112UL, 0x124eb824135d0f7fUL, 0xc5dc4ad0ba348a55UL, 0x27d23b5967fadceaUL }},
+  {{ 0xcdc224b4080ec1a3UL, 0x74007ffeb41aeb57UL, 0x37dd1f1c31e76769UL, 0x05519adb4b1efa63UL }},
+  {{ 0x96b1974fbf27374bUL, 0x00382b385fe73ce4UL, 0xfb09d60c60c39ae7UL, 0x129798025c50daffUL }},
+  {{ 0x00375bc0ca01832cUL, 0x9ee9a30d8a22ab02UL, 0xf2b15eefb95a6a52UL, 0x2e3e5c2562a0215aUL }},
+  {{ 0xab34dc2e59427c34UL, 0x77b5fb339f1b317aUL, 0x22b89b5a264d6e88UL, 0x2d32ec13301b03b9UL }},
+  {{ 0xdd6c809de4f5134fUL, 0xebbd2f7168fdc865UL, 0x18683e0e792cb507UL, 0x01c0a46cd9ecf1e4UL }},
+  {{ 0x4f7cac0810308920UL, 0x713fb9e573dd7c25UL, 0x9c545623fd4e804eUL, 0x09cc8b305cc005abUL }},
+  {{ 0xbe41412e7667caecUL, 0xf25ed5fbbfa74be8UL, 0x66c97a592ef92f4aUL, 0x0ffc0a5f921fe450UL }},
+  {{ 0x0c396f71ca044dffUL, 0x9c1d7c29246409e6UL, 0x2f88684cfb44abd3UL, 0x0cd63247ad734aa9UL }},
+  {{ 0x39abcb2637268893UL, 0x51b103c1d3f94555UL, 0x770b61e08ea8067aUL, 0x2040930292c5dbceUL }},
+  {{ 0x6d6a09d6bda1707fUL, 0x76ffe534128d982bUL, 0x30f916de5655cda7UL, 0x0b96c7c574e857b1UL }},
+  {{ 0x697b0c9ac92f815cUL, 0x0ccb878aa75e5f8dUL, 0x151dc08fbed63fe3UL, 0x03283a75cd201076UL }},
+  {{ 0xd026313cf3a3576aUL, 0xa2500c61ca939170UL, 0xfb837c32ffea86d0UL, 0x1f4d663148622ce5UL }},
+  {{ 0x1f857ef511b36649UL, 0xa55884125a6f3aadUL, 0xdbd7c2ef430e9c67UL, 0x3025d145937d8fd5UL }},
+  {{ 0x5f7de48d18bde89aUL, 0xa411c91833922a47UL, 0x50720caa362d1336UL, 0x0fa5a0c4f5bb9e9eUL }},
+  {{ 0x27144293c446187aUL, 0xc0e8fe9974c1fa47UL, 0xcbd59ff69052b6a1UL, 0x1961abf1cab6d63eUL }},
+  {{ 0x892851e8e105102bUL, 0xc23b3bb3ac083e1bUL, 0x24a174a0f0ba4e66UL, 0x301a6dc5621f9847UL }},
+  {{ 0x74355968a978e100UL, 0xefedc2cf2b3cd6f3UL, 0xccdc0a073d300621UL, 0x2352b265b773316fUL }},
+  {{ 0x29599148d7402883UL, 0x7c3fa5abc592ebe1UL, 0x18c78bd7448e7c9eUL, 0x143e96662d173334UL }},
+  {{ 0x23606ffe7eb2c021UL, 0x57eb594e95085272UL, 0x44a8da6a6a370a07UL, 0x0ec58a569ffd218fUL }},
+  {{ 0x6b7a9bd4a26c4eb5UL, 0xcabae5b6710d825bUL, 0xb03e5e9c19f01777UL, 0x1ba959a0795b6ef4UL }},
+  {{ 0xbb65a55f2038b264UL, 0xcb3922a7e1bce13aUL, 0x3da07ec89642e972UL, 0x1bd6d03037a2eb41UL }},
+  {{ 0x538d58144db12393UL, 0x8940329780b4304bUL, 0x2c24eb747163d9a9UL, 0x1d144e12a5ac7aa8UL }},
+  {{ 0xe5344e5b551772b4UL, 0x358f4066cb2b7ff4UL, 0xa357e72863f5de11UL, 0x2c422b91a9237e41UL }},
+  {{ 0xb1046be34fab2001UL, 0x886cb52e52969304UL, 0x0df5e7ddb4cf1e30UL, 0x1d01a4c6fea44a20UL }},
+  {{ 0x38b5e893f3423477UL, 0x879b1cf7c2bc878eUL, 0xfb866b9a4a8396a8UL, 0x09b132082db862f7UL }},
+  {{ 0x38acfa9e4b65bb45UL, 0xd25193b099cd47d9UL, 0xfb4330a87e56e315UL, 0x08b5dc5cbd680d08UL }},
+  {{ 0x6fc616bae35caf1cUL, 0xeed5a1b7f2c24b67UL, 0xce2b8c4e6a4d20c9UL, 0x1e28fbb3987fb962UL }},
+  {{ 0x0242f4434b65f5d9UL, 0x568d062468bc057eUL, 0x1444b33c5d821093UL, 0x06635a74a9ac19aeUL }},
+  {{ 0x5c2782adc5ffe514UL, 0xe9cc1d3dd1a3b97aUL, 0xc8cc3de3efdf75beUL, 0x1b79448193a92a13UL }},
+  {{ 0x6c55fbc33966fd47UL, 0x29ba1e48cb20d27eUL, 0x8703480d65fcd090UL, 0x112d888a6a770e2eUL }},
+  {{ 0x931bd9aa9c0098fbUL, 0xdd156512a0ab32d1UL, 0xc4c71fc3766e2b09UL, 0x2ff6e2ea5e3af3b9UL }},
+  {{ 0x71f0cc60034c509fUL, 0x7a089dc3ae89705cUL, 0x045008c612886021UL, 0x1a012cc1b8feacc5UL }},
+  {{ 0x2e310ad82f587f2bUL, 0x943001f97dc14be3UL, 0xbde1ad461ea70a6aUL, 0x131fc09f12c8c500UL }},
+  {{ 0x585f0f619155ee8fUL, 0xd36dc7b596c58f66UL, 0x639baa5e28d399a4UL, 0x043a105e4f24adc0UL }},
+  {{ 0xc3019148a6e5e3cbUL, 0xfb93b698dd5345cbUL, 0x94fda8f591f678bfUL, 0x089ad8aef6becfa9UL }},
+  {{ 0x7dfb4db5a655b87eUL, 0x7e03dd499c00cebaUL, 0x92574f0d1bed2ef1UL, 0x2583f2a34bce96a9UL }},
+  {{ 0xcb588d38325da9f8UL, 0x7207085f83bf4b34UL, 0x14a0c291229318a2UL, 0x21055998e3dc428eUL }},
+  {{ 0x71b665f0d5af6000UL, 0x29e734ea5f863816UL, 0x7e5c4133f215d544UL, 0x00d633b3b130dd74UL }},
+  {{ 0x389e615650c6c1c6UL, 0x660ca96c848cb8c2UL, 0x77d96268105590a0UL, 0x0c2988963f12f88aUL }},
+  {{ 0xd38299c30e33cb5cUL, 0xd586caf92984a870UL, 0x7ac8d69b9ec9d292UL, 0x18d506067eca5866UL }},
+  {{ 0xe2e8ed63ce02ce4aUL, 0x699132f7701c32d2UL, 0xf1b4536a0c34aa8fUL, 0x2b8d2db8e0a21924UL }},
+  {{ 0x64a6c6c46c26e840UL, 0x896036312b02ee04UL, 0xc3e4aae9603b73bfUL, 0x01b5662205215684UL }},
+  {{ 0xe67b7e1a5bcc7276UL, 0xe66746d2396387f3UL, 0x0be54132e072b99fUL, 0x098f56882aa14d76UL }},
+  {{ 0xae6051ffa205e902UL, 0xb163719122b02f29UL, 0x7aff545bc0bc3efeUL, 0x0105790223dcbea7UL }},
+  {{ 0xab4849e40e2707b8UL, 0xc74f8043ba9388acUL, 0x04a48f74d989ccddUL, 0x24c002765f91c2b9UL }},
+  {{ 0x4f8addf8c07512f2UL, 0x03e4edcaf48f05b8UL, 0xc6fe4d80b1b3fa22UL, 0x0bc803d5f34b2094UL }},
+  {{ 0x91fe03fe0f16e84fUL, 0x534bb039020b396eUL, 0x275b023e8c6b4d8cUL, 0x2aef572f6e9f52acUL }},
+  {{ 0xa8a8c3f92c60d332UL, 0x8782563bae659842UL, 0xb2f2496c404d6d3dUL, 0x1ead98dd014ed52fUL }},
+  {{ 0x97f1fe5082a59cceUL, 0x9e85e09d8fe59f6fUL, 0x010f15ead1f81604UL, 0x2d734a87deadc4e3UL }},
+  {{ 0x01f110b41ff0852dUL, 0x8bcff8c0ca8b9b59UL, 0x6081edf131f6aac5UL, 0x10d983306873f09eUL }},
+  {{ 0xac740990d163043dUL, 0xd7a1d9c6c6159e5aUL, 0x3a6167122a4b2aa0UL, 0x003a81ab177b66d7UL }},
+  {{ 0x25f51e0459350ebdUL, 0x1e15ebe3692f4ea1UL, 0x5fb7890ca65ff0ecUL, 0x25a235bcd2893db3UL }},
+  {{ 0xb27703276a9a20a3UL, 0x65318cc4deecef89UL, 0x1713110a1b8b5c6fUL, 0x23938b64008d0f7eUL }},
+  {{ 0xb452a032ec770000UL, 0x8764316fb85e8ec7UL, 0x2b8d34ddb37f8147UL, 0x1aa41fb83ce9599fUL }},
+  {{ 0xe5d410df91206d9eUL, 0x660c37de88ec9fc3UL, 0x09d066a17131230dUL, 0x2f565bf7fe34c162UL }},
+  {{ 0x69a7b2327a49f23fUL, 0x0508a408a3b5d212UL, 0x0f0664567840c0cdUL, 0x24b26111c77c2767UL }},
+  {{ 0xec75825204e5b805UL, 0x41e08d7d92ecf1c9UL, 0xbf1221b6bb322815UL, 0x0b3ef3dd2825aef9UL }},
+  {{ 0xfb9cd9b6387427b3UL, 0xe8eb6ebf6542d73fUL, 0x110529ef84eecabaUL, 0x23a014d0e2cd0f81UL }},
+  {{ 0x384c5177dea9534bUL, 0xb6c826fcfd564b1bUL, 0xb840c2e3f0cd52a0UL, 0x0765cd74ddf4b99dUL }},
+  {{ 0x859655112ef14d7bUL, 0x1b235e6e98b3ca5cUL, 0x4f7c0fb4c749f93dUL, 0x1b538074a90fbe66UL }},
+  {{ 0xff781546cce0f1f8UL, 0x7a2e9e559c2dc114UL, 0xe800577829d7862dUL, 0x28661ffb7463dbc4UL }},
+  {{ 0xe8f4e76335e8b20dUL, 0xc9677fa3be8f9a84UL, 0xf2621d2c8b7a3504UL, 0x1ce22df8157e5c5dUL }},
+  {{ 0xb6c9361d32f688bdUL, 0x5cd1fe9838635fb0UL, 0x8b8d1fb88c896996UL, 0x00bafa7ada989cceUL }},
+  {{ 0xd47b6ea53c2a1411UL, 0x065161c10156d83aUL, 0x2d3758e5ce5cfe69UL, 0x2ef3cac22066abefUL }},
+  {{ 0x3323290f3a4ecd40UL, 0xd4ee5f0b04ed813bUL, 0xc3fb3dee96754fe6UL, 0x0a02a3302f84047dUL }},
+  {{ 0xa2344ed406f0f2dfUL, 0xaee1eacacb8cdd67UL, 0x3b27a6fb24cb6327UL, 0x18d2a18d0dbe2e17UL }},
+  {{ 0xe5bb9f7de072ee02UL, 0x831b4bb884d96b7aUL, 0x52d25973a11b09b1UL, 0x1ac75ff004313c22UL }},
+  {{ 0xb124bd0128949c62UL, 0x77df97586648848aUL, 0x6441ad78732c77c1UL, 0x1014667ee18397a7UL }},
+  {{ 0xc30253dc32c8f9f3UL, 0x96dc79b3a925a9aeUL, 0x05805de2e6bdcb57UL, 0x076f91318710d271UL }},
+  {{ 0x8d0959c2ace9d186UL, 0xce67a30bc08fe7a6UL, 0x900a8b23bbbb1c26UL, 0x1ec8e208c698de61UL }},
+  {{ 0xd91cb687fd9894d2UL, 0x920758470c24c797UL, 0x86c4c84aa0ad391cUL, 0x181cf3c6f4beefbcUL }},
+  {{ 0x3b4a0bada44770bcUL, 0x7f49f7c9578e4bbfUL, 0x46453a8b677a4ecbUL, 0x080b712ff24a06a1UL }},
+  {{ 0x52f6996e33cc75e7UL, 0xadcc700feb93de19UL, 0x94d2fe33dca04622UL, 0x1dc8f4c304fff9fdUL }},
+  {{ 0x3641c37aadab43bbUL, 0x8e9a81c16602bc3aUL, 0xb344f0447b96aacfUL, 0x09b985231a81d354UL }},
+  {{ 0x99f387c7626539a2UL, 0x266e031d822672ffUL, 0xa0a35cc5c6e51e08UL, 0x198b93469f9dad8cUL }},
+  {{ 0x6134b83c0881ba9fUL, 0x97e516beda856b13UL, 0x50534d1e47ed15cdUL, 0x1ea754de37af8089UL }},
+  {{ 0xd4d2f9a7767e5dd4UL, 0xbabf9c0492071603UL, 0x639c784c913bdbf0UL, 0x0e8372582350b839UL }},
+  {{ 0xa7d048470c50c3c3UL, 0xe754e25a0981c3c9UL, 0x96ee33e469873b5aUL, 0x1cf7d39943513200UL }},
+  {{ 0xa6c1b713d80c7dc8UL, 0x80a9aecbc3aeaccdUL, 0x9f8b8313b90e50f4UL, 0x2e16acdc5b0ddf0cUL }},
+  {{ 0x5199dd55aabd80e7UL, 0xc718c1156b04a6fcUL, 0x5f573b7978e52dc4UL, 0x0c06967711d0b672UL }},
+  {{ 0x80528bff714e57f4UL, 0xe81605f06c3608c8UL, 0x860ce1a3c7eb1ff5UL, 0x0fafbc3f1f9218abUL }},
+  {{ 0xc06f1a50d154b975UL, 0x4bdc0ff70723cdacUL, 0x31864400d5225892UL, 0x22d28f5dbe476151UL }},
+  {{ 0xfb25aef74ea7b256UL, 0x7ecc896bbbbb85e4UL, 0x8f10228b665349a8UL, 0x21032e30b5f4c45fUL }},
+  {{ 0xd0ce13a49facd0a9UL, 0x5af7360195aabc51UL, 0xb7a3624acf4bebedUL, 0x2287b3f9eb3a60f1UL }},
+  {{ 0x65a640764bfb9032UL, 0x46dc336c07b67260UL, 0xae61b895c93129b6UL, 0x2ad2f0383d148322UL }},
+  {{ 0x7a74bf994a0e1dcbUL, 0x130e344986834bf1UL, 0xa1be5d4b74c924a8UL, 0x186204831ea15c0dUL }},
+  {{ 0xb9036b670435db8bUL, 0x321fa12a078a61c6UL, 0x92c3acd43ee986a0UL, 0x1b6f89423946297bUL }},
+  {{ 0x22d9ce273f55258cUL, 0x761cf9092ebd2e0bUL, 0xc87e41539e7c510aUL, 0x06e71048561c25c4UL }},
+  {{ 0x9526afca8916c0a3UL, 0xaf969425db3e9c4cUL, 0x52f3bc8a3911e8c9UL, 0x207af7add37f3cb5UL }},
+  {{ 0x23562b52762eb52fUL, 0x2fda2396fc4bc26dUL, 0x55b1a763f937f9a2UL, 0x1b60e42303be55f4UL }},
+  {{ 0x42eba1509986ecc1UL, 0xf192e0de3e026d00UL, 0xd90448ffe86e9781UL, 0x1679fe5fee22684bUL }},
+  {{ 0x8b0bee1b501e0e92UL, 0xa3e0ebf995e1800cUL, 0xd0581b3b750dd2b1UL, 0x02898df5bed7214dUL }},
+  {{ 0x1a8872b995000dedUL, 0x81519e18174d6369UL, 0xcc27dfb3d23d9d4fUL, 0x2d518e8706e826b8UL }},
+  {{ 0x3bda469ce5c4ba35UL, 0xd3a9ce5870ffbe42UL, 0x4427be0cd6dd3cb1UL, 0x15f9660fb47fb9d9UL }},
+  {{ 0x4141977bdd1c42a6UL, 0x840fa2d7ab931d3aUL, 0xad746a0228d6ad99UL, 0x0508d81e955229faUL }},
+  {{ 0xeab101f899006229UL, 0x057b8e0143a82393UL, 0xf5b817832722d61bUL, 0x262b11f6832812d6UL }},
+  {{ 0x509444c7d7feed5aUL, 0x560471adc59a459dUL, 0xccc36d8d2cf3657bUL, 0x0d464d0de231aebdUL }},
+  {{ 0xf76443bc87b0e68dUL, 0x0d21ee141b9fb227UL, 0x12beb933865d8229UL, 0x2c8832dcd9c3c69fUL }},
+  {{ 0x02ec85492bdbdc41UL, 0x14e21dcfbefaf1e7UL, 0x533208efa2521165UL, 0x04bc74bdf7752beaUL }},
+  {{ 0x0fcc34bfb31c1af6UL, 0x27e4d756e6a12e63UL, 0x5b106d6999c69f05UL, 0x015f5b409e305fa0UL }},
+  {{ 0x39a0541d86d12606UL, 0x559dbd8eedcb2dddUL, 0xa51daea2111afe82UL, 0x0b58bd7092e95f3fUL }},
+  {{ 0x52eb0cfdcf39514aUL, 0x02c4a8cd8e0853eeUL, 0xd3355fbfeb1941b9UL, 0x2223545968ae6fafUL }},
+  {{ 0xa2c42a206cd930ccUL, 0x02f71d25f347a588UL, 0xfa27b0c5849d515bUL, 0x0b0934a71d640badUL }},
+  {{ 0x7754fae19b4d268cUL, 0x85e0c733c3b43aa7UL, 0x909c5c73503731c5UL, 0x0699e39c4d17e382UL }},
+  {{ 0x482886c329dc3a85UL, 0xc9f34b0881d8204fUL, 0x6eac13babe30369bUL, 0x1fae7f5108d97457UL }},
+  {{ 0x0c3ee338ebb1a999UL, 0xbe53bd8d5a98be0fUL, 0x15a839bf45a16da7UL, 0x1f843fc0c54e92dfUL }},
+  {{ 0xab108c266bebba84UL, 0x17d1d97ea3599303UL, 0x98d4cb2ef1d28dc0UL, 0x174aa3388a07dc8eUL }},
+  {{ 0x64bc4d3eee170412UL, 0xfc4089d52169456aUL, 0x35e3a2e412f2609cUL, 0x1a661de5ca996df2UL }},
+  {{ 0x88c4bc3adb94b051UL, 0x0014685790875b74UL, 0x7ee7380b2d38d125UL, 0x106b2a04360e95b0UL }},
+  {{ 0x5e172d2e9bc21424UL, 0x961bc47ddbf63cfeUL, 0xe5f4b325d13934cfUL, 0x2060d9dcc507d337UL }},
+  {{ 0x9f830eaadf1721ccUL, 0xd85c10b1cd0062dbUL, 0x2f7b4db7bdba5497UL, 0x1e773a2d20ecf2c6UL }},
+  {{ 0xb9aad08332527d0dUL, 0x481c1022bd091b96UL, 0x30a07619973963c6UL, 0x2bf4634e42098020UL }},
+  {{ 0x93b80bc25123d1f0UL, 0xb329dd0dff3a881aUL, 0x75949f1a12ebf163UL, 0x14b04652e6b28b0aUL }},
+  {{ 0xdf6a4314cc09a2b7UL, 0xdd0bc50605fe857eUL, 0xcd11610cec968746UL, 0x04f8cc5e65683650UL }},
+  {{ 0x0998d1a1f53da9aaUL, 0x943cbe30aed6400fUL, 0x1cd583d37dcfe043UL, 0x25fd3dcb3ef5943eUL }},
+  {{ 0x8ffcf0408283cd55UL, 0x0232fd66108651bdUL, 0xf4d9ac98fbbefe15UL, 0x04fd68f5ce69fb01UL }},
+  {{ 0x39d4636a7f27c8ccUL, 0xd629d8c3aac1e87aUL, 0x63165d4d2c4fab25UL, 0x0946f7f8f97eaf1cUL }},
+  {{ 0x1ded528d586f576eUL, 0x8d52a0da181ba1faUL, 0xd3f9696e8bf23812UL, 0x0c20039e23c62aecUL }},
+  {{ 0x8cd8bbd38dd18c34UL, 0x9feef2505caa2b3cUL, 0xdfebf366f3854930UL, 0x0951b84dc6515c48UL }},
+  {{ 0xabefc6527ab4b183UL, 0x7a5f392240450498UL, 0xda76cb37e75a389aUL, 0x28c2605a3f6af8faUL }},
+  {{ 0x98bdcb1849e56b97UL, 0x15911f5272c3000eUL, 0x671e56db7de2d931UL, 0x05f1bc64f3988cc7UL }},
+  {{ 0xe6de313fe72075c7UL, 0x5337d45adfbbcaa8UL, 0x8823a51e1f3bfd1aUL, 0x1710e7bbea323dbaUL }},
+  {{ 0x2554df2b46b663e8UL, 0xf52bd3f8c3c704e4UL, 0xcc3a326ccf0094d1UL, 0x275a28f215f64445UL }},
+  {{ 0xaa652a8613b5d399UL, 0x0cafbb5338ea9350UL, 0x707ab5b71559183eUL, 0x2070ea8458b46aa6UL }},
+  {{ 0xefc764d1d4926fd3UL, 0xfaaab25c0db29fdaUL, 0xdbe5f8d22020e0fcUL, 0x0510db94042a86c8UL }},
+  {{ 0x2ee7252bf087dc52UL, 0xf4b108d6c5035df5UL, 0x0592c52b980830c1UL, 0x12912603784bb10cUL }},
+  {{ 0xf821a7c4fbeb3c21UL, 0xc33f823767370bffUL, 0x19f64e202f795e5bUL, 0x2bd01679bb4c9427UL }},
+  {{ 0x712eb4c6969874b2UL, 0xd768be74f9a8f732UL, 0x4e380535ad0b79a3UL, 0x26426d821674334eUL }},
+  {{ 0x2b343d12e3ade136UL, 0xe4f6cbd3c5a2b0bbUL, 0xe084cae32ee43ed4UL, 0x2e20a21f38842ee7UL }},
+  {{ 0x1b585fa173089d07UL, 0x7c3b684b2bb5fb3dUL, 0xb79d1dbda2580f7fUL, 0x26e8826b621bc598UL }},
+  {{ 0xeb37337f238c176dUL, 0xa832847a7fe45b73UL, 0x0f813943bf04388aUL, 0x019bae10ee498300UL }},
+  {{ 0x56f375855d5837d3UL, 0x4d87ec97d702c3f5UL, 0xf0290173e3f36a16UL, 0x19857aec37979ce1UL }},
+  {{ 0x12a1f7314ef51b4fUL, 0xe544863a3a282340UL, 0x4a123618f3a96d3aUL, 0x04577f18098b5bd4UL }},
+  {{ 0x040d83887e4bb45eUL, 0x1f27534f48c303c6UL, 0x503a66a62f243cb6UL, 0x27db4df0db09e8faUL }},
+  {{ 0xcf74fb0b23974201UL, 0xf9b0fc1a56c5dd36UL, 0x128ca17144399425UL, 0x04753de3b98a65a2UL }},
+  {{ 0xfe89953b916bfb18UL, 0x47e4c7dc74969f3dUL, 0x5c9e6edd5018a926UL, 0x152578162ab89b4eUL }},
+  {{ 0x6c95d6e96237444eUL, 0x546bd19ea0b99b6dUL, 0xd8bdae4ad92f64daUL, 0x11cb2b6e82fd4ec6UL }},
+  {{ 0x3306fbaa1c459577UL, 0x5b06c5e21d3928f2UL, 0x25c00be7d47ff946UL, 0x1f37bb413e406962UL }},
+  {{ 0x20e7ae245f19d2c4UL, 0x2ede297f89f46951UL, 0xabdca1e9b3bc9c61UL, 0x28a9e0bcea7f7678UL }},
+  {{ 0x02e195748efe07bcUL, 0x60bc163852649c3cUL, 0x877d486fc21bec22UL, 0x1c92461898d28a01UL }},
+  {{ 0x63bbb6e28bf9f1d2UL, 0x28753682f2bec891UL, 0x08217e69b49cd687UL, 0x0ed64e17bf6071c2UL }},
+  {{ 0x9fafa221a700169fUL, 0x7f1396fde419b7adUL, 0x3958f65ea92b1ce6UL, 0x1115ba5f4791a045UL }},
+  {{ 0x0da9b75af0a88a17UL, 0xaf573d3a5a67549fUL, 0x938662c35b1bb23bUL, 0x2d0428a3e151f825UL }},
+  {{ 0xd9837d8963ffddb7UL, 0x17e06e1f16e2be23UL, 0x7c6945cd7bb4ff2fUL, 0x01e76a07cff3c1b8UL }},
+  {{ 0x6d052af31e2edc54UL, 0xd16b2efac96367e7UL, 0x54dbec02d9eaabccUL, 0x160e0fbd33961ef4UL }},
+  {{ 0x87ce46b585287c4bUL, 0xaf150f93c98777a6UL, 0x6c087437ccbe3b04UL, 0x12ccd9fe8358f334UL }},
+  {{ 0x3437e193e3cb68e3UL, 0xf31d50fb2d58d632UL, 0xad68ce26273442adUL, 0x027b379369fe3fadUL }},
+  {{ 0x0fbb826668641c61UL, 0x8385a41e29dc75d6UL, 0xf0e7d990a6d7105aUL, 0x28aa63a7ef77b16dUL }},
+  {{ 0x071b114d9e112dd8UL, 0x7bfd13038bd7f177UL, 0x42cef71362999ffdUL, 0x19045de0392eb44dUL }},
+  {{ 0x85683af0ae39592bUL, 0x175b065f6449741dUL, 0xd95184c28da0118eUL, 0x26420ee7e2ff2ee0UL }},
+  {{ 0xaf153d21ba45e3e4UL, 0x6b254950bf233609UL, 0x6cdbdeeb76b9d87eUL, 0x1a6bd422a1be216aUL }},
+  {{ 0xb1cf5d65cfb745eaUL, 0x602434efe1be0bc1UL, 0x94d76a25e99db79bUL, 0x275575186a1d6930UL }},
+  {{ 0xb83d4334b8f1c05eUL, 0x98a63904eed4652bUL, 0x5b06906ef710948dUL, 0x0652787fe8dd54e9UL }},
+  {{ 0xb38e03ac9eb995c8UL, 0x185c59328bec13cdUL, 0x8f44fe4e79c43b0bUL, 0x2d4338193b4d0987UL }},
+  {{ 0xb48c5de756167e94UL, 0x8c02beb83d368e2eUL, 0x794079a0a616b4b2UL, 0x2b78270e9bcba012UL }},
+  {{ 0x4f2bcd036ebe7949UL, 0x6cf49eda303bcca0UL, 0x5e62623352a49fbeUL, 0x1201ace602d51745UL }},
+  {{ 0x0a79e62dee9fc020UL, 0x4549ae4c7e03c6a2UL, 0x790ab2232bf28ef4UL, 0x1d7f6938b25d1767UL }},
+  {{ 0x5b60ca52507e16a4UL, 0x219b0c660200947aUL, 0x18fd4602efb2d432UL, 0x154e5ca99e04b000UL }},
+  {{ 0x96e791341473213aUL, 0x0d403b9c189b5253UL, 0xaccba20ab997fad8UL, 0x2703c98f474f78ecUL }},
+  {{ 0x83492ecd864966afUL, 0xa78f2dfeb2f82efaUL, 0x203f716afbc6d8fdUL, 0x3006bbcc28dead23UL }},
+  {{ 0xe53d67e45d98330fUL, 0x827f5ddbcd5832b6UL, 0xf629392ead1776cfUL, 0x1733955bce2c6dccUL }},
+  {{ 0xd974536469fcbb13UL, 0xeb9a8abe10a292c5UL, 0x26afa8d6bf9df9d0UL, 0x06589029a37a193fUL }},
+};
+
+static const fd_bn254_scalar_t fd_poseidon_mds_6[] = {
+  {{ 0x40608a783ee62badUL, 0xb04481cea961436eUL, 0x97a709db9ed8c008UL, 0x281f30c1bf2d293aUL }},
+  {{ 0x1eb9eb4e60ba3373UL, 0xf00765566cd757d0UL, 0x268dc55adb55846fUL, 0x269cfc86a2aa48ebUL }},
+  {{ 0xfbd0fae3e707c83dUL, 0x0747923dbcdfee7aUL, 0xe557147ed47c883fUL, 0x17e8bde04d18fe5fUL }},
+  {{ 0x7bc95074a957f067UL, 0x92742eda793e04d2UL, 0x8a21a997bcea54ebUL, 0x1940a532751ec116UL }},
+  {{ 0x452d49d15618e722UL, 0xf190e2a158c159cfUL, 0xf3872d51c2664285UL, 0x0178a647be9003c9UL }},
+  {{ 0xc7ffe564d3eddaf9UL, 0x35a45ad2b23d1285UL, 0xb93fe800101207a9UL, 0x0e899bc033f34aadUL }},
+  {{ 0xefda51bad9992600UL, 0xb16fd81c76521488UL, 0x2cb484bec9ea82abUL, 0x23da01c08fa91fdfUL }},
+  {{ 0x8ebbefa3fccd5f05UL, 0x5426dfcd19dde090UL, 0x20be5e39a7e6d97eUL, 0x0f7c06a615f5e4b4UL }},
+  {{ 0x23d1b77b033d60f4UL, 0x3a318f06f771ca28UL, 0x274637939c2a62cfUL, 0x11a6537465cf9e63UL }},
+  {{ 0x484cc8e7d5f9e814UL, 0xe648b1359b98a57bUL, 0x3ff7f647ef353142UL, 0x27b31ee9c20ff9ffUL }},
+  {{ 0xb3bd0f39349ed952UL, 0x7312b9eb8a75b33dUL, 0xa4cb7e2f22f8707bUL, 0x211e5f99af40c21dUL }},
+  {{ 0xe689b0b0b960b0e9UL, 0xa59654462b376397UL, 0xc1b82be00456d0b5UL, 0x1e160fcaeb5e06f3UL }},
+  {{ 0x3e66e1111b61380eUL, 0xb3bb4d0a482fed80UL, 0xf1fc52e48b3c87c3UL, 0x29c2b69d270a7a26UL }},
+  {{ 0x3cc59fe2ec6e0ee3UL, 0x37485e8bb490e1acUL, 0x70f730f0cc0c998eUL, 0x0c104d3d523b237dUL }},
+  {{ 0x8766ea049b81b64dUL, 0xd7eb0b588f7ee7ffUL, 0xa680d52360b40d40UL, 0x2ca41a0d59a7c287UL }},
+  {{ 0xf082905d919792caUL, 0x356f1731e730d31bUL, 0xb875ae04a1ab56d5UL, 0x19ec9b0bad23b140UL }},
+  {{ 0xcb79be0ca8ffd3d7UL, 0xa44293e88721cb2dUL, 0x3b18a7d5973a5e2eUL, 0x02e98dd0e637f10dUL }},
+  {{ 0x3f4a96b43a524eacUL, 0x0eae4179c556059cUL, 0xe5f44612842f2f44UL, 0x1de7db929e3a2ebfUL }},
+  {{ 0xa891ce4cf72c8118UL, 0x05ea1137dca7b6dcUL, 0x5d29edc5b17f099bUL, 0x0d2055ef4c751416UL }},
+  {{ 0xfe40bc12d589914cUL, 0xc80b5c9641012cabUL, 0x06141dd49a0f2a09UL, 0x1801513dd0fcf525UL }},
+  {{ 0x5a828f0a35fcd279UL, 0x964872d3376aa04cUL, 0x1b96474d51f0077dUL, 0x1865ba3db468d563UL }},
+  {{ 0x6d095f01a26e38d7UL, 0xb058478241d1ee84UL, 0x20fdad0cbee0343eUL, 0x15e1aa2a804448feUL }},
+  {{ 0xf42b9ce424fb5920UL, 0x04ce20816a5c0bbbUL, 0xbb768122771c499eUL, 0x029c56eac72c04b4UL }},
+  {{ 0x053ee9a8b40dea2fUL, 0x8c0f06c76d015743UL, 0x9fa29e578da2d6b7UL, 0x23b88cab9f8127f6UL }},
+  {{ 0xd5084b983d059f09UL, 0xb26e4cc70ef857edUL, 0x4b26508a71981283UL, 0x2b1a7b81185ba003UL }},
+  {{ 0x63cc2e19b2f5e970UL, 0x627de97f5dadf3e2UL, 0xbea9a303fa8e4cfeUL, 0x04673cdd12ef3efbUL }},
+  {{ 0x1867682fa6c0667cUL, 0x85c52d48f9ad0b1fUL, 0x0ecad0b8d863a0b4UL, 0x2a8b3bd310a0fb6cUL }},
+  {{ 0xd0109ef67b446a43UL, 0x8f1c5c34cb2cf7bdUL, 0x2b9433541d70e88bUL, 0x2f0a210228cfe694UL }},
+  {{ 0x415264bb2f851f60UL, 0x654b6ae05b764f1bUL, 0x95ec4302bf86cc97UL, 0x2ff1febb53aa2132UL }},
+  {{ 0x77ace1660180df7aUL, 0x81e9f4808991cad5UL, 0x70948c9cd60fe288UL, 0x155f834700ff1a52UL }},
+  {{ 0xa582444f5961d9e4UL, 0xff79361827fd1e0aUL, 0x017b68f5275f16e3UL, 0x2cdb7c001a0f5f1fUL }},
+  {{ 0x3f97d29cf63a99b9UL, 0x585ce6f59f5d0179UL, 0xb5eb9fe498bef091UL, 0x1def28255939535bUL }},
+  {{ 0xbf051a5712364a91UL, 0x944cc3120036058fUL, 0x009bc4bbd9ba986aUL, 0x2f67f5aae7583230UL }},
+  {{ 0x93e0d9d279578ecdUL, 0x3f5900a10336c640UL, 0x3c07e3830ae2c921UL, 0x26fb3f9e2ad30a18UL }},
+  {{ 0xb4e790ea44be8ff5UL, 0xa263d62f64bee9d3UL, 0xfc321bdc1b5d3f9dUL, 0x0acba80b0018c1d9UL }},
+  {{ 0x1cf3860522396deeUL, 0x6e8ac845cc78648aUL, 0x8befbc792c684b44UL, 0x27d25218ce3dace9UL }},
+};
+
+static const fd_bn254_scalar_t fd_poseidon_ark_7[] = {
+  {{ 0x219faa0970770602UL, 0x9a73c1dc6e820969UL, 0x1117bae44becff8bUL, 0x00c3f5af1d27ec8dUL }},
+  {{ 0xcd7fa6279aeb8abfUL, 0xf16ba25b5eb55d49UL, 0x9fda5ae58e2f542cUL, 0x0f79c548eb9bd349UL }},
+  {{ 0xaa94898f77e72db9UL, 0x5491d93cd5538b5fUL, 0xcf7c09e35eb5c3ccUL, 0x16c9a99863dcaa2eUL }},
+  {{ 0x1136ce7cec82d4fcUL, 0xf67145b7175d44e6UL, 0x3858013948ce29fdUL, 0x24d2e99833748e1dUL }},
+  {{ 0x49cf12e8651ae724UL, 0xff0df55424cf1717UL, 0x638677e75be1c82aUL, 0x0e0c407037a30ad1UL }},
+  {{ 0x84aff868019e997bUL, 0x4e831233cccc7093UL, 0xc37b5d530a03284bUL, 0x00cd3bf7b17ee697UL }},
+  {{ 0x8f51804c5d3a8e91UL, 0x41eed532a30e5b85UL, 0x5e7f612b2cc9f18eUL, 0x0808e26e36319154UL }},
+  {{ 0x311ff6381d85aab9UL, 0x540a63602cd32969UL, 0xd9c14ca75a290101UL, 0x1b857196fbe8ed98UL }},
+  {{ 0x4eb8f05ae00e1f24UL, 0x972592347b211c4dUL, 0x942369823c17d65aUL, 0x1e52888cf029c72cUL }},
+  {{ 0x484ae7d1136ef3e0UL, 0xe375844542f88603UL, 0x24237fc45fc97715UL, 0x2b0ef5311c7cf311UL }},
+  {{ 0x2976ba47c1d12f53UL, 0xae90de072e7e247dUL, 0x1deadfff61d36a1bUL, 0x0633704f07839f7bUL }},
+  {{ 0x9d368fcec9498cefUL, 0xeca770c8400a36a6UL, 0xd4940a8c0783abd9UL, 0x1c2121b88438a9dfUL }},
+  {{ 0x0f32d20be1e81289UL, 0x69e4e5c5159af692UL, 0xbbf8b3f0840fca99UL, 0x2f460d16934b1c99UL }},
+  {{ 0x01a7c375981ede92UL, 0x90702ec9167d9041UL, 0x1b93da494e814379UL, 0x2e61dc18c71d6175UL }},
+  {{ 0xb147ae9bf7038e01UL, 0xebe06225fe36ea40UL, 0xa82e952e6ba9bf9bUL, 0x0bc3abc4b98b4bbcUL }},
+  {{ 0x351ab0e458b02267UL, 0xab0d9cf39cce2e13UL, 0xf9e4da8bee4e2e9dUL, 0x0cc1926bd84b77f5UL }},
+  {{ 0xb207f8aa2c3f57b2UL, 0xada9628c62377d58UL, 0x9260122a93701d8cUL, 0x0c0c2c68b064e2eaUL }},
+  {{ 0x228c79c2f57de637UL, 0x0a1e5f83852e7a6cUL, 0x250293a74b267b7aUL, 0x1d6bf1d0c64f40d2UL }},
+  {{ 0x626f83d2aaa7c711UL, 0x798a358f1b6e570dUL, 0x071b7a2d2279a5bdUL, 0x2d2d7d78bb806436UL }},
+  {{ 0xb647a7a1f56a022aUL, 0xed4de2d135978011UL, 0x5e510b31e568cab0UL, 0x18eb27482f5ee3aaUL }},
+  {{ 0x40dfa10de2662df7UL, 0x830c0aae6cd72a96UL, 0x88f721a6e33d1639UL, 0x1765ab56ed951ee1UL }},
+  {{ 0x6defb5eec7d84ac5UL, 0xdb741ef39db8547fUL, 0xbe644f0c066dd149UL, 0x0eb7882a9d06cbabUL }},
+  {{ 0x68dc38bca496b1c4UL, 0xaed56d4b5755a84fUL, 0xa9165b4bbfa34252UL, 0x1377d695ae7f2bb8UL }},
+  {{ 0x2833ea47e0574a8aUL, 0xa5cf5be77e4091e9UL, 0x79279a8f294bd813UL, 0x0dd0a7255817b47cUL }},
+  {{ 0x7e9dbac35fbd61edUL, 0xd8fa80bddcb8051bUL, 0xfeab23cf0b65a3f8UL, 0x232d5d985db9faf8UL }},
+  {{ 0xa4578970921489b9UL, 0x0b8a744136c722c4UL, 0x085fae9b1168ff78UL, 0x28693995c8ca967aUL }},
+  {{ 0x52d112a4ce037015UL, 0x752981217a15433dUL, 0x203900bdd8232c99UL, 0x0f96807632de0746UL }},
+  {{ 0x17a3d06b06500af7UL, 0xd9630917494bb60fUL, 0x672c179cf6188a41UL, 0x128a6e7f0543c688UL }},
+  {{ 0x037fc0d74d2ddb5bUL, 0x3a25bfcd89f90950UL, 0x80f6c1b7592947a4UL, 0x0cbf75104a8dcda7UL }},
+  {{ 0xfb359a023cd6b82eUL, 0xcbcf9b9fe199c805UL, 0xb041a3f154a2bdcaUL, 0x20de305c3c0202feUL }},
+  {{ 0x2c09b85026781180UL, 0xf9e11948651b8e0cUL, 0x6e53edac9630d90cUL, 0x0a3d44b8979c8ba6UL }},
+  {{ 0x4a817954d38385d5UL, 0xbb1cc0b8904b4e45UL, 0x4fd4b36ee1b5b5f5UL, 0x252773e9d19f5089UL }},
+  {{ 0x30061998de6c79bcUL, 0xb4493f13ee6c157dUL, 0xddddd9153025a17bUL, 0x13dd0f710de329ccUL }},
+  {{ 0x79692590b76a788dUL, 0xb4dfe2200a893dabUL, 0x2213d87008b23ad0UL, 0x264a8406ceaf64eeUL }},
+  {{ 0x44687dcf2b3e2e5eUL, 0x2cd82bb0bdd4eb37UL, 0x1637626925b1c5c9UL, 0x02d2ce90813fcd52UL }},
+  {{ 0x9252286b0d5cebd0UL, 0x46adb7c9c02df817UL, 0x2376b18bcad8b065UL, 0x1ddfe4dc612f930eUL }},
+  {{ 0xb7faff097cbb4acdUL, 0xc00fb08725369e4aUL, 0xcadd288213b9fda1UL, 0x3011cb18b8bbc821UL }},
+  {{ 0x05bbb7f788245364UL, 0x62343d6b2a53b608UL, 0x71fdca13390014e5UL, 0x2a9e008f46b55e90UL }},
+  {{ 0x14250dd8673b7f8aUL, 0x97a091f1832ee935UL, 0x91f6d00b8b894480UL, 0x2bdc9fadbc4c3d18UL }},
+  {{ 0x0996e37994b537d4UL, 0x69ece8ec543bc070UL, 0x7556fcfd3de1fee6UL, 0x09b0ab8fbd0dd691UL }},
+  {{ 0x03deb2a323f390e7UL, 0x0248e9478288a770UL, 0x2c002f415b3cc85dUL, 0x020dc8cf0b50bf9cUL }},
+  {{ 0x93358ca5b862eb16UL, 0x33ca2ccd11d9b4e1UL, 0x413747414554c924UL, 0x134b78e40d607395UL }},
+  {{ 0x08d2357eeb524906UL, 0x81f45f93402bdc24UL, 0x3de3329aefce8bc0UL, 0x188ac1d6de8259e6UL }},
+  {{ 0x702d129dfc86be55UL, 0xe2a9ac06e6f9b2a1UL, 0x8158d27694804e7fUL, 0x25ee333f5ad36076UL }},
+  {{ 0xeacf26572787ec31UL, 0xd5d4b042d11d801aUL, 0xf9ca8769e13df1d7UL, 0x227f1790651e26bdUL }},
+  {{ 0x84c1d98938e3712cUL, 0x4c042e0888e020a5UL, 0xbfaf390698b3fee7UL, 0x0ef25fa1196b1307UL }},
+  {{ 0x118368b5e02b1e56UL, 0x3e9f9503e2219ad8UL, 0x982b6ce7c24f7023UL, 0x04abd8333b564a24UL }},
+  {{ 0x79bfcb95e16ef95cUL, 0x4f57112ed465b59cUL, 0xf44324611fc70588UL, 0x0bd0fc176c83a669UL }},
+  {{ 0xbdae34beb6c8f79aUL, 0x74ab63906a9241e2UL, 0x43842aaa9f8d4b7fUL, 0x1a4aa2af8ab2fd46UL }},
+  {{ 0x9726344b41636bcaUL, 0xe32e6092a3ddc5ebUL, 0x743848fd09bd1b82UL, 0x2eccb3f9a33c9b3eUL }},
+  {{ 0x4590e3fa772bb97fUL, 0xe7623868239d2e8aUL, 0xf69560e1e4032ffaUL, 0x019c3300c054651dUL }},
+  {{ 0x8b5559e9f2ba4532UL, 0x5627c701fe464a35UL, 0xfa1ce6031dc3554cUL, 0x2833e7e0bcfb521eUL }},
+  {{ 0x7f6adcc19b6a66d6UL, 0x27379e72e530d06dUL, 0xda409d504a3a5c1dUL, 0x2a71cb357c9f10d8UL }},
+  {{ 0xec38fd994b96cdd9UL, 0x07523f1fd005d3faUL, 0xbcbaa90f944dc588UL, 0x04643ecd11f4e218UL }},
+  {{ 0xa292121c89143babUL, 0xcbb2c3b0aee120f8UL, 0xd4bd2bb8ed8d4ea2UL, 0x199c75cc34b8d2adUL }},
+  {{ 0x0a99945314572327UL, 0x39184f4ccfd30997UL, 0xfe9a5f644724a2b0UL, 0x2abdd6be2a184a2fUL }},
+  {{ 0xe23aa094af507f2bUL, 0xaa516a43cffb3006UL, 0xbcc96c0680c5bdb0UL, 0x09c3182a455ed4f6UL }},
+  {{ 0xf3e7549b3b8f33ebUL, 0x45c6e8977cdb0e74UL, 0x962bacca6a839a11UL, 0x24ad76403938f7bcUL }},
+  {{ 0xf8d7cafbc79b51a3UL, 0xbad33d55025cb236UL, 0x5f1d16bb7606008fUL, 0x1bbd5807c256515dUL }},
+  {{ 0x6144346faa5e0219UL, 0x09fb678b211b5a94UL, 0xa793ca6cf413fc5bUL, 0x0849b6ef88ec14baUL }},
+  {{ 0xd4f7c33b3566c588UL, 0xffe88b0c3b031923UL, 0x7bdbcb6b7fb2a85fUL, 0x2d8a2742dffb2f75UL }},
+  {{ 0x4f34938671165a34UL, 0x19ceef527845cee8UL, 0x69a12d97ba85b534UL, 0x088d1c47414903e9UL }},
+  {{ 0x43aa0ac556b57f6dUL, 0x1c0ea230d288d2b8UL, 0xb03a4ebe3d154d3bUL, 0x0ca17b4af2438e28UL }},
+  {{ 0x1c6ce497c30f6542UL, 0xdbcc121c35d4b1baUL, 0x331d61df26f8d193UL, 0x142888c75005738aUL }},
+  {{ 0xd0fdfaa1ab359019UL, 0xd76db4e07946ab5dUL, 0x4327dd67b6480b17UL, 0x09b88855262275c2UL }},
+  {{ 0x911cd762d2d1bc20UL, 0x6a4e1f0a19fe5de9UL, 0xc1a03bb39926d4c9UL, 0x258a7016ea05217dUL }},
+  {{ 0x444b2f8d80ec9357UL, 0x918f2b447633e1b3UL, 0x8df267eb96d290faUL, 0x02c5e983c3f82af9UL }},
+  {{ 0xd96a00fda4f0685fUL, 0x2700b47590ab9f12UL, 0xb7de39580d7a2e83UL, 0x065b998fe1825dd4UL }},
+  {{ 0x5eaa040e8d9b28eaUL, 0x9adf125f53360781UL, 0x73e68a08292a73f5UL, 0x173e4d640abc9cdcUL }},
+  {{ 0x85debc0bd9283639UL, 0xbe8707b44a5dcadbUL, 0xb4d082b58db83990UL, 0x2941fd4cbab13340UL }},
+  {{ 0xae22a901ad027c74UL, 0xe3c5d2518be0cc5dUL, 0x24db3762bd69a612UL, 0x28a123fbc377f8b4UL }},
+  {{ 0x401d460b69ae4520UL, 0x8efc24fef74d5e49UL, 0x91fd73575f8df0a6UL, 0x194c1fe486bcc9faUL }},
+  {{ 0x75178bfe09df0ce9UL, 0xf22ec2bf1e33bc8aUL, 0xd317d3d04e8ed065UL, 0x0242dedd80fe602dUL }},
+  {{ 0x7506dd679c49d23dUL, 0xa4971f4c445b82f5UL, 0x7b93fb7d74c43e9cUL, 0x29810d264a6101d4UL }},
+  {{ 0xcd2192e46faf5b13UL, 0xede2b36abe35cb47UL, 0x298bb66312e264fdUL, 0x167a06b90563b6bdUL }},
+  {{ 0x6e8b42b7e4b0abe9UL, 0x501af7deb8f9d292UL, 0xbd0fc48584ec9091UL, 0x1eef009128768badUL }},
+  {{ 0x7a6c60d70128e953UL, 0xc375703c6d8e7a47UL, 0xe10a04c7d6cf5bb4UL, 0x07ab4d4af0bfc52eUL }},
+  {{ 0xce5755c0d7b4a3a3UL, 0x0252d849fb2d859aUL, 0x1633fb59016ba0d9UL, 0x2929c1d471dc8107UL }},
+  {{ 0x2a017cf37e562ec2UL, 0xb63111d5e4e52e36UL, 0x1fdeb1398bea7846UL, 0x1e187b082a848cafUL }},
+  {{ 0x3753d4b8ff09100aUL, 0x989343373c94a938UL, 0x4fbb91969306f4bcUL, 0x0ade9bbe852900afUL }},
+  {{ 0x013f46879a82ff83UL, 0x29f02577250d601fUL, 0x8a37850d2b26c833UL, 0x1c026022a0a6b0fcUL }},
+  {{ 0xfba95b26b03e4fe7UL, 0x228565506f1fbf2dUL, 0xe075d6a8b0cbd504UL, 0x2f62c52b25db21ddUL }},
+  {{ 0xba08b9a1f7a81915UL, 0x2c077284cd1ad934UL, 0x3e27c6d64911f3bcUL, 0x0f69fe64f7f42bc4UL }},
+  {{ 0x133878499466b36fUL, 0x96e58f719a687e2fUL, 0x3768d6646cd5b0ddUL, 0x0ba7089bcf97d870UL }},
+  {{ 0xa69be2a45448c2d4UL, 0x5cedbccc9e9dfabcUL, 0x5c3f8fa9414165cfUL, 0x04ab1888f8da3805UL }},
+  {{ 0xbe385eaba83e139bUL, 0xb4082f0f62c2448cUL, 0xaa21523142658691UL, 0x2b2e6ee612d15ce2UL }},
+  {{ 0x4045055339ac040bUL, 0x3e66d90391e05fc4UL, 0x5e04c361f35fbb23UL, 0x161538035706414eUL }},
+  {{ 0x8cfa4ecb831dbc6bUL, 0xbdd870e1275ef461UL, 0xbb683ad84285aea9UL, 0x00e62c7019e24567UL }},
+  {{ 0x12e823a3f9e1c0d0UL, 0xb53504bdac117fbfUL, 0x52b2f8386b3cfb3bUL, 0x1c2fb35245f11d96UL }},
+  {{ 0x5fcef8ad9a2e7021UL, 0x0cb3d9ffabbad94eUL, 0x616191287f3276dcUL, 0x1e287267fad47a24UL }},
+  {{ 0x1e92f74e7156e1abUL, 0x75d16aeec70b2b9bUL, 0x069e44185e05f6dbUL, 0x2ad32e94ff35a59eUL }},
+  {{ 0x4f2fc3d624a94539UL, 0xeb482d80a23ce507UL, 0x864f25ec81a642e7UL, 0x2ac868bb2a68b5bcUL }},
+  {{ 0xa6bc49e493235af0UL, 0xf3faf52746b6cb85UL, 0x021d23df38fa8394UL, 0x2c90bee14905831aUL }},
+  {{ 0x3822872a7b31db76UL, 0x129c29a511b45ff4UL, 0xbb215482119ebb9eUL, 0x264da4a3f26bef0bUL }},
+  {{ 0x78a720c5cd87abd4UL, 0x8b1d682b7654ad84UL, 0xd78931cbc5a97940UL, 0x1007e65e47f371b1UL }},
+  {{ 0x1c4ec7db3772f7e6UL, 0x52c09db7ddc35529UL, 0x5a1066c9ec85034cUL, 0x208dc23a4aa34b07UL }},
+  {{ 0x9ae6491634a90eb5UL, 0x86a957ebd0b17417UL, 0x6365f7b70bf86125UL, 0x20dbd0f31fe7f4edUL }},
+  {{ 0xf83eedbd8181ff55UL, 0x624f58e354fc1578UL, 0x9881cdf5e3f34b8eUL, 0x0c1da04db39a0e4bUL }},
+  {{ 0x599f03091e3868ccUL, 0x471d0fda2fd2947bUL, 0x1410b46d38ad38ebUL, 0x1cab2e5001da522fUL }},
+  {{ 0x29d031a7fa081da0UL, 0xd0c77d63c8178dd7UL, 0x5f8a7e7e6ab98817UL, 0x068b1469203f73e7UL }},
+  {{ 0x3c57504cebd8b415UL, 0x510f74191449aa83UL, 0x8690ae23276757c0UL, 0x08bf9b48724c0543UL }},
+  {{ 0xe2c25d67181aa078UL, 0x8ef6bc9e3732e6e8UL, 0x7e82d37cd5cb69e3UL, 0x24edb2522431c952UL }},
+  {{ 0x7caf73dd38da8090UL, 0x603a1925b0288624UL, 0x1d2b3aa91e7233adUL, 0x305e52f37060d11aUL }},
+  {{ 0xc13c9dba4f8be42dUL, 0x1cca2ee592b1d11cUL, 0x379372804d8a29f5UL, 0x276522b21c3708bdUL }},
+  {{ 0x52f47e576fc46719UL, 0x39fc6479830af04aUL, 0xbae5710a931a4f9eUL, 0x043680d91698b721UL }},
+  {{ 0xaba64cc30effe5a2UL, 0x0c8b099b98e3cb7aUL, 0x6500b77b00b254adUL, 0x25ebcef30d356edbUL }},
+  {{ 0x6c4e9b3507e8af9bUL, 0xe36c63dde71b1c5dUL, 0x72c3b0a49d134dbeUL, 0x00d10a79da0c1c1eUL }},
+  {{ 0xfe5f72836205d99dUL, 0x592e43ffba778246UL, 0x39611afe07c56649UL, 0x1a43550f13c494e0UL }},
+  {{ 0x5c5fa063762b1ddcUL, 0xb91c4127bdefb183UL, 0x28a8e47183ff762dUL, 0x2148c2407e6f89a2UL }},
+  {{ 0x6a6d0928c3d36bcfUL, 0x0d367edf0b4b0764UL, 0x1dd50863e6d5ad14UL, 0x17762716234dc6dfUL }},
+  {{ 0xe13766c817a1f208UL, 0x17ebdb120ee9ecdcUL, 0xacac8dc1c94c9390UL, 0x194823ee6aed50bbUL }},
+  {{ 0x53b5dd839254771aUL, 0xe442d6017464c919UL, 0x41a80bf3198ac6fbUL, 0x1f8932667bb632c6UL }},
+  {{ 0xf31b41f1b04f7081UL, 0x9100aa7586516fd3UL, 0x256faf750484172aUL, 0x11f6efc820a00d97UL }},
+  {{ 0x651b68941ba41e37UL, 0x15fa797c628ba722UL, 0x3783c7f4820f6f08UL, 0x113eed858f85f464UL }},
+  {{ 0x434de9bc4c658112UL, 0xe49b6047061eaad5UL, 0xe3d1a8482cef24f9UL, 0x252507cc5508453cUL }},
+  {{ 0xd1835f441093fbd1UL, 0xe390000348719057UL, 0x64b1127b5205e4feUL, 0x156d7ddd936eb6bfUL }},
+  {{ 0x85bf7acd56d541bdUL, 0xcb2a8817669d0364UL, 0x6b63cecfaace142eUL, 0x1d3b3bf03384ab50UL }},
+  {{ 0x508525022b9f63e0UL, 0x23e38565b985ccb8UL, 0xbb22b995f2c209aaUL, 0x1669529b04a37b67UL }},
+  {{ 0xdc55defe63dcf015UL, 0x52e41bf460ae9a12UL, 0xb30291d171e177dbUL, 0x12e264d62fc17389UL }},
+  {{ 0xa5ed148afb467b7eUL, 0x3df03594ff8f2e1aUL, 0xdd6c55f58483dbf6UL, 0x0786ea9960a5fc36UL }},
+  {{ 0x09a157c99e39bca4UL, 0xdf733d917718a0efUL, 0x9f4a771f2b1feda4UL, 0x15b2c407f4c062e6UL }},
+  {{ 0x1c9f7b3cb9117e92UL, 0xf582438a608c212fUL, 0xfd7009f231032032UL, 0x2289476d1034ae65UL }},
+  {{ 0x109187c7be834829UL, 0xc5d8abc6f7b5c946UL, 0x7b50445ef14fe9cbUL, 0x2b16afd781221038UL }},
+  {{ 0xff9dff3373d24a91UL, 0x67735b7d5596dfc0UL, 0x49eca980e75c4510UL, 0x03c38cbc7ea123b1UL }},
+  {{ 0x3a646c106e7c564cUL, 0xa98f8a942d6e6e5aUL, 0x27aaf4eb93b196fcUL, 0x01a641eeef8daa7cUL }},
+  {{ 0xa36381680c6dbc8bUL, 0xa5e242f1b9eabe76UL, 0x8fb937351d6c215cUL, 0x1ef2bbad4509079bUL }},
+  {{ 0xa5410c0ea764cfd9UL, 0x37f48a0c0a40e9f9UL, 0xcff4c2fadf612276UL, 0x24f6a673e6626179UL }},
+  {{ 0xdc9e68b406a6cebcUL, 0xcdbd7574747f5313UL, 0x9618f57d08253f1eUL, 0x209744e4ffb8b013UL }},
+  {{ 0x91ed530e014cf09bUL, 0x113f06b9ffe521c7UL, 0x53d822af08b7eb13UL, 0x2933b83b2ae7d51dUL }},
+  {{ 0x9220562c261fdab3UL, 0xb68cbfef87e750cdUL, 0xa117499fe239e2bfUL, 0x1cac4a2733cb5402UL }},
+  {{ 0xb70444f75dc44674UL, 0x2a28008a17f7386cUL, 0x3d3881f83a7d1045UL, 0x03a8aec91204b7edUL }},
+  {{ 0xeb4b4b9b76d0e090UL, 0x8a47241c498745dfUL, 0xf4ddecacad1c0717UL, 0x0e96f44c94936b89UL }},
+  {{ 0x13213e09c8a08224UL, 0xfa36097696e06595UL, 0x303fa3bac5887a6cUL, 0x0150d6ca6982cacfUL }},
+  {{ 0x6dca002a2ebbca2dUL, 0xcbaa3d436daeb8bbUL, 0xa7f3c1100ceb6b19UL, 0x08f60aeab94ccb26UL }},
+  {{ 0xe063c1c1dadb0d6eUL, 0x2fb79ec395b0bbf5UL, 0x87d775d2651e88f7UL, 0x2cff94973af2c0c4UL }},
+  {{ 0x2f88fc9e3247d403UL, 0x5889d194f1e36e5fUL, 0x3ab706e6f1a6c329UL, 0x14d82777d1b7d57fUL }},
+  {{ 0x1afc5229061fa03cUL, 0x5d526466dcfdac5bUL, 0xe74b827f53b9c1feUL, 0x2a1db5dc1c36fc4cUL }},
+  {{ 0xfaa17b9fb22b20e5UL, 0x54a765f35d08b99aUL, 0x83674f7e32b2e2eaUL, 0x2b5f641c17cba224UL }},
+  {{ 0x520f5b8a630e5310UL, 0x5167043434bb8790UL, 0x1cf318eb63836f5aUL, 0x0c587aeb64177955UL }},
+  {{ 0xd9c520c4f2136722UL, 0x8c11e86870031e3eUL, 0x3b78d06c891eb362UL, 0x208a0f0d90f6a379UL }},
+  {{ 0x2761baba5d950a44UL, 0x6ad1cb31ea7726f5UL, 0x66396fbf7e79ee0bUL, 0x054ae186296de0dcUL }},
+  {{ 0x1a1eb4e99da0f5dfUL, 0x4cd89567db78a3d8UL, 0xde1a8d578eae17e6UL, 0x268f2861ff8635eeUL }},
+  {{ 0x53c31bd4e7539b22UL, 0x701276389275d897UL, 0xbb4267a9e486290eUL, 0x062553d28e8af003UL }},
+  {{ 0xe2b98648258ad455UL, 0x5398463b3c006c55UL, 0x0c04295de073b47cUL, 0x236f480aa98648adUL }},
+  {{ 0xc0a060c5dbb196e0UL, 0x23b967a42be2eefeUL, 0x7987170baa8de021UL, 0x00c529280c80dae3UL }},
+  {{ 0x78f443b66cabdb5bUL, 0x36f6f21177894420UL, 0x09f904d4caafd3aeUL, 0x04ec1592e2584c6dUL }},
+  {{ 0xcd9f323a6ff10ec1UL, 0x792e2a89ad2ec213UL, 0xe91e5eceac19bcb7UL, 0x1506f26dc266816eUL }},
+  {{ 0x1b73dcd24f4f1796UL, 0x11cad79087f64a58UL, 0xdcecdbab0c5be87aUL, 0x0ff285e486761733UL }},
+  {{ 0xda247565ea505c75UL, 0x62444af118814702UL, 0xa2cd5472493f1878UL, 0x088f4a59624855b7UL }},
+  {{ 0xcd93155f67cdb2f7UL, 0x2ceb27376c2fe958UL, 0xcc9aa2fe5165a961UL, 0x0d9320ddec26b8ffUL }},
+  {{ 0xf06a5422bd0aea80UL, 0xbc58509244383862UL, 0x5c87c5e8170e9374UL, 0x2d77cd8b0c8b02aeUL }},
+  {{ 0x45da9edbcf487badUL, 0x9b1a01f13373e2a5UL, 0x76e9796a2eadfe3dUL, 0x0bbda1ebcbc73e66UL }},
+  {{ 0x46739707a4cc3731UL, 0x4c487667e47e8ed0UL, 0xee58b0b4d7bb05d1UL, 0x1cf2c587812459aeUL }},
+  {{ 0xabb82eb2aa452a62UL, 0x7b0a22107d9a791fUL, 0x5a043e50ed27ba0aUL, 0x2b8ee58b18a6dad6UL }},
+  {{ 0xf6fefd84f8ffbd86UL, 0xb7d588712626705cUL, 0x99afa39af28fd00eUL, 0x2ce9e22262559bceUL }},
+  {{ 0x9b624243151ef7c3UL, 0x1e4b24f2a67c3fe0UL, 0xce8ecd9f9d3f4c74UL, 0x236059e7a03d19abUL }},
+  {{ 0x7ed055a42952c5b8UL, 0xc18fe4ebde46c24cUL, 0x291c94f44d39d65cUL, 0x22bc305c2f37e1cbUL }},
+  {{ 0xedc422bd3350a7d7UL, 0x960b5999d6e08625UL, 0xf3c4444dbba05f6dUL, 0x0fb20d844c8044f6UL }},
+  {{ 0x57edc0de2efc8743UL, 0xd94ff72acbf4cac2UL, 0x87bc218e5a744339UL, 0x073d05251a7d9ca8UL }},
+  {{ 0x8e4e99ba28d3a42fUL, 0x9a46ce41d64de1d5UL, 0xe43eb13a05bd514bUL, 0x1b36295408e50f39UL }},
+  {{ 0x90f7693ba4a8583eUL, 0x5894e51f96cc68c0UL, 0xa984f774f6f500aaUL, 0x13fae71b9fbc2a03UL }},
+  {{ 0xaed436e07c971ba9UL, 0x435f030df3665ff0UL, 0x4c6c184ad2d033b9UL, 0x074f70cbd6913201UL }},
+  {{ 0x263a297d64166578UL, 0x282e5e78729f398fUL, 0x1e201a6b3e83e8b2UL, 0x2e19016901af4527UL }},
+  {{ 0xf08c092ce050f8acUL, 0xc43cd4fb4c76f302UL, 0xa75331b4064ddc14UL, 0x0b12ed5bd8f74808UL }},
+  {{ 0x0ab59b3921a442a0UL, 0xfcfe4d1d2cdbb030UL, 0x927a3592442ce40eUL, 0x0f086185b8ecff32UL }},
+  {{ 0xab206a8dec4cd254UL, 0x1ab37efcdfdff49eUL, 0x324c185cff37e41bUL, 0x2b9214fd2ed65d5cUL }},
+  {{ 0x834d1963976dc1ccUL, 0x80c08172135abe34UL, 0x3022f36c471f1ebfUL, 0x12233378227dcfa1UL }},
+  {{ 0x3b87860f9d4087a0UL, 0xd141b2dadb6e7177UL, 0x52ebcbc375a9d5baUL, 0x07bf6b51ce12a7f8UL }},
+  {{ 0x6173324498ad7abfUL, 0x09bc8348fb0b5409UL, 0x28c610a617504b90UL, 0x1950cac7442a764dUL }},
+  {{ 0xdaa1397cf478868aUL, 0xa213ca178f9cccecUL, 0x8d63a8b0f5785273UL, 0x129f665742fe82deUL }},
+  {{ 0x6c00ce8061175604UL, 0xf53fe69d215d3029UL, 0x229896a83d1e6607UL, 0x2e4d54f203aa6408UL }},
+  {{ 0x56718a82871e652dUL, 0x6107fb0effa4078fUL, 0x00766efbd636f527UL, 0x2120fcb8ed825c78UL }},
+  {{ 0xac7e6760fd8889a2UL, 0x44bcc4031fd0cbaaUL, 0xd489b1ffcd9b2a3dUL, 0x21d88141e7ef615bUL }},
+  {{ 0xf1f7e384d4f2385fUL, 0x4c2ead311363ec41UL, 0xa952b1c4184b3e0bUL, 0x287351e3f8109e01UL }},
+  {{ 0xb4bedd787e68bddaUL, 0x93c7615a547ca32cUL, 0xfaa5475f3d89d0d4UL, 0x2225161968182131UL }},
+  {{ 0x34ab1dfe8b02e473UL, 0x65d13d356e58a6f7UL, 0x6cdd7ab07ee51ee6UL, 0x03e9c053228dc054UL }},
+  {{ 0x9019cf3566d29f5cUL, 0xa0b62df8e6c7cca6UL, 0x0f154b36ffb09bc2UL, 0x0a5193cd89d57751UL }},
+  {{ 0xc049e539eca4fc43UL, 0x00179d99610b4735UL, 0xf7d09bb6dcacbd46UL, 0x11135ac324932d87UL }},
+  {{ 0x3ae8390352b1496eUL, 0xe1e87efad59c8aa1UL, 0x9ce208ba7c7393edUL, 0x16e20689ebf8c4bfUL }},
+  {{ 0xfd7b90ca4453ea99UL, 0x5a2541da4be27e78UL, 0x198ed2e602a345d9UL, 0x0a0352a0b6dee62bUL }},
+  {{ 0x48bcf81d597b462cUL, 0x985e8437db57b3b4UL, 0xb585f3b82cb2dc5aUL, 0x06721935312734c7UL }},
+  {{ 0x23b9b8c27df3b128UL, 0x3428aef51157579fUL, 0x022914148b954037UL, 0x10a9fc4dea7e36adUL }},
+  {{ 0x2ee4beec154691aaUL, 0xd6a39d15ee3ce9a7UL, 0x2ab13a690c278554UL, 0x18ca029c113373f3UL }},
+  {{ 0xc57f1ad80987c5aaUL, 0xc3f2089a0b05ece8UL, 0x764b8f8f4f591b73UL, 0x17c54a28ed083cc9UL }},
+  {{ 0x1a4e389c2efd0e69UL, 0xe00e9c0a9130d96cUL, 0x0804ad60cac4b9b9UL, 0x2f54b2907ca5c26cUL }},
+  {{ 0x9ae5d6b92d6bcc47UL, 0x24c1ab32e479c43fUL, 0x641d9acd9d89457aUL, 0x039256dde340c673UL }},
+  {{ 0x909e7297848f2daeUL, 0x448f8aa9b586f090UL, 0xbb91255df9e84ff6UL, 0x0e06d7816556d510UL }},
+  {{ 0xabb49dc0641c7609UL, 0xb1f5d965c450ccbbUL, 0x68d9baf6c545ec1eUL, 0x03449a73e8203b4eUL }},
+  {{ 0xcfc851114a61c5afUL, 0xcf1a1611a209d5bdUL, 0x8a1f6b058c7b90feUL, 0x0bba4daefe01559aUL }},
+  {{ 0x1891fb3b8429f503UL, 0xa577ada8aeb6781fUL, 0x4cff3ab63f112fb0UL, 0x00ecc67b6d95e240UL }},
+  {{ 0x598eb6b9c4a61bb0UL, 0x13e704543396e3dfUL, 0x887a2db31e4d2dd3UL, 0x07f8a1fc548b2854UL }},
+  {{ 0x57344f3ff6350589UL, 0xa8f1091d55eef50cUL, 0xecd1ad519e525e47UL, 0x01cfdc06159fc200UL }},
+  {{ 0xa4fac874f187931dUL, 0x4e6fb03fae856025UL, 0xdeafc6216434a458UL, 0x29f92b365e69ebd7UL }},
+  {{ 0x10394edcb1b48c39UL, 0x8d6246cb5ce4d86cUL, 0xb8be16b8b9a1f77dUL, 0x0fb08e7af82faad8UL }},
+  {{ 0x88e92cf59c2d4bc6UL, 0x14a4b26569e8856cUL, 0xaa4aa3e1d8bef512UL, 0x28fb8fc060a788e0UL }},
+  {{ 0x83b680259dde7d64UL, 0xf3293740a88f319cUL, 0x8cdfa6ba9c727a02UL, 0x2b27ef410906f0eaUL }},
+  {{ 0xf0e0e6dda18c8eefUL, 0xf3f1204e7dfaf131UL, 0x6ae183a15ad61058UL, 0x13fdd1dd66fa4a61UL }},
+  {{ 0x16eca2876538faa7UL, 0xd591412d41a197bcUL, 0x04a2f54ab99d8edfUL, 0x010929af18a2bf84UL }},
+  {{ 0x8e992b886d148194UL, 0x0fb7eb1214c17743UL, 0x169509bc71c68955UL, 0x1a9cdccd228a0e5bUL }},
+  {{ 0x09e0c2b9e955c2b2UL, 0x13b8dcde09f1ec38UL, 0xe54c32cc6f95d471UL, 0x2311d05c14089c7cUL }},
+  {{ 0x7ae9c386b58b6f98UL, 0xc36b3671ca8633e9UL, 0xbe0bd15c1422303cUL, 0x296de174de768beeUL }},
+  {{ 0x60345678a92dc363UL, 0xe67835c7463a8776UL, 0x9d0059dd350c27c2UL, 0x26f59253c78f1cf4UL }},
+  {{ 0x209a3222a31f5720UL, 0x0afa2f28a7ebbd15UL, 0x6e6e747138f6351cUL, 0x0e8dbe4d8c2d4c77UL }},
+  {{ 0x13c9853f921090f0UL, 0xfa796e8494b55803UL, 0x4193f23707dcbfa5UL, 0x0009d92696132b3eUL }},
+  {{ 0x66a459466e6a070fUL, 0xd54cdc7a16b8c3a7UL, 0xc9ef2135f4e34572UL, 0x0182a6f050e449bbUL }},
+  {{ 0x978c874f9b554f6fUL, 0xc6474536f9d67743UL, 0xba5043263a2fbbf5UL, 0x1922a8f0bd677258UL }},
+  {{ 0x5fa26761dfd7214fUL, 0xf210f4817547970bUL, 0x0ab8729b97b69937UL, 0x29354c8ffaf88095UL }},
+  {{ 0x8578dc6efbf27dd3UL, 0x8847c2f7addb788cUL, 0xe6560e57da0b4ee3UL, 0x00f5ad0cf43f1828UL }},
+  {{ 0x27c9c4ff85725fe0UL, 0x237a891b5db22974UL, 0x3a4b20f5b7e75bf2UL, 0x0449a87518916602UL }},
+  {{ 0xcd8edc01a5c025a3UL, 0x8b92f9df74d0d503UL, 0xa0ee5b2647c819c6UL, 0x0fd954f6cdbee372UL }},
+  {{ 0x9545ca3b77fe6c69UL, 0x32c1aa8fbeafd7efUL, 0x94c34aaa7f66e362UL, 0x215b2ad3aeac4f88UL }},
+  {{ 0xe1f289e1ffd66f71UL, 0xa6377c5e76c9570aUL, 0x2ddb7b0d72c28bf4UL, 0x07b279e0fc17d4a9UL }},
+  {{ 0x69fa3a4b473e9048UL, 0x73bb396531d074e5UL, 0x61a1472d4a132036UL, 0x1b41cb9b7833be39UL }},
+  {{ 0x29db532a69792a6dUL, 0xa0ce2de96f8397ecUL, 0xb782d25da823ba8fUL, 0x1293c09a8105acb0UL }},
+  {{ 0x90127e8f385968faUL, 0xc464d24f5f0f0a0eUL, 0x18e510f37f302109UL, 0x2c4207a9cbf60d65UL }},
+  {{ 0xb82aee092e8bad02UL, 0xe6157055f70b742dUL, 0x6334fdfe13623f3fUL, 0x24891dc295640f65UL }},
+  {{ 0xa8b4b70cfd8d09a0UL, 0xccb256f115ebc4fbUL, 0x679f1df8f5613138UL, 0x0452914f09288267UL }},
+  {{ 0xd382aa73a27086c4UL, 0x37e04877f608aeb7UL, 0xbbf74e84a4e7fcc7UL, 0x0ec0c9d9ffa29127UL }},
+  {{ 0xd3665ddc68492d69UL, 0x7667e17762d19c0dUL, 0xf093bd0e281bc5f5UL, 0x0d76bb7494eea9b4UL }},
+  {{ 0xe968304bc12cc02cUL, 0xbe733136b5ec9951UL, 0xc7290ee258c3ade2UL, 0x0a3fd5cb38534e48UL }},
+  {{ 0x84839eba38d8bbe1UL, 0x50791c784723d948UL, 0xee711fc8e36c0c21UL, 0x156da4f6f4857511UL }},
+  {{ 0xa033fc34b8fb5b70UL, 0x85e39ef55bdd3255UL, 0x754601c2dab5111aUL, 0x0efc894b4ef82cbdUL }},
+  {{ 0xa7065da9ae1f5ed9UL, 0x5b0a5da35cd05722UL, 0x31b4d2d9858153c6UL, 0x1c61c015af24922aUL }},
+  {{ 0xf2a4302d71cc150bUL, 0xb51d291c90a488acUL, 0xc87750b1631bf386UL, 0x22d0dabf649b7afaUL }},
+  {{ 0x2aab29e0b8b0da8dUL, 0x66116fada29b172bUL, 0xa149cb51fa5e0340UL, 0x19e8b05b79b6244fUL }},
+  {{ 0x7491bbe98cd59391UL, 0x5cd9f0862c3d6711UL, 0xbf886d010e0e6d37UL, 0x2ead250f13de5619UL }},
+  {{ 0x3f4b4344f5965c69UL, 0x10938f4743ebc574UL, 0xf4accdc37abafab7UL, 0x292ea7b69086e460UL }},
+  {{ 0xd99f857d56068544UL, 0x5c194b0dd8cc35a5UL, 0xd850e67984d074deUL, 0x01e22fef08735aceUL }},
+  {{ 0x9628e43974a3686aUL, 0xb4a27004abc8b952UL, 0x1391d0bccaa32641UL, 0x1b578d99f05fa550UL }},
+  {{ 0x9b3ec5a7d6e24c0dUL, 0x42f1ab76f236db50UL, 0xa9e3688ba8d23bceUL, 0x0ab2eb1eaa639ae0UL }},
+  {{ 0x13068370a0e4705cUL, 0x872e911c03f0f7b8UL, 0xfeeb2b783efc6dd0UL, 0x2a7e887cf098f737UL }},
+  {{ 0xf37a4da22aa8135dUL, 0xb2dcefb4ea1eb8f0UL, 0x21f61000f24c91edUL, 0x0f1c19ee38aa7466UL }},
+  {{ 0xf07873a08b24f32aUL, 0x404d8400f740da12UL, 0xd77ca965c7fe50d7UL, 0x08d246933a9cd842UL }},
+  {{ 0x36703347aeda4ed8UL, 0x7fd2dcd82cb8765dUL, 0xf5a78256d360153bUL, 0x2c25f3a7aeb88347UL }},
+  {{ 0xe115ee1c11415364UL, 0x059758348386addaUL, 0x9b2932b14af6442aUL, 0x1afbc238daa4b819UL }},
+  {{ 0xf34d928909674be8UL, 0xbd951e99652e91feUL, 0xa5a5d3ffd310f48bUL, 0x0df969a646d0c6dbUL }},
+  {{ 0x82d81fb1a0019ab6UL, 0x6e2d2cfd894947d1UL, 0xea4e5bb683ed4887UL, 0x1be0ed69eba92228UL }},
+  {{ 0x39e99c44ff471420UL, 0x3459b6ba6fb4de4dUL, 0x8a369b9da140a461UL, 0x13aa2ef9dc65e971UL }},
+  {{ 0x8a3c1f6d6f6cd702UL, 0xe8d10cb2de3e4480UL, 0x88b5272f6b0e0a56UL, 0x2024f48c7a5111ddUL }},
+  {{ 0xb705d441b4b14013UL, 0xdfc438af4a8e3128UL, 0x836c7407f656a7a6UL, 0x2c257b1544139d76UL }},
+  {{ 0x33225a3d7eb80c61UL, 0x95ba9e1bb70fa7afUL, 0x579825f28c078136UL, 0x0ceb846dceff32fbUL }},
+  {{ 0x9aa199de8567a30bUL, 0xa400e970715195d7UL, 0x475ff5734a7129ccUL, 0x211b5a4b4d0e217fUL }},
+  {{ 0xf47dd80bd7096207UL, 0x8fe523bae734f8e3UL, 0xe246ebab1b9ebe65UL, 0x2c3d5255001d885aUL }},
+  {{ 0xc92db829c805ec16UL, 0x0d9fb3323b679ba0UL, 0xc6c297097478deb4UL, 0x1f34e81331825ebaUL }},
+  {{ 0x26e07ace47dfc73aUL, 0x7df341aee463ed6dUL, 0xfe168ec560dcfa7fUL, 0x08d2e6ffc55ad52bUL }},
+  {{ 0x01e50ede2eebc621UL, 0x7a9c398a60901596UL, 0xb84125f80f2c43f9UL, 0x127b64b615d0e216UL }},
+  {{ 0x85bfba33779358a8UL, 0x46ffcfef16a7db2dUL, 0xff889ea89bcb16e2UL, 0x21167d1fbafbbe8bUL }},
+  {{ 0xf950688ba16ea00aUL, 0x11504e8f6838bcdbUL, 0xb1ad703f8d95591aUL, 0x12d644e74fd35433UL }},
+  {{ 0x90e5a4800281ece5UL, 0xe3ae6151ddc23fbaUL, 0x510d245fbe70f299UL, 0x286e90ae8058ed27UL }},
+  {{ 0x14d0d4eb8f5711b5UL, 0x5249f9e58c8d8099UL, 0xfff4ffea87273aabUL, 0x060f5b656937b945UL }},
+  {{ 0x943544d16aef7923UL, 0x0b1715dda0eac321UL, 0x83d3d388dedd8c9aUL, 0x01c482c5444d9f6bUL }},
+  {{ 0xe5f469e83a98481fUL, 0x678b716e0ad5bdedUL, 0x83392a58affc6c42UL, 0x0e7224dddac0c530UL }},
+  {{ 0xaab682c0891028c8UL, 0xc6abd201927c80cbUL, 0xdbeae37fcc9f8f3bUL, 0x282915fb0deb964aUL }},
+  {{ 0xa3f4bbf76408e167UL, 0x7db84dd699bf3079UL, 0xe1c9f1cadb2b29c8UL, 0x006839fb184da434UL }},
+  {{ 0xfca3815fe6fe227aUL, 0xcb7de454ff536967UL, 0xcc7f8ef65803ec7aUL, 0x261fc8ad7cc40cddUL }},
+  {{ 0xdadaaf3393a20276UL, 0x039562b3fe42d131UL, 0x84c02a818606fc82UL, 0x0537f53e390e6bf1UL }},
+  {{ 0xabf4bc7c7874770fUL, 0xb4aab96069202eedUL, 0x1ddb517a5595c2ebUL, 0x1fb290b4d9b41916UL }},
+  {{ 0x384f8a901451a9daUL, 0xb2a00b9053e1f42fUL, 0x3af6382fb912c09eUL, 0x13991bedd668808bUL }},
+  {{ 0x6bf8dae168e67f9cUL, 0xabff30d7133c57fcUL, 0x93eec44ec9b84570UL, 0x28c49c9cbe395367UL }},
+  {{ 0x236a4f6d81ea02a0UL, 0xd1d6b297e046966cUL, 0x5a81aed97bdae851UL, 0x260ee0e186d93128UL }},
+  {{ 0x10840e53b33b4ab1UL, 0x5bdeab4d82e611afUL, 0x008432a8e1f67108UL, 0x0299d722ea254bfcUL }},
+  {{ 0x50f35cf4c46b5ce3UL, 0xe0356f93ca3f7451UL, 0xb43a12f570cc8530UL, 0x1d78061ce8ffde45UL }},
+  {{ 0xf3b6d8d77fd86484UL, 0x077e2ba8702b4fb1UL, 0x4f2c9608c6f02e16UL, 0x241f3cee9a58bb1fUL }},
+  {{ 0x064c97176e693c02UL, 0x8f13ac5f3dabbd06UL, 0x6f98c1b52b5005dbUL, 0x15e8d7256ed8d4abUL }},
+  {{ 0x5c7d7480c271d977UL, 0x8d5f301f9fbbcd10UL, 0x90b1b7b2f2075feeUL, 0x2c8c322b0209e9b0UL }},
+  {{ 0x65fc627cc0e2d114UL, 0x1db40f2ade37ac75UL, 0xfa64afc6482be29cUL, 0x1decc7e46f863454UL }},
+  {{ 0x0a1023d835c48077UL, 0xf6af260dcc004793UL, 0x3f389f2292603d57UL, 0x019b054257906f79UL }},
+  {{ 0x24b0a38917f4d24eUL, 0xb9f248f60a67b3f9UL, 0xbb3e2f2d4efdbb7eUL, 0x09cea22204b357b1UL }},
+  {{ 0x791868276315b6e7UL, 0xf20490669fef4f33UL, 0x08a38972b17feb8cUL, 0x2cc7f85cd99559a6UL }},
+  {{ 0xf22ef54259dd4d98UL, 0xe19f6718538f23cbUL, 0x032429f384370f23UL, 0x1d177f5db3f2893bUL }},
+  {{ 0xba5be1570c6d4311UL, 0xa022c6e49d6c4cadUL, 0xff2556fc93e14d77UL, 0x12ffb4b6452845c4UL }},
+  {{ 0xb474e90e4f95144eUL, 0xe5ffd070666fdb24UL, 0xf3cc8ebab35768c9UL, 0x07207d1fe47271f9UL }},
+  {{ 0x2f5b78b5bcf4600eUL, 0xec49c4f35d1d7da2UL, 0x85544d645526ad49UL, 0x10369cdd9f385543UL }},
+  {{ 0xb258984a72d2642cUL, 0x8b6836a13d476377UL, 0xd01def995f090bcdUL, 0x0e6ac6bc9f57d1e8UL }},
+  {{ 0x2a36db9bcf291373UL, 0x2055478a9a79abcbUL, 0x0e55cbe2407dbf7eUL, 0x1f4344d47e942c96UL }},
+  {{ 0x95e3003b22188bfeUL, 0x417ca5cf3d085b15UL, 0xc7260f57d8663f82UL, 0x073fed0407b00e05UL }},
+  {{ 0xa38a8f7d1d27026aUL, 0x1db4b099efe74d4aUL, 0x0310a733efc534efUL, 0x10994bdb89daa06bUL }},
+  {{ 0x1dd5ebf95ca60ec8UL, 0x93da305490ead87fUL, 0x623c1a5dd3ef46c9UL, 0x2ea894aef9067025UL }},
+  {{ 0xeced882a4bb41e6dUL, 0x4c09f296b1c40e15UL, 0x3448e11e76ba05e4UL, 0x0932966fe27d922fUL }},
+  {{ 0x1036a57728625f6eUL, 0xc1c009f4db5a6b9aUL, 0x823a36683a2a5ec3UL, 0x1d4a9b9df893d164UL }},
+  {{ 0x06d2b7746284898dUL, 0xc2e207d9469fb603UL, 0x5b6810c58135443bUL, 0x2a83f8cbd0b1cca3UL }},
+  {{ 0x1c4f7f4c8fbe76acUL, 0x0cef62237f0420cdUL, 0x475c344e2e44d946UL, 0x2b9128f8034452ffUL }},
+  {{ 0x1230f17f4c2322d1UL, 0x796c7a329a43eaffUL, 0x879a966bd2050dcaUL, 0x245cd213a163e97eUL }},
+  {{ 0x34d5f40a9f124fd8UL, 0x2ff73cb66c7ab6d8UL, 0xc90ff67e518de2c5UL, 0x14bb766c31f92505UL }},
+  {{ 0x84ce4a08651e673fUL, 0x23a9a6062cad9f28UL, 0x0ff38820b239c4daUL, 0x02bba678f1caa599UL }},
+  {{ 0xd1447c250bc1b77bUL, 0x857016811092d21fUL, 0x6ca2d6b762fc5af9UL, 0x2a55cd627a6890d9UL }},
+  {{ 0xe325cfc134c5d9bdUL, 0xdd83847fd7aba39aUL, 0xb4e398e71673fb89UL, 0x280213c7a0e0dca4UL }},
+  {{ 0x1afa9efeaf918006UL, 0x3c8aa18feeb158ffUL, 0x3be7719de37092c3UL, 0x28bc39f2ae0419d5UL }},
+  {{ 0x8a3505605b81e853UL, 0x17d17c98b993d639UL, 0xbc16c35cadb1fc31UL, 0x0b5206716d7984b3UL }},
+  {{ 0x2246e2183d0ec47bUL, 0x330182763b405af3UL, 0x2bc388fd0b6a8855UL, 0x20cb75fb2b2a96c7UL }},
+  {{ 0x8e928c33d44c9941UL, 0xcdebbb347301a45bUL, 0x3e1245b58450ae00UL, 0x184e3da2a256e5faUL }},
+  {{ 0x23172d9f3ba15dc1UL, 0xe7692ab8c0910a25UL, 0x64215b25cc21d449UL, 0x217552faee4d82b1UL }},
+  {{ 0x7687d794824138e9UL, 0xd7733ced39b3fc83UL, 0xe47983c3ad2238caUL, 0x1fdbeae3aab98694UL }},
+  {{ 0xf53f16fd081b5853UL, 0x7fd26851716cbda0UL, 0x3272c1c210409a0dUL, 0x078c4e2cd4347476UL }},
+  {{ 0xdb25d85fec9e04e3UL, 0x04c0513263a330ddUL, 0xa908d94afa3c6aa8UL, 0x17b05cfb6cde7c2aUL }},
+  {{ 0x740cb1f916403346UL, 0xb1e9352573e92d90UL, 0x5bd309681ce696ffUL, 0x04a4600d0d6bcd2dUL }},
+  {{ 0x0476d1aeac09c896UL, 0x88c0db4a57ca2b4fUL, 0x4d8bb6db37734a8eUL, 0x28341f766f1d9c70UL }},
+  {{ 0xab82122374909ca4UL, 0x13432e8d60c31e28UL, 0x4141ff772e00fc3bUL, 0x1be37cacaeea19fdUL }},
+  {{ 0xf71c51a3443a787bUL, 0x9c59a805dcceaa94UL, 0x104e40f3ce8d341dUL, 0x0cad0aee20ab2389UL }},
+  {{ 0x1eb6f3b78823f93aUL, 0x9193b2b18dfef4b7UL, 0x4179e141db65aeb0UL, 0x0d88e8585878e98dUL }},
+  {{ 0xedd239662b508d29UL, 0x42ac95c330835310UL, 0xe220d0d47126a380UL, 0x051c1c2c2d0d60d7UL }},
+  {{ 0x4202cb6636bf5c71UL, 0x74b1ad036940269cUL, 0x035606ff560a0cd3UL, 0x2a29c040c870cae9UL }},
+  {{ 0xe00f613fda6ceb43UL, 0x7eb29c6b25a363e1UL, 0x075c3c71c3519cd9UL, 0x0196365a417b7095UL }},
+  {{ 0x2cd6f22538c498a2UL, 0xe4bc2b60cf462b75UL, 0x57f689a5f2f477fbUL, 0x0cc3126c2d14d9ffUL }},
+  {{ 0x8a6dba94072b225fUL, 0x29daf0ba0b88614eUL, 0xbeae3e80232274ddUL, 0x04b8f9d287934653UL }},
+  {{ 0xd4542a33ecc1132fUL, 0xc0099e17bdf520deUL, 0x4aeb0ac475598c8aUL, 0x219b72aee25be6c8UL }},
+  {{ 0xf55b97d0ef42ff68UL, 0x2c924fb044fc3c25UL, 0x4bbe8f242860a29dUL, 0x0414aeeb0a0cf60cUL }},
+  {{ 0x4ab1d980ca3fcdfcUL, 0x4a50966d83bc9a21UL, 0x385930d83d77d173UL, 0x082549b5719d2579UL }},
+  {{ 0x9879a6845723461dUL, 0x08fc84f5262daa6cUL, 0xdced61277f165344UL, 0x04e04d8011365984UL }},
+  {{ 0xc2ec0c1ef805cdecUL, 0x6ad0f3183726c7e7UL, 0xae91af894385d25eUL, 0x2b9d4e146bb552d8UL }},
+  {{ 0xbdbfa88325780284UL, 0x880c7aba2f64a6d2UL, 0x8941ea5292718189UL, 0x0b0a4cdd77c7dcc5UL }},
+  {{ 0x2e3dc3e7e9ba8fcdUL, 0x7e601b46ac98224bUL, 0x82c2e84411b7486eUL, 0x05f757cb1568a210UL }},
+  {{ 0x8a229e11ccfdb929UL, 0x6a084ba6539efca7UL, 0xaca074417659ea33UL, 0x1231fee08f3f30c5UL }},
+  {{ 0x5048622d7d2a9b7cUL, 0xa1d5a7060567b18eUL, 0x5aeb9bbfafe071a6UL, 0x2f1f4ba299cb4928UL }},
+  {{ 0x77dfd6bfbae63666UL, 0xd5a03e2357b77dc1UL, 0xc1c796d301a413e7UL, 0x2c040b1f06b5e0c0UL }},
+  {{ 0xbed0cab678a16ce6UL, 0x5cc3e4d88c0218cfUL, 0x1e92031fdb52158dUL, 0x07835e6d983fc2c2UL }},
+  {{ 0x27fb6e29e1b5c9b3UL, 0xccb820a1169d7c1bUL, 0xa9cca04f8b06af9eUL, 0x2ff00d902baacd77UL }},
+  {{ 0xa929e5152cf0365cUL, 0xb54c65600d4ba398UL, 0xf2ebd5e1fc690541UL, 0x09b4364c3a1a3da6UL }},
+  {{ 0xa32daa952cccd1a7UL, 0x3cb4d3d54cdc6a0bUL, 0xf85b45cac1170dbdUL, 0x039fdfd8ebbc7678UL }},
+  {{ 0x1586e4f20a6641adUL, 0x4bbadd1170a08e24UL, 0x5ece433296526975UL, 0x2ae1ecb5f6e87810UL }},
+  {{ 0x1d9abdbddf3a67ddUL, 0x703d9555ea44ccd9UL, 0x6af32a61d4642da1UL, 0x094c5b00b21d4747UL }},
+  {{ 0x52afda6e268c7b57UL, 0xda69ef738e9274aaUL, 0x1e4386b019ce67e5UL, 0x2c40211922d899d9UL }},
+  {{ 0x7fd63789953dc267UL, 0xd117493c586b4d8bUL, 0xb125ca34822893dfUL, 0x13f736dd4c85cd9bUL }},
+  {{ 0x996c2fbb6d15d93cUL, 0x46aa640bf05069e5UL, 0xdb468fda4f592301UL, 0x1d54ea1593df7d75UL }},
+  {{ 0xfc940e9b8eb2921fUL, 0xef2713e7809738b0UL, 0x68632c3f82671e06UL, 0x027df5d67610c767UL }},
+  {{ 0xe010a78bc36a10cfUL, 0xe167b2d8ccd9a3ceUL, 0x080f31edd211af53UL, 0x2230d121c82a75a0UL }},
+  {{ 0xa11f6b5ad2ff9fe5UL, 0x8d84046c985ee327UL, 0x857b83d3fd504af3UL, 0x0987013b674a68ecUL }},
+  {{ 0x9c6b54e9163a944aUL, 0x524a2bbf0fa2532fUL, 0x41a407e00077880aUL, 0x044b511a48a2d523UL }},
+  {{ 0xb8c4ae3795180884UL, 0x830c0294c4484e02UL, 0xa45216629ae4ed51UL, 0x293a25f8ba802f4bUL }},
+  {{ 0xcf31b912c6e87463UL, 0xc993c29c88eec33cUL, 0xbda3245a15a2c9ceUL, 0x1bddc935c5fa8e11UL }},
+  {{ 0xa3230bcbd64c53a5UL, 0x5fb7dc8abd1cc12aUL, 0x1f0a75dc1a77c139UL, 0x1a314e8a6b9273dbUL }},
+  {{ 0xdc06d506fe8a5184UL, 0xac423f29e213b633UL, 0x3f1e9d9e5efc9408UL, 0x2eaea11cfa4371c4UL }},
+  {{ 0x70a06b1fbcce36e1UL, 0x5d9c7f7cb8c8a227UL, 0x4758ef1237cca7c4UL, 0x29eb019e1b4dd480UL }},
+  {{ 0xadb8a280cf5e3c95UL, 0x39403a8306f66283UL, 0x7ef252f4b09edea6UL, 0x228b10233e128243UL }},
+  {{ 0xcd3198ea1356e5a3UL, 0x3ecc01da61a6a669UL, 0xa2ce2722c7834cb6UL, 0x15a6091a5c14742fUL }},
+  {{ 0x0f7af06d161a3f5eUL, 0xcc91f43974e1a0b0UL, 0x31ed3fb80916c078UL, 0x23aef4309270adc3UL }},
+  {{ 0x53b64f082ca6dc5fUL, 0xb87ec77180303fafUL, 0x2d3633264c588eb0UL, 0x0d2c680deb89399cUL }},
+  {{ 0x561c3835840cfdeaUL, 0x6351602116f92e68UL, 0x55b1a69aac7824a8UL, 0x3027fb7ea08045c1UL }},
+  {{ 0x737a8076dcb81187UL, 0x59146a927746d4dbUL, 0x8ab8441a79486d93UL, 0x17e46e35905b2343UL }},
+  {{ 0x365bf6f6d27b40acUL, 0x24961313a41eebb0UL, 0x05bd94490ecfa17fUL, 0x262ce1391a519efaUL }},
+  {{ 0x68a6c7cf8678ef2aUL, 0x2e6e56764c29019eUL, 0xb198f56e8b6d9f5aUL, 0x1bdbb60859e16216UL }},
+  {{ 0x53b63361699c9704UL, 0x90e17724965e4709UL, 0x959be8f410dbb53dUL, 0x202790b4ac2c2377UL }},
+  {{ 0x8b7eac53cadfaf16UL, 0xd060c38539ad820cUL, 0x78ffa94aca678c0bUL, 0x2ff1f320507a54beUL }},
+  {{ 0xeb2db0d74744a673UL, 0x014efe1dcc45db5aUL, 0xf736f7807ef65628UL, 0x2914d845def65becUL }},
+  {{ 0x7260ba6a56954eebUL, 0xd265748dc009678eUL, 0x2f444ae0aa41a60eUL, 0x112d388ff662f5c4UL }},
+  {{ 0xb5380fbd4bf21757UL, 0xf64f64eecc012744UL, 0x19fa9bedbd3da597UL, 0x2af7fe248e2f5098UL }},
+  {{ 0xed47a0a927f2de6dUL, 0x3e417e0ea03f0a56UL, 0x31131e4f82c1a266UL, 0x1de0048e4a2f9d6fUL }},
+  {{ 0x876137497737cd62UL, 0xb25f480f15771635UL, 0x6eb6290b99ebd9f1UL, 0x144f4f467b395a6dUL }},
+  {{ 0x10d215dbc0c156f6UL, 0x0ff7753e83a8de86UL, 0x0b9e02a5994b8124UL, 0x2412d8ce17c273d8UL }},
+  {{ 0x0ae3435b50a2c662UL, 0x17cc480991943266UL, 0x4afe7e897fa295e7UL, 0x23a7cb941e677562UL }},
+  {{ 0xd5118a846cf3d690UL, 0xe7badb1ff2b66e5dUL, 0xd28ab9d6d20ee211UL, 0x1d2d0741e85e0129UL }},
+  {{ 0xd759ad82a8db81dcUL, 0x1f94559d86c71012UL, 0x90b7c4a2eb0cb561UL, 0x0e16ef9d9ee26c12UL }},
+  {{ 0x06de1bf3783cffe7UL, 0xac2361d4801a903fUL, 0x4f6a761139c826f0UL, 0x15551958699d0822UL }},
+  {{ 0x1507c6895fe9cfc7UL, 0x6ba89dfc42ea6f98UL, 0x8e21f7a21848e026UL, 0x1dc2cfcc9187a631UL }},
+  {{ 0x20a059e4093c8167UL, 0x3c8d116fdda055f8UL, 0xa78d05554975921fUL, 0x150f1999da25c4f1UL }},
+  {{ 0x7bca29e2b5e52f87UL, 0xfcc017b61108c97eUL, 0xff10e81d69c317aaUL, 0x1742e8589a4b8017UL }},
+  {{ 0xc5a88088cc741189UL, 0xc0fffbea99809b1cUL, 0xbbb3659f2bf35758UL, 0x18de88252447caf9UL }},
+  {{ 0x02042de07872f2cfUL, 0x8a6d1a755bd603b3UL, 0x543f44d222b5a143UL, 0x05b75ba7828ab755UL }},
+  {{ 0x3ce415fc08e1035eUL, 0x87437ce53dd7c56aUL, 0x4dbeb52c5b549578UL, 0x21f3abb7024fca27UL }},
+  {{ 0x4beb15da07ff8caaUL, 0x5c6d7be13eacacd3UL, 0x823339a42733fa9dUL, 0x0641ab6e800fb899UL }},
+  {{ 0x88d057fe33a12780UL, 0xfe5cec84c7e082cdUL, 0xbb27eb3e90e0fe25UL, 0x0cb29cfff1ffb177UL }},
+  {{ 0x4bad5569e8a44cabUL, 0x3b3b00d0f9ef1115UL, 0x12086a41bf7f708cUL, 0x2e312837ec24c739UL }},
+  {{ 0x3da88f09c4cad719UL, 0xd4d29ec498502599UL, 0x3bb91648d688c12dUL, 0x276ed60d434f7b1eUL }},
+  {{ 0x0d9dac681029ace4UL, 0xda7c0015cffdfa06UL, 0x5e4560c8e9e92fc7UL, 0x0ce9930eaa3cba1eUL }},
+  {{ 0xcdc278f43c749956UL, 0xea9ba00e49c7b738UL, 0x3f9e10fb3f5e21f3UL, 0x09028428aeff7c47UL }},
+  {{ 0x4f2a2c980cfe18b6UL, 0xddf1ca0693e38a11UL, 0x515f6f35aa9d0953UL, 0x1898b9433e740181UL }},
+  {{ 0x67be87317a5f1acaUL, 0xfe44860337e6ee0bUL, 0x952cfdd27bf54af2UL, 0x01a25bfaa15af888UL }},
+  {{ 0xcba49992acd770efUL, 0xcaae8529104e6da7UL, 0xa9e5945a23550769UL, 0x2459cb18f0427574UL }},
+  {{ 0x8adfeb621bbb693eUL, 0x3fa3c71321cad301UL, 0xaac098c61ac4240cUL, 0x22542d8ff46b7b88UL }},
+  {{ 0x9e2e9272be3dc2aaUL, 0x255e1b54c3582e96UL, 0xa0cb4830b583ebf8UL, 0x1cecf14d37ab617eUL }},
+  {{ 0xd7b29413cae61c6eUL, 0x74831c5b79cc0148UL, 0xa210f8e4a884a81eUL, 0x25098265fd5dcde5UL }},
+  {{ 0xc4c8dbaa8353be7cUL, 0xa01205e40545249cUL, 0xcd5265e162f73f90UL, 0x296fc1dff9973d1eUL }},
+  {{ 0x3c8c6c738528dfe8UL, 0x2a391c49670526b6UL, 0x446a1c6b11c4c960UL, 0x2326182f5a0c3b05UL }},
+  {{ 0x5dde8669b077008fUL, 0xf99b3f8128d6b511UL, 0x29eda2dfffc1f082UL, 0x2064860bc33e23bcUL }},
+  {{ 0x4437b947f2eb16c3UL, 0x15ac280e0c19697bUL, 0xcc1812fd92f7974cUL, 0x21a10cdd06d6c4e2UL }},
+  {{ 0x6acd3ab7c782a851UL, 0x0a23c96ab8cdcfb7UL, 0xa0c0e023ddc5eddbUL, 0x16ef87c969c9d187UL }},
+  {{ 0x5349e931103b2c3dUL, 0x7ba199dd811526bcUL, 0x8489ab8396b9141aUL, 0x15b09d087fc9c77aUL }},
+  {{ 0x08034fb67b608ec4UL, 0x0b9f6782b718a85cUL, 0x301bc7f2b079799fUL, 0x1df4c56d96a14a59UL }},
+  {{ 0x69eaef4e40333c35UL, 0xfbcb84a2f0f59921UL, 0x14e0aa9da218a3a9UL, 0x2cfc1a717e8a38b4UL }},
+  {{ 0xbb082769e5d5e4faUL, 0xfd439467c7c7f09aUL, 0xa773b7646c25eed1UL, 0x1299d67268b93840UL }},
+  {{ 0x9c4d1910fac4775fUL, 0x066f7f6c6f364af7UL, 0x8386e7251256a5e6UL, 0x00f4ece4a53bd6cbUL }},
+  {{ 0x9b2f7c8e88e2cba2UL, 0x2e4e744a218c4679UL, 0x5e89867bb0781b0eUL, 0x1baa3c16e5a004dfUL }},
+  {{ 0x2f2cdd11dd656f47UL, 0x185e343b9cde1b8aUL, 0xc5a5d049752fe4ceUL, 0x1710f9c60315a432UL }},
+  {{ 0x05b8a7813ae6f188UL, 0xb8484eda5aa595bcUL, 0xed38dc6b4e068e38UL, 0x132a460363a9ac1dUL }},
+  {{ 0x475b6c5f03777170UL, 0xf982758884abbde8UL, 0x4634f6da5f48ee66UL, 0x0f68fea76dbe099dUL }},
+  {{ 0x673f556cce3bf576UL, 0xedd416c51ed73f63UL, 0x5b0919667a7691cbUL, 0x2df0c54631aa0b7dUL }},
+  {{ 0x8baf56adf65165a5UL, 0x3c4f7b4804d346c7UL, 0xdd9cf07f4d3b61d4UL, 0x23f1e0a7c34727b1UL }},
+  {{ 0x912809749c72441cUL, 0x83e158b3efb3035fUL, 0x0679bb5ba90407d6UL, 0x1ed3f4bc50f3ad09UL }},
+  {{ 0x71edf1a563057b31UL, 0x9f5a57f6b01047e4UL, 0x47b3c2651e036c09UL, 0x299babac46f6a013UL }},
+  {{ 0x885824826cece01aUL, 0x69ace9a323693ff3UL, 0xb89b01d3116e572dUL, 0x0c9b81328af59265UL }},
+  {{ 0x2131d2bffba71adbUL, 0x798e196b2dedde5bUL, 0x4ab234553a0d2b5dUL, 0x12941ad85b96a83dUL }},
+  {{ 0xe66c8f8e3ec62be1UL, 0x816413aa5d52cca4UL, 0xbd81a3fa4e66e115UL, 0x1263f88f524e99ddUL }},
+  {{ 0xb1547e11192bbcc0UL, 0xdc3e509ce65ad8dfUL, 0x1439a3c0fa2df8feUL, 0x0be985e1a7027386UL }},
+  {{ 0x9bef313a4753144bUL, 0x9098ba2192d84285UL, 0xd66ee129f521875fUL, 0x2c8567378b8e4fd1UL }},
+  {{ 0xb5e66a2c23c5968dUL, 0xd8cf0189daf6cad8UL, 0xa1ce218a872ac436UL, 0x119e3b53c9195586UL }},
+  {{ 0xa5ce069c8ce170c4UL, 0x905d2ee611a130d0UL, 0x5ef4709aef23040bUL, 0x09b70d5ca3a4512eUL }},
+  {{ 0x87ed256220bd95b3UL, 0x114588c4bbe7bdc6UL, 0x4977bfd7bbeaaec2UL, 0x003c58b1be61caa0UL }},
+  {{ 0xe10bf19848b0f78dUL, 0xf30be204ad5a1dcfUL, 0x1a4e40e6e4958c45UL, 0x1d0c5859e2e6ddd8UL }},
+  {{ 0x38ca38d4f041e723UL, 0x28de78090cf84e21UL, 0x418d4376d3dbf854UL, 0x2378039e36c96057UL }},
+  {{ 0x45e62d4e9923b4daUL, 0xc13d690f5afa05bdUL, 0x0c6d9e9baadad998UL, 0x06585b0af37efda5UL }},
+  {{ 0xaaabd794396854cdUL, 0xe6ae555e7fe58a71UL, 0x1522d8454603328cUL, 0x216a14c5f0ef4d64UL }},
+  {{ 0x45b00cdcee3ec269UL, 0x07e9155231b5af79UL, 0x008ffcb46e740f25UL, 0x08df3f7719c48ab5UL }},
+  {{ 0xe610f3f76ba22485UL, 0xb79d4340085e6237UL, 0xc65b9c6058fd0d1cUL, 0x18a3d5d99f104154UL }},
+  {{ 0xf8d9d8b0ba75e620UL, 0xcd218f4bb6763778UL, 0x20573ec707862b28UL, 0x04d2f7cb21bbbb3fUL }},
+  {{ 0x1fab3b359f1541f6UL, 0xfd105954e6b3088aUL, 0x78d890fcdeabe2ddUL, 0x07c2fd30881984b2UL }},
+  {{ 0x175f03e7cdd2018cUL, 0x1b862c6512e1dcb5UL, 0x7b373515029f52f2UL, 0x072f7d0eb65773cdUL }},
+  {{ 0x36df637a27db2769UL, 0x559ceb96b6eb1db6UL, 0x8d2cb09d969e60d3UL, 0x277912fef91a213cUL }},
+  {{ 0x44303b8d59538f26UL, 0x5b1ddbcb75d7d2b0UL, 0xe0dc71f0bfc392f0UL, 0x24518063ca7b370bUL }},
+  {{ 0x03f18c8686dcaf62UL, 0xdf471e1275b493adUL, 0xa1847dc8cbe0b203UL, 0x1a88a7f43923f5f4UL }},
+  {{ 0xf19e0312786f8037UL, 0xb990304fab30d7c2UL, 0x8a3dfaaa7d0efc13UL, 0x0a40e1a12e0c9853UL }},
+  {{ 0x69d7aa176a0e07f4UL, 0x0ff1c5ec6d50e3aaUL, 0x72ed8293f9699393UL, 0x20740e215c6bbcefUL }},
+  {{ 0x898667d998836ddfUL, 0x76e4f80f01312648UL, 0x9a7d0b7b290c870fUL, 0x2f7f705de2cb8d65UL }},
+  {{ 0xb34de631ce8f2401UL, 0x543d4ad485b21804UL, 0x045e3903bd9f2cb4UL, 0x304b32617018f695UL }},
+  {{ 0xbe3f027031a837b9UL, 0x1ed62c3f97289b20UL, 0xc07d2fcf32ad4f3fUL, 0x08b672b2479a3c19UL }},
+  {{ 0x16370d1f63e7ca67UL, 0x4a9be12383dc4ed5UL, 0x7074d43c0736f4caUL, 0x111f6ca5b751cfefUL }},
+  {{ 0x75641aa1031d7456UL, 0x50d25a94b2a4dd1eUL, 0x80752244e27ca200UL, 0x106a915b6b01497bUL }},
+  {{ 0x1c9a57090b9c98a2UL, 0x1d79f49118050b9bUL, 0xc45b8697cb604994UL, 0x085c9ea2f8a62c8bUL }},
+  {{ 0x077947742eb5b956UL, 0xccb993fb2964a716UL, 0x0f4e1a1452b415d9UL, 0x239fc1d7d1f3436bUL }},
+  {{ 0xffa422e53819e258UL, 0x58bc886bcbf717cbUL, 0xb56a0a33cf8da1a7UL, 0x086f1af8b0a5ff58UL }},
+  {{ 0x30e8da4697e73576UL, 0x0635c5ad09afa97eUL, 0xbe8cb9652848ce7cUL, 0x2860096627a1bebdUL }},
+  {{ 0x1ae5f8de3bfbdf57UL, 0xfe369d6fea9c9967UL, 0xe4864f9c1f1b5e84UL, 0x177e21b45b574564UL }},
+  {{ 0x515185ee85ff7b76UL, 0x563b83aed063071fUL, 0x0d33be333b9b0b0dUL, 0x1046acb69b7d3316UL }},
+  {{ 0x6627da39373b2a2fUL, 0x73f826461ab8d102UL, 0xfeb6139b856f1af6UL, 0x22e1b15d2d799a00UL }},
+  {{ 0x35e6d21fb6af9b41UL, 0xe8253f7cf2003f4bUL, 0xbeb57f06bbc14638UL, 0x2b26b698f32a12bdUL }},
+  {{ 0x308a43e369c5e9deUL, 0x403f63e3cd82b2e3UL, 0x7ba0e0472a40275aUL, 0x0a295e7646a2b629UL }},
+  {{ 0x4118f81dd8d9d40fUL, 0x4da263923cd1c6fbUL, 0x49569e214b3b8efdUL, 0x1101bdf61baff606UL }},
+  {{ 0xc9b786d026951eb5UL, 0x0acbd602f5322b0bUL, 0x4f928dafd830bcd6UL, 0x08bcabb29ef932c9UL }},
+  {{ 0x9a4c5ccb973f9619UL, 0x3d3bcd7662c3b398UL, 0xa5d1f86baa7f8ca1UL, 0x0c47b011eec3eab7UL }},
+  {{ 0xbe5d3a10735369e1UL, 0x805d1e06f187c047UL, 0x8dde734ed1a39d2aUL, 0x07bca37042ece2feUL }},
+  {{ 0x3256b891135ea117UL, 0x7ca4faf514240091UL, 0x65aab52cc3081cffUL, 0x166581a758c99b69UL }},
+  {{ 0x5d9a418ff13fe9f5UL, 0x2379b775118b2c51UL, 0x5d243ba3c7da0fdaUL, 0x17bffacca392ea19UL }},
+  {{ 0x4d285dfc581264f3UL, 0x141fa8df8cc21c30UL, 0xc3656615e5f71428UL, 0x18063961fcaa3ff1UL }},
+  {{ 0xf37ba397c3502af6UL, 0x31437858d1a89f34UL, 0x0c71aabd517e546fUL, 0x301a5b6b6fb9275fUL }},
+  {{ 0x6a1a71b55a4cb738UL, 0x7a03fe57c20a181fUL, 0x958bbb3f00f9f859UL, 0x0dc01ebb1567da2eUL }},
+  {{ 0xcb30e15c816ca80dUL, 0xe65da729ff3a90b1UL, 0x27afb1568bda4519UL, 0x1e9bcde10c75bc4dUL }},
+  {{ 0x9f108ba2da3a2987UL, 0x55dc97a5cdc07070UL, 0xf624f4c1f81e6f3bUL, 0x24fe48d5f615b897UL }},
+  {{ 0x9c911d6675c8b605UL, 0x80304eae52aa3c98UL, 0x5e70393d18e55ec4UL, 0x2aa360caac3b88e0UL }},
+  {{ 0x83f3c570e9de23b7UL, 0x13930edd729d1626UL, 0x83c428d062e896dbUL, 0x23e7184bc318d276UL }},
+  {{ 0x7ac151f3e4775181UL, 0x992376d7e834f30bUL, 0x5d6a76b3c563925aUL, 0x256b96e7d5176ff6UL }},
+  {{ 0xbc5dd21ac523e316UL, 0x5e6d95848e2424a8UL, 0xe51113b6657b85ccUL, 0x05a51cb51887549bUL }},
+  {{ 0x0eac8d4924333ce7UL, 0xe9e4d6573dd31eceUL, 0x328da7935df705eaUL, 0x284ab9f5eb0f76b5UL }},
+  {{ 0x6daed34ba8789d2aUL, 0xca6c505fc3ff48adUL, 0xeac8f3a592164ea9UL, 0x2960a791d78163fcUL }},
+  {{ 0x7859ead58876989cUL, 0x55f4ce52bf9a1c0aUL, 0x303da12c271e8ef7UL, 0x05049f42384548cbUL }},
+  {{ 0xfffa8898d9278e33UL, 0x803485a151031823UL, 0x86f152fd03c50e87UL, 0x023c41787b2a6ed7UL }},
+  {{ 0xd62c65b0de6731e3UL, 0x0c8b1094043c9d1cUL, 0xfca02c778bcf1b85UL, 0x1fa5423904211b1aUL }},
+  {{ 0x013826f015e03ea8UL, 0x1f17275cc977438aUL, 0xfd2686af2cbb0e26UL, 0x159114c079223d11UL }},
+  {{ 0xdd40145dffae0235UL, 0x80ca849c8606c99dUL, 0x6bb5c17288c71db4UL, 0x15f7c0ffc1907b6bUL }},
+  {{ 0xae32b3609db1d7f7UL, 0x6bd79eb63c82168bUL, 0x557283fab63e14b0UL, 0x09ada8d7e8a704b8UL }},
+  {{ 0x1dac858046ea840cUL, 0x0d0d4818e6b08bf7UL, 0x5c0719501801ef20UL, 0x12f5a584f86c8bf7UL }},
+  {{ 0x53c049dbe73f0a49UL, 0x2a35c1911c7480a6UL, 0x26d347ab7f6ff46cUL, 0x14466170a0bad5b2UL }},
+  {{ 0x3ab1fc77e8443f46UL, 0xc924e68592ccaa98UL, 0x736936c702e4a5eaUL, 0x165dba641fa499e7UL }},
+  {{ 0xb86ca64f20f5858fUL, 0x700ad3c86d95e48fUL, 0xb6d67095219bbd74UL, 0x235e90f9a0a04d07UL }},
+  {{ 0x068e9ffd6270f250UL, 0x92000ab45324ba96UL, 0xa3b4df8a5e0faccaUL, 0x1fe1ca57f1ba77d1UL }},
+  {{ 0x1f2ded2e6b15fb00UL, 0x1bb80933507d1423UL, 0xdd5eb5a3ee5e5450UL, 0x130b5a4f4b9685bbUL }},
+  {{ 0x1b61ab448d296d6cUL, 0x8acc43343d8953cbUL, 0xf3cf9c555f071aecUL, 0x1f4a89c498bd94edUL }},
+  {{ 0xfc32dc5cf9f46f3bUL, 0x543803e90b38ad59UL, 0x17efc0493970f9b9UL, 0x2f735fc1cbf06446UL }},
+  {{ 0xcd514cf509b7d0acUL, 0x841c0b998b6172b3UL, 0x88a21b60e021614eUL, 0x162d72d4215d5c0fUL }},
+  {{ 0x31ee972f8c1fa60dUL, 0x8a90fbd17b3ce151UL, 0x9e64fa36f27a8ed2UL, 0x11608cb985469f95UL }},
+  {{ 0xc15258d1f7ca94f4UL, 0xb031ceed82d4711dUL, 0x52e23199785faa39UL, 0x29cd0599c9af9b9aUL }},
+  {{ 0xf79fb5a24cd3d125UL, 0x268a4e2eb5fb1eb1UL, 0x5651284e1b03799fUL, 0x2acde4eee58e5886UL }},
+  {{ 0x899888a61daef677UL, 0xbedfd0c1683bfebcUL, 0x1309742a0bc47412UL, 0x277b9595d4bd48c7UL }},
+  {{ 0x5f65a5e56e8f445cUL, 0x4d14b1db19e32372UL, 0xc99e7bdc236d564bUL, 0x058d4064edf6cdbcUL }},
+  {{ 0xaa681f84279c7b90UL, 0xfa3df9233e21b6baUL, 0x631ba639e41be3e7UL, 0x2de784bedb93d433UL }},
+  {{ 0x40f6bbb0a632109eUL, 0x9ae69477df8891f9UL, 0xdad91a790ea190f0UL, 0x12a9bed8e85fe4beUL }},
+  {{ 0x10d54e854f25899bUL, 0xc5472ebfbc9b6922UL, 0xdf9a3b6201452936UL, 0x112b601c08599c79UL }},
+  {{ 0x5704f70d9b3e8256UL, 0xeb03f492d46377bfUL, 0x0c4cb20761afa278UL, 0x2423c447d64802f7UL }},
+  {{ 0xb1da51dd7e2ae5beUL, 0x8299aeeddd6575d6UL, 0x994cc1fce809dd76UL, 0x07875eadc1a91ce8UL }},
+  {{ 0xef885205d4bfb012UL, 0x3320daa5171f01a6UL, 0xe0d97d64c4795303UL, 0x1be2e4871446ed29UL }},
+  {{ 0x1d3e74b3004de830UL, 0xfebdac964aa5c618UL, 0xf1569f623471c15aUL, 0x00917c252f490b68UL }},
+  {{ 0xdc25c724a9547f94UL, 0x7eb025a44ab2a535UL, 0xc02bee46e6123dc8UL, 0x1164c19a5d39c653UL }},
+  {{ 0x3fa2a38cbd2c3bc8UL, 0x243b0b2d37c843f9UL, 0x4f32ee14d75ed10dUL, 0x29f7975ab80a7d08UL }},
+  {{ 0xc65220134e809143UL, 0x52fa77c9a605bf9eUL, 0xf5d22b1000be47a4UL, 0x0acf0e72873e16c5UL }},
+  {{ 0xfb4f69676ac151f9UL, 0x96316d7196ec02cdUL, 0x85fce889035cb752UL, 0x28d8b0c8f76f1109UL }},
+  {{ 0xb88823b2c28a4669UL, 0x18c25b4e0269cb08UL, 0x8d992ad3d94dd546UL, 0x00b0f2eaf78ae33cUL }},
+  {{ 0x15235df926717f00UL, 0xa6f2df5fa38e3fd3UL, 0xbe1bcf6073947e31UL, 0x1b4ba39b41112e73UL }},
+  {{ 0x0cc82da672c76b49UL, 0x49de34f603d99ab8UL, 0xc2f77570ce41169aUL, 0x1e4aec592abb3ba8UL }},
+  {{ 0x80dd620f14a54014UL, 0x10da66299f5d0844UL, 0x651035237463a057UL, 0x132e78120850c0b3UL }},
+  {{ 0xa4bdfff02451dd70UL, 0x2243855b68d7f13bUL, 0xb4f6fe49ee9f0343UL, 0x122c9ff49f2bf887UL }},
+  {{ 0xc0c5bf195d49ef0cUL, 0xe517964e41a07b1fUL, 0x849c227edd5adf36UL, 0x13f490a54ad324d6UL }},
+  {{ 0x164c5dc898d6968cUL, 0x93cc2b9e16660ed8UL, 0x514c244be6d11403UL, 0x135bf12b710a84d6UL }},
+  {{ 0x1a16ba58a01b2ec7UL, 0xea89316e75289efcUL, 0xa62ca9ec34d020fcUL, 0x1f620e6aad844475UL }},
+  {{ 0x06128496dd9304cbUL, 0x46b9b38b8a5ccb08UL, 0x365461f1b6f1fac7UL, 0x2ed89d5f7013aff2UL }},
+  {{ 0x50c8837c26e7b51cUL, 0xeb2597dbfc873140UL, 0xbb19b15345ba3a5fUL, 0x050a56ca35a5e14bUL }},
+  {{ 0xb678080966971be0UL, 0x820a8659d9769a70UL, 0xdd3d337f09390da2UL, 0x23aced2dcae33065UL }},
+  {{ 0xbfd2603daead3d2aUL, 0x9528e82cb0ef6493UL, 0x93563abc4c7209deUL, 0x14fb843017c38f0fUL }},
+  {{ 0xc7a1aaf4f4a5d8b0UL, 0xbe94dcb0c736ff58UL, 0xe4b51ee65de6a4e8UL, 0x2fd4c2d47f6b5c6dUL }},
+  {{ 0x16f01c1baed31f4dUL, 0x6f524e8f93695272UL, 0x336d0b94939fa7a9UL, 0x2b639169d35fd158UL }},
+  {{ 0xa6cc523b2833d1c8UL, 0xb6ec30648da04e27UL, 0x3371ab5e0b832123UL, 0x177bb8e629efdc09UL }},
+  {{ 0x2afd0dd444640ba7UL, 0xc7483396233a9125UL, 0x2a4e991e0fdc3774UL, 0x07452b0128e3a099UL }},
+  {{ 0x79e6f57469296d41UL, 0xd02994875a4e1b9bUL, 0xf909d6ced4de5f59UL, 0x1415ce362fe67ed4UL }},
+  {{ 0x081406d4baabeefeUL, 0x7da08060a971f6acUL, 0xd478dfc8e4ff7c38UL, 0x12175513446bae4aUL }},
+  {{ 0x254522f1d87042bbUL, 0xe165987f215abd7bUL, 0xfacb131c4d842597UL, 0x2a103d1439d397dcUL }},
+  {{ 0xf462f929d946bf94UL, 0x34d8acb6763b38e6UL, 0x9cb045d95a308b2fUL, 0x145b27e77a9173c1UL }},
+  {{ 0x2189192ef36e32aaUL, 0x4767fc28776466d5UL, 0xe2183b4eef161dffUL, 0x204539188ac9bd9aUL }},
+  {{ 0x293529af3fdb31b4UL, 0x3c06d5163f922637UL, 0xeb10adf6644f9639UL, 0x1263ce7271bfe39dUL }},
+  {{ 0xfe40615f42797cc1UL, 0x0de446e42c931f26UL, 0x222f408bf09e0a6fUL, 0x2f6a093f96512058UL }},
+  {{ 0x1b1c9c8f31859426UL, 0xdf617f8df98490c9UL, 0x1f0a455c61d05a7aUL, 0x230ecbcbbdd7d278UL }},
+};
+
+static const fd_bn254_scalar_t fd_poseidon_mds_7[] = {
+  {{ 0xd24ccb91fde9412bUL, 0xb32bd1c97ec99d80UL, 0x26d1f83cff15e715UL, 0x04ab17c2331ad1beUL }},
+  {{ 0xd3604c386f0d6a83UL, 0x2ebdcd8369790c0dUL, 0xb395dcde9ddcf452UL, 0x088c4fcfee99cda2UL }},
+  {{ 0xd572efd7eb7723c5UL, 0xf02b75bb1e189fddUL, 0xfec9b9eb5167ab58UL, 0x25a4b7eddc20a9b8UL }},
+  {{ 0xe2b13562993f47d2UL, 0x001b9962bb43def6UL, 0x27a024c4d4e782d9UL, 0x0b27576cc1d0fa22UL }},
+  {{ 0xb587710392f4f8caUL, 0x7a6620eb3c28b0ffUL, 0x1bf9bb1464b9c657UL, 0x1d075685f4f5d58dUL }},
+  {{ 0x0f4ec70786eaf1f3UL, 0x90c7788eabd9f903UL, 0x05abe8fd6fdccee4UL, 0x099592e642af3c43UL }},
+  {{ 0xdca5c3fde186aff6UL, 0xb2bf6e32ce121671UL, 0xd8d345b467ac8216UL, 0x2e599650586c8afbUL }},
+  {{ 0xa6288e89444bddebUL, 0x05262308cf91505bUL, 0x815ea488ac5b6cffUL, 0x12a21d19b0750542UL }},
+  {{ 0xe0129bb5793bfe78UL, 0x6e6491be0f22a44dUL, 0x521a38cbcd193438UL, 0x2facf856be995f7bUL }},
+  {{ 0x681af83acc0efd37UL, 0x53fb77cbc937ef57UL, 0x56dc8aee4b73d9ffUL, 0x045fd5648e8b5006UL }},
+  {{ 0xc1f53732a0d86058UL, 0x5d54cba1ddef2289UL, 0x4264923647afe0a6UL, 0x2106446749a53ce5UL }},
+  {{ 0x46b95c4db01d0ae6UL, 0x43db78172b55134cUL, 0x4c1a7136f480f9c1UL, 0x069b9d9599a91701UL }},
+  {{ 0x04b3a5567dcb301bUL, 0x3fb4749a44535f78UL, 0xb813a9e919fa9eccUL, 0x1797bc29c96cda59UL }},
+  {{ 0x9659c8b10e627ec7UL, 0xe2ff5c1bd7b09b38UL, 0xcd2adbfaca221ad3UL, 0x0457228e6d8a8269UL }},
+  {{ 0xacf060a6340d3543UL, 0xd15a3d9f64009ca3UL, 0x004dda80951c6839UL, 0x05e8e1e88397fc89UL }},
+  {{ 0x65329832ec6860d7UL, 0xe3322b781007097aUL, 0x380a12b9b5fbf09fUL, 0x2c6134945a421dafUL }},
+  {{ 0x2e42e36e463f86fbUL, 0xc4890e6e87b96707UL, 0x970821f91c090d3dUL, 0x0f24e914155cdaa9UL }},
+  {{ 0x99e55903fd825bc2UL, 0xfae8d62959c449cfUL, 0xce91904f2aebe3f7UL, 0x1696350cc1b6b0ceUL }},
+  {{ 0x0d1e19f09f7cd095UL, 0x1fd3db7fc2b700beUL, 0x7a4a42f0003e30caUL, 0x162cb8a35117169dUL }},
+  {{ 0x08ce831ca4c7a784UL, 0xcaca0fc0efd3eeecUL, 0xf3fecbd6c959161fUL, 0x08aeddac3d8b8857UL }},
+  {{ 0x67c94dd5da0d17ceUL, 0x32c7d96537680599UL, 0x90f451559ad76907UL, 0x228c91d772544719UL }},
+  {{ 0x7ce2b3f123646878UL, 0x6ea7b19d5a3e6448UL, 0x650a96ac326f2e2bUL, 0x2472b4dc08e47a91UL }},
+  {{ 0xfd37e7302a3d67b8UL, 0x6b1857563a4528b8UL, 0x0e89a868c3e5138dUL, 0x1ee7dce98bb72eddUL }},
+  {{ 0x06b7d5faef1cedbcUL, 0x16a642458f432b6fUL, 0x81e4856b83343bf9UL, 0x0bd95bdbbe70ddafUL }},
+  {{ 0xcfb5223430c2f2b0UL, 0xbe13b789b1739037UL, 0x6a5dc7f439854c38UL, 0x10da2dcb969cdfd9UL }},
+  {{ 0xe21353da9bede31dUL, 0x2d14f51f9cb09388UL, 0x75d08d2a4773a18aUL, 0x1ea53526e54c5115UL }},
+  {{ 0xb19c21787176ced8UL, 0x69f4f538a2ad0949UL, 0xeb7b8ad417ff8cebUL, 0x191a4fd4899a77bdUL }},
+  {{ 0x78bce69a673b6172UL, 0x066bebc3ee6762e5UL, 0xf010cfed5168043fUL, 0x1aaa0c3b8db5005bUL }},
+  {{ 0xf6da1f2009222f64UL, 0x5b8d0fa7d56352b5UL, 0xfb0c47ff8a3867d1UL, 0x013aa976d411b669UL }},
+  {{ 0x19a01977d132e5dbUL, 0x5ba04635191dac18UL, 0x61e5896c71003a1aUL, 0x0c7d0228676a4b83UL }},
+  {{ 0x95bc78fc48dff194UL, 0xc4fb06ad379eea9dUL, 0x2861a3973f52711bUL, 0x12b62627cf30787aUL }},
+  {{ 0xf838c178fb7ebca9UL, 0x3ea7a7810258f056UL, 0x777ca9749fbe1f3aUL, 0x12556ee2f2a9c482UL }},
+  {{ 0x33d52f1620c2db55UL, 0x46f7d1e356487bc7UL, 0xfaf65580550aa33aUL, 0x019885003032515fUL }},
+  {{ 0x5ece5d3c1eb48ddaUL, 0xde65f387ade54f81UL, 0x1e4e55262a7c767fUL, 0x1a5da6e53e457687UL }},
+  {{ 0x9514ae38f97d78e5UL, 0x123749888f2e8273UL, 0x468f7701321b370eUL, 0x2790a61ad8f9ba6aUL }},
+  {{ 0xfd1f47fcbd9bec31UL, 0x85c85f72dd296b2fUL, 0x057dcab9f6223673UL, 0x2f0577502db383a3UL }},
+  {{ 0xf75bb4dcf1804e3dUL, 0x29bd14765f694b0fUL, 0x9bcfa28091a3067cUL, 0x03bf8809cdab122dUL }},
+  {{ 0xee23c9734603e105UL, 0xccae13f8ed9db9d3UL, 0xb351d2d528dbdcd2UL, 0x2c7056c822110748UL }},
+  {{ 0x69c9f1496fffca88UL, 0x42ec99ae81bac453UL, 0xfffc382a5c449989UL, 0x25ce451310812d9eUL }},
+  {{ 0x83a11bb2328bee81UL, 0xd08bf1a402defe30UL, 0x0e26ee05fbfa6a28UL, 0x0ccf6942e181343eUL }},
+  {{ 0x7f2617dcb9ea43d0UL, 0x45901366f6652147UL, 0x755687c3c40bcac1UL, 0x2944c7c404513a2cUL }},
+  {{ 0x45db03d81824623cUL, 0xfae9a4f4b3c06cd0UL, 0xed0ddceb67312d9fUL, 0x13330f835c43a8bcUL }},
+  {{ 0x36ddad9730d995cbUL, 0x75b5ca1324765e8fUL, 0x12ece2991cd94422UL, 0x0957757916efc2bbUL }},
+  {{ 0xee7092eaed5875b6UL, 0xcd7896c336a9828bUL, 0xee2d125b3d91eae5UL, 0x1e0cfc1103d80d31UL }},
+  {{ 0x5acd8a9b03581fc4UL, 0xede777bfa05bb124UL, 0xea38bb49880dc821UL, 0x0afa842c3e09b31dUL }},
+  {{ 0x09b979978b193ca8UL, 0xdd175096f2f2bc34UL, 0x0ed3125f920b3e37UL, 0x2145f0ea9069c72eUL }},
+  {{ 0xa7cd35a205c1154dUL, 0x4698a11062c0b2eaUL, 0x81d91215cb69fdeaUL, 0x0d6652b7146b51b1UL }},
+  {{ 0x512344e9c6f516a3UL, 0xc559c8d05f20b07cUL, 0x1a8a8d847f2391aaUL, 0x21fd58c3bb921248UL }},
+  {{ 0x5e8e3b2258fd318cUL, 0x3a3c3d21eeae689cUL, 0x899282f48e5751dcUL, 0x260360a917696de2UL }},
+};
+
+static const fd_bn254_scalar_t fd_poseidon_ark_8[] = {
+  {{ 0xb9d56deaa52d8e34UL, 0xd1abc4bba3d90188UL, 0xa8cae9bbcffb7668UL, 0x244a8228c1c4c5f0UL }},
+  {{ 0x3dadf724c2eaa7c4UL, 0xc51336d7575c7e07UL, 0x989515c71f971dcbUL, 0x17c6e62cc5db59f4UL }},
+  {{ 0x9a785811aedd0e6aUL, 0x4abd2d0e31c5d29dUL, 0xb5691668f07ad24dUL, 0x21a1412a9055812cUL }},
+  {{ 0x1a1f57ac65873e06UL, 0x09a871092cd63bceUL, 0xb2a301dc92b291e9UL, 0x02df60a73e0b640eUL }},
+  {{ 0xf185359b8f3279c8UL, 0x6e07da68fad0e2fbUL, 0xf5906abcaa5c94ebUL, 0x1b9106f8351fab4aUL }},
+  {{ 0xcbdee6a35f251d5cUL, 0x2af53ea3da47733bUL, 0xa70bd5f2463dbb63UL, 0x16678a748d643595UL }},
+  {{ 0xe19b312a4f28de64UL, 0xb8539e8e11e9a52fUL, 0xd256feabffce5651UL, 0x2433096036613addUL }},
+  {{ 0xf0f41cae15b94415UL, 0xb0576cef1699fc8fUL, 0x94fdfec78826e716UL, 0x0ce6b8ea70b7152eUL }},
+  {{ 0x1289e4c953dd46aaUL, 0xfd13cb560f744a23UL, 0xc2c1f5ee27236071UL, 0x1dd7afb615c030c0UL }},
+  {{ 0x7022636aa31e1ac8UL, 0xd4c9c3f832f30079UL, 0x73b155799e977e04UL, 0x2dd6d78e755d5b8eUL }},
+  {{ 0x34a20ac0467a13cbUL, 0x6e831fc39374434eUL, 0x6701ce1e4fb11604UL, 0x10e2e8f9cadb5405UL }},
+  {{ 0x837e7c8f2a4fa8aaUL, 0x38fb4cc3a1124d39UL, 0x076dcd735b1be9f8UL, 0x2ba035238bb9cc40UL }},
+  {{ 0x0e70038583ede263UL, 0x0cd95751e7a4ec14UL, 0x6aa34a12ed49763fUL, 0x0187091d6ecab044UL }},
+  {{ 0x86be962a59c3e1f5UL, 0xfe3e9e0ed05c0bd5UL, 0xee189a3e0cc6220dUL, 0x1d60f3f663068b65UL }},
+  {{ 0x775f0eb3c7fb902aUL, 0x322221872ede4264UL, 0xd3df5e8640049c60UL, 0x119918662880b8a8UL }},
+  {{ 0x73bea87369215771UL, 0x90f75b7d95918f59UL, 0x0470369b0e3be035UL, 0x20cb193533fd4cd4UL }},
+  {{ 0x0e973d94f5b0804eUL, 0xf74277947dcb1bfeUL, 0xe26d8516a9a6acd9UL, 0x18a86b3713492ca6UL }},
+  {{ 0x510141c45c437218UL, 0x76f535564cde586dUL, 0x000363e8abd9f4a4UL, 0x12a3835f4cbaca03UL }},
+  {{ 0x136e78bdba67b048UL, 0x968c2d36f4714f89UL, 0xa556c83e5961e546UL, 0x086541cfa4bd5368UL }},
+  {{ 0xaf807e7c1b310515UL, 0x34c0ae5645e77a62UL, 0x043d936742165873UL, 0x1a6bc24f1c422c26UL }},
+  {{ 0x29891fa12070bfadUL, 0xf8e9bc0501ea561cUL, 0x04370d9a2b1807efUL, 0x16b2237ed10dc66eUL }},
+  {{ 0x65d4a800d004b5b7UL, 0x8b36e3e848b6a486UL, 0xd1b4f9eb97ab742fUL, 0x28e0e14f52b13397UL }},
+  {{ 0xfa33f5c564d20f74UL, 0x99111ba0c868ed25UL, 0xccc079f64e17421aUL, 0x20276a9fcd71e705UL }},
+  {{ 0xe0fa0f8ed318d6dcUL, 0x11f6ee941832f159UL, 0x729a8022e7854192UL, 0x15ca65d38836a47fUL }},
+  {{ 0x24e35f141c5066b3UL, 0xa5fe958a50469859UL, 0xe84c3fc1d9f7fbc8UL, 0x0646e958c0879327UL }},
+  {{ 0x717f046df02c4c6fUL, 0xeda245559b4a4febUL, 0xceb1a876f4eabdffUL, 0x0eaf72095ef60b2eUL }},
+  {{ 0xb2fcf91540a9843aUL, 0x4678871e98b13f65UL, 0x3b7637880132205cUL, 0x2c521d750f3725bbUL }},
+  {{ 0xeb2151b6794dca92UL, 0x01c0e8f16afd5638UL, 0xfc93d821f18a9e6eUL, 0x13bd160da6973f9bUL }},
+  {{ 0xd506960b7a6f3fa6UL, 0x7b61e33e946329f5UL, 0xb800639beba89ab0UL, 0x2aded4fcc8a48edaUL }},
+  {{ 0x40cec50bd0297c00UL, 0x4dcccb5c8261bf07UL, 0x3420a609d2e26604UL, 0x1ed73a6f6f29e260UL }},
+  {{ 0xaf0ec80fbe94ff6cUL, 0x420c7684c6919d8aUL, 0x8901218c1be9c87cUL, 0x02d3164f4234f582UL }},
+  {{ 0xa9dfe880fd82326eUL, 0x21fe179ddb59b8bbUL, 0xfef84b865722d5fbUL, 0x07736481fd42726cUL }},
+  {{ 0x93d0855fba175e9dUL, 0x599662c3d2d09f61UL, 0xc3054a59b8e2bf9eUL, 0x19fd465c47a028b2UL }},
+  {{ 0x003655c46bd6d727UL, 0x30f85054d3319ab0UL, 0xb6634b97cd92615aUL, 0x10a7c7a2993f8defUL }},
+  {{ 0xe227ca7a62acc4bdUL, 0x7e2d3bdf83adc733UL, 0x832ffe5c5c4121e4UL, 0x18bc689d052deb32UL }},
+  {{ 0x08deb313d32da414UL, 0xfd49227967051a9dUL, 0xfd58d0d35fe4aca3UL, 0x217564e3896a16bdUL }},
+  {{ 0x5e3239bcfaa59c70UL, 0xa15515ede070b315UL, 0x85fb98e7b7f4957aUL, 0x1bd3d169ebb757a6UL }},
+  {{ 0x30a2838e1626eedeUL, 0x17ec0aefaf943c8eUL, 0x2a97386ef15c9d65UL, 0x1a901b190fe66929UL }},
+  {{ 0x86d8fca07376cd84UL, 0xeab535ab0449cc3cUL, 0x18ac1f330ba65437UL, 0x2bf0af71685af3a2UL }},
+  {{ 0x539d4c401f63795cUL, 0x9ccd8bb1b99ba763UL, 0x95dd555034192465UL, 0x1e660f92795ab539UL }},
+  {{ 0x82cf75a4cc6d5333UL, 0xfb344a5440c724d3UL, 0xee8acdbe638a273eUL, 0x0dad3bb535239ca1UL }},
+  {{ 0xb198be4c4ce751ceUL, 0xe87767870a8af9daUL, 0x65d9cb55456b71fbUL, 0x0e5c0383866568aeUL }},
+  {{ 0x3cbb713ddc29af33UL, 0x716738ed0820fdecUL, 0x6d719ed51f4c72f7UL, 0x24a60562c33243b7UL }},
+  {{ 0x75d9e334eec9bf7fUL, 0x1e0de9faf175c018UL, 0x99babba6ec6fca9fUL, 0x10ea16023240b9ebUL }},
+  {{ 0x277907fe257a943fUL, 0x6c87523ce94ff362UL, 0x5bc98d869974b0faUL, 0x28f1db9ef5f36196UL }},
+  {{ 0x13fca3de7e4e0d86UL, 0x22b644a27c79b9a5UL, 0xb038892b004e2150UL, 0x05f247224696dbc2UL }},
+  {{ 0xd0973d77c1924ec5UL, 0xc98d0e49e53e1a49UL, 0x07d92c4abcc1fc57UL, 0x2df65aec6cb33759UL }},
+  {{ 0x6fc1021fd24493bcUL, 0x27e437e72d1000d3UL, 0x03a35a6e2dbc3bfeUL, 0x2470189e2920ed66UL }},
+  {{ 0x2f5c5e149834f9c5UL, 0xa925c9f30a31845aUL, 0xc3011dac0a35df4cUL, 0x2374d545400eaf58UL }},
+  {{ 0x4725dfa607eccdb3UL, 0xf5db50b14d8e7c6cUL, 0xe184e6e2f314d807UL, 0x2cb57c37467c38d9UL }},
+  {{ 0xcee307cc74654341UL, 0xc7d11565617ec57fUL, 0xd91b0dfb748412b2UL, 0x2e7cd81734682acdUL }},
+  {{ 0x0bdebf2f28f5519bUL, 0xad5c9b680e211705UL, 0xff7408f447887ce3UL, 0x1b00ebcae3252d72UL }},
+  {{ 0x193a660dd25dc6d7UL, 0x7d691846c186cd25UL, 0xc66b345ae2fd5095UL, 0x163c8fbf38ffabfaUL }},
+  {{ 0xc40c744fa667bfdbUL, 0xd61c99e7a99ac778UL, 0x55544da6d9e91fe9UL, 0x272487f8d062d86fUL }},
+  {{ 0xd9c067010a02bbc6UL, 0x22a3c3e3a1078fbaUL, 0xf7c15517f75fef06UL, 0x09284548e0f98505UL }},
+  {{ 0x6ac6d2a47da7aa9bUL, 0x555e12c59a839fc4UL, 0xed73cfd4375efdacUL, 0x0ff8aaa28e96f636UL }},
+  {{ 0x0912dc7b57552b66UL, 0x8439950109e11bb4UL, 0x47f38ea55b3f7f82UL, 0x07ff21bc06e2505eUL }},
+  {{ 0xf6dca7acee6d8d13UL, 0xa0451d8cd3aa3c42UL, 0x0bd5d1da56397e28UL, 0x165b536ef88087c4UL }},
+  {{ 0x52d924c6461780deUL, 0xec9744a64484b511UL, 0xd2a3f74d6183c3c9UL, 0x0e43e4e99f8aacd0UL }},
+  {{ 0x99509dbda4bdff70UL, 0x3f09b63b276f809dUL, 0x2462b0abf3e68122UL, 0x2af0a8a2c5a42d04UL }},
+  {{ 0x3f671a842bf88560UL, 0x94c64189b461e274UL, 0x9b79c408e6cc648fUL, 0x2683393997bd427bUL }},
+  {{ 0xe37704b3c69a2285UL, 0xc06a8a605f4f6ffcUL, 0xefc1ccf2ee504787UL, 0x05a95f5de28c4d2bUL }},
+  {{ 0xd6e809b689c889cbUL, 0x5fdb7f228b05039cUL, 0x3a8543b065624d78UL, 0x2195a62b5255bad3UL }},
+  {{ 0x1b26f3ec610ff883UL, 0xf55526cba5330207UL, 0x93e149c65342b7f3UL, 0x08daa5bb151bc8ddUL }},
+  {{ 0xa87e4a2fc8664f3bUL, 0x419077bcbce33f20UL, 0xd4b7d1f64ae42be1UL, 0x1bc0d640df7bf93aUL }},
+  {{ 0x22536671dd155976UL, 0x964615f7f964ec71UL, 0x8ac0aa38aaa563f8UL, 0x0b0d6967dae70c76UL }},
+  {{ 0x65fb7373da951bacUL, 0x1e2ed88f4c1bb38eUL, 0xf71b8aef56ffa867UL, 0x0dae81cdd2d09ce1UL }},
+  {{ 0x08b032e44a9f3172UL, 0x53b8013bd2a2ab1bUL, 0xd958fa669440bdf2UL, 0x07b6b0d4fc8ba937UL }},
+  {{ 0x0402f57b19bd2188UL, 0x0de3a5263deec59dUL, 0xd7a4da583036f16cUL, 0x04d2a68879b1a215UL }},
+  {{ 0x4471267f1875f05aUL, 0x90739fa058e4595fUL, 0x1b8226589d4174d6UL, 0x13e88078eca5484dUL }},
+  {{ 0xd5e8c7ae72c573e3UL, 0xba7f402a0fc9eaadUL, 0xa01294d22c48e83fUL, 0x2a41308bc5ffc797UL }},
+  {{ 0xfbeaf778274b6fffUL, 0x114de2d41500e6e4UL, 0x8c60ea6b7821a9d2UL, 0x288312a4ae247995UL }},
+  {{ 0x5fe4cbe011ba82aeUL, 0xb244cf68b843ee75UL, 0x465c35ed4620147aUL, 0x2850906017465be5UL }},
+  {{ 0x9d241bf245879b82UL, 0xaccd4bd61e7aede3UL, 0x0ae03c4cce51b1edUL, 0x0b39ecd84f2d4c51UL }},
+  {{ 0x0a005f0c8aac166bUL, 0xf43af1016dbc7b38UL, 0x18bbff9dd47e9150UL, 0x05766beea6665ba0UL }},
+  {{ 0x88745ec06b8b6c33UL, 0xd2e003ea34f5dd2cUL, 0xed647409833dadfdUL, 0x0e9b392594cc535bUL }},
+  {{ 0x7f06b6b848a660f1UL, 0x8445e5d6640eb0f7UL, 0xf9a50f9f488908bcUL, 0x0f0890b7740541f8UL }},
+  {{ 0xb464a4e00e36c4beUL, 0xd8085e467efb2a9cUL, 0x2b964491af5d6dcaUL, 0x21373804e474f5e3UL }},
+  {{ 0x6c9025556eaf0613UL, 0xdccc0880a8b670ffUL, 0x16ae6620402f9778UL, 0x1fd2b521a90efcd1UL }},
+  {{ 0xa83e64e16efb5863UL, 0xf0aa9955d50d1d60UL, 0xcf7cf6c2ba76383cUL, 0x183befab20436a15UL }},
+  {{ 0x522acde77fb012b5UL, 0xa732f7beb5c4f339UL, 0x4cf7205e242147bcUL, 0x0d1dd473a967eb35UL }},
+  {{ 0x3953c9201bbea7f7UL, 0x5663106d012109adUL, 0xa404418638ba3d70UL, 0x129fdd9ee8d752cfUL }},
+  {{ 0xd73d80ac33269d1dUL, 0x587f9e5a7f7fe240UL, 0xff8d4259d4d200f5UL, 0x1c95588e5b9d58e3UL }},
+  {{ 0x6dd3b121fe330261UL, 0x586991cc9ca2a2efUL, 0x0e2107c3050a8f64UL, 0x0638a627eb26dd22UL }},
+  {{ 0x93fb7e23194f2a1bUL, 0x048bcc9087c3af1bUL, 0x005cd585e261d3c1UL, 0x2428afd209725977UL }},
+  {{ 0xcfa62ecd32f99570UL, 0x715f152d13b85632UL, 0xb46e19145ed53e8dUL, 0x18584967c479892fUL }},
+  {{ 0x678f1412d754d38dUL, 0xa4f2ca54fc983e53UL, 0xb0ebe2557a4904f6UL, 0x1f0729477fb45439UL }},
+  {{ 0xd63cc2323f2c0db0UL, 0xc36b41004feecd98UL, 0x2b0250ebf7508039UL, 0x222491128008ba79UL }},
+  {{ 0x63c2cf2b49060978UL, 0xa2c54d46379b33e6UL, 0xcf9f629389bce14dUL, 0x20f5a46505c0cc2aUL }},
+  {{ 0x41a675a8848c41bcUL, 0x4e6c34fbd5ade952UL, 0xe549f3fae2f44445UL, 0x02934550d495de22UL }},
+  {{ 0xcc6a813c44b854d9UL, 0x1f6b7001787b25caUL, 0x01c3ff138db6c1b6UL, 0x1f2321127b7788f1UL }},
+  {{ 0x2eb0c8f6c65d7d45UL, 0xc7b961b54270ff53UL, 0xcf2ddd6cfc36ec76UL, 0x1a9ab39a5caf68b7UL }},
+  {{ 0x99f3c5f45bd57770UL, 0xbadb7667e3f1c2b4UL, 0x475bade64e4d63ffUL, 0x09bcff1d87829ffaUL }},
+  {{ 0xc0526dced1222acdUL, 0x0d4f2bb13b1d6aa9UL, 0x5d9a28811ea59991UL, 0x06ac5a4c6967c4d7UL }},
+  {{ 0xd6a11ab9f4a17029UL, 0x1fc01a85a928adb3UL, 0x4f4e116417ba6609UL, 0x2616068a5b83c0f1UL }},
+  {{ 0x852eb8b38a9feb1fUL, 0x70beca23f2e93b81UL, 0xebc3bdf2c7419fdaUL, 0x03ca75ca11d892bbUL }},
+  {{ 0xfd958eb761049e2bUL, 0xd391f39cf86732c1UL, 0x0e50427e9a36e175UL, 0x1bf523da917613c6UL }},
+  {{ 0xb97738005e9b7a95UL, 0xe249d1b3b6cee576UL, 0xe6e1ea512df513d5UL, 0x19bef670e32ac42fUL }},
+  {{ 0x1c2fbe5256dc662eUL, 0x2723ac7d917bffe2UL, 0xd6e19e4c57d87223UL, 0x0d8685f5a06b982bUL }},
+  {{ 0x6e61b2ade2966f1cUL, 0x15503b7e06f50821UL, 0xdae741fde388183aUL, 0x139cbb44a7cbe501UL }},
+  {{ 0x17a36bd9d0c9c7efUL, 0xab89bb847547914bUL, 0x61f916d5806fbb82UL, 0x2eb35f48b2395cd4UL }},
+  {{ 0xbb5998dfbcffd0e9UL, 0xc5612e1e7e7693b7UL, 0x86f8eb9e3beb7488UL, 0x1148a65bae033d14UL }},
+  {{ 0xbdedde5da156df5aUL, 0x2ef9572b5b6b024eUL, 0x9adaf50524598b13UL, 0x21d67ad046b34ae1UL }},
+  {{ 0x1e451d05a884cf48UL, 0xa39bd9cc8cabce08UL, 0x6dca4235279702eeUL, 0x179e095dff9162e5UL }},
+  {{ 0x4350d00d39b70f66UL, 0x4fe474a218b780d0UL, 0x95c99b0d47f1f533UL, 0x17f9afdfe6e6bc2cUL }},
+  {{ 0x5b8f5d82a8af473cUL, 0x2a6c5816b3e341ecUL, 0x1d8e9f83c87eed02UL, 0x2ff488ff70746011UL }},
+  {{ 0x17b7a0342815e353UL, 0x930e308667c7183eUL, 0xd53374361ad9e542UL, 0x0266f4964843b5f8UL }},
+  {{ 0x67cc69c308802ab3UL, 0xac802f7ae1e27cd1UL, 0x71d2ab3f2021a817UL, 0x0a65c704fb286359UL }},
+  {{ 0x3dae720b54629dd4UL, 0x89e75f100d768ac4UL, 0xad3b40308d9e8dc1UL, 0x20f9f39f1f4cc99bUL }},
+  {{ 0xbdeacbaf4df60cb7UL, 0x694776983c8101e9UL, 0x0465a03ff3d389c4UL, 0x13448321fc5fd928UL }},
+  {{ 0x8926ae2565e3f9e0UL, 0x15acae623aca43e0UL, 0xd7af49ec2a464453UL, 0x18d40a7813cc4036UL }},
+  {{ 0x0b4fa266bca820daUL, 0x85cad93f7e8eec66UL, 0x20b7886ec0770734UL, 0x221d05267493f933UL }},
+  {{ 0x8939e9bb143a72bdUL, 0xd72ecba06e85cb84UL, 0xb8c5af326b7ce73aUL, 0x2563c9fadbb07597UL }},
+  {{ 0x1933a4aa083c7e42UL, 0x7cd00e179b5031bcUL, 0x2b05f9074e74e7a3UL, 0x2aec8cd46131d66bUL }},
+  {{ 0xcc660245bd5fdbbdUL, 0xd37d0cce88d9cdb1UL, 0x58de803fde8e4355UL, 0x0cd8cd8e3d7688e2UL }},
+  {{ 0x5de25ea8dc6de519UL, 0x4f01cd28dd9cd82bUL, 0x1456fc2ff41cc68cUL, 0x058bedba3dbccbe4UL }},
+  {{ 0xe2c0de2ea593e042UL, 0xb48bff07534027b9UL, 0xc1daab2e3743bb80UL, 0x27a65705e634b7c5UL }},
+  {{ 0x145f7aa9d4cdfb3dUL, 0xd769512e7511c42eUL, 0x11b0e505f699372aUL, 0x187b1b018bf1c2a6UL }},
+  {{ 0x962b5767021ccc69UL, 0xbadb21d67a794ee8UL, 0x6e7e0f8ffc606abeUL, 0x0e1b8b1bb731ddbcUL }},
+  {{ 0xf42296f9d35b4492UL, 0x9be21f2c95ecbde3UL, 0x9ca9664d6d63d253UL, 0x107425e9be2e7efaUL }},
+  {{ 0x9d3ed93fbbe566c2UL, 0x4673f7266759909eUL, 0x0af59a1c74fbb484UL, 0x1e1a75ecb118c017UL }},
+  {{ 0x3447d72d8fae15beUL, 0xa2cfb59d75254faeUL, 0xeaa8b8dad3535b83UL, 0x044e46b55e7cbfecUL }},
+  {{ 0xb30bb8e767d3d377UL, 0x762c2b6d5d758c46UL, 0x5738c39265f08969UL, 0x2b835f5ffeb8e9ecUL }},
+  {{ 0x278f9efadfef16e5UL, 0x99c6f994465506dcUL, 0xac81d28a2efd5a23UL, 0x100459918af0d86fUL }},
+  {{ 0x1bd7aff13ae5829cUL, 0x5a50679171c86161UL, 0xdf4a029f380d69bfUL, 0x096059ffa05fbd13UL }},
+  {{ 0x5d4fb97010b2c586UL, 0x628f9845b5cb7eceUL, 0xd8d4bf720429216dUL, 0x1a0aa679ecc31df8UL }},
+  {{ 0xa6fb24ddc73c87e0UL, 0xf0d93b29e01683aeUL, 0x82d574f7df1f0f5fUL, 0x1ea1a509e3c9d183UL }},
+  {{ 0xe1fd0e8d3e7593f7UL, 0xa1c8e07064ff3911UL, 0xa3d9a2d79b482bb0UL, 0x1cca627b300af502UL }},
+  {{ 0x14ce32fd9ae25ff4UL, 0x6be803e9cd6bb92eUL, 0x11a872463b0b9cbbUL, 0x0b5ba947b3d8ebfcUL }},
+  {{ 0x75cd91bbb64403beUL, 0x3ab4d406cd53eeb5UL, 0xea14cdc534755001UL, 0x2962c9c7a2d22d19UL }},
+  {{ 0x3141ead5881e55abUL, 0xcd8ba96f173f190bUL, 0x1b081ecb8b570ba5UL, 0x1c3186217bb9ca69UL }},
+  {{ 0xcb439ce307666f66UL, 0x5f74105c1dafe820UL, 0xde5f3cd1356ffebdUL, 0x0b4eecf7c88ee004UL }},
+  {{ 0xb6cfaa6cd306ba19UL, 0xbe25f2d84e90423dUL, 0x312ca85ff30ca171UL, 0x213a8aabb786bcdbUL }},
+  {{ 0xc4d5680257fc5d31UL, 0xa471dc4ad8cf254fUL, 0x4379eeca2a1c903fUL, 0x03634d7e4659d1e6UL }},
+  {{ 0x61a9207f8902da74UL, 0x81f4e94d5bd3c755UL, 0x2211f3743d3b29b2UL, 0x0bd9faf62e1af115UL }},
+  {{ 0x3ae2f64eb074c385UL, 0xed7e9f979eef42a2UL, 0x6955d240de4afec6UL, 0x25be79a6835ad2b1UL }},
+  {{ 0xb7e2014e3dc54171UL, 0x9f84b5b3163f97f5UL, 0x51dcef414ac0539fUL, 0x17831b6678b6885dUL }},
+  {{ 0x7600c160361e51b9UL, 0x110bf449d1a48e28UL, 0xb5eb6f040cd39709UL, 0x2fdbb9fbb8ebd7f8UL }},
+  {{ 0xe95667c28254e8deUL, 0x9ecacd587a3c10eeUL, 0x621fea490ca11ad0UL, 0x1bc92f0f47c304bbUL }},
+  {{ 0xb7401743c95b7ae8UL, 0xe4eff3dd7b3a356dUL, 0xa9d5b4b86f7f8b3bUL, 0x23cc8358f9175e00UL }},
+  {{ 0xb4e956ae777791cbUL, 0xc1e43255a98f2cbeUL, 0x1bac13a8d2ea88d0UL, 0x2f59a95e89973eb7UL }},
+  {{ 0xc4d196c2915777f3UL, 0xb16fa63ca09977a9UL, 0xaccb30826ab31c57UL, 0x128d28e1b45d38daUL }},
+  {{ 0xe8389470412379f9UL, 0x1268a5babf05a484UL, 0x4c62ba79a3bffb99UL, 0x2ee1767d5010f7daUL }},
+  {{ 0x3692c4eb19caf796UL, 0xdc93e23de73cde9dUL, 0x14b73c476d653849UL, 0x20ac7d1a7cd94e38UL }},
+  {{ 0x9e2b514eacc63827UL, 0xf585413250fe50c1UL, 0x2036c7e6825900a7UL, 0x1c4d4e513ab23612UL }},
+  {{ 0xb0b579aff32615ccUL, 0x6f3cee397bb75660UL, 0xad1f8a1b1b043dbfUL, 0x29a06d66efe59989UL }},
+  {{ 0xb924f570eff17192UL, 0x9582e1ccb1ac6153UL, 0xcf4f9a853c0e9aa9UL, 0x0e220e8f0eec9927UL }},
+  {{ 0x637827d5c5d2e72aUL, 0x02540e52bca613f2UL, 0xde9168fd08773c4fUL, 0x044a623a6028814cUL }},
+  {{ 0x1b86c682af7b3140UL, 0x4be2899794ef64a2UL, 0xb6da10dad3e49e52UL, 0x225d84ce2c1fa0ddUL }},
+  {{ 0x6061b727a1037be8UL, 0x68ed6c98eac82d21UL, 0x8ab86a0a1c5e0665UL, 0x07bc85756830be5cUL }},
+  {{ 0xe4c61517409d286eUL, 0x63ef22a3d81007c8UL, 0x90220eacda253573UL, 0x27712124bf2bd940UL }},
+  {{ 0x71c0559579a884cdUL, 0xef85f2045fd85e85UL, 0x62d01585fc0fe591UL, 0x131def55662460bfUL }},
+  {{ 0x47ea781e61ccd2c4UL, 0x0c5e6fe553c08191UL, 0x154751a7c16e98d8UL, 0x25802c3886db00e3UL }},
+  {{ 0x482f2ea8ec0c21c2UL, 0x772d64bab472a777UL, 0x2041ed1ab6f34677UL, 0x08f4ec7dce952a1fUL }},
+  {{ 0x1a9677f0a75b7ffaUL, 0x6f575fe845623c5fUL, 0xb891940e132eef24UL, 0x0087a0f9f498260aUL }},
+  {{ 0x97796febde4dd59bUL, 0x301cb8154b340753UL, 0x857b58555f6b9b1aUL, 0x258dc1a2c3691e4eUL }},
+  {{ 0xd72c9a5689e53e09UL, 0xc1aae72e8c2f7758UL, 0xc57bf01e41f50840UL, 0x2779376282c3d90bUL }},
+  {{ 0x6fb51922f2918f24UL, 0x4597bdfda5d5b917UL, 0x00fcfb294589824eUL, 0x256a044473bbba18UL }},
+  {{ 0x102ed782fe80840eUL, 0x93c2982cb641be17UL, 0x4c5896125c0ad726UL, 0x0ab968fdbab0617eUL }},
+  {{ 0xc1b988f71d815c0bUL, 0x5a92cc2cc2b572cbUL, 0x287b8a8f54e281f6UL, 0x09ba0abbba0e1899UL }},
+  {{ 0xc28e0fb245c83923UL, 0x6643628236d4aa22UL, 0xc95972a4e9cc4084UL, 0x006ae6807cbfcab7UL }},
+  {{ 0x7291be840cb7a732UL, 0xbc27cca842694485UL, 0xc8ba48d0316d87baUL, 0x1d59b3686cf179b5UL }},
+  {{ 0x45e8e3a794cf1f92UL, 0x967d0f76c336a5cdUL, 0x67f35a1f7e7ba408UL, 0x09bd0e32a9c63c00UL }},
+  {{ 0xaf50bab177808820UL, 0x038d33fee5076fb9UL, 0x02b84d8cb102ae26UL, 0x1fb5ac5fc740b8fbUL }},
+  {{ 0xf1da97e06a8218c6UL, 0x1328f1c0ed154a46UL, 0x77daa22da243bf9bUL, 0x11e3f903f124aa39UL }},
+  {{ 0x2d467f9f4f17936fUL, 0x68a0671a9ec3f96eUL, 0xf19aaae942f5c8caUL, 0x1ab8a165900c644bUL }},
+  {{ 0xa9c531f352c7d975UL, 0xc7781a0aa90da56cUL, 0xdd15c3ef5964c075UL, 0x0dc64c3af299fafbUL }},
+  {{ 0x68d56adaad75fcd9UL, 0x98e0a2347c9aae9bUL, 0x857fcdb278d2c54aUL, 0x041940f867e28a2eUL }},
+  {{ 0x88a850f04b575ed4UL, 0xb025508749743d5fUL, 0x4a496244502bac5fUL, 0x26b75d0022330d3aUL }},
+  {{ 0x681c654594ce92d9UL, 0xf036af9c20941a8eUL, 0x97646619a9bd0647UL, 0x29329e1428fbb13bUL }},
+  {{ 0x9944d0a698810012UL, 0xe941aeefaad9db96UL, 0xdb7ce5c8a441d223UL, 0x100b7683534f0eeaUL }},
+  {{ 0x2cc21221cbb9a6b3UL, 0x1b783d7bc4b7acaeUL, 0x30e9f7f97529a86fUL, 0x0832076de742a90eUL }},
+  {{ 0xcf3617fba0d72310UL, 0x4136a4abd21641c6UL, 0xa10ff7a507d78c38UL, 0x23fe575fb73d433dUL }},
+  {{ 0x7a789a152cd40c65UL, 0x619a793c1c545f2aUL, 0x3bc4cdc21dcbf407UL, 0x00600e47257bdfb7UL }},
+  {{ 0x85b4e2a5d80b6c01UL, 0xd1fa8fa3c0e7dc47UL, 0x9dd95d4027f8ea67UL, 0x20dcd0203b8bf89eUL }},
+  {{ 0x77db0422df3b5efeUL, 0x53a71e3e61bce5d7UL, 0xbbbe32e128458727UL, 0x11fdeec2ef601359UL }},
+  {{ 0x4608d5cdf73570c6UL, 0x0226b2e523b1a484UL, 0xc7831086fdabc6e2UL, 0x2cce5b9b1d4c9652UL }},
+  {{ 0x2686d0967e275fa4UL, 0xf3557538e269602eUL, 0xa34299c974fef80eUL, 0x083526db992984fbUL }},
+  {{ 0x221d549630cafecfUL, 0x84cca89c0977cbb1UL, 0xc5e18c1d0362bd32UL, 0x1bec55d4dbd8f1ecUL }},
+  {{ 0xdd0c3995c084f659UL, 0x515059ff593338b2UL, 0x186fca86dec82ce2UL, 0x07d3c6316ee94655UL }},
+  {{ 0x2917d7c4313bbb0cUL, 0x0582cc286915c7aeUL, 0x057ada7e200fd52bUL, 0x02561303b47a706bUL }},
+  {{ 0xb0140b021d421f4fUL, 0x1721c90d46c840e5UL, 0x21bef39dc049759fUL, 0x183aff7b26b13d3eUL }},
+  {{ 0x790a7555df68d953UL, 0xed99728e341ed1abUL, 0xa70712c52dbffb48UL, 0x16981227d60f8d70UL }},
+  {{ 0x8e65d10350773265UL, 0x68beb856ea515bc8UL, 0x8564ef7d672ca1c6UL, 0x1f89c7f8e39c977bUL }},
+  {{ 0x9fe4b5538f476b0cUL, 0x498770423aeff54cUL, 0x00f3091cec8f9c3eUL, 0x1ab819b1bcea8d84UL }},
+  {{ 0x50eba460d99beea7UL, 0x8ee74eee7cf262dcUL, 0x8441c1205f520602UL, 0x00a7fa402c65e72cUL }},
+  {{ 0xaf1eb0b41b8c1b38UL, 0xf8c97f3203ec96fcUL, 0x230ad83ae721e8cfUL, 0x27ee1c612c043656UL }},
+  {{ 0x6a916cb685350945UL, 0x6bb911d30c487bddUL, 0x3f5c8b953fb78f52UL, 0x235416b03eeb3487UL }},
+  {{ 0x518308390d0bd501UL, 0x63510f27855870bcUL, 0x4ebdbdbf70ae4f31UL, 0x2e488d007f3f6954UL }},
+  {{ 0xbfd83724622ac278UL, 0xb50b0625439ad70bUL, 0xead002bc22af9469UL, 0x0acf1db6bfdda580UL }},
+  {{ 0xa1f6d4818b6d2f4eUL, 0xe9d18b78c29e6c84UL, 0x8dd5963eb703db5fUL, 0x1bb12e7054333753UL }},
+  {{ 0xfd75af860a88117dUL, 0xd2b04c337e01d405UL, 0x232893c9f7a28534UL, 0x26826843783eca87UL }},
+  {{ 0xd0074bfaa478442aUL, 0x6c31dce69b5650e1UL, 0xf5aec0b65a1aeaa4UL, 0x1879703413a6690fUL }},
+  {{ 0x04dfde5f412ee773UL, 0x0e1bc1c111dd3d2fUL, 0xa7af2a838fcf08a6UL, 0x184ae18e89b3ffc0UL }},
+  {{ 0x45c6c36cb9b50212UL, 0xfe890b069a643a44UL, 0xc9ce750deb82dd53UL, 0x0b9efa737389af58UL }},
+  {{ 0xe75747a15e11e777UL, 0x39c21f3d3e4a543dUL, 0x98a15cf3ed898124UL, 0x2082de69be4f422cUL }},
+  {{ 0x7de34d03f07b6efdUL, 0x70fa96803d7da9b6UL, 0xb5969ea0603fb8e5UL, 0x12a1a09392cdbb15UL }},
+  {{ 0x276978c8f01fcd08UL, 0x90cff11d836baddaUL, 0x8cdff1d0cbf889a6UL, 0x21282918e716675cUL }},
+  {{ 0x80807b320ad3af74UL, 0xc9112b28bbd58e2eUL, 0xa6c18daa21757ab5UL, 0x133e07def08e5ac1UL }},
+  {{ 0x4f787e2a30437a93UL, 0xb583745274e9a61eUL, 0xb3f739dec1da2447UL, 0x0049fc975ea20609UL }},
+  {{ 0xbda6c36661fe55c1UL, 0xd8dd0d97e11a3dc8UL, 0x9ded5b2b37190a69UL, 0x23ed33a1eb5c5636UL }},
+  {{ 0xabe9b3bb0bf3fd55UL, 0xc19e054a1e0416a8UL, 0xd0138927d3c82b49UL, 0x02cd6cffc83417f6UL }},
+  {{ 0xd10645a1948f4dffUL, 0xce50c818f3d48d0aUL, 0x48f8d3c48d6e1ea4UL, 0x284369bc42779199UL }},
+  {{ 0x6f7ba8fa100469abUL, 0xc3550bff80c7b6d2UL, 0x09de633eabb65cfbUL, 0x0e8d6e950bb84d0fUL }},
+  {{ 0xfda959a5b9c61532UL, 0x2ee7d66bd6667f6cUL, 0x10161a726912da17UL, 0x10125948700c9eddUL }},
+  {{ 0x8c7391781e586222UL, 0xf8a2877b39e87cdeUL, 0xa5bac6ec83909a58UL, 0x0894c0c117398a93UL }},
+  {{ 0x2134eda40ce6ed74UL, 0x4a778b960cf7962cUL, 0x9fa97faa24efa1b6UL, 0x006685bf5f6a131aUL }},
+  {{ 0x5f7bb2a5971b5ec6UL, 0x29c69805ee0ebdcbUL, 0x69354acef6c58c45UL, 0x24a95debd5e1cd83UL }},
+  {{ 0x391bac46a5f2bec6UL, 0x9442f7c62d81b46eUL, 0x2bf3b0cb86334c1dUL, 0x16d462ce2d6235b9UL }},
+  {{ 0x6a4830f14a29e09cUL, 0x123c5e2c5f195edbUL, 0xe855e2f5a4cf3bb8UL, 0x14044df8054a443eUL }},
+  {{ 0x4ebbb4d17438274eUL, 0x547c03cadf06aed2UL, 0x2557bcd7a0995356UL, 0x1b9f0286080c81a7UL }},
+  {{ 0x41e72fa3d756a81fUL, 0x6c524aaacb0ec4e5UL, 0xd64279c2bd71a6a6UL, 0x24c526106daa793bUL }},
+  {{ 0xdb6f79fc57a8694cUL, 0x38d8604be1653ff0UL, 0x824cf0bc6290746cUL, 0x093bd8a299c37a9aUL }},
+  {{ 0x5f58404c2f24a053UL, 0x99dd6d887f097a44UL, 0x03a79273eb804e46UL, 0x21003b3fbd1f8295UL }},
+  {{ 0x2be6a36976181cc1UL, 0xd4ebfd66d21bc727UL, 0x5b59dee800e251b9UL, 0x1bf44979a50f0d3cUL }},
+  {{ 0xb240e983f8eb59a4UL, 0xe1e06019147076eeUL, 0xbc5263b94afa2a6fUL, 0x18f170b39f10334aUL }},
+  {{ 0xb76bdb80cb91a12aUL, 0x0fb18a6de02a6c09UL, 0x03c0430906d22c49UL, 0x2690cf70032d36e0UL }},
+  {{ 0xa07fa503a9df45f2UL, 0xa9690061fa5ae9baUL, 0x1785493d77866ef0UL, 0x2dfa9a5dcb4c09e9UL }},
+  {{ 0x95539eb985844a07UL, 0xe9bc44e8df7ab413UL, 0x0e4f11d0ff1ef353UL, 0x1708ce91c3556f9dUL }},
+  {{ 0x9dee4c5a988ca61aUL, 0xb6b745a020f669c1UL, 0x132d0768fb71dea1UL, 0x05a273be7a302a79UL }},
+  {{ 0x4231ef0e7a21e9e9UL, 0x7a82d9d6dfe62958UL, 0x60d3cd72e1ad8dcaUL, 0x0dab2db658d0c0f1UL }},
+  {{ 0xc91d17e663da1ff9UL, 0xe0ee4a006a6e2f1aUL, 0x5fe165d505ac0d35UL, 0x2a252d8fcacacb5cUL }},
+  {{ 0xfa6ccbbf8de10ec5UL, 0xa8733d05abe85180UL, 0x266f1774945a7b76UL, 0x249a63fcaaf1797eUL }},
+  {{ 0xef2f0ac672fde148UL, 0xf20a19f1bf904b7bUL, 0x18e67afd4f48b517UL, 0x21e4680b9ca2c784UL }},
+  {{ 0x3129a6b0f3ae04ccUL, 0xee377193cb7961cbUL, 0x95d687e7e128a6c5UL, 0x16af24031a5fdc53UL }},
+  {{ 0xc3d8970672ab916dUL, 0x1cbdd550fb4d494eUL, 0x4000016036963c3bUL, 0x172b7eb0953a9038UL }},
+  {{ 0x0a785948d9a4fa09UL, 0x97838f652d377a7fUL, 0x2ec35c40a6031dc9UL, 0x0581fdf20efce267UL }},
+  {{ 0x391498695366f862UL, 0xf0682fd4675bc6feUL, 0xd4576021990fcbfbUL, 0x1a8c5b71d04958f4UL }},
+  {{ 0xf9b9990f728a3db4UL, 0x2fcbc9307eeaabbcUL, 0x988b377849ac5436UL, 0x0368dccca3954082UL }},
+  {{ 0x730335097afaf1e8UL, 0xf3a7b89b3b021d92UL, 0x64c6e2ccbaaa5892UL, 0x2e68b5362a24f7eaUL }},
+  {{ 0x50fd9aa286a0a38eUL, 0xc4dd085037dd69a6UL, 0xe8fcbe2fce20c371UL, 0x0ae6edaa0295e901UL }},
+  {{ 0xeb1ac74700ab4cd2UL, 0x1f66d5bddabb7c1fUL, 0x0889ad020ffa1026UL, 0x0df45a04ac81e0f0UL }},
+  {{ 0xfc0405515e6a28dcUL, 0x449a85fe98c1857cUL, 0x60f253e49699b6b1UL, 0x24b659a685566de6UL }},
+  {{ 0x9b01af2f03babddfUL, 0xbc12a9e5b90d0dedUL, 0xf5ded3afbab3fd3bUL, 0x0659da0ebf4c146cUL }},
+  {{ 0x28ddf8e40d9f1dbcUL, 0x24ff54d42b2a5eebUL, 0xc5854748eb368cbaUL, 0x2f57ca32063132dcUL }},
+  {{ 0x1c0ba241f3f75ec5UL, 0xc3f460b54c4ca600UL, 0x9024898428f332cfUL, 0x27012bc3e18f7489UL }},
+  {{ 0x0e1d5b2028a72f23UL, 0x90e06bee18fb0ff4UL, 0x42a21b9dc7de3690UL, 0x208efea8e1cccd23UL }},
+  {{ 0x4d94d0bfabf69c8aUL, 0x2962a5f7df4face3UL, 0xf76356f5ba3dc324UL, 0x30407167bd16015dUL }},
+  {{ 0x43d5500d8fcb2a08UL, 0xe5f36cf475b1c778UL, 0xff2f99e88cef28cfUL, 0x1d5a065e9ef8d685UL }},
+  {{ 0xd60d0fc96fbb48a0UL, 0x4f20f62cb2e99868UL, 0xfbc8399a0a6c0e09UL, 0x20c530e529e43dafUL }},
+  {{ 0x4e680bc5618dcff2UL, 0x84d65e3eb98a5f66UL, 0x3ab8dc9580f3c87eUL, 0x1cd4ecd2f03ac6dcUL }},
+  {{ 0xdfa7feb97d693810UL, 0xb9f10f315e5754d0UL, 0xff5b988ed3b9715fUL, 0x199de72290187b1aUL }},
+  {{ 0xae1834a7fb261cd4UL, 0x9d9432fe6dfd5ffbUL, 0x8f5ffa3adb7afdfdUL, 0x04bd5770232c55a8UL }},
+  {{ 0x4984145f987fda00UL, 0xaf285b4fc36e6fb8UL, 0x78448365e122ddc3UL, 0x09ead696c2f03a9fUL }},
+  {{ 0xe91588be53e1dc9cUL, 0xb8b5ef44c332f947UL, 0x99a2c79fb84645c1UL, 0x1069bb35b6a4ca49UL }},
+  {{ 0xc8d0441aab750925UL, 0x71256e3eff3ccd27UL, 0x13fbc8e19e5fd16cUL, 0x0f6b172c51fb7298UL }},
+  {{ 0x94536f5d986f4149UL, 0x49dbc4ddb2afe31cUL, 0xee60c45fa5857b8fUL, 0x26dc0b59f28e073fUL }},
+  {{ 0x59eef856a291499fUL, 0x62d0c9e4828a05a7UL, 0xc7107464730c1a56UL, 0x0f8e6261af64d739UL }},
+  {{ 0xa7f8ea38bcd25235UL, 0x4d95107e385418aaUL, 0x1fed9521c9c7c39eUL, 0x045182faebca3801UL }},
+  {{ 0xc02a96f018a5caefUL, 0x6c1e4ffda4dad5f6UL, 0xf6a1b8785a78e9c4UL, 0x1ebac5258555ca47UL }},
+  {{ 0x0fccdfbfe5e92df4UL, 0x43943aea6a600897UL, 0x9af0558ad1a0a34eUL, 0x243c9510a8982834UL }},
+  {{ 0x50dea1ac46a571a9UL, 0x12d42693e0eefbccUL, 0xedaebd4d9a33009dUL, 0x0ebb3564a9d2f25cUL }},
+  {{ 0x63db9f4d1b82f582UL, 0x4ac97f822ae27dafUL, 0xd6619391a7a7e36dUL, 0x05b54e93d31c7a2bUL }},
+  {{ 0xf48c4d90aaece655UL, 0xf25386c01e2afe5eUL, 0xeb3a25f4cfe29fd3UL, 0x013b981c9dce10e4UL }},
+  {{ 0x405e6e16daedbdaeUL, 0x37da47d2a6daaa8dUL, 0xf44764c5201192beUL, 0x05a1c2b1ae603375UL }},
+  {{ 0xc682b922fae66bb2UL, 0xef6d38a019668ec8UL, 0xb4d87c377a1515dcUL, 0x276278a3f1a09352UL }},
+  {{ 0x618c7b342f90573fUL, 0x82b9d5c033524be6UL, 0x73a882a55b1fe206UL, 0x13631e54da876244UL }},
+  {{ 0x6b1a8e189a74bfd9UL, 0x4b708e6b8b8703e3UL, 0x03f62ba225267658UL, 0x0e98a4cf46edbe35UL }},
+  {{ 0xafdb905e44ed2b9dUL, 0x102bc7e65d570c89UL, 0x7d1bc38de05c4350UL, 0x0b2589757af6f98dUL }},
+  {{ 0x2e4c5fa036de0b9eUL, 0x10e68e2228b6c8adUL, 0x441df6499727043dUL, 0x240fc8686fb3a903UL }},
+  {{ 0xe0b9a5511d4f4847UL, 0x7bbd8b989931a14cUL, 0x7b9530db677a10e0UL, 0x1f36c97b2910cccfUL }},
+  {{ 0x8743e0c8252e768dUL, 0x74cd3bdbc974d606UL, 0x05212bb1e392288dUL, 0x1a1d8c4bc729e639UL }},
+  {{ 0xd2420199b33a946bUL, 0xbba68ec16b24918eUL, 0x77f773c6a218caa5UL, 0x151b6ce608abb0e3UL }},
+  {{ 0xfa706341992e9d28UL, 0x648991da37be9292UL, 0x7e434754f3e45e8eUL, 0x07511ee1404f1413UL }},
+  {{ 0xba232a53120801c1UL, 0x686eb938343ff23fUL, 0x3458f845abba1a05UL, 0x00d12575a2ef160eUL }},
+  {{ 0x5bcd52bcb7609f36UL, 0xfe3fe53ef84c1ee4UL, 0xf0e889067bbd9db3UL, 0x0a550a432dba77e4UL }},
+  {{ 0x7d638120783f55cfUL, 0x359bd61f5a897694UL, 0x26658213ce822002UL, 0x2133342a4e1de1e1UL }},
+  {{ 0xe05387e955055758UL, 0x06f5d76021e3d19fUL, 0x9f674ac2bf56a297UL, 0x161c425edc359c6fUL }},
+  {{ 0x9557693f6eb68eb4UL, 0x4f16d2ee6b669f16UL, 0x5bfe47b9ee33a401UL, 0x2a5e723af9c248b2UL }},
+  {{ 0x55f4b6e69c54f372UL, 0xeeb519fca4bc2099UL, 0x17848aa30d2c8b0aUL, 0x2668cf2c6b7d6f84UL }},
+  {{ 0x191d2f0884064c47UL, 0x6afacbe57a473f20UL, 0x7241a259ccf57d84UL, 0x2650beedb27e8a05UL }},
+  {{ 0xcb8317929f2a3df3UL, 0xd6f520465f177f12UL, 0x633c1a7a4d30c4e4UL, 0x23e3d6a846e9062eUL }},
+  {{ 0xefc47d0e4c7b9fdbUL, 0x7e22ef5ae2fb448eUL, 0x03f5af62594186c4UL, 0x2b1ce87d37cfc519UL }},
+  {{ 0xab49bf3b60653ee9UL, 0x3fe2e4f57926a88fUL, 0x9cb0eb2c782e86eaUL, 0x2ea3f29763ae32b7UL }},
+  {{ 0x190d6a0585fd26c4UL, 0x50b27aa08dc14e9bUL, 0x18c464cc92fd5fffUL, 0x1536f6d6aa663e38UL }},
+  {{ 0xbad51a35e6e6324eUL, 0x5c5d5fed932af554UL, 0xa6f8a969603ba6bcUL, 0x00788a089c5e6bbdUL }},
+  {{ 0x1b03f675be1653b6UL, 0x62d8666d96828aa1UL, 0xbc0317f079787550UL, 0x1eee655ac0bbe3dcUL }},
+  {{ 0xfbda0a7e8f043afcUL, 0x2335d315c6d8efecUL, 0xf61f473ff7d4d8c3UL, 0x2d929a5505ac438bUL }},
+  {{ 0x83bca0fe8b9c73d6UL, 0xfd3b3a4bdbca2db8UL, 0x09cc070a8a69f56bUL, 0x1071d510f1d30711UL }},
+  {{ 0xd66a5459e1f9bfceUL, 0x8f53eec1fcfc9720UL, 0x73b1568421d553c2UL, 0x2fd6bd79cf12fd7eUL }},
+  {{ 0xc292c15ea8ca836eUL, 0x68e13563452a0880UL, 0x3d30227873d9fa90UL, 0x0cf01cc55e223a6aUL }},
+  {{ 0x10901e3e3eaccce4UL, 0x67586d75d04977eeUL, 0xd555455a5025fe77UL, 0x0a8d9d19e8f0a531UL }},
+  {{ 0x4f85c28d548f98d3UL, 0xc9f4f3b4bcf57c7dUL, 0xf5e584a2881e1e57UL, 0x116b3bbce21717dbUL }},
+  {{ 0x6e64051e3d1bb684UL, 0xeb904c4857452400UL, 0x9ca7b6ed7d983465UL, 0x001cd6267875a062UL }},
+  {{ 0xedf7f51624b8f6ecUL, 0x14de265fa29219f2UL, 0xf05f400055b00d49UL, 0x12c92f6797053853UL }},
+  {{ 0x6753867bfc55d654UL, 0xcbe704cf6e758185UL, 0x1b354ea1c579c9afUL, 0x01701221a3396cc9UL }},
+  {{ 0xdacefc739d2adb4cUL, 0x0b007a8ffdabc950UL, 0x3f160452765399f7UL, 0x0d0fe55d208bc8e7UL }},
+  {{ 0x292aa4531236d1d6UL, 0x3a21a3493477281fUL, 0x8ceb8f578019a04eUL, 0x2ca4fb2809bcf06bUL }},
+  {{ 0x71ab1e81f5418871UL, 0x26e779c06179b130UL, 0xb5f66d8c9e3966c1UL, 0x2552372c88d8e60dUL }},
+  {{ 0x64aa1835165d50ceUL, 0x64d4301528a65f5cUL, 0x9cf72e468a5b4401UL, 0x147b00e0d195e549UL }},
+  {{ 0xeeb4b1bfcdf21901UL, 0xe3b853567af2e29bUL, 0x7e87475a495cd0efUL, 0x278da474fc64693cUL }},
+  {{ 0xf847f2fa1c6e2300UL, 0x6363f97dd64bed47UL, 0xf4da0de19b2c523fUL, 0x198053bed85ad925UL }},
+  {{ 0xcc43ab1a039a4400UL, 0x32121e68725e8e9bUL, 0x35ecfc94bb519b7fUL, 0x258dacf476b57359UL }},
+  {{ 0x12d5fa192bce3aa6UL, 0x9b71dd4df82cce89UL, 0x92068a1c2576ffa1UL, 0x06479b272c2d731aUL }},
+  {{ 0xa8ce40e7f5c77844UL, 0xb3e3c00cc2a294e0UL, 0x645f0e437e391ce2UL, 0x0e6baf84356517d4UL }},
+  {{ 0x909775ef1f51ce9dUL, 0x5be84008d0bf46c5UL, 0xe735d2f76d2b431bUL, 0x18aaf7ce214227cfUL }},
+  {{ 0x59cad3e1b3604198UL, 0xabf10174d538d1f4UL, 0xb5f80e83430911edUL, 0x2c62b26dda396348UL }},
+  {{ 0xe5671ef46ed5a29fUL, 0xe060eaa824ba63d6UL, 0x4b3530c94e712890UL, 0x080c1d1c40fc2810UL }},
+  {{ 0xef522cf1677c3654UL, 0x206972f5a728c31bUL, 0xf0412ddce741f8b2UL, 0x0bbf1ff2a07a2ac4UL }},
+  {{ 0x06ec8fda7ecfa48dUL, 0x118e756ccc95368dUL, 0x9415587787ad4d0eUL, 0x02ad748400994432UL }},
+  {{ 0x0b793cf3a096d189UL, 0x357debe8cb31d78cUL, 0xb7b25b1b0ca5f733UL, 0x2f376a2c14f32aceUL }},
+  {{ 0xcf7a68557c7e8811UL, 0x388414ff767fadeaUL, 0x0d4c68026452888fUL, 0x273cf4784f7af3daUL }},
+  {{ 0xacd8b9c4e9e5a870UL, 0x8d6dec67a6477522UL, 0x192e9c06349c7fadUL, 0x1fa1f04221334c23UL }},
+  {{ 0xd17c4c56830d9aa9UL, 0x5452ba8004b7a719UL, 0x465b297908061680UL, 0x11671598eaedb451UL }},
+  {{ 0x7305ce10a1068eb6UL, 0xc4d7979d2ffb8755UL, 0xa30e90596d19868fUL, 0x244b5fea15fb315cUL }},
+  {{ 0x4e264f7e75f8c44dUL, 0x3c7de81af9512a74UL, 0x2d872831fda94aabUL, 0x2f427a1816379c29UL }},
+  {{ 0x0b53e948b5bb1719UL, 0x79a048c4c5e1d30aUL, 0x0cee91407a34b05dUL, 0x0919e9de28f0360fUL }},
+  {{ 0x9e94d21016cdfc67UL, 0x788cc0960e50f036UL, 0xb868c9284fb51064UL, 0x15d7f2c51c1d3019UL }},
+  {{ 0xfb4c715fd5e55779UL, 0xa693e51895f56842UL, 0x4ae62c8abf4a62deUL, 0x2b21395da6e953c0UL }},
+  {{ 0xbf4d0ddffc57d93bUL, 0x41018ef158d2e782UL, 0xfb26432fd283857aUL, 0x0ec48dbd02881e15UL }},
+  {{ 0x893519bdb76d2f65UL, 0x5a47ed0f05e8bf36UL, 0x5746e72a5d62110bUL, 0x1a2561a942b8cbc2UL }},
+  {{ 0xc83b761cf39871a3UL, 0x382157981aad5b5dUL, 0x890300f37c1ab304UL, 0x18dca490354e5292UL }},
+  {{ 0x20d47e851578ec02UL, 0x4b99a219101a3ab2UL, 0x03e41ce391ae9f7eUL, 0x0e611dd73cc84468UL }},
+  {{ 0x09e300b752a5a458UL, 0x8cfe1812a532f592UL, 0x8a84bb75894b9db6UL, 0x22bc35db9b9d5f89UL }},
+  {{ 0x301936cf223564ccUL, 0x88d54c939fed7ac8UL, 0x870441bec5cc542eUL, 0x0c5634a32d4c2d9cUL }},
+  {{ 0xcb661457100de084UL, 0x392220a964bc7650UL, 0x1bda0ca139a8f113UL, 0x0dad44b3b80d6485UL }},
+  {{ 0x7daf92c22cfa2263UL, 0xe44fdf27f6bfdedcUL, 0xf7bde3455e802d8dUL, 0x22dc47988166c427UL }},
+  {{ 0x33c285083c49999eUL, 0x115629016e35b72eUL, 0x507ad22e805a0b87UL, 0x0c8f55f6b4e8dcf9UL }},
+  {{ 0x4d3bc85d4b0f5a65UL, 0xc33afdec5863652fUL, 0xe22ff42a81910bd1UL, 0x1b01d689b1308eb7UL }},
+  {{ 0x18af6c2751cb592eUL, 0x8775e43d93450b31UL, 0xfcf448a166e0bc83UL, 0x17d46a7ae42c1f47UL }},
+  {{ 0x02fc2593803c2b85UL, 0x72f026cc8641910aUL, 0xf699a65896276063UL, 0x12ac98add50bf968UL }},
+  {{ 0x890bc15c01d02a55UL, 0xc7a2601c2a6cae5bUL, 0xff66b4b337811f13UL, 0x068bf701e4696a3aUL }},
+  {{ 0xd4c7ae84e41e847bUL, 0x185a60f095131cc2UL, 0x5168c172049c95a0UL, 0x0e4364bead4acca2UL }},
+  {{ 0x553680da80c2a3feUL, 0x9614a9ed05888c8fUL, 0xb95769374b5e8c39UL, 0x03fd2636099a7b4fUL }},
+  {{ 0x07477d8a812ca51eUL, 0x749779add2d50015UL, 0x304b0544c808071aUL, 0x1c47525888d0ce4fUL }},
+  {{ 0xc3f44f8cde83b8f9UL, 0x0d5f9f93be8eb1d0UL, 0x6a847c645471fc25UL, 0x12ce1a04e5a9c406UL }},
+  {{ 0x0f3ea1b3e4ffb122UL, 0xb7d66002ce4a5210UL, 0x95d74af69e318cbdUL, 0x1b2cb17559d51afeUL }},
+  {{ 0x80fa3dc1f9fe5cf9UL, 0x5c1ee2a7a4aa5672UL, 0xb88a99334e053291UL, 0x0ce6dd8841bf2b4aUL }},
+  {{ 0xe7e0a4be49c3c7aaUL, 0xda3c95bab8ff7bfdUL, 0x1cd02d4c72ad899eUL, 0x0ebbcbc8dbba3eebUL }},
+  {{ 0xdd85d05994492daeUL, 0xf44963a702e1187cUL, 0xc4d6abb4f39a81d6UL, 0x1d01c5564f761eb2UL }},
+  {{ 0xeaaf93ac7cafc5e9UL, 0x44de3265b03b5339UL, 0xa5c281d632f219b1UL, 0x099384fd83e24a8eUL }},
+  {{ 0xcc145b512991cf46UL, 0x56d2c72fed4c7658UL, 0xe5535cffc30e4464UL, 0x11212470e1820fc0UL }},
+  {{ 0x73b537fb35849e2dUL, 0x8d68777aee60b213UL, 0xfea0d895b822cce7UL, 0x2419e3f64b5aa716UL }},
+  {{ 0xbc6e22591d4a69a4UL, 0xb45514693b5bc27dUL, 0x71194ba249db19adUL, 0x2e09594edcd2c707UL }},
+  {{ 0xfe32194ceaad030bUL, 0x0b8cd6d743c38993UL, 0xaf1ed66c304a3a58UL, 0x2f8a4f80e78d8771UL }},
+  {{ 0x27d6876690fdbcfeUL, 0x03a2aa92bb04dd3bUL, 0x0cfe8be7b3131025UL, 0x1bdfdf556f7b98a1UL }},
+  {{ 0x368d60d712d25bd6UL, 0xc4deb95590e09420UL, 0x5b46e475d2dc700bUL, 0x22e9e1d69434087bUL }},
+  {{ 0xe781900259595d5bUL, 0x8608b1f0037ffb31UL, 0xff71940fbdc7deafUL, 0x07281315b3ed9b6eUL }},
+  {{ 0x044746a4bbcc6449UL, 0x7580af0d79229de0UL, 0x6485f2defdaac0c3UL, 0x24110dd3beb0c62dUL }},
+  {{ 0x7b5a5c7d3e70e198UL, 0x5f1924e6599a1e0cUL, 0xbfb1e4114f183cf9UL, 0x15b007d9304a1075UL }},
+  {{ 0x418dba216ce70714UL, 0xb1d4b261e0202c69UL, 0xca0f77f35e2dc60bUL, 0x0c41153825b28d87UL }},
+  {{ 0x6f1e5f44a30e596dUL, 0x82bea31e6aef52afUL, 0x061219f99902977bUL, 0x069bb0321d24e32aUL }},
+  {{ 0x22cfeec1276d5cd8UL, 0x754a274405c7f172UL, 0x3dd17a90e44b7c64UL, 0x0ab175ffae0683fdUL }},
+  {{ 0x601d553b7292268fUL, 0x821e661419d0250eUL, 0x53734b70bca5f939UL, 0x08ea2b63f537e62aUL }},
+  {{ 0x2138fcef0ad4af2aUL, 0xf22a8f04b6c85896UL, 0x508c233424d735d3UL, 0x13a80378b7635428UL }},
+  {{ 0x01d70be7f80c5d48UL, 0xba6af04611ba242cUL, 0xea606d410553ea92UL, 0x072e62472b3bdc6dUL }},
+  {{ 0x2101b97ff9cd0e5bUL, 0xbc4be2bf34ff7c81UL, 0xfb8c42e0b2cc175fUL, 0x2435701e78f7ed39UL }},
+  {{ 0xfacd1653b6b46ba7UL, 0x6beaaa7eb2495c70UL, 0x2d653699e461ff30UL, 0x260cc04925254d13UL }},
+  {{ 0x228f6ec64ce4ec97UL, 0x086c38a3ece7cf5dUL, 0xbf750369d257ee55UL, 0x1c9436b75dc233fcUL }},
+  {{ 0x6ac40cfa6be4caa1UL, 0x6b2a531d7cd7a6f5UL, 0x1b8b1af25dc5ed92UL, 0x0ac194ad0c2775c3UL }},
+  {{ 0x36a99bf407c1d3c4UL, 0x3ad6c839c976389eUL, 0x30900c66117d752fUL, 0x209ea6e3e0090799UL }},
+  {{ 0x8ecacdf25266104eUL, 0xaff19cece8c138b2UL, 0x1b2431c2cfb92f28UL, 0x1b7f1b1a1ea6fbb9UL }},
+  {{ 0x8089ae2a333d6932UL, 0xb8af64d79ea27731UL, 0xfc244c077fb268daUL, 0x15b4f648f1b43dadUL }},
+  {{ 0x9a9f967f0ee4866bUL, 0x9b4df71a8761ac0fUL, 0xc87e4b8857c327daUL, 0x052e91992063919bUL }},
+  {{ 0x0da9f78801e705e3UL, 0x83758bead549001fUL, 0xa8b15322d0fea54dUL, 0x2735a1f257ce5f55UL }},
+  {{ 0x1beb3ca53f3982a0UL, 0xa12ec6033975ce3aUL, 0xdfadf92720c5432dUL, 0x1b7e71591d35e0f4UL }},
+  {{ 0x4b82c1ab876faf5bUL, 0xa61308a296ce96aaUL, 0x4d405f67b9d552daUL, 0x04d1d5251d89566fUL }},
+  {{ 0x4d08cac4b0c7e865UL, 0x379d7ad2bcb794caUL, 0xceee74a4e9fbc18dUL, 0x04a3dd20dbe6e237UL }},
+  {{ 0x7d15e3d0455ce252UL, 0x1c63a22d98870e28UL, 0xea93feac5bf870ecUL, 0x1d321ceb1566b179UL }},
+  {{ 0xb3c0639375a66e6aUL, 0xc3594056e29481a4UL, 0x49e527ebe6a36898UL, 0x0b7c352d53a380a3UL }},
+  {{ 0x913a61ef67e6c96dUL, 0xa77a72f82baf07beUL, 0x5742383cf5f6aa29UL, 0x1994b75c954cc4bdUL }},
+  {{ 0x6a6ecc547c80d1c2UL, 0x72721fef725e764bUL, 0xb40b5356c380a9d8UL, 0x21a105ab5032d11fUL }},
+  {{ 0x6a838f5a87b2c93aUL, 0xcc97a12654e86900UL, 0x466afd2c4a767b2cUL, 0x283904ad4ac40dd6UL }},
+  {{ 0x3fd8216aa338cd35UL, 0x9f35cc6f8ab693d0UL, 0x9ac8b73b3bfc1324UL, 0x26a5537ececeb53eUL }},
+  {{ 0x441ebfa96536f6f6UL, 0x8f6255b5fc8262e3UL, 0x9815d2976f2d6847UL, 0x2da9c7057ec4f39cUL }},
+  {{ 0x243aa3465ed58a7eUL, 0xcda51a6ee00b748eUL, 0x485c6b05aa48c2ccUL, 0x29ceaca828562670UL }},
+  {{ 0x28f3d577cc0a4a6aUL, 0xd92089f64cec4275UL, 0x7af600f24937b55fUL, 0x0dd31922c6164bbdUL }},
+  {{ 0x72323bca0e27e36fUL, 0x6b8f378e72f5af6aUL, 0x8c9f9a98375acef4UL, 0x134c4a4afbc83cd7UL }},
+  {{ 0x8ad95c0a696ab692UL, 0x99c98ee2584b6f0eUL, 0x4ed106f2ac3637cbUL, 0x0979c116c0a0a899UL }},
+  {{ 0x860bce06adfde003UL, 0xa0963116d3a8c248UL, 0x110a4ffe6ba920dfUL, 0x22151d7041d60b3fUL }},
+  {{ 0x48e348b3e2335d09UL, 0xe95fb13dfaf976b5UL, 0x479fc0e5dbbcb8cfUL, 0x2c6f63192e84d6b2UL }},
+  {{ 0x9faeb106747e94beUL, 0xecfd4af6fbb2a263UL, 0x434b1aea36517591UL, 0x0c96bd2d1c0c0f3cUL }},
+  {{ 0x94194f50780940ffUL, 0xd6f494aaedb2e724UL, 0xaa81b079e60e5711UL, 0x08a201fc35aeeaabUL }},
+  {{ 0xbe42729fcef5d74dUL, 0x3c3cefbde344f246UL, 0xcfd050a2e3af752fUL, 0x0e6b04a9f3fcfd83UL }},
+  {{ 0xbc0d247b1c84035aUL, 0x7635b48e0605e0e6UL, 0x86708981e8091a4eUL, 0x151711cc6aaa0bccUL }},
+  {{ 0xe03c28055b5d4955UL, 0x13abfab569b42928UL, 0xb74372e78272bcf2UL, 0x0b2626f51333f087UL }},
+  {{ 0x2c8dff8913a13a10UL, 0x6c5cba93b300f36aUL, 0x75eb5b0374bdff60UL, 0x2da8739d2c31d7a1UL }},
+  {{ 0xe11b75bb3ae51e56UL, 0x61678b085ee73c53UL, 0x14122447c70fbf8cUL, 0x24eea415a8990309UL }},
+  {{ 0x17c8a7fc4108e943UL, 0xcdfb61695815e95fUL, 0xb85be436dde7d396UL, 0x174cc8ecbda306aeUL }},
+  {{ 0x38da9ce8f2d257d3UL, 0x42e06a95e8e6e0b7UL, 0xe7e99624f4f36af7UL, 0x24850bde8e5ae3ceUL }},
+  {{ 0x6ebeaed239190620UL, 0xbed532c631686968UL, 0xf200cd8aebcaf97aUL, 0x2f947c39f1c1258eUL }},
+  {{ 0x399515572bf059a9UL, 0x33e9d4daa2a93e3cUL, 0x4e47aa00103a1637UL, 0x299322a226a07184UL }},
+  {{ 0x0ce714587cae4458UL, 0x5cbbf1c664a918efUL, 0xd4cfc9d5be48e459UL, 0x02dca97339adbca4UL }},
+  {{ 0xea7ce9d3b7b49390UL, 0x4fc9b9eb01d50826UL, 0xfbe22819f6f08b24UL, 0x2bd75a4c5e3de3ddUL }},
+  {{ 0xf5a1c8991c86b03cUL, 0x21a6cfda589f7522UL, 0x91c3e5c3e632cf15UL, 0x2e0057d4f8d53ca6UL }},
+  {{ 0xb9b835a9d8a47be8UL, 0xa7970c1937ca1c34UL, 0xe6f12951ebf268b3UL, 0x2e3e7a599081693fUL }},
+  {{ 0xd5c9d3259b68d340UL, 0x707e04f76b9a7e47UL, 0xc7705a1ac1da5f5aUL, 0x2e23ccd2b372f54dUL }},
+  {{ 0x83a856a504be99b6UL, 0x3567547cbb892295UL, 0x8e20bbcbc118c6a1UL, 0x039a92e7ee7f7896UL }},
+  {{ 0x96d5fdec34744edbUL, 0xb77e07a8c793109bUL, 0xb3d1de21eb14eb60UL, 0x0ddd0326e18e49d6UL }},
+  {{ 0x036dbd80848b75fbUL, 0x52d38ff42a92806cUL, 0x2475de9b78915eccUL, 0x10422774b7f508a0UL }},
+  {{ 0xa4876d9c614d688bUL, 0x2912f9a613942ac7UL, 0x1809ea4f35127399UL, 0x25aa325f03e3aa55UL }},
+  {{ 0x553143d978795a31UL, 0xa1e6a4b2c0ce8d39UL, 0x63e1ad619809d3dfUL, 0x1b1b06ea30722064UL }},
+  {{ 0xdbe75f01c1bbb44bUL, 0x523a9bf892512cebUL, 0x2aac9d939f94d4f7UL, 0x21974a99faa665daUL }},
+  {{ 0x5410d36ff4069a4cUL, 0xc5881e76ba92629eUL, 0x7fdba9d2915d5883UL, 0x00388c05dfb53959UL }},
+  {{ 0x4985cf185f2c7f7cUL, 0x6e129455b1223f66UL, 0x0ebc9adc433dd877UL, 0x19e1fdbfdb2dda58UL }},
+  {{ 0xb7c3275e1621fd34UL, 0x450e5462653273ffUL, 0x5610c6f138ff9acaUL, 0x011a76bc1796c62bUL }},
+  {{ 0xee07742dfc3190f2UL, 0x8c582eda7b87a697UL, 0x4a6530cb0f371da9UL, 0x2e643a132c934c60UL }},
+  {{ 0x1b555e68d79eaedeUL, 0xd027e008adf57430UL, 0x9ac4e2babbb862d4UL, 0x21a170540815980bUL }},
+  {{ 0xbe8015d2828d2c6aUL, 0x35252dbd2793ef11UL, 0x3000fdd06d734a52UL, 0x074bfc6b46532c9bUL }},
+  {{ 0x77818f833f8f94ecUL, 0xce8ad5ab9d2bd524UL, 0x8fcfc8cb0ca4a466UL, 0x149ea9422d54f286UL }},
+  {{ 0x27a480836ee3e9eaUL, 0x57ba22457f2c6914UL, 0x73dd8c3be81490afUL, 0x17e9c21e735251afUL }},
+  {{ 0xcf2dd743ff269d02UL, 0xe0ddf5f19c7e678bUL, 0x4d48314e24e91c19UL, 0x28200bd3f83e5e03UL }},
+  {{ 0x8b6e092a963bdadaUL, 0x6514183cf2e87bc9UL, 0x9af4dff8f9a48606UL, 0x19a2ee084f73d87cUL }},
+  {{ 0xc3a084e89f4361e5UL, 0x86e4252510b76f94UL, 0xc908f144624483c3UL, 0x1e3335fd4d9667c2UL }},
+  {{ 0x0c056fad4a1106d4UL, 0x33f118f37c6f9162UL, 0x67b607b09a32845bUL, 0x0785e0bc2564ba27UL }},
+  {{ 0x9db8a479dc078d31UL, 0x65e8bcc59b1daec6UL, 0xbfadf51db2b5480cUL, 0x0885b7ca0047a3e0UL }},
+  {{ 0x3f99869d796f7a2aUL, 0x0e6c8f67c143b29fUL, 0x7f01726cdf0f1cfeUL, 0x275f86ff86d72e7cUL }},
+  {{ 0x64b2946f05067fb7UL, 0x5a11d7c6933bb751UL, 0x7cd1a0485b1ef7a2UL, 0x265a8a2398b75914UL }},
+  {{ 0x142792a527dc37a0UL, 0x2269c34131cf3b93UL, 0xf66512539b0183a1UL, 0x2895ca4b754e9079UL }},
+  {{ 0x296ef16956842f1eUL, 0x24fad080edd1530aUL, 0x6468d1e251d98518UL, 0x016f0ee5f2d2baddUL }},
+  {{ 0x4cdfc75bc6a85426UL, 0x1b69e3b94dd72decUL, 0x689c63b2047963ffUL, 0x10b17d0ee079aaedUL }},
+  {{ 0xed9211875d1a508bUL, 0xe4778de7a78bd623UL, 0x25fb9c96e9a96e9bUL, 0x201ce510040ca607UL }},
+  {{ 0x240ce2e3ba4de391UL, 0x5fa1d51c8de587a7UL, 0xa68257be6ff015eeUL, 0x1bdd0a8ef7d1bd99UL }},
+  {{ 0x215d146972e485a4UL, 0x9cee5396b1cd3293UL, 0x1900860fb7cd835fUL, 0x0d8a7d15737874b6UL }},
+  {{ 0x4f47fdc1161484eeUL, 0xbb163cd0228615f9UL, 0xa1ce97f7ecff9d2eUL, 0x1fc246e67018c678UL }},
+  {{ 0x01c5b8406377f61eUL, 0xb8a0d316cc89d196UL, 0xcae332ef370b7821UL, 0x14b3c7a2873c2379UL }},
+  {{ 0x146267dd17f57dd8UL, 0x37307a6505928cdeUL, 0xbb952d3dd68261bcUL, 0x1130795880386a80UL }},
+  {{ 0xb465213b44ae01cdUL, 0x62bc4aad29eeb02cUL, 0xf2958d2704299e8cUL, 0x2d709f69fcb67d3fUL }},
+  {{ 0x3f75b80eac6346d1UL, 0x3931f5d8175fa83fUL, 0x0200193e328e7db5UL, 0x3055fe9e9c2810ecUL }},
+  {{ 0xec2b5ffb190ce977UL, 0x66646a976f71e644UL, 0x8cde1ea02d187092UL, 0x2d9ac79d35669009UL }},
+  {{ 0xac22c2c95f3923afUL, 0x1a44a8f328af56b1UL, 0xdd8781f5243eae69UL, 0x06962eec24e05610UL }},
+  {{ 0x198b3e0c788acc02UL, 0xd136776dc346fa64UL, 0x79ac947809e39176UL, 0x02d7c141413f4f5bUL }},
+  {{ 0xbbd33dfd123732cbUL, 0xef661b3485ac5ba3UL, 0x53186ef5f6c3cf03UL, 0x0e46fe5bc9aaad0eUL }},
+  {{ 0xae66ab0f4bfa4f54UL, 0xbecbfb47d7107a4fUL, 0x995f106cccd47fc8UL, 0x1d5249f7e61d2446UL }},
+  {{ 0xa3f0a09b6dbd061aUL, 0x06ec8665c28f4695UL, 0x91de91a66270ca6eUL, 0x15681576d919b364UL }},
+  {{ 0x59a4331244a49076UL, 0xafc55e7a18b2ec0aUL, 0xa924812a370998bbUL, 0x0f40c192343e66b6UL }},
+  {{ 0xab41d310139fe06fUL, 0x39816ac00b4f2445UL, 0xf59ccf29cf0243ecUL, 0x0600077311b267d3UL }},
+  {{ 0xef45aac861d97467UL, 0x84affa678835024cUL, 0x1905078812f55a4bUL, 0x2e094f8c9e7935d2UL }},
+  {{ 0x4617d106f8ae4c95UL, 0x42a2a7dc410ff7b7UL, 0x267206f57d367fdeUL, 0x11258dd80f0f8004UL }},
+  {{ 0xa43a044942139c65UL, 0x0dd8b42beae8c773UL, 0xcad02cb6d3a3c313UL, 0x0c294e0b482093a2UL }},
+  {{ 0xa8b7e9a7e68c6958UL, 0x6ce6ed8904afcdc5UL, 0x0d2e0c430a120a18UL, 0x1ad84546a37d38adUL }},
+  {{ 0xa8d9c049332a8624UL, 0x80ce18353f7e9bc4UL, 0x247bf4511e012873UL, 0x1e8894577321b8e4UL }},
+  {{ 0x52ca4c6c083afeb2UL, 0xf81cef411a907d99UL, 0x00c471c290b5deabUL, 0x0c6db71bb702a12aUL }},
+  {{ 0x82a4d60b7b76620eUL, 0xe578da864e1625f8UL, 0x1a6e63a1c1e05fc4UL, 0x0908d802b90fab8eUL }},
+  {{ 0xe7448b6ea88312bbUL, 0xc8f14bbce670cf6bUL, 0x221d37ace40e7821UL, 0x06e7e60ead0e38f1UL }},
+  {{ 0x02c50f390ef9ffa2UL, 0x7a8f1606454b94a8UL, 0xe72e8a7b7d1140c9UL, 0x100ddcb6badc8256UL }},
+  {{ 0xc5c0b9667b132944UL, 0xf2d12277b083e86fUL, 0x5b8a084d21f65f45UL, 0x020629547814c2a9UL }},
+  {{ 0xf1462a76acd23cc7UL, 0x216f840b4dd80c8dUL, 0x7e750d883cebb3ddUL, 0x199133af76923e3eUL }},
+  {{ 0x28e4568d229efe7fUL, 0xfb27d1c9fc0a28f3UL, 0x065c1f74993d7d83UL, 0x1cef12ab2ee5f83aUL }},
+  {{ 0xbc6a2b70548d9ddaUL, 0xe92e7aa14b219ae6UL, 0x16acee4e006fcce3UL, 0x2d35052f974061c8UL }},
+  {{ 0x5bb4314a4759e145UL, 0xd9e45fefd71aed10UL, 0x161d08741e6bb287UL, 0x098197a90d1758aaUL }},
+  {{ 0xfbf5d7242614d26cUL, 0xe8558dbe51d6ff50UL, 0xab38fb02afc743d2UL, 0x143f542f97be7c80UL }},
+  {{ 0x216b029905b44286UL, 0x6022e7fe12bcdb34UL, 0xb774f1d7a3a75b38UL, 0x287933817bc63382UL }},
+  {{ 0x71129a4f96703d5aUL, 0x40136bec97c0f551UL, 0x618fe18d5ae23292UL, 0x0bb3b490b26a0c3dUL }},
+  {{ 0xdfe4c3d4a773c3ecUL, 0x66f37311db2d8a32UL, 0xea6a80616c75450fUL, 0x0927a63b6b0a3dd5UL }},
+  {{ 0xe5137f1a9250a7bfUL, 0xd3dffd6c54d63247UL, 0xb2b981fced5334dcUL, 0x2863288edaa71819UL }},
+  {{ 0x6e4fce5fd45e39f2UL, 0xe4567861a7785fdbUL, 0x083561776a8d89b1UL, 0x0168046f667d939bUL }},
+  {{ 0x61031586c9f3fb35UL, 0xa54446f546c5bf5fUL, 0xc0c722353fcb268fUL, 0x224f2e60ffd738a9UL }},
+  {{ 0x251a37fd94966c8fUL, 0xf0915e37937a9327UL, 0x901d280cc2f7bde6UL, 0x10ac4cd3f4a62216UL }},
+  {{ 0x6544b74d94169815UL, 0x68eb6f62f62211fcUL, 0xd9a1d13e9ca62c84UL, 0x181d696fdb5d6587UL }},
+  {{ 0xbdb6936b54a3c3edUL, 0x5a7ae2cd514b2817UL, 0x324e64647b7ecd46UL, 0x19af44ed4b4c32dfUL }},
+  {{ 0xf18027e5bb86c5d0UL, 0x71d47ae850c0a431UL, 0xf4a5a2fb3115b8a2UL, 0x2772e17254d9d5baUL }},
+  {{ 0x93cda77870d7c8b3UL, 0x71cfae506bcec4f7UL, 0x068ed22a56128432UL, 0x03c2ac1cfc499ff2UL }},
+  {{ 0x22b034f378f8610dUL, 0x38fcecbb437b708cUL, 0x57257d31d1fe0754UL, 0x0eb0aee050e3d395UL }},
+  {{ 0xdbcc2805d3b4dd9fUL, 0xe8333b818582f1b5UL, 0xe88e6ef89db53a1fUL, 0x1ff7d044a8c46157UL }},
+  {{ 0x32e83407f97840d0UL, 0xd6ba81058b5f2facUL, 0xb9ffd64449621007UL, 0x08977f5a80603b52UL }},
+  {{ 0xfc9b73b92446c7b7UL, 0xe9aeb84738cec467UL, 0x3c6fa363bd3a550fUL, 0x16e3146c5293efb7UL }},
+  {{ 0xe75d1bac535ede7dUL, 0xb00b081eda47c010UL, 0xa53069a5c2cdea22UL, 0x009b98eeefd4dc50UL }},
+  {{ 0x6fe5dc9865a30596UL, 0xf6512651402f5484UL, 0x5866fcaab29e568aUL, 0x1c5497fb852b13acUL }},
+  {{ 0x810bf6d45abff915UL, 0x8efe0b78da9e4ed5UL, 0x103589e47dca4e02UL, 0x20db501b859bf1d2UL }},
+  {{ 0x95ab7e4ea11a8072UL, 0x3ce0a9dd702bf035UL, 0x15b510c78f939b3fUL, 0x15aac9ad286f82d1UL }},
+  {{ 0x7e63aa0bcd3bd42aUL, 0xcb150bdee3bcaf4eUL, 0xcfa8a4cac6290c58UL, 0x0b1467ecc2378239UL }},
+  {{ 0xcc5361888cada940UL, 0x4ae7c74232ceceb5UL, 0xc37c4fb34d7f88bfUL, 0x1ebf7c959ae13980UL }},
+  {{ 0xc126ae88014b803cUL, 0xad91d97297a1cc37UL, 0xe392cbc91a7ccfacUL, 0x2f3d2567350e1e44UL }},
+  {{ 0x4cd037cc7a32269bUL, 0x486f640f7c522d77UL, 0x4975889847a5ba0bUL, 0x160e050c2cf1c63dUL }},
+  {{ 0xcd3e6993e45429acUL, 0xa6d5708a47d69e02UL, 0xc18b52936769e47eUL, 0x282f1b13f8710e9eUL }},
+  {{ 0xb9534a450046464aUL, 0x3e0acb4533e7438aUL, 0xb6fdc40d931bf950UL, 0x22be6dc5cbe75147UL }},
+  {{ 0x155525930d127ca2UL, 0xe1b9ecf3802bedbaUL, 0x5ec740fc8be97b62UL, 0x278d8914557e0648UL }},
+  {{ 0x6fdcdccadf4471e4UL, 0x7224b5771a31a9e6UL, 0xd6b68b0e068deb9aUL, 0x28c4d285427e47b1UL }},
+  {{ 0x5abd89a5beca105dUL, 0xba93c34579d0a77eUL, 0x693289d78b13410fUL, 0x2af72e145648d774UL }},
+  {{ 0xcf259f9a025e60d2UL, 0x849fc37b7557c526UL, 0x687f553c2eda92cdUL, 0x2095a78a7b836afcUL }},
+  {{ 0xac33127fbf05a791UL, 0x06d148db82c38ac0UL, 0xf27422c1c450ed95UL, 0x1419a65a908250d0UL }},
+  {{ 0xa66ca78fd032207cUL, 0x0511b91e6ee4998dUL, 0xdf5b861d5726a6e7UL, 0x0583ea7627a04b1dUL }},
+  {{ 0x9777b75f192a0712UL, 0x705df2cd98fe9b8cUL, 0x5ca3fad5e67cb575UL, 0x26f375260cc3d834UL }},
+  {{ 0xeae8fba27106711bUL, 0xdfccdd665cca8aa6UL, 0x0f58a812e20292e4UL, 0x07baf4ef819a1055UL }},
+  {{ 0x4d4bf91acbed4aacUL, 0xa112a5553163688fUL, 0x7a32efd268f91622UL, 0x1b07cca9015817aeUL }},
+  {{ 0xb5ceff6be6371bf9UL, 0xe5e0d36b39be7e39UL, 0x131c2fb617adfe52UL, 0x06c9c8ebc8b65c93UL }},
+  {{ 0xb6c58d44d6149388UL, 0xf1cf2ae3a0fb87f1UL, 0x0fdbe28e5f82a47bUL, 0x24f8d394f4ade640UL }},
+  {{ 0x49ebea3b793e8ed1UL, 0x55cfb46d4db869beUL, 0x4d586c87869f97f5UL, 0x1e424f0a14ae9241UL }},
+  {{ 0x91b7753b5598cc0fUL, 0xe6dd2ecaa2e2700bUL, 0xd66bfa5b9e59de65UL, 0x202ca835dab1d7a2UL }},
+  {{ 0x159f0d913fd3724cUL, 0xfe11482e9c405fc3UL, 0x07dfc5c855cf5d9cUL, 0x132015d0fa14fcdbUL }},
+  {{ 0x75276cbd3b88d499UL, 0x6d81ca3cbc75cd13UL, 0x6f92e90b1992ab0cUL, 0x0219dd2d0d3f3022UL }},
+  {{ 0x3233058baace037aUL, 0x762f42954b58949cUL, 0xddaf4e297f543db2UL, 0x05ebef9297a0c719UL }},
+  {{ 0x15eb05ff6e29eef0UL, 0xc096a38ed82d16b2UL, 0x977c1838c017ce4aUL, 0x2f47ec0c862b351dUL }},
+  {{ 0x5a591fda38b14a0cUL, 0xa04314825661c119UL, 0xc69c778fe069922bUL, 0x229223343903b949UL }},
+  {{ 0x4017166282f4152bUL, 0x8001451b391ba3baUL, 0x3fcaec45af7bd74fUL, 0x11b106a68c00231aUL }},
+  {{ 0x440a71338a2a7c5cUL, 0x7f09bd7121211f3fUL, 0xa4dbc9aee4c7c57cUL, 0x0dc48883cd68d35fUL }},
+  {{ 0x62aabd9b3d2c64d9UL, 0x9e1c8db2fb9cb0d7UL, 0xeba44d639f9fa440UL, 0x0e9a50f10ec6e9d7UL }},
+  {{ 0x62322b8050ea763fUL, 0x494ecd345955e1a1UL, 0x691f132f99f5c116UL, 0x1b9cda82c1392037UL }},
+  {{ 0xb83e2c9b045430baUL, 0x0f9f1e2bffed7bd6UL, 0x1d621e981625ba64UL, 0x13d5e8d846bbfbbcUL }},
+  {{ 0xd9541500ee77b3b3UL, 0xa64733c15e66e5fcUL, 0x070e12279125379dUL, 0x0077218337f959b4UL }},
+  {{ 0xd671318cd45deb54UL, 0x551bb4643e35bfe6UL, 0x43eb98ff0eff6786UL, 0x010a9364e23db506UL }},
+  {{ 0xa2048b475174d7a6UL, 0x02cb9db49608c370UL, 0x42c672317ebd0784UL, 0x090f725443c33268UL }},
+  {{ 0xc459fc654c061f14UL, 0x60e96a25adc82076UL, 0x9b409954e31f0208UL, 0x084eddb5e9b13c6cUL }},
+  {{ 0x434b38b6d16ffbc1UL, 0xa907abd1f5e76888UL, 0x0065dc7e7736e861UL, 0x06bae47361b09c64UL }},
+  {{ 0xb2ec26badf151166UL, 0x54ca41113e263047UL, 0x74468b29d1588d98UL, 0x0418e544ae45c3a8UL }},
+  {{ 0xbe761a02337ef9afUL, 0x7dc3bf714906850dUL, 0x0d2bc9400171a74eUL, 0x2a6fbd0c4c5e977aUL }},
+  {{ 0xb06188abc805abc3UL, 0xcda7c83da31ecb48UL, 0x6fd98953c0365fd4UL, 0x1dacb65533f6c582UL }},
+  {{ 0x5630acb8772b821dUL, 0xcd905c71a35f0511UL, 0xc70c0c89133de995UL, 0x206b0115fd7dae56UL }},
+  {{ 0xcd8ba0ce76854bc3UL, 0x02826e2505b087c3UL, 0x148c0b6c4b16fd64UL, 0x17bc2838ff685496UL }},
+  {{ 0xcd3e8fd5aa1ea6caUL, 0xd708ce74e6d6ce45UL, 0x6800c044fac900a9UL, 0x2b112b8f21fb15dcUL }},
+  {{ 0xdaab7bd4c2ea3dcaUL, 0x6109b91758193284UL, 0x61245ddd2c89fa43UL, 0x0f81e55a8e55c572UL }},
+  {{ 0x7e669deaa9f931b8UL, 0x41f3f291d26d05b1UL, 0xc9f3099640e1f8e1UL, 0x21467c70298eeebdUL }},
+  {{ 0xe9b6395247214d50UL, 0x15546526ba43db10UL, 0xaae0ba29b0266bbeUL, 0x1116badac63d03a1UL }},
+  {{ 0x70eb02a51ba975efUL, 0x58db7cf9b353a846UL, 0x734b817b33306092UL, 0x19d4701603c36d24UL }},
+  {{ 0xb1012ca71c854340UL, 0x6e252f5cf8cad291UL, 0xcca63357ef2949bfUL, 0x002f8a965da0261fUL }},
+  {{ 0xa3dd3cf7e3720fd5UL, 0xd2ae0522d48cd261UL, 0x3b66db1ac42a1391UL, 0x26dd6244ed11aa5fUL }},
+  {{ 0xa0244745b1c9b9eeUL, 0xb551c673e89e5c04UL, 0x05c146c524d330d9UL, 0x16dd8d59cb0b359dUL }},
+  {{ 0x799acd5cdbbe1810UL, 0x0c76958961f47bceUL, 0xb35a1d3127ac8c29UL, 0x13586e57275e4ea7UL }},
+  {{ 0xd7ae37c6f368102cUL, 0x3218afd9d01f0433UL, 0xb5a1ec9f93f19d20UL, 0x10a7defca70f0982UL }},
+  {{ 0xfe09cfde1ac19870UL, 0x4e96e7e2661652aaUL, 0x03bb4c8d846450f0UL, 0x2f0f263e9f2e17baUL }},
+  {{ 0xa117809d3f5e460bUL, 0x55c83b745662f72eUL, 0x1cc98649f809f49bUL, 0x0993105639241a11UL }},
+  {{ 0xe1f9b3be7dcfde8eUL, 0xd82488905a240c7eUL, 0x3d7cf5ca06cfd207UL, 0x1eb1f0d9408e1aaeUL }},
+  {{ 0x1d9510082fca77d9UL, 0x4c84b59f2c5e040cUL, 0xd9a3eb94b2af6345UL, 0x2b4edf29eadd4f0aUL }},
+  {{ 0x24022e3fe5d97247UL, 0x929d7a6b915039c1UL, 0x075db00413b1f7cbUL, 0x06189c7d95e85836UL }},
+  {{ 0x3b62e30bd5e283fbUL, 0xb21cdf2d5957946fUL, 0x7da252294683c9d5UL, 0x2fc01a3f9ea7ad62UL }},
+  {{ 0x884910a9eb8e8de4UL, 0xa8edd3386fe814fdUL, 0xda156b5d6966b011UL, 0x0c11f56e47636040UL }},
+  {{ 0x883235ab43dcc134UL, 0x2001917b9d58b43fUL, 0xbf97f16833a73c1bUL, 0x1c61b3e083c126e5UL }},
+  {{ 0x50fad662d74e00d6UL, 0x624ecfd12380ca76UL, 0x80139c14aad32eb9UL, 0x197ae511d7bb6370UL }},
+  {{ 0x07cc574c546e102bUL, 0xb89f5888ba0d6765UL, 0x4342202d68e7c40eUL, 0x2bfe048881abed92UL }},
+  {{ 0xef8c5f4b3b6d859cUL, 0xb75bf4e6f9e96454UL, 0x4d87200da94f09daUL, 0x3007a8861d289910UL }},
+  {{ 0x7536c0d83b942b79UL, 0xd3bd355987e52fd7UL, 0xc0fe528125533969UL, 0x2fa8e34c5ae5cc6aUL }},
+  {{ 0xe74249f7d91b0f74UL, 0x7171386d28806a7bUL, 0x36fa0d420239e0e9UL, 0x0cae0c8dc6f30183UL }},
+  {{ 0x2e9c27589f8bec96UL, 0x5820d9fd58468810UL, 0xc7bc9249101132feUL, 0x10ade3f2d46254ceUL }},
+  {{ 0xe032eeaf9f4b00b9UL, 0x5a5ab949a4e0b19bUL, 0xddc0d75ef8c8f525UL, 0x00a455da487c9ef3UL }},
+  {{ 0xe08be11a77433564UL, 0xec3bf53d4e4f7f48UL, 0xbc77c0a3d1f8bc24UL, 0x0b359fc9c36f8964UL }},
+  {{ 0xa02f8caee6a5102fUL, 0xb02b63b5da92a9beUL, 0xc8f7fd16578996d0UL, 0x2d236af78415b37bUL }},
+  {{ 0xfd49a770743a51d7UL, 0x3c5c6ae7a4a23724UL, 0xa952ac25391697d6UL, 0x1a66ac9240780740UL }},
+  {{ 0xa507cb722d86f7c2UL, 0xe5dbf6a8d45f01a3UL, 0xe81de2327c7cdfc7UL, 0x2b4cd2a81edb1e10UL }},
+  {{ 0x83b520f898d3d36eUL, 0x4ded9b1411d2fe86UL, 0xce1f9328e2290deaUL, 0x08cf505014b60596UL }},
+  {{ 0x915ee5eb9c5898c8UL, 0x60c8917aa8ec9cceUL, 0x1fd3ac766e16efd8UL, 0x02d9dd6603dd2b4eUL }},
+  {{ 0x00fc6eeb00977343UL, 0x6e123ba14b041193UL, 0xa3eaa00cfb126492UL, 0x1a33cedf286f12bfUL }},
+  {{ 0x791c7394c1eedb1aUL, 0xd825bd5edfa4e490UL, 0x336a85c850f92453UL, 0x2d71b9663105565fUL }},
+  {{ 0xabe75d98700e50c9UL, 0xd8fca36370a9bebaUL, 0xf695b02802a4b10fUL, 0x11c65c062f713e0bUL }},
+  {{ 0xab325389c492f18dUL, 0x62fc132dc63ee7ccUL, 0x164efca360dc5fa7UL, 0x2c0c86beb88b16edUL }},
+  {{ 0x2b96b4bc2b4fa2b4UL, 0x05b3032cea607f8cUL, 0x1eb5a0ce4bb5ab67UL, 0x168102c6c8cfea13UL }},
+  {{ 0x8c9642ae7bb2643bUL, 0x2ef048e8d7019c4cUL, 0x8441a5e032cd3423UL, 0x048e5cdf19e649faUL }},
+  {{ 0xe62cf58be94d0e29UL, 0x8a1175a7b3a4de0aUL, 0x863df8b07d065088UL, 0x0e84c36548699db8UL }},
+  {{ 0xab12111845635315UL, 0x050f7e9cd4198f73UL, 0xa2f2e944d61c4b7dUL, 0x2aad2483473b3220UL }},
+  {{ 0xd87789a7a5de0859UL, 0x51fc521efc435329UL, 0xa9356ea348cad8a1UL, 0x2ef81f8c1c7133d7UL }},
+  {{ 0x1e0626697daaf1aaUL, 0xbe6d8d90d0c00a7fUL, 0x8710fff508a6db9cUL, 0x23e1a08429a7ac6eUL }},
+  {{ 0xde616162f55321ffUL, 0x9b4012adac560059UL, 0xbd5036a610390fe5UL, 0x1d2db8168f4b0361UL }},
+  {{ 0x63c4c2ce27de8e69UL, 0x0f95166db761db68UL, 0xd1ff22b61449113cUL, 0x081c1720cb0c8131UL }},
+  {{ 0xc7e4cd21f8cfdedbUL, 0xfc1304ff80046739UL, 0x4001a473c0018b6aUL, 0x09f3a1dda0f14248UL }},
+  {{ 0xf1617c613233787fUL, 0x3ceabab5c3be080dUL, 0x0ccf2cc48665dc1aUL, 0x0dfa0b25a0dfa182UL }},
+  {{ 0x475c629330e491e2UL, 0x5a5a0fc088ed4e37UL, 0x0698943e15a292f1UL, 0x13ae65166ca6624bUL }},
+  {{ 0xc345b0121b214ae2UL, 0x8f4bc200a2c37664UL, 0xd154d17cde47c623UL, 0x21cda18d689ae7b1UL }},
+  {{ 0xbe7370f709f7ffe6UL, 0x50759cbfe21ff1ebUL, 0x6513de2242d78437UL, 0x12841b585a1eaa2bUL }},
+  {{ 0xac435b04a546c156UL, 0x8c1b935c1051004dUL, 0xb519ef490a598772UL, 0x27874a364ebefc9eUL }},
+  {{ 0x42bc5912657c9f50UL, 0x42016fac07067999UL, 0x6959dc2583d92480UL, 0x176fdaa2ffea13e4UL }},
+  {{ 0x5e206ce4abc5c31bUL, 0x9db92eee8b82557cUL, 0xdb411fb483cbea45UL, 0x26c9d2863cd6e843UL }},
+  {{ 0x366a229b30d4905cUL, 0xaac9889f657ae5bcUL, 0x51ccac94c008744eUL, 0x2e96a79a4bf41294UL }},
+  {{ 0xb54960943c3ee82dUL, 0x350a53558f564284UL, 0xfa9d9bac122ac046UL, 0x0493639e26137645UL }},
+  {{ 0xea110d0122f9d558UL, 0x79e08eeebb213c79UL, 0x3b67d7718f752ba4UL, 0x21515590e53fad11UL }},
+  {{ 0x38e193f006903749UL, 0xcb74e8d7917f3593UL, 0xc31e3ab38d4de189UL, 0x04bccc143ce75b5cUL }},
+  {{ 0xd0b5c9975073d692UL, 0xcf9975ee50bfed07UL, 0xc0aea48f67cd6027UL, 0x0baed5af201bae3dUL }},
+  {{ 0xaa61446f04995f73UL, 0x1e666a5d94a01ebbUL, 0x9e4d05408d25e0d7UL, 0x0d240754b75b0885UL }},
+  {{ 0x31944311da0dbb29UL, 0xd6cad455a80899deUL, 0xa7512875292853e5UL, 0x251351b5e0466dd2UL }},
+  {{ 0xb13391ee6bc0ff59UL, 0xd029b7c7f6310583UL, 0xa805cc64eac15ebfUL, 0x1f3303b05c15b62fUL }},
+  {{ 0xa6823882bdb93510UL, 0x59fd98111abf8ce5UL, 0xe45eb4c61ce0364eUL, 0x2b128062bf27e4efUL }},
+  {{ 0x822bc9bb51b33a94UL, 0x5fe8194a1e975f11UL, 0xf5e768ab4e700b79UL, 0x1ed09fc503655a51UL }},
+  {{ 0xba85b2b777537172UL, 0x2be0326e69a9094aUL, 0x0a8887897f211326UL, 0x2750677f82403ebaUL }},
+  {{ 0x54dd1b93bddbf7e2UL, 0xfb7f4ce481f60ed0UL, 0xe215ecbebf2418e3UL, 0x22cbef43589e9925UL }},
+  {{ 0x464b5a983ff3a000UL, 0x58451512bcc011d9UL, 0x618fc5f616cd606cUL, 0x03b325dd6cad2320UL }},
+  {{ 0xa27f0b498bf511d5UL, 0xb16337db1553caa4UL, 0x0e68d50a3158e724UL, 0x097abc8937a2b634UL }},
+  {{ 0xc05d1fb14d19fb37UL, 0x900d26e6705763deUL, 0xcc7b7da1a13b8ed7UL, 0x09d391cb497a5e5eUL }},
+  {{ 0x4ccd0473ba513215UL, 0x9e67885d4965a4a8UL, 0x458d1d3072f45472UL, 0x27213035596fe039UL }},
+  {{ 0x7043d00f380b53e3UL, 0x34591facab513cccUL, 0xe5ac066bcf6bcba6UL, 0x0b3eab403435f2a6UL }},
+  {{ 0x08ee1d36ee7de399UL, 0x74525484d071c255UL, 0x143f382399c24e37UL, 0x16c7c296d9c31bf5UL }},
+  {{ 0xc08e77b4ea9c06f8UL, 0x4776fa75b94c2cc5UL, 0xf2a181193bc606d2UL, 0x1150f9b7083e9b6cUL }},
+  {{ 0x9adce6a63cfed5b3UL, 0x0dc19eca20595784UL, 0x956a44a52ba5594eUL, 0x1990c103fa3c4587UL }},
+  {{ 0x55eb65c9020884d5UL, 0x235d98752b489072UL, 0xebae130fadb6b4f2UL, 0x01714e623426ee5bUL }},
+  {{ 0xeb27e00c17eb24c9UL, 0x5362fafd0e31bf02UL, 0xf6c9c4c073d2c011UL, 0x0ed344be4a5bfef6UL }},
+  {{ 0xd16b2fde5a5f23deUL, 0x4999a95e3233d12aUL, 0xbae2d14743c36c1aUL, 0x19b04f8d4eb1b00cUL }},
+  {{ 0xff7f4da0bae483eaUL, 0x3f69e32de0a578a1UL, 0xb006a20dc450d1caUL, 0x2665b577aeb1dbcdUL }},
+  {{ 0x24c93e3526d117caUL, 0xd8acd58d16c90ae2UL, 0xd6ad58cd492dde9fUL, 0x0f58d6c8990981ebUL }},
+};
+
+static const fd_bn254_scalar_t fd_poseidon_mds_8[] = {
+  {{ 0x1f4dbe8bf090b931UL, 0xd395b73788fca25aUL, 0xdc23828594b1efd6UL, 0x1141a50170bf495cUL }},
+  {{ 0xa44f4ce91ce44eb9UL, 0xd2b3b7e296a4526dUL, 0xaf5f5999c01cd83aUL, 0x2633983e5af71cfaUL }},
+  {{ 0x644e209477ae014bUL, 0xd826a52906dbc7c2UL, 0x52a48302102d9137UL, 0x2e2bd01633a00547UL }},
+  {{ 0x66bf5ed390f639d4UL, 0x4c3ad200735ff1f7UL, 0x74eb895d111697d9UL, 0x22b608708e6b75edUL }},
+  {{ 0xb00e55426228f056UL, 0xab6725269a9461dbUL, 0x34338b9d6c802343UL, 0x26274666f521bc21UL }},
+  {{ 0xeca0bea37fa76441UL, 0xa5ff4d32d09dab40UL, 0x7270e1a074e4f7deUL, 0x057f7b5e705d0f93UL }},
+  {{ 0x3807b96db5185840UL, 0x8804048324013a2dUL, 0x2d82aea12ccd16c7UL, 0x23360c90d8531339UL }},
+  {{ 0x173a927c2e8cd2c2UL, 0x657ef693fc14542dUL, 0xc44e777e448e4496UL, 0x116166484c5622ceUL }},
+  {{ 0xe1927edc10347fb5UL, 0x1548221913074c96UL, 0x9ed2715ec1cf5809UL, 0x2a968c597597d2b8UL }},
+  {{ 0x30487c6d722c8813UL, 0xeb319ebb527d6985UL, 0x3ece65effa8e5594UL, 0x1c771bbf55eeecd4UL }},
+  {{ 0x0365710170f84f9cUL, 0x1188a5fbde5787baUL, 0x3e13b3c752e6b1a7UL, 0x20c3a8a08b6c9105UL }},
+  {{ 0x743553eb5f98c2beUL, 0xfdb60bfa52f2e522UL, 0x0eb83e7b280ac6a5UL, 0x036484b863123974UL }},
+  {{ 0xe765c293d13bfab7UL, 0x0b1f09e3ab0f4071UL, 0x14f97c4a71f6bc22UL, 0x23f546cb2b363175UL }},
+  {{ 0x1fd66cd3168553c5UL, 0xfa01b014810f760bUL, 0xc2656f39daecd429UL, 0x2efd7e16fcf0ee6bUL }},
+  {{ 0x4f26d45c2e767a1eUL, 0x52379f662bff12ddUL, 0x0b13910e75b6ea3dUL, 0x07f054ffb00bc39dUL }},
+  {{ 0x92ff2fb1e0188efeUL, 0xd0ea2231d6a6999eUL, 0x56bcea061febd7b8UL, 0x1bc087a8248f8513UL }},
+  {{ 0x783657eacbb1af36UL, 0x79ee316f0218341dUL, 0xcf1687685ba466f1UL, 0x1d52e0e630c90c63UL }},
+  {{ 0x327f363b8ce6207bUL, 0x05762a08cf05d3f0UL, 0x0e65703be941a6c4UL, 0x0a5eaa5aef398d8fUL }},
+  {{ 0x37e9fa58f258aa08UL, 0xe19ed5f916714126UL, 0xfbfbf0bef92045e5UL, 0x1c8622d2bca21375UL }},
+  {{ 0x057e69a4336b2bcdUL, 0x07f30bbf64457537UL, 0x2adc43af83ab3376UL, 0x1cb21b6ec4186980UL }},
+  {{ 0x8125f97bc0dde997UL, 0x922f95923e4b5519UL, 0x3e26e5fce0c84054UL, 0x07e5c9a3fff91b8aUL }},
+  {{ 0x62cddda028e3826eUL, 0x042f00bf23b1f377UL, 0x59f4aeddbe7bc26cUL, 0x1e3f9099e170e7c0UL }},
+  {{ 0x23609899cd9d9023UL, 0x0422a5474efacc85UL, 0xc2189a16f4373bbbUL, 0x2fdb3a1ac059d5ddUL }},
+  {{ 0x91685342d960e34aUL, 0xf7ec5c0e2632ba11UL, 0xeeae223a23c6c7bdUL, 0x07b30713366e0896UL }},
+  {{ 0x24d339197ed7f8deUL, 0x0b305ae31ee4a45dUL, 0xe26f53f1a285676dUL, 0x191ea399db57a297UL }},
+  {{ 0xd02efaa09baa6068UL, 0xf7a58094d0bf5124UL, 0x8cd2d60974ae8ff6UL, 0x1b820864296a0b09UL }},
+  {{ 0xe31b5dc4993e7b51UL, 0x7477eb845e3f6830UL, 0xd700d11b8ebc71bfUL, 0x1a23fe2f282ba8ceUL }},
+  {{ 0x547db540a9c704c1UL, 0x09bd792f850ba845UL, 0x399e17cd244ae1b9UL, 0x039ee5e54d87eea6UL }},
+  {{ 0x22a777927cbbef26UL, 0xb54889b6b0b78f77UL, 0x560f20d5c57c25a4UL, 0x150ec35a40aa403fUL }},
+  {{ 0x1b31c6f6c348e438UL, 0x06019a71d5ef3f9fUL, 0x79983c44e6f64b0dUL, 0x28a8f282ce3713d6UL }},
+  {{ 0x34705a0d42f5a84eUL, 0xc6451f373c2ee169UL, 0x71d379a72b1e7550UL, 0x099c8aabaa99e69bUL }},
+  {{ 0x23c21ba2e6c7e3eeUL, 0x82b0f30e088d4a82UL, 0xef7ea200d9c0da9fUL, 0x0a9c07a3f5ed4454UL }},
+  {{ 0xf1fe47b4ff9e4f1dUL, 0x042443fca708f057UL, 0xca26362144820d98UL, 0x1117dfea0b9da342UL }},
+  {{ 0xa77d0650ac027097UL, 0x6880be995373ad3eUL, 0x94e2745eecaa3abbUL, 0x28ae5c0159613b8eUL }},
+  {{ 0xc8b26043296fc6f7UL, 0x899896e52582f51cUL, 0x60f84b5cb1c7067eUL, 0x122b293ca0c066daUL }},
+  {{ 0xe6f1d3dbf692fff9UL, 0x193fc0914de807a3UL, 0x5734673662f2f1b0UL, 0x105e83c3e60384beUL }},
+  {{ 0x9875a0af04b1ab63UL, 0x72f1a77755eaf3b2UL, 0x4933de619ce7a042UL, 0x276347b8bce7d72eUL }},
+  {{ 0x0c16a39118e65d67UL, 0x667cfa3cce9052ddUL, 0xb88851e4d8af893aUL, 0x1f38658fc57099e8UL }},
+  {{ 0x2f97ebe2b3dce21eUL, 0xe69567268628e738UL, 0x1275be39fdfb5f87UL, 0x3035f09153cb87deUL }},
+  {{ 0x4b42c709f78ae33dUL, 0x8776723c78f7ca27UL, 0x1b24eb99b03b6a82UL, 0x29eb35cd546bb09eUL }},
+  {{ 0xad5a45345326decdUL, 0xb34d1fb1b0c68695UL, 0x9e4ae2ce670611d5UL, 0x2d50c8b91aade6d1UL }},
+  {{ 0xa188fa32a8f40af1UL, 0x2678597a932f7c2eUL, 0x18fda36e4735603fUL, 0x1f4098e893b61794UL }},
+  {{ 0xba141bada2024e64UL, 0x11316690068472baUL, 0xab15bc78d8cb23a8UL, 0x12f1a41cb7488b91UL }},
+  {{ 0x9d78d12f5155d59bUL, 0x5ac3cf4799968e39UL, 0xd917bcf5693ff608UL, 0x2202d5b4897aa0ffUL }},
+  {{ 0x631d6a007024fb42UL, 0xa9fe14e199386501UL, 0xa0fa612a9b994c65UL, 0x1575df8b9bcac476UL }},
+  {{ 0xad8e311121cf5735UL, 0xbc63458348ccb116UL, 0xefa7608aafbf6627UL, 0x1154ecf28933af86UL }},
+  {{ 0x319dfb4131786c94UL, 0x8b0479b07b4585f0UL, 0x993a10a8e45f7cb0UL, 0x06e0293da66812e8UL }},
+  {{ 0x34b6a4cdba566069UL, 0x41ea373a58e27600UL, 0x252846097f0ee028UL, 0x136b99f20935ad55UL }},
+  {{ 0x9229c5ffff67658dUL, 0xa7cd285e7d64cf7cUL, 0x2e9d258584e0f885UL, 0x1c5ec1e7d71547f1UL }},
+  {{ 0x2b8fd37b6b72facdUL, 0xd896897705d057ebUL, 0x95a9768686a34ce1UL, 0x0a486f8ff2e8cfa1UL }},
+  {{ 0xee28a597e0f4c486UL, 0x1373a6dcb1e61d4dUL, 0x71e0869ea889d0daUL, 0x0c12a8978cb1b37bUL }},
+  {{ 0xc173c626643ae516UL, 0x6ece99de6bb284e2UL, 0x193e6ea9301e905dUL, 0x046d199654b8c6ffUL }},
+  {{ 0xd31620550c2063a8UL, 0xc34eae3f606aea1aUL, 0xf19c5b2bb38c8144UL, 0x1bc0df4b6c47f866UL }},
+  {{ 0x19edaf4fac4a5950UL, 0x50b74d229383c262UL, 0xb72bd0dedacb132aUL, 0x2d88dc23f4282fb1UL }},
+  {{ 0x716141c4eff8580dUL, 0x4b2f1a22174ac058UL, 0x156c34f9ba12709eUL, 0x0c466d87fd82c81dUL }},
+  {{ 0xf5dc0d315b374c95UL, 0x66f3e21e2c2fb2eaUL, 0x34e83b2ff15b4d79UL, 0x2a69d692add4e815UL }},
+  {{ 0x26dc3f69fca2240bUL, 0x7275fadef4b2504eUL, 0xd9b376153cc71a9cUL, 0x0f4c91b26642b7f0UL }},
+  {{ 0x32aacc16597da227UL, 0x58c91b9c9238716fUL, 0x551a461b1fdaa9e6UL, 0x152c5904bc224f9aUL }},
+  {{ 0x3ef8b8e0fdc19fc8UL, 0x59dc4372e1f9dcfcUL, 0x9e7318cfcfaddf15UL, 0x2fdf1459e24ef836UL }},
+  {{ 0x6175a88cb170f6f5UL, 0x00ca8f93c830947dUL, 0x586cd165e5aad452UL, 0x09a0c83f4ead679dUL }},
+  {{ 0xe0ff544adfa4a22eUL, 0x99ca87cca282e14cUL, 0xd17f314147a36a02UL, 0x145c3be0bc913d1dUL }},
+  {{ 0xc988334033482eb4UL, 0x7877e1ca3f7f4314UL, 0xfff56249183438e9UL, 0x180a038a831f84c4UL }},
+  {{ 0xd46a3817209b306fUL, 0x4b06c0c0f8f88e8dUL, 0x62056a0f32d2e169UL, 0x01bf0627f7f3a1cbUL }},
+  {{ 0x1328e6f831bd305eUL, 0x72ab5629f4c4da22UL, 0xda548457d5b38778UL, 0x25d3f15e0feac66eUL }},
+};
+
+static const fd_bn254_scalar_t fd_poseidon_ark_9[] = {
+  {{ 0xccc8c7771a8a426aUL, 0x12881baf5b09dc22UL, 0x36bef279b36ae936UL, 0x20877252cb848cf7UL }},
+  {{ 0xa0182a7b51a81044UL, 0x37c6694858a05be1UL, 0x41be7c08aff90695UL, 0x0fa219c0afd59fecUL }},
+  {{ 0x927e749575a42340UL, 0xd1c22dc2be654ad7UL, 0x5519b169de072c28UL, 0x2306c9e590ba9bcdUL }},
+  {{ 0xa998508b3b06c3f8UL, 0x8fec3d5e70bcd329UL, 0x699f55d98c3fe155UL, 0x1c02d2ef924fd7f0UL }},
+  {{ 0xe077214dc8f2ebf9UL, 0x4bfd1e9dc817dbb5UL, 0x76c893d969f23465UL, 0x1da257e392ae3bbeUL }},
+  {{ 0x4bf06b6fabc06012UL, 0x1998f04d702c3ff3UL, 0x027cb244dfcb0546UL, 0x1dbf7fb63607cb25UL }},
+  {{ 0xe0f73842567af487UL, 0x1dedfc94ecee0938UL, 0x7f5158f37cfb5a7eUL, 0x21377cff2472b46eUL }},
+  {{ 0xefa5098a62780ac6UL, 0x6a3e3ae207da787aUL, 0xf24e455a49ab4778UL, 0x112d4ae0548a52d0UL }},
+  {{ 0xf86dbecf0f918d4aUL, 0x6e8e1c6953c74dceUL, 0x3e1edf877b097536UL, 0x102f4ba5c65e8139UL }},
+  {{ 0x4ac12099ad282572UL, 0x50ed3fdab30adca5UL, 0x09cdee706768cd28UL, 0x0f85e9728a73835cUL }},
+  {{ 0x158cf25534d0f1fdUL, 0x6f9dce2d02cdad8eUL, 0x3ef23bd9ba5bb00cUL, 0x071e60d22be5095bUL }},
+  {{ 0xef17f9ecb2b55ec9UL, 0xd709375ad47843c4UL, 0x92536b8c0dacaf72UL, 0x1b533d42233483f3UL }},
+  {{ 0x28eab2d051dd3e16UL, 0xd068d6eca00b333aUL, 0x2f893bed2223436eUL, 0x0c2498d5e1dd5a36UL }},
+  {{ 0x644e0ad83524009cUL, 0xe0c38dc40a0cf099UL, 0x91d16cfe1d0eb356UL, 0x0be9a688b883a70dUL }},
+  {{ 0xffa9bf5e22b65fe9UL, 0xa1a4809e8abb3481UL, 0x5b4263441e0d888fUL, 0x182adfa735f27a7aUL }},
+  {{ 0x6b5d01838807e447UL, 0xbd4a5918ac36d3ddUL, 0x836917c4cc69d980UL, 0x29239ac7fa73ad56UL }},
+  {{ 0x0334f526202bfd86UL, 0x7c9701b17ace47cfUL, 0x5fe73a26985a1a15UL, 0x21c9a523c217031dUL }},
+  {{ 0x55030436e55b3acdUL, 0x73568bf0759a1dacUL, 0x306c34a559d5e1a3UL, 0x2d871fb8c9c523ffUL }},
+  {{ 0xb594fc4ef7b721d7UL, 0x68ece0e21d4ca126UL, 0xd803536c3b76ed32UL, 0x02bdbaf3f7ebcb2aUL }},
+  {{ 0x4550558d678d807cUL, 0x538b2969c9ce4376UL, 0x13c58fb4b51bd2e4UL, 0x1488f97a6bae30b9UL }},
+  {{ 0x0ec82fbc2056e72cUL, 0x37ca13c814401597UL, 0xfd6a9c74013d7a7eUL, 0x03061a4488106a9aUL }},
+  {{ 0x44227dfd21b43c47UL, 0xb5b664b19677b7a1UL, 0xd9e13e16386b3beeUL, 0x1bbb8b792cf08e26UL }},
+  {{ 0xfd64b592e84ef98aUL, 0xf29ba24b39a26ff0UL, 0xa5f85ffd82230f3fUL, 0x1f15c772be0a75b2UL }},
+  {{ 0x67397c68a2689dd3UL, 0xbdd8922b4a181860UL, 0x1068774046a81065UL, 0x0290e017859dbf4fUL }},
+  {{ 0x6a77fa9b3d67a3fdUL, 0xba3075c2dbac99ebUL, 0xf4017598d8bfa3faUL, 0x013db06ab7fca961UL }},
+  {{ 0xa9442da2cfa45f40UL, 0x8bf1ac728e9d4a31UL, 0xae6574e8c89c5b13UL, 0x1f749d27eee1bf86UL }},
+  {{ 0x16ff5925737fbcadUL, 0x46f082df55df313eUL, 0x2c34ceb441cac12dUL, 0x045fe39cc2ed1f07UL }},
+  {{ 0x6cb2520503013c09UL, 0xc77e386597ec4445UL, 0x4ce84dcfbc67ae7dUL, 0x14d9e8cabbb176ccUL }},
+  {{ 0x633fb13e9901c30cUL, 0xefa5a7a114d82b98UL, 0x424f1f6bc9c18663UL, 0x2ef457b332abed2fUL }},
+  {{ 0x78f4ab51bce7bd01UL, 0xf1ccd89f73b7f13dUL, 0x72a09fb3933ba24eUL, 0x2304e73c223d52c6UL }},
+  {{ 0x114e5353297c7328UL, 0x46cd6592d1218a49UL, 0xe30fee447d54799eUL, 0x16f5f46064c1b750UL }},
+  {{ 0x7310f1626799f97eUL, 0x4852d96ea5ae908dUL, 0xd46ee88a99ff50a9UL, 0x1c00732976f1cb16UL }},
+  {{ 0x40da0b835eda63baUL, 0xd9c8f8152a7b2453UL, 0xa91a9ababef05bddUL, 0x017104ef8522b492UL }},
+  {{ 0x4d28751a791ed996UL, 0x43b8260f849f4568UL, 0x42e604a305a60c2bUL, 0x063071af3aeb86ebUL }},
+  {{ 0xe100c733c85f3235UL, 0xfad068501c51e098UL, 0x8653ae328f609b7bUL, 0x1b3327abdf98d0d9UL }},
+  {{ 0x67cb9539f4021196UL, 0x9003ea7ca50b08cdUL, 0x2e3f3ea29d82fefbUL, 0x10609ac1b1071d24UL }},
+  {{ 0x14445c0aa69e75f7UL, 0x732491c275954620UL, 0xe457963d0cbdb7dbUL, 0x167b0d374b0ea165UL }},
+  {{ 0xf84cf84e77d8764fUL, 0x1f92ab2a447a4b77UL, 0xd7d1e6b16b9b7d19UL, 0x2f76dbfdccc7231cUL }},
+  {{ 0x418b86df067d9281UL, 0xb8b342d208d6537cUL, 0xd44e1127f7d2ca8aUL, 0x171514cfe97f4ea8UL }},
+  {{ 0x835be1fde44e9868UL, 0x390dbb6d3fcf862dUL, 0x6a5c22a202d74d59UL, 0x1148c519dc362750UL }},
+  {{ 0x98d9fc9a1f37e00fUL, 0x361c907bc92a21a7UL, 0xcb79933a76175978UL, 0x238df17b8b6285a4UL }},
+  {{ 0x0b24fc500e05ac46UL, 0x4d48f6d9cf5d92d6UL, 0x7f01cce06ff8e13aUL, 0x2862cd0616f7a9d4UL }},
+  {{ 0x29840c8d115bc510UL, 0x1fa189e772c3042dUL, 0x132d27673f93daacUL, 0x2c4305944bb65b23UL }},
+  {{ 0xa027884bc1e4f253UL, 0xad380a3ddc22c63bUL, 0xb6d6f9a585653e93UL, 0x236c4cd6727a0d1eUL }},
+  {{ 0xf6e95d6cd8c05beaUL, 0x4d2bae1b468b32deUL, 0x4ac5482bd299acfaUL, 0x0af3c8e9843c6750UL }},
+  {{ 0x8d97e2f0b5152138UL, 0x8809f6f296ea66e7UL, 0x2cf2ba6d4724f9a8UL, 0x02af332aff019baeUL }},
+  {{ 0xb4159efd723503ceUL, 0x0d876ec61312afabUL, 0x0f23bf963c3c674dUL, 0x22b49aea6b42e538UL }},
+  {{ 0x4a7b601cbc987b64UL, 0x1d1f8a848bc68960UL, 0xbadb4abcd319964aUL, 0x216eea0e78cd147fUL }},
+  {{ 0x4532201cd0aaf476UL, 0x865e80e928a211d4UL, 0x11f4f7be73cc6a11UL, 0x2b78b1d2a2106027UL }},
+  {{ 0xda6b9808488b3660UL, 0xb0d4952cb6a767cbUL, 0x26e77c236859df61UL, 0x29077a6fa12dba58UL }},
+  {{ 0x4cc998df49ad2e32UL, 0x34277277f43202d9UL, 0x8c49b1c75a65bc0bUL, 0x2ef05089c8d1ffbaUL }},
+  {{ 0xa23728b79d95082eUL, 0xf88a62c3f4f0d86fUL, 0xca814ea83ae82d0eUL, 0x06b2c3d7d3e0d545UL }},
+  {{ 0x0bc3f8b847d28a8cUL, 0x6f0d7e78e02e43f5UL, 0x3edfd4d30a6d7f66UL, 0x284cc96650f32979UL }},
+  {{ 0x04c7fce8ebd7de71UL, 0xa47e44363a4c6ba9UL, 0x7d20c860a00bd0dbUL, 0x264da8af7034cd46UL }},
+  {{ 0x248a46d3ea346d33UL, 0xccc395586165da08UL, 0x040b3a3614f2ef42UL, 0x26d686825d812027UL }},
+  {{ 0xdebdb62d6f391b00UL, 0x8b843b7abb2ec880UL, 0xe16f16e335ec1f31UL, 0x019ff74e670a3425UL }},
+  {{ 0x35d4a7a7cb8a0777UL, 0x16c1ed506f4e173bUL, 0x130e50705f728165UL, 0x253935c0aa72387fUL }},
+  {{ 0x59a2ec573aa37cfcUL, 0x697e558fb68a57ecUL, 0x5db9726576870e0cUL, 0x24c2ee5ee99d75b3UL }},
+  {{ 0x4b7377901ada621bUL, 0x61afb02fbf300229UL, 0x473b8c9ca3b54a1eUL, 0x2e7dfe507b830bc5UL }},
+  {{ 0x757d24e593b458a4UL, 0x6a9b88a27544d871UL, 0xcdddfcb5ade83f82UL, 0x20cdc5982bc7a647UL }},
+  {{ 0x71f5b9fa87cb32ddUL, 0x6f873a08f286a2b1UL, 0x5c8a45299ac0be2eUL, 0x259c54623a867704UL }},
+  {{ 0x030ded707a4b6144UL, 0x25e93fd1f3f70852UL, 0x45d6f469ab49cc55UL, 0x0cb375c85d056aefUL }},
+  {{ 0x97abd7bd0ab095a7UL, 0xe95863b6012be64fUL, 0xa8744a248f48ab4dUL, 0x21adf8bf678c8575UL }},
+  {{ 0x00eb6f4a5c4dee83UL, 0x180956063fd66387UL, 0x3013e2d2a292d9c9UL, 0x01ac96f821ee2f26UL }},
+  {{ 0x0c9f99ac18701371UL, 0x5b874c6c676fb7f0UL, 0x29581a863ac0bd17UL, 0x1570d645dfa2b11cUL }},
+  {{ 0xfcbd1ac5a44118bfUL, 0x080f7abbf7ec7ba8UL, 0x6f3829b301c3d294UL, 0x096a0d3886170aefUL }},
+  {{ 0x63f3f0e4a59517d1UL, 0xbaf204330e8fa53bUL, 0x345f73697af34503UL, 0x02b9ce923e4a250cUL }},
+  {{ 0xed43600397589836UL, 0x951dac93c7caed7bUL, 0xef17e1008918b88eUL, 0x23287c48a6a43da1UL }},
+  {{ 0xf9dfb4e1fb71effcUL, 0xf587b2de80f7ce73UL, 0x8a3ab6328fceb2bfUL, 0x1af036946a2a03c4UL }},
+  {{ 0xf6b06ffdc1b15fe9UL, 0x9c628ac29a676538UL, 0x362a13fbe9305971UL, 0x1210ff1958378ad5UL }},
+  {{ 0xa9f074ee3b98ee62UL, 0xec63bbd9ee186b75UL, 0x1ded3e9dac1bb0a0UL, 0x0dcf1ffa2bbfb05dUL }},
+  {{ 0x57ac160fad859b07UL, 0xde39c1f614ec03a5UL, 0x621f203b6a6e9332UL, 0x14b19ba2624c0b91UL }},
+  {{ 0x8f2dab230b6b5a43UL, 0x1ba8f71b237044b1UL, 0xe37e1ad56b0b620eUL, 0x192840e54ab46983UL }},
+  {{ 0x7a188e49e25fab3cUL, 0xf7b2ba48e77a807eUL, 0xce8c4ae2ac357cbdUL, 0x0440824e2237ad2bUL }},
+  {{ 0x9c30e2673d1a6e70UL, 0xdacf995cf14e1a04UL, 0xf61a736c6c96460dUL, 0x2f0a15f00dd62d0bUL }},
+  {{ 0xf77d6fe674daec25UL, 0x20538228fd454bbbUL, 0xc562e2be9181c907UL, 0x2db83cf69a834461UL }},
+  {{ 0x14731c106c7c59f4UL, 0x93e9dcb58c063db9UL, 0xefb3352a5619d68cUL, 0x231e692682b96856UL }},
+  {{ 0x8823d4fa3da6933bUL, 0x21d70bd6ecd5770fUL, 0x8b7d5e98be4c1420UL, 0x1ee773d31b298bbaUL }},
+  {{ 0x08f29b1b94fe0b95UL, 0x9d25611b5ff009e4UL, 0x274fe0d307d22e31UL, 0x08dde848c7d4e913UL }},
+  {{ 0x742ce0bf76fc6438UL, 0x8394e1c0853db019UL, 0x0092d550923c0e45UL, 0x1bec648f25f94486UL }},
+  {{ 0xd861b0e90405f168UL, 0x90c1c88a6c0812a8UL, 0x5dbe0252eefab566UL, 0x2a3c1c10d78b5905UL }},
+  {{ 0x63c6f364765eb670UL, 0x636abf28aca28e84UL, 0x4f6a38d8a38b7cc9UL, 0x2c8c1f733bbd095aUL }},
+  {{ 0xf16329b3585a9cb3UL, 0xe095e3a44c42128eUL, 0x85d2873facad8ee8UL, 0x0df2583175875661UL }},
+  {{ 0xbf91218e58becda8UL, 0x80fb6c1a316ed5f6UL, 0xe1c5ff49877aa433UL, 0x1c14d636861d2653UL }},
+  {{ 0x1964f57cfa56662aUL, 0x9b8f37b09c62980bUL, 0x6ef20c3527c15cc0UL, 0x10014e8ae9076f9fUL }},
+  {{ 0x3cd1af7ff5ddadc6UL, 0xf97735b0d0b672c4UL, 0xbe13ee5089732a5eUL, 0x1e4aa9e111e982c0UL }},
+  {{ 0x8cd14799f15091eeUL, 0x02c274674831ff59UL, 0x65e93dfb6e894502UL, 0x071ee1bb1d4c1a30UL }},
+  {{ 0xf20ccd58f05aff0dUL, 0x7358ff1e9ceeefb5UL, 0xadd71d441921b85fUL, 0x123ec4de02b89545UL }},
+  {{ 0x7ef425202f556198UL, 0x5d1cc26f70bbd87fUL, 0x375cae6d80c04bb3UL, 0x2ecddde659f9867eUL }},
+  {{ 0x8bd3b9b4b63a5a0fUL, 0x9793d3ba22ecbe88UL, 0x2c4a8694f2815dd9UL, 0x04d1a7483c577f4bUL }},
+  {{ 0xbde9b0f5ae1158d5UL, 0x4023ae3c83c8bf9eUL, 0x0f7e054a16997afaUL, 0x1754eb89a47ea73fUL }},
+  {{ 0x3a8fc61527a5331aUL, 0xf578272591bcca32UL, 0x148f3691abf29717UL, 0x02899d8e1cd4dde9UL }},
+  {{ 0xce6b9223f1bc32d9UL, 0xc52c9945eff130e1UL, 0xa3ff6c32329b169bUL, 0x221ce11ea04093beUL }},
+  {{ 0xe8897d2ba3695479UL, 0xb6b8ff3cb69ec7f5UL, 0x0156aefebc9b852cUL, 0x175f2392ab2125baUL }},
+  {{ 0x046eda8b45c28de4UL, 0x1451177da07a9901UL, 0xefc8a757815ecfa4UL, 0x21843805ef7822f2UL }},
+  {{ 0xa837efed4da8a99aUL, 0xc5d2b5827eeb0e93UL, 0xe79b563a3e966328UL, 0x1d468ae90b9fb4b4UL }},
+  {{ 0xad16ea5a52926969UL, 0x0d841161ba43ad32UL, 0x2d064bcddd77c7b6UL, 0x14530e69dac6c899UL }},
+  {{ 0xdf2778aad6faa6adUL, 0xfdd382692a710d4eUL, 0xcdf23c9c3b962168UL, 0x2a066ae830bec8d5UL }},
+  {{ 0xa4ebe1718402d8bdUL, 0x67e3f676f211caa5UL, 0x600fa1436841bfaaUL, 0x11f6d2c3d350849bUL }},
+  {{ 0x792f3ec641ed3569UL, 0xca56e6b5eea2ff78UL, 0x82e96cc542186bb3UL, 0x2ac54069006d4449UL }},
+  {{ 0x995f04c5b7f71072UL, 0xcced64af8d0e9c13UL, 0x198f31240d409163UL, 0x2ba5082cfcee2b4eUL }},
+  {{ 0x4b350476a5b60150UL, 0x2f1548d61f7d84b7UL, 0x5dddb5696aa70b30UL, 0x194669c556fe71f5UL }},
+  {{ 0x5fbd782872786ac0UL, 0x8ed5ae1be2317b35UL, 0x8b61b8df50305ed3UL, 0x16d7b0478ba7d517UL }},
+  {{ 0x9502b472047d4447UL, 0x45625e8c25cb1016UL, 0xb95a4f95b6812051UL, 0x1836ff13fde299dcUL }},
+  {{ 0xe7f7b5138f93a0f9UL, 0x6ee93c115aa6d7b1UL, 0xd2ea66f2dffc6bf9UL, 0x16bc599aee97e393UL }},
+  {{ 0x6a7053087448f31bUL, 0x5f7128f25787c9f6UL, 0x97799290d69da6a1UL, 0x0bdc09f473cee351UL }},
+  {{ 0xbc5431fb3d5f609bUL, 0x556fbe556123d349UL, 0xaee92db0a0800b39UL, 0x0eb5ac83c0182781UL }},
+  {{ 0x72f499cb7e662dd3UL, 0x04b9e658d4b5cf06UL, 0xf3f5cc5d8c7849f4UL, 0x2b21dde694d26f5fUL }},
+  {{ 0x02b15fdce61269a4UL, 0xee757cd0084fec5cUL, 0x2895d86e90b0399dUL, 0x094cfe682bc7c3a7UL }},
+  {{ 0x1de41be480821aecUL, 0x44a9157e9cae3056UL, 0xe4c162aa2ad1e7ccUL, 0x2cecb27051fb3915UL }},
+  {{ 0xb8e28bf33d661621UL, 0x5407d8eff49900a1UL, 0xf11b5f355f909b4bUL, 0x2e5cb0ee79dd0969UL }},
+  {{ 0xa29bb36b931a72e1UL, 0x2fb6e40c0e305eb0UL, 0xe6a7001d499a6568UL, 0x094501516a6463adUL }},
+  {{ 0x195e67eb61551614UL, 0xe5c36287ca4bc7e6UL, 0xa36302a0618c6ad1UL, 0x16ecffbf550af2baUL }},
+  {{ 0xcbae31ed840defb7UL, 0x108b3edc89fdfc46UL, 0xfc6f401ece841630UL, 0x2923c15f7fc1cd4bUL }},
+  {{ 0xb4ba46059907d77cUL, 0xafc1139c11ba53e3UL, 0x29bf36e9f1ce9d14UL, 0x20d227685fe71a5aUL }},
+  {{ 0xeea2fd90100ac68cUL, 0x12aba03af0522eacUL, 0x2ed57005ff902506UL, 0x096abd56ff4c04e4UL }},
+  {{ 0xf7471390b210e918UL, 0xcb879762a804f646UL, 0xb90178d2f9d98adeUL, 0x2a52f99d42ee538eUL }},
+  {{ 0x2c0458d8d7399415UL, 0x4b2f57c4d97db372UL, 0x8a0f2f4f7844ce69UL, 0x2bd43ae828abfa70UL }},
+  {{ 0x6600a4dcba0c1e54UL, 0x21163712bacfc236UL, 0x140c19ad228d8c34UL, 0x0e1462cdfe98b04fUL }},
+  {{ 0xe98ecafafb1e9e07UL, 0x292aef35caaea0cdUL, 0x6900eeb1b87823b5UL, 0x0129ca20af2c13a1UL }},
+  {{ 0xff37895dd38e2e03UL, 0xec2154cf6d9c662fUL, 0x2389a3fbd4b3f0c6UL, 0x1d96059612032e1bUL }},
+  {{ 0x66003b9ff4bb86e2UL, 0xca030fb8fdbd0646UL, 0x837591760970cd40UL, 0x06f05fb5baad6b52UL }},
+  {{ 0x377601ff9cd95473UL, 0x77b536ad1e367732UL, 0x4ab11de8c8910d42UL, 0x05bf1a23ddf84c21UL }},
+  {{ 0x69c8de248449c1aeUL, 0x4cc36fe0d7fe771dUL, 0x5ccdc07b2bc0a9a6UL, 0x2a59a97e800b1fe3UL }},
+  {{ 0xc3d0c02c9bbc9700UL, 0xcc40483d7912e65cUL, 0x0edacaaf105854e1UL, 0x25d9271b0d15ef1fUL }},
+  {{ 0xf030676659263555UL, 0xc8aa8d9a40dd349eUL, 0x7aab2915ba89a275UL, 0x03d6a750ec3a9c5eUL }},
+  {{ 0x627d340f483a57bdUL, 0xb42f13c3cab35e41UL, 0x52c30201db9d032aUL, 0x1eec0298451284f0UL }},
+  {{ 0xe26658dd28c3464eUL, 0x54fe45bff330c5dbUL, 0x21d365d115f38514UL, 0x1598ad0463d272ecUL }},
+  {{ 0x19dd1ece3b5e6492UL, 0x11dd770c35a1686aUL, 0x3456f6c45dc9a6a4UL, 0x2dcc481155a1ae33UL }},
+  {{ 0xf6fba8f98ce76465UL, 0x43a4fe4f8bdd5ae5UL, 0x9d137e9953182c50UL, 0x0f79685b5bfac690UL }},
+  {{ 0xbd3696d173fec970UL, 0x147622a8cd72f5b4UL, 0x90da7872d178ffcbUL, 0x172fd3d9a14d4bd7UL }},
+  {{ 0x6b9391fcf274c46dUL, 0x1113f5a2b769d79fUL, 0x83a8225b6c97d719UL, 0x27d61517e6f72c29UL }},
+  {{ 0xe77b56ed01d49d4cUL, 0xf1494c29623e6109UL, 0xaf79c09b83566bc2UL, 0x2f8cd656a6e85e01UL }},
+  {{ 0x5efe8ada7ca2349cUL, 0x671344059d9b4b33UL, 0xbc01b1ff067d377cUL, 0x01b54f3bfd98f2adUL }},
+  {{ 0x972b2bb1900754efUL, 0xe0b8e0abfd8fe34fUL, 0x3e14add1ea6cd7c8UL, 0x1ec7bcf7718167d1UL }},
+  {{ 0xe1a6bd9b7c745b60UL, 0xe64b446cf84f1d6dUL, 0xe525573d7fa8cd84UL, 0x1e5edec6585576c5UL }},
+  {{ 0x46ee0288f1799524UL, 0xd5d72007a46a6e6cUL, 0x624b198377683eefUL, 0x20639a44fb931d0cUL }},
+  {{ 0xe9d4a9d153bd266aUL, 0xa0f4d12160ade72cUL, 0xe189b2a401b3ea08UL, 0x2ccb39046ae51420UL }},
+  {{ 0xcc691a76f92091d4UL, 0x5430316dc32df718UL, 0x6efe4b1221d42f29UL, 0x285fc4b2b74a48ffUL }},
+  {{ 0x3e0c9eeb13dbdd62UL, 0x3f449cdeb17ed1c3UL, 0x10c0192554daa229UL, 0x2f8098e1aba8eed0UL }},
+  {{ 0x0eb14bbcc88c1697UL, 0xccc959ceddbea3fdUL, 0x1b2d6183325b4a27UL, 0x1e06f38d7726ad2bUL }},
+  {{ 0xdca8b1545a3a6934UL, 0x7dadb98d3f6d4e00UL, 0x987a826aa8629e29UL, 0x27e1af5e276dcf24UL }},
+  {{ 0xb6100b2e14c61ddaUL, 0x081a788b539d3eb0UL, 0xf392f87f3d6dba32UL, 0x126887343b2055c9UL }},
+  {{ 0xc82ce5b42666e6fcUL, 0x3e8f9405b8bdc12bUL, 0x17e06fc0c0cac284UL, 0x270c6264b50e9f74UL }},
+  {{ 0x75707e0b3aaa7522UL, 0xfdea6332ccc8612dUL, 0x4b8c7409e4f18f0cUL, 0x1767d70331e4ce0fUL }},
+  {{ 0x6aa32995965ec4daUL, 0x052784853fa5dbb4UL, 0x220df55da334ee5cUL, 0x0eae6eb352c1b294UL }},
+  {{ 0xa9ee21cb9dbcfc2cUL, 0x9d629396b5d5feafUL, 0xe053ce4f203add56UL, 0x17a931e674d75de2UL }},
+  {{ 0x2fe0829472cf0c27UL, 0x9e4b4bf36ab14d99UL, 0x7847ddcff261d72eUL, 0x17b2ba848a13df34UL }},
+  {{ 0x92c8d75147924f0eUL, 0xbf5f2e110896682fUL, 0x039b0bb784b66e58UL, 0x11855489b64093b3UL }},
+  {{ 0x3f4dc92d1ac5ba66UL, 0xb973a75ecf2e29d9UL, 0x3a4c0b51a8789463UL, 0x2b4446d643f8c1d6UL }},
+  {{ 0xf43103bbcd68eb53UL, 0xa9fccc36a6ce0149UL, 0xbfa266c963b5eac2UL, 0x05f19caa692a89ecUL }},
+  {{ 0x12546f7ad83bbc28UL, 0x625d341951172ad8UL, 0x56fb54892f27bcd7UL, 0x00187034790d469bUL }},
+  {{ 0xaa1bb0293ec0f8a2UL, 0x09f9bb2a952198eeUL, 0x5b9700e148048428UL, 0x19944e3d67a1b166UL }},
+  {{ 0x4008b4e696baf765UL, 0x0e796c4bd8ef8f9fUL, 0x2f4815818b596659UL, 0x2bd2868fd319e6ceUL }},
+  {{ 0x6d6d4cd535325ec8UL, 0x9abe43c8ece27db0UL, 0x27e6452cd722edc0UL, 0x22b012bb25eeace4UL }},
+  {{ 0x6f510414bb28bbb0UL, 0x91b8914ad43ae84dUL, 0xd6caea3e5724d557UL, 0x06d51e3f96da23efUL }},
+  {{ 0xf97dc234a9017362UL, 0xbd6138b8bd7e6955UL, 0x73e04dd49445dd70UL, 0x0156e39831ba35daUL }},
+  {{ 0x5a302b4396c5788bUL, 0x9485885b98d27bfdUL, 0xdeda9ce49dceeafaUL, 0x16953cc7f70459f8UL }},
+  {{ 0x8743b616bc419b87UL, 0x5727521e41daf1f2UL, 0xb195b99619157924UL, 0x2a437b6d9d94910dUL }},
+  {{ 0xb109baabc4d256f2UL, 0x5e2ecdea23889f91UL, 0x5095689fb58b005aUL, 0x2f1ad7e925bfb30cUL }},
+  {{ 0xf06ffa1e0563d565UL, 0xe7c4723843cef938UL, 0xca182c7faf92c67eUL, 0x2e9959e4dc542916UL }},
+  {{ 0x68f3e80d3a51ae33UL, 0x44fcf26dbb8aeca8UL, 0x7186222c19bab2dfUL, 0x22f1b3ae75fca51fUL }},
+  {{ 0x5a83214f277018c5UL, 0x042915d0829b6b00UL, 0x643b81722ad2a80dUL, 0x0cf764a029536784UL }},
+  {{ 0xb94d6727c6502a20UL, 0x5939a0f1555de5c1UL, 0xe4e927a6f4c747fcUL, 0x1ceb59b3cf1ecf21UL }},
+  {{ 0x8a922e8c2ca13882UL, 0x05fc51e035d4b022UL, 0x8d10f6ffdbd533c1UL, 0x12c05f4af1b2c2e4UL }},
+  {{ 0x3960f42b619b8e37UL, 0xa13758d83e231cfcUL, 0x7a926b42f9493645UL, 0x2cbdb2a49c1f9bc0UL }},
+  {{ 0x4d2e2e266dfa4a68UL, 0xf620b6e3b0e7dac2UL, 0x860b99e62f110a4aUL, 0x03856e26dd3a5949UL }},
+  {{ 0xfffc15da82523339UL, 0xd25bf34b681d3eb2UL, 0xc1639a40fdeb9cf7UL, 0x2379b2c839aab169UL }},
+  {{ 0x5a08e2abb234ea1dUL, 0x3f87c6a85cf0713aUL, 0x5ee2e8c7714aec1fUL, 0x28db2659fb598b75UL }},
+  {{ 0x239324ed0de72388UL, 0x029a98687678078bUL, 0xd5dd92342c247269UL, 0x0cd2fb4ae3dbdf91UL }},
+  {{ 0xa8c77facd5e2de5dUL, 0xf798cf2d5f63cb83UL, 0x0ddfcf32999a59e7UL, 0x22f129625db9cf6fUL }},
+  {{ 0x69863e10e74a2418UL, 0x2a8447c311f24f21UL, 0xaf72925a8734cf88UL, 0x2d32c4c81a3bbcabUL }},
+  {{ 0xd5b44f3b40bab268UL, 0xe8a0469c6a6a2eb4UL, 0x34f26be2d2bcaa5eUL, 0x0cf0d9bd93eca198UL }},
+  {{ 0x8d1653c307ef54eeUL, 0xfdc8a471abc7c567UL, 0xe99ddf663f76b9a2UL, 0x2e7c38dcfd1344dbUL }},
+  {{ 0x59588ed49daf1824UL, 0x245b39cddcf848dfUL, 0xe5d2d677473df3e8UL, 0x13fdd519e667d185UL }},
+  {{ 0x535d70ea44dd3fc2UL, 0x822937b0f0f1243bUL, 0xed757b48fe96c217UL, 0x144fe7442ba6c38dUL }},
+  {{ 0x737c209bac8cf6beUL, 0x8b9add8488972407UL, 0xff8f11960b098153UL, 0x16055fe2bd222285UL }},
+  {{ 0x8fb7471a69b8e667UL, 0x0a639193e8943702UL, 0xb93c99d93342426fUL, 0x2a7910d6e7997ea3UL }},
+  {{ 0x6cf57900969301daUL, 0xb1b649b9e4528aebUL, 0xc4dddc44a5f365b9UL, 0x18b96474735275a3UL }},
+  {{ 0x25fc19f7b6e2d2ecUL, 0xe73c09963aa67521UL, 0xef9ee99327536733UL, 0x19b5d9200ab7d574UL }},
+  {{ 0xefd91a6c4f80ee20UL, 0x14f73aa3a776ccf2UL, 0xff205f8995063a55UL, 0x233b74ca1a501a21UL }},
+  {{ 0x8653ebfa5c90b1afUL, 0x323dc141fd4f8977UL, 0x9bcc053f59138321UL, 0x119043587c3a0cdaUL }},
+  {{ 0x0530af7a648f105aUL, 0x083e86056055ce68UL, 0x0d8a2bdf97ba8a05UL, 0x0250cff14e54189cUL }},
+  {{ 0xda77e86fc139969cUL, 0x8220f6874af6ee5dUL, 0x0d99a582cb5f12eeUL, 0x2ea96e147b932abeUL }},
+  {{ 0x1bdce688b77f1428UL, 0x27c3315484c48d0eUL, 0x5f1fb0dcad93e862UL, 0x02911436f709aef2UL }},
+  {{ 0x2c649ff3edfa2385UL, 0x4fe76b9eea5c02c9UL, 0x27c31036cc7e85e1UL, 0x185e0714f483bac9UL }},
+  {{ 0x4343e6590ea16d3bUL, 0x31aac0723f420b26UL, 0x4afbc3150f513810UL, 0x04df728dc4a3aa9bUL }},
+  {{ 0x564f7c0b67b07494UL, 0x3229da9758f00275UL, 0xccc9da70fa7ff65aUL, 0x0b7f3f99ec64ed3eUL }},
+  {{ 0xe4fd7724adb170a9UL, 0x112e7d099be7110eUL, 0x2204541244ed0d9cUL, 0x119a28c832e985b0UL }},
+  {{ 0x65b66ca02431598dUL, 0xe6f1795165d60983UL, 0xca31659932cbf504UL, 0x132e93d06c48d14bUL }},
+  {{ 0xdaf17a02b14309e4UL, 0x711af32c3942c4c9UL, 0x74140d434220daeeUL, 0x21c890f8826839dcUL }},
+  {{ 0x6ba64ac553ed7fd2UL, 0xdcf7e0c9d89e95f0UL, 0xefdf75639e6c06d9UL, 0x2ab5374beed8d915UL }},
+  {{ 0xb1e5143f9b21d931UL, 0x5de25a038578638dUL, 0xe770182a045b5405UL, 0x2bcd47b13fc28189UL }},
+  {{ 0x01c19b3f1ee74c28UL, 0x95a3c460175a475aUL, 0xed64fb598b83e2b9UL, 0x0263ea9324a1e8d6UL }},
+  {{ 0x38aa9b9a35ec47e9UL, 0xacac98619d9f489aUL, 0xa6da4fb2a999f60fUL, 0x08d2391b4aed4179UL }},
+  {{ 0x42238c3d47654cbfUL, 0x2b5068735b9cc81cUL, 0x10613c96204cd697UL, 0x2c34d5841fcfc054UL }},
+  {{ 0x75a6dabd78b3b48aUL, 0x1a67fab964610a13UL, 0x5df309d3f019a699UL, 0x259170674f1a2c70UL }},
+  {{ 0xa9b877a9af12dc67UL, 0x1233170820609ce3UL, 0xdc50f5fc4685804cUL, 0x11eb7332afdc1d26UL }},
+  {{ 0xe4651b9bfb7d5453UL, 0x82c3ee8b8bbc47efUL, 0x15250e7eb0fcfd59UL, 0x1c853feab6186b9dUL }},
+  {{ 0x6f9fba4eaf61fc5eUL, 0x3ce1aeb068e39b62UL, 0xd7bfbd540b7074ecUL, 0x0a30e93a08dd2e19UL }},
+  {{ 0x3615977a0842ea83UL, 0x5c0037ef1b680216UL, 0x17e35d45133b9725UL, 0x2981c488319495d4UL }},
+  {{ 0x305befb18212d6f2UL, 0xf20439685f03745bUL, 0x114de24268ff6cb7UL, 0x17900c01dc238d72UL }},
+  {{ 0x42fbe48ca39b8d83UL, 0xe56d651ed9c2a99dUL, 0xbb8a01e5bb3432f1UL, 0x2f934cb78e0d1be6UL }},
+  {{ 0xb0b63127cbaed016UL, 0x48593d3b9d6b6137UL, 0x033cbbdafa6549bbUL, 0x045d8539804e18cfUL }},
+  {{ 0x36ed1dc6ce58b537UL, 0x9cee75b5ec10a816UL, 0x47bbdac56999ebb2UL, 0x0194f36740fe76abUL }},
+  {{ 0x4ebf72322ee36e7bUL, 0x1d4e79e4033565fdUL, 0xe4558220984df84eUL, 0x11bdec63b05d8617UL }},
+  {{ 0x141a47d886c57bf7UL, 0x6e10d1c70c9bf204UL, 0x1c3479625729de5dUL, 0x240a5592d226f518UL }},
+  {{ 0x90280de3161a3615UL, 0x5b0c169286210c09UL, 0x683c71deed4f9c25UL, 0x017af6150b9c7ebaUL }},
+  {{ 0x78e31bc46fcf23d9UL, 0xaf67f43127d5b730UL, 0x91551403d57b453aUL, 0x0ba34289c2dc0f7fUL }},
+  {{ 0xead652d9fe72d448UL, 0x0dc7cb86186f7810UL, 0xf072d3454feb3be3UL, 0x1b0f011c55ceb273UL }},
+  {{ 0xa53cbf067e8c774eUL, 0x310e4af3f511ce10UL, 0xff9adb9133f7c023UL, 0x17af835b73310b4fUL }},
+  {{ 0xefc5503ec38523f9UL, 0x8ca814682a0d3713UL, 0x9f8b9791959af2acUL, 0x07caa488356a3f6dUL }},
+  {{ 0x17ade8ee3fd5f2f8UL, 0x79c3910ebe76a4ddUL, 0xddaec1fe637142f5UL, 0x0e9fb516278745b9UL }},
+  {{ 0x00fd6b909d648677UL, 0x23461a7c8ca0f102UL, 0x170be177a80a575bUL, 0x10d3ab92bc687a63UL }},
+  {{ 0x44a7ef5d505a4934UL, 0x7b8dd96bff011c8eUL, 0xb9666ffc4083bc93UL, 0x250a7711ecad29a0UL }},
+  {{ 0x6d4abc5ebe67e64bUL, 0x281c49140168603dUL, 0x1f8079eef56591cfUL, 0x07c56d56b6cc44f8UL }},
+  {{ 0x9a8d9e5fd373aaf3UL, 0xfc8e3b958eef3b34UL, 0xa8bda6b93356f6b1UL, 0x274c70b7bf567626UL }},
+  {{ 0xc58c85db96a6e17dUL, 0x72f267143a1c7fa8UL, 0x39da0e93a6539510UL, 0x016e429a69a6d4d7UL }},
+  {{ 0xf6c42807343bc878UL, 0x6d654032df19ded1UL, 0x9f08a05e3b9e4070UL, 0x2c65301994dfebd9UL }},
+  {{ 0xc5a11f415b1667afUL, 0x06210b2cafb8420cUL, 0x7d47b5a1a38e58bcUL, 0x1727d95f35ca6a8cUL }},
+  {{ 0xbde1bea4df289db8UL, 0x0c80e5f876a67c77UL, 0x702b85f3bdabc582UL, 0x28fbae95d1895689UL }},
+  {{ 0x89fd658bf889d10eUL, 0x8b399873470e536fUL, 0xc758d92dfda9cda6UL, 0x0c26b0b68f6dc3d8UL }},
+  {{ 0x54f9a960e4ab558aUL, 0xb2652c64a9fadfe7UL, 0xc035d1b071155ec6UL, 0x13f0efbc8bc45406UL }},
+  {{ 0xe07451d2267e18a0UL, 0x91def20ea7b7cd31UL, 0xf3f6ce62bf7ad915UL, 0x0787eb14c52f974cUL }},
+  {{ 0x3f4a705f5539d424UL, 0x44da439b1ce0cbe9UL, 0x1695511335d1887aUL, 0x2b0b14c34817b075UL }},
+  {{ 0x1e27abfbebd7f1d6UL, 0xbf75f715e8c394adUL, 0x425b3376b4d07871UL, 0x06fc402bc4f36eb9UL }},
+  {{ 0xd4e4963f6aca81bdUL, 0xabb752c5c331a10fUL, 0xb49603c79d02c1e6UL, 0x0b117b5803d7e7c8UL }},
+  {{ 0xaf4eea43c5bd5893UL, 0x226a749ed25bd931UL, 0xdaae8846b51af2c5UL, 0x10eebb3a95ffacedUL }},
+  {{ 0x210f783d8fea1d26UL, 0x9b4bd5190a55cac2UL, 0x28f9636ca7c4738fUL, 0x03c3a21930acf77dUL }},
+  {{ 0xefaf93a0f8cab335UL, 0x45dfd61077c32ebfUL, 0x2bdebfb4419acc5aUL, 0x151b38b2234755daUL }},
+  {{ 0x60caf154e9f1dd67UL, 0xfe78d24a343b3cc2UL, 0x5e536e44efe4011bUL, 0x1fc03e64153d4ca4UL }},
+  {{ 0x0ef365890f604fcbUL, 0x7e6abfdbaafb775fUL, 0xc3255d553ea16b65UL, 0x234fa77a5cff51e4UL }},
+  {{ 0x6aca8989369e54c3UL, 0xde2cbbcfe071252dUL, 0x8ef73926d87e641aUL, 0x07767f954db3fb4bUL }},
+  {{ 0xd7e7fa0f47b9a519UL, 0x5c8e69309bcde912UL, 0x27e6e83f5a1df8ebUL, 0x019732857f04d845UL }},
+  {{ 0x27ca633735f18fb6UL, 0xcf1ecc93611eeb67UL, 0x94b86dc831be519bUL, 0x112d24ccec50fd78UL }},
+  {{ 0x815782ab736e6ff2UL, 0x45b2e961adb1224aUL, 0x690be32d39afc6ceUL, 0x15dfc47cde37e364UL }},
+  {{ 0xf884df23a24abcd9UL, 0xa7bc5f481c6f8184UL, 0x93d25fd5e05d717bUL, 0x1067e34ddfec9699UL }},
+  {{ 0xfcc71f45e05830d1UL, 0xbafb020af837c9caUL, 0xda23f7bd3ccc0c43UL, 0x25a035d96eafb2a8UL }},
+  {{ 0xc0c4d8761278a229UL, 0x72f848f14d79a0b8UL, 0xa44efbe460fd7d30UL, 0x128edd7118f747dfUL }},
+  {{ 0x487b16c8bb656b94UL, 0xf63c85cd045b15e1UL, 0x391a0cbc357ff450UL, 0x302a68c738e69bb1UL }},
+  {{ 0xb97a19b2b42a06d7UL, 0xdc2068469da65dc2UL, 0x5021834fdb3df11bUL, 0x087f86cca6cad46dUL }},
+  {{ 0x9a1aea93099b91feUL, 0x71fb7d173dbdc0eeUL, 0xafab9a5bc4382c52UL, 0x0fd7096dc41f2d5eUL }},
+  {{ 0x77cbcfe78ac4e7b6UL, 0xe0626c0191fe670eUL, 0xb5e0349ca81d774aUL, 0x208440a31ad50dacUL }},
+  {{ 0x87e1838fe5c62feaUL, 0xe8bbd88a2d60861dUL, 0xab6cb88328340219UL, 0x2553712e9cae3ae6UL }},
+  {{ 0x987ab42a0aae4015UL, 0xfc02213e45eb3c27UL, 0xb8da024776028198UL, 0x1332e589d5c0c77eUL }},
+  {{ 0xe309f598216b5adeUL, 0x34bbba8b2d6d3bc0UL, 0x009caa00b254cfc2UL, 0x2729e97e14593168UL }},
+  {{ 0x5e5b89ee281e6a21UL, 0xfc72749f8db09cccUL, 0x66ea716f0829092fUL, 0x01ffdf8bee24ff6cUL }},
+  {{ 0xa81482732009335bUL, 0xe485d7c45f5291e9UL, 0x1e1ac90fb7061c26UL, 0x15c85715a9f954fbUL }},
+  {{ 0x164da7c646e9e67eUL, 0xaab968cf9a156a3bUL, 0x4984c68335abcfddUL, 0x09929082facdd703UL }},
+  {{ 0x2decefe05a1a675bUL, 0xe1bf91c3dbf26d08UL, 0x1e87b30c53d971a7UL, 0x203badd897f420aaUL }},
+  {{ 0xa5fee492671bf613UL, 0x8c534cffcfb824f3UL, 0xe00bc2e6bf9fb451UL, 0x1dfff85cbac4efc6UL }},
+  {{ 0x21177b38fff6d073UL, 0xeaec3bae6056441dUL, 0x1f05c27cc4b01931UL, 0x0b61abc38d5bc5afUL }},
+  {{ 0x02f4126e047c565fUL, 0x8e1b7b6a294a6595UL, 0x222f93269852e7cbUL, 0x19d5a9492638a1c1UL }},
+  {{ 0x138d779226b8b9ffUL, 0x26f3fee976180e0cUL, 0xee7df93852cb83c4UL, 0x154b70ce648f25ceUL }},
+  {{ 0xaca345dc89fae925UL, 0x05945de488697512UL, 0x5b95be429e3dd53bUL, 0x150b8a4ec40f055bUL }},
+  {{ 0xa0191328bca5056eUL, 0x6f9ee6f1d5b511c6UL, 0xb548560173e0cec7UL, 0x13625b3cec596a3eUL }},
+  {{ 0x90b43ab12a70973bUL, 0x4218f0bd98c27880UL, 0x3f84c24da7526d2dUL, 0x029fd58f223da4f4UL }},
+  {{ 0x0962be2c67bc4638UL, 0x6db64f1a82536590UL, 0x74756aa5d52a9e84UL, 0x010fd0e98b5a9f65UL }},
+  {{ 0x891aa45f42019f97UL, 0xb3258ea723066c7cUL, 0x40a787b698c71a7dUL, 0x021b974980ef915dUL }},
+  {{ 0x7af4572aa5cf21eaUL, 0x771679d9abad695fUL, 0x080251b9b95f31efUL, 0x27ba51401a7eb965UL }},
+  {{ 0x4acf158818c2cca2UL, 0x7f6205c104400232UL, 0x33869245035bb60aUL, 0x15f80b41688282f7UL }},
+  {{ 0x4f3edc267b3f141cUL, 0xd28ebd496aeddc6cUL, 0x4bee5c89f82833f3UL, 0x2c2f52074272c117UL }},
+  {{ 0x36d4f91b56ae40d3UL, 0x4fa1116825088c1fUL, 0x3640d30fe93c37ccUL, 0x22f34cf62e1d7d2cUL }},
+  {{ 0x4b75053b2ef8c938UL, 0x6e324aaa63dcbe9eUL, 0x9fbf1bcac9109196UL, 0x13ac055a7f609919UL }},
+  {{ 0x975ef89f3f080497UL, 0x3578ea98dd696d34UL, 0xd6b6027fb61c8aebUL, 0x02133a683dec5ad1UL }},
+  {{ 0xd3e01ece60b9e754UL, 0x8750a4b38f60971bUL, 0x2056cfb258850d85UL, 0x2e09dd91bfa4a42dUL }},
+  {{ 0x9bf44988599c473dUL, 0x0aa77de8afc3abb1UL, 0xc538e16530f80ea4UL, 0x08ba881f77b6c4fbUL }},
+  {{ 0xbe33331e8e0fbd48UL, 0x4127f22034bff5c7UL, 0x7d470d419026d487UL, 0x1095faa5b5152417UL }},
+  {{ 0xdd922c58d87c0be5UL, 0x8cfa52efb5b9db05UL, 0x6ed945c37b4260c0UL, 0x2ab87eb73a1f36fcUL }},
+  {{ 0x508325035c1a39daUL, 0x68a1cbef4e6b7a3cUL, 0x142171501fed700fUL, 0x03b169934fb08573UL }},
+  {{ 0x18188e6c44008ef4UL, 0xe640a9af9ba5f0d8UL, 0xcd6e82597a27f22fUL, 0x0ca6478ebd94f73cUL }},
+  {{ 0xde2489c9fc364c38UL, 0xc3c3485cc87cbfedUL, 0xb0f92eb46f3f1e5aUL, 0x078c4f500974db9eUL }},
+  {{ 0x6195ca130d454686UL, 0xa56c80122c21b19dUL, 0xb80f4eed483c0bdeUL, 0x183f7cba2a346888UL }},
+  {{ 0x514dd0f680e50ce8UL, 0x645b44bc5c5bea11UL, 0x9b281fe939f6bcc2UL, 0x225dde06067d6657UL }},
+  {{ 0x6d9ee5850049c06aUL, 0xe9c3ecf7fb61b23cUL, 0x392fd2a45385ce0eUL, 0x127c6aea0903e537UL }},
+  {{ 0x5f4ba0ca413842b7UL, 0x2e56c5e9ed5f155cUL, 0xe1a15ab671c85056UL, 0x0f44759b0f22d464UL }},
+  {{ 0xecdd86aa1e359339UL, 0x63571044d8847a24UL, 0xd65cd62869efe1e2UL, 0x27d2a1db0faeed8dUL }},
+  {{ 0x84fdba672db04c29UL, 0xbef16d54d8b37576UL, 0xcfe4e5dab4e082edUL, 0x227986a06551762fUL }},
+  {{ 0x2f34155da525214fUL, 0x5ce2298fbae210f6UL, 0x229e8a9f2f8fc60dUL, 0x2963094c53b70aa8UL }},
+  {{ 0x62d1cf57e1eed03bUL, 0xb3e00328dd795861UL, 0xd5b55d708f768591UL, 0x1a3f91f5e32cbfb1UL }},
+  {{ 0xb05ab08b5a8241aeUL, 0x185796d0baaf6708UL, 0x35b6311068bf7697UL, 0x13c1ecfbfbabff82UL }},
+  {{ 0xd92cad2912b11becUL, 0xade88da8636c2fe2UL, 0xd74db7407f79bac5UL, 0x1253f0ee92158d99UL }},
+  {{ 0x20b662938c47e908UL, 0x0625a5e38b369713UL, 0x86b9e5b3f8a8b9c5UL, 0x22b8ec14756c0967UL }},
+  {{ 0xbb5425014ce5e378UL, 0x3d45b9846ac5a61cUL, 0x87bf83ecbfcac058UL, 0x0ce43dbc03f06247UL }},
+  {{ 0x5b2dabcc06c75e96UL, 0xdb24eafe02ca2ddfUL, 0xb9f9b91269f135c3UL, 0x092c05960121cc27UL }},
+  {{ 0x19862ffcc8c8d0eeUL, 0x8c19ee4088d9b4b7UL, 0x5d14c5bd15c37ca8UL, 0x2ed0c68394857562UL }},
+  {{ 0x68b661c5d9af7608UL, 0x952bfd1b94df11a8UL, 0xe429bf1b16212302UL, 0x286cc3c440004958UL }},
+  {{ 0x525ab55957262fa1UL, 0x2839852efeef2a0bUL, 0xb9b6750cbd0074e1UL, 0x06c42de0d2cf18b1UL }},
+  {{ 0xf4df5f0ae09b6fcfUL, 0xcd79bf1eda2fec7aUL, 0xd3e08b813524c5adUL, 0x2b4574a6d37b3698UL }},
+  {{ 0xb193535198bd5c54UL, 0x604096869e3ce1afUL, 0xacf643be57f0ee00UL, 0x0ddadff88bf3802eUL }},
+  {{ 0x97e690ea2c3d1edfUL, 0xf17376809f03f3cfUL, 0x3519d3fd64faf206UL, 0x3061713329e120d0UL }},
+  {{ 0x0dfe9a911885bd19UL, 0x24312de6b642d7eeUL, 0xa142c73d68aa0391UL, 0x1f33515bae8d05ddUL }},
+  {{ 0xdc0321cbc35511a2UL, 0x39a9470b03c1538aUL, 0x7645c9854d76c514UL, 0x021b82bc5c16a943UL }},
+  {{ 0xc8ead5efcc980961UL, 0x35e92667f7db0853UL, 0xae9645717c9578e2UL, 0x1ad831716733da09UL }},
+  {{ 0xfc7df9012b286fd6UL, 0x3e877db52477b91aUL, 0xc1fe1fdc39e2bcf9UL, 0x16015dd105787a59UL }},
+  {{ 0x0d785960973fc157UL, 0x9c494a8f61e67d91UL, 0xde0131180235d503UL, 0x141447068b41dbacUL }},
+  {{ 0x734cd58049502c08UL, 0x1b15bc40cef3ee68UL, 0x030722df202d7416UL, 0x2271184a7cbceb5fUL }},
+  {{ 0xdc0c364eb4ae023fUL, 0xed504278196318bfUL, 0x6bd2c9d8ab57f613UL, 0x0494aadf5286ed8bUL }},
+  {{ 0xba11680ebce98561UL, 0xaec579eba613ac3dUL, 0x3a363d0957ba9e83UL, 0x092c6e012e291c6dUL }},
+  {{ 0x3d7ddba1e873695cUL, 0x240842b617438898UL, 0xac0bb34fd3eb0abbUL, 0x2ab7f2a4487f1114UL }},
+  {{ 0x964118b6a8ca7eeeUL, 0x663fecebed9d765dUL, 0x6cc8f1216167e5ceUL, 0x1ef80f3746da184eUL }},
+  {{ 0x962ffe14aa2bfc8cUL, 0x93b7e494c24a1546UL, 0x8db7393cfd11a7e1UL, 0x197fa165cf684888UL }},
+  {{ 0xe089db98d344c0a4UL, 0x53ce2fc8db088f11UL, 0xa42d900fa1f76b9aUL, 0x04c661e1e61ddb90UL }},
+  {{ 0xe86dec6801c64afdUL, 0x90c82256b5667302UL, 0x3b2e6c2f8c106cf7UL, 0x06cf8d1fd83f2e42UL }},
+  {{ 0xfaa281568798b794UL, 0x9c3aeca23391a405UL, 0xaf8c643900e97a16UL, 0x16ffbf4bd0be1d9aUL }},
+  {{ 0xc171e6e373ca8d3fUL, 0x2a449e5d91e2b77bUL, 0x8f9f5c721b2342bcUL, 0x1b3847e12a0aa6b8UL }},
+  {{ 0x5a4999f0b7104decUL, 0xbc6b83c39dd36a37UL, 0x7e39d723c87b06ddUL, 0x283c48fe025a13d7UL }},
+  {{ 0xddf4d9632528e8d5UL, 0x3ea55cc28c2d9dabUL, 0x6a0be97ed332d153UL, 0x2a4d748a0a8dbab7UL }},
+  {{ 0x60771595f7957907UL, 0x514e3777687dac32UL, 0xee6f727003837773UL, 0x1585cbdd1a597668UL }},
+  {{ 0xb315cbd9e4f8e982UL, 0x0bee162359978413UL, 0x7ad849eb5f272ba9UL, 0x11945611a277c2c1UL }},
+  {{ 0x0292e97b0d1e1535UL, 0x6b15175194348711UL, 0x7fbddaf9fb2d5f9fUL, 0x07a40acab353a3abUL }},
+  {{ 0x4d178c6a10fd792cUL, 0xa667d93b4021279dUL, 0x3007598087095044UL, 0x06e9f571c395c6b1UL }},
+  {{ 0x933d7b702e02c0c3UL, 0x74169093f2119cadUL, 0xa3ebd0bebbbfd165UL, 0x05b8f82e4ee7df21UL }},
+  {{ 0x1647c0456659712cUL, 0x547a8b1683feddafUL, 0xb8c9890bd3bbf996UL, 0x06fc6cfa6ab9a849UL }},
+  {{ 0x9b1eaa53d1948c4aUL, 0x5b8267ce01b9e64fUL, 0x1b9e521d447e46a9UL, 0x014f4b5c06ea0336UL }},
+  {{ 0x985b74fbdae0ad9aUL, 0x82d46444b98071d5UL, 0x7f0b743bef5a6f97UL, 0x27507b07242a0ea2UL }},
+  {{ 0xa38d2386366787f7UL, 0x5294ee06451099adUL, 0x8cf1af27cbb4f0a2UL, 0x119ff0e37aaf23e3UL }},
+  {{ 0x3360e4578997df14UL, 0x328c8d40f0c99b56UL, 0xca2e6ad9533f5f6fUL, 0x24f8d2ca243ded52UL }},
+  {{ 0xdd36153c88e70e7fUL, 0x50a5592bcecaa470UL, 0x63c034dd27c3f963UL, 0x29157f0d60bfac1bUL }},
+  {{ 0xa09d5d2f7812511eUL, 0x3251d5f06017a4a3UL, 0x79ac74e834f7d618UL, 0x1cbc61569bfdced5UL }},
+  {{ 0x8aaf8399ee2e3045UL, 0xfaad895e1dab29b1UL, 0xb7d149197e035006UL, 0x30190b70e515511fUL }},
+  {{ 0x27316c501c99686eUL, 0x1ffe01804856d7daUL, 0xc3cad01334eecec2UL, 0x00dc81fc80a165caUL }},
+  {{ 0xf015968825dd4065UL, 0xe3ee8388f5ef95efUL, 0xfe4d8b1d861b7f59UL, 0x1b78f6465d6b8f4aUL }},
+  {{ 0x8846945188777e57UL, 0x9fec570ef40494a9UL, 0xcb067b9dbe9b5b42UL, 0x1c710df1c9992b8cUL }},
+  {{ 0xca6b76632dcbef0dUL, 0x95110ccf1acee445UL, 0x2e4f507fef31be62UL, 0x0fed4c23cf0c812aUL }},
+  {{ 0xe5f7968df8f61d19UL, 0xbb06bfc9dae916adUL, 0xf035cf71df2f7094UL, 0x1dfbace6946c9a10UL }},
+  {{ 0x43566df162ddde7bUL, 0xf751c386fdf78713UL, 0xd5b77b7af4d5ae58UL, 0x0c83bbb95cfffbceUL }},
+  {{ 0x79e6dd3e5e7b42b0UL, 0xa008ef8fac582256UL, 0xa8e2dd88ea3807bcUL, 0x1c848db810e2f5faUL }},
+  {{ 0x2c675294484c9b36UL, 0x6f82f7e80081402eUL, 0xba395e2b8c19073dUL, 0x09b7668bb72485a7UL }},
+  {{ 0x23698b58751ebed2UL, 0x9ae54b9b6bb4e242UL, 0x0079b5ff41c8601fUL, 0x0ebc379ce371e3adUL }},
+  {{ 0xbb6556ac6afecf76UL, 0xfd53c36c92cef4ccUL, 0xa753ecba2366e88fUL, 0x16bf49a1f33f3f8cUL }},
+  {{ 0x5fab54f3b2660410UL, 0xe961064e351fbec0UL, 0x791bf086b23c5d93UL, 0x2ba0d49f6a15e61cUL }},
+  {{ 0x95a4c80443c2d478UL, 0x571dcac6cf9edb0fUL, 0xcff6fb90d5dce892UL, 0x1cfeb4b7b8332a6eUL }},
+  {{ 0x2aa293b3cffc7f4cUL, 0xb014e212dbe5dcf4UL, 0xd99b69e1208c2f71UL, 0x1cb7090878ad9e97UL }},
+  {{ 0x72ba70082d913f57UL, 0x911e3745134cc434UL, 0x08a471b5c19fdc3aUL, 0x059dc2711ddd80b0UL }},
+  {{ 0xd3be6b702a31d8d1UL, 0xf03adb529f22073cUL, 0x5216e89ac0529370UL, 0x06f30cfb8809cc52UL }},
+  {{ 0xa618ec641271d7d2UL, 0xc98ee686e90eacd3UL, 0xd19af565fd7d7a98UL, 0x1c06a9bfbaf2f169UL }},
+  {{ 0xeea326a881241a1aUL, 0x5a197d26d432bdd1UL, 0xd1479d6344a574ddUL, 0x182feeefdd4e9d55UL }},
+  {{ 0x49b72a8a99ef231fUL, 0xf056ae0e328495e4UL, 0x4aa980f3b25adc89UL, 0x167cff9e2dc1155dUL }},
+  {{ 0x515b67e052e5b8aaUL, 0x8abc05385bc92695UL, 0xa03f4fde7d0bf4f2UL, 0x0d7a3527544b604fUL }},
+  {{ 0x618f50eaac62b374UL, 0xbc2bd057f39ade5dUL, 0xa514a1d40f28471cUL, 0x1381bdac4527371dUL }},
+  {{ 0x428df4fea08949ceUL, 0x4ec5bd2339d4507bUL, 0x0ea8d492bd1d5614UL, 0x2e28e699f331e8c3UL }},
+  {{ 0x489879fbcf7c41b0UL, 0x6d16475dc706f342UL, 0x9839e07149835990UL, 0x1122a9690a412912UL }},
+  {{ 0x2f24884ae3436752UL, 0x2096d7acaf09a70dUL, 0x1657e1fa696c7811UL, 0x26afe0f1234bb099UL }},
+  {{ 0x507f6ac98ddd7667UL, 0xa82697cea029ff4dUL, 0xce42f280d61fb538UL, 0x1f4b54ccfb56ad6cUL }},
+  {{ 0xe423d56ba7d72afdUL, 0x8b6269245ef039fdUL, 0xc38b9aec47142a27UL, 0x2040701bc4a3c1caUL }},
+  {{ 0xc0138e7a8e9a24deUL, 0xa1f5156d46a9b040UL, 0x5dff9dfd36e2cd48UL, 0x09d2dacb90fc04e4UL }},
+  {{ 0x660b1c87742ad30bUL, 0x23eab6b6740ca2c3UL, 0x866644cfb53b23b5UL, 0x0351e1deaf30b30bUL }},
+  {{ 0xf05ba0000e366a64UL, 0xb6dc8f18dbf279eeUL, 0x4f1305b095afa15bUL, 0x294d5e858a68161eUL }},
+  {{ 0x35f1d8240d0143c3UL, 0x5c241f054b918cccUL, 0xc9d84985f6308b38UL, 0x14e4a31ad77fd602UL }},
+  {{ 0xc71142d158c6c6e2UL, 0xecb8200b3d4f8beeUL, 0x69a00c5cbaf52f34UL, 0x190f0cd86f5b6651UL }},
+  {{ 0x5a87957892f700e6UL, 0x5f8e6966b98842d3UL, 0x78b806d54e1aefecUL, 0x1032d84203854fceUL }},
+  {{ 0xd58b0ca8bbf46a81UL, 0x75dcf9057b0038e2UL, 0x17fd4b9cee77729eUL, 0x1bc12b1779b5d92cUL }},
+  {{ 0x620e441c24a46102UL, 0xe4089dfe0d75ca4bUL, 0x69fa12f35c35848cUL, 0x1dc2f02eb3f00fddUL }},
+  {{ 0xeaa207c1f439ca61UL, 0x055e743fcd071b75UL, 0x7fb587aae13b5205UL, 0x28e0515f170774f7UL }},
+  {{ 0xb524cad59fa43b01UL, 0xe74b6715b271be1aUL, 0x6a08ac5dc56bbb03UL, 0x2f280f407e3e61f8UL }},
+  {{ 0x34acbb50f82696dfUL, 0x48687a378fe9c077UL, 0x4319d50b6c984980UL, 0x0d61801d74384fe7UL }},
+  {{ 0x8e18e5ffcde46dd3UL, 0xbc96a2b39b51da7bUL, 0xd3af87f8d7651f95UL, 0x25d7867af1ca0f1fUL }},
+  {{ 0x682cbda40e60494dUL, 0xead90b14eb6a96a3UL, 0x4d9a0e09834c7c64UL, 0x1d7d7f1244d763f4UL }},
+  {{ 0x8d4dc591e3854f62UL, 0x928c5ef433ca73d3UL, 0x8dcc02a9a82935b7UL, 0x2a4a515a9816e2bcUL }},
+  {{ 0xe7e600d1af08a904UL, 0xc953871c623106f0UL, 0x0ca581feef199b12UL, 0x209cb133568a98a5UL }},
+  {{ 0x029d3e307a9e512aUL, 0xb722b88e112ab958UL, 0xbb1ee5c030e4684aUL, 0x2df6032fe6085be5UL }},
+  {{ 0xc67784f639f065a9UL, 0x3efd7f74ee67cd47UL, 0x2d5a66812adf7e1bUL, 0x168e78a07af0a99aUL }},
+  {{ 0x2ec0ad21b07b0eb6UL, 0xefb2c9ca0741aa6eUL, 0xab3fd1b7b37a507dUL, 0x13511ad1f5c05b95UL }},
+  {{ 0xbf1caa94bb5f7065UL, 0x1591868ae39ff451UL, 0x482a9daaf6f05831UL, 0x2f1dc348055f3d6bUL }},
+  {{ 0x06c1598bedcb52b2UL, 0x391893cf89223415UL, 0xea768f0a5ea4ae02UL, 0x20a4b01ef8629503UL }},
+  {{ 0xa3ceeeacaca805b3UL, 0x0d1be796ae34fba7UL, 0x24145817bb87d159UL, 0x268490af7d11c27cUL }},
+  {{ 0x9096ef58d8d6d67dUL, 0xed29fb1f20f8e90fUL, 0xcb917c7319d07751UL, 0x2e4e27c11c075169UL }},
+  {{ 0x4eaa09d8bd2df9fdUL, 0x1044f22ce45bb6a4UL, 0x974b03127f7698f8UL, 0x1cad037741785fe6UL }},
+  {{ 0xa3b0d032c81be0ffUL, 0x676db7340e5202fbUL, 0x8ef42cd326f0b6e1UL, 0x1eed5fd652b32720UL }},
+  {{ 0x1d2723ffd4c3ade5UL, 0x93b7ae872775872eUL, 0xc2e4e35fc2e7391dUL, 0x06935dcbfc41af8cUL }},
+  {{ 0xa318971b8c27589dUL, 0x51f263d9b2a5cdf9UL, 0x88ea2f81967d5e4bUL, 0x01d400ecde58368fUL }},
+  {{ 0x457b809a233c5bc2UL, 0x4488e833107323eeUL, 0x5b86e08ab05214b6UL, 0x0d06087c148b779bUL }},
+  {{ 0x24e56fcfce7bf13aUL, 0xc01a8efccacbf648UL, 0x5430ee496ffaa896UL, 0x14746d1fb6e76de8UL }},
+  {{ 0x9acac8f60d7e90abUL, 0x7ea68e23e948060cUL, 0x995f810ac6b8ee1aUL, 0x1849b9cacfb8be8cUL }},
+  {{ 0xa4317f8fa549ad09UL, 0x7ef24a8cfeea2500UL, 0x4b1fa077edecb244UL, 0x25502bbeec79d68eUL }},
+  {{ 0x4b76bbe46303bd66UL, 0x9a79dc6121759f91UL, 0xe32e4e4539202faeUL, 0x27ee7acc875543a1UL }},
+  {{ 0xe847723460aa02faUL, 0x64caa3a14ba0ac78UL, 0x42ada1e7a6791451UL, 0x071e6b6e16649bb7UL }},
+  {{ 0x871e0ae53fb0e2f3UL, 0xea5aec6c73aebc5eUL, 0xbab217c27cb4eb8cUL, 0x2ba6f19dc1f61887UL }},
+  {{ 0xa2abef3a477fdacaUL, 0x8523a1439d839eadUL, 0x28bd61b0e5aebe1eUL, 0x249042f8c4f8341dUL }},
+  {{ 0x6276b6f3e3417ed2UL, 0xb11898eab08cc14fUL, 0x85c1707965216324UL, 0x1e0e24cfe4432c86UL }},
+  {{ 0xd67d6061aceb6070UL, 0x5dff9ba2ecdb799aUL, 0xecad66d4c9564f25UL, 0x206e17acfc8c4aadUL }},
+  {{ 0xa3408a6902908a6cUL, 0xa3087229871ba5a9UL, 0x1837e09bd7732335UL, 0x21455fcc364782e6UL }},
+  {{ 0x937197281421c489UL, 0xaf06c5546d1713d9UL, 0xb0af67511047e58aUL, 0x0c4c20a14395026eUL }},
+  {{ 0xb1b1035976a0cf9eUL, 0x14a955acccf8b717UL, 0x0a1112604a0b9436UL, 0x000fe064a86e533aUL }},
+  {{ 0x6815186793da1adfUL, 0x8b64605a5ebbf30aUL, 0x7113ec41252424aeUL, 0x1004ced448564df8UL }},
+  {{ 0xbf6f9eb5b7cfeaceUL, 0x44530020a6d60895UL, 0x6bbb8977773a2777UL, 0x029c3b34f27f3180UL }},
+  {{ 0xd4c0b802b9c42224UL, 0x75bbfef0d9b438e3UL, 0x919353e51765b737UL, 0x16fceb8b1b960c1cUL }},
+  {{ 0xab349b668ea2ac7fUL, 0xc952360f896b6ba8UL, 0xfe80ca8c4f28c566UL, 0x1da672dac35c532dUL }},
+  {{ 0x43d2f89b33d8d517UL, 0xc1989861ca4830a3UL, 0x8394add41d337804UL, 0x189a178bbfd4de7aUL }},
+  {{ 0xae130b268ae68a1bUL, 0xff0bc08c999bd580UL, 0x9550e8b6a22df17bUL, 0x243d6a0348dbf631UL }},
+  {{ 0x0bd25871900effb8UL, 0xbff3b90e8b131399UL, 0x7b2a8678c0b90b10UL, 0x1b64c81d4bb3b551UL }},
+  {{ 0xd12baea02d931a93UL, 0xc4ef05912da15b5dUL, 0x16c9b8572c6b895dUL, 0x2f84ea171950af3cUL }},
+  {{ 0x59abc7830e4e4eaaUL, 0x24093dfcb84a0da7UL, 0x73db8f8ce965c2d6UL, 0x201c2a5e15ef3860UL }},
+  {{ 0xf2fc9b3821e61f3aUL, 0x6fa586a7ab128e9dUL, 0xee067d9b5e1696ebUL, 0x1b8ab28bf3fbf193UL }},
+  {{ 0xb4dd9ba381724180UL, 0xfbea9ca86aba5b33UL, 0x25574be5849d5564UL, 0x206bedfcffa42274UL }},
+  {{ 0x2f6469ddc18cf850UL, 0x8af1c1b0d28a2ce2UL, 0xe55be73c00bee144UL, 0x1709e0d9ae9522bcUL }},
+  {{ 0x4ee4bb4d5910befcUL, 0x08e43c1f7f7637dbUL, 0xa59a8aa41065b76fUL, 0x0267dd61da4fed5cUL }},
+  {{ 0x6797543c2ca85702UL, 0x8b230243774d6142UL, 0x43461e369c33297eUL, 0x1bb610dabfc36125UL }},
+  {{ 0x58d9a687b9a43f87UL, 0xfadaa510d508e321UL, 0x8418c52ab257a870UL, 0x1a4dffd14254cf84UL }},
+  {{ 0xee33bbf360c7d753UL, 0xcacc5095ccb6848aUL, 0x588778b725ab49d2UL, 0x009db3ed20e3dbd8UL }},
+  {{ 0x3bf15d64b4ce4f31UL, 0x3acde0c03cc6a6b7UL, 0xbff7ea19b7498d42UL, 0x17a92b0ff8ad99a9UL }},
+  {{ 0xb8c50edb3b75419aUL, 0x016c6b7cf4ad5d66UL, 0x97939e8128d9ebd3UL, 0x08f0c68038ea12c1UL }},
+  {{ 0xaaa99e41aaf2532bUL, 0x8634c3f3a9fc0fb0UL, 0x48d0170a0e4b770fUL, 0x0bf5f5cf8e1a581fUL }},
+  {{ 0x3fdb90e41462be42UL, 0xbefee2f1a0694a14UL, 0x5f32f345bcddb3ffUL, 0x23185e6da79c1e66UL }},
+  {{ 0xa797d5d8ff51f0bdUL, 0x5949daa5b7189541UL, 0xfea861c3527c250fUL, 0x0eea0992587cd1cdUL }},
+  {{ 0x48a0c3b37c59478fUL, 0xd7ff8d6fabe9f104UL, 0x96d72da19d98c445UL, 0x05ef8c29d197715dUL }},
+  {{ 0xb77214cf551fc58aUL, 0xaccd54ef1ce26fdaUL, 0x3c089b60e094b6feUL, 0x2b3b4a22e166dca2UL }},
+  {{ 0xa2c6d1725d0a6f76UL, 0x50701e332c1d2755UL, 0xebaaa6fbc920ca93UL, 0x0bf0e1784a7a1fafUL }},
+  {{ 0xf61a249dde699991UL, 0xbae25d32106ae97bUL, 0xf177d8d2021c9e90UL, 0x28e76c60758eddedUL }},
+  {{ 0xa173359783986580UL, 0xe7d844f1be150e80UL, 0x98e419fdd8608533UL, 0x0b8a8d77948fcb6dUL }},
+  {{ 0xc1f7a805ce581555UL, 0xf93a408f195486c3UL, 0xd0a6aad297a9cefaUL, 0x0a181d835c64d656UL }},
+  {{ 0x7d0050b6b0c4bcb2UL, 0xfb3111109ee5016eUL, 0x634f84126f911b72UL, 0x082023bf2876eb52UL }},
+  {{ 0x48e88e466148229dUL, 0x2d227d0610d92656UL, 0xf8d2cd4422a8e7e8UL, 0x185e1d7b7769670cUL }},
+  {{ 0xeee6a51faeaef412UL, 0xf5e7456bb3801859UL, 0xc765c10d33aa703fUL, 0x1d7dd4883c879479UL }},
+  {{ 0x8ec4e839eada8f63UL, 0xf37583d125fa17a3UL, 0x12dd90cd0f33b538UL, 0x24144efb6afe140dUL }},
+  {{ 0x6b5af43fbe48cf5bUL, 0x04c54f424ccb3952UL, 0x55f55a132b490914UL, 0x1350f721784f4a87UL }},
+  {{ 0x468e5892da4d6a54UL, 0x8621a2602ed4e47fUL, 0x3f7299524261e1b8UL, 0x2898c78789ce2e1bUL }},
+  {{ 0xe3284fa8c8aa7181UL, 0x6d37d5056b420453UL, 0x2b80a292c075b812UL, 0x0bb74e725cb4c34cUL }},
+  {{ 0xf28129a20e95cbd4UL, 0xc8f46ec61e79839dUL, 0x5b7e073746a5fe3fUL, 0x006f45a957dabcf7UL }},
+  {{ 0x83cfb32de88088e9UL, 0xa42a5a015459daf2UL, 0xc0e001c13d249136UL, 0x1a90837fb480d6d5UL }},
+  {{ 0x4a95173260e98483UL, 0x48f19cbb2aa127eaUL, 0xdd46e50683326a74UL, 0x00b329cb39855e4aUL }},
+  {{ 0xcd345cd87b7779c3UL, 0x9f2548fc444b8932UL, 0x809430f4e04f8ee0UL, 0x202fda9bd164eb09UL }},
+  {{ 0x05c182998a1d84f1UL, 0xa347aba558501a20UL, 0x832e462cc87ed274UL, 0x236286b032215db6UL }},
+  {{ 0xdf4ba4531f5a1667UL, 0x6aec23536518bdcaUL, 0x80da8aa903d39641UL, 0x1855b3db7fb5962cUL }},
+  {{ 0xcf386259c8b86b9cUL, 0xd76cf8d5d5e50852UL, 0xa7435f6d63ddc4c7UL, 0x00f80162680c0452UL }},
+  {{ 0xb48a9d0a42340d46UL, 0x494ddf9d9e5c0550UL, 0xebe0f436fc1dbc53UL, 0x1bd852533df8bfdbUL }},
+  {{ 0x884d157c5e6abc37UL, 0x4c69a3cc98b9d414UL, 0x11f6e35581bf9f22UL, 0x297646d2a40ef9edUL }},
+  {{ 0xb54ecc9fbe3d549bUL, 0x5f392c6f2a5e3963UL, 0x038afb3a78766a2fUL, 0x13f1fb753d79c64fUL }},
+  {{ 0x467e3ff7adc1ed07UL, 0xcd0dd63eb9099c51UL, 0x67e2a4cc09aa7899UL, 0x0ae52d9613ceab95UL }},
+  {{ 0xd9cd34c420afd045UL, 0x6a5da3253a95646cUL, 0x9337539291e92d60UL, 0x0d1dab8b86376df0UL }},
+  {{ 0x3ad309f7f273d8afUL, 0x1cbf3cf44b11d0acUL, 0x6fd4221575319077UL, 0x11e5d4b99f7b5e5cUL }},
+  {{ 0x7bdbd51f33856689UL, 0x76e17aaf1aebfe0aUL, 0xec818428d38978efUL, 0x1f653fd3e44b1d65UL }},
+  {{ 0x7dff9f15963a7e55UL, 0x5528235333b37e5dUL, 0xef98d79c69182330UL, 0x1ba7d865f16384e6UL }},
+  {{ 0x59c7d1f6b76f1936UL, 0x0e7e34969e10e9bdUL, 0x323a7f81ffc233b7UL, 0x2d161824541af0ddUL }},
+  {{ 0xa23abacf8ffadad0UL, 0xc492486e135023acUL, 0x158e870b8bd3dec8UL, 0x1642878b95ec55eeUL }},
+  {{ 0x4f86fd2a5684f29cUL, 0x687419fefeb203a0UL, 0x267a50fa8300db22UL, 0x03413c833e447638UL }},
+  {{ 0xd6e3ee3de1408737UL, 0xce87e2f3cc27d61aUL, 0x75f92ed9025668afUL, 0x29e3d53334cc164fUL }},
+  {{ 0x3aed32b037388f71UL, 0x24133e3e361d4462UL, 0x20607fa8c500704eUL, 0x0cbff98545729acbUL }},
+  {{ 0x6fdb846efb266703UL, 0x68cd9123f9a1746cUL, 0x16b279f50757d55fUL, 0x0e0d63956cd77f53UL }},
+  {{ 0x0971ce998f4527abUL, 0xe8a3a407a1ccca5fUL, 0x3a536b0b3c263c5cUL, 0x19de151bc67c10d3UL }},
+  {{ 0xaf6387a79e68f40eUL, 0x1a404b8506b0f55eUL, 0x322de7b61b0f3593UL, 0x0010ff24ad117b17UL }},
+  {{ 0x2f7c48013f4c35b0UL, 0x41527cf10c359da6UL, 0xc4f61218952f82d8UL, 0x0e27e61253817871UL }},
+  {{ 0x921b8a16894ce832UL, 0x47084768fde0e08dUL, 0x7b34e72003d75f56UL, 0x2acc6ef75df7c2ecUL }},
+  {{ 0xbb13cbd98e48ad9dUL, 0xc5ce7fc0a8698132UL, 0xeea2d46820256cffUL, 0x1150bbd7a1a41f12UL }},
+  {{ 0xdc845670252d6f3cUL, 0x02a852ca8fecacfaUL, 0x271e163bf266c640UL, 0x1a513ab2aa372addUL }},
+  {{ 0x75c829f4a27894f2UL, 0x4fe3c2cbcafc88b7UL, 0x09cea5a661ca9a15UL, 0x07a34f06717e78f3UL }},
+  {{ 0xb50afce6f0747672UL, 0x45c85c8b9ef142e9UL, 0xf60cfc11367b4cecUL, 0x1c2ac54417b39e79UL }},
+  {{ 0x97d116f8248c6fafUL, 0x67d98378fbf8b442UL, 0xe5d9cc62c735a5edUL, 0x0e20d26d6763203eUL }},
+  {{ 0x72cbb90566074b16UL, 0x3ecedaee181b92d3UL, 0xc8793d15b2667b56UL, 0x21f23a7a97727b44UL }},
+  {{ 0x92183a05bccb74a2UL, 0x010f6d4e29eec792UL, 0x31a055309ec8c28aUL, 0x16112b470707934cUL }},
+  {{ 0xfbc997f45050ade5UL, 0x1a5da5fec0edd459UL, 0x537227fd13cde92bUL, 0x301ec0e30cd28923UL }},
+  {{ 0x044d4f5c63aee235UL, 0xe9d02b5825695e7dUL, 0x36f21e05065ab39dUL, 0x24b168ad09f1f37aUL }},
+  {{ 0xa07f77d6e6d279fcUL, 0x076050e63124a050UL, 0x4d0f3b4ac145bf95UL, 0x01864cec07aeb353UL }},
+  {{ 0xe17537b6e1f7f623UL, 0x72124586f7453c1aUL, 0x30ae2ce20bdac93fUL, 0x1082c5d53d9a7b96UL }},
+  {{ 0xb6da9eee33c488ceUL, 0xd2b7c9a96fc6973cUL, 0x440ff8603716db32UL, 0x1883d1c123fbb68fUL }},
+  {{ 0xf450641145df31c4UL, 0xae185cc4df6c8d9bUL, 0xdab16d4343d2fcffUL, 0x0bb9d2b2d64c6531UL }},
+  {{ 0x50c4cba6ffe4dd15UL, 0xb28ac17a3ae787f0UL, 0x24c660b2b667b710UL, 0x0b31156036e86061UL }},
+  {{ 0x7716499bdeae1dc9UL, 0x2850b9b0e5538485UL, 0x4eae69ce3930311cUL, 0x0e2523b6badf6a1bUL }},
+  {{ 0x8fdfacb13196b30bUL, 0xcea708ff8fc6fa0eUL, 0xda627bd3758ece1eUL, 0x259c46ea0fbfb809UL }},
+  {{ 0x35a016253942bd1cUL, 0x0d5faad9ea04ded2UL, 0x144d8a75cc61ebdfUL, 0x0bcf167a61047187UL }},
+  {{ 0x0de6d0a21fdce0e6UL, 0x44629845e8c3f19aUL, 0x1451c62d88b73630UL, 0x19e3b6b93095cacbUL }},
+  {{ 0x445b301f3df6b8baUL, 0xbc4877fdba3dec41UL, 0x580b9cf44f37ec8bUL, 0x0513a93d2684abebUL }},
+  {{ 0x2ddba5082e525841UL, 0x098a3ead2fe1fed8UL, 0x91679c8290544723UL, 0x1059c5f7857a456eUL }},
+  {{ 0xfd6cedad6cb97b8eUL, 0x06bfb266f3d779f3UL, 0xcae7666cd86b85faUL, 0x05d9f6d81fbd078eUL }},
+  {{ 0xb121a6866ef4f71dUL, 0xf7d2774bdef81425UL, 0xead5a65783586570UL, 0x18d7f76c7db057d8UL }},
+  {{ 0xa8acb1935521703dUL, 0xb0b882e2dbe7da92UL, 0x8dc43c9647d75b11UL, 0x1d432cba603097b4UL }},
+  {{ 0xfac696b156820be9UL, 0xc609f72f82739023UL, 0x26dc0fd147116e38UL, 0x268daa0dd1f7dc39UL }},
+  {{ 0x4980fb0915e171ebUL, 0xfc838aad7e0c6effUL, 0x0d570ea0c3bb6a7dUL, 0x1f9604aff590b195UL }},
+  {{ 0xed77fe9b92f682fbUL, 0xa00075091e62108aUL, 0x3c409cdd7e972675UL, 0x02bd6a9f77640635UL }},
+  {{ 0x4416e1b72251d7b2UL, 0x3bc23387cd8727a0UL, 0x841f504ec25d3a12UL, 0x06ae4a28e4ac4914UL }},
+  {{ 0x74372b8772ea7979UL, 0xaee03cfe76b05c3aUL, 0x4d687922835dcb33UL, 0x2497d8b04d6f9ad2UL }},
+  {{ 0x6a29a63c36048340UL, 0x120067c4644cb3dbUL, 0xa6adbdf024ae3a93UL, 0x1795ab852edebc2eUL }},
+  {{ 0xa18caf0800e6e20dUL, 0x53e1d0da98080745UL, 0xc19ae2beda5bd9dcUL, 0x2d39517e40084067UL }},
+  {{ 0xcc7b393bb64946c1UL, 0x4f434c833d4dfabaUL, 0xd335982f0d2cbb2bUL, 0x1be5fb00f3cf36c2UL }},
+  {{ 0xc3e56c8014576760UL, 0xf082b8487d13684dUL, 0x8a103efe151e4c48UL, 0x276dd76f476256a5UL }},
+  {{ 0x63c98628920eb269UL, 0x21cf765cac318a08UL, 0x26b30254d0f0860eUL, 0x120ef83747ad2959UL }},
+  {{ 0x68535f059463fcf6UL, 0xb2a6063bd5a7565cUL, 0x4476c9cb88e72499UL, 0x09d885df357c28cbUL }},
+  {{ 0x4a35cfb2342af01bUL, 0xf65e6827cdddb8d6UL, 0xf8f225e3c538ef11UL, 0x00f3863ecedb86ccUL }},
+  {{ 0x8eca74a89857353aUL, 0xd117bceb7876b6e5UL, 0x5500322940f9c168UL, 0x1618e3eea48185efUL }},
+  {{ 0xb28901d2a7345e02UL, 0x60671efea1d64438UL, 0x2a9d0ae7190e25dcUL, 0x00e5269541e8c9deUL }},
+  {{ 0x3439ba89fe42e7fcUL, 0xc3aa75cc511ea3f3UL, 0x23bf62d7fe7ebc37UL, 0x01900eb85df8d779UL }},
+  {{ 0xede5d9020a686215UL, 0xeb0aeccd4ed90fd0UL, 0x20d9ab950aae7e38UL, 0x1c5b7fe38fd7c999UL }},
+  {{ 0x2726a7f93426ae3fUL, 0xda64bec7b15968dfUL, 0x8683693ebcd7eb4fUL, 0x22d817a8d81c10efUL }},
+  {{ 0xf1498b46bf4bf3c9UL, 0xcc728e3b23eba0fbUL, 0xf753a9f0217ebf8dUL, 0x26b89f554c7034ddUL }},
+  {{ 0x088ca0964449128bUL, 0x8dc4b8099a5355b2UL, 0x2d7cbd72c4f90203UL, 0x18787d67fbfc2918UL }},
+  {{ 0x6b0a1e2954f6faa3UL, 0x46da08df10c82fbaUL, 0x079670747cbca9a9UL, 0x07b620facf4aa462UL }},
+  {{ 0xdfca06e641f59a0aUL, 0xf508b3bc5190aac5UL, 0x8b80fb881b594951UL, 0x02f8d55add8943e7UL }},
+  {{ 0x0e89100c3094b63fUL, 0x9b5e6d429b91203fUL, 0xd748d6be174c7dbbUL, 0x2daf6a20c8e4087eUL }},
+  {{ 0x9063aa6639688508UL, 0xa5f8b196dbc2a78bUL, 0xece496e212a0618dUL, 0x2e6a1de462b9cd1aUL }},
+  {{ 0xbf79d2fe202a45afUL, 0x81326d76a08dbd6dUL, 0x6668431928e4606fUL, 0x28dd5bd454690f1eUL }},
+  {{ 0xccbbd0c3cf81728eUL, 0xee1d6e380711233eUL, 0x76237d4272d65e28UL, 0x2952f2ad1a1269adUL }},
+  {{ 0x5b2fd5d877d748d9UL, 0x0d7a9cfd1f4ed953UL, 0x2b7483286911d29aUL, 0x0d622f9625c92ea2UL }},
+  {{ 0xc83823640a041be3UL, 0x18770cd1b93af460UL, 0x5300f2bec5a8a69fUL, 0x002fa24b7e72f2e0UL }},
+  {{ 0x154ac7a7274ae787UL, 0xa1882af71a1e2a24UL, 0x90ec72f98c09026fUL, 0x16033918f5a28030UL }},
+  {{ 0x3a67303b0252d3a3UL, 0xe252ec47737fe11bUL, 0x9b75c65675853f0dUL, 0x0e7d3b934cd211bcUL }},
+  {{ 0xae6e10522308fe1fUL, 0x5a7f60bda6983e99UL, 0x11faf0c38c147d07UL, 0x293a2ba079b3d830UL }},
+  {{ 0x907f0ab1637ef860UL, 0xfa0fafe352f2600fUL, 0xea3dab2172768954UL, 0x0a602cb76694f6d2UL }},
+  {{ 0xff838d53c1fa4749UL, 0xee80957f0173eab1UL, 0x93a0a6f48f89f3f3UL, 0x0eefcea42f133a91UL }},
+  {{ 0xcc97334e1c6363d9UL, 0x0e042dc9f9aa8d30UL, 0x0e7dcbe74eba5191UL, 0x13363e49bccb622bUL }},
+  {{ 0xce319c4238a8ddebUL, 0xc610fbd8bf5b817aUL, 0x01985aaade2eeeecUL, 0x25a306f6688dd862UL }},
+  {{ 0xe686dd7bc22bbc38UL, 0x024d66ff9b0651d0UL, 0xca47d31fb5b19435UL, 0x22664aad27dd201dUL }},
+  {{ 0x91e55860e920b931UL, 0x91d7f4805cbd9803UL, 0xeb07ee54239aa034UL, 0x0ce012e26a9f5194UL }},
+  {{ 0x133db0eafb456688UL, 0x8aa930e65d1670acUL, 0xb1bc22009430b7ecUL, 0x2c961b5288592488UL }},
+  {{ 0xb72479ec78579cc0UL, 0x9bb20491efcc13f7UL, 0x354d56f743a7d614UL, 0x16809f984df91ec9UL }},
+  {{ 0xf2ae2064dc6995c5UL, 0xe18088ed67d841b0UL, 0xb8a8c3b01e2ade79UL, 0x1b1c07719364f575UL }},
+  {{ 0x26e7ee9591ed5b36UL, 0xe5117c7af244a417UL, 0x90b6665c36f9f10dUL, 0x1370734fbd31e500UL }},
+  {{ 0x9705d7feba9b8badUL, 0xd6b558e21fb54a9cUL, 0xb5f91d6283e2aef2UL, 0x0e79dd789c3cc989UL }},
+  {{ 0xb9f7b94e1ed55906UL, 0x21d737fd882aa324UL, 0x75268250299b40afUL, 0x06d1d186f9281598UL }},
+  {{ 0x21e02748200978f9UL, 0x3c8bb43ce10f9da5UL, 0x7f4a51123b3084a2UL, 0x11aa4ca41c6b158aUL }},
+  {{ 0x7e02c749b1716868UL, 0x19a0645efb5edc47UL, 0xac2a6423f3cf2913UL, 0x2f91597497de3487UL }},
+  {{ 0x9d5b3dc4c882c982UL, 0x43ecdf19eebfdc8cUL, 0x4e93860791158977UL, 0x218ee0896b2563fcUL }},
+  {{ 0x3051bad5c532d02dUL, 0x54d5298f193cb36aUL, 0x1feb72cf42f45150UL, 0x0d3697f2cd3e901bUL }},
+  {{ 0x22ef5a8f80d4f424UL, 0xe58a9f566f3d3764UL, 0x68cf916c58c83d52UL, 0x0dad0d086f884298UL }},
+  {{ 0x2f538f892ffa65efUL, 0x848cd351d1da734eUL, 0xeeec872cd87784a1UL, 0x25147f0b2c71a48eUL }},
+  {{ 0x1a81867e25d5976aUL, 0x9e838af875246d8aUL, 0xad3d215c342328b6UL, 0x298e607dae8aa0e5UL }},
+  {{ 0x276e8a69dd846fc4UL, 0x750a335d73092a8aUL, 0x26b704dabd30f8dcUL, 0x004e0eb032257334UL }},
+  {{ 0x93261d7ab3c159c1UL, 0xf31ba7b10a7ba761UL, 0xd9b16c2f354e1b52UL, 0x21541f25153e8521UL }},
+  {{ 0xbd02faba2f5b3e53UL, 0x10efa519224c8ff5UL, 0x52b0269135ff5884UL, 0x02e7ab591e2046abUL }},
+  {{ 0xce2951b9029cec9dUL, 0x5647a9b0f63ca1f3UL, 0xd818ed6f55f051e2UL, 0x2c8eacee071e0ce4UL }},
+  {{ 0x135d100ab806dd60UL, 0x9d1cca75ebb6a046UL, 0xf7a1d3beff59169cUL, 0x2672ce6b08bc83f3UL }},
+  {{ 0x08f7a340ace8e21fUL, 0x2351f0cdaad9ce1aUL, 0xfd1ec25f4329a2c1UL, 0x0b324f1f049af728UL }},
+  {{ 0x0ccc88b3bec5dc03UL, 0x5b2355591fe45c42UL, 0x46db9f3240adcf65UL, 0x0990469b7ce1d3c8UL }},
+  {{ 0x7056e7c12136f8f2UL, 0x4e9e0bc9bf650c17UL, 0x5db9bf8da53e6a45UL, 0x00c1370e5fbf7803UL }},
+  {{ 0x0e36120dfdeafea7UL, 0x319ce61311db74e8UL, 0x2f33f6277d693e4cUL, 0x0f774dc6b7e0d295UL }},
+  {{ 0xf245eb594ad48b58UL, 0x90deac3f3629d0c2UL, 0x0b9a0e4854dac387UL, 0x17961542ae2bac8bUL }},
+  {{ 0xdf242aa1ecf38125UL, 0x53a18f693b5b0254UL, 0xb5830995a96098c8UL, 0x095eb4cad7df9002UL }},
+  {{ 0xd916f16d510d3828UL, 0xdcc26591403ea461UL, 0x20b818b578d98278UL, 0x27352e264cc92856UL }},
+  {{ 0xf67539a55b41f08eUL, 0x3804555ad3e7b0a0UL, 0x21326e2fbb183cf4UL, 0x19390c5cfdf995f1UL }},
+  {{ 0x229059030df3899eUL, 0x9c74341b357f7a4fUL, 0xe4a32d79955771b7UL, 0x2668f9a07def7780UL }},
+  {{ 0xf394a7e170afdcf3UL, 0xdf25deaf4f9cb733UL, 0x728fcd011a37c586UL, 0x1d55345d81152f26UL }},
+  {{ 0x3beff9d637bb708dUL, 0x8f8af4401deacf15UL, 0x3f97bd03122641f0UL, 0x038d786599441d00UL }},
+  {{ 0x47bdf3a3855ba5a7UL, 0x19a262daff59bcd4UL, 0x77eeb4db1cbb0f5eUL, 0x0d3738e3d0960a4aUL }},
+  {{ 0x4abf27cd9aa63b1eUL, 0xcbe18552231ddcdeUL, 0x1fe0092644d520d8UL, 0x260060b2fe7701f6UL }},
+  {{ 0x63e0905a89b4453fUL, 0x09f67fdbd4a29f1bUL, 0x6cec48f4e4aa0dd9UL, 0x1af90cd969e74685UL }},
+  {{ 0xb6a25e8282dd6a93UL, 0x2247fae67d037985UL, 0x9d8086da4ac08922UL, 0x10c070b6fcc69c37UL }},
+  {{ 0xcc721ac7a03a2264UL, 0xbfb806442705d2b9UL, 0xaaed1e47423be8c7UL, 0x02b4db5ec2a8c6cbUL }},
+  {{ 0xd6397e24561666b4UL, 0xf1a1f6f4446233c8UL, 0x51a4a5387bcf5addUL, 0x1d086927ba7bea85UL }},
+  {{ 0xb98dd7f38bcbf132UL, 0x6ac11b19dab0a713UL, 0xd358965a43443756UL, 0x16d640fed940d44fUL }},
+  {{ 0x6b5bea614fadffc8UL, 0x3246f54baf3006d7UL, 0x23615201a66a027fUL, 0x01ce02888d4ffc43UL }},
+  {{ 0xd3265facb9e59392UL, 0x38add8269d65906bUL, 0x8da734187ad95066UL, 0x1a2dabe6e8df9315UL }},
+  {{ 0x3c8c9424ca17d77cUL, 0x3c776fb7f795fc4aUL, 0x2d57080c097e272dUL, 0x0a26c886e540f333UL }},
+  {{ 0xd1f8588fefa7e632UL, 0x1658111561198c20UL, 0x9780ddb0a96f72b8UL, 0x13af536a874cebcaUL }},
+  {{ 0x17aee599b975a214UL, 0x1971c1628766c216UL, 0xafd2e4372202ae59UL, 0x1dbe7562a0374b52UL }},
+  {{ 0xbadc8602526aca99UL, 0x7476995a90d31a5cUL, 0xcf7c03bae966d21fUL, 0x248e7fe761591121UL }},
+  {{ 0x4081088b8035a28dUL, 0xfdfcae29c5fcf1d4UL, 0x4c93719977952c04UL, 0x077c74e96c91d95cUL }},
+  {{ 0x66e6d4e2a1fd4230UL, 0xb79403455e3c26e6UL, 0x29f9668eee9d7099UL, 0x23e2712f43002721UL }},
+  {{ 0x8ee08e9b1f783296UL, 0x1299020b56139fb2UL, 0x0075ed506222e54cUL, 0x135c359c17b13738UL }},
+  {{ 0xea0849e3afa55c1eUL, 0x667deae83304ee7bUL, 0xd0dbe5a159b18b49UL, 0x0f7a7584974f78c5UL }},
+  {{ 0x1c2d9b11c23c3542UL, 0xb8658d570908b1a6UL, 0xaf1863ff409e7430UL, 0x12623f4d7e41011dUL }},
+  {{ 0xf753353e19c3914bUL, 0x1b727a8026c5c03dUL, 0xb27a82112eb21274UL, 0x1bd69dfeb11061c0UL }},
+  {{ 0xb61559b546f940c6UL, 0x3f0c80b5a4436e8dUL, 0xb24c8a8fac42a557UL, 0x07913738bfeb3bcaUL }},
+  {{ 0xf22bcd3c282f0604UL, 0x65e4912484d43b55UL, 0x5bea6131a9c7f1e3UL, 0x054c523998c9452eUL }},
+  {{ 0x353d56e8abd981d4UL, 0xd2f0dbe92cb151a8UL, 0xdef881f03ca1f275UL, 0x0715f68966b76057UL }},
+  {{ 0xdcc0892329b868ddUL, 0xfa1046781c52bcf6UL, 0x1dd1fd775bcd09a1UL, 0x0dba0cc71f550e88UL }},
+  {{ 0x7018b5e18acaac32UL, 0xf6d6ad83bce8c552UL, 0xc2470be9902d9b27UL, 0x0b3e4e832b8a8512UL }},
+  {{ 0x40eb0fa3bf576a85UL, 0x6864da8355e1cafdUL, 0x871c6cba20852266UL, 0x1575b128c9a3adeeUL }},
+  {{ 0xa1365a3fdd191cd6UL, 0xdc565c9c03ecf89eUL, 0x607bae7d7e2fcf43UL, 0x1e485827bae288b4UL }},
+  {{ 0xa689a2371dacfc8aUL, 0xecf5be59fab1c6a6UL, 0x85b6b19ed936fdd7UL, 0x1e39fd17df6c8aa0UL }},
+  {{ 0xd4cc4f4e7c5259feUL, 0xc64e61ad8bd4e299UL, 0x7dcc0b07c7754282UL, 0x16cb2831b04c1a27UL }},
+  {{ 0x53c2aca89f7153d2UL, 0x641c817f2ef15546UL, 0xa9c8d21f1bcb7db9UL, 0x2197d2d8abf2bbb4UL }},
+  {{ 0x17d54245944b2d1cUL, 0x8c90102398546a5bUL, 0x8f2fff0f1368c87aUL, 0x2d17e564b549dc64UL }},
+  {{ 0x3dd289c8c5281e4fUL, 0x813d18cb170e828bUL, 0x9232cf8fbb58e50eUL, 0x1d3a6a23a8281cccUL }},
+  {{ 0x30eeb33ea79aa1b1UL, 0xfae2e564f3f7c325UL, 0xb6054f16bc762132UL, 0x13d75c3188a70e6cUL }},
+  {{ 0x2fc56a3272998985UL, 0x25856a0577760db4UL, 0x50a57052764ca670UL, 0x26bd75d42ed1ed32UL }},
+  {{ 0xf2468bb825a1af32UL, 0xe03b8e1007d1ddc4UL, 0x2f2beaab02ed7b57UL, 0x03838044527235a4UL }},
+  {{ 0x04ecb453a03f073cUL, 0xc1744fed5c3877ffUL, 0xc6ce964bae97f2deUL, 0x16740b086ca73470UL }},
+  {{ 0xdb7a9ece8f6e88b8UL, 0xfe1923362639a41cUL, 0xe8ae36db73ca2200UL, 0x163c15e73a5bb464UL }},
+  {{ 0x330643db69ad6ccbUL, 0x2e3144744a43036dUL, 0x7014cb10ccca6f96UL, 0x2ec6275abcfd42bfUL }},
+  {{ 0x3ea01ae125546a1dUL, 0x875a817355048ae1UL, 0x514ee09c0f888e12UL, 0x1e72a8e968801702UL }},
+  {{ 0x9a6b153e12613738UL, 0x960db7f8962d89f1UL, 0xd91a32d8844b723fUL, 0x1b3acac330487098UL }},
+  {{ 0x54d170dcf3cac9dfUL, 0x8e784b15584e027dUL, 0x099bf3e15ff2da1dUL, 0x00cde348227ab301UL }},
+  {{ 0x7d0174edf132440eUL, 0x3d059d9a6f006324UL, 0x297e42115a2e34d2UL, 0x1759f8d0edd215baUL }},
+  {{ 0x7cb3dedb145c64faUL, 0x23c5d4ca60fcc4e5UL, 0x0c62901600f81973UL, 0x24e1bc60b2cb69fbUL }},
+  {{ 0xefdcee6f407a0167UL, 0x96adfec11cda85daUL, 0x5380ac938780be44UL, 0x1785eef66cd68e8aUL }},
+  {{ 0xe6d0fadb9f8e44a2UL, 0x218987b213ab513cUL, 0x18766f6b63330f60UL, 0x272f076e63f83135UL }},
+  {{ 0x3ec58c76b4077be7UL, 0x77dc11453378c384UL, 0x3140538b397768d3UL, 0x06185355864a3833UL }},
+  {{ 0x9aefa4ad4d73e99bUL, 0x97fd1297bb09f940UL, 0x24ffee956f0fb336UL, 0x2ec064bcd0dfd71cUL }},
+  {{ 0x51d4abf4c4d15fb9UL, 0x26767bac3510601eUL, 0x512229b5defd9110UL, 0x2703c6fecaaaacaeUL }},
+  {{ 0xa44a160633ce3a0cUL, 0x0b1128afad7c82eeUL, 0xddc7164a92c0f4a8UL, 0x253e89355a91244eUL }},
+  {{ 0xba21813793967d36UL, 0xd6e21fe6b316f39aUL, 0xa013a8a82c2313a8UL, 0x229afb8479524d27UL }},
+  {{ 0x97212e650e168469UL, 0xc73ae18d53208f89UL, 0xecef48f17ebc9d99UL, 0x03d4732fd850a110UL }},
+  {{ 0xc4501aeb714299d8UL, 0xc4bff2291cb9a73eUL, 0x414ba7d7a24f3387UL, 0x11c63c47591dcc82UL }},
+  {{ 0x2b343208dceea06fUL, 0x11541fe30aaaeaf7UL, 0x6d3121821037f9c5UL, 0x29d3608bb1ed2675UL }},
+  {{ 0xbf5e71b374f7fe8bUL, 0x5451869799c4b259UL, 0x19aca5e9054d8348UL, 0x2e994ebb5c1ed4c9UL }},
+  {{ 0x01e5298622754c65UL, 0x4e97562dac744ccfUL, 0x5003b1b55487905fUL, 0x14f46060a6353136UL }},
+  {{ 0x616561ced075fb85UL, 0xf3461a256c3d6cebUL, 0x7747060b244ad7feUL, 0x2822753df458d4fdUL }},
+  {{ 0xd7efc39ddae66894UL, 0x622e72bbd6f57cb6UL, 0x8d8277ff17aaa5eeUL, 0x191005ea96df0ce4UL }},
+  {{ 0x8f6431c8401b8ad5UL, 0x2208bea1ac7dbc62UL, 0x09e837ebb0aa2d11UL, 0x13db76856eaea19fUL }},
+  {{ 0x482f16b8386c3721UL, 0x92bc713ff79c0217UL, 0xb01681111e0554f4UL, 0x11c2ca4488b7c605UL }},
+  {{ 0xc00ef6bcbeed3975UL, 0x4a52838d8ebc90a2UL, 0x7c4bb0848e8d8319UL, 0x0190e08e14645f5fUL }},
+  {{ 0x05c8d66aadcd74a9UL, 0xaf4c773ab8b7d925UL, 0x6a19139c1f53571dUL, 0x0e769c6cbe87cf19UL }},
+  {{ 0x7703c58d763d878dUL, 0xc14def1581fe1b97UL, 0xf0754e506fc62d40UL, 0x11d3157d86de29eaUL }},
+  {{ 0x4ec9b2f5d1f2622dUL, 0x7079a1886e7a8e1fUL, 0xfe93917a2214dcbcUL, 0x2174054f1451c736UL }},
+  {{ 0x7944a99188939b39UL, 0x95b39099e3d16472UL, 0xebcd18fcc74aeecdUL, 0x2397d4ddf6aa0b20UL }},
+  {{ 0x35b485733ca6de00UL, 0xaa5a0bde05cb1355UL, 0xf9e6152b24cadb24UL, 0x18325f072cd9184cUL }},
+  {{ 0xa66ad566c79ed12dUL, 0x14d76d94067380d8UL, 0xf05dd5fa3e76d395UL, 0x24de4e33aab530b4UL }},
+  {{ 0x89a51c8d0d14f797UL, 0xcdd2895eb2ff74e5UL, 0x5068100ca9b644abUL, 0x2a1a9b7c36d779c0UL }},
+  {{ 0x781df10b2776f06aUL, 0xa7f4b66ae29278b3UL, 0x45f0832fa5e141b2UL, 0x1a302943bdfd1f21UL }},
+  {{ 0x0c2c38ecd31e42b4UL, 0x298f687099348559UL, 0xcc0900981f78f0b1UL, 0x0746e3d5af98e899UL }},
+  {{ 0x1d4e45de4861cb65UL, 0x6d99d3d42f3c110eUL, 0x3d2b64fc23a82912UL, 0x2721c50ca628c1f8UL }},
+  {{ 0x23ec9230c68c138fUL, 0x8bcb5be42c92f34bUL, 0x8fcdd4d6a73fed51UL, 0x1fdc36470ee545b7UL }},
+  {{ 0xd12c2d96f3e4cb70UL, 0xe3790ba0cd1a9277UL, 0x0c9b31ae7667eed0UL, 0x2b0a3b8514832b29UL }},
+  {{ 0x5c8e9cf3d8e7b4eaUL, 0x520efa3efbd3948dUL, 0x86eb21ef0dd4dbbbUL, 0x0ab89cdaa47505a3UL }},
+  {{ 0xc6690209dfad5027UL, 0x8ab46d129e1b19adUL, 0x085d7c6dcdf8a8b3UL, 0x1bfa0d8c0f659f46UL }},
+  {{ 0x1a7f6c4b0688acd2UL, 0x07e05d213dcd284bUL, 0xea25f90003acd10eUL, 0x00e304d08128f13bUL }},
+  {{ 0x0a343721dba07365UL, 0x5683173497fa9831UL, 0x2f15fbedc6a25b0dUL, 0x14af447891b16e3eUL }},
+  {{ 0x21d8f93aac96ba7bUL, 0x8a994598258bfe41UL, 0xe504f249563bc5a2UL, 0x1d7a4f9d6429e554UL }},
+  {{ 0x08f99d841854d8f0UL, 0xb31133e2c0790763UL, 0x46ecb36d669ce9deUL, 0x09c4983c9ca279d8UL }},
+  {{ 0x445cc0125f1141edUL, 0x23cf597172aaf8e1UL, 0x269bb3bc949aada6UL, 0x0dc2ac644099bc8dUL }},
+  {{ 0x6d1f0e31298415deUL, 0x82027f555a02bf8eUL, 0x5a4b94b2c7c63f92UL, 0x1b7f0e4c9125e12aUL }},
+  {{ 0x7c64a78d7a225173UL, 0x6a00ccd15fe219daUL, 0xa6f0efe0c86bd7e3UL, 0x29cff5efc0af0652UL }},
+  {{ 0x4e980fe12fd0c74dUL, 0xf98e73f0d020c8f7UL, 0x8e49f1058ed76d9cUL, 0x27a28269fe0b62dbUL }},
+  {{ 0x00c84c3b9536eeb3UL, 0x6380dc26c7c45ebcUL, 0xd5c10d6a5e29694aUL, 0x1778196dc49b8273UL }},
+  {{ 0xd33ad409580b6f38UL, 0xc29b64a7caf776e0UL, 0x8b73ec7dd1dce041UL, 0x07a1efb120d0568bUL }},
+  {{ 0x611077e9d6eb9654UL, 0x74579a9a9f4a95fdUL, 0x45326a84bcf84c9eUL, 0x0bc31fbe3c7087d7UL }},
+  {{ 0x1215938a5505e7e9UL, 0x0d7ac60c9facf97aUL, 0xe8f3a2d259a198aaUL, 0x0c6721b6a3e3def9UL }},
+  {{ 0x5f120b566ccec741UL, 0x2ebf55a51db0411dUL, 0x09e15cd3c5d79b59UL, 0x2cf61619df5d9179UL }},
+  {{ 0xc2d31dc42bb5f5c2UL, 0x2d2667a92327e55fUL, 0x14ec4068b956f40fUL, 0x190316dc4edcbfdfUL }},
+  {{ 0xfadc0817af84b687UL, 0xe66c74ba5b84c857UL, 0x286b98a90fc504e7UL, 0x1170c9015fd9faa5UL }},
+  {{ 0xfb953245daa0488fUL, 0xc1d59fffab3cca1bUL, 0x1f1a4a8347fb52e5UL, 0x0547ba283d6c5777UL }},
+  {{ 0x6137e3416ca6d0caUL, 0x3c2edd47e4f79db9UL, 0xfcec1253df0bd573UL, 0x2d3be9c362f27d76UL }},
+  {{ 0xf65b37cb8b374e1bUL, 0xd34d75349912a2d8UL, 0x3696c732b56fc3bbUL, 0x152b1eeb5bbc1c8cUL }},
+  {{ 0x4433b2f8ec080e39UL, 0x38fd1b4adce1ff2fUL, 0x057d3514b5153ea6UL, 0x0f208f097bd1cfe8UL }},
+  {{ 0xc85580ca6639062fUL, 0xc9987fb020cbe27bUL, 0xd26fdb6b13847870UL, 0x1c6592e69f9d325bUL }},
+  {{ 0xc71a668a2967b328UL, 0x4ebcb42929182578UL, 0x1b7543bfdf381c2bUL, 0x02027f2ec3d7d320UL }},
+  {{ 0x0f2ce266a321f525UL, 0xb4ea6561ed838564UL, 0x000142b5adc16a23UL, 0x04f7c0c326ef8ce2UL }},
+  {{ 0x78ad30ad72fdd73dUL, 0x8f2ea1b9d814240dUL, 0x1475fe311cfc3df5UL, 0x074f2755ae1e798dUL }},
+  {{ 0x95184bc7dc7d709bUL, 0x0c70a818ebce5c58UL, 0x7cb7f587a924982cUL, 0x1271286bd3d915bbUL }},
+  {{ 0xaff5c2215213a451UL, 0x9740eea7464e69b1UL, 0x2813bfed6f5531f9UL, 0x09dcaef397fdfb9fUL }},
+  {{ 0xeb744f07fafb56daUL, 0xe0e32fa8a5fca4e7UL, 0xe3cbe9433828c038UL, 0x230765f49481bb4eUL }},
+  {{ 0x8883f5de0d6fc41aUL, 0x780fc0d9df1ba4f9UL, 0x179671520c2b8a7cUL, 0x245b9c432fe3f954UL }},
+  {{ 0xbfa93ea47378b345UL, 0x08dd41415e464f29UL, 0xd1bbdfdc2136cb11UL, 0x03a922565980ae5fUL }},
+  {{ 0xc92a8a5a3bfb51b8UL, 0x9341aebfc8a54443UL, 0xc89ce34455fbffb4UL, 0x178f80a87c6ea560UL }},
+  {{ 0x2c3916e9ee53c288UL, 0x23fa02411d70923eUL, 0xa4200dfb314f8ad8UL, 0x2e5d159713027542UL }},
+  {{ 0x3c2aaabe838f00f7UL, 0x52631de86852f8c2UL, 0x16b25df6bd77ed11UL, 0x1cbc5a67fa4e114aUL }},
+  {{ 0x6c86e7821df6477fUL, 0xa69b5fa64b6a6c82UL, 0x4849d25535967227UL, 0x1002b73e291692aaUL }},
+  {{ 0xc3024acc61da33f7UL, 0x7d055e2a876eb454UL, 0x2a2e08fb9162ecafUL, 0x0c59e76c67c19879UL }},
+  {{ 0xef996b92effe09f5UL, 0x6fbbcd7de702da90UL, 0x3d71eef9c13649bbUL, 0x0f4523062eb6b20aUL }},
+};
+
+static const fd_bn254_scalar_t fd_poseidon_mds_9[] = {
+  {{ 0x447766904d8567bfUL, 0x1c57e6b79253cb2dUL, 0x51acb0f67ab9a1c8UL, 0x1cb4e8b5ed6d914fUL }},
+  {{ 0xfb5f006cc0a0cbdaUL, 0xe6fcd1a96cbf22afUL, 0xc5cbd466c4e06badUL, 0x036de2ff6b702d1dUL }},
+  {{ 0xab8f9a2c66f69a98UL, 0x4fe4cbcc2bcf4b4eUL, 0xc878f3b76056998fUL, 0x2d9ba2cd301557c0UL }},
+  {{ 0x08b0eec3f498c374UL, 0x72d5d765ef7936d4UL, 0xdebc3a6fdddc5d90UL, 0x2fcfd53a605f269bUL }},
+  {{ 0xd7cff19cd778781fUL, 0x30d61fd6e4b41950UL, 0x0f95c9c8bdcf6384UL, 0x19ccdff27ac46432UL }},
+  {{ 0xf4ddc6bd755c7dbbUL, 0x31ca9a3f406ece46UL, 0xa9c95d717452f1faUL, 0x0fd0b2f9a2e109aaUL }},
+  {{ 0x3cdd173047576e24UL, 0xc3a2fc5a52b55dbbUL, 0x0e184adb630bdb14UL, 0x1c6eb1181a20f923UL }},
+  {{ 0xc82c6921e96142a2UL, 0xdf3853852e1d5e3bUL, 0xdce169509a78ea0bUL, 0x20f68c53fc1e50ddUL }},
+  {{ 0xeba36e2fa1669582UL, 0x13eac76f9c468c5cUL, 0xea3e128c64ab1724UL, 0x0f3c326714780a51UL }},
+  {{ 0x7e7083a07243f6d8UL, 0xb8c7eee40c94b77aUL, 0x280253be655726aeUL, 0x26f1b7e9eaf92fefUL }},
+  {{ 0xbd95d9fba5074180UL, 0x28fb54832ef79a62UL, 0x191a5f19f931a19eUL, 0x1bb7d169e28559dbUL }},
+  {{ 0xdae8ad17b2e761b7UL, 0xa394a961e32b1f18UL, 0x92586aafd4d18c97UL, 0x2f90a08696a2a1cbUL }},
+  {{ 0xcd51ca4f6785c327UL, 0x36a671bb1b993673UL, 0xf70a07d2fd0f0e0cUL, 0x09b8f7290eb394ddUL }},
+  {{ 0x525c91da02048f42UL, 0xf3976db0863d98c7UL, 0xdcd4e76face08680UL, 0x04733fabf9c19ffdUL }},
+  {{ 0x24cd4443c86729d9UL, 0x5190306667e92ec2UL, 0x3e8db4945192a6daUL, 0x10d8eee9b4aab49fUL }},
+  {{ 0xbb409478bf377d06UL, 0x4b775f214234f4b0UL, 0x9d7e960ccf5e54e8UL, 0x03e8ba93a309db58UL }},
+  {{ 0xcc0d3e2ac2719e4cUL, 0x5a4870cec8448fccUL, 0x71012050ad194c85UL, 0x2347ae94474c7d6bUL }},
+  {{ 0x75f9f678a6089b15UL, 0xa1c0aa0edb44b8e5UL, 0xba511ec83c6d38c3UL, 0x0ae5c61f35b7d8eeUL }},
+  {{ 0x338ffacdf40cc989UL, 0x46745de72bc1c676UL, 0xc99780aa71319719UL, 0x1da55b3b2fd62565UL }},
+  {{ 0x7329fcdb3f8d5a22UL, 0xd846888d90686b6dUL, 0x1381c9bd59f4c50dUL, 0x0b9d589bd93dc624UL }},
+  {{ 0xadd6713e80d72aeaUL, 0x625fd736a274662fUL, 0xc09d9143d44f8783UL, 0x09a58732243298c5UL }},
+  {{ 0x16f3ae99e386c0c2UL, 0xe2372fb85c82caa5UL, 0x80ba13f80db48fd1UL, 0x2f7369549f93fe11UL }},
+  {{ 0x44cc9863f08c2e58UL, 0x60aabea833e2bbe1UL, 0x86e0f589ea92a11cUL, 0x20e5964682e8252bUL }},
+  {{ 0xb13ae54079d0959bUL, 0x19f163abcb5f45faUL, 0x8cda66b8e6757efaUL, 0x27e1ad8c09553525UL }},
+  {{ 0x8ad3905c6cde909aUL, 0xcba7a7f76b320136UL, 0xd06f46c6d2455b86UL, 0x03955349e3c3860fUL }},
+  {{ 0xa737e615214b8510UL, 0x795be6ace2f1d678UL, 0x67444e2ca55251c2UL, 0x0f5fe37ed92cb857UL }},
+  {{ 0x7546fdd3f21e9796UL, 0xe5989d3feb962160UL, 0x27487e4dd20bc802UL, 0x0e74c050a1f0668aUL }},
+  {{ 0x9bcf846b0592adb9UL, 0x6bde3de2abe8d4e8UL, 0x0bb7a94bc2aeb1d7UL, 0x1a266fb9d14d99dfUL }},
+  {{ 0x1671e58f1819634fUL, 0x77a96a64096c1b6fUL, 0x67f592a7ceed93cbUL, 0x19b7d50c3a2d551fUL }},
+  {{ 0xf87deb212b063330UL, 0x2dd08a4f1e8d3075UL, 0x270381b93dbe027eUL, 0x285fecf0de922d42UL }},
+  {{ 0x3fe8638b028eddecUL, 0x2e404431f78c06b7UL, 0xb3f76028f8420392UL, 0x1d177bdf186129dfUL }},
+  {{ 0x04b997d0dd57779eUL, 0xe2e49afaf0c5c9c3UL, 0x802a5b600200280eUL, 0x0b77e25dc242c5b8UL }},
+  {{ 0xd44dc1c6e4f3e294UL, 0x0b4cee0cb17b70e8UL, 0xac0caf46219dc2b4UL, 0x135f788cab91314cUL }},
+  {{ 0x63cd9586cdb2c2b8UL, 0xa0bde09cf77a98c1UL, 0x565e370e263e2808UL, 0x2cad86cbbd8d4f38UL }},
+  {{ 0x561961b0748e7c4cUL, 0x44ee2fb34631429eUL, 0x6db3ad4b09480e28UL, 0x0b084658e326a017UL }},
+  {{ 0x99f5eff7f9e12e5cUL, 0x3381b06ff6559711UL, 0x79d03b60114219c6UL, 0x084e36aaff83cc37UL }},
+  {{ 0x1c30902be1d43ff7UL, 0xab6cddb698a63431UL, 0x026924a475e962e3UL, 0x1ee583c367438b82UL }},
+  {{ 0xcc0c1769b9180bdfUL, 0x864adc08159d374bUL, 0xa445023c30b12e29UL, 0x031535e1b4bcf120UL }},
+  {{ 0xa8d65547f98f8efcUL, 0x34d76540fd7f326bUL, 0x451b134b16753b24UL, 0x172368e5ccf5827eUL }},
+  {{ 0x4ce5c52cadc0cdb3UL, 0xce9e389c29fa46deUL, 0x5da460ed58355f68UL, 0x0d6af2a7430e0a5aUL }},
+  {{ 0x1852248fb5a8fb7aUL, 0xd38084edb65d2085UL, 0x2aa2e6727d7655afUL, 0x2fa5e6d9b2269eb9UL }},
+  {{ 0xfe0dc7eee802eb62UL, 0xa788f16e6dd63a2bUL, 0xfd1dfeb331a75c0aUL, 0x295590701e0535e1UL }},
+  {{ 0x5fd9e557d2671e28UL, 0xb8df08a18e96b811UL, 0xa2dbe3db6aced682UL, 0x2afe5d9ff82d824bUL }},
+  {{ 0xa8b3afe3cb024276UL, 0xb1220a8f5fe41132UL, 0x3c77e9cbb48d20d3UL, 0x13b789bd7cd96859UL }},
+  {{ 0xdf433e4250504204UL, 0x9dd9e3584463a108UL, 0x864f5273f05a6430UL, 0x1f71f24737d671a2UL }},
+  {{ 0x5ed0e7f54eb0a9bdUL, 0xb45e664a30572d9eUL, 0x8bcadb4e712057acUL, 0x164cffaed83d85a7UL }},
+  {{ 0xe2d54016801cadd4UL, 0xafa367c66ac533c4UL, 0x13b4c599cdef717fUL, 0x0745ad22449d013fUL }},
+  {{ 0x53f90cc4d0f98734UL, 0x76190219cafb3a7dUL, 0xa3775d53cf1d405dUL, 0x1afc7f36076c3a51UL }},
+  {{ 0x578dad2be51f0b8fUL, 0x6c7311a8777afa41UL, 0x709ef23af6a30946UL, 0x0f156af7c062c5d7UL }},
+  {{ 0xa78821113cba8e09UL, 0xc47640051e1b3ab2UL, 0x6da6f5100b708370UL, 0x13e87538caeb5e07UL }},
+  {{ 0xd5f027bbbbc6e8edUL, 0x79327333730a2e3bUL, 0xce4df9a8407536b5UL, 0x1fa697cca4444dc3UL }},
+  {{ 0xaf49e196db823107UL, 0xac786e7425befcafUL, 0xb2db598092f5e6ddUL, 0x281412d437b5daf2UL }},
+  {{ 0x3dea1b116decf524UL, 0x3e928a9d365dc95eUL, 0xa845c9464848d18bUL, 0x177e4ccb8ca9873bUL }},
+  {{ 0x1b9dbad180606810UL, 0x9bad1ada81b4f0bbUL, 0x7c23e4b09d6304b1UL, 0x2270eb71457cd37dUL }},
+  {{ 0x2076110ff1b24ecdUL, 0xd9e44f5c0370350aUL, 0xf3085fad5038a1adUL, 0x12fa7587c04c235eUL }},
+  {{ 0xa4efed094f76f0f8UL, 0xbb5e9757df017235UL, 0xc1301607a44f739eUL, 0x0a1db2874ad67b8eUL }},
+  {{ 0x109ad0eef40bb764UL, 0xf5cfafa99fb7d2e5UL, 0xba65aabb73f67c23UL, 0x065365571f13756aUL }},
+  {{ 0x015ab9abfdb9817aUL, 0x500d41cc72526793UL, 0x03df46a37be70013UL, 0x29b2162069ff6b9fUL }},
+  {{ 0x4d030b57aac92938UL, 0xc6e174cc22c61eacUL, 0xd221f2841fda687fUL, 0x035c4588a361f599UL }},
+  {{ 0x85055e18d376983aUL, 0xc19f6056e72223b2UL, 0xa4faffe48b265a79UL, 0x2b8593fd11cd7cf3UL }},
+  {{ 0x4a59d04180782d90UL, 0x0efb89971da520faUL, 0x1de6efcc9e2e0471UL, 0x12e3b71ad22cebecUL }},
+  {{ 0x3d95e8c490d93060UL, 0x5af497b10b5ee1ecUL, 0xc449a713c82a2eedUL, 0x1a818ef44fcd8a37UL }},
+  {{ 0xb77b34107e2e43a7UL, 0xea308d960e45fc30UL, 0xeb5af8d19add7c3eUL, 0x2e1d5a51070c326fUL }},
+  {{ 0xe703896aaccb8db7UL, 0x8ef1887f17cae125UL, 0xe01f8961d1cbcd94UL, 0x1f6f92350deee04cUL }},
+  {{ 0xbe29dff8b4815ef3UL, 0x92516f810b1005d6UL, 0xf3ec75a97a9629faUL, 0x24365fb5d3cda839UL }},
+  {{ 0x6c5b97e0df9f6b3eUL, 0x4a0fb2b0972a9b8cUL, 0xc9174c67f978f3f8UL, 0x1e6ec4bfeeaa8dffUL }},
+  {{ 0x414fbd9ad17f7d39UL, 0xf01b0f4f51eb84d7UL, 0x98b9bf883013434aUL, 0x2127d6cc88a57d24UL }},
+  {{ 0x51a972ce4fc2a65dUL, 0xd1d08b806f1417c6UL, 0xdc6ef2f1ac65d5d6UL, 0x22ea5c1de36b8232UL }},
+  {{ 0x5b084f9eba2f07fdUL, 0x0cea41613509d94dUL, 0xc62df6dced1cf6d2UL, 0x005826dccd4cbcb8UL }},
+  {{ 0x8455fd319c176bc5UL, 0x6b53f8e3c52d5229UL, 0x4188be59826c7d4eUL, 0x1b7901cd7d0c36abUL }},
+  {{ 0x73ee3228c4db3897UL, 0xf5a8ea1e04d82e5cUL, 0x5fd16967a5208021UL, 0x22d8cece441c2bd2UL }},
+  {{ 0x2a8086eeca7c4322UL, 0x233227dd764d0c16UL, 0x7b9eb5421804d6e9UL, 0x0e2795d49ffab917UL }},
+  {{ 0x64da9b5307114704UL, 0x173b5f3796d7dd9fUL, 0x7185dca41be86711UL, 0x15174305cea1fa56UL }},
+  {{ 0x63e242ce0f3709d3UL, 0x8bbe234f6ad701eeUL, 0x79cc8f27b6650a12UL, 0x1fac862e2efd18a6UL }},
+  {{ 0x342c4e6522b32873UL, 0x963e6b747cd28156UL, 0xe21d9ea80af2acdfUL, 0x11dd360f7d6837ccUL }},
+  {{ 0xda2fb975e292e2e6UL, 0xa191b9af6ce6ac3bUL, 0xe1b92926c6d464d1UL, 0x24a7b2c134b6ffe2UL }},
+  {{ 0x6951d4d913552b25UL, 0x4e8fa43e4e7bf542UL, 0x479cc47c3e76c350UL, 0x02ca7f3d8ac0aca9UL }},
+  {{ 0x77c43fd64994a391UL, 0x3d54347b691ddf77UL, 0x4f9ffc41d714cdf8UL, 0x0848a0efa67716c6UL }},
+  {{ 0x6030767ad6913ddbUL, 0xc025a1a140ba9ec7UL, 0x0be13da139a3fa12UL, 0x0d91ad952a30f654UL }},
+  {{ 0x130bc23bb55b0ad3UL, 0x2d0af687016c072bUL, 0xdeb1a4f006929722UL, 0x02fe8d1ad887eb0fUL }},
+  {{ 0xe6691da663f7ff6fUL, 0x1ecc9cd1a037efc4UL, 0xdb82bae63de15b75UL, 0x2d6facafb718914cUL }},
+};
+
+static const fd_bn254_scalar_t fd_poseidon_ark_10[] = {
+  {{ 0xcfdcb7a408294d86UL, 0x7cd3aa1bcf75b142UL, 0x53e448e07f9bde14UL, 0x258e323186f968bfUL }},
+  {{ 0x3691f0f6bc72144eUL, 0xf13ae01658b8aaaaUL, 0xe5304ad1de28f058UL, 0x0af6f86ba4d88ac4UL }},
+  {{ 0xc43a26bfdcc2695bUL, 0x46fba2920a83fb67UL, 0x078b6129557f4380UL, 0x098c74a21bf64bffUL }},
+  {{ 0x8e6710e5c06ecf08UL, 0x93e3390a63736328UL, 0xadba442c3233b82aUL, 0x0febfd0acbc371faUL }},
+  {{ 0x196bb920cdb35c71UL, 0x33238e8fed6a62e7UL, 0x9cf65a3571027340UL, 0x1885079255b0cc1cUL }},
+  {{ 0x9ff94d0cb58a413cUL, 0xc289496b682f276fUL, 0xa6f655b065288e3aUL, 0x05a8f02dbdd8cbceUL }},
+  {{ 0x2a747fc599d40e33UL, 0x4bdcab88a694a107UL, 0xbd05e0402f6348d2UL, 0x0cf159fd7854c296UL }},
+  {{ 0xc5b145327f52f564UL, 0xf0ed17c1b3eb63a0UL, 0x6ba5c7770420eed9UL, 0x0bb601a578be2bb6UL }},
+  {{ 0xca1bf3ae55d2ff0cUL, 0xcd39eb8fa2343e8dUL, 0x5626d4625ddcb1d9UL, 0x1651b8b1328f00daUL }},
+  {{ 0xf115494330daa7fdUL, 0x10d7844e1192837eUL, 0xeb2c2b77cb5a6927UL, 0x0baebbf66e6d18ddUL }},
+  {{ 0x3f02dcbcbc00a25eUL, 0x327c7f3777ed6b82UL, 0x14770f09bc31229eUL, 0x25651396804623f9UL }},
+  {{ 0xa7ff9753e538cb9eUL, 0xdf9cb85dc274c2e3UL, 0x7e4864b4071bb9a6UL, 0x0242b90b62527159UL }},
+  {{ 0x2c980c49d4a7bc53UL, 0x3a90b111256f7982UL, 0x52cfc265ac4886bfUL, 0x08d1120049428fa3UL }},
+  {{ 0x97deb6d35f0564ebUL, 0x7b2495b4b007aa5bUL, 0x3476fa494ef923adUL, 0x1022c5148e5f1858UL }},
+  {{ 0x9a7bc9e39a52cda0UL, 0x65cd2ee2d4f50aa8UL, 0xa69b81f4f188c27fUL, 0x2beddcfec9a2cf63UL }},
+  {{ 0x983addcb18be788dUL, 0xf12b59c55bc2b3c0UL, 0xf7ea37edd29622a0UL, 0x24233c152ad43b03UL }},
+  {{ 0x0c5cd656c61df1a4UL, 0x4259556fb43e0257UL, 0xd8053e3221d84b22UL, 0x256a09cc8dc77526UL }},
+  {{ 0x33f7ff9dc4f12fadUL, 0x3ffcb8952d34b69cUL, 0x0d7bc06c35a14d17UL, 0x0e20e7b896e07c48UL }},
+  {{ 0x907375c8f68bf027UL, 0xd7fd113062445847UL, 0xd7970c4c43d3fbe4UL, 0x0ef80dce8bd514d6UL }},
+  {{ 0x715c5f950103f30dUL, 0xd6976a3453515784UL, 0xefa182c312e7791cUL, 0x0facf0b9afea75c2UL }},
+  {{ 0xc75f4900aefd6da9UL, 0x1301e4e6833810feUL, 0x89c650e4a9e89b22UL, 0x26efe9041deee84fUL }},
+  {{ 0xe13610a959235769UL, 0x117272d29e192bf4UL, 0xc8a8e2fac967aff9UL, 0x1c9f1e3e59a720c1UL }},
+  {{ 0x28f3b0b72f1922c1UL, 0xb6f106b309760006UL, 0x051762a448065924UL, 0x2d174757e0b0a6fdUL }},
+  {{ 0x3a4dec1659943ce6UL, 0x77b2649ed2ed81eaUL, 0x89b167fade37ade2UL, 0x05d062e1d4a2e31dUL }},
+  {{ 0x34ff18f36eddc649UL, 0xc979923750a22c40UL, 0x65142537d47fd8f4UL, 0x22fd79e612d91212UL }},
+  {{ 0x329603e420235d21UL, 0x5c17dbe4c342d0bdUL, 0x50885f283ce00660UL, 0x2a2e46113487c3f7UL }},
+  {{ 0x859012e5ecf2a0a1UL, 0x132be61f75f0a17eUL, 0x228063e77eb978f6UL, 0x0b45364134dbb412UL }},
+  {{ 0xab02f6ecc13fc93bUL, 0x7dffc91d4c6b638eUL, 0x662feb8bc49083b0UL, 0x1ba0b2a0f3151c2dUL }},
+  {{ 0xbb608c71abb61812UL, 0xfb055a1dcca83a66UL, 0x36a51b7613bf00a3UL, 0x27fb896f67d659acUL }},
+  {{ 0x58609da8b0ec1d46UL, 0x7355fa8acc71e52eUL, 0xf176d90a53789645UL, 0x00677de37a1030e9UL }},
+  {{ 0x0d1660a1fbd47aa6UL, 0x17717189ad7caacaUL, 0x77a02a6894953c9dUL, 0x0b24345f5585845dUL }},
+  {{ 0x0d174b2e77e05d6eUL, 0x5525a3352e40ca42UL, 0xaa987b9c97badf6aUL, 0x11c79a0305da8a72UL }},
+  {{ 0xdd5037e64c78fbf7UL, 0x2cf9ae0d5b57d6b5UL, 0xaeb9b1d02a586174UL, 0x024dc3e6a3775099UL }},
+  {{ 0xa0ee1c72bdf7e162UL, 0xb8fa59954da1945eUL, 0x3e0dd15905ef3715UL, 0x29982c2800281cbfUL }},
+  {{ 0x0a1fad7d2f36c4a0UL, 0xffe61fd20ec0fadbUL, 0xf5875b62b1939ca0UL, 0x002bac123a5ad769UL }},
+  {{ 0xf180bbbc2815953eUL, 0x1e2befd53b0478e1UL, 0xc1e4d7c6ed566e17UL, 0x1d744c6af1fbaa23UL }},
+  {{ 0x15fb0463ead3cd68UL, 0x9b66f61ca6974dfaUL, 0xd65e5cb70034d150UL, 0x25e73a6a4ef33be0UL }},
+  {{ 0x875e8868da746beaUL, 0x5f7c9e38bda05febUL, 0xd6adff39122377deUL, 0x2ccf3b73205140f4UL }},
+  {{ 0xb0327564ff430f49UL, 0x299a6c3fb922b816UL, 0x058f0fc91c38ea86UL, 0x14c0cc347df28210UL }},
+  {{ 0xf67383570eaa46aeUL, 0x22c645dde18dc5f1UL, 0x15cb204fce57f2dbUL, 0x30241a36fb40bf09UL }},
+  {{ 0x3e74562128065340UL, 0xc1756256d5331ab4UL, 0x9a26e3db71417c78UL, 0x27f5d5b32de59c92UL }},
+  {{ 0x51c67f8b1a7acee6UL, 0x4dc26675020ea4a5UL, 0xf8d99e382f8021deUL, 0x11a89e28574d3cb6UL }},
+  {{ 0x2378f71a22108003UL, 0x928bd5b441d3e335UL, 0x55380390922f6602UL, 0x17b3c93126d3032bUL }},
+  {{ 0x64645b62781cb8bcUL, 0x1cb450c742e616faUL, 0xb00b415a97843d09UL, 0x05ebf8b3dd4a19e5UL }},
+  {{ 0x7a98b453ff3bcf2aUL, 0xf25047c9f977735dUL, 0x39a595b96595a7daUL, 0x1831c6f645617ec6UL }},
+  {{ 0x14d41b20f7249301UL, 0x2c4dab33057d3550UL, 0xf95397e67367a81cUL, 0x245cd7cdacd3d263UL }},
+  {{ 0x82fadd66e9bf2124UL, 0xab5f8fb48923129bUL, 0xdd3e678fade61c77UL, 0x1325e8a1e48dca85UL }},
+  {{ 0x86c49372da916448UL, 0xee4fddd6c5d6e341UL, 0x6a2ea586cabf77fdUL, 0x2cd29c16a41524b5UL }},
+  {{ 0x498ca03e50892bd7UL, 0x8bb67e1301fe1ffeUL, 0x44b5e36297991e5eUL, 0x24e7fd1350548102UL }},
+  {{ 0xa0901219cbbd2e29UL, 0x99b3534c1060855bUL, 0xe75a34ce83df4061UL, 0x14f4ffb01f7bf4a3UL }},
+  {{ 0x1aa40020a84fea03UL, 0xd3bfee06586187d5UL, 0xe59246a49999b59fUL, 0x0db70b2e328f2d8cUL }},
+  {{ 0x6543c51ddcaf3b6dUL, 0xa7ac1c0a034da4cfUL, 0x11073a563cc6c0beUL, 0x2c6bb67bfb5facbfUL }},
+  {{ 0x641142bbfaa0a888UL, 0x29e46ae74a463886UL, 0x13fd891c6926aacaUL, 0x1a33743939ebfdf7UL }},
+  {{ 0xcd54af7b57454592UL, 0x24ab85aee51015d1UL, 0x06baeea83202aeabUL, 0x0d03cb0b5158f295UL }},
+  {{ 0x6fd7b23dcacb02ccUL, 0x708a69ff9c3a1181UL, 0x0d4f8b063150523eUL, 0x238d55a87ca9b11cUL }},
+  {{ 0xbcc2b77342c15557UL, 0x4ffe3f828a6a71f2UL, 0x140f934e082f5946UL, 0x2ad10e38b25aa5e4UL }},
+  {{ 0xe07914180c08e409UL, 0x17a85baf3b450eb2UL, 0x288ec427a117ee51UL, 0x016352684263ff9aUL }},
+  {{ 0x5c514fac05b2ccf8UL, 0x65b3e3a66f527567UL, 0xd8457b844629174cUL, 0x02eb4f92b8dd7777UL }},
+  {{ 0x12b7aea8b9c0527eUL, 0xac3d625f7a651f22UL, 0xc2593508fe2b1f8dUL, 0x033b9cffe917ff94UL }},
+  {{ 0xfa457606025e48feUL, 0x4ac0af1b33696d74UL, 0xba5b028d68a54c97UL, 0x12a537d2dd4b1410UL }},
+  {{ 0x55294eba52cb2082UL, 0x33a24471a8365828UL, 0xadfc5aa67c84ea7fUL, 0x034af6c25e1323c9UL }},
+  {{ 0x1290d225c2a0b51eUL, 0xd62c1419da969a42UL, 0x73c2fe50f6e21916UL, 0x2a07ebd4dbec28f5UL }},
+  {{ 0x7fe28c3e8f1c03e0UL, 0x6cfd188385d1c726UL, 0x98644c4de1ee16a5UL, 0x2f9100f4d9af73a4UL }},
+  {{ 0xcf999d34e4abddd8UL, 0x03bee47573a5cf7eUL, 0x524cc3a1ac7ddd07UL, 0x02ec6c6f4b8bb451UL }},
+  {{ 0xc4655ec55dfb41e8UL, 0xfe49ce1ee72a692fUL, 0xcd22b4272dff698dUL, 0x166027a78919f77dUL }},
+  {{ 0x0afe8fa386671e0aUL, 0x0e9b5ff569c996f1UL, 0x70984ace8ec07c46UL, 0x0dba40a72329b98aUL }},
+  {{ 0x8359b31b4120f1eaUL, 0xba6f92b9a7734fdeUL, 0x3770a466caf8324bUL, 0x12983c875707e754UL }},
+  {{ 0xad03195c5334b263UL, 0x0441555aea928a88UL, 0x18532f151e333555UL, 0x042ae889205cfdf8UL }},
+  {{ 0x1d1110d481a16ab7UL, 0x1022b5ce555e4c06UL, 0x3261b10a0e6213d5UL, 0x18bdffb4d85b2e71UL }},
+  {{ 0x898328f7dbaa9cdbUL, 0x75e44d80ae054edaUL, 0xac3896066419332dUL, 0x05dd25110c250d28UL }},
+  {{ 0xc7a1c254df25ef70UL, 0x3e7c4bbea58a00a4UL, 0x733f0c9a6a1b1955UL, 0x2688357a1f7841e9UL }},
+  {{ 0xe80b544361f16e17UL, 0xfc488a606d1ff699UL, 0x34d66fb7d17d2ce4UL, 0x053526c652862384UL }},
+  {{ 0xb38921d48423d852UL, 0xf0e04c5b6bc41837UL, 0xdc19dffae824f5beUL, 0x21f0847bdfdc0da5UL }},
+  {{ 0xfd6d82ddd104b195UL, 0xeb6ff0b2510af814UL, 0x7b958b424d0855fdUL, 0x2a63bebee541ca37UL }},
+  {{ 0xaf026e3140f0fb07UL, 0x4f594e4fa440abeeUL, 0xda2dcf327b6dfe10UL, 0x29e020c05d3edc26UL }},
+  {{ 0xd40233b0265a085cUL, 0x8ab16d0d129d875eUL, 0x73e4b43f82ce4a7eUL, 0x0c33297528c16e2aUL }},
+  {{ 0x7ce4511ad622754aUL, 0x5037663709d5605fUL, 0xe5a5a86cf450ef8dUL, 0x1dcdcc42fcd30f9aUL }},
+  {{ 0x30b29730a67155ffUL, 0x9cf93b8bbd56065cUL, 0xc6de688c7e7e875cUL, 0x11871609f78a9f4fUL }},
+  {{ 0x37fdf3c1d0423786UL, 0xc56302d16b086483UL, 0xac58a32f2b8a67d4UL, 0x0222f020c6edb6e2UL }},
+  {{ 0x2756f7b1bcf0bd48UL, 0x54cbd76cb3cc704aUL, 0xbd42130cdcbd8b68UL, 0x25850d7d86e63629UL }},
+  {{ 0x542ea7262c5d8279UL, 0xecd516330c832595UL, 0xab2fe9ab61bdf222UL, 0x2e14202e72e64361UL }},
+  {{ 0x4cfaa5ac8234a45fUL, 0x040e3b2ab91ffff8UL, 0x50f05d36c301a90aUL, 0x2a7f2b95233ac9cbUL }},
+  {{ 0x76f706b9aeaafaffUL, 0x36017bb1c6456c40UL, 0x1e1ccc619b4e4df3UL, 0x299187dfb86a9693UL }},
+  {{ 0xb5a16f7111aff8ffUL, 0xe45240a9bb5c732eUL, 0x7f92350e6964aee4UL, 0x2490a0a2d1cb5adeUL }},
+  {{ 0xa927f0708049a905UL, 0x9de0b5c449744255UL, 0x7a328dfe1295960aUL, 0x127e1d0775c5a75dUL }},
+  {{ 0xf51669182d7f8e64UL, 0xeb16ae93a3e9ca36UL, 0x286bf277f89ff358UL, 0x2d3f07bfde8d6763UL }},
+  {{ 0xf5e9034bcfdce9faUL, 0x719d4ac7c7057f62UL, 0xa43d678b80f3f192UL, 0x19c265a2d7b66ad2UL }},
+  {{ 0x99e601c5fa647430UL, 0xdbed121b0ee57d30UL, 0x408d3f8f21e870b4UL, 0x2235d624fd5d9585UL }},
+  {{ 0x02c34d1334d5efe1UL, 0x8861930c623f6b0dUL, 0xae9c38723c11070dUL, 0x22b1afa9173f5518UL }},
+  {{ 0x7a23278ef545e107UL, 0x295e1b80829733e1UL, 0xdbaf4b2b67635749UL, 0x1bcc5a91b52fe60dUL }},
+  {{ 0x9c10298a49dc6562UL, 0xfb022c673a09d9f6UL, 0xfda182850c4a3e91UL, 0x1ffafc4061aef7bcUL }},
+  {{ 0xebe11265171530ddUL, 0x324a07791d482b53UL, 0x9d9bf2098e85c68dUL, 0x285df3a46d47a22fUL }},
+  {{ 0x5b2d1b60ce9a2686UL, 0x59525c1bdd92a516UL, 0x0c8f560494d7c323UL, 0x0d70be06e9e76884UL }},
+  {{ 0x4b1cdb620645810cUL, 0x33eab86b15aa8a87UL, 0xd36303603ec1e52aUL, 0x1e642e09f5cb108bUL }},
+  {{ 0x1613632e464af726UL, 0xbaaedabea83f7cdbUL, 0x54d2092a75052e95UL, 0x2ef7b7951c9ee4c8UL }},
+  {{ 0x11996991b62c73beUL, 0x13a3cd97d1a18765UL, 0x7cccd0208df457ceUL, 0x2dda315ea9e178caUL }},
+  {{ 0xaf62ab7e0a75cc73UL, 0xdd2da9de35934c95UL, 0x003f190d7bcc6454UL, 0x110168dda7bd1fb5UL }},
+  {{ 0xa611c27189278108UL, 0x38cc8dbdfc8e3a9dUL, 0x0e44dc056a6afb24UL, 0x2e0107acf1ead9f3UL }},
+  {{ 0xeed82c5c330c473aUL, 0x8aeedc7fb6865f3eUL, 0xea1bbb856737ce6aUL, 0x1fd0f83aff0d12c7UL }},
+  {{ 0x07322e06c087be96UL, 0x5a13de90a6a19081UL, 0x0acd155f43c46050UL, 0x06099a66eee3aea9UL }},
+  {{ 0xa8a1eab1da27159dUL, 0x70ca2d95a47e6ae0UL, 0x0007056f850b9409UL, 0x2c3a2d7a1f19d60aUL }},
+  {{ 0x73bd67176c546b12UL, 0x928bbfb604c7858fUL, 0x0adde14ca7086d0cUL, 0x2ca84ffca141cf47UL }},
+  {{ 0x7956644bfd2992ffUL, 0x1bc833ba07a0a244UL, 0xdcfd698cb6402c12UL, 0x24ed0e53b4840f60UL }},
+  {{ 0xfe5fb5c114fc25bbUL, 0xc42aa00209b870eaUL, 0x9035c8f89f026655UL, 0x30437dcfec7754fdUL }},
+  {{ 0x1b39e0cb73e44dbdUL, 0x57d2360bd248d2beUL, 0x364dbf1704d38fd5UL, 0x13e2f383fdbb74f6UL }},
+  {{ 0xc26c851e04acb5c7UL, 0xbdfac5870b5bce2aUL, 0xcb92548405744d65UL, 0x24759e61cd04718aUL }},
+  {{ 0xf39fb0ad182a821bUL, 0x737891119364f014UL, 0x67258a4c51826f65UL, 0x0352260204ab8a39UL }},
+  {{ 0x154bc72002116edeUL, 0xbb2d0a10530bb67bUL, 0xd815b1dd84775b90UL, 0x2c1ece5e2b9622dfUL }},
+  {{ 0x53bc294b405a1995UL, 0xd5cb81b8103f6ff1UL, 0x9c07c51fdfa9b486UL, 0x0f387944aeaf1ad4UL }},
+  {{ 0xb2d5ab5fb793e021UL, 0x96f1b5fe581e8049UL, 0xb7247b3b72a03711UL, 0x02369a1ac53d2dfcUL }},
+  {{ 0x1d69e20412375225UL, 0x1c768c41b8ad026aUL, 0x5f423cf2f2242ab1UL, 0x193259c4a98ee3b8UL }},
+  {{ 0x0eec228e5c97ec26UL, 0x44bcf87661d272f0UL, 0x47ffba245f4975ddUL, 0x09e53ce0b211cf78UL }},
+  {{ 0x528a9f81bdde665bUL, 0x9d0000f7746c9ab3UL, 0xcd22b052719844e9UL, 0x11fcdf877b5b650eUL }},
+  {{ 0x3b77d94649b807eeUL, 0xf44fa04378c596e5UL, 0x0c15bd51c945d07fUL, 0x14b817305ce0c7d9UL }},
+  {{ 0x93360b2fb081a25dUL, 0xf2d614eacbfb7aaeUL, 0xe8939c1d38b9d4e6UL, 0x213079f1b2033656UL }},
+  {{ 0x904340a57d635132UL, 0x0d95cf3f9033f212UL, 0xfd0bf0657bad68feUL, 0x013a5ab439566a12UL }},
+  {{ 0x3c34a2e971a1e6e6UL, 0xce439253fd0a61fbUL, 0x1e00f14aaad69975UL, 0x23403d0ae34d0cb9UL }},
+  {{ 0x47234a3d128f3174UL, 0xf6e5c006e915bafeUL, 0xe84c012c28c846dbUL, 0x0a7b82ff5f24e2d2UL }},
+  {{ 0x801868241658ac10UL, 0x668a1af5c29ab040UL, 0x897986d7c1271558UL, 0x031bd136359f0e44UL }},
+  {{ 0x4a1e63638333f956UL, 0x20a9563a2af2f6b2UL, 0xe89618230f9f07f0UL, 0x002e7ae71b9a400bUL }},
+  {{ 0x5a321e866ce3b897UL, 0x1aa788f9e507c78bUL, 0xc5bab4ad5a989288UL, 0x121374c1b611c021UL }},
+  {{ 0xbe6f994b99f8e4f0UL, 0xba250158b606ac34UL, 0xbbfcadb6dc733d19UL, 0x23fbf35dbb896844UL }},
+  {{ 0x1b09f70287664d6bUL, 0x236eb7875ef581ecUL, 0x2d78e4c33124f867UL, 0x24d9cc607b5ce663UL }},
+  {{ 0x0abafad620446d41UL, 0x023b0b14ed7c6d80UL, 0xa59aad72a75f592dUL, 0x12b114964d48e2edUL }},
+  {{ 0x23fc90cd2e839bbcUL, 0xcff0d53b467edbaaUL, 0xde9ff3382c6948e9UL, 0x079688351f3fdb41UL }},
+  {{ 0x364d066872b6b1ddUL, 0xd33800effe7a60c3UL, 0x29f3f8d6f5d41d9bUL, 0x18983314347842afUL }},
+  {{ 0xd785f90ed6d0b5b5UL, 0xa20396c6e36d42e9UL, 0xc919c5c2f23d7711UL, 0x25e96e1206bd36b6UL }},
+  {{ 0x0d5b00ad2e752552UL, 0xd34e77675c3ff69aUL, 0x4af010a887e026a8UL, 0x218729d8a3537610UL }},
+  {{ 0x08873820a8e03fcbUL, 0x41e93c6671633a2fUL, 0xe10f0e0629e19688UL, 0x1233933a44afd254UL }},
+  {{ 0x2bf55a50e8023935UL, 0x9501396e7d70ebfaUL, 0xc4c1a47f7f6596dfUL, 0x28d904a6cf04b8d3UL }},
+  {{ 0xc683b1b14a6b66f0UL, 0x384aa03f93b8eee8UL, 0xf0fd69a73914de3fUL, 0x17790c29ee9030d7UL }},
+  {{ 0x94a729c9fc378d9fUL, 0x4c98522ad50c9306UL, 0x68260ff45a04caedUL, 0x14d34e5c960717e7UL }},
+  {{ 0xc66d505c4806b41dUL, 0x64fccdf3285d9a8dUL, 0xb8d4d3d444f951c1UL, 0x0f5df8fe64bd63b3UL }},
+  {{ 0x46f31d85b64e94deUL, 0x75304a2c9f23413fUL, 0x113a4e88b488c117UL, 0x17e592b421732882UL }},
+  {{ 0x3f4a58f36a6b4e1dUL, 0xe53b05956d0a91d7UL, 0xe215dd0d1f5231d4UL, 0x269f576820abd09bUL }},
+  {{ 0x0f42f1777ce4a29dUL, 0x0160af9c04d18de5UL, 0x85374d9351e4a095UL, 0x05b218f357c53cd9UL }},
+  {{ 0x22079e35d0f8d64aUL, 0xe44946cd973e0f90UL, 0x0c87ffa427a2cbb7UL, 0x240ff6807236a447UL }},
+  {{ 0xeeff3d342dac9260UL, 0xf34f41ce346be351UL, 0x998ee1ded580d471UL, 0x056aad9bdc03a93bUL }},
+  {{ 0x591a5d60f05ed4afUL, 0x8b94a808ae40d533UL, 0xba03484f9d0528c4UL, 0x2c632e8654c7e0aaUL }},
+  {{ 0x9674bb5b1f559d14UL, 0xc7b2b849fa0a8c5bUL, 0x8761d5d5ba6ed3dbUL, 0x09bd191397f6c442UL }},
+  {{ 0xc67c5963414c0bd1UL, 0x6b1fa76a69c7d2b8UL, 0x2a5c26f6b01192fdUL, 0x0c3f8c2f9b69f042UL }},
+  {{ 0x66c7aabf0371c776UL, 0xbcf628d3f9cf1009UL, 0x1e00c2a2c038ad96UL, 0x2945f5a8762f9305UL }},
+  {{ 0xf177dd347c3b12b3UL, 0x01be0079eb731dffUL, 0x181ffa6b085d0f83UL, 0x24d1edf6f2cedc1aUL }},
+  {{ 0xa2192d5e0210b25bUL, 0xbe3dd893b52ba7b0UL, 0x815b484871031003UL, 0x13061e7324afb82fUL }},
+  {{ 0x9822cd1e4f8232a7UL, 0xb622d84c8b3ff1dfUL, 0x569a9f10b43e00a9UL, 0x15c1b794f8f501e0UL }},
+  {{ 0x994b35eb1d7be9f0UL, 0xbd9a11e894d50d4cUL, 0xbe6eb45efef0fceaUL, 0x070c4f1d16261d61UL }},
+  {{ 0xbed319d9ecebfac3UL, 0x783cf90d9a1eeeb3UL, 0x20a5ebdb7321a24aUL, 0x0492c798571a97c4UL }},
+  {{ 0x00c70d15e3331241UL, 0x246c32910f986cb0UL, 0xa8c7a388ac5010a4UL, 0x19fd082da18f635cUL }},
+  {{ 0xed31f5f148c35646UL, 0xed0984f0437e3db7UL, 0x48cca2a5e0c8d7aeUL, 0x1563b055a48ca417UL }},
+  {{ 0xb4658f16729b7192UL, 0x954d443978794e85UL, 0x0ec065e090152149UL, 0x1c3dbaf7dc82f671UL }},
+  {{ 0x5b83561b46cf1326UL, 0xb7d109d2dfc98a41UL, 0x0c6d32bd36135b87UL, 0x294d02861d3b6b11UL }},
+  {{ 0x8b64a4846a33ba01UL, 0x0babeb34d626ba47UL, 0x8b34370f6ea7a98aUL, 0x30226465df2e7ca4UL }},
+  {{ 0xd0b11a8281075bfaUL, 0xe8527f6b847ea017UL, 0xacb6f712f170c870UL, 0x1baafa2b4959bb6bUL }},
+  {{ 0x80e3b7c13b925910UL, 0x088fd5c2da6d5509UL, 0xa66cce6bbe308894UL, 0x27aa4c0060fe8dfaUL }},
+  {{ 0x846d9c822aa45625UL, 0x5236ebc0b28297caUL, 0x44ff6850b8d2c8e4UL, 0x232aa4771ea08e3eUL }},
+  {{ 0x30dd8a13621747e1UL, 0x3b8416ffd7dbc8c6UL, 0x56e12b524b51d873UL, 0x1ce8770d6d57879bUL }},
+  {{ 0x513823850a063ef0UL, 0xfdbc9a91a7712e96UL, 0x824028d69686a456UL, 0x2f021bdc990370d0UL }},
+  {{ 0x586362dc7738f7e0UL, 0x7abebdb85848ff42UL, 0x100098bd63584596UL, 0x09c8b020bf02bb92UL }},
+  {{ 0x637a18bc4d87bf36UL, 0x54c8607bb2459395UL, 0xd7a8898721a4ba1bUL, 0x1308a0f744863a42UL }},
+  {{ 0xfcf686f65e7f44e1UL, 0x782e6326275fc576UL, 0xaa4ca1eea4b5fd0bUL, 0x1e7389af58078671UL }},
+  {{ 0x106b58e6cbed1ebbUL, 0x1c43f4b8f9adb1c8UL, 0x08757d4905d48b4eUL, 0x286e4ee90f33c073UL }},
+  {{ 0x08f64b8895baa795UL, 0xd989eb7a547177deUL, 0xce39625b6853f336UL, 0x2377d938f8648ed3UL }},
+  {{ 0xa91a5d275684638dUL, 0xbce55d1fc23e1e6eUL, 0x8a98bb5890c1ef3fUL, 0x0667f68f52fb680fUL }},
+  {{ 0x672f53336eb8275cUL, 0x812537fcb66b85beUL, 0xfd2ac7954a355defUL, 0x1806cdd308a5a13fUL }},
+  {{ 0xd0daf5f46a264461UL, 0x01e703d3b064b835UL, 0xc6991ccbaba60213UL, 0x2019916e547e5e7eUL }},
+  {{ 0xdc2d63c007f18de5UL, 0x2ae6361dc7dfae09UL, 0xf5d8cba4bc428be5UL, 0x1f7a38e82168f762UL }},
+  {{ 0x26e38b38d703386cUL, 0x564fb28c0aa500dfUL, 0xb341f2e0754ac7abUL, 0x0f0638846c875e25UL }},
+  {{ 0xda595b68aec80c91UL, 0x1aabdacea1acbe8cUL, 0x77342b006a653255UL, 0x16842baa255e14b9UL }},
+  {{ 0x649ca7a22c9e30f9UL, 0x39c17a58038731e2UL, 0x326be23c6bcea29cUL, 0x17b2922ba3fe800eUL }},
+  {{ 0xdf250c93b0a976e4UL, 0x1b7fa156b515b5a7UL, 0x6b0bfc73a8dc1862UL, 0x065e2e23fff18534UL }},
+  {{ 0xaf06cd2ca21a9e4fUL, 0xa2c46c525c8cdd5bUL, 0x8b974f5d1a3e73ddUL, 0x2eefe0c649a2e4d7UL }},
+  {{ 0xd51f9e510f12afefUL, 0xbaf191f62164e344UL, 0x3b8d82153a6ef6e7UL, 0x12d7e6da86e53909UL }},
+  {{ 0x481ef549a0f46d59UL, 0x5766cb4c0ecc27c9UL, 0xadc5194241686c04UL, 0x05949612f341de6fUL }},
+  {{ 0xe3489105bb601955UL, 0x8af3c35afec2e20cUL, 0x0e3d65705011e8b5UL, 0x22cc40efc35aa190UL }},
+  {{ 0xdcc8027120d85119UL, 0xed08240053e156d7UL, 0x9c7b5fe7424f97fbUL, 0x1f980a1bef2c2cf7UL }},
+  {{ 0xbcea523d973aaabfUL, 0xa871f1fedca48154UL, 0xcd2fc2268e6847eaUL, 0x1b215f20bdb63a29UL }},
+  {{ 0x401b6fe82387eee8UL, 0xd7b76157a9f251caUL, 0x8f8a044d7aff5a18UL, 0x14b50b3f21fff43bUL }},
+  {{ 0x427a9c6b019e5d1bUL, 0x6575cc8bfbf8a8e4UL, 0x60dcb375a9d703f3UL, 0x2a6b1f4a3707e2d6UL }},
+  {{ 0x15db4e8e7e8b7f4bUL, 0xe9bde790c8b4b961UL, 0xcbaa569cea136c09UL, 0x106f5313aa761697UL }},
+  {{ 0xef37e92fda49b2b0UL, 0x7bc28bcbcdabb323UL, 0x1bf4995a52fa7527UL, 0x16abced698361219UL }},
+  {{ 0x10d5750ae7477034UL, 0x8bb5fd24d7a47d51UL, 0x9854a8af54ca3430UL, 0x1f4494fa14650a87UL }},
+  {{ 0x659d6361254ed648UL, 0xcf7a493fbf7a6337UL, 0x0b88add25c2d62e4UL, 0x1cf373b1a9c1f7f2UL }},
+  {{ 0xc9f4694cfbb4b4a4UL, 0xf0537eeba3dbe8eeUL, 0xc3edb8bff1dc5d0eUL, 0x07e6177b63b9e335UL }},
+  {{ 0xd48be3f48bae17ebUL, 0x0441198eb52912bcUL, 0x46874cd99d92681bUL, 0x0f930e259c872853UL }},
+  {{ 0xd275c5b5eab2370dUL, 0xbde1a2c652cad4b3UL, 0x1840853c2bd8a084UL, 0x1453e1f13a6bc425UL }},
+  {{ 0x250c8648861a1466UL, 0xcdb7168c414791d3UL, 0xc9b2620b172b317bUL, 0x0601089735cbbbe7UL }},
+  {{ 0xd155d1749f342899UL, 0xd62b2cf2bb665bdfUL, 0xee793feacbe871eaUL, 0x09cfbc0640f21c7fUL }},
+  {{ 0xde0109d243e4391aUL, 0x364471d31ad653a1UL, 0xe457032881ed30afUL, 0x0140663b5ba0ac4fUL }},
+  {{ 0xae187222dc24331aUL, 0x5db55fa754b9fbf0UL, 0xdfe7ca1eae09dfcfUL, 0x15ba9947e75031a5UL }},
+  {{ 0xd759754e5a08a177UL, 0xa83ac24d303b86bbUL, 0xeb56a17bf03b0481UL, 0x1ab0de983790e825UL }},
+  {{ 0x6d07454110ef0987UL, 0xe89bab47c3ff6422UL, 0xf0a6787a688b8d31UL, 0x178e3a8b11d77872UL }},
+  {{ 0xd25674b44d3eb2bbUL, 0x95794d34441ab216UL, 0xfe7a1b8d69c67a20UL, 0x02a1542c18337113UL }},
+  {{ 0x696142fb9a58f70eUL, 0x3950e9de5a3f2c4eUL, 0x2056b23b7b4f2acdUL, 0x1e6112766b0e4539UL }},
+  {{ 0x21fd58d7b36734f5UL, 0x1cb37a1c68b67215UL, 0x19ec6637d6a1a9faUL, 0x2fd1e8c3a1905b6dUL }},
+  {{ 0x5a496a187cae26f9UL, 0x1f7c7b526c22a7b7UL, 0x0ca39fe55839fe07UL, 0x0c82e5b9d62d2d70UL }},
+  {{ 0xa04ca8cda1ad7753UL, 0xbc4e227ef6188321UL, 0x7ef77c2ed0fee999UL, 0x21418d655af01507UL }},
+  {{ 0x556572d9d0d479afUL, 0xb6557959032f71b7UL, 0xeb29046b2256b970UL, 0x0b030ec8995874e1UL }},
+  {{ 0x278b7d2f5996c14dUL, 0xad922f02bef1ee72UL, 0x458a89e0a49ef30fUL, 0x07d86e60405e07efUL }},
+  {{ 0xd4dfe2d28b5397bdUL, 0xbc7c5aa39cedeb6cUL, 0xbbcc83586de06424UL, 0x01aa556ca89ec789UL }},
+  {{ 0x4558d9a52f3f39fcUL, 0x169d78f92216a6a8UL, 0x576f39b06b29d4aaUL, 0x1b34d89584bd26d0UL }},
+  {{ 0x983dd02ce93bde3eUL, 0xc48ba98b7639cc3bUL, 0xc523eae2db35ae3aUL, 0x03f9bbde9fd6a22fUL }},
+  {{ 0x6e1ae398da5bb25eUL, 0x6edfd7c2a391ef77UL, 0x5d3f8f4d5031fb68UL, 0x06d6efb6c576bcf4UL }},
+  {{ 0x945b3a235931018bUL, 0x77877f6a92c120bdUL, 0x1c4c1c5b5fa70b0aUL, 0x0c5e675abe7e7204UL }},
+  {{ 0xa4a16dfd8ddab7ecUL, 0xdcbd1d62b1e8d9a7UL, 0x5911bf9bd6777835UL, 0x2de6e6e480e343c0UL }},
+  {{ 0x5b76d122f46ee6fcUL, 0x0681aed135b91475UL, 0x7151d7013da8f941UL, 0x0b9b80102e716794UL }},
+  {{ 0x43749fa72e52980bUL, 0xf119c37ef5238ea6UL, 0x607839c9be8d70f8UL, 0x0ff1afa6e2ffbc91UL }},
+  {{ 0x51de0723d41932e5UL, 0x7973af262b1d5cbeUL, 0xf4e742cd3a4f84aeUL, 0x1dbce4bf8943d2cfUL }},
+  {{ 0x008273fd0d9865daUL, 0x2eb492b366cd9d12UL, 0x366065f91a234b01UL, 0x02654e415f0a90f2UL }},
+  {{ 0x944e99aa447eae9dUL, 0xecfef06a1fbfb994UL, 0x94ddd5b68cc3a739UL, 0x2c54dc66a533319fUL }},
+  {{ 0xe9e1cd2bb698cbabUL, 0x51a100b17f7c9599UL, 0xb889bd2864fbbd10UL, 0x1dc5a36cceec1367UL }},
+  {{ 0x3ca09f8e39a4b447UL, 0x68c9ab93058761bdUL, 0xe596c6f04a3db574UL, 0x21537ca5ef7d8693UL }},
+  {{ 0x54f4269cd08e13bfUL, 0xd2b9cd46a45f641eUL, 0x33386587034b0785UL, 0x070071e71a477739UL }},
+  {{ 0x6d57b472479569e5UL, 0x78acaca537786ca0UL, 0x3b8406a3b3fa96d6UL, 0x2575a9b98f8c04d5UL }},
+  {{ 0x7ebe40d2961deab4UL, 0x11d24c3ae69b47c1UL, 0x15893a0d637d9fdcUL, 0x076fbb523e473095UL }},
+  {{ 0x79b643529c44cbdeUL, 0x53a9675554a3f299UL, 0x7a88015416fac8f1UL, 0x1b6887517f504f96UL }},
+  {{ 0x4bf3ff14ea186c8dUL, 0x89d38f4f207b97a1UL, 0x5a5ec2831fe1b3deUL, 0x053003968939e8d6UL }},
+  {{ 0x337e77f7099dec96UL, 0xc9c7eefae1339c24UL, 0x633aeea08b312eb4UL, 0x05f54682d0ed2447UL }},
+  {{ 0x9ad0fd0855135724UL, 0x3dcfea4cdcd3ff83UL, 0x417f19c5ded3958dUL, 0x2b7ea0f970c4ebdbUL }},
+  {{ 0xa1ae0c02eccf5a54UL, 0x6f3a51b509f0b44cUL, 0xd96d26f5d4943f31UL, 0x0a4962e6c34054e5UL }},
+  {{ 0x06c46dd5145edb78UL, 0x7154db8dd348f0deUL, 0x36b87b321229ff46UL, 0x26b3668edafbdb99UL }},
+  {{ 0x38cb0afafea0939fUL, 0xffdace764b4a5d66UL, 0x220f90a556b3c0e2UL, 0x03e7af4224dbf2e8UL }},
+  {{ 0xe581de88a9f6e03fUL, 0x75056aa4124ae533UL, 0x5e35f32bc67eab48UL, 0x24d85e8a0dced1e3UL }},
+  {{ 0x5adfb7151e2f9c77UL, 0x7723f55ab3987a97UL, 0x2c021bfe2e475f4eUL, 0x24e1c7be7602a9aeUL }},
+  {{ 0x65b6711d76aa7baaUL, 0xb33f2101a57fb5d3UL, 0x6976fac86d2de530UL, 0x032a7c8f2086a7d4UL }},
+  {{ 0xc8ad69e57d296fbfUL, 0x077f5df588ab8d31UL, 0xfc2087b475be41ccUL, 0x09e5651dd6c80f4fUL }},
+  {{ 0x5c2c7d85f85432beUL, 0x790e3700f23ab80fUL, 0xc7c219d5000d2fd7UL, 0x117f77ffe40ecc16UL }},
+  {{ 0xc154db113e34a73dUL, 0x59baad17ec1af822UL, 0x628206f6c783b7f7UL, 0x098edc816f880b5dUL }},
+  {{ 0x6ccdc9c0cb7ed830UL, 0xdfd20b1ddb9a0d99UL, 0x8ee0f8fc3ae9f08dUL, 0x0f4c05376a2abd21UL }},
+  {{ 0xcbda5f66adb67835UL, 0xc349f580b9cdb65aUL, 0x982766eb992168cdUL, 0x0051ac43ffe8585fUL }},
+  {{ 0x3b52f999530a4ea0UL, 0x47791af400558609UL, 0xf76e02b4074382e1UL, 0x1df65b90a87008b8UL }},
+  {{ 0x02f86b9aab4930c0UL, 0x5b41ac7a3678a2a5UL, 0x937a773f09560165UL, 0x18910223515a23c3UL }},
+  {{ 0x8f7d9461125a54d4UL, 0x07ab040a6ce0c554UL, 0xb15f7fa0135549edUL, 0x304562f811c0d3f6UL }},
+  {{ 0x5936b81c960423c1UL, 0x18339a2c0767058bUL, 0x3e10981de3780406UL, 0x1e5fedd5662aa5c0UL }},
+  {{ 0x6d17997a09c36d81UL, 0xb613b1424710a994UL, 0x7af058809ec10e8eUL, 0x1af5a6fee65c5cb4UL }},
+  {{ 0xd77879bb46d5570fUL, 0xbc8549c77861e407UL, 0x6daacdf1f106e71cUL, 0x2b9ed9b8ccb598a8UL }},
+  {{ 0x93f33a5e3ac4e8d5UL, 0x1bddff120cfb43d3UL, 0xe9d0912af52ac50cUL, 0x03c6cdc560e2c00cUL }},
+  {{ 0x2de48616d35ff4beUL, 0x96a12b7d4e714ec0UL, 0xf39ef5ff36e0a944UL, 0x187032e831b71ed2UL }},
+  {{ 0xc359399a06ccf039UL, 0xef6681de19e6df89UL, 0xd059cb0a82e3273aUL, 0x091234e753420bc7UL }},
+  {{ 0xabf3e3e0ca13ba6cUL, 0xff334ce5b7ffe984UL, 0xb627d9612de55fc3UL, 0x07134454fc57572aUL }},
+  {{ 0xd92584ddc7959f98UL, 0xcb7b53da44ff38f3UL, 0x4651f1ad945409f2UL, 0x0c4e26ce2a567c7cUL }},
+  {{ 0xbafe5f6af8913ab9UL, 0x187e33fb71f5454bUL, 0xd759f6e1143559f0UL, 0x005355c1bc888aa3UL }},
+  {{ 0xb5c954eb9c785713UL, 0x12ae165380ef0704UL, 0x7a6f2d35c1c9b8ffUL, 0x1b06f961417b533eUL }},
+  {{ 0xde3ea84e63ed40e5UL, 0x04edd047a418331fUL, 0x06305e90851e4d9aUL, 0x166d8fcaa54e5737UL }},
+  {{ 0xbd125caf15803853UL, 0x9c36726de80d90f9UL, 0x20903dbcb7a46042UL, 0x1b793ae85881febaUL }},
+  {{ 0x1a66d8d9b4db875eUL, 0x888e749a5c453f9bUL, 0xd755053f9f7e70a0UL, 0x032880f054a8be34UL }},
+  {{ 0x35e0f9310004c4a1UL, 0x214122cae861fbe9UL, 0xf3c6eeae28d91061UL, 0x2a8676dcec63f609UL }},
+  {{ 0x89f0b8a3e662ed46UL, 0x383beb1d6f704e11UL, 0x6618ce1c9fd65c33UL, 0x0c652a563ed82e6cUL }},
+  {{ 0x74bea988875c188cUL, 0x3d0f59d8e8fe1c1eUL, 0x475076888cbe7cb8UL, 0x27730ce45a95075aUL }},
+  {{ 0x297e3d530e3c597eUL, 0xa8976265c436acaeUL, 0xc5e8c48695a3745cUL, 0x15933e4e80d86fbcUL }},
+  {{ 0x18bb8eaab75dd54dUL, 0x46154c02ed6d2395UL, 0x51750a1903b70c9eUL, 0x0879bd447081fb49UL }},
+  {{ 0x8b9b59bffeb1b12dUL, 0xf6370745c2972a3eUL, 0x79be577c3f80a3b3UL, 0x146ec54f5b6f98deUL }},
+  {{ 0xcb3c17f6295ced82UL, 0x0e852789333f442cUL, 0x45a79cc28a8d09ddUL, 0x1b844557a07b6d4cUL }},
+  {{ 0xbee0c8a9c242529cUL, 0xa74338ea983da8bbUL, 0x5ba090fcd1e589b7UL, 0x0fee509d6095362fUL }},
+  {{ 0x99266ea7be37f20dUL, 0x5106b4d0795d95b9UL, 0x00ddb478163ef4baUL, 0x176cafb2b317dcffUL }},
+  {{ 0x83ca5d6de1d885adUL, 0x12d23f8784626f1aUL, 0x4fe419ad938c4815UL, 0x2819559d5441b971UL }},
+  {{ 0xad157617567e9389UL, 0x7315553ea1512e9bUL, 0x223f9d0493484d28UL, 0x2fed406a45afd48aUL }},
+  {{ 0xc10524bf66713615UL, 0xb4db90e6fd3ea2edUL, 0x7f9ecff73c08b685UL, 0x16e9a14a637b859cUL }},
+  {{ 0xa941e4d176c59784UL, 0x7a6dbc14933ce1f6UL, 0xd8821660b56d67c0UL, 0x288f0a566598f340UL }},
+  {{ 0x3ff6c332d8bdadc2UL, 0x75e259b9bf3ce02cUL, 0xa939d072599980a7UL, 0x08e11d1d2ee9651fUL }},
+  {{ 0xaa7853ea384d9567UL, 0x687d9c5759120b75UL, 0x3f4a4a1a3d5b60e3UL, 0x10df2d71edbf9e46UL }},
+  {{ 0xb79c1372e8f6a421UL, 0x512ed9a50dbd1d16UL, 0x103b424b74fee354UL, 0x1ffd0902a1b11dcfUL }},
+  {{ 0x718d307a09ee8abfUL, 0x0e59c77cca480185UL, 0xa55d774d69bbdc07UL, 0x15c12a98c3e88466UL }},
+  {{ 0xe98681c98bef771bUL, 0xec060ac3d833a72cUL, 0x1aea2d6199595881UL, 0x1c524e5052b2299aUL }},
+  {{ 0x19c0a617f2d1a220UL, 0x53fc515f468130b7UL, 0xb1884462ec4fe69bUL, 0x050fc4c09c4fcbe4UL }},
+  {{ 0x08015514b2fc6440UL, 0x96fd9df442fda2e3UL, 0x5f01c602bbaa39c8UL, 0x2e54fd1258bdfc89UL }},
+  {{ 0x23500b69152c858eUL, 0x04f97796c87bd04fUL, 0x403bf871a1eb55d2UL, 0x19c2426afa1de68eUL }},
+  {{ 0xcbb5f359b4fff260UL, 0xd02848077f94aa5bUL, 0x6d0be6af30aed290UL, 0x0a323c9634ca50d5UL }},
+  {{ 0x858a078bb76077faUL, 0xadfe8da35439d310UL, 0x210e092fd62a9302UL, 0x15fa27f17df7cf1eUL }},
+  {{ 0x48f993ffd19df056UL, 0x2a465e8faae81f80UL, 0x557103c7ef6d5745UL, 0x06898a2bbcd72213UL }},
+  {{ 0xbe0196bee17388a0UL, 0xc6ebd40b19f605c6UL, 0x7d9bcfe9c5c2b425UL, 0x06a0c6de8677a52dUL }},
+  {{ 0x7ceccbc10ddacd44UL, 0x8d0f729b819e23d4UL, 0xdc29fcbcd10c8274UL, 0x0b38b85aa3c29eb1UL }},
+  {{ 0x5bb71af1c5bbe64cUL, 0x15e5a886ca0a5591UL, 0x70b1ce998d1adfc6UL, 0x19cd01d302b018b2UL }},
+  {{ 0x78ff3c6238be518dUL, 0x7ee0dbcebbd014ccUL, 0xcf1ff02873e555e7UL, 0x1501f5c73357a441UL }},
+  {{ 0xfdedbae2bd72d328UL, 0x67f2af6bb8bd0ec2UL, 0xbc66e748b6acd811UL, 0x02d5d1b137cd42a4UL }},
+  {{ 0x6b6dc56630e5223aUL, 0x45a8795f5f275f0cUL, 0xfc528feb1ed8dcedUL, 0x100b9301ebf4d79bUL }},
+  {{ 0xa2f30a24b1d3e17eUL, 0x575c3c590e5f0d1eUL, 0xb66a7e1da65e346bUL, 0x15f2fe343b5ab343UL }},
+  {{ 0x36748a2315531ed7UL, 0x6436c4b05fd52e3bUL, 0x48bc071cb06fe6c7UL, 0x1a6283b8a095aafaUL }},
+  {{ 0x6b5fcd696f7ddb2cUL, 0x95d8241c6c49dd22UL, 0xf1e8d82296752063UL, 0x1d1d616febf06a1aUL }},
+  {{ 0x522eebd6f0cc1c2cUL, 0x8701fd8aaeffc454UL, 0xabb302aa414b73d7UL, 0x0b34808cd9e1e835UL }},
+  {{ 0x2e0a407a8d7cad84UL, 0x3e2eb0d41faa6c27UL, 0xb330c7dc5dd134efUL, 0x1afa5b216ea4622cUL }},
+  {{ 0x07ecc814822827faUL, 0x127c282ba30d7520UL, 0xb1e326dfddf4a81eUL, 0x274c8eab7867d053UL }},
+  {{ 0xe8d65c00989225c6UL, 0x4a72c2062e97c3f2UL, 0xc596c320aefcf41eUL, 0x06ca477cc7e00317UL }},
+  {{ 0xb1174a94a936664bUL, 0xd161219c61d73006UL, 0x24b929e85c5499d5UL, 0x1d53a7bfced8570fUL }},
+  {{ 0xd35899c96e36b137UL, 0x944612fb521cc761UL, 0x93d55037835a6d29UL, 0x0b634d4cf5afa42fUL }},
+  {{ 0x4744b5c19e98b82fUL, 0xc5ff8f648d43498aUL, 0x1a656e67020cf4f5UL, 0x2426491e0a367b9cUL }},
+  {{ 0x073c87e26dc7957bUL, 0x2a349a659b759971UL, 0x09ca187ef8e4d9c1UL, 0x1fc8059d1d6e902cUL }},
+  {{ 0xf2d7c6aee973301dUL, 0xfef591ad940e3e79UL, 0x2f763f316fe057d7UL, 0x2093483c1fd59586UL }},
+  {{ 0xd55b8bf0fd176136UL, 0xfb48ba33d35b804eUL, 0x1a4a5a3e03b93590UL, 0x03fc326688cf0131UL }},
+  {{ 0x6b583ac85ac19d3dUL, 0xb5340a44833caf5cUL, 0x6439e492ebb42ad4UL, 0x1f5c5be832d7849bUL }},
+  {{ 0x95eb356105003390UL, 0x9d46a1549942a00fUL, 0xd8fce49fce6eb842UL, 0x13f1af19d03eb8ffUL }},
+  {{ 0x6b577e67d94e74cdUL, 0x3bcc37f7243aa960UL, 0x8e07bfb7ed040c66UL, 0x1bccbffc198023aaUL }},
+  {{ 0x4397fb83ac488f44UL, 0x2a55faca2fa4cf1cUL, 0x65f7f6d6394ef303UL, 0x298df7d3bea3ff80UL }},
+  {{ 0xb2d969e7d3b5bf01UL, 0xbf94e085a22b142fUL, 0xcda5ab24c243fa00UL, 0x2fe56f17c31402baUL }},
+  {{ 0xdd7c678dec571412UL, 0x142194b4be23740dUL, 0x1a9aefdbd4d61185UL, 0x101bbe55fefe231cUL }},
+  {{ 0xdb4f8e12978aef47UL, 0x21d6de27587d0cebUL, 0xaea0aff3999be042UL, 0x16fc575e6a6cd957UL }},
+  {{ 0x4bd453dcb821595aUL, 0x4eaec286f2bf2c58UL, 0xdc4aadac7c9dcf92UL, 0x29573292933e5c6eUL }},
+  {{ 0xc329835c59e710fdUL, 0x2afa72754d5e4f1fUL, 0xfde974e37caf97b7UL, 0x0c4876b499d77fb7UL }},
+  {{ 0xee48297749b07150UL, 0x3488f23cb964ce49UL, 0xa0fd533cec684796UL, 0x0f37c63d77d4eb3fUL }},
+  {{ 0x24dbc894ad4a9539UL, 0x7489d76b805dec49UL, 0x4dcbf935a32ef0c1UL, 0x158a1533ae55ae40UL }},
+  {{ 0x149e54e36d30ab18UL, 0x878fd2b01ba25485UL, 0x85fc465b61782e4bUL, 0x2c2354cd21bb52b3UL }},
+  {{ 0x70ecf7513f788676UL, 0xf6ee1c3ffa16ef78UL, 0x86c85ee54656bfd5UL, 0x057fd4399aafe4f3UL }},
+  {{ 0xac9989ee172d3e1dUL, 0x227022c19486d6a7UL, 0xce483bb66ead8658UL, 0x05bc71f4de084d0cUL }},
+  {{ 0xe4873fb6f4c31a36UL, 0x9802a4a4397c54a9UL, 0x6024f4454c4e0c36UL, 0x034938638eff9808UL }},
+  {{ 0x817b6ba57af8f0a5UL, 0xe79da8358eda677eUL, 0xdac2de6fb02e525fUL, 0x20d71c5ab9a12b5bUL }},
+  {{ 0x571a0142e4e70e78UL, 0x8c2d7609dba466b5UL, 0xc1211ec4a4807393UL, 0x2d6bf4552ea79a19UL }},
+  {{ 0x5964a8843a81e4a0UL, 0x4a6661733bef5429UL, 0xbabf8c4f03fa67e1UL, 0x1703332923fc8387UL }},
+  {{ 0xb99ce2d2dfd1a3c9UL, 0xeb8fefb97952bf3cUL, 0x958868c63471d1c0UL, 0x11aa36d7468fd9b1UL }},
+  {{ 0xeb7d054f0b7c5476UL, 0xb8163a01e6c56741UL, 0x44c54195d1f67e94UL, 0x2bb8e6d0c5b9ac6cUL }},
+  {{ 0xa92c8fa0b23d0e51UL, 0xd6f81bdb71862979UL, 0x40d08a5b55800030UL, 0x0c931b4188ceedc1UL }},
+  {{ 0x887f9193a028603fUL, 0xcdd1f1b13db37cd7UL, 0xe05ac91dabb47f14UL, 0x0ec07c4c571b881bUL }},
+  {{ 0xd6027f3e5fcbea08UL, 0x3d30ba09c784795bUL, 0x769a745513804008UL, 0x0d72ab8a8a62ae7fUL }},
+  {{ 0x5520a193d2f45d59UL, 0xa4d19bbc966ea16cUL, 0x95d077fb0db6d426UL, 0x2262c64084475fabUL }},
+  {{ 0x1b2ec2db8f6b350aUL, 0xbaf053b82ddf4098UL, 0x5a5b48d2b7289b05UL, 0x2eb75e4e17ad5a0bUL }},
+  {{ 0x134be52104ab257aUL, 0x39bc773fddc9f363UL, 0xc5ea3d16ef02a260UL, 0x1fba06ad82ad5568UL }},
+  {{ 0xfdc156601782a629UL, 0x7f90521f58221134UL, 0xc40d9e0889c44264UL, 0x2ca6dd773d44cd4eUL }},
+  {{ 0x7cba54535ad93825UL, 0x28cbe89ebf0de7e7UL, 0xe1d58a1bc0724c9bUL, 0x24fd072e5259f3a6UL }},
+  {{ 0x1e26ba2607e4a029UL, 0x9683bf46bf0e186fUL, 0xab38720c607bf7f6UL, 0x2013345244a1dfa4UL }},
+  {{ 0x03dfe63c11f18eddUL, 0xde1784fc47ebba01UL, 0x9b5664f2945ab8c0UL, 0x09cca17e996f0345UL }},
+  {{ 0x533e595d46f5fc11UL, 0x0d0ea8e45e4e77f9UL, 0x85f6cc1094f51b3aUL, 0x118cbc9787682cbdUL }},
+  {{ 0xb293d9d27294981eUL, 0xb6bf212e3c55a4c2UL, 0x817c37abaac8a735UL, 0x21ab4e1e62d22af7UL }},
+  {{ 0xeba389a2eb139edeUL, 0x14e2e339eecaa8b8UL, 0xf5b1745b6897e3a1UL, 0x12dff8fba9165806UL }},
+  {{ 0x5dfac86d41d25512UL, 0x811c5fb4b3d43f91UL, 0x4bba927cf823d55eUL, 0x15c89d6f8115d3abUL }},
+  {{ 0x53b5aee17542f3f7UL, 0xbfed1f233731f9d0UL, 0x9992d8224f815a73UL, 0x2b5ae957b07ebf43UL }},
+  {{ 0x192506e6673519b7UL, 0xae41d8b47af742f7UL, 0x3380b67160298921UL, 0x128a68eb8030e0dfUL }},
+  {{ 0xf50d629f71c67b46UL, 0xbc3f4a46a8c62fd6UL, 0xe0a4f1bbef63e7caUL, 0x2f4db2463136bf94UL }},
+  {{ 0x0345e011b4f8f685UL, 0x05af0fa7a2b9fa1eUL, 0xadf0c24045d5cd67UL, 0x0dd3e231ee9f42b0UL }},
+  {{ 0xc245a8f7bfab9e65UL, 0x4b48566fcb3a3e20UL, 0x592a3519f7bbfc5fUL, 0x2532f9c2d934ae0aUL }},
+  {{ 0xa8cec09d29ee5cc8UL, 0xddb06758ce64265dUL, 0xc264cf428c4295ddUL, 0x2b97fdfeb370f873UL }},
+  {{ 0x4a46d88c1262d33aUL, 0x6da5a93a7c834ef2UL, 0x01e9485b030149b3UL, 0x01023caed6427063UL }},
+  {{ 0xb67063a04d84bd27UL, 0xbebfb72a89dda82dUL, 0x4371b3f3729df172UL, 0x29634a16a597c837UL }},
+  {{ 0x3097171830414802UL, 0xc1c0db3061c9d037UL, 0xb1ed3ba05cb3a4baUL, 0x2349b98b1ec10cadUL }},
+  {{ 0xc03a2255cd829c72UL, 0xa1680392492e7531UL, 0x7c93b378ed9f7990UL, 0x1264c5cf363d4830UL }},
+  {{ 0x8b3eaae0e11c5659UL, 0x38fcdc5c757060c8UL, 0xd7cad45c48c2796aUL, 0x184d12d704464eaeUL }},
+  {{ 0xf15f90d99d564e18UL, 0x3b1f8f02d188960aUL, 0x72a7f0d8bfb3cfacUL, 0x1c5bf2dcf9510409UL }},
+  {{ 0x28cf4ad332c1cffbUL, 0x344524bf5c6a93c9UL, 0x4137b7aaf2493032UL, 0x08a77c948b6d656aUL }},
+  {{ 0x8b10e420bd9133d2UL, 0x575796f9d57bdf1cUL, 0xf3524c6d8947ea7aUL, 0x2e8790209890f643UL }},
+  {{ 0x46e14defdc7107afUL, 0x87d7dd5ca094cb6dUL, 0xb7727bd096da4381UL, 0x1341a562f895ed42UL }},
+  {{ 0xb8613ae450a9c2b4UL, 0x70d90b30402ebdebUL, 0x2d014bba06a9eeeaUL, 0x23aff12b1b3bc4e5UL }},
+  {{ 0xdac3bf7e719a4c05UL, 0x1890f9ea883905dfUL, 0x459bfb80b8fa12b8UL, 0x1b640f70fe61940dUL }},
+  {{ 0xe96be0f8fb35bfacUL, 0x66a7981104bb3a88UL, 0x474929134eab766aUL, 0x2ff308337bcaae3dUL }},
+  {{ 0x796bc9f4073feadbUL, 0xd9567ddcf50a6d10UL, 0x54fa42586d308007UL, 0x0cd4f4fc8d73b1b2UL }},
+  {{ 0x172c859077f20559UL, 0x1ea7b1c1c673e571UL, 0xe3e84474abc3ab24UL, 0x088954ba736a62c3UL }},
+  {{ 0x9ee3915bc34b0407UL, 0x0c20e4aad8bdf640UL, 0x0e0b4d869ba0bf31UL, 0x05df574ab1bb940fUL }},
+  {{ 0xa39daed000b13d07UL, 0xe9be7c91904a2337UL, 0x6afe69220871aebdUL, 0x194fd2be21255f21UL }},
+  {{ 0x25940b3fd5518487UL, 0x793fdeb6e8be801bUL, 0x99f6a2e89b256668UL, 0x105dd8ef6f11210dUL }},
+  {{ 0x1f18ab928b0d3ec2UL, 0x4db6fb735945d7efUL, 0x0b5734a390633c7eUL, 0x0e45347ce6dee5c6UL }},
+  {{ 0xb3a1c1e9b52cffd6UL, 0x38f4d63cd55b329bUL, 0xb21d73d9f36caaa8UL, 0x1d946ac6e4be9f37UL }},
+  {{ 0xf5b9ffb5fe1b812eUL, 0x83b2a635959ec4f7UL, 0x250d4347f2b065a8UL, 0x1075fc1570edd5a5UL }},
+  {{ 0x50d00a8b38ad0cecUL, 0x2c5d2d454768ce70UL, 0x49e653e0e30746c5UL, 0x2aac7fe91699e673UL }},
+  {{ 0x736f495ff4d80352UL, 0x6849e79fb25f80b4UL, 0xc4f35d1060ee5b2eUL, 0x12e5a815b058e8e1UL }},
+  {{ 0xb3f0702b87974680UL, 0x64f59a449794d98bUL, 0x7f4816229bf6e187UL, 0x0431b2ab63ffe7c2UL }},
+  {{ 0xb1391c1c988dc9fcUL, 0x1061119f95dc633dUL, 0xe6daea4f76d9078bUL, 0x127018a158f78d36UL }},
+  {{ 0x9dd73ce983830ee7UL, 0x0cd2e50d9cb8f37aUL, 0xaac4b105b30b3a85UL, 0x2eef6e8282cc5783UL }},
+  {{ 0x7a7a97a0aad09d7eUL, 0x5ef4a32944fd3ea3UL, 0xf04a110f238aedb6UL, 0x14c264da34894a29UL }},
+  {{ 0x6edfd1cfb2f50929UL, 0x3cb24721da7f7f80UL, 0x867f9862800d11e2UL, 0x23b79a43a89d02a2UL }},
+  {{ 0x1c14f6e779c9ec12UL, 0xaf52ce7f2237dbe6UL, 0x03e63f64db706d48UL, 0x046b71c45b2e2fabUL }},
+  {{ 0xad581e8ce3c3f285UL, 0xe3e7bd053a70d32aUL, 0xbf0b7fb5924d002fUL, 0x083897a11bd9e292UL }},
+  {{ 0xb67a3b15b3415321UL, 0x15c8df728ae3e637UL, 0x6c4c9723f3e4c129UL, 0x00a5efa5b03ed05aUL }},
+  {{ 0x04a75fe9ff08f355UL, 0xbf2eefaf8a2523cfUL, 0x852e734c808a0dadUL, 0x1d7b99e2001cfa00UL }},
+  {{ 0x4455abdc7ee0c12cUL, 0xb2ce0e60d736d4c4UL, 0x370db955c39e89b6UL, 0x0d1517171f03e45bUL }},
+  {{ 0xebf5e3159cc10c15UL, 0x45c2f85c54af784cUL, 0x770037eeaf92850dUL, 0x300f87afd63edfe8UL }},
+  {{ 0xc938a5c91736958fUL, 0xab25b2e1b7e0fb89UL, 0xc3615b1584d39e51UL, 0x0e0e3b518c37290bUL }},
+  {{ 0x08e5257cb47ea54bUL, 0x88a984d2ca9d009bUL, 0xbe6fdbd7cc4272d3UL, 0x06f7d47c1d061efcUL }},
+  {{ 0x62e90fc5e66e43c2UL, 0xbb0b02c23d0ab03fUL, 0x37e4e2afb9257b71UL, 0x2becaadd9a738cdfUL }},
+  {{ 0x37d02775c0e51b1bUL, 0xcf41cd12005069f1UL, 0xec0cc27eefa0616cUL, 0x2b62e8738b978471UL }},
+  {{ 0xb7be2b94b17d4231UL, 0xe05568485b9c8471UL, 0xe692d0603ece0444UL, 0x0b81e5d7cf238222UL }},
+  {{ 0x133f6f36e1a682e7UL, 0x8cb0e226873ab908UL, 0x6397c348735309e2UL, 0x090e873a537e9984UL }},
+  {{ 0xc3032b90a340a3edUL, 0x997d856e8b4af9b8UL, 0x6946dd8973553201UL, 0x214e76d16bfa85dfUL }},
+  {{ 0x29a47efbdc3db114UL, 0x8db3d8d0d85816eaUL, 0x2e03b5df6ae3c91eUL, 0x22289d397c45a690UL }},
+  {{ 0x12862f7c584809c4UL, 0xc1dfe4c8a117b578UL, 0xa0df62d7cfd95a1aUL, 0x0f8161a555607306UL }},
+  {{ 0x79588c66fb0a5871UL, 0x4ed6086e7f3468b6UL, 0x1946b176a72345e7UL, 0x2b2bdaa170f0dfdbUL }},
+  {{ 0xd3853af1b1d830dcUL, 0x4c031c314654debcUL, 0xb65443631cbd284eUL, 0x25b176b3bc28d4d5UL }},
+  {{ 0xa084216f20fcd7f0UL, 0xa027ae2751488085UL, 0x4a1cdaf5aeacef22UL, 0x106190eefb9dc509UL }},
+  {{ 0xa6f91402611bd9c1UL, 0x209dee3f38079ab9UL, 0x1242affb58a60ff7UL, 0x27a2e19cc5e30083UL }},
+  {{ 0xe55bc63503791ee9UL, 0xfc94f64d0e72d72cUL, 0x2699c756e45a0571UL, 0x086831de4c1d057dUL }},
+  {{ 0xc75bb5c03aa48658UL, 0xafe1d77b6d64d7dbUL, 0x1c6bfa41086b5706UL, 0x23fb020e7f06fac4UL }},
+  {{ 0x7f368ded695cb5edUL, 0x5a372dee6a6853b9UL, 0x0c90c323c60f53cdUL, 0x29a7d6662548d3eaUL }},
+  {{ 0xe06f986e2764335aUL, 0x2b20ea34af2268a8UL, 0xa65933967a0e2d29UL, 0x11a72d842bc60397UL }},
+  {{ 0xf4ac3d2f7b8c69ccUL, 0x0598702555cc2706UL, 0x8721be2446eba980UL, 0x2e702cc84b278ee3UL }},
+  {{ 0x5d1bc53c396e5516UL, 0x8b9fca7b79045a6cUL, 0x2094d4f377f37a51UL, 0x12574b08fb7e1bdaUL }},
+  {{ 0xa67ffd8775a7bf35UL, 0x8641e1e38f6194eeUL, 0x290654b84d062b04UL, 0x1ea4fdf186396b52UL }},
+  {{ 0x3842ecf9b444f54aUL, 0xfc6015e282919347UL, 0xe6219c7dc39077f8UL, 0x1fb0681973dc3dbcUL }},
+  {{ 0x39e49747446541afUL, 0x0eadf73d30291ce9UL, 0x38a15708a53935e0UL, 0x037374292233d96eUL }},
+  {{ 0x8f5cc087af31114eUL, 0x69c853a328358657UL, 0x44294986319d3b8fUL, 0x0b22f0a2e5d0ce42UL }},
+  {{ 0x7e9415d49f669a35UL, 0x55204846ed52f9c0UL, 0x9212bec81ee41707UL, 0x0e5320fd314d5732UL }},
+  {{ 0x08efbd4984cc244bUL, 0xba6da1e4423e9828UL, 0x085c266f51154d95UL, 0x08fdc5cf74c367aeUL }},
+  {{ 0x1567266624ce2b42UL, 0xbd356f299d9f2e3eUL, 0x4b3803db3bd60447UL, 0x0d0374cd42d86d3fUL }},
+  {{ 0x4b4ede854440c43dUL, 0x466dcf65a352bb96UL, 0xec9255e0bc3685dbUL, 0x17ebcf6e8900591aUL }},
+  {{ 0xa97416f246567fb6UL, 0x16cd38d192db71baUL, 0x19d505e40836505fUL, 0x194d555ed5d37514UL }},
+  {{ 0xb0b1649f1718d257UL, 0x6a8513d166c601a5UL, 0x6185233e672f49b6UL, 0x0b24a939653c3cf1UL }},
+  {{ 0x369af582b244557bUL, 0x46d689b19e85bb00UL, 0x14dd6e4777912e93UL, 0x1a5c75d766e47aeeUL }},
+  {{ 0x8f1d2bdf81b56497UL, 0x73488035c1931355UL, 0x043dabc0abf73eb8UL, 0x2474b2c56acfdd5eUL }},
+  {{ 0x370ae81593c8b0abUL, 0x44ec05ac03f1738aUL, 0x3b81193f41ea093fUL, 0x1ce26fe39fe94380UL }},
+  {{ 0xcbc742d0a60f1dc1UL, 0x86dfdbcdf87de276UL, 0x6c5dd2e7aaf7adbaUL, 0x055f3dc80ef3e6beUL }},
+  {{ 0xa78fe33a901b24dfUL, 0x7fc938749120ec14UL, 0x868565262ce969bcUL, 0x06d64123c6af6703UL }},
+  {{ 0x40920be7a0b730f2UL, 0x987191ab98b42e6aUL, 0x036cfd4a03e0e241UL, 0x2a14061ace0a69f9UL }},
+  {{ 0x2d0abaa3536d217dUL, 0x23acc3f0d49235f4UL, 0x87ea31d8e9343030UL, 0x0ba30e28eeec78b3UL }},
+  {{ 0x82dd6f023cfe62d0UL, 0xbccdef0c703a7219UL, 0xd0efbb3f8574e799UL, 0x2d3abe376dfe414dUL }},
+  {{ 0x8e79ef30aa3691b3UL, 0x600f2272ce1399c4UL, 0x966fc81b9de03007UL, 0x1acafa842ebb7bccUL }},
+  {{ 0xaa1f5f853d4fc292UL, 0xd4e254036da8b83cUL, 0xa21772b0167e5723UL, 0x22ee7db13f1255b4UL }},
+  {{ 0xaa33705c7accc7f9UL, 0xe9dbca689a6c263aUL, 0x2d576cfdac347361UL, 0x0eaab5ff68bd0dc2UL }},
+  {{ 0x6dea0d627d3c67d6UL, 0x9d0e1bf713ce35efUL, 0xfe722a9fbbe468beUL, 0x2f85e689aeaa063aUL }},
+  {{ 0x277bd172fe4b0264UL, 0x325d0447d4b315d4UL, 0x6415d98718492782UL, 0x1dc637a571ef9fa9UL }},
+  {{ 0x9e8f635b962ba278UL, 0x969e5647c88771eeUL, 0xe8d7b438fecb3de3UL, 0x02d4a62afe6eca8aUL }},
+  {{ 0x6fb09186079119ccUL, 0xd4ecac0f6c4a1af6UL, 0xf1d041b6e1591590UL, 0x02f78134a0ad4968UL }},
+  {{ 0x886557c6c4a47416UL, 0xc0a5806b01b66a48UL, 0x5667331be9b8d5bfUL, 0x02bdd38c95207088UL }},
+  {{ 0x4e8e379da58d3ae2UL, 0x94437cbe8948b45aUL, 0xc23b37cc070e5c97UL, 0x24ef1c00f1425e9fUL }},
+  {{ 0x735007723cb7b42bUL, 0xda994fc6d40be4edUL, 0x78babf48bbbd9d95UL, 0x0dfd2b1a52e70599UL }},
+  {{ 0x48271edc863e63f0UL, 0x27de37b062a18383UL, 0x12391a415dc38b11UL, 0x1055c341eb8c6ab8UL }},
+  {{ 0x08d00c4d960c81c9UL, 0xff7db2a22108025bUL, 0x351471c342e8c480UL, 0x279b11b92d04504eUL }},
+  {{ 0xacd32fafc885c085UL, 0x5b407e004a6ff3d1UL, 0x20c7d02d1f107d54UL, 0x2cb5b75f49152dbdUL }},
+  {{ 0x42487d244812c3faUL, 0x64f64e8732562177UL, 0x665995170ff7cffaUL, 0x25dbdf1ed14e99c8UL }},
+  {{ 0x6768fc732a518c11UL, 0x689413deec07e5a8UL, 0x04179947b0792140UL, 0x0bd5393cd4e06ac7UL }},
+  {{ 0x1fed6454817c7287UL, 0x629575864f660e26UL, 0xb85883e27f620956UL, 0x0f08ccc81f848c54UL }},
+  {{ 0x3940945369329be9UL, 0x25144f7da314268aUL, 0x9b36ef7d1628a182UL, 0x20e64c0bbf7b8c09UL }},
+  {{ 0x413c4e089e46611cUL, 0x6c17d68f1fb3cb73UL, 0x50d0f36631b9e5dbUL, 0x2d3365d3d7ad6c92UL }},
+  {{ 0x5e3104b4d1d681c0UL, 0x7836d2aad252ec0bUL, 0xc8e153b4c696b05bUL, 0x11076eb8c3e96dd8UL }},
+  {{ 0x29fb6857d52a00f1UL, 0x3b29483427c96e92UL, 0x7ca09bd209bd788dUL, 0x215e20ff7388efb9UL }},
+  {{ 0x4859126356c0aac2UL, 0x3d6c121a04296b83UL, 0xb715df4c6657a317UL, 0x01fa6d6335ef86acUL }},
+  {{ 0x7c4e33bafc923702UL, 0x6b0fcb83842583b3UL, 0x97adb1b71036cab4UL, 0x1b48ac2aff03761eUL }},
+  {{ 0x87948c74e16f1cfdUL, 0x6e5ca5722906e3d2UL, 0x44fc3d5668f2f6e1UL, 0x1b4362c5dc6f9d37UL }},
+  {{ 0xc035fe85a90eaef6UL, 0x181614a2aeceffc7UL, 0x6bd0c36bb493a8eaUL, 0x019a392155a11c45UL }},
+  {{ 0x403c85ee911df7e7UL, 0x555991cf07109623UL, 0xb19e06209af4a16fUL, 0x25a5619a97ade441UL }},
+  {{ 0x128e381d29cf3676UL, 0x3071d0588e572830UL, 0xe8e76696b0a72bd0UL, 0x1a050820c0eddf2dUL }},
+  {{ 0x9e1cdc4f16675341UL, 0xe93c243b87adc01aUL, 0x85cc9c4c786381a6UL, 0x1a9178da16461887UL }},
+  {{ 0x8920f558365913fcUL, 0x1d266fb80489b0aaUL, 0x256aee1edaecf1acUL, 0x0335054c62622c7dUL }},
+  {{ 0x346e6f7f89b061d3UL, 0x003f20c39637bb06UL, 0x013307c960420be6UL, 0x2e837b33a35bae5aUL }},
+  {{ 0x7ac6ebd7113c6e91UL, 0x280a7efb212851e1UL, 0x58b8d644e854e8d0UL, 0x2a924f69b0f938e3UL }},
+  {{ 0x25de0d4f606feb87UL, 0x96eea46b0c8b51e7UL, 0x8588fc8317225577UL, 0x21bf786df565f9e2UL }},
+  {{ 0xb6f29a114f8b13ebUL, 0x4575919abb69638bUL, 0x784b80714358bcf8UL, 0x2c1dd2cb4915c644UL }},
+  {{ 0x2476362607865782UL, 0x2dea8c138bea4ddcUL, 0x9909fe06e3c33b53UL, 0x01ac1b5bbd159d11UL }},
+  {{ 0xfb393e2e99dca672UL, 0xd250ca943dee0e32UL, 0x8c73bac9877a124fUL, 0x2e5db5bb3c9111b6UL }},
+  {{ 0x822adaf8c383f0b4UL, 0x6c30148fcf6b729eUL, 0x08579eaaffe92f5dUL, 0x0ab4cf3494dd9134UL }},
+  {{ 0x4a8d84a8024b9f38UL, 0xc1bfe3259645b3ccUL, 0x2ffa5bdad45e148aUL, 0x1c8d7d47e18cc6a7UL }},
+  {{ 0xbc2aac23c331c3aeUL, 0x6030042630f3e47fUL, 0x50c272ad2f57a27bUL, 0x0179e318df0465e0UL }},
+  {{ 0xd3e253ab7c947931UL, 0x35c4187371f78159UL, 0x5eadc52e034850a4UL, 0x0226959632ecd82dUL }},
+  {{ 0x396d61c1a3bb4721UL, 0x0863fe2f13973b56UL, 0x8b8680d211039906UL, 0x156fe294bcdf0be3UL }},
+  {{ 0x74369b7fab09837dUL, 0x4fac744dfcb346e1UL, 0x5f6e89ae965c6596UL, 0x243c98e8030f4b03UL }},
+  {{ 0x61fb96de795981f3UL, 0x7b173a590b9f0afbUL, 0x2769c462c715e882UL, 0x18b21ae9b3ec5b32UL }},
+  {{ 0x7ad39cbf2eb5add3UL, 0x519101ebff42d37aUL, 0xf8bacaa59c726686UL, 0x137124f7f4f0749bUL }},
+  {{ 0xb6a94b5f3108a356UL, 0x2eba88a99e3d440dUL, 0x274bc7fd6364de90UL, 0x09c9f6b4557118d5UL }},
+  {{ 0x11430380204bec8bUL, 0x6d53cfdc8d9e93ccUL, 0xf7ca53bbc2576651UL, 0x066d1f7acec2b3a8UL }},
+  {{ 0x6f385f62df85f823UL, 0x145a0eb9d8a6a7aaUL, 0xa9c093661e0b214fUL, 0x1df2955ccbf148f3UL }},
+  {{ 0x83c8462eb047e6ceUL, 0xdb676726ddae7ae8UL, 0xcce0b478fb9fbe83UL, 0x010e412cbbe6c40eUL }},
+  {{ 0xe5e182a498067ca1UL, 0xd14047defa69db30UL, 0x04ce8e513c5c35f9UL, 0x2690653cec6d4ed0UL }},
+  {{ 0x8c57dbd07d41cee0UL, 0xfaaf4da5db66f83fUL, 0xb281e1a294a59c9eUL, 0x2e696536e5ccc682UL }},
+  {{ 0xe00a624a0a11c50eUL, 0x4f59e81a97a5e7f3UL, 0x03aca7568799b6c5UL, 0x1b0868561673e44cUL }},
+  {{ 0x6d266574c8c1c24eUL, 0x3858f8ba24710836UL, 0x2f8bc818effb587cUL, 0x032be4717e7388cdUL }},
+  {{ 0xf1d28f93c02ecdd4UL, 0x371875195f0a80ceUL, 0xee117a6f01442bd9UL, 0x2568864dad189eadUL }},
+  {{ 0x021822ac88b04420UL, 0x9f512f173e21089dUL, 0xf1a63e702cf41fb1UL, 0x1447f74ccbc69fd7UL }},
+  {{ 0xa5025bb2d25ed06bUL, 0xbc85dcd27b8c709dUL, 0x2c87fb3e998252c2UL, 0x01433749bda836f8UL }},
+  {{ 0x71a9876caab078d2UL, 0xed7162b1f1de6ec9UL, 0xe65d2eabee395a4eUL, 0x26b46fa6a3840ad9UL }},
+  {{ 0x411d44ec6dd5fbd1UL, 0x130ca750a5224d39UL, 0x42301b5f1ecc0668UL, 0x14aa4ec96d3f6a29UL }},
+  {{ 0x4ba0a80093984ea0UL, 0x02c4f38f16cf296dUL, 0x6468dcf198d04189UL, 0x0a2a42ea03215607UL }},
+  {{ 0x1a93015b1ae4043dUL, 0xe2e285c9c22002acUL, 0xff76f553a2c5b89fUL, 0x1e3e54fdb1f96da1UL }},
+  {{ 0xafc817c77fbbf8d8UL, 0x19f3abe33b0805c7UL, 0xa5084c2cb330f0d4UL, 0x250037389e47d818UL }},
+  {{ 0xe5c15b151d7ed715UL, 0x028cc3ad05942f1aUL, 0x12397e3846a82180UL, 0x18a3a43e6d55dc0cUL }},
+  {{ 0xcba19b7bbba07146UL, 0x95ecb7cabb112565UL, 0x2986a4e91e99aaafUL, 0x29bd45c297693fa6UL }},
+  {{ 0x0de5685c3bf755abUL, 0xc03ca5fab94dad81UL, 0x4129f2381b1bd648UL, 0x2314a01398c133e6UL }},
+  {{ 0xf9632b082a207805UL, 0x56816fe3d4ef602aUL, 0xccf27b68a797b7bcUL, 0x20d0c7958097da99UL }},
+  {{ 0x48959e1745ed89b8UL, 0xac343deabeae5e47UL, 0xb0530006ba42c49eUL, 0x152d77e969808c61UL }},
+  {{ 0x438915a1005ad5ecUL, 0x5c7a6f14e0dd1b7eUL, 0xe6ca8708c2fd1a89UL, 0x165ba669c294d65aUL }},
+  {{ 0x19dbb4a8822c4681UL, 0x228392c150c0a380UL, 0x56ec5b7387451331UL, 0x20883ae64bba476fUL }},
+  {{ 0x44b1b3fd239aa23eUL, 0xe774af4b854453a5UL, 0xf646d63a79d227d5UL, 0x15449c11fdbe2893UL }},
+  {{ 0x3eb53a58099f3053UL, 0x444593a6dc8f8012UL, 0xcb574cb13ea30cd4UL, 0x170105b84dce2253UL }},
+  {{ 0x0b918cbcfd8cff54UL, 0x31fbb2a7410253e0UL, 0xf781d9396d97359bUL, 0x14f5deef6b600ce3UL }},
+  {{ 0x7f04a78dde4f1bdeUL, 0x740e39843adb2193UL, 0xdc7ceb1145d744d7UL, 0x275102d3892e21d3UL }},
+  {{ 0xc233cb7994846e95UL, 0x756f313c2752b158UL, 0x4307e233a2b29d47UL, 0x22fe03ceb8507675UL }},
+  {{ 0xf67114df3017e10aUL, 0x79173499531fc0c3UL, 0x6378051b98a5e15dUL, 0x1628175298d4a65aUL }},
+  {{ 0xdc3c57dbbeb80845UL, 0xf9b704ddab65e9dcUL, 0x7d23f61f85bfa7fdUL, 0x2049a3df77fd861fUL }},
+  {{ 0x5c4df03c3afb4b37UL, 0x6f1a31f3d49407c2UL, 0xeaee572fa24f9514UL, 0x2c27c1ec22d71abeUL }},
+  {{ 0xc3b7934147c07f72UL, 0x89ceea869b66487bUL, 0x530ee64ead74dd52UL, 0x1a10765ca0c0b5f7UL }},
+  {{ 0xdcc7d1549a352ea8UL, 0x1a2bbceb6086a543UL, 0xc72d2474be378608UL, 0x1fce68a2a6d957b0UL }},
+  {{ 0xfc8e849c3be449eaUL, 0x982e040c7b41df22UL, 0xc447bdbf9deb383dUL, 0x0be0c084f14de704UL }},
+  {{ 0xb4d782dfba792161UL, 0xc12d4d49f096864dUL, 0x9f6a181e2f88c6b9UL, 0x16bdd1f6fc20d106UL }},
+  {{ 0x9f62c3fd91f69413UL, 0x2ad4012022048d99UL, 0x9358cf51dc754713UL, 0x2c953843ea1c8830UL }},
+  {{ 0x83cc7255a3eea90cUL, 0x987620f1e91098b9UL, 0xb27a003fb08e60a7UL, 0x09d81ae9278daee0UL }},
+  {{ 0x23af692568688e37UL, 0x3234ed1eddf2b654UL, 0x9bdce1c535ae8d84UL, 0x191b2455792e2e49UL }},
+  {{ 0x7d69f5bc2fa95f6eUL, 0x69c952e3be12d25aUL, 0x6fa5bf41febad0c6UL, 0x1e4e5fd399ff8057UL }},
+  {{ 0x7ddf7872fad93c15UL, 0x05cf556e9b51c109UL, 0x4df807063f66b9d2UL, 0x0b8fc9ec29a71769UL }},
+  {{ 0x318377106a6352fbUL, 0x2463ee5fb865bec0UL, 0x14de870cc99cd385UL, 0x06394ca673b15ce5UL }},
+  {{ 0x7aeefcbb8148d8abUL, 0xb7f89c6024e3f98cUL, 0x31520a17a0c491b3UL, 0x0ea8bbef24adf685UL }},
+  {{ 0x9ad522c80f7e9b08UL, 0x455a5b7074f3c366UL, 0xbd25bd1825019883UL, 0x120b0f4241899135UL }},
+  {{ 0x879b32000a102f53UL, 0x157a23267f5c635cUL, 0xbe596fa74484101bUL, 0x0f466c879903e7ebUL }},
+  {{ 0x1f021c5274223548UL, 0x27709e441f9fcfc1UL, 0xae2b80236d27d2b0UL, 0x29ec9cc60b8fe9d9UL }},
+  {{ 0x6db3e20c819cb578UL, 0x8048dff4a8de4173UL, 0x0fbced28a0aa7e39UL, 0x297330ed712d6a1eUL }},
+  {{ 0xc399ae0b11e12870UL, 0xc7253d4064624e1fUL, 0x1f788a17d8be858bUL, 0x2779532021898dfbUL }},
+  {{ 0x446bf9478661a12fUL, 0x5fc28e70711bf839UL, 0xb58cb3ccf342c0e0UL, 0x1647d3d618780e98UL }},
+  {{ 0x84e20624901eb97dUL, 0xc47c47e473c0b121UL, 0x0c93335ec193923bUL, 0x106600fa071bcb68UL }},
+  {{ 0x3634d28cc5b6e815UL, 0x78851e439b363ee9UL, 0xde23c96d9f73fd0fUL, 0x053e43a127af364dUL }},
+  {{ 0x23c0b715e6284ac1UL, 0xc24a4ab784a8d294UL, 0xc8e104b09317ac0bUL, 0x2cf2b3bec6bf2343UL }},
+  {{ 0xdc16f411cdf06f41UL, 0x85e333d22b2d35f0UL, 0x16b5133957a67cbaUL, 0x060d76237df11a49UL }},
+  {{ 0xf1ca9af54e252640UL, 0xe11cec9351a7f7deUL, 0x05710baff8d3917bUL, 0x11a102fc02f1c53aUL }},
+  {{ 0x2a3331ab900e3a3fUL, 0x7e0d3d1ecc5a9e1aUL, 0xfbff2d8907f71cccUL, 0x10da87c55f8c8b17UL }},
+  {{ 0xec6ab77c0cb12efbUL, 0xaad93c94cd0ced14UL, 0x644422dcf9deffa8UL, 0x21f71cd5fc9769e6UL }},
+  {{ 0xd48d3802682df455UL, 0x8b1cab15f59ccf04UL, 0x3fdb602b786dc162UL, 0x2e8a8422d71ce736UL }},
+  {{ 0xbaf9041d4905d2e0UL, 0x7f2ac2fd0e76e6a7UL, 0xe13b42472ff30250UL, 0x1f48b70d4ba873faUL }},
+  {{ 0xa52f2be04adccd33UL, 0x5893733363b54a92UL, 0xa5ef4d2636aa3aceUL, 0x0e6e55a68e208d16UL }},
+  {{ 0xa84cd87146fc9c3dUL, 0xd0e2a969a8e2bb2eUL, 0x934a205ebd5b1ab7UL, 0x28715e3a699260faUL }},
+  {{ 0x9f1c67dfc3a707a7UL, 0xd785f0165235fccdUL, 0x08624fab08671eebUL, 0x27113a319e143d56UL }},
+  {{ 0x46067b9b0bf429ecUL, 0x2352e95d1cd55a26UL, 0x9327e6bedbeefe9cUL, 0x2b614aa576067549UL }},
+  {{ 0x8930edfe7b1d0fb4UL, 0x30ada4456b6e4874UL, 0x537fa30c4b9dce81UL, 0x2456647c43a320e0UL }},
+  {{ 0x49c9209e46bebb16UL, 0x4bc336beb7c7213bUL, 0xe559dc5bb3f8439bUL, 0x20fcf286bda81f67UL }},
+  {{ 0xd5b7a3787fbd60edUL, 0x2be0e981b35d5578UL, 0x4aead607f64b1048UL, 0x147b50afef12b43fUL }},
+  {{ 0x9e5fc992ecad0491UL, 0x56694989c1ff6627UL, 0x4d1f1258056a8c70UL, 0x234ddb7d090d8110UL }},
+  {{ 0xfa1ba834a8e93730UL, 0x9628cf0942332bc5UL, 0x8b77305e96a631d1UL, 0x06ce50627f4334c9UL }},
+  {{ 0x772e6c4e108a5a73UL, 0xf95c6a3061dce200UL, 0x5a0f8daea29d709cUL, 0x248564bf1670f022UL }},
+  {{ 0x961f08b242433282UL, 0x6d83fdcd6124f84eUL, 0x24ae55efef159750UL, 0x21ea25bce7f3208bUL }},
+  {{ 0x36340747f59d0fceUL, 0x02d11be8bf6d8618UL, 0x23a2a2011f139109UL, 0x06d4d86cbb2d49f0UL }},
+  {{ 0x64000d6ba899694cUL, 0xc99e687e7389544cUL, 0x26b751a4cc3b0c42UL, 0x1ff249b8673ff3e2UL }},
+  {{ 0x1f34bc61a2a8d42dUL, 0xc197f7b74bb915a5UL, 0x1f56171452a31b23UL, 0x16d68516bba79ef3UL }},
+  {{ 0xe318c4e979ab6beaUL, 0x19c3cc513f7f2573UL, 0x9a4cc47700eda429UL, 0x2c7bab2b8a259a65UL }},
+  {{ 0x5f7e9d747576d8efUL, 0x6c3fd3f7a507e363UL, 0xf9f46e667a3e71f8UL, 0x2c58c5d5fa6b2657UL }},
+  {{ 0x06e7e176fc98a28bUL, 0x31877c10592a9f34UL, 0x450001f624505abbUL, 0x2cacc89a09ccf323UL }},
+  {{ 0x4ea9d380cb990907UL, 0xe47bd3c8e5cece64UL, 0x1fca4eaead88cf3aUL, 0x1a55b9e334379b75UL }},
+  {{ 0x82801c3f385d89d2UL, 0x1c1d4fc7d2452bb6UL, 0xcb1fd4d7f1dff58bUL, 0x2b602b817b55344dUL }},
+  {{ 0xaa91d0003ebe6999UL, 0x9197c83dcab99da4UL, 0x8ac4aa38b9e8d375UL, 0x2fa8b095d97b4866UL }},
+  {{ 0x896c3d0d58103814UL, 0x6274b7041d392790UL, 0x25c3e70d3513b05aUL, 0x05d345ef6e1a8eebUL }},
+  {{ 0xb9f959df676c3bb5UL, 0x8715912f7abf14a3UL, 0xd547d5153ea40ebeUL, 0x15d42ae1cb05b323UL }},
+  {{ 0x9106f6aa34c32edfUL, 0x83eb8b6238a876c0UL, 0xc0f28c3aa4cd98e5UL, 0x1943d8ae0c18b3e9UL }},
+  {{ 0x8c7554a272f54ab2UL, 0xadd4ad0c805d4d71UL, 0xc0dec940b8f8e54bUL, 0x234bcc5d6863474eUL }},
+  {{ 0xb1932a1fadb35f87UL, 0xcd355fce46d9ae42UL, 0xd22f245e311f1d7eUL, 0x16d923016296e866UL }},
+  {{ 0x7edef644b7fcf16dUL, 0xe0d9f160baa08a7eUL, 0x2e651404eb0542a0UL, 0x12b98df1e326efd7UL }},
+  {{ 0xdddfcca21f27ed69UL, 0xfb2251108b862f2fUL, 0x1c4696beb0a00cfbUL, 0x1e2e9e74595dc7bfUL }},
+  {{ 0x629366134a8930d8UL, 0xe46a439c184fb067UL, 0x8969cf5341d2f8aeUL, 0x100d23dfdbffb531UL }},
+  {{ 0x0e8f76b8f0223a3cUL, 0x41bcbf790be82921UL, 0x16ae4ddbaf6b07cdUL, 0x2b4b5f1a3e2d417dUL }},
+  {{ 0x8f7463d739ddee72UL, 0x1f09ad44d7da65faUL, 0x568f0fa23d7f0613UL, 0x27681ee0f0e570b6UL }},
+  {{ 0x309723f8ef2feb82UL, 0xdcd6fe1760322fafUL, 0xf031d09f3ea0c26fUL, 0x1b7c0603ae2d589bUL }},
+  {{ 0xbebef65976a70f5dUL, 0x226be43f98075ed1UL, 0x083db431c78cbe59UL, 0x0731a4f5ec1479d4UL }},
+  {{ 0x18e998c8a94c7dbdUL, 0x1fdd0d565d839e82UL, 0x2130eafe6d13afe5UL, 0x10c4d4d4c2e3ae4bUL }},
+  {{ 0xf62781102bd989ddUL, 0x25d45d3e9f1c7489UL, 0xf25096be6f1c7a1dUL, 0x2eba6bbf386c2bffUL }},
+  {{ 0x2c7dab5417fd7096UL, 0x190bc1f44ffb7956UL, 0xb664efd4df515b73UL, 0x07971e6a18c22ea8UL }},
+  {{ 0x54b47fa8627e0ec0UL, 0x6102a03c295c5810UL, 0xbe0598431735fb74UL, 0x0ac568755a98c635UL }},
+  {{ 0x5b51863d2120041cUL, 0x4c73c9b63a1fbeddUL, 0x404a7fee5e4b7aadUL, 0x2e9203229440a307UL }},
+  {{ 0x50230501a7c72eb9UL, 0x71d7b905323db3d7UL, 0x5ac78ec86f0b2e49UL, 0x1e378d34ec2f43d0UL }},
+  {{ 0xc1d2fd83c98d7f02UL, 0x9e0e2f350ae7f755UL, 0x1cb444e0e29f185dUL, 0x230c8462c64c6cdbUL }},
+  {{ 0x36d1b00b7e89b6dcUL, 0xd50ad37a81260daeUL, 0x27c2db42905fdeb5UL, 0x227d0913113d0eacUL }},
+  {{ 0x578bc634fe87981fUL, 0x6cc4a77a42db9531UL, 0x23676b621cb9e54fUL, 0x10723d88af00e122UL }},
+  {{ 0xed9a19a60fd0f23fUL, 0xee9bd2c56b0da2a9UL, 0xa087c5b285617803UL, 0x082b92811613bb6bUL }},
+  {{ 0x74167b4e26794774UL, 0x295e8e7a106ed8deUL, 0xdf5a0722d4f1e085UL, 0x00419d8a40ab8ec8UL }},
+  {{ 0x9065e0e248eca1ddUL, 0xea96bb1e6c2b3668UL, 0x8c5c3588611016a7UL, 0x0277d6ec4bc2d369UL }},
+  {{ 0x4b015c53ea732d19UL, 0xe7faff9920ccb5d3UL, 0xb40af070784f4502UL, 0x02037ebd97244138UL }},
+  {{ 0x2b81798aa77740b1UL, 0xb6d05651a02647ffUL, 0xc028c6c284c0fa7cUL, 0x0e7f41c9720562dcUL }},
+  {{ 0xd8107ebb932ce849UL, 0x124eaf3305d15aa2UL, 0xacb63dbdcb98a8ceUL, 0x2cf5df8191c09578UL }},
+  {{ 0x9c9fc75e45ea0d79UL, 0x075d4d56a8eca2e8UL, 0x590544cdae15845dUL, 0x2c42b13385b06435UL }},
+  {{ 0xcfe0192f0df59d37UL, 0x236fc17b557e3378UL, 0x91497de0997a4cedUL, 0x2356f8629c289404UL }},
+  {{ 0x2e7a4f994e81c18dUL, 0x4653ce486da410b1UL, 0xb66c100de0989b67UL, 0x1fad1e9b0cd76f9dUL }},
+  {{ 0x7dc65cc25bd4d348UL, 0x1b6282d9f1e3c006UL, 0xc5cc246e9119b23eUL, 0x11e95919f0172937UL }},
+  {{ 0x35e2c5fb8d518ff1UL, 0x4755afee9f2a9d1eUL, 0xded33b170f92dc29UL, 0x2bc2e431eb701ca4UL }},
+  {{ 0x01b456f880bd46b9UL, 0x0a4f11eab5663a14UL, 0xbe0c9d406942006fUL, 0x08bee70f625c26a1UL }},
+  {{ 0x25dafce4071f1d8fUL, 0x5728e0b1f1f75c3aUL, 0xb76b5f79838519f2UL, 0x1a6b012f541dccf9UL }},
+  {{ 0x7d067c599e4de37cUL, 0xcd4d53ea427da75cUL, 0xf7ddc28d39e3adc6UL, 0x123a307c75f694faUL }},
+  {{ 0x76a2e8706db34306UL, 0xfe58468afc1f1fe1UL, 0x484b157b2733781eUL, 0x1d58818818b59cf2UL }},
+  {{ 0x84398497d7b7e3daUL, 0x6b20f4d7f692c028UL, 0x6e880c9a43a26207UL, 0x17592f008a6fad7bUL }},
+  {{ 0x35195b73d319fef6UL, 0x4a349a053661bde0UL, 0xd1c902f8b85e9c47UL, 0x302cdeef76608b5bUL }},
+  {{ 0xf15a47f8a08d7ac3UL, 0x70e4509748c9a145UL, 0xee833b3f6fd2ab24UL, 0x16937e88a4004745UL }},
+  {{ 0x9498ceee11f6f5e0UL, 0xbbb0bd97c1258411UL, 0x582ea00831448ed7UL, 0x11d45db338fc1495UL }},
+  {{ 0x8b8619b46e03ce83UL, 0x4e7e037a5562e542UL, 0x32cbdfb1b17feb4bUL, 0x2e555a9c272263abUL }},
+  {{ 0xdb7ff42ee34fe5fbUL, 0x027f0a2480c4c29aUL, 0x36ec958611f1a747UL, 0x0995ab94c8039c4dUL }},
+  {{ 0x245e1f80fdc2dbbbUL, 0xc14d9e75ccbd3ca8UL, 0x465a0cddabdbd40aUL, 0x1c2ac701e8585069UL }},
+  {{ 0x8d7300980c3f64d2UL, 0x5eec0b40b460f14eUL, 0xbe50e3f5bb236835UL, 0x0d8da006534ed9cdUL }},
+  {{ 0x36037070711e673eUL, 0xb7533f40c0a0e354UL, 0xb5c5961e353fbbe8UL, 0x2a9b544db5d4f5cdUL }},
+  {{ 0x65195c924b2e740bUL, 0x7159d68362a0b5cfUL, 0x3e6382d8cc2cd901UL, 0x1dc991da19835a9aUL }},
+  {{ 0x0bedc39da4c53612UL, 0xe82a832137286b08UL, 0x0fddfac1c07afa75UL, 0x22c888c2e63fb800UL }},
+  {{ 0xe4fec112a864030bUL, 0x3e8f6d373343a9c5UL, 0x1401e6c3c56af3d3UL, 0x204678d29477a8b4UL }},
+  {{ 0x86c2415f5cf4f858UL, 0xc043c90c056b7d3bUL, 0x3bc9ff8b0cf37df7UL, 0x073e0a0dc98d6565UL }},
+  {{ 0xeebe5b6bc56134d7UL, 0x97f8b40f8fef3840UL, 0xaa20561da73ab98dUL, 0x2753fbc7cc14cf26UL }},
+  {{ 0x9c3f8c4b269327fcUL, 0x418b1ec4f61eb9b5UL, 0xdff3290390e34b97UL, 0x02339dbd4cdcc850UL }},
+  {{ 0x90eca8cdf7043b65UL, 0xab6ff04f87182306UL, 0x30de529664815687UL, 0x1927e9eb70e08e52UL }},
+  {{ 0xc5ae6b4d7c1cea36UL, 0xda796217668866b9UL, 0x211bf8b10c253445UL, 0x0e124abfef6ece9aUL }},
+  {{ 0xb7113572069de451UL, 0x2f973e7e14cf09faUL, 0x65f8f4fcfea8b75fUL, 0x2a074aa0166bbd88UL }},
+  {{ 0xb202ba6803893a2bUL, 0xc7da1ca9903a100aUL, 0xf64971badcf4eceaUL, 0x020b8e2f851963feUL }},
+  {{ 0x437dbcd38483ec84UL, 0x935ad24870e89bc2UL, 0x40da3c924385ddf5UL, 0x1daae345a47aba7cUL }},
+  {{ 0x0bd24ba6d5ce4b86UL, 0x03d7a050cbcb645cUL, 0xdb2c0ee6f6a90af6UL, 0x281682aea21e59faUL }},
+  {{ 0x11af957eca3ad096UL, 0xebf6e85115ab596eUL, 0xfc1ce98419798b49UL, 0x1526fd911602e50fUL }},
+  {{ 0x53802cfb826cdd11UL, 0xc1112365274899fdUL, 0xcc9c0f293364285dUL, 0x17c1505a882acd51UL }},
+  {{ 0x2765eeb296770311UL, 0x5a3aa648a7987337UL, 0x28bb5bd1cbe18b8bUL, 0x0a6e9c668f2f713aUL }},
+  {{ 0xd1b9f566ade0aeffUL, 0xee731b1af1df3dfaUL, 0x4af6615261f4d917UL, 0x04b2958eba83c5caUL }},
+  {{ 0x23792b665533fd3fUL, 0xd091baf7381174e1UL, 0x8d5c12f9eec1ed0dUL, 0x215ff8632fac4560UL }},
+  {{ 0x04857c20d685951fUL, 0x9ce7f4ec096bf5b9UL, 0x3be6cee364fd81acUL, 0x2f40a93df188c57bUL }},
+  {{ 0xbabfd2d24c4284f3UL, 0x29d090de8c8a042eUL, 0x46cc08d13b525ef4UL, 0x19a6424c0cb6e9dcUL }},
+  {{ 0x0a93cb88cd4a1d25UL, 0xcd1a37c45a4edac9UL, 0x2ff898b5edf26d9bUL, 0x07ca63557a2f0673UL }},
+  {{ 0x56153fd7593b9f58UL, 0xff511ab85df77be0UL, 0xac9b9269c84cfbfaUL, 0x27f2853618a23070UL }},
+  {{ 0x0ea40865df3a8959UL, 0x4e7e18efbe2983b9UL, 0x935dfee8f8e2b160UL, 0x233b3b81283b1c20UL }},
+  {{ 0xec5c2341f0e7d79aUL, 0x8f26ca9f190cadd3UL, 0x5d8b65f7203c43f4UL, 0x208b554166d74ea6UL }},
+  {{ 0x05fef81c1528ff7bUL, 0xb6b8cf3649b98506UL, 0x94a2d98b4bc0cbe9UL, 0x1b2ea91121c40db6UL }},
+  {{ 0x46cc549ead0ee833UL, 0xc4f171b56ab12078UL, 0xeb2cc3cd70ee3443UL, 0x08ec192ee8195adaUL }},
+  {{ 0x7615bf1257c32abaUL, 0x44ba3f6efb1f952fUL, 0xbc263c57dfac1f87UL, 0x2f7e8face42085deUL }},
+  {{ 0xe36a7e2878b68421UL, 0x9911eb7e2bef9c64UL, 0x9fbe13d4f100078aUL, 0x2f45388e35791c89UL }},
+  {{ 0x00055ef8aa1a114dUL, 0x3013799c98888e4bUL, 0x2f4a249e735b8a98UL, 0x2c290cd32dfa0b9aUL }},
+  {{ 0xbc17cd7c4ecfa9c2UL, 0xbbaaf51424e1117aUL, 0xe4501ef9b481fd06UL, 0x0ee769e7e4b5436aUL }},
+  {{ 0x324c85126683a445UL, 0xa2fbeca2431752b5UL, 0xefd56572665879a0UL, 0x0ca31863ec001af7UL }},
+  {{ 0xd9d9118189a70bcaUL, 0x86a9a729fd235961UL, 0x281cf5f61d26427cUL, 0x21e0d417cdb19b3fUL }},
+  {{ 0xd8fca85fab78f213UL, 0xee6f48aee880bcf3UL, 0x615ebbc623012ebfUL, 0x0c65c9e2721fb144UL }},
+  {{ 0x71216c78f3f89be4UL, 0x3c1267c3018f3318UL, 0x9c5c6c5c573fea67UL, 0x0fcc898d05d22dd7UL }},
+  {{ 0x5d590a8884d10842UL, 0x19e5f5b932dc94bbUL, 0xabfe919c22574bc6UL, 0x024ec378060da0f6UL }},
+  {{ 0x160ef68375baf6d1UL, 0xf7e864ec706f0ed8UL, 0x1cb164000b086b79UL, 0x13c6e79a574256afUL }},
+  {{ 0xfefae3ec5bca5ebaUL, 0xec9c7d2f50e248f4UL, 0x4ff9e3e5a536b27dUL, 0x0107cff178c853b4UL }},
+  {{ 0x0a510325f424639aUL, 0x5eac29fe4688903bUL, 0xf758fc9dfdea83ceUL, 0x2560ec645552c489UL }},
+  {{ 0xde86ec6ceab0ead7UL, 0xad7118ecdf8799f4UL, 0xa0ee6a7a80e53349UL, 0x2d9d8803dbf0b4e3UL }},
+  {{ 0x78285c58820d83b7UL, 0x56ffb7fcbdd6ec3eUL, 0x62916f65a5f8e24cUL, 0x17792f0b6ea999d2UL }},
+  {{ 0xae2941990175d830UL, 0xecaf0b713cac9405UL, 0x8e69ab831db52a3fUL, 0x3005205c0b561035UL }},
+  {{ 0x9d69fa0a34e46461UL, 0x4727ed18eb401318UL, 0x65f9ff3203d7230bUL, 0x1354ca6bc0dca2f5UL }},
+  {{ 0x603d76a60b48afcfUL, 0x3629cd7bdffea372UL, 0x52f7ead892ece4b1UL, 0x100cfe4584659210UL }},
+  {{ 0xc1251e9c249bd56bUL, 0xf2dd6cc50fbd6525UL, 0x0c12c4b1445660bdUL, 0x1a8c6c54e33afcbfUL }},
+  {{ 0x7287916f685bdaeaUL, 0xe805b986a656063dUL, 0xe5c94c657a9b76abUL, 0x22d95f9152388073UL }},
+  {{ 0xe91d63e3786e730bUL, 0xef043fc5817990b6UL, 0x48b6d03cc0c25eeeUL, 0x014f119f2817ebebUL }},
+  {{ 0xd477f701d0400b3bUL, 0x396de33695739359UL, 0x077ccdc5a45d9133UL, 0x266126ac536987f7UL }},
+  {{ 0xf53509993a5bad24UL, 0x10a780339a3633fbUL, 0x47d5e380c01d869cUL, 0x23cb981d621ad9c5UL }},
+  {{ 0x786eccb3abafa9d2UL, 0x29a070f4efa0a060UL, 0x18d5e3ee36ca151bUL, 0x2da250019f3fee92UL }},
+  {{ 0x1022d843b5bca8beUL, 0x05438167bd6acf31UL, 0x3897372df24e5512UL, 0x1961f3f31063780aUL }},
+  {{ 0x8ef793d04531e89aUL, 0x98f4957f372944a8UL, 0xb0c0b8aae66b5bedUL, 0x2fc27ee9559c93a9UL }},
+  {{ 0xab86f89e0d18a5e3UL, 0xcb0af81d1dbcf944UL, 0x5571a0834dfc2d90UL, 0x1e3315a353feffe8UL }},
+  {{ 0xf2456dba66014fadUL, 0x88765250ff244c21UL, 0xc96c08e045b5b6d8UL, 0x22895b0131e95546UL }},
+  {{ 0xb1c543cf94fff636UL, 0x4afc1bc1bb719ed5UL, 0xf0289360a8766a0aUL, 0x17caefc91d80e15dUL }},
+  {{ 0x6afd1bb81f8caf21UL, 0x543a2fe81d1f802bUL, 0x2189039e9b1574f1UL, 0x1b964b8e49580e29UL }},
+  {{ 0x5cb90f8a3a717602UL, 0xbefb261fa417bbeaUL, 0x814a5e8ca74a087bUL, 0x1d263b25aad030b3UL }},
+  {{ 0x799a88f797ee316eUL, 0x424d5e25b4f9c9b5UL, 0xc6f42aef3a958c9aUL, 0x136aac9291c96cc2UL }},
+  {{ 0x5773b406f80e9e46UL, 0x8b56e062591188d6UL, 0xb92f1fd7cbc4ecf8UL, 0x02f469834530a358UL }},
+  {{ 0x91be5015bb0ba98aUL, 0x70f905c63ee7cdefUL, 0xea0df74be35585f8UL, 0x2b46a25b06ea1b37UL }},
+  {{ 0x05dcfac151d8956eUL, 0xc562a2a82bb39cd8UL, 0x73402ca12517c064UL, 0x2a3726fc76c4d6d6UL }},
+  {{ 0xdc05c1a0adf8ba84UL, 0x59e91672fc8dd541UL, 0x6d8938cc365a5928UL, 0x140b6eadf8ee8ef6UL }},
+  {{ 0x09488be551e07685UL, 0xaff9796c41dca396UL, 0x83d134581e143d8aUL, 0x051ee3c4ba276657UL }},
+  {{ 0xe5d17970aa5a2364UL, 0x563c24f252f69452UL, 0xf7171fa0cb6944a5UL, 0x00200a74a8d92821UL }},
+  {{ 0xda8c54c31f31f6c5UL, 0x5e92402cf1e30cbdUL, 0x0724ae7bb81457f8UL, 0x269f8ddda86ff079UL }},
+  {{ 0x00f8e2e88bdb6c81UL, 0xd9d69208b83babbeUL, 0x952a1f67db08b62cUL, 0x203e78d60d291ee7UL }},
+  {{ 0x6fd5de34909dff99UL, 0x388b556727eafd86UL, 0x0cb9ec99b082f93aUL, 0x2a367bf9f3238adeUL }},
+  {{ 0x3eec4167d6f18a38UL, 0x30777c272542f5a5UL, 0xa1735aa9c0b85847UL, 0x1323075e03e7faadUL }},
+  {{ 0xf4c0272d541fb5d0UL, 0x4eeb6b17e33c5a0aUL, 0x625d085ac180ca42UL, 0x0c82b909e074b117UL }},
+  {{ 0x49a3e542e4205d97UL, 0x1fb123ade7d764f0UL, 0x9eb600dad890018dUL, 0x17b023c9b76ee1c4UL }},
+  {{ 0xf6437a92b1d3d021UL, 0x04201382ed8f811eUL, 0xb52385d2fb3dd446UL, 0x168a578f329fc78cUL }},
+  {{ 0x9643ddda7e4cd729UL, 0x9c22879a20a342f7UL, 0xf769052004c60b2dUL, 0x11ff39ff8b9778dfUL }},
+  {{ 0xa07989d252479811UL, 0x4470f437e591f149UL, 0x67d5c1cd6209a25dUL, 0x165506fa02543dabUL }},
+  {{ 0xc5fe95b486635f76UL, 0x60cbe8be4cea3ddaUL, 0xd1b53a91f956040cUL, 0x2811afad8c3c5d4eUL }},
+  {{ 0xcee7516e0d12f3b2UL, 0xf8c33db15be88abfUL, 0x1b2505257fbf8ecbUL, 0x1204c1971344d5f3UL }},
+  {{ 0x2d580bad437793f0UL, 0x71996739fb6291beUL, 0x46366a5926940713UL, 0x25d9cfd3b5154f9aUL }},
+  {{ 0x2c8bdda29792132eUL, 0x79b0221dd6c9cbc2UL, 0xdfb1e83dad1fc5a4UL, 0x1d539c4c79633d32UL }},
+  {{ 0x32ae6a872fdcafdcUL, 0x99074a98f27ceca9UL, 0x43895ac0c7357466UL, 0x243c0610aa0cdecdUL }},
+  {{ 0xc0e736c0dd5c3db3UL, 0xdcff0790054c8935UL, 0x38bd1b4e44f925baUL, 0x102b4587c6fd3d71UL }},
+  {{ 0x7c3d716e0aa862b6UL, 0x31358af03e052e2eUL, 0x34de942e53784035UL, 0x271b204b81f7fb72UL }},
+  {{ 0x4b35dafe75c0f0b0UL, 0x2c226ae197880bd1UL, 0x84ac121dcae45281UL, 0x1a5161a45c927f9bUL }},
+  {{ 0xd43c9926a2de0c54UL, 0x6bc0213bd920d505UL, 0xb4c1cf3d97e5e82dUL, 0x08bb816fd045c48dUL }},
+  {{ 0xfdfa9216a8eb3e0eUL, 0x5a49afac356636bcUL, 0x93d7ea87ded514b4UL, 0x2023df7a0028a407UL }},
+  {{ 0xe7136aa6c67437dcUL, 0x3cfbd37514ca2f92UL, 0x69df0cb3147750e4UL, 0x1e63d2db69e54426UL }},
+  {{ 0x6e55213f95943f45UL, 0x13c411a422dc0f47UL, 0xd7216dd1740b9c19UL, 0x18020b7b8c736469UL }},
+  {{ 0x658160454827171aUL, 0x744a695abfe4bff7UL, 0x1cc0391e652f2998UL, 0x1a32cf57cfe86641UL }},
+  {{ 0x10a1cbdc5726f608UL, 0xada513c20877400aUL, 0x6dd8ed6cfd53a608UL, 0x2ee6f6198f53f51eUL }},
+  {{ 0x78a9fa30d5478827UL, 0xc3cf3dde8bd229c9UL, 0x2dddce47795214a5UL, 0x1ba0e59d8713af77UL }},
+  {{ 0x760b410a6a32f65bUL, 0x4ba05add45cb9b0bUL, 0xc3222c49bf862b9bUL, 0x0a4b5bb6b253c725UL }},
+  {{ 0x3c93b317f316b4f6UL, 0x9ebe3d2a2ed0055eUL, 0x44cb8c38a19c834bUL, 0x2d5d68865ac5f00eUL }},
+  {{ 0xeae40db092a4dc60UL, 0x01787c94540bb1beUL, 0x94a6f195d185e24fUL, 0x0aa8c9f4b664f603UL }},
+  {{ 0x5a3dbdadcb67ce6cUL, 0x295324334815fcbeUL, 0x34c5c25248f8905cUL, 0x124a1cc6bd6ab6adUL }},
+  {{ 0x5b058441a723c518UL, 0xff53893515624e18UL, 0xb624f8d7e75c747dUL, 0x20c5db52b09be6a7UL }},
+  {{ 0x76b28c4f6a526098UL, 0x17506a4eced5fbf1UL, 0xda6b7e32c95e5b41UL, 0x1ca4ea8b1efd0937UL }},
+  {{ 0x327257e943b72ba5UL, 0xdbb50d751496f11cUL, 0x520d9a77417bd454UL, 0x25fa706f49393644UL }},
+  {{ 0x4a0e787a3ed41280UL, 0x4ee815e1af19120fUL, 0x2ff8beb9051e6184UL, 0x0e29bc41f3e56008UL }},
+  {{ 0xa64c5ebad5a06415UL, 0x97845f1b5d39fe89UL, 0x2c51fbd38c08cbe9UL, 0x08af31ee5ff896afUL }},
+  {{ 0x309f55446207b063UL, 0x7ad2380404a31a6bUL, 0xb416ff3745ef2bfdUL, 0x1462a433ee4b958fUL }},
+  {{ 0x1b63c11b4e7a69dbUL, 0x6fed0b75d6e4a8bfUL, 0xc7990d2538defa0fUL, 0x15ce4c9e9f15cbddUL }},
+  {{ 0xfba3a393ed991a04UL, 0x6df7a41bfb8c99d7UL, 0xc4115a692af07b39UL, 0x2307696f182b80b1UL }},
+  {{ 0x62923c3e92079c0dUL, 0x3547da811ce857e6UL, 0x1af7680338cf3bb8UL, 0x03ad8a05d02c39a9UL }},
+  {{ 0x4e026ee52bc9d918UL, 0xb30bebb13ff5c288UL, 0xf0e4cc124fbcbeeaUL, 0x00045fba4ee0859fUL }},
+  {{ 0x13076d4075ec9846UL, 0xab7d0798e64e2b78UL, 0x691d05dbe13728d2UL, 0x09fd7d89a4cdaa51UL }},
+  {{ 0x08dcf6ab38886455UL, 0x450a3b9b38782e58UL, 0xeaddfc18809f4b22UL, 0x214f5e84cfd46f10UL }},
+  {{ 0x42fbac6006b77e2dUL, 0xa444a4bd5c40fdddUL, 0x93646d8f3dcbf82bUL, 0x1803b8d924847767UL }},
+  {{ 0xc5ccdc110a90ff31UL, 0xf2476107ac784c33UL, 0xca165cd37c3bed70UL, 0x0bcae3cc95069c98UL }},
+  {{ 0x6733bca6949d1423UL, 0xca3d9fa9392d454aUL, 0x753cc7314a91c926UL, 0x0cdc7baa44961c55UL }},
+  {{ 0xacb4d20755d4cbf8UL, 0xba1baf575809fa18UL, 0xae02963a3f548adbUL, 0x1f00f546eae6a75aUL }},
+  {{ 0x6462fb1d16afc087UL, 0x5857ba7a92f98177UL, 0x4c0fa71d367c89bcUL, 0x0666e203d9f6a32fUL }},
+  {{ 0x0c8255f9da71fa23UL, 0xf83061558a4c3d33UL, 0x074aa67353034015UL, 0x24304c9614396cc5UL }},
+  {{ 0xb2aa6f690deceec9UL, 0x06d6b03f9bee7de2UL, 0x49188544710c3fb0UL, 0x24117b5f2dd23272UL }},
+  {{ 0xd87c32449131b34eUL, 0xaadf9d2b0effda6dUL, 0xf3cce3cb9df81d3dUL, 0x0bdfe1fbd5f50aacUL }},
+  {{ 0x506c11e26b04bf27UL, 0x88047552ca6e74e1UL, 0xe0cc993d5eac1da8UL, 0x1ddd0dca7abf2deaUL }},
+  {{ 0xbcab79c1653982caUL, 0x43373b6873195571UL, 0x4e663635a2cb9840UL, 0x24557ebfec63f9bbUL }},
+  {{ 0xdffbb40f6aadd60cUL, 0x8b6e14900008bab7UL, 0x9d74d946ced91c07UL, 0x1ba3d07c76c0eea7UL }},
+  {{ 0x32eaabb9126bc517UL, 0x7e2abb66b61aa817UL, 0xd5af370f5cdfc0b4UL, 0x2dd2d1c0dfcd51cdUL }},
+  {{ 0x1c3291704a2100f8UL, 0x3cee553f6570cb5aUL, 0x45cc77cad3be9c48UL, 0x0361ea3f01de6ff2UL }},
+  {{ 0x3dd86685959fb27cUL, 0xcefc11308165905dUL, 0x715450f28dc068eaUL, 0x0ef033f5cf39e1e8UL }},
+  {{ 0x9163b72f122d7a28UL, 0x41c0bf9230574176UL, 0x8aa0b8b5a75ee362UL, 0x2c960e78ef836a36UL }},
+  {{ 0x0458a857f0e05a00UL, 0x8ac09a692237ded1UL, 0xb8899e51b62c3b6cUL, 0x237ed5d4fae48cf4UL }},
+};
+
+static const fd_bn254_scalar_t fd_poseidon_mds_10[] = {
+  {{ 0xe6614a3e6d90b4ceUL, 0x5200488a5113f396UL, 0xdb53de6d224eea8fUL, 0x2b291d666b0d68bbUL }},
+  {{ 0xd9533b43d956f40dUL, 0xb1063b7f366c40f4UL, 0xce833899d598ba9bUL, 0x2005d175a86c5a6aUL }},
+  {{ 0x13f686c52b8b458dUL, 0xe366f395a025f2c8UL, 0x3455b27408ee7b88UL, 0x2d30960325e98a83UL }},
+  {{ 0xe6be830c18e51fc0UL, 0x83c28bda35f4727eUL, 0xf680717534963ce3UL, 0x1861b3aeea8d6bd2UL }},
+  {{ 0x49a790f7045e73acUL, 0x3f10b6c9a3403e46UL, 0x7da32a0336b02605UL, 0x1158612561ebc2b5UL }},
+  {{ 0xdd124fcb15598ea0UL, 0x194b2e74010a5ec1UL, 0xfabc0a2a42bcd5f6UL, 0x0efcd58187abf288UL }},
+  {{ 0x3532dcf9accbf573UL, 0x83a4cea4f8d8a66aUL, 0x753b242e13df3f6aUL, 0x0b3e7b43c5c5b929UL }},
+  {{ 0x1f8dfcacb0313427UL, 0x7ffcd155d3fbe630UL, 0xebab2742720b19c4UL, 0x11a6354b922ac7a9UL }},
+  {{ 0x050d5497dba82121UL, 0x73eeef0e9f8a94ebUL, 0x897e65fa4cbf122aUL, 0x2adf55e0555fd0b9UL }},
+  {{ 0xcbd9ea6ffbb2fc88UL, 0x6743057e4c80e144UL, 0xc743f26e50f7e32bUL, 0x1d5e77a36b14f6b7UL }},
+  {{ 0x372f2323d875fb22UL, 0xb4ef2c3992812c17UL, 0x871ba83189d9be07UL, 0x24588e722c2e6979UL }},
+  {{ 0xf6e4e3e69983a771UL, 0x6798e214ffcd6ec9UL, 0x4b7c7488a36a9cd4UL, 0x0c57bec8fca240e1UL }},
+  {{ 0x90c24a961180014aUL, 0xc9f87faca1bc1155UL, 0x9e17e5956f863882UL, 0x01a29ee78c1867a5UL }},
+  {{ 0x55d5f69d20f9246aUL, 0x56fc1ae456945e19UL, 0x7d85d065c08646d5UL, 0x288d1a46bbf3a8adUL }},
+  {{ 0x8a4e396cd0a68fdfUL, 0x25da024ec7e7fd3dUL, 0xb75794bc83a2defcUL, 0x077a678350894e0eUL }},
+  {{ 0x37f20f694e86e33fUL, 0x2aa4b326b0cd07f3UL, 0xc3c9a7fe44d4b3e7UL, 0x14fc82e1e879296cUL }},
+  {{ 0x44a34f11706f9049UL, 0x596ef913fa7dff10UL, 0xd23d9b5341d7b34dUL, 0x0af070c3c21af902UL }},
+  {{ 0xd9f7fc4f337045a9UL, 0xe0a89d5ef261168fUL, 0x1921e578a88f7070UL, 0x147a6d59a14d449aUL }},
+  {{ 0x7ecddb72583a513fUL, 0xbee7ccd9211f40f4UL, 0xfab3d7be4c4cbc44UL, 0x2804110bc8fee20bUL }},
+  {{ 0x15fca76be6c0c001UL, 0x68f6ad52d66ce222UL, 0x55fa3e81b241d571UL, 0x1f306421a708eeefUL }},
+  {{ 0x00bc7b5d01bf2c50UL, 0xc86b7f68f0cc2e81UL, 0xca25bf4417b3cb53UL, 0x1b11d4418071c26eUL }},
+  {{ 0xc499c39e63daae51UL, 0x61f103173f14da0fUL, 0xbdd513055f698466UL, 0x0c0d4ea30e3bf37aUL }},
+  {{ 0xa1195d1cdad50a13UL, 0xab07e591c9a1a7dbUL, 0xbe12af4661a85b7cUL, 0x0e73b483352c5e98UL }},
+  {{ 0xd4d7bd666350242aUL, 0x2aa094cc7dd489d7UL, 0x81cca5a34b5a736aUL, 0x25e354b4da2ea345UL }},
+  {{ 0xa2139a5e5b8dec6dUL, 0x2461214c8c41edeaUL, 0x4fb371b199ca47f9UL, 0x0ca11be809f41a40UL }},
+  {{ 0x49906d09ee43112aUL, 0x3b34fa7f44e47b37UL, 0xe1a8ba8e237b2a77UL, 0x1a0d1b354ff7ee38UL }},
+  {{ 0x37c41d97c4641cb3UL, 0x2f8603af2ff29873UL, 0x05551393484690e9UL, 0x0f78ba0f163fe953UL }},
+  {{ 0x8762d49e5c1f5d56UL, 0x9432928ba9615af9UL, 0xa34f504d2a677258UL, 0x0b4a666afcfb669fUL }},
+  {{ 0xff7d3da9d394422eUL, 0x46cf06fa406cd130UL, 0xe49bc4640886b17fUL, 0x1aaa0b53404ce43bUL }},
+  {{ 0xe232dab9e7747c51UL, 0x1a78fbf4c1cb9a22UL, 0x33e522ae155d6f16UL, 0x121ae1a150f2ce5fUL }},
+  {{ 0xb83b552c48be060dUL, 0x2e718fca4da5fe06UL, 0x68415b3479766130UL, 0x2189bc2437f02a28UL }},
+  {{ 0x784bf3a1bbcd7917UL, 0x295ad952afbaeebeUL, 0x90d7e8f23833c264UL, 0x28f094ffa1c1e1d5UL }},
+  {{ 0x41d3fe57cb2ee4dcUL, 0xbcd20e26cdbd18eaUL, 0x64649236d3a97749UL, 0x0a4eb4d00abd1555UL }},
+  {{ 0xd3be436c04d52829UL, 0xc9acb448d1d403ddUL, 0xea040d4f4b4a7006UL, 0x1ecc574f2914d237UL }},
+  {{ 0xf7b73f1a02438be3UL, 0x439bbef136865fcfUL, 0x65b9f67412290816UL, 0x22e89c61037d7fb5UL }},
+  {{ 0xa73ed4c02b5e1621UL, 0x07c7d3fbf771a151UL, 0x4b3a72bb3cb4a309UL, 0x2687ac3bd394508eUL }},
+  {{ 0x1118f91d7f390c76UL, 0x8ab4798ea1732468UL, 0xb4f925e7e3bd1439UL, 0x0736da89d59c0593UL }},
+  {{ 0x9a6ed32e211984a5UL, 0x14073396588b10fdUL, 0x9b6ebb77eeeea679UL, 0x0bf6c1d20f5045b6UL }},
+  {{ 0xa6f0dfcfdb0337e3UL, 0xafbe2245b7425470UL, 0x96579b37fe1cf1baUL, 0x2109f4501db049adUL }},
+  {{ 0x5e28e749f3c85079UL, 0x7cf246aa9f25cb11UL, 0xd1500cb5605a74a0UL, 0x121c19df1434c774UL }},
+  {{ 0xdf63b2365c96863aUL, 0xce3cb53dcb7bff29UL, 0x3a3ac1eb834ed903UL, 0x28451bdfc3e290d6UL }},
+  {{ 0x3758531ea5c1c4e2UL, 0x26861d50da4fe5b7UL, 0x809e1bdd81f208a2UL, 0x00d45b31bdb05672UL }},
+  {{ 0x0bb6c52f7cef0438UL, 0xf2ba9c09d6636179UL, 0xa7d7ba2af66337f7UL, 0x0e1876a5d0ba89f5UL }},
+  {{ 0x68fe3bedeeb48f1cUL, 0x2234dfe228d3ad82UL, 0x2e91072990427cfbUL, 0x00edcf5f1f354083UL }},
+  {{ 0x68beed634e70b0dfUL, 0xc5172a5893a9e93cUL, 0x632e4f84e7c7fcebUL, 0x0b6783882db579baUL }},
+  {{ 0x6b1e7e7e00534523UL, 0x8f23b6fa386b1974UL, 0x76196583f5b3e43cUL, 0x0f29cf8f1894fe12UL }},
+  {{ 0xc6d3d44265c0013bUL, 0x89e36f3df14d158dUL, 0xdb81a97b931f2a50UL, 0x23434cf98dfe6c88UL }},
+  {{ 0x9fb49ae3d9b7101dUL, 0x7d9ccd4c70bc31bcUL, 0xf54a79690ca4029eUL, 0x25a56d94499ac714UL }},
+  {{ 0x6200a4b25a5bf40aUL, 0x62c9c4717b17480fUL, 0x5e4e2bd1383fcb86UL, 0x1c6a5ae1eb31d422UL }},
+  {{ 0xfb695822ab2ef6e9UL, 0x6d41fb9d7bef9f34UL, 0x772f0ff62218bc0dUL, 0x1722dfd3b255d287UL }},
+  {{ 0xc49850d4bc3815e8UL, 0xd5599594b1935a0fUL, 0x61359db3035a56b8UL, 0x05509f7c0e9d27faUL }},
+  {{ 0x68a4af5edbfc350eUL, 0xbdeb82c5ee9eccdaUL, 0x6cd1ee0ae27e9329UL, 0x0f12d70812cbd69dUL }},
+  {{ 0xb692a8afcc7945adUL, 0x44003f6b9980cc1dUL, 0x449bfc6cf3b46c7cUL, 0x0d7a6f21329a71a9UL }},
+  {{ 0x6a4de08ebed6bdfdUL, 0xe89cd6377a32cc38UL, 0x5e2d27daf1b4d5b4UL, 0x022950066a1817c1UL }},
+  {{ 0xc27cbf8e3b1e23b5UL, 0xae76c456a6eac357UL, 0xd07304bb3b9fc055UL, 0x1d72d753610732d9UL }},
+  {{ 0xbad67583d7900fceUL, 0x6a7edac0942d0144UL, 0x39f1243e822a7eceUL, 0x10920370aabdd3c5UL }},
+  {{ 0x21dc2bc408da5b8dUL, 0xee9c114f4645f18eUL, 0xaadd2fe92486c1a8UL, 0x24e51c00925a887fUL }},
+  {{ 0x2209949e137db9c4UL, 0x7e2887e27a741a8eUL, 0xed5a0fc4c414c479UL, 0x1cc0aebf789d882bUL }},
+  {{ 0x5ac36fa4287462a4UL, 0xb06193df478ee9cdUL, 0x2d758e089926a83fUL, 0x095c9853c6da5814UL }},
+  {{ 0xcd5e2b3de9c2bc24UL, 0x495721d81c671123UL, 0x96ee20c73694f009UL, 0x0e76d17a7e16bfd2UL }},
+  {{ 0xb96da9f32eaed9fcUL, 0x5a0b00aca021891fUL, 0xa97071bfd1f5c38fUL, 0x14079885aec0cf4dUL }},
+  {{ 0xa989129025b9b7ccUL, 0xe98c3176d667cbc6UL, 0xa74419e850af2a81UL, 0x12b2073caeaae883UL }},
+  {{ 0x8a07d8590c4f9809UL, 0xfc6558ae825efe2bUL, 0xa55e2677f27c03b3UL, 0x17cdc7b4140dd9f2UL }},
+  {{ 0xae1a26f03b64d57eUL, 0x018a8d2556aad075UL, 0xb58af95af4c9c477UL, 0x1a14799a4b469d37UL }},
+  {{ 0xe4480b164f0ea535UL, 0x032601d63dd55e9fUL, 0x0b16cf6a7423465cUL, 0x18735d6c96625031UL }},
+  {{ 0xce9a3146d213f808UL, 0x71f5ccf45cb09672UL, 0x7116b151b4557d8eUL, 0x1da96fe01788029eUL }},
+  {{ 0xbf6a1c0ab27d46dfUL, 0x7cd5d57260ec023dUL, 0xd29a0716b0fd27a5UL, 0x1bfccea9e3b4a8c2UL }},
+  {{ 0x282442d04bf36f90UL, 0x56f85992c07a0d0eUL, 0x928181f71a3abe0bUL, 0x1bbe224ab0df1ee5UL }},
+  {{ 0xccbef3b6ec93827eUL, 0x5744e3ca45df515aUL, 0x973bdf9f35dc45a0UL, 0x2b26d622fbd7dba6UL }},
+  {{ 0x7e321c12761f4450UL, 0x27063a3ecab1baa9UL, 0x925d04c694298bd9UL, 0x2e44842bc20a2ec7UL }},
+  {{ 0x25dff87e5e701ac5UL, 0x530ac173efb95a87UL, 0xfc42aee5614e2da1UL, 0x0530451b874d220bUL }},
+  {{ 0xd4ce2237192d3bf4UL, 0x8c71538a821c2b18UL, 0xe6f97276de88a8bbUL, 0x15e8242f896641e8UL }},
+  {{ 0xa77e9ec7da95b849UL, 0x08cd59741942e4fcUL, 0xde6db21ac7416b4fUL, 0x059ab3dfc1a488dbUL }},
+  {{ 0xb1d417c0914a2076UL, 0x4aa2116ecf23b769UL, 0x60ead53b9fb9a5d8UL, 0x1f28da871088fc52UL }},
+  {{ 0x898b1f08e3baa8a2UL, 0xa6f94a8c14b37a52UL, 0x5a4102531829003cUL, 0x2a298ce82a773740UL }},
+  {{ 0xc816c1861a893c37UL, 0xd706b008b2ae71a7UL, 0xab0daa867caa3060UL, 0x122ddf6ecca38692UL }},
+  {{ 0x237d5595505f54eaUL, 0x2369aa0384d24072UL, 0x8f7dd2707a83da9dUL, 0x02d540c6168bd88fUL }},
+  {{ 0x1625d5a25a5f0a0eUL, 0x4761b6af9578b050UL, 0x88280091d2cf0b0cUL, 0x02153246effede29UL }},
+  {{ 0x7dde72dec5b3c5ceUL, 0x31b84caa2704330bUL, 0xd6a31b0b24da34b8UL, 0x2055d62ea59cb916UL }},
+  {{ 0xba7e0017a604abe3UL, 0xff556717dd8fb3c8UL, 0xadd39983a222ffc2UL, 0x250583a2fe5cc4c3UL }},
+  {{ 0x8bb192813b7d8f46UL, 0xb787c384f61d3aedUL, 0x30a0ec55e2aec775UL, 0x0d15d245d41e2c1cUL }},
+  {{ 0x4b30ce0b1b4ea066UL, 0x24840eb920329dcfUL, 0x5c2274e8057c5f5bUL, 0x04ebdc27fd19f45dUL }},
+  {{ 0xc79ecb6863be0a3eUL, 0x7bfb4e719c2aaaedUL, 0x9b66e3f943883512UL, 0x05e43a477e3bc567UL }},
+  {{ 0xf43160ccc94b1b7eUL, 0xa1397e0c982309bbUL, 0x7cb06f0cb4853cb7UL, 0x212e38cc15258557UL }},
+  {{ 0xa92f5af62a652b5fUL, 0x3a5580c03883deeaUL, 0x6e3fac228b884f26UL, 0x14d54bfcce37d19eUL }},
+  {{ 0xf07d372f444dd2e6UL, 0x34dcfe4c8e916cbaUL, 0xbb832dbf356cb0afUL, 0x177c79d7a02e681bUL }},
+  {{ 0x0ac337c4fcc973f4UL, 0xa698e6c791c39a47UL, 0x9c695765fda58893UL, 0x082c4da1d52ced90UL }},
+  {{ 0x9842e5f59f2f0209UL, 0xb2b0f8ca00d0edbaUL, 0x8b99bf7031cbd2c4UL, 0x1394c56f11e860e4UL }},
+  {{ 0xd67e578829c53c45UL, 0xc9344d35a22354bfUL, 0xbe5672b759e65f95UL, 0x0e10449852e99adbUL }},
+  {{ 0xa242df48d54c8e9eUL, 0x377130f6c7138b1cUL, 0x02006e1502e7653cUL, 0x0cc448dd4f79b392UL }},
+  {{ 0x73c50cf720407978UL, 0x4ee1f71cfa48429aUL, 0x72c1d149b06c1e32UL, 0x2971e89f998301f6UL }},
+  {{ 0xc29d01fde5a57d58UL, 0x8af1d2d9ab4a4966UL, 0x8bd9610ef74b2b52UL, 0x1cffd170ee65a583UL }},
+  {{ 0x20bf17067872fc25UL, 0x9443b00fd6e3121fUL, 0x9fe110be53baafd2UL, 0x2c76a3fd01208038UL }},
+  {{ 0xceff8b359bab100dUL, 0x359d1e6e99e20171UL, 0x99c5443c6e4f8ad1UL, 0x1fdd949a2f3e1096UL }},
+  {{ 0x4e26b5cebfa64b6bUL, 0xed6d87cba37aad74UL, 0xec607771cfc28326UL, 0x07531eb41979959aUL }},
+  {{ 0xb1eaa1b8159b24dfUL, 0xedf04462e05d53beUL, 0x4c0e4f2de933fa10UL, 0x05279a2ee8d53a45UL }},
+  {{ 0xd361d4e6fef67487UL, 0x4f06b8f26bf1e22fUL, 0xf74d15f829739e16UL, 0x141ff392e96effb3UL }},
+  {{ 0x931b47936ba7cd8fUL, 0xc6f4177bd5300d59UL, 0x90a0919e97aa0023UL, 0x128fc09020ff173cUL }},
+  {{ 0x00408ab23a1f968bUL, 0xaa61495d9aa56e44UL, 0xa27b246224cc5ee4UL, 0x1bd9b471888fd4d3UL }},
+  {{ 0x8a9f31c4a8daaf84UL, 0xa83cf155722ced2cUL, 0x401339b054c2fcf8UL, 0x054b2fdbed3229aeUL }},
+};
+
+static const fd_bn254_scalar_t fd_poseidon_ark_11[] = {
+  {{ 0xcf05a300dda2f521UL, 0xb189a788fb138550UL, 0x0019e7e8f7027ccaUL, 0x1804025998f0df22UL }},
+  {{ 0x18a6f413f312d760UL, 0xe60f98bb43c57c05UL, 0x2db57f0cedf49583UL, 0x2ca9e8a90adcc8b3UL }},
+  {{ 0x97a418c207ea9479UL, 0x1b7ad3fc23689e9cUL, 0xf17a4f3a6d290f79UL, 0x2fcc7cf6199e5633UL }},
+  {{ 0x71774852ae212a24UL, 0x4a79088168f952a4UL, 0xa8f809f97bd0fd2fUL, 0x18f23c94343e0a68UL }},
+  {{ 0x04750f1c6b2579ecUL, 0xae94850230de7042UL, 0x5c82f337600294beUL, 0x2155d02c605a080aUL }},
+  {{ 0x96565b2df41a7422UL, 0xa45d198e8c2abbeaUL, 0x845f9b1153de2cecUL, 0x0d1e3da6f64f2deaUL }},
+  {{ 0x8f3fc33703828444UL, 0x115f8983cb1e7ed9UL, 0x16d2e3d708889f6eUL, 0x2ec1cb2c16fbd82eUL }},
+  {{ 0x0bdc26389c6f0fdbUL, 0x3a72d4f1cf5713f8UL, 0x96912237f552b2dfUL, 0x2799840d192c61d7UL }},
+  {{ 0xaf9e89d9e8d4de2aUL, 0x2173974008ad98c8UL, 0x92043bb4397b677aUL, 0x00cf4adb05e970b6UL }},
+  {{ 0x1beb6e1f02972d1dUL, 0xb0bb1a1f2fcb97a6UL, 0x155b3b703d480280UL, 0x0e83f923d886c54fUL }},
+  {{ 0x842bfd0e2ac6cd5dUL, 0xf33de3534477b0e5UL, 0xface3a0d7946219eUL, 0x1a7e293099712afaUL }},
+  {{ 0x279417dcc748217bUL, 0xff6e2b9e7453082dUL, 0x547bd887963bbfc4UL, 0x1b916c90d22b75cdUL }},
+  {{ 0xd1195c12c26e48d3UL, 0xcc2bb7c429dfedb0UL, 0xc8cf5dc5626d96f3UL, 0x2339fc012463be7dUL }},
+  {{ 0x919dd1a02a9f8c09UL, 0x5627ab7e50486388UL, 0x55065a85beecc0d1UL, 0x103fa3e5a1d55a7fUL }},
+  {{ 0x6997eded7ce240d0UL, 0xfe9dd49314b8b5e5UL, 0xd94598278b0659a7UL, 0x24c554ccf7a6c8f7UL }},
+  {{ 0x2866f24cbe6faee5UL, 0x11b2cdac9b33ff6cUL, 0xbe2ca945a72ff5e4UL, 0x2374f434cb5bd901UL }},
+  {{ 0xdc1675ffd7de4af3UL, 0xce77467a2d406773UL, 0x46cc18ec3ac978beUL, 0x0707c9d61066df0dUL }},
+  {{ 0x39ca2095e6bd2e4aUL, 0xb24299fd8fa681ddUL, 0xa63b2dee1c101487UL, 0x19a7140ec12cbf99UL }},
+  {{ 0x8863163934669dc4UL, 0x52ec6af179642ac9UL, 0x995b9575918aec77UL, 0x0e46b9e37f4bf544UL }},
+  {{ 0xca26e3cd4d69105fUL, 0xaf4dd6ed6bb52cfbUL, 0x4956453fa9ed65e6UL, 0x26bf20b47018da28UL }},
+  {{ 0x0ec9625c97b84cb0UL, 0x079098af8b0dcf64UL, 0x1a788baa84833a95UL, 0x14212ef7684e6bebUL }},
+  {{ 0x54fe2b1192519bc9UL, 0xe649c5abe6d27051UL, 0x32f1e72b19afcbdeUL, 0x02076eca3139295aUL }},
+  {{ 0x53b1d8b6e31bacc8UL, 0x63502a5f42628b26UL, 0xf000a98c422e3b78UL, 0x2dde145d309ab722UL }},
+  {{ 0x08f471eb0a10d327UL, 0x285edc8259ebb5d6UL, 0xca2e787e0c3d1658UL, 0x26167d24f2610167UL }},
+  {{ 0xc7048758eb5f685fUL, 0x095ad3030b538c13UL, 0x12ea39fd006b2054UL, 0x075ae744ccfd9a13UL }},
+  {{ 0xe9f840710ddf1f33UL, 0xf511e32a03103654UL, 0xe86d45b1c591b741UL, 0x02fe4084e2d3b681UL }},
+  {{ 0xcaa755639a730ad2UL, 0xa5351818502add73UL, 0xe5304708e4621c9dUL, 0x22414a75e20040c0UL }},
+  {{ 0xdd5038d9070a858eUL, 0x693438ef2e597905UL, 0xa0a729f2634bc65aUL, 0x0d2293e6418fbdf1UL }},
+  {{ 0xb2e77ca9579f0305UL, 0x72b37d7980cc284bUL, 0xa07cb46c1c408613UL, 0x0b1f9c3772748078UL }},
+  {{ 0x959d98465170d272UL, 0xcbfb3d422beb53d8UL, 0x34c0317955be3e82UL, 0x007515fafe04412fUL }},
+  {{ 0x3f97fd588d9092a9UL, 0x7235d90b016e9fa4UL, 0xc2b614ee2dbbfb2eUL, 0x1cea56c408fb8bbeUL }},
+  {{ 0x80d5ab4a7aec004fUL, 0xc04b196728c7bd64UL, 0x9f9dac880b6496a6UL, 0x0dfda8f81ca1111cUL }},
+  {{ 0x2a4a4cc61714813cUL, 0xc06af69c4dbc3bfcUL, 0x7647fdf7b99dedd9UL, 0x07f8f951d4d12a18UL }},
+  {{ 0xe547151925e10525UL, 0x7ae2b8a7771f2592UL, 0x767d15b408cea4d0UL, 0x2beeadb0b2fbfda1UL }},
+  {{ 0xeeb60b6946220a27UL, 0xf06443e478a3e4d3UL, 0x45504ea4346ea57eUL, 0x148e8c8c817cfefdUL }},
+  {{ 0xfef50a22125884b5UL, 0xd15085e6caacc7abUL, 0x6e316205972a6f48UL, 0x20c6eaa302e560c0UL }},
+  {{ 0xf2aac936595b810bUL, 0x545d0bb94402ba11UL, 0xc21457455af9802bUL, 0x07c31f007e0e1aa5UL }},
+  {{ 0xe2b2037dfbb46244UL, 0xb4248a3f9afcdb0dUL, 0xd127482501ebc4d1UL, 0x12ccd70fc4f8c15eUL }},
+  {{ 0x17824738d37a4ef0UL, 0x09312a90f6d4db17UL, 0xbbd2b6f2b10c4332UL, 0x2211dee95157b9feUL }},
+  {{ 0xc150214a2121f980UL, 0x48e0cad124f2f31dUL, 0x3fa6f65dffeb505dUL, 0x232fd74afcdfbbedUL }},
+  {{ 0x22cc6b9ed6171330UL, 0x20466522c96200bfUL, 0x2b62a7d86022cf38UL, 0x20179aa1ef8c6b64UL }},
+  {{ 0x119e1f9e68b7ba1dUL, 0x5dac6af40f83d46eUL, 0xa1205d79363f3078UL, 0x2e0620813441f725UL }},
+  {{ 0xc57f382f2fae5dd3UL, 0xbc45744bc75952b7UL, 0x3981ccab14354e5eUL, 0x2fce4eb4de744315UL }},
+  {{ 0x524d5a274f02a807UL, 0xe9c5805cdf5100d7UL, 0xa046599ad8d40872UL, 0x14b3d9412a6ddfc1UL }},
+  {{ 0x8b8c353ceacd889eUL, 0x456ef2bc33220d56UL, 0x267ce0475b8a9bd1UL, 0x035de48a93add4cdUL }},
+  {{ 0x472658ec0a3dbf36UL, 0xc1b76c4d5acd2190UL, 0xa26add97bf46c0a8UL, 0x08eb8938544319c0UL }},
+  {{ 0x057702bc8d96e16aUL, 0xaa3b89b15cf00213UL, 0x2c0e7ac629e2ba9cUL, 0x0618f4a3e964de01UL }},
+  {{ 0xd9625accb1da6e8bUL, 0x12c2b8229cbe9b79UL, 0xbfe2197a2485d540UL, 0x29578e0a0d33fbefUL }},
+  {{ 0x7c60ba0ab00a382fUL, 0x3b1cf03f16b428beUL, 0xc4aacdd6fbc7b46eUL, 0x27487aed6ca5145aUL }},
+  {{ 0xf63c00e5c2bb9367UL, 0x689704ff50aeda67UL, 0x55af968a7aedb57dUL, 0x1a4525a86ed5bb4cUL }},
+  {{ 0xf1cee85b5791df12UL, 0x89879e84b1da8b0dUL, 0x01b71a05facf744dUL, 0x0f6f2e7dd37007a8UL }},
+  {{ 0xe060310394448b75UL, 0x17f86a10de732c33UL, 0x54d430ea3ea82a0bUL, 0x188f9a52d94ae49fUL }},
+  {{ 0x246d99e007993955UL, 0x591010b438d117a3UL, 0xd892be81140ec7d4UL, 0x1ad2cc0938f1dac3UL }},
+  {{ 0xd33f755b3efbaf6eUL, 0x8bf2585883e823e0UL, 0xcb43800f20f54164UL, 0x033036919fdf6e4dUL }},
+  {{ 0x4a0464056125ddd8UL, 0x2d6d5c0c0e30e323UL, 0x1ea82f28133c853fUL, 0x2c157d86a5b3bfbcUL }},
+  {{ 0x59196760f0090828UL, 0x4b6e5932ee7787e5UL, 0xb93804e3c051a727UL, 0x1657089dd9d1a59aUL }},
+  {{ 0x796067b343b1e511UL, 0xd9efc9b3ec05102fUL, 0x87553ae1e78b043fUL, 0x24c33fa407608f6dUL }},
+  {{ 0xb16d231a1f12c2b1UL, 0x880b3b1d4f57571eUL, 0x2141aee367618883UL, 0x082d0fdb4cbee6a1UL }},
+  {{ 0x07a91a6e2144da8bUL, 0x3a528264209e8a80UL, 0x5d2f784788592aa8UL, 0x05b511886918d24fUL }},
+  {{ 0x5db311c5cd6c7b30UL, 0xc99ac33be28c7848UL, 0x7365613fee12b6a6UL, 0x11ab18476b6ff8adUL }},
+  {{ 0xbe7d1bccea95c06cUL, 0x653c78b35398042aUL, 0x2b219834c4ac8cb3UL, 0x12ee41a1ce8f7460UL }},
+  {{ 0x53711164c85aa2b8UL, 0x08b761168c1b0095UL, 0x54148fd7a0aeb5b8UL, 0x170b0b33a42a6595UL }},
+  {{ 0x03b23efb473f704eUL, 0x47eccea6ceb92fa2UL, 0x2de1a8f7759f3903UL, 0x1699f4b800b50f27UL }},
+  {{ 0xdc37955099b9aed8UL, 0x5ea8d70adbf3cbdcUL, 0x711b3e1b04016434UL, 0x063c5008f1d4fa40UL }},
+  {{ 0x37cacdcfa252594eUL, 0xabd4909bca291b7dUL, 0x30ca72d4cb7a96b9UL, 0x22e684cc9bd37c1eUL }},
+  {{ 0x0fdc5dce2a9106d5UL, 0x9fe0bbf6e09ef35bUL, 0xdf9edfc80274dca9UL, 0x18a1377ac2b29c47UL }},
+  {{ 0x7dee916d711f29aaUL, 0x1edcd3b670ab73e8UL, 0x1fe5af4a1d94e6abUL, 0x010c830454b9892cUL }},
+  {{ 0xab5f72167e257b48UL, 0xb2f0dc3a821be3daUL, 0x822471d512561f64UL, 0x2f35adc00bba73f6UL }},
+  {{ 0x669999cf41e7217eUL, 0xaf24176539debcaaUL, 0xf2fe7f1407e07722UL, 0x12f142d8b9b7d873UL }},
+  {{ 0xb8d31773f95c3ad8UL, 0x1cfaf0911ea728fcUL, 0x9df7f0b2d555b119UL, 0x20f0de6005488d1aUL }},
+  {{ 0x20cde5525aa524faUL, 0x39ea65e4f6f78ad0UL, 0xb325fdb76e8308a5UL, 0x00d01d5d11bdd07aUL }},
+  {{ 0xec66f24fdd070ed7UL, 0xa20365aa7dccbb44UL, 0x340293d285bc8c04UL, 0x0632040a249d50fdUL }},
+  {{ 0xeaca2a5516802ee6UL, 0xa803ce2f1e41bc0bUL, 0x39f19c23fe3603eaUL, 0x1d4ee015317a414aUL }},
+  {{ 0x7f23511b65906c3cUL, 0x97e832f679fb9d11UL, 0xd28834e3da030373UL, 0x1e0dbeb6651ca456UL }},
+  {{ 0x076323add9372b68UL, 0xfe7751559922d04bUL, 0xb2e9c0c2ced4d3eeUL, 0x198d4be9596b859dUL }},
+  {{ 0xaec38cd8e4fb87bfUL, 0x81880c3734b44761UL, 0xfc97b0cfade4236bUL, 0x2443d34d530ca5ddUL }},
+  {{ 0x9a65115ecbfbcdb2UL, 0xc0044e94b2c8e772UL, 0x353e97fc15ffac0aUL, 0x1740cb98f6adad12UL }},
+  {{ 0xf8511125079fe2c0UL, 0x6454df3a1924527dUL, 0x3b574aa3ef44a2a2UL, 0x0c6ab7a169d9b8e4UL }},
+  {{ 0xf22f386208b5cfa5UL, 0x171e9af9cb8c57ebUL, 0xad67281459c3ad78UL, 0x22fc5a1753e56db5UL }},
+  {{ 0x759de838b4d14f7dUL, 0x2d6d24b2eb4ccbacUL, 0x0b9967823fef72e9UL, 0x0647e27f4c7b4260UL }},
+  {{ 0x26b249dbbb6bcfd9UL, 0x2e915243a547bfbaUL, 0xf91ddf70c064b5a1UL, 0x00a98572989b4ee7UL }},
+  {{ 0xff143abdd385a1b3UL, 0x9121ce7e1e3b3c9dUL, 0x2658797f92eab02bUL, 0x0af7f9705d2ef837UL }},
+  {{ 0x94b9b366bf1889a0UL, 0xc8552621975d953bUL, 0x113e7c17f8b826f9UL, 0x2b8df0c6c1ebb41dUL }},
+  {{ 0xc45c556858300677UL, 0xd440159852f39743UL, 0x366010ecce4f1813UL, 0x25e54508b0983083UL }},
+  {{ 0x299bc8d355a8725aUL, 0xe221d6b55eddad34UL, 0xce4e7e567bb992d8UL, 0x1ce24318fb97c73cUL }},
+  {{ 0x8d17c5c95423c46fUL, 0x7f94c15382de33f6UL, 0x5ddc319b11e2ddffUL, 0x2fc5988d7724dcc8UL }},
+  {{ 0x271e897a81fa7410UL, 0xf18ea06f9d7c93a0UL, 0x268236fe0ef50bf8UL, 0x007e865662f06ee4UL }},
+  {{ 0x984f47a5227285a2UL, 0x2b52d3df84cee24eUL, 0x47f8f5c00dae697aUL, 0x264dd430fa421a15UL }},
+  {{ 0x80c0b11a82283b8aUL, 0x9d9db1ec1aabbc84UL, 0xc1f5b657f8855025UL, 0x1bbe2613dfdbca94UL }},
+  {{ 0x133786471e796778UL, 0xe1c140c3c9de37e7UL, 0xf176a3be9e50f2dbUL, 0x17a4d3e098d17b99UL }},
+  {{ 0x3615899799df3515UL, 0x9c610f47aa126d58UL, 0xddd832c0b19f5db3UL, 0x2ac1158d0ab2fedbUL }},
+  {{ 0x9be209a50a267ac4UL, 0x350eef8f0f097005UL, 0x0ceb921dbe77b516UL, 0x0b2e329c39506848UL }},
+  {{ 0xd514eebea847eebaUL, 0xca7c1e0d82d6df71UL, 0x7a169316647e87e4UL, 0x3017627bb0f41c8cUL }},
+  {{ 0xf8f16384867bbc3bUL, 0x0ff863fbdf737e0cUL, 0x78476b74efd491f1UL, 0x26094facb6205becUL }},
+  {{ 0x0c93c7fc0763b10cUL, 0x253dd72939ec821dUL, 0xc3c07bdc826a45c7UL, 0x1c4daac0e4bd2d76UL }},
+  {{ 0x53119435d9804df0UL, 0x561bf45882ad0989UL, 0xa7b004b60d5eeed8UL, 0x1de60710e103339bUL }},
+  {{ 0x214e5bdff410d1d7UL, 0x0f66103a69ab1d22UL, 0x5942277c5991bf1cUL, 0x2a4e98ac23ede4a2UL }},
+  {{ 0x14755153d62e5a4bUL, 0x236dfa538ddd4b02UL, 0xb4ef7669e6a5b234UL, 0x155e07e605a9c421UL }},
+  {{ 0x24ebd32e4fa81d19UL, 0x89e7da09ba5c503aUL, 0x65146cbf62d4b68aUL, 0x12d85994ca8e1553UL }},
+  {{ 0x1506356212957131UL, 0xdbb73824bc805f4eUL, 0x5a5c11964f8c8da0UL, 0x15ca3a992af2a5e9UL }},
+  {{ 0xb86ef0c4f387773cUL, 0x3dd9af22ffe68f5aUL, 0x196027ffcfa1f46aUL, 0x16af5bb6060a8e26UL }},
+  {{ 0xad34f06691730331UL, 0x997a14c40aa7e716UL, 0x8ce8ab52f5a60802UL, 0x20c2383ac3b95757UL }},
+  {{ 0xd1e525ca10025001UL, 0x94f72c85d5ab27e3UL, 0x26d299073b2a79a6UL, 0x2e5de79d3317752eUL }},
+  {{ 0xd7c055ff446aca14UL, 0xb36224c341c9f74fUL, 0xa7146f608f8f73cbUL, 0x242cef39ee66f3b2UL }},
+  {{ 0x7651db05d2f1560aUL, 0x731fc2b58d733a79UL, 0x8205569ca87228a0UL, 0x1bf49b33f064c94cUL }},
+  {{ 0x9de1a92835b34c12UL, 0x81f56639a00c32a0UL, 0x6fe4e98682185187UL, 0x0fa01c7dbd6f85ccUL }},
+  {{ 0xb8da2994e755129cUL, 0x4f6bd43a34b8331eUL, 0x2227e836f8fc392dUL, 0x1d2ea9c8952e1e30UL }},
+  {{ 0x432c42e08301c2d4UL, 0xce36a04fde26f447UL, 0x0d5532a4beb2c647UL, 0x174c507bea502f48UL }},
+  {{ 0x9fde80e019d14269UL, 0x1b001cc9232c0011UL, 0x51f600638b649798UL, 0x10cea917ef5bbc78UL }},
+  {{ 0x00deb9f3d53eaa76UL, 0xc68443ca5bb79410UL, 0x1b374f948fcfb324UL, 0x2381d483b3966ac6UL }},
+  {{ 0xd1916ecb6f32a3caUL, 0x4e4be3ba8a44ded9UL, 0xf88f1a80373b6d10UL, 0x0058e1b8ce1bc978UL }},
+  {{ 0xa1e2f9184faf690cUL, 0xdcc882472cf1297eUL, 0xece110f9ebe85b2eUL, 0x226593d18cc0815aUL }},
+  {{ 0x45c31ecda7aed7a5UL, 0x6db98288cf1ff327UL, 0x4b3555d3e085de86UL, 0x2295057676a5019cUL }},
+  {{ 0x07e06e05262bf1fdUL, 0xee51778136ef3ba7UL, 0x47a50222b940458dUL, 0x2b5550ef58ce1391UL }},
+  {{ 0xfce42a9dbb6c852fUL, 0x81c493f75cfe9828UL, 0xaebd5db0f18ea6c5UL, 0x2bb6dd4b24ab4078UL }},
+  {{ 0xe668ac58a8279b0aUL, 0x3199ca16e8d3d594UL, 0xfe81f2de8b638f5aUL, 0x0210cdc88819ff29UL }},
+  {{ 0x51727cfe1ed5f7d1UL, 0x1eccf8858421efc7UL, 0x8e708f75a057c2b8UL, 0x244370a2d74323b9UL }},
+  {{ 0x7ecf5673a0fbb5faUL, 0x2e987faee22b50e9UL, 0x85d73f4121e8c356UL, 0x19b82e2891c3e039UL }},
+  {{ 0x1675018b24bce365UL, 0x97fddc8b87f16ca6UL, 0xb43220817d997383UL, 0x23b2992f0f7b703bUL }},
+  {{ 0x5c031deb0a57d2c1UL, 0x2c00b11642aea1a5UL, 0x00457d2e784ffbc5UL, 0x2b405a3e017d79e6UL }},
+  {{ 0x0899e694c262075dUL, 0x1ceb30535c9f67bfUL, 0xb3370e7a5df2c90eUL, 0x206c6d87abdedab0UL }},
+  {{ 0x133c52530cbd54b5UL, 0x881637cfa1965fbcUL, 0xeb71c2e717986219UL, 0x0c262bce458d105eUL }},
+  {{ 0xa918d35d9ac19187UL, 0x755617cb0fc239e5UL, 0x6466a6ccd91342f9UL, 0x2ce99bda6de814e0UL }},
+  {{ 0xc65b4b7c28a0e30eUL, 0xdf755cee63723f6aUL, 0xf23f9835f6165afdUL, 0x295488a07e460f79UL }},
+  {{ 0x25b1974f8e21b334UL, 0xe177d847ed407737UL, 0x8a7ee95c21fe9db6UL, 0x23e6c525081d3cb5UL }},
+  {{ 0x2e6159f6bb021854UL, 0x5518c829322b6a0fUL, 0xdc5bfe950ac97c66UL, 0x2ccc4075d97e46a1UL }},
+  {{ 0x040029e0a16e7433UL, 0x8f137d6e3f9e4432UL, 0x0de63090e83e6ebaUL, 0x29b9d1232fba9036UL }},
+  {{ 0x8e26b9db8a9d88c6UL, 0xa66c31b58552b200UL, 0xdd6da01f517393e6UL, 0x2d4e463f79ea9530UL }},
+  {{ 0xe0382d86618158b1UL, 0x7e2dbcf91225a344UL, 0x11250723c204d8f3UL, 0x07a551e3d24cb721UL }},
+  {{ 0xd9fbe4882d4ec52bUL, 0xe1d418d7ec1effbaUL, 0xcf9ce733809d3c0cUL, 0x23d31eee8df23384UL }},
+  {{ 0xf8b12ad19e40df29UL, 0x11afd0f02255e32eUL, 0xdc632fc12a0f2b1fUL, 0x27d7702fd687bc3aUL }},
+  {{ 0x1104dffbc3e2c606UL, 0x6b90b0ba20b34ed1UL, 0x77defcf4c1da7691UL, 0x19ded510e0761fb8UL }},
+  {{ 0x3ed44faf1e3aef49UL, 0x4683b9f7a3c563a2UL, 0x5e579f011d4fc264UL, 0x2c411bed1a270063UL }},
+  {{ 0xd830a5acbee612dfUL, 0x918b30417ebeb797UL, 0x893fa9a5aad250afUL, 0x0b2351eb97e91f72UL }},
+  {{ 0xe3ba309300e258d1UL, 0x7b633e419ede976aUL, 0xbf057d395ff5c4f9UL, 0x02e05e31bcd55540UL }},
+  {{ 0x98ae0c7062e65204UL, 0x7f1d7193ba37f0baUL, 0x37b71f31d310ffb4UL, 0x25e792f4f9bfd98fUL }},
+  {{ 0x19b6c6f5f28d752bUL, 0x886d17395973d0a8UL, 0xd4f1103bf3237244UL, 0x205da91437e59232UL }},
+  {{ 0x42a9cb203c901531UL, 0x734c7cf5e94b7840UL, 0x85b984e2f91bf836UL, 0x23e2fe2f5ca900aeUL }},
+  {{ 0xf4c51428cc91d33aUL, 0x7c31501b44d5a904UL, 0x5e5240eb43824f9dUL, 0x2192518517a38f8eUL }},
+  {{ 0x86f8f02c417c90f3UL, 0xfcd0e69dc0ff3c59UL, 0x386cf72d84608e50UL, 0x0c58eb951e7d0760UL }},
+  {{ 0xe79296f08e3d967aUL, 0x5a964500e8f70f13UL, 0xc9547aa71996b2f3UL, 0x244a8a8f4172add4UL }},
+  {{ 0xa4c54fbccb7c21c7UL, 0xcd6893ca04fe92b2UL, 0xec37776fd5ebd6dcUL, 0x2e6a99871d9c7d3bUL }},
+  {{ 0x1b61e1f941854cfdUL, 0xaa841fb0144ad985UL, 0x69ec028b07e267baUL, 0x1f2538932a4b8129UL }},
+  {{ 0x06c4efd9779b2629UL, 0xa16fc1e57028b818UL, 0x0c5be95a3c1f52ffUL, 0x1249238d37e4ac56UL }},
+  {{ 0xa4ce6a6192eb5a22UL, 0xff701f4308ba942dUL, 0x80f06083186a5cbbUL, 0x25e246510313d9deUL }},
+  {{ 0x2baadbcd29b13209UL, 0xe4b4933297b0577cUL, 0x34a493c63e5f9587UL, 0x147c757076a506a8UL }},
+  {{ 0x3a27ef2a277fbec5UL, 0x52e7546e8fedeefbUL, 0xe157b475bf18d2d9UL, 0x2674abb6982cd7feUL }},
+  {{ 0x7be3454f45cd16a0UL, 0x50f73891024c1b6dUL, 0xf54895dd4d3820b2UL, 0x28e3eb70ad962526UL }},
+  {{ 0x7edbf3639eb26e0cUL, 0xae8a1c105da82db9UL, 0x062bdcb5640e5fcfUL, 0x257cba81ce2d712bUL }},
+  {{ 0xbb2b1837bacea0afUL, 0x13515bf0a7a31bdbUL, 0x7b573cf2204e4f13UL, 0x058cdc4bfa8515f0UL }},
+  {{ 0xba8c0505388533b2UL, 0xa240b234241135e3UL, 0x05e474c0d77865ccUL, 0x11908372057ec66bUL }},
+  {{ 0xf209959930db34feUL, 0x1376d09acca884a3UL, 0x12ce422f173f5386UL, 0x1f760e2b3ed9b069UL }},
+  {{ 0xf958e1f4a5d249edUL, 0x69cf329a8d949923UL, 0x77bfd8099bb2d939UL, 0x1405de9b5da41626UL }},
+  {{ 0x9802173c1ec06eadUL, 0xde91438e4be192f2UL, 0x4a18b2d408310bd9UL, 0x20456f8fdd6fae16UL }},
+  {{ 0xde20208011335ea4UL, 0xc1f6d020b9909879UL, 0x0af2e3af02117922UL, 0x14fd76d0d6c1e86cUL }},
+  {{ 0x42793d6f638a36d8UL, 0x430669e01ae81720UL, 0x62b171d835c4c10eUL, 0x1982c01e09954fc4UL }},
+  {{ 0x747e0684049bfd87UL, 0x63e39f6d647d6367UL, 0x52492ffd8bb177c6UL, 0x0088602eebee9ce4UL }},
+  {{ 0xb0d83020d1916464UL, 0x24eee10e5aff02acUL, 0x618e8b2380ecea0cUL, 0x16efef5c48d9524dUL }},
+  {{ 0x5c385c1257f0c91eUL, 0x2925caa25d5f639bUL, 0xae88498a4617626fUL, 0x1448e134898e02eeUL }},
+  {{ 0xa2f296987d86fd13UL, 0x8b49fe55bb9eb395UL, 0xce8c92b778cf9d8fUL, 0x13dc347b95ce0ddaUL }},
+  {{ 0x0223581a8f43d3d3UL, 0xdb1ff2b731ae3d96UL, 0x3a0d294f3ce0c59aUL, 0x0639e6c83cf3fa5dUL }},
+  {{ 0x497137ec7fcc6e17UL, 0x6161f2ee8c6fda3dUL, 0x94dacbc6a20bfb6bUL, 0x0a012aac5ed91054UL }},
+  {{ 0x1e75a904fca723e5UL, 0xf279179a1bbb39f7UL, 0xaa87d034803a213cUL, 0x24b11ef5136cf81fUL }},
+  {{ 0x8d6be2199991cd6eUL, 0xef0a423e9356bd51UL, 0x837f26d991dc451eUL, 0x0173789ba3ed7491UL }},
+  {{ 0xa364ea557c7fac04UL, 0x4298499a72603ed8UL, 0xe7e5a7351b2d2a3fUL, 0x120e9f994a389f1cUL }},
+  {{ 0x66fe432931384b4eUL, 0x62199fe7081edbd1UL, 0xf1e9a69b5e1ec513UL, 0x0bcea799c107ae99UL }},
+  {{ 0x4107d2b05df9e0c6UL, 0x249b430e4bb22235UL, 0xa9b7c9187f10f3b7UL, 0x14f13363a4d70df7UL }},
+  {{ 0x8930fb876cee74cbUL, 0x7ea3d43c877c17f2UL, 0x129c9372356572a8UL, 0x147d537ade723943UL }},
+  {{ 0x9b9c079738d9e863UL, 0x511c2891cd9c9b90UL, 0xbd0f6204707820adUL, 0x17831463d6272c36UL }},
+  {{ 0x3e35fe5faa7ff5a0UL, 0xa629454bfa602bb7UL, 0x3db0cb27192fa6e6UL, 0x1681eb9c58c46873UL }},
+  {{ 0x111d22003c36bd6eUL, 0x15b191c3ce68e274UL, 0x1a7b7f45445a7514UL, 0x158abc5cef7a5ea3UL }},
+  {{ 0x3b7b93c5f356772dUL, 0x42505c3f0af6e369UL, 0x1d0dd30412315f0dUL, 0x2cb2d920f5132ad7UL }},
+  {{ 0xde3039f81be440adUL, 0x8c68beebb1dade51UL, 0x3140d6821e19bd60UL, 0x0ee096daddac0f6cUL }},
+  {{ 0xf002f8a33bbf2ec3UL, 0x9f4c58c0b9ce8385UL, 0xc03c3b80a825efbdUL, 0x194b8889629c1587UL }},
+  {{ 0x3bb6a94f262326d3UL, 0x6a1fbcda18e1655fUL, 0xe2674eacd4a9b49eUL, 0x28e89b33bca72ffcUL }},
+  {{ 0xce0e967bdf566f36UL, 0xb5fe88e4811e7770UL, 0x7564b0594f384ec5UL, 0x034257787d2ef72fUL }},
+  {{ 0x8609682120ebcf83UL, 0x35a8f40dcc5e43e5UL, 0x19b0a122a8145831UL, 0x1313ecc6684a6345UL }},
+  {{ 0xa71ab29ec275849bUL, 0xce46d26a0c7b5906UL, 0xd126806c344679dcUL, 0x254614b33b078c72UL }},
+  {{ 0xeae8083bee1f1427UL, 0x1d2c3df6f52107e3UL, 0x2479d68b393aeb7fUL, 0x2b647a371896a604UL }},
+  {{ 0x076c784c1ec0c4d6UL, 0xfb9150d887849484UL, 0xef8a2a79c333177eUL, 0x10e6a8e8428040bbUL }},
+  {{ 0xb021f81d7fee9168UL, 0x8ada3c376dddd897UL, 0xcfbcac27254fed06UL, 0x03ebc9830c18fd44UL }},
+  {{ 0x2059e93173dc518eUL, 0x988ab838eabe8362UL, 0xd43062f18ec52fc9UL, 0x066477c425f351e6UL }},
+  {{ 0x80e25f9bab696ec9UL, 0x00083dd8a59fac1cUL, 0x83f4647dd4b4e311UL, 0x1db83fa0fa4dfa76UL }},
+  {{ 0xf180ea3d1e0cddbbUL, 0x6f43fe15f9f7a508UL, 0xeb0e6c302e6f0065UL, 0x237a5cb658b0c248UL }},
+  {{ 0xb107e6a25eb0ec77UL, 0xdc58a1024a03b827UL, 0xe96af6c85393ec83UL, 0x2ea107fba7686039UL }},
+  {{ 0xb44a711bc8decc0aUL, 0xb77df68138ca2a71UL, 0x4aaa625776359719UL, 0x041454d7a19b5adeUL }},
+  {{ 0x3d054c9526a25c58UL, 0xf66cc8dc05f357b6UL, 0x62afbd88424cd85cUL, 0x08827c95d920bb53UL }},
+  {{ 0x92f84fc47e23337bUL, 0xf960f87fdc2ab290UL, 0x16116b232562a7c4UL, 0x15fbaf230ebfb9b3UL }},
+  {{ 0xd06d78c1519241f8UL, 0x5340e46740318323UL, 0x076ecb058197e5cdUL, 0x200d96a50aa7dcb6UL }},
+  {{ 0x739505b8feb31f43UL, 0xcc3fff6605e8ff80UL, 0x60eb101b2f51a529UL, 0x06fdeb177ef50a3bUL }},
+  {{ 0xa89741174e948bb8UL, 0xe52b3778e9a9f10dUL, 0x59dab59e378d05a5UL, 0x195142ce551a7fd3UL }},
+  {{ 0xef6ed339552253f3UL, 0x77ca0ced135b1d6dUL, 0x56dcc76b068beda4UL, 0x19465f9653f25f33UL }},
+  {{ 0xff0cdd1975a65a8bUL, 0x98e07d555e95d385UL, 0xb35fac63c2c179b6UL, 0x2b517fd567d944e3UL }},
+  {{ 0xf3547b4fecbba3bbUL, 0x02c20718774d2517UL, 0xe8b22c6b7b646f83UL, 0x08af04624a0653ebUL }},
+  {{ 0xee79fe83a2680912UL, 0x8dbdbec5eb8a4003UL, 0x12866bd5ae794f3dUL, 0x08dcaeecbde125f8UL }},
+  {{ 0xd778367851d0a25eUL, 0xd6fa46a0a528c89cUL, 0xaa73120f0e718adfUL, 0x21be6d1f739b0777UL }},
+  {{ 0x278f353bbbb4e665UL, 0x7e5d374d05b47f51UL, 0x37d72272bcc31b1eUL, 0x1fa07b43fbc39b1aUL }},
+  {{ 0x691da3934cd0568aUL, 0xb3079c5adbd5c676UL, 0x9b86848c5204dccfUL, 0x055bb9b0534b68d1UL }},
+  {{ 0x9d71f4b9bb9bf5feUL, 0x8e6e40442eb2cf7bUL, 0xc975c23fc28f9271UL, 0x2c222e12bc44c6bcUL }},
+  {{ 0xc420e99fbe9c4f30UL, 0xd7518653343a9549UL, 0xba224c3453614f0dUL, 0x01557e417468ea53UL }},
+  {{ 0x877949ae78d9028bUL, 0x94aff0604ecf17a4UL, 0x346ba5a06cbc7884UL, 0x1cdc31a241faf3b3UL }},
+  {{ 0x497aeb27e224c98fUL, 0x7cf64015a333386dUL, 0x10afbbe916c10494UL, 0x139a5d016f204f70UL }},
+  {{ 0x26de043748aed313UL, 0xcee8b622b67f7a91UL, 0x86c9daef4d202d84UL, 0x28c23c98a74bfa1aUL }},
+  {{ 0x19d25bb110a18f32UL, 0xd0bb9d0357f889c8UL, 0x2719ed997db27612UL, 0x2be11c21b55116eeUL }},
+  {{ 0x4165b9f838b03839UL, 0xb6a34f9efa43103dUL, 0x898cc445773dfe36UL, 0x2138b58ef6337789UL }},
+  {{ 0x8f20044cf84eb0a6UL, 0xad3b1199e2cea6c7UL, 0xe5cf164fe0869a58UL, 0x0ea60507777d5504UL }},
+  {{ 0x3d918558f91277cfUL, 0x57b8de6855242e6fUL, 0xfa1dd0fe96cdbc30UL, 0x065d78ec01c8f589UL }},
+  {{ 0xe29af5425aae2516UL, 0x075834d79bae9f48UL, 0xc03e62198675e177UL, 0x0abd8b16de1fb726UL }},
+  {{ 0x4459afe8fb4c92aeUL, 0x203cf20c69ef5f71UL, 0xc0f85e5ae4e78795UL, 0x0bce57eb1e6e1db6UL }},
+  {{ 0xa8b905575645cc0dUL, 0xdf258bb2b0484999UL, 0x1250c981a130937aUL, 0x120f3031bf054087UL }},
+  {{ 0x2bea96f172cc086aUL, 0x12fb4ed1deb6e3deUL, 0xdcd01326da3e3a43UL, 0x1eb74d34f90605e9UL }},
+  {{ 0x9d6f9e776ed94b8aUL, 0x75ca8be9dadabf14UL, 0xb07e3def58176fe6UL, 0x289724259560598bUL }},
+  {{ 0xec74202168609c64UL, 0x1796303e78ed22d5UL, 0xc7d8566cf1985c14UL, 0x077fc863eaaacb34UL }},
+  {{ 0x103eb45fac9fc06cUL, 0xe0b19c518b91710bUL, 0x4d3180512db06059UL, 0x216bf7f9236298cbUL }},
+  {{ 0x08e309b345607580UL, 0xdee1a32f25601955UL, 0xe3f128956be13e94UL, 0x0fab5f7b2d6e03ccUL }},
+  {{ 0x8a0babe950ecb447UL, 0x7f18b143b241149dUL, 0x3ec2b19e8ca9395fUL, 0x1db017f8a771b86eUL }},
+  {{ 0xfa5ecc9120a0918dUL, 0xf1b7e7464d131685UL, 0x0d6039677048e7fbUL, 0x1645c008917d14e7UL }},
+  {{ 0xb13fe72255746750UL, 0x3042c2547f6fbeecUL, 0x965b2a3cb51e3db4UL, 0x05f06d3a26f202f4UL }},
+  {{ 0xcd0705d4bd00f277UL, 0x066dea359510c5bfUL, 0x0c99bf536c69a7bbUL, 0x210c92469e7d9ee5UL }},
+  {{ 0x33571aedd5c4fb56UL, 0xeadbf4e3284ea387UL, 0xfd5c062cd0559b15UL, 0x087fe65bd84e9008UL }},
+  {{ 0x11f0f398fcfca105UL, 0xe3ec94967866838aUL, 0xb99940325af823f7UL, 0x12eb9c904fb506abUL }},
+  {{ 0x3e1628489c718e88UL, 0x7af79c859a243aa3UL, 0xd9273fa84f24008fUL, 0x1259282c479c4ec4UL }},
+  {{ 0xe8c3929458a933d1UL, 0xe451cfda454a2aadUL, 0x905146f1f6ec1ad4UL, 0x0efb98af533cc4abUL }},
+  {{ 0x8b06dd77cfb223abUL, 0x33b00daf07a01e08UL, 0xdbce53fcf16d9bd1UL, 0x0b8b95567f07152fUL }},
+  {{ 0x3466f95aef3412c6UL, 0x11a9a0f8fc63408aUL, 0x1fd12910d13012fdUL, 0x24c249e3df45e755UL }},
+  {{ 0xbad6b710fe35d240UL, 0xcb9193adbe38acabUL, 0x6e8c4416ba76d2f0UL, 0x0b79ee6540511eafUL }},
+  {{ 0x454e388271f65024UL, 0x4420fe6886a6f06aUL, 0xbb2493f2dab82f7aUL, 0x07ed68d6eb51d6b9UL }},
+  {{ 0x08b9b507465dba13UL, 0x3ce38c48a7851d69UL, 0xc284ffd2fa9f7c4dUL, 0x1708551a267205b4UL }},
+  {{ 0xe27d522f8aa5d21aUL, 0xa5a4665988704afaUL, 0x84246d1b7959d631UL, 0x2f538e5787e5319cUL }},
+  {{ 0x258f916f41d20449UL, 0x81e37fd74892ab05UL, 0x5a43d83b1722a338UL, 0x0cfe6ed4704f96c4UL }},
+  {{ 0x5b286a5a60b329c9UL, 0xac586f71ebba4d79UL, 0x9c9922547c05f50eUL, 0x2199ad156857c498UL }},
+  {{ 0xec56f4d5214d4322UL, 0x51b1313a09c99fd5UL, 0x970de7c9a65c9ebdUL, 0x15a680f8449e9c68UL }},
+  {{ 0x85677131229e0ac1UL, 0x82e14010df236465UL, 0x70be76dd8b6cd23dUL, 0x0804b2b90690ed9bUL }},
+  {{ 0xa9d6b3bccb9e3842UL, 0x355ac2be1e6c686bUL, 0x4b97853bfd3f00deUL, 0x2913306b4197660cUL }},
+  {{ 0x5cf6932a554d9b1fUL, 0x496577a00311f849UL, 0x47f94386a84a02c7UL, 0x0ae73d1a3f46a2bbUL }},
+  {{ 0xc6821339f522e408UL, 0x7e6acdd910631c70UL, 0xe114dddb4f20ce9fUL, 0x0e1b00572715a7a3UL }},
+  {{ 0xf31d9b08974d839aUL, 0xe45fadfcffca9f8dUL, 0x585c2e67bc5ba468UL, 0x0966c0493e62b80fUL }},
+  {{ 0xc88e7a0f1be0a5f9UL, 0x1c2170844ecf1128UL, 0xf66a91a2989f9ae3UL, 0x16bcb9f1d8f31307UL }},
+  {{ 0x26f7288a428eb7b5UL, 0x79838ad7f1032c16UL, 0x036b013cbc0bc163UL, 0x1bdbd59c83df7403UL }},
+  {{ 0x9e6f5ae7ba20dec6UL, 0xb560d80791467fd3UL, 0x30e1aece8c9816e0UL, 0x12cd0da30c22570cUL }},
+  {{ 0x9f46bf90edc6764cUL, 0x7d2960bae5a6a4e6UL, 0xb19fceaebbf1abafUL, 0x1659edc48c3a125eUL }},
+  {{ 0xa10137a252727154UL, 0x45f6b3c0e0da9ce0UL, 0x6b4b6b9b59852824UL, 0x140735eb64f07db6UL }},
+  {{ 0xc3238d5f5af0b0a3UL, 0x79f8d0920e34a7f6UL, 0x9c25f39837721649UL, 0x259c46f755031669UL }},
+  {{ 0x4073985b44419b3eUL, 0x91209667597e3100UL, 0x15b73dab76e14319UL, 0x286eb3887bb3215bUL }},
+  {{ 0x76b8f267cff8d742UL, 0x059377d92f46482dUL, 0x624ed8b994ef11a0UL, 0x1ddd9dc9d2363e74UL }},
+  {{ 0xe414c8be4786e8e6UL, 0x03526b72fbfd6833UL, 0x16cadeaef558942bUL, 0x0de7ad57896f344cUL }},
+  {{ 0x8c519eed4f088180UL, 0x434190174df27ab4UL, 0x506e0a64499ae2e8UL, 0x00802af287c8947eUL }},
+  {{ 0x6168b1cbd01c1948UL, 0xcb2eed8aebb1293bUL, 0x5c118484ffe45d20UL, 0x08a1f250e17e5d2dUL }},
+  {{ 0x921f380f3feb9985UL, 0x2df6bc9972940ab7UL, 0xfc9d3496065c2281UL, 0x2f5f52681995680eUL }},
+  {{ 0x853259433fe02991UL, 0x0b1c15993cb0aa0aUL, 0x2e7a6f1bf456f2d8UL, 0x05305302196ed628UL }},
+  {{ 0x0b19c030cabea27cUL, 0x96fd76a2534a67d1UL, 0xd100e5155826ddd6UL, 0x152bc2e4b0c90ccbUL }},
+  {{ 0x2b516bf2d8f23841UL, 0xae0157a5f4f4d3c0UL, 0x721b255260851327UL, 0x0adfbf4677ef49d8UL }},
+  {{ 0xc1cf0a59cfb1e83eUL, 0x87287b9693f708b9UL, 0x5bdf39dcd3d086daUL, 0x2a75429f74b75283UL }},
+  {{ 0x85b72faee2dc2986UL, 0x9b080a8af84b2d78UL, 0x15aefff06b1747edUL, 0x071d7ffe55e0f762UL }},
+  {{ 0xdfcd9256dec07c94UL, 0x2029ae3bc2abf4aaUL, 0xb27e27ccb6dd8305UL, 0x0a409987f0af0a10UL }},
+  {{ 0x5235c1de79ad0486UL, 0x1acfe17ccf442febUL, 0x9c0690cf98a546b7UL, 0x0cc6fe9c83a032b2UL }},
+  {{ 0xf9d1c4b62df55ac0UL, 0xf797459fa390dc48UL, 0x4e712ea2740a01d7UL, 0x2077ad905053fd6bUL }},
+  {{ 0x5487eb3d9f5d4947UL, 0x33c1db247bed4fc3UL, 0x075f0167f34e8a99UL, 0x0a39332b2384fa24UL }},
+  {{ 0xdfcd40a1498519b9UL, 0x98a4d8e5e40c7370UL, 0x790230726b89ee13UL, 0x1d78d8acf6d9d4b7UL }},
+  {{ 0xa93169be5998d369UL, 0x3be92b8cffc22352UL, 0xd862270970cac9adUL, 0x18f8770d69ae36dfUL }},
+  {{ 0x7b5b85800f68229fUL, 0x9c7151f2730f69f7UL, 0x2be0cc6db0a63480UL, 0x04ff85b99cec7575UL }},
+  {{ 0x382832b3d5b34a32UL, 0x1119bb688f2e7e72UL, 0x5c706103ecbaa4c9UL, 0x2ca118b9294224d4UL }},
+  {{ 0xd6c2725269d76aa3UL, 0xef8d63922d68be44UL, 0xeef0dd4aed484631UL, 0x169b53dd209b49dbUL }},
+  {{ 0x575846168ee75967UL, 0x689edc5e483a281bUL, 0x44182aeff2471088UL, 0x0e24ad15f0e6f3f0UL }},
+  {{ 0xec2818eb58967d6dUL, 0x5be070e0bcaf210eUL, 0x434d9a14961b00d1UL, 0x1b95ff000aa38092UL }},
+  {{ 0x49ec70deea8950ceUL, 0x4c21a81c082550d3UL, 0xbad4d4d105817f3eUL, 0x08faa1d738d5c85dUL }},
+  {{ 0x159489c24774dce9UL, 0x477a54ca80e12b37UL, 0x227ca22821fb9b9dUL, 0x0e63a0e1b2ddc894UL }},
+  {{ 0x9fb7d03bea5e14abUL, 0x4cfa91e7107f04cbUL, 0x46fdad8c184e4db2UL, 0x0f4a26fba417fee3UL }},
+  {{ 0x6313a900faf26d93UL, 0x471633623075f107UL, 0x931946243e1ded6eUL, 0x2fc16e6d5f7fbe35UL }},
+  {{ 0x8aa791119308a766UL, 0xb3796f8d6e6f960bUL, 0x08fd599a9fe8b79cUL, 0x20a309558ed93f2fUL }},
+  {{ 0x2ca1c152824e997dUL, 0x0051fddf62ebbed4UL, 0x96f5b5825fe039d5UL, 0x2c5c298f9935cafbUL }},
+  {{ 0xf650a3ba08b79e1dUL, 0xc7a60a401f470329UL, 0x09c3ca36e04f3b45UL, 0x2caad9c3e44f0076UL }},
+  {{ 0x6cf3acf588e53718UL, 0x8a52abe1ac443ac7UL, 0x370a77f7c604143bUL, 0x06b811a3fe178838UL }},
+  {{ 0x2fa1a5ad1d84d114UL, 0x491800da0e48650cUL, 0xa2a26f9624ac778aUL, 0x2667affdcf67bea8UL }},
+  {{ 0x3c771e50be05847eUL, 0x1050143fa2e06064UL, 0xfd0afa7735809341UL, 0x196c535eb1ca69c0UL }},
+  {{ 0x8690c6a7de123af4UL, 0xfac9da947f699a05UL, 0x913755e7c3293f40UL, 0x2523393de53fb215UL }},
+  {{ 0xa193e1f9e80a45feUL, 0xf3b13c0b7c72e3d6UL, 0xfac1678ee50d2b9eUL, 0x09b924a314ae26c2UL }},
+  {{ 0x495d23bcc8c47fd5UL, 0x792d467e27793c0bUL, 0x5a149bce4808c785UL, 0x1e4781d1840d7b4dUL }},
+  {{ 0xe46e8461dca5f1b3UL, 0x4385db0930deba9cUL, 0x8f4e5711911ed83eUL, 0x1d30d82a608aa9efUL }},
+  {{ 0x389df3539c180c2aUL, 0x0b2875158628ea0fUL, 0x69467a61080b17c1UL, 0x1e5c3ac640edfbdeUL }},
+  {{ 0xfc00d6907508f8b7UL, 0xcc89cdbcb5c50786UL, 0xfeff03c4b03c9311UL, 0x19ed6787abe6f081UL }},
+  {{ 0xff8982c2eef97dfdUL, 0xa466738b3e21ab13UL, 0x3bf91b8f226b3515UL, 0x2e79fdd99003f765UL }},
+  {{ 0xa8be784244740db0UL, 0x06706416777ede0cUL, 0xad82d476a07441ecUL, 0x1bc684bf28463ea6UL }},
+  {{ 0x6764958c8bcbf0d9UL, 0x60e08e0474284f81UL, 0x2b6b4e84cc8f34cdUL, 0x04ec695f3aa0210dUL }},
+  {{ 0x60c8f32a0265ceecUL, 0xa4486a7204d085f8UL, 0x955dcc36f85e1513UL, 0x282df08620f157ebUL }},
+  {{ 0x3fbc71b5e4f6e7b6UL, 0x4b3a53255ac85e83UL, 0x123b7742cd64b61eUL, 0x274e5eca5c112388UL }},
+  {{ 0xe4caff7e5a00cfddUL, 0xdec3cee76ec103d9UL, 0x3a265e7fe90b3b90UL, 0x145b48c7a40bdd4dUL }},
+  {{ 0xba1641d42c66b4beUL, 0x7278df134771381cUL, 0xce5c14cb3d73ac8dUL, 0x1d288191f8e4bce0UL }},
+  {{ 0x9e08da2ff6604c1dUL, 0xef4fa279a03f304aUL, 0x8d83d8f188540b00UL, 0x03b8e26b84992f2cUL }},
+  {{ 0x7289ae444bee2952UL, 0x30231e0c028db4f7UL, 0x7a6e1b93087f35c1UL, 0x166c8c2480b44a97UL }},
+  {{ 0x555a3852ba03f8b3UL, 0x3e282e4427848fe9UL, 0xc4e6631cafae2d95UL, 0x19a7c90c4c01299dUL }},
+  {{ 0xed86777a5c86dee4UL, 0x6edcc9654a2eec88UL, 0xae610222911987dbUL, 0x2c778bf55df3c21dUL }},
+  {{ 0xcfd784ce7392bd5eUL, 0xe7139708abd0a016UL, 0xcf6951f8b6e97c64UL, 0x2457db8b6ede33abUL }},
+  {{ 0x67c9dc19a135679aUL, 0x082eeb0854325cf9UL, 0x96fc88cca1305115UL, 0x2fdaa303b13eda88UL }},
+  {{ 0x5a9e81b96c1d7cb0UL, 0x58cfe58256d3eeb0UL, 0x00a041d3e0f634f8UL, 0x0690cb9ab19deb64UL }},
+  {{ 0x0bb8afa47a4ac248UL, 0x434161872ad2c2d9UL, 0x34f9cba366cb9575UL, 0x1f0f7184e1f2dcbeUL }},
+  {{ 0xd8106ca79b77ecc5UL, 0x66e374a76ac59c95UL, 0xf08bd91515fd490aUL, 0x1ba3b04cd0bbf736UL }},
+  {{ 0xa9fa28566c111f99UL, 0xd457722d61ad15f6UL, 0x2d346f5e8e612df2UL, 0x217eab0875e8dce0UL }},
+  {{ 0xa848814c1b0c5d62UL, 0xbf85cd0d9a1109a2UL, 0xa28257357cdcfbb6UL, 0x1bc7c891f4a8c16eUL }},
+  {{ 0x82cd8fbe016ba8f5UL, 0xc294f8655865877bUL, 0x355eea75ec663212UL, 0x085dd329981c11e9UL }},
+  {{ 0xf92ed0649dc0508eUL, 0x2c4ac839d8bee6caUL, 0xab6c0ec391f4169aUL, 0x099f3db85deb81caUL }},
+  {{ 0x4921ca0c9a6ea938UL, 0x93053e10854a027cUL, 0x5d7e813f050e01d5UL, 0x0c9a94d2964b004aUL }},
+  {{ 0x6ab09e167415f402UL, 0x2ecadfb0981ed236UL, 0xdd6fc5baba8ba1e8UL, 0x2bb7b4c6d7e9be33UL }},
+  {{ 0xe00e57037db66e3eUL, 0xcfdc0d6ab12fcfb1UL, 0x03a9c967351a02d3UL, 0x1d2239846995e0d9UL }},
+  {{ 0xd3271abcb1af528cUL, 0x35be6816ea1dcbceUL, 0x330d22bbcb8c5e6bUL, 0x03c8e7f2d6e301cfUL }},
+  {{ 0x78454cdb4828c800UL, 0x802f19d3c4a95257UL, 0xfd291e697e15ef11UL, 0x301aef88be4cef4cUL }},
+  {{ 0xe7eb393d7fc9d67bUL, 0x1ded468404999ebfUL, 0xc7d06228446de36fUL, 0x17d1ac1aaa035c8dUL }},
+  {{ 0x075e17721355d384UL, 0x5c20077202f90c7dUL, 0xe26d8909bab79e0bUL, 0x21471f1f37b87f7aUL }},
+  {{ 0xb8914c1e7fee6432UL, 0xaf5ce13452dcc4e2UL, 0x84458f55bb55d6c5UL, 0x0d6965066864e044UL }},
+  {{ 0xb305303da9abecdfUL, 0x52b5bf8d0864c985UL, 0x5bb2efa5b20260ffUL, 0x10efa5af38b7665fUL }},
+  {{ 0xc70739c15481d2c8UL, 0xf04ea06faa0c72a6UL, 0xaf1d7e24b040fd75UL, 0x0dd8a16320d0e4a8UL }},
+  {{ 0x580bdde9a99464dbUL, 0x5e6c117c1ad8d0feUL, 0xbd09507a725dd995UL, 0x2564a38ed66289f8UL }},
+  {{ 0xdd03d9b2245cfe80UL, 0xc5363129ed00d9a0UL, 0x642ffe9ee2a50d08UL, 0x0d7101948beb5e6eUL }},
+  {{ 0x26f5e5f9bf28c7fbUL, 0x64aa9f92e3da52deUL, 0x74480e3e7a8dabf6UL, 0x097c99c137743a85UL }},
+  {{ 0x4bcf273e3f056204UL, 0x1122fa0f4a1b542bUL, 0xa303133adc177aeaUL, 0x0752e12da72c56b6UL }},
+  {{ 0xece8587c651a361fUL, 0x3fd9044372121b0aUL, 0x14d8d37eede73e04UL, 0x2c194bbcae5cc6a5UL }},
+  {{ 0xf236d97e035aedbcUL, 0x9205f78dd5d38ad3UL, 0xb85e6b95013abb26UL, 0x203076e406808528UL }},
+  {{ 0x4f69111639a56d2aUL, 0xe375ac2d1de2098bUL, 0x7b545a3969d4c4ebUL, 0x207c49333ed9dfb7UL }},
+  {{ 0x7a60d80dfd25dbd7UL, 0x9725bfc17bbcbdf6UL, 0xc6c98f7df9616778UL, 0x0f5b7699b2dbdb1eUL }},
+  {{ 0x1331cf02adad9be3UL, 0x235b48c8a43c36cfUL, 0xd0b53bdeaaa16749UL, 0x21a79059e98e80c0UL }},
+  {{ 0xe03b3d7d1b81ea6bUL, 0x12b460cc185c0192UL, 0x098fc90393feb286UL, 0x188b88b3a9d2fd6aUL }},
+  {{ 0xd40bb50c022d0d3cUL, 0x4f567a16e533fe47UL, 0x301c72967a46830aUL, 0x2740c8a065da3964UL }},
+  {{ 0xb68211f67e4cc2c4UL, 0xe9f1358624e8405cUL, 0xd6afd266c44344f5UL, 0x0ad13dcf5e6e6f38UL }},
+  {{ 0xfae622cbcd5f6762UL, 0xc9d367e45a0b473eUL, 0x8ca373a1d3a9e582UL, 0x00392938d9dc3f64UL }},
+  {{ 0x8821eaf177740132UL, 0xd8d3b34fa9a83ae7UL, 0xf3c8f9716370be41UL, 0x297853a06c9f5753UL }},
+  {{ 0x47b93f1cd8ddb09dUL, 0x0be06c8747685992UL, 0x17349fe57aa80b14UL, 0x2fd0b8093c8fcb8fUL }},
+  {{ 0xbe8d861bcce52771UL, 0x3f9958a2f41c8744UL, 0xa2fe205fc8ce587eUL, 0x085311b209abbacdUL }},
+  {{ 0xb35589ec97bc891cUL, 0x0a4cb6697a3a6cadUL, 0xe7ac9a3ac140c442UL, 0x1bd4881d22d43b36UL }},
+  {{ 0xfdcf9dc8e69f54c6UL, 0x7e3652cd9944427eUL, 0x00382aee91822f29UL, 0x02388218c538b652UL }},
+  {{ 0x3264710b210dc865UL, 0x34b087396bcafab0UL, 0xf2dfb96bd7b40e3eUL, 0x14bc32951c03aa0fUL }},
+  {{ 0xeb08374c3072e3e2UL, 0x5f07abe64722b6deUL, 0xd5038a0c1a0e2e52UL, 0x1b7c7b0839f76468UL }},
+  {{ 0xf55eb071ea2babc2UL, 0x9b009ea3ec54a5a4UL, 0xf66771f338e71b06UL, 0x03b78b5434f67a48UL }},
+  {{ 0xb48a75a7e2d91b1cUL, 0xa86ffa513879cd35UL, 0x89f4da6069bfe858UL, 0x05b30c5f46e88f27UL }},
+  {{ 0xa63f55db7451e29eUL, 0x82633b3ab12f67afUL, 0x334fc5783b3b1f2bUL, 0x179c7567a653f3c3UL }},
+  {{ 0xb5384424e4850ea6UL, 0x51095ca1e7a92852UL, 0xdcb1abad39afd5c1UL, 0x2d940fdc72be54fcUL }},
+  {{ 0xaa51d1ccb5730932UL, 0x38ff9a859956e182UL, 0xfb1549d794421b60UL, 0x1777c7c54479f12dUL }},
+  {{ 0x8ee79832a43b4e3fUL, 0x75d438ec2af7d5e4UL, 0xc767432fb2642ce4UL, 0x305c7bf7c2323b37UL }},
+  {{ 0xef3475a6465c264cUL, 0xa2f6d2e486353f0bUL, 0x31c6e5e1abda9f46UL, 0x14f6e6d72c666baaUL }},
+  {{ 0x607181272e875f95UL, 0x9efc29b85521a549UL, 0xe738b738279e145cUL, 0x1e3051acafe7133cUL }},
+  {{ 0xe6ae5a7363fcfcabUL, 0x0d6cf43a4056ac57UL, 0xe517499605590418UL, 0x0deb354ddcf8561dUL }},
+  {{ 0xf2f00515d14b6366UL, 0x03fb8a7b356be75eUL, 0xf7ab17dabd3be442UL, 0x245657e1ffe60371UL }},
+  {{ 0x074445fb7554a413UL, 0xd8716b71fdc9d0aaUL, 0x5d676820231b64f8UL, 0x28930d18cb28546cUL }},
+  {{ 0xb85a72db4e53bfd7UL, 0xf321b402cb314da1UL, 0x37538629cc570389UL, 0x0aa0b78f9abfc795UL }},
+  {{ 0x818124472af7c4ddUL, 0xc6bba277883e9499UL, 0xd07f9486da7386bcUL, 0x2fa835026a6429f5UL }},
+  {{ 0x7be8dd5aee05f3c8UL, 0x4ffc577cbd5a0038UL, 0x7386a35973d28660UL, 0x25b13178e90d6560UL }},
+  {{ 0xa00bc8986327e882UL, 0xbf103b16af362663UL, 0x16139acee7f92248UL, 0x069f5502e0e63b01UL }},
+  {{ 0x47a921520f3214b5UL, 0x9a6a5380d2d43910UL, 0x7254271db7675724UL, 0x0afa1e1a045c12b3UL }},
+  {{ 0xc3a5f606dd190412UL, 0x3d111cc11b477791UL, 0x2abdd071eb333489UL, 0x1ef0f016e6fc867fUL }},
+  {{ 0xf198ec0f97c935f0UL, 0xbc1fb9f06afa4bf5UL, 0xbfec0dee3f17def9UL, 0x038377364a2896b1UL }},
+  {{ 0x790a265a872255c6UL, 0x687d4b4f989072b5UL, 0xe62681509b669959UL, 0x02f78a18d7419955UL }},
+  {{ 0xe6dd44c538da690bUL, 0x822363a88927f741UL, 0x55a921f0a77c0582UL, 0x064698b9464a8bdeUL }},
+  {{ 0x338e384b16eaae36UL, 0xac35f768add4aa13UL, 0x33c39e066de5146dUL, 0x0fa05cdbc1b38d22UL }},
+  {{ 0xea911fa0ed45c98fUL, 0x084f792db071a5b0UL, 0x06af8f5fa2e6ec5aUL, 0x0ae80fc7d3f024b7UL }},
+  {{ 0x5d900903355a6069UL, 0x63c2fd9f019c96abUL, 0x392ae31d5799a827UL, 0x08238efb879eada8UL }},
+  {{ 0x269f244dc4ec982cUL, 0x578a6b6ef30c2630UL, 0xe79bee0bd0f4bc8aUL, 0x14b00165b08da770UL }},
+  {{ 0xc3f8702c23291db0UL, 0xe0c8aea1b7811a72UL, 0xa26b97b0648bacaaUL, 0x2268288f50db1321UL }},
+  {{ 0x50c79d0651178057UL, 0x0a307af502e18af7UL, 0x1d45155097e6d3b1UL, 0x0de81a532c99732cUL }},
+  {{ 0x6775a54d7f034a16UL, 0x227859b0d796a94dUL, 0x2bd0dfb7a32446abUL, 0x03868a726e828e75UL }},
+  {{ 0xa8b87172eb7e5705UL, 0x6f8d9b1797dd8d6bUL, 0x5c66849e21f680d7UL, 0x02eb9fcd1e46a892UL }},
+  {{ 0x69a6591e72b45f49UL, 0xe243d61015a316ceUL, 0x2a377dadb15915e8UL, 0x250695109a55aa40UL }},
+  {{ 0x418e770ed2369970UL, 0x0cd3b2745c2759dbUL, 0xd0f8a40f999efb40UL, 0x265b4c837a42123fUL }},
+  {{ 0xe1f1261139a0e3e8UL, 0xc482674016f83aa6UL, 0x3a76e3042b4d0405UL, 0x2835707260531498UL }},
+  {{ 0x51faec30701b8d6dUL, 0x1e6de618054bed90UL, 0x6f0080ff2132719eUL, 0x0b849729fe72738dUL }},
+  {{ 0x5d223c8dd93e1badUL, 0xbd1cd216cb3e082bUL, 0xb3204ae278de80a7UL, 0x1d85a2d7f002061eUL }},
+  {{ 0xb0a503ab3f96b79eUL, 0x9245607c097bdd4dUL, 0xbbefcfef8bf6b0abUL, 0x084c412fc222da8aUL }},
+  {{ 0x0ad08f1bfb77296bUL, 0xe317ed908abb9795UL, 0xffdc887321bda748UL, 0x197f4af04549c66aUL }},
+  {{ 0xdfc71658fc22bee0UL, 0x7e419f6a158231ceUL, 0x52dffc9d98da1b42UL, 0x2837f7a084e35d62UL }},
+  {{ 0x3ccb6b8947376438UL, 0x7badd82c2d16ebffUL, 0x14198a785c36bc84UL, 0x07cc733fe40be42eUL }},
+  {{ 0x653d0f985457c714UL, 0x5e28c10ac6037797UL, 0xc59ac3d4c394c1f8UL, 0x2ee8bf9275ae4961UL }},
+  {{ 0x8040cd8971a0c401UL, 0x9b828121f65c3d0eUL, 0xe0fdb397bdc04982UL, 0x094499d62c482aa4UL }},
+  {{ 0xa24fa65189cc615eUL, 0x76069cd4a82b378cUL, 0xa4a77020122b968aUL, 0x0d37affed022160dUL }},
+  {{ 0xb4d78407a4b3d9bbUL, 0x72e98c03aa9eaa9aUL, 0xaf0f80aa6ea24f83UL, 0x304e2736ed1805ffUL }},
+  {{ 0x4324abeca89b721cUL, 0x4f263bc1767930f1UL, 0xa024df4f7c5c2e44UL, 0x2499f863ded832edUL }},
+  {{ 0xe0d7f096b1f57467UL, 0xcfa654fa384eaef2UL, 0x66e4138f49535db0UL, 0x1f6ce4ed911f505eUL }},
+  {{ 0x013e6518ec17c494UL, 0xbb36bca0b9b3da7eUL, 0x938590633e2d48a8UL, 0x0ec37f004fd840f6UL }},
+  {{ 0xdeeb9012226826baUL, 0x6cfbd9d69eb94ed7UL, 0x51c9935a7a6735b1UL, 0x014e62c0386d99daUL }},
+  {{ 0x12ec400d1e13dbf0UL, 0x087155007effd1a7UL, 0x37e51324cff7c746UL, 0x0ad098bafca070d4UL }},
+  {{ 0xb7c9786b1385044cUL, 0x22916b5060561710UL, 0xc47204d21c78b2c3UL, 0x155d0485db5efae3UL }},
+  {{ 0xa8f35eb78d696a7eUL, 0xeffdea78481d7a82UL, 0x2d4b47dc55bb57c9UL, 0x285a7d31d687f074UL }},
+  {{ 0x95f043483b92a353UL, 0xb7d6288db94ce6fdUL, 0xe0f7d4c38436bd82UL, 0x050e39d37e32c9faUL }},
+  {{ 0x30cf451a81b447e3UL, 0x8b9c6dc9ff603f3cUL, 0x4214b684082ffc11UL, 0x203ef89eb89d9b80UL }},
+  {{ 0x80e12fcd187813c7UL, 0x906085065ed8cabcUL, 0x67dd8f5ad9bd9964UL, 0x140e5302c8085f66UL }},
+  {{ 0xa52d2f5e9fc051e7UL, 0x531dbce6fb1cb526UL, 0xa7ef7d7cb40a0a39UL, 0x063210dfb205a232UL }},
+  {{ 0x8c1cbb5d732dec57UL, 0xa790776c32f868c6UL, 0x27dcfe3a85f560a5UL, 0x1bc18362e195c974UL }},
+  {{ 0x703d3c583411b71cUL, 0xfc287a08b5161632UL, 0x184ea98218ef379cUL, 0x28c1ee0fc5b528e4UL }},
+  {{ 0xa1dff5b52bbd889fUL, 0x5b43f97183bb41f7UL, 0x4a1123d8a3b07410UL, 0x2a949a636cbd312cUL }},
+  {{ 0x3e4428e840ef16a9UL, 0xf3094cfd6a470001UL, 0x06b6486cf325904dUL, 0x24bf68e734987946UL }},
+  {{ 0x503a753326f16cdfUL, 0x40993818ef1d7a20UL, 0xf5baf0ec31519d0aUL, 0x03dfd65fa33a5812UL }},
+  {{ 0x941756369e77c1f0UL, 0xb765aa7fa9e015b2UL, 0x6d81368b7545cd62UL, 0x297fefe27d7a485bUL }},
+  {{ 0x5f1d13b5960e848cUL, 0xbdebfb51f1a9ee76UL, 0x333f520823010d14UL, 0x23d0ecb1396e73e6UL }},
+  {{ 0xcc076bb9eaa1156bUL, 0x500a52716846de34UL, 0xfb58df7f3591a990UL, 0x00fe10656ace8660UL }},
+  {{ 0xee5fa2c28533213cUL, 0x51dbf176f4527ecdUL, 0xde7fa064815879f0UL, 0x081764f6d778d5f6UL }},
+  {{ 0xc452837ab629a8aeUL, 0x314e4439ca8a9890UL, 0x138bf93cdf870393UL, 0x027600c25590b72fUL }},
+  {{ 0x4b5c1a1715b915edUL, 0x3cbda8f8d99a58e1UL, 0xcd1214290390e00aUL, 0x2c095670955be736UL }},
+  {{ 0xcc2df15bdd11b1eaUL, 0x2af927d961a8ba94UL, 0xe4912ab88a835e35UL, 0x15a39cd014032151UL }},
+  {{ 0xb2acccfd50986161UL, 0x7869c24ee8ccd366UL, 0xa312e067767d209eUL, 0x1f2085224981efbeUL }},
+  {{ 0x7415fa920877ae3bUL, 0x3518ef92f38dfbdcUL, 0x22b47bca75b48e1cUL, 0x141adeec3b356737UL }},
+  {{ 0x80342c6eb6bb0228UL, 0x6dc50972a526f24fUL, 0x61821141706727b9UL, 0x253a9056e1c73c78UL }},
+  {{ 0x80f8ae9e6a43b09cUL, 0x01ed391b3636da7fUL, 0x9bcfd0470df4a5b9UL, 0x2e27b23f8aed614cUL }},
+  {{ 0x46802e82711485e5UL, 0x183b866e5752c601UL, 0x99f190c5a166caeaUL, 0x1b7f4998b59512feUL }},
+  {{ 0x32fab43a76dd25ddUL, 0x97a4dadeb2d5a695UL, 0x10a06f979a1e885bUL, 0x0a67e01df02ad96aUL }},
+  {{ 0xb2d1200bdffef000UL, 0x6db0f5dfb7ab3357UL, 0x6b0349c2dc48cf20UL, 0x156dde177a7151beUL }},
+  {{ 0x12dd048dc386cd7fUL, 0xaf5b444f1240832cUL, 0xc3f5d256acddadd9UL, 0x2c709bb59e72d506UL }},
+  {{ 0x2c472697dc2b7e60UL, 0x08eb09c395c687abUL, 0x328d77a80fa5c04aUL, 0x1205550e0a43d09aUL }},
+  {{ 0x5c589013c3c69e17UL, 0xc565d847038292c1UL, 0x719bba96a2e15d89UL, 0x029288fd90c94af8UL }},
+  {{ 0x306ede4e5bd53564UL, 0x7775ba74702e7ab7UL, 0xe9c4db805c2ee4f3UL, 0x071e1e4b9ab44534UL }},
+  {{ 0x94dd5c911fb9b0b2UL, 0x6a3f75a37922d833UL, 0x1a324bd3fdeefec2UL, 0x25db82e953ae18f3UL }},
+  {{ 0x7f3dac5f9734cd1eUL, 0xe21b886b5c26cca3UL, 0x4cbc63ad3434fb3aUL, 0x22fdfc92447f73a4UL }},
+  {{ 0xda6d73f240f60c5fUL, 0xf528cf77139ba64fUL, 0xb63cc15d97549b4bUL, 0x1e9646539aae7453UL }},
+  {{ 0xc14d27f0917e13d7UL, 0x8197d38189f27d8aUL, 0x23470725b88e423eUL, 0x1144168d12d811bfUL }},
+  {{ 0xf51b9d527a3b0b3fUL, 0x2038fcf2d6bd4db1UL, 0xf79893ff81b73b85UL, 0x1a6df42c6fa13d76UL }},
+  {{ 0xbd401569c7f6ab49UL, 0xc0ec41aadfe6d4e7UL, 0x4d7bc44d1937564bUL, 0x0da8dcd74912632cUL }},
+  {{ 0x1fff90a1fe7ec30dUL, 0xe06c66980f525bb9UL, 0x2b9486ae00a6e6e4UL, 0x203a190ccb907a72UL }},
+  {{ 0xaa32f70b091fd864UL, 0x18fdaa7928d19709UL, 0xd05d885b2a4282d5UL, 0x0257f04d7589326aUL }},
+  {{ 0x98dea9f0fe4c6986UL, 0x6c0cc71a7d16ea6dUL, 0xad21370082839a22UL, 0x0f6fca62571a75eeUL }},
+  {{ 0x3333b5131c4a1b65UL, 0xb7a608e14f980b66UL, 0x660c65aaaf2e59e4UL, 0x02dbcd403fede90dUL }},
+  {{ 0xd5a6865cbe5e96c9UL, 0x4c64961985172bdfUL, 0xb5e827385f6d0468UL, 0x2f2640b0c1647fc2UL }},
+  {{ 0x11f0781af317eec8UL, 0x358023da3f4c2c73UL, 0x0f34659349bdb952UL, 0x12fc447d68dbdfeeUL }},
+  {{ 0x7d9700ab91dbdc64UL, 0x0b90d24622eef67fUL, 0xedc39fab43410ab1UL, 0x20a65c59840631c9UL }},
+  {{ 0x4f1d6e01ef3fe1ccUL, 0xa20a6b72b223620bUL, 0xdc247153c4f96f5bUL, 0x129ebcd0f14648d3UL }},
+  {{ 0x1b27d04398a0122fUL, 0x59cd033ed4e2a9d6UL, 0x9904adec29d8824fUL, 0x1cc405503687076bUL }},
+  {{ 0x99c4f6b9f75dc4d9UL, 0x97bdfc62d265a0ffUL, 0x13572828dc04cb6cUL, 0x0bcb855ab8fb42acUL }},
+  {{ 0x64ee0443dcf51503UL, 0xddcf57300ee605baUL, 0xae2285d22c237b63UL, 0x185966fd54cf6c26UL }},
+  {{ 0x1a132744ea323132UL, 0x0b9e205fd668f999UL, 0x2fc18a2390c7d1c0UL, 0x11418a2d63563230UL }},
+  {{ 0xae6ee45f769f21a3UL, 0xcaf95abad26f60a8UL, 0xd010a6ffc3ea96c9UL, 0x0c48b6a8e30942cbUL }},
+  {{ 0x48c22eeca55f5018UL, 0x2ce918fcc960849cUL, 0xa71b23c26ed663e5UL, 0x23f278b40f8a1ee4UL }},
+  {{ 0x87e09f531788af88UL, 0x449837200234327aUL, 0xae36e3256eb50a36UL, 0x0145820add7c7aefUL }},
+  {{ 0xd06c9b2cbeb01e4aUL, 0xe9dcc3404190119fUL, 0x790347e8c296671aUL, 0x168ac26a18515f1eUL }},
+  {{ 0x070d2267e86971adUL, 0xd9295a04ffa4398bUL, 0x595a191c33a476d1UL, 0x105206d17dcd0897UL }},
+  {{ 0x208746be312d89b2UL, 0xcff86eed77b7db85UL, 0xd2a2c6eae5cbe026UL, 0x000c184b93fbf75bUL }},
+  {{ 0xc3b5ccf5c821feaaUL, 0xae38619bb35a96edUL, 0x869a5187806177a1UL, 0x2c0f00c60238a37aUL }},
+  {{ 0xeb43fdce1962f29dUL, 0x5a5ccf11b7960de3UL, 0x759e0330e2b183abUL, 0x1a9bc957ba6e82a4UL }},
+  {{ 0xc5d891869ba83c43UL, 0xb83982faf64b6bd2UL, 0x4e7dc47bc936bebfUL, 0x206ad0008f986979UL }},
+  {{ 0x64a95126c21c556cUL, 0x35084ec43e3801f1UL, 0xd9e007f8fa52431eUL, 0x1186ea662c1e9597UL }},
+  {{ 0x2df785e24ad447adUL, 0xae8fec202cd9aa1fUL, 0xc1089deb992f28aeUL, 0x22c7ab737d2416ceUL }},
+  {{ 0xde0c87563fd01016UL, 0xe716dc355ed83256UL, 0xff3c4113ae1d9378UL, 0x2832a413c0a8e5b0UL }},
+  {{ 0x70ddbc9efb827fc6UL, 0x1d568e46d194c5c2UL, 0xd58088d10bbdfe04UL, 0x22d666e13cc93b98UL }},
+  {{ 0x6809c302b867f5b6UL, 0x7281c8a2359f45dcUL, 0x0f3df28ba5c702e1UL, 0x144ff8c8844f0c45UL }},
+  {{ 0xd03b578e14e6e596UL, 0x8bcfc005cf335ccaUL, 0x0cd5b6b55c0be943UL, 0x2a194e7e1a5d4d26UL }},
+  {{ 0x95b152a21252716cUL, 0xc630dc7d0f1e6a5aUL, 0xeaea72be66990d4eUL, 0x2a6588983a1906e9UL }},
+  {{ 0x57ea1912f4870866UL, 0x45e9b6452f1873b2UL, 0x9a47c431a4381746UL, 0x1f46d4d93bb20bd2UL }},
+  {{ 0x350331364338310bUL, 0xd89bd59c65a7bc19UL, 0x03073258ffc4c6fbUL, 0x0f308e3e33228929UL }},
+  {{ 0x2db19719a6cb8421UL, 0x3f5f52ad3b8ff59aUL, 0x8f8d1ef1ab971e13UL, 0x1e5a21965ef22193UL }},
+  {{ 0xdb5f0f6de75d68b2UL, 0xc8390b1a40be8d24UL, 0xf379c52a70dd1980UL, 0x1fb160668882d2b7UL }},
+  {{ 0x1d1c54cb1f1116c4UL, 0x87fc4e9e045643faUL, 0xdb89b46b1524e01dUL, 0x18fdb84c5b12d006UL }},
+  {{ 0xf50dc1d20e51b537UL, 0x3b7916d9b79441bcUL, 0x3511e921e07adaaeUL, 0x18394d32ac5a3f4fUL }},
+  {{ 0x5dbc664960c60f53UL, 0x75de40d96ffe6a38UL, 0x314e6fbf269eff1fUL, 0x0521b740996f9b3eUL }},
+  {{ 0x0870bc3b1385a34dUL, 0xca3972de8cbf3765UL, 0x578edff9f17811c2UL, 0x18d0dfa12d564081UL }},
+  {{ 0x72bbd1e366f3fa1aUL, 0xc7c62185fc3764a2UL, 0xe53b06dcb3219873UL, 0x20810edf4423fde7UL }},
+  {{ 0x10a1e0e1e5bd467fUL, 0xd3e88711e389da78UL, 0xe5adcf530e3d8d5fUL, 0x089b74e6b4e767d1UL }},
+  {{ 0x3e8571725796a915UL, 0x983cede00d400b50UL, 0xbea9a0d2eeddcb45UL, 0x0ad88bf35727ce25UL }},
+  {{ 0xb5c67ea7a7d78b21UL, 0xab105dd0cc96ea5bUL, 0xda3ed74d73c4cc77UL, 0x0b84cdfb682a2a00UL }},
+  {{ 0x0647a3698223c074UL, 0x49dcc7964b11bec5UL, 0x41fef932f8e34cb2UL, 0x284db15897d314c2UL }},
+  {{ 0x43efb0345253298fUL, 0x4dd2f7126f087cfaUL, 0x6b939638764d96bcUL, 0x1c187c19c51f11fdUL }},
+  {{ 0xdf17486e0575253bUL, 0x2a1f6c756327ecb9UL, 0x93848a505d3c76dcUL, 0x000605e881b3aaf8UL }},
+  {{ 0x3232241ef6136268UL, 0x48a27bc3ea04ffb5UL, 0x23c2ba68498bc00aUL, 0x27c328a93d6ca958UL }},
+  {{ 0x3ed137cdadc93634UL, 0x79d50dc5530a0947UL, 0x68c847ff408ffaf5UL, 0x2e384881f0818b02UL }},
+  {{ 0xd1bdd48e5b77a4ebUL, 0x865dba7b21f852e7UL, 0xcb265b54faf7fe1cUL, 0x1db5869704cf6265UL }},
+  {{ 0xbe36385402ca004dUL, 0xa946399cf8923711UL, 0x70c323095997886dUL, 0x27b4762efb414c28UL }},
+  {{ 0xc481d26386c13c4eUL, 0xefba1800310ed32aUL, 0xe687bab22927d77aUL, 0x1fc838d519c84556UL }},
+  {{ 0xc1f89399d3457e51UL, 0xd01ee89bfc07fd5fUL, 0x5c39a050b895d5bfUL, 0x0c9228934ad00f5dUL }},
+  {{ 0x444441f836a50a9cUL, 0xd63354381615b15eUL, 0xd46162beaa1ef231UL, 0x12e631ccee5b9f75UL }},
+  {{ 0x20413d4da1b9d603UL, 0x16314aa9586fee95UL, 0x898862fb409b36a2UL, 0x03c54fb93c40d560UL }},
+  {{ 0xdfc393d6940bd520UL, 0xe06c5844630c4c55UL, 0xe3b8c687d4f84a83UL, 0x093cf19bfeb730f3UL }},
+  {{ 0x4bf58aa88ecee978UL, 0xd3964cf4ee47ec2cUL, 0x50f442cac712f5bfUL, 0x2b43ef90581ca680UL }},
+  {{ 0x7f66c7ee5c4b7a3aUL, 0xc2901cb0a3ec30afUL, 0x3daafcc8f80e7d94UL, 0x1c6a45202bfe5412UL }},
+  {{ 0xf665b58dc7770fd4UL, 0x97be80bd3742ca2dUL, 0xf66bc76eb7e15ca0UL, 0x17edf7d1194d6699UL }},
+  {{ 0x60441b8c7a780951UL, 0xafe96f3e9061fe4eUL, 0xa9ea73c8ea1513f0UL, 0x1e0ed67060b5512cUL }},
+  {{ 0xb1cc8266c1830e9dUL, 0xddfb60bc1848b4bfUL, 0x47e1793242825c7aUL, 0x28fa226614e3a63aUL }},
+  {{ 0x7a6fc31e0c2f68a2UL, 0xefc460f6aff42dc8UL, 0x6c8ea1b226657cceUL, 0x236f3e1a5acd1ec9UL }},
+  {{ 0x891dcb6d34a51f4bUL, 0x9181f1ba3d56ba8eUL, 0x1cd3fa87e4fd9ca8UL, 0x0003ef773ee16d2fUL }},
+  {{ 0x107e352a78013206UL, 0x0539e6ab1c5f35afUL, 0x1e611ecacda07059UL, 0x2aefc57866c70950UL }},
+  {{ 0x720d26baedc93aecUL, 0xb0a228fbd574762cUL, 0xda3672e52c7b0787UL, 0x12c338b748230093UL }},
+  {{ 0x2221e1a1169b8869UL, 0x45a2665efa6c60d7UL, 0x6f9e0f54b8515fdfUL, 0x183a511bc029d5a5UL }},
+  {{ 0xbda219f4afe0025dUL, 0xc749f580629a75e3UL, 0x8a378583f152935dUL, 0x237b56d5a4d99cd8UL }},
+  {{ 0x49dbc8db1a2c7403UL, 0x2a9cde0f05eafef3UL, 0xff1b4b6b4f226d34UL, 0x225eb23da090aa17UL }},
+  {{ 0x814cf441ce0da35fUL, 0xb8dbe96818425c85UL, 0xd010cca77e7068fdUL, 0x2349461f924ccd77UL }},
+  {{ 0x50c1b913d7a91b5cUL, 0x514477cd0a6ab507UL, 0x87b004e31ffbc11fUL, 0x1b793083372a2278UL }},
+  {{ 0x4438379f54bcdba1UL, 0x518b25493234797dUL, 0x6147461b6c814362UL, 0x0510cd5cfb267beaUL }},
+  {{ 0xe50cc98369560a2cUL, 0xa60252268ffbe438UL, 0xb7803177624f087bUL, 0x0b79df12d28d484aUL }},
+  {{ 0xf7e1c6f5c23fcaeeUL, 0xb42511bde74867cdUL, 0x6e8597b054bf5359UL, 0x00bfdd2f8bea9b79UL }},
+  {{ 0x76afb57cafa0f53dUL, 0xc3676e675eb1c903UL, 0xd2b0ed2875b705f6UL, 0x08fd92d4d434fb68UL }},
+  {{ 0x7930998a591a1e91UL, 0xe685095bb53c735aUL, 0xae3325f16683fbc6UL, 0x22bb26dc1592552aUL }},
+  {{ 0x9bb636e11402c587UL, 0x10fafd307b7f27faUL, 0xde676e11c36bb2e5UL, 0x26a303c5f33ffd36UL }},
+  {{ 0x621135794a35eae6UL, 0xc3b2e483287eb5efUL, 0x8d2738be768aba41UL, 0x2619ade6523ed7c9UL }},
+  {{ 0xf4d980550ef45b51UL, 0xada533a04e2e9656UL, 0xf39dbe10b463fc5cUL, 0x0c75e030ef9194d2UL }},
+  {{ 0xd25c9525e6f04be7UL, 0x3f407533033efef8UL, 0x9c48e673c00c703cUL, 0x07b2b5449bd4c37dUL }},
+  {{ 0xaf24f46863149b2aUL, 0xf2b25eb7824bec5dUL, 0x43bae78cea2c2ca1UL, 0x0ea99c861dd2829aUL }},
+  {{ 0x8d466838858f3d0cUL, 0xa4b3c4a200c01204UL, 0xbed3fd30bcecd1c2UL, 0x034f5b321575ffcdUL }},
+  {{ 0xdb3da72ed96da24cUL, 0xa1ff78790d901241UL, 0x865296f79421e30cUL, 0x2925ff6e1d9090b1UL }},
+  {{ 0xc38ccacc86478f85UL, 0x630f2d5235cd32d4UL, 0x5bbf66f4474295d6UL, 0x182c0dcfd76ac8f5UL }},
+  {{ 0xcd1d79af83f72cd0UL, 0xe4a35805655b7e5dUL, 0x3c35eace16d2e610UL, 0x13d673ec317fc5a1UL }},
+  {{ 0x66d6b1383e19c8b1UL, 0x532a9cfe065d4096UL, 0x089fdf136d2acfb8UL, 0x24219f066086adf3UL }},
+  {{ 0xcc79ff5553b57351UL, 0x9c4d48ba16173965UL, 0x353d3a0354918c31UL, 0x236031ee8df3bb88UL }},
+  {{ 0x8d508023aa995506UL, 0x103e7fadd80a5001UL, 0xc8a165a24219c49cUL, 0x10c3eaa8ee21c00aUL }},
+  {{ 0xcb5577e1d4803ea4UL, 0x8ad0cec63a250543UL, 0x690baccc5e3b8f85UL, 0x0fd67bf7ebc85537UL }},
+  {{ 0x93f772b8d433f69bUL, 0x8dc9c61818cdf3dcUL, 0x265401a67993af86UL, 0x01f89c93d724a7d2UL }},
+  {{ 0xd778cd4ded716f95UL, 0x37af24db1f85d4efUL, 0xffaddfec1cd9e445UL, 0x23f4a8c7b531fcc2UL }},
+  {{ 0x04ccd5897b9c8869UL, 0xafe87be14018a986UL, 0x05de7283c50885b5UL, 0x2920540029570a7eUL }},
+  {{ 0x3bf0a3531cbce538UL, 0x3084ff276ac1ea24UL, 0x6e616cb6a82d85cdUL, 0x0e234ee9b6accc92UL }},
+  {{ 0x0c8ede90349d71e3UL, 0xb3e7e59c185d9e33UL, 0x1059cb6c908bfb79UL, 0x12c37aaf3c4cde2cUL }},
+  {{ 0xcf2fe50f061e8082UL, 0xf6fb5d0de3f81d62UL, 0x83885281f8369000UL, 0x002aafffdd068156UL }},
+  {{ 0xc03d7e2143eddab3UL, 0x02e2f6d259cd543eUL, 0x61abe046a2b6512cUL, 0x2dca40af3dffc68fUL }},
+  {{ 0xaadb0a42fc0c37b1UL, 0xdddc2e099203aae9UL, 0x9774ad9ad0e15bd7UL, 0x0648249b14f575e3UL }},
+  {{ 0x6e928050edb048f4UL, 0x6a7ea2221acbeee8UL, 0x6bd0e610c55d1293UL, 0x0afdd04c6c37b5c7UL }},
+  {{ 0xacaf9f07f6c3fe9dUL, 0x90f1bdeef9629877UL, 0x408619afa4b63cf1UL, 0x00669f43f0b20399UL }},
+  {{ 0xf42075658336cdf6UL, 0x5709701b328cf065UL, 0x72f4ac1c79760da8UL, 0x17df3302f074dfc7UL }},
+  {{ 0x7349108a56a1dc82UL, 0x4b04b167f0103b36UL, 0xdc128a5c368b6e8cUL, 0x0dcee8e0c75cc2c7UL }},
+  {{ 0xbdbe034120f0193fUL, 0x5e99be1c13dadd51UL, 0x2aab66503f94e4b6UL, 0x1883d004453692c4UL }},
+  {{ 0x1ef50511c2511d7dUL, 0x0d6bbbcd5c0ae490UL, 0x5d61feb8a7c5fbd0UL, 0x068903ca67c8e946UL }},
+  {{ 0x0b067320b98ad2e7UL, 0xc2c9becc1f52f93eUL, 0xe31a53816deac773UL, 0x0b19976a606fcd9aUL }},
+  {{ 0xce9927d3da55b6cbUL, 0x739cdb709ce2d4beUL, 0x9033a9d8e6a66cccUL, 0x021c0c23077ff03fUL }},
+  {{ 0x890e034c87ee2f59UL, 0x1a29f1ebea22be30UL, 0x711cf338ef8e9192UL, 0x04fbb513ef6d8aebUL }},
+  {{ 0x5fca79cfe381e951UL, 0x7d60f98a19386c19UL, 0xbdcd08859ba47ffdUL, 0x1aeace3af931867dUL }},
+  {{ 0xe46cfc3837e3ab20UL, 0xe737648f2055a692UL, 0x541ec45209fbb5a1UL, 0x21280a0ea2fcdd03UL }},
+  {{ 0x35300d5e182880e1UL, 0xb7907e70b079f0dbUL, 0x78865b88f8eb247bUL, 0x03d428c65393578bUL }},
+  {{ 0x207573842077ec84UL, 0x44cdf98ad7211cf2UL, 0xac49acbd6224e7dfUL, 0x0e02dc987dc237d7UL }},
+  {{ 0xc4e68ecb8d5bf8aaUL, 0xb7fec1e84d8054fcUL, 0xf9d3540d083053deUL, 0x2fe3dd636cd15ea5UL }},
+  {{ 0x1b20757593c7dfedUL, 0x3c2a4ebc12d44154UL, 0xdd93739c2722ec13UL, 0x0f827d32414b9bd4UL }},
+  {{ 0xf030fd0d0390cef0UL, 0x5659b0671a309a9dUL, 0x06711efae23b6dfbUL, 0x213a75a5f3a13c36UL }},
+  {{ 0x0a20ce0912971bd8UL, 0x33461b46dec19823UL, 0xb6ec31e9f9e4bf79UL, 0x01257ca5affabc0bUL }},
+  {{ 0x1c54764e4682f5f4UL, 0x348862a5667bda20UL, 0x746557d0eecc0cf1UL, 0x0c129f60fee202bbUL }},
+  {{ 0xd2471ae52790d297UL, 0xb3a4f032e59ecf87UL, 0xc5b88c29570be989UL, 0x1b7ba0be1e7ed376UL }},
+  {{ 0x1bf7044ee58dbb2eUL, 0x01d5481ab1959f36UL, 0x8725e0f044a78946UL, 0x13c979bb852772c6UL }},
+  {{ 0xa227e15a36235e36UL, 0xa6edb6552a2fb6d6UL, 0xcf5eb2f7c575e310UL, 0x2e458e039d378c64UL }},
+  {{ 0x75e2c5d342a6fce2UL, 0xd7b201b0a3030af1UL, 0xba9db31927ff41b5UL, 0x2da8cee9f21d6165UL }},
+  {{ 0x6f5fdfbffd4a784bUL, 0x1c2269380c911aefUL, 0x7423c3718c65bcc0UL, 0x0a4e18d6af491774UL }},
+  {{ 0x90127186df92ad30UL, 0x128bbd98f622d9e8UL, 0x6b33761baa5288a6UL, 0x2b65fcebaa7aed99UL }},
+  {{ 0xb85bf9a2398bb087UL, 0xee9dcd4d9c3b11ebUL, 0x4f15753c9ae6ee06UL, 0x25742aa65d0c111fUL }},
+  {{ 0xd3c992e4442b6fb5UL, 0x2dcba628d06f457aUL, 0x0f828c5ac51e5f21UL, 0x1be9e209562d6afeUL }},
+  {{ 0x3dd96db83c7eba18UL, 0xa3e4d2606cc891b8UL, 0x05fb2a131bda3a4bUL, 0x00599dc1e93e8ca1UL }},
+  {{ 0x9b5a0d2f6aa4e4e6UL, 0xbd5ea48a961bc7f4UL, 0x8c92b459abea46c2UL, 0x14239f6ad53cdc04UL }},
+  {{ 0xd6456f5896de5596UL, 0x1c79e7abe288982aUL, 0xd5daa2e09810b820UL, 0x088d0dd891882a63UL }},
+  {{ 0x303f8d086e53f3ccUL, 0xe34f156b6fb8e71dUL, 0x1ac62aa46182f00fUL, 0x2739e5b90d231948UL }},
+  {{ 0xb667f92f0c2334a0UL, 0x6f94b307f8f2893aUL, 0x23c6da34a61e92f3UL, 0x13a3b481c179bfceUL }},
+  {{ 0x3524ed4836e890c1UL, 0xfa8942024d7b0ea5UL, 0x20f6883289d037f0UL, 0x276c5de1e5067c3eUL }},
+  {{ 0x78afa01d780c41c5UL, 0xc4aa36999754cd06UL, 0x184e482dc5450f20UL, 0x209e3e4cd499e438UL }},
+  {{ 0x9cd68ca1e55f6d3dUL, 0x02a510330a51bd82UL, 0x71401a8d68b61dddUL, 0x139dda74a8232804UL }},
+  {{ 0x9791f55741f7e9f0UL, 0xe7574402cc019da3UL, 0xf3e81ca2eb0f57c7UL, 0x0f24c0aa7e8c611fUL }},
+  {{ 0xac2a32207e84caf3UL, 0x73eec0cb01696d62UL, 0xbd8395722b3d02e0UL, 0x20ac1665ff2b02eaUL }},
+  {{ 0xaa0d092e47cf5a20UL, 0xb2dded26fc938a2fUL, 0xbaaabbbe7c92e522UL, 0x09fdce9945eedb82UL }},
+  {{ 0x77b3c84b0ad4e0e3UL, 0xbc2f6e43b0ba5996UL, 0x8ce3703f9e7121f9UL, 0x028784b69428a48dUL }},
+  {{ 0xe3d18263663041fbUL, 0x6b663a86573d816eUL, 0x4572693209d84e65UL, 0x2286b001fe71f1b0UL }},
+  {{ 0xef906802dec66ac3UL, 0xa88dd778f6dc3310UL, 0x839006fc0f677ef0UL, 0x035770558b906629UL }},
+  {{ 0x39071c59e58dd46aUL, 0x3f12a422431a27e5UL, 0x427a20fd5ae56077UL, 0x02c13a0a0e24e2c5UL }},
+  {{ 0xc4d61480295027a4UL, 0xead89abb8ee39bedUL, 0xd3d745e4b9ba9275UL, 0x1f9ba8ef323666d7UL }},
+  {{ 0xdcee4b637a1e0676UL, 0xa48074dbc5b516b0UL, 0x94cff73a7900c29dUL, 0x0f28efe7b9941134UL }},
+  {{ 0x1bc329ff2363ea08UL, 0xa90a00fbfff35aefUL, 0x50999e6d39ad0e02UL, 0x18d09354b5c80492UL }},
+  {{ 0x99986a3909f64ecfUL, 0xfaac9e8b7356f567UL, 0xea85211d1302f9acUL, 0x14f2179e0b8d494fUL }},
+  {{ 0xd9edc175187af975UL, 0xf88d756abbc022a1UL, 0xb137ef9f9f31730fUL, 0x2253633ca2d0e86fUL }},
+  {{ 0x9c5b2d38b1608b17UL, 0x9a5c24b53f0e66f8UL, 0x26662753736c3514UL, 0x1e27f0c47c2f0b35UL }},
+  {{ 0x12a14d77f599f4f0UL, 0xd693a61af9eac383UL, 0x4b7bbefb7a8d3471UL, 0x1b07b900fb3f19a0UL }},
+  {{ 0xed50aec799c6e803UL, 0x88055951b1642a23UL, 0x72523d207987a691UL, 0x2d33b472bec41b18UL }},
+  {{ 0xd7d454adc12d123eUL, 0x97cf4509047c9829UL, 0xb2ab1e61102ac8fcUL, 0x2d91e788f2adbb7bUL }},
+  {{ 0x655f1e89270f44d2UL, 0x6376a63ad3820c37UL, 0x35a2de67392b486eUL, 0x0efbd40d0c8bc372UL }},
+  {{ 0xddbd3aacebf48d02UL, 0x690098b517afc334UL, 0x829ca89b9fc61ba4UL, 0x17e398b900c9deb3UL }},
+  {{ 0x8526f25961747003UL, 0xcd231346407994b3UL, 0x8cd952e418188a50UL, 0x0120cf007cafb0aaUL }},
+  {{ 0x0cf2be6896b06d45UL, 0x46550dbf865b845cUL, 0x3b4630ca6baddef0UL, 0x0992548d521edcdfUL }},
+  {{ 0x6d1a00bd17c285e5UL, 0x2198de7c1758f446UL, 0xdfc0639090767192UL, 0x12f3ee6df2aaf80eUL }},
+  {{ 0xfb6bf7000f58766eUL, 0xc2bd073c8a2929feUL, 0x928316f08f0321b4UL, 0x21296c3e865e4766UL }},
+  {{ 0x80e36d96f7995e51UL, 0x87753059ea07bf9cUL, 0x6e580a3b83d4a8c5UL, 0x11dcfae5ce5dbdf6UL }},
+  {{ 0x16e5eea26cd39f8bUL, 0x5cfd47def366897aUL, 0x8d7bdca96a37cc30UL, 0x2ff7ea3d8224a8f4UL }},
+  {{ 0x9d5dd134236a843aUL, 0xcdc1ee07e4f644c3UL, 0x98170c2ed29651dfUL, 0x2ec1d2cf29917244UL }},
+  {{ 0x498265b4463c2829UL, 0x8392445610f1c185UL, 0xd8b6e3da29a9b0c3UL, 0x23bd89f0db9d1d44UL }},
+  {{ 0x2199660b4e2d0612UL, 0x0f8c761fbadaeb21UL, 0x0cb79ccd2815a65aUL, 0x2caa2618e7788f34UL }},
+  {{ 0x1a97952db72751c9UL, 0x7c078a9838df5f91UL, 0x0a9a3479a4ddba99UL, 0x01e1dd6e67e55628UL }},
+  {{ 0xee41357d18e4b0faUL, 0x7dde9d638befa96bUL, 0x3655bc54fdc7862aUL, 0x0bf6d03fd4604738UL }},
+  {{ 0x5f997ef6165f850bUL, 0x08ab3569ed45e33cUL, 0x195e3b9139f8810fUL, 0x04ff33b5d03b2deaUL }},
+  {{ 0x6e818f62ff817e6bUL, 0x500dd47fdd392cdaUL, 0x7b99c00a379782b7UL, 0x0101eee74c241b25UL }},
+  {{ 0xd860a5bd57dc6144UL, 0x7878ecd447fd9df4UL, 0x7fdb85025cb0741cUL, 0x0381c98c41c8e108UL }},
+  {{ 0x3ad22be1cd2da4d3UL, 0xcdc6aacf4450df14UL, 0xb252ff4932e2a074UL, 0x226cdb074d98d045UL }},
+  {{ 0x96c9b5a2d8bcb7f7UL, 0xc5015041834d64d4UL, 0x1a26238422b60588UL, 0x147ff0cbf80376c9UL }},
+  {{ 0xbd13f3279fc3b87dUL, 0xa733d9a55abc6c3fUL, 0xd31b4c227e320a2fUL, 0x0e70bee3f5c7d693UL }},
+  {{ 0xf2f2f95638906c69UL, 0x205a7d4cf661e782UL, 0x745d3261f4e5394cUL, 0x1013dd5518696e86UL }},
+  {{ 0x5b8081c9dc8fe7cdUL, 0x8bd86fa02a096f78UL, 0x6708ce1ba1f8a01dUL, 0x0a448ffe0e1ce08cUL }},
+  {{ 0x86d6f4b26e1e6c8cUL, 0x4052aae1068a20caUL, 0xccc3f9ba1fafe16aUL, 0x1e95efbee9d463b7UL }},
+  {{ 0xfdd10e1f7b00ab1eUL, 0x051cd8970d3988b1UL, 0x0f1146b6123277d5UL, 0x07f8db6bdea3e44fUL }},
+  {{ 0xff75538f5382eb4bUL, 0x9fd67685a4b64c23UL, 0xd6191660dc63b879UL, 0x0088c27cd753bae4UL }},
+  {{ 0x300c11536ade6e1fUL, 0x4854255a2dcdd545UL, 0xedcc53411cc13f9cUL, 0x18e652420d97e51aUL }},
+  {{ 0x5952745d74724ce2UL, 0x23dc5967c1b4da64UL, 0x5abefdc09bceb1efUL, 0x1e47b10c6e74698bUL }},
+  {{ 0xee661d274e2029dcUL, 0x1bf25e339478b7f9UL, 0xfbe8e8d15df1bd3cUL, 0x21fdc15ce90497b3UL }},
+  {{ 0xffa3518912f0445fUL, 0xe3776a5283643cfaUL, 0xc362beee77604ad8UL, 0x27846946bfea11f6UL }},
+  {{ 0x418375cc696eb745UL, 0x92cbc6fc3b651c2cUL, 0x807f92a6c719f0bcUL, 0x1cbb47e6d15a836dUL }},
+  {{ 0xc07870cc99c6e76bUL, 0xbb7b748dc96a4917UL, 0x0ac01c3acecbf8f0UL, 0x253edf67cb73de59UL }},
+  {{ 0x0cdc88cc27870ceaUL, 0x3faf9e7215b15315UL, 0x6b395381235871e2UL, 0x0068fc73adad93b8UL }},
+  {{ 0x5db31f857f5e332aUL, 0xbe071c11d99697c4UL, 0x617362801b367eeeUL, 0x0d2224d413cf4995UL }},
+  {{ 0x9194538c29b4c8f5UL, 0x14506be2a8251c7cUL, 0x2f4d29a7f7f10350UL, 0x09f23dbe85440302UL }},
+  {{ 0xc19448cf82762a8fUL, 0x2a35ba9f6a918c36UL, 0x18092bfa3e400b26UL, 0x087e24d02768611cUL }},
+  {{ 0x21edda709febeb3dUL, 0x08ccf9c79f920625UL, 0x51a6d74ecf509e0cUL, 0x0545f8b405954432UL }},
+  {{ 0x5c66c2f62c0892daUL, 0x35578e49365eea88UL, 0x8256a42492bfbdb1UL, 0x19c9841bff1872c2UL }},
+  {{ 0xf50b20beede97cfdUL, 0xf01d4f3260d79cecUL, 0xc1dd2b1c78e380abUL, 0x0aec8934f35cd917UL }},
+  {{ 0xd732a640ebef386cUL, 0x22c1a728130ffa1dUL, 0xa74260a00d2ee1dfUL, 0x1e10777c665b21e9UL }},
+  {{ 0xcf1780288348b8e4UL, 0xfb55d7e42e797939UL, 0x55fe73ddffe96d00UL, 0x0cbc375453e804ebUL }},
+  {{ 0xa2769be5d1454927UL, 0x80d62a370e86da24UL, 0x0db08d424b319810UL, 0x20be30310d0d8784UL }},
+  {{ 0x2da3aa6e4c47bbc5UL, 0xd1efadb95fa4f0b0UL, 0x652459e4774efc43UL, 0x0d1763c08d12d1e7UL }},
+  {{ 0x2f328c4b315cafadUL, 0x3d8f25bc50a70dd9UL, 0xa9baec0e49f5fbe1UL, 0x239742e9de4f7f82UL }},
+  {{ 0x592aa6b6b3334946UL, 0xcac4ed63a3828c74UL, 0x10f3ee1e8629d691UL, 0x2dd9b96e66fa3e4eUL }},
+  {{ 0xcc5e9f030263a147UL, 0x04a1262c6dc7a5ccUL, 0x2e15042d5b832d8bUL, 0x0e12151c8c1f5a0fUL }},
+  {{ 0x8afe9d8ddedfc43aUL, 0x42661bdfd87c11a1UL, 0x49c663d5bc54fff3UL, 0x2a85a6e4c7c87c5cUL }},
+  {{ 0xb0d2f6d2d0465680UL, 0xdedcb86f24c78e98UL, 0xff2b96bb12d036a7UL, 0x03a433def459cf0cUL }},
+  {{ 0x9b7d4a207211a1d6UL, 0xd67d298d9e540fb3UL, 0x244de081aa4877acUL, 0x2ed1c6e950cd6cafUL }},
+  {{ 0x347fcaac48c7237dUL, 0x6e71870159881f5cUL, 0xe0272ad5de01a05eUL, 0x2d9271d91a353a86UL }},
+  {{ 0xfef059904309d605UL, 0xc445e18ef0278a0bUL, 0x236eaca8b433df3dUL, 0x23b56db87a697c08UL }},
+  {{ 0xb461ce8e8cd1d678UL, 0xeda35a4fdcb1d1baUL, 0x47af919334c6cd0aUL, 0x11cd8f64c0acb27cUL }},
+  {{ 0xd388a24dd5104b45UL, 0xaee0ab195846ee8aUL, 0xae083b4d35399014UL, 0x2e6a05dcd68f4151UL }},
+  {{ 0x031922ab64269f5fUL, 0x291d885c03f0cf4fUL, 0x207783cdc5f0a75fUL, 0x064f8e0ee4e4932bUL }},
+  {{ 0x5ceec6186894319aUL, 0x93fee371764c97baUL, 0x634f3b0f5c890843UL, 0x293d42268b8efb30UL }},
+  {{ 0xe8aeb85e340dcfe5UL, 0xa36f4c78beef7db6UL, 0x4980c7df33db33aaUL, 0x1dccf14815f6545aUL }},
+  {{ 0x60d3251f992943e3UL, 0xa7dee491b8d47649UL, 0x0d5d76f18207e840UL, 0x0a8c6f92318f474cUL }},
+  {{ 0x4e4b0f8da0f0a75bUL, 0xbfc3c58ced8cec62UL, 0x11f0e82dd43fa9eeUL, 0x24bc5be0ee005482UL }},
+  {{ 0x190b75dba5e26693UL, 0xad4a4a6cff6843b6UL, 0x401ebd29c80bd661UL, 0x105583fceec037adUL }},
+  {{ 0xba40600ac4aebe5aUL, 0x99c3902df3532122UL, 0x4fb10f5adc15f5caUL, 0x17c4b0aeea8c88cbUL }},
+  {{ 0x75f8a7546d723f69UL, 0xc6078c6be6bf3fa1UL, 0xac7865d1c718c49aUL, 0x043dac6ce032954eUL }},
+  {{ 0x014fa3073b30cce9UL, 0xe29e05cf756f3decUL, 0x1e4c223ff404f201UL, 0x1be388df2f4762b1UL }},
+  {{ 0xd28df4a4facd0c14UL, 0x8531b7d08b392e32UL, 0x75ca4a85d8a7b568UL, 0x0058c813d53ab543UL }},
+  {{ 0x19032275fc2edd65UL, 0xc33560019acbb757UL, 0xd768f8e9a5cc2f38UL, 0x0895473c467a9563UL }},
+  {{ 0xb1d145692f85fec0UL, 0x9de73d50d325fe96UL, 0xd7124c6fed04fe7bUL, 0x1d3c3f90db3efe97UL }},
+  {{ 0xfb5facf4694806f8UL, 0xedcff2fe04d7a490UL, 0x3375b01fe5a9a7c0UL, 0x2db61b9a526b7ecaUL }},
+  {{ 0x05ad599871f6b9c4UL, 0x8022915dd1f5f73fUL, 0x8aea5034f47dfe38UL, 0x1e77fe8562833e3fUL }},
+  {{ 0xdf7a1b8791667a70UL, 0xde55084721ed9002UL, 0xbf9c6a4041b5fb34UL, 0x02de08ad0c5fb599UL }},
+  {{ 0xe891503abcbaf443UL, 0xb6cffc1b7306831eUL, 0x39d3c1a4ae11fcfbUL, 0x19fbcd931060e527UL }},
+  {{ 0x737d23ef8ab58d56UL, 0xbf1c0c303b3f124fUL, 0x00d9c99aa5b865e1UL, 0x12ac2477b4b3baadUL }},
+  {{ 0xf09bdaec7260ae7cUL, 0xb7a7c08f65d05e7fUL, 0x44dbdfac8d2a6667UL, 0x162ec8a481cf6928UL }},
+  {{ 0x43227890375b511bUL, 0x4b9cf2e7fe072411UL, 0x61749596c309eee3UL, 0x28c3bffbfcad08f4UL }},
+  {{ 0x4fa395c4df3e5fdeUL, 0x0c85642deb412553UL, 0xaa4abb224a364d5bUL, 0x20f211d4c79128e5UL }},
+  {{ 0x68c65be8dc52e5edUL, 0xc09f81914d046fa3UL, 0x538f8a8d186cd9c2UL, 0x2934343f1f56e840UL }},
+  {{ 0x70a8efaa12680992UL, 0xa2968b3f49a3a274UL, 0x8affec2a201733b5UL, 0x004e7efcfb269b27UL }},
+  {{ 0xa7766c135ae884e6UL, 0x93c84a3743152e6dUL, 0x4263b3c798ea1a38UL, 0x2707b722e4d137d7UL }},
+  {{ 0xce3fa614f73c08dbUL, 0xb903d05f3772b850UL, 0xacaa013582c763d4UL, 0x2d93eecebb0692c7UL }},
+  {{ 0x7724b6aa5b520b32UL, 0xe82f7598e64cad77UL, 0xfdc90ef65007213dUL, 0x2c3d47429054c922UL }},
+  {{ 0xe5c007438cab761cUL, 0xe1fc3564c7139c9fUL, 0xa429d0f3da9e40a4UL, 0x234971b1ba2e515cUL }},
+  {{ 0xb87dbc720d72b632UL, 0x6f471bbc0cd06d43UL, 0x735768743b607444UL, 0x072128382de01f61UL }},
+  {{ 0x24d5835524424857UL, 0x0d730da7e6d82b82UL, 0xf3acc0e6677c0861UL, 0x13f341344784dd3dUL }},
+  {{ 0x0feb8cd1b7032bc3UL, 0x9bd6db55aa7a2bf8UL, 0x8572687a81ea650aUL, 0x2d00e465a6be0db9UL }},
+  {{ 0x57d81cf2a1efb8c5UL, 0xa3e6991fce4040a8UL, 0xb757fac2a6c0ae6aUL, 0x291600ead0966d73UL }},
+  {{ 0x46f0220004542378UL, 0x218bfe5f7363de92UL, 0x7174d0fa7dbb5d48UL, 0x0171125d9d0910b1UL }},
+  {{ 0x1f7033fd761b8296UL, 0x2d76bd0d19ef7ff6UL, 0x8a504abc42b97867UL, 0x1dfdae2ee24fc24cUL }},
+  {{ 0x451ea03f018f727cUL, 0x7937411e3a79a6ffUL, 0x7d10bd64d95664b1UL, 0x2e5b67996c34a11cUL }},
+  {{ 0xd0d11ef9df26b8f4UL, 0xb221364721c5c0d7UL, 0xa9ea6f4c6b5b2856UL, 0x07fe786814f092dbUL }},
+  {{ 0x5a06c86733d78511UL, 0x206da31c51f3bc42UL, 0x43e0bae0df257b8dUL, 0x277d6689accb597fUL }},
+  {{ 0x5689498c6e7c95e3UL, 0xfc7624bd063d8ca7UL, 0xd8069e7bbf75aa4cUL, 0x150c436b3432ed35UL }},
+  {{ 0x94d4176bb000f9acUL, 0xa28a8c43bf8b0551UL, 0x297b2cc40dcdde7eUL, 0x1a36c8f8c77edfa7UL }},
+  {{ 0x94fc94ec91927e9bUL, 0xb9bb076b7f7b0de0UL, 0xe1d841ac202b68ddUL, 0x2d8d9cf391d86318UL }},
+  {{ 0x59bdeeb7b2b5c88eUL, 0x158f0e618cddd27fUL, 0xf60e0f6c0b51452bUL, 0x17f16243db6840e8UL }},
+  {{ 0x93164ccb99d0d7d6UL, 0xd9f0eddde833267fUL, 0xc6bd8840389f01e1UL, 0x2ada3357ddbea881UL }},
+  {{ 0xf245818ce693f060UL, 0x6599884a65365c1cUL, 0x34c1e810f0279c37UL, 0x24500aa6ba7da287UL }},
+  {{ 0x24b8a3788b8b300aUL, 0x781c00df6fd542e8UL, 0xb4e7f3880379d8baUL, 0x0186b7457354f7e8UL }},
+  {{ 0xeb9c506efb3f9196UL, 0x4e0c56ada9cd3902UL, 0x53489950e6c58c64UL, 0x1772db5181767e41UL }},
+  {{ 0x9b3bcc5c451e87b2UL, 0x6d88a3e950f88597UL, 0xeff2f200454e7312UL, 0x17da1bcc984b8f4cUL }},
+  {{ 0x2592abf10a552077UL, 0x319ca7f7db64c9faUL, 0xe04086fb58f5b5b8UL, 0x2754e667660a5f13UL }},
+  {{ 0x5cca5788c4decf0eUL, 0x0cc92c030c442c9cUL, 0x5cd60469aef3dc70UL, 0x0309d1cb9d2d7a14UL }},
+  {{ 0x28b5cb9b5b06bd0cUL, 0x66a8ecb312dc9a4cUL, 0xec016e6e16d649b4UL, 0x0fda4e99c02fce4dUL }},
+  {{ 0x3ab8ca84047d8014UL, 0xec9db28d6fcc3826UL, 0x7dedc9113ddeb95fUL, 0x0de25d6835382233UL }},
+  {{ 0xebc3499a47abd5dfUL, 0xea0306a1bcfc4f55UL, 0xfa0b125b8030350cUL, 0x0dee3952a2a616d0UL }},
+  {{ 0xecdacc35c105887bUL, 0x97ef09149acf2fe4UL, 0xc7cefd90ab1b9d77UL, 0x2f723521e73f39b9UL }},
+  {{ 0x95473c00df8b6c51UL, 0x8f00cfe179b3aa5fUL, 0x4f99ce56e2fe7748UL, 0x1b89457165ac545eUL }},
+  {{ 0x487b5734e474b12dUL, 0x5cae31198c23257dUL, 0xfbf9aee6942baff9UL, 0x09f51f9cc27267f5UL }},
+  {{ 0xdcc861e018a24a88UL, 0x4e214be48119c1a1UL, 0xa701948b02490b8dUL, 0x2c19bbfe28d26ca6UL }},
+  {{ 0xdaa10f75cf74fcdbUL, 0xbe053e5d4d6aca34UL, 0x5c2b7b2ba352c980UL, 0x2269adbd40a02db5UL }},
+  {{ 0xd1f86ac5b09e3f70UL, 0x6f916f8f4c3b3c95UL, 0xc6863368544e6f55UL, 0x067286a7909332a2UL }},
+  {{ 0x8684846c58c61cb4UL, 0x8dfe2f4ce7bc4ebcUL, 0x5c92a569829ba84dUL, 0x26a4340380f9d154UL }},
+  {{ 0x93c00e38267e5727UL, 0x79cd056273566f53UL, 0xdb3680aa0f4af86bUL, 0x0cdff583fabaf49aUL }},
+  {{ 0xed71c8c2e08ca3f3UL, 0x0e4caa37c4cb37fcUL, 0xcb35d205df429a06UL, 0x29b02d31d1235192UL }},
+  {{ 0x2fd429bec61af3aeUL, 0xfda0e5b94a9e0717UL, 0x6b495d777938cad2UL, 0x05b4f063f6627ed0UL }},
+  {{ 0x18ab8c928889a5f5UL, 0xe27f2f3473654e5dUL, 0xa56461a1c5e82cc6UL, 0x1cefbdeb822e5d3cUL }},
+  {{ 0x25fe8875be5029b0UL, 0x23c66431d2ddc73dUL, 0xdcdf3285318d8ec8UL, 0x11e974c7ac3c4a72UL }},
+  {{ 0x3956cc41d6ccf467UL, 0xeca8417989db88aeUL, 0xd06763323c523ae5UL, 0x2de3fb09de59601dUL }},
+  {{ 0x9e7919116ccfff57UL, 0x3cb97686740d9e6cUL, 0xa23e04e2a03e81c1UL, 0x074bba6ebaede39fUL }},
+  {{ 0x32b5b478d23422d7UL, 0xce98e128067da2eeUL, 0x3227d2cf5046ff1eUL, 0x18aaa6f3fb3d2374UL }},
+  {{ 0x224be30450d0fbd4UL, 0x1add5e2c50874771UL, 0x0819c3549b838d0aUL, 0x19ffc688d94259b8UL }},
+  {{ 0x0c71c38fa0a3f6d8UL, 0x87629d66e58e1d56UL, 0x7ad57f5d271336feUL, 0x07359e8f9f3da9edUL }},
+  {{ 0xe3bdc1cdfdaf3716UL, 0x3b54616495e8b5abUL, 0x46efbf812b53e11eUL, 0x2be39e2afe859f70UL }},
+  {{ 0x2fcde00b6c6ce1dcUL, 0x596832d070ce6319UL, 0xf7a93d7b1432209cUL, 0x01fba89bb504e78bUL }},
+  {{ 0x53c665a4f0be70c2UL, 0x586162f8aeb957a0UL, 0x1c13bbe1eb531025UL, 0x020ddcb99b4c526dUL }},
+  {{ 0x7513fb1ce33736fbUL, 0x2e54d3af6bcc2bffUL, 0x380ca03032f3fe01UL, 0x100f3e34e18bbab8UL }},
+  {{ 0x967e99b2ac7e4d37UL, 0x05f60520126b98d5UL, 0x0881bb9c1af3d79aUL, 0x275e08c088625e5eUL }},
+  {{ 0xb1a26e2fd76e636aUL, 0x6ed978b399209bb1UL, 0xe1f118edb07ec59bUL, 0x17953e27156145b7UL }},
+  {{ 0xf30b7541ebfbc991UL, 0xdde1ce8288b4886aUL, 0x20213e43264aa8caUL, 0x14892a03b358f8ffUL }},
+  {{ 0x4c7495cfd1f1db09UL, 0xab6a9ea1ab62e984UL, 0xf5bfde9383152f12UL, 0x1321ee9688124a25UL }},
+  {{ 0x703691786075f9dbUL, 0xd4e1e9b76faa3b29UL, 0x65122a4d7a2ceea4UL, 0x201fecd4821b737fUL }},
+  {{ 0x7db0c9112187ac46UL, 0x46acffe8eb234bc8UL, 0x05470767fe19b000UL, 0x014044134ad1df75UL }},
+  {{ 0xdaa54243f68fefc8UL, 0xe337020fa0e82e6dUL, 0x21989633958a4a24UL, 0x1a7bec4d2da8978bUL }},
+  {{ 0xc4a32831cfaec3f2UL, 0x49f1e4f0073a2ea1UL, 0x3b7e93e0289ea87aUL, 0x0125f6fb186d6788UL }},
+  {{ 0x5f8bc41f629ec7c6UL, 0x63da35957843b4a4UL, 0xbb51a6f1ba822606UL, 0x281770f7c2d8d79cUL }},
+  {{ 0x57d5e8a37110cafdUL, 0x66a192ebc10b2b38UL, 0x750175dfc5a16ce7UL, 0x19f3bce5b2645347UL }},
+  {{ 0x43ca46456fbe9e76UL, 0x27d27fa28291d9beUL, 0x462ecf763bf4c811UL, 0x0436d7709d638e06UL }},
+  {{ 0x73e9f6d21ad1b44bUL, 0x9bfee335bd439d8eUL, 0x452d8462c7ef9467UL, 0x24ada5b72d169c5dUL }},
+  {{ 0xea607e0921fe9a9dUL, 0xa7e61b0937ddc3deUL, 0xca4deaf3dec2b770UL, 0x224197ab098bae0dUL }},
+  {{ 0xa3fc40d7ec89cf8dUL, 0x0123a1214541f1b8UL, 0x489cdbe57f654eb1UL, 0x16952c12741e67b9UL }},
+  {{ 0x96e7fa29076800b1UL, 0xb71eec475b858a90UL, 0x4e93a114cf048a01UL, 0x06786c1b92bcaaeeUL }},
+  {{ 0x6b018748cff4999dUL, 0xf2dcd98be8c2e8ecUL, 0x75f8a9ffc9154b8dUL, 0x2b7e1064a34c971dUL }},
+  {{ 0x89a5fbf35a77279fUL, 0x7513b9024a8b7113UL, 0xce57bbd791454120UL, 0x2f4a979233a716dbUL }},
+  {{ 0x96d3552c15b6989fUL, 0xe6371954b2972f6cUL, 0x1f14543bf0c598c7UL, 0x19607b05b74cd864UL }},
+  {{ 0x91bd0f64bb9d80e0UL, 0x6231846cd7b37098UL, 0x007cd247f92477f3UL, 0x091c83fc6745e0e1UL }},
+  {{ 0xd736e87951437903UL, 0x9125f98d77909713UL, 0xea2a7b9057ab40cfUL, 0x16e61c7bbbcd8ad0UL }},
+  {{ 0xe38351d045466499UL, 0x2af828d16e1d3427UL, 0xdeb4a007a9eb8961UL, 0x1bc2627a40bfd18dUL }},
+  {{ 0xa26c043b85bad9f6UL, 0x05afed1e21e1d813UL, 0x2eaf2f86836c21dfUL, 0x02f14125fda1b9e3UL }},
+  {{ 0xd3a0a4a70a63269bUL, 0xffa84e251c1da587UL, 0xcac5786f728c4ae8UL, 0x10f7ee26929908cbUL }},
+  {{ 0x3774070dbb6b248cUL, 0x4aeb899bcdb53083UL, 0x87def7a5bb748b11UL, 0x0261e39de8ad3e28UL }},
+  {{ 0x0f3c8783b0be3657UL, 0xe85db91cbbddeaa7UL, 0x5357b5a50f167e24UL, 0x2397e238afba2082UL }},
+  {{ 0x2d494e2cd9b579eaUL, 0x6e7b3dbc363a05eeUL, 0x46b11636ca63bcf1UL, 0x2b8e2090f32109b2UL }},
+  {{ 0x44449b92b8223387UL, 0xba185a8a9a5e45deUL, 0x73095719625395e7UL, 0x11f885aab7277bc0UL }},
+  {{ 0xa9a0a9563b736c6bUL, 0x1445205fc0e331c5UL, 0x3c53b24cf3b6b7fdUL, 0x1e2fce81d718f2caUL }},
+  {{ 0x7a1f7a9a9f411641UL, 0x6a6482fe3595845bUL, 0x8952c7aa17115a1dUL, 0x1ab11d943e744349UL }},
+  {{ 0x3166e5b4a689dc9cUL, 0x33a6a3cf49d35315UL, 0xd5949fe492e7e647UL, 0x17da686470bb4ce7UL }},
+  {{ 0x9db18839e8337779UL, 0x80ed11dc82f554fcUL, 0x8539251b670118b2UL, 0x1e3ece423bf443e3UL }},
+  {{ 0x6e5d661010e35ccdUL, 0x46852786eacad4a4UL, 0x61419a62d687fea0UL, 0x1ace3d8f900b2e40UL }},
+  {{ 0x7ef48738dc80cc1cUL, 0x85f9da03a69af388UL, 0x5d933c93f9627fc6UL, 0x230f52e0c494760dUL }},
+  {{ 0xfe104ff7881bdb8eUL, 0xd7c95a48116ed753UL, 0x23fadada2ef681d6UL, 0x2cac201c4e3bb821UL }},
+  {{ 0xf13d6ce7e425a1f8UL, 0x057fc05fd93324cdUL, 0xe1f6f26ab94f6cccUL, 0x003a5220bfc404beUL }},
+  {{ 0x6d197e23ae0db63cUL, 0xac694e4c517ef03bUL, 0xc83d2d6d0292595cUL, 0x0b4705a8d243de3eUL }},
+  {{ 0x0f45e9b3b35a7ef4UL, 0x8ad6d8d1652c7406UL, 0xc240120b8a724abeUL, 0x0485605bafac7a7bUL }},
+  {{ 0xacd0445f954fd53eUL, 0x5cd5ddff0a848adbUL, 0x6833b5b1af5a96a9UL, 0x1f59c35b6c3f0e2bUL }},
+  {{ 0x617955d6048c6782UL, 0x8eaf73b90163d985UL, 0x8279a267b06053a6UL, 0x0c2b5c6d4921b6afUL }},
+  {{ 0xb7bc00f6d011080eUL, 0xa75926784a8ceabdUL, 0x5bf84d702bab3beeUL, 0x2f3b8fb0a8c6b154UL }},
+  {{ 0x48e49ca57dd12a1cUL, 0x13aae72aa93c23bbUL, 0x3db641296ae5015aUL, 0x2d75c592d5c2fc75UL }},
+  {{ 0xccb6b4627a543401UL, 0x8a6e303d0af2b550UL, 0xed71bf0f936ba0a1UL, 0x0886d1e63fe26c6bUL }},
+  {{ 0xa0980b20366e5e0fUL, 0xad86e6560885de30UL, 0x216774bfef128861UL, 0x07f1f9936b4bde55UL }},
+  {{ 0xb5308e028de00848UL, 0xcbc2774d6998aec2UL, 0xb1d9331bfb230cf3UL, 0x178f111a6cd04784UL }},
+  {{ 0x2b0ccfe86efdac46UL, 0x8aa668fabc43d70dUL, 0x3c8ff1886a18d136UL, 0x27dd27cad6b15f60UL }},
+  {{ 0x4504c908752b315bUL, 0x2ae817d83e1f8c7eUL, 0xff1c8f6442b3d239UL, 0x2ba90a906ffa70c9UL }},
+  {{ 0x40f45da961304bc5UL, 0xf62e3a1641638443UL, 0x74cad08421f5f9f9UL, 0x22b0d53fdfab6df7UL }},
+  {{ 0xdecf54fdaad93f3cUL, 0xbaed6562e30f8801UL, 0x44a860e5807bcb2bUL, 0x11cafb44f80d2c94UL }},
+  {{ 0x8b13939a552060bcUL, 0x8483c6c81acbf434UL, 0xe9915c369313b41cUL, 0x2fac43b917342497UL }},
+  {{ 0x4440807b233fb905UL, 0x0e54ecec9ffa964dUL, 0x328259a666cbde78UL, 0x26477323e1d89affUL }},
+  {{ 0x8ae7dcbdde2af376UL, 0x4bef4f959af8efe6UL, 0xe108b330bd14e19eUL, 0x2ffc74360e4ada62UL }},
+  {{ 0x088b672abfefd4e7UL, 0x6940d19a233897fbUL, 0xf44561a21786a8a3UL, 0x11e7d56a083d1a71UL }},
+  {{ 0x741890fc0935eeb8UL, 0x2c457f57ecc215b6UL, 0xa4a46a5a7dcab3b7UL, 0x129d2263ad3f6d9dUL }},
+  {{ 0xe3deed811683817cUL, 0x08f1810c8d5ef49cUL, 0xc85fba3d562c2f17UL, 0x07fd1d45f737f2f3UL }},
+  {{ 0x7886994bfb3d48c8UL, 0x830ad0e4dc7fb802UL, 0xa1c4f565987a6b95UL, 0x2c88d1bbcd13b966UL }},
+  {{ 0x7164873de893642bUL, 0x41913e876dba5d73UL, 0x5fd490834603e913UL, 0x10cad0545646c774UL }},
+  {{ 0x53a6d6e4c23c2bf3UL, 0x7414a4dcbe3c45d3UL, 0x55e9e4ba8ab12416UL, 0x241f0cdef10baf03UL }},
+  {{ 0xc318113156e045c8UL, 0x91c00d5ff4ab1ae8UL, 0xa8041bfddc6fbe1eUL, 0x29532272c7dd69dcUL }},
+  {{ 0x1e2e0a41d543d9c9UL, 0x261299005d05b724UL, 0xdcd49da6342b3e28UL, 0x07b1b5d29363e2a2UL }},
+  {{ 0x61a4ac7785894014UL, 0x084f93d828fdd122UL, 0x95de02d38100a3ecUL, 0x1254baa02455eb01UL }},
+  {{ 0xa146b64f3b28bc92UL, 0xb9dc441f74dd0f00UL, 0x765cc9c062e028e8UL, 0x0a57fc8fcf70b1bbUL }},
+  {{ 0xb9a29c50d3e8eaf7UL, 0xf639e880f7329921UL, 0x5c4c78a647bd9315UL, 0x264e9f9f2e95906fUL }},
+  {{ 0x6f22d88d412b1524UL, 0xb81e0d494d890a77UL, 0x4873286ced971b7aUL, 0x242bddbce72e84a9UL }},
+  {{ 0x1d81d95928fd89feUL, 0x58bf99c5141a46c9UL, 0x3bc5e009e972db43UL, 0x06e78dd6912aaa62UL }},
+  {{ 0x8e5b2bbc974e4863UL, 0xa6252595c0e3434fUL, 0x5ee6d3b29f5df5c0UL, 0x1fcb943e690341e0UL }},
+  {{ 0x53d500b6c6e89326UL, 0x3011eed27c98cbebUL, 0x89ab8c406926aeceUL, 0x0dd410e13c222bcdUL }},
+  {{ 0x12eec50bb9df6cadUL, 0xb88e4ba3f1eee6ddUL, 0x77a2e21b1fd9e5e5UL, 0x189e874231f8574bUL }},
+  {{ 0xcaf966630960314bUL, 0xd3327eef0d960797UL, 0xd6c589fbc5f657deUL, 0x16291db83c7af33dUL }},
+  {{ 0xf5c3acec89f47305UL, 0x589ca0a92b8cae78UL, 0x7034f851a849ef2cUL, 0x12c48ab81dae3ebbUL }},
+  {{ 0xc1e2f45ccf6789c2UL, 0x619ef788b664ed43UL, 0xc9e87b14372939edUL, 0x2c4dd91494cbe70bUL }},
+  {{ 0xd0e1b8012671f29bUL, 0xd83e8bc4ad1bce9bUL, 0xe7f8c9e822f941b4UL, 0x1151d1b219157aa4UL }},
+  {{ 0x71774810f7d144b2UL, 0xa3216736d81ca226UL, 0xcc7088680e7ea124UL, 0x2eb7ce1e4433ac23UL }},
+  {{ 0xf62026be4102b91bUL, 0xa88831acdf44ae03UL, 0x509a794e3f38af41UL, 0x174d2f26dcd369bcUL }},
+  {{ 0x0155d9844444568dUL, 0xf67b5375a28e93a7UL, 0x500b72bc917b355eUL, 0x2284d5d9b12c4196UL }},
+  {{ 0xfc99e47d162e625bUL, 0xf9311ddad58d3cf5UL, 0xcdd16ded84310595UL, 0x1700740f68e6b222UL }},
+  {{ 0x132e82c21e6c6346UL, 0x19b29e0447289beeUL, 0xbcbc46cfe33690edUL, 0x09ae60868ad87112UL }},
+  {{ 0xa84b01673f5e7e87UL, 0x7b61142f02a5bcf6UL, 0x36ed46f7a87c467cUL, 0x150069b6385f7279UL }},
+  {{ 0x08d0b4e804bb4359UL, 0xfd3293cea8666114UL, 0x62ff172e7cbad577UL, 0x042b26369ee7cbceUL }},
+  {{ 0x6bd85f8c2313c632UL, 0x06e848aa4a7b7010UL, 0x79c69b2eba6b30e8UL, 0x03d63704c0b89acaUL }},
+  {{ 0xe38e74eaa363093aUL, 0xb6be0215f2531371UL, 0x50c2938953c3cdb5UL, 0x27ade4916c8c2b43UL }},
+  {{ 0xc9a55b3d960885e2UL, 0x6d516ed5cdb52378UL, 0xb654cbd4d8e449cdUL, 0x0a5e161a278198f2UL }},
+  {{ 0xbe19f22043b69bd9UL, 0x5eefe85c7493c213UL, 0xc044c907c5100fa0UL, 0x030ec77b4e1f451cUL }},
+  {{ 0x95fe9fefb083bdefUL, 0xc49f0d8878afc1a9UL, 0xd759d29c0d750a9eUL, 0x0dddfcf470f963c8UL }},
+  {{ 0xd9aa0643d3305969UL, 0x3e4cf68db25e9907UL, 0x15476fcda6f1739aUL, 0x261d9feefe4183d7UL }},
+  {{ 0x19dce0b04631abb4UL, 0xfe4f1dbbbf816f6eUL, 0x4266b296e967a874UL, 0x21b4ad77b67f6916UL }},
+  {{ 0x75469871289f8d5eUL, 0x0cda6985a5b7e72bUL, 0x98784c14b55e253bUL, 0x1524b7922d4d0573UL }},
+  {{ 0x7d218f7426516001UL, 0xe7fbf013c27a655cUL, 0x56149b929eacf80bUL, 0x14c038105171b5a9UL }},
+  {{ 0x69c28e18f3bcb23dUL, 0x9aa90f9b1738c1eaUL, 0x223645396c658e87UL, 0x0c94c1ca8d9d8897UL }},
+  {{ 0x3b9ad70606441a06UL, 0xf584efefefe39b15UL, 0x5a604f29605f446aUL, 0x2e440c87dd561670UL }},
+  {{ 0xeaf5624ebc12a552UL, 0xac5dcff16897a19cUL, 0x02255e2bf6c97836UL, 0x2cb5a36801598c60UL }},
+  {{ 0xad60d585bf09b492UL, 0xbc7d4cda3e3d271aUL, 0xe93f16181f3d644cUL, 0x07eb802f9d1076beUL }},
+  {{ 0x00ee9646464ecc42UL, 0x3f4a4fc26c454025UL, 0xdf509e8ce7078a8fUL, 0x0c4dff742127ba4dUL }},
+  {{ 0x7bf12d00c3a94cf3UL, 0x5e140f8a2562eb4eUL, 0x59eae0c9a0bdfb3eUL, 0x1912a8c82f6fc475UL }},
+  {{ 0x040969e4802852b5UL, 0xfb393cc29c5e82f0UL, 0x437bb7bb97765551UL, 0x2d3ad5f14942255bUL }},
+  {{ 0xb54cab77910464e8UL, 0xdfc4ce4de81b23c9UL, 0x7747d87467da8bc7UL, 0x1fdc2f4c586f26a1UL }},
+  {{ 0x3d7742536ebb34f0UL, 0xc3c48f320d52d31eUL, 0x85256522e75e45a4UL, 0x0ebcc87bf062f45dUL }},
+  {{ 0x6722cd6eaf22b9b2UL, 0x628ebce6af9e7e8dUL, 0x72d2d23af699abb6UL, 0x121fb848805a9a67UL }},
+  {{ 0xa74ffbf48b1a1c32UL, 0x05432d6584e27714UL, 0x71f5e7a48dfa9cddUL, 0x2e118c3335dfc02bUL }},
+  {{ 0x409d85d840261d74UL, 0x0cb6af0497258d4eUL, 0xec19dce46bed17cfUL, 0x1d80ca1f286ed318UL }},
+  {{ 0xe8eac07c3f903b5eUL, 0x7c6386575a8fb781UL, 0x25aa2f37269b7e7aUL, 0x23f8d1016dc2d3c1UL }},
+  {{ 0x3ece5b91effaf5bfUL, 0x93033f7b5e3060ceUL, 0xc8f4c19a0833c7e0UL, 0x100e5379a3fada78UL }},
+  {{ 0x8a4ac2078664b728UL, 0x106b141695c3ac70UL, 0x0c7390f9a40e5120UL, 0x23c8a25d131b9105UL }},
+  {{ 0x6d2bda25d93a6c74UL, 0xbe99288a477b80afUL, 0x2a7f4f4298d6de76UL, 0x22da32db86d741ccUL }},
+  {{ 0x3f78cd7e5efe9fb0UL, 0xb4669c99f0f90480UL, 0xbab24a2a690f5ec9UL, 0x2891a5c660bd3005UL }},
+  {{ 0x9d355e8cd80658dbUL, 0x041e488039fd57abUL, 0x97b48fd5c4511fedUL, 0x2abf65d6c3f2c1a0UL }},
+  {{ 0x18fab962b64c9a0cUL, 0x30ac29cf7b20351cUL, 0xdfdaf66470051f7aUL, 0x0059476f92f8d145UL }},
+  {{ 0x394db2528425aab8UL, 0x181f90a452728902UL, 0x8419de231b288e90UL, 0x302d06dafedf7225UL }},
+  {{ 0x10c2e9c6db39fba6UL, 0xad482ea7a0324d5bUL, 0x0eb1648463404565UL, 0x0cfeca2e8d78fc49UL }},
+  {{ 0x15269b0a8497a26aUL, 0x0d3f2e50d8481fdfUL, 0xa06f7f8889206cc3UL, 0x1f7a7fbb3206dc00UL }},
+  {{ 0x905064e1969a2318UL, 0x7d70a4d37fcd78c4UL, 0x3def136f529ed591UL, 0x23f2294cca1b6b9cUL }},
+  {{ 0x11e0183a3c11e784UL, 0x59e008734f06a10bUL, 0x7582e1b1d3473bf1UL, 0x0f3c203b63205887UL }},
+  {{ 0xe6b6a9932516417fUL, 0xce98a5cd9d1e5a96UL, 0xb2445735993fe4f4UL, 0x26e816a54a2957adUL }},
+  {{ 0x9e6449bea95e5471UL, 0x09ad4db819db84b5UL, 0x0319050fbb7edcbfUL, 0x10cd227b333c7cfeUL }},
+  {{ 0x9f53e34b5ca38e49UL, 0xa790b921f97d4905UL, 0x816538548093aa09UL, 0x025837859e9a2648UL }},
+  {{ 0x8375534368bc48daUL, 0x34f763fa1a2e8737UL, 0xeec585f1b13fdda0UL, 0x0e0eef0ce0821bdcUL }},
+  {{ 0x6470595ff49d7225UL, 0x7945a4c0f932612bUL, 0x2d9d5afafe52ae1aUL, 0x15c4ffd51c7cf055UL }},
+  {{ 0x91d007c956227b11UL, 0x885b977c23ba5f25UL, 0x6a022af41ca8f194UL, 0x2deab9ce4d0c658cUL }},
+  {{ 0xbc207f8bbf61765dUL, 0x634d900df775156eUL, 0x09200493cf5076bbUL, 0x17e037b41104bd9fUL }},
+  {{ 0x9084e5e170b3b054UL, 0xec5e856946a2b151UL, 0x44b516dd6283ba29UL, 0x246e428d6276a322UL }},
+  {{ 0xe47189e60bf837d7UL, 0xb264f11a21ba3dc1UL, 0x1bba6f091eb3233cUL, 0x278fcccb9f491aecUL }},
+  {{ 0xa93a1ab665c759daUL, 0xbf744bc31438ba23UL, 0xfe946e9bbd3fc434UL, 0x1c02de9ef9ad53b2UL }},
+  {{ 0x120cb515baba068bUL, 0x2c18eafef3ba38ceUL, 0xb714bf134980af92UL, 0x1e84324e5454407bUL }},
+  {{ 0xfcc5e4fd9b717da7UL, 0x2a1cd560488b2d0aUL, 0x6ae0615e7f1901d6UL, 0x0596b20cf5ff17b2UL }},
+  {{ 0x5881347a69b0ea1dUL, 0xf75282746efb6e1eUL, 0x3b33e600b9f5e64dUL, 0x1fbdd6b6225c06b7UL }},
+  {{ 0x9713825d08b336ddUL, 0x7831f944e5a8d96dUL, 0x8180de91a27a5f7bUL, 0x2d52b97e5ec97d11UL }},
+  {{ 0x35395792879e8748UL, 0xd12306d9d88d8f57UL, 0xe12efcaf30a77666UL, 0x05735ea25269cf1cUL }},
+  {{ 0x8db8e28ba36cf669UL, 0xe4be219d7a2ee5f4UL, 0x0789cde8e7902d2bUL, 0x05864d30d1130398UL }},
+  {{ 0xcec5653c95d0cfaeUL, 0x849cad4b8448b93cUL, 0xc2925f4eff3fd12fUL, 0x1740cf41bb2eb23cUL }},
+  {{ 0xd965564458b31ab2UL, 0xd28089538097987bUL, 0xfdf9c4cbdadda015UL, 0x121809189eb92b8eUL }},
+  {{ 0x480199c11e7e74b0UL, 0x9ef09dc2e6349d30UL, 0x589646531295d523UL, 0x0d8fa56595ce86d3UL }},
+  {{ 0x6e861c91b02e695eUL, 0xd3b46a06237a2867UL, 0x328fbf82ff61e838UL, 0x2c8df88faa5503c9UL }},
+  {{ 0xd247db63a105176cUL, 0xb27f1ffbda383385UL, 0xe629b7cfecbfa17eUL, 0x1694778e2d7fb561UL }},
+  {{ 0x943e052f99965e35UL, 0xb691a4f78633a41bUL, 0xa309979802a0e4e3UL, 0x2330f738959e3339UL }},
+  {{ 0xaf05505ebcc1974cUL, 0x108d8d7005f2ec43UL, 0x0ad1154ad7696472UL, 0x264ac8d2e4902a0bUL }},
+  {{ 0x971f268a8a8a9fc6UL, 0xc7b06abf5a599fa0UL, 0xa1e811c8de3e3b3bUL, 0x019c028fdc38ab86UL }},
+  {{ 0xca45a590fb1b06e4UL, 0x5f59aaa11f712045UL, 0x1f800d19a264b421UL, 0x22b3e048ead97f27UL }},
+  {{ 0x04ce36a1157ba464UL, 0x81d03f9d2240d816UL, 0xd806f944fdd2e137UL, 0x177ae8031287e22bUL }},
+  {{ 0x6a6548264514aca9UL, 0x795e9882c611e46bUL, 0xcc1121d293e19687UL, 0x15729ba3ab42f4dfUL }},
+  {{ 0x22cf7461fc033417UL, 0x719410d5485c352dUL, 0x04cc5beb2ea8bc2aUL, 0x2b6db233c454c0caUL }},
+};
+
+static const fd_bn254_scalar_t fd_poseidon_mds_11[] = {
+  {{ 0xbf35d343ac4b23e3UL, 0x32869ab9f3cf3279UL, 0x5a21a53add96c8ccUL, 0x2aec2b24e6536aecUL }},
+  {{ 0xfca676d207563283UL, 0xac7f6f0489b71d25UL, 0x1c1242644851c9b2UL, 0x2a23558b1465b569UL }},
+  {{ 0x2e63e859e896d763UL, 0x3cafe9ff65c9283fUL, 0x7ced04811f294628UL, 0x2539f116e93f536aUL }},
+  {{ 0xdc5fb3fda2f3f0caUL, 0x81b9561304321438UL, 0x270f1822a4998dd9UL, 0x273ab9fa47db9033UL }},
+  {{ 0x25d624ecc8b037d1UL, 0x020f04161c8ac3cdUL, 0x69c6a4ba2d839309UL, 0x0a94090299da1af3UL }},
+  {{ 0x26ab76aaf0bb623eUL, 0xb00c082acaca2340UL, 0xd9cce4dbe9e16030UL, 0x23c05eb266e6e9e6UL }},
+  {{ 0x7d18d2ed8d95a173UL, 0x4fb9906cfd6a5396UL, 0xce889d2eeebda845UL, 0x0e5c26905f16e36cUL }},
+  {{ 0x8bd8751e2716d6e8UL, 0x50e9401677c3aa40UL, 0x667c04bf91d523a5UL, 0x1f36e83df32eb492UL }},
+  {{ 0x5d0f25a80ad58a5aUL, 0x68704bf7283333e8UL, 0x3308308a3b45287aUL, 0x0e0902f86e43f9c1UL }},
+  {{ 0x51b85f906a082750UL, 0x18493a4f2d421b79UL, 0x950337f9f6bf729dUL, 0x2fc56f86f8152700UL }},
+  {{ 0x199b49f65cef91aeUL, 0x223763244686f61bUL, 0x4affb67c25be8a1fUL, 0x0664bc3aa47b7aa2UL }},
+  {{ 0x2b1049b9f9f9751aUL, 0x76743e1c7b3f8231UL, 0x9ee6897f83aa4cccUL, 0x1ec889d07b6955f4UL }},
+  {{ 0xf94d66a749f547a8UL, 0x875744fc0937d3f7UL, 0x1d2071d2b505e0c1UL, 0x019c3ba8abd72856UL }},
+  {{ 0xfc0c2c92191268a7UL, 0xb19d8fe6a0233ed2UL, 0xa8f8ba3988faf2faUL, 0x2a81590a1b717ce2UL }},
+  {{ 0x2049015ac6c2f783UL, 0xc96e8a5358eefff8UL, 0xd74262245fbe1413UL, 0x0539751a4551698fUL }},
+  {{ 0xc140144c273796daUL, 0x3670492a3f284d63UL, 0xd18055b539461e74UL, 0x1cd94e2828e4cec8UL }},
+  {{ 0x72c621ce30995c7aUL, 0xa1c009dcd773aac6UL, 0xc84b1999a5279e30UL, 0x13ecc165354d05c9UL }},
+  {{ 0x1a244087f2b5c2eeUL, 0x090a801f422c4549UL, 0x1295e785f6f85b01UL, 0x13d50d5aae4eefabUL }},
+  {{ 0x8d98f91b899653cbUL, 0x4eda4e0dc329aa0bUL, 0x8a109159bd6ee153UL, 0x2cd3f57f9ce3166aUL }},
+  {{ 0xb375729310bf1574UL, 0x1cb0573dc649c4e1UL, 0x7ad0d5bad73ccd8aUL, 0x2ade402315aa0bceUL }},
+  {{ 0x87c50d8bf3264f6fUL, 0xb695d0e103718fd3UL, 0x1bcd418a144de1d3UL, 0x05b6f7efc63d326aUL }},
+  {{ 0x0fdcb74d28c8d6e9UL, 0xeb7e4eee0aef7592UL, 0xb75c2800df36f2b5UL, 0x280af98f701e1bcaUL }},
+  {{ 0xc4690c6e533acb09UL, 0x9e0ec418828597adUL, 0x216bd6ef5fb63e9aUL, 0x0ce7d631ea127695UL }},
+  {{ 0x034bfb01eff96343UL, 0x048fc437f8920ea9UL, 0x5c4483196b7db8ffUL, 0x06e3fffc23fe3888UL }},
+  {{ 0xa503a1af7517fd1dUL, 0x7e0d524c5225c11aUL, 0x7ff5775c0fa756c6UL, 0x0a2d7fa7ecd2a2aeUL }},
+  {{ 0xdca2ee3c907fd20fUL, 0xc1a65eeb14df80bdUL, 0xf5ac2632f6f1ac1fUL, 0x0340eef696787fb2UL }},
+  {{ 0xd9b5134dd1ce048eUL, 0xbe48fbc348254609UL, 0xfac8f54de70cd0efUL, 0x0494d06806ea9ebeUL }},
+  {{ 0xc28ed9c0ee1fbde7UL, 0x07d5af695d2cbbb4UL, 0x8c6c8d9d7eb413b9UL, 0x0ead44615baa33b3UL }},
+  {{ 0x40093cda67c4a5c2UL, 0x7050bc44ec84ad8aUL, 0x564319b79a44ffc4UL, 0x037be1d905804fe7UL }},
+  {{ 0x34989b5a8bd1e60dUL, 0xd98b1bbf2e442af1UL, 0x0714d912e2eb9484UL, 0x023c071452c17197UL }},
+  {{ 0x0415a64906374e29UL, 0x9fd1e3152777e012UL, 0xcd4fb786bb7479f7UL, 0x2ce135a7ca93b07dUL }},
+  {{ 0x494f434e55f1d032UL, 0x61feaa4afabaed4dUL, 0xa71fac77d5ac513eUL, 0x2238fb2eebfe0906UL }},
+  {{ 0xce89d3e626e5c746UL, 0xb20a601132ff7c46UL, 0x032933879d5e78c3UL, 0x2e3e855c8e3b0e33UL }},
+  {{ 0xc7cbb6727d5802baUL, 0xc344533468c7e02bUL, 0x53d2557122af1a34UL, 0x2b5dec5265f41c24UL }},
+  {{ 0x8e5969f199807586UL, 0x8e071455d62406f5UL, 0x23049bd6f2b12e35UL, 0x1782bca99fce961eUL }},
+  {{ 0x8fcfd01e3ced2ac0UL, 0x2fc8bd2ae4ebd021UL, 0xfc0ff20e936df306UL, 0x032f3ecd2f5816d2UL }},
+  {{ 0xc6a5053c647ec77bUL, 0x4449c23b50d63aa2UL, 0x514306102fa4de75UL, 0x1280e733c15f6836UL }},
+  {{ 0x072d88091fa791f0UL, 0xb86e54dca7b91dfcUL, 0x9a3abcf3f8cd669cUL, 0x24c5c553c42f8422UL }},
+  {{ 0xe872d18064140289UL, 0xd2e8b3588c83a79cUL, 0x34a3ce61dabfe664UL, 0x0825f5f44f0ccf11UL }},
+  {{ 0xcde06cc74b09ed30UL, 0xf84f5da97612a35fUL, 0xadd23e717336f5ccUL, 0x2ebcd07be001e69aUL }},
+  {{ 0x3ee3997c3f431becUL, 0x6b2d2830ce268339UL, 0x8ca47a1e5cd5656aUL, 0x165e017898499d21UL }},
+  {{ 0xd88c878a9e261b21UL, 0x61f123c99755af6cUL, 0x5b442aa9f33982ccUL, 0x0694fdadf4eac79cUL }},
+  {{ 0x69cb4a03023030f5UL, 0xe60bbf72db10bbb1UL, 0x78e98e4a770ccaf1UL, 0x2c117c889cb843d8UL }},
+  {{ 0x28dbca9a9ad82dfeUL, 0x11db59e99f47cfaeUL, 0x566b9ced15dc6986UL, 0x248527b846a9db74UL }},
+  {{ 0x49b36bfd67d4802dUL, 0xb47bf01c6248034dUL, 0x572c4c45739f5d08UL, 0x0ce98f347b663c57UL }},
+  {{ 0x50b14f7e0b014392UL, 0xc860728fec4efaf7UL, 0x472a27c1389a986cUL, 0x185452662408e83fUL }},
+  {{ 0x502dc688c1916ebaUL, 0xa229ed1ff0c9c331UL, 0x7cd838485c87f8b5UL, 0x1c0accde5a11bf0cUL }},
+  {{ 0x5d95201539a8cc3dUL, 0xd94ddd25cadb4655UL, 0x51511942af22f052UL, 0x1e12dcd31ae8478dUL }},
+  {{ 0x80a90e2d5b92127aUL, 0x4d4124dab1e3a06bUL, 0x255018413a9d8648UL, 0x1b64fe7cb09a6c79UL }},
+  {{ 0xbcb5b567c7a62ec1UL, 0xab2a29cac13b635bUL, 0x03954fb339f499bbUL, 0x057e4352b629fec6UL }},
+  {{ 0x82de5bbfc4e5f9edUL, 0x34c916d3a774bc44UL, 0x602ef7e82471c84dUL, 0x0e31d465cae83608UL }},
+  {{ 0xf48aa6e8a5511d9bUL, 0xba145f4f07a36cd1UL, 0xf9c6d258176e2a34UL, 0x07d10d6ba5958a7aUL }},
+  {{ 0x81f84f7a60435134UL, 0x29e4fc16c676b108UL, 0x8faccbb232d609daUL, 0x045f3de723553fa7UL }},
+  {{ 0x67d87c9ec671189bUL, 0x86dd8e7d31481c95UL, 0x871eacf2cd0525a7UL, 0x1bc5c5b879f834e1UL }},
+  {{ 0x1feb99297fe2054dUL, 0x441ce8098af13e16UL, 0x21157e55ade16fe0UL, 0x23d3e18174942c03UL }},
+  {{ 0x96a42e6ec45f5da7UL, 0x2b0a142ea4128910UL, 0x17d58f95d07cd271UL, 0x0a47d9bfaa2ded20UL }},
+  {{ 0xecb0fe70282ba190UL, 0xfa4c488466538750UL, 0x149a85795f324117UL, 0x21afe8e1f4040b8fUL }},
+  {{ 0x1ada9183bd937243UL, 0x9c4582cd50318e21UL, 0xa931c6fb29fe1438UL, 0x150e7c5351c85654UL }},
+  {{ 0x6906e5d147a1fde5UL, 0x6fd9597a1a0cbde4UL, 0xaedc2bf376d28e29UL, 0x0cdcd53badcb9b12UL }},
+  {{ 0x98ca4ec0ca11f46aUL, 0xbf5797d559a17039UL, 0xab26b967a9fac4d5UL, 0x2119500896d5cabfUL }},
+  {{ 0x26474ab858354ddcUL, 0x32fbba74592102b4UL, 0x55c2f97dccf6cbd3UL, 0x15bc5ebe5f411e70UL }},
+  {{ 0x137a9a738067c807UL, 0x2033a879dc3f30c1UL, 0x840ab1a91428871aUL, 0x11d97d2e32ffccfbUL }},
+  {{ 0x970a4c4e7805c784UL, 0xc9e96d11804b723cUL, 0x94046de7edb94244UL, 0x026e13ff7cbed3fbUL }},
+  {{ 0x005c054fe286be36UL, 0x028c0f36c357ad7bUL, 0xa99466c41241da67UL, 0x1c231bc792d01f5fUL }},
+  {{ 0xb1a821fc8bf97980UL, 0x4349f85e1800148aUL, 0x7517283b64f01016UL, 0x15550f7b4ea966f2UL }},
+  {{ 0xdac3755099239639UL, 0xddbb101ee1f91f6fUL, 0x36154794e3e283b8UL, 0x27a704566975d60cUL }},
+  {{ 0xbe3a07e27a9cc845UL, 0xc134408be4848d50UL, 0x0ea4f7945366daa2UL, 0x301d90e4c519db4bUL }},
+  {{ 0xa1e815beccc4f805UL, 0x1cd8c091c86d131cUL, 0x96e7daace1120abcUL, 0x08bc3b75a90424c2UL }},
+  {{ 0x23a54851254fb145UL, 0x58556699c91a71adUL, 0x9f72c64edcca1e4dUL, 0x09d3cbeb91720b4aUL }},
+  {{ 0x6031a5987c673410UL, 0xc2bafec6d7a53497UL, 0xfb7193a7c5ef9169UL, 0x27e1020572500025UL }},
+  {{ 0x9367203184bc25faUL, 0x408ad3f1e0cc51dcUL, 0x314a9bc3d889cab6UL, 0x02587ea78c84a327UL }},
+  {{ 0x1b5d851002b9a454UL, 0xb80824bd72eaa498UL, 0xc3cc3f0c7579cb80UL, 0x0288e3d4a528be9fUL }},
+  {{ 0x165c9f202c936031UL, 0xdd83fb2ea3a9eeb4UL, 0xee222d33c068b144UL, 0x0c4d8941fb06fc4aUL }},
+  {{ 0x0ae493a8fed5e2fbUL, 0xcab2002e0d7cbfa1UL, 0x112db1d9d65263a7UL, 0x1ebfd5760eb1c752UL }},
+  {{ 0x55f5b362439ee4e5UL, 0x9df1b4c503d47512UL, 0xfc33eef9bf274b34UL, 0x089485a2b24cf23aUL }},
+  {{ 0x5ac8a917d661dd88UL, 0xfa14065ed60d706aUL, 0xa9288be07a86417fUL, 0x016750f50a2a56e5UL }},
+  {{ 0x9078f1f1e2d7b386UL, 0x6c25aef03b3b98e8UL, 0x303e9740ca428a16UL, 0x2fbb717f4efa0187UL }},
+  {{ 0x20cdf3e70443a904UL, 0x7b5e01f61381f2c1UL, 0x5b159d1a7cd24c45UL, 0x0c6b8614bdc831d6UL }},
+  {{ 0x293b0cef1c5ac25aUL, 0x9df4d19bb18b162aUL, 0x135e825bfa1f93bbUL, 0x17fcbc39f1cde751UL }},
+  {{ 0x6cb771deaac10d1aUL, 0x27fe03e6d08fb6b1UL, 0x555c80634768fa81UL, 0x25f90a51a57a1ef1UL }},
+  {{ 0x6b3256b8fcd16f0dUL, 0xb7ba98cf7aa78f5aUL, 0xd01010a809d4a49cUL, 0x03761c627c5533edUL }},
+  {{ 0x7f1e7cceb3dfddd6UL, 0xcf63d2f2e7bf732aUL, 0x188efdc71c699443UL, 0x1818b43c0645f38cUL }},
+  {{ 0xece943b1f522fb82UL, 0x10de4d68f5606312UL, 0x528cc7f7293d61eeUL, 0x1df2148ab5ea7f55UL }},
+  {{ 0xafd30d5f09a566e0UL, 0x90908c8e9e160f13UL, 0x078028d4b51f4f92UL, 0x1e93c631844f20c9UL }},
+  {{ 0xcabbf12e75810a20UL, 0x41c825465a622db4UL, 0x8e88337b770fee88UL, 0x2c2ee6510ef8e6abUL }},
+  {{ 0x310d2a94303f08d0UL, 0x7e3f820da9feb4aeUL, 0x97b099361dbb4237UL, 0x047e10c59d3ab197UL }},
+  {{ 0x4d1a0651a7a40f9fUL, 0x61e7caa1f8388f57UL, 0x6d57bbce152a7587UL, 0x2515fdaada14e61eUL }},
+  {{ 0x689db4c270bdb534UL, 0x5fc60ba1a7fffe98UL, 0xacf99514d7cd971fUL, 0x1994f03c12e8851bUL }},
+  {{ 0x8c812d160d476290UL, 0x1c1d60d71e3afee5UL, 0xa09b69f9383055c4UL, 0x05fd12616dfd67e8UL }},
+  {{ 0xac1d8e93757d5de5UL, 0x309082a72f92da4dUL, 0x57374a0bfe631415UL, 0x06e8e21b6970d282UL }},
+  {{ 0x1d86ae354b918fc5UL, 0xd655b53fba566ca2UL, 0xf6e6997f84eaf91aUL, 0x1a8b79c5a15ea5c1UL }},
+  {{ 0x969339d318fa052fUL, 0x68ebc04a13ed98fdUL, 0x12fc5f957f4830caUL, 0x1c22284ede6a45f2UL }},
+  {{ 0x60268eb6e3393e4aUL, 0xba50b623e8c37020UL, 0x13e61fec61621cb2UL, 0x1ef2f0fafbc4ca6dUL }},
+  {{ 0xb9844605f4dfbec4UL, 0x71f63fb708c0f48bUL, 0x81357e928bf66881UL, 0x083fe77bd4a6ad6cUL }},
+  {{ 0x060613ba49e92450UL, 0x63922773b6e2b932UL, 0x7f8680a80b350f87UL, 0x2afeea993fd77198UL }},
+  {{ 0xac83fd707f8d062aUL, 0x3c159ac78de900a7UL, 0x6b501916f38fec5dUL, 0x02d923d6fe2d92d6UL }},
+  {{ 0x4757c7a4a367375dUL, 0xcb929a8478d52382UL, 0x95067ec709b5a30fUL, 0x0d2a9fd3d9450448UL }},
+  {{ 0xdf21ddff4755bc1fUL, 0xd933e04a4bef23adUL, 0x123f5f4610b009b4UL, 0x0549f9c6547a731cUL }},
+  {{ 0x089ac0e1cb3cd399UL, 0x582f60c4fbf6cf04UL, 0x9cb495657e944e77UL, 0x254f3a2ec492e83eUL }},
+  {{ 0x347ad3bc37e222f9UL, 0xa703b8686e4358edUL, 0x5252d25cf7bc2938UL, 0x09a5c063942169a4UL }},
+  {{ 0x8b38e493b923813fUL, 0xadebee70756ac6dbUL, 0x3730422d1f202f84UL, 0x079c4457dd0c674bUL }},
+  {{ 0x0a62306057e92c7bUL, 0x0db1e5febce9fd0cUL, 0x41d59cf045dc313cUL, 0x16e22f7a675426e3UL }},
+  {{ 0x55d5373c27954508UL, 0x93385d6f7e8b358dUL, 0xdc1274820d2bcbebUL, 0x0f6a415438cecd0bUL }},
+  {{ 0x91856705f8b9bb6aUL, 0xd6004d71e6c676b3UL, 0x099c4712f602977bUL, 0x25c2c26f098fc3bfUL }},
+  {{ 0x0612d665b9c9a2a0UL, 0x905f2cf02b932ce5UL, 0x3cb53b9ebd7e1485UL, 0x1464f5b91144004eUL }},
+  {{ 0x75663fcac9672712UL, 0x381658867e131f52UL, 0xde4cd5997b8fc5bdUL, 0x1988071950b3320aUL }},
+  {{ 0xd96a8ebdb0fd1131UL, 0xef41c2179db7cc9aUL, 0x9a59dfaa7206e249UL, 0x0e2a581be7e5bb8dUL }},
+  {{ 0x1e9b4abc6d3fd546UL, 0x03d72ea73e38c0d5UL, 0x5712505ae1ccab87UL, 0x1ae240d41c29a279UL }},
+  {{ 0xe9c203d0be609914UL, 0x3c8c319c1fa4ae4fUL, 0xf4badc30095dd5edUL, 0x12951088d2c33eabUL }},
+  {{ 0xb004d659a05cff7eUL, 0x797910f54d55b8b2UL, 0x10e3db64c59fc5e8UL, 0x0ae5b1c5c70b3689UL }},
+  {{ 0xfa0f7997885e3181UL, 0x3696fdac1937979eUL, 0xb8c35bb8ce55f885UL, 0x13239e9894fcfd4eUL }},
+  {{ 0x91bda864d3843ea7UL, 0x093a9519b793f51fUL, 0xd1a91751bca18734UL, 0x29867a7fcc0ddbe8UL }},
+  {{ 0xdbc5c34915ba7952UL, 0x9d63001a2aabda6bUL, 0xbadb5427faeaf1b9UL, 0x09786189e33ceb3aUL }},
+  {{ 0xc43e945f72a3610bUL, 0x799a991949193c0eUL, 0x2be403440a7302d6UL, 0x203fd027b8e4b2d3UL }},
+  {{ 0x3116b7bd86642414UL, 0x4a976e0d5b105231UL, 0x3758f0910eae6fb7UL, 0x23d304680c3e928bUL }},
+  {{ 0x33be9f14d79601b5UL, 0x397e3c823344a161UL, 0x05cb1441b248ecc2UL, 0x1948098762852d0dUL }},
+  {{ 0xaaea3d004432c700UL, 0xa80de34b67fc6711UL, 0x36f650f20c7c5f6aUL, 0x1b3061f5449296bdUL }},
+  {{ 0x0dc19f89b2b2fb65UL, 0x9dc527b2754567b8UL, 0x29b3af22e16aaf89UL, 0x212a610bb30c97a7UL }},
+  {{ 0x31ecee97caf7a027UL, 0x4ed240608404a59bUL, 0x9d8d1254727e1030UL, 0x1059e0b9c556cc17UL }},
+  {{ 0x8bd41963e9d366abUL, 0xa7ac622a7fa68294UL, 0xf94d7271cae27036UL, 0x2f852a6bcc183524UL }},
+  {{ 0x1722b19cab310b65UL, 0x6f0e8c9ad7bc4036UL, 0x952d2c30532abe01UL, 0x03d127a65406382aUL }},
+};
+
+static const fd_bn254_scalar_t fd_poseidon_ark_12[] = {
+  {{ 0xc206ab5b7e9999ecUL, 0x695b8ad148207108UL, 0xad8c370a23e0e1e2UL, 0x0376bc0993731eccUL }},
+  {{ 0x2841f2ca54028e07UL, 0x8b921e061ae9b944UL, 0x1d7723ac15cd7ae9UL, 0x1016b5bf680293c0UL }},
+  {{ 0xeca055ca9b82bdc7UL, 0x1b252e7ba276f303UL, 0xc82151c149684730UL, 0x0fb98a7481751601UL }},
+  {{ 0x603d383ec9c3cd7eUL, 0x7273c3a2549a464dUL, 0x4adb115d946ce148UL, 0x04fbff9e9fc53e56UL }},
+  {{ 0x9569bff773cb24b6UL, 0xf3b4a076aaa7ef1aUL, 0x615aa200d21580b7UL, 0x2b85c2eac88a0cf5UL }},
+  {{ 0xbf5bd329a1fb4645UL, 0xbbee81a89034d515UL, 0x4a8ed992190a425dUL, 0x244c843e58302192UL }},
+  {{ 0x0d2407dd6e85c225UL, 0x58fc79617b4eb9ccUL, 0xd00161a70b258d9aUL, 0x1963a517dfc4f6ecUL }},
+  {{ 0x9edcd6d3d0349d0cUL, 0xb7104fe6f8472c55UL, 0x3541cdf202a9dfe5UL, 0x23482ec32aec5380UL }},
+  {{ 0x18b636ea163ee343UL, 0xedad31c50b972da2UL, 0x202f99013f2ed1faUL, 0x2bff6b508e8e3e31UL }},
+  {{ 0xb5341429890bd992UL, 0x8f96c5cec56e16e8UL, 0xd390d54847fab27bUL, 0x12e47a2d6a9917e1UL }},
+  {{ 0x2a1abf55ca149353UL, 0xa89e42bcf7fbe6b6UL, 0x3d2514f4785cac3dUL, 0x181af6dc040f33b2UL }},
+  {{ 0x9976552b0ce26fc0UL, 0xb74ac0654b43fc4dUL, 0x1f712bfb0b2c7aa8UL, 0x047aee2c576493e8UL }},
+  {{ 0xf4f8c5ab08b84532UL, 0x52a9331c8a9e0456UL, 0x77188a1d3c6e9ae8UL, 0x209934af9244cc4fUL }},
+  {{ 0xbef4f38e0863b142UL, 0x2c83f25dce90fe4cUL, 0x95a8e7598e18f981UL, 0x2c618909465ef203UL }},
+  {{ 0x276181cb719115c5UL, 0x6c257ae47b3e8262UL, 0x330dacb2ac80f42aUL, 0x1209b87e23fcec30UL }},
+  {{ 0x9ef1a36211b5cad8UL, 0xc6f67d2517580411UL, 0xe6c9193c222bda6dUL, 0x1266c639a5120fceUL }},
+  {{ 0xd12b40b516ddd9bdUL, 0x36a2fa3bcd7d8379UL, 0x1e549d7de2d79037UL, 0x127542c054077171UL }},
+  {{ 0x9f1772210f11fe77UL, 0x32d98a3b3a7bfc0fUL, 0x1822c8dfac2d52a0UL, 0x02408d6da9322186UL }},
+  {{ 0x28873d4921057b29UL, 0x2bfcf5cfec032edcUL, 0xce795d3721b55cafUL, 0x0f87608cd983cf50UL }},
+  {{ 0x5e106985cddf1d87UL, 0xfd273a31e16c21a3UL, 0x1e32fdd695e093ebUL, 0x2fd2cf320a450405UL }},
+  {{ 0xa38264907e4e06edUL, 0x0c0ffd7acff5eb81UL, 0x3116474aa4176a2cUL, 0x21590f970d14e8beUL }},
+  {{ 0xb57f5873993142eeUL, 0x22786d33eff1fdabUL, 0x15db1756b311cfcbUL, 0x010f3537b7fd7edaUL }},
+  {{ 0x8fe6cfc1b12dc977UL, 0x6cb21e1f44d0cf7eUL, 0xb0a3d9e224ea7ef4UL, 0x2239dd898942ad86UL }},
+  {{ 0xc2e5a1f6c8dcb647UL, 0x6caa97f570490e2bUL, 0xf319a853d23d96e7UL, 0x103d2c2644cff963UL }},
+  {{ 0x45dbd6df59f2e09eUL, 0x102e1f544b21a755UL, 0x6049cf6c3560eb01UL, 0x1eba90de4be5b6efUL }},
+  {{ 0x80599eaf94d68b9dUL, 0x854d3a468218ace2UL, 0x9cfb8ba086e9b040UL, 0x025f3c840210cca8UL }},
+  {{ 0x3944499396cb2b72UL, 0xae7c46f9b3e52348UL, 0x5b5f32ddf501406dUL, 0x2810537730f77dfdUL }},
+  {{ 0x81f8b558b001cbfbUL, 0x9898f07f78b328c1UL, 0x428716bf6e2ad94cUL, 0x1e5b619ced819151UL }},
+  {{ 0x2476f907e96bb994UL, 0x77b5549db41ff293UL, 0xb8fec3228f4c23f0UL, 0x2e1f2597c7cbced8UL }},
+  {{ 0x6eed1b05b5a02328UL, 0xb354f955d59d3310UL, 0x218d384190738458UL, 0x137f4cfaca2315afUL }},
+  {{ 0x814302c01730223cUL, 0x119138bd5709c2adUL, 0x59d611c5cac29e80UL, 0x09577374a69f7fe4UL }},
+  {{ 0xea7ac69f3fc68ccbUL, 0xa02f66b7d72a3d66UL, 0x937f0d1124ff6b9fUL, 0x1be7dcbfe896b059UL }},
+  {{ 0x6dde4219bc5e0380UL, 0xd93c4ccdc0697c64UL, 0x96186042beca6101UL, 0x0eb4e86e72996b51UL }},
+  {{ 0x932d28cd37816470UL, 0xf35a6a06677a2e90UL, 0x7982227c89b2271aUL, 0x0228e5deabddb05bUL }},
+  {{ 0x1c587688ee4578ceUL, 0xb0edbcfe96f3e6c1UL, 0x0ddc160e9c929386UL, 0x18c2ec8d7885a340UL }},
+  {{ 0x791976c61de17551UL, 0xa1728cc7758be5b0UL, 0x356624c64971ebc3UL, 0x1d4593a1fdf537b5UL }},
+  {{ 0x43632d5df11c4f9dUL, 0x86bf4d05ab50d6dcUL, 0x7909ee668ca06c5aUL, 0x1507fdee43eb6834UL }},
+  {{ 0xd38d42187367c745UL, 0x1a6254c380842253UL, 0x3437dc8e2085942aUL, 0x05d78adfeb41ed00UL }},
+  {{ 0x358f912b981df4a3UL, 0xd1ae16e48bb79402UL, 0x2fc067f8252f5eb3UL, 0x25150d6f28657b28UL }},
+  {{ 0x9dc0879ae0130957UL, 0x423341dcbb743d46UL, 0x031a42dc7aa372beUL, 0x26bd4a7cd8f6c312UL }},
+  {{ 0x652eef430552f4cfUL, 0x20794fe9d5505355UL, 0xf7e22eecfd72ab4dUL, 0x10383165a63c5027UL }},
+  {{ 0x39a6f080b223fb5eUL, 0x40795a8226358960UL, 0x238a599af6b7cc95UL, 0x0a8ff53c9f317967UL }},
+  {{ 0xeef198fd09b9a9a2UL, 0xc42930f91cf9491cUL, 0x982fff6b71abed97UL, 0x14af165d6cde6be8UL }},
+  {{ 0xc869687b5061bbfbUL, 0x7f81fde27a828841UL, 0x3793ecb54fd2bc65UL, 0x0e3fc89ef70b3f5fUL }},
+  {{ 0xc9dbb51353b24ca0UL, 0xca2f39bcef9f66c8UL, 0x2eb7ffef29562bb7UL, 0x21f2f66c084c9131UL }},
+  {{ 0x9d9f3a2b4840bbfbUL, 0xc4cefba9fb445b70UL, 0x6f6958412022015eUL, 0x060d73116a3c24a7UL }},
+  {{ 0x60e0ae306f58895cUL, 0x42acdbe2936c41a1UL, 0xc7144d6bbd721f2fUL, 0x10f0538c69c1651bUL }},
+  {{ 0x8af066ed4b3d1a27UL, 0x72f7d6380b519a1eUL, 0x811e3f3e10966cf8UL, 0x14f1dc270cd3d90aUL }},
+  {{ 0xa04fbc4ed6d5506dUL, 0x741985679d7de614UL, 0x0ae63cf4a78a2a17UL, 0x22cd454e44152aefUL }},
+  {{ 0x496de19a9f1432f5UL, 0x637f020a62e5e3d5UL, 0x068dd1d49c391856UL, 0x1bf93e5a8db64122UL }},
+  {{ 0x102df9093c8e8869UL, 0xa9c6272feafb7c77UL, 0xc7fc32618e0c1ffaUL, 0x2f48fe9ef944e95cUL }},
+  {{ 0x2b656415dd6388caUL, 0xbfd2cecb519c1123UL, 0xe869748c2db347e9UL, 0x2cb63cdcbce4bdfcUL }},
+  {{ 0x560f0d8625be0009UL, 0x9d1aa2fb196135d4UL, 0x429618a6be4d0343UL, 0x2f90c6c8f46962e4UL }},
+  {{ 0xff7fc66c641e5179UL, 0x854569aff8be4ae8UL, 0xb69467b5a159b108UL, 0x23490d493ee913b4UL }},
+  {{ 0xde2584874c92f9d3UL, 0x091918a98b19d4ffUL, 0x4d1b1905117a2decUL, 0x11683c9b3f526a98UL }},
+  {{ 0xc7e83885098e7af4UL, 0x4e0cb942e579f2e3UL, 0x1043e67b83075ee1UL, 0x280748d153d4b759UL }},
+  {{ 0xcf889a78c2291da8UL, 0x7aa3be0d41da4234UL, 0xe2971b4e8c5276a1UL, 0x1b9f840ef0c42cfaUL }},
+  {{ 0x6c0481ae599760b3UL, 0xf5658a07a63bca0cUL, 0xd8153a72e45ff1aeUL, 0x2658e2bdccafbe03UL }},
+  {{ 0x5da1130e380a0151UL, 0x135b0c3d4a1379feUL, 0xb246ff1e3241dedeUL, 0x22a5b80435a0319aUL }},
+  {{ 0xb6d1f16eb572afceUL, 0x6898473398bed984UL, 0xfafc5bfc4d072ce8UL, 0x0d30108376964a4eUL }},
+  {{ 0xf9de9bcab259c2cdUL, 0x7a2687c3bd3985f0UL, 0x0794afb203ecabefUL, 0x00f633039ec1edccUL }},
+  {{ 0xfe311f873775aaadUL, 0x1fb90c4be9e20443UL, 0xde05246f56914d2dUL, 0x1d028c799f599973UL }},
+  {{ 0xddeebc04e594a834UL, 0x2671a013d07d11c1UL, 0x07a3a80bd5486096UL, 0x0221d53d38c11e3cUL }},
+  {{ 0xc47c10deef306a6bUL, 0x12d6efe3c9f163a6UL, 0x2b45f82a955fed27UL, 0x0716aad872a6163dUL }},
+  {{ 0x5d50ac262bbbbc9dUL, 0x4f7a42b769e83b7cUL, 0x72c766e356f36452UL, 0x1731836cf27578b7UL }},
+  {{ 0x095671c1a45190d3UL, 0xb14b47e0d21c95a2UL, 0x348275a1df71ee88UL, 0x17391a7fa7b8d9c4UL }},
+  {{ 0x15b7c85b6d80c8afUL, 0x132df40a1cba769bUL, 0x8bccaf53b9e12a7dUL, 0x102dfd799af4e485UL }},
+  {{ 0xbffe3ad5edd11c22UL, 0xa68353ab441cad1eUL, 0xcfd97d94df707a73UL, 0x1427614aedb09b6dUL }},
+  {{ 0xda9cb9d6fb8c566eUL, 0xc52414673c39750eUL, 0x5ed926c561a53e36UL, 0x0d26730ca78a49dbUL }},
+  {{ 0x80958df0f4a7659dUL, 0xabc899efefa7be10UL, 0xa6117e201a29c035UL, 0x04d2a0c3911e7f2bUL }},
+  {{ 0xbfdb059380ba0633UL, 0x04dd12f8fb2b5a68UL, 0x16fbf43fc0856978UL, 0x17c663dbeff69b22UL }},
+  {{ 0xebc3ebd53652d89cUL, 0xd93fb96c2b403ad2UL, 0xbe8fe4557234a754UL, 0x206ee0000cf7fe41UL }},
+  {{ 0xcebd66c4ad4f8721UL, 0xc8a4ddb968bee368UL, 0xd129664ec0a4c35bUL, 0x04abe27e94ae123aUL }},
+  {{ 0xe7736ba79eeb1434UL, 0x7ed16b4249d3a2beUL, 0x1afc194ed60b995dUL, 0x099b7d9829063e62UL }},
+  {{ 0x8902ffcc84ef11aeUL, 0x8503040c236fa162UL, 0x9f51fbba32d2f187UL, 0x0a27c0e5e2e9d1a5UL }},
+  {{ 0x27d5408532868aeaUL, 0x76a34a32653e6f08UL, 0x61cef416e232ef73UL, 0x2538daea0f4da389UL }},
+  {{ 0x4a9996bb32bdd448UL, 0x1bfa50848eb91267UL, 0x2429342b7c74f980UL, 0x1b4429b4a8d39c00UL }},
+  {{ 0x64bab0bc2f1789a2UL, 0x01e4347c4045a887UL, 0xffd18b8b5695da6aUL, 0x04effc85690b4a79UL }},
+  {{ 0x0b3b83eafb29d0a3UL, 0x812c4aaa293124b0UL, 0x29093b55214c3fc7UL, 0x1c0be295164208b8UL }},
+  {{ 0x9ecac2047763a177UL, 0x4eacd81a17d4dec9UL, 0xe68f63bed0d35b70UL, 0x18d82cd8dc764d94UL }},
+  {{ 0xdc0455488e8b9ed5UL, 0x34af06e1d3092433UL, 0x1a42b3602ed72236UL, 0x0a685513745314b8UL }},
+  {{ 0x910dbbdf10525532UL, 0xc0c5c37744fa975eUL, 0xb9f2f8f2d49789f4UL, 0x2cc7bbe64d3b11e3UL }},
+  {{ 0xd300a6c3672ade48UL, 0xdc4f887b17e71c23UL, 0xc69b28d47368202dUL, 0x1a207096805c9be7UL }},
+  {{ 0xceb5551bc83f04c3UL, 0xed0ae962d2c0cdb2UL, 0x0ec7c73b0acb751fUL, 0x2af6186021040d28UL }},
+  {{ 0x7ba1d46dfaf3567eUL, 0x0964155301f5c5ebUL, 0x1b2d82512a7c3b63UL, 0x2d0d3c2fb1729673UL }},
+  {{ 0x96063be16a91d2e2UL, 0xb89588dfd3151e4bUL, 0x915f9bed3a2fbe15UL, 0x10da51193f5b5937UL }},
+  {{ 0xae13f4bd50d155d3UL, 0xe558c0d627b1e0b0UL, 0x236928850183c8dfUL, 0x01ede9be4720201cUL }},
+  {{ 0xb8b2e38b761f0e67UL, 0x534e9971aad5911aUL, 0xc63e9a7075e68b5eUL, 0x187e5ca76dbe59c2UL }},
+  {{ 0x1f2dacda67f14d29UL, 0x07636b8ce745e1c8UL, 0x62885a53f4c5c985UL, 0x064b7db475821127UL }},
+  {{ 0x967eb520bc255881UL, 0xfaa44f7004369e73UL, 0xb35664f24b06daddUL, 0x18c96241939b4395UL }},
+  {{ 0x864a33bf4a0da83bUL, 0x93b575d6a5467abcUL, 0x53b091a657943aa1UL, 0x1d61de03448aaaddUL }},
+  {{ 0x5469102601efbf28UL, 0x9c115811f7788d42UL, 0x9bb27106eb897be3UL, 0x2de291c2a58f3f5aUL }},
+  {{ 0x8030601c95370579UL, 0x8cffb82a8a74cbb7UL, 0xf22fccb02a5bb213UL, 0x1cd1c30daa4ed307UL }},
+  {{ 0x3f27ea36192ff8c7UL, 0x8bb27acf4df02caaUL, 0x495ddef2a3464639UL, 0x1848771dce914dbfUL }},
+  {{ 0xcf3da12aa81f0507UL, 0xf3f6d05f696dc6f2UL, 0xf89322f34a67802cUL, 0x0dbfe7bfdec92d02UL }},
+  {{ 0xeaa9c3f4986a50aeUL, 0x475c03d6d2222c28UL, 0xef429eaa82b1fbbfUL, 0x28f5432c8df05048UL }},
+  {{ 0xa33c62a6dc2b8af0UL, 0xfb6e66ec640b4bfaUL, 0x746ad6d227919557UL, 0x27945561a4296a48UL }},
+  {{ 0x81eb4b45f50a99d8UL, 0x743d08e4da75b285UL, 0x0990b2af79e3b73eUL, 0x195a89946367d9f3UL }},
+  {{ 0x196262efa621bde3UL, 0xe4da6d40990c9ba7UL, 0x658858dda012cb44UL, 0x2595f2f0ea4a473bUL }},
+  {{ 0xe4091aa16bb3c50aUL, 0x8e820991bb88f23bUL, 0x1d83ad296eb4fa5cUL, 0x2288bd697729d42eUL }},
+  {{ 0x0002e7f4a5554baaUL, 0xe2bf4b969ac17d35UL, 0x4bcb981b554f760fUL, 0x0ae6d61b63864cbdUL }},
+  {{ 0x70f70fc26e4ab6e5UL, 0x5fa9ac07a67114c5UL, 0x6cf6eb592f9b60feUL, 0x044c5b2b3f01e5c5UL }},
+  {{ 0x59c610b2a038cf42UL, 0x1cf1c9189e93a582UL, 0xca76bf86ec542e76UL, 0x278da57017e6c0ecUL }},
+  {{ 0x4f020398c8b9e96bUL, 0x767354dc68137e63UL, 0x0ea505523a2eea2aUL, 0x13c4e1be0aad1416UL }},
+  {{ 0x969ec0c57b6d9bf7UL, 0x6ac9f281b8ccf4c2UL, 0x648ac19d9f0fd135UL, 0x07f173b2e5a88f45UL }},
+  {{ 0xf78b273d9d41efc1UL, 0x6efe7b8227e02db1UL, 0xd091dc77213813baUL, 0x1f2dec010c337e77UL }},
+  {{ 0x3ff6bb3b02dcc040UL, 0x217d30fe61b454e6UL, 0x9c8517454ea984ebUL, 0x0cddd5136de0a57fUL }},
+  {{ 0xcf81ec7b03533d89UL, 0xb4900009751d5d89UL, 0x92ba7f26c168725cUL, 0x2894da6fd0910c67UL }},
+  {{ 0x4bb7c16eefeab5abUL, 0x250cee981eace24bUL, 0x94dab6d61d3cfa94UL, 0x13ce5c759520c008UL }},
+  {{ 0xd2a4152949f394abUL, 0x31c7e63b9d66e693UL, 0xabc2af3dde65bc6fUL, 0x1849ef142b794f8eUL }},
+  {{ 0xe4f7428784918f96UL, 0x644468858302e7adUL, 0xfdca3de81c9d5ce0UL, 0x0f2f3d42f9b0574fUL }},
+  {{ 0x25893c525dc7471fUL, 0x5a6affe37a3c5832UL, 0xdc9ee92da1b9b4a9UL, 0x2083ec28ac4c48b0UL }},
+  {{ 0x37078f4c7f078688UL, 0x23656b344c59c5e4UL, 0x20189327612493e2UL, 0x1504dd6f64e9604fUL }},
+  {{ 0x81b8fbb91129a03dUL, 0x41a4d87d50a4f433UL, 0x783984de5c95279aUL, 0x1e3f02c0461bad0bUL }},
+  {{ 0x869f96b1439bb3f4UL, 0x91f406c43b496b30UL, 0x9cdaa550350ce125UL, 0x16dc3c46e3d9fdf6UL }},
+  {{ 0xdaba3bcd336e14eeUL, 0x0ccc82a2d6f2952aUL, 0x690f9b240c628321UL, 0x0d8036b2eea1a855UL }},
+  {{ 0x7fb807a4197336fcUL, 0x49b43a0ff916b7c4UL, 0x18ecb3d19d8aec89UL, 0x052a0998ed3bd904UL }},
+  {{ 0xc60b7c35beb368d9UL, 0x2996c1f11aa526e6UL, 0xdc47fcc991386d0cUL, 0x1bdb8900179bfbe7UL }},
+  {{ 0x0d4dcd7c42f66985UL, 0xf3669e5927739407UL, 0x02ce5c49f8532818UL, 0x075ae43606d09b46UL }},
+  {{ 0xba08aac865e2873aUL, 0xee0420cb2cff58f6UL, 0xaefab4627dd6c9f6UL, 0x086432d7d1900a4fUL }},
+  {{ 0x58ac874a13770867UL, 0xb902f51fbcf974a7UL, 0x8e42308a5b45797fUL, 0x2cb5d4ac02e5b733UL }},
+  {{ 0x3fcfe8e5e8a480c2UL, 0x0e6c8ff3f1c77163UL, 0xec1b22f3f7d66d67UL, 0x02bd86e50f8552cfUL }},
+  {{ 0x14a1cef3a6533d5dUL, 0x51825fe7050925c4UL, 0x45d3c5fa73b75468UL, 0x205d5dfbb59b4618UL }},
+  {{ 0xb8914b9f25361eadUL, 0x0d7f7ce3a3873f8fUL, 0x5cf65d314005010cUL, 0x06946b7698ee0cb3UL }},
+  {{ 0x9d0e575fd93569f3UL, 0xb2e0ab4db8910655UL, 0x2c7136f4300b5c7cUL, 0x2ba91a2b61dae147UL }},
+  {{ 0xe05edb80de307b10UL, 0x4a8c8d24cc5f89b7UL, 0xafe47896ff6ad4b7UL, 0x164e9e7d2d2c67aeUL }},
+  {{ 0x4c695e04b322d167UL, 0x4f0e34aeede0bf09UL, 0x908b74ff52b1510bUL, 0x047b2e033cc328e5UL }},
+  {{ 0x9a8158406f94699aUL, 0xc1a0795f2e78387eUL, 0xa7770dc79e051aadUL, 0x052dbef73e82d910UL }},
+  {{ 0x6f311239531d1537UL, 0x4b9c6bd006b671faUL, 0xe6fcc1c6e586c251UL, 0x1de15d29bace3d3bUL }},
+  {{ 0xa4b47acc4c67fca4UL, 0xaf69f802e7c3bd8dUL, 0x397047da72dc1d7cUL, 0x260abfedd07383efUL }},
+  {{ 0xdaa204c29bdfc9f1UL, 0x9b9b477ce048a573UL, 0xcc7f9101cc7c79e8UL, 0x23079dab7655ea89UL }},
+  {{ 0xeb0bea253ba1c4f4UL, 0xfa8067b8b3f08b4fUL, 0xf4a4c2f807a0c75aUL, 0x2664e297519e6f05UL }},
+  {{ 0x088f26da4503cec4UL, 0x6b1708195453a7f4UL, 0xf70973f5b7b9aad5UL, 0x20b7be967166d036UL }},
+  {{ 0xe94530ddfcaf3eabUL, 0xe69043ed579bf4ccUL, 0xb5c1d4a58057edd3UL, 0x18ce5986ed2db64fUL }},
+  {{ 0x768702da509cb1b6UL, 0x577f12ea2e6843b7UL, 0x8e939c92b91cd74aUL, 0x01efcf27c31de3bbUL }},
+  {{ 0x30ac4e99c2959c20UL, 0x66febb5f04778afdUL, 0xf413ba9ae43037c1UL, 0x2b5f21bf0039892cUL }},
+  {{ 0x35709efaf34b702fUL, 0xdb44e34a1e04da3fUL, 0x123df92d2dfaa1d5UL, 0x23fbcac44ff656a3UL }},
+  {{ 0x329c2476e19feee3UL, 0x84a29c5baf5e944eUL, 0x53e9fa2e9f4b4497UL, 0x2b5208d1979f1423UL }},
+  {{ 0x93b4b4faa5805458UL, 0x7f39333aa7a9db6bUL, 0x4da084e60ba89868UL, 0x10c214195a127a62UL }},
+  {{ 0xd57066fcf41531e1UL, 0x6ffbc4f5db339522UL, 0x17240f99eb6324b8UL, 0x1dc94e0032b2c697UL }},
+  {{ 0xca4c17e3349824a0UL, 0x965b9fcb99cb1486UL, 0x6bf8dee14cc55b40UL, 0x02bf8541d1eb5655UL }},
+  {{ 0x94bcde853452c1fbUL, 0x436db36504140e31UL, 0xd5028405a871910cUL, 0x048630818dc9b1afUL }},
+  {{ 0x4afb84a0fa1b2edcUL, 0x5e56f86aad9d7392UL, 0xc71cf98440e7ceadUL, 0x27be4dc950a2cb24UL }},
+  {{ 0x34c6101a312779ceUL, 0x715b5d03407703b4UL, 0x38ec78202def3cb7UL, 0x13f366b8fad90f4aUL }},
+  {{ 0x56083eda475ad55cUL, 0x1b2f78c9b55547c6UL, 0x06f2a515a7aeb270UL, 0x0fb29692ea83844dUL }},
+  {{ 0x48d924532c9c254aUL, 0x69545ad596f27c2dUL, 0x2f1d54e931b4dedcUL, 0x1ca5558c2b4b97e0UL }},
+  {{ 0x1134ccedb01428a8UL, 0xe2b4e327c715acbeUL, 0x030dfae00823d25bUL, 0x250006e06836a049UL }},
+  {{ 0xd5752e008d4991c1UL, 0xfcbe4b9377bc5bc3UL, 0xd2cb07ef53acdc80UL, 0x0363ddb4b1dd8860UL }},
+  {{ 0x75426245e4a5832bUL, 0x6e18b3619fb1b4cfUL, 0x28ff43ecad2abc88UL, 0x304d6c16f14ed215UL }},
+  {{ 0x875239245966fe93UL, 0x91fffc62f82db8e6UL, 0xfd6c645318e406a8UL, 0x25539e0132215b05UL }},
+  {{ 0x3ded31c9e01af55fUL, 0x66cc03ac05358e62UL, 0x2c1abd9043120256UL, 0x140b18f952b101f1UL }},
+  {{ 0x06a9b1d1e3b41f7eUL, 0xae8acaf135117076UL, 0xc52d9777f445ae0eUL, 0x0f886e84d2d9a140UL }},
+  {{ 0xcd48d2903435706cUL, 0x62b95eabafebf06eUL, 0x32dd6ff919be72a6UL, 0x2cf0bd9fcccec5cbUL }},
+  {{ 0x925220699642adcbUL, 0x4293256eee91e7bfUL, 0xe60070720b589fcdUL, 0x10f799ce27b6bbacUL }},
+  {{ 0x89e3ac6bf16efc0eUL, 0x77d97247cf76186eUL, 0x39fe0a391fccb8c4UL, 0x0fcabf52db8a0f78UL }},
+  {{ 0xeba719ab90dab573UL, 0x5d18741816a244c0UL, 0xc10d2459f5009041UL, 0x15244bd5159e6e28UL }},
+  {{ 0x5560ce5249cdbc5aUL, 0xe509f82980290c31UL, 0x1ab7862b5c953941UL, 0x26e67c537b17e239UL }},
+  {{ 0x7cb7312a9d9a698dUL, 0x864131f0848c4e8cUL, 0x71658cddcac85ddaUL, 0x1f2a35320f1d65f0UL }},
+  {{ 0x2548ed3e68d004a1UL, 0xcbe281b72717264cUL, 0x322c8542942b574fUL, 0x042e5df6732a9e96UL }},
+  {{ 0xbed4e8a71efd102eUL, 0x81763e738ec42c26UL, 0xb76ca98a2e1efcb7UL, 0x21151caa522473e9UL }},
+  {{ 0x4b4f4e5c12ce8727UL, 0xa4da862f30ef0333UL, 0x3062c07d3c3a5446UL, 0x2d15d4d5111de3e3UL }},
+  {{ 0x02d6bad3c39b27b4UL, 0x258bab615ec482e3UL, 0x808e71ee3f2aa008UL, 0x02cc5ad7cab6e27cUL }},
+  {{ 0x792ba67f83d91944UL, 0x929dda495196de51UL, 0xbf5df8245bfac4a3UL, 0x23ee3f9ab7f79e09UL }},
+  {{ 0xbcd8f8bb081812c7UL, 0xde478c2006f06c36UL, 0xf3e0295f4d7da079UL, 0x07655a9c51e98562UL }},
+  {{ 0xda7444659aa5ab06UL, 0xfd5952d503256c4aUL, 0x693a022bc6e8439eUL, 0x0d23af257c10900eUL }},
+  {{ 0x81fc592a0185a31aUL, 0x6571dc2fcaefa4e8UL, 0xb63cd937dd011909UL, 0x1c0bff369a6d2e2bUL }},
+  {{ 0xf5d3acc047825ee3UL, 0xb0caa160ca1fd297UL, 0x8a8624990b7f1497UL, 0x0886e9f65d602346UL }},
+  {{ 0xf8f880063570ebcdUL, 0x640754ea6f72e151UL, 0x82f7eacc34a1dc86UL, 0x00961ca28c1de39fUL }},
+  {{ 0xd2dfae13382835beUL, 0x132c9fd34c0b6a9dUL, 0xdb38041731bb8f0bUL, 0x09bff96fe797d41eUL }},
+  {{ 0x3958d4e9e1dd201aUL, 0xec0bb5234249f471UL, 0x0c5064a73c035946UL, 0x0b8d6a36828778ffUL }},
+  {{ 0xe8ccaa51516149bcUL, 0x9743eaef0ab16896UL, 0xc877b385ba9b5cf5UL, 0x204d8f26aab32413UL }},
+  {{ 0x57c26050420d1c0aUL, 0x4104e335dafd4b45UL, 0x2f3ffb8c47d67078UL, 0x20cdace9938f0896UL }},
+  {{ 0xfcb8b39b3cc00205UL, 0xa684e1dfe7341160UL, 0x9d3adf82e062db92UL, 0x10e5f54c22c6e9ecUL }},
+  {{ 0x60ead9d8415a15e9UL, 0x0342b770c226c2b4UL, 0x3e4a05ccf667f842UL, 0x1851554e723dfc7aUL }},
+  {{ 0xa80141894692a3aeUL, 0x19e7b3fd33fa8cbcUL, 0x10f6bf02a43b9d88UL, 0x00ab86ee7b3c53f1UL }},
+  {{ 0xfd70d2d2c36ee1ddUL, 0x1ec695f132ed0186UL, 0x51ebfdc0f78ed630UL, 0x19c9c4d4d03e6aceUL }},
+  {{ 0x60cb335d41b6d3f0UL, 0xf2b5bdf9b4ebdf14UL, 0xdfe3c234d3600729UL, 0x1683e3d1e7488a09UL }},
+  {{ 0xf59f5911e4e81964UL, 0xbeea17b5bdf07843UL, 0x3248143a58bf343cUL, 0x19acce9b16beddd8UL }},
+  {{ 0x94045d2c14553050UL, 0x0e59237896962c1aUL, 0x1bffc3d836231984UL, 0x022eab297597f952UL }},
+  {{ 0x689d14e8d0c90c30UL, 0x15be9072a5efab28UL, 0x15e8dee393be9d7aUL, 0x0fe6572b662d957eUL }},
+  {{ 0x9042d02970a42e3fUL, 0x966b23a524f0ebbaUL, 0x201c9dd202983335UL, 0x002b1c7f7eb8378eUL }},
+  {{ 0x7e9aa86a18d4d32eUL, 0xfa84ea07b0ba28b5UL, 0x951972a68da39f78UL, 0x2be9a9ee080ffa0eUL }},
+  {{ 0xe1fb0494a6171a8fUL, 0x2f3c5b6358ec1e9fUL, 0x550a507c3e80e3beUL, 0x2f25eef8be519842UL }},
+  {{ 0x714d5c8486f6e0feUL, 0x139431a3fb0eda7eUL, 0xb93d09a65a939c66UL, 0x14d52138828f7aa4UL }},
+  {{ 0x15f7a36b4b39667eUL, 0xd21cf80ddb5099a4UL, 0x33e37f365dbe5179UL, 0x2c9b95437eb1875cUL }},
+  {{ 0x47ad10760af0ff7dUL, 0x1b7fd677b8583fe8UL, 0xb5afd4c409d0fbc3UL, 0x2732d7772c64fb8cUL }},
+  {{ 0x47f7557b091a7396UL, 0xf3729d9adbe2989bUL, 0xfe86b47c4d43f498UL, 0x23dbf669169382d1UL }},
+  {{ 0xae88e80d24d39736UL, 0xdaba7091a164804fUL, 0x07cbd3d44e219360UL, 0x0ca31c69277c46dcUL }},
+  {{ 0x415b5c1394b39d79UL, 0x3322b767a2556415UL, 0x63a6f341a2c2b692UL, 0x2d8227dc01c2fe3cUL }},
+  {{ 0xaf65702fa1f48371UL, 0x2f132f2f93d76ad2UL, 0xd9fbd6a7dcdb75d5UL, 0x180c270f214e7785UL }},
+  {{ 0xb16153f862fb0dcdUL, 0x3e8b3abe17052441UL, 0x59f5e6a2b82d7d9aUL, 0x14fa362a7c296b6aUL }},
+  {{ 0x53d453fb2f7e0439UL, 0xfb073b5158e62c66UL, 0x5a6407c8ca7c4d30UL, 0x178db82daab3e187UL }},
+  {{ 0x8b044ad0fa930f1aUL, 0x4b21adebd014d1b6UL, 0x01e4b9f733748b07UL, 0x137415ac9604ff35UL }},
+  {{ 0x346e48dab181aa4eUL, 0x221ed42c4ef2522bUL, 0x563d67d54c04d455UL, 0x2d525ebf02cfdd56UL }},
+  {{ 0xf16e3e88d9b539c3UL, 0xaa5dd88a39c8e5aaUL, 0xdbe76541cdc43906UL, 0x17dc334ed8c73cdeUL }},
+  {{ 0xf82305127d69f015UL, 0x41cac5239714db3fUL, 0x6dfa681aed43febaUL, 0x190fd1526d9c8937UL }},
+  {{ 0xf9aaddf59add5dc8UL, 0x07b377dc59e25d6fUL, 0x116fdd882674bc8eUL, 0x2403d2ac45e7bb8fUL }},
+  {{ 0xf2dc48a52047a4edUL, 0x8f9e5eaa35532005UL, 0x377580707e487fc3UL, 0x161a69ac51a19d59UL }},
+  {{ 0x78b46b0b37033bb6UL, 0x31c88d266bb6ca91UL, 0xaf2eb754408ceca8UL, 0x2e2dd87ea41a1039UL }},
+  {{ 0x289ce425c867cfbbUL, 0xa816b109dae1043eUL, 0xba3f38b52b758a6cUL, 0x249808221e22347bUL }},
+  {{ 0x00c7bee26be70ba0UL, 0xab61e79b8166a0eeUL, 0x1410c5b37b80d125UL, 0x112d5148e656b10cUL }},
+  {{ 0x254949322c62af86UL, 0x9c6d8a3bd6a3d19dUL, 0xeb1df69ffd4c7f47UL, 0x1b9dd19425281e0eUL }},
+  {{ 0x8e25cbbfa22cc775UL, 0xbe2e7e633696fb27UL, 0x81aea250d9702d93UL, 0x154f3cc675b76ed6UL }},
+  {{ 0x62b228c716e62986UL, 0x1f864ee8b7c055a7UL, 0x5786a3db55d83c14UL, 0x0a2aea4f50eea330UL }},
+  {{ 0xa675335447c0c10fUL, 0x05079403fba5b53cUL, 0x4b7358c1426c4c61UL, 0x0ce509543d7e3497UL }},
+  {{ 0x5276ed836d66e581UL, 0x3f0997e29b7cb755UL, 0xefb877a4a1934887UL, 0x083e938063715656UL }},
+  {{ 0xd3cfa3e23f79697bUL, 0x430b558aecf8677aUL, 0x8cb0fe4263d0dde7UL, 0x066e8318b184dc02UL }},
+  {{ 0x8be0ac27b2505072UL, 0x13c20bc129426a2eUL, 0xdcad0e4d64c7d0daUL, 0x01dea64d0775b02fUL }},
+  {{ 0x63d7adefcc72960cUL, 0x81f82b4d73084a10UL, 0x022f8405717a51a8UL, 0x300376d1c13fc484UL }},
+  {{ 0x198ef22bbbd4f555UL, 0x502925d35d55dc98UL, 0x11f6eeedf2f6f482UL, 0x136ed1a657bafbe7UL }},
+  {{ 0xf9b4a736b6fe11b8UL, 0x8d6454b405dfab27UL, 0x18d7fac3837459b8UL, 0x1fe5c34bef1d80f8UL }},
+  {{ 0x4269bdbfeedcf2d9UL, 0x37c202f896fa1267UL, 0x7de349e324b2db5bUL, 0x016b27d23bc91a4cUL }},
+  {{ 0x40ba662cd014cb8aUL, 0xe40f67045ec4d32aUL, 0x10a882a8a830966eUL, 0x1a11eed29a22c4c7UL }},
+  {{ 0x91ff3ed2750f5737UL, 0xaf0ab4059f33906eUL, 0xcc349ebc958a85fbUL, 0x2115b9ff4cd4b419UL }},
+  {{ 0xff33dd6ca5e5cfdcUL, 0x8a04834d2966e5f3UL, 0x3fbb742c6d52fbebUL, 0x0dd1b7d2d744d7eaUL }},
+  {{ 0xc46400c822974344UL, 0x5b0588bc81193959UL, 0xc998666a220e7f96UL, 0x2eae9f85dc7b0f07UL }},
+  {{ 0x7e4a6f1820a30b68UL, 0xd5885209313feee8UL, 0xc15a0e0703a4ebf2UL, 0x1c5f78b958fe3adaUL }},
+  {{ 0xde5a4be11388e443UL, 0x3db48520c14c79e7UL, 0xaa174b25d020174dUL, 0x2700d7ccfbe18431UL }},
+  {{ 0x9f30523e7a72c4b4UL, 0x24f48495414006c2UL, 0xe6b3da54721ccd42UL, 0x06006aace6fb681dUL }},
+  {{ 0xd06de8c1f630f679UL, 0xb8b57cccac17a934UL, 0xce9f0c6fbaa2b996UL, 0x0a5c595588e5395dUL }},
+  {{ 0x5d8a042457f61c58UL, 0xf298a06cc013a967UL, 0x693fdd49a89edeb5UL, 0x2585d75234370d7bUL }},
+  {{ 0x7031482886849456UL, 0x866403b334912e8aUL, 0xeb245883cacd5481UL, 0x273dcd139ea53739UL }},
+  {{ 0x22d6b85dd2f7f821UL, 0x20b424c436dc1dbaUL, 0xd597dfa609635cacUL, 0x23dee9dfb8b39aacUL }},
+  {{ 0x589a91e6c09c6c8bUL, 0x7ca1a4fbf1ac2f8eUL, 0x910ac8421f69dc23UL, 0x198dfbcf948ff27aUL }},
+  {{ 0xba4ab2d42a76b445UL, 0xb2b3fbde36e14145UL, 0xe1d6a6631afb5cd1UL, 0x22c9cca762f27879UL }},
+  {{ 0x9fb42972e82c8fb0UL, 0x78d7e7084350b0beUL, 0x59cedeef4bcbf9d6UL, 0x20a83969cdf4d21bUL }},
+  {{ 0xb26fb70011a64c96UL, 0xd4b43db321d316f4UL, 0xca8334fdedc4c8bdUL, 0x0968818d94af1520UL }},
+  {{ 0xe0d02988da6032a8UL, 0x479b934579aa3b01UL, 0x543900722fca7a1dUL, 0x24478125fc1a9fd4UL }},
+  {{ 0xcf271e7e447e9993UL, 0xc9d6ac58a580c226UL, 0xc00d4bb62460974dUL, 0x25d3cab41e5a1d53UL }},
+  {{ 0x118b25cccb22ebd4UL, 0xa6022dac5f7557ceUL, 0xc7c6cf48198cc04aUL, 0x1dc4595fd7edca12UL }},
+  {{ 0xd05319f588483ad6UL, 0x828a8a12970df219UL, 0x909fda78d34a0acbUL, 0x0c1274d0b6a54283UL }},
+  {{ 0x92cc1fa423ba2514UL, 0xe0e4ac09329451f2UL, 0xc6ede03694b2aec5UL, 0x15f572029ab40b90UL }},
+  {{ 0x800115874f09ff8eUL, 0xb6798fcf6a0a425dUL, 0xc511bf0284a5a2f6UL, 0x2bbff93bd7b0c445UL }},
+  {{ 0x06e9f5d5ba939106UL, 0xc129cd1e6f55ea52UL, 0xa8e8efd42b4c9161UL, 0x095ef7758ad39b05UL }},
+  {{ 0xd3b82fa9e39f94acUL, 0x5255a16a113479dbUL, 0x606f24ea0f0ad07aUL, 0x2ad44c3b2d0e3acbUL }},
+  {{ 0x9ae66840f803dd83UL, 0x047aec382c846fb2UL, 0xba77cbb777b371acUL, 0x21a19bc4a719ed7eUL }},
+  {{ 0xfb9902ea27c1aeccUL, 0x146ce4ce0bf82d52UL, 0x0c988397605d7422UL, 0x155518a71d129601UL }},
+  {{ 0x8fb0ada0b4363552UL, 0xefbca8ef73e05438UL, 0x61f39faefa442911UL, 0x173f26debfe021c6UL }},
+  {{ 0xe79ef3c3dfec9b8dUL, 0x852457f0da288cb9UL, 0x0a9fef81688b6fd4UL, 0x17b8fa4477431fe5UL }},
+  {{ 0x10ac9ec1cdfa0a78UL, 0x9e07eb8cf6e68cccUL, 0x750176b299f37ecaUL, 0x2fb6853de7b6fb10UL }},
+  {{ 0x461d18058266cc47UL, 0x45601308a4dba6e7UL, 0xda62fb718135b70bUL, 0x1c41c07b105e6ec3UL }},
+  {{ 0xdf90673a7112ea07UL, 0xd934f2f43c2890c9UL, 0xed7069f7dbe1b6d5UL, 0x22ba3b2e952ea75dUL }},
+  {{ 0x8fbf060e50059047UL, 0x628a0b3c3195bc4bUL, 0x8402d5c21de305c5UL, 0x28a4cf529f4f441fUL }},
+  {{ 0xe2f76b2cada3ebf7UL, 0x8a62c4ab9d90c8b1UL, 0x86a4780cc82c94e1UL, 0x1df8bfa8b683ae3fUL }},
+  {{ 0x1574499a4ff4e67fUL, 0xd5db54c1b557cefaUL, 0xe5575cd4ebe10a0aUL, 0x043996a7d83b1042UL }},
+  {{ 0xceb1fcedb528513fUL, 0x733ba2c0faf4f66aUL, 0xec8c5f6d6b5df90fUL, 0x2b0a94f402772aadUL }},
+  {{ 0xf74c1609537e5a98UL, 0xbafba3153fb2d395UL, 0x6093e14221958498UL, 0x1d905099c401010aUL }},
+  {{ 0x4f389ce58c6456c3UL, 0x0b4933408649244dUL, 0x74c1cd458da33285UL, 0x26c03eef2b6777beUL }},
+  {{ 0x20b9f2d41f31b942UL, 0x06e3b03336861f80UL, 0x0b0c55649a721d39UL, 0x189e5984fdddc780UL }},
+  {{ 0x25dfeaafb4caf40eUL, 0x9f881c5049d12d8fUL, 0xee9d0325916bd472UL, 0x179604f3063bb205UL }},
+  {{ 0xdc1229f8f6c424c6UL, 0x346bc57d1fed4728UL, 0xedde33424fc9a748UL, 0x2a3d86146e2e4cc8UL }},
+  {{ 0x87d15b86f20d201cUL, 0x31660a5d743d64aeUL, 0x30dbaf426130cfe5UL, 0x196b9a3c6c94d8ccUL }},
+  {{ 0x30fc9018d114a599UL, 0x9991359b7f5c84b0UL, 0x07b5c37ce4a34e33UL, 0x1391be9641d33f01UL }},
+  {{ 0x0a80687c57871ab3UL, 0x8cbd507bc226f791UL, 0x8c396a5133eb903cUL, 0x0e668506e095bd94UL }},
+  {{ 0x45263ab0c4e5eae5UL, 0xcedf53a03c8c8ca7UL, 0x144cb9feeb00e6e0UL, 0x13e168f4dbd65c6aUL }},
+  {{ 0x69c1c11885eddde4UL, 0x9d9e85ad491ad8c8UL, 0xc518cf5c356899c4UL, 0x054d327eb8462a76UL }},
+  {{ 0xbe5009b5637e60bbUL, 0xe44875a9cea4528dUL, 0xe3d20a92dc78fcd6UL, 0x06b5c2caf8866ceaUL }},
+  {{ 0x9495c5b6d9a071d4UL, 0x7af5a2449d219d74UL, 0x806dc6eebde63585UL, 0x0b6c1ed26703fc9eUL }},
+  {{ 0x427b0806867f5893UL, 0xd746b0f8308c5a14UL, 0xa4c081395a9c67e8UL, 0x2adac60158d668e8UL }},
+  {{ 0xc35a9679d9a29cd1UL, 0xfb71ff749ccd2db4UL, 0x83dbca5332671cb8UL, 0x0ce89f29de22f920UL }},
+  {{ 0xe5bd5744ce83d9f6UL, 0xfcf3d2cb8ec4cd95UL, 0x4ca4193235f85a5eUL, 0x2f5fe079f9265965UL }},
+  {{ 0x7ad5a7f70094c134UL, 0x3f17b52682ace11dUL, 0xf43da5621f8c5616UL, 0x0a0c9fb8750bc23dUL }},
+  {{ 0xc63f3ceba823d717UL, 0x92bde383b0028b88UL, 0x4ddeda730b8f54eeUL, 0x23cc7d178443dd58UL }},
+  {{ 0xed709388145eeb85UL, 0xc53aea0b8fb9344cUL, 0x4c3fdfce07216589UL, 0x02f8ded2fb9b397eUL }},
+  {{ 0x63dba299249dc57dUL, 0x83803346da7502daUL, 0x0aad70a1a9a62c13UL, 0x234d637f0559160aUL }},
+  {{ 0xf20deabfcef851adUL, 0x98a43b2b8c689df8UL, 0x8bbc73236bae4f40UL, 0x1ba556e67d54480aUL }},
+  {{ 0xf5a3dd2192c6505cUL, 0x917a8e68f4b75b92UL, 0xffcecab4b8412356UL, 0x0efc89bc64abf6cfUL }},
+  {{ 0xc8552254d81f7e74UL, 0x4a3610aa1c6bebdfUL, 0xf9678274433b3d6bUL, 0x0444f24dae2ba048UL }},
+  {{ 0x85903f7c5c857846UL, 0xfee6d5354fe0de0fUL, 0x5510c7601ca2f7b8UL, 0x1db730ff97f5381aUL }},
+  {{ 0x26585d67bea0a630UL, 0x74b5ecb0cea2b4eaUL, 0x66a1843756b72076UL, 0x0f0e3d87146bfb41UL }},
+  {{ 0x4af1dd8a108703a1UL, 0x3aa7bd00977bef2aUL, 0x7822d26a5a03edd4UL, 0x10a85550b19f1beeUL }},
+  {{ 0x69bc419728358f45UL, 0x136f4e63c2a30647UL, 0x837a26ba711b53cfUL, 0x2c3af9837f4806feUL }},
+  {{ 0x0472855c41178cceUL, 0x0311a80014602e79UL, 0xe42e9c7f6a470fccUL, 0x184601c7b21a909dUL }},
+  {{ 0x6956c5790b6b6396UL, 0x8806c2a54f7ca6efUL, 0xdd923851b3952149UL, 0x018e797e05bcc359UL }},
+  {{ 0xc3da64d024aa0724UL, 0x249a7d025be3099fUL, 0x1de5069ce0a823abUL, 0x2be89f13c8e76f21UL }},
+  {{ 0x0fa56f8384bfc6b4UL, 0x8002b72a92dc4a39UL, 0x748153d8897eaa6eUL, 0x0f8ae1fb9f2d63c7UL }},
+  {{ 0x1b79b745d003bb6eUL, 0x52108b68f1a02e0eUL, 0x8aea570f76b4669aUL, 0x141cbb91f2aa1f73UL }},
+  {{ 0x0814d1e585f645e1UL, 0xe41173d891db9c30UL, 0xa328df65ebbbd5b2UL, 0x212bb4c609b97c91UL }},
+  {{ 0xb308d19e96c0fd55UL, 0xe8495e0bf5a13260UL, 0x7f0d52a26de8783fUL, 0x1b04ac6a132509beUL }},
+  {{ 0xfb780007984dc31fUL, 0xcc480170bf5ca56cUL, 0x304fa88021bf5064UL, 0x0a6f69615f8308b9UL }},
+  {{ 0x4ddb65cd15db6fdaUL, 0x397e75830322d3aaUL, 0xd7e9d20acf0fc270UL, 0x1a774569e1ef4923UL }},
+  {{ 0x6fd5d7300904a323UL, 0x63b835c2cbdf3bc0UL, 0x70a3dc4b7fe46064UL, 0x126b81059692d7a0UL }},
+  {{ 0x2dc073e98d229868UL, 0xfde64e38df26349aUL, 0x9134a5d2fe207ccfUL, 0x2ce18b08fe4538beUL }},
+  {{ 0xe11816e67c1fa905UL, 0xfe3e5ca47475cc2cUL, 0x0b1d80d9b42b6c65UL, 0x2ded9399120a3413UL }},
+  {{ 0x9be21f30de0fe83cUL, 0xa89210ea474dfb4cUL, 0x1b3030977209c196UL, 0x2b83cc8efa95d4aeUL }},
+  {{ 0x02334146651ffd95UL, 0x60a773567104e71fUL, 0xa41680e8ad4243eaUL, 0x08f9da020510affcUL }},
+  {{ 0x8cc0a9fc6311f6eaUL, 0x194b22f0361dd3c3UL, 0x19bf58b3015a7b7cUL, 0x2941baff5d34ddf5UL }},
+  {{ 0xd45396f774a95c49UL, 0x54011b6e6ab79f74UL, 0xdcb546c914164dabUL, 0x3058d6efc4bd1cabUL }},
+  {{ 0xb6d15b9572106137UL, 0x58fd988a75f9ab7cUL, 0x7c489206187b5d19UL, 0x11d513003ff8d349UL }},
+  {{ 0x46e00a057d9cd781UL, 0x1feb37b664156c9fUL, 0xcd55b100c7e61deaUL, 0x070940aaca133e5bUL }},
+  {{ 0x2b77cca76cc10891UL, 0x9e92b4893c26eb41UL, 0xadd273c29ce21b9dUL, 0x25b0c0c8766b672aUL }},
+  {{ 0xb9fdac7d59a54304UL, 0xe027c30dfc104a25UL, 0x929e376c6db4813cUL, 0x07633bfd98f47fb3UL }},
+  {{ 0x4fd552eeceadae39UL, 0x43c8e49b63087979UL, 0x2e9fa37f7a3f3739UL, 0x2b229c3e79e91accUL }},
+  {{ 0x21f0e3e0a47ff793UL, 0x8c58ef7378269723UL, 0x51872fa8b684fc8eUL, 0x1abd67e8e6d03500UL }},
+  {{ 0xb3544165a35c8ac3UL, 0x2fec9a59194aa4c4UL, 0xd2f16df19b03f688UL, 0x1ca9a529b62efc2bUL }},
+  {{ 0x39a725991a555e41UL, 0xa4188e7cd8e33d31UL, 0xc7d19e8108492778UL, 0x2e420c2e1a2b7922UL }},
+  {{ 0x4a673d1b81cf0dbaUL, 0xf9d51296a37a545aUL, 0xc47deb0da49666b4UL, 0x270a2b47cd1fcb9bUL }},
+  {{ 0xb2d6dd4094051396UL, 0x5c4d71b1a048ce62UL, 0x30fb4f532dd6335bUL, 0x231abb325e85a1e4UL }},
+  {{ 0x2eba5d58fa498a8fUL, 0xe199373ef2273ab4UL, 0xada0c2a242eb92b4UL, 0x115c1d61c107d45cUL }},
+  {{ 0x8395d88ef8b44a61UL, 0x3f434892aad49c44UL, 0x544c25753f165c3fUL, 0x0ecb77b45d8dc8a2UL }},
+  {{ 0x56f90270d595c8eaUL, 0xe8fc7857e3fbff77UL, 0xdd56918259d870efUL, 0x2e9ff9e443333e1dUL }},
+  {{ 0x65f7d7e7abb538d4UL, 0x8415d8338724d5dcUL, 0xee2e11c2f8899a18UL, 0x2d6033b98bf35359UL }},
+  {{ 0x75cd0edf258bfe50UL, 0x69474a835ae38fcaUL, 0xd2b3a1a0acc00740UL, 0x1357c7fdbe355e13UL }},
+  {{ 0x3f6a5ff3cf2854faUL, 0x4374ea8f1aedb23fUL, 0x01324ef27447c6e0UL, 0x1d6bce296c12bc50UL }},
+  {{ 0x61f6cc92df9ffa2cUL, 0x82cf6e62a595270cUL, 0xe425b5bdceea9c52UL, 0x15dc58686f7cf10fUL }},
+  {{ 0x869933e54c3a77d6UL, 0x3df60a9ed8002c54UL, 0x4448252213de461bUL, 0x006d8bfca2aa2dc3UL }},
+  {{ 0xfd21268b7b38c2b1UL, 0x2a1b9fb7fa77ca87UL, 0xf66511bf301f3469UL, 0x2de023a2fd7c4d11UL }},
+  {{ 0xafefe26bd82b22f1UL, 0xdeefae69640925ebUL, 0x707c907dd39b0c6bUL, 0x19262d766415c105UL }},
+  {{ 0xd62357a0ec006128UL, 0x77fbbb4601ceedf0UL, 0xae6a55b561f95bfbUL, 0x30436d221145c181UL }},
+  {{ 0xa1763c1151d97931UL, 0x95c72d9ac179bc48UL, 0x2761e1da521328b3UL, 0x0c561179db3c1c12UL }},
+  {{ 0x524cda103c83ffddUL, 0x7e236cdfb7a7b85fUL, 0x4708ac37935046f4UL, 0x257b3bada4f3a904UL }},
+  {{ 0x06acc143836026cbUL, 0x1c780e9e7e1d4a2bUL, 0x0e559d36ad456a8dUL, 0x05c765b37c014fb1UL }},
+  {{ 0xef93b4d8b3ef4474UL, 0x913f8658440c7046UL, 0x1c5708b322a10a4eUL, 0x021ca7e9f6b8c348UL }},
+  {{ 0xf281019ff9c7aaf6UL, 0xb9094414d4f2eb9eUL, 0x5186b48ba528767fUL, 0x0ed7d42593226376UL }},
+  {{ 0x50595da16dc6d4acUL, 0x7efd034a567dc4acUL, 0x9306f9ff65353fe3UL, 0x049017f684a3af44UL }},
+  {{ 0xbe778dbda3bb4245UL, 0x74c3c9e08f7766e1UL, 0x0a0f0c9f476b6d41UL, 0x1b4a3d95509b6707UL }},
+  {{ 0xe5506aac99998cceUL, 0xc1d5267b6ffbb436UL, 0xca10c964f72a540aUL, 0x20959863bdd7381bUL }},
+  {{ 0x969b11662f6d791bUL, 0xd29275c305eda5aeUL, 0x4fb462a144a2bbfcUL, 0x127d27a594985572UL }},
+  {{ 0x5d8bd5e9e3487407UL, 0xb025cbf360c78ec9UL, 0xae4762937598f64fUL, 0x18c5662de65f4c69UL }},
+  {{ 0x3e5b2796621329d1UL, 0xe805fdde17c07804UL, 0x829ca3a61755d94fUL, 0x095414706246067dUL }},
+  {{ 0x32d1306b063d1c40UL, 0x0a273a28656d6e1bUL, 0x9a33ab53cc3a9196UL, 0x0edb7b83330b1646UL }},
+  {{ 0xfc292732695e66edUL, 0xaa62b2c66130dc0bUL, 0xa58e3ce1dc8f8f85UL, 0x05afad09860b61bbUL }},
+  {{ 0x26f6e8e2aad9ee78UL, 0x09dffbf5dd39d96dUL, 0xbff88b33aa0c248bUL, 0x261b5b3a5f31c139UL }},
+  {{ 0x0f807264d648450dUL, 0xb77a1fdc171b8e40UL, 0x0fca04e924f8324aUL, 0x155ad60265a2472dUL }},
+  {{ 0x786ef1eda5a35016UL, 0xab691fbefa415062UL, 0xead2b30d3fd11964UL, 0x1ea2a69bb2956490UL }},
+  {{ 0x31a26b86b0e7fb5fUL, 0xd3f280b256ec5670UL, 0xa00d8d35508467e2UL, 0x30207335cd70fe21UL }},
+  {{ 0x605da099f1e1527aUL, 0xad70a8d1b2dbc6e0UL, 0x5fcc442d97895c9cUL, 0x2e7138569508f1d0UL }},
+  {{ 0xea629407f9e25dabUL, 0x7faa9deec5197fb0UL, 0x23a3fbbd6ca776faUL, 0x21836513e3d8bfedUL }},
+  {{ 0x12f89403608c0637UL, 0x9327f630349de481UL, 0x627876d0cc81c6cdUL, 0x2c53ef5d1e596c54UL }},
+  {{ 0x9b72e1455fc303b1UL, 0xdb461f6be097bab2UL, 0x591fba2a9f87c734UL, 0x244a779b36dd0c88UL }},
+  {{ 0xa35c4c17ef5f6f0eUL, 0x0e3ce9378dd00df1UL, 0x29f25df42ed66853UL, 0x2fc5f1bc5369942cUL }},
+  {{ 0xbce0e822a195689bUL, 0x7022d80c147d9f01UL, 0xac785f5ad8f8fd3aUL, 0x1421bf650a6328a0UL }},
+  {{ 0xb52823eb65a60133UL, 0x62a9ec630600a4c0UL, 0xcd8b9596b9579111UL, 0x23e66157746a84c1UL }},
+  {{ 0x888003a0ad9a751bUL, 0xc685bd58b004d1dcUL, 0x4a9b065921da80d5UL, 0x161a9e5e370fcdeaUL }},
+  {{ 0xc51a4f100a9ad40eUL, 0x0d40afe3956cd0f5UL, 0x9e6d8b66843d7ef5UL, 0x0aab8ca5fe1ef252UL }},
+  {{ 0x1f8d5cb81341ed39UL, 0x2870af4a3defb2bcUL, 0xcd9cd93bea1e82e9UL, 0x26fc677a2349f922UL }},
+  {{ 0x72ab83b2b4af39c1UL, 0xb31f700380ed935bUL, 0xc132d5c5c04e23f4UL, 0x1346fd25bc8984efUL }},
+  {{ 0x1162c81c80075004UL, 0x49f0ff8283673b72UL, 0xa9291cfb6db95246UL, 0x177ca88d6ed38d6aUL }},
+  {{ 0x12f53eee723e54ffUL, 0x3ae0aaa598c72264UL, 0x2d9f8d91b7a56154UL, 0x29674aae6ef85199UL }},
+  {{ 0x4f8014dc58c55521UL, 0x91fe2481467da30eUL, 0xf2b41bd0e4ad0135UL, 0x0bc51992f466ee92UL }},
+  {{ 0xde5fb848116d5976UL, 0x89913c98d5e872ebUL, 0x32c461df38108501UL, 0x21d63243988a90cdUL }},
+  {{ 0x42428dd767049f38UL, 0x55d7f1264c0ef814UL, 0x14762d6e7ad7a076UL, 0x087af7674c3f443cUL }},
+  {{ 0xc40d19ce6e5306c7UL, 0x7df2d39052b765d4UL, 0x577d23839aa1dc5eUL, 0x0a23eabd569bfbe0UL }},
+  {{ 0x6f45d4c7b23d54e8UL, 0x9641f43a3c023ec7UL, 0x317e1843a3ae8b8cUL, 0x2af49a1870972f71UL }},
+  {{ 0x494d757e451213b5UL, 0x6f32acb486537bb1UL, 0x0b26b4caf8dc9863UL, 0x2a35de1186c98870UL }},
+  {{ 0xf44a5b1dc193440dUL, 0x34ba9ede7c697dd0UL, 0xcdbe5bf4e0222c2aUL, 0x22cf6b2b07d20ae8UL }},
+  {{ 0xd77231bf7b09f4ceUL, 0xbfe6c3ee2f61a0bdUL, 0x59e278e6de718ed5UL, 0x173c4577ec1ed13cUL }},
+  {{ 0x0488b9fee77cfe88UL, 0xfafcfbcc62b1088bUL, 0x382fe619e56396aaUL, 0x00dab70642fc9b77UL }},
+  {{ 0x46c1cd8aeef8a1b3UL, 0xd56f78b8f36c7ccfUL, 0x5ed43a9e01c26b8bUL, 0x2421dfe82137c740UL }},
+  {{ 0x362b953d709ad4d8UL, 0xe83e3839474d19a2UL, 0xfe66eaedecc5cabdUL, 0x2abd38940150ee25UL }},
+  {{ 0x0d2b80f1a28dd7bfUL, 0x54c7f2d421e55899UL, 0x88fdc04fc57b7abdUL, 0x27c312b5152d02daUL }},
+  {{ 0xd1498307e6322c80UL, 0x2c6bd9b0f899a135UL, 0xbfbc81f7f4e63a9cUL, 0x259642fded1933a4UL }},
+  {{ 0x913f9432ac1f592eUL, 0x74a94169df834a12UL, 0xaa10b0fe4c30aa3bUL, 0x0aa08106a6d4dbe9UL }},
+  {{ 0x0fe7c95bfe702bcbUL, 0xbee4f0214e766e40UL, 0x19fc3950fd1b9b41UL, 0x1d3953a40bb14d5aUL }},
+  {{ 0x42411bc0a4fa3b32UL, 0x1c790c83f75c9f20UL, 0x879194d3160a3c10UL, 0x1ea0101f9c8d36b6UL }},
+  {{ 0xfd10e7ae7fb17db5UL, 0x470e4269e143f94dUL, 0xc91aea951eaee2b8UL, 0x1784d026429c5698UL }},
+  {{ 0x12bc01dfbfb552c6UL, 0x16d7603ea9a4b9ddUL, 0x1fb57bdb58274c2bUL, 0x0b836a6b06396e77UL }},
+  {{ 0xe19aea75954c7badUL, 0x5317842464b65713UL, 0x6e4b68a8f0e97411UL, 0x03302d7efedd75f4UL }},
+  {{ 0xe583010393ace1f1UL, 0xd8d463dcc0246344UL, 0xa14b676f9def6ebaUL, 0x042df0993a8e380bUL }},
+  {{ 0x8826ca546a84b79cUL, 0x67065127a4eb2144UL, 0xc47b77a909d2ca9dUL, 0x1fd780242539b7b1UL }},
+  {{ 0x99075923eac3f80eUL, 0x07ec2d366b735579UL, 0x37e96a269602c3d9UL, 0x0c21e8470404a0b8UL }},
+  {{ 0x2826ad81ab86bed3UL, 0x0b121e9cbf27b481UL, 0x640fab6c4d8a2cf2UL, 0x165416182d5167dcUL }},
+  {{ 0xe2e43b2747821a42UL, 0xb007f70ad13b34e1UL, 0x6962e94dd3b99793UL, 0x2ab3b06b74926cc3UL }},
+  {{ 0x79ac4e496d646b56UL, 0x95672dfb2e9ecf86UL, 0x2b175f75fc080f51UL, 0x1aefdcf3a50d8e9dUL }},
+  {{ 0x436aef6f9188a414UL, 0xdc4c77b0518b788eUL, 0xec739fe91f56400fUL, 0x2baf3c9265af82fcUL }},
+  {{ 0x47b255864cfeb400UL, 0x5869e9312f678268UL, 0xed069efed6d3503cUL, 0x2615c11236f16ce1UL }},
+  {{ 0x39b4a6e3c916900dUL, 0x3ec10933fe4a26f9UL, 0x27c0d6993f68236aUL, 0x2cc38b0c22916bb8UL }},
+  {{ 0x0405416392fd0c79UL, 0x8110becf40a41597UL, 0x6413ef2adb7fec7bUL, 0x2fc55f9e536bd244UL }},
+  {{ 0x68bef21ff649a498UL, 0x0b12efdb4511820aUL, 0xfbf4631dbbdccc3cUL, 0x271a089a50f56e81UL }},
+  {{ 0x2b72659f9ffcf700UL, 0xc7a9898ca39ca409UL, 0x02fe1b8b888a029dUL, 0x02d29e5f67de2484UL }},
+  {{ 0x1d51d77d884e0221UL, 0x032f5adfb7df5766UL, 0xc6c9153458d573c3UL, 0x1dfbbaddade7b6b2UL }},
+  {{ 0x218143637693547bUL, 0x4db3e4c12313ed23UL, 0xb97b65ceef2992eeUL, 0x20f1b45626bcfedeUL }},
+  {{ 0x63bc92d8b9a4222bUL, 0x24d844b299d4f2edUL, 0x7153e7fd8f2c21d4UL, 0x12405d4b6cb7abafUL }},
+  {{ 0xf850059842454edaUL, 0x64cd043fd3cb9239UL, 0x9ca618c38c69c4f4UL, 0x16927043c6c14372UL }},
+  {{ 0xe18de1c92d751c2fUL, 0x72c8a3979f6d6451UL, 0x7f1d06cf5ce669ebUL, 0x187a3bd9ace1aa96UL }},
+  {{ 0xdd769fc4be053d0aUL, 0xed334635c2190999UL, 0x9c6b0adaf826226fUL, 0x2ac25accd866759bUL }},
+  {{ 0x9e197672594c2c10UL, 0xf115acf5f308ccf3UL, 0xdb8906491974a87dUL, 0x1dcec9614c0ae536UL }},
+  {{ 0x5aaed270ce71107eUL, 0xd3a88b8fd2b14114UL, 0x87520b922b49012fUL, 0x1f27abe7e2e74e22UL }},
+  {{ 0x1158d1062b1a37dfUL, 0x6bd507d91a9dbd37UL, 0xf201648e5aed7c47UL, 0x2eab102a882cb6a9UL }},
+  {{ 0x593e9ad7313fee0eUL, 0xe9fe01a0ebe4776aUL, 0x02070afee7d36e80UL, 0x20003d1d6a3db002UL }},
+  {{ 0xdaba29fe4f862db8UL, 0x3159c759835f9b18UL, 0xbccc6a1843b85e7fUL, 0x239e602329c5318aUL }},
+  {{ 0x83cae8ed3d717233UL, 0x141ca60bc82f2a3bUL, 0x39383d5d4d045e61UL, 0x1db70d9c1cf0b686UL }},
+  {{ 0x644e128bf23c6a4aUL, 0xfc31ad4b4690c10fUL, 0x45c781c2bf2a1f12UL, 0x07aa8a55335d0edaUL }},
+  {{ 0xdef85a23522a5d96UL, 0x43a6fac8b4a99e9cUL, 0xb4a6f371bb30d361UL, 0x08fdd03f3e02be32UL }},
+  {{ 0xe49bebd20fda4bebUL, 0x484e0d19ba8b785fUL, 0xb0bef58c78b9fc90UL, 0x0397e3521bea16b4UL }},
+  {{ 0xcdce59ad98977c8bUL, 0x0497fe793d138a5aUL, 0xc02d0ac502caf4e1UL, 0x2c848f0f072d7ffcUL }},
+  {{ 0x596e2685a8dc1733UL, 0x98ec2a03b159695dUL, 0x23359521115b4bdbUL, 0x138ead1a030cd373UL }},
+  {{ 0xcc365d125b6eddfbUL, 0xd048d56e64d28ef9UL, 0xd7d09460a53d306aUL, 0x0f4744a8657b2294UL }},
+  {{ 0xbca15bea4f7f329dUL, 0x437983e363a724e5UL, 0x3f86ce559b403bc8UL, 0x16c37b45f9e412a4UL }},
+  {{ 0x332492b8507ae71eUL, 0xfeccaec5c3968218UL, 0xf04925d68bb37cadUL, 0x04e465dbebd44d7fUL }},
+  {{ 0xf4eed8ad3314f2c9UL, 0x14ebe9386ccfcde8UL, 0xd6f520ad483e2a53UL, 0x1619e8ae23782b91UL }},
+  {{ 0x70c9ad2f0d2a5081UL, 0xe23215b1cdcc46fbUL, 0xfe2dcb3071a30637UL, 0x0ed3cf124b8b8b88UL }},
+  {{ 0x8162f96836ba00cdUL, 0x528de1330a887377UL, 0xe6980219e3279a55UL, 0x2f8d121c1a422f22UL }},
+  {{ 0xb1379c336ea7c250UL, 0x8a2011f0bacf6cffUL, 0x09e09e36f7afd7feUL, 0x25f47fe555b8e816UL }},
+  {{ 0x5e3c1821f6fd8889UL, 0xa9f41b5fefcbc4e5UL, 0x9e9766460427479fUL, 0x1362908ab2a569f3UL }},
+  {{ 0xc2f1f44d4daa6a70UL, 0xa9fd60d8860c2a7cUL, 0x7d9878c5e9f8c5acUL, 0x138d7982a6f81479UL }},
+  {{ 0x4ada211c071e036fUL, 0x12c235f0c5bdbe5bUL, 0x82bc0ab3c0837dd7UL, 0x00aa5ab82f976569UL }},
+  {{ 0x6c24c6e31d0a1c5cUL, 0x18e7e39dc1c9befcUL, 0xf4f2235748bc69b0UL, 0x26c647709a8a338dUL }},
+  {{ 0x8fcbb67ca9b44213UL, 0xc8935e8159034f8aUL, 0x0d4607a7570db9cdUL, 0x05e90e971eed37adUL }},
+  {{ 0x40ba6c5efcd4e663UL, 0x1743b53386584390UL, 0x3c44d5b2d880c794UL, 0x1ea21024b9260927UL }},
+  {{ 0x5c752b51908ac3c9UL, 0x4e897981dd85ecd1UL, 0x9c480c391adeec9aUL, 0x0594acabc2f58443UL }},
+  {{ 0x02a17ded786188afUL, 0x4b94f2666755daeeUL, 0x0a689b2f68af1792UL, 0x0bb23f1a37a98828UL }},
+  {{ 0x211827a99cd8fdcdUL, 0x0f6abb435f5f1e8fUL, 0xda3c9cb7659e4545UL, 0x26caa25fdd7886a1UL }},
+  {{ 0x9eeceac2fe1ef385UL, 0x400d2d11fc7ee637UL, 0x3d32b7130baada3aUL, 0x2ff1cbfe04b70d67UL }},
+  {{ 0xc3a45bdf9150b066UL, 0x00a70043de7fc63eUL, 0x998888b81908876bUL, 0x2c14bc2d4e25195bUL }},
+  {{ 0x77ffb84e27e84b5aUL, 0x0535b6bec1694d90UL, 0x34335b8c65d07907UL, 0x1382ee49616f1674UL }},
+  {{ 0x0deef7259b3390b3UL, 0x23eaa984da540be8UL, 0x1b2b889dca82294cUL, 0x19443528b4024c48UL }},
+  {{ 0xbb565c6a878d402bUL, 0xae415f71c44dad47UL, 0x8861df5b3ee18a8fUL, 0x00f2314dcbab748aUL }},
+  {{ 0xc25c9621a5a1a950UL, 0xe62791cb7bc7a4d4UL, 0x8df2ac46f809e33aUL, 0x21759aa1f4084e34UL }},
+  {{ 0x9fa6abb4ea8b652fUL, 0x70c02831bee8bd87UL, 0x69fbe88770fd225bUL, 0x25df6caa8083c062UL }},
+  {{ 0xbbaada0fead6b255UL, 0x71e3e249382c6144UL, 0xd15580ebb9aa66cfUL, 0x25066085f68cbe5dUL }},
+  {{ 0xc5fc7aabdf75bfe7UL, 0x8d272739f0205610UL, 0xf4980c2cbd16b012UL, 0x11f094643e9df24eUL }},
+  {{ 0xb9792b37e2d1e533UL, 0x024639f34aced30eUL, 0x5f40919c606d1498UL, 0x03933206afebc69fUL }},
+  {{ 0xc88e41ea14693aedUL, 0x10f9fda150a7f954UL, 0x26f8cc9e834827a1UL, 0x03eb693dbd9cba2bUL }},
+  {{ 0x634d1bad55be6e5aUL, 0x4ea3471dd9449b66UL, 0x6c37a273c8144a16UL, 0x01b68544a1793968UL }},
+  {{ 0x560a95aa36cffe5dUL, 0xe80c2bfefe80c81fUL, 0xbccefec908dcf55aUL, 0x228d1066e6f4051aUL }},
+  {{ 0xf9cc92843a17cadcUL, 0x5ba23ac658af0451UL, 0x8724ccdb39d578a8UL, 0x2dfac814b9b6f0b7UL }},
+  {{ 0x4f002c9a5e6c7400UL, 0x7f57eeca3271712dUL, 0x369aea970b7f5db1UL, 0x0328ca1953eb61b2UL }},
+  {{ 0x7ff3b6d2740e1821UL, 0x82c01eaf085882a0UL, 0x75ebfa598fbd15a9UL, 0x0b9929eac71179e5UL }},
+  {{ 0x377ecae3862e0739UL, 0x624dff2ad61c7d1aUL, 0x0381a20bef1dcdf4UL, 0x28c5dfa190a9899bUL }},
+  {{ 0x13f389582c12d3dfUL, 0xf2d3a597bcfb1762UL, 0x797761afa1959649UL, 0x00d22b484d2b53d5UL }},
+  {{ 0x34e39846dbb7085fUL, 0xf34bce812f4af7feUL, 0xfb7ea6eff7558d6dUL, 0x1281189bc2af68b6UL }},
+  {{ 0xdc7ff3a4d4823891UL, 0x48f90f04b618ef18UL, 0x2340ea09659a063aUL, 0x1e8fc6ad42545352UL }},
+  {{ 0x87e18a80454353bdUL, 0xa200ec51e6f977f9UL, 0xe66cc51273770760UL, 0x1aad4a29e292168fUL }},
+  {{ 0xf1370ffecc580604UL, 0x051eeba9db34e1a6UL, 0x6fe963c27156e4b9UL, 0x2c28b4a576859beaUL }},
+  {{ 0x4fc20ae2049a51ffUL, 0x8773bf5004d1925bUL, 0xa468507fd5bb38f2UL, 0x1a2f2a4a10405e77UL }},
+  {{ 0xd7b06b3047471cfeUL, 0x0e6a4efdbdac1affUL, 0xa7ef2dafb231755cUL, 0x225eb36260440a65UL }},
+  {{ 0xb229bbb7fdf52fc7UL, 0x94d7fb7db81b82dcUL, 0x15d432ac03b84775UL, 0x23ed29d6a33d0ee3UL }},
+  {{ 0x719f7810f9127fb3UL, 0xad2a43925a9df5ffUL, 0xf1d71fd90dc2d3e2UL, 0x1fcc28bbe3caa270UL }},
+  {{ 0x0ac81db417349606UL, 0x86b569eb2ab7e727UL, 0x7f28aa3c4f8d3d9cUL, 0x1ed2517fcf619003UL }},
+  {{ 0x7122540e7489ba89UL, 0xb5ecd3ca4fdb93e6UL, 0x0f7e54f63a344b4bUL, 0x2e55575ef12b3ba0UL }},
+  {{ 0xe9e70838cb1d817aUL, 0x4c79cff26f059340UL, 0xe3ac070da037c20dUL, 0x11b63a944f2f8f2bUL }},
+  {{ 0x55cd9449b90474abUL, 0x1cb63132a98de253UL, 0x058a9f516288bc13UL, 0x2f7f8187e225617fUL }},
+  {{ 0xd9193187272623b0UL, 0x49b87deab81b8396UL, 0x4d4a5e292bc3faf6UL, 0x08720f626f56472cUL }},
+  {{ 0xf55e6ef3e63b7ebcUL, 0xf70dec1818409724UL, 0x1f3d5c33574eb63cUL, 0x10a4db2584cb9905UL }},
+  {{ 0x15cbf8261df7ea05UL, 0xef4b1a92b91d095bUL, 0xd8134fa38110843fUL, 0x06d048313cb7d0a5UL }},
+  {{ 0xb5bc972cd085e96fUL, 0x4c933084a56579b4UL, 0x9739d27ea60c57a4UL, 0x1822a2d05df1e53fUL }},
+  {{ 0xbbeed15fd2d64403UL, 0x5f9aef0d1e4e2713UL, 0xd7c497196868ee7dUL, 0x1aee2e7134d30756UL }},
+  {{ 0x5f23c37570c899ffUL, 0xf642ca368469b7bdUL, 0x1dd662a30eba544eUL, 0x08b17d520f3f6354UL }},
+  {{ 0x07abc483845c22aaUL, 0xf7ffd7e45cfd9100UL, 0x8da8df1a88210705UL, 0x0c8dcc8ea2284e23UL }},
+  {{ 0xe80f2f9fc78f0e7bUL, 0x471ff2ba7a6f9c85UL, 0x55756554cfeff3f0UL, 0x1b46eb10f5c1b321UL }},
+  {{ 0x97000b44181f15f3UL, 0x58323c6871a7467dUL, 0x829fff9667f5ba3eUL, 0x192d0915a1593efeUL }},
+  {{ 0xe9d945b8beca05e2UL, 0xd39adbfa5dec17b8UL, 0x6099aeaa0b1df485UL, 0x15fd9ae9021de946UL }},
+  {{ 0x97f3d36b5c96f436UL, 0x23d08129e682ef3aUL, 0x89bd433143f94fd5UL, 0x13f8968b53fb48f5UL }},
+  {{ 0x5ef5088e0a8266cdUL, 0xf13d81521f7a6720UL, 0x6c913a3acad263e0UL, 0x2a8a577289f0f165UL }},
+  {{ 0xbcda84d267f687a7UL, 0x814e533aa46c26b5UL, 0xe3b2379042e6ec1cUL, 0x1ecf80e70c8ec88eUL }},
+  {{ 0x7c7c180994dd6e52UL, 0x4d6aec3a3a3c969fUL, 0xc92ac7893bd9fa06UL, 0x1c7e429df0ee7121UL }},
+  {{ 0xb819dc71a6f00c05UL, 0x84be39f36d79d4a1UL, 0xa224e165d64072faUL, 0x0da48e491901ebe3UL }},
+  {{ 0x5279217e3c923ec1UL, 0xcf1bcf6e1359585cUL, 0x1a8ec58be3b18b01UL, 0x2fe089ad720a18e1UL }},
+  {{ 0x06d44feed63ae4b2UL, 0xc30fece3de1175c2UL, 0x83151cdd35ab945cUL, 0x0219ed4c306688afUL }},
+  {{ 0xaf7f56b2ce0f28ceUL, 0x51e215439010f444UL, 0x7ca2a68df4957320UL, 0x0098822c976d1c6eUL }},
+  {{ 0x394dba6bcd11f922UL, 0xd6d43f5072c1b0f1UL, 0x9ae478c47bbdacd0UL, 0x2f4b45b98e180f89UL }},
+  {{ 0xd5ee135f8661b24fUL, 0xc4b522b0cfdde676UL, 0x0063f6884b8ea40fUL, 0x10e619214c005540UL }},
+  {{ 0xf491fae7859df0efUL, 0xcc45833883e9efd8UL, 0x49ac2aa331e1e211UL, 0x205b3666937c9373UL }},
+  {{ 0x40aa1c719af8f4edUL, 0x07581159e221c7a9UL, 0xb5794729719b81d6UL, 0x00ebc6f59c9493c3UL }},
+  {{ 0x7c556bf0ad650b02UL, 0x7e6bd1f93d5a07c1UL, 0x3ab80225bc7fc550UL, 0x0e1433f72a650638UL }},
+  {{ 0x0fc9731a5e0d17f8UL, 0x697b20cabb581ba5UL, 0xf24236792c9cc44aUL, 0x084447c72616c7d0UL }},
+  {{ 0x37011a38b6036527UL, 0x95788b1f52b7424eUL, 0x848ebc092300955dUL, 0x1ef520ad73596b23UL }},
+  {{ 0xadd2f9d365e5d83bUL, 0x876dd7dab30343aaUL, 0x3dfa57f2cb8847e3UL, 0x24df032596b25a27UL }},
+  {{ 0xc4f65f1715564eb1UL, 0x91aff33c0fbfbd96UL, 0x4187dcbd528bfba6UL, 0x21b2b0a5bcbbe5e6UL }},
+  {{ 0x7b2025aa07887dd7UL, 0x18670f7bf0d62c69UL, 0x6362990fbfa64ea3UL, 0x10e55f259d465936UL }},
+  {{ 0x06d6e523c01c40c1UL, 0xdaf2d61008a3d8b1UL, 0x90a82b4fbfdec4faUL, 0x178fed52583c99c5UL }},
+  {{ 0x215082f97f13edf0UL, 0x339b65189a39880bUL, 0x4b8b6684edc274cfUL, 0x0591c386ad273c5dUL }},
+  {{ 0x8913a44c37eff0c2UL, 0x2b8ae215df3e0108UL, 0xa15643cd5dcbb609UL, 0x0e934deb24e75d13UL }},
+  {{ 0x7d5d59c713091d49UL, 0x7c91a30f9ee3786eUL, 0x3446d83a9a3bd13bUL, 0x2628fba3bcabb67cUL }},
+  {{ 0xab0537ee805a88feUL, 0x5e5a14e08d8f1372UL, 0xc1460a3560e3244bUL, 0x18d754ca9c7189beUL }},
+  {{ 0xf4113c6b9b80b728UL, 0xfb74898851b2f80eUL, 0x03e3e57332892ccfUL, 0x14e4d16d1f7236a6UL }},
+  {{ 0xa19ce1ffb0870baaUL, 0x4a8ea6634863cacfUL, 0x653bed08c01b5c6aUL, 0x01c7bf3ecebf975fUL }},
+  {{ 0xb4aa41583acaf60dUL, 0x6d2e6764579d277eUL, 0x94050e6d854816ddUL, 0x1d7f48a3adb6338aUL }},
+  {{ 0xec3df416199a7c3eUL, 0x840d6be759c83853UL, 0xfbca7242a4b58d81UL, 0x0c53a7d919986b59UL }},
+  {{ 0xc36031fd1f93e9d1UL, 0x26c4f0588293cf33UL, 0x6c627d3e416d4fc9UL, 0x1613fac528df5dabUL }},
+  {{ 0xda7f332dd42db7edUL, 0xa35df5fea67d9f4bUL, 0x1592c744da0c398bUL, 0x2cf6f98fdceb6b0bUL }},
+  {{ 0x438685970a793db6UL, 0xdd182c6b951de073UL, 0xa196ad2d8dd4084fUL, 0x2f7e176539fc2f43UL }},
+  {{ 0x1da26a0b42a16831UL, 0x988b698e6ba6eaeaUL, 0x833d87fd5a7390c8UL, 0x2c2a80d952e07dc2UL }},
+  {{ 0x532fef7c02ce468dUL, 0xf518e6c755569e18UL, 0xaa7fd3b6c57046d1UL, 0x20d84c377d72b51eUL }},
+  {{ 0xd1936ad05bf51a1bUL, 0xd0ddda9ce8d09e32UL, 0x20df44ef8b5a9b0eUL, 0x1b24f8d4762419cbUL }},
+  {{ 0x5814bbfcb21d1b38UL, 0x795e1c501b54f367UL, 0xc7579396f1f64592UL, 0x023402fe0a98e011UL }},
+  {{ 0x92c2ec8361ce480cUL, 0xf7302cadf86a7697UL, 0x14fe10d343db61ccUL, 0x1cc1537c28720aceUL }},
+  {{ 0x4314722ce1c590b6UL, 0x73ac3b1626c98189UL, 0xbdf24c4fb0281513UL, 0x2733eed1c88b99e1UL }},
+  {{ 0x5af00142352cd4c4UL, 0x59f4d6d61330208aUL, 0x47d200da01b2ae7dUL, 0x2278f546de411821UL }},
+  {{ 0x735d2c588163be6bUL, 0x2c3e416b6d7efdcaUL, 0xefdc28f10bbf2487UL, 0x29b55f3e8eba0c2dUL }},
+  {{ 0xdfb22b7f19af7ba3UL, 0x64f797f172526d6bUL, 0xb3a1d12f105bb6cdUL, 0x0be33e8b84171e95UL }},
+  {{ 0x6398f8dad8179b64UL, 0xe16c7ccc43350f44UL, 0xb6dd76e22a44202dUL, 0x2547455e858ef6cdUL }},
+  {{ 0x6de34147218a3e99UL, 0x4a7d4a61af11de63UL, 0xdaf70b9a79b5cd0aUL, 0x0f5797bb482d16a0UL }},
+  {{ 0x3ffdf38294fe8361UL, 0x23b2f14b814b16b9UL, 0xd3472e70a8447838UL, 0x1e677f0e7a54bd5cUL }},
+  {{ 0x8ec8ea958c6c155fUL, 0x7ea97252ba8cbb72UL, 0xc606bc4e6e6d49b4UL, 0x05820af6aecdfdebUL }},
+  {{ 0xde523d60993db84cUL, 0x38a925ee46b5f573UL, 0x68d11269309d5274UL, 0x2716a77c39610f67UL }},
+  {{ 0x237d7880338a0639UL, 0x5b4bec70afdc385dUL, 0x763bda4963a53f63UL, 0x20b55e7447b353ceUL }},
+  {{ 0x642baa3102bdfc46UL, 0x9e7bc8cdece718e2UL, 0x254dad16e2251d56UL, 0x0ec3abcd95bec8aaUL }},
+  {{ 0x7e48902c017012b7UL, 0xbc9d827a73a2ae0dUL, 0xdbf151b7eaf9e2efUL, 0x2d959696566150aaUL }},
+  {{ 0xd94d07ba66748a5fUL, 0x72f3eea21668437dUL, 0x2ab9c18088e2e50eUL, 0x0dfccb04f63fcfe5UL }},
+  {{ 0x07ca9e0a9b75655aUL, 0xcd3aafc763ffb447UL, 0x7a3b52439cafb184UL, 0x02c7d53242a7c75bUL }},
+  {{ 0xc0b52c00fd0757d5UL, 0x0f21413ec55331f9UL, 0x1912881e319f645bUL, 0x041c605d0f142ce3UL }},
+  {{ 0xda284618d059d9cfUL, 0x1991b04f95912a02UL, 0xc105a3f3f49cdf5dUL, 0x13ad99b378139942UL }},
+  {{ 0xaa12550cccbb1974UL, 0xb8f6c8e6beab0868UL, 0x5e221124c61e9623UL, 0x262bb22bd4c2d841UL }},
+  {{ 0x4ae833724aeff7beUL, 0x8784cd25f852195dUL, 0x7d9544b2a34de877UL, 0x115e3af409515925UL }},
+  {{ 0x977632616e359f2bUL, 0xcc4662ea41526447UL, 0xd97facd78d950e8eUL, 0x29c1ae7aa61d74acUL }},
+  {{ 0x7b44318da173bfe7UL, 0x057bebcc7aa0b4cbUL, 0x5a0a992468bd38d1UL, 0x190766b71705c96aUL }},
+  {{ 0x9e7fe530756e3c5bUL, 0x5581dc0e8fb9ad51UL, 0x330a86b401af8d28UL, 0x09b76469087d3bd2UL }},
+  {{ 0xfebc96f44c438c45UL, 0x65d8adbe5bbc53e1UL, 0x611798dcc2944639UL, 0x1ec4294aafb553a4UL }},
+  {{ 0x794107eac4030c46UL, 0x06c4fbcd93031e33UL, 0x853ed27e5a5de837UL, 0x06ea5309c29266c7UL }},
+  {{ 0x83a5923ad6994f53UL, 0x125699b747d2bd01UL, 0xe5c6d0daba34e08aUL, 0x204c35048163d95dUL }},
+  {{ 0xd120ec6ca11613dcUL, 0x0959f54130fd2abaUL, 0xe060ea29101b3850UL, 0x10500db8f2f5d051UL }},
+  {{ 0xd7b85e5727fbc294UL, 0x2ae3af9f382277aeUL, 0x1a11d83eff3a52f1UL, 0x0d8e3fb762f03207UL }},
+  {{ 0xfcc8468591028ae8UL, 0xa6d2f20fa246c1d9UL, 0xc14cd13863913e9dUL, 0x1653abb41b8c711eUL }},
+  {{ 0x233fc8c478df3d41UL, 0x9cd0e990559817dfUL, 0xff3dc1350d949d02UL, 0x2ac70bb395d6563aUL }},
+  {{ 0xa82833538c0e1a20UL, 0x934fcc5a462410d7UL, 0xc3ff0dd16098c0e8UL, 0x2f72832dfbfa38abUL }},
+  {{ 0xdf9a7f76883374cbUL, 0xf55f55d327d17f4aUL, 0x98df8c204f49ab45UL, 0x279c3c1f2dbe2293UL }},
+  {{ 0x3f2efe5e3ff8f0b4UL, 0x057c8be61af75e34UL, 0xaecb9e14ef2d657aUL, 0x213e77be1c44b6d1UL }},
+  {{ 0x38bd62cd941a6488UL, 0x055b1fb24448201aUL, 0xcf4d4c7928bfe2b1UL, 0x0b201ff9ba86997cUL }},
+  {{ 0x44b4093c42061e53UL, 0xed700ceb82c4faa6UL, 0x68afc3726d737d89UL, 0x2f7806447ba87346UL }},
+  {{ 0x4b0270f9c6e1b8dfUL, 0x642faa66586cb33dUL, 0xeb27ff00202a8d96UL, 0x0750c279787e9aadUL }},
+  {{ 0xb3d2a07298ea31d7UL, 0xb0f0d9bb3abf09d8UL, 0x8603aa153994bd8aUL, 0x066de10ba72c5473UL }},
+  {{ 0x0ddeb3bea0ea1c7bUL, 0xc6a2cb101c732000UL, 0x0088eb94839dc6feUL, 0x098ce8b74b67f3e5UL }},
+  {{ 0x3403a13d38d30189UL, 0xfe527bdacc58434fUL, 0x160fe1a565a6865dUL, 0x01c98a5c403d3253UL }},
+  {{ 0x3eccc9d31e204e5fUL, 0x6e7865724ec2ca94UL, 0x1aa03297093dfc57UL, 0x21eb663657d9fa48UL }},
+  {{ 0x086197d363ef9dc3UL, 0x89d8d9b066ee8fd5UL, 0xe174f53ab740d76bUL, 0x01e54474b3d5ac5dUL }},
+  {{ 0xc7ad06294465c513UL, 0xdadfad82a24c4964UL, 0x2b45bd8f3b4b1395UL, 0x201a9e11ecf74fb9UL }},
+  {{ 0x1e85b208d2c58ef5UL, 0xe6120c263d6bff00UL, 0x6ea0b4b6b3eaa434UL, 0x1ba94a3be3cb16dcUL }},
+  {{ 0x8dc83a82d9fb063bUL, 0x4f7b18e0f8e5730aUL, 0x883670b1c4132400UL, 0x01828d9472d31ae4UL }},
+  {{ 0xda61c8dad2b83a73UL, 0x7b393330cd6a0b00UL, 0x9b23f6917c71ea73UL, 0x2d71ccd5295a6075UL }},
+  {{ 0xcfc44fe52b1939a5UL, 0x1944d7cc0697ae45UL, 0x3d45c24f8ea5f7f3UL, 0x0d57a94379966a82UL }},
+  {{ 0x3bcd7e74e3a192fcUL, 0x4d19cbec80cb1c2dUL, 0x140ab4d9eba8c985UL, 0x2fbb9812df73692cUL }},
+  {{ 0x9a6cc4df4d7c05ecUL, 0x39905ea5719c368aUL, 0x863b1c75998c989cUL, 0x060434af0094c52bUL }},
+  {{ 0x2873936f5e045dddUL, 0xa2ca5bd6056d8d7cUL, 0xcf6bfc79a5be5490UL, 0x0d4b5b7fc99ef400UL }},
+  {{ 0x69fc60fff32936f1UL, 0x39bf6e8a191a82b9UL, 0xe019a3e74e56ad74UL, 0x1c47931b33b0fd4fUL }},
+  {{ 0x12aeae54451885eeUL, 0x54c4d1968723f16fUL, 0x2bd33d7d2993b719UL, 0x2e7160a69a3f1989UL }},
+  {{ 0x882bc1d30ff7bb07UL, 0x093cae8ed64d614eUL, 0xab4bd37f8112924eUL, 0x21c71e762b65fbc4UL }},
+  {{ 0x3e34437a95a1f5a6UL, 0xc0b96efacc52e6b4UL, 0xf3bd0493698a5f29UL, 0x300f3ef6a0a0dbfeUL }},
+  {{ 0xbaa19cc3be512c8eUL, 0x57b2e6dbbd0c2584UL, 0xa28cd27ac39b2e68UL, 0x29be7808004e1169UL }},
+  {{ 0x652cd09f1d9abcf8UL, 0x76e1bfb7763725eeUL, 0x874b887dd71ad858UL, 0x06fdc34d4624acacUL }},
+  {{ 0x0943b2b7c9fa8998UL, 0xc52fe07d3769edf2UL, 0x5baa86594637d95aUL, 0x08e71a8d24982845UL }},
+  {{ 0x4c18da9286aab2bdUL, 0x160f851b7b2ff2a6UL, 0x8b38d9ada695caafUL, 0x1c59a887735331e2UL }},
+  {{ 0x2788d7dd06bc8045UL, 0x3115450a8e89a97fUL, 0x35cee1876a8180b8UL, 0x0918bdf2205dcb70UL }},
+  {{ 0xd16c0cd3a68953a0UL, 0xa0871aca667a894eUL, 0xe8edbfc424599f3dUL, 0x2dacf1fa0e4f5853UL }},
+  {{ 0x2a63a643398ca188UL, 0x4b16c7c1e0339426UL, 0xef6c5a754abd7a6fUL, 0x0ffc6ba36838eb39UL }},
+  {{ 0x514c413e3d144f77UL, 0xd13a7d0fb803242cUL, 0x2dc2ea5ae0cc61f0UL, 0x134f80ced1cac35fUL }},
+  {{ 0x0aa20e953c4770bbUL, 0xeb3e796d6ecb0c58UL, 0x7e2ad14132177576UL, 0x23c87644f0f719e6UL }},
+  {{ 0xac8843138b65d565UL, 0x49e860ddfd79b55dUL, 0xdd999b77d171a527UL, 0x28d85782a52c64e1UL }},
+  {{ 0x67873f73ff0f4325UL, 0xd75be963e6bc4750UL, 0x58cd818c834c686fUL, 0x099859089e2c1274UL }},
+  {{ 0x6798414a132e5186UL, 0x804daa08a76798feUL, 0x82dd54921547762eUL, 0x03265b29f1f463f5UL }},
+  {{ 0xa80d972a5b3fced3UL, 0xca66479d2fdabaf0UL, 0x160497cdf134dc6bUL, 0x1dfc2500cfc77143UL }},
+  {{ 0x26a7200ea980b801UL, 0xb1b3ec753cffa2ddUL, 0xd435283a094373efUL, 0x163d895f8a652f9aUL }},
+  {{ 0x080532743e221bbbUL, 0x37873cba84fd1b47UL, 0xd0aeb54f898da339UL, 0x0ba88f1a6629cfc9UL }},
+  {{ 0x46ac345e5935b77eUL, 0x02f6a6be7330f417UL, 0xc75e104147551a6bUL, 0x13c8795b33529ed1UL }},
+  {{ 0xd7ae61adefebc488UL, 0x98a719a236dd1690UL, 0x3fe4dd485c7b4615UL, 0x28ce252920944b02UL }},
+  {{ 0x6c49456665a5b3d0UL, 0x3f1030adcfce7c55UL, 0xe8a0f709a3ffcdb9UL, 0x2d8a20c6d822c149UL }},
+  {{ 0xf3ed4d3fdd132bc3UL, 0xc269d41455d48701UL, 0x33c0b52b89eb46abUL, 0x22df63e4a482f64eUL }},
+  {{ 0x7229233499ddb773UL, 0xce3872b04722b4fbUL, 0x70575184c80d2864UL, 0x1397c0213e90f8feUL }},
+  {{ 0xd0177810c6639bc6UL, 0xc377bf2ef0a4e480UL, 0x4d7fc857193b48d7UL, 0x1e21f8b224ac9401UL }},
+  {{ 0x1d6cd291ee717bd0UL, 0x57895b75ef374aa1UL, 0x2a3e0558fc8c5112UL, 0x20f4bca57d00ba9eUL }},
+  {{ 0x95424c6e90f1be0cUL, 0xcf486994dad70928UL, 0x8a83b81860cd0db0UL, 0x010284b8e1cfe336UL }},
+  {{ 0xc67466ef6634357dUL, 0xb6ba3e53e0567b49UL, 0xef7a5816ba790087UL, 0x1c0ff24eb7bed2f2UL }},
+  {{ 0x1760d99e12562d65UL, 0x1c30d96a85870910UL, 0x0bc39047bcb84793UL, 0x23cee7ea5521b917UL }},
+  {{ 0x0bda278e509bf605UL, 0xdcda7204e5ce3304UL, 0xc4e6ca4739f44879UL, 0x07ee6c7e28f1de06UL }},
+  {{ 0x94b296f8bfbaeba2UL, 0xeb2766985f71b75cUL, 0x4ae0dbc5f6a4fc27UL, 0x05bd9da2cadd2d58UL }},
+  {{ 0xe3e93b24ce33f3b3UL, 0x9f0efa163dd02be8UL, 0x66a6092966488d72UL, 0x179aca74e45427beUL }},
+  {{ 0x2c49bd5c257b2ca9UL, 0xe7689c13aa296eeeUL, 0xd7885741e4be1501UL, 0x0180c44e16a2931cUL }},
+  {{ 0x4efeb97464b6b023UL, 0x2f4cf55c0ee30087UL, 0x2c06037d64dc1a74UL, 0x0fb6ededbc54ada6UL }},
+  {{ 0x9c9e263ce34ff67aUL, 0xf1936868094b0362UL, 0x9be374e77950f6b7UL, 0x0447d28e407ddb49UL }},
+  {{ 0x409c9abac4dddfb2UL, 0x571b9f6aeccaa080UL, 0xa9b08ebcd69f8aacUL, 0x0d7ba85626326e20UL }},
+  {{ 0x74f935cd4e5d0b80UL, 0x76d61901661e7651UL, 0x7fecf4da3b68e858UL, 0x0fff8c21783e7d72UL }},
+  {{ 0xfe4da366798a9db0UL, 0x17b5a939ca30b3a9UL, 0x31a2e66c07b71546UL, 0x287bc0ec56c53baaUL }},
+  {{ 0x6b83edcdd125ee7dUL, 0xabebfffa07e48354UL, 0x1fc05a5f785569e7UL, 0x14763f78f7e8e704UL }},
+  {{ 0x72e46ee57666ce1fUL, 0x13b74af31e9fd527UL, 0x319494ab5a025c51UL, 0x18c957024d3f03baUL }},
+  {{ 0xfa508a54ddaeaedeUL, 0x79bd5cc64f676cb9UL, 0x80feac90a3ab3067UL, 0x20b3c03740fd83a0UL }},
+  {{ 0xf6c292d19a0944afUL, 0xebd44a377c8600dbUL, 0x5fdc31c95d758d28UL, 0x19646c5c28754e07UL }},
+  {{ 0xc4f844dd636b541fUL, 0xb5b25fb24f6bcb65UL, 0x92952b5cd28725b2UL, 0x099ad54b13094df5UL }},
+  {{ 0x25068bb5f75144ccUL, 0x373eec07f34e292bUL, 0xec64b79b47202316UL, 0x3017416b9837fcfbUL }},
+  {{ 0x3463f37bbc72e0b1UL, 0x281c6cb1d4a033cdUL, 0xd69f46926065e4fcUL, 0x204f6f991de201c2UL }},
+  {{ 0xc8a7bbed4e8bab42UL, 0x4b84542cdb50cc99UL, 0xd3f354f7137a970aUL, 0x167a60f54942a7beUL }},
+  {{ 0x010049b09bd87873UL, 0x8c95b0929686de60UL, 0x8bbacecb5a7676a2UL, 0x074b0a68c2211ff8UL }},
+  {{ 0x70dc23d68953b071UL, 0xc39c66ffd73e0de9UL, 0x5472d49ce4b27eedUL, 0x1a76d0185de2fe93UL }},
+  {{ 0x17eb580eda4580d6UL, 0xd7dc8610a031bf80UL, 0xc73ebfc6c0174c5cUL, 0x2817316625e228f9UL }},
+  {{ 0xeec07c9aeddf735dUL, 0x10665ae2d496e5e8UL, 0x8c492640fa9fe856UL, 0x2fc35629a7e17afbUL }},
+  {{ 0x819a9a677b3307efUL, 0x2dbdb542ed1fd6ffUL, 0xa2c71538f242a001UL, 0x10f718cc74fee604UL }},
+  {{ 0xd51afa9b8367146bUL, 0x61a16f4c87a1991fUL, 0xebb9dd9192959b90UL, 0x26b1f66c071c4f0eUL }},
+  {{ 0xb5210d9d88bad823UL, 0xe1e5ce2685163f64UL, 0x394c3251b82dc13aUL, 0x2c1f9d959d0a4ea0UL }},
+  {{ 0x57e0c8c69a348169UL, 0x177003491904ba60UL, 0x5dc4ce6dfaa79e81UL, 0x05677e6ec2bf04cdUL }},
+  {{ 0xd486d8f0259729e2UL, 0x67925b14c2ab83a4UL, 0x1bbe46a926ea3d3aUL, 0x09e28db9e1347e71UL }},
+  {{ 0xca9eda1f665fa994UL, 0xa4e2ff5207aad04bUL, 0xc94c737c298645a7UL, 0x021f831e62470196UL }},
+  {{ 0xec95c9c8720131f0UL, 0x30dff320caa80408UL, 0x9df594aa14cfe7e5UL, 0x2456703f2f2f3de2UL }},
+  {{ 0xbdaed2b2fd95258eUL, 0x899d182af6abdc8dUL, 0x50466e1b30735e3dUL, 0x2a0780c3c6fcd432UL }},
+  {{ 0x38766c564766efd0UL, 0x2959939ffe4f473dUL, 0xcfa21e9be318a620UL, 0x2da30c3621103c5eUL }},
+  {{ 0x45f738dc8b264d7fUL, 0xec1b85880948346fUL, 0x057eaf3df827f324UL, 0x2b1b3ab3bbd801aaUL }},
+  {{ 0xa548c5c2437cc961UL, 0xa96af93d5edae76eUL, 0x8bd8e878de9eaadeUL, 0x2ea45a8a53b81ca4UL }},
+  {{ 0x0cb10a700e80062fUL, 0xc835bae600729adeUL, 0x7a67d731f82d2217UL, 0x280cf479a3bfdb4aUL }},
+  {{ 0x95f634174c19b56aUL, 0x07e6d54cc792d072UL, 0x9729181a491e854cUL, 0x0123eacf1c1aab9aUL }},
+  {{ 0xf8909b9e859198bbUL, 0x5a575e3b5480e63dUL, 0x275230d5642e41e1UL, 0x09c0104401917126UL }},
+  {{ 0x6fafd73dde84504fUL, 0x40184208cbae34d3UL, 0xcd24d9bf59129751UL, 0x0b628985a730b474UL }},
+  {{ 0xff2ecf3f0dc508a1UL, 0xc6be0757551589c1UL, 0x773bd0bbb4b90925UL, 0x12bc457e42408b4dUL }},
+  {{ 0x26532d143f4176e3UL, 0x4bb9b3a0eb36d516UL, 0x4a5bbce1358aa49dUL, 0x09c959eee3e6ef6bUL }},
+  {{ 0xccbfb0cefdc7bf70UL, 0x588f8c0caa338155UL, 0x6585a06cfc06c4f9UL, 0x2839c26976b6fdc1UL }},
+  {{ 0x9631e8071c7865c8UL, 0x78bcb346dc060a1dUL, 0xf3acdaf545b479e2UL, 0x22b7f0ddb8665249UL }},
+  {{ 0x00ddb3d55b58037cUL, 0x33697635eb09b91cUL, 0xcbf8c9e51a6c05c4UL, 0x16ec1fcf099a56d1UL }},
+  {{ 0x37abe21ae3f8c8afUL, 0xb772c958ef7d8bcfUL, 0xa8dfde3e8883bb8bUL, 0x006f551113be8293UL }},
+  {{ 0x9d8fc99944ba591bUL, 0x0861ecadfc04051eUL, 0xf1cb8d7694da00d4UL, 0x2f3f23ef5daad154UL }},
+  {{ 0x4a55b00f6017b76aUL, 0xc14af60a95053748UL, 0x4c2b249eebee8b59UL, 0x0f2cc3c71a343ca9UL }},
+  {{ 0x480520e186212bd3UL, 0x08b3e60211a907aaUL, 0x5b8c251b8f726e49UL, 0x2b354a69abdfe5a5UL }},
+  {{ 0x0463dbf5894d6b6bUL, 0x11de80990886d35cUL, 0xf04ca19e8879ed1cUL, 0x022a5c709ab29e3bUL }},
+  {{ 0xfd2ad1ec884c8facUL, 0xd157d0bb9cb61ff8UL, 0xe589178ea56621e4UL, 0x0f835b64b0aa2f49UL }},
+  {{ 0xd0f113c87ba17f0cUL, 0x2b7b286a060b1ec5UL, 0xb8c650b0a851fc6eUL, 0x153f3575a9b258edUL }},
+  {{ 0xb456b6c022d13eb2UL, 0x2b6543efd423d851UL, 0x42b7c0a3fef0efb1UL, 0x29c15bb6d4014e67UL }},
+  {{ 0x0322ff081d220f88UL, 0xa72d083026ba616aUL, 0xbb218b6af599b5e9UL, 0x1667e26ab65f61abUL }},
+  {{ 0x2343e84c7f0cd5d6UL, 0x30b4b8dc797608ebUL, 0x0174f5ff4f248ee5UL, 0x2133550977be0f56UL }},
+  {{ 0xea20a9191fb890b4UL, 0x624846f7d4eb1199UL, 0x91ac819697bc8b81UL, 0x007b6140e5026a30UL }},
+  {{ 0x40ce2003a9353818UL, 0xd17ddfdc95089d2aUL, 0x4d905743cef1ed47UL, 0x0f4a746b1b2dba13UL }},
+  {{ 0xd33eca030c8321afUL, 0x21ba07870cf01ddcUL, 0x16e1e13b7e7b2e07UL, 0x06b707df1e9abcadUL }},
+  {{ 0xb12cbc788581cbbfUL, 0x410bf93b2f948aa9UL, 0x659188fd3d999e90UL, 0x18705bb5cba19ad6UL }},
+  {{ 0xfc461619a3f9f670UL, 0xce82823c41cfedb1UL, 0x5a50f854de638defUL, 0x07161b18582e268aUL }},
+  {{ 0xb00b114fc613f1deUL, 0x892f684b1d6a692dUL, 0x1816579e8a7760b1UL, 0x1073f196e2f9e15bUL }},
+  {{ 0xc6f289e01cd3aadbUL, 0x4f78929bae32c602UL, 0xdb765cb302df2116UL, 0x179a5ddb3e315f19UL }},
+  {{ 0x4cc5d7c2618a38bbUL, 0xb810d79fe855dc79UL, 0xc7fcda10f55889ebUL, 0x00e68332fcbd13a7UL }},
+  {{ 0x825013bb397971c0UL, 0x001186486aef5a83UL, 0x251526ec5ecb2ba2UL, 0x305b593acf654773UL }},
+  {{ 0xf56c06df6cfd2a1fUL, 0xf858018c6d08f6ddUL, 0x8bc12aeb083ba41aUL, 0x2b434361ba354439UL }},
+  {{ 0x82a7683b57062280UL, 0xaf9fa46b11364c19UL, 0x214690d6280c7f81UL, 0x06f56451d7c06582UL }},
+  {{ 0x3e8870313f453e02UL, 0xf7a53bcd3f6ad8eeUL, 0x8a1ff2c8b1b7355dUL, 0x2bf3ecb8b8f642beUL }},
+  {{ 0x1c23444cb8ad9086UL, 0xc24fffaa7bc77becUL, 0xb0b1a769e2c89d8fUL, 0x143a8076ece3588eUL }},
+  {{ 0xaf666e3f54963dddUL, 0x626a0217ee410d8cUL, 0x7bf07ec329c9a71bUL, 0x0c50f43ee10e5eb9UL }},
+  {{ 0x7a9ad3534aeea9bbUL, 0x6e0d97216b9b0b63UL, 0x4cf51157fd5fb5acUL, 0x27d81a0dad963ae7UL }},
+  {{ 0x87625437fdec3547UL, 0x60df969619375f39UL, 0xdcb5e8d1764a5c62UL, 0x0af8b6fac26c1455UL }},
+  {{ 0x1fcac624929f3d51UL, 0x73264dd5f3d5c288UL, 0xd1d5e9eb4a032b2eUL, 0x2c52e66560a1950bUL }},
+  {{ 0x91c6b08787b80d89UL, 0x83732bda1a801f3cUL, 0x6bd5289d70e327b2UL, 0x137994ad7f088374UL }},
+  {{ 0x6cfeb922964702caUL, 0x79f85a75de98fbe2UL, 0x4f69d095d100a138UL, 0x143e2e628afac258UL }},
+  {{ 0xfb765b7aea08f64cUL, 0x5426e2051becf089UL, 0x3c9f207efca20b3bUL, 0x01fb6266cfdc4a53UL }},
+  {{ 0xd79dd184362ef8caUL, 0x191c68f344085f7bUL, 0x31164e2db0bad166UL, 0x15804638e1373cddUL }},
+  {{ 0x564afe1cc225d228UL, 0x60708b9db00e4756UL, 0x4901bf1481d86a32UL, 0x1961ce6a0d26f79fUL }},
+  {{ 0xdc82b2560e22d06cUL, 0xd1e22e2f6cc0b0e3UL, 0xfb29279128c8c0a6UL, 0x1e41dd00ca995693UL }},
+  {{ 0x0ec01a48c8746e29UL, 0x9d6ef26e998654f5UL, 0x8585692e6fb49d4cUL, 0x1f319d62188d2794UL }},
+  {{ 0x0f116cb7a9ae0882UL, 0x8b2a890cf91f410cUL, 0x3f54559095e8b80eUL, 0x20677414770b3bd6UL }},
+  {{ 0xbee1337e6bbfd831UL, 0x170e0cb6e6387536UL, 0xfb87d70516f5cb03UL, 0x03cf0d37b5dad81cUL }},
+  {{ 0xb656b0da40cfede6UL, 0x5ff917217943ab4dUL, 0x2f3912b70600b143UL, 0x1968c9c142c972b9UL }},
+  {{ 0x108b054700604cdcUL, 0x708d8b713a64bd08UL, 0x8fa65f8fc5d4f739UL, 0x1f85220f90a90181UL }},
+  {{ 0x98f0b19883516cc8UL, 0x6e462f88195af779UL, 0x7a964bbbc7fd8a0cUL, 0x1b81f2559c2d33a8UL }},
+  {{ 0x7e38b9deb460b67dUL, 0xd6e00d709094a071UL, 0xb1aae7628b3adad1UL, 0x25402d4992530890UL }},
+  {{ 0xc50dcf9e4f46ba12UL, 0x185e6586333131afUL, 0xfa500be5072653d2UL, 0x0ba892a80efac410UL }},
+  {{ 0xd3c65b32023b062cUL, 0x1469acc806fddb5cUL, 0xf4402c811ab4b739UL, 0x0fdf68de0f723034UL }},
+  {{ 0xe259977ea5f7178fUL, 0xf3a335d1328b8200UL, 0xe6c96c30e98f5858UL, 0x2425f9c0aa0730ecUL }},
+  {{ 0x0063cf5a17d20be3UL, 0x7c3235e1add90b24UL, 0x51b596d1303dd829UL, 0x032cafd93bd2b549UL }},
+  {{ 0xe46b871c0204520dUL, 0xb9f96edf3245a8a7UL, 0xad9940eda704e1ceUL, 0x06db534d5c374bf8UL }},
+  {{ 0xccb3a5b5b79b6c7aUL, 0xa2353d15dacf04dfUL, 0xb4c31562a8f972dbUL, 0x2dea7f07e9a85f26UL }},
+  {{ 0xcca27fafa4fb607aUL, 0x8343c7fbd784ed50UL, 0x59e49f339712af0eUL, 0x225feb7cdcd4b665UL }},
+  {{ 0xcac99a80a3f47375UL, 0xc72f2d85a2213ddaUL, 0xc2fae95e3fcb7e85UL, 0x2bfd5968aac2b0efUL }},
+  {{ 0x24ba3c25eb636e70UL, 0xf52e4b0a65874f02UL, 0x52eb63f25e6a98feUL, 0x127c4517ffca49a4UL }},
+  {{ 0x370067f2634e3606UL, 0x637822944c14416fUL, 0x678f9ab50dddda56UL, 0x0926068f7a9657ffUL }},
+  {{ 0x4bfa67d2cb008845UL, 0xb2c20f6a3c668b71UL, 0x4acf256d2e0adc64UL, 0x0d0ca0f4350a4d64UL }},
+  {{ 0x17b38a9f3a0a8a59UL, 0xc9637f62623d9452UL, 0xe21b6a946bf2c130UL, 0x2d4738fb542c650dUL }},
+  {{ 0x2c8cf506c2bb8885UL, 0x8a7ac31bd9890daaUL, 0xd170597ddad8960bUL, 0x055a3fa1da233c68UL }},
+  {{ 0x4bef39a98b023a87UL, 0x9b3df7db828cc4d7UL, 0x5bc682e1419bd3eeUL, 0x037adb986678ec35UL }},
+  {{ 0x7e04ef2a5f4e6f14UL, 0x981eef728f638046UL, 0xfe6fc0216ad00a3cUL, 0x2e418175c22b7297UL }},
+  {{ 0x3ae45ce4e8212706UL, 0x1fc38e68b48e8231UL, 0x98cb6fadcc6139b4UL, 0x12a8fabd2df33863UL }},
+  {{ 0x473f74f9106a1711UL, 0x80cf731f02cc74bbUL, 0x1965be5e6673bc90UL, 0x07fbe76ce9b0e3c6UL }},
+  {{ 0xd78fddb86d8540cbUL, 0x814f235c9162731bUL, 0x14e5b282f1391040UL, 0x2cc7aa2f1e9b663aUL }},
+  {{ 0xd1d7418fc7870061UL, 0x11c1a70f7d2e415dUL, 0x89e6fc35377508d9UL, 0x187a398b2383e791UL }},
+  {{ 0xc1ee22e833eeddd9UL, 0xb82e2a838e51ccd8UL, 0xbcbe32a33d889260UL, 0x22e1441474973dceUL }},
+  {{ 0x84f48ce650f56dc9UL, 0xd140b2223ece331aUL, 0x3fe03050362b7ca4UL, 0x1ea4ac53a5b3431bUL }},
+  {{ 0xe1624f5036af9a40UL, 0x3bf0e9b9d4437f89UL, 0x97406f8db6c08b0eUL, 0x167ce0c788f10282UL }},
+  {{ 0xfa159beb1f04fd23UL, 0x220dd661f53a6ce5UL, 0x0536973423ac181eUL, 0x2c1323b6b923304eUL }},
+  {{ 0x8fb9d8956d2ec908UL, 0x989dc14238c2c545UL, 0x2351e346c49f6aacUL, 0x2c04a785cde6ac99UL }},
+  {{ 0x87c0358aef07a1dfUL, 0x85e19ba5b61e11e4UL, 0xc160f8e8cefc0164UL, 0x20b3ce1af62f0b94UL }},
+  {{ 0x266fd3ee1702410bUL, 0x4a15bef1a73fb521UL, 0x954e7e21e8a2f083UL, 0x1f7b2af6f081e9a3UL }},
+  {{ 0x44b47118ddb69b65UL, 0x05df64fa098f05b5UL, 0x201a7b104c60a2b0UL, 0x228eac7ae2ac6fb9UL }},
+  {{ 0x6c1f3884b5cc71ccUL, 0x9fb306d7ddceb5b3UL, 0x14705e82efc97a14UL, 0x2b5b044b49d1205cUL }},
+  {{ 0x7634cf7725a65a74UL, 0x52135acef4ac4818UL, 0x34915c0cb8585f63UL, 0x0ea1c831d423c16aUL }},
+  {{ 0x537af60d0f0721f3UL, 0xad162f6e37d97df8UL, 0x7a6b358e2f1173bbUL, 0x1bfdae726afb2cb2UL }},
+  {{ 0x138a5e6eaa01f0abUL, 0x91b77fdfd7e4af85UL, 0x61509c10a761f46cUL, 0x1889e069a61ee3c6UL }},
+  {{ 0x06ac9b6348f0c6afUL, 0xd1faf71e9234bca8UL, 0xda9f00f620146812UL, 0x0a5d48f1170e3e62UL }},
+  {{ 0xec24ad278dfe6296UL, 0x6153324b0756c82fUL, 0xe28f28282c21447cUL, 0x0a9e057289838bfbUL }},
+  {{ 0x77e149ac25aab09cUL, 0x00969681f961ff20UL, 0xd48a26158b96cd43UL, 0x0b1e480bf8f497dfUL }},
+  {{ 0x740820cb03027ae3UL, 0xf2c34dc1aaac7488UL, 0x8b0fd3f6bfeacb4aUL, 0x27318014da14cac8UL }},
+  {{ 0x63a9bb9a3580cf41UL, 0x20d97d9e6b951dc7UL, 0x4ac806544468af56UL, 0x06ae427ac11e4b69UL }},
+  {{ 0x64284c6ec3105a66UL, 0xa8630a9187703b85UL, 0x5da5a5db3c49054bUL, 0x287f60eab7c3c1d6UL }},
+  {{ 0x086d8725c72a8d81UL, 0x27ee70a0ff07b76fUL, 0x06dc90a4fc481f20UL, 0x0ee9fa555701ed44UL }},
+  {{ 0x249023dafc0b9dedUL, 0x8850e80de4375f51UL, 0x444c4f78bb76f182UL, 0x0879404ab6eeb1e4UL }},
+  {{ 0x72541676342d2a4eUL, 0x7bd02e33025be203UL, 0xfe0b36a475b9039bUL, 0x18220424dc8296c1UL }},
+  {{ 0x83f45f32b6569c2bUL, 0xa7e1291682f61631UL, 0xa02857cad81eaf55UL, 0x165edb630e41a717UL }},
+  {{ 0x23d5f58173725475UL, 0xba99673a7955aa3dUL, 0x3cbb8b0355eebf40UL, 0x0250debf50a7d721UL }},
+  {{ 0x8e0793638431ddfbUL, 0xda86f2cf04173ddaUL, 0xf5ee53f3a7f0c5d2UL, 0x2720015b42d3114bUL }},
+  {{ 0xb7b869ed646ea70eUL, 0x8fb8b7a409feba3bUL, 0x61b9fa055e735643UL, 0x0085b9670acf9bc0UL }},
+  {{ 0xfef938f2c0e7e6d2UL, 0x32b6731dc54ef999UL, 0xeff3acb08fb1d239UL, 0x23c68ae037595815UL }},
+  {{ 0x80287f1965c16ce6UL, 0xac46344aa2a5bd4bUL, 0x8d2c0aabeb8fe7dcUL, 0x1b36a7961efa7c8cUL }},
+  {{ 0xd9fed10efdda1b01UL, 0xbbca24441212b71eUL, 0x6c913b4e74bfb54eUL, 0x122360b76dc76066UL }},
+  {{ 0xb80d348a7c8a3cf7UL, 0xd08fa0fc243818d4UL, 0x45cb916e1895cb2dUL, 0x2e2370395235d73cUL }},
+  {{ 0xfa1dc3b21fdb9a85UL, 0x7f5bd07cda5621f8UL, 0x971f106e7f94160fUL, 0x1e6b8b70c3254644UL }},
+  {{ 0xfcaaf190af2169f4UL, 0x9f294fe1d4ad4705UL, 0x05c46aed869aaefbUL, 0x08ecff3f7b5acf02UL }},
+  {{ 0x2cfcb07532ec9902UL, 0xe2c20c3653505bbfUL, 0x856539b942314554UL, 0x0d7ea28835ba20b4UL }},
+  {{ 0x9ce02c8776a7ffe8UL, 0x808b0007a9c2e0ddUL, 0x7eac80d8a7060802UL, 0x176ebe0b73534556UL }},
+  {{ 0xf51ce670ef35391eUL, 0x1aff962da9cbfe73UL, 0xaed3a88bfe51c64eUL, 0x1f2e51d023d3abdbUL }},
+  {{ 0xa9458348dcb4c9dbUL, 0x37a7c77ce5dd8714UL, 0x844cebc23b9dc62bUL, 0x2f1913205d0ebdffUL }},
+  {{ 0x8a85200f2e5e399fUL, 0x7a3e9ae4965d1f0cUL, 0xf7b2e05f7bc7a962UL, 0x128e9cac0c07b9c9UL }},
+  {{ 0x9d951fefbf3d7c0eUL, 0xbb5e7d258ea14080UL, 0xb7bedd878b56f8c5UL, 0x1084a92e0c3fc091UL }},
+  {{ 0xd1fc182770ad4f99UL, 0x2dc8d5e361192817UL, 0x119f323eb7e81e97UL, 0x1b6194b4bad94428UL }},
+  {{ 0x80c953caec905c49UL, 0xfda22fabef7f3369UL, 0x88689646ddcfdeb7UL, 0x0c5b47798ddcafcfUL }},
+  {{ 0x10b3def24bb1cfbcUL, 0x39689791c557d513UL, 0xfcd95ef148c46ab3UL, 0x11436bf9979880dcUL }},
+  {{ 0x817b87d3d97b5cf8UL, 0x0901cb0118f9b22cUL, 0xcdfc3cc8250c6067UL, 0x266208567dc44c4bUL }},
+  {{ 0xc8323b429ca62502UL, 0xcfe7ffa144097fd7UL, 0x9791fd0323f420ccUL, 0x2c3af7b8f2af839eUL }},
+  {{ 0x5d3f57a102a25c19UL, 0x8c0fbca618dcd897UL, 0x5386796256f50406UL, 0x276bd50f77115f30UL }},
+  {{ 0x39ca4fc255297430UL, 0x1d2f9b5bdbe430c6UL, 0x495458212c4d65f0UL, 0x036fba1b5fb9aa58UL }},
+  {{ 0xf68bc5c0a34c2d52UL, 0xf1295e13fb9c42ffUL, 0x508161bfbebfb4c6UL, 0x1679078589c872aeUL }},
+  {{ 0x08486137967d19c6UL, 0x12c6d93d94342de5UL, 0x5c5ba0cadff09859UL, 0x24603a0227065243UL }},
+  {{ 0xb1a94cf9b409a53cUL, 0xe2ab93b45ce6b521UL, 0xf21a646f0ead32afUL, 0x1821aca395a92febUL }},
+  {{ 0x4019f63d2f3d180cUL, 0x1541d8ace0e68122UL, 0x225f81e6a553e83cUL, 0x2c6f77ec3e35a11fUL }},
+  {{ 0x6069f7c094ee6bd7UL, 0xd4f32998a1827b18UL, 0xde5d29f6431685f8UL, 0x26c6785b807cc680UL }},
+  {{ 0xc276d3020821d204UL, 0x3e7ff9ee275e6b7dUL, 0x42902e701c5c9889UL, 0x0bb4971d3d4393ecUL }},
+  {{ 0x8a10b97c76103d77UL, 0x9ba2f633e9e69ea9UL, 0xdf864d421a73907aUL, 0x2caefd5b4b9b8e93UL }},
+  {{ 0x6c86b75eb9ef897fUL, 0x9a34e112234cd40aUL, 0x772eecdf563479d7UL, 0x259dd4714e5d173fUL }},
+  {{ 0x879188bc5ef95396UL, 0x19318a117aa31c0dUL, 0x2acc3c6cffb28f1dUL, 0x04bdc2aff86bec3eUL }},
+  {{ 0xe13c127f8a7f8222UL, 0x816388062b6b8834UL, 0x903f0a57442c395fUL, 0x1243482c8aafe1f1UL }},
+  {{ 0xcee79df227335781UL, 0x4459164afe4c7c1bUL, 0xa58ab5b6a7190a4dUL, 0x22fa70343dd3422eUL }},
+  {{ 0x3b17565415979f57UL, 0xaa92c1fd4ea6ec74UL, 0x05833768cababafbUL, 0x12e1e2b4b9a20a05UL }},
+  {{ 0x40b122f0c6ea883dUL, 0x919a8303affb809fUL, 0x3eceaaf4198055dfUL, 0x1d0fa3c6cb87ff2aUL }},
+  {{ 0x9cf135f2ab6521bbUL, 0xb3b48d9614f53f19UL, 0xdf041ebb1beb408eUL, 0x198832799b631ca5UL }},
+  {{ 0xffa0714f0284788dUL, 0xbd8903a1b4f92ac9UL, 0x239ca5fcf831949cUL, 0x17d89283fd5dbbfeUL }},
+  {{ 0xda83c67b89849c0dUL, 0x30012e00df62c1ddUL, 0x791206ad006a4bbaUL, 0x12646ae8a3b10fadUL }},
+  {{ 0xfa782e5cf2e316fdUL, 0x5d7c7c8231ea1046UL, 0x9a6c111e2837d606UL, 0x2ad7b6c4c75a3a55UL }},
+  {{ 0x69c2b3dd8219c4b4UL, 0x8cf2a3e3d54dbcadUL, 0x24f3e3e1919ed154UL, 0x1c0fec02e36bfdbaUL }},
+  {{ 0x8104597734c4a8c1UL, 0x5ec4acbcca5780a4UL, 0x3a97b8079e20e587UL, 0x2169d4724043b38aUL }},
+  {{ 0x5d382d3233cb185aUL, 0xfe48e37c04afa943UL, 0x9471a7ae59afbf5eUL, 0x0e955be777ac58b4UL }},
+  {{ 0x67284c2393067f7aUL, 0xaa27e75290fd28d8UL, 0x3cba6020a248f045UL, 0x29da983cb4d1ecb2UL }},
+  {{ 0xfba13a6395eb0d5bUL, 0x035cbe21c9e24cd8UL, 0xfae841f25f9aaae1UL, 0x2a4afb7cc3314362UL }},
+  {{ 0x9009077f4ef9e929UL, 0x9f9c71563adc5a7cUL, 0x0b837c668d106ce9UL, 0x0e00b25b6e0a832eUL }},
+  {{ 0x81c432313ddf74e6UL, 0x5ce12544d6a17d0cUL, 0x05a70833741f3c24UL, 0x1199b196d5348008UL }},
+  {{ 0x5d83a634f821eb01UL, 0xd1418a88b6a9d8baUL, 0x96cc5e6eda168df5UL, 0x0799452fe47a898eUL }},
+  {{ 0x540411b98c829e13UL, 0x2c230c3604917a7fUL, 0x72589d799d4ae8d7UL, 0x271d987e0f2e884fUL }},
+  {{ 0x7c003cc9a3910b7bUL, 0x83feefa108fb9945UL, 0x2a85476452d347ffUL, 0x2c9f007467d21e2eUL }},
+  {{ 0xd11124800392bcabUL, 0x140df72b4d53ffebUL, 0x279a62239bf165a7UL, 0x13ba2075fa4ac250UL }},
+  {{ 0x73f9a65b449b0028UL, 0xeefbfa7daea4e3d2UL, 0x177c280580826627UL, 0x15c96f964e1b08a2UL }},
+  {{ 0x5ccb93e77c37ae66UL, 0x9ef1e4883e94cf62UL, 0xe87a8713dcb581d8UL, 0x04cd15566eef1234UL }},
+  {{ 0x69abfbcceca8fc48UL, 0x99bc57476ed5adf7UL, 0x2c089d722222b408UL, 0x1bfcf6d5438b2a59UL }},
+  {{ 0xdff6d637cec6c67dUL, 0x43955345176db9f0UL, 0x06f702710dc6b694UL, 0x2f1040008d19db2eUL }},
+  {{ 0x83cca0abf4a9e53bUL, 0x18d7da4d1d382012UL, 0x931dada8dea42709UL, 0x2c3558831d83a689UL }},
+  {{ 0x64470abbb13dadb5UL, 0xe2e051c5a40affe7UL, 0xe7a01c5e449d5e09UL, 0x242659624288d6abUL }},
+  {{ 0x2fa0e09dd02b492fUL, 0xa6e40d9d42bb0f49UL, 0x2da8a9fadbab6f63UL, 0x0daecf81578552c9UL }},
+  {{ 0x82fa53bed5945fabUL, 0xfebacb29078bdddeUL, 0x6e06f8e386c850c7UL, 0x11714d9f93e0c7b2UL }},
+  {{ 0xba45c0bc8c2ab803UL, 0xc71a82b9e1f9e325UL, 0x948e3b84f3b6e308UL, 0x0342dbf1644aa50dUL }},
+  {{ 0x859259f72d882bc1UL, 0x110df552d7ef865aUL, 0xaba3ad523452fdd6UL, 0x237e5b75b969dcb8UL }},
+  {{ 0x12a1a774d4afd853UL, 0x7c8ce372da2291eaUL, 0x5132ecee56d01dbcUL, 0x1edd13c91c8d7db3UL }},
+  {{ 0x21327e341b5bc4b4UL, 0xff85457ca720062fUL, 0x19ca37d1cf7183aeUL, 0x233a5b6a996b5112UL }},
+  {{ 0x0deacdf2c8d884b2UL, 0xbc0ae4d732f7bd0dUL, 0xf6cd4368b64aefbcUL, 0x28bb84bb17b01568UL }},
+  {{ 0xda86e9dff1c7ccadUL, 0xc98dc97d9fd98703UL, 0x3fac3d2bb7ffd758UL, 0x1457e11f302a5791UL }},
+  {{ 0xfe09dd3102aeb103UL, 0x3cd56eb251b982d8UL, 0x5df581c138ee7ca0UL, 0x0168f968b0e07800UL }},
+  {{ 0xa37bf54585c402ccUL, 0xf4e63381efe060f6UL, 0xdc44188d3e137db3UL, 0x04be9491e8806147UL }},
+  {{ 0x1b4cf4925df9c8d5UL, 0x14f555ce9ce8e83aUL, 0xed6180fead991495UL, 0x256f591c0b246eb4UL }},
+  {{ 0x3108b65f1ab8bba2UL, 0xf7732e12fb529741UL, 0xae7f63c21ffb51c0UL, 0x103ff9c0b8b40450UL }},
+  {{ 0x83f5f416726278fcUL, 0x85b083765c74d3ffUL, 0xa38dba9e08ba055dUL, 0x1814e56b002a7150UL }},
+  {{ 0xbccdad773400fbe3UL, 0x5f1499299d633d58UL, 0xdce3bcdd302ed30dUL, 0x0ab0167373ce93d5UL }},
+  {{ 0x37042db754d85ed1UL, 0xae02a3773e1b5906UL, 0xf155a4da037bf561UL, 0x0b79f15754161a8eUL }},
+  {{ 0x1a5b468a17585643UL, 0x56bc0a73b5c930c8UL, 0x7d07fdf73a60397cUL, 0x035602fa73507495UL }},
+  {{ 0xc2c07535e65fe744UL, 0x853c00621ca2ac0fUL, 0xb85b88897fccf7e8UL, 0x2672b8c4f679946eUL }},
+  {{ 0x0c95894f2617e43cUL, 0xdd9dfa2e709d26c4UL, 0x286c9dcde1b66309UL, 0x1cc1ecaa8fb85b1aUL }},
+  {{ 0xfbe024dced7472d7UL, 0x57295c7a4214e024UL, 0xf4eac014eb48b382UL, 0x0346bef56ed04918UL }},
+  {{ 0xd0be64c89ce5ce41UL, 0x7fe73b017b366934UL, 0xfa2b28d5dd19cd90UL, 0x17c1f955b9125a3eUL }},
+  {{ 0xade9adc87c35207dUL, 0x7dabd5558204f2ecUL, 0x8efa2527dba3dbc7UL, 0x21f7041a264306f3UL }},
+  {{ 0x1e42b9692e26b688UL, 0x42ec38a3b92a64a0UL, 0xcde3830622df097eUL, 0x0a3df7112c1bae3eUL }},
+  {{ 0x3247714cb80e98f3UL, 0x2650a39686e2a053UL, 0x871fdf52b79f95b0UL, 0x2784c524a35c20c1UL }},
+  {{ 0xa1df1e661657993eUL, 0xf98bcf70048a255dUL, 0x504cae1305f6ee91UL, 0x05bca84342250725UL }},
+  {{ 0x6fedc8da35a2bb88UL, 0xecf45d623f0fff4eUL, 0x8f81bf255aec3acbUL, 0x1e349da3432a5107UL }},
+  {{ 0xa116f95356b647f4UL, 0x53607bb321170f72UL, 0xf367d6c717ebcda2UL, 0x08b2d85d9f4ce848UL }},
+  {{ 0xc6bd1e497b6cfd1cUL, 0x7adffbe01fb2886aUL, 0x9624d84de72c5c8dUL, 0x2a789fb08d70bb53UL }},
+  {{ 0xfa452149362d0e8fUL, 0xefb7a4ee8d8b1fd3UL, 0xb7527898a6b2c41cUL, 0x17a10e354bba9175UL }},
+  {{ 0xdd4ffc2e4d0a82a2UL, 0xf53c91e3515bc78eUL, 0x35eb4eb66e03933aUL, 0x03568a17374ae16cUL }},
+  {{ 0x0aaa9c4cf79c7a83UL, 0x3b0742c8d04635d7UL, 0xe740be36dea6b2f2UL, 0x063c0690e46fa62bUL }},
+  {{ 0x2ae5772c4bd1183fUL, 0x1f1b598280c81d69UL, 0xbb481723e09e1e24UL, 0x1e56053661b6d910UL }},
+  {{ 0xcb43bc128218a75cUL, 0x5dc37b9b5438ea90UL, 0x4dee7cf2a7ec602aUL, 0x2fd13dc0d3582f17UL }},
+  {{ 0x0aea6c4eb3bb3763UL, 0x2f2fd3d11ca9eeecUL, 0x7cc1a769b4616e17UL, 0x2cfd7d805bdeb068UL }},
+  {{ 0xde6798af136c4489UL, 0xc3d57b872278e0e4UL, 0x5b43d427513611fdUL, 0x07c126146583c8e5UL }},
+  {{ 0x53b880f46dc5a610UL, 0xe716fe96df6aa1b6UL, 0x564fab1a2da4c04bUL, 0x03cd1e6b8ecfbccfUL }},
+  {{ 0x8b7dccf457a93bcdUL, 0x8cc51972e368fb5eUL, 0x2c3de2f74e9cba4cUL, 0x2db2771894dffcb3UL }},
+  {{ 0x224e16d65db1da1bUL, 0xdca4bd2aeae29ee0UL, 0x89c158e0cac7c971UL, 0x24e7d1121588cb60UL }},
+  {{ 0xea1025200112ca61UL, 0x0040b75e1deef8d0UL, 0x2cf2a373c45cb8adUL, 0x2321b9907d97edbbUL }},
+  {{ 0xde87b0ce18d33a98UL, 0xbdbc3abfe3c64ae4UL, 0xb4776a6c3fce691aUL, 0x1fc6fb48d4039555UL }},
+  {{ 0xd3d90d4441ba9370UL, 0x87218963df228f87UL, 0x9e629c462ddaa0efUL, 0x18ccf6b1788568bcUL }},
+  {{ 0xf9c33e06c62f58c4UL, 0x927a4d814287e6e6UL, 0x6808bd231d7d9ed5UL, 0x26adfed2bca44259UL }},
+  {{ 0xb0b363a671783448UL, 0x134010e5f0e7d173UL, 0xc20b009ee5113bcbUL, 0x2f42bf970c6ca956UL }},
+  {{ 0xb2d737099c84510eUL, 0x797535c52f9cb98cUL, 0x7577d0bce59bba7fUL, 0x2c291f7bc7e3e7f9UL }},
+  {{ 0xce5de0d7827d61d3UL, 0x54d78c6a2df459c6UL, 0xb5a77ffb1e81508dUL, 0x1df240c601cd73f4UL }},
+  {{ 0x0efb6e622bc81497UL, 0xdeb4f71fabbd25ecUL, 0xe32c6674e7a088b3UL, 0x12be5b4bea02d39fUL }},
+  {{ 0xcc10d9458f5249a8UL, 0x00090b7280d19070UL, 0x967f0f760998fb4eUL, 0x264fa31bdbff4606UL }},
+  {{ 0x3f523ae20a53ec0fUL, 0xb1c99ae07c7f3f2eUL, 0x1a95c4a4a2e7a4e0UL, 0x054c2cf47e2f69f5UL }},
+  {{ 0x28e9464eaa7e37f4UL, 0x4357ef26b5d04ecaUL, 0xb70f952f13eea62fUL, 0x026abc4c32a907ccUL }},
+  {{ 0xa2c8c2a9ce457362UL, 0x8b431d8f34476c82UL, 0x6ffb1ae7c552229dUL, 0x0280739b1d18de14UL }},
+  {{ 0x53274e3d3d3153ddUL, 0xc08f5c67ae6c3d51UL, 0x38d4d4ad9ba44457UL, 0x2f84c8dd5268e1c9UL }},
+  {{ 0x2267d74cb226dc9fUL, 0x6c4252bcef4adafcUL, 0xe2d4e48bc3bda8f7UL, 0x1579e75a5bf7587bUL }},
+  {{ 0xd8c5a017a10aa86dUL, 0x155e25eb4f0a49f8UL, 0x0b39aa5da72460dcUL, 0x122130866d08fe44UL }},
+  {{ 0x9faab874f8657e27UL, 0x80de0902bf1877f8UL, 0xac7b31ed686c1e7cUL, 0x15d14efad1f3f90aUL }},
+  {{ 0xc5aceb19efd6f50aUL, 0xe7a591d0f4aaaaf1UL, 0x0a0bb23a80e61368UL, 0x28c92b4e1bfea213UL }},
+  {{ 0x8cd57f955dcdc27eUL, 0x2a820864a3ce45b5UL, 0x286108d8787c002bUL, 0x083e2742e0e13638UL }},
+  {{ 0xfbea5890543801d3UL, 0x3103af282460d22eUL, 0x25f5127be8344d2cUL, 0x06758c2befa6654cUL }},
+  {{ 0x878a5de349d9d023UL, 0x6c2ad5d3d66e0716UL, 0xa147e9a543136852UL, 0x0c2f33a7240be8afUL }},
+  {{ 0x53180e1a3210e36cUL, 0x034bd303d0efbb4fUL, 0x5d63668871b06296UL, 0x0e7c1d86d1204fdbUL }},
+  {{ 0xd8129ad359570371UL, 0x3331eddf91969a8cUL, 0xb8f85042f014d6cdUL, 0x075f808a9bdf3081UL }},
+  {{ 0x4f19927892d1e0d6UL, 0x47762c57317e5b8bUL, 0x82edb4e38b29868cUL, 0x06f53045b48dd1e3UL }},
+  {{ 0xf07a020eb0bd376eUL, 0x53caa3b25ba56636UL, 0xc8d0cc31647c59aeUL, 0x287f1eaf0caad25dUL }},
+  {{ 0x85de2ec5ea5bcb08UL, 0x2f8a6f95e4587407UL, 0x3308c6e6f8e2fc7cUL, 0x05ff72b9f9b62138UL }},
+  {{ 0x6a5417c82243fdd6UL, 0xdb9f55065a3bbfcbUL, 0x1a85174183d547fdUL, 0x2173506ed941ff79UL }},
+  {{ 0xdd7910208ca3482dUL, 0x0a0b15df0555fd51UL, 0xa788281419748a42UL, 0x04581c32d894ab94UL }},
+  {{ 0x6cf9459215a92354UL, 0xb9f070ffd38261ecUL, 0xb7885962ff6965f9UL, 0x11a99cfb5ab8a0aeUL }},
+  {{ 0x399f6654d05d4d06UL, 0x0f6ffb5183fd8bd0UL, 0x0f96d0eb88f854b8UL, 0x16198b731213ba49UL }},
+  {{ 0x70fba56b1a2216e4UL, 0xcb271791ffe9d016UL, 0xbcb10e8f32eeeb62UL, 0x0b07261628206394UL }},
+  {{ 0x5cf9a6281c07dda1UL, 0xbbaed2ce267670d4UL, 0xa4f1b5e5cedc8bb7UL, 0x031f335eb59a9227UL }},
+  {{ 0x9d867c1c6081825aUL, 0xc3b308bde5008d2cUL, 0xfef45ffdf6cc5491UL, 0x22b4b852950378ecUL }},
+  {{ 0xfb89c6d754362424UL, 0xfcd6ab2f022d6210UL, 0xe8216de89fa9f4c7UL, 0x29421648b8a9d625UL }},
+  {{ 0xee6ff324b32c16fbUL, 0x876e4e43d9cfc574UL, 0xdf03439f78c2c8efUL, 0x2b6578f1b67e17aeUL }},
+  {{ 0xdba0978a68ebb003UL, 0x475a58b2bd189de5UL, 0xc8a39421e893088bUL, 0x066b4342b89b04baUL }},
+  {{ 0x142a3f23f26517b0UL, 0x7535db6b1cf3186aUL, 0x90b40fd2a0d6570eUL, 0x2e9dfbb5919c5da1UL }},
+  {{ 0xb863f57e7abe87b0UL, 0x3b433a13bbb9e599UL, 0x206b9e91f98469a5UL, 0x274283c57303e038UL }},
+  {{ 0xbf0a383a3741037bUL, 0x78d94bdffa174e89UL, 0x00dbd2f82ab39fe0UL, 0x012e6b71f6fcb32aUL }},
+  {{ 0x94aab522794ba767UL, 0x08ff3e691e53301cUL, 0x06f1cf37a01f059bUL, 0x1d12a7dec3c9ebf3UL }},
+  {{ 0x9a215f50ab3f0fe5UL, 0x1bfcb3c2ffd36d53UL, 0xaf6b9cdfba4daf43UL, 0x04e62deecc7831a4UL }},
+  {{ 0x93ea7e53ab77c042UL, 0x5bb158205b8fa339UL, 0xb8f299a5d2a76afcUL, 0x199e6367a9a81a22UL }},
+  {{ 0x6078bb78f04bd485UL, 0xa58889e52d3920a0UL, 0x4d431fba230a784bUL, 0x1f592573df3b5fc6UL }},
+  {{ 0x4d3e7f7f74b187c5UL, 0x983b6c5e1bcb556fUL, 0xf7cce44c2b7a4ebdUL, 0x0b06a6500fa23fd6UL }},
+  {{ 0x764d764b67f1aeb9UL, 0x768c323efb7e5bbaUL, 0x1487934ff8ff3384UL, 0x0c0f7ccb5a7b80b9UL }},
+  {{ 0x9cf2d81d347c326aUL, 0x335a45659796983fUL, 0x2aefe6b11e8de8d7UL, 0x13d9c03a02fadd4eUL }},
+  {{ 0x7111d3711553b249UL, 0x08a44cf9c5cc68fdUL, 0x35d4052be1d96e2eUL, 0x27562ae217b8e388UL }},
+  {{ 0xa3aaf07e5bcf36f7UL, 0x043fa3ee3ff8d0e4UL, 0x27b71dd1fe3390e2UL, 0x2d6c5786ea8ab05dUL }},
+};
+
+static const fd_bn254_scalar_t fd_poseidon_mds_12[] = {
+  {{ 0x7be15e9c8bc62723UL, 0x96ed328f6f6dfe8cUL, 0xaa1c1d5fe0d04cdfUL, 0x1def002d24afa03fUL }},
+  {{ 0x1cfadf5b257659b8UL, 0xdcda1b1c6e6ba845UL, 0xe5a6676c82c499b4UL, 0x23001c50b5b040f7UL }},
+  {{ 0x10ec045d63dc2a4fUL, 0x9439bdd05d9c9681UL, 0x4b3d037631358ff7UL, 0x174afa6d173078cfUL }},
+  {{ 0xa654a34204731915UL, 0xd7b926424dce98bfUL, 0xc772dbd655369ec5UL, 0x198dd1ad75fed3b0UL }},
+  {{ 0x247529f645461ac0UL, 0x8a126c0afd11b3e7UL, 0x3756198de4e66ed4UL, 0x06705349bcc19d6cUL }},
+  {{ 0xd22b90a7d6cb42e4UL, 0x5a040d320c4d8c9cUL, 0x8948854114d2ea73UL, 0x1ccb49c0b422efc1UL }},
+  {{ 0x2caa235ec5b4050aUL, 0x6e6b80a6ffe6722dUL, 0x1dd179d52192d179UL, 0x153eb938073a4e5dUL }},
+  {{ 0x47f74d8799decaacUL, 0xa619ed663e665a67UL, 0x82b34de513cdcc70UL, 0x16fb366c9e782a62UL }},
+  {{ 0xf1046df1f279c589UL, 0x8902e8c307f6bacbUL, 0xa51e8f885db6fe92UL, 0x300bf752cde7bfb8UL }},
+  {{ 0x47fde28cdaf3a7d6UL, 0x1f7e582ddc3c4bc2UL, 0x7da9405a36c3e984UL, 0x24c99f52a1cc1fd9UL }},
+  {{ 0x924fa636645cd44fUL, 0x72e54b8cf35d4096UL, 0x6a950e000c2e61d3UL, 0x2c246ab02887e4d8UL }},
+  {{ 0xfb01689d96b38e97UL, 0xc4b53ee38a57e63cUL, 0xba15719d7719459dUL, 0x0749bb1fedc0d514UL }},
+  {{ 0x75542d43de84f76aUL, 0x26dff199c48f6126UL, 0x4fe8e1e367dee28eUL, 0x2b1be9b505e643ebUL }},
+  {{ 0x0683b296256f5aecUL, 0xd7b2d3b54124f057UL, 0xde3b32a376fbc9f5UL, 0x073bf71e64424498UL }},
+  {{ 0x65f2187b6060bf8bUL, 0x71800745806b85c1UL, 0x3a04e475113a8d7fUL, 0x1b82ff9ba4ba676cUL }},
+  {{ 0x1bcf5007bf622ccfUL, 0x6522ee2a1321e76bUL, 0x52b4a62feed6774fUL, 0x20079d7538edbe2eUL }},
+  {{ 0x385d31dc53ad3d3aUL, 0x3313aaf98d462674UL, 0x8b84982cb8754df4UL, 0x2a18850941baa33aUL }},
+  {{ 0x514a6e7ad3eb0dfeUL, 0x6f84ecba7a4ac723UL, 0xea436ca2de9b91aaUL, 0x13c3ae6bfec1c1f9UL }},
+  {{ 0x933b247a97ee3495UL, 0x0168c4d296991f8dUL, 0xdfd54bc446ce41b6UL, 0x28ea0644c294c2cfUL }},
+  {{ 0x4e2a28c7de1f4212UL, 0x9ace694eb96c8132UL, 0xd009d74bc0cfc76bUL, 0x17ad41822741d0d9UL }},
+  {{ 0xbf422ebfb0a49d2aUL, 0x3538ecb1562895d6UL, 0x92d773753f82f79bUL, 0x0f2558a15e910f13UL }},
+  {{ 0x61a6cdddd8a74edaUL, 0xf7e5502cb5a4d89eUL, 0x867a7e04cc37da66UL, 0x2eed1e7f1c4ce57aUL }},
+  {{ 0xc6c4f0e514e1a132UL, 0xb610b7224841d027UL, 0x417271986892d0e1UL, 0x1eff2623b6699735UL }},
+  {{ 0xc715279f5e3f0cb8UL, 0xc3754deafd549b2fUL, 0x4d598977aad08dc3UL, 0x12acf267fa71a90bUL }},
+  {{ 0xc9dcf8e64b9cd1beUL, 0xd570b765bb5dde16UL, 0x07ecbd0310d783a1UL, 0x1f9858548f766d17UL }},
+  {{ 0x081dced257054540UL, 0x7faceb29a0776ec2UL, 0x595c02bf4803a9e9UL, 0x0757d84a19c73019UL }},
+  {{ 0xdf81ad1c44e9c7a7UL, 0xe510b20acd2a8af1UL, 0xf0eaf4f60ba9066aUL, 0x2bd9c4076f50b550UL }},
+  {{ 0xa3d24d8015d54befUL, 0x63b929b042f747ebUL, 0x86fe149b59e992e9UL, 0x1db6d9c92c419ed5UL }},
+  {{ 0x8d7373646652a540UL, 0x93e4670a48353494UL, 0x18ab7652456f68c9UL, 0x0add6e87bacb196cUL }},
+  {{ 0x414f64ceee6677a6UL, 0x67fca9814e84220eUL, 0xd195cb4e5dec5792UL, 0x2103d68370ac8147UL }},
+  {{ 0x40850045b848c45cUL, 0xbf29e1ff7d77ccf0UL, 0x9f9b66dd5b579daeUL, 0x045b3bee0a0fabdbUL }},
+  {{ 0x402a24e11c7197c5UL, 0x4b9a6b5264296a95UL, 0xd335d937a2a0a91dUL, 0x25b40a3992840756UL }},
+  {{ 0x2d734fd142d6ba82UL, 0xd34df12861d18cb6UL, 0x5b6e83fc78fc4892UL, 0x1e246d226642cc64UL }},
+  {{ 0xe4a7a67b52f11e6cUL, 0x914bb7a48dd87861UL, 0x05a452c04fc64d7cUL, 0x1e6c6070072204f7UL }},
+  {{ 0x95cb43ed5db2a4deUL, 0x9159d83488d4b245UL, 0x16a8d1f373c9b27aUL, 0x06ee7d4c12f40b2bUL }},
+  {{ 0x401619535224a8a9UL, 0xe6ba5baa5ef9b44cUL, 0x65cde55212defedaUL, 0x04a4efae0ab9692bUL }},
+  {{ 0x273cb309f2e49cf6UL, 0x0278160b498dc284UL, 0xdf91ae379f1c04cdUL, 0x17488694f9b22fbaUL }},
+  {{ 0x771ecb9591350e82UL, 0x67a7d27160a1036cUL, 0x982318bf7c050a41UL, 0x21f41496ad6c50f9UL }},
+  {{ 0xf5ad9f36212bd96cUL, 0x9aef24f891dcb10bUL, 0x5d9a174ac7ccfa63UL, 0x29ac4cf023011b61UL }},
+  {{ 0x5a3a8189a97983b1UL, 0x232d3d4fa2ed33ceUL, 0x446a0c8e1f247f16UL, 0x21ada1420f9e0910UL }},
+  {{ 0xd70bd27af6a5bc9dUL, 0xfe26576c1b64e2e3UL, 0xbae013814a904683UL, 0x13d922b3c44aee15UL }},
+  {{ 0xe8dd872606dd2adcUL, 0x01242081779d3390UL, 0x844a4d273411d58dUL, 0x27fc9ef7c96e574bUL }},
+  {{ 0x8a8aa070e58b39daUL, 0xf600540cab85e674UL, 0x2903e95c713af7a7UL, 0x14982f3bcc33e6f9UL }},
+  {{ 0x263651820c8f2ff6UL, 0xf73b048ee6835559UL, 0x09bacdbc1c663d73UL, 0x0765279ce05fe19aUL }},
+  {{ 0x900dd3f927b1b8c2UL, 0x1b83239add1e546eUL, 0x1a4d4bcde7602ee6UL, 0x1b117bcd62be914fUL }},
+  {{ 0x48f5e62d8bd02f46UL, 0xca8dd9bf6cd564c1UL, 0xac3b11046d96d4e1UL, 0x27f427e5ef652c86UL }},
+  {{ 0xadd278b4be7499cdUL, 0x4e8c77fdabe9136fUL, 0xd824fadaf918da23UL, 0x203f062bcf73d19bUL }},
+  {{ 0x866b1f1c0f7343f2UL, 0xaf440f5adb4ab083UL, 0x9c6933ad7dbc2cdcUL, 0x2befae73d26eb5c2UL }},
+  {{ 0xbe584c0df421756aUL, 0x549f813d8ee9c150UL, 0x151c8a36f62638f1UL, 0x165d60e675c55a52UL }},
+  {{ 0xcbb4364b4699291fUL, 0x245ef687d9cdbaddUL, 0xaf7db5f165b93936UL, 0x10a81acbdd825253UL }},
+  {{ 0x75caf5e40f5ed482UL, 0x21744d88f80263e1UL, 0x1c4b0e0408518c1bUL, 0x0972139aed389e58UL }},
+  {{ 0x73721cc132c5a242UL, 0xb47fc9a3c8ab6204UL, 0xe30c4cdee4c40307UL, 0x1a4f7c7c8b1f543dUL }},
+  {{ 0xecf7d4a3c6a4f17fUL, 0xe0b5409ff425691bUL, 0x30197c56b51518cbUL, 0x12babe2c5f9b87bbUL }},
+  {{ 0xedf8d0b201fffa03UL, 0xff3061fdbaf2d517UL, 0x2bb7c444c777d426UL, 0x052469c879e184b6UL }},
+  {{ 0x091f87afae2eacaeUL, 0xaca9132f848c9e9cUL, 0xf94e0f9fd0d77a01UL, 0x09f03cac41e1e45dUL }},
+  {{ 0xfcffc669ae5a679eUL, 0x502f747a801c938cUL, 0x45187023cda7a793UL, 0x276e3b3b8bd2b994UL }},
+  {{ 0x96de496b5e76ab48UL, 0x07eea93c1f504268UL, 0x1d25ec39b9c47ec6UL, 0x0339836e92299fd3UL }},
+  {{ 0xa1afa8f282cc1caeUL, 0x8323b5ba371e0f95UL, 0x5ea6ee0b2d2f740eUL, 0x0389639fb0eec63eUL }},
+  {{ 0xd43345521b65dc00UL, 0xdfd928911cc74901UL, 0x1a7df22764bc370aUL, 0x06ef14773d2ff931UL }},
+  {{ 0x652dc363c3137359UL, 0x50d2294c6bb0774eUL, 0x90aeb10fd91d46ffUL, 0x014600f39a8f2adfUL }},
+  {{ 0x59bfecd45f7ee48dUL, 0xddcd3a156c7212ebUL, 0x3504ff5259e25e7cUL, 0x1ffb6fbe036ef6e3UL }},
+  {{ 0xc0cfc903f58be7f6UL, 0x2f10970d461ebfe1UL, 0x3cab580fd68cc430UL, 0x118a71da27be3dfaUL }},
+  {{ 0x7fe2197eac57e456UL, 0x1542a11b67d7dd4eUL, 0x701d56e4281449aaUL, 0x07d369016f6a6e03UL }},
+  {{ 0x784cede60540e6baUL, 0xa04a2940f824eaf0UL, 0x1acb043e3eece8adUL, 0x0b5c454f1b58d9d2UL }},
+  {{ 0xf9e1cd2cd87aabfdUL, 0xcceaa3ef42ef29daUL, 0x5d9c35778b8df357UL, 0x05071e21d3a2de7bUL }},
+  {{ 0xca27341c8b820f48UL, 0x060a2cb0fda818a9UL, 0x067039a3ca6d0231UL, 0x0107ad7b85761fc5UL }},
+  {{ 0xe16f4445aa9c597aUL, 0x3b3039903202ee67UL, 0x276263ae5bf7da24UL, 0x10b18ec7f24713bfUL }},
+  {{ 0x63ca9e7eeaa843e9UL, 0x69eec7c091801dd5UL, 0x039be0a27b6522adUL, 0x2dc0c44a49fe00afUL }},
+  {{ 0x101aaebd466a1a57UL, 0x64f525344237a3f4UL, 0x7786e2fe30e8b232UL, 0x234a860950d9db98UL }},
+  {{ 0x5606bc6bf6cb1b42UL, 0x1c099c7e53d7bed7UL, 0x8a791319c828479dUL, 0x2ef40cd4324edfc2UL }},
+  {{ 0xa7a71d0d1ddc56baUL, 0x33dc716a6d781c95UL, 0x124ce2693dc355cbUL, 0x20541519adf9a51fUL }},
+  {{ 0xa66bc57aa54a2bb2UL, 0x728da37be2eec5baUL, 0x51086dbc1935e652UL, 0x059b1bf29b2fc8feUL }},
+  {{ 0x85673300bee933dfUL, 0xc95fbc10ef37bbbeUL, 0x79035de60cccc415UL, 0x0fcea4af476bc15aUL }},
+  {{ 0x64d9acef9534ff38UL, 0xd640734ec7332c4fUL, 0x4d2d68ed36d0b196UL, 0x1ce169066980d1a7UL }},
+  {{ 0x99fd27db488fc004UL, 0x7fa4eb46aa2952ffUL, 0xd0e57d3d1eff34a9UL, 0x2df898ea03bf4aa6UL }},
+  {{ 0x1851298ce59af8eeUL, 0x922946c505fb5b1eUL, 0x530db75de71263ebUL, 0x2e21e1ff52fc4df8UL }},
+  {{ 0x9e979a21638c4de3UL, 0xa4e7f2f687d94e8eUL, 0x9a2777fce24cde8eUL, 0x00fac977904c47b9UL }},
+  {{ 0x973548235301529dUL, 0xe9b4b7ea136fb557UL, 0x31014dfccae9613aUL, 0x22b8fb5d40f15a10UL }},
+  {{ 0x8deff8009e71a3feUL, 0x97644e9535ddc963UL, 0xe6eb07cc0cf6bd69UL, 0x10e0e7a9af93ac68UL }},
+  {{ 0xe2b53a83c74c5950UL, 0xf40f7af30dd15472UL, 0x367345e3724cda6bUL, 0x1da1a9f0ac648e87UL }},
+  {{ 0x2e4f16aec2415e56UL, 0xaa812a87eb442ac7UL, 0xa6f40a9ffa20828dUL, 0x1cc2761567ea3b2bUL }},
+  {{ 0xcfc2086d5e3572d5UL, 0x185a88765c113d59UL, 0xfbf6510baf054b98UL, 0x08dd6ae514833055UL }},
+  {{ 0x8b6546f012fe912aUL, 0x35001fe292b11920UL, 0xbcd13f7d04d87f8aUL, 0x0198d03fd1402f5eUL }},
+  {{ 0xbe2fb15ae54d0506UL, 0xcbe3f99f06388bb4UL, 0x9de51874e9dbf4d7UL, 0x0c72f0ee86894c64UL }},
+  {{ 0xd65003375978dcf6UL, 0x84ffca045b987783UL, 0x1cd7682478d64ec2UL, 0x0e8c9e8e16e077ccUL }},
+  {{ 0xe59024cf5ddb89a0UL, 0x5933b84369f9702eUL, 0xe3679fcbe7b81b5eUL, 0x2cd81cf4ebf2895cUL }},
+  {{ 0x4761c18d93410b9dUL, 0xba796354db8931c8UL, 0x724ecafb74132950UL, 0x2e840d4705bb13a6UL }},
+  {{ 0x906048893154eeacUL, 0x8d2352cb02a5b581UL, 0x0af2bf05ce2e3340UL, 0x28056a8282d80650UL }},
+  {{ 0x9af2b2539ebe715bUL, 0x86a7b05037d1e2a5UL, 0xad3834ba16b36f94UL, 0x281ab387d0e7d889UL }},
+  {{ 0x035c660aa9ed7ab5UL, 0xa45a8e4c38145b8eUL, 0xc15741970afe0599UL, 0x16afe8d73f1d31bcUL }},
+  {{ 0x7cf60f965fd01ce0UL, 0x948dacce081ec767UL, 0x9233ea4992068f99UL, 0x1fda7cbf32bc3861UL }},
+  {{ 0x39dabb28bc6995f6UL, 0xc995df79a97c8879UL, 0xdfd3790dcd05281aUL, 0x2c337a41775789eeUL }},
+  {{ 0x714a68bf67e87985UL, 0x061df44b7972ea57UL, 0x885f2b20d96000d1UL, 0x1e58806a6b204684UL }},
+  {{ 0x7bbc910b7d3c101aUL, 0x7d46fff0aed336a0UL, 0xe602b734a74ba5eaUL, 0x2ccdb7e4800efae5UL }},
+  {{ 0x0a10edff9de31a0fUL, 0x13d8b6eecc94b0afUL, 0xa2652839d2e4f6fcUL, 0x15660fe8c5ef9102UL }},
+  {{ 0x99cbaeea9e28cb44UL, 0xbb373450ce970329UL, 0x100a6e8d2ded0ed3UL, 0x14b173a6c5cca304UL }},
+  {{ 0x660034f2375d37abUL, 0xc37c9ca8bc8d8e00UL, 0x03fbaca4ae758fa4UL, 0x0927245d4c5a18ecUL }},
+  {{ 0x0ad3c548c0fbd9c3UL, 0x4c40a2ef4da5a427UL, 0x5d972a0e636f0ff8UL, 0x0d64c7d71e75a15eUL }},
+  {{ 0x3bc4d4bff46f59f3UL, 0xfc9dab4b7aa89449UL, 0xb310d1d2cea0fdc0UL, 0x2dd12bce05516c79UL }},
+  {{ 0x6e166e7d8bc68a10UL, 0x45d0894c7b1a2aa0UL, 0xe538ec3850391fecUL, 0x2fed118ad5ef31f0UL }},
+  {{ 0xddc077cf3dca5c7fUL, 0xdd1d29c6323c9d80UL, 0x2981bbe223d6b1d4UL, 0x0985a6a39a02eb27UL }},
+  {{ 0x88e7e745d812bd7bUL, 0x20c803f69a684ac1UL, 0xf41100e013ae31d2UL, 0x19b4c58da0bb77fbUL }},
+  {{ 0xe043fa36567d1645UL, 0xb1ba3465dffcb908UL, 0x89c539035fa7a965UL, 0x2a1b57fd763dbc9dUL }},
+  {{ 0x1e6e48106ecdb83eUL, 0x7e887cc5c1930f13UL, 0x7c6add14aba0d315UL, 0x007ecd102793f211UL }},
+  {{ 0xcba9a9e459d1fd34UL, 0x51198f7cd4d24d52UL, 0x7e52c8d81b8c9760UL, 0x0e9cfe468e919b44UL }},
+  {{ 0xd603d25dda0afe8eUL, 0xe36323ad01208021UL, 0x56ac34aed317eb67UL, 0x00e9ea49f7f02fc0UL }},
+  {{ 0x6ccbef6f83cfb2daUL, 0x704d6ec3dc171b67UL, 0x76b3466b1d2cebf0UL, 0x033f0fed0eecd935UL }},
+  {{ 0x625f6f075becd6d1UL, 0x3dc6f6d81c4e0a2bUL, 0x511b2d81ad4f0e57UL, 0x1858c33a8b963262UL }},
+  {{ 0x79480f68755d557cUL, 0xd524c3628c8d8611UL, 0x1136d8b8a313d030UL, 0x2127edf638454f2bUL }},
+  {{ 0xe4994d5ae36a0a62UL, 0xbbebde3208b8bc6fUL, 0x0b61167e96b7bf3fUL, 0x187b9d1ef216da99UL }},
+  {{ 0x399e204bb6769ed9UL, 0x778f69ae79fc37d8UL, 0xd252ed193e2407afUL, 0x03f73793b9201e3bUL }},
+  {{ 0xc00efb64481e9ea6UL, 0xf75f22fe6cd6594fUL, 0x1b27fcd31b28f8ffUL, 0x141c4b5bd886eef4UL }},
+  {{ 0x4ea0ca091c7faaddUL, 0x54962ba78a5d44c0UL, 0x27826e89a6faae8dUL, 0x1e6d8011fa613cb4UL }},
+  {{ 0x462018e6a41443fbUL, 0x5d5371f701cd9253UL, 0x9095b8cbc93f9470UL, 0x16aeb37de7d0a3f0UL }},
+  {{ 0x4ef4c82dde891af2UL, 0xfd42a231d51db46cUL, 0xe703630733af917fUL, 0x06fa27016843c1f8UL }},
+  {{ 0xa48354fc63af5f12UL, 0x1080df0eaabd2cfeUL, 0x3d84720eb3eff489UL, 0x2929e2dd4eb4fa59UL }},
+  {{ 0x70f40092a97d40c4UL, 0xc367289d6d7385dbUL, 0x08a3dd928b7b53fdUL, 0x08111d6f10c3d702UL }},
+  {{ 0xf66dedac03b34479UL, 0x384a0fcec1813301UL, 0xae4f8bd874c34712UL, 0x0ea2283395050a6fUL }},
+  {{ 0xbfcf915576e2d074UL, 0x4539111f2144ec81UL, 0xc6bb32ebecf29e18UL, 0x1d69e81cb2b1cafaUL }},
+  {{ 0xb15ddf2c07c46ff5UL, 0x1e8f8ef565e6a123UL, 0x571526827173453dUL, 0x14aaf5d534208234UL }},
+  {{ 0xc1bb7b5d2fd3ae59UL, 0xfb50f2c6b2e4f9f1UL, 0x0a75acad9816fe94UL, 0x1b451b034f32c9a0UL }},
+  {{ 0x623db34b600176f0UL, 0xc7eac88ec981f094UL, 0x93dafcb3a0d0719bUL, 0x170beefe89ddada0UL }},
+  {{ 0x54bbcc0ae3e500a1UL, 0xd77622a9f9492dacUL, 0x226be8b17608fbb5UL, 0x2aaac56a9b362a39UL }},
+  {{ 0x95e35fa274e92e1dUL, 0xac390bc1f798cc68UL, 0xa07e5b8786e3a1d1UL, 0x1f987c0f62aa2a31UL }},
+  {{ 0x1ec9554069dab890UL, 0x965fc256c963d5dfUL, 0x77725f8cb10a1712UL, 0x1510403cc9d53d5aUL }},
+  {{ 0xffb73bb723814ff2UL, 0xe079b2364af27ceaUL, 0xea64130d10038d60UL, 0x1858415582838c88UL }},
+  {{ 0x140d825c56125e2aUL, 0x3a4cb3ef365e2f4cUL, 0xab184f59b4e8b491UL, 0x24c4a9c0e64e4fd4UL }},
+  {{ 0x65ae0d9f5985f635UL, 0x4037c546b471b118UL, 0x89499e1b3a149ff4UL, 0x0848d6b8a69515eeUL }},
+  {{ 0xec9ac6a1006e0fcfUL, 0xc093fa141f99a783UL, 0xc07d520da1b009c0UL, 0x04e9f87d1c5dbb4fUL }},
+  {{ 0x9d44307f068210d8UL, 0x8f528a42ed6f72abUL, 0x93ad7df81ea6c0eeUL, 0x0fb00df95f71297eUL }},
+  {{ 0xf768c0bd50379eddUL, 0x2b4780e4c6a1f718UL, 0xd4afdd228b347c9dUL, 0x2633a7484910cd7eUL }},
+  {{ 0x57d43446297b5bc5UL, 0xfe20ec906c3e2599UL, 0x94ce10b1e560d70eUL, 0x0dccd5b162866b63UL }},
+  {{ 0x6880f298bfe8d129UL, 0x90acc76d7084e50dUL, 0xe202fd1995c64b10UL, 0x16055ece34bde382UL }},
+  {{ 0x8ebc7ce907b9e1d2UL, 0x947c42ed47f3ea10UL, 0x5d298e1500f9804cUL, 0x09477dea8811d078UL }},
+  {{ 0x48acc79c7082ecb2UL, 0x90d35f80c1f4db12UL, 0x239164edbc1c9114UL, 0x0f28d5c4126c7550UL }},
+  {{ 0x6761a0c789a08ab4UL, 0xd89391f2f89f1ea5UL, 0xf380f582d02f76c5UL, 0x14e4412bc8574850UL }},
+  {{ 0xa8c01f698201ade0UL, 0x19767f166bb0849cUL, 0xfdac469ac69ecc9bUL, 0x0f09d5fe15f2cd3eUL }},
+  {{ 0x76ea758f19feb39aUL, 0xe61fdb6210817049UL, 0x7107df1640c95950UL, 0x21c2fb995145ab9cUL }},
+  {{ 0xc405d1e0310fd2d7UL, 0xf7e5dad64ca344efUL, 0x04b68edaae84b654UL, 0x140c2991bef4e032UL }},
+  {{ 0xf08e51451c9ae0daUL, 0xb5771a8b8146ac89UL, 0xe4688898bef3e7bdUL, 0x17b39fd44d94d4fbUL }},
+  {{ 0x415bd6ea448c2f6dUL, 0x65b2683d2bf1b458UL, 0xfaa4d46b2fc76642UL, 0x0080dfa6e8def63bUL }},
+  {{ 0xe641a5c45b5640e7UL, 0x7039a093ac751786UL, 0x6283ba4d98b9f61eUL, 0x1393f73beba4de1cUL }},
+  {{ 0xd190026292075a77UL, 0x9f028e8f1f2b4b48UL, 0xca0e058f7a3e1bb6UL, 0x030ea81e76286b56UL }},
+  {{ 0x0fe23be62297995fUL, 0x5d475d5352231709UL, 0xb2800e80fc3b7d80UL, 0x0aeac23bedcc6facUL }},
+};
+
+static const fd_bn254_scalar_t fd_poseidon_ark_13[] = {
+  {{ 0xba41adffee856c88UL, 0x9921fe55fd71cc53UL, 0x9733baca82a86723UL, 0x0595cab62c5e06b8UL }},
+  {{ 0x94db7429e3e6343cUL, 0xb359eaf7ceaa7739UL, 0x9a6f882fbde2339aUL, 0x02d76ff5dac580e6UL }},
+  {{ 0x2f35e3b75578279eUL, 0xde73f63fd2e15ad2UL, 0x9bed6bdaf03b9c58UL, 0x1c8b9f2e4e2f00f1UL }},
+  {{ 0xfc13ffd41d020efbUL, 0x7c0f089d862f27f2UL, 0x4a335024e21208edUL, 0x1cfdd553ecda3585UL }},
+  {{ 0xf4890e73bca71fa4UL, 0x562264ccd7b35b83UL, 0x2ae9ddae54c81dc1UL, 0x082473459790e80aUL }},
+  {{ 0x1d8929f99cc9016cUL, 0x9f33289580a5f843UL, 0x557948cf9dfdbf29UL, 0x253a5eae0b52d498UL }},
+  {{ 0xed559aeadfd8459cUL, 0x1e1c984254b25cc0UL, 0x6b3e49ca404bf881UL, 0x1ff5d55d0b1c3c98UL }},
+  {{ 0xadd4e65d4126ff4eUL, 0xa0398bf39ba3aebdUL, 0xbb9f15ad07c9b371UL, 0x0bd578b822ea0477UL }},
+  {{ 0x54ceabeb0773cf0cUL, 0x9beb5709b863fda5UL, 0x0f1d34ebe168477aUL, 0x0c4d110e09722f71UL }},
+  {{ 0x460042a255ad3198UL, 0x41c50d5581625a17UL, 0x91a9b9065f0dfa52UL, 0x28fc27bc1c4c1d51UL }},
+  {{ 0x396b0040576b5f97UL, 0x756a37dca72ed771UL, 0x98a893ab561420b6UL, 0x1798f5919e1c0813UL }},
+  {{ 0x381d54b7bffcb332UL, 0x1e38fbcc41e1711bUL, 0x2cf98a09ece580afUL, 0x17ac34e5688cb979UL }},
+  {{ 0x2767b2228ada0c74UL, 0x803515e3ba635dfcUL, 0x467f5529de01d62dUL, 0x14c2798c07b8ffa6UL }},
+  {{ 0xe55d2cd38aea24ecUL, 0x6d366d1022cf9209UL, 0xdcfe1b57ffbd0b28UL, 0x0c728351177e28acUL }},
+  {{ 0x28e30959cef76414UL, 0x695b491c39338e6eUL, 0x117ea98c33dd3e61UL, 0x099eb56b383eeb50UL }},
+  {{ 0x4e24ebd03c7001b4UL, 0xac95ff0979a7ce2dUL, 0x3108d8d08b0a1954UL, 0x10887e7cc0a8e113UL }},
+  {{ 0xde69876aae18d3e3UL, 0xabe3a4b0cfd3d4b9UL, 0x873a4af90c91f316UL, 0x02fa67939ceb17fdUL }},
+  {{ 0xae88c589fcdd339bUL, 0x118731564478eaebUL, 0x2fcb8c024666e22cUL, 0x12424a1ec3ad1f71UL }},
+  {{ 0xfaf70dc7c2342afeUL, 0xf89710a886b2d01aUL, 0x6579586e21f71c39UL, 0x22604b5022838e0aUL }},
+  {{ 0x80d9906487099fe0UL, 0x69776b7d54572e5cUL, 0x0585dd137a27c7cdUL, 0x2ffc861ea1c14936UL }},
+  {{ 0x1174514f4669dd79UL, 0x0fa35d0f6c59e600UL, 0x1c3e9e262c51efe7UL, 0x2bb1d8abd2a9aa66UL }},
+  {{ 0xa931d703267aeaebUL, 0x45f20610b6bb8cb5UL, 0xdee5ddd6d6ca7d33UL, 0x06b65a48331cc436UL }},
+  {{ 0x1e4f8a75bf4bc911UL, 0x1f4b986b5835ba57UL, 0x64e53a6ad26b699eUL, 0x2748642602518faeUL }},
+  {{ 0xc8a96d08528e4e90UL, 0xf168ac3b5349ffccUL, 0x31e71d1a73402026UL, 0x15ccc8ba1c0058a4UL }},
+  {{ 0x240b14dcdf0048eaUL, 0x3339384466c83546UL, 0x89fdd820b8686507UL, 0x041293652abd71f5UL }},
+  {{ 0x568189269abe2635UL, 0x021a6ad5975d928aUL, 0xfe2f67cb49c21896UL, 0x08457b23f5bcabdcUL }},
+  {{ 0x7c8f3fd6f1ac5831UL, 0xc5cd2d6ff55afb7cUL, 0x5348b03b030cfda5UL, 0x0e202310cf238a11UL }},
+  {{ 0x6236a1d9d5edbbdbUL, 0x0d0f75eba2317d6aUL, 0x60f87388679d60b9UL, 0x2bc4675ce6b4005cUL }},
+  {{ 0xc038562796aba193UL, 0x6bdc49feaa62b84cUL, 0x274db0651a65f5ecUL, 0x2d1aed9d5f7b76faUL }},
+  {{ 0xd3233c8b1904678fUL, 0xe1b3ff78e06cea7eUL, 0x751cd1195080a3ccUL, 0x0935d05966109f67UL }},
+  {{ 0x07832f285371470bUL, 0xde1cc61ef8a465c4UL, 0xa0b55630c703e4cbUL, 0x17b6e23a2598d2a3UL }},
+  {{ 0xe43a840bc5f79d00UL, 0x228f02a57329f376UL, 0x5b183ab2d6bdfaaaUL, 0x17612183246c3ab1UL }},
+  {{ 0x5fb59c56d7af496fUL, 0x4ae016470012f8e7UL, 0xa5333cdbbce10990UL, 0x2003fce27f04d934UL }},
+  {{ 0xf58de20badf5900fUL, 0x7cba80356c0b180fUL, 0x9f748bd4ebe65e3fUL, 0x020b87bedd1fe6f3UL }},
+  {{ 0xf4b96d894c5dc941UL, 0x12eee982db911f82UL, 0xdf0fbe9cf82d321aUL, 0x0c3aba396584eb89UL }},
+  {{ 0x8853924bd4bbe423UL, 0x9b33a5163557e074UL, 0xae381ad923ee1d58UL, 0x1f9f86c9b3e5bc71UL }},
+  {{ 0x3dd3a6d446bd6278UL, 0x51644349a89be77bUL, 0x5ec133b4123130cbUL, 0x28e66ef589d8e9a8UL }},
+  {{ 0x8eff090a159d8491UL, 0x3f6ea7d05c5d5d25UL, 0x336fc0710642a9b2UL, 0x2934503cb7941cf3UL }},
+  {{ 0xbeb23495895da533UL, 0x7b3e0aac5564746dUL, 0x5621a5891c0e00d5UL, 0x17eef97ec00fd855UL }},
+  {{ 0x32ed175caeb7a5a7UL, 0xfee7976fdf0bcb02UL, 0xfb0dd9d95b5480ecUL, 0x1dde9e3b96024e1dUL }},
+  {{ 0x1c9c7e8d2ee882f3UL, 0x67995774ce9b110aUL, 0xef39f9ad92b2f9b0UL, 0x21bfeea4fd1c1abbUL }},
+  {{ 0x5c75a400e1e4db37UL, 0x4ff3b80537f1404fUL, 0x1c35ef7b27faff3cUL, 0x227325ce492e5dacUL }},
+  {{ 0x08ac40702f7a9a57UL, 0x5cb027dc657d53f9UL, 0x59bd2f17a2ecb26dUL, 0x1a15aa0d267c2148UL }},
+  {{ 0x1c87f5054761f2d7UL, 0x39b0eb3229fce72dUL, 0x163ec18e446ea437UL, 0x0c0c6f21e78c3813UL }},
+  {{ 0x1b41df483d908b05UL, 0x86fd79f10fa28094UL, 0xb3de8c3e44db8f3dUL, 0x223a2235d694d228UL }},
+  {{ 0xdef601657c3f5a7dUL, 0xe9826f4db2bd8c80UL, 0x77eaa17cd1ea21c9UL, 0x2aec72605a7e7b0aUL }},
+  {{ 0xd56a33aceb075b88UL, 0x0ff946ddbbba226fUL, 0x2545a2982854090eUL, 0x163373be04a40702UL }},
+  {{ 0x875c82e9fd3df13fUL, 0x27101cd6c8fdaabeUL, 0x79224f4f0a37ff0aUL, 0x2acb6cdbedfbc748UL }},
+  {{ 0xcbbb1cd7cdc4d4fbUL, 0xd52f1f156e98f2e9UL, 0x1e64b860e2ce7cc3UL, 0x142cc44451267f83UL }},
+  {{ 0x281c4785836cbb71UL, 0xddbbe0b759a28d76UL, 0x0a0e8817f08c1d97UL, 0x21e507e744423600UL }},
+  {{ 0x466709e974bf6375UL, 0x03569146d7523f92UL, 0x1d1a3fcdeb87266fUL, 0x01340f9c5abea6feUL }},
+  {{ 0x28b508e9eb002f3dUL, 0xf6c9ff32d56afcc5UL, 0xc79e5b24cdc9b6d2UL, 0x234fe6a8d19e73fbUL }},
+  {{ 0x09f1989e9d9c9655UL, 0x6b06ae5e60d925ccUL, 0xe7bbc0ae5decfff0UL, 0x25ee4502b73b9128UL }},
+  {{ 0x50c1d72672397338UL, 0x9b8587adcdc5f38aUL, 0x1db55f3107d5fad4UL, 0x227170f9746c67e9UL }},
+  {{ 0x55aa9e2094f1e9fcUL, 0xb0a7af83db4cec28UL, 0x96143d395734a32eUL, 0x15f74658d246c881UL }},
+  {{ 0xa70677a316df7b57UL, 0x1f955d4fc3b30a5eUL, 0x913812acf8fb48deUL, 0x18ccf9be5db39cb4UL }},
+  {{ 0xffe991c12dc20c64UL, 0xbfb36b03533b11e5UL, 0x0bacb6253d3ae942UL, 0x2506de63928cb4caUL }},
+  {{ 0xebca4adc069a6382UL, 0x47625120aee8a9faUL, 0xfe6ceca6e402398bUL, 0x1558de29da7613e8UL }},
+  {{ 0xa21a8397651bd1a6UL, 0x1c847828761abacbUL, 0x8feb4cfd3321d13eUL, 0x0ec7377ff1ed9c63UL }},
+  {{ 0x75eae03a8d91c2b9UL, 0x4e821b5ef55d05a2UL, 0x50c8b04cc44001e7UL, 0x14ce8e71db6c1e12UL }},
+  {{ 0x85086baabf2f4d7eUL, 0x786f406129251525UL, 0x5af6f7244fd89c52UL, 0x12398233a0eeca05UL }},
+  {{ 0xf08c9ed89ea7c5f4UL, 0x01d0fd4cf8e3a49eUL, 0x230fbf90db00b3c2UL, 0x0ee1400730f72e0bUL }},
+  {{ 0x05d74351a7a961dbUL, 0x270dffea16320ac8UL, 0x92db07c13ae3dc5fUL, 0x20504fdcb1a03f56UL }},
+  {{ 0x53173bb329cf3eb2UL, 0x85994827564a92f4UL, 0x44bfca0778834afeUL, 0x2309df15f952c75bUL }},
+  {{ 0x61e3cc14266b623cUL, 0x1989c172f6768941UL, 0xcce6c0e0cdb8f3aaUL, 0x0047082bc3d96312UL }},
+  {{ 0x11547dbe30de49bdUL, 0x5fdaa82a0f1f8eb6UL, 0xed818e9259609971UL, 0x11ebabb42655c490UL }},
+  {{ 0x5d1efa5dbb1cf61dUL, 0x20bd7c7bb596208dUL, 0x2511c42334b3557dUL, 0x1a3f941e3ee55834UL }},
+  {{ 0x5e173e81b119329bUL, 0x13290d8a485baee5UL, 0xeb8e404b68e82a03UL, 0x2bd451032bf68ce3UL }},
+  {{ 0xb227f22718e7c68dUL, 0xaa52d8709f227134UL, 0x120aabb91c28b4bcUL, 0x1346df25f5023885UL }},
+  {{ 0x93f8966a2794a2acUL, 0x249e2953cefe8897UL, 0x64332d49f1e134d7UL, 0x22f961e46ff2870cUL }},
+  {{ 0xa34d0868eed4297aUL, 0xe75614dae7f59ba7UL, 0x7b2452bacc517492UL, 0x0bbd41af64175627UL }},
+  {{ 0x141d874c88d51fc8UL, 0x0a7f6b35aa9b606fUL, 0x442d7e5e30eedda2UL, 0x1ad4d0e64c648ba6UL }},
+  {{ 0x7282b751b482f7daUL, 0xf3ce1f5bba0a73faUL, 0x20e1d238c81424d5UL, 0x17600c8d9f6800bbUL }},
+  {{ 0x134ea68676188215UL, 0x2c733a7a8bd55810UL, 0xeea7dc335f827548UL, 0x00dbbf4fb659628bUL }},
+  {{ 0xcec307b49c87fcdcUL, 0xff15f5d5b7f942d3UL, 0xd8b43ce9b735d7d5UL, 0x2202d697acc06892UL }},
+  {{ 0xb4777c4ef267a956UL, 0x0c6aa3619da59ddeUL, 0x84cba3e5209b1ffdUL, 0x10ed2114831212f3UL }},
+  {{ 0x76e15863ae077ea1UL, 0x6ecf94db23b025daUL, 0x64d7ac38e7269a78UL, 0x2280d0895d6242fcUL }},
+  {{ 0x1feeaf0cf0f41142UL, 0x8d81b1d78539aedaUL, 0x945e198bef86b8c8UL, 0x17b62307f3bbe2ebUL }},
+  {{ 0xf2ecb9abad0188f5UL, 0xd631b180b7ba2a4cUL, 0x173d5649d8788722UL, 0x0543ed2c24ed2cd7UL }},
+  {{ 0xfd79cb64e6d3618fUL, 0x4eec3b8295059b06UL, 0x71d8de6ac0a7426aUL, 0x2333c8e851c3d464UL }},
+  {{ 0x9ee80a4ae3afebdbUL, 0xcde51eddb34faf8fUL, 0x95ae39584e75f89eUL, 0x2c6317c351a528ccUL }},
+  {{ 0x424f90883af63fbfUL, 0x17088e35c95610ccUL, 0x583035f1cff04242UL, 0x2e813f07f9cee4cbUL }},
+  {{ 0xcad20615ae8125ceUL, 0x074296dd05930f10UL, 0x15c51eebf877e678UL, 0x120199fb09ae7002UL }},
+  {{ 0xe349e2aac3487ebdUL, 0xa41ab585044c8183UL, 0x118faaf269e13740UL, 0x062e3576c102e3a8UL }},
+  {{ 0x7d4f73df2e3d7b18UL, 0x5394acb1270e9474UL, 0x779b685cf9ad2df9UL, 0x0318b40ed2f64386UL }},
+  {{ 0xe8a6ced2a9d13838UL, 0xc30815281b589a19UL, 0x07cec3a05e3a24b8UL, 0x29aedc8b33e4e828UL }},
+  {{ 0x117ae1b31423c941UL, 0xf465e5afb05e9ed2UL, 0xa3c4cbaa5edb31eeUL, 0x29e0d6d4bafacc1bUL }},
+  {{ 0x94a36519fd61380bUL, 0xd5b2efd2008e4fd8UL, 0xf51b1d55eda88f8aUL, 0x16093d34bfd09444UL }},
+  {{ 0x00df8abd1013c9fcUL, 0xfe317086fd4c4f0fUL, 0xe598028233c107deUL, 0x0606e55e4bd48d7bUL }},
+  {{ 0x6773d7d1863c4013UL, 0xee483af74434c3f6UL, 0x5a2cfd6a9d6a1c92UL, 0x1fe24feba254a11dUL }},
+  {{ 0x284f968fb93ac268UL, 0xb6fd59a96eb48772UL, 0xf89d0dbb52822553UL, 0x22439e044eb0703bUL }},
+  {{ 0x2e3bae99826babd0UL, 0xe99c639751a31755UL, 0x4eda643c4b913813UL, 0x1900a2968cced320UL }},
+  {{ 0xfd8518537bf3fd56UL, 0x4170f5aba1f3d449UL, 0xcede42db79156c60UL, 0x0261d9ce72940d44UL }},
+  {{ 0x3e9f122221a61492UL, 0xbd7b3eea2a1f9f77UL, 0x3c318e97978d098eUL, 0x0dec8f11db09832cUL }},
+  {{ 0x052d20c77c9372ecUL, 0xbe6e8cc753f33492UL, 0x32a951a3551c37edUL, 0x12153cf83f32f8ceUL }},
+  {{ 0xe0e567f13d00fe7aUL, 0xcf71fb14f178e211UL, 0x9f11eea9ff56e779UL, 0x2aa761aca85dfc01UL }},
+  {{ 0x7b4e95e5bf4a509eUL, 0xec80dc1095453dbcUL, 0x0518348287b8b6d3UL, 0x221ecd5c212c0b11UL }},
+  {{ 0x16eb33299242d171UL, 0xba3af78904272fb8UL, 0x2dc86f466af76f7aUL, 0x295b1cbbac809fb7UL }},
+  {{ 0x0e15c2dc000eb362UL, 0x21ada65d1674395cUL, 0xc0bb0b4a4b4ddb15UL, 0x12c6b41c5fb5ec0eUL }},
+  {{ 0x24d0570a8325e221UL, 0x02a423682704d769UL, 0x6290b52f87f3617bUL, 0x1cd6e7a94b2514f0UL }},
+  {{ 0xa67879221937d6d9UL, 0x6a525e2ae2745ebfUL, 0xdfa953e06c582984UL, 0x1e85e2bd101128e0UL }},
+  {{ 0xba88a568579e3142UL, 0x91c978cd3cf58d70UL, 0xca9563a1034d6db9UL, 0x035376b301e85c4eUL }},
+  {{ 0x8e66dc0e3e48ecd0UL, 0xa8f6a1509f89f419UL, 0x6b51b509584838b5UL, 0x11e5c041afb283f5UL }},
+  {{ 0xcfaa03c7303cecf3UL, 0x725dee9769b8302bUL, 0xe6077d11354508cbUL, 0x1de74ccad2a51e4cUL }},
+  {{ 0x3f32d745fa4cc723UL, 0x7140f93aff5c3212UL, 0x04da8f38a5daefe4UL, 0x2301e0b38c32ed95UL }},
+  {{ 0xd8f4521f0af5d4b1UL, 0xc8360ddf650abf19UL, 0x53bec203e8b04ba7UL, 0x137a02a5f8542570UL }},
+  {{ 0xe3c3cbe429dd1cd3UL, 0x273756c2eabf3c1bUL, 0xd9d79e4f21e90919UL, 0x1226ef24a66c1b75UL }},
+  {{ 0x8b3e53a39f259588UL, 0x1155428ac24c50e4UL, 0xd3fa758714db4699UL, 0x29cefbcf5f80a85cUL }},
+  {{ 0xca81e247d85880d9UL, 0xd70fd7f713d667afUL, 0xbd3b0abdbb9aaf96UL, 0x1783b8024543e51eUL }},
+  {{ 0x57436a530c3ab612UL, 0x2a67452d123280efUL, 0xeedc2901b13e34dfUL, 0x15d991a46d9b8c48UL }},
+  {{ 0x84b71cd7b37ae61aUL, 0x6cb747dc12df1ad4UL, 0x325955266f52afa0UL, 0x04efce847853db03UL }},
+  {{ 0x034d6310bc1b9f5fUL, 0x0dc05ca52476f00cUL, 0x1821c581d0a35c06UL, 0x10a664a124364206UL }},
+  {{ 0x6eb1fb8cf1948ac9UL, 0x3ece0fcb283e58feUL, 0x86fdd1a24798348dUL, 0x1922cae4f0f8953bUL }},
+  {{ 0xf037f4dade0fd6ecUL, 0x525e04e096484d1aUL, 0xed546d9e1ea07c62UL, 0x2c80977611072cc7UL }},
+  {{ 0x303261071b604c46UL, 0x605b9ff044a158c3UL, 0xa563ff75c5f67435UL, 0x2157b8357933be88UL }},
+  {{ 0x4a0caae2339a9777UL, 0x83762d2d9d8182a6UL, 0xe8b12759efb7e4d0UL, 0x125ca25649638c41UL }},
+  {{ 0xd222e49fd1fcd0ddUL, 0x27196f361c70a689UL, 0x985f2245de98a144UL, 0x13dacfc15882e8b0UL }},
+  {{ 0x8eea673046bc31f7UL, 0xd6e5fb3dfb4c9fd1UL, 0xfd107d4e20d18f52UL, 0x11ea06a7b322014fUL }},
+  {{ 0xa43d10d50366d727UL, 0x0846008716214c99UL, 0x410d88516d5c10f2UL, 0x0e3f6cde33035797UL }},
+  {{ 0x9f36d376a0c99785UL, 0xd58ca3d3e5741fa1UL, 0x922010733b73d93bUL, 0x2b13210c76a80937UL }},
+  {{ 0xa63226700ce47dfcUL, 0x84ce3ca5f6016d0bUL, 0xc9c14a519aec4998UL, 0x03e063bcf13e2f7eUL }},
+  {{ 0xda63c5664c59336fUL, 0xb77b734867325973UL, 0x7a0f061e6e109098UL, 0x0c216da9c5fb5008UL }},
+  {{ 0xc1a1b3197db393edUL, 0x0d17746f55ac4822UL, 0xc1a03158f72c7bf7UL, 0x0d4f8be2bc97e805UL }},
+  {{ 0x5ab3b4f848d2648bUL, 0x472de18d9a927653UL, 0x470f3b6128fe4638UL, 0x2f1297a6b051d4acUL }},
+  {{ 0xeb7a602deea76e8cUL, 0x8962e0cce0717e93UL, 0x56366b32ff5e4c68UL, 0x24deec08da078b95UL }},
+  {{ 0x07f4f403548b7931UL, 0xea471fcd8ccc9d5dUL, 0x479197986fafba70UL, 0x303c5164868ba177UL }},
+  {{ 0x90cd3c48d525895bUL, 0x7e759fa4dad75d67UL, 0x421013bb323f432aUL, 0x1280b5ef2ebd2ee7UL }},
+  {{ 0x5e027f7e2e5ff63bUL, 0xc385ff89dbddca7dUL, 0xf9c89f2982fdc797UL, 0x053cc1b18b08e8e5UL }},
+  {{ 0x8a0e3ccc4a752238UL, 0x1873b3a676b436b0UL, 0x5e720a820333cee7UL, 0x07c1ee7d6b8ce3c2UL }},
+  {{ 0x288744c93dafd617UL, 0xb59c514b91fd7320UL, 0x4fb11db31c76bc24UL, 0x04a62755b3db9ec6UL }},
+  {{ 0xc70798aebab4bb9fUL, 0xd4154a2036549b16UL, 0x4dc9d65294a156cbUL, 0x053f01615221eacdUL }},
+  {{ 0x28a3306adbb9c899UL, 0x18fa05ce25b72d2dUL, 0xd3734600df306cdeUL, 0x1b1b0cef88554222UL }},
+  {{ 0x76cf6168c4e6645aUL, 0xc9d8507c380f84ccUL, 0x710e6227471c16c8UL, 0x068f3fcf626f4378UL }},
+  {{ 0x82bbe0e585c1cfe7UL, 0x963cc6ccee56c605UL, 0xc8b8cd9c189f0ac6UL, 0x0fca903727841957UL }},
+  {{ 0xaa7df960111733c5UL, 0x166c71ffec1f9759UL, 0x0a3d1d4e785a40cbUL, 0x2e69491db532ae33UL }},
+  {{ 0xee3d3dc653bb16b1UL, 0xfa61f4c8d01ba625UL, 0x2deef44f37d6d841UL, 0x0f647584c0bf339bUL }},
+  {{ 0xbcbc889752b479bbUL, 0xbead136a7edaf199UL, 0xb9b644c503afeaf5UL, 0x17b371c033971496UL }},
+  {{ 0x690e433d4e472329UL, 0x1a1f155cf61725f2UL, 0xe75b3e9769012454UL, 0x2406df26336503cfUL }},
+  {{ 0x3368699b791c8e67UL, 0x28d15bb94d383100UL, 0xef81f29bd391d29eUL, 0x0a43fca3fc4c1e92UL }},
+  {{ 0x7260ab2dabe98a5bUL, 0x529789f63f75dfd2UL, 0x9d53390c7051892fUL, 0x23c8de662c72bf5aUL }},
+  {{ 0x6137831d6bdded0bUL, 0xc64a44aa59423930UL, 0x51b774b3a0bed7f8UL, 0x0d1cb6149d046b11UL }},
+  {{ 0x5e8e9be58b8383eeUL, 0x2dd5e30ff91bc47fUL, 0x1a5887e6d5c2cb0eUL, 0x0efb67a90dc4cfeeUL }},
+  {{ 0x57993df209314e72UL, 0x53730cc8d5d7cb42UL, 0x3d29efad995856b1UL, 0x0197386437d70e53UL }},
+  {{ 0xbf3f17667ff647b0UL, 0x74a73bf370c2ed1cUL, 0x6e95981ec85f04c0UL, 0x1a8352942cccdd1cUL }},
+  {{ 0x48e0bff935dc3145UL, 0x1ac0ad4b62faaa30UL, 0x4fc435e356a0298dUL, 0x237e9be62c139453UL }},
+  {{ 0x523bf3d55ae5145fUL, 0xc4bf03898beec469UL, 0x3f3427b8d5cb7888UL, 0x2e597f355fc1ce39UL }},
+  {{ 0x32256745f23caab5UL, 0xdc8a9e185197ab75UL, 0xc0025110a0938327UL, 0x0a98eb6850ea4f64UL }},
+  {{ 0xeabc4ef15c2aaabcUL, 0x451061353a75c662UL, 0xffa6a4cd48d49792UL, 0x047d82807399b14dUL }},
+  {{ 0x72ce5fe6f0c8f0d8UL, 0xd12db312357be34dUL, 0xde52671943127256UL, 0x03cbd09e8d9025e3UL }},
+  {{ 0xcd0a9ccb5a4e9828UL, 0x65633cd2b636ad49UL, 0x9a3323b177c38fdaUL, 0x1d2c1828bb1e9fd2UL }},
+  {{ 0x8b2d16c17e89cd2aUL, 0x723d71a4750c56f7UL, 0x3539ac469a5f3d3dUL, 0x21a6902c85fbf233UL }},
+  {{ 0x3eca4f0a75ec7e6aUL, 0x6f54783fbca6f9f8UL, 0xe9c091bf2ac7294aUL, 0x232e3b95517f3df6UL }},
+  {{ 0xbd38ea05c7d9fa90UL, 0x270e5db83783d965UL, 0xede006c09736bf60UL, 0x2556b02ea8055148UL }},
+  {{ 0x1cb4881edf1aa728UL, 0x2943f3d2e479997aUL, 0x659ac3d5cc5c1424UL, 0x2b6c2b5f5539f356UL }},
+  {{ 0x69e45863edcd9d80UL, 0x750a65c077bf055eUL, 0xd34f6be836fa1f38UL, 0x2e4fc7c36e3187ddUL }},
+  {{ 0x4ecce58ac933e406UL, 0xc2eb8855918d0ed6UL, 0xe8e6a7a00ce7882bUL, 0x123845d26c830208UL }},
+  {{ 0x20cd7ceb290e7c2cUL, 0x0198a8c654ff76ceUL, 0x6bcab8f2e506e4a3UL, 0x114bcdd5f3ea027dUL }},
+  {{ 0x42815424e742936bUL, 0x4d03307a00aa2c58UL, 0xed20197b2aecc3eeUL, 0x0c788ec385c86f93UL }},
+  {{ 0x0e4027b1481ef46bUL, 0x7dfdff9dc6b3d9ffUL, 0x49e69c7e0c9b351aUL, 0x123236d593f3f2eeUL }},
+  {{ 0x11788d0155d9684aUL, 0xe8f7432e00d4194bUL, 0x3657c3ee4deac169UL, 0x11db66d995880248UL }},
+  {{ 0x8766ded17bb561cfUL, 0xdbd07e4f2a0593d6UL, 0x03dcef0edcaf1bf5UL, 0x1b2ed5541b3bb740UL }},
+  {{ 0xd11f60d11421e1e3UL, 0x8bfd273111a9e2f2UL, 0x0c2bcb3107b2193aUL, 0x2fee38d0a6e7f57fUL }},
+  {{ 0x0ed7a7550b303b3eUL, 0x3f9fffe2497084e1UL, 0x34e6e777de32c643UL, 0x24ecc3becb64d1c3UL }},
+  {{ 0xd5c98b546eead5e1UL, 0xad090f1be1c68803UL, 0x5ea316c37ef28e90UL, 0x17261a210eb813a0UL }},
+  {{ 0xdc834766c9c32cf9UL, 0x6c2d1210e387e62eUL, 0xd055eb933b46fa37UL, 0x15deb38899fa3187UL }},
+  {{ 0x445c37d2b6568792UL, 0x674c60ddfc51afd3UL, 0x9a5847be5b945f55UL, 0x15d3cd2df305c34fUL }},
+  {{ 0xc6c6cef25956d675UL, 0x261e8cfdc847f0aeUL, 0x5d56321d90411eb1UL, 0x1e41f7ab769aafdfUL }},
+  {{ 0x414c9c0af004d413UL, 0x53b6944334bd5cc5UL, 0xf76cc897eae3633dUL, 0x0bf3580722020e58UL }},
+  {{ 0x39632af373198213UL, 0x4361c90342cb59b6UL, 0x07a8c2aac5613edeUL, 0x24560cf5851bb284UL }},
+  {{ 0xe60610fc4a770d78UL, 0x1f9548b7ed899a75UL, 0x2a2b1b24c7a80bb8UL, 0x277ddd23deeb64cfUL }},
+  {{ 0xd86b26fd84f4a8e1UL, 0xf329459fe36fb168UL, 0x5f75054decd1047fUL, 0x3061bdf6eab386b2UL }},
+  {{ 0x9f43b48efeb70f2fUL, 0xf53963fc0bfc6956UL, 0x2c68ab61622deac5UL, 0x1c5983fff198879eUL }},
+  {{ 0xa34ecf2c8983e862UL, 0x87f47324e6075e99UL, 0x71624e4bed0d80f2UL, 0x1ae8275249b4c95bUL }},
+  {{ 0xa1a4d90ea7aaf015UL, 0x775f8d91596b0547UL, 0xdead651e43de16c3UL, 0x196879657af2022cUL }},
+  {{ 0xa3a3a95f7db118e9UL, 0xbf850dc39be42765UL, 0x99e3c6f4a7523e4cUL, 0x13e6e3a9e80a3e27UL }},
+  {{ 0x1c05b65885658f79UL, 0x51498b8ddfbf169aUL, 0x34869203468fb93dUL, 0x1fc330e188158d50UL }},
+  {{ 0x5d799ffaed370e61UL, 0xea6929735b58c16aUL, 0x81c29a4319c02022UL, 0x06c1b148a716e7bbUL }},
+  {{ 0x1d6de8ce1da33688UL, 0x196db11dfb65e3eaUL, 0x7cadec0017d7af1dUL, 0x0159240515652fddUL }},
+  {{ 0x91d05768cf61eb96UL, 0x42e7ef5de1cd841aUL, 0x1f717378a46d4513UL, 0x021e472a6e7143ecUL }},
+  {{ 0xf9094120b53e56a1UL, 0x79ff0fb8f678d411UL, 0xc2bda83eaace0a42UL, 0x013b7824b06c1c1cUL }},
+  {{ 0x588cbece913e1d19UL, 0xcdac3f9f9033216dUL, 0xe7caa1fe9e56ba89UL, 0x1bc79214c160c591UL }},
+  {{ 0xe769b102a9a55b06UL, 0xa427a80fe2e14692UL, 0x6e04cdf1b389dbe8UL, 0x2e84f4ecd226a7ddUL }},
+  {{ 0x5016593f6ad4c3c8UL, 0x65bda4435e01b691UL, 0x90dae3c06108262fUL, 0x1eb15b0ec7c1475cUL }},
+  {{ 0x4289ab95c403cb2cUL, 0x22ceeb8d483c1cfdUL, 0xabcf05ee19fef988UL, 0x2aedc77e6f97ba8eUL }},
+  {{ 0x45d02f4a908491e5UL, 0xa846904789c0a4a1UL, 0x623af1d3cf9fb849UL, 0x0cc7834cf8511fb2UL }},
+  {{ 0x3a8d0a62f19ae60aUL, 0xf5f754ab70151b03UL, 0xe43b140a9777611fUL, 0x1bb31401b394c4bfUL }},
+  {{ 0xc43fbde78f00b938UL, 0x9af7d9eb6386175cUL, 0xbcff67574707c5e6UL, 0x0ef0f0ee97da5501UL }},
+  {{ 0xd9c641245e29d5c6UL, 0xd6e612424eac4c4eUL, 0x1890aec44cd8be78UL, 0x0bca14d897d95c05UL }},
+  {{ 0x218c66026ac8c6f6UL, 0x5369ebbd0fb39d40UL, 0x56d2a7788f879e59UL, 0x1d2ea1ab82b8f50cUL }},
+  {{ 0x621eaf491dd64e3aUL, 0xfcd33186673d5808UL, 0xdea9edacf5d49620UL, 0x1681b0918c3af08fUL }},
+  {{ 0x859046e9fb52ee84UL, 0x908d2a1c2ffb3afcUL, 0x85b5425168d51773UL, 0x2bd257d0e00bb224UL }},
+  {{ 0x3f53f66cdc0137dfUL, 0x2f2d193190d9560cUL, 0xaa2ca693d2f10f68UL, 0x226750d35376babfUL }},
+  {{ 0x4a6008903c4682d7UL, 0xe8fca8ff619c94a0UL, 0x5164ca83743970ffUL, 0x2765f262b18aeddfUL }},
+  {{ 0x748aca5dd9f48448UL, 0xeb910ad2ad9b18c1UL, 0x3801dc7301e2fa52UL, 0x2d519e33b12e46d6UL }},
+  {{ 0x05f1a06435772ab5UL, 0xca4a1a179dec9748UL, 0x2bd83918fb24b4f1UL, 0x2432ca8fc81f1a6bUL }},
+  {{ 0x3d42459d13579967UL, 0xa998e40d1eefb792UL, 0x19da1f8fc3b09033UL, 0x0f675dfdb687de39UL }},
+  {{ 0x0c0b662853beebb6UL, 0x3a1e23131b5c1f73UL, 0x19254340dcf290f8UL, 0x28de02abcba019b6UL }},
+  {{ 0xc445c788e6bcac43UL, 0x17ed3cc0c3ced368UL, 0x2e43317fc932ffd2UL, 0x27c6d29c65ac62c8UL }},
+  {{ 0xb8efedcd5a141aa8UL, 0xdba27959462048f2UL, 0x9c7ae086ec6ba90bUL, 0x02efb67b89432111UL }},
+  {{ 0x35fe90f106716fabUL, 0x8c93ee4dc6e591e9UL, 0x5475000ac285becfUL, 0x249c21e1048c045bUL }},
+  {{ 0x5ae837a73bfd769bUL, 0x9265da668f95ef9bUL, 0x8074b31b0215fe2aUL, 0x1a3cb1790996869dUL }},
+  {{ 0x198d08209b096572UL, 0x10a19146e2b7cb96UL, 0x9d7cbc32fa7eb1f0UL, 0x07174978f06b75a6UL }},
+  {{ 0x609a4d168499d6a7UL, 0xe3e16639d89fea9fUL, 0x838a0c08e634f09aUL, 0x0009ef406e2f2ddeUL }},
+  {{ 0x3b0d274760ddaf63UL, 0xb0fcd665c28273bdUL, 0x61a6765919a3e482UL, 0x18368aaa8eafd001UL }},
+  {{ 0xedb9a2df5a1f085aUL, 0xdafcb661bbb468fdUL, 0xfbbc0e983a5a18f4UL, 0x2e31ac37675f21fdUL }},
+  {{ 0x24b165ccb26b0272UL, 0xf9d83ca2c6ccc970UL, 0x701f2ce2c7258325UL, 0x0a7ad2f082d555f1UL }},
+  {{ 0x500e4c7f656ab550UL, 0xd2571560dc00a25aUL, 0x679164d070b8240bUL, 0x2a25856e62a198a5UL }},
+  {{ 0x42c140fbb666f473UL, 0xc74257a67fbf6e38UL, 0xf93ae250f3448c8fUL, 0x071c9ecb57f72870UL }},
+  {{ 0xaa0733dddd4903d2UL, 0xe1267369cf0b63dfUL, 0x9d1f10090b582d83UL, 0x258d89723abed9ddUL }},
+  {{ 0x0626054b49ee2759UL, 0x2ea627928161bae0UL, 0x78f08575257afbf7UL, 0x0e74db623df023f3UL }},
+  {{ 0x391132ac2e303940UL, 0x6ee89dba07c6f858UL, 0x92236a84f22c9f4bUL, 0x0666a4fa3f50a38bUL }},
+  {{ 0x756d66176a39ff4bUL, 0xf89ef0acdd092c59UL, 0x8bd4859138502ff8UL, 0x2e69b23201af9976UL }},
+  {{ 0xdbf6f32a5d112e12UL, 0x9220725254c4095eUL, 0x13400b32c27055ffUL, 0x09ee3ceb3218d8d7UL }},
+  {{ 0x29d0bf75c546aa90UL, 0x725e77c103dd5d56UL, 0xdfbc289786b33511UL, 0x16e2e538c3d915ccUL }},
+  {{ 0xff3ed0b286b21548UL, 0xd811d369f9c29380UL, 0x653380db9b1d4aabUL, 0x2deb6da49744dc20UL }},
+  {{ 0x3e758c4d69eed66dUL, 0xa72e08bb0918771bUL, 0x65930c2baa5afb8eUL, 0x1e6e9b51799fe991UL }},
+  {{ 0xf9e2a1f22805b270UL, 0xbf3d5507432463a2UL, 0xfe11fecf810b8626UL, 0x287a5c8ccd654bc8UL }},
+  {{ 0x97a10a4de1fff31bUL, 0x53acc4a80713ef35UL, 0x8d8a1a78373371aeUL, 0x14d6754f09e0c801UL }},
+  {{ 0x0065744da1d6e399UL, 0xc577dc8f46fc13b9UL, 0x1d6bfe49ac46b489UL, 0x2cbb3611787eee10UL }},
+  {{ 0x2611d659b27ace8fUL, 0x4838c93173d63cd0UL, 0x1f40436f921cdf85UL, 0x255741a7310a99ffUL }},
+  {{ 0xa24f3371d542b8a5UL, 0x3ee7efe2c2fb2a09UL, 0xaaa384b44b0c077fUL, 0x071226e8c4abfcdfUL }},
+  {{ 0x8ae4ff9f604d2ae3UL, 0x8223714031936a39UL, 0x6268841cbb91663eUL, 0x19ca754277698419UL }},
+  {{ 0xdb2c1fb4cd23f39aUL, 0xe0169e45c1cb0747UL, 0x488a988810a16b06UL, 0x1853a130d60ab154UL }},
+  {{ 0x5666ed72bd3fcff5UL, 0xc5950d9673dbb79dUL, 0x9684a5a83aab3d0bUL, 0x2b521b9ecf11df9cUL }},
+  {{ 0x67eb8d31f61a192fUL, 0x9b78d8b680cf8a43UL, 0xbb02a9bc683c953bUL, 0x2789fdeefaaa6971UL }},
+  {{ 0xe95c5dc8501c40aeUL, 0x8d5ae4e9f41f4f8dUL, 0x07676e927148a37cUL, 0x159d83291fb63660UL }},
+  {{ 0x62c79ef78f55bbf6UL, 0xd4c0dce7f8081f6dUL, 0xed859b353b58aeedUL, 0x2f12865d2915cd9aUL }},
+  {{ 0x456cda1754832e7dUL, 0x54462329685336e6UL, 0x095b13805c880289UL, 0x20430dc703662fe7UL }},
+  {{ 0x4dcd87b5488d157bUL, 0xca2534a98e5df0b7UL, 0x3cf37bba8dbc942eUL, 0x1d8024a63bd83006UL }},
+  {{ 0xd7041cea89502036UL, 0x4371e0e2d68850e5UL, 0x53226faf65f79cf1UL, 0x28f3382f8eaccadaUL }},
+  {{ 0xd5826cca50666a47UL, 0xb893199e1aa5311eUL, 0x504ead548ff67b6bUL, 0x15a951d296065cb0UL }},
+  {{ 0x28b61789f5b7c9f5UL, 0xdd86c286b6cb16e5UL, 0x876b7409698b2b02UL, 0x30020a7998270d77UL }},
+  {{ 0xb2c941be36ddc9bdUL, 0xf1cba0351bb50768UL, 0x7ea1266d9a6e386cUL, 0x10ce765ca571178eUL }},
+  {{ 0x4505d8119d1fb0e3UL, 0xba1133aeddbff93dUL, 0x8b4325f4edba1073UL, 0x250aba89f53dac20UL }},
+  {{ 0xadb6dfa4e3e04f36UL, 0x804f9248388b9d5dUL, 0xa1cf43fbe2b4636eUL, 0x25d861a6bc27b1c2UL }},
+  {{ 0xe5cc91cdea9876b0UL, 0xd76608f29c097068UL, 0x160704ff4a1fac76UL, 0x2699e85530889622UL }},
+  {{ 0xc9f7323037ddbb9aUL, 0xa830f9b279ebd34fUL, 0xc782cb731fbf8a74UL, 0x29f77be10417e904UL }},
+  {{ 0x333a66e4056b9067UL, 0x314b049dd5a963e3UL, 0x3aabf658d5013d6fUL, 0x21315842fe2f3ab1UL }},
+  {{ 0xc4f6f07711905022UL, 0x0e988016c000a02aUL, 0x8b3e72680c054969UL, 0x12920370a6d66666UL }},
+  {{ 0xaafd53838de253b1UL, 0xd637137f88d0497fUL, 0x423a8196ab83f57bUL, 0x2a415178fcb26ee2UL }},
+  {{ 0x2451800cc279329dUL, 0xf36d29d6d6773b36UL, 0x407e0e57bd9935c4UL, 0x0409d46ebc1edc5fUL }},
+  {{ 0x0c19d0d9cf96f28cUL, 0xc2151df68fe62259UL, 0xda34db7c92aeb0a8UL, 0x28a6d11a6b093a15UL }},
+  {{ 0xd45b0453a880145cUL, 0x3f8a78f64ace6fffUL, 0xd7277ca2fe719a00UL, 0x1d2109cae6c2ffceUL }},
+  {{ 0x386266901bde0726UL, 0xc4127a611492a90eUL, 0x15c43fc2237c4b6bUL, 0x0b8102da850b7877UL }},
+  {{ 0xe66dd31d9f1a512dUL, 0x62904476fd1b571bUL, 0x9f6f781e78ae5840UL, 0x1ab777ebf8bcd62dUL }},
+  {{ 0x08d713622cad4c78UL, 0x89bba99c76492801UL, 0xebba28b2818a3507UL, 0x113175edb1db2c81UL }},
+  {{ 0x5ad42826cd1dff34UL, 0x977fb6440d694083UL, 0x60b986919e9e43c4UL, 0x03092d186a0f14d8UL }},
+  {{ 0x087b471821bcbf87UL, 0x178868cb610b80b3UL, 0xb8823ca49e8f7a4fUL, 0x1a5ba2654ba02f65UL }},
+  {{ 0x0d83b700c81b9d5aUL, 0xc4d3cd46c43a6604UL, 0x3a5e6d4384380a0eUL, 0x0225c0ec0d8839dbUL }},
+  {{ 0xa17cbdd43194406bUL, 0xaf18fa49177261b0UL, 0x481592bca987e032UL, 0x2455f9e9661b06baUL }},
+  {{ 0x7993f7bdb8f5f590UL, 0x1cbfe0a557fb79aaUL, 0x44ae4b4b18b2375fUL, 0x19455a441805ae36UL }},
+  {{ 0xc6e27f3a89e49c14UL, 0x8032f572f3a344b0UL, 0xf11d8fb701962514UL, 0x0a763c1ee0dc27c4UL }},
+  {{ 0xad736153e46724e6UL, 0x138b497587cff770UL, 0x7da5e641af2d6788UL, 0x0f3f0754e72d7921UL }},
+  {{ 0xa4c359c5456f01c5UL, 0x72082690c3423b8aUL, 0xa0ae7f59ec6a3578UL, 0x0fb15e8bb31087e6UL }},
+  {{ 0x524e5803f7b7ebb9UL, 0xdbbdbf2cf3d1f468UL, 0x4aeb8e11dda0a651UL, 0x193391a5ed825406UL }},
+  {{ 0xe771c9144357bdb8UL, 0xa9277b01032f6501UL, 0x0f34aad59044a3beUL, 0x15da8cc47ccdebedUL }},
+  {{ 0x9c645273158eb734UL, 0x18b020ef3547036aUL, 0x1e12e471e09254b4UL, 0x0126213c815b2077UL }},
+  {{ 0x875e1ac39a54f15bUL, 0xa5624186c9d8747eUL, 0xe174fca9ef513dbfUL, 0x10bb5afd36fa0b1cUL }},
+  {{ 0x360431fcfcefd24cUL, 0x6e94abee7bbf7ebbUL, 0x979b6a2d7ee5cdc2UL, 0x24a6f12c15deb150UL }},
+  {{ 0x251293787a0136f0UL, 0x7cd1534659b7b7d0UL, 0x9b39f44ad219f9ebUL, 0x0ceb9835a01a8913UL }},
+  {{ 0xa030a7bcfc44e96fUL, 0x0eadad036f39ab31UL, 0xe02618971d668fc5UL, 0x2104114c1b1da689UL }},
+  {{ 0x14974e9dc1852472UL, 0x80f97abc0b7ce917UL, 0x25e80ffaefc83df7UL, 0x146692e5aed50c4cUL }},
+  {{ 0x9257aaa7db201023UL, 0x36c7f625b24890e3UL, 0x50438fa4e5366bb4UL, 0x2f9007fbdda7f978UL }},
+  {{ 0x0b595175cdd4cde7UL, 0x6464e58ce36c74b4UL, 0x6020ddf2e9aa1792UL, 0x2412ab44b4cf5bd8UL }},
+  {{ 0x36570e361b348f93UL, 0x3419a95c11ccd797UL, 0xb5b41480afbcf58eUL, 0x281c6e888a1606d8UL }},
+  {{ 0x2df4bc5c69a0be0cUL, 0xc25ed49876b994e3UL, 0x7169b6b371ef6887UL, 0x19cbd6fa11e1e020UL }},
+  {{ 0x8ff1f2ed0afa852fUL, 0x0930a9847b9a8f13UL, 0x1762f5032070338fUL, 0x2cb803700b05599bUL }},
+  {{ 0x3d4944155a6f7780UL, 0x19cb9c4d7cb749aeUL, 0x8899c67c857f9a86UL, 0x2a5edb2be332c3b4UL }},
+  {{ 0x43b6594d3a7e3f4cUL, 0xc29cd38a809aeed9UL, 0x7877462497db0b8aUL, 0x14573921e8f6d786UL }},
+  {{ 0xbce2fd1be6ea38e6UL, 0x76aaec951af8a7a4UL, 0xee1c6fdca10df5f4UL, 0x0752d8340d68a602UL }},
+  {{ 0xd795daecd6d35b4dUL, 0x12442e2a5b2d0f2dUL, 0xe8e8e2828ac227fbUL, 0x115efffc49c0fa54UL }},
+  {{ 0xe4ef44b4c3e11cefUL, 0xba857c4ef09b4ae1UL, 0x9738d5d1101834a5UL, 0x06abac4279f0c1a8UL }},
+  {{ 0x090e8fd85a1bbd49UL, 0x2f573f4b27c6d3cfUL, 0x33963c509451a08eUL, 0x01f8fbbd50eb7dfbUL }},
+  {{ 0x8043258ec8880221UL, 0xa5cdee37b9ebe76aUL, 0x7cf98aed66612ee2UL, 0x2a5c0247a6c267aeUL }},
+  {{ 0xc9a537b835248ca0UL, 0x7d58d68021dd6db5UL, 0x4ba43c31c13446baUL, 0x1a31fd65894b5448UL }},
+  {{ 0x62fd4d15444f4ca8UL, 0xd62ce150d4728abfUL, 0xbb057fc215c49ad3UL, 0x13813c724d3e2965UL }},
+  {{ 0x35196753d5f71370UL, 0x3210d6d0028f9492UL, 0xcaac58c76f15087eUL, 0x1104ca7a565971b1UL }},
+  {{ 0xc63d7a9a098d43a8UL, 0x75ba087b2d5409e6UL, 0x95370e63039fb4a8UL, 0x13419b43587c72d2UL }},
+  {{ 0x9bf964ebba3c943eUL, 0x47fb563d01e0f97fUL, 0xb0e689e6e81161f0UL, 0x05bb7ea9061aaf5eUL }},
+  {{ 0x85b13431c96406d1UL, 0x4e28da48eb491160UL, 0xca2424918dce7451UL, 0x136a935d08e9f52bUL }},
+  {{ 0xb68391d91c9ea5a5UL, 0xd8de5c297a47fed1UL, 0x4385602bcbf6e603UL, 0x29c4490835acfa2eUL }},
+  {{ 0xcbb568e548fd364fUL, 0x99dbb55876f42cceUL, 0xd7045a472d906445UL, 0x25bef8bc94fbd206UL }},
+  {{ 0x1aca38de76b9c496UL, 0x0cdfc30aa30496a8UL, 0x818ea85974fd54c1UL, 0x1800070000b09510UL }},
+  {{ 0xf3d48fc8519f58ddUL, 0x1ae9559c33228317UL, 0x78665c0b7619e0ecUL, 0x29002259b4df6b00UL }},
+  {{ 0x38b991a494a4f582UL, 0xaa42e483eb472372UL, 0xbd4b089f1ac02775UL, 0x06e40936ec93c653UL }},
+  {{ 0x0399e9946ba051c8UL, 0xfc010c6a0fa623e3UL, 0x4e7d4079962cb928UL, 0x154c031184c3b7f4UL }},
+  {{ 0x8d46c6713a3af4dfUL, 0xcb0b6b883d93afb5UL, 0x9972d773a12cabc1UL, 0x2b40860ac607ea7dUL }},
+  {{ 0x3e66a4c932d7c74cUL, 0x5040f7d58e23dcbfUL, 0x1866174dfe263745UL, 0x2eb3ebd0822a76a9UL }},
+  {{ 0x7ab9bd19960d90a9UL, 0xeb97fea4dc040d3aUL, 0x59ea71460ce59d3cUL, 0x0f1f4cf452834561UL }},
+  {{ 0x007ad854661625f1UL, 0x26e5c440c23c7432UL, 0x9f36a8e011abbc69UL, 0x01605d78cfa96780UL }},
+  {{ 0x704c0c99b2b27044UL, 0xac85cb2eb2435cc7UL, 0x4ca692e4f3ea43f4UL, 0x22d15db93893155aUL }},
+  {{ 0xfb770e90100eed03UL, 0x36f9950aa2d28157UL, 0x928b339a0c36b837UL, 0x174088aac7e6170dUL }},
+  {{ 0x912603fabf6650b5UL, 0x9a1227a207f7e092UL, 0xf72d59a168f899b9UL, 0x16fa2ec0d70fbdd2UL }},
+  {{ 0xd66d68e927a180f6UL, 0x53ba4aeac01d472fUL, 0x93203cb26cd7d130UL, 0x2059b71bc2a07881UL }},
+  {{ 0xbd507e4bd0c2fd99UL, 0xc6a2f4b57ecd355aUL, 0xd3af3b551f931fc6UL, 0x158e6b6b5f626d57UL }},
+  {{ 0x233886461b73a2b6UL, 0x136b6d38d69d107eUL, 0xe0620d72206df46fUL, 0x2913b83717a5c845UL }},
+  {{ 0x15394ab58d293239UL, 0xb49af05da4b03790UL, 0xf5d3ab6687592bc4UL, 0x24c5b496d4aab83dUL }},
+  {{ 0x35278c9085165c7bUL, 0x88b536df6db8baa0UL, 0x9b3560de8663f8edUL, 0x179bc680ce8212c1UL }},
+  {{ 0x54ccdf04ff731d36UL, 0xb1ce42b8b00aa03aUL, 0xc6e3b67eb87497d7UL, 0x27267105691ff230UL }},
+  {{ 0x0233fa1ed5e5fe80UL, 0xc71bb3446dd473c1UL, 0x57374b4c51ced4e6UL, 0x06e1367f2e0be622UL }},
+  {{ 0x5bfeebc2f05100d5UL, 0x735c7bc48b153ad9UL, 0xab038ea3db2067e4UL, 0x215f50ef572481d2UL }},
+  {{ 0xf1ecdf559aaf2927UL, 0xc115d43bcd3547dbUL, 0xe5dce5b2ae5fce59UL, 0x28eae22c38b1c86eUL }},
+  {{ 0xc7edb30c3a6aedb1UL, 0xd0dab2abae91d2a2UL, 0x8b4c2a7f43407c17UL, 0x1e22abd1fe5b3200UL }},
+  {{ 0x0eaa124441c88ee1UL, 0xbbad8ffa3e2a8f2eUL, 0x8829b7b8a4cae1cdUL, 0x2e0749539c411e5fUL }},
+  {{ 0x22d6c23a629ce0d5UL, 0xc5dca84aa9f26d50UL, 0x0f1ea85a1aa0c73eUL, 0x03759bf36b0c40edUL }},
+  {{ 0x56c45619c2ea3033UL, 0xb04820cf881c496eUL, 0x1963dcd83ef9d29fUL, 0x10bdfd20bd9e99b2UL }},
+  {{ 0xc1267c7d88bd9fc2UL, 0x1585400dccc08c1dUL, 0x0473260846d86668UL, 0x0a2452f555ad8524UL }},
+  {{ 0xa7edb62560b2b68eUL, 0x875c3df4b78d3647UL, 0x01ff8f5fff4f3520UL, 0x1400035e6f23d9a2UL }},
+  {{ 0x95253a6d0ca40646UL, 0x8fe9e797cadc1481UL, 0xa78daf3dcce7eebcUL, 0x25a11cab69c2eedfUL }},
+  {{ 0x989fb5b3ee5769d0UL, 0x629e20ede40eab56UL, 0x7129ac5f20501a69UL, 0x18b3f9dc77641777UL }},
+  {{ 0xe0b541c572c82092UL, 0xc01f02542211d483UL, 0xdcf0cc8d521b3cf7UL, 0x28b44245395a6390UL }},
+  {{ 0x265ae1941e111751UL, 0xb3f2961bcaaf33dcUL, 0x637e0d02f33fea0bUL, 0x0e9b083c631d8fa8UL }},
+  {{ 0x2d120094f337cf3eUL, 0x8be42ccb316a7e65UL, 0x53fd1a085dc69c83UL, 0x0192f02b1478898dUL }},
+  {{ 0x5fc4d149e8abd505UL, 0xa9475a2644ba549dUL, 0xb019bc3236901865UL, 0x0dab0f155f83da1aUL }},
+  {{ 0x1fc06d58d344723cUL, 0xefa3640e3e891426UL, 0xd91c146ade933061UL, 0x049b08cceb84e05eUL }},
+  {{ 0xba6af8bbbd842019UL, 0x0c93492944a50adbUL, 0xc1a129ee307620a8UL, 0x23e417673b49f3a6UL }},
+  {{ 0x7282a2f856591b8aUL, 0x87c3f73a42e946beUL, 0xf84d1e3f7c5f4f00UL, 0x2ae36ca80176dd65UL }},
+  {{ 0x723ba52605f11806UL, 0x146e959ff2475534UL, 0xcff0771afcae9fedUL, 0x1f0986f823a7f7f7UL }},
+  {{ 0xc5a31e5ae6074e1cUL, 0xc5b2cf0c0dc3ec9aUL, 0x73eb9881428ccbd6UL, 0x209d6c6bf5b0aee5UL }},
+  {{ 0x1f6fbd97733355acUL, 0xcfad982541212bd0UL, 0xcd4db1297fc99541UL, 0x0239afc51dfcdd49UL }},
+  {{ 0xc61ce75c372bc357UL, 0x19daae7527ea2c35UL, 0x8137c9b6aeed469bUL, 0x18549f566b133b81UL }},
+  {{ 0xa9e8dd4d29a5ef14UL, 0x14a0b572995cdd5bUL, 0xc0ce8590e9a67998UL, 0x072e8f32082c3e49UL }},
+  {{ 0x1dcc34761128f4c1UL, 0xcb884ce4ac4d05b2UL, 0xc8ed6dcb6a039639UL, 0x1fdb10aecbde231dUL }},
+  {{ 0xe7449f0492b107c8UL, 0xf9ee9e831df98971UL, 0x0f38e69806b66074UL, 0x18d66d0085a96f6bUL }},
+  {{ 0x0a521c381ffb9455UL, 0x80ee83721b87cfb1UL, 0x6d0ee6a38b6f1657UL, 0x0309c4263cf534abUL }},
+  {{ 0x51de4ac998f9d0d5UL, 0x37570afd92131fcbUL, 0xd74205020fdee715UL, 0x140218dc81041838UL }},
+  {{ 0x5e89ca86e26b7daaUL, 0x4f07e152baa60dfcUL, 0x1e9fb6493ded810aUL, 0x25e0a42426d00ff5UL }},
+  {{ 0x2d22c3e53b5c11abUL, 0xb61e33e95ba42590UL, 0xe8ab211a7703e1cdUL, 0x19ee3d949c61f545UL }},
+  {{ 0xec2cec504d3ff516UL, 0x3f0bd116e2e557e0UL, 0x53a6f273f172eda8UL, 0x27268566d0c4ef24UL }},
+  {{ 0x9389cf0216230a1bUL, 0xe440303b215c50b5UL, 0x59b63a8ea9b93817UL, 0x1b97123ceab0ba06UL }},
+  {{ 0x6ab151f05a57f3a8UL, 0x3f777dabd84dd315UL, 0xc858162137ed206fUL, 0x14c17189c5442c4cUL }},
+  {{ 0xa0c5043db9c5da1eUL, 0xb1637e596024052bUL, 0xa5e62f0bfae7f52bUL, 0x2fd6f39d4f5c2754UL }},
+  {{ 0xc037c85b46ec7787UL, 0xa3fcba44390e0f1eUL, 0x935420a70a7b9fd0UL, 0x0f760657fbbaef68UL }},
+  {{ 0xb81af3b40d129d43UL, 0x10c09c54c48b498eUL, 0xa54d769acd586279UL, 0x0aea6660be290826UL }},
+  {{ 0xaf6dca1fd8ddb1b0UL, 0xcd78c10bb3d0ef82UL, 0xd58d3aa4fa52152dUL, 0x118ba7f85d7b89e4UL }},
+  {{ 0x3d79581ad22f03caUL, 0x00bcde066db75e32UL, 0xef79cdbf1afd9dacUL, 0x07970ed3d5f54a5bUL }},
+  {{ 0x148a907a964b0322UL, 0xc6a658690ae95fddUL, 0x84f3783e559f7060UL, 0x15fd991efc214356UL }},
+  {{ 0xd86b44551760f285UL, 0x3a4a14d0e3364034UL, 0x03bff161f07e1ba4UL, 0x0cdff2d1d7482253UL }},
+  {{ 0x8184dc7087362ad5UL, 0x5dcc428afd6cd771UL, 0xe7ef859aeb333f96UL, 0x1241a33e050e7e95UL }},
+  {{ 0xdfb9573adc448328UL, 0xca5bddcfebf2932bUL, 0x2a7d179465c8d6a7UL, 0x0c4d007b88e0eb24UL }},
+  {{ 0x46f772d1a0db0d39UL, 0xae4426eb537dbe62UL, 0x927a10ebd480bedaUL, 0x2ac55c1feec0664fUL }},
+  {{ 0x7161f0f67510d82dUL, 0x25eb8a25a31eb060UL, 0x66451f4a1671e270UL, 0x117bc39435c373e5UL }},
+  {{ 0x888fdf1b3ad33d13UL, 0x39786eed00ab0f5dUL, 0xc5c793f39a78d865UL, 0x1a9a464c9a135613UL }},
+  {{ 0xbe6da8904e26921aUL, 0x8140904c816dc75cUL, 0x0f19299f8806c39eUL, 0x26976df9c5b17175UL }},
+  {{ 0xe88407f3bcb19fc2UL, 0x8562a12b393e3b73UL, 0x1f6377a6a34e332dUL, 0x20353aefe42fe383UL }},
+  {{ 0x90b6a901986746b0UL, 0x13cea2591c62a84dUL, 0x86b38e38f0b15255UL, 0x2e93bdefd9718dafUL }},
+  {{ 0x8b454c7beaca7530UL, 0x7d50e29c7ea81812UL, 0xe4ef9ab4e41734c9UL, 0x16de8e7a9e89946cUL }},
+  {{ 0x8f881f6e7447040dUL, 0x0c782ea9fc69d9d1UL, 0xf46ce120e6e63790UL, 0x1236c3fc2a0eb7d6UL }},
+  {{ 0x14ec14b8f513ee71UL, 0x9db31c18c3990a7dUL, 0xff10b3184391e661UL, 0x0cfb0c4be4c86026UL }},
+  {{ 0x88bbeb59341db306UL, 0x59f8df1c92c07143UL, 0xd6746a1b2f5e4e36UL, 0x1dba2e1232cbef94UL }},
+  {{ 0x09c9dc242c3dd239UL, 0xc65918c870ab2860UL, 0x23d4c1654bc5f900UL, 0x01361e32d33aaeafUL }},
+  {{ 0xf023a85b806a0a45UL, 0x9b2c4c4af9ddadceUL, 0x9c38461b1dd27695UL, 0x09b471618df247f8UL }},
+  {{ 0x4dfd3ea57c87dbafUL, 0xce872664347eb87fUL, 0x34db2500eade815eUL, 0x20bcc92fc0455126UL }},
+  {{ 0xcdc6132d53647dfcUL, 0x46dce13c7f47a6e4UL, 0x191bdf8dc2e1bcd4UL, 0x108d37d98df8e727UL }},
+  {{ 0x25e6b339e401f04fUL, 0x91bd7af7dc2f2f83UL, 0x7c4e1a58c303f050UL, 0x073117edbb43e376UL }},
+  {{ 0xf2f67bba739f4bcdUL, 0x889b37cead05a3feUL, 0x7b4345b37cd34b13UL, 0x2b220b600a47ecffUL }},
+  {{ 0xf6c6d19f57d75aefUL, 0x19ab3372c3cdf519UL, 0x525b0a4b009ab8adUL, 0x2b9cb6841a86a1d2UL }},
+  {{ 0xf3e41441b755fc5eUL, 0xa9b1b4fb47007189UL, 0xfd522ea78b0f955cUL, 0x2b6abcd7a5773bc4UL }},
+  {{ 0x02585efa208b762aUL, 0xf31ac631301ec627UL, 0x9f921a12bdc63d44UL, 0x1eba06ccc5d1774eUL }},
+  {{ 0x3e634dae6a3d6504UL, 0xeee5794dc4617f0fUL, 0x588fe0d725bb2d16UL, 0x1fcceeef99347e90UL }},
+  {{ 0xbf44c811c5aaa333UL, 0xf2eecd9492efc234UL, 0x33ba9068b07f367fUL, 0x2950bde707a42865UL }},
+  {{ 0x9f00f3c1dd8c8b1bUL, 0x9ead86cf4d109596UL, 0x12b193e72422c335UL, 0x05c9a479f52b7c82UL }},
+  {{ 0x4553f8e9bdd0ed24UL, 0x3b5b24e769f9a67bUL, 0xf37ce51a7e87049cUL, 0x2221d3422e030f03UL }},
+  {{ 0xad6a64cc460c601aUL, 0x01726740fdb1af25UL, 0x63b33e2d99d02c07UL, 0x10e35d003f9b6001UL }},
+  {{ 0x774f9549a15805aeUL, 0xd7b9023989aaf775UL, 0x3a71d62670278f0eUL, 0x210f1961160a4c32UL }},
+  {{ 0x17b0e6c8b53f287dUL, 0x67d1a77057889398UL, 0xd9e75bd774479113UL, 0x23d9d20814a5d5edUL }},
+  {{ 0x3d5a40f88b0f0ed5UL, 0x93eb47c0ceb15250UL, 0x4a2a5a6f52d7a3aeUL, 0x1db16d9865f8355aUL }},
+  {{ 0xe93ce0a6e1946691UL, 0x67c40a748e30471cUL, 0x3ea0486bac065db0UL, 0x2c37385d1564da7cUL }},
+  {{ 0x2a49408c5bf896ffUL, 0x4ea20811764e9a91UL, 0x1356e7d987c39ba3UL, 0x0441d7692428997dUL }},
+  {{ 0x72b86523ec9b70b4UL, 0x0d73a5c129088552UL, 0x004a181cd30da6ffUL, 0x14e8452e8316b1e3UL }},
+  {{ 0xe8ededee6fa84100UL, 0x85ba6834c71303f7UL, 0x2633f63948d600d6UL, 0x148afb376561987fUL }},
+  {{ 0x1e52f9458cbc7e39UL, 0xf7df2eea03637127UL, 0x0f83a0d1df501f3bUL, 0x0b171a0cb6f211b7UL }},
+  {{ 0x55babfae0206d98cUL, 0x673d8df954336287UL, 0x91fbad77818c14ceUL, 0x0b39386662e5b7bcUL }},
+  {{ 0x71ebe6f5cedaa884UL, 0x7134764669eaab4dUL, 0x05a76aac80e4bf5dUL, 0x014720674e33b385UL }},
+  {{ 0x2f1b955c31eccc42UL, 0x9aaa46b9ee6cf365UL, 0x55144bac6eac4a91UL, 0x2d7b250f17699737UL }},
+  {{ 0x0fdfaa2633cc32bcUL, 0x5a01b0adb87c2581UL, 0x2d0bc831ebb59cccUL, 0x302c8e9073ffdd78UL }},
+  {{ 0xe58252740c203f82UL, 0xfb5384a1dc9334b8UL, 0xee37a78877021628UL, 0x2d0d9109d101810eUL }},
+  {{ 0xeb9325350461e51eUL, 0xea40dde2ea510d18UL, 0x3f3a026007471eedUL, 0x07d260a9d966a195UL }},
+  {{ 0xbc7260f645a372b8UL, 0x472523c4a6ef89f0UL, 0xccbd6a08eb883ea3UL, 0x2cb9a2460bb635a0UL }},
+  {{ 0x35b5c244cb2303d6UL, 0x5550cd9a45a04ed1UL, 0x9824b7e41a8fb78bUL, 0x1aa2e0f696bf5b97UL }},
+  {{ 0x05490b7aa8731bb0UL, 0x53b56cd7aff2a5d0UL, 0x206dbbc846c425b9UL, 0x0137a41234b18878UL }},
+  {{ 0x372e9f7974887a0bUL, 0x30fad0225153ba8bUL, 0x4ade4cbcbd6ddb95UL, 0x02cd3173917cacf0UL }},
+  {{ 0xa4c5e690dd4bef48UL, 0x779c0c7ad2ecd143UL, 0x36309a5aedc14b29UL, 0x0002a06bff8bde7dUL }},
+  {{ 0x4a90b9971b5aad3dUL, 0x2903617cd7eb274eUL, 0xc003c16fa96cc9b3UL, 0x2343bfb330152cf3UL }},
+  {{ 0xc33eb1f8572127ccUL, 0x48d7e0932eb6a32eUL, 0x7baa4d246ea834caUL, 0x12d39498575f4185UL }},
+  {{ 0x8a428c6be12d452dUL, 0xac0eb8da5dd8c5caUL, 0x0de6d92a26fbbea6UL, 0x187bca5d7081233fUL }},
+  {{ 0x85c396c6d279a7b7UL, 0xd336d7849e8d1244UL, 0x616db48646271a62UL, 0x2f0540e44a1d5779UL }},
+  {{ 0x7afafa543bd35992UL, 0x5f66f2eef5636b20UL, 0x7375ec5192bf9472UL, 0x24e6a45ea8c3eff7UL }},
+  {{ 0xcf143141827f8cefUL, 0x3a71fc64e380f042UL, 0x7ca1ef3b0386ff0aUL, 0x2621aac6fe584050UL }},
+  {{ 0xb37b3c632454a7c4UL, 0x9960f7d127e67861UL, 0xaa5b2cbbc99f134aUL, 0x260482d9f963d58eUL }},
+  {{ 0xc85adbe833df846fUL, 0x32c3105d4f6d54f8UL, 0x3213e1693c953948UL, 0x1399e3ffeb2e3349UL }},
+  {{ 0x168812043a02b3b3UL, 0xaa5e18570ac04b22UL, 0x79d35560184b2a25UL, 0x2f9ae5802d6732c1UL }},
+  {{ 0xeb7e4e09d609861dUL, 0x43794ccadcce7e13UL, 0x80b2f08661900b4aUL, 0x09b0b11725122b15UL }},
+  {{ 0x8f6eadc5f124dd96UL, 0x361eefce8c6a5ca6UL, 0x4b4e371b667c9ce5UL, 0x211477920a41170bUL }},
+  {{ 0x4409167723f0e85dUL, 0x87e98166d495c21dUL, 0x0c80f9656bb8c3ccUL, 0x1eb082071eddb9c3UL }},
+  {{ 0x1d2bb2b0879617adUL, 0x354242f833dc1b7cUL, 0x8815eb9e24f0d62eUL, 0x2abce440a298bb25UL }},
+  {{ 0xdb2df5650347b756UL, 0xa6a1bfebb71f8e2cUL, 0xd378821000fa4946UL, 0x0d25bac3daf772f5UL }},
+  {{ 0x6c78686507dd2ea9UL, 0x229666b3b9f2414cUL, 0x2b8dff2529c6ee66UL, 0x03057c79c63c9fbaUL }},
+  {{ 0xbfa1c5b18c4c5280UL, 0xb1df8d72a2c78789UL, 0xdfc741fe5781e399UL, 0x2892c5b742e8feb2UL }},
+  {{ 0xcd2804787780da36UL, 0x5618aa863e17b853UL, 0xdad14763c7ff75d2UL, 0x08bcd65cfdf0f11cUL }},
+  {{ 0x5bfecd1701c23631UL, 0xd26f1e55b37133a1UL, 0x1bc200c965f9bb84UL, 0x2d1d9d8a7283dc71UL }},
+  {{ 0x5f2319e8f1d3e167UL, 0xf3618b54a0fa22beUL, 0x75e149449cd80036UL, 0x21ee7f76c0fb3c3eUL }},
+  {{ 0x17ea3c96f02af8bbUL, 0x25445f8a5e08a260UL, 0x12a5dfb2a9493222UL, 0x272f581d9e98c77eUL }},
+  {{ 0xce195cc741822106UL, 0x1b0254b68bd2c089UL, 0x827b6afcb324fe72UL, 0x2f9e804adc3acd41UL }},
+  {{ 0x50f861de18bbe312UL, 0x44d550ef6e4a2e50UL, 0xf01fd2bfb6df5205UL, 0x0421678c97622aa1UL }},
+  {{ 0x8e31258f79af1cd2UL, 0x194d0ca0614edaeeUL, 0xb9a4eb04fd11b477UL, 0x087e70f6cda40805UL }},
+  {{ 0x0aad3a1faca6ae98UL, 0xf6eb20abcd78dbeaUL, 0x640b2659b0e2d357UL, 0x2fc0dbb1640103a8UL }},
+  {{ 0x59fa283b2d5c38d8UL, 0xf8b7dffab1e41c72UL, 0xd527326f01366716UL, 0x13e836a875a2f373UL }},
+  {{ 0xd8bc66f47d03938cUL, 0x905eee767f600ea3UL, 0x2540f67d5980eaffUL, 0x2284be915d0667eaUL }},
+  {{ 0xbeb58329c25da8f5UL, 0x440b0a11df942adeUL, 0x94acb5fb7786c985UL, 0x0cc4c93b3a6ff952UL }},
+  {{ 0xff303dc52af4f6cbUL, 0xfcc12a3551689263UL, 0x717bb3917a45beafUL, 0x1939aa4de6405657UL }},
+  {{ 0x39155565333645dbUL, 0x6309f829f627895fUL, 0x6bf0ae57747fd4e8UL, 0x0cdb7f126c0535f2UL }},
+  {{ 0xd8dbd9125dfc068dUL, 0xf379c5476001ccbcUL, 0x89db4c545f5c2429UL, 0x1f1f6c737762e750UL }},
+  {{ 0xde88b012a931d1dbUL, 0x2b84f3f46fe7264fUL, 0xe19a8e10a504a0b4UL, 0x1686a94d215bb67dUL }},
+  {{ 0xa069d7463a8290b6UL, 0x006361881a46ab81UL, 0xd4111b48dd0a1253UL, 0x10997ebf2239bb18UL }},
+  {{ 0x432328e99e723ddbUL, 0xdecc7a1977ae58edUL, 0x82191b0b844c1a91UL, 0x24559c6e8f534978UL }},
+  {{ 0x3b26e0eff24ab73fUL, 0x4703bdd707fbb537UL, 0x55610d2886d24201UL, 0x2ed0969758e4c5d0UL }},
+  {{ 0x46f92ace2169cc08UL, 0xc56c441cd2c764bdUL, 0x746b43e1f24a8883UL, 0x289caa68fefb1544UL }},
+  {{ 0xf2784e20b2ac8715UL, 0x6398d1bbd50ad78bUL, 0x6e719532fa8765eaUL, 0x24c4c77e4f444b98UL }},
+  {{ 0xf3702a07f19b3358UL, 0x9bd12dd6ebdd366eUL, 0x6cd5c70d1cf5b4a1UL, 0x0400fd2feb9e35cdUL }},
+  {{ 0x6be5e46b026f7d3fUL, 0x8b2f0aaf99c70cf7UL, 0xefd9c675dbcc1f47UL, 0x08908ab47cbd1f7eUL }},
+  {{ 0x9ca372627dbc8017UL, 0xf8de3a870460e41fUL, 0x16b9e4ab2fa74eb3UL, 0x24bd4b21ca66388aUL }},
+  {{ 0x506dc4f2c5640e99UL, 0x6e5d71692aa3ed55UL, 0x60fccb722734b8eaUL, 0x2003c03895fee6adUL }},
+  {{ 0x6c9c028aec49dfe9UL, 0xfe176702960335b7UL, 0xe1552b2cc489c8e0UL, 0x0555da13fdef2f31UL }},
+  {{ 0x32babad8b3093bc1UL, 0xd7040384ec7ca637UL, 0x046c4dbcc4704072UL, 0x067a5b52ccada05cUL }},
+  {{ 0xf22c82a225671734UL, 0x75ca802bd2130e74UL, 0xf13d78bc309a1c9dUL, 0x23def9e2d92c85a2UL }},
+  {{ 0xd05b3ae331671d5fUL, 0xfe308e6652156ee2UL, 0x3d1567f4726fbdfbUL, 0x1b11504c2a147c0bUL }},
+  {{ 0xa57841c62fc27401UL, 0x05ab3405a09853a8UL, 0x5bc1899123c088f6UL, 0x299f1a09d2d812cfUL }},
+  {{ 0x0b249a6a062c7fb1UL, 0x555ca8598b04773bUL, 0x0d676c8be35003a6UL, 0x08da5198c53667edUL }},
+  {{ 0x9f1e4657619fdc69UL, 0x44311469e5ccbeceUL, 0x33efb9e54e694abeUL, 0x28933ad0d89d7aedUL }},
+  {{ 0x2845a1e4d2c9e6c9UL, 0xbce405d5f902009aUL, 0x551dfdfe9a370108UL, 0x2ad2bbe45085cd57UL }},
+  {{ 0xf0170b098091449eUL, 0x58ba084e8a4e5d79UL, 0x65161068b00155cfUL, 0x29cdca27b25c1e72UL }},
+  {{ 0x23dffc9c587d0446UL, 0xe5aad4208bac266fUL, 0xcb2ace050cac1b5cUL, 0x1f250df2496dac72UL }},
+  {{ 0x6408a1b93ca1a645UL, 0xcca66c912258d65bUL, 0xf26ac52e24e9b7aaUL, 0x1bd3ff4a419540d5UL }},
+  {{ 0x58b1af23292bf8cbUL, 0x2f15bcedccf1b804UL, 0x210e5431bdd85c89UL, 0x1b2629ce82c3f6faUL }},
+  {{ 0xb85b722ddf9de495UL, 0xd333e0d3523e3f06UL, 0x42f38e16d9cd22efUL, 0x0d7498f2008bdd95UL }},
+  {{ 0xde13da21793120efUL, 0x194c2d843291475fUL, 0x36236fab44c094afUL, 0x2786f61bdeb4147bUL }},
+  {{ 0x3ae477f576a38f98UL, 0x4d16f1581eedfbdeUL, 0x0967ffa19e5b5c14UL, 0x050e9109e27dc757UL }},
+  {{ 0x15db98638f30ad88UL, 0xda559bfe6a3bb0f0UL, 0xd34fb18e3738553eUL, 0x217c68aeeda98a6cUL }},
+  {{ 0x6d97471d4501bd7dUL, 0x273d96c400925d61UL, 0xc2ac917404b8e134UL, 0x15632dc085dec5abUL }},
+  {{ 0x1f501685942aab02UL, 0xa158fd73328857dfUL, 0xdbcadcc9f68a08bbUL, 0x23db0d3b31ba2756UL }},
+  {{ 0xb550fc090e43e4acUL, 0x04223086dec3fb2dUL, 0x5c2c81db2d91b95dUL, 0x2f1c0856c39c9c1eUL }},
+  {{ 0xc8fdde0c51e43476UL, 0x6dec1de5f6736083UL, 0x2ec54f854f21d2a8UL, 0x17ca71c20f7972c7UL }},
+  {{ 0x2177747cfadd329aUL, 0x19873dd16f9519aaUL, 0xf3f45c4a65311a84UL, 0x0789525be2f764a5UL }},
+  {{ 0x9a35d5c2f476c46dUL, 0x009c2f0a7dca7a2fUL, 0xb7dfe2d0c40a168dUL, 0x18358a765afddd1cUL }},
+  {{ 0x2cc1af1b7154f1e1UL, 0x7cd2a6f9e6d32e28UL, 0x387e555e327ee630UL, 0x14e79477fef7bce7UL }},
+  {{ 0x99d3c0f1ca87947dUL, 0xdc08b09fa31e21b1UL, 0xcb963c287debc10fUL, 0x29f149126b79f02fUL }},
+  {{ 0xc45e9746ab8ced77UL, 0xc5ac34404539485bUL, 0x3b128f31005fe4b6UL, 0x0639fdb656f3c550UL }},
+  {{ 0xc9c5e4fb58bfd6a7UL, 0x800e5f69469dda53UL, 0xb04c306bba29c4ecUL, 0x06a641ba54d59904UL }},
+  {{ 0x5b6957021fced4e4UL, 0x6a4bfd8f57afdfe2UL, 0x48ed270ecb5702ecUL, 0x034235277de45bb3UL }},
+  {{ 0x7cb45939c574b5ceUL, 0x13733ae33663fa4aUL, 0xe74741afcea218d1UL, 0x1d77ca4ec90decaaUL }},
+  {{ 0xb6aaa826a73917f9UL, 0x3cd4b9d83b8306d2UL, 0x59b25a1e460b1419UL, 0x268ac1e7938ff5acUL }},
+  {{ 0x542a209024052e23UL, 0x57c94853a0e2f76bUL, 0x463de74b2dbac6a4UL, 0x302be35295a8494cUL }},
+  {{ 0x543bdb48d559631dUL, 0x4804eef76b537dceUL, 0xbc89e2aab36ba6b9UL, 0x05e0b498a0213d61UL }},
+  {{ 0xcfb2f420a4621192UL, 0x4ad073425b21575aUL, 0x65e47c83f9c506e3UL, 0x0f7d001d53a7f131UL }},
+  {{ 0x63d6b626b29f7a19UL, 0xd036e86ab41864c5UL, 0xf9e6880bdde068c6UL, 0x161674cf96238cafUL }},
+  {{ 0x6eed88785fbb74cfUL, 0xae459d1361ebb302UL, 0x748e04e9ebfb570eUL, 0x1b8920b6c77adf97UL }},
+  {{ 0xe7ef0e43d9fca8daUL, 0x7a5cabd2774e2ccaUL, 0x9ebdf40af6231aacUL, 0x0742c751b2d20f93UL }},
+  {{ 0x5bdff8fcbeb43d98UL, 0x9c198d78fb4323ffUL, 0x19782a3089f3958dUL, 0x17a53cef4f7f883cUL }},
+  {{ 0x3be51beeb13e4081UL, 0x75f9f82cf8ffca8bUL, 0x54aa0cde4c216dbdUL, 0x1baa41607cb4a024UL }},
+  {{ 0x06f87af417370da7UL, 0x952994e69236a6e2UL, 0x022754cbb0fa05aeUL, 0x0c6642713134a997UL }},
+  {{ 0x037026dbefa7a6ccUL, 0x7bafce80285467c0UL, 0x69fb9bbb4901305bUL, 0x15535dc08f7701f4UL }},
+  {{ 0x087db47538164ee4UL, 0x2224ae9071e43457UL, 0x52373a69a8229630UL, 0x2d604325f73e3e99UL }},
+  {{ 0x8369009d21a872c2UL, 0x5456b362c5831a32UL, 0x729fc7f7ad69fec5UL, 0x1d8422435a13ea2fUL }},
+  {{ 0x393550aeb8b1d264UL, 0x7fc7635cb4b91a01UL, 0x3817158e3aece634UL, 0x1d1cb10f7dd292f4UL }},
+  {{ 0x684104ab339eee91UL, 0x9456720ce8704a1dUL, 0x6281de9a7c03fb82UL, 0x04df63a59dab0e9eUL }},
+  {{ 0x31592447cfe4ee09UL, 0x826d9792d97e9c13UL, 0x0044220f72d414a5UL, 0x0b6b285eff0d0f57UL }},
+  {{ 0xb383966d5462d47bUL, 0xc1301a2fc3a32756UL, 0xbb653278ea29e74cUL, 0x17ce3ffd1a113a35UL }},
+  {{ 0xc1754e204901dd30UL, 0xcec10db85b75b23eUL, 0x604bf2e73aa735deUL, 0x1bf8d15c1d4d20e6UL }},
+  {{ 0xe70bf59493ae181dUL, 0x85919221b7d77f19UL, 0x3ebe82b644502e24UL, 0x2d471f01636a8847UL }},
+  {{ 0xd7ce278b099a5598UL, 0xb851bf262f103f24UL, 0x39d24297f9fe9e65UL, 0x000a677794e6a32eUL }},
+  {{ 0x55e612f320c27d1aUL, 0x012853977a2af596UL, 0x34c5bf9a2013038fUL, 0x0895fee2b7ee59c5UL }},
+  {{ 0x5ffb7fd61dadbff4UL, 0x926d42b2950dda2cUL, 0xf4116cf07bb90b47UL, 0x21220f7be6f30efaUL }},
+  {{ 0x10c9f68f767adf0bUL, 0x1a5612305de18ff4UL, 0xefc2483a5235ed61UL, 0x09400bf5983e6c48UL }},
+  {{ 0x8695750b72a49a19UL, 0x0441c3f1ba7da438UL, 0x4740d25f1681cbf3UL, 0x0e5bb270c7e2715cUL }},
+  {{ 0xb7e60acf6d6e509dUL, 0x0db94cb98f312967UL, 0x513cfc6e0a70a678UL, 0x08935ed1cc8dcc58UL }},
+  {{ 0x661beb4dc6c73441UL, 0x07fd18f7a058182bUL, 0x854a5f338f02df3bUL, 0x19abbc95ba2453beUL }},
+  {{ 0x4207dab99dbeea7cUL, 0x11493457be878e62UL, 0x1f2686e476128647UL, 0x2ac1d56f3f856ea7UL }},
+  {{ 0xd04859aa65882fd2UL, 0x7a7dfb99a7f3aa72UL, 0x63168bbd4a61841fUL, 0x27b0db7f7b2c1ea8UL }},
+  {{ 0x62521a2233310f1aUL, 0x824049f5128446e4UL, 0x0c185f5ad8f2030cUL, 0x03e5207cfea9d241UL }},
+  {{ 0xfa02d9f15db7dee6UL, 0x257eb3085e1c6c21UL, 0x67c0610d6e9ac888UL, 0x0a7172db02204139UL }},
+  {{ 0x40708fce08f86b5aUL, 0xff516393e0558a51UL, 0x97245a4949faf6edUL, 0x179bdcb9d9926b3cUL }},
+  {{ 0x3a733880da8aae79UL, 0xa21e1891f03f389cUL, 0x981d5f546f77836eUL, 0x2f21a97a1af79122UL }},
+  {{ 0xad0590c47576e2b6UL, 0xb99a4e3e14dee8c5UL, 0x47093cb2be3679a4UL, 0x13a072044e5924b9UL }},
+  {{ 0xf0186b7b8abc5030UL, 0x7c19eb94c5593d4eUL, 0xaf70d510d0f940edUL, 0x013b31aa8a28927fUL }},
+  {{ 0xd8dafa3ea0b3117bUL, 0x090609e07643b0fbUL, 0x41f8b08446581c3aUL, 0x0a697c644083dbcdUL }},
+  {{ 0x83712373899bae4eUL, 0x306794d5dd0774b6UL, 0x97ad91331949e48bUL, 0x0640857fd534f198UL }},
+  {{ 0x804e3f85844d02e3UL, 0x2ccbe8313769bfebUL, 0x1fb1c4aaa7f39e9bUL, 0x2bd1c58c8fe96bc7UL }},
+  {{ 0xafb528865350bda6UL, 0x1939734fc87c8df7UL, 0x47e6702c9fae4d72UL, 0x020a0dfb5e672297UL }},
+  {{ 0xd8e30a82cf0dbc19UL, 0xac9f3006ae323b08UL, 0x501c5f6c55e22428UL, 0x005cf1c836275196UL }},
+  {{ 0xeb07fbd9ca8c4fe1UL, 0xda61ec419687e561UL, 0x8686bfff7f1699cfUL, 0x2b9212b3c0f17e6fUL }},
+  {{ 0x5f8edbebc0a26c16UL, 0x19195742282dd5d7UL, 0xfebd1c7fbc6a6d72UL, 0x02f7ff9debaa2232UL }},
+  {{ 0x76a3e7ca8840e617UL, 0x4a335ace96ed44dcUL, 0x3a00431eb0d9f9e3UL, 0x152611e0b6223d2dUL }},
+  {{ 0x148b65d3b555eb55UL, 0x39daa89bbe5ebbacUL, 0x35d057fb52d0b093UL, 0x195eecea0ed9d7b2UL }},
+  {{ 0x981abdafdc2fe648UL, 0xdcc021396f6720e0UL, 0x31e4f9a1434586cbUL, 0x1e5edbcca1e24e21UL }},
+  {{ 0x741e5251b4c81aafUL, 0x2c2418e5cfe5579bUL, 0x8c8de3751f89cfaaUL, 0x0c9f773b94ad028cUL }},
+  {{ 0x36b10be19452b6f3UL, 0x825fab0d5d13a496UL, 0xf519058a5768773dUL, 0x24e4dea891f4d106UL }},
+  {{ 0xec78cb955f408866UL, 0x6f9f87a31b7301b1UL, 0x742f1318b58f5494UL, 0x0db422d52d2b6fcdUL }},
+  {{ 0xeb49f0992aea20a9UL, 0x3988a1dd8b7113c7UL, 0x6d231d6b4f295096UL, 0x23bbe9a8b593ecbdUL }},
+  {{ 0x461cc414c07be546UL, 0x0cd608a28f469e7cUL, 0xdce87eaca502af92UL, 0x0271fe9ad8f3ac1cUL }},
+  {{ 0x936165fb3e81f7d0UL, 0x5039f30ed59963c9UL, 0xc4adca3a2c29ec4aUL, 0x1e8026f4b44d8d95UL }},
+  {{ 0x0d7e0e43da6b4d29UL, 0x676b01917e2e6097UL, 0xf8a05000a0d8a3adUL, 0x02db403035ac0eaaUL }},
+  {{ 0x7f47ee9b0263393bUL, 0xd2674258f2b98a81UL, 0xca387c3fd7d25d8cUL, 0x27f5581170b07450UL }},
+  {{ 0xe893ef96c9c37402UL, 0x3efd9c1d38b27052UL, 0x701e9a7f96a7dc01UL, 0x301e1e88682be22fUL }},
+  {{ 0x83b1c4dd7ddf39a8UL, 0x851b0175883c7182UL, 0x6bac74296b10a1fcUL, 0x1fcc78634a264340UL }},
+  {{ 0x183b2dd7118c8ccfUL, 0x92ca627399c092d4UL, 0xe715798fa8a6c2cfUL, 0x0eae42bffe13de41UL }},
+  {{ 0xd873185c105e8a5aUL, 0x22ce27e5b0259fedUL, 0xe6bd2bb5592b5a7cUL, 0x119885b3e6a3adb5UL }},
+  {{ 0xf5c2ee873940dd79UL, 0x5278c332583d0499UL, 0x9fdd31f4e30d1783UL, 0x1511caf76c423076UL }},
+  {{ 0xa520d31b8dc3dc36UL, 0xbfa924c078bdbc12UL, 0x0e586541f2c12cf4UL, 0x2b73ee678ccf433cUL }},
+  {{ 0x9985ae7a93f1d0eeUL, 0xe3c4d75cec8fc99fUL, 0xfed0e57ca24bf5a4UL, 0x201539b1fe44bdc0UL }},
+  {{ 0xb3881b288197a54dUL, 0xd4e2bd06b3a5ddf3UL, 0x8e6f63d4c3ce2370UL, 0x0512200f48cd7d5cUL }},
+  {{ 0xe9f3ef5bb7fa6909UL, 0xf8e69f883bca8e68UL, 0xb965824b68f2f91fUL, 0x1560e47b1af49463UL }},
+  {{ 0xc2165db3eb56412dUL, 0x822c97396cc62373UL, 0xbdbc3c4e53b68c72UL, 0x01443bb022900d09UL }},
+  {{ 0x408130ea9ab54059UL, 0x1b2554c62197f6d0UL, 0xaf80d74193ce43ffUL, 0x0284ff868562fce6UL }},
+  {{ 0x0e02177f4bfdd707UL, 0xfd8f834a1bdc13b8UL, 0xcaa6694cb6693a4fUL, 0x24f9e128f9c75bbcUL }},
+  {{ 0x821a73581615b2b8UL, 0x0c8260ffb9951523UL, 0xc10c0c682097a2f6UL, 0x1a50eacd7e05cc90UL }},
+  {{ 0xe0a12ffc32eca18cUL, 0xaab84a8e19458274UL, 0x6f9882070b0c24f6UL, 0x100190298c2f5b1bUL }},
+  {{ 0x104dc633587abfafUL, 0xc46718321f7973b1UL, 0xb3922eac67924a89UL, 0x23707a9f35a901edUL }},
+  {{ 0xa64ed04e2e9a5010UL, 0xf23b0d6ae8e0390fUL, 0xa5f2b97ef5c19b00UL, 0x1cd978adc9cff237UL }},
+  {{ 0x6dbf3ba6fcbd387bUL, 0xe1a9d24d38b4ce12UL, 0xe613d88662515262UL, 0x19732c3fb907d824UL }},
+  {{ 0xb5d1a45118f2bd78UL, 0x654e5cac622f34aeUL, 0x09cc4b894ebcbabbUL, 0x2d7e6ff5b6e9f1dbUL }},
+  {{ 0xbd34906a5cdf2bf6UL, 0x8b912e8222842010UL, 0x90f5937101bb5667UL, 0x02a7d50b649d215bUL }},
+  {{ 0x9bb9ec809e11b0e2UL, 0x31eb51e7ab9b7a59UL, 0x1f570e6a5f8eae3bUL, 0x1134768c0b95fb2cUL }},
+  {{ 0x8f65ec8e7415be8fUL, 0x9915f9d7608db83dUL, 0x4ca8bf640fc5fb54UL, 0x2fcbe04059332d56UL }},
+  {{ 0x4fb6f253d5f3a389UL, 0x8cbd0ea868860be2UL, 0x51a21a623199c71eUL, 0x04af9d2e7d1af54dUL }},
+  {{ 0x26c330c9e3580854UL, 0x89de644140d46e6fUL, 0x2831eb63fe18b324UL, 0x228dc8d34195409bUL }},
+  {{ 0xc30be16c83010bd1UL, 0xa7cd33f71ecbadc8UL, 0x70810a64480afddaUL, 0x2d0a84eb2a1d71d7UL }},
+  {{ 0x5470e0e3394fab65UL, 0x6a9701ceca981eeeUL, 0xb2931eaa3c980d6aUL, 0x02ef01c31b6bdaf9UL }},
+  {{ 0x35b3bd0a42b97b85UL, 0xe691d13720402183UL, 0x2c391b36ab0e9facUL, 0x06b7ab8f07bc61ffUL }},
+  {{ 0x461ffe775da03249UL, 0xd60bbe37db53a1f3UL, 0xbe78720c9c70215aUL, 0x220ca07d003fd85eUL }},
+  {{ 0x1dd2f90fd52a1022UL, 0xdc2fbefacd4928d6UL, 0xb9a020c837443c81UL, 0x1ccf10c7e0be9026UL }},
+  {{ 0xb73e17903b485f86UL, 0xde9fe5057585e9c3UL, 0x6b1868a004dacdcfUL, 0x10e7f6c6aa067239UL }},
+  {{ 0x3de0132935bc1d7aUL, 0xb1359a4c15e60dd4UL, 0xa23b6a3d0151ddedUL, 0x173da89936abd514UL }},
+  {{ 0xb3b9a97d08ace258UL, 0xf7c79a5cce699356UL, 0xc9dbef24cf98ac73UL, 0x029082170fb0a87cUL }},
+  {{ 0xf6ef353d757542b3UL, 0x94253668dc12b8abUL, 0xcacb36dc1b35c9e4UL, 0x1a0df0c41362bf3eUL }},
+  {{ 0x69aa5edb98965c7eUL, 0x81b75b4413fc06d5UL, 0x9a023818f7fc4bbbUL, 0x09d0c8b117fcdae0UL }},
+  {{ 0x238a24327df58695UL, 0x5232051d957a624cUL, 0x005b784490cb7afdUL, 0x302d18c2d9b5e503UL }},
+  {{ 0xaa48c7662d97f49cUL, 0x7dcd8c90f4077d4aUL, 0x5cb2aaeb674218edUL, 0x269f08f8f7a95eddUL }},
+  {{ 0xa818451b974f0df7UL, 0x4b4d5ef2ec09162bUL, 0x50b21454b952f609UL, 0x0f1c511dd250b432UL }},
+  {{ 0xd0a408a49ce81ff7UL, 0x99cecdfa49a5635dUL, 0x02c80dd9e0755573UL, 0x1c6e63da7e3005a7UL }},
+  {{ 0xdf51c2fd455ac3d0UL, 0x419462bdfc075776UL, 0x78f17b10974d9244UL, 0x235d01e2bc628236UL }},
+  {{ 0xc9795513bfa434e2UL, 0x9898139593fa870fUL, 0x37f92dfcee0649d2UL, 0x197060075aeac997UL }},
+  {{ 0xcbe2862e991f5a59UL, 0xc9ecbd56bb26419aUL, 0x15bfa50c8ea21177UL, 0x109b44770124a6fbUL }},
+  {{ 0x8bcac42f2ce9cb39UL, 0x48ddda00c6a5f820UL, 0xbd2bc1dd0a175948UL, 0x23375ffba5406badUL }},
+  {{ 0xa888a2c1a02b005fUL, 0x89a277f05a6c92ebUL, 0xcd0946be7f866f93UL, 0x04bd9f759f734d59UL }},
+  {{ 0xb2e4f6c286e62b99UL, 0x6ace684ca890987bUL, 0xdc9c84b558f41b7bUL, 0x185ffb62c09bd9dfUL }},
+  {{ 0x74103aa719164f73UL, 0x0393116a7e90c431UL, 0xa4eeb5891d9384e1UL, 0x2221c4507ea6899fUL }},
+  {{ 0xcdb301028b61ab1eUL, 0xd002b7c8e583ffabUL, 0x63a5aa5329986417UL, 0x13b5af0edccf11dfUL }},
+  {{ 0x015db0efe740ce35UL, 0xfc1ced2121b1b296UL, 0xcf24bc1b561d6e21UL, 0x08b077138e7cdea5UL }},
+  {{ 0x7f118c2439c5d3b1UL, 0x3a973eb721486d93UL, 0x7c860b8497f5d9d4UL, 0x091ad98dcc269154UL }},
+  {{ 0xa7459475bf1e05deUL, 0xda1104a0bed7cfc8UL, 0x2e1ed32ae9f33ab7UL, 0x186cbd9600fc56c6UL }},
+  {{ 0xacedb0b1dcfed55eUL, 0x64bbbb6e43fc1b1eUL, 0x149af68b12996f5cUL, 0x21afb742082a9424UL }},
+  {{ 0x9f4fcf1646d1eb1eUL, 0x5ca73457aacd2fa2UL, 0xa425d876957ae500UL, 0x271df09be734a731UL }},
+  {{ 0xd82686dd7a749551UL, 0xd97a6f680e875443UL, 0xec035cc571bea12fUL, 0x034eb2d5c303b772UL }},
+  {{ 0x1a9d94f01c167ab6UL, 0x40ae0a47fc9eb73eUL, 0x4167e5efa3fd252eUL, 0x0a2f86618454700fUL }},
+  {{ 0xe279bcaf204476f6UL, 0x0bac3e18691a6be8UL, 0x46ba6beda76cc4cfUL, 0x2d8069ae4c6c9ac3UL }},
+  {{ 0x29b104a35e3a8c4fUL, 0xd78a9da186514fd8UL, 0xbb8031f6591b7586UL, 0x0fa8ca6831cfc5dcUL }},
+  {{ 0x489aba3f31bd0e36UL, 0x34688e6c31912c1dUL, 0xe2bbba3e3835d26eUL, 0x0709f6bfe447c7c2UL }},
+  {{ 0x3da8d8f8c04104ccUL, 0x0e8c235cc358e09bUL, 0x16bf20bbbf57b619UL, 0x1c50cd8e98590295UL }},
+  {{ 0xcd2047d6adff2afcUL, 0x009b841136a908f1UL, 0x803a32fe941c7c1bUL, 0x0b2dddd5d24b4f1bUL }},
+  {{ 0xeb9514444fd1a695UL, 0x39bf754100ba701cUL, 0x573c5b386f139e10UL, 0x06ef768ba7304542UL }},
+  {{ 0xbf0e041dfd9cac90UL, 0x628a0a465db6e84dUL, 0xad900504fc6e75f1UL, 0x1fc4f2e210643e19UL }},
+  {{ 0x7b92c6c1f873c21cUL, 0x7923bd6c5c24b9f5UL, 0x90d1754cf168acb1UL, 0x0a40bdbef8501abdUL }},
+  {{ 0x802c993cc497f711UL, 0x658da383224775e1UL, 0x9bb424ba5a3993a7UL, 0x23ca38184b0290a5UL }},
+  {{ 0xd252d0eb2ab2e4e2UL, 0x6f7f1e1e74c596ffUL, 0xa5c69b8a12fb90d2UL, 0x1b3a568302d71e7eUL }},
+  {{ 0x39c517036e21c319UL, 0x67a3c71e7b127029UL, 0x7dcac86efbb1cda6UL, 0x19ee7d1c01f19642UL }},
+  {{ 0xcca53baf913f6825UL, 0xf3d9232d6e9f6e92UL, 0x42869488f5a0391fUL, 0x12415d51796ac051UL }},
+  {{ 0xecb653e02d655eb1UL, 0xa03b460375f456b8UL, 0xcfe3f03b4670631dUL, 0x1ce61436f72f8835UL }},
+  {{ 0x36f3218f8f729977UL, 0x571966e28f43ea4aUL, 0x6faa5761df704c28UL, 0x2245761d76fda0d9UL }},
+  {{ 0x207e3d04b060143dUL, 0x1d830d3a593c3ec2UL, 0xea4ff9f345e18661UL, 0x2e8c9e1b748e6a3eUL }},
+  {{ 0xe3c53fe724e3a102UL, 0x924274c3b63dde5eUL, 0xb7d0a6b7dc09d393UL, 0x2b8016fb06de6279UL }},
+  {{ 0x111d99d85b715f2dUL, 0xfa5da15d1a929bb9UL, 0x74053c1330da1fc6UL, 0x0d1b8cc0716adfa9UL }},
+  {{ 0x9225e1bbeae51294UL, 0x4d7e74807edff9b5UL, 0xcad98b58a1b06e51UL, 0x2fceac7ab7fe50dbUL }},
+  {{ 0xf34b185d69da6ce4UL, 0xbcbe74ea2833e5efUL, 0x15278287d375d6bfUL, 0x1146612524341bdfUL }},
+  {{ 0x2b23e348dbb76441UL, 0x0faf2bca55c66008UL, 0x302ac98d1e6b08f2UL, 0x149099d13e3e5467UL }},
+  {{ 0x00874fef22324458UL, 0xe09f64763b3b010bUL, 0xa8d8d44db9626d87UL, 0x0ea8914337081ef4UL }},
+  {{ 0x44cad0fd7999f8f1UL, 0x638f980f7e4b64c2UL, 0xc9994c3708abf956UL, 0x2da4b3d30ca1fd7bUL }},
+  {{ 0xb9c590ea513eed55UL, 0x6e2d730414b4a1e5UL, 0x4d504dabdb25dd7dUL, 0x21af3bb2a2933030UL }},
+  {{ 0x1937cd7e47541331UL, 0xbbdbac8e049f8660UL, 0xc0f479fbc93a4127UL, 0x0f91b58f93f70df8UL }},
+  {{ 0xbb86627997583537UL, 0x89f6e7e9561acee4UL, 0xb6624048c60b0af8UL, 0x21fa2afd354a3dbbUL }},
+  {{ 0x5c2078a6d7312e68UL, 0x5c1bd7456833f8bbUL, 0x0f33a96fff06afddUL, 0x1d4913658fe92224UL }},
+  {{ 0xfd7a02bf93d6f478UL, 0xbbf6a7c00d6877deUL, 0xd34d7a4c99197d11UL, 0x2c37b1957c41129aUL }},
+  {{ 0x4eb81a0b84742ae9UL, 0xdbcac881ffd4b906UL, 0x29dda236b890ec57UL, 0x0c96747950cae3fbUL }},
+  {{ 0x340ec9b8696d03b3UL, 0x1909abfa8a99ab3bUL, 0x0fcd33e05a06fd79UL, 0x079d0088d6c546bdUL }},
+  {{ 0xca66cbb7a132d229UL, 0x0fddd5d110b487a4UL, 0x98703b46d424a9b2UL, 0x291268925fb3ce3bUL }},
+  {{ 0x9f366c0aba141ebaUL, 0x805bd2240d649db7UL, 0x5ef438bde2911de0UL, 0x197768be8eeb21dbUL }},
+  {{ 0x28399f06c6f99591UL, 0x3c7d3704599433c8UL, 0x7af66d253577d7fbUL, 0x2c257797558dcda9UL }},
+  {{ 0x8a625deb9bf7eaf5UL, 0x764ade32df49fdc5UL, 0xba928a7cde93fef5UL, 0x146c6301698415daUL }},
+  {{ 0xc86eb150bb90c8fcUL, 0x1b6e9d9c016217a4UL, 0x6a31e089eee97cddUL, 0x0c79877da34dfc56UL }},
+  {{ 0xdb25ffd06233a7beUL, 0x6f78b424eb9ff84aUL, 0x278fbed0d6535922UL, 0x200d05681df53af9UL }},
+  {{ 0x9741578db75aabb6UL, 0xf88cb5c128f6287aUL, 0x1d15e94913da6aeaUL, 0x17528b32207b9084UL }},
+  {{ 0x635b36945049fecbUL, 0xeae97f48620663deUL, 0x4486c10cbc9e51e5UL, 0x27644482bf6c9da9UL }},
+  {{ 0xebf45d589de16d80UL, 0xcc85caca8eebd2b6UL, 0x460b303d5602d3f5UL, 0x204cf4050f4d94dcUL }},
+  {{ 0x4ad6cfc25234269dUL, 0xa2359bcbcb84d0c5UL, 0x085e420f55ca542dUL, 0x0def0335da264fabUL }},
+  {{ 0x6ebafcdf455e9207UL, 0x77d790cd9b0410afUL, 0x1633bba521734f46UL, 0x2326eb8edd98a7e3UL }},
+  {{ 0xcfd7ca4103e56667UL, 0xe1db89c967635fc4UL, 0x6d2b18372abf2a1eUL, 0x1b02ec8f02fe849eUL }},
+  {{ 0x74c79314f19ae4aaUL, 0xc5a1863fa1425e67UL, 0x62fa9df03463be63UL, 0x2b2eea9529d55786UL }},
+  {{ 0x3849c2e605cc9e12UL, 0x9fe90db918cdbd70UL, 0xe3606250c3472c4aUL, 0x249d2a8ede408188UL }},
+  {{ 0x4deda834862ca36aUL, 0x1b922ad2e06ddf00UL, 0xa834e416d55cb37dUL, 0x2ca1b3076e41a3ebUL }},
+  {{ 0xf1290a133888a22fUL, 0x988b251bd8f2d107UL, 0xd43c728ae7d61aacUL, 0x2519ba6a97ba193aUL }},
+  {{ 0xdd22b3a37f5b0c0fUL, 0x914d739d84111c49UL, 0xb4c84d44d1f527c2UL, 0x281d99b096b0b297UL }},
+  {{ 0xb46459050dadab5aUL, 0x6e116883df9739c4UL, 0x5c86f1a10d349610UL, 0x0dda5d6ef5434bccUL }},
+  {{ 0x986b356d91ce690bUL, 0xb25f5f49d4202697UL, 0x2965dc2ae219244dUL, 0x009927b30e346fc0UL }},
+  {{ 0x3535c1545746692bUL, 0x622a615fef6ac07fUL, 0x4d94801ae1c918a9UL, 0x027ffde26e259f81UL }},
+  {{ 0x0ca9a15b8e4fc2a1UL, 0x0244d08cd6869a79UL, 0x95bc7929e17a55e9UL, 0x140ac6ca8234369bUL }},
+  {{ 0x3385c27dd0d5be35UL, 0xdfd0c525c98bfcf6UL, 0x95b7700cf9a59861UL, 0x21ec7a58d8a8f1ebUL }},
+  {{ 0xc0c6ac51b606154dUL, 0x5df6c0ab826055ccUL, 0x742c84e7658a251dUL, 0x021853163d9d204fUL }},
+  {{ 0xb7e248e98a364e37UL, 0x0f56ac59c1b5c55eUL, 0x831c35b8ca1d2d70UL, 0x172e200952def7e8UL }},
+  {{ 0x8dc632aadb4f9af1UL, 0xc912b752ff192732UL, 0x84a40a3a5ec30b23UL, 0x0d72a8fb5824ee66UL }},
+  {{ 0xbf73835938674385UL, 0x56fbff435c3a50f5UL, 0x415b9bede93e92eaUL, 0x2ef697c4d97a3056UL }},
+  {{ 0xa52584b2c8451503UL, 0x2c634dbfeaecfcddUL, 0x423f1c3d8c6bf5baUL, 0x182f282e15f7abefUL }},
+  {{ 0xb28aff9310d47118UL, 0x2c749b0e1faa01b0UL, 0xed74daa6ce6314d8UL, 0x0bb0a60309ac5b30UL }},
+  {{ 0x5b6300ac28fce063UL, 0x6cc7ab41a55a7c8cUL, 0x73815f75808c3975UL, 0x1afc50d508ed6181UL }},
+  {{ 0x855d4bcaa38f9af7UL, 0x4eba8719332b6023UL, 0x7fa8a20af86b92b1UL, 0x12eec881f860551dUL }},
+  {{ 0xa066aa9336460d72UL, 0x289bccc29e22de57UL, 0x65a93c0ce09625e8UL, 0x01bb266c5639c76dUL }},
+  {{ 0x06cd3d3dfcb44d22UL, 0x9e92d791ff52eaf2UL, 0x1144bf564942018aUL, 0x06fcdefd571d99e1UL }},
+  {{ 0xe7ac6d3f6d828aa0UL, 0xdd27cc0d50969a62UL, 0xfdd1d34dc16a3bf1UL, 0x23643a87806a746fUL }},
+  {{ 0x46d26356f46b879eUL, 0x48904b121efa46b8UL, 0x83cb9b98ba3be944UL, 0x22ce8cdae3e1a8b6UL }},
+  {{ 0x217d97937e346f4aUL, 0x9ae3029bf4762619UL, 0x56c28158c9c2d2f0UL, 0x2a47755234d00f79UL }},
+  {{ 0xfe623fc2f4077c0dUL, 0x5c06baafd2b3a15eUL, 0x1a0505476528c87cUL, 0x133aba3e17b1d3cfUL }},
+  {{ 0x0b5b21f07efb77f4UL, 0x83ac040aa25d6d34UL, 0xb79eff2c55bd7423UL, 0x293e5c4ca3c6ba60UL }},
+  {{ 0x488cfd1cac3ec33dUL, 0x7d1091e477ee4de5UL, 0x681ba936e4efd8a8UL, 0x0c88cdffcaf41fe8UL }},
+  {{ 0x0d7cb17e9075ca55UL, 0x763f6d6c74586969UL, 0xba2a23929cea9e62UL, 0x08fefba1bc89029fUL }},
+  {{ 0xbf02f930ed7ddcabUL, 0x1ee13d4633801a1cUL, 0x09b2635689abff09UL, 0x28f30b63ec6fc996UL }},
+  {{ 0xaa4a46d858c4f5e2UL, 0x6fa08656144e985aUL, 0xc054c5adbe34f9cdUL, 0x14c009f674575dc3UL }},
+  {{ 0x40c3554544984256UL, 0x4b91b7eb9229dd19UL, 0xb98343ccaffca595UL, 0x000de2de375ae3d9UL }},
+  {{ 0x509f82603b5ae6d9UL, 0xb53eeaf461f3aae6UL, 0x943fcb95982ff652UL, 0x12ea9307c4ee888dUL }},
+  {{ 0x5d9b30227099234eUL, 0xcfc198b307818052UL, 0x240018065a05fcbeUL, 0x01e2dbe7b6f6c350UL }},
+  {{ 0x1964ebceb3149fa8UL, 0x7ccfedf57ed1b773UL, 0xeca5ae02272a3ecdUL, 0x00fac7cb7aa0c5c6UL }},
+  {{ 0xb59acd663184b010UL, 0xe245b204773ee204UL, 0xe713e6c97a35200cUL, 0x024d0bf49eaff2efUL }},
+  {{ 0x98e7a8d59a01a975UL, 0x1432935b55f5814cUL, 0xccbbc30fde177c25UL, 0x0e6258af4220e44dUL }},
+  {{ 0x4647c55767fa001dUL, 0xa3acbf395af75438UL, 0x009042d6ac4b2086UL, 0x00e1635080755a60UL }},
+  {{ 0xf59b81d6e5e491c8UL, 0x4deaff085508e2d0UL, 0x8d495d12c52fbc8dUL, 0x18e2c2e833d0ac48UL }},
+  {{ 0xf1eb800f9ed62bb4UL, 0xb016959310759333UL, 0x2271649991fcb671UL, 0x08d95ab84791dd06UL }},
+  {{ 0xa2ed34a69005bc98UL, 0x57948d5c64823c84UL, 0xa594449671872a04UL, 0x05d6acbc46d7c2d5UL }},
+  {{ 0x1e655e92b7e06469UL, 0x03089b19fa3aca06UL, 0x0616f02bcb3abe72UL, 0x0ed232b9089db799UL }},
+  {{ 0x60995aaf5e70fbc4UL, 0x72d018d1d09acf48UL, 0xdce011d1a018f7daUL, 0x222318f7c69639ddUL }},
+  {{ 0x9e330c354bb718e6UL, 0x5fb404fb652614a7UL, 0xf7fc8cb7501c94b4UL, 0x2bcbbfd4ae1abc5cUL }},
+  {{ 0xbcd88eef067fd282UL, 0x013705a93ce88e06UL, 0xcf67c022e032108cUL, 0x1a6442364176b29fUL }},
+  {{ 0x285d8f1863535242UL, 0xeb1b9830a8a3bd3fUL, 0xbdc1d5879d52cc4aUL, 0x1a287d3d3cc9a069UL }},
+  {{ 0x351a6bfd4b631f7dUL, 0xeabaaff15f0f0714UL, 0x93eb553121849ae0UL, 0x1e0053fbe5beff7dUL }},
+  {{ 0x0b90afae363fda6dUL, 0xa11216c3ca62f226UL, 0xb0879e811e0209e6UL, 0x19a20263d3c9a547UL }},
+  {{ 0x24439e0aadba4ecfUL, 0xbe8ed32962605e87UL, 0x726f1dc0abdcd127UL, 0x1d67535270f21099UL }},
+  {{ 0x2bbd4d28f252c697UL, 0x469b2bb589e0347eUL, 0x2a0e6d8c1ba76c11UL, 0x21e7a5c845db22b5UL }},
+  {{ 0x94a4ee7c7925b7d9UL, 0xa19854ce3cf6d6a9UL, 0x70b5d0086812ac7aUL, 0x04cb33641caa4936UL }},
+  {{ 0xee4f68d17fed2bd3UL, 0x88feedc4cffbe1cdUL, 0x407c6b6391562b57UL, 0x04a9edcd50456eefUL }},
+  {{ 0x0f4586560d4192c3UL, 0x06683c06e8c82869UL, 0x886cbeaedd1bfd2fUL, 0x0a9c56e89c792149UL }},
+  {{ 0xe953b2f818456ba2UL, 0xf4087532ede9d384UL, 0x3f48b21d80aefdf9UL, 0x0e5eb197e4ef3e5bUL }},
+  {{ 0x6d2353a6a5b0fe24UL, 0x1ecc0762eb9d59a9UL, 0x9aa96c1e532479ffUL, 0x20bccc0e6d379c9cUL }},
+  {{ 0x3298b14ea3cc595eUL, 0xeb4641e9133338dbUL, 0xae430f599ac4a7efUL, 0x183c32e5d51d994bUL }},
+  {{ 0x1002ed5a8a70b2b7UL, 0x92c4579f1a5ae00aUL, 0xa1679fe81be8ec97UL, 0x076f333933ac59e1UL }},
+  {{ 0x6edb552179a2a21cUL, 0xbba6f1ec14eec35eUL, 0x55efe84c6282706fUL, 0x18426e6bd4e08228UL }},
+  {{ 0x908dfe39a00f2067UL, 0x029a2c20dfb7d98cUL, 0x2a4f216e72fd6ac6UL, 0x00dd5096614bacc8UL }},
+  {{ 0x997e4da53ed070acUL, 0xc5dfda5eac88e974UL, 0x2049cde447167bb6UL, 0x27ff0e632c982eb8UL }},
+  {{ 0x4196d544356fceb4UL, 0xd2a143f250d95b53UL, 0x8311cc46c6ee9723UL, 0x05f363cb2933f20fUL }},
+  {{ 0xd9ba7adc3e22d9f2UL, 0xd61e156ebd199c95UL, 0xf3c2fdffef29e4f8UL, 0x1b30c57e39be8910UL }},
+  {{ 0x9dd78112ed0ae95fUL, 0x4f5cd42b8fb43874UL, 0x78896132af6f2b08UL, 0x1aa35924a44dbdfaUL }},
+  {{ 0xf90a53d892daad49UL, 0x789da91400690f60UL, 0x159864f33a8cf9f4UL, 0x18441068eb5f9a69UL }},
+  {{ 0x5f4f1f5ae84ba026UL, 0x4675b7e8f6c9d543UL, 0x8db8914f450dcfbdUL, 0x01f6fe3920ddf15eUL }},
+  {{ 0x31125c816d133ac0UL, 0xb632b100e915e9e1UL, 0xb5c19504cbf9db81UL, 0x0b3f775566d25f75UL }},
+  {{ 0x6f5850abd6a683daUL, 0x504c867fd8a0e0e6UL, 0x52e4fffc4d34fab2UL, 0x1f926935dba7350aUL }},
+  {{ 0x3e8c43da46626f37UL, 0x51be318bbbe2bf7cUL, 0xd40a0f63a347645bUL, 0x0ceeda906af5ff1fUL }},
+  {{ 0xdf306271487b1147UL, 0x1f4a379424118d4bUL, 0x77293e0421de74acUL, 0x196354add5470254UL }},
+  {{ 0x823da3e28944be34UL, 0x684c92e4b147aacbUL, 0xfe094a89f2edbdf1UL, 0x19955385424becf6UL }},
+  {{ 0xa0a663347df58dd5UL, 0xed5f9e57c815eb9eUL, 0x31c2c95ebd729510UL, 0x244077c061d7029eUL }},
+  {{ 0x1df964b33a389be9UL, 0x9e3eee474b216192UL, 0x93d7cdbb2f5af290UL, 0x169186f41dd0eaeaUL }},
+  {{ 0x767b3fc080a2eb8cUL, 0xf0bbd89e57291430UL, 0x95bf96a65918dd4eUL, 0x1b270e34621b9fe1UL }},
+  {{ 0xe1e9472e4eb431b3UL, 0x5e07d5e28a699f9dUL, 0xa92747c39d05c97aUL, 0x277710daac28cc81UL }},
+  {{ 0x06fc6d075b6bc5adUL, 0xfff274fbb0a00390UL, 0xa125cdad0b9d418eUL, 0x1d359f096811ca1fUL }},
+  {{ 0x3ff724ee746ea81aUL, 0x7dbba18ae5cce5bcUL, 0x59cb1228bd20e30dUL, 0x17864cb064a21ca0UL }},
+  {{ 0xa671986c0f8e21c9UL, 0xf2f784749a59d741UL, 0x82046931cf0fa7b4UL, 0x015012ceb094e801UL }},
+  {{ 0xb90c1631583702f4UL, 0x613f874d734d221bUL, 0x8e84e0b0bbaac2a5UL, 0x0f51a5604c001ccbUL }},
+  {{ 0xf4dbc22c12647e34UL, 0x095f260d85d48f91UL, 0xe5ed8fccc5588fa2UL, 0x2b0cbef1860cffbcUL }},
+  {{ 0xd263f338568f3a13UL, 0xf7e9ec0f5194363eUL, 0x11d25e3aac9d96e1UL, 0x082efeb730f61b0dUL }},
+  {{ 0x018e7b95159123f3UL, 0xde17b92e13cce11fUL, 0x99ce816a78ca31d1UL, 0x233adaa4432d60f1UL }},
+  {{ 0x768cc0c48081152cUL, 0xb8e18de3df493ab2UL, 0xd3a9086eda911773UL, 0x2b6c8eace5c2517fUL }},
+  {{ 0x21967b1b57e0a366UL, 0xdf6103cf0994a151UL, 0x0eed10f4e5b86ff2UL, 0x001c6dda1f494542UL }},
+  {{ 0xf29455f864b4fd70UL, 0x5d7c92b8270eb916UL, 0xeb95b6a7d56fcf1cUL, 0x2f564d4717f96e53UL }},
+  {{ 0xbc6076bd76bdbe38UL, 0xae1688ed4f8ae5d3UL, 0x04b78075e18bfdbbUL, 0x27f2ed9a0322a209UL }},
+  {{ 0x6b587ca4eef799a6UL, 0x7b5315a534abe5daUL, 0x9e687f9b8a82b5b7UL, 0x05c335d1d3ca0357UL }},
+  {{ 0xa2567a3afcfa8cdeUL, 0xb854094653cecb30UL, 0xaa121512bce73c39UL, 0x1e105714c4f25942UL }},
+  {{ 0x2ea89329537204ceUL, 0x6ec7c069a53330eaUL, 0x42f217b8c969ca6bUL, 0x0ed59ec33b11ec87UL }},
+  {{ 0xad00b84c199d0b4cUL, 0x24b5cb55e293da6cUL, 0x7970dbe81154c6e5UL, 0x2795c1fbf45e34bdUL }},
+  {{ 0x0cde63bb156f2c87UL, 0x6af95c191b67aa57UL, 0xab97019d4bb75052UL, 0x1efce7e00d65a1c1UL }},
+  {{ 0x100ae0a2b9bd658dUL, 0x7fa6224929083a93UL, 0x185f67e16db575ddUL, 0x1ebf88dc69ab70f6UL }},
+  {{ 0xcb09148fa6546327UL, 0x4f747005109ee1dfUL, 0x2f89ea033bf01990UL, 0x1f0990f9a9267fdaUL }},
+  {{ 0x8a056fca4204411dUL, 0xc49dca93b8603ab0UL, 0xc77ad545951d9db2UL, 0x2538fde34230223cUL }},
+  {{ 0x73b09b1eae7c5aeaUL, 0x9e1c6c541b17a3fbUL, 0x038007b42738c672UL, 0x01def8afbc3e509dUL }},
+  {{ 0x1ab35a63a63f1ccfUL, 0xdeba26d63716eaebUL, 0xb6004072dcee0111UL, 0x1ca1331e99af7144UL }},
+  {{ 0xfa3c4284de6f1329UL, 0x0a2af61d02750af4UL, 0x2fae78c460beb2f1UL, 0x041c4e1cadd79b84UL }},
+  {{ 0xc567792d7821eb08UL, 0xb6bbba385a35f8bbUL, 0x11b2767e78eca9c8UL, 0x28e255238ef06639UL }},
+  {{ 0xb6db6e24a25b024aUL, 0xb45fcacba23ff5f1UL, 0x42fcaa6e6c0e299fUL, 0x06eb1d6e4f32c1f5UL }},
+  {{ 0xae496363f870bb3cUL, 0xf9717efc15c32f48UL, 0xb1c3ba8adfe3750eUL, 0x1b3ff2f46cd1b80aUL }},
+  {{ 0xb8652adb36d575d4UL, 0xde1c150053d5cf58UL, 0x93b4cdcf991d653aUL, 0x0fcecd46d5dd54cbUL }},
+  {{ 0x53c7279864a86013UL, 0x0e831cd24e22f091UL, 0xb713891d8216b104UL, 0x22d52e6be045f55fUL }},
+  {{ 0x55f37ca0162dcfc8UL, 0x9ffcbc24dab370b3UL, 0x148b3ed604ddc1b5UL, 0x19697aa603d3d282UL }},
+  {{ 0xea41e89fb64f0e05UL, 0x2c0fd3b15b48e1dcUL, 0x16e1c7576e2bf04eUL, 0x099e6eefd8c36e55UL }},
+  {{ 0x61b7245501feab6fUL, 0x465237511e4f8b76UL, 0xc6ebfbcdd67f0660UL, 0x248c893853f05d69UL }},
+  {{ 0x74a2774ce8020e39UL, 0xecbd86cd078f9fbdUL, 0xc7b531b092d4309dUL, 0x13c966f4a8d2d218UL }},
+  {{ 0x1140e61c6ff5de4bUL, 0x12c36bd6db62181cUL, 0xa88e31dc7dc7eaa6UL, 0x0f20ded1c7c370a7UL }},
+  {{ 0xcd5c3c67fb0951c1UL, 0xbb788ec144a9db92UL, 0x384d540ce983c9efUL, 0x0265d15037a5412aUL }},
+  {{ 0x676cfea879778e62UL, 0x55882b68423d73cdUL, 0x12363eaab90914f1UL, 0x0706cc828c46bfa2UL }},
+  {{ 0x44d80e2a9aaba0f9UL, 0x45ce6b47069b1d27UL, 0x314d7fe2ed612aa4UL, 0x239a8b9c6bd5e35fUL }},
+  {{ 0x78662042fb651b6fUL, 0x1a33bb2cab6769b0UL, 0xce07f337aa3673d7UL, 0x0cd9230efbaf48a3UL }},
+  {{ 0x0bd337433782b08eUL, 0xe0e808333b80f16aUL, 0x0159eb2c42654dccUL, 0x0d415474c6971341UL }},
+  {{ 0x32a0910a38344141UL, 0x688f575fa37960dbUL, 0x2dc678aa04072c64UL, 0x2e5dbe1ddf7d7f10UL }},
+  {{ 0x20b39b42c2636010UL, 0x7cd5fd977bceb985UL, 0x36debf9ed68c484dUL, 0x1500cabd75fd8316UL }},
+  {{ 0xd8f6e643fbd51b98UL, 0x120b833bd9b69cf1UL, 0xef1bbe20bcc0c523UL, 0x22d20b803277229fUL }},
+  {{ 0xddd1fc64c4fd325aUL, 0x5ed491b322b71b2cUL, 0xf8670c6494feaaf3UL, 0x0646cafebe669453UL }},
+  {{ 0x38aed522c81aa950UL, 0xc11b64da9e6c089dUL, 0x79df8d20889f2fc2UL, 0x02013d0673a83c39UL }},
+  {{ 0xf754a7e37a903dbfUL, 0xfd47afb627387c5cUL, 0x924da2337b2ab7e3UL, 0x1033d320877b2e32UL }},
+  {{ 0x07c9712f3aa0cba7UL, 0x02459a4b2dd344efUL, 0x46feef5c912a527fUL, 0x2219b12557af27cdUL }},
+  {{ 0xab222aacc6080d3cUL, 0x59609eb7924f837bUL, 0x506dba6340b7a3acUL, 0x2a71c5f0e4fc9042UL }},
+  {{ 0x3e7001f1921e5df1UL, 0x09dec6b40da28bacUL, 0x23c9ed7f7b84849cUL, 0x0d629322bc447798UL }},
+  {{ 0xb1bb145124180c5bUL, 0x363871263efb0bb6UL, 0x9ae644692b8d1363UL, 0x0a099a517c20e365UL }},
+  {{ 0x6c02659cb8f74cedUL, 0x2269e6f88c892653UL, 0x6c0cbf88fdbb874eUL, 0x1f5eebc0ba200e39UL }},
+  {{ 0xa7d1d12e60cae2f9UL, 0xd8149161688557afUL, 0xcf6695e0ac920b4fUL, 0x153d604d8ec21a2dUL }},
+  {{ 0xe6f83a638129dddaUL, 0x1e952acc98279520UL, 0x92faf7a0bd1b4391UL, 0x06774ae53b5b1266UL }},
+  {{ 0xd5c6e40734223f4aUL, 0xd340e76bd477f0d5UL, 0x8a4bb55ee9f9faa6UL, 0x13b61d0f5bb7ba60UL }},
+  {{ 0x294a63d4baea64a5UL, 0x460e5a0d0ad9d671UL, 0x0f657702ec6d9094UL, 0x2be95eed37ac9605UL }},
+  {{ 0xf316c4d95eb7ea9cUL, 0x6d06b60bf3f36c32UL, 0xf17f5c561dab19efUL, 0x0d134954f04bd52aUL }},
+  {{ 0x4e14609e22431a2cUL, 0xe6c0612fd973ac01UL, 0x9eecff9f9e76a8daUL, 0x17c25c24a87bc65fUL }},
+  {{ 0x1d9e3836e6c405c2UL, 0xc8646b346921ce88UL, 0x0faa8eb6224bc371UL, 0x21c3ccd403f32b98UL }},
+  {{ 0x30480771e7858e45UL, 0x5cdd88fcbc2bca49UL, 0x1d491fe92759c3dbUL, 0x0f4af1e5414bc669UL }},
+  {{ 0xd95dae01ebbdb104UL, 0xdd2f7890923ea688UL, 0xc63f953e42cc013fUL, 0x106b16756c6396e2UL }},
+  {{ 0x63a24239bb70c871UL, 0x5885745f5a66c65dUL, 0xa64c4afe0fd9d671UL, 0x1412706159951d28UL }},
+  {{ 0xec5d81543170b3feUL, 0x584496f444cb6496UL, 0x501a10974bc7c0c7UL, 0x0300b0b8bb857415UL }},
+  {{ 0xf5e4fcf176b556e2UL, 0xe58a87eb0c3c9967UL, 0x2ead4e0507700b32UL, 0x19af04210a76ac8aUL }},
+  {{ 0x8e3f863b16f614fbUL, 0xb293dfb5660a6642UL, 0x7ed3af6b70490769UL, 0x178faec15557bec2UL }},
+  {{ 0xdb392aa0bf1902fbUL, 0x9aa590b7c9d6f6f0UL, 0x4bbd08435ac58846UL, 0x10bbebd008d80218UL }},
+  {{ 0x8f9e0f7279c62a9eUL, 0x45e343c59d41177cUL, 0x91ccfdd10e9db359UL, 0x13f40ae14d25569eUL }},
+  {{ 0xbf658df2794fb730UL, 0xc76fd6550bdfa757UL, 0x34fd00a72d484728UL, 0x1510c4585bba9a30UL }},
+  {{ 0x5c3b1db5734cfb3bUL, 0x73a3b078f125e2f3UL, 0xbf477b270a864c53UL, 0x21377a556ee66188UL }},
+  {{ 0x9db0e7929c13aedfUL, 0x767763486622bdbeUL, 0xd8bfd839db917745UL, 0x1b5a179b749a9be7UL }},
+  {{ 0xb83ae675d18cbdc0UL, 0x8109bdd778833c77UL, 0x60103a6926e6759eUL, 0x1559664f2cc4d1acUL }},
+  {{ 0xe9778933791c99a5UL, 0x8c0e7ffffd9fabd3UL, 0xf8eb14843e201127UL, 0x303bfe2468c594eeUL }},
+  {{ 0xb1dce825c07eeb44UL, 0x9e59e39f176d3e6fUL, 0x8d51b8f74c49af0cUL, 0x13d1c6fd076d226aUL }},
+  {{ 0x1d6c4a05bedee07aUL, 0x569b97d6b0ee80f0UL, 0xf5dade8fa7952366UL, 0x14e4e54f1f4c1038UL }},
+  {{ 0x6ce06f0124d19859UL, 0x117e5a863143cbb3UL, 0xbb6c8fd3329846a4UL, 0x17d843704fcf5904UL }},
+  {{ 0x8161ded801b441dfUL, 0xfaf9691548511020UL, 0xe064dc0d10523b4dUL, 0x1775b6f4e502684aUL }},
+  {{ 0x463d60f3ef96b9f9UL, 0xb61f68302e851f4fUL, 0x89f7bef0508bbc72UL, 0x03be84ec64279289UL }},
+  {{ 0x3ce71ebd5f6a03f3UL, 0x0b19ee69ca4f8d33UL, 0xeb363d0f8b215bacUL, 0x257bd3c8870a2ddeUL }},
+  {{ 0x32f04a13c2841a2cUL, 0xa3b5d3ea24dd496dUL, 0x16ba740a12adc3d3UL, 0x2ae3e3d8efadcb2fUL }},
+  {{ 0x6ec0efc7b771b4b5UL, 0xe63d7b284a2f575cUL, 0xe7185aacd854744dUL, 0x0bdbfe0f238d145fUL }},
+  {{ 0x2580c83b648e483cUL, 0xca05e427a33c658eUL, 0xec9a75d37620c3f2UL, 0x28261c369046cbfeUL }},
+  {{ 0xa2267e0254e46f56UL, 0xd22e643b697fa26dUL, 0x48fef3a2abe702bbUL, 0x056f8afd2494e97fUL }},
+  {{ 0x642a1be6e147326bUL, 0x2169beaf57ba4ee3UL, 0x980709e88e894379UL, 0x1dcb385fc10ac771UL }},
+  {{ 0xd517d4dcaa01bb52UL, 0xf4494b08e1a9f7abUL, 0x5b69d6d8085dde5bUL, 0x1ebd1589ac5f596cUL }},
+  {{ 0x408ef7b87bd13872UL, 0x729d5df35cb837b7UL, 0x5117ce8cc18c4661UL, 0x0e087f6d947ccc28UL }},
+  {{ 0xa6c905260fdb8db8UL, 0xf8d754c36559d833UL, 0x4301726b8352b599UL, 0x2fa556e26edc4ce7UL }},
+  {{ 0xf9d306cc4fbdf9fbUL, 0x6df8657410636126UL, 0x37e163aa2660d21aUL, 0x2d0187f35f12991aUL }},
+  {{ 0xe82d5e114d4f8598UL, 0x2ea085d2fa61c1ccUL, 0x5df6c89f02b8deb1UL, 0x26fa6d3ee19625acUL }},
+  {{ 0xd8cae9fc9a2a6d78UL, 0x9fd8dec71d1caffdUL, 0xa647b0890c866ed7UL, 0x2f276c2e79be876fUL }},
+  {{ 0x23975379e128b7bbUL, 0xf66a8b44730582d7UL, 0x45f403dd689ea7caUL, 0x2147183601446cf8UL }},
+  {{ 0x7bb667ca3aa79cf4UL, 0x92edeb6a3e5510ddUL, 0x6e035309dee0d4b1UL, 0x252fa34d95270487UL }},
+  {{ 0x7dbc09c516806324UL, 0xd106551c11eadef3UL, 0x9263c4904ad244c7UL, 0x2c7576f843940d84UL }},
+  {{ 0xc9cf80ca9c98762aUL, 0x75d50d93275aff14UL, 0x7f5bda58c6fe0dd6UL, 0x2a1cf527e893597dUL }},
+  {{ 0x8780f15c4c2acf00UL, 0xb5ea043fba210034UL, 0x37b91941103261ceUL, 0x11abeabd4c51e984UL }},
+  {{ 0x4e3d8c0939b2e167UL, 0x9b7dec721fa55fe1UL, 0xef4cc7be66488a60UL, 0x074fb87b3aa762a6UL }},
+  {{ 0xb3bbb8b5cc609c86UL, 0x6460422954d64e9fUL, 0xb8a79be6923a7317UL, 0x296b862a97f0185aUL }},
+  {{ 0xc86eeb6acb31b0f9UL, 0xf1aaddd2a4df6d7dUL, 0x1b401ce0e82311d4UL, 0x1d304c0b00a78699UL }},
+  {{ 0xbe28a5fc4f31181eUL, 0x15731f0f3f2e1265UL, 0xecbed9f73a7e3bdaUL, 0x209bc408a637fb3aUL }},
+  {{ 0x49ec7e612f3ee094UL, 0xc987fec3782079a4UL, 0x0829b5a0d83d9460UL, 0x2ef3691fec444b8cUL }},
+  {{ 0xd09fb1fbe495a417UL, 0xc9255f9754b3e3eaUL, 0x8c787d76e2f558f9UL, 0x23a39ba3d00fffa3UL }},
+  {{ 0x2e7c94e132b90757UL, 0x1783bf69cd56349bUL, 0x1e1033ec8d33e288UL, 0x09b8214cb04a7a04UL }},
+  {{ 0xc60bc3a9ffc14e30UL, 0x79bfb4c1c457ec5aUL, 0x35c69f8795468c8dUL, 0x06f1840d40d7fc45UL }},
+  {{ 0x6d98379b05a274d9UL, 0x2c07382dc70a22b4UL, 0x1392eb42c1c52860UL, 0x216fa0939ec92227UL }},
+  {{ 0x4bb99330c53722d7UL, 0x26d8ab7880dc03c5UL, 0x21a1833457365670UL, 0x16c8828e05f04c54UL }},
+  {{ 0xef3463c5f387cf5dUL, 0x5506a6d221505aa5UL, 0x8f2c6ef1deabc40bUL, 0x026c2e7405e2f1f7UL }},
+  {{ 0xd4f512bcbb9d26b1UL, 0x7deef133f89a43f5UL, 0x3769e3fcb66f48d0UL, 0x2a6f30cfda7fc6ffUL }},
+  {{ 0x15e2d8d682a0cf80UL, 0xc7f5b314a94a1224UL, 0x20f7f90461b1090cUL, 0x293557fef8bdc5b8UL }},
+  {{ 0x52d0fcf3344b0dc0UL, 0x7d91bb73e79ebbaeUL, 0x9b39884b31515a95UL, 0x122e989cc73b564cUL }},
+  {{ 0xf35ca32bfff0aa6eUL, 0xc86e5ed1049360f5UL, 0x98cd7d49ea067aaaUL, 0x19f68a93d61090caUL }},
+  {{ 0xac8ff319bcd66feeUL, 0x9e9f1f2070995792UL, 0x72f0b94914845266UL, 0x06fb84d6d1db0a1cUL }},
+  {{ 0xb993951897a1f22dUL, 0x48e0d2714b1123feUL, 0x7c0a1bb3cde3b8c8UL, 0x11963c35a431023dUL }},
+  {{ 0x9a7885c7ac739509UL, 0x5f33fa497c435fe0UL, 0xbc9652ce98e8b7d6UL, 0x139e38586e6d4e6dUL }},
+  {{ 0x54affe0421d12f56UL, 0x8d4ab83d9a2f4e54UL, 0xb5b611faf6b24ed8UL, 0x302003ae43ff074cUL }},
+  {{ 0x31be54ce9a00b9bbUL, 0xb7e0d99740a23097UL, 0x2f192483d330d7c2UL, 0x0fec06ac556a9f3eUL }},
+  {{ 0x38235bffe2c9c940UL, 0x4fad7fd664c31fcfUL, 0x9c5add4f34034393UL, 0x24f883f6f758bd70UL }},
+  {{ 0xbcc987bb8ab32f35UL, 0xdba813f2b452b2d8UL, 0xfc53a3b55fa4491bUL, 0x0ca168c491707074UL }},
+  {{ 0x2c5cf4021d7428c5UL, 0x04966f7d3e9bde66UL, 0xe2ca9c9cd4058d88UL, 0x2bcbc9212bfeb974UL }},
+  {{ 0x32959c766dffcf78UL, 0x5fc0b8e74a067e46UL, 0xfbd5ae3d76ce80cbUL, 0x169af9616c754d2eUL }},
+  {{ 0x78ee9b0560214f5bUL, 0x1a1c99dd5c5a36d8UL, 0x8d536c7868793d9fUL, 0x076c73dee1d98ff3UL }},
+  {{ 0x3419240a31840a7dUL, 0x12fb59447be28d57UL, 0x04395e2ef03b670cUL, 0x1eaffca7e2402d1aUL }},
+  {{ 0xd8a5a88d34c9bdb4UL, 0xb5c12869bcf5cf9bUL, 0xd5078a874e77f319UL, 0x047d0f7b25334097UL }},
+  {{ 0x7f915eb63ca85e18UL, 0x7e2a9ec949af4287UL, 0xce0e19326ec4519aUL, 0x14f6b4209a70c083UL }},
+  {{ 0xe784bfeb8ce4bd3eUL, 0x9cf4933a777edc60UL, 0xba14d34759429c0cUL, 0x2d0dc73f3dbacf7eUL }},
+  {{ 0xbd09317010eae275UL, 0x0d116ba722c8ff5eUL, 0xd9b4da1d11e01a53UL, 0x2f0c63bfe641ae52UL }},
+  {{ 0x225555accfa08b17UL, 0xb0730bec7bebdf52UL, 0x99ffc3b799729948UL, 0x2f69763750e7f7dfUL }},
+  {{ 0x5a3b5649ae995d04UL, 0x789d9e9e39e4a944UL, 0xa50b2204dc670b59UL, 0x0e9c60c20c4b4b4fUL }},
+  {{ 0xd756cf146502d284UL, 0x7a1486ccdb73c2e8UL, 0xd2f7a42a4ab746e8UL, 0x171b511bcb2dc9d9UL }},
+  {{ 0x5010bf96464c2477UL, 0x468717c9ae05b667UL, 0x2b218ca97b9ee355UL, 0x0f608051eee12118UL }},
+  {{ 0x99def3e70fcd8e05UL, 0x3e5a9ea4446b029cUL, 0xb1f1b6f9470a1d53UL, 0x032c3cb977ee5935UL }},
+  {{ 0x4ee1c2c3f0219eb6UL, 0xaf996d6ee21ec651UL, 0xcc65bc5f3480219bUL, 0x0113c2e919175ca9UL }},
+  {{ 0x5e64505366d98391UL, 0x0abc6d8d8f2b650eUL, 0xf01538181342139fUL, 0x1387171c5df89c77UL }},
+  {{ 0x9b489f36259c96dcUL, 0xbc5fdfbf9eb63efeUL, 0x9e0754a315c6799bUL, 0x246177644d30d94bUL }},
+  {{ 0xef5da1f9fab2308cUL, 0xf69b0734dd698c99UL, 0x0078c80ef2be03e6UL, 0x101aa51b6cb12d91UL }},
+  {{ 0x3e00463d0e770322UL, 0xc82b98f82575d50cUL, 0xbdc8c63bb1bae27bUL, 0x2a606779a3f658c8UL }},
+  {{ 0x00804c7a63dc4e59UL, 0x5afa6094d5ad557fUL, 0x7cc90edfdcdefca1UL, 0x0f6fd9bd28c78438UL }},
+  {{ 0xb3d0a45f32a790dcUL, 0x43d5c184208e905cUL, 0xeed7d83a73568783UL, 0x0cf7cbc0ecb7a16fUL }},
+  {{ 0x013f20dbaa98bdf1UL, 0x3c354874a364e436UL, 0xa5672b9ebf792c25UL, 0x22c72d56c95b2826UL }},
+  {{ 0x1ae7cc4fff7db6baUL, 0x7d7b947e69b31679UL, 0x72d9c81a441ef90eUL, 0x15da46076cbd3d9bUL }},
+  {{ 0x72a2f3726caad581UL, 0xd306b89a8ccdac56UL, 0x987a758116c4c2dbUL, 0x15170fdfd61d9350UL }},
+  {{ 0x0ad137b147931717UL, 0x4cd3c802a2bdd66dUL, 0xffc923f8de5fcc38UL, 0x16bd09fffe76aee4UL }},
+  {{ 0xccdca10f7e2af57dUL, 0xe22815dad2566079UL, 0x4055838521fb3ffdUL, 0x0fafeee7b67070b4UL }},
+  {{ 0xd5c8f035dcf04582UL, 0x6b66d8cde4c4e434UL, 0x4268c4c4fb1dc339UL, 0x01bce9f1c5a03630UL }},
+  {{ 0x5635e418b825dd36UL, 0x21a172b3b3bf7ab6UL, 0xf1c62ffc247a9231UL, 0x1a9b7ad9f652012aUL }},
+  {{ 0xa3eb353bc9c281ceUL, 0xbfbd17ef5e4db87eUL, 0x8038c3a453d45353UL, 0x0abc2482acd8fd06UL }},
+  {{ 0x951aa3a28cbe58cdUL, 0x33bc869191d9a689UL, 0x0ed4235b09e83526UL, 0x13668e411bdebca2UL }},
+  {{ 0xaa1a1f4c5093d888UL, 0x9513ec6372feb5eeUL, 0x4e3218ebcc35edc3UL, 0x0b0278cd517b9bacUL }},
+  {{ 0x1d6446c8e6dda10aUL, 0xcf99e9eeaecbae2fUL, 0x86339e982c884ac6UL, 0x1ba6fdca35a713e4UL }},
+  {{ 0xfb8edf2aae3d85e1UL, 0xc6df6f6d6d2c64f4UL, 0x7b49f7757074322cUL, 0x152ca725e7209ae9UL }},
+  {{ 0x7f930f7142ffaed5UL, 0x3c8a8787634bf548UL, 0x3449eba913ae2079UL, 0x1fc692850da5c1acUL }},
+  {{ 0xe4ee36f8ef97505eUL, 0x66d7a18ed2a89e19UL, 0x62be2ba45a94ae5dUL, 0x14996be38b173148UL }},
+  {{ 0x3b02c8a3a485e25dUL, 0x30feee5127989e5aUL, 0x5de064b28ca56602UL, 0x0e2a9c38b26663cbUL }},
+  {{ 0x997e19a2f94c7d73UL, 0xe1cc3841cbde34d1UL, 0xc2a8ab4f82f71846UL, 0x0ea45acf0ab678beUL }},
+  {{ 0xaf9de64855416ebfUL, 0x90cb4e4c97f1166fUL, 0xa53dd5555db50315UL, 0x24efa8c2cce58f72UL }},
+  {{ 0xb79c43570ee33892UL, 0xba1dfa718e7d0b45UL, 0x42f6c6e4fd498077UL, 0x1a05ba7676bc4186UL }},
+  {{ 0xa5bd2960e33e1665UL, 0x813f78020b50749dUL, 0x37f38d9f5311a78dUL, 0x294b0b3512187057UL }},
+  {{ 0xbafbeeb75b3636ceUL, 0x791e7dddf1189b4cUL, 0x24ab0844045be303UL, 0x05576924f36ff80dUL }},
+  {{ 0x9edcf44383ca1258UL, 0x6776dfbd8b439498UL, 0x872c7bb2750d62e8UL, 0x0cd10b7f5275f261UL }},
+  {{ 0x4231d41d1fb89437UL, 0x3e8bffef5e5b8c8fUL, 0x01e4a28fc7503bb4UL, 0x1a116c9d12e98233UL }},
+  {{ 0x53b810bb1aeebbc6UL, 0x98981a9601ef363bUL, 0x9aca4edddf41e4fbUL, 0x182789872120f209UL }},
+  {{ 0x8e468495a2873995UL, 0x53f24a483895babaUL, 0xf058c902484cb2efUL, 0x05464af6cc33b42cUL }},
+  {{ 0xe7ed14326557c35cUL, 0x9c56eea67b70f046UL, 0xe758b1c9be2b7b23UL, 0x00f37f52f74bc059UL }},
+  {{ 0x8f8be0f4415e85f1UL, 0x05167644cf4dffd3UL, 0x6c05e262695fb43bUL, 0x10aa12a353050dc3UL }},
+  {{ 0xef231e744e3169a6UL, 0x7860214c953aa3a4UL, 0x50e27ea548549ce5UL, 0x0f240f9c15eb7400UL }},
+  {{ 0x55ce7c1657d33ab6UL, 0x930e175a4ed27156UL, 0x3ab51b5cb22aeedaUL, 0x26611b9de15506a8UL }},
+  {{ 0x51fa1f7a20a33004UL, 0xb6a75860c1e56db3UL, 0xca575f0aa6a3238eUL, 0x1fc9b5f20e817492UL }},
+  {{ 0x1369d2d4675e72d6UL, 0xf90e737c5f38d68eUL, 0x7943d9b9cd703bfaUL, 0x23cab46203f4e42dUL }},
+  {{ 0x581594c437928eccUL, 0x9292a3f7dd733271UL, 0xe2dbd460ada93b6eUL, 0x17695db3f5d335d2UL }},
+  {{ 0xfec6376fafde9685UL, 0x15a1433184a7083dUL, 0xe3729ded857ee107UL, 0x21d1185b9dc79918UL }},
+  {{ 0x6c74ca4ec959f0b4UL, 0xba501f515d048a80UL, 0xcbbfbe368182ccbcUL, 0x263553e8c287a7d4UL }},
+  {{ 0xd7cde5b9c9f72db2UL, 0xaaade65c4bd663c5UL, 0x0ff3642239803661UL, 0x18cadb896dd524aeUL }},
+  {{ 0x0004a56c70914f9eUL, 0x12138f2d78f114d5UL, 0x5007939ded20919cUL, 0x2764d9f3aa52800bUL }},
+  {{ 0xbb01cfc4250f70e5UL, 0x8dd33dfdfdc926b2UL, 0x7247bf37410e4bbdUL, 0x24e53a8a0b0254b8UL }},
+  {{ 0xefd793f003edbe86UL, 0xd99693c543d60a46UL, 0xe1fb0df20cda93f7UL, 0x24c9705d548ac42dUL }},
+  {{ 0xa40fb1b848b71f3dUL, 0x2449270168c70fc8UL, 0x949898b6647d263dUL, 0x2f0a7543c04b586fUL }},
+  {{ 0xc92cda190fdb2f9aUL, 0x7eb2c5df82a31bb2UL, 0xcb992d6d12dfae69UL, 0x193813c24a75b805UL }},
+  {{ 0x994a7b720e22d079UL, 0x997d9978f1e83204UL, 0x0476309bc8893774UL, 0x0cea34f0f33f82f6UL }},
+  {{ 0x63186e6774b0c458UL, 0x788fd5dedf056a4fUL, 0x1f90dc5c0d8f38a3UL, 0x16756f7d7a90c5d2UL }},
+  {{ 0x6c77b152a17485d5UL, 0x494b997e68d63512UL, 0x849b31e512b3f7d3UL, 0x2b763771774b5fc8UL }},
+  {{ 0x3d8466055d78a2f7UL, 0x1be8bd7bda20a824UL, 0xb35a223539ed4293UL, 0x00f7d7dd2f2aa6f5UL }},
+  {{ 0xf0d2f8f3581e4c54UL, 0xd8b2d9fe71bbd063UL, 0x9c7d7f2610c232e2UL, 0x1b2ea96c3c226309UL }},
+  {{ 0xeed1c27056065042UL, 0x8937bfa168f64239UL, 0x5b89e2a870e8a538UL, 0x1f56888d65ce90eeUL }},
+  {{ 0xedd419e44576eca8UL, 0xbe82aefc3c7606d1UL, 0x672b7db4fb15854eUL, 0x0b9cda7fbf0d15ccUL }},
+  {{ 0x913c2299a03f8e5aUL, 0x793b9c2b2b9c6d8fUL, 0xf942fdc10cd3c90aUL, 0x10b0657734a1cb76UL }},
+  {{ 0xa3816ee1a38a14b7UL, 0xc2a271b8ffa1c901UL, 0xa9151ca4ff06fcbdUL, 0x301d136f78948327UL }},
+  {{ 0xdc6eaa90d2d51598UL, 0x52a1e677f237ff53UL, 0x849cc24dbd5d78baUL, 0x1579896f8fbe619aUL }},
+  {{ 0xb6bc3c4aa2f77878UL, 0x83bbd1818d4c015cUL, 0x0e8466c391bb1e8fUL, 0x236e8d2508d72765UL }},
+  {{ 0x5ab5ad303e2fd142UL, 0x3fa9c805608595acUL, 0x060c9c21cd30269cUL, 0x1d9cae8a63aeb9f6UL }},
+  {{ 0xc1b4670b9d3d968eUL, 0x5de3f6e579d9c183UL, 0x808c9b0f02a160b9UL, 0x0eb5f65250ef47f1UL }},
+  {{ 0xa3f8efbc8168490dUL, 0x1952cc8f1c85702cUL, 0x0a7f42b891c33fc8UL, 0x1eb9cfad1b674d0bUL }},
+  {{ 0xf43ff8bd4860bee4UL, 0xfeba155676945d55UL, 0x0636f31a3bb0d612UL, 0x02ec23137c184c07UL }},
+  {{ 0x815802f6ec14bde4UL, 0x61a06c7aa60ba9cbUL, 0x29a7bd13a37905e0UL, 0x2013c0e980ad6b6aUL }},
+  {{ 0x9b98c65319077ffdUL, 0xc28bfe1a8cd4279bUL, 0x96e638f969a0f1ceUL, 0x13bf4bd432c6037dUL }},
+  {{ 0x8d1c26124795185eUL, 0xf36ba8f840ae6ab9UL, 0x6cf1e60bbcb8b9acUL, 0x2577305dc82ac2b6UL }},
+  {{ 0x1a65cd847e5b67acUL, 0xc34cc7c347fe4f36UL, 0x25daf4da95d9d85aUL, 0x1185d118813917f9UL }},
+  {{ 0x193c1f990de7cb11UL, 0xca16af2076334325UL, 0x77f5a1f67697d20eUL, 0x1345bdadbed0995fUL }},
+  {{ 0xeebf5573266269ccUL, 0x1b49e78cdeae54d9UL, 0xb12e37bf7e20cf68UL, 0x250ef9a472d6dab0UL }},
+  {{ 0x42b5255af3ad1488UL, 0xbde222e34accb648UL, 0x42b881a3c6333466UL, 0x0cd64c33cbb55078UL }},
+  {{ 0x27b1f4b2591157b0UL, 0x8339a5935a41edaaUL, 0xa5b4bc15c300e836UL, 0x1de4e5f4988f8b78UL }},
+  {{ 0xc8709da2444ba3f6UL, 0xf6ae060fa5d76549UL, 0x0072e30411f54bcaUL, 0x0bd3fcff9782dcbcUL }},
+  {{ 0x34effab016e8abfcUL, 0x31eb40390f9929ceUL, 0xb8cdcf0621942bd4UL, 0x29ca94fe916a894cUL }},
+  {{ 0xe4af2fb9dc4634b1UL, 0xd0969ac9c987b867UL, 0x0459cd3b4bbb3a50UL, 0x15edb0cdf8462b8fUL }},
+  {{ 0x5db1c7ed786097b2UL, 0x2f87bae6b49bca24UL, 0xb13aa4555a18a480UL, 0x27124a104224908aUL }},
+  {{ 0x3eb21c2819589dceUL, 0x390af32ce609e7b7UL, 0x4342bf1a740a7145UL, 0x1715dccd41b6f57aUL }},
+  {{ 0x46e62980a4372abfUL, 0x0c50d9e15f8cad62UL, 0x3e697e4ab847288cUL, 0x25345e7dc52d523aUL }},
+  {{ 0x7959fbea493b5d14UL, 0xd0b9229c6a9bec16UL, 0xac10f2a617514b8aUL, 0x2c332561ef030dd5UL }},
+  {{ 0xfacee3d59a5b667aUL, 0xeae4786e5cb0ad18UL, 0x99647b0f043d4cbeUL, 0x049ffb62ff403e9fUL }},
+  {{ 0xdb63a1904991015cUL, 0x3d40552afa5cc058UL, 0x1727089e6f286f91UL, 0x1f55a341629f3e84UL }},
+  {{ 0x8c6cdbc6e547c41fUL, 0x37038f49e90b450dUL, 0x206e1e20f54fe22bUL, 0x0e1f685a688197dbUL }},
+  {{ 0xca6b5025f4a8f474UL, 0x64241e4b354124ddUL, 0xed6cd522d3adeba0UL, 0x01017742072e09a6UL }},
+  {{ 0x8444b5b4c38491dbUL, 0x6be7191df8d01e64UL, 0xb3e6008040cbc950UL, 0x0fab7f132e16785aUL }},
+  {{ 0x08ed067da0193feaUL, 0x3452bc257d166809UL, 0x40b345d013ffc643UL, 0x1a97635d50d41e7bUL }},
+  {{ 0xe9eb9b26bbeee8f5UL, 0x7269a055b3111495UL, 0xfd34b66aef2e653eUL, 0x19a020e127ce709bUL }},
+  {{ 0x3828d71a41d17dccUL, 0xdd3fa336b708a64fUL, 0x73e6b12c3c63b337UL, 0x12202592422ad009UL }},
+  {{ 0xe41a821a28a539a7UL, 0xb295c983e232fdd3UL, 0x8ba4be4310d391b4UL, 0x020169613addba58UL }},
+  {{ 0x9f434984fd18efa6UL, 0x8ac2a0e40e99b27aUL, 0x5c13e11ca1df053cUL, 0x2fe06b407464f3fbUL }},
+  {{ 0x9a0e7f1c093a43b2UL, 0xed98b24ef9f15113UL, 0x98e6068c0fb9aa34UL, 0x2462f0094cbafa52UL }},
+  {{ 0x4a9a7859c4668b85UL, 0x25e5fc11f249b8cdUL, 0xbfffb251438434d1UL, 0x29b9f02a46eaeeceUL }},
+  {{ 0x667051cb014ce405UL, 0x27cd586dd3a50617UL, 0x27af0f45d5040d3cUL, 0x2434f423276f5db7UL }},
+  {{ 0x49cd9a72ed4f8f86UL, 0xfd41b9df26915ac0UL, 0x6013511683d1dfb4UL, 0x0468f27d0654e5ecUL }},
+  {{ 0xdb6772f3b3523ae3UL, 0x17f473282eb82425UL, 0x8281304ea4c11addUL, 0x0d4edc804f3dcc1bUL }},
+  {{ 0xb5bfe5d870797348UL, 0x9f605465e7756a7aUL, 0x26499564c32edf82UL, 0x2cd04a73f7a3b826UL }},
+  {{ 0xb8e4dd21b825a9dcUL, 0xc4dad826c00181f7UL, 0x4ba493ebda454bd1UL, 0x0caf32d0fbdf8ce3UL }},
+  {{ 0xee42505ea90de6eeUL, 0x15712bbd336165feUL, 0x1a762fe328cfc761UL, 0x0f02b6a7a08a32b8UL }},
+  {{ 0xeca73834f53fc2ffUL, 0xe356fcca105a7a04UL, 0x2b18e4ce9741f3abUL, 0x29f38b7c7da1b0c5UL }},
+  {{ 0x53e1530726f91f58UL, 0xad99daea9b00395eUL, 0xe16b57392b780b82UL, 0x0afc3343b17456dfUL }},
+  {{ 0xe1eba0b168ebe968UL, 0xfd1b5f246ad87f4bUL, 0x2b8d1504935c268bUL, 0x285cb6ed9d18b0d1UL }},
+  {{ 0xe94899f6f17b13feUL, 0xc3d6adcfa08939f4UL, 0x17d32f88e9133fc6UL, 0x25475a0d1014f12cUL }},
+  {{ 0xb9b3d653c001381cUL, 0x8257a0b15c3858d1UL, 0xf3301f96c4c372d8UL, 0x22f49afeb182f41dUL }},
+  {{ 0xc59ebf3421a39b14UL, 0xaada22210ccef23aUL, 0x5adf93c54e72c5e5UL, 0x2fce2bac6910ace6UL }},
+  {{ 0xcc166c7bcd1aa607UL, 0xbc15638b6f8ba1e3UL, 0xe8eac866e71c00d4UL, 0x1da57e1a0b06887fUL }},
+  {{ 0x766723f2858c4d4dUL, 0xba49321a0eb81cfbUL, 0xcc910a60f9bbe40dUL, 0x271a69c7bb0a886eUL }},
+  {{ 0x58e713a66913177aUL, 0x651df13905dbe756UL, 0x865327dd77d36a5eUL, 0x2bc3d08053a70913UL }},
+  {{ 0x7c20b0522f1dcec6UL, 0x93a33dbce63e9078UL, 0x84bef32c60084062UL, 0x170e5a196888769aUL }},
+  {{ 0xe5166878ccc7743fUL, 0x3ad497e933d238dfUL, 0x0d203a144af3319eUL, 0x01e9f726f4c7f6b3UL }},
+  {{ 0x29e564be6e4dd4f2UL, 0x4a3bae5bf2f84b5bUL, 0x843c7e006c631af2UL, 0x0d4dfba2ed0bd5f0UL }},
+  {{ 0xba8e4ad23d322f6fUL, 0x98bc46923c34351cUL, 0x0ff151309d947c29UL, 0x2987fb83044dd547UL }},
+  {{ 0x47890ed8bfc5e6caUL, 0xaef7e2c2f9b17416UL, 0x7c4e9f553c7dc72fUL, 0x0cb1cef32e1e0257UL }},
+  {{ 0x14bcd096c3ea5a8eUL, 0x4fc9333a1b375a50UL, 0x2546ffc4c212b2a0UL, 0x153f244f17d28821UL }},
+  {{ 0x97f043f787fb4b09UL, 0xfd14a9f035c737a2UL, 0x09668ebb4e4a0d6cUL, 0x007762ebe9a3c771UL }},
+  {{ 0x8298fca9192e500bUL, 0xa3616a92d7380f40UL, 0xfa8ed87b666fad58UL, 0x29ec2d951717ec05UL }},
+  {{ 0xfad2f702843959a6UL, 0x22c9a3c90167ba1eUL, 0xfc6f950c1f48397cUL, 0x2487f1b1adf3081bUL }},
+  {{ 0x1663b9231324c3aeUL, 0xd236ce8929d7f957UL, 0x6e47b114ad54eda1UL, 0x17312c3a94ed6ff1UL }},
+  {{ 0x18b52a29e5ebb278UL, 0x5b5f129c6a6e6bb6UL, 0x572cee00ece1ca4cUL, 0x1d21b2ae5c2b8ba5UL }},
+  {{ 0x5015d6e5dd5a8cbfUL, 0x1aa3aeb1683b6aceUL, 0x6ebee4427c2da4beUL, 0x079ddf27e91f1eedUL }},
+  {{ 0xe018540e83af5678UL, 0x5f7c846d6d58c4afUL, 0xdf8186227bb3d6ecUL, 0x1c6fcef0e5b639fbUL }},
+  {{ 0x27a46e9672b64bb2UL, 0x4b41ce201a4df729UL, 0x2b6ffe41290c43cdUL, 0x02ccf76aaa17fa5cUL }},
+  {{ 0xad114cfa0b5c0731UL, 0xec6f74c886743b7cUL, 0x56deb8e4d77b63ddUL, 0x198ce882b309c767UL }},
+  {{ 0x2528e5034d763c6fUL, 0xbefd84d8100b90ffUL, 0xc2aae03ec4031de8UL, 0x26c072406413de50UL }},
+  {{ 0x581fd7d3a4bcc8e1UL, 0xd719101955f4f753UL, 0xeefb5c49ab2f697aUL, 0x191110cc5d6eb947UL }},
+  {{ 0xe01b4a763dd29c52UL, 0xfc4074735a3f587fUL, 0xf5a335a1a2ccc4e1UL, 0x219a8d65dfe2fe3eUL }},
+  {{ 0x594b156fe5a34423UL, 0x4b152e25b8a71e16UL, 0x5b233ac0ed27fee8UL, 0x2cd8d6d7a02f9211UL }},
+  {{ 0x35e61469dfb9487cUL, 0x556197397fbf3466UL, 0x7f6b389762b46bbfUL, 0x2a8ff68a05e6501eUL }},
+  {{ 0xdf2f8c6147e94f3aUL, 0x9f8659340c85323eUL, 0x430b72391a172524UL, 0x05e7776ad7203549UL }},
+  {{ 0x2d7a840ae099096eUL, 0xc50523db616f6b7cUL, 0x591d05b9813339c0UL, 0x0135b4d4bbf25341UL }},
+  {{ 0x743442a70a2918cdUL, 0x758ffe54854c326bUL, 0x8f56a79b442ebdbbUL, 0x111df17008d67eafUL }},
+  {{ 0x03fc9f6cc57bf79eUL, 0x561633d965998e4eUL, 0x5e8f3c86289eecbeUL, 0x259e85f957c1c010UL }},
+  {{ 0x95558ab2acf43171UL, 0xb515d114029d4c45UL, 0xe3ac0d1eb867a34fUL, 0x09b2529c37840622UL }},
+  {{ 0x1339fd8d7218672fUL, 0xeb1f88b237c5325bUL, 0x606fcd4b19107cbfUL, 0x176ff61ed774ed56UL }},
+  {{ 0xba9887b8aba7e4feUL, 0x46f7638542c37849UL, 0x32aefeba6c64edf5UL, 0x2f7e30f2410d12f6UL }},
+  {{ 0x8e1aa5f8733a48b1UL, 0xb8c46c97de5bbc23UL, 0xbd42b6efed78c27eUL, 0x067a848375d211b3UL }},
+  {{ 0x6e0a258478b0aa29UL, 0x8774e4023440f33dUL, 0x77ac58a91ade0df5UL, 0x000a43ab63c20373UL }},
+  {{ 0x3a5f7a6142f865fdUL, 0x85a60eddc7ecdfebUL, 0xf8d5fe95153c7e98UL, 0x26ed6bde497a0a52UL }},
+  {{ 0x2b00192e476bf430UL, 0xa834c9ba903c2dd6UL, 0x9d200a8fc967d352UL, 0x234ddccdef467f72UL }},
+  {{ 0x10c85f12dd295a07UL, 0x242e249e79398102UL, 0x37d1c51f14c8794fUL, 0x0699ac19a83c8df1UL }},
+  {{ 0x3d28e833614fb1d4UL, 0x2d52453c9eb492f4UL, 0x8d4f2e29b492c923UL, 0x1d21c786956b1798UL }},
+  {{ 0x3d8de2cdaff773c8UL, 0x98c7d34e40b98af8UL, 0xb3ae18a5bdba58bdUL, 0x0190d1c6d155c300UL }},
+  {{ 0xfc88b1ca4455767eUL, 0x2b068067357804c7UL, 0xfc32b26e93d4d8fdUL, 0x044082112475633bUL }},
+  {{ 0x9847256438c5ecffUL, 0x1fe239a514acaae8UL, 0x1e6bc9ac2dcba283UL, 0x27aec05ed1764825UL }},
+  {{ 0x33a97b00965ffc8fUL, 0xeb24461702260551UL, 0x8e8a1ec8b50ae71eUL, 0x1f68bb311799dcbeUL }},
+  {{ 0x71c3f534124c8a4cUL, 0x5b12692b06530cffUL, 0x4de204bf506d5091UL, 0x220a15549c9fa67cUL }},
+  {{ 0x2eb63e9cf94619e7UL, 0xe450db0a7f0476d9UL, 0x17ec534b356b34b1UL, 0x23ee998618bc20bfUL }},
+  {{ 0x3607b7505b9d1161UL, 0xafbad08c46891117UL, 0x08e12e1717d558f1UL, 0x02791ed6cc003177UL }},
+  {{ 0x264705fbf543d14dUL, 0xd976f979ab2b530bUL, 0x11420df038c409e5UL, 0x1e814cbd37b55d12UL }},
+  {{ 0xee977c96b51c78b0UL, 0x7e728fda93444356UL, 0xc6779489f85df176UL, 0x2a5404e4626874b2UL }},
+  {{ 0x8ee262c9e70d7f1aUL, 0x293bd0a8e9b59322UL, 0x90828253c38c846bUL, 0x2ca9fe72fccae372UL }},
+  {{ 0xfe704386dcbdefa3UL, 0xf4047e51a95589f0UL, 0xa43eb425886ef27cUL, 0x2bc7ceb5815da0f6UL }},
+  {{ 0xa4ccb25d93775d1eUL, 0x6731d4d66ff468efUL, 0xb0ff056ea424472fUL, 0x2b467402c80d88cfUL }},
+  {{ 0x4f60b186f709f7edUL, 0x2cb8a3a1506246aeUL, 0x6fd619a859a95eaaUL, 0x01c5e57219621b45UL }},
+  {{ 0xec985e974ea9eb88UL, 0x1fcae7b32a42390cUL, 0xa64f09993f277c58UL, 0x265f910ff5c23a2bUL }},
+  {{ 0x216f6def33de4812UL, 0xd4b5707119fd1cdcUL, 0xbf7544af53b337c4UL, 0x112a2d38bb37267aUL }},
+  {{ 0xad56e5aa64917f01UL, 0x1f058a33e47f13bfUL, 0x5a5aef8c269d6708UL, 0x2cf3506ad425b67eUL }},
+  {{ 0x8bc99ea50baf0af9UL, 0x80895555b7590958UL, 0x4a950473d7f44002UL, 0x203fd994bb116f25UL }},
+  {{ 0x72efcbdc7ead992dUL, 0x254ba7ed9aaed218UL, 0x691ecd3b2aebdf94UL, 0x09140da85e74403eUL }},
+  {{ 0xe550ac122ebfebcaUL, 0x589def1cd8952eaaUL, 0x28fa6f49c37f0fd4UL, 0x2bda08a4de699999UL }},
+  {{ 0xdb93cc3272473bf2UL, 0xf830189a63c2c25bUL, 0xeeb3b6b6b77525d3UL, 0x157e260798f621c5UL }},
+};
+
+static const fd_bn254_scalar_t fd_poseidon_mds_13[] = {
+  {{ 0x260f226f53effc0eUL, 0x696850298ca823bfUL, 0xcf41d3be9e9b8b29UL, 0x2aca1e1675cf79faUL }},
+  {{ 0x2f8b9f63433a61f2UL, 0xd47677ec1a78e4adUL, 0xabaf00d1a3d001e3UL, 0x102cb98270095274UL }},
+  {{ 0xc4cf73943e3a4fbaUL, 0x1594d67c3098e1b9UL, 0xac7a2d3fb9ab0acbUL, 0x032e60b174c4786fUL }},
+  {{ 0xced4c52d7b9faa51UL, 0x52b922bb0e4037f8UL, 0x84ca34a4fede794dUL, 0x1540ed67560cbdfaUL }},
+  {{ 0x3e7595447244a44dUL, 0x650eabd535d48363UL, 0xf75ed5ae2eee166fUL, 0x006d50f46161c652UL }},
+  {{ 0x189ecbc0d362341aUL, 0x21beaa62901c277aUL, 0x3e04c7ceb78ab48cUL, 0x1f0da8fe57845765UL }},
+  {{ 0xde06baf9e64bd8b3UL, 0x3c0355a575c50d6fUL, 0x017fedb14d4db69eUL, 0x1b4d2f282f186012UL }},
+  {{ 0x826e4da24ea63924UL, 0x16b8bf6b9aa1955eUL, 0xeae08d7ed96bae0dUL, 0x23826acbe10a3650UL }},
+  {{ 0x4636ca7443335172UL, 0xe2fb924be9c3d01cUL, 0x7b4e74dcd9928c72UL, 0x1f8db2b6a98fd182UL }},
+  {{ 0x32e4bc565a13629bUL, 0xeac7802a5b652020UL, 0x7e2ae44e4e44383fUL, 0x1e06c149daa8e55cUL }},
+  {{ 0x051fb0efd5d7e78dUL, 0xecb45f5c6c946827UL, 0x4b2b765bf3a12b08UL, 0x27cc8b7609f5fe4fUL }},
+  {{ 0x9698157e289308adUL, 0x589b5b8dbe68a1e0UL, 0xb3ec1feb2e0f1f31UL, 0x00b8b7e48b2c096eUL }},
+  {{ 0xff36ffd5ce2e06ceUL, 0x1ebfa4a2347972feUL, 0x227ac6471220871fUL, 0x16e74b792ae2bcf1UL }},
+  {{ 0x6e2c382d7470a19aUL, 0x3a9b8f27261c0889UL, 0x683726b47e17eaa1UL, 0x2dfa2c16ebaca0f3UL }},
+  {{ 0xe56b1b75f731a445UL, 0xda4d7950b216e7c2UL, 0x566e4107cf17103aUL, 0x1a0576727ecef5faUL }},
+  {{ 0xe49a8e83ea1761d1UL, 0x1880d387ed90dd05UL, 0x55aa4e633eafcde6UL, 0x2af2ca8f4a771b99UL }},
+  {{ 0x47e06afe6ef12c23UL, 0x1a5d60753af4ae10UL, 0x3d6be10d89b6d825UL, 0x2354b7cf03f279c6UL }},
+  {{ 0x18e10e9a94268868UL, 0x3405a8a8308b5c18UL, 0x541aea9220a7d340UL, 0x09575c698599a43cUL }},
+  {{ 0x5fe639d5a08dd032UL, 0xbc0ecbb77801c64eUL, 0xb06c0dc05f8fc904UL, 0x14b8a2177f2063e6UL }},
+  {{ 0xf368d04c1987646bUL, 0x74f794deb77ffce5UL, 0xc420f4ee29ecfefcUL, 0x0fefb11b255d2060UL }},
+  {{ 0x7d16c5182a6bb97dUL, 0xe7078f635e8f445bUL, 0xa23d3174d4090714UL, 0x1ac7394577b4f974UL }},
+  {{ 0x7ab5427976b94a86UL, 0x6b6cab1c3b0e3942UL, 0x2bde1a5c47a2485bUL, 0x19149c5166175898UL }},
+  {{ 0xabec949af75019bcUL, 0x0a093e251bea8a9cUL, 0xd9865d654c78e713UL, 0x060bd4a943aaf4abUL }},
+  {{ 0xfb1938712a7f10a0UL, 0x2b6ecd1186b8701aUL, 0x39c29ee6d632ebbaUL, 0x227b11f8b96b0aa5UL }},
+  {{ 0xfb8eec4e1fc77460UL, 0xfa958af78cced1ddUL, 0x1af15cd38d36690bUL, 0x156604c26cd6029aUL }},
+  {{ 0xa86ba5f1cc37ccacUL, 0xb09e470a378251aeUL, 0xe431064f49e68234UL, 0x07680e28f574a7afUL }},
+  {{ 0xf4fd4d294a9d807aUL, 0x87b812c679d476daUL, 0x4de5f7c20ccdf503UL, 0x193833769b59622aUL }},
+  {{ 0xf49ca3242a2c38c9UL, 0x71ed631a76c6ea45UL, 0x171d7b2d45febc09UL, 0x04607447ab3e618eUL }},
+  {{ 0x7f75f1d6d48a8bd0UL, 0xc5bf534cb3f40c23UL, 0x877022daa7da9c61UL, 0x2bd07713336e8b78UL }},
+  {{ 0x2e9d93d7f0f58ca0UL, 0x3514b3860ab79e92UL, 0x47ba9bb642c09c4eUL, 0x152ee98c5061467cUL }},
+  {{ 0x46ab490b443b2b48UL, 0xeb045b8d6842912aUL, 0xd2677b6e68a75199UL, 0x302b8e4d093a7d75UL }},
+  {{ 0x7675720025281329UL, 0xecf450e68114b3e8UL, 0x8a88c5bb5dd2dec9UL, 0x1fd3bcf8a4ae435fUL }},
+  {{ 0x8630d43d3d4e0421UL, 0x55e95f8ed00bb634UL, 0x93f04f454576dfaeUL, 0x0051943c108fba54UL }},
+  {{ 0xb4b4b9e49d3e5a59UL, 0x3459d8036bcf1a5eUL, 0xbe1e370659be3ffcUL, 0x028c9432d0001c12UL }},
+  {{ 0xe7dd445d51bff78eUL, 0x4113d1576267c15bUL, 0x9d5e06872db5646cUL, 0x276b5d2d14328b47UL }},
+  {{ 0xc89bff1c0e71722dUL, 0xdbfab595cb0bf99aUL, 0x81a667a0f6ab09aaUL, 0x0138b7eef4fdff1eUL }},
+  {{ 0xb1a62ec89fa29bddUL, 0x84a859264387dfeeUL, 0xdf78c74aa137dc28UL, 0x0b3bfd472cc14171UL }},
+  {{ 0xb17fe6547b81cd9dUL, 0x4f17b07433986b35UL, 0x9d616bc46cda700dUL, 0x29f1f749f0b54f07UL }},
+  {{ 0x0f158d075ef026c5UL, 0x15c3d339345f1edaUL, 0x970c7d506e45693aUL, 0x06d7f267a21ff412UL }},
+  {{ 0x52015f64dd3dd65dUL, 0x3efbb7b8c0baf5d3UL, 0x30a5fdaea6819324UL, 0x27a171fd5303b583UL }},
+  {{ 0x5ad206f4b6ff8e45UL, 0xa28e8344da051d61UL, 0x58dbefdd636a4daaUL, 0x24c8d4d3673ee177UL }},
+  {{ 0xe1cbb28415d506d1UL, 0xf873de5359acba69UL, 0xf5767af9f33f7ff6UL, 0x040d64fee8cb4e90UL }},
+  {{ 0xe8346c19dd8a6f05UL, 0x945484678acf8d4bUL, 0x98da17b21ef92c79UL, 0x2cc2598f30df37b7UL }},
+  {{ 0x6c31b2a06e6efd06UL, 0xf25ad4f2d2bc353eUL, 0x0a167258854dc00aUL, 0x0d75851eda6995fdUL }},
+  {{ 0x54dd2265a011eecfUL, 0xf965713a71f45e75UL, 0x9e605b5d4ad42ff0UL, 0x0c656afdace49fa9UL }},
+  {{ 0x618609db6c716edfUL, 0x15bc8abe63b9d448UL, 0xe145f52744227c79UL, 0x0f83fa7f003695b7UL }},
+  {{ 0xfa9341436a129cbfUL, 0x56f3f1764f38cfe0UL, 0x5576fcbc307115eaUL, 0x05b49bfbd88d5376UL }},
+  {{ 0x47a1700ca61b01c0UL, 0x984157d9f8a2d921UL, 0x7ad60cedfa53ef85UL, 0x2c1d6619f24ffeb6UL }},
+  {{ 0x6b138fe9a44959e4UL, 0x067da56dcd5f5c23UL, 0x90a5e5384d007af5UL, 0x054114de95aa57a5UL }},
+  {{ 0xcf3a66dc96fef86fUL, 0xf2e68d169900f3edUL, 0x60c8765274fd2b35UL, 0x05e17f321e1dc7cbUL }},
+  {{ 0xa64ae2afae9bd513UL, 0x0126a7cee7972246UL, 0x97a00fa06849d6caUL, 0x28e69ec623225828UL }},
+  {{ 0xc3acf11b4007d287UL, 0x788ad56b7438399eUL, 0x550eb386697e3e64UL, 0x09dbc3c2afd42a6cUL }},
+  {{ 0x4e5ea42c81dbb720UL, 0x4df045a1201e33f2UL, 0xa923daf893da5107UL, 0x1dc357be40bfa422UL }},
+  {{ 0xe15a1fb78b1238deUL, 0x973e21b31b0600acUL, 0x6f7535833782bbddUL, 0x2e72a2af4aec1023UL }},
+  {{ 0x4846953e158d7332UL, 0x99543ba4267b1d0cUL, 0x7da78422181b9214UL, 0x0c43ed63901fd2f7UL }},
+  {{ 0xd4840b46c1a9a31fUL, 0x112c86bf8b9b0fa1UL, 0xe1f30dfde6b499cdUL, 0x26c8fd098e9aca3aUL }},
+  {{ 0xeb2aae20116c10c5UL, 0x52798569b905bccfUL, 0x443bb23fd2a5dfc3UL, 0x2ea4d80352ad4066UL }},
+  {{ 0xa1abdb299f4ae95bUL, 0x69ff25a8e666d752UL, 0x687d3904aa67a282UL, 0x077f8c1c99adba45UL }},
+  {{ 0xbb9cf8f4f2fec31fUL, 0xe767bc56a0cb1f19UL, 0x754f9eb42d82d150UL, 0x2b6455663fc6d264UL }},
+  {{ 0x837483ca43bc8b4cUL, 0x28a064a2ce5e29b2UL, 0xeee8857a02b7a3f5UL, 0x0f56a59fa335247fUL }},
+  {{ 0x4d5c1cc959a46e7dUL, 0xfdb3aca68c925e65UL, 0x0424b39bf835fb65UL, 0x28548ff154cde49aUL }},
+  {{ 0x10bb56027e27fffeUL, 0x006edef82cdda089UL, 0xc4d3d37cd260b513UL, 0x191e2959256c1bceUL }},
+  {{ 0x672e66e883521606UL, 0xeb74a50f03e2b204UL, 0x823f1e9fd0cee017UL, 0x08ae578993ee87aeUL }},
+  {{ 0x8f1522379edd3664UL, 0x89df46235c1e5226UL, 0xc2bfa797b8990e37UL, 0x0dc66ceadad402c1UL }},
+  {{ 0x87b720dc00c19927UL, 0xa088396a7a297672UL, 0x78753a1cc1491dabUL, 0x18c32da9515a489aUL }},
+  {{ 0x76e0fa82fb6a77e2UL, 0x79e000b2bf87c46eUL, 0x501c0473468ae34fUL, 0x01ceb8bc4d9c8cc1UL }},
+  {{ 0xc8c498359e7210cdUL, 0x49fbf89b5500b83cUL, 0x633d831061e04833UL, 0x0ea462cb95ef933bUL }},
+  {{ 0xa376fd012252abc4UL, 0x22785f6d0b6ef342UL, 0xd83d71d6f69468cfUL, 0x1ac8ae31fcc1e379UL }},
+  {{ 0x68d6689300482528UL, 0x6e796fcd142d6cdaUL, 0xbce8d43440223ae0UL, 0x0829180636fc8d25UL }},
+  {{ 0x20513abb9a784f0eUL, 0x2ac19a75a717f639UL, 0xefe722e824351839UL, 0x07d3890cee392dc3UL }},
+  {{ 0xa646f2d206e35d40UL, 0x5c292d5cbd406b88UL, 0xf83ab2bd3d8fd0b4UL, 0x0be11b68f7ce51c0UL }},
+  {{ 0x79d92015786b0eafUL, 0xb242408f4948d590UL, 0xecb8711f1c8b28fdUL, 0x2686af99ecfdfb67UL }},
+  {{ 0x5b69131f5f9dc54dUL, 0x4f43066f1743fecdUL, 0x6c7593ccf73ae826UL, 0x0dc3a5e6cfc801e5UL }},
+  {{ 0xfb145d16e5a2e904UL, 0xdaf201ef3fc37631UL, 0xab3817c24a96d99eUL, 0x034ed4fab35fdb5bUL }},
+  {{ 0xc24a4ac62c103bdcUL, 0x95f2833a73ea1f14UL, 0xb695398609031e31UL, 0x06878956067b006eUL }},
+  {{ 0x2cbc4cd212ccbcd5UL, 0x3e6cb8a835d8f68bUL, 0xa2068f9d188f688bUL, 0x2f0489023d8a1e69UL }},
+  {{ 0x5cfc66e588c21004UL, 0x6ef3b1b5c5bfc785UL, 0x9ee2d27228416e28UL, 0x219334bef57b32fdUL }},
+  {{ 0x9f7777a021ec138aUL, 0x4d541a9fb5c802f8UL, 0x716ae85c3e576575UL, 0x1b53e074bd2e271dUL }},
+  {{ 0x028f7198554eec8eUL, 0xf735edcb739494ddUL, 0xcd017da03e12e431UL, 0x1852b4c7fc399531UL }},
+  {{ 0x5c515187f07b0e4dUL, 0x443df090d42eb638UL, 0xfcf724307e6367e5UL, 0x1dd36cc0e9b71a37UL }},
+  {{ 0x54376aadbc163406UL, 0x20fdd31e251047daUL, 0xf1c28a7fdacd8140UL, 0x0cf45533f9c184d7UL }},
+  {{ 0x60e8774664c81bebUL, 0xa0aff791f3988073UL, 0x17318a84e88b8027UL, 0x2f4e81ef7e459bdaUL }},
+  {{ 0x6acc3d8eafb78089UL, 0x650ffb48cfd274fcUL, 0x3e385be7044d624aUL, 0x1b7ff1d4be2a09c3UL }},
+  {{ 0xda84929b83b6a207UL, 0x7e4681c1051870c1UL, 0x718ffd18dd7de599UL, 0x1d5d3f7b26042aeeUL }},
+  {{ 0x2b58af2faeba6155UL, 0x1c4960646a099ccaUL, 0xce1c1002d675ca5cUL, 0x08401fc9aa2dff8aUL }},
+  {{ 0x6615152e26e30ff2UL, 0x44a565520281077bUL, 0x79a073289129ada7UL, 0x1119aed7d8826788UL }},
+  {{ 0x5cd2c1529133e351UL, 0x4dfa86173ce0b660UL, 0xeee84c17e268c2a5UL, 0x084ccf57e4b99a11UL }},
+  {{ 0x5ecafffc935d8769UL, 0x1ee1613613e0e3a3UL, 0xa3039e157523314cUL, 0x15c7032c59b0ef92UL }},
+  {{ 0xf9985a34cea59db0UL, 0xa80a1c9a634d7decUL, 0x0eb371fa0912bd0dUL, 0x21fdf3082167093eUL }},
+  {{ 0x086e2d5d328030b1UL, 0xc8247cd65a45fdcaUL, 0xc824da4c672c82d4UL, 0x1639586e7ed4478eUL }},
+  {{ 0xf8bc5d8a080ff0a2UL, 0x8565e8c74f2146a4UL, 0x5eec5c1402090c5cUL, 0x1933ad06630b66c4UL }},
+  {{ 0x66e8a29076f842a2UL, 0x9cad939fd9a88016UL, 0xffddb3b76221e239UL, 0x26862c2cedeacf3cUL }},
+  {{ 0xc9a14d5140227d47UL, 0x861d561d5f4bf5faUL, 0x2dadbd80a2adb4a7UL, 0x05a3a1b0f84a09c5UL }},
+  {{ 0x143f774e1bf0aa38UL, 0xbe7fb0ffb20779b9UL, 0x257921076104127dUL, 0x08b74865580d2222UL }},
+  {{ 0xaff9b9e14f7fe885UL, 0xe39652ff69fb6802UL, 0x8fa7fc4ff33ef77fUL, 0x0a509f82505603b6UL }},
+  {{ 0x1cdda87170508b73UL, 0x8a97853f8f319234UL, 0x0f8abd7d50591ecdUL, 0x165392fd0603330dUL }},
+  {{ 0x4b1ca2ff1966b370UL, 0x8225d174dc57b6f8UL, 0xd247dd3e1e3ee204UL, 0x17c5ff035a425e39UL }},
+  {{ 0x2925bf4de94a1e5cUL, 0x977e58f6d813c837UL, 0x6d0165da816639c6UL, 0x1535dc6acf9466f6UL }},
+  {{ 0x6e8a07efbe080646UL, 0xc3a3b7c24285c0ccUL, 0x73b67f9e1675b881UL, 0x2724ec38f2a2bbc7UL }},
+  {{ 0x5522a3b90ddad11bUL, 0x93f170b980430ef0UL, 0xb77c61c79cd600fbUL, 0x20ff4e83ea0b732bUL }},
+  {{ 0x1c9864af699070c7UL, 0xf8d6024182bb6ec3UL, 0x018a3b8629275512UL, 0x22081e9572e2bf11UL }},
+  {{ 0x48b7385324b48700UL, 0x1dc305585546b807UL, 0x7a3873c89186a7a6UL, 0x1c79d5f7ac971389UL }},
+  {{ 0xba2489206dc6a49bUL, 0x7038bc777511e9faUL, 0x4e836e7cabbc3130UL, 0x18376588250f2773UL }},
+  {{ 0x0d6da10baf23f993UL, 0x2f6e008ec5a3b118UL, 0x79752134de0110e8UL, 0x1f04771a93fabfeaUL }},
+  {{ 0x24568b1fbf1a7b75UL, 0x0279709c9367a232UL, 0xf7ea98751e81ca61UL, 0x2e2b5c8f7b941190UL }},
+  {{ 0x2c918eb55fe44173UL, 0x2d2e1ae5193d05c5UL, 0x077633503dd71b5fUL, 0x04f1e9fef95f2117UL }},
+  {{ 0xf8a853eb6847be2eUL, 0xc5afe97b7df2407eUL, 0x9e76bbb049c86213UL, 0x1e4e10ce66bcc07aUL }},
+  {{ 0xc267583f3ba0a324UL, 0xbfc95376e5fa0f30UL, 0x25779dfae929bc85UL, 0x0cfe2d917836f934UL }},
+  {{ 0x921b7216af1971b3UL, 0x790a01256d3df511UL, 0xe9a0c447a40d81f5UL, 0x0f3c9f8407acdc6dUL }},
+  {{ 0x7fce32613b7716ffUL, 0xf31eed8cb21b6b5dUL, 0xeabfbb588d285f41UL, 0x026d01caf5627e82UL }},
+  {{ 0xf0ec951cbcdf5fe5UL, 0x876dad8b3c0b6458UL, 0x32f1ebdf1235ca2cUL, 0x1e374c2eb05eabb5UL }},
+  {{ 0x652ef44294068b38UL, 0xbd553f0a00d42fc7UL, 0x141480067efdb9b2UL, 0x260161271ab29529UL }},
+  {{ 0xf29fac8d46ccd875UL, 0x48f4ef55874272faUL, 0x8bc044d49e005584UL, 0x256c050649b93cceUL }},
+  {{ 0xbcb44a209efa7668UL, 0x29024b35403056aeUL, 0x42a300fa034c314dUL, 0x24c207e84eb01d5aUL }},
+  {{ 0x668708ce8c58c8afUL, 0xebbf19deea8d1c17UL, 0xbb3b70a668437041UL, 0x0d23f7fd7471cf6cUL }},
+  {{ 0x455ed09f3394e3eeUL, 0x58e2a2c52519c8b4UL, 0x5af65dbfdfe14050UL, 0x0c878227b0ac721dUL }},
+  {{ 0x98c0ec761d20c984UL, 0x7f5f9092fc52124eUL, 0xcf9579757400da17UL, 0x01754c74e7d45d9fUL }},
+  {{ 0xd4291d59863f1898UL, 0x39bc5beac6d56829UL, 0xf074662f77dd0b02UL, 0x0915424c04070d22UL }},
+  {{ 0xb2c7b45ead860429UL, 0xf71e86c2b950737aUL, 0xdea537a662cf5436UL, 0x29f07e33ee60df92UL }},
+  {{ 0x0f4439cedaf5884dUL, 0x90ee089e594f4062UL, 0x229b6227cd0a9fa9UL, 0x28033841ca497f99UL }},
+  {{ 0x5c3d62a992c024e4UL, 0x62df301bc00b5c14UL, 0x10c522fdaa829c7fUL, 0x14dacbf628b38f3aUL }},
+  {{ 0x82d9af4a743b9fa2UL, 0x88d594129736b338UL, 0xf2878ae18ad5bff1UL, 0x057b0a80cd554c88UL }},
+  {{ 0x4bae284cf67f287dUL, 0x0c1eb291196f4295UL, 0x5248aaf26f64390aUL, 0x018922189839c2b8UL }},
+  {{ 0x833b679cd5dd9548UL, 0x5ba1afb2b115dc95UL, 0xc7882f23870a879cUL, 0x12d95a12ac96b844UL }},
+  {{ 0x04d106f1d1312f21UL, 0xcc440caa227e79a7UL, 0x171184cab21e6c2eUL, 0x10b75ec2a1230040UL }},
+  {{ 0x5d352058cde81d0dUL, 0xddf449002fa59cc6UL, 0x78cba729b4ecfca7UL, 0x0b0bdebe98590341UL }},
+  {{ 0x9bca307455c03db2UL, 0xdc8f1c8ec43110ecUL, 0x6e8a2a3b4fdd8acdUL, 0x0c2dfb7733d4807bUL }},
+  {{ 0x5dd8c93931e9e350UL, 0x8abf9ece66a5601bUL, 0xb3224247b2dc1cb7UL, 0x2e78634871dcd1daUL }},
+  {{ 0x233a99c8883d901bUL, 0x1015c6023ba64de4UL, 0x77c27f6f01bd1678UL, 0x209458b7b8123348UL }},
+  {{ 0x8a9d6b8df9f39721UL, 0xd2bafcec9a22e8a8UL, 0x97a717248e8e8441UL, 0x1c7967b88f0691fbUL }},
+  {{ 0xdfdcaa4f9f819048UL, 0xa524edd547ad13f6UL, 0xc7fd533ecd8adaeeUL, 0x04899704d151e729UL }},
+  {{ 0x289ae9704a8c8962UL, 0x5a1a4014ebf8b5cbUL, 0xc59338c4581543c6UL, 0x00258d5ded039eefUL }},
+  {{ 0xc37ae2216d9925d6UL, 0xd8dad0bca747655aUL, 0x558383e8ac7acfa3UL, 0x0979bb1d16ae0e07UL }},
+  {{ 0xaa0878a70fed96d5UL, 0x871a23faac589623UL, 0x0e77f15f5ca60907UL, 0x237b7522823053dcUL }},
+  {{ 0x24671c7385262236UL, 0x8b249ebf38ec644cUL, 0x53ff56a098d8eed6UL, 0x2ff9a4eae45e6293UL }},
+  {{ 0x1d727148d987340eUL, 0xcaf8655c5da8e34eUL, 0x68e30496ddb4f717UL, 0x28cbf24015a35708UL }},
+  {{ 0x9fa22695ed762c73UL, 0x7e3bc9b41fa8358bUL, 0x9c491fd10827aab0UL, 0x0ed9e5a65ac5122dUL }},
+  {{ 0x5cfd5b69fbb1bd21UL, 0x61047d4966408e6aUL, 0xce3b1eb6875f4398UL, 0x022460191d075ed8UL }},
+  {{ 0x7e6741fff1fa7415UL, 0x2e6cfc8f97a4d3a5UL, 0xb19bfdf245b778d9UL, 0x1c0e96944df59e99UL }},
+  {{ 0xd8c93320219d196eUL, 0x8221755b6e9b38f3UL, 0xeb5fc8bff2074228UL, 0x2119410b1739dd79UL }},
+  {{ 0xd4f0983d8d40cf30UL, 0x35ae48c7cca5f054UL, 0x0e01ee428ceb6191UL, 0x24ee5635a32d2dcdUL }},
+  {{ 0x528492a75dfa208dUL, 0x75e4e50c0aba9d4cUL, 0x66c9fa168c2a2245UL, 0x123b8dc6fcab1ef1UL }},
+  {{ 0xff1a52a8c482ecf1UL, 0xb96b7a433888d91cUL, 0xdf8a84c46331f618UL, 0x092a57cb732898f3UL }},
+  {{ 0x07866d3723b4794fUL, 0xb7e8e0eef05232dfUL, 0xcd4032da35438453UL, 0x16256ed4709d059aUL }},
+  {{ 0x010c7c84b9d642d5UL, 0x559dce013543fbeaUL, 0x3c7b922cc13bf817UL, 0x20a3226ee786f2d6UL }},
+  {{ 0xa0d3267923b48e68UL, 0xeb43f6227cba1e8dUL, 0xacae023a785fed4eUL, 0x08175321923bbb4aUL }},
+  {{ 0xbc1da6467c2d70bdUL, 0x584d4ee8b66ba9a4UL, 0xc76477116ae8e067UL, 0x214c9c99034bf02eUL }},
+  {{ 0xd93d4c41aad9e156UL, 0x3ebca0c5ac53b5c3UL, 0x72d38696dd4be222UL, 0x1b89cc420fd0f1fcUL }},
+  {{ 0x845fce0f10c5713dUL, 0x8901d7db5da94a34UL, 0xdf251f9603a1a42dUL, 0x1a6fc5a6f64e5861UL }},
+  {{ 0xd29527f1a2213652UL, 0xb0871a7f13118c5eUL, 0x62d485e7e384ca8aUL, 0x177fe3b98481ae2bUL }},
+  {{ 0x64d4b3420a4b59afUL, 0xbbc0024c26219f4eUL, 0x0f328c9452a08a70UL, 0x1a2915d7e5cf7b79UL }},
+  {{ 0x46a034c865d3109eUL, 0xd0ea08a81eaa8aa7UL, 0x89d83419be9216bdUL, 0x0eff6ab03c3e278bUL }},
+  {{ 0x907147382b175ff3UL, 0xfe16546581fad896UL, 0x4cd166feb8922a38UL, 0x17d56891e7ec6256UL }},
+  {{ 0xeb05ed6e4cce370aUL, 0xea5fcb353ec4f044UL, 0x9afaf5dcff21b1c2UL, 0x171212130e819e67UL }},
+  {{ 0xd0c655a3c3d57c4cUL, 0x98d7a6335cb778cfUL, 0xeabce70d77d8279dUL, 0x2af5f0a1fc9d0a8dUL }},
+  {{ 0xe2da0d07f59b5d76UL, 0x035ad992a0215677UL, 0x5de9657c05bcf090UL, 0x1c882d89d6da4c60UL }},
+  {{ 0xf1537145af3bfb3fUL, 0x1ba793c38826d2a6UL, 0x2600b67676398639UL, 0x093d4f42015777f5UL }},
+  {{ 0x7ddddfb9497f9fcbUL, 0x116d8426503ee590UL, 0x045d7bc59b7276f0UL, 0x15f30ec13f5c7977UL }},
+  {{ 0xd5938db329c69269UL, 0x0a05a3658590e48cUL, 0xde3fb5549bf752e3UL, 0x18de7b3cf4cab051UL }},
+  {{ 0xaacbf6dc6ad53836UL, 0x27ee4eb024c41cf6UL, 0x58f5a57704ac3e80UL, 0x09395b31e6326990UL }},
+  {{ 0xe508ed5973eb57ebUL, 0xfc684341fb38074bUL, 0x7352614a4399cc32UL, 0x0af0940a1e608107UL }},
+  {{ 0x9ba463f3e1b9185fUL, 0x0408fa4f25c2572aUL, 0xdb7a46d311a905bdUL, 0x24ef9921220bfbf8UL }},
+  {{ 0xf0bd71333c9af1d8UL, 0xd5d4b30798a57133UL, 0xa24942fecbd2dd1dUL, 0x260f7f14be57dcddUL }},
+  {{ 0xbb28a287a8de8aefUL, 0x0a3fd73683528528UL, 0x5279ce37bd1b52b4UL, 0x19bb63cff8cf436aUL }},
+  {{ 0x718fb23e672f7977UL, 0x33730aeeb087337bUL, 0xa87ef765da25e565UL, 0x2c80ce770ee81a63UL }},
+  {{ 0x542c5333c4e03fe3UL, 0xe48d141f733f144cUL, 0x9962d322547c6ec0UL, 0x07d4bdedb314f6fbUL }},
+  {{ 0x361dd199cda5282bUL, 0xf2f42eb8db72e2a8UL, 0x5a6edef94f070582UL, 0x0481df4530c68eb0UL }},
+  {{ 0x52f5756113979b24UL, 0x870525f936b928aaUL, 0x0cfc082fe9804c9dUL, 0x1c819c4168a4de1dUL }},
+  {{ 0xfbae83e0bdcd6ecdUL, 0x57eb6692fbf72541UL, 0x0d2d09c469c3322dUL, 0x0e4883bd12535684UL }},
+};
+
+static const fd_poseidon_par_t fd_poseidon_params[ FD_POSEIDON_MAX_WIDTH+1UL ] = {
+  [ 2] = { .partial_rounds = 56, .ark = fd_poseidon_ark_2, .mds = fd_poseidon_mds_2 },
+  [ 3] = { .partial_rounds = 57, .ark = fd_poseidon_ark_3, .mds = fd_poseidon_mds_3 },
+  [ 4] = { .partial_rounds = 56, .ark = fd_poseidon_ark_4, .mds = fd_poseidon_mds_4 },
+  [ 5] = { .partial_rounds = 60, .ark = fd_poseidon_ark_5, .mds = fd_poseidon_mds_5 },
+  [ 6] = { .partial_rounds = 60, .ark = fd_poseidon_ark_6, .mds = fd_poseidon_mds_6 },
+  [ 7] = { .partial_rounds = 63, .ark = fd_poseidon_ark_7, .mds = fd_poseidon_mds_7 },
+  [ 8] = { .partial_rounds = 64, .ark = fd_poseidon_ark_8, .mds = fd_poseidon_mds_8 },
+  [ 9] = { .partial_rounds = 63, .ark = fd_poseidon_ark_9, .mds = fd_poseidon_mds_9 },
+  [10] = { .partial_rounds = 60, .ark = fd_poseidon_ark_10, .mds = fd_poseidon_mds_10 },
+  [11] = { .partial_rounds = 66, .ark = fd_poseidon_ark_11, .mds = fd_poseidon_mds_11 },
+  [12] = { .partial_rounds = 60, .ark = fd_poseidon_ark_12, .mds = fd_poseidon_mds_12 },
+  [13] = { .partial_rounds = 65, .ark = fd_poseidon_ark_13, .mds = fd_poseidon_mds_13 },
+};
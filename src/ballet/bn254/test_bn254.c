@@ -2,6 +2,210 @@
 #include "fd_bn254.h"
 #include "../../util/fd_util.h"
 
+static void
+log_bench( char const * descr,
+           ulong        iter,
+           long         dt ) {
+  float khz = 1e6f *(float)iter/(float)dt;
+  float tau = (float)dt /(float)iter;
+  FD_LOG_NOTICE(( "%-31s %11.3fK/s/core %10.3f ns/call", descr, (double)khz, (double)tau ));
+}
+
+/* Scalars used below, big endian */
+
+static void
+scalar_set( fd_bn254_bigint_t * s,
+            ulong               v ) {
+  fd_memset( s->v, 0, 32UL );
+  FD_STORE( ulong, s->v+24UL, fd_ulong_bswap( v ) );
+}
+
+/* scalar_set_neg sets s to r-v, so that [s] P = -[v] P */
+
+static void
+scalar_set_neg( fd_bn254_bigint_t * s,
+                ulong               v ) {
+  static const uchar r[ 32 ] = {
+    0x30, 0x64, 0x4e, 0x72, 0xe1, 0x31, 0xa0, 0x29, 0xb8, 0x50, 0x45, 0xb6, 0x81, 0x81, 0x58, 0x5d,
+    0x28, 0x33, 0xe8, 0x48, 0x79, 0xb9, 0x70, 0x91, 0x43, 0xe1, 0xf5, 0x93, 0xf0, 0x00, 0x00, 0x01
+  };
+  fd_memcpy( s->v, r, 32UL );
+  ulong borrow = v;
+  for( int i=31; i>=0 && borrow; i-- ) {
+    ulong d = (ulong)s->v[ i ] - (borrow & 0xffUL);
+    borrow  = (borrow>>8) + (ulong)(d>>63);
+    s->v[ i ] = (uchar)d;
+  }
+}
+
+static void
+test_pairing_batch( void ) {
+  static const fd_bn254_point_g1_t g1_gen = { .v={
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+  } };
+  static const fd_bn254_point_g2_t g2_gen = { .v={
+    25, 142, 147, 147, 146, 13, 72, 58, 114, 96, 191, 183, 49, 251, 93, 37,
+    241, 170, 73, 51, 53, 169, 231, 18, 151, 228, 133, 183, 174, 243, 18, 194,
+    24, 0, 222, 239, 18, 31, 30, 118, 66, 106, 0, 102, 94, 92, 68, 121,
+    103, 67, 34, 212, 247, 94, 218, 221, 70, 222, 189, 92, 217, 146, 246, 237,
+    9, 6, 137, 208, 88, 95, 240, 117, 236, 158, 153, 173, 105, 12, 51, 149,
+    188, 75, 49, 51, 112, 179, 142, 243, 85, 172, 218, 220, 209, 34, 151, 91,
+    18, 200, 94, 165, 219, 140, 109, 235, 74, 171, 113, 128, 141, 203, 64, 143,
+    227, 209, 231, 105, 12, 67, 211, 123, 76, 230, 204, 1, 102, 250, 125, 170,
+  } };
+  static const fd_bn254_point_g2_t g2_7 = { .v={
+    41, 3, 186, 1, 90, 154, 189, 226, 106, 93, 8, 30, 132, 85, 30, 99,
+    190, 15, 212, 81, 110, 70, 238, 109, 89, 62, 222, 186, 70, 54, 36, 85,
+    34, 75, 220, 93, 67, 39, 252, 248, 237, 112, 46, 1, 222, 28, 47, 22,
+    87, 162, 83, 186, 117, 227, 42, 137, 195, 144, 20, 42, 170, 40, 179, 8,
+    3, 200, 183, 205, 166, 178, 222, 219, 122, 238, 175, 95, 218, 70, 74, 209,
+    112, 54, 190, 161, 196, 230, 247, 173, 186, 237, 30, 190, 3, 53, 224, 216,
+    29, 146, 255, 245, 42, 38, 80, 23, 238, 204, 179, 114, 227, 125, 122, 123,
+    212, 49, 128, 14, 202, 40, 223, 216, 46, 33, 232, 5, 65, 20, 35, 63,
+  } };
+  static const fd_bn254_point_g1_t g1_11 = { .v={
+    42, 20, 112, 85, 55, 176, 9, 24, 157, 168, 128, 134, 81, 238, 205, 184,
+    36, 130, 71, 127, 233, 42, 193, 44, 168, 183, 31, 128, 252, 61, 73, 239,
+    45, 247, 238, 127, 36, 62, 168, 179, 142, 29, 223, 20, 2, 146, 88, 135,
+    122, 97, 140, 119, 159, 212, 113, 125, 182, 23, 126, 25, 234, 103, 236, 56,
+  } };
+  static const fd_bn254_point_g2_t g2_bad = { .v={
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    13, 18, 113, 149, 62, 217, 234, 8, 54, 132, 110, 112, 161, 147, 65, 135,
+    153, 140, 127, 121, 12, 180, 215, 81, 27, 127, 141, 168, 45, 224, 72, 164,
+    40, 105, 17, 29, 83, 129, 240, 114, 248, 226, 114, 143, 219, 130, 90, 81,
+    170, 221, 112, 229, 44, 152, 48, 233, 171, 75, 135, 28, 5, 49, 241, 187,
+  } };
+
+  fd_bn254_bigint_t s[1];
+  fd_bn254_point_g1_t p[1];
+  uchar in[ 20UL*FD_BN254_PAIRING_ELEMENT_FOOTPRINT ];
+#define PAIR(i,g1,g2) do {                                                                                 \
+    fd_memcpy( in+(i)*FD_BN254_PAIRING_ELEMENT_FOOTPRINT,                       (g1), FD_BN254_G1_FOOTPRINT ); \
+    fd_memcpy( in+(i)*FD_BN254_PAIRING_ELEMENT_FOOTPRINT+FD_BN254_G1_FOOTPRINT, (g2), FD_BN254_G2_FOOTPRINT ); \
+  } while(0)
+
+  /* Scalar multiplication */
+
+  scalar_set( s, 11UL );
+  FD_TEST( fd_bn254_g1_mult( &g1_gen, s, p )==p );
+  FD_TEST( fd_memeq( p->v, g1_11.v, 64UL ) );
+
+  /* e([11] G1, [7] G2) e([-77] G1, G2) == 1, by bilinearity */
+
+  scalar_set_neg( s, 77UL );
+  FD_TEST( fd_bn254_g1_mult( &g1_gen, s, p ) );
+  PAIR( 0UL, g1_11.v, g2_7.v   );
+  PAIR( 1UL, p->v,    g2_gen.v );
+  FD_TEST( fd_bn254_pairing_batch( in, 2UL )==1 );
+  FD_TEST( fd_bn254_pairing( &g1_11, &g2_7, p, &g2_gen ) );
+
+  scalar_set_neg( s, 76UL );
+  FD_TEST( fd_bn254_g1_mult( &g1_gen, s, p ) );
+  PAIR( 1UL, p->v, g2_gen.v );
+  FD_TEST( fd_bn254_pairing_batch( in, 2UL )==0 );
+  FD_TEST( !fd_bn254_pairing( &g1_11, &g2_7, p, &g2_gen ) );
+  FD_TEST( fd_bn254_pairing_batch( in, 1UL )==0 );
+  FD_TEST( fd_bn254_pairing_batch( in, 0UL )==1 );
+
+  /* More pairs than fit in a single Miller loop batch, with some pairs
+     involving the point at infinity: e(G1,G2)^17 e([-17] G1, G2) */
+
+  uchar zero[ FD_BN254_G2_FOOTPRINT ] = {0};
+  for( ulong i=0UL; i<19UL; i++ ) PAIR( i, g1_gen.v, g2_gen.v );
+  PAIR( 5UL,  zero, g2_gen.v ); /* e(0,G2) == 1 */
+  PAIR( 11UL, g1_gen.v, zero ); /* e(G1,0) == 1 */
+  scalar_set_neg( s, 17UL );
+  FD_TEST( fd_bn254_g1_mult( &g1_gen, s, p ) );
+  PAIR( 19UL, p->v, g2_gen.v );
+  FD_TEST( fd_bn254_pairing_batch( in, 20UL )==1 );
+  PAIR( 11UL, g1_gen.v, g2_gen.v );
+  FD_TEST( fd_bn254_pairing_batch( in, 20UL )==0 );
+
+  /* Invalid points */
+
+  fd_bn254_point_g1_t bad_g1[1] = { g1_gen };
+  bad_g1->v[ 63 ] = 3; /* (1,3) is not on the curve */
+  FD_TEST( !fd_bn254_g1_check( bad_g1 ) );
+  FD_TEST( !fd_bn254_g1_add( bad_g1, &g1_gen, p ) );
+  FD_TEST( !fd_bn254_g1_mult( bad_g1, s, p ) );
+  PAIR( 3UL, bad_g1->v, g2_gen.v );
+  FD_TEST( fd_bn254_pairing_batch( in, 20UL )==-1 );
+
+  fd_bn254_point_g1_t big_g1[1] = { g1_11 };
+  fd_memset( big_g1->v, 0xff, 32UL ); /* coordinate not less than p */
+  FD_TEST( !fd_bn254_g1_check( big_g1 ) );
+
+  FD_TEST( fd_bn254_g2_check( &g2_gen ) );
+  FD_TEST( !fd_bn254_g2_check( &g2_bad ) ); /* on the twist, not in G2 */
+  PAIR( 3UL, g1_gen.v, g2_bad.v );
+  FD_TEST( fd_bn254_pairing_batch( in, 20UL )==-1 );
+
+  /* Addition edge cases: P + (-P), P + P, P + 0 */
+
+  fd_bn254_point_g1_t q[1], z[1];
+  fd_bn254_point_g1_t inf[1] = {{{0}}};
+  scalar_set_neg( s, 11UL );
+  FD_TEST( fd_bn254_g1_mult( &g1_gen, s, q ) );
+  FD_TEST( fd_bn254_g1_add( &g1_11, q, z ) );
+  FD_TEST( fd_memeq( z->v, inf->v, 64UL ) );
+  FD_TEST( fd_bn254_g1_add( &g1_11, inf, z ) );
+  FD_TEST( fd_memeq( z->v, g1_11.v, 64UL ) );
+  scalar_set( s, 22UL );
+  FD_TEST( fd_bn254_g1_mult( &g1_gen, s, q ) );
+  FD_TEST( fd_bn254_g1_add( &g1_11, &g1_11, z ) );
+  FD_TEST( fd_memeq( z->v, q->v, 64UL ) );
+
+  /* Compression round trips */
+
+  fd_bn254_point_g1_compressed_t g1c[1];
+  fd_bn254_g1_compress( q, g1c );
+  FD_TEST( fd_bn254_g1_decompress( g1c, z ) );
+  FD_TEST( fd_memeq( z->v, q->v, 64UL ) );
+
+  fd_bn254_point_g2_compressed_t g2c[1];
+  fd_bn254_point_g2_t g2[1];
+  fd_bn254_g2_compress( &g2_7, g2c );
+  FD_TEST( fd_bn254_g2_decompress( g2c, g2 ) );
+  FD_TEST( fd_memeq( g2->v, g2_7.v, 128UL ) );
+
+  /* Benchmarks */
+
+  ulong iter = 1000UL;
+  long dt = fd_log_wallclock();
+  for( ulong rem=iter; rem; rem-- ) fd_bn254_g1_add( &g1_11, q, z );
+  dt = fd_log_wallclock() - dt;
+  log_bench( "fd_bn254_g1_add", iter, dt );
+
+  iter = 100UL;
+  scalar_set_neg( s, 1UL );
+  dt = fd_log_wallclock();
+  for( ulong rem=iter; rem; rem-- ) fd_bn254_g1_mult( &g1_11, s, z );
+  dt = fd_log_wallclock() - dt;
+  log_bench( "fd_bn254_g1_mult", iter, dt );
+
+  iter = 10UL;
+  PAIR( 0UL, g1_11.v, g2_7.v   );
+  PAIR( 1UL, p->v,    g2_gen.v );
+  dt = fd_log_wallclock();
+  for( ulong rem=iter; rem; rem-- ) FD_TEST( fd_bn254_pairing_batch( in, 2UL )>=0 );
+  dt = fd_log_wallclock() - dt;
+  log_bench( "fd_bn254_pairing_batch(2)", iter, dt );
+
+  dt = fd_log_wallclock();
+  for( ulong rem=iter; rem; rem-- ) FD_TEST( fd_bn254_g2_check( &g2_7 ) );
+  dt = fd_log_wallclock() - dt;
+  log_bench( "fd_bn254_g2_check", iter, dt );
+
+#undef PAIR
+}
+
 int main( int     argc,
           char ** argv ) {
   fd_boot( &argc, &argv );
@@ -122,6 +326,8 @@ int main( int     argc,
         211, 123, 76, 230, 204, 1, 102, 250, 125, 170 } };
     FD_TEST(fd_bn254_pairing(&g1_1, &g2_1, &g1_2, &g2_2));
   }
+
+  test_pairing_batch();
     
   FD_LOG_NOTICE(( "pass" ));
   fd_halt();
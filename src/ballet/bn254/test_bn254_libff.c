@@ -0,0 +1,174 @@
+/* test_bn254_libff checks the native fd_bn254 and fd_poseidon against
+   the libff implementation they replace, on random inputs, and compares
+   their performance. */
+
+#include "fd_bn254_libff.h"
+#include "../../util/fd_util.h"
+
+static void
+log_bench( char const * descr,
+           ulong        iter,
+           long         dt ) {
+  float khz = 1e6f *(float)iter/(float)dt;
+  float tau = (float)dt /(float)iter;
+  FD_LOG_NOTICE(( "%-31s %11.3fK/s/core %10.3f ns/call", descr, (double)khz, (double)tau ));
+}
+
+static const fd_bn254_point_g1_t g1_gen = { .v={
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+} };
+
+static const fd_bn254_point_g2_t g2_gen = { .v={
+  25, 142, 147, 147, 146, 13, 72, 58, 114, 96, 191, 183, 49, 251, 93, 37,
+  241, 170, 73, 51, 53, 169, 231, 18, 151, 228, 133, 183, 174, 243, 18, 194,
+  24, 0, 222, 239, 18, 31, 30, 118, 66, 106, 0, 102, 94, 92, 68, 121,
+  103, 67, 34, 212, 247, 94, 218, 221, 70, 222, 189, 92, 217, 146, 246, 237,
+  9, 6, 137, 208, 88, 95, 240, 117, 236, 158, 153, 173, 105, 12, 51, 149,
+  188, 75, 49, 51, 112, 179, 142, 243, 85, 172, 218, 220, 209, 34, 151, 91,
+  18, 200, 94, 165, 219, 140, 109, 235, 74, 171, 113, 128, 141, 203, 64, 143,
+  227, 209, 231, 105, 12, 67, 211, 123, 76, 230, 204, 1, 102, 250, 125, 170,
+} };
+
+static void
+rand_scalar( fd_rng_t *          rng,
+             fd_bn254_bigint_t * s ) {
+  for( ulong i=0UL; i<32UL; i++ ) s->v[ i ] = fd_rng_uchar( rng );
+}
+
+static void
+rand_g1( fd_rng_t *            rng,
+         fd_bn254_point_g1_t * p ) {
+  fd_bn254_bigint_t s[1];
+  rand_scalar( rng, s );
+  FD_TEST( fd_bn254_g1_mult( &g1_gen, s, p ) );
+}
+
+static void
+test_g1( fd_rng_t * rng ) {
+  for( ulong iter=0UL; iter<1000UL; iter++ ) {
+    fd_bn254_point_g1_t x[1], y[1], z[1], z_ref[1];
+    fd_bn254_bigint_t   s[1];
+    rand_g1( rng, x );
+    if( iter&1UL ) rand_g1( rng, y );
+    else           *y = *x; /* doubling */
+    rand_scalar( rng, s );
+
+    FD_TEST( fd_bn254_g1_check( x )==fd_bn254_libff_g1_check( x ) );
+
+    FD_TEST( fd_bn254_g1_add( x, y, z ) );
+    fd_bn254_libff_g1_add( x, y, z_ref );
+    FD_TEST( fd_memeq( z->v, z_ref->v, FD_BN254_G1_FOOTPRINT ) );
+
+    FD_TEST( fd_bn254_g1_mult( x, s, z ) );
+    fd_bn254_libff_g1_mult( x, s, z_ref );
+    FD_TEST( fd_memeq( z->v, z_ref->v, FD_BN254_G1_FOOTPRINT ) );
+
+    /* Random bytes are almost never a valid point */
+    for( ulong i=0UL; i<FD_BN254_G1_FOOTPRINT; i++ ) x->v[ i ] = fd_rng_uchar( rng );
+    x->v[ 0 ] &= (uchar)0x1f;
+    FD_TEST( fd_bn254_g1_check( x )==fd_bn254_libff_g1_check( x ) );
+  }
+  FD_LOG_NOTICE(( "g1: ok" ));
+}
+
+static void
+test_pairing( fd_rng_t * rng ) {
+  for( ulong iter=0UL; iter<20UL; iter++ ) {
+    fd_bn254_point_g1_t p1[1], p2[1];
+    rand_g1( rng, p1 );
+    if( iter&1UL ) rand_g1( rng, p2 );
+    else {
+      /* p2 = -p1, so that the product is one */
+      *p2 = *p1;
+      fd_bn254_bigint_t s[1] = {{{
+        0x30, 0x64, 0x4e, 0x72, 0xe1, 0x31, 0xa0, 0x29, 0xb8, 0x50, 0x45, 0xb6, 0x81, 0x81, 0x58, 0x5d,
+        0x28, 0x33, 0xe8, 0x48, 0x79, 0xb9, 0x70, 0x91, 0x43, 0xe1, 0xf5, 0x93, 0xf0, 0x00, 0x00, 0x00
+      }}}; /* r-1 */
+      FD_TEST( fd_bn254_g1_mult( p1, s, p2 ) );
+    }
+    int res = fd_bn254_pairing( p1, &g2_gen, p2, &g2_gen );
+    FD_TEST( res==fd_bn254_libff_pairing( p1, &g2_gen, p2, &g2_gen ) );
+    FD_TEST( res==!(iter&1UL) );
+  }
+  FD_LOG_NOTICE(( "pairing: ok" ));
+}
+
+static void
+test_poseidon( fd_rng_t * rng ) {
+  uchar bytes[ 32UL*FD_POSEIDON_MAX_INPUT_CNT ];
+  for( ulong iter=0UL; iter<1000UL; iter++ ) {
+    ulong sz = fd_rng_ulong_roll( rng, sizeof(bytes) )+1UL;
+    for( ulong i=0UL; i<sz; i++ ) bytes[ i ] = fd_rng_uchar( rng );
+    int be = fd_rng_int_roll( rng, 2 );
+
+    fd_poseidon_hash_result_t res[1], res_ref[1];
+    FD_TEST( !fd_poseidon_hash( bytes, sz, be, res ) );
+    FD_TEST( !fd_poseidon_libff_hash( bytes, sz, be, res_ref ) );
+    FD_TEST( fd_memeq( res->v, res_ref->v, FD_POSEIDON_HASH_SIZE ) );
+  }
+  FD_LOG_NOTICE(( "poseidon: ok" ));
+}
+
+static void
+bench( fd_rng_t * rng ) {
+  fd_bn254_point_g1_t x[1], y[1], z[1];
+  fd_bn254_bigint_t   s[1];
+  rand_g1( rng, x );
+  rand_g1( rng, y );
+  rand_scalar( rng, s );
+
+  ulong iter = 1000UL;
+  long dt = fd_log_wallclock();
+  for( ulong rem=iter; rem; rem-- ) fd_bn254_g1_add( x, y, z );
+  log_bench( "fd_bn254_g1_add", iter, fd_log_wallclock()-dt );
+  dt = fd_log_wallclock();
+  for( ulong rem=iter; rem; rem-- ) fd_bn254_libff_g1_add( x, y, z );
+  log_bench( "fd_bn254_libff_g1_add", iter, fd_log_wallclock()-dt );
+
+  iter = 100UL;
+  dt = fd_log_wallclock();
+  for( ulong rem=iter; rem; rem-- ) fd_bn254_g1_mult( x, s, z );
+  log_bench( "fd_bn254_g1_mult", iter, fd_log_wallclock()-dt );
+  dt = fd_log_wallclock();
+  for( ulong rem=iter; rem; rem-- ) fd_bn254_libff_g1_mult( x, s, z );
+  log_bench( "fd_bn254_libff_g1_mult", iter, fd_log_wallclock()-dt );
+
+  iter = 10UL;
+  dt = fd_log_wallclock();
+  for( ulong rem=iter; rem; rem-- ) fd_bn254_pairing( x, &g2_gen, y, &g2_gen );
+  log_bench( "fd_bn254_pairing", iter, fd_log_wallclock()-dt );
+  dt = fd_log_wallclock();
+  for( ulong rem=iter; rem; rem-- ) fd_bn254_libff_pairing( x, &g2_gen, y, &g2_gen );
+  log_bench( "fd_bn254_libff_pairing", iter, fd_log_wallclock()-dt );
+
+  uchar bytes[ 64 ];
+  for( ulong i=0UL; i<64UL; i++ ) bytes[ i ] = fd_rng_uchar( rng );
+  fd_poseidon_hash_result_t res[1];
+  iter = 1000UL;
+  dt = fd_log_wallclock();
+  for( ulong rem=iter; rem; rem-- ) fd_poseidon_hash( bytes, 64UL, 1, res );
+  log_bench( "fd_poseidon_hash(2)", iter, fd_log_wallclock()-dt );
+  dt = fd_log_wallclock();
+  for( ulong rem=iter; rem; rem-- ) fd_poseidon_libff_hash( bytes, 64UL, 1, res );
+  log_bench( "fd_poseidon_libff_hash(2)", iter, fd_log_wallclock()-dt );
+}
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+  fd_rng_t _rng[1]; fd_rng_t * rng = fd_rng_join( fd_rng_new( _rng, 0U, 0UL ) );
+
+  test_g1( rng );
+  test_pairing( rng );
+  test_poseidon( rng );
+  bench( rng );
+
+  fd_rng_delete( fd_rng_leave( rng ) );
+  FD_LOG_NOTICE(( "pass" ));
+  fd_halt();
+  return 0;
+}
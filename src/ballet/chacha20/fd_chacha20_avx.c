@@ -14,6 +14,14 @@ wu_rol8( wu_t x ) {
   return _mm256_shuffle_epi8( x, mask );
 }
 
+#define QUARTER_ROUND(a,b,c,d)                                         \
+  do {                                                                 \
+    a = wu_add( a, b ); d = wu_xor( d, a ); d = wu_rol16( d );         \
+    c = wu_add( c, d ); b = wu_xor( b, c ); b = wu_rol12( b );         \
+    a = wu_add( a, b ); d = wu_xor( d, a ); d = wu_rol8( d );          \
+    c = wu_add( c, d ); b = wu_xor( b, c ); b = wu_rol7( b );          \
+  } while(0)
+
 void
 fd_chacha20rng_refill_avx( fd_chacha20rng_t * rng ) {
 
@@ -57,14 +65,6 @@ fd_chacha20rng_refill_avx( fd_chacha20rng_t * rng ) {
   wu_t c8 = k4;    wu_t c9 = k5;    wu_t cA = k6;    wu_t cB = k7;
   wu_t cC = idxs;  wu_t cD = zero;  wu_t cE = zero;  wu_t cF = zero;
 
-# define QUARTER_ROUND(a,b,c,d)                                        \
-  do {                                                                 \
-    a = wu_add( a, b ); d = wu_xor( d, a ); d = wu_rol16( d );         \
-    c = wu_add( c, d ); b = wu_xor( b, c ); b = wu_rol12( b );         \
-    a = wu_add( a, b ); d = wu_xor( d, a ); d = wu_rol8( d );          \
-    c = wu_add( c, d ); b = wu_xor( b, c ); b = wu_rol7( b );          \
-  } while(0)
-
   for( ulong i=0UL; i<10UL; i++ ) {
     QUARTER_ROUND( c0, c4, c8, cC );
     QUARTER_ROUND( c1, c5, c9, cD );
@@ -75,7 +75,6 @@ fd_chacha20rng_refill_avx( fd_chacha20rng_t * rng ) {
     QUARTER_ROUND( c2, c7, c8, cD );
     QUARTER_ROUND( c3, c4, c9, cE );
   }
-# undef QUARTER_ROUND
 
   /* Finalize */
 
@@ -103,19 +102,95 @@ fd_chacha20rng_refill_avx( fd_chacha20rng_t * rng ) {
   wu_transpose_8x8( c8, c9, cA, cB, cC, cD, cE, cF,
                     c8, c9, cA, cB, cC, cD, cE, cF );
 
-  /* Update ring buffer */
+  /* Update ring buffer.  Block idx+k goes to slot (idx+k)%8 of the
+     ring.  idx is usually a multiple of 8, but not after a
+     fd_chacha20rng_init_prefilled. */
 
   uint * out = (uint *)rng->buf;
-  wu_st( out+0x00, c0 ); wu_st( out+0x08, c8 );
-  wu_st( out+0x10, c1 ); wu_st( out+0x18, c9 );
-  wu_st( out+0x20, c2 ); wu_st( out+0x28, cA );
-  wu_st( out+0x30, c3 ); wu_st( out+0x38, cB );
-  wu_st( out+0x40, c4 ); wu_st( out+0x48, cC );
-  wu_st( out+0x50, c5 ); wu_st( out+0x58, cD );
-  wu_st( out+0x60, c6 ); wu_st( out+0x68, cE );
-  wu_st( out+0x70, c7 ); wu_st( out+0x78, cF );
+  ulong  r   = idx & 7UL;
+# define SLOT(k) (out + 0x10UL*((r+(k))&7UL))
+  wu_st( SLOT(0), c0 ); wu_st( SLOT(0)+8, c8 );
+  wu_st( SLOT(1), c1 ); wu_st( SLOT(1)+8, c9 );
+  wu_st( SLOT(2), c2 ); wu_st( SLOT(2)+8, cA );
+  wu_st( SLOT(3), c3 ); wu_st( SLOT(3)+8, cB );
+  wu_st( SLOT(4), c4 ); wu_st( SLOT(4)+8, cC );
+  wu_st( SLOT(5), c5 ); wu_st( SLOT(5)+8, cD );
+  wu_st( SLOT(6), c6 ); wu_st( SLOT(6)+8, cE );
+  wu_st( SLOT(7), c7 ); wu_st( SLOT(7)+8, cF );
+# undef SLOT
 
   /* Update ring descriptor */
 
   rng->buf_fill += 8*FD_CHACHA20_BLOCK_SZ;
 }
+
+void
+fd_chacha20rng_first_blocks( uchar       block0[][ FD_CHACHA20_BLOCK_SZ ],
+                             uchar const key   [][ FD_CHACHA20_KEY_SZ   ],
+                             ulong       cnt ) {
+
+  wu_t iv0  = wu_bcast( 0x61707865U );
+  wu_t iv1  = wu_bcast( 0x3320646eU );
+  wu_t iv2  = wu_bcast( 0x79622d32U );
+  wu_t iv3  = wu_bcast( 0x6b206574U );
+  wu_t zero = wu_zero();
+
+  /* Same as fd_chacha20rng_refill_avx, except that each lane runs block
+     0 of a different stream instead of a different block of the same
+     stream. */
+
+  for( ulong i0=0UL; i0<cnt; i0+=8UL ) {
+    ulong lane_cnt = fd_ulong_min( cnt-i0, 8UL );
+
+    /* Load one key per lane (repeating the last one for unused lanes)
+       and transpose so that k<j> holds word j of each key. */
+
+#   define KEY(l) wu_ldu( key[ i0+fd_ulong_min( (l), lane_cnt-1UL ) ] )
+    wu_t k0 = KEY(0); wu_t k1 = KEY(1); wu_t k2 = KEY(2); wu_t k3 = KEY(3);
+    wu_t k4 = KEY(4); wu_t k5 = KEY(5); wu_t k6 = KEY(6); wu_t k7 = KEY(7);
+#   undef KEY
+    wu_transpose_8x8( k0, k1, k2, k3, k4, k5, k6, k7,
+                      k0, k1, k2, k3, k4, k5, k6, k7 );
+
+    wu_t c0 = iv0;   wu_t c1 = iv1;   wu_t c2 = iv2;   wu_t c3 = iv3;
+    wu_t c4 = k0;    wu_t c5 = k1;    wu_t c6 = k2;    wu_t c7 = k3;
+    wu_t c8 = k4;    wu_t c9 = k5;    wu_t cA = k6;    wu_t cB = k7;
+    wu_t cC = zero;  wu_t cD = zero;  wu_t cE = zero;  wu_t cF = zero;
+
+    for( ulong i=0UL; i<10UL; i++ ) {
+      QUARTER_ROUND( c0, c4, c8, cC );
+      QUARTER_ROUND( c1, c5, c9, cD );
+      QUARTER_ROUND( c2, c6, cA, cE );
+      QUARTER_ROUND( c3, c7, cB, cF );
+      QUARTER_ROUND( c0, c5, cA, cF );
+      QUARTER_ROUND( c1, c6, cB, cC );
+      QUARTER_ROUND( c2, c7, c8, cD );
+      QUARTER_ROUND( c3, c4, c9, cE );
+    }
+
+    c0 = wu_add( c0, iv0 );
+    c1 = wu_add( c1, iv1 );
+    c2 = wu_add( c2, iv2 );
+    c3 = wu_add( c3, iv3 );
+    c4 = wu_add( c4, k0  );
+    c5 = wu_add( c5, k1  );
+    c6 = wu_add( c6, k2  );
+    c7 = wu_add( c7, k3  );
+    c8 = wu_add( c8, k4  );
+    c9 = wu_add( c9, k5  );
+    cA = wu_add( cA, k6  );
+    cB = wu_add( cB, k7  );
+
+    wu_transpose_8x8( c0, c1, c2, c3, c4, c5, c6, c7,
+                      c0, c1, c2, c3, c4, c5, c6, c7 );
+    wu_transpose_8x8( c8, c9, cA, cB, cC, cD, cE, cF,
+                      c8, c9, cA, cB, cC, cD, cE, cF );
+
+    wu_t lo[8] = { c0, c1, c2, c3, c4, c5, c6, c7 };
+    wu_t hi[8] = { c8, c9, cA, cB, cC, cD, cE, cF };
+    for( ulong l=0UL; l<lane_cnt; l++ ) {
+      wu_stu( block0[ i0+l ],       lo[ l ] );
+      wu_stu( block0[ i0+l ]+32UL,  hi[ l ] );
+    }
+  }
+}
@@ -68,6 +68,17 @@ fd_chacha20rng_init( fd_chacha20rng_t * rng,
   return rng;
 }
 
+fd_chacha20rng_t *
+fd_chacha20rng_init_prefilled( fd_chacha20rng_t * rng,
+                               void const *       key,
+                               void const *       block0 ) {
+  memcpy( rng->key, key,    FD_CHACHA20_KEY_SZ   );
+  memcpy( rng->buf, block0, FD_CHACHA20_BLOCK_SZ );
+  rng->buf_off  = 0UL;
+  rng->buf_fill = FD_CHACHA20_BLOCK_SZ;
+  return rng;
+}
+
 #if FD_HAS_AVX
 
 void
@@ -75,6 +86,20 @@ fd_chacha20rng_refill_avx( fd_chacha20rng_t * rng );
 
 #else
 
+void
+fd_chacha20rng_first_blocks( uchar       block0[][ FD_CHACHA20_BLOCK_SZ ],
+                             uchar const key   [][ FD_CHACHA20_KEY_SZ   ],
+                             ulong       cnt ) {
+  uchar block[ FD_CHACHA20_BLOCK_SZ ] __attribute__((aligned(32)));
+  uchar _key [ FD_CHACHA20_KEY_SZ   ] __attribute__((aligned(32)));
+  uint idx_nonce[4] __attribute__((aligned(16))) = { 0U, 0U, 0U, 0U };
+  for( ulong i=0UL; i<cnt; i++ ) {
+    memcpy( _key, key[ i ], FD_CHACHA20_KEY_SZ );
+    fd_chacha20_block( block, _key, idx_nonce );
+    memcpy( block0[ i ], block, FD_CHACHA20_BLOCK_SZ );
+  }
+}
+
 void
 fd_chacha20rng_refill_seq( fd_chacha20rng_t * rng ) {
   ulong fill_target = FD_CHACHA20RNG_BUFSZ - FD_CHACHA20_BLOCK_SZ;
@@ -116,6 +116,31 @@ fd_chacha20rng_t *
 fd_chacha20rng_init( fd_chacha20rng_t * rng,
                      void const *       key );
 
+/* fd_chacha20rng_first_blocks computes the first ChaCha20 block of cnt
+   independent RNG streams, where stream i is keyed by key[i] (32 byte
+   seed as in fd_chacha20rng_init).  block0[i] is filled with the first
+   FD_CHACHA20_BLOCK_SZ bytes that fd_chacha20rng_init( rng, key[i] )
+   would produce.  With AVX, 8 streams are computed per pass.  This is
+   useful when many short streams are needed (e.g. one per shred for
+   Turbine), since fd_chacha20rng_init computes a full buffer of blocks
+   that is mostly discarded if only a few values are drawn.  key and
+   block0 have no alignment requirements.
+
+   fd_chacha20rng_init_prefilled is fd_chacha20rng_init with the first
+   block of the stream already computed by fd_chacha20rng_first_blocks.
+   Further blocks are computed as usual once block0 is consumed.
+   Returns rng. */
+
+void
+fd_chacha20rng_first_blocks( uchar       block0[][ FD_CHACHA20_BLOCK_SZ ],
+                             uchar const key   [][ FD_CHACHA20_KEY_SZ   ],
+                             ulong       cnt );
+
+fd_chacha20rng_t *
+fd_chacha20rng_init_prefilled( fd_chacha20rng_t * rng,
+                               void const *       key,
+                               void const *       block0 );
+
 /* The refill function .  Not part of the public API. */
 
 void
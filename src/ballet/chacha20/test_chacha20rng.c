@@ -34,6 +34,48 @@ main( int     argc,
     fd_chacha20rng_ulong( rng );
   FD_TEST( fd_chacha20rng_ulong( rng )==0xf4682b7e28eae4a7UL );
 
+  /* Test fd_chacha20rng_first_blocks and fd_chacha20rng_init_prefilled
+     against fd_chacha20rng_init */
+
+  do {
+    fd_rng_t _lrng[1]; fd_rng_t * lrng = fd_rng_join( fd_rng_new( _lrng, 1U, 0UL ) );
+    fd_chacha20rng_t _rng2[1];
+    fd_chacha20rng_t * rng2 = fd_chacha20rng_join( fd_chacha20rng_new( _rng2, FD_CHACHA20RNG_MODE_MOD ) );
+
+    uchar keys  [ 19 ][ FD_CHACHA20_KEY_SZ   ];
+    uchar blocks[ 19 ][ FD_CHACHA20_BLOCK_SZ ];
+    for( ulong i=0UL; i<19UL; i++ ) for( ulong b=0UL; b<FD_CHACHA20_KEY_SZ; b++ ) keys[ i ][ b ] = fd_rng_uchar( lrng );
+
+    for( ulong cnt=0UL; cnt<=19UL; cnt++ ) {
+      fd_chacha20rng_first_blocks( blocks, (uchar const (*)[ FD_CHACHA20_KEY_SZ ])keys, cnt );
+      for( ulong i=0UL; i<cnt; i++ ) {
+        fd_chacha20rng_init          ( rng,  keys[ i ]              );
+        fd_chacha20rng_init_prefilled( rng2, keys[ i ], blocks[ i ] );
+        for( ulong j=0UL; j<1000UL; j++ ) FD_TEST( fd_chacha20rng_ulong( rng )==fd_chacha20rng_ulong( rng2 ) );
+      }
+    }
+
+    FD_LOG_NOTICE(( "Benchmarking fd_chacha20rng_first_blocks" ));
+    ulong iter = 100000UL;
+    long  dt   = -fd_log_wallclock();
+    for( ulong rem=iter; rem; rem-- ) {
+      fd_chacha20rng_init( rng, keys[ rem&15UL ] );
+      FD_COMPILER_FORGET( rng );
+    }
+    dt += fd_log_wallclock();
+    FD_LOG_NOTICE(( "  ~%6.3f ns / fd_chacha20rng_init", (double)dt / (double)iter ));
+    dt = -fd_log_wallclock();
+    for( ulong rem=iter/16UL; rem; rem-- ) {
+      fd_chacha20rng_first_blocks( blocks, (uchar const (*)[ FD_CHACHA20_KEY_SZ ])keys, 16UL );
+      FD_COMPILER_MFENCE();
+    }
+    dt += fd_log_wallclock();
+    FD_LOG_NOTICE(( "  ~%6.3f ns / stream with fd_chacha20rng_first_blocks", (double)dt / (double)((iter/16UL)*16UL) ));
+
+    fd_chacha20rng_delete( fd_chacha20rng_leave( rng2 ) );
+    fd_rng_delete( fd_rng_leave( lrng ) );
+  } while(0);
+
   do {
     FD_LOG_NOTICE(( "Benchmarking fd_chacha20rng_ulong" ));
     key[ 0 ]++;
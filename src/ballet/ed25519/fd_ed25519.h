@@ -72,6 +72,37 @@ fd_ed25519_sign( uchar         sig[ 64 ],
                  uchar const   private_key[ 32 ],
                  fd_sha512_t * sha );
 
+/* FD_ED25519_SIGN_BATCH_MAX is the max number of messages that can be
+   signed by a single fd_ed25519_sign_batch call.
+   FD_ED25519_SIGN_BATCH_MSG_MAX is the max message size that goes
+   through the batched SHA-512 path (larger messages are still fine,
+   they are just hashed one at a time). */
+
+#define FD_ED25519_SIGN_BATCH_MAX     (16UL)
+#define FD_ED25519_SIGN_BATCH_MSG_MAX (1232UL)
+
+/* fd_ed25519_sign_batch signs batch_sz messages with the same key pair.
+   msgs[i] and msg_szs[i] are the i-th message and its size, with the
+   same requirements as in fd_ed25519_sign, and its signature is
+   written to sigs+64*i.  batch_sz must be in
+   [1,FD_ED25519_SIGN_BATCH_MAX].
+
+   The signatures are exactly the ones fd_ed25519_sign would produce.
+   What is shared across the batch is the expansion of the private key,
+   which is done once, and the hashing of the nonces and of the
+   challenges, which use the SHA-512 batch API (AVX / AVX-512 when
+   available).  Sanitizes the sha and stack like fd_ed25519_sign.
+   Returns sigs, or NULL if batch_sz is out of range. */
+
+uchar * FD_FN_SENSITIVE
+fd_ed25519_sign_batch( uchar *             sigs,      /* 64*batch_sz */
+                       uchar const * const msgs[],    /* batch_sz */
+                       ulong const         msg_szs[], /* batch_sz */
+                       ulong               batch_sz,
+                       uchar const         public_key[ 32 ],
+                       uchar const         private_key[ 32 ],
+                       fd_sha512_t *       sha );
+
 /* fd_ed25519_verify verifies message according to the ED25519 standard.
 
    msg is assumed to point to the first byte of a sz byte memory region
@@ -129,6 +160,40 @@ fd_ed25519_verify_batch_single_msg( uchar const   msg[], /* msg_sz */
                                     fd_sha512_t * shas[ 1 ],               /* batch_sz */
                                     uchar const   batch_sz );
 
+/* FD_ED25519_VERIFY_BATCH_MAX is the max number of signatures that
+   can be verified by a single fd_ed25519_verify_batch_multi_msg call.
+   FD_ED25519_VERIFY_BATCH_MSG_MAX is the max message size that goes
+   through the batched SHA-512 path (larger messages are still fine,
+   they are just hashed one at a time). */
+
+#define FD_ED25519_VERIFY_BATCH_MAX     (16UL)
+#define FD_ED25519_VERIFY_BATCH_MSG_MAX (1232UL)
+
+/* fd_ed25519_verify_batch_multi_msg verifies a batch of batch_sz
+   signatures, each over its own message.  msgs[i], msg_szs[i], sigs[i]
+   and pubkeys[i] are the message, message size, 64-byte signature and
+   32-byte public key of the i-th signature, with the same requirements
+   as in fd_ed25519_verify.  batch_sz must be in
+   [1,FD_ED25519_VERIFY_BATCH_MAX].  sha is a handle of a local join to
+   a sha512 calculator.
+
+   On return, res[i] holds exactly what fd_ed25519_verify would return
+   for the i-th signature: each signature is checked individually with
+   the same (cofactorless) equation, this is not a probabilistic batch
+   check.  What is shared across the batch is the decoding and the
+   hashing of the k_i, which use the SHA-512 batch API (AVX / AVX-512
+   when available).  Returns FD_ED25519_SUCCESS if all signatures
+   verified, the error of the first signature that failed otherwise. */
+
+int
+fd_ed25519_verify_batch_multi_msg( uchar const * const msgs[],    /* batch_sz */
+                                   ulong const         msg_szs[], /* batch_sz */
+                                   uchar const * const sigs[],    /* batch_sz, each 64 bytes */
+                                   uchar const * const pubkeys[], /* batch_sz, each 32 bytes */
+                                   int                 res[],     /* batch_sz */
+                                   ulong               batch_sz,
+                                   fd_sha512_t *       sha );
+
 /* fd_ed25519_strerror converts an FD_ED25519_SUCCESS / FD_ED25519_ERR_*
    code into a human readable cstr.  The lifetime of the returned
    pointer is infinite.  The returned pointer is always to a non-NULL
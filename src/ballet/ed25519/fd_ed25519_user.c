@@ -131,6 +131,94 @@ fd_ed25519_sign( uchar         sig[ static 64 ],
   return sig;
 }
 
+uchar * FD_FN_SENSITIVE
+fd_ed25519_sign_batch( uchar *             sigs,      /* 64*batch_sz */
+                       uchar const * const msgs[],    /* batch_sz */
+                       ulong const         msg_szs[], /* batch_sz */
+                       ulong               batch_sz,
+                       uchar const         public_key[ static 32 ],
+                       uchar const         private_key[ static 32 ],
+                       fd_sha512_t *       sha ) {
+  if( FD_UNLIKELY( batch_sz==0UL || batch_sz>FD_ED25519_SIGN_BATCH_MAX ) ) {
+    return NULL;
+  }
+
+  /* Step 1 of fd_ed25519_sign, once for the whole batch */
+
+  uchar s[ FD_SHA512_HASH_SZ ];
+  fd_sha512_fini( fd_sha512_append( fd_sha512_init( sha ), private_key, 32UL ), s );
+  s[ 0] &= (uchar)0xF8;
+  s[31] &= (uchar)0x7F;
+  s[31] |= (uchar)0x40;
+  uchar * h = s + 32;
+
+  /* The batched SHA-512 needs each prefix || M and R || A || M
+     contiguous in memory, so they are copied into buf, as in
+     fd_ed25519_verify_batch_multi_msg.  Messages too large for buf are
+     hashed in place. */
+
+  uchar              r  [ FD_ED25519_SIGN_BATCH_MAX ][ FD_SHA512_HASH_SZ ];
+  uchar              k  [ FD_ED25519_SIGN_BATCH_MAX ][ FD_SHA512_HASH_SZ ];
+  uchar              buf[ FD_ED25519_SIGN_BATCH_MAX ][ 64UL+FD_ED25519_SIGN_BATCH_MSG_MAX ];
+  fd_sha512_batch_t  _batch[1];
+
+  /* Step 2: r_j = SHA512(prefix || M_j) */
+
+  fd_sha512_batch_t * batch = fd_sha512_batch_init( _batch );
+  for( ulong j=0UL; j<batch_sz; j++ ) {
+    ulong msg_sz = msg_szs[ j ];
+    if( FD_SHA512_BATCH_MAX>1UL && FD_LIKELY( msg_sz<=FD_ED25519_SIGN_BATCH_MSG_MAX ) ) {
+      fd_memcpy( buf[ j ], h, 32UL );
+      if( FD_LIKELY( msg_sz ) ) fd_memcpy( buf[ j ]+32UL, msgs[ j ], msg_sz );
+      fd_sha512_batch_add( batch, buf[ j ], 32UL+msg_sz, r[ j ] );
+    } else {
+      fd_sha512_fini( fd_sha512_append( fd_sha512_append( fd_sha512_init( sha ), h, 32UL ), msgs[ j ], msg_sz ), r[ j ] );
+    }
+  }
+  fd_sha512_batch_fini( batch );
+
+  /* Step 3: R_j = [r_j]B, and step 4: k_j = SHA512(R_j || A || M_j).
+     Writing R_j over the prefix in buf also clears it from there. */
+
+  batch = fd_sha512_batch_init( _batch );
+  for( ulong j=0UL; j<batch_sz; j++ ) {
+    uchar * sig    = sigs + 64UL*j;
+    ulong   msg_sz = msg_szs[ j ];
+
+    fd_curve25519_scalar_reduce( r[ j ], r[ j ] );
+    fd_ed25519_point_t R[1];
+    fd_ed25519_scalar_mul_base_const_time( R, r[ j ] );
+    fd_ed25519_point_tobytes( sig, R );
+
+    if( FD_SHA512_BATCH_MAX>1UL && FD_LIKELY( msg_sz<=FD_ED25519_SIGN_BATCH_MSG_MAX ) ) {
+      fd_memcpy( buf[ j ],      sig,        32UL );
+      fd_memcpy( buf[ j ]+32UL, public_key, 32UL );
+      if( FD_LIKELY( msg_sz ) ) fd_memcpy( buf[ j ]+64UL, msgs[ j ], msg_sz );
+      fd_sha512_batch_add( batch, buf[ j ], 64UL+msg_sz, k[ j ] );
+    } else {
+      fd_sha512_fini( fd_sha512_append( fd_sha512_append( fd_sha512_append( fd_sha512_init( sha ),
+                      sig, 32UL ), public_key, 32UL ), msgs[ j ], msg_sz ), k[ j ] );
+    }
+  }
+  fd_sha512_batch_fini( batch );
+
+  /* Steps 5 and 6: S_j = (r_j + k_j * s) mod L */
+
+  for( ulong j=0UL; j<batch_sz; j++ ) {
+    fd_curve25519_scalar_reduce( k[ j ], k[ j ] );
+    fd_curve25519_scalar_muladd( sigs+64UL*j+32UL, k[ j ], s, r[ j ] );
+  }
+
+  /* Sanitize */
+
+  fd_memset_explicit( s,      0, FD_SHA512_HASH_SZ );
+  fd_memset_explicit( r,      0, sizeof(r)         );
+  fd_memset_explicit( _batch, 0, sizeof(_batch)    );
+  fd_sha512_init( sha );
+
+  return sigs;
+}
+
 int
 fd_ed25519_verify( uchar const   msg[], /* msg_sz */
                    ulong         msg_sz,
@@ -308,6 +396,90 @@ int fd_ed25519_verify_batch_single_msg( uchar const   msg[], /* msg_sz */
 #undef MAX
 }
 
+int
+fd_ed25519_verify_batch_multi_msg( uchar const * const msgs[],    /* batch_sz */
+                                   ulong const         msg_szs[], /* batch_sz */
+                                   uchar const * const sigs[],    /* batch_sz, each 64 bytes */
+                                   uchar const * const pubkeys[], /* batch_sz, each 32 bytes */
+                                   int                 res[],     /* batch_sz */
+                                   ulong               batch_sz,
+                                   fd_sha512_t *       sha ) {
+  if( FD_UNLIKELY( batch_sz==0UL || batch_sz>FD_ED25519_VERIFY_BATCH_MAX ) ) {
+    return FD_ED25519_ERR_SIG;
+  }
+
+  fd_ed25519_point_t R     [ FD_ED25519_VERIFY_BATCH_MAX ];
+  fd_ed25519_point_t Aprime[ FD_ED25519_VERIFY_BATCH_MAX ];
+  uchar              k     [ FD_ED25519_VERIFY_BATCH_MAX ][ 64 ];
+
+  /* The batched SHA-512 needs each R || A || M contiguous in memory, so
+     they are copied into buf.  Without a batched SHA-512 implementation
+     (FD_SHA512_BATCH_MAX==1) this is pure overhead and all messages are
+     hashed in place. */
+  uchar              buf   [ FD_ED25519_VERIFY_BATCH_MAX ][ 64UL+FD_ED25519_VERIFY_BATCH_MSG_MAX ];
+  fd_sha512_batch_t  _batch[1];
+  fd_sha512_batch_t * batch = fd_sha512_batch_init( _batch );
+
+  /* First, validate the scalars, decompress the public keys and points
+     R_j, check low order points and queue the computation of the k_j.
+     Errors are checked in the same order as fd_ed25519_verify. */
+  for( ulong j=0UL; j<batch_sz; j++ ) {
+    uchar const * r          = sigs[ j ];
+    uchar const * S          = sigs[ j ] + 32;
+    uchar const * public_key = pubkeys[ j ];
+    uchar const * msg        = msgs[ j ];
+    ulong         msg_sz     = msg_szs[ j ];
+
+    res[ j ] = FD_ED25519_SUCCESS;
+
+    if( FD_UNLIKELY( !fd_curve25519_scalar_validate( S ) ) ) {
+      res[ j ] = FD_ED25519_ERR_SIG;
+      continue;
+    }
+
+    int err = fd_ed25519_point_frombytes_2x( &Aprime[ j ], public_key, &R[ j ], r );
+    if( FD_UNLIKELY( err ) ) {
+      res[ j ] = err==1 ? FD_ED25519_ERR_PUBKEY : FD_ED25519_ERR_SIG;
+      continue;
+    }
+    if( FD_UNLIKELY( fd_ed25519_affine_is_small_order( &Aprime[ j ] ) ) ) {
+      res[ j ] = FD_ED25519_ERR_PUBKEY;
+      continue;
+    }
+    if( FD_UNLIKELY( fd_ed25519_affine_is_small_order( &R[ j ] ) ) ) {
+      res[ j ] = FD_ED25519_ERR_SIG;
+      continue;
+    }
+
+    if( FD_SHA512_BATCH_MAX>1UL && FD_LIKELY( msg_sz<=FD_ED25519_VERIFY_BATCH_MSG_MAX ) ) {
+      fd_memcpy( buf[ j ],      r,          32UL );
+      fd_memcpy( buf[ j ]+32UL, public_key, 32UL );
+      if( FD_LIKELY( msg_sz ) ) fd_memcpy( buf[ j ]+64UL, msg, msg_sz );
+      fd_sha512_batch_add( batch, buf[ j ], 64UL+msg_sz, k[ j ] );
+    } else {
+      fd_sha512_fini( fd_sha512_append( fd_sha512_append( fd_sha512_append( fd_sha512_init( sha ),
+                      r, 32UL ), public_key, 32UL ), msg, msg_sz ), k[ j ] );
+    }
+  }
+  fd_sha512_batch_fini( batch );
+
+  /* Then check [S]B = R + [k]A' for each signature */
+  int err = FD_ED25519_SUCCESS;
+  for( ulong j=0UL; j<batch_sz; j++ ) {
+    if( FD_LIKELY( res[ j ]==FD_ED25519_SUCCESS ) ) {
+      uchar const * S = sigs[ j ] + 32;
+
+      fd_ed25519_point_t Rcmp[1];
+      fd_curve25519_scalar_reduce( k[ j ], k[ j ] );
+      fd_ed25519_point_neg( &Aprime[ j ], &Aprime[ j ] );
+      fd_ed25519_double_scalar_mul_base( Rcmp, k[ j ], &Aprime[ j ], S );
+      if( FD_UNLIKELY( !fd_ed25519_point_eq_z1( Rcmp, &R[ j ] ) ) ) res[ j ] = FD_ED25519_ERR_MSG;
+    }
+    if( FD_UNLIKELY( res[ j ] && !err ) ) err = res[ j ];
+  }
+  return err;
+}
+
 char const *
 fd_ed25519_strerror( int err ) {
   switch( err ) {
@@ -1081,6 +1081,150 @@ test_cctv_batch( fd_rng_t * rng, fd_sha512_t * sha ) {
   FD_LOG_NOTICE(( "fd_ed25519_verify_cctv_batch: ok" ));
 }
 
+void
+test_verify_batch_multi_msg( fd_rng_t *    rng,
+                             fd_sha512_t * sha ) {
+  char cstr[128];
+
+  uchar         _msgs[ FD_ED25519_VERIFY_BATCH_MAX ][ 128 ];
+  uchar         _sigs[ FD_ED25519_VERIFY_BATCH_MAX ][  64 ];
+  uchar         _pubs[ FD_ED25519_VERIFY_BATCH_MAX ][  32 ];
+  uchar const * msgs   [ FD_ED25519_VERIFY_BATCH_MAX ];
+  ulong         msg_szs[ FD_ED25519_VERIFY_BATCH_MAX ];
+  uchar const * sigs   [ FD_ED25519_VERIFY_BATCH_MAX ];
+  uchar const * pubs   [ FD_ED25519_VERIFY_BATCH_MAX ];
+  int           res    [ FD_ED25519_VERIFY_BATCH_MAX ];
+
+  /* generate valid signatures over distinct messages */
+  for( ulong j=0UL; j<FD_ED25519_VERIFY_BATCH_MAX; j++ ) {
+    uchar prv[ 32 ];
+    msg_szs[ j ] = (ulong)fd_rng_uint_roll( rng, 129U );
+    for( ulong b=0UL; b<msg_szs[ j ]; b++ ) _msgs[ j ][ b ] = fd_rng_uchar( rng );
+    fd_ed25519_public_from_private( _pubs[ j ], fd_rng_b256( rng, prv ), sha );
+    fd_ed25519_sign( _sigs[ j ], _msgs[ j ], msg_szs[ j ], _pubs[ j ], prv, sha );
+    msgs[ j ] = _msgs[ j ]; sigs[ j ] = _sigs[ j ]; pubs[ j ] = _pubs[ j ];
+  }
+  for( ulong batch=1UL; batch<=FD_ED25519_VERIFY_BATCH_MAX; batch++ ) {
+    FD_TEST( fd_ed25519_verify_batch_multi_msg( msgs, msg_szs, sigs, pubs, res, batch, sha )==FD_ED25519_SUCCESS );
+    for( ulong j=0UL; j<batch; j++ ) FD_TEST( res[ j ]==FD_ED25519_SUCCESS );
+  }
+  FD_TEST( fd_ed25519_verify_batch_multi_msg( msgs, msg_szs, sigs, pubs, res, 0UL, sha )==FD_ED25519_ERR_SIG );
+  FD_TEST( fd_ed25519_verify_batch_multi_msg( msgs, msg_szs, sigs, pubs, res, FD_ED25519_VERIFY_BATCH_MAX+1UL, sha )==FD_ED25519_ERR_SIG );
+
+  /* slot each cctv vector in a random position of a full batch, the
+     per-signature results must match fd_ed25519_verify exactly */
+  for( fd_ed25519_verify_cctv_t const * proof = ed25519_verify_cctvs;
+       proof->msg;
+       proof++ ) {
+    ulong j = (ulong)fd_rng_uint_roll( rng, (uint)FD_ED25519_VERIFY_BATCH_MAX );
+    msgs[ j ] = proof->msg; msg_szs[ j ] = proof->msg_sz; sigs[ j ] = proof->sig; pubs[ j ] = proof->pub;
+
+    int expected = fd_ed25519_verify( proof->msg, proof->msg_sz, proof->sig, proof->pub, sha );
+    int err      = fd_ed25519_verify_batch_multi_msg( msgs, msg_szs, sigs, pubs, res, FD_ED25519_VERIFY_BATCH_MAX, sha );
+    FD_TEST_CUSTOM( res[ j ]==expected, fd_cstr_printf( cstr, 128UL, NULL, "fd_ed25519_verify_batch_multi_msg id=%d", proof->tc_id ) );
+    FD_TEST( err==expected );
+    for( ulong i=0UL; i<FD_ED25519_VERIFY_BATCH_MAX; i++ ) if( i!=j ) FD_TEST( res[ i ]==FD_ED25519_SUCCESS );
+
+    msgs[ j ] = _msgs[ j ]; msg_szs[ j ] = (ulong)fd_rng_uint_roll( rng, 129U ); sigs[ j ] = _sigs[ j ]; pubs[ j ] = _pubs[ j ];
+    uchar prv[ 32 ];
+    fd_ed25519_public_from_private( _pubs[ j ], fd_rng_b256( rng, prv ), sha );
+    fd_ed25519_sign( _sigs[ j ], _msgs[ j ], msg_szs[ j ], _pubs[ j ], prv, sha );
+  }
+
+  /* the first failing signature is reported */
+  _sigs[ 3 ][ 0 ] ^= (uchar)1;
+  _msgs[ 9 ][ 0 ] ^= (uchar)1; msg_szs[ 9 ] = fd_ulong_max( msg_szs[ 9 ], 1UL );
+  FD_TEST( fd_ed25519_verify_batch_multi_msg( msgs, msg_szs, sigs, pubs, res, FD_ED25519_VERIFY_BATCH_MAX, sha )!=FD_ED25519_SUCCESS );
+  FD_TEST( res[ 3 ]==fd_ed25519_verify( msgs[ 3 ], msg_szs[ 3 ], sigs[ 3 ], pubs[ 3 ], sha ) );
+  FD_TEST( res[ 9 ]==FD_ED25519_ERR_MSG );
+  _sigs[ 3 ][ 0 ] ^= (uchar)1;
+  _msgs[ 9 ][ 0 ] ^= (uchar)1;
+  FD_LOG_NOTICE(( "fd_ed25519_verify_batch_multi_msg: ok" ));
+
+  /* bench against one fd_ed25519_verify per signature */
+  for( ulong j=0UL; j<FD_ED25519_VERIFY_BATCH_MAX; j++ ) {
+    uchar prv[ 32 ];
+    msg_szs[ j ] = 128UL;
+    fd_ed25519_public_from_private( _pubs[ j ], fd_rng_b256( rng, prv ), sha );
+    fd_ed25519_sign( _sigs[ j ], _msgs[ j ], msg_szs[ j ], _pubs[ j ], prv, sha );
+  }
+  ulong iter = 10000UL;
+  long dt = fd_log_wallclock();
+  for( ulong rem=iter; rem; rem-- ) {
+    ulong j = rem & (FD_ED25519_VERIFY_BATCH_MAX-1UL);
+    FD_COMPILER_FORGET( j );
+    fd_ed25519_verify( msgs[ j ], msg_szs[ j ], sigs[ j ], pubs[ j ], sha );
+  }
+  dt = fd_log_wallclock() - dt;
+  log_bench( "fd_ed25519_verify(128)", iter, dt );
+  for( ulong batch=1UL; batch<=FD_ED25519_VERIFY_BATCH_MAX; batch*=2UL ) {
+    dt = fd_log_wallclock();
+    for( ulong rem=iter/batch; rem; rem-- ) {
+      FD_COMPILER_FORGET( batch );
+      fd_ed25519_verify_batch_multi_msg( msgs, msg_szs, sigs, pubs, res, batch, sha );
+    }
+    dt = fd_log_wallclock() - dt;
+    log_bench( fd_cstr_printf( cstr, 128UL, NULL, "fd_..._verify_multi_msg(128 / %lu)", batch ), (iter/batch)*batch, dt );
+  }
+}
+
+void
+test_sign_batch( fd_rng_t *    rng,
+                 fd_sha512_t * sha ) {
+  char cstr[128];
+
+  /* include messages too large for the batched SHA-512 path */
+  static uchar  _msgs[ FD_ED25519_SIGN_BATCH_MAX ][ FD_ED25519_SIGN_BATCH_MSG_MAX+64UL ];
+  uchar         sigs   [ FD_ED25519_SIGN_BATCH_MAX ][ 64 ];
+  uchar const * msgs   [ FD_ED25519_SIGN_BATCH_MAX ];
+  ulong         msg_szs[ FD_ED25519_SIGN_BATCH_MAX ];
+  uchar         prv[ 32 ];
+  uchar         pub[ 32 ];
+
+  for( ulong iter=0UL; iter<64UL; iter++ ) {
+    fd_ed25519_public_from_private( pub, fd_rng_b256( rng, prv ), sha );
+    ulong batch = 1UL + (ulong)fd_rng_uint_roll( rng, (uint)FD_ED25519_SIGN_BATCH_MAX );
+    for( ulong j=0UL; j<batch; j++ ) {
+      msg_szs[ j ] = fd_ulong_if( fd_rng_uint_roll( rng, 8U )==0U, FD_ED25519_SIGN_BATCH_MSG_MAX+(ulong)fd_rng_uint_roll( rng, 65U ),
+                                                                   (ulong)fd_rng_uint_roll( rng, 129U ) );
+      for( ulong b=0UL; b<msg_szs[ j ]; b++ ) _msgs[ j ][ b ] = fd_rng_uchar( rng );
+      msgs[ j ] = _msgs[ j ];
+    }
+    FD_TEST( fd_ed25519_sign_batch( sigs[ 0 ], msgs, msg_szs, batch, pub, prv, sha )==sigs[ 0 ] );
+    for( ulong j=0UL; j<batch; j++ ) {
+      uchar ref[ 64 ];
+      fd_ed25519_sign( ref, msgs[ j ], msg_szs[ j ], pub, prv, sha );
+      FD_TEST( fd_memeq( sigs[ j ], ref, 64UL ) );
+      FD_TEST( fd_ed25519_verify( msgs[ j ], msg_szs[ j ], sigs[ j ], pub, sha )==FD_ED25519_SUCCESS );
+    }
+  }
+  FD_TEST( !fd_ed25519_sign_batch( sigs[ 0 ], msgs, msg_szs, 0UL,                           pub, prv, sha ) );
+  FD_TEST( !fd_ed25519_sign_batch( sigs[ 0 ], msgs, msg_szs, FD_ED25519_SIGN_BATCH_MAX+1UL, pub, prv, sha ) );
+  FD_LOG_NOTICE(( "fd_ed25519_sign_batch: ok" ));
+
+  /* bench against one fd_ed25519_sign per message, with 32 byte
+     messages like the Merkle roots signed for each FEC set */
+  for( ulong j=0UL; j<FD_ED25519_SIGN_BATCH_MAX; j++ ) msg_szs[ j ] = 32UL;
+  ulong iter = 10000UL;
+  long dt = fd_log_wallclock();
+  for( ulong rem=iter; rem; rem-- ) {
+    ulong j = rem & (FD_ED25519_SIGN_BATCH_MAX-1UL);
+    FD_COMPILER_FORGET( j );
+    fd_ed25519_sign( sigs[ j ], msgs[ j ], msg_szs[ j ], pub, prv, sha );
+  }
+  dt = fd_log_wallclock() - dt;
+  log_bench( "fd_ed25519_sign(32)", iter, dt );
+  for( ulong batch=1UL; batch<=FD_ED25519_SIGN_BATCH_MAX; batch*=2UL ) {
+    dt = fd_log_wallclock();
+    for( ulong rem=iter/batch; rem; rem-- ) {
+      FD_COMPILER_FORGET( batch );
+      fd_ed25519_sign_batch( sigs[ 0 ], msgs, msg_szs, batch, pub, prv, sha );
+    }
+    dt = fd_log_wallclock() - dt;
+    log_bench( fd_cstr_printf( cstr, 128UL, NULL, "fd_ed25519_sign_batch(32 / %lu)", batch ), (iter/batch)*batch, dt );
+  }
+}
+
 /**********************************************************************/
 
 int
@@ -1118,6 +1262,9 @@ main( int     argc,
   test_cctv       ( sha );
   test_cctv_batch ( rng, sha );
 
+  test_verify_batch_multi_msg( rng, sha );
+  test_sign_batch            ( rng, sha );
+
   fd_sha512_delete( fd_sha512_leave( sha ) );
   fd_rng_delete( fd_rng_leave( rng ) );
   FD_LOG_NOTICE(( "pass" ));
@@ -57,6 +57,13 @@ struct fd_pack_private_ord_txn {
   FD_PACK_BITSET_DECLARE( rw_bitset ); /* all accts this txn references */
   FD_PACK_BITSET_DECLARE(  w_bitset ); /* accts this txn write-locks    */
 
+  /* Unlike the bitsets above, which only represent accounts that are
+     referenced by more than one pending transaction and have been
+     assigned a bit, the blooms represent every account the transaction
+     references (except for the unwritable ones), hashed with
+     bloom_bit.  See bloom_{rw,w}_in_use below. */
+  FD_PACK_BITSET_DECLARE( rw_bloom );
+  FD_PACK_BITSET_DECLARE(  w_bloom );
 };
 typedef struct fd_pack_private_ord_txn fd_pack_ord_txn_t;
 
@@ -368,6 +375,29 @@ struct fd_pack_private {
   FD_PACK_BITSET_DECLARE( bitset_rw_in_use );
   FD_PACK_BITSET_DECLARE( bitset_w_in_use  );
 
+  /* bloom_{rw,w}_in_use: bloom filters (with one hash function,
+     bloom_bit) of all the accounts in acct_in_use, respectively of those
+     in use for writing.  Since accounts leave acct_in_use, bit i is
+     maintained as bloom_{rw,w}_cnt[i]>0, where bloom_{rw,w}_cnt[i]
+     counts the entries of use_by_bank (across all banks) that hash to
+     i.  Unlike the bitsets above, these never produce false negatives,
+     so if a transaction's blooms don't intersect them, the transaction
+     can't conflict with anything in use and the acct_in_use lookups in
+     the scheduling loop can be skipped. */
+  FD_PACK_BITSET_DECLARE( bloom_rw_in_use );
+  FD_PACK_BITSET_DECLARE( bloom_w_in_use  );
+  uint bloom_rw_cnt[ FD_PACK_BITSET_MAX ];
+  uint bloom_w_cnt [ FD_PACK_BITSET_MAX ];
+
+  /* bloom_wcost_hot: bloom filter of the accounts in writer_costs with a
+     total_cost above wcost_hot_threshold (which is 3/4 of the per
+     account write cost limit) this block.  A transaction with a
+     compute_est below the remaining quarter whose w_bloom doesn't
+     intersect it can't exceed the per account write cost limit, so the
+     writer_costs lookups can be skipped. */
+  FD_PACK_BITSET_DECLARE( bloom_wcost_hot );
+  ulong wcost_hot_threshold;
+
   /* writer_costs: Map from account addresses to the sum of costs of
      transactions that write to the account.  Used for enforcing limits
      on the max write cost per account per block. */
@@ -412,10 +442,36 @@ struct fd_pack_private {
   /* acct_to_bitset: an fd_map_dynamic that maps acct addresses to the
      reference count, which bit, etc. */
   fd_pack_bitset_acct_mapping_t * acct_to_bitset;
+
+  /* shard: if non-NULL, the table shared with the other pack objects
+     that this pack object is a shard of, in which case shard_idx is
+     the index of this shard and shard_tag identifies the current block.
+     Every entry of use_by_bank is also acquired in the shared table. */
+  fd_pack_shard_t * shard;
+  ulong             shard_idx;
+  ulong             shard_tag;
 };
 
 typedef struct fd_pack_private fd_pack_t;
 
+/* bloom_bit returns the bit representing acct in the bloom filters.
+   Account addresses are public keys or hashes, so any 8 bytes of them
+   are uniformly distributed already. */
+
+FD_FN_PURE static inline ulong
+bloom_bit( fd_acct_addr_t const * acct ) {
+  return fd_ulong_hash( fd_ulong_load_8( acct->b+8 ) ) & (FD_PACK_BITSET_MAX-1UL);
+}
+
+static inline void
+bloom_reset( fd_pack_t * pack ) {
+  FD_PACK_BITSET_CLEAR( pack->bloom_rw_in_use );
+  FD_PACK_BITSET_CLEAR( pack->bloom_w_in_use  );
+  FD_PACK_BITSET_CLEAR( pack->bloom_wcost_hot );
+  fd_memset( pack->bloom_rw_cnt, 0, sizeof(pack->bloom_rw_cnt) );
+  fd_memset( pack->bloom_w_cnt,  0, sizeof(pack->bloom_w_cnt ) );
+}
+
 ulong
 fd_pack_footprint( ulong                    pack_depth,
                    ulong                    bank_tile_cnt,
@@ -509,6 +565,9 @@ fd_pack_new( void                   * mem,
   FD_PACK_BITSET_CLEAR( pack->bitset_rw_in_use );
   FD_PACK_BITSET_CLEAR( pack->bitset_w_in_use  );
 
+  bloom_reset( pack );
+  pack->wcost_hot_threshold = limits->max_write_cost_per_acct - limits->max_write_cost_per_acct/4UL;
+
   acct_uses_new( _uses,        lg_uses_tbl_sz );
   acct_uses_new( _writer_cost, lg_max_writers );
 
@@ -533,6 +592,10 @@ fd_pack_new( void                   * mem,
 
   bitset_map_new( _acct_bitset, lg_acct_in_trp );
 
+  pack->shard     = NULL;
+  pack->shard_idx = 0UL;
+  pack->shard_tag = 0UL;
+
   return mem;
 }
 
@@ -703,6 +766,8 @@ fd_pack_insert_txn_fini( fd_pack_t  * pack,
 
   FD_PACK_BITSET_CLEAR( ord->rw_bitset );
   FD_PACK_BITSET_CLEAR( ord->w_bitset  );
+  FD_PACK_BITSET_CLEAR( ord->rw_bloom  );
+  FD_PACK_BITSET_CLEAR( ord->w_bloom   );
 
   for( fd_txn_acct_iter_t iter=fd_txn_acct_iter_init( txn, FD_TXN_ACCT_CAT_WRITABLE & FD_TXN_ACCT_CAT_IMM );
       iter!=fd_txn_acct_iter_end(); iter=fd_txn_acct_iter_next( iter ) ) {
@@ -725,6 +790,10 @@ fd_pack_insert_txn_fini( fd_pack_t  * pack,
     q->ref_cnt++;
     FD_PACK_BITSET_SETN( ord->rw_bitset, q->bit );
     FD_PACK_BITSET_SETN( ord->w_bitset , q->bit );
+
+    ulong bit = bloom_bit( &acct );
+    FD_PACK_BITSET_SETN( ord->rw_bloom, bit );
+    FD_PACK_BITSET_SETN( ord->w_bloom,  bit );
   }
 
   for( fd_txn_acct_iter_t iter=fd_txn_acct_iter_init( txn, FD_TXN_ACCT_CAT_READONLY & FD_TXN_ACCT_CAT_IMM );
@@ -750,6 +819,9 @@ fd_pack_insert_txn_fini( fd_pack_t  * pack,
 
     q->ref_cnt++;
     FD_PACK_BITSET_SETN( ord->rw_bitset, q->bit );
+
+    ulong bit = bloom_bit( &acct );
+    FD_PACK_BITSET_SETN( ord->rw_bloom, bit );
   }
 
   pack->pending_txn_cnt++;
@@ -800,6 +872,74 @@ release_bit_reference( fd_pack_t            * pack,
   return ret;
 }
 
+#define SHARD_ACQUIRE_SUCCESS    (0)
+#define SHARD_ACQUIRE_CONFLICT   (1)
+#define SHARD_ACQUIRE_WRITE_COST (2)
+
+/* shard_acquire acquires the accounts of a transaction that has no
+   conflicts with this shard in the table shared with the other shards
+   on behalf of bank_tile, and charges its cost to the shared writer
+   costs.  Readonly accounts already in use by bank_tile are already
+   held (and will only be released once), so they are skipped.  This
+   mirrors exactly which accounts get appended to use_by_bank below.
+   Returns one of the SHARD_ACQUIRE_* codes, and on failure, leaves the
+   shared table unchanged. */
+
+static int
+shard_acquire( fd_pack_t              * pack,
+               fd_txn_t const         * txn,
+               fd_acct_addr_t const   * acct,
+               ulong                    cost,
+               ulong                    bank_tile ) {
+  fd_pack_shard_t * shard = pack->shard;
+  ulong             owner = fd_pack_shard_owner( pack->shard_idx, bank_tile );
+  ulong             tag   = pack->shard_tag;
+
+  ulong charged[ FD_TXN_ACCT_ADDR_MAX ]; ulong charged_cnt = 0UL;
+  ulong locked [ FD_TXN_ACCT_ADDR_MAX ]; ulong locked_cnt  = 0UL;
+
+  int result = SHARD_ACQUIRE_SUCCESS;
+  for( fd_txn_acct_iter_t iter=fd_txn_acct_iter_init( txn, FD_TXN_ACCT_CAT_WRITABLE & FD_TXN_ACCT_CAT_IMM );
+      iter!=fd_txn_acct_iter_end(); iter=fd_txn_acct_iter_next( iter ) ) {
+    ulong i=fd_txn_acct_iter_idx( iter );
+    if( FD_UNLIKELY( !fd_pack_shard_charge( shard, acct+i, tag, cost ) ) ) { result = SHARD_ACQUIRE_WRITE_COST; break; }
+    charged[ charged_cnt++ ] = i;
+    if( FD_UNLIKELY( !fd_pack_shard_lock_write( shard, acct+i, owner ) ) ) { result = SHARD_ACQUIRE_CONFLICT;   break; }
+    locked[ locked_cnt++ ] = i;
+  }
+
+  if( FD_LIKELY( result==SHARD_ACQUIRE_SUCCESS ) ) {
+    for( fd_txn_acct_iter_t iter=fd_txn_acct_iter_init( txn, FD_TXN_ACCT_CAT_READONLY & FD_TXN_ACCT_CAT_IMM );
+        iter!=fd_txn_acct_iter_end(); iter=fd_txn_acct_iter_next( iter ) ) {
+      ulong i=fd_txn_acct_iter_idx( iter );
+      if( fd_pack_unwritable_contains( acct+i ) ) continue;
+
+      fd_pack_addr_use_t * use = acct_uses_query( pack->acct_in_use, acct[i], NULL );
+      if( use && (use->in_use_by & (1UL<<bank_tile)) ) continue;
+
+      if( FD_UNLIKELY( !fd_pack_shard_lock_read( shard, acct+i, owner ) ) ) { result = SHARD_ACQUIRE_CONFLICT; break; }
+      locked[ locked_cnt++ ] = i;
+    }
+  }
+
+  if( FD_UNLIKELY( result!=SHARD_ACQUIRE_SUCCESS ) ) {
+    for( ulong j=0UL; j<locked_cnt;  j++ ) fd_pack_shard_unlock( shard, acct+locked [ j ]             );
+    for( ulong j=0UL; j<charged_cnt; j++ ) fd_pack_shard_refund( shard, acct+charged[ j ], tag, cost );
+  }
+  return result;
+}
+
+/* shard_release_all releases all the accounts acquired in the shared
+   table for the outstanding microblocks of all bank tiles. */
+
+static void
+shard_release_all( fd_pack_t * pack ) {
+  if( FD_LIKELY( !pack->shard ) ) return;
+  for( ulong i=0UL; i<pack->bank_tile_cnt; i++ ) {
+    for( ulong j=0UL; j<pack->use_by_bank_cnt[ i ]; j++ ) fd_pack_shard_unlock( pack->shard, &pack->use_by_bank[ i ][ j ].key );
+  }
+}
+
 typedef struct {
   ulong cus_scheduled;
   ulong txns_scheduled;
@@ -828,6 +968,17 @@ fd_pack_schedule_impl( fd_pack_t  * pack,
   FD_PACK_BITSET_COPY( bitset_rw_in_use, pack->bitset_rw_in_use );
   FD_PACK_BITSET_COPY( bitset_w_in_use,  pack->bitset_w_in_use  );
 
+  FD_PACK_BITSET_DECLARE( bloom_rw_in_use );
+  FD_PACK_BITSET_DECLARE( bloom_w_in_use  );
+  FD_PACK_BITSET_DECLARE( bloom_wcost_hot );
+  FD_PACK_BITSET_COPY( bloom_rw_in_use, pack->bloom_rw_in_use );
+  FD_PACK_BITSET_COPY( bloom_w_in_use,  pack->bloom_w_in_use  );
+  FD_PACK_BITSET_COPY( bloom_wcost_hot, pack->bloom_wcost_hot );
+  uint * bloom_rw_cnt = pack->bloom_rw_cnt;
+  uint * bloom_w_cnt  = pack->bloom_w_cnt;
+  ulong  wcost_hot_threshold = pack->wcost_hot_threshold;
+  ulong  wcost_cold_max_est  = pack->lim->max_write_cost_per_acct - wcost_hot_threshold;
+
   fd_pack_addr_use_t * use_by_bank     = pack->use_by_bank    [bank_tile];
   ulong                use_by_bank_cnt = pack->use_by_bank_cnt[bank_tile];
 
@@ -883,22 +1034,33 @@ fd_pack_schedule_impl( fd_pack_t  * pack,
 
     fd_txn_t const * txn = TXN(cur->txn);
     fd_acct_addr_t const * acct = fd_txn_get_acct_addrs( txn, cur->txn->payload );
+
+    /* The exact checks below need a map lookup per account, so only do
+       them if the blooms say the transaction might touch an account
+       that is in use in a conflicting way, or that is close to its
+       write cost limit. */
+    int check_in_use = !FD_PACK_BITSET_INTERSECT4_EMPTY( bloom_rw_in_use, bloom_w_in_use, cur->w_bloom, cur->rw_bloom );
+    int check_wcost  = (cur->compute_est>wcost_cold_max_est) |
+                       !FD_PACK_BITSET_INTERSECT4_EMPTY( bloom_wcost_hot, bloom_wcost_hot, cur->w_bloom, cur->w_bloom );
+
     /* Check conflicts between this transaction's writable accounts and
        current readers */
-    for( fd_txn_acct_iter_t iter=fd_txn_acct_iter_init( txn, FD_TXN_ACCT_CAT_WRITABLE & FD_TXN_ACCT_CAT_IMM );
-        iter!=fd_txn_acct_iter_end(); iter=fd_txn_acct_iter_next( iter ) ) {
+    if( FD_UNLIKELY( check_in_use | check_wcost ) ) {
+      for( fd_txn_acct_iter_t iter=fd_txn_acct_iter_init( txn, FD_TXN_ACCT_CAT_WRITABLE & FD_TXN_ACCT_CAT_IMM );
+          iter!=fd_txn_acct_iter_end(); iter=fd_txn_acct_iter_next( iter ) ) {
 
-      ulong i=fd_txn_acct_iter_idx( iter );
+        ulong i=fd_txn_acct_iter_idx( iter );
 
-      fd_pack_addr_use_t * in_wcost_table = acct_uses_query( writer_costs, acct[i], NULL );
-      if( FD_UNLIKELY( in_wcost_table && in_wcost_table->total_cost+cur->compute_est > max_write_cost_per_acct ) ) {
-        /* Can't be scheduled until the next block */
-        conflicts = ULONG_MAX;
-        break;
-      }
+        fd_pack_addr_use_t * in_wcost_table = check_wcost ? acct_uses_query( writer_costs, acct[i], NULL ) : NULL;
+        if( FD_UNLIKELY( in_wcost_table && in_wcost_table->total_cost+cur->compute_est > max_write_cost_per_acct ) ) {
+          /* Can't be scheduled until the next block */
+          conflicts = ULONG_MAX;
+          break;
+        }
 
-      fd_pack_addr_use_t * use = acct_uses_query( acct_in_use, acct[i], NULL );
-      if( FD_UNLIKELY( use ) ) conflicts |= use->in_use_by; /* break? */
+        fd_pack_addr_use_t * use = check_in_use ? acct_uses_query( acct_in_use, acct[i], NULL ) : NULL;
+        if( FD_UNLIKELY( use ) ) conflicts |= use->in_use_by; /* break? */
+      }
     }
 
     if( FD_UNLIKELY( conflicts==ULONG_MAX ) ) {
@@ -913,14 +1075,16 @@ fd_pack_schedule_impl( fd_pack_t  * pack,
 
     /* Check conflicts between this transaction's readonly accounts and
        current writers */
-    for( fd_txn_acct_iter_t iter=fd_txn_acct_iter_init( txn, FD_TXN_ACCT_CAT_READONLY & FD_TXN_ACCT_CAT_IMM );
-        iter!=fd_txn_acct_iter_end(); iter=fd_txn_acct_iter_next( iter ) ) {
+    if( FD_UNLIKELY( check_in_use ) ) {
+      for( fd_txn_acct_iter_t iter=fd_txn_acct_iter_init( txn, FD_TXN_ACCT_CAT_READONLY & FD_TXN_ACCT_CAT_IMM );
+          iter!=fd_txn_acct_iter_end(); iter=fd_txn_acct_iter_next( iter ) ) {
 
-      ulong i=fd_txn_acct_iter_idx( iter );
-      if( fd_pack_unwritable_contains( acct+i ) ) continue; /* No need to track sysvars because they can't be writable */
+        ulong i=fd_txn_acct_iter_idx( iter );
+        if( fd_pack_unwritable_contains( acct+i ) ) continue; /* No need to track sysvars because they can't be writable */
 
-      fd_pack_addr_use_t * use = acct_uses_query( acct_in_use,  acct[i], NULL );
-      if( use ) conflicts |= (use->in_use_by & FD_PACK_IN_USE_WRITABLE) ? use->in_use_by : 0UL;
+        fd_pack_addr_use_t * use = acct_uses_query( acct_in_use,  acct[i], NULL );
+        if( use ) conflicts |= (use->in_use_by & FD_PACK_IN_USE_WRITABLE) ? use->in_use_by : 0UL;
+      }
     }
 
     if( FD_UNLIKELY( conflicts ) ) {
@@ -928,6 +1092,14 @@ fd_pack_schedule_impl( fd_pack_t  * pack,
       continue;
     }
 
+    /* If we are a shard, the transaction must also not conflict with
+       the microblocks the other shards have outstanding. */
+    if( FD_UNLIKELY( pack->shard ) ) {
+      int acquired = shard_acquire( pack, txn, acct, cur->compute_est, bank_tile );
+      if( FD_UNLIKELY( acquired==SHARD_ACQUIRE_WRITE_COST ) ) { write_limit_c++; continue; }
+      if( FD_UNLIKELY( acquired==SHARD_ACQUIRE_CONFLICT   ) ) { slow_path++;     continue; }
+    }
+
     /* Include this transaction in the microblock! */
     FD_PACK_BITSET_OR( bitset_rw_in_use, cur->rw_bitset );
     FD_PACK_BITSET_OR( bitset_w_in_use,  cur->w_bitset  );
@@ -952,10 +1124,15 @@ fd_pack_schedule_impl( fd_pack_t  * pack,
       }
       in_wcost_table->total_cost += cur->compute_est;
 
+      ulong bit = bloom_bit( &acct_addr );
+      if( FD_UNLIKELY( in_wcost_table->total_cost>wcost_hot_threshold ) ) FD_PACK_BITSET_SETN( bloom_wcost_hot, bit );
+
       fd_pack_addr_use_t * use = acct_uses_insert( acct_in_use, acct_addr );
       use->in_use_by = bank_tile_mask | FD_PACK_IN_USE_WRITABLE;
 
       use_by_bank[use_by_bank_cnt++] = *use;
+      if( !(bloom_rw_cnt[ bit ]++) ) FD_PACK_BITSET_SETN( bloom_rw_in_use, bit );
+      if( !(bloom_w_cnt [ bit ]++) ) FD_PACK_BITSET_SETN( bloom_w_in_use,  bit );
 
       /* If there aren't any more references to this account in the
          heap, it can't cause any conflicts.  That means we actually
@@ -975,7 +1152,11 @@ fd_pack_schedule_impl( fd_pack_t  * pack,
       fd_pack_addr_use_t * use = acct_uses_query( acct_in_use,  acct_addr, NULL );
       if( !use ) { use = acct_uses_insert( acct_in_use, acct_addr ); use->in_use_by = 0UL; }
 
-      if( !(use->in_use_by & bank_tile_mask) ) use_by_bank[use_by_bank_cnt++] = *use;
+      if( !(use->in_use_by & bank_tile_mask) ) {
+        use_by_bank[use_by_bank_cnt++] = *use;
+        ulong bit = bloom_bit( &acct_addr );
+        if( !(bloom_rw_cnt[ bit ]++) ) FD_PACK_BITSET_SETN( bloom_rw_in_use, bit );
+      }
       use->in_use_by |= bank_tile_mask;
       use->in_use_by &= ~FD_PACK_IN_USE_BIT_CLEARED;
 
@@ -1016,6 +1197,9 @@ fd_pack_schedule_impl( fd_pack_t  * pack,
   pack->use_by_bank_cnt[bank_tile] = use_by_bank_cnt;
   FD_PACK_BITSET_COPY( pack->bitset_rw_in_use, bitset_rw_in_use );
   FD_PACK_BITSET_COPY( pack->bitset_w_in_use,  bitset_w_in_use  );
+  FD_PACK_BITSET_COPY( pack->bloom_rw_in_use,  bloom_rw_in_use  );
+  FD_PACK_BITSET_COPY( pack->bloom_w_in_use,   bloom_w_in_use   );
+  FD_PACK_BITSET_COPY( pack->bloom_wcost_hot,  bloom_wcost_hot  );
 
   pack->written_list_cnt = written_list_cnt;
 
@@ -1036,12 +1220,25 @@ fd_pack_microblock_complete( fd_pack_t * pack,
   FD_PACK_BITSET_COPY( bitset_rw_in_use, pack->bitset_rw_in_use );
   FD_PACK_BITSET_COPY( bitset_w_in_use,  pack->bitset_w_in_use  );
 
+  FD_PACK_BITSET_DECLARE( bloom_rw_in_use );
+  FD_PACK_BITSET_DECLARE( bloom_w_in_use  );
+  FD_PACK_BITSET_COPY( bloom_rw_in_use, pack->bloom_rw_in_use );
+  FD_PACK_BITSET_COPY( bloom_w_in_use,  pack->bloom_w_in_use  );
+
   fd_pack_addr_use_t * base = pack->use_by_bank[bank_tile];
   for( ulong i=0UL; i<pack->use_by_bank_cnt[bank_tile]; i++ ) {
     fd_pack_addr_use_t * use = acct_uses_query( pack->acct_in_use, base[i].key, NULL );
     FD_TEST( use );
     use->in_use_by &= clear_mask;
 
+    ulong bit = bloom_bit( &base[i].key );
+    if( !(--pack->bloom_rw_cnt[ bit ]) ) FD_PACK_BITSET_CLEARN( bloom_rw_in_use, bit );
+    if( base[i].in_use_by & FD_PACK_IN_USE_WRITABLE ) {
+      if( !(--pack->bloom_w_cnt[ bit ]) ) FD_PACK_BITSET_CLEARN( bloom_w_in_use, bit );
+    }
+
+    if( FD_UNLIKELY( pack->shard ) ) fd_pack_shard_unlock( pack->shard, &base[i].key );
+
     /* In order to properly bound the size of bitset_map, we need to
        release the "reference" to the account when we schedule it.
        However, that poses a bit of a problem here, because by the time
@@ -1084,6 +1281,8 @@ fd_pack_microblock_complete( fd_pack_t * pack,
 
   FD_PACK_BITSET_COPY( pack->bitset_rw_in_use, bitset_rw_in_use );
   FD_PACK_BITSET_COPY( pack->bitset_w_in_use,  bitset_w_in_use  );
+  FD_PACK_BITSET_COPY( pack->bloom_rw_in_use,  bloom_rw_in_use  );
+  FD_PACK_BITSET_COPY( pack->bloom_w_in_use,   bloom_w_in_use   );
 
   /* outstanding_microblock_mask never has the writable bit set, so we
      don't care about clearing it here either. */
@@ -1177,6 +1376,23 @@ fd_pack_set_block_limits( fd_pack_t * pack,
   pack->lim->max_data_bytes_per_block  = max_data_bytes_per_block;
 }
 
+void
+fd_pack_set_shard( fd_pack_t       * pack,
+                   fd_pack_shard_t * shard,
+                   ulong             shard_idx ) {
+  /* The accounts of outstanding microblocks were acquired in the old
+     table (if any) and would be released in the new one. */
+  for( ulong i=0UL; i<pack->bank_tile_cnt; i++ ) FD_TEST( !pack->use_by_bank_cnt[i] );
+  pack->shard     = shard;
+  pack->shard_idx = shard_idx;
+}
+
+void
+fd_pack_set_shard_tag( fd_pack_t * pack,
+                       ulong       tag ) {
+  pack->shard_tag = tag;
+}
+
 
 ulong
 fd_pack_expire_before( fd_pack_t * pack,
@@ -1199,6 +1415,8 @@ fd_pack_expire_before( fd_pack_t * pack,
 
 void
 fd_pack_end_block( fd_pack_t * pack ) {
+  shard_release_all( pack );
+
   pack->microblock_cnt        = 0UL;
   pack->data_bytes_consumed   = 0UL;
   pack->cumulative_block_cost = 0UL;
@@ -1233,6 +1451,7 @@ fd_pack_end_block( fd_pack_t * pack ) {
 
   FD_PACK_BITSET_CLEAR( pack->bitset_rw_in_use );
   FD_PACK_BITSET_CLEAR( pack->bitset_w_in_use  );
+  bloom_reset( pack );
 
   for( ulong i=0UL; i<pack->bank_tile_cnt; i++ ) pack->use_by_bank_cnt[i] = 0UL;
 
@@ -1259,6 +1478,8 @@ release_tree( treap_t           * treap,
 
 void
 fd_pack_clear_all( fd_pack_t * pack ) {
+  shard_release_all( pack );
+
   pack->pending_txn_cnt       = 0UL;
   pack->microblock_cnt        = 0UL;
   pack->cumulative_block_cost = 0UL;
@@ -1276,6 +1497,7 @@ fd_pack_clear_all( fd_pack_t * pack ) {
 
   FD_PACK_BITSET_CLEAR( pack->bitset_rw_in_use );
   FD_PACK_BITSET_CLEAR( pack->bitset_w_in_use  );
+  bloom_reset( pack );
   bitset_map_clear( pack->acct_to_bitset );
   pack->bitset_avail[ 0 ] = FD_PACK_BITSET_SLOWPATH;
   for( ulong i=0UL; i<FD_PACK_BITSET_MAX; i++ ) pack->bitset_avail[ i+1UL ] = (ushort)i;
@@ -1498,12 +1720,19 @@ fd_pack_verify( fd_pack_t * pack,
 
   ulong const EMPTY_MASK = ~(FD_PACK_IN_USE_WRITABLE | FD_PACK_IN_USE_BIT_CLEARED);
 
+  uint bloom_rw_cnt[ FD_PACK_BITSET_MAX ] = { 0U };
+  uint bloom_w_cnt [ FD_PACK_BITSET_MAX ] = { 0U };
+
   for( ulong bank=0UL; bank<pack->bank_tile_cnt; bank++ ) {
 
     fd_pack_addr_use_t const * base = pack->use_by_bank[ bank ];
     ulong bank_mask = 1UL << bank;
 
     for( ulong i=0UL; i<pack->use_by_bank_cnt[ bank ]; i++ ) {
+      ulong bloom = bloom_bit( &base[i].key );
+      bloom_rw_cnt[ bloom ]++;
+      bloom_w_cnt [ bloom ] += !!(base[i].in_use_by & FD_PACK_IN_USE_WRITABLE);
+
       fd_pack_addr_use_t * use = acct_uses_query( acct_in_use_copy, base[i].key, NULL );
       VERIFY_TEST( use, "acct in use by bank not in acct_in_use, or in uses_by_bank twice" );
 
@@ -1539,6 +1768,15 @@ fd_pack_verify( fd_pack_t * pack,
   VERIFY_TEST( FD_PACK_BITSET_INTERSECT4_EMPTY( rw_complement, rw_complement, rw_bitset,  rw_bitset ), "extra in rw bitset" );
   VERIFY_TEST( FD_PACK_BITSET_INTERSECT4_EMPTY(  w_complement,  w_complement,  w_bitset,   w_bitset ), "extra in w bitset" );
 
+  for( ulong i=0UL; i<FD_PACK_BITSET_MAX; i++ ) {
+    VERIFY_TEST( bloom_rw_cnt[ i ]==pack->bloom_rw_cnt[ i ], "bloom rw count mismatch" );
+    VERIFY_TEST( bloom_w_cnt [ i ]==pack->bloom_w_cnt [ i ], "bloom w count mismatch"  );
+    FD_PACK_BITSET_CLEAR( bit );
+    FD_PACK_BITSET_SETN( bit, i );
+    VERIFY_TEST( !!bloom_rw_cnt[ i ]==!FD_PACK_BITSET_INTERSECT4_EMPTY( bit, bit, pack->bloom_rw_in_use, pack->bloom_rw_in_use ), "bloom rw bit mismatch" );
+    VERIFY_TEST( !!bloom_w_cnt [ i ]==!FD_PACK_BITSET_INTERSECT4_EMPTY( bit, bit, pack->bloom_w_in_use,  pack->bloom_w_in_use  ), "bloom w bit mismatch"  );
+  }
+
   acct_uses_leave( acct_in_use_copy );
 
   acct_uses_join( _acct_in_use_orig );
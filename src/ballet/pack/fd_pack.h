@@ -9,6 +9,7 @@
 #include "../txn/fd_txn.h"
 #include "fd_est_tbl.h"
 #include "fd_microblock.h"
+#include "fd_pack_shard.h"
 
 #define FD_PACK_ALIGN     (128UL)
 
@@ -177,6 +178,27 @@ FD_FN_PURE ulong fd_pack_bank_tile_cnt( fd_pack_t const * pack );
    but the call is valid. */
 void fd_pack_set_block_limits( fd_pack_t * pack, ulong max_microblocks_per_block, ulong max_data_bytes_per_block );
 
+/* fd_pack_set_shard: Makes this pack object one of the shards sharing
+   the shard table shard (see fd_pack_shard.h), with index shard_idx in
+   [0, fd_pack_shard_cnt( shard )).  From then on, before including a
+   transaction in a microblock, pack also acquires its accounts in the
+   shared table on behalf of the bank tile, and charges its cost to the
+   shared per account write cost limits, releasing the accounts when
+   the microblock completes.  The caller is responsible for only
+   inserting transactions whose home shard (fd_pack_shard_home) is
+   shard_idx, and for splitting the block wide limits between the
+   shards.  shard may be NULL to stop sharing.  pack must be a valid
+   local join with no outstanding microblocks.
+
+   fd_pack_set_shard_tag sets the tag identifying the current block in
+   the shared per account write costs (typically the slot number).  All
+   shards must use the same tag for the same block, and it should
+   increase from block to block.  The typical place to call this is
+   immediately after fd_pack_end_block, alongside
+   fd_pack_set_block_limits. */
+void fd_pack_set_shard    ( fd_pack_t * pack, fd_pack_shard_t * shard, ulong shard_idx );
+void fd_pack_set_shard_tag( fd_pack_t * pack, ulong tag );
+
 /* Return values for fd_pack_insert_txn_fini:  Non-negative values
    indicate the transaction was accepted and may be returned in a future
    microblock.  Negative values indicate that the transaction was
@@ -0,0 +1,134 @@
+#include "fd_pack_shard.h"
+
+#define FD_PACK_SHARD_MAGIC (0xf17eda2ce7ac5a00UL) /* firedancer pack shard ver 0 */
+
+ulong
+fd_pack_shard_align( void ) {
+  return FD_PACK_SHARD_ALIGN;
+}
+
+ulong
+fd_pack_shard_footprint( ulong lg_bucket_cnt ) {
+  if( FD_UNLIKELY( (lg_bucket_cnt<FD_PACK_SHARD_LG_BUCKET_CNT_MIN) | (lg_bucket_cnt>FD_PACK_SHARD_LG_BUCKET_CNT_MAX) ) ) return 0UL;
+  return sizeof(fd_pack_shard_t) + (1UL<<lg_bucket_cnt)*sizeof(fd_pack_shard_bucket_t);
+}
+
+void *
+fd_pack_shard_new( void * shmem,
+                   ulong  shard_cnt,
+                   ulong  lg_bucket_cnt,
+                   ulong  max_write_cost_per_acct ) {
+
+  if( FD_UNLIKELY( !shmem ) ) {
+    FD_LOG_WARNING(( "NULL shmem" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( !fd_ulong_is_aligned( (ulong)shmem, fd_pack_shard_align() ) ) ) {
+    FD_LOG_WARNING(( "misaligned shmem" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( (!shard_cnt) | (shard_cnt>FD_PACK_SHARD_MAX) ) ) {
+    FD_LOG_WARNING(( "bad shard_cnt" ));
+    return NULL;
+  }
+
+  ulong footprint = fd_pack_shard_footprint( lg_bucket_cnt );
+  if( FD_UNLIKELY( !footprint ) ) {
+    FD_LOG_WARNING(( "bad lg_bucket_cnt" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( max_write_cost_per_acct>UINT_MAX ) ) {
+    FD_LOG_WARNING(( "bad max_write_cost_per_acct" ));
+    return NULL;
+  }
+
+  fd_memset( shmem, 0, footprint );
+
+  fd_pack_shard_t * shard = (fd_pack_shard_t *)shmem;
+  shard->shard_cnt               = shard_cnt;
+  shard->bucket_cnt              = 1UL<<lg_bucket_cnt;
+  shard->max_write_cost_per_acct = max_write_cost_per_acct;
+
+  FD_COMPILER_MFENCE();
+  FD_VOLATILE( shard->magic ) = FD_PACK_SHARD_MAGIC;
+  FD_COMPILER_MFENCE();
+
+  return shmem;
+}
+
+fd_pack_shard_t *
+fd_pack_shard_join( void * shshard ) {
+
+  if( FD_UNLIKELY( !shshard ) ) {
+    FD_LOG_WARNING(( "NULL shshard" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( !fd_ulong_is_aligned( (ulong)shshard, fd_pack_shard_align() ) ) ) {
+    FD_LOG_WARNING(( "misaligned shshard" ));
+    return NULL;
+  }
+
+  fd_pack_shard_t * shard = (fd_pack_shard_t *)shshard;
+
+  if( FD_UNLIKELY( shard->magic!=FD_PACK_SHARD_MAGIC ) ) {
+    FD_LOG_WARNING(( "bad magic" ));
+    return NULL;
+  }
+
+  return shard;
+}
+
+void *
+fd_pack_shard_leave( fd_pack_shard_t const * shard ) {
+
+  if( FD_UNLIKELY( !shard ) ) {
+    FD_LOG_WARNING(( "NULL shard" ));
+    return NULL;
+  }
+
+  return (void *)shard;
+}
+
+void *
+fd_pack_shard_delete( void * shshard ) {
+
+  if( FD_UNLIKELY( !shshard ) ) {
+    FD_LOG_WARNING(( "NULL shshard" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( !fd_ulong_is_aligned( (ulong)shshard, fd_pack_shard_align() ) ) ) {
+    FD_LOG_WARNING(( "misaligned shshard" ));
+    return NULL;
+  }
+
+  fd_pack_shard_t * shard = (fd_pack_shard_t *)shshard;
+
+  if( FD_UNLIKELY( shard->magic!=FD_PACK_SHARD_MAGIC ) ) {
+    FD_LOG_WARNING(( "bad magic" ));
+    return NULL;
+  }
+
+  FD_COMPILER_MFENCE();
+  FD_VOLATILE( shard->magic ) = 0UL;
+  FD_COMPILER_MFENCE();
+
+  return (void *)shard;
+}
+
+ulong
+fd_pack_shard_mask( ulong            shard_cnt,
+                    fd_txn_t const * txn,
+                    uchar const *    payload ) {
+  fd_acct_addr_t const * accts = fd_txn_get_acct_addrs( txn, payload );
+  ulong mask = 0UL;
+  for( fd_txn_acct_iter_t iter=fd_txn_acct_iter_init( txn, FD_TXN_ACCT_CAT_WRITABLE & FD_TXN_ACCT_CAT_IMM );
+      iter!=fd_txn_acct_iter_end(); iter=fd_txn_acct_iter_next( iter ) ) {
+    mask |= 1UL << fd_pack_shard_of( shard_cnt, accts+fd_txn_acct_iter_idx( iter ) );
+  }
+  return mask;
+}
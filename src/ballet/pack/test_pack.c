@@ -1031,6 +1031,303 @@ test_reject_writes_to_sysvars( void ) {
   }
 }
 
+/* performance_many_accounts measures scheduling cost for adversarial
+   transactions that reference many accounts, which makes the per
+   account conflict checks in the scheduling loop expensive.  Each
+   transaction writes write_cnt accounts of its own, and reads read_cnt
+   accounts out of a small set of popular accounts.  With hot_write_cnt
+   non-zero, one of the writable accounts is instead one of
+   hot_write_cnt popular accounts, so most candidates conflict with a
+   microblock in flight. */
+static void
+performance_many_accounts( void ) {
+  FD_LOG_NOTICE(( "TEST MANY ACCOUNT PERFORMANCE" ));
+
+  fd_pack_limits_t limits[ 1 ] = { {
+      .max_cost_per_block        = FD_PACK_MAX_COST_PER_BLOCK,
+      .max_vote_cost_per_block   = 0UL,
+      .max_write_cost_per_acct   = FD_PACK_MAX_WRITE_COST_PER_ACCT,
+      .max_data_bytes_per_block  = ULONG_MAX/2UL,
+      .max_txn_per_microblock    = MAX_TXN_PER_MICROBLOCK,
+      .max_microblocks_per_block = 10000000UL,
+  } };
+
+# define BANK_CNT (4UL)
+# define ROUNDS   (32UL)
+
+  FD_LOG_NOTICE(( "writes\treads\thot writes\tschedule (ns/txn)" ));
+  /* At most 36 accounts fit in an MTU sized transaction with no
+     instructions. */
+  ulong const params[][3] = { { 1UL, 2UL, 0UL }, { 8UL, 8UL, 0UL }, { 17UL, 18UL, 0UL },
+                              { 8UL, 8UL, 8UL }, { 17UL, 18UL, 8UL } };
+  for( ulong k=0UL; k<sizeof(params)/sizeof(params[0]); k++ ) {
+    ulong write_cnt     = params[ k ][ 0 ];
+    ulong read_cnt      = params[ k ][ 1 ];
+    ulong hot_write_cnt = params[ k ][ 2 ];
+
+    for( ulong i=0UL; i<MAX_TEST_TXNS; i++ ) {
+      uchar    * p      = payload_scratch[ i ];
+      uchar    * p_base = p;
+      fd_txn_t * t      = (fd_txn_t*) txn_scratch[ i ];
+
+      *(p++) = (uchar)1;
+      fd_memcpy( p,                                   &i,               sizeof(ulong)                                    );
+      fd_memcpy( p+sizeof(ulong),                     SIGNATURE_SUFFIX, FD_TXN_SIGNATURE_SZ - sizeof(ulong)-sizeof(uint) );
+      p += FD_TXN_SIGNATURE_SZ;
+
+      t->transaction_version          = FD_TXN_VLEGACY;
+      t->signature_cnt                = 1;
+      t->signature_off                = 1;
+      t->message_off                  = FD_TXN_SIGNATURE_SZ+1UL;
+      t->readonly_signed_cnt          = 0;
+      t->readonly_unsigned_cnt        = (uchar)read_cnt;
+      t->acct_addr_cnt                = (ushort)(1UL+write_cnt+read_cnt);
+      t->acct_addr_off                = FD_TXN_SIGNATURE_SZ+1UL;
+      t->recent_blockhash_off         = 0;
+      t->addr_table_lookup_cnt        = 0;
+      t->addr_table_adtl_writable_cnt = 0;
+      t->addr_table_adtl_cnt          = 0;
+      t->instr_cnt                    = 0;
+
+      /* The signer */
+      *p = 's' + 0x80; fd_memcpy( p+1, &i, sizeof(ulong) ); memset( p+9, 'S', 32-9 ); p += FD_TXN_ACCT_ADDR_SZ;
+      /* Writable accounts, unique to the transaction except maybe for a
+         popular one */
+      for( ulong j=0UL; j<write_cnt; j++ ) {
+        ulong tag = i*FD_TXN_ACCT_ADDR_MAX+j;
+        if( hot_write_cnt && !j ) tag = ULONG_MAX - (i%hot_write_cnt);
+        memset( p, 'W', FD_TXN_ACCT_ADDR_SZ ); fd_memcpy( p, &tag, sizeof(ulong) ); fd_memcpy( p+8, &tag, sizeof(ulong) );
+        p += FD_TXN_ACCT_ADDR_SZ;
+      }
+      /* Readonly accounts, chosen out of 2*read_cnt popular accounts */
+      for( ulong j=0UL; j<read_cnt; j++ ) {
+        ulong tag = 2UL*j + ((fd_ulong_hash( i )>>(j&63UL))&1UL);
+        memset( p, 'R', FD_TXN_ACCT_ADDR_SZ ); fd_memcpy( p, &tag, sizeof(ulong) ); fd_memcpy( p+8, &tag, sizeof(ulong) );
+        p += FD_TXN_ACCT_ADDR_SZ;
+      }
+      payload_sz[ i ] = (ulong)(p-p_base);
+    }
+
+    FD_TEST( fd_pack_footprint( MAX_TEST_TXNS, BANK_CNT, limits )<PACK_SCRATCH_SZ );
+    fd_pack_t * pack = fd_pack_join( fd_pack_new( pack_scratch, MAX_TEST_TXNS, BANK_CNT, limits, rng ) );
+
+    long  elapsed   = 0L;
+    ulong scheduled = 0UL;
+    for( ulong round=0UL; round<ROUNDS; round++ ) {
+      for( ulong i=0UL; i<MAX_TEST_TXNS; i++ ) insert( i, pack );
+      for( ulong bank=0UL; fd_pack_avail_txn_cnt( pack ); bank=(bank+1UL)%BANK_CNT ) {
+        fd_pack_microblock_complete( pack, bank );
+        elapsed   -= fd_log_wallclock();
+        scheduled += fd_pack_schedule_next_microblock( pack, ULONG_MAX/2UL, 0.0f, bank, outcome.results );
+        elapsed   += fd_log_wallclock();
+        if( FD_UNLIKELY( extra_verify ) ) FD_TEST( !fd_pack_verify( pack, pack_verify_scratch ) );
+      }
+      fd_pack_end_block( pack );
+    }
+    FD_TEST( scheduled==ROUNDS*MAX_TEST_TXNS );
+    FD_LOG_NOTICE(( "%6lu\t%5lu\t%10lu\t%17.3f", write_cnt, read_cnt, hot_write_cnt, (double)elapsed/(double)scheduled ));
+
+    fd_pack_delete( fd_pack_leave( pack ) );
+  }
+
+# undef ROUNDS
+# undef BANK_CNT
+}
+
+#define SHARD_LG_BUCKET_CNT (16UL)
+uchar shard_scratch[ sizeof(fd_pack_shard_t) + (1UL<<SHARD_LG_BUCKET_CNT)*sizeof(fd_pack_shard_bucket_t) ] __attribute__((aligned(FD_PACK_SHARD_ALIGN)));
+
+/* init_shard carves a pack object with the given parameters out of
+   pack_scratch at offset *off, and advances *off.  The block wide
+   limits are split evenly between shard_cnt shards. */
+static fd_pack_t *
+init_shard( ulong * off,
+            ulong   shard_cnt,
+            ulong   pack_depth,
+            ulong   bank_tile_cnt,
+            ulong   max_txn_per_microblock ) {
+  fd_pack_limits_t limits[1] = { {
+    .max_cost_per_block        = FD_PACK_MAX_COST_PER_BLOCK      / shard_cnt,
+    .max_vote_cost_per_block   = FD_PACK_MAX_VOTE_COST_PER_BLOCK / shard_cnt,
+    .max_write_cost_per_acct   = FD_PACK_MAX_WRITE_COST_PER_ACCT,
+    .max_data_bytes_per_block  = ULONG_MAX/2UL,
+    .max_txn_per_microblock    = max_txn_per_microblock,
+    .max_microblocks_per_block = MAX_TEST_TXNS,
+  } };
+  ulong footprint = fd_pack_footprint( pack_depth, bank_tile_cnt, limits );
+  FD_TEST( *off+footprint<=PACK_SCRATCH_SZ );
+  fd_pack_t * pack = fd_pack_join( fd_pack_new( pack_scratch+*off, pack_depth, bank_tile_cnt, limits, rng ) );
+  FD_TEST( pack );
+  *off = fd_ulong_align_up( *off+footprint, fd_pack_align() );
+  return pack;
+}
+
+static void
+test_shard( void ) {
+  FD_LOG_NOTICE(( "TEST SHARD" ));
+
+  FD_TEST( !fd_pack_shard_footprint( FD_PACK_SHARD_LG_BUCKET_CNT_MIN-1UL ) );
+  FD_TEST( !fd_pack_shard_footprint( FD_PACK_SHARD_LG_BUCKET_CNT_MAX+1UL ) );
+  FD_TEST( fd_pack_shard_footprint( SHARD_LG_BUCKET_CNT )==sizeof(shard_scratch) );
+
+  FD_TEST( !fd_pack_shard_new( NULL,            2UL,                     SHARD_LG_BUCKET_CNT, 1UL ) );
+  FD_TEST( !fd_pack_shard_new( shard_scratch+1, 2UL,                     SHARD_LG_BUCKET_CNT, 1UL ) );
+  FD_TEST( !fd_pack_shard_new( shard_scratch,   0UL,                     SHARD_LG_BUCKET_CNT, 1UL ) );
+  FD_TEST( !fd_pack_shard_new( shard_scratch,   FD_PACK_SHARD_MAX+1UL,   SHARD_LG_BUCKET_CNT, 1UL ) );
+  FD_TEST( !fd_pack_shard_new( shard_scratch,   2UL,                     4UL,                 1UL ) );
+  FD_TEST( !fd_pack_shard_join( shard_scratch ) );
+
+  /* Allow one of the heavy transactions below per written account per
+     block across all shards. */
+  ulong max_write_cost = 1500000UL;
+  fd_pack_shard_t * shard = fd_pack_shard_join( fd_pack_shard_new( shard_scratch, 2UL, SHARD_LG_BUCKET_CNT, max_write_cost ) );
+  FD_TEST( shard );
+  FD_TEST( fd_pack_shard_cnt( shard )==2UL );
+
+  ulong off = 0UL;
+  fd_pack_t * pack0 = init_shard( &off, 2UL, 128UL, 2UL, 128UL );
+  fd_pack_t * pack1 = init_shard( &off, 2UL, 128UL, 2UL, 128UL );
+  fd_pack_set_shard( pack0, shard, 0UL ); fd_pack_set_shard_tag( pack0, 1UL );
+  fd_pack_set_shard( pack1, shard, 1UL ); fd_pack_set_shard_tag( pack1, 1UL );
+
+  ulong i = 0UL;
+
+  /* The home shard is one of the shards owning a writable account */
+  make_transaction( i, 500U, 10.0, "ABCD", "E" );
+  fd_txn_t const * t = (fd_txn_t const *)txn_scratch[ i ];
+  ulong home = fd_pack_shard_home( 2UL, t, payload_scratch[ i ] );
+  FD_TEST( home<2UL );
+  FD_TEST( fd_pack_shard_mask( 2UL, t, payload_scratch[ i ] ) & (1UL<<home) );
+
+  /* A write in one shard blocks a read and a write of the same account
+     in the other shard until the microblock completes. */
+  make_transaction( i, 500U, 10.0, "A", "B" ); insert( i++, pack0 );
+  make_transaction( i, 500U, 10.0, "C", "A" ); insert( i++, pack1 );
+  make_transaction( i, 500U,  9.0, "A", "D" ); insert( i++, pack1 );
+  FD_TEST( fd_pack_schedule_next_microblock( pack0, 1000000UL, 0.0f, 0UL, outcome.results )==1UL );
+  FD_TEST( fd_pack_schedule_next_microblock( pack1, 1000000UL, 0.0f, 0UL, outcome.results )==0UL );
+  FD_TEST( fd_pack_schedule_next_microblock( pack1, 1000000UL, 0.0f, 1UL, outcome.results )==0UL );
+  fd_pack_microblock_complete( pack0, 0UL );
+  FD_TEST( fd_pack_schedule_next_microblock( pack1, 1000000UL, 0.0f, 1UL, outcome.results )==1UL );
+  fd_pack_microblock_complete( pack1, 1UL );
+  FD_TEST( fd_pack_schedule_next_microblock( pack1, 1000000UL, 0.0f, 1UL, outcome.results )==1UL );
+  fd_pack_microblock_complete( pack1, 1UL );
+  FD_TEST( fd_pack_avail_txn_cnt( pack0 )==0UL );
+  FD_TEST( fd_pack_avail_txn_cnt( pack1 )==0UL );
+
+  /* Reads of the same account in both shards proceed concurrently */
+  make_transaction( i, 500U, 10.0, "F", "H" ); insert( i++, pack0 );
+  make_transaction( i, 500U, 10.0, "G", "H" ); insert( i++, pack1 );
+  FD_TEST( fd_pack_schedule_next_microblock( pack0, 1000000UL, 0.0f, 0UL, outcome.results )==1UL );
+  FD_TEST( fd_pack_schedule_next_microblock( pack1, 1000000UL, 0.0f, 0UL, outcome.results )==1UL );
+  fd_pack_microblock_complete( pack0, 0UL );
+  fd_pack_microblock_complete( pack1, 0UL );
+
+  /* The per account write cost limit is shared between the shards, and
+     resets when every shard moves on to the next block. */
+  make_transaction( i, 1000000U, 10.0, "J", "" ); insert( i++, pack0 );
+  make_transaction( i, 1000000U, 10.0, "J", "" ); insert( i++, pack1 );
+  FD_TEST( fd_pack_schedule_next_microblock( pack0, 10000000UL, 0.0f, 0UL, outcome.results )==1UL );
+  fd_pack_microblock_complete( pack0, 0UL );
+  FD_TEST( fd_pack_schedule_next_microblock( pack1, 10000000UL, 0.0f, 0UL, outcome.results )==0UL );
+  fd_pack_end_block( pack0 ); fd_pack_set_shard_tag( pack0, 2UL );
+  fd_pack_end_block( pack1 ); fd_pack_set_shard_tag( pack1, 2UL );
+  FD_TEST( fd_pack_schedule_next_microblock( pack1, 10000000UL, 0.0f, 0UL, outcome.results )==1UL );
+
+  /* Ending the block releases everything the shard holds */
+  make_transaction( i, 500U, 10.0, "K", "" ); insert( i++, pack1 );
+  make_transaction( i, 500U, 10.0, "K", "" ); insert( i++, pack0 );
+  FD_TEST( fd_pack_schedule_next_microblock( pack1, 1000000UL, 0.0f, 1UL, outcome.results )==1UL );
+  FD_TEST( fd_pack_schedule_next_microblock( pack0, 1000000UL, 0.0f, 1UL, outcome.results )==0UL );
+  fd_pack_end_block( pack1 ); fd_pack_set_shard_tag( pack1, 3UL );
+  fd_pack_end_block( pack0 ); fd_pack_set_shard_tag( pack0, 3UL );
+  FD_TEST( fd_pack_schedule_next_microblock( pack0, 1000000UL, 0.0f, 1UL, outcome.results )==1UL );
+  fd_pack_end_block( pack0 );
+
+  do {
+    fd_pack_shard_bucket_t const * bucket = (fd_pack_shard_bucket_t const *)(shard+1);
+    for( ulong b=0UL; b<(1UL<<SHARD_LG_BUCKET_CNT); b++ ) FD_TEST( !bucket[ b ].lock );
+  } while(0);
+
+  fd_pack_set_shard( pack0, NULL, 0UL );
+  fd_pack_set_shard( pack1, NULL, 0UL );
+  FD_TEST( fd_pack_shard_leave( shard )==shard_scratch );
+  FD_TEST( fd_pack_shard_delete( shard_scratch )==shard_scratch );
+  FD_TEST( !fd_pack_shard_join( shard_scratch ) );
+}
+
+/* performance_shard compares the rate at which a single pack object
+   can schedule microblocks for bank_cnt bank tiles with the aggregate
+   rate of bank_cnt/SHARD_BANK_CNT shards, each scheduling for
+   SHARD_BANK_CNT of the bank tiles.  Shards run in their own tile, so
+   the aggregate rate is determined by the slowest shard.  Since this
+   may run on a single core, the shards are timed one after the other. */
+static void
+performance_shard( void ) {
+  FD_LOG_NOTICE(( "TEST SHARD PERFORMANCE" ));
+
+# define SHARD_BANK_CNT (4UL)
+# define SHARD_TXN_CNT  (MAX_TEST_TXNS)
+# define SHARD_ROUNDS   (16UL)
+
+  for( ulong i=0UL; i<SHARD_TXN_CNT; i++ ) make_transaction( i, 500U, 10.0, "", "" );
+
+  FD_LOG_NOTICE(( "banks\tshards\tsingle (mblk/s)\tsharded (mblk/s)\tspeedup" ));
+  ulong const bank_cnts[] = { 4UL, 8UL, 16UL, 32UL, 60UL };
+  for( ulong b=0UL; b<sizeof(bank_cnts)/sizeof(bank_cnts[0]); b++ ) {
+    ulong bank_cnt  = bank_cnts[ b ];
+    ulong shard_cnt = bank_cnt / SHARD_BANK_CNT;
+
+    double rate[2];
+    for( int sharded=0; sharded<2; sharded++ ) {
+      ulong pack_cnt      = sharded ? shard_cnt      : 1UL;
+      ulong pack_bank_cnt = sharded ? SHARD_BANK_CNT : bank_cnt;
+
+      fd_pack_shard_t * shard = NULL;
+      if( sharded ) shard = fd_pack_shard_join( fd_pack_shard_new( shard_scratch, shard_cnt, SHARD_LG_BUCKET_CNT, FD_PACK_MAX_WRITE_COST_PER_ACCT ) );
+
+      ulong       off = 0UL;
+      fd_pack_t * packs[ FD_PACK_SHARD_MAX ];
+      for( ulong p=0UL; p<pack_cnt; p++ ) {
+        packs[ p ] = init_shard( &off, pack_cnt, SHARD_TXN_CNT, pack_bank_cnt, MAX_TXN_PER_MICROBLOCK );
+        if( sharded ) { fd_pack_set_shard( packs[ p ], shard, p ); fd_pack_set_shard_tag( packs[ p ], 1UL ); }
+      }
+
+      long  slowest   = 0L;
+      ulong mblk_cnt  = 0UL;
+      for( ulong p=0UL; p<pack_cnt; p++ ) {
+        long elapsed = 0L;
+        for( ulong round=0UL; round<SHARD_ROUNDS; round++ ) {
+          for( ulong i=0UL; i<SHARD_TXN_CNT; i++ ) {
+            if( sharded && fd_pack_shard_home( shard_cnt, (fd_txn_t *)txn_scratch[ i ], payload_scratch[ i ] )!=p ) continue;
+            insert( i, packs[ p ] );
+          }
+          elapsed -= fd_log_wallclock();
+          for( ulong bank=0UL; fd_pack_avail_txn_cnt( packs[ p ] ); bank=(bank+1UL)%pack_bank_cnt ) {
+            fd_pack_microblock_complete( packs[ p ], bank );
+            mblk_cnt += !!fd_pack_schedule_next_microblock( packs[ p ], MAX_TXN_PER_MICROBLOCK*1200UL, 0.0f, bank, outcome.results );
+          }
+          elapsed += fd_log_wallclock();
+          fd_pack_end_block( packs[ p ] );
+        }
+        slowest = fd_long_max( slowest, elapsed );
+      }
+      rate[ sharded ] = (double)mblk_cnt * 1e9 / (double)fd_long_max( slowest, 1L );
+
+      for( ulong p=0UL; p<pack_cnt; p++ ) {
+        if( sharded ) fd_pack_set_shard( packs[ p ], NULL, 0UL );
+        fd_pack_delete( fd_pack_leave( packs[ p ] ) );
+      }
+      if( sharded ) fd_pack_shard_delete( fd_pack_shard_leave( shard ) );
+    }
+    FD_LOG_NOTICE(( "%5lu\t%6lu\t%15.0f\t%16.0f\t%6.2fx", bank_cnt, shard_cnt, rate[0], rate[1], rate[1]/rate[0] ));
+  }
+
+# undef SHARD_ROUNDS
+# undef SHARD_TXN_CNT
+# undef SHARD_BANK_CNT
+}
+
 
 
 int
@@ -1053,9 +1350,12 @@ main( int     argc,
   test_gap();
   test_limits();
   test_reject_writes_to_sysvars();
+  test_shard();
   performance_test( extra_benchmark );
   performance_test2();
   performance_end_block();
+  performance_shard();
+  performance_many_accounts();
 
   fd_rng_delete( fd_rng_leave( rng ) );
 
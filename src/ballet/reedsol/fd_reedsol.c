@@ -11,28 +11,47 @@ FD_IMPORT_BINARY( fd_reedsol_arith_consts_gfni_mul, "src/ballet/reedsol/constant
 #endif
 
 void
-fd_reedsol_encode_fini( fd_reedsol_t * rs ) {
+fd_reedsol_private_encode( ulong                 shred_sz,
+                           uchar const * const * data_shred,
+                           ulong                 data_shred_cnt,
+                           uchar       * const * parity_shred,
+                           ulong                 parity_shred_cnt,
+                           uchar       *         scratch ) {
 
 # if FD_REEDSOL_ARITH_IMPL==3
-  if( FD_LIKELY( (rs->data_shred_cnt==32UL) & (rs->parity_shred_cnt==32UL ) ) )
-    fd_reedsol_private_encode_32_32( rs->shred_sz, rs->encode.data_shred, rs->encode.parity_shred, rs->scratch );
+  if( FD_LIKELY( (data_shred_cnt==32UL) & (parity_shred_cnt==32UL ) ) )
+    fd_reedsol_private_encode_32_32( shred_sz, data_shred, parity_shred, scratch );
   else
+# else
+  (void)scratch;
 # endif
-  if( FD_UNLIKELY( rs->data_shred_cnt<=16UL ) )
-    fd_reedsol_private_encode_16 ( rs->shred_sz, rs->encode.data_shred, rs->data_shred_cnt, rs->encode.parity_shred, rs->parity_shred_cnt );
-  else if( FD_LIKELY( rs->data_shred_cnt<=32UL ) )
-    fd_reedsol_private_encode_32 ( rs->shred_sz, rs->encode.data_shred, rs->data_shred_cnt, rs->encode.parity_shred, rs->parity_shred_cnt );
-  else if( FD_LIKELY( rs->data_shred_cnt<=64UL ) )
-    fd_reedsol_private_encode_64 ( rs->shred_sz, rs->encode.data_shred, rs->data_shred_cnt, rs->encode.parity_shred, rs->parity_shred_cnt );
+  if( FD_UNLIKELY( data_shred_cnt<=16UL ) )
+    fd_reedsol_private_encode_16 ( shred_sz, data_shred, data_shred_cnt, parity_shred, parity_shred_cnt );
+  else if( FD_LIKELY( data_shred_cnt<=32UL ) )
+    fd_reedsol_private_encode_32 ( shred_sz, data_shred, data_shred_cnt, parity_shred, parity_shred_cnt );
+  else if( FD_LIKELY( data_shred_cnt<=64UL ) )
+    fd_reedsol_private_encode_64 ( shred_sz, data_shred, data_shred_cnt, parity_shred, parity_shred_cnt );
   else
-      fd_reedsol_private_encode_128( rs->shred_sz, rs->encode.data_shred, rs->data_shred_cnt, rs->encode.parity_shred, rs->parity_shred_cnt );
+      fd_reedsol_private_encode_128( shred_sz, data_shred, data_shred_cnt, parity_shred, parity_shred_cnt );
+}
+
+void
+fd_reedsol_encode_fini( fd_reedsol_t * rs ) {
+
+  fd_reedsol_private_encode( rs->shred_sz, rs->encode.data_shred, rs->data_shred_cnt,
+                             rs->encode.parity_shred, rs->parity_shred_cnt, rs->scratch );
 
   rs->data_shred_cnt   = 0UL;
   rs->parity_shred_cnt = 0UL;
 }
 
-int
-fd_reedsol_recover_fini( fd_reedsol_t * rs ) {
+/* recover_fini is fd_reedsol_recover_fini.  direct caches the
+   coefficients of the direct recovery path between calls (see
+   FD_REEDSOL_RECOVER_DIRECT_MAX). */
+
+static int
+recover_fini( fd_reedsol_t *                rs,
+              fd_reedsol_private_direct_t * direct ) {
 
   ulong data_shred_cnt   = rs->data_shred_cnt;
   ulong parity_shred_cnt = rs->parity_shred_cnt;
@@ -51,6 +70,17 @@ fd_reedsol_recover_fini( fd_reedsol_t * rs ) {
   }
   if( FD_UNLIKELY( unerased!=data_shred_cnt ) ) return FD_REEDSOL_ERR_PARTIAL;
 
+  /* Few received parity shreds (which implies few erased data shreds):
+     interpolate the erased data shreds directly and re-encode. */
+
+  ulong rcvd_parity_cnt = 0UL;
+  for( ulong j=data_shred_cnt; j<data_shred_cnt + parity_shred_cnt; j++ ) rcvd_parity_cnt += !rs->recover.erased[ j ];
+  if( FD_LIKELY( rcvd_parity_cnt<=FD_REEDSOL_RECOVER_DIRECT_MAX ) ) {
+    fd_reedsol_private_recover_direct_prep( direct, data_shred_cnt, parity_shred_cnt, rs->recover.erased );
+    return fd_reedsol_private_recover_direct( rs->shred_sz, rs->recover.shred, data_shred_cnt, parity_shred_cnt,
+                                              rs->recover.erased, direct, rs->scratch );
+  }
+
 # if 0 /* TODO: Add first variant for slightly more performance */
   if( FD_LIKELY( i==data_shred_cnt ) ) {
     // Common case: we have all of the data shreds
@@ -76,6 +106,28 @@ fd_reedsol_recover_fini( fd_reedsol_t * rs ) {
   return fd_reedsol_private_recover_var_256( rs->shred_sz, rs->recover.shred, data_shred_cnt, parity_shred_cnt, rs->recover.erased );
 }
 
+int
+fd_reedsol_recover_fini( fd_reedsol_t * rs ) {
+  fd_reedsol_private_direct_t direct[1];
+  direct->data_shred_cnt = 0UL;
+  return recover_fini( rs, direct );
+}
+
+ulong
+fd_reedsol_recover_fini_batch( fd_reedsol_t * const * rs,
+                               ulong                  cnt,
+                               int *                  err ) {
+  fd_reedsol_private_direct_t direct[1];
+  direct->data_shred_cnt = 0UL;
+
+  ulong success_cnt = 0UL;
+  for( ulong i=0UL; i<cnt; i++ ) {
+    err[ i ] = recover_fini( rs[ i ], direct );
+    success_cnt += (ulong)( err[ i ]==FD_REEDSOL_SUCCESS );
+  }
+  return success_cnt;
+}
+
 char const *
 fd_reedsol_strerror( int err ) {
   switch( err ) {
@@ -315,6 +315,24 @@ fd_reedsol_recover_abort( fd_reedsol_t * rs ) {
 int
 fd_reedsol_recover_fini( fd_reedsol_t * rs );
 
+/* fd_reedsol_recover_fini_batch finishes the cnt in-progress recover
+   operations rs[ i ] for i in [0,cnt), e.g. several FEC sets that
+   became recoverable together.  On return, err[ i ] holds what
+   fd_reedsol_recover_fini( rs[ i ] ) would have returned.  Work that
+   only depends on the shred counts and on which shreds were erased is
+   shared between consecutive operations with the same pattern, so
+   grouping operations by pattern makes this cheaper.
+
+   Assumes each rs[ i ] is a distinct fd_reedsol_t initialized as a
+   recoverer and err has room for cnt results.  None of them will be
+   initialized on return.  Returns the number of operations that
+   succeeded. */
+
+ulong
+fd_reedsol_recover_fini_batch( fd_reedsol_t * const * rs,
+                               ulong                  cnt,
+                               int *                  err );
+
 /* Misc APIs */
 
 /* fd_reedsol_strerror converts a FD_REEDSOL_SUCCESS / FD_REEDSOL_ERR_*
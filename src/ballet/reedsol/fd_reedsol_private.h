@@ -47,6 +47,18 @@
 
 FD_PROTOTYPES_BEGIN
 
+/* fd_reedsol_private_encode dispatches to the best encode
+   implementation below for the given shred counts.  scratch must point
+   to the 1024 byte scratch region of a fd_reedsol_t. */
+
+void
+fd_reedsol_private_encode( ulong                 shred_sz,
+                           uchar const * const * data_shred,
+                           ulong                 data_shred_cnt,
+                           uchar       * const * parity_shred,
+                           ulong                 parity_shred_cnt,
+                           uchar       *         scratch );
+
 /* fd_reedsol_private_encode_{n} requires that data_shred_cnt <= n */
 
 void
@@ -155,6 +167,64 @@ fd_reedsol_private_recover_var_256( ulong           shred_sz,
                                     ulong           parity_shred_cnt,
                                     uchar const *   erased );
 
+/* FD_REEDSOL_RECOVER_DIRECT_MAX is the largest number of received
+   parity shreds for which recovery skips the FFT based algorithm.  In
+   that case at most this many data shreds are erased, and each of them
+   is computed directly as a linear combination of the first
+   data_shred_cnt received shreds (Lagrange interpolation at the shred
+   indices).  The erased parity shreds are then re-encoded from the
+   complete data, and the re-encoded values of the received parity
+   shreds are compared with what was received.  This is the common case
+   in the FEC resolver, which recovers as soon as data_shred_cnt shreds
+   of a set have arrived. */
+
+#define FD_REEDSOL_RECOVER_DIRECT_MAX (8UL)
+
+/* fd_reedsol_private_direct_t holds the interpolation coefficients of
+   the direct recovery path for one erasure pattern.  Since they only
+   depend on the shred counts and which shreds were erased, they can be
+   reused across recover operations with the same pattern.  The first
+   three fields are the key; data_shred_cnt==0 marks an empty entry. */
+
+struct fd_reedsol_private_direct {
+  ulong data_shred_cnt;
+  ulong parity_shred_cnt;
+  uchar erased[ FD_REEDSOL_DATA_SHREDS_MAX + FD_REEDSOL_PARITY_SHREDS_MAX ];
+
+  ulong erased_data_cnt;                                                   /* in [0, FD_REEDSOL_RECOVER_DIRECT_MAX] */
+  uchar src [ FD_REEDSOL_DATA_SHREDS_MAX ];                                /* indices of the data_shred_cnt shreds used */
+  uchar dst [ FD_REEDSOL_RECOVER_DIRECT_MAX ];                             /* indices of the erased data shreds */
+  uchar coef[ FD_REEDSOL_RECOVER_DIRECT_MAX ][ FD_REEDSOL_DATA_SHREDS_MAX ]; /* shred[ dst[ i ] ] = sum_j coef[ i ][ j ] shred[ src[ j ] ] */
+};
+
+typedef struct fd_reedsol_private_direct fd_reedsol_private_direct_t;
+
+/* fd_reedsol_private_recover_direct_prep makes direct hold the
+   coefficients for the given erasure pattern, recomputing them only if
+   direct was prepared for a different pattern.  Assumes at least
+   data_shred_cnt shreds and at most FD_REEDSOL_RECOVER_DIRECT_MAX
+   parity shreds are un-erased.  Returns direct. */
+
+fd_reedsol_private_direct_t *
+fd_reedsol_private_recover_direct_prep( fd_reedsol_private_direct_t * direct,
+                                        ulong                         data_shred_cnt,
+                                        ulong                         parity_shred_cnt,
+                                        uchar const *                 erased );
+
+/* fd_reedsol_private_recover_direct recovers the erased shreds using
+   coefficients prepared for this erasure pattern.  Arguments and return
+   values are as in fd_reedsol_private_recover_var_{n} (never
+   FD_REEDSOL_ERR_PARTIAL).  scratch is as in fd_reedsol_private_encode. */
+
+int
+fd_reedsol_private_recover_direct( ulong                               shred_sz,
+                                   uchar * const *                     shred,
+                                   ulong                               data_shred_cnt,
+                                   ulong                               parity_shred_cnt,
+                                   uchar const *                       erased,
+                                   fd_reedsol_private_direct_t const * direct,
+                                   uchar *                             scratch );
+
 /* This below functions generate what:
 
      S. -J. Lin, T. Y. Al-Naffouri, Y. S. Han and W. -H. Chung, "Novel
@@ -0,0 +1,167 @@
+#include "fd_reedsol_private.h"
+
+/* Direct recovery for the common case of few erased data shreds.
+
+   Shred i holds the value at x=i of a polynomial P of degree
+   <data_shred_cnt (see fd_reedsol_pi.c), so given the values at a set
+   S of data_shred_cnt distinct points, Lagrange interpolation gives
+   the value at any other point t as
+
+     P(t) = sum_{a in S} P(a) w_a L(t) / (t+a)
+
+   with L(t) = prod_{b in S} (t+b) and barycentric weights
+   w_a = 1 / prod_{b in S, b!=a} (a+b) (addition is subtraction in
+   GF(2^8)).  The coefficients only depend on the erasure pattern, so
+   they are computed once with scalar log/exp tables and the per-byte
+   work is one GF_MUL_VAR per (erased data shred, source shred) pair.
+   With GFNI, that's a single vgf2p8affineqb.
+
+   The erased parity shreds are then produced by the regular encoder
+   from the completed data.  Since the encoder writes every parity
+   shred, the shreds are processed in stripes of STRIPE_SZ bytes and
+   the received parity shreds are encoded into a small stack buffer,
+   which also lets us compare them against what was received. */
+
+#define STRIPE_SZ (256UL)
+
+/* GF(2^8) with the 0x11D reduction polynomial, primitive element 2.
+   gf_log[ 0 ] is unused. */
+
+static uchar const gf_log[ 256 ] = {
+    0,   0,   1,  25,   2,  50,  26, 198,   3, 223,  51, 238,  27, 104, 199,  75,
+    4, 100, 224,  14,  52, 141, 239, 129,  28, 193, 105, 248, 200,   8,  76, 113,
+    5, 138, 101,  47, 225,  36,  15,  33,  53, 147, 142, 218, 240,  18, 130,  69,
+   29, 181, 194, 125, 106,  39, 249, 185, 201, 154,   9, 120,  77, 228, 114, 166,
+    6, 191, 139,  98, 102, 221,  48, 253, 226, 152,  37, 179,  16, 145,  34, 136,
+   54, 208, 148, 206, 143, 150, 219, 189, 241, 210,  19,  92, 131,  56,  70,  64,
+   30,  66, 182, 163, 195,  72, 126, 110, 107,  58,  40,  84, 250, 133, 186,  61,
+  202,  94, 155, 159,  10,  21, 121,  43,  78, 212, 229, 172, 115, 243, 167,  87,
+    7, 112, 192, 247, 140, 128,  99,  13, 103,  74, 222, 237,  49, 197, 254,  24,
+  227, 165, 153, 119,  38, 184, 180, 124,  17,  68, 146, 217,  35,  32, 137,  46,
+   55,  63, 209,  91, 149, 188, 207, 205, 144, 135, 151, 178, 220, 252, 190,  97,
+  242,  86, 211, 171,  20,  42,  93, 158, 132,  60,  57,  83,  71, 109,  65, 162,
+   31,  45,  67, 216, 183, 123, 164, 118, 196,  23,  73, 236, 127,  12, 111, 246,
+  108, 161,  59,  82,  41, 157,  85, 170, 251,  96, 134, 177, 187, 204,  62,  90,
+  203,  89,  95, 176, 156, 169, 160,  81,  11, 245,  22, 235, 122, 117,  44, 215,
+   79, 174, 213, 233, 230, 231, 173, 232, 116, 214, 244, 234, 168,  80,  88, 175
+};
+
+static uchar const gf_exp[ 255 ] = {
+    1,   2,   4,   8,  16,  32,  64, 128,  29,  58, 116, 232, 205, 135,  19,  38,
+   76, 152,  45,  90, 180, 117, 234, 201, 143,   3,   6,  12,  24,  48,  96, 192,
+  157,  39,  78, 156,  37,  74, 148,  53, 106, 212, 181, 119, 238, 193, 159,  35,
+   70, 140,   5,  10,  20,  40,  80, 160,  93, 186, 105, 210, 185, 111, 222, 161,
+   95, 190,  97, 194, 153,  47,  94, 188, 101, 202, 137,  15,  30,  60, 120, 240,
+  253, 231, 211, 187, 107, 214, 177, 127, 254, 225, 223, 163,  91, 182, 113, 226,
+  217, 175,  67, 134,  17,  34,  68, 136,  13,  26,  52, 104, 208, 189, 103, 206,
+  129,  31,  62, 124, 248, 237, 199, 147,  59, 118, 236, 197, 151,  51, 102, 204,
+  133,  23,  46,  92, 184, 109, 218, 169,  79, 158,  33,  66, 132,  21,  42,  84,
+  168,  77, 154,  41,  82, 164,  85, 170,  73, 146,  57, 114, 228, 213, 183, 115,
+  230, 209, 191,  99, 198, 145,  63, 126, 252, 229, 215, 179, 123, 246, 241, 255,
+  227, 219, 171,  75, 150,  49,  98, 196, 149,  55, 110, 220, 165,  87, 174,  65,
+  130,  25,  50, 100, 200, 141,   7,  14,  28,  56, 112, 224, 221, 167,  83, 166,
+   81, 162,  89, 178, 121, 242, 249, 239, 195, 155,  43,  86, 172,  69, 138,   9,
+   18,  36,  72, 144,  61, 122, 244, 245, 247, 243, 251, 235, 203, 139,  11,  22,
+   44,  88, 176, 125, 250, 233, 207, 131,  27,  54, 108, 216, 173,  71, 142
+};
+
+fd_reedsol_private_direct_t *
+fd_reedsol_private_recover_direct_prep( fd_reedsol_private_direct_t * direct,
+                                        ulong                         data_shred_cnt,
+                                        ulong                         parity_shred_cnt,
+                                        uchar const *                 erased ) {
+  ulong shred_cnt = data_shred_cnt + parity_shred_cnt;
+
+  if( FD_LIKELY( (direct->data_shred_cnt==data_shred_cnt) & (direct->parity_shred_cnt==parity_shred_cnt) &&
+                 fd_memeq( direct->erased, erased, shred_cnt ) ) ) return direct;
+
+  direct->data_shred_cnt   = data_shred_cnt;
+  direct->parity_shred_cnt = parity_shred_cnt;
+  fd_memcpy( direct->erased, erased, shred_cnt );
+
+  /* Interpolate from the first data_shred_cnt un-erased shreds, like
+     the FFT path does */
+
+  uchar * src = direct->src;
+  uchar * dst = direct->dst;
+  ulong src_cnt = 0UL;
+  ulong dst_cnt = 0UL;
+  for( ulong i=0UL; (i<shred_cnt) & (src_cnt<data_shred_cnt); i++ ) if( !erased[ i ] ) src[ src_cnt++ ] = (uchar)i;
+  for( ulong i=0UL; i<data_shred_cnt;                          i++ ) if(  erased[ i ] ) dst[ dst_cnt++ ] = (uchar)i;
+  direct->erased_data_cnt = dst_cnt;
+
+  /* log w_a, as a value in [0,255) */
+
+  ulong log_w[ FD_REEDSOL_DATA_SHREDS_MAX ];
+  for( ulong a=0UL; a<src_cnt; a++ ) {
+    ulong log_prod = 0UL;
+    for( ulong b=0UL; b<src_cnt; b++ ) if( a!=b ) log_prod += gf_log[ src[ a ]^src[ b ] ];
+    log_w[ a ] = (255UL - log_prod%255UL) % 255UL;
+  }
+
+  for( ulong t=0UL; t<dst_cnt; t++ ) {
+    ulong log_l = 0UL;
+    for( ulong b=0UL; b<src_cnt; b++ ) log_l += gf_log[ dst[ t ]^src[ b ] ];
+    log_l %= 255UL;
+    for( ulong a=0UL; a<src_cnt; a++ )
+      direct->coef[ t ][ a ] = gf_exp[ (log_l + log_w[ a ] + 255UL - gf_log[ dst[ t ]^src[ a ] ]) % 255UL ];
+  }
+
+  return direct;
+}
+
+int
+fd_reedsol_private_recover_direct( ulong                               shred_sz,
+                                   uchar * const *                     shred,
+                                   ulong                               data_shred_cnt,
+                                   ulong                               parity_shred_cnt,
+                                   uchar const *                       erased,
+                                   fd_reedsol_private_direct_t const * direct,
+                                   uchar *                             scratch ) {
+  uchar         junk[ FD_REEDSOL_RECOVER_DIRECT_MAX ][ STRIPE_SZ ];
+  uchar const * stripe_data  [ FD_REEDSOL_DATA_SHREDS_MAX   ];
+  uchar *       stripe_parity[ FD_REEDSOL_PARITY_SHREDS_MAX ];
+
+  uchar const * src     = direct->src;
+  uchar const * dst     = direct->dst;
+  ulong         dst_cnt = direct->erased_data_cnt;
+
+  for( ulong stripe_pos=0UL; stripe_pos<shred_sz; stripe_pos+=STRIPE_SZ ) {
+    /* shred_sz>=32, so a short last stripe can be moved back to overlap
+       the previous one instead */
+    ulong pos = stripe_pos;
+    ulong sz  = fd_ulong_min( STRIPE_SZ, shred_sz-pos );
+    if( FD_UNLIKELY( sz<32UL ) ) { pos = shred_sz-32UL; sz = 32UL; }
+
+    /* Interpolate the erased data shreds */
+
+    for( ulong off=0UL; off<sz; /* advanced manually at end of loop */ ) {
+      gf_t acc[ FD_REEDSOL_RECOVER_DIRECT_MAX ];
+      for( ulong t=0UL; t<dst_cnt; t++ ) acc[ t ] = gf_zero();
+      for( ulong a=0UL; a<data_shred_cnt; a++ ) {
+        gf_t in = gf_ldu( shred[ src[ a ] ] + pos + off );
+        for( ulong t=0UL; t<dst_cnt; t++ ) acc[ t ] = GF_ADD( acc[ t ], GF_MUL_VAR( in, direct->coef[ t ][ a ] ) );
+      }
+      for( ulong t=0UL; t<dst_cnt; t++ ) gf_stu( shred[ dst[ t ] ] + pos + off, acc[ t ] );
+      off += GF_WIDTH;
+      off = fd_ulong_if( ((sz-GF_WIDTH)<off) & (off<sz), sz-GF_WIDTH, off );
+    }
+
+    /* Re-encode the parity shreds */
+
+    ulong junk_cnt = 0UL;
+    for( ulong i=0UL; i<data_shred_cnt;   i++ ) stripe_data  [ i ] = shred[ i ] + pos;
+    for( ulong i=0UL; i<parity_shred_cnt; i++ ) {
+      ulong idx = data_shred_cnt + i;
+      stripe_parity[ i ] = erased[ idx ] ? shred[ idx ] + pos : junk[ junk_cnt++ ];
+    }
+    fd_reedsol_private_encode( sz, stripe_data, data_shred_cnt, stripe_parity, parity_shred_cnt, scratch );
+
+    for( ulong i=0UL; i<parity_shred_cnt; i++ ) {
+      ulong idx = data_shred_cnt + i;
+      if( erased[ idx ] ) continue;
+      if( FD_UNLIKELY( !fd_memeq( stripe_parity[ i ], shred[ idx ] + pos, sz ) ) ) return FD_REEDSOL_ERR_CORRUPT;
+    }
+  }
+  return FD_REEDSOL_SUCCESS;
+}
@@ -985,6 +985,208 @@ test_recover_performance( fd_rng_t *    rng ) {
         ));
 }
 
+/* test_recover_direct covers the patterns that take the direct
+   recovery path: at most FD_REEDSOL_RECOVER_DIRECT_MAX parity shreds
+   received, and either exactly data_shred_cnt shreds received (what the
+   FEC resolver does) or a few more, which must also be checked for
+   consistency. */
+
+static void
+test_recover_direct( fd_rng_t * rng ) {
+  uchar * d[ FD_REEDSOL_DATA_SHREDS_MAX   ];
+  uchar * p[ FD_REEDSOL_PARITY_SHREDS_MAX ];
+  uchar * r[ FD_REEDSOL_PARITY_SHREDS_MAX ];
+  for( ulong i=0UL; i<FD_REEDSOL_DATA_SHREDS_MAX;   i++ )  d[ i ] = data_shreds + SHRED_SZ*i;
+  for( ulong i=0UL; i<FD_REEDSOL_PARITY_SHREDS_MAX; i++ )  p[ i ] = parity_shreds + SHRED_SZ*i;
+  for( ulong i=0UL; i<FD_REEDSOL_PARITY_SHREDS_MAX; i++ )  r[ i ] = recovered_shreds + SHRED_SZ*i;
+
+  for( ulong i=0UL; i<FD_REEDSOL_DATA_SHREDS_MAX; i++ ) for( ulong j=0UL; j<SHRED_SZ; j++ ) d[ i ][ j ] = fd_rng_uchar( rng );
+
+  for( ulong iter=0UL; iter<20000UL; iter++ ) {
+    ulong d_cnt    = 1UL + fd_rng_ulong_roll( rng, FD_REEDSOL_DATA_SHREDS_MAX );
+    ulong p_cnt    = 1UL + fd_rng_ulong_roll( rng, FD_REEDSOL_PARITY_SHREDS_MAX );
+    ulong shred_sz = 32UL + fd_rng_ulong_roll( rng, SHRED_SZ-31UL );
+
+    /* Receive p_rcvd parity shreds, then erase e_cnt data shreds with
+       e_cnt<=p_rcvd so that at least d_cnt shreds are received */
+    ulong p_rcvd = fd_rng_ulong_roll( rng, fd_ulong_min( p_cnt, FD_REEDSOL_RECOVER_DIRECT_MAX )+1UL );
+    ulong e_cnt  = fd_ulong_min( d_cnt, p_rcvd - fd_rng_ulong_roll( rng, fd_ulong_min( p_rcvd, 2UL )+1UL ) );
+
+    fd_reedsol_t * rs = fd_reedsol_encode_init( mem, shred_sz );
+    for( ulong i=0UL; i<d_cnt; i++ ) fd_reedsol_encode_add_data_shred(   rs, d[ i ] );
+    for( ulong i=0UL; i<p_cnt; i++ ) fd_reedsol_encode_add_parity_shred( rs, p[ i ] );
+    fd_reedsol_encode_fini( rs );
+
+    uchar * erased_truth[ FD_REEDSOL_DATA_SHREDS_MAX + FD_REEDSOL_PARITY_SHREDS_MAX ];
+    uchar * erased_dst  [ FD_REEDSOL_DATA_SHREDS_MAX + FD_REEDSOL_PARITY_SHREDS_MAX ];
+    uchar * rcvd        [ FD_REEDSOL_DATA_SHREDS_MAX + FD_REEDSOL_PARITY_SHREDS_MAX ];
+    ulong erased_cnt = 0UL;
+    ulong rcvd_cnt   = 0UL;
+    ulong e_left     = e_cnt;
+    ulong p_left     = p_rcvd;
+    rs = fd_reedsol_recover_init( mem, shred_sz );
+    for( ulong i=0UL; i<d_cnt; i++ ) {
+      if( fd_rng_ulong_roll( rng, d_cnt-i ) < e_left ) {
+        e_left--;
+        erased_truth[ erased_cnt ] = d[ i ];
+        erased_dst  [ erased_cnt ] = r[ erased_cnt ];
+        fd_reedsol_recover_add_erased_shred( rs, 1, r[ erased_cnt++ ] );
+      } else {
+        rcvd[ rcvd_cnt++ ] = d[ i ];
+        fd_reedsol_recover_add_rcvd_shred( rs, 1, d[ i ] );
+      }
+    }
+    for( ulong i=0UL; i<p_cnt; i++ ) {
+      if( fd_rng_ulong_roll( rng, p_cnt-i ) < p_left ) {
+        p_left--;
+        rcvd[ rcvd_cnt++ ] = p[ i ];
+        fd_reedsol_recover_add_rcvd_shred( rs, 0, p[ i ] );
+      } else {
+        erased_truth[ erased_cnt ] = p[ i ];
+        erased_dst  [ erased_cnt ] = r[ erased_cnt ];
+        fd_reedsol_recover_add_erased_shred( rs, 0, r[ erased_cnt++ ] );
+      }
+    }
+    FD_TEST( rcvd_cnt>=d_cnt );
+
+    FD_TEST( FD_REEDSOL_SUCCESS==fd_reedsol_recover_fini( rs ) );
+    for( ulong i=0UL; i<erased_cnt; i++ ) FD_TEST( fd_memeq( erased_truth[ i ], erased_dst[ i ], shred_sz ) );
+
+    /* With redundant shreds, corrupting any received shred is caught */
+    if( rcvd_cnt>d_cnt ) {
+      uchar * bad      = rcvd[ fd_rng_ulong_roll( rng, rcvd_cnt ) ];
+      ulong   byte_idx = fd_rng_ulong_roll( rng, shred_sz );
+      bad[ byte_idx ] ^= (uchar)1;
+
+      rs = fd_reedsol_recover_init( mem, shred_sz );
+      ulong j = 0UL;
+      for( ulong i=0UL; i<d_cnt+p_cnt; i++ ) {
+        uchar * shred = i<d_cnt ? d[ i ] : p[ i-d_cnt ];
+        if( j<erased_cnt && erased_truth[ j ]==shred ) fd_reedsol_recover_add_erased_shred( rs, i<d_cnt, erased_dst[ j++ ] );
+        else                                           fd_reedsol_recover_add_rcvd_shred  ( rs, i<d_cnt, shred            );
+      }
+      FD_TEST( FD_REEDSOL_ERR_CORRUPT==fd_reedsol_recover_fini( rs ) );
+
+      bad[ byte_idx ] ^= (uchar)1;
+    }
+  }
+  FD_LOG_NOTICE(( "recover direct: ok" ));
+}
+
+#define BATCH_MAX (16UL)
+uchar batch_mem[ BATCH_MAX ][ FD_REEDSOL_FOOTPRINT ] __attribute__((aligned(FD_REEDSOL_ALIGN)));
+uchar batch_shreds   [ BATCH_MAX ][ 64UL ][ SHRED_SZ ];
+uchar batch_recovered[ BATCH_MAX ][ 64UL ][ SHRED_SZ ];
+
+/* batch_prep sets up batch_mem[ b ] to recover 32:32 set b with the
+   shreds in the erased bit mask (bit i is shred i, data shreds
+   first) erased. */
+
+static fd_reedsol_t *
+batch_prep( ulong b,
+            ulong erased ) {
+  fd_reedsol_t * rs = fd_reedsol_recover_init( batch_mem[ b ], SHRED_SZ );
+  for( ulong i=0UL; i<64UL; i++ ) {
+    if( erased & (1UL<<i) ) fd_reedsol_recover_add_erased_shred( rs, i<32UL, batch_recovered[ b ][ i ] );
+    else                    fd_reedsol_recover_add_rcvd_shred  ( rs, i<32UL, batch_shreds   [ b ][ i ] );
+  }
+  return rs;
+}
+
+/* erased_mask returns the erasure mask of a 32:32 set where e_cnt data
+   shreds are lost and exactly 32 shreds are received */
+
+static ulong
+erased_mask( fd_rng_t * rng,
+             ulong      e_cnt ) {
+  ulong erased = 0UL;
+  while( (ulong)fd_ulong_popcnt( erased )<e_cnt ) erased |= 1UL<<fd_rng_ulong_roll( rng, 32UL );
+  return erased | fd_ulong_if( e_cnt<32UL, ULONG_MAX<<(32UL+e_cnt), 0UL );
+}
+
+static void
+test_recover_batch( fd_rng_t * rng ) {
+  for( ulong b=0UL; b<BATCH_MAX; b++ ) {
+    for( ulong i=0UL; i<32UL; i++ ) for( ulong j=0UL; j<SHRED_SZ; j++ ) batch_shreds[ b ][ i ][ j ] = fd_rng_uchar( rng );
+    fd_reedsol_t * rs = fd_reedsol_encode_init( batch_mem[ b ], SHRED_SZ );
+    for( ulong i=0UL; i<32UL; i++ ) fd_reedsol_encode_add_data_shred(   rs, batch_shreds[ b ][ i      ] );
+    for( ulong i=0UL; i<32UL; i++ ) fd_reedsol_encode_add_parity_shred( rs, batch_shreds[ b ][ 32UL+i ] );
+    fd_reedsol_encode_fini( rs );
+  }
+
+  for( ulong iter=0UL; iter<1000UL; iter++ ) {
+    fd_reedsol_t * rs    [ BATCH_MAX ];
+    int            err   [ BATCH_MAX ];
+    ulong          erased[ BATCH_MAX ];
+    ulong cnt     = 1UL + fd_rng_ulong_roll( rng, BATCH_MAX );
+    ulong corrupt = fd_rng_ulong_roll( rng, 2UL*BATCH_MAX ); /* Corrupt a set about half of the time */
+    for( ulong b=0UL; b<cnt; b++ ) {
+      /* Mostly reuse the previous erasure pattern, sometimes one that
+         needs the FFT path */
+      if( !b || !fd_rng_uint_roll( rng, 4U ) ) erased[ b ] = erased_mask( rng, fd_rng_ulong_roll( rng, 2UL*FD_REEDSOL_RECOVER_DIRECT_MAX ) );
+      else                                     erased[ b ] = erased[ b-1UL ];
+      if( b==corrupt ) erased[ b ] = 0UL;
+      rs[ b ] = batch_prep( b, erased[ b ] );
+    }
+    if( corrupt<cnt ) batch_shreds[ corrupt ][ 0 ][ 0 ] ^= (uchar)1;
+
+    FD_TEST( fd_reedsol_recover_fini_batch( rs, cnt, err )==cnt-(ulong)(corrupt<cnt) );
+
+    for( ulong b=0UL; b<cnt; b++ ) {
+      if( b==corrupt ) { FD_TEST( err[ b ]==FD_REEDSOL_ERR_CORRUPT ); continue; }
+      FD_TEST( err[ b ]==FD_REEDSOL_SUCCESS );
+      for( ulong i=0UL; i<64UL; i++ )
+        if( erased[ b ] & (1UL<<i) ) FD_TEST( fd_memeq( batch_recovered[ b ][ i ], batch_shreds[ b ][ i ], SHRED_SZ ) );
+    }
+    if( corrupt<cnt ) batch_shreds[ corrupt ][ 0 ][ 0 ] ^= (uchar)1;
+  }
+  FD_LOG_NOTICE(( "recover batch: ok" ));
+}
+
+/* test_recover_erasure_performance measures recovering a 32:32 set from
+   exactly 32 shreds (as the FEC resolver does) by number of erased data
+   shreds, through fd_reedsol_recover_fini (which picks the direct path
+   when it can), through the FFT path alone, and in batches of
+   BATCH_MAX sets with the same erasure pattern. */
+
+static void
+test_recover_erasure_performance( fd_rng_t * rng ) {
+  ulong const test_count = 20000UL;
+  ulong const e_cnts[] = { 0UL, 1UL, 2UL, 3UL, 4UL, 6UL, 8UL, 12UL, 16UL, 32UL };
+
+  for( ulong k=0UL; k<sizeof(e_cnts)/sizeof(ulong); k++ ) {
+    ulong e_cnt  = e_cnts[ k ];
+    ulong erased = erased_mask( rng, e_cnt );
+
+    long dt = -fd_log_wallclock();
+    for( ulong rem=test_count; rem; rem-- ) FD_TEST( FD_REEDSOL_SUCCESS==fd_reedsol_recover_fini( batch_prep( 0UL, erased ) ) );
+    dt += fd_log_wallclock();
+
+    long dt_fft = -fd_log_wallclock();
+    for( ulong rem=test_count; rem; rem-- ) {
+      fd_reedsol_t * rs = batch_prep( 0UL, erased );
+      FD_TEST( FD_REEDSOL_SUCCESS==fd_reedsol_private_recover_var_64( SHRED_SZ, rs->recover.shred, 32UL, 32UL, rs->recover.erased ) );
+    }
+    dt_fft += fd_log_wallclock();
+
+    fd_reedsol_t * rs [ BATCH_MAX ];
+    int            err[ BATCH_MAX ];
+    long dt_batch = -fd_log_wallclock();
+    for( ulong rem=test_count/BATCH_MAX; rem; rem-- ) {
+      for( ulong b=0UL; b<BATCH_MAX; b++ ) rs[ b ] = batch_prep( b, erased );
+      FD_TEST( fd_reedsol_recover_fini_batch( rs, BATCH_MAX, err )==BATCH_MAX );
+    }
+    dt_batch += fd_log_wallclock();
+
+    FD_LOG_NOTICE(( "recover 32:32 from 32 shreds, %2lu data erased: %8.1f ns (fft %8.1f ns, batched %8.1f ns) %6.1f Gbps",
+                    e_cnt,
+                    (double)dt      /(double)test_count,
+                    (double)dt_fft  /(double)test_count,
+                    (double)dt_batch/(double)(BATCH_MAX*(test_count/BATCH_MAX)),
+                    (double)(test_count * 32UL * SHRED_SZ * 8UL) / (double)dt ));
+  }
+}
+
 int
 main( int     argc,
       char ** argv ) {
@@ -1000,6 +1202,9 @@ main( int     argc,
   test_encode_vs_ref( rng );
   test_recover( rng );
   test_recover_performance( rng );
+  test_recover_direct( rng );
+  test_recover_batch( rng );
+  test_recover_erasure_performance( rng );
   test_pi_all( rng );
   test_linearity_all( rng );
   test_fft_all();
@@ -85,12 +85,50 @@ query_pubkey_stake( fd_pubkey_t const * pubkey, fd_vote_accounts_t * vote_accoun
   return vote_node ? vote_node->elem.stake : 0;
 }
 
+/* Replay votes are upserted into ghost in batches of up to REPLAY_VOTE_BATCH_MAX, so the stake is
+   propagated up the ancestry once per batch rather than once per vote. */
+
+#define REPLAY_VOTE_BATCH_MAX 512UL
+
+/* replay_votes_flush upserts the batch of replay votes into ghost, then checks each voted slot's
+   stake pct in ghost, and marks stake thresholds accordingly if reached. */
+
+static void
+replay_votes_flush( fd_bft_t * bft, fd_ghost_vote_t const * batch, ulong batch_cnt ) {
+  fd_ghost_replay_votes( bft->ghost, batch, batch_cnt );
+
+  for( ulong i = 0; i < batch_cnt; i++ ) {
+    fd_ghost_node_t * ghost_node = fd_ghost_node_query( bft->ghost, &batch[i].slot_hash );
+
+    double pct = (double)ghost_node->stake / (double)bft->epoch_stake;
+
+    if( FD_UNLIKELY( !ghost_node->eqv_safe && pct > FD_BFT_EQV_SAFE ) ) {
+      ghost_node->eqv_safe = 1;
+#if FD_BFT_USE_HANDHOLDING
+      // FD_LOG_NOTICE(
+      //     ( "[bft] eqv safe (%lf): (%lu, %32J)", pct, batch[i].slot_hash.slot, batch[i].slot_hash.hash.hash ) );
+#endif
+    }
+
+    if( FD_UNLIKELY( !ghost_node->opt_conf && pct > FD_BFT_OPT_CONF ) ) {
+      ghost_node->opt_conf = 1;
+#if FD_BFT_USE_HANDHOLDING
+      // FD_LOG_NOTICE(
+      //     ( "[bft] opt conf (%lf): (%lu, %32J)", pct, batch[i].slot_hash.slot, batch[i].slot_hash.hash.hash ) );
+#endif
+    }
+  }
+}
+
 static void
 count_replay_votes( fd_bft_t * bft, fd_fork_t * fork ) {
   FD_PARAM_UNUSED long now = fd_log_wallclock();
 
   fd_latest_vote_t * latest_votes = fork->slot_ctx.latest_votes;
 
+  fd_ghost_vote_t batch[REPLAY_VOTE_BATCH_MAX];
+  ulong           batch_cnt = 0;
+
   // fd_root_vote_t * root_votes = bft->root_votes;
 
   ulong smr = bft->smr;
@@ -133,10 +171,11 @@ count_replay_votes( fd_bft_t * bft, fd_fork_t * fork ) {
 
     /* Look up the ghost node. */
 
-    fd_slot_hash_t    slot_hash  = { .slot = vote_slot, .hash = *bank_hash };
-    fd_ghost_node_t * ghost_node = fd_ghost_node_query( bft->ghost, &slot_hash );
+    fd_slot_hash_t slot_hash = { .slot = vote_slot, .hash = *bank_hash };
 
 #if FD_BFT_USE_HANDHOLDING
+    fd_ghost_node_t * ghost_node = fd_ghost_node_query( bft->ghost, &slot_hash );
+
     /* This indicates a programming error, because the slot hash must have been inserted if we are
      * processesing replay votes. */
     if( FD_UNLIKELY( !ghost_node ) ) {
@@ -144,28 +183,12 @@ count_replay_votes( fd_bft_t * bft, fd_fork_t * fork ) {
     };
 #endif
 
-    /* Upsert the vote into ghost. */
-
-    fd_ghost_replay_vote( bft->ghost, &slot_hash, node_pubkey, stake );
-
-    /* Check this slot's stake pct in ghost, and mark stake threshold accordingly if reached. */
-
-    double pct = (double)ghost_node->stake / (double)bft->epoch_stake;
-
-    if( FD_UNLIKELY( !ghost_node->eqv_safe && pct > FD_BFT_EQV_SAFE ) ) {
-      ghost_node->eqv_safe = 1;
-#if FD_BFT_USE_HANDHOLDING
-      // FD_LOG_NOTICE(
-      //     ( "[bft] eqv safe (%lf): (%lu, %32J)", pct, slot_hash.slot, slot_hash.hash.hash ) );
-#endif
-    }
+    /* Queue the vote for upserting into ghost. */
 
-    if( FD_UNLIKELY( !ghost_node->opt_conf && pct > FD_BFT_OPT_CONF ) ) {
-      ghost_node->opt_conf = 1;
-#if FD_BFT_USE_HANDHOLDING
-      // FD_LOG_NOTICE(
-      //     ( "[bft] opt conf (%lf): (%lu, %32J)", pct, slot_hash.slot, slot_hash.hash.hash ) );
-#endif
+    batch[batch_cnt++] = ( fd_ghost_vote_t ){ .pubkey = *node_pubkey, .slot_hash = slot_hash, .stake = stake };
+    if( FD_UNLIKELY( batch_cnt == REPLAY_VOTE_BATCH_MAX ) ) {
+      replay_votes_flush( bft, batch, batch_cnt );
+      batch_cnt = 0;
     }
 
     /* Only process vote slots higher than our SMR. */
@@ -204,6 +227,8 @@ count_replay_votes( fd_bft_t * bft, fd_fork_t * fork ) {
     // }
   }
 
+  replay_votes_flush( bft, batch, batch_cnt );
+
   if( FD_LIKELY( smr > bft->smr ) ) { bft->smr = smr; }
 }
 
@@ -303,15 +328,7 @@ fd_bft_fork_update( fd_bft_t * bft, fd_fork_t * fork ) {
 fd_fork_t *
 fd_bft_fork_choice( fd_bft_t * bft ) {
   // long now = fd_log_wallclock();
-  fd_ghost_node_t * head = bft->ghost->root;
-  while( head->child ) {
-    fd_ghost_node_t * curr = head;
-    while( curr ) {
-      head = FD_GHOST_NODE_MAX( curr, head );
-      curr = curr->sibling;
-    }
-    head = head->child;
-  }
+  fd_ghost_node_t * head = fd_ghost_head( bft->ghost );
 
   /* search for the fork head in the frontier. */
 
@@ -128,6 +128,22 @@ fd_ghost_delete( void * ghost ) {
   return ghost;
 }
 
+/* fd_ghost_private_head_update recomputes node's head from its children, assuming the children's
+   weights and heads are current. */
+
+static inline void
+fd_ghost_private_head_update( fd_ghost_node_t * node ) {
+  fd_ghost_node_t * best = node->child;
+  if( FD_LIKELY( !best ) ) {
+    node->head = node;
+    return;
+  }
+  for( fd_ghost_node_t * curr = best->sibling; curr; curr = curr->sibling ) {
+    best = FD_GHOST_NODE_MAX( curr, best );
+  }
+  node->head = best->head;
+}
+
 /* If there is a new head, update the ancestry. */
 
 void
@@ -161,6 +177,10 @@ fd_ghost_node_insert( fd_ghost_t *           ghost,
   node->slot_hash        = *slot_hash;
   node->stake            = 0;
   node->weight           = 0;
+  node->head             = node;
+  node->delta            = 0;
+  node->pending_cnt      = 0;
+  node->pending          = 0;
 
   /* map insertion */
 
@@ -168,6 +188,7 @@ fd_ghost_node_insert( fd_ghost_t *           ghost,
 
   /* tree insertion */
 
+  node->parent  = NULL;
   node->child   = NULL;
   node->sibling = NULL;
 
@@ -194,6 +215,16 @@ fd_ghost_node_insert( fd_ghost_t *           ghost,
     }
     curr->sibling = node;
   }
+
+  /* Update the heads of the ancestry. The new leaf has no weight, but it can still become a head
+     (eg. parent was a leaf, or by slot tie-break). Stop at the first ancestor whose head is
+     unchanged, as the heads above it are then unchanged too. */
+
+  for( fd_ghost_node_t * ancestor = parent; ancestor; ancestor = ancestor->parent ) {
+    fd_ghost_node_t * prev_head = ancestor->head;
+    fd_ghost_private_head_update( ancestor );
+    if( FD_LIKELY( ancestor->head == prev_head ) ) break;
+  }
 }
 
 fd_ghost_node_t *
@@ -201,11 +232,62 @@ fd_ghost_node_query( fd_ghost_t * ghost, fd_slot_hash_t const * slot_hash ) {
   return fd_ghost_node_map_ele_query( ghost->node_map, slot_hash, NULL, ghost->node_pool );
 }
 
-void
-fd_ghost_replay_vote( fd_ghost_t *           ghost,
-                      fd_slot_hash_t const * slot_hash,
-                      fd_pubkey_t const *    pubkey,
-                      ulong                  stake ) {
+/* fd_ghost_private_pending_add adds delta to node's pending weight change and marks node and its
+   ancestors as pending (if not already). Each newly marked node is pushed onto the deque and
+   counted in its parent's pending_cnt, so the pending nodes always form an ancestor-closed set. */
+
+static inline void
+fd_ghost_private_pending_add( fd_ghost_t * ghost, fd_ghost_node_t * node, ulong delta ) {
+  node->delta += delta;
+  while( !node->pending ) {
+    node->pending = 1;
+    fd_ghost_prune_deque_push_tail( ghost->prune_deque, node );
+    node = node->parent;
+    if( FD_UNLIKELY( !node ) ) break;
+    node->pending_cnt++;
+  }
+}
+
+/* fd_ghost_private_pending_propagate applies the pending weight changes bottom-up. A pending node
+   is processed once all its pending children have been (pending_cnt==0), at which point its
+   delta includes its subtree's, and its head can be recomputed from its children. */
+
+static void
+fd_ghost_private_pending_propagate( fd_ghost_t * ghost ) {
+  fd_ghost_node_t ** q = ghost->prune_deque;
+  while( !fd_ghost_prune_deque_empty( q ) ) {
+    fd_ghost_node_t * node = fd_ghost_prune_deque_pop_head( q );
+
+    /* Skip nodes that were already processed, or that will be once their last pending child is. */
+
+    if( !node->pending || node->pending_cnt ) continue;
+
+    for( ;; ) {
+      node->weight += node->delta;
+      node->pending = 0;
+      fd_ghost_private_head_update( node );
+
+      fd_ghost_node_t * parent = node->parent;
+      if( FD_UNLIKELY( !parent ) ) {
+        node->delta = 0;
+        break;
+      }
+      parent->delta += node->delta;
+      node->delta    = 0;
+      if( --parent->pending_cnt ) break;
+      node = parent;
+    }
+  }
+}
+
+/* fd_ghost_private_vote_upsert updates pubkey's latest vote and the stake of the previously voted
+   and newly voted nodes, deferring the weight changes to fd_ghost_private_pending_propagate. */
+
+static void
+fd_ghost_private_vote_upsert( fd_ghost_t *           ghost,
+                              fd_slot_hash_t const * slot_hash,
+                              fd_pubkey_t const *    pubkey,
+                              ulong                  stake ) {
   fd_ghost_node_t * node =
       fd_ghost_node_map_ele_query( ghost->node_map, slot_hash, NULL, ghost->node_pool );
 
@@ -244,14 +326,10 @@ fd_ghost_replay_vote( fd_ghost_t *           ghost,
 
     } else {
 
-      /* Subtract pubkey's stake from the prev voted slot hash and propagate. */
+      /* Subtract pubkey's stake from the prev voted slot hash and its ancestry. */
 
       node->stake -= vote->stake;
-      fd_ghost_node_t * ancestor = node;
-      while( ancestor->parent ) {
-        ancestor->weight -= stake;
-        ancestor = ancestor->parent;
-      }
+      fd_ghost_private_pending_add( ghost, node, -vote->stake );
     }
 
   } else {
@@ -274,14 +352,29 @@ fd_ghost_replay_vote( fd_ghost_t *           ghost,
   vote->slot_hash = *slot_hash;
   vote->stake     = stake;
 
-  /* Propagate the vote stake up the ancestry, including updating the head. */
+  /* Add the vote stake to the slot hash and its ancestry. */
 
   node->stake += stake;
-  fd_ghost_node_t * ancestor = node;
-  while( ancestor->parent ) {
-    ancestor->weight += stake;
-    ancestor = ancestor->parent;
+  fd_ghost_private_pending_add( ghost, node, stake );
+}
+
+void
+fd_ghost_replay_vote( fd_ghost_t *           ghost,
+                      fd_slot_hash_t const * slot_hash,
+                      fd_pubkey_t const *    pubkey,
+                      ulong                  stake ) {
+  fd_ghost_private_vote_upsert( ghost, slot_hash, pubkey, stake );
+  fd_ghost_private_pending_propagate( ghost );
+}
+
+void
+fd_ghost_replay_votes( fd_ghost_t *            ghost,
+                       fd_ghost_vote_t const * votes,
+                       ulong                   cnt ) {
+  for( ulong i = 0; i < cnt; i++ ) {
+    fd_ghost_private_vote_upsert( ghost, &votes[i].slot_hash, &votes[i].pubkey, votes[i].stake );
   }
+  fd_ghost_private_pending_propagate( ghost );
 }
 
 void
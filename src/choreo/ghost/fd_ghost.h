@@ -18,6 +18,12 @@
    hash, which is the slot hash of the validator's vote, and also contains the validator's pubkey
    and stake.
 
+   Each node also caches the head of its subtree (head), ie. the leaf reached by greedily picking
+   the heaviest child starting at that node. Fork choice is then just ghost->root->head. Weights
+   and heads are maintained incrementally: a batch of replay votes accumulates per-node weight
+   deltas and propagates them bottom-up once, visiting each ancestor on the union of the voted
+   nodes' ancestry paths exactly once regardless of the number of votes in the batch.
+
    [1] GHOST paper: https://eprint.iacr.org/2013/881.pdf */
 
 #include "../fd_choreo_base.h"
@@ -43,6 +49,10 @@ struct __attribute__((aligned(128UL))) fd_ghost_node {
   fd_ghost_node_t * parent;       /* pointer to the parent */
   fd_ghost_node_t * child;        /* pointer to the left-most child */
   fd_ghost_node_t * sibling;      /* pointer to next sibling */
+  fd_ghost_node_t * head;         /* heaviest leaf of the subtree rooted at this slot hash */
+  ulong             delta;        /* reserved for internal use by fd_ghost_replay_votes (pending weight change) */
+  ulong             pending_cnt;  /* reserved for internal use by fd_ghost_replay_votes (children still to propagate) */
+  int               pending;      /* reserved for internal use by fd_ghost_replay_votes (on a path being propagated) */
 };
 
 #define FD_GHOST_EQV_SAFE ( 0.52 )
@@ -187,14 +197,22 @@ fd_ghost_node_insert( fd_ghost_t *           ghost,
 fd_ghost_node_t *
 fd_ghost_node_query( fd_ghost_t * ghost, fd_slot_hash_t const * slot_hash );
 
+/* fd_ghost_head returns the current fork choice, ie. the head of the root's subtree. Assumes
+   ghost has a root. O(1). */
+
+static inline fd_ghost_node_t *
+fd_ghost_head( fd_ghost_t const * ghost ) {
+  return ghost->root->head;
+}
+
 /* fd_ghost_replay_vote_upsert updates or inserts pubkey's stake in ghost.
 
    The stake associated with pubkey is added to the ancestry chain beginning at slot hash
    ("insert"). If pubkey has previously voted, the previous vote's stake is removed from the
    previous vote slot hash's ancestry chain ("update").
 
-   TODO the implementation can be made more efficient by short-circuiting and doing fewer
-   traversals, but as it exists this is bounded to O(h), where h is the height of ghost.
+   This is bounded to O(h*c), where h is the height of ghost and c the max # of children of a node
+   (to update the cached heads). Prefer fd_ghost_replay_votes when processing many votes at once.
 
    Note it is specific to the replay vote case that stake is propagated up the ancestry
    chain.
@@ -206,6 +224,19 @@ fd_ghost_replay_vote( fd_ghost_t *           ghost,
                       fd_pubkey_t const *    pubkey,
                       ulong                  stake );
 
+/* fd_ghost_replay_votes upserts cnt replay votes, with the same result as calling
+   fd_ghost_replay_vote on each of votes[0,cnt) in order (the next field of each vote is ignored).
+
+   The votes only update the voted nodes' stake and accumulate weight deltas. The deltas are then
+   propagated bottom-up (and the heads updated) once for the whole batch, so the cost is
+   O(cnt + u*c) where u is the # of nodes on the union of the ancestry chains of the voted (and
+   previously voted) nodes, instead of O(cnt*h*c). */
+
+void
+fd_ghost_replay_votes( fd_ghost_t *            ghost,
+                       fd_ghost_vote_t const * votes,
+                       ulong                   cnt );
+
 /* fd_ghost_gossip_vote_upsert updates or inserts pubkey's stake in ghost.
 
    Unlike fd_ghost_replay_vote_upsert, the stake associated with pubkey is not propagated. It is
@@ -87,13 +87,126 @@ test_ghost_print( fd_ghost_t * ghost ) {
   fd_ghost_print( ghost, ghost->root );
 }
 
+/* check_ghost verifies the weights and heads of the tree of node_cnt nodes (slot i has parent
+   parents[i]) against a from-scratch recomputation. Slots are numbered in topological order, so
+   children are visited before their parent by iterating slots in descending order. */
+
+static void
+check_ghost( fd_ghost_t * ghost, ulong const * parents, ulong node_cnt, ulong * weight ) {
+  fd_ghost_node_t * head[node_cnt];
+  for( ulong i = 0; i < node_cnt; i++ ) weight[i] = 0;
+  for( ulong i = node_cnt; i--; ) {
+    fd_slot_hash_t    key  = { .slot = i, .hash = pubkey_null };
+    fd_ghost_node_t * node = fd_ghost_node_query( ghost, &key );
+    FD_TEST( node );
+    weight[i] += node->stake;
+    if( i ) weight[parents[i]] += weight[i];
+
+    fd_ghost_node_t * best = node->child;
+    for( fd_ghost_node_t * curr = best; curr; curr = curr->sibling ) {
+      ulong cw = weight[curr->slot_hash.slot];
+      ulong bw = weight[best->slot_hash.slot];
+      if( cw > bw || ( cw == bw && curr->slot_hash.slot < best->slot_hash.slot ) ) best = curr;
+    }
+    head[i] = best ? head[best->slot_hash.slot] : node;
+
+    FD_TEST( node->weight == weight[i] );
+    FD_TEST( node->head == head[i] );
+  }
+  FD_TEST( fd_ghost_head( ghost ) == head[0] );
+}
+
+/* test_ghost_batch builds the same deep, bushy tree in two ghosts (each slot's parent is one of the
+   4 previous slots), then replays rounds of votes from voter_cnt voters for slots near a moving
+   tip, one vote at a time into the first ghost and as one batch into the second. */
+
+static void
+test_ghost_batch( fd_wksp_t * wksp, fd_rng_t * rng, ulong node_cnt, ulong voter_cnt ) {
+  ulong        vote_max = fd_ulong_pow2_up( voter_cnt ); /* map chain cnt must be a power of 2 */
+  fd_ghost_t * ghosts[2];
+  for( ulong j = 0; j < 2; j++ ) {
+    void * mem = fd_wksp_alloc_laddr( wksp, fd_ghost_align(), fd_ghost_footprint( node_cnt, vote_max ), 1UL );
+    FD_TEST( mem );
+    ghosts[j] = fd_ghost_join( fd_ghost_new( mem, node_cnt, vote_max, 0UL ) );
+    FD_TEST( ghosts[j] );
+  }
+  fd_ghost_t * single = ghosts[0];
+  fd_ghost_t * batch  = ghosts[1];
+
+  ulong * parents = fd_wksp_alloc_laddr( wksp, alignof(ulong), node_cnt * sizeof(ulong), 1UL );
+  ulong * weight  = fd_wksp_alloc_laddr( wksp, alignof(ulong), node_cnt * sizeof(ulong), 1UL );
+  fd_ghost_vote_t * votes =
+      fd_wksp_alloc_laddr( wksp, alignof(fd_ghost_vote_t), voter_cnt * sizeof(fd_ghost_vote_t), 1UL );
+  FD_TEST( parents && weight && votes );
+
+  ulong depth = 1;
+  for( ulong i = 0; i < node_cnt; i++ ) {
+    fd_slot_hash_t key    = { .slot = i, .hash = pubkey_null };
+    fd_slot_hash_t parent = { .slot = 0, .hash = pubkey_null };
+    if( i ) {
+      parents[i]  = i - 1 - fd_rng_ulong_roll( rng, fd_ulong_min( i, 4 ) );
+      parent.slot = parents[i];
+      depth += parents[i] == i - 1;
+    }
+    for( ulong j = 0; j < 2; j++ ) fd_ghost_node_insert( ghosts[j], &key, i ? &parent : NULL );
+  }
+  check_ghost( single, parents, node_cnt, weight );
+
+  ulong stake[voter_cnt];
+  for( ulong v = 0; v < voter_cnt; v++ ) stake[v] = 1 + fd_rng_ulong_roll( rng, 1000000 );
+
+  ulong round_cnt = 64;
+  ulong window    = 64;
+  long  dt_single = 0;
+  long  dt_batch  = 0;
+  for( ulong r = 0; r < round_cnt; r++ ) {
+    ulong tip = fd_ulong_min( window + r * ( node_cnt - window ) / round_cnt, node_cnt );
+    for( ulong v = 0; v < voter_cnt; v++ ) {
+      /* some voters vote more than once in a round */
+      ulong voter = fd_ulong_if( !fd_rng_uint_roll( rng, 16 ), fd_rng_ulong_roll( rng, voter_cnt ), v );
+      votes[v].pubkey         = pubkey_null;
+      votes[v].pubkey.ul[0]   = voter + 1;
+      votes[v].slot_hash.slot = tip - 1 - fd_rng_ulong_roll( rng, window );
+      votes[v].slot_hash.hash = pubkey_null;
+      votes[v].stake          = stake[voter];
+    }
+
+    dt_single -= fd_log_wallclock();
+    for( ulong v = 0; v < voter_cnt; v++ ) {
+      fd_ghost_replay_vote( single, &votes[v].slot_hash, &votes[v].pubkey, votes[v].stake );
+    }
+    dt_single += fd_log_wallclock();
+
+    dt_batch -= fd_log_wallclock();
+    fd_ghost_replay_votes( batch, votes, voter_cnt );
+    dt_batch += fd_log_wallclock();
+
+    check_ghost( single, parents, node_cnt, weight );
+    check_ghost( batch,  parents, node_cnt, weight );
+    FD_TEST( fd_ghost_head( single )->slot_hash.slot == fd_ghost_head( batch )->slot_hash.slot );
+  }
+
+  double vote_cnt = (double)( round_cnt * voter_cnt );
+  FD_LOG_NOTICE( ( "%lu nodes (depth %lu), %lu voters: %.1f ns/vote single, %.1f ns/vote batch",
+                   node_cnt,
+                   depth,
+                   voter_cnt,
+                   (double)dt_single / vote_cnt,
+                   (double)dt_batch / vote_cnt ) );
+
+  fd_wksp_free_laddr( votes );
+  fd_wksp_free_laddr( weight );
+  fd_wksp_free_laddr( parents );
+  for( ulong j = 0; j < 2; j++ ) fd_wksp_free_laddr( fd_ghost_delete( fd_ghost_leave( ghosts[j] ) ) );
+}
+
 int
 main( int argc, char ** argv ) {
   fd_boot( &argc, &argv );
 
-  ulong  page_cnt = 1;
-  char * _page_sz = "gigantic";
-  ulong  numa_idx = fd_shmem_numa_idx( 0 );
+  char const * _page_sz = fd_env_strip_cmdline_cstr( &argc, &argv, "--page-sz", NULL, "gigantic" );
+  ulong page_cnt = fd_env_strip_cmdline_ulong( &argc, &argv, "--page-cnt", NULL, 1UL );
+  ulong numa_idx = fd_env_strip_cmdline_ulong( &argc, &argv, "--numa-idx", NULL, fd_shmem_numa_idx( 0 ) );
   FD_LOG_NOTICE( ( "Creating workspace (--page-cnt %lu, --page-sz %s, --numa-idx %lu)",
                    page_cnt,
                    _page_sz,
@@ -118,6 +231,11 @@ main( int argc, char ** argv ) {
   test_ghost_print(ghost);
   test_ghost_simple( ghost );
 
+  fd_rng_t _rng[1];
+  fd_rng_t * rng = fd_rng_join( fd_rng_new( _rng, 0U, 0UL ) );
+  test_ghost_batch( wksp, rng, 4096, 3000 );
+  fd_rng_delete( fd_rng_leave( rng ) );
+
   fd_halt();
   return 0;
 }
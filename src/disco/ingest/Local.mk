@@ -0,0 +1,7 @@
+ifdef FD_HAS_HOSTED
+$(call add-hdrs,fd_ingest.h)
+$(call add-objs,fd_ingest,fd_disco)
+$(call make-unit-test,test_ingest,test_ingest,fd_disco fd_tango fd_util)
+$(call run-unit-test,test_ingest,)
+$(call make-unit-test,bench_ingest,bench_ingest,fd_disco fd_quic fd_tls fd_aio fd_waltz fd_tango fd_ballet fd_util)
+endif
@@ -0,0 +1,236 @@
+/* bench_ingest compares the cost of moving a transaction from a
+   co-located process into the validator through an ingest ring against
+   sending it over QUIC on a loopback connection.
+
+   Both sides of each path run on the calling core, so the result is
+   the total CPU time per transaction, not a latency.  The QUIC path
+   uses a virtual pair (the two fd_quic instances are connected with
+   direct fd_aio calls), so it does not include the cost of the kernel
+   UDP stack or the net tile, and is a lower bound of the real loopback
+   QUIC path.  The ingest path includes the copy out of the ring that
+   the ingest tile does. */
+
+#include "fd_ingest.h"
+#include "../../waltz/quic/tests/fd_quic_test_helpers.h"
+
+#define DEPTH (16384UL)
+#define MTU   (FD_TPU_MTU)
+
+static ulong quic_rx_cnt;
+static ulong quic_rx_sz;
+static int   quic_server_ready;
+static int   quic_client_ready;
+static ulong quic_now = 123UL;
+
+/* The QUIC instances run on a test clock that jumps to the next
+   scheduled service, so timers fire as soon as they are due. */
+
+static ulong
+quic_clock( void * ctx ) {
+  (void)ctx;
+  return quic_now;
+}
+
+static void
+quic_service( fd_quic_t * client,
+              fd_quic_t * server ) {
+  ulong next_wakeup = fd_ulong_min( fd_quic_get_next_wakeup( client ), fd_quic_get_next_wakeup( server ) );
+  quic_now = fd_ulong_if( (next_wakeup!=ULONG_MAX) & (next_wakeup>quic_now), next_wakeup, quic_now+1UL );
+  fd_quic_service( client );
+  fd_quic_service( server );
+}
+
+static void
+quic_conn_new( fd_quic_conn_t * conn,
+               void *           ctx ) {
+  (void)conn; (void)ctx;
+  quic_server_ready = 1;
+}
+
+static void
+quic_hs_complete( fd_quic_conn_t * conn,
+                  void *           ctx ) {
+  (void)conn; (void)ctx;
+  quic_client_ready = 1;
+}
+
+static void
+quic_stream_receive( fd_quic_stream_t * stream,
+                     void *             ctx,
+                     uchar const *      data,
+                     ulong              data_sz,
+                     ulong              offset,
+                     int                fin ) {
+  (void)stream; (void)ctx; (void)data; (void)offset;
+  quic_rx_sz += data_sz;
+  quic_rx_cnt += (ulong)!!fin;
+}
+
+static double
+bench_quic( fd_wksp_t * wksp,
+            fd_rng_t *  rng,
+            uchar *     txn,
+            ulong       txn_sz,
+            ulong       txn_cnt ) {
+  fd_quic_limits_t const limits = {
+    .conn_cnt           = 2,
+    .conn_id_cnt        = 4,
+    .conn_id_sparsity   = 4.0,
+    .handshake_cnt      = 10,
+    .stream_cnt         = { 20, 20, 512, 20 },
+    .initial_stream_cnt = { 20, 20, 512, 20 },
+    .stream_pool_cnt    = 2048,
+    .inflight_pkt_cnt   = 1024,
+    .tx_buf_sz          = 1<<15
+  };
+
+  fd_quic_t * server = fd_quic_new_anonymous( wksp, &limits, FD_QUIC_ROLE_SERVER, rng );
+  fd_quic_t * client = fd_quic_new_anonymous( wksp, &limits, FD_QUIC_ROLE_CLIENT, rng );
+  FD_TEST( server && client );
+
+  server->cb.now              = quic_clock;
+  client->cb.now              = quic_clock;
+  server->cb.conn_new         = quic_conn_new;
+  server->cb.stream_receive   = quic_stream_receive;
+  client->cb.conn_hs_complete = quic_hs_complete;
+  server->config.initial_rx_max_stream_data = MTU;
+  client->config.initial_rx_max_stream_data = MTU;
+
+  fd_quic_virtual_pair_t vp;
+  fd_quic_virtual_pair_init( &vp, server, client );
+  FD_TEST( fd_quic_init( server ) );
+  FD_TEST( fd_quic_init( client ) );
+
+  fd_quic_conn_t * conn = fd_quic_connect( client, server->config.net.ip_addr, server->config.net.listen_udp_port, server->config.sni );
+  FD_TEST( conn );
+  for( ulong i=0UL; i<1000UL && !(quic_server_ready && quic_client_ready); i++ ) {
+    quic_service( client, server );
+  }
+  if( FD_UNLIKELY( !(quic_server_ready && quic_client_ready) ) ) {
+    FD_LOG_WARNING(( "QUIC handshake did not complete, skipping" ));
+    txn_cnt = 0UL;
+  }
+
+  fd_aio_pkt_info_t pkt[1] = {{ .buf=txn, .buf_sz=(ushort)txn_sz }};
+
+  ulong sent = 0UL;
+  long  dt   = -fd_log_wallclock();
+  while( quic_rx_cnt<txn_cnt ) {
+    while( sent<txn_cnt ) {
+      fd_quic_stream_t * stream = fd_quic_conn_new_stream( conn, FD_QUIC_TYPE_UNIDIR );
+      if( FD_UNLIKELY( !stream ) ) break;
+      if( FD_UNLIKELY( fd_quic_stream_send( stream, pkt, 1, 1 )!=1 ) ) break;
+      sent++;
+    }
+    quic_service( client, server );
+  }
+  dt += fd_log_wallclock();
+  FD_TEST( quic_rx_sz==txn_cnt*txn_sz );
+
+  fd_quic_conn_close( conn, 0 );
+  for( ulong i=0UL; i<100UL; i++ ) {
+    quic_service( client, server );
+  }
+
+  fd_quic_virtual_pair_fini( &vp );
+  fd_wksp_free_laddr( fd_quic_delete( fd_quic_leave( fd_quic_fini( server ) ) ) );
+  fd_wksp_free_laddr( fd_quic_delete( fd_quic_leave( fd_quic_fini( client ) ) ) );
+  return txn_cnt ? (double)dt/(double)txn_cnt : 0.;
+}
+
+static double
+bench_ingest( fd_wksp_t * wksp,
+              uchar *     txn,
+              ulong       txn_sz,
+              ulong       txn_cnt ) {
+  ulong data_sz = fd_dcache_req_data_sz( MTU, DEPTH, 1UL, 1 );
+  fd_frag_meta_t * mcache = fd_mcache_join( fd_mcache_new( fd_wksp_alloc_laddr( wksp, fd_mcache_align(), fd_mcache_footprint( DEPTH, 0UL ), 1UL ), DEPTH, 0UL, 0UL ) );
+  uchar *          dcache = fd_dcache_join( fd_dcache_new( fd_wksp_alloc_laddr( wksp, fd_dcache_align(), fd_dcache_footprint( data_sz, 0UL ), 1UL ), data_sz, 0UL ) );
+  ulong *          fseq   = fd_fseq_join  ( fd_fseq_new  ( fd_wksp_alloc_laddr( wksp, fd_fseq_align(), fd_fseq_footprint(), 1UL ), 0UL ) );
+  fd_ingest_t *    ingest = fd_ingest_join( fd_ingest_new( fd_wksp_alloc_laddr( wksp, fd_ingest_align(), fd_ingest_footprint(), 1UL ), 1UL ) );
+  FD_TEST( mcache && dcache && fseq && ingest );
+  fd_ingest_ring_set( ingest, 0UL, wksp, mcache, dcache, fseq, MTU );
+  fd_ingest_ready( ingest );
+
+  fd_ingest_client_t client[1];
+  FD_TEST( fd_ingest_client_join( client, ingest, 0UL ) );
+
+  uchar         out[ MTU ];
+  uchar const * batch_txn[ 16 ];
+  ulong         batch_sz [ 16 ];
+  for( ulong i=0UL; i<16UL; i++ ) { batch_txn[ i ] = txn; batch_sz[ i ] = txn_sz; }
+
+  ulong sent = 0UL;
+  ulong seq  = 0UL;
+  long  dt   = -fd_log_wallclock();
+  while( seq<txn_cnt ) {
+    sent += fd_ingest_client_publish_batch( client, batch_txn, batch_sz, fd_ulong_min( 16UL, txn_cnt-sent ) );
+
+    /* Consume like the ingest tile: speculatively copy out and check
+       for overrun */
+    for(;;) {
+      fd_frag_meta_t const * line = mcache + fd_mcache_line_idx( seq, DEPTH );
+      if( FD_UNLIKELY( fd_frag_meta_seq_query( line )!=seq ) ) break;
+      fd_memcpy( out, fd_chunk_to_laddr( wksp, line->chunk ), line->sz );
+      FD_TEST( fd_frag_meta_seq_query( line )==seq );
+      seq++;
+    }
+    fd_fseq_update( fseq, seq );
+  }
+  dt += fd_log_wallclock();
+  FD_TEST( !memcmp( out, txn, txn_sz ) );
+
+  fd_ingest_client_leave( client );
+  fd_wksp_free_laddr( fd_ingest_delete( fd_ingest_leave( ingest ) ) );
+  fd_wksp_free_laddr( fd_mcache_delete( fd_mcache_leave( mcache ) ) );
+  fd_wksp_free_laddr( fd_dcache_delete( fd_dcache_leave( dcache ) ) );
+  fd_wksp_free_laddr( fd_fseq_delete  ( fd_fseq_leave  ( fseq   ) ) );
+  return (double)dt/(double)txn_cnt;
+}
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot          ( &argc, &argv );
+  fd_quic_test_boot( &argc, &argv );
+
+  fd_rng_t _rng[1]; fd_rng_t * rng = fd_rng_join( fd_rng_new( _rng, 0U, 0UL ) );
+
+  ulong cpu_idx = fd_tile_cpu_id( fd_tile_idx() );
+  if( cpu_idx>fd_shmem_cpu_cnt() ) cpu_idx = 0UL;
+
+  char const * _page_sz = fd_env_strip_cmdline_cstr ( &argc, &argv, "--page-sz",  NULL, "gigantic"                   );
+  ulong        page_cnt = fd_env_strip_cmdline_ulong( &argc, &argv, "--page-cnt", NULL, 1UL                          );
+  ulong        numa_idx = fd_env_strip_cmdline_ulong( &argc, &argv, "--numa-idx", NULL, fd_shmem_numa_idx( cpu_idx ) );
+  ulong        txn_sz   = fd_env_strip_cmdline_ulong( &argc, &argv, "--txn-sz",   NULL, 192UL                        );
+  ulong        txn_cnt  = fd_env_strip_cmdline_ulong( &argc, &argv, "--txn-cnt",  NULL, 1UL<<20                      );
+
+  ulong page_sz = fd_cstr_to_shmem_page_sz( _page_sz );
+  if( FD_UNLIKELY( !page_sz ) ) FD_LOG_ERR(( "unsupported --page-sz" ));
+  if( FD_UNLIKELY( (!txn_sz) | (txn_sz>MTU) ) ) FD_LOG_ERR(( "--txn-sz must be in [1,%lu]", MTU ));
+
+  FD_LOG_NOTICE(( "Creating workspace (--page-cnt %lu, --page-sz %s, --numa-idx %lu)", page_cnt, _page_sz, numa_idx ));
+  fd_wksp_t * wksp = fd_wksp_new_anonymous( page_sz, page_cnt, fd_shmem_cpu_idx( numa_idx ), "wksp", 0UL );
+  FD_TEST( wksp );
+
+  uchar txn[ MTU ];
+  for( ulong i=0UL; i<txn_sz; i++ ) txn[ i ] = fd_rng_uchar( rng );
+
+  double ingest_ns = bench_ingest( wksp,      txn, txn_sz, txn_cnt );
+  double quic_ns   = bench_quic  ( wksp, rng, txn, txn_sz, txn_cnt );
+
+  FD_LOG_NOTICE(( "%lu txns of %lu B", txn_cnt, txn_sz ));
+  FD_LOG_NOTICE(( "shm ingest:    %8.1f ns/txn (%7.3f Mtxn/s per core)", ingest_ns, 1e3/ingest_ns ));
+  if( FD_LIKELY( quic_ns>0. ) ) {
+    FD_LOG_NOTICE(( "loopback QUIC: %8.1f ns/txn (%7.3f Mtxn/s per core)", quic_ns,   1e3/quic_ns   ));
+    FD_LOG_NOTICE(( "speedup:       %8.1fx", quic_ns/ingest_ns ));
+  }
+
+  fd_wksp_delete_anonymous( wksp );
+  fd_rng_delete( fd_rng_leave( rng ) );
+
+  FD_LOG_NOTICE(( "pass" ));
+  fd_quic_test_halt();
+  fd_halt();
+  return 0;
+}
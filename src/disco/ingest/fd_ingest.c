@@ -0,0 +1,328 @@
+#include "fd_ingest.h"
+
+#include <errno.h>
+#include <signal.h>
+#include <unistd.h>
+
+#define FD_INGEST_MAGIC (0xf17eda2c3a16e500UL) /* firedancer ingest ver 0 */
+
+ulong
+fd_ingest_align( void ) {
+  return FD_INGEST_ALIGN;
+}
+
+ulong
+fd_ingest_footprint( void ) {
+  return FD_INGEST_FOOTPRINT;
+}
+
+void *
+fd_ingest_new( void * shmem,
+               ulong  ring_cnt ) {
+
+  if( FD_UNLIKELY( !shmem ) ) {
+    FD_LOG_WARNING(( "NULL shmem" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( !fd_ulong_is_aligned( (ulong)shmem, fd_ingest_align() ) ) ) {
+    FD_LOG_WARNING(( "misaligned shmem" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( (!ring_cnt) | (ring_cnt>FD_INGEST_RING_MAX) ) ) {
+    FD_LOG_WARNING(( "bad ring_cnt" ));
+    return NULL;
+  }
+
+  fd_memset( shmem, 0, fd_ingest_footprint() );
+
+  fd_ingest_t * ingest = (fd_ingest_t *)shmem;
+  ingest->ring_cnt = ring_cnt;
+
+  FD_COMPILER_MFENCE();
+  FD_VOLATILE( ingest->magic ) = FD_INGEST_MAGIC;
+  FD_COMPILER_MFENCE();
+
+  return shmem;
+}
+
+fd_ingest_t *
+fd_ingest_join( void * shingest ) {
+
+  if( FD_UNLIKELY( !shingest ) ) {
+    FD_LOG_WARNING(( "NULL shingest" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( !fd_ulong_is_aligned( (ulong)shingest, fd_ingest_align() ) ) ) {
+    FD_LOG_WARNING(( "misaligned shingest" ));
+    return NULL;
+  }
+
+  fd_ingest_t * ingest = (fd_ingest_t *)shingest;
+
+  if( FD_UNLIKELY( ingest->magic!=FD_INGEST_MAGIC ) ) {
+    FD_LOG_WARNING(( "bad magic" ));
+    return NULL;
+  }
+
+  return ingest;
+}
+
+void *
+fd_ingest_leave( fd_ingest_t const * ingest ) {
+
+  if( FD_UNLIKELY( !ingest ) ) {
+    FD_LOG_WARNING(( "NULL ingest" ));
+    return NULL;
+  }
+
+  return (void *)ingest;
+}
+
+void *
+fd_ingest_delete( void * shingest ) {
+
+  if( FD_UNLIKELY( !shingest ) ) {
+    FD_LOG_WARNING(( "NULL shingest" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( !fd_ulong_is_aligned( (ulong)shingest, fd_ingest_align() ) ) ) {
+    FD_LOG_WARNING(( "misaligned shingest" ));
+    return NULL;
+  }
+
+  fd_ingest_t * ingest = (fd_ingest_t *)shingest;
+
+  if( FD_UNLIKELY( ingest->magic!=FD_INGEST_MAGIC ) ) {
+    FD_LOG_WARNING(( "bad magic" ));
+    return NULL;
+  }
+
+  FD_COMPILER_MFENCE();
+  FD_VOLATILE( ingest->magic ) = 0UL;
+  FD_COMPILER_MFENCE();
+
+  return (void *)ingest;
+}
+
+void
+fd_ingest_ring_set( fd_ingest_t *          ingest,
+                    ulong                  ring_idx,
+                    fd_wksp_t *            wksp,
+                    fd_frag_meta_t const * mcache,
+                    uchar const *          dcache,
+                    ulong const *          fseq,
+                    ulong                  mtu ) {
+  if( FD_UNLIKELY( ring_idx>=ingest->ring_cnt ) ) FD_LOG_ERR(( "ring_idx %lu out of range [0,%lu)", ring_idx, ingest->ring_cnt ));
+
+  fd_ingest_ring_t * ring = &ingest->ring[ ring_idx ];
+  ring->mcache_gaddr = fd_wksp_gaddr( wksp, fd_mcache_leave( mcache ) );
+  ring->dcache_gaddr = fd_wksp_gaddr( wksp, fd_dcache_leave( dcache ) );
+  ring->fseq_gaddr   = fd_wksp_gaddr( wksp, fd_fseq_leave( fseq ) );
+  ring->mtu          = mtu;
+  if( FD_UNLIKELY( !ring->mcache_gaddr || !ring->dcache_gaddr || !ring->fseq_gaddr ) )
+    FD_LOG_ERR(( "ring %lu is not in the ingest workspace", ring_idx ));
+}
+
+fd_ingest_t *
+fd_ingest_attach( char const * wksp_name ) {
+  fd_wksp_t * wksp = fd_wksp_attach( wksp_name );
+  if( FD_UNLIKELY( !wksp ) ) {
+    FD_LOG_WARNING(( "fd_wksp_attach(\"%s\") failed", wksp_name ));
+    return NULL;
+  }
+
+  /* The objects of a topology workspace are laid out in a single
+     allocation with tag 1 at the start of the data region, aligned to
+     fd_topo_workspace_align() (4096), and the directory is the first
+     of them (see fd_topob_finish and fd_topo_create_workspace). */
+
+  ulong                    tag = 1UL;
+  fd_wksp_tag_query_info_t info[1];
+  if( FD_UNLIKELY( !fd_wksp_tag_query( wksp, &tag, 1UL, info, 1UL ) ) ) {
+    FD_LOG_WARNING(( "workspace \"%s\" has no objects", wksp_name ));
+    fd_wksp_detach( wksp );
+    return NULL;
+  }
+
+  fd_ingest_t * ingest = fd_ingest_join( fd_wksp_laddr_fast( wksp, fd_ulong_align_up( info->gaddr_lo, 4096UL ) ) );
+  if( FD_UNLIKELY( !ingest ) ) {
+    FD_LOG_WARNING(( "workspace \"%s\" is not an ingest workspace", wksp_name ));
+    fd_wksp_detach( wksp );
+    return NULL;
+  }
+
+  return ingest;
+}
+
+void
+fd_ingest_detach( fd_ingest_t * ingest ) {
+  fd_wksp_t * wksp = fd_wksp_containing( fd_ingest_leave( ingest ) );
+  if( FD_UNLIKELY( !wksp ) ) FD_LOG_WARNING(( "ingest is not in a workspace" ));
+  else                       fd_wksp_detach( wksp );
+}
+
+/* ring_claim atomically claims ring for owner, taking it over from a
+   previous owner process that no longer exists.  Returns 1 on success
+   and 0 if the ring is held by a live process. */
+
+static int
+ring_claim( fd_ingest_ring_t * ring,
+            ulong              owner ) {
+  for(;;) {
+    ulong prev = FD_VOLATILE_CONST( ring->owner );
+    if( FD_UNLIKELY( prev==owner ) ) return 1;
+    if( FD_UNLIKELY( prev && !(kill( (pid_t)prev, 0 )==-1 && errno==ESRCH) ) ) return 0;
+    if( FD_LIKELY( FD_ATOMIC_CAS( &ring->owner, prev, owner )==prev ) ) return 1;
+  }
+}
+
+fd_ingest_client_t *
+fd_ingest_client_join( fd_ingest_client_t * client,
+                       fd_ingest_t *        ingest,
+                       ulong                ring_idx ) {
+
+  if( FD_UNLIKELY( !client ) ) {
+    FD_LOG_WARNING(( "NULL client" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( !ingest ) ) {
+    FD_LOG_WARNING(( "NULL ingest" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( !fd_ingest_is_ready( ingest ) ) ) {
+    FD_LOG_WARNING(( "ingest is not ready, the validator is not running or still booting" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( ring_idx>=ingest->ring_cnt ) ) {
+    FD_LOG_WARNING(( "ring_idx %lu out of range [0,%lu)", ring_idx, ingest->ring_cnt ));
+    return NULL;
+  }
+
+  fd_ingest_ring_t * ring  = &ingest->ring[ ring_idx ];
+  ulong              owner = (ulong)getpid();
+  if( FD_UNLIKELY( !ring_claim( ring, owner ) ) ) {
+    FD_LOG_WARNING(( "ring %lu is claimed by live process %lu", ring_idx, FD_VOLATILE_CONST( ring->owner ) ));
+    return NULL;
+  }
+
+  fd_wksp_t *      wksp   = fd_wksp_containing( ingest );
+  fd_frag_meta_t * mcache = fd_mcache_join( fd_wksp_laddr( wksp, ring->mcache_gaddr ) );
+  uchar *          dcache = fd_dcache_join( fd_wksp_laddr( wksp, ring->dcache_gaddr ) );
+  ulong *          fseq   = fd_fseq_join  ( fd_wksp_laddr( wksp, ring->fseq_gaddr   ) );
+  if( FD_UNLIKELY( !mcache || !dcache || !fseq ) ) {
+    FD_LOG_WARNING(( "ring %lu is corrupt", ring_idx ));
+    FD_ATOMIC_CAS( &ring->owner, owner, 0UL );
+    return NULL;
+  }
+
+  fd_memset( client, 0, sizeof(fd_ingest_client_t) );
+  client->ingest = ingest;
+  client->ring   = ring;
+  client->owner  = owner;
+  client->wksp   = wksp;
+  client->mcache = mcache;
+  client->sync   = fd_mcache_seq_laddr( mcache );
+  client->depth  = fd_mcache_depth( mcache );
+  client->mtu    = ring->mtu;
+  client->chunk0 = fd_dcache_compact_chunk0( wksp, dcache );
+  client->wmark  = fd_dcache_compact_wmark ( wksp, dcache, client->mtu );
+
+  /* Resume after the last frag published into the ring, by this or a
+     previous client.  The sync is only a hint of where that is (a
+     previous client may have died between publishing and updating it),
+     so walk forward over lines that were already published, skipping
+     ahead to lines that were republished since. */
+
+  ulong seq = fd_mcache_seq_query( client->sync );
+  for(;;) {
+    ulong found = fd_mcache_query( mcache, client->depth, seq );
+    if(      FD_LIKELY( found==seq              ) ) seq = fd_seq_inc( seq, 1UL );
+    else if( FD_LIKELY( fd_seq_gt( found, seq ) ) ) seq = found;
+    else break;
+  }
+  client->seq = seq;
+
+  client->chunk = client->chunk0;
+  ulong last_seq = fd_seq_dec( seq, 1UL );
+  fd_frag_meta_t const * last = mcache + fd_mcache_line_idx( last_seq, client->depth );
+  if( FD_LIKELY( fd_mcache_query( mcache, client->depth, last_seq )==last_seq ) ) {
+    ulong last_chunk = (ulong)last->chunk;
+    if( FD_LIKELY( last_chunk>=client->chunk0 && last_chunk<=client->wmark ) )
+      client->chunk = fd_dcache_compact_next( last_chunk, fd_ulong_min( (ulong)last->sz, client->mtu ), client->chunk0, client->wmark );
+  }
+
+  client->fctl = fd_fctl_cfg_done( fd_fctl_cfg_rx_add( fd_fctl_join( fd_fctl_new( client->fctl_mem, 1UL ) ),
+                                                       client->depth, fseq, &client->slow_cnt ),
+                                   1UL, 0UL, 0UL, 0UL );
+  if( FD_UNLIKELY( !client->fctl ) ) {
+    FD_ATOMIC_CAS( &ring->owner, owner, 0UL );
+    return NULL;
+  }
+  client->cr_avail = 0UL;
+
+  return client;
+}
+
+void
+fd_ingest_client_leave( fd_ingest_client_t * client ) {
+  fd_mcache_seq_update( client->sync, client->seq );
+  FD_ATOMIC_CAS( &client->ring->owner, client->owner, 0UL );
+  fd_memset( client, 0, sizeof(fd_ingest_client_t) );
+}
+
+static inline void
+client_publish( fd_ingest_client_t * client,
+                uchar const *        txn,
+                ulong                sz,
+                ulong                ts ) {
+  fd_memcpy( fd_chunk_to_laddr( client->wksp, client->chunk ), txn, sz );
+  ulong ctl = fd_frag_meta_ctl( 0UL, 1, 1, 0 );
+  fd_mcache_publish( client->mcache, client->depth, client->seq, 0UL, client->chunk, sz, ctl, ts, ts );
+  client->chunk = fd_dcache_compact_next( client->chunk, sz, client->chunk0, client->wmark );
+  client->seq   = fd_seq_inc( client->seq, 1UL );
+  client->cr_avail--;
+}
+
+int
+fd_ingest_client_publish( fd_ingest_client_t * client,
+                          uchar const *        txn,
+                          ulong                sz ) {
+  if( FD_UNLIKELY( (!sz) | (sz>client->mtu) ) ) return FD_INGEST_ERR_INVAL;
+
+  if( FD_UNLIKELY( !client->cr_avail ) ) {
+    client->cr_avail = fd_fctl_tx_cr_update( client->fctl, client->cr_avail, client->seq );
+    if( FD_UNLIKELY( !client->cr_avail ) ) return FD_INGEST_ERR_AGAIN;
+  }
+
+  client_publish( client, txn, sz, fd_frag_meta_ts_comp( fd_tickcount() ) );
+  fd_mcache_seq_update( client->sync, client->seq );
+  return FD_INGEST_SUCCESS;
+}
+
+ulong
+fd_ingest_client_publish_batch( fd_ingest_client_t *  client,
+                                uchar const * const * txn,
+                                ulong const *         sz,
+                                ulong                 cnt ) {
+  if( FD_UNLIKELY( client->cr_avail<cnt ) ) {
+    client->cr_avail = fd_fctl_tx_cr_update( client->fctl, client->cr_avail, client->seq );
+  }
+
+  ulong ts = fd_frag_meta_ts_comp( fd_tickcount() );
+  ulong i  = 0UL;
+  for( ; i<cnt; i++ ) {
+    if( FD_UNLIKELY( !client->cr_avail                    ) ) break;
+    if( FD_UNLIKELY( (!sz[ i ]) | (sz[ i ]>client->mtu) ) ) break;
+    client_publish( client, txn[ i ], sz[ i ], ts );
+  }
+
+  if( FD_LIKELY( i ) ) fd_mcache_seq_update( client->sync, client->seq );
+  return i;
+}
@@ -0,0 +1,282 @@
+#include "fd_ingest.h"
+
+#include <errno.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+FD_STATIC_ASSERT( FD_INGEST_ALIGN    ==128UL,                 unit_test );
+FD_STATIC_ASSERT( FD_INGEST_FOOTPRINT==sizeof(fd_ingest_t),   unit_test );
+FD_STATIC_ASSERT( FD_INGEST_SUCCESS  ==0,                     unit_test );
+
+#define RING_CNT (2UL)
+#define DEPTH    (256UL)
+#define MTU      (FD_TPU_MTU)
+
+/* ring_t is the consumer side of a ring, as the ingest tile sees it. */
+
+typedef struct {
+  fd_frag_meta_t * mcache;
+  uchar *          dcache;
+  ulong *          fseq;
+  ulong            chunk0;
+  ulong            wmark;
+  ulong            seq;
+} ring_t;
+
+static fd_ingest_t *
+ingest_create( fd_wksp_t * wksp,
+               ring_t *    ring,
+               ulong       ring_cnt,
+               ulong       depth ) {
+  fd_ingest_t * ingest = fd_ingest_join( fd_ingest_new( fd_wksp_alloc_laddr( wksp, fd_ingest_align(), fd_ingest_footprint(), 1UL ), ring_cnt ) );
+  FD_TEST( ingest );
+  for( ulong i=0UL; i<ring_cnt; i++ ) {
+    ulong data_sz = fd_dcache_req_data_sz( MTU, depth, 1UL, 1 );
+    ring[ i ].mcache = fd_mcache_join( fd_mcache_new( fd_wksp_alloc_laddr( wksp, fd_mcache_align(), fd_mcache_footprint( depth, 0UL ), 1UL ), depth, 0UL, 0UL ) );
+    ring[ i ].dcache = fd_dcache_join( fd_dcache_new( fd_wksp_alloc_laddr( wksp, fd_dcache_align(), fd_dcache_footprint( data_sz, 0UL ), 1UL ), data_sz, 0UL ) );
+    ring[ i ].fseq   = fd_fseq_join  ( fd_fseq_new  ( fd_wksp_alloc_laddr( wksp, fd_fseq_align(), fd_fseq_footprint(), 1UL ), 0UL ) );
+    FD_TEST( ring[ i ].mcache && ring[ i ].dcache && ring[ i ].fseq );
+    ring[ i ].chunk0 = fd_dcache_compact_chunk0( wksp, ring[ i ].dcache );
+    ring[ i ].wmark  = fd_dcache_compact_wmark ( wksp, ring[ i ].dcache, MTU );
+    ring[ i ].seq    = 0UL;
+    fd_ingest_ring_set( ingest, i, wksp, ring[ i ].mcache, ring[ i ].dcache, ring[ i ].fseq, MTU );
+  }
+  return ingest;
+}
+
+static void
+ingest_destroy( fd_ingest_t * ingest,
+                ring_t *      ring,
+                ulong         ring_cnt ) {
+  for( ulong i=0UL; i<ring_cnt; i++ ) {
+    fd_wksp_free_laddr( fd_mcache_delete( fd_mcache_leave( ring[ i ].mcache ) ) );
+    fd_wksp_free_laddr( fd_dcache_delete( fd_dcache_leave( ring[ i ].dcache ) ) );
+    fd_wksp_free_laddr( fd_fseq_delete  ( fd_fseq_leave  ( ring[ i ].fseq   ) ) );
+  }
+  fd_wksp_free_laddr( fd_ingest_delete( fd_ingest_leave( ingest ) ) );
+}
+
+/* txn_gen fills txn with the synthetic transaction with sequence
+   number seq and returns its size. */
+
+static ulong
+txn_gen( uchar * txn,
+         ulong   seq ) {
+  ulong sz = 1UL + (seq*7919UL) % MTU;
+  for( ulong i=0UL; i<sz; i++ ) txn[ i ] = (uchar)(seq+i);
+  return sz;
+}
+
+/* consume reads up to max frags from ring like the mux of the ingest
+   tile would, checks them against txn_gen if check is set, and returns
+   credits through the fseq.  Returns the number of frags read. */
+
+static ulong
+consume( fd_wksp_t * wksp,
+         ring_t *    ring,
+         ulong       max,
+         int         check ) {
+  ulong depth = fd_mcache_depth( ring->mcache );
+  ulong cnt   = 0UL;
+  uchar buf[ MTU ];
+  while( cnt<max ) {
+    fd_frag_meta_t const * line = ring->mcache + fd_mcache_line_idx( ring->seq, depth );
+    ulong seq_found = fd_frag_meta_seq_query( line );
+    if( FD_UNLIKELY( fd_seq_lt( seq_found, ring->seq ) ) ) break;
+    FD_TEST( seq_found==ring->seq );
+
+    ulong chunk = line->chunk;
+    ulong sz    = line->sz;
+    FD_TEST( chunk>=ring->chunk0 && chunk<=ring->wmark && sz<=MTU );
+    fd_memcpy( buf, fd_chunk_to_laddr( wksp, chunk ), sz );
+    FD_TEST( fd_frag_meta_seq_query( line )==ring->seq );
+
+    if( check ) {
+      uchar expected[ MTU ];
+      FD_TEST( sz==txn_gen( expected, ring->seq ) );
+      FD_TEST( !memcmp( buf, expected, sz ) );
+    }
+
+    ring->seq = fd_seq_inc( ring->seq, 1UL );
+    cnt++;
+  }
+  fd_fseq_update( ring->fseq, ring->seq );
+  return cnt;
+}
+
+static fd_wksp_t * bench_wksp;
+static ring_t *    bench_ring;
+static ulong       bench_consumer_total;
+
+static int
+bench_consumer( int     argc,
+                char ** argv ) {
+  (void)argv;
+  ulong txn_cnt = (ulong)(uint)argc;
+  ulong got     = 0UL;
+  while( got<txn_cnt ) got += consume( bench_wksp, bench_ring, 64UL, 0 );
+  bench_consumer_total = got;
+  return 0;
+}
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+
+  ulong cpu_idx = fd_tile_cpu_id( fd_tile_idx() );
+  if( cpu_idx>fd_shmem_cpu_cnt() ) cpu_idx = 0UL;
+
+  char const * _page_sz = fd_env_strip_cmdline_cstr ( &argc, &argv, "--page-sz",  NULL, "gigantic"                   );
+  ulong        page_cnt = fd_env_strip_cmdline_ulong( &argc, &argv, "--page-cnt", NULL, 1UL                          );
+  ulong        numa_idx = fd_env_strip_cmdline_ulong( &argc, &argv, "--numa-idx", NULL, fd_shmem_numa_idx( cpu_idx ) );
+  ulong        txn_cnt  = fd_env_strip_cmdline_ulong( &argc, &argv, "--txn-cnt",  NULL, 1UL<<20                      );
+
+  ulong page_sz = fd_cstr_to_shmem_page_sz( _page_sz );
+  if( FD_UNLIKELY( !page_sz ) ) FD_LOG_ERR(( "unsupported --page-sz" ));
+
+  FD_LOG_NOTICE(( "Creating workspace (--page-cnt %lu, --page-sz %s, --numa-idx %lu)", page_cnt, _page_sz, numa_idx ));
+  fd_wksp_t * wksp = fd_wksp_new_anonymous( page_sz, page_cnt, fd_shmem_cpu_idx( numa_idx ), "wksp", 0UL );
+  FD_TEST( wksp );
+
+  FD_TEST( !fd_ingest_new( NULL, 1UL ) );
+  uchar * mem = fd_wksp_alloc_laddr( wksp, fd_ingest_align(), fd_ingest_footprint(), 1UL );
+  FD_TEST( !fd_ingest_new( mem+1, 1UL ) );
+  FD_TEST( !fd_ingest_new( mem, 0UL ) );
+  FD_TEST( !fd_ingest_new( mem, FD_INGEST_RING_MAX+1UL ) );
+  FD_TEST( !fd_ingest_join( mem ) );
+  fd_wksp_free_laddr( mem );
+
+  ring_t        ring[ RING_CNT ];
+  fd_ingest_t * ingest = ingest_create( wksp, ring, RING_CNT, DEPTH );
+  FD_TEST( fd_ingest_ring_cnt( ingest )==RING_CNT );
+
+  /* Clients can't join before the ingest tile is ready */
+
+  fd_ingest_client_t client[1];
+  FD_TEST( !fd_ingest_is_ready( ingest ) );
+  FD_TEST( !fd_ingest_client_join( client, ingest, 0UL ) );
+  fd_ingest_ready( ingest );
+  FD_TEST( fd_ingest_is_ready( ingest ) );
+  FD_TEST( !fd_ingest_client_join( client, ingest, RING_CNT ) );
+
+  /* A ring claimed by a live process can't be joined, one claimed by a
+     dead process is taken over */
+
+  ingest->ring[ 0 ].owner = 1UL; /* init */
+  FD_TEST( !fd_ingest_client_join( client, ingest, 0UL ) );
+
+  pid_t child = fork();
+  FD_TEST( child>=0 );
+  if( !child ) _exit( 0 );
+  FD_TEST( waitpid( child, NULL, 0 )==child );
+  ingest->ring[ 0 ].owner = (ulong)child;
+  FD_TEST( fd_ingest_client_join( client, ingest, 0UL )==client );
+  FD_TEST( ingest->ring[ 0 ].owner==(ulong)getpid() );
+  FD_TEST( client->seq==0UL && client->chunk==ring[ 0 ].chunk0 );
+
+  /* Bad sizes are rejected */
+
+  uchar txn[ MTU+1UL ];
+  FD_TEST( fd_ingest_client_publish( client, txn, 0UL     )==FD_INGEST_ERR_INVAL );
+  FD_TEST( fd_ingest_client_publish( client, txn, MTU+1UL )==FD_INGEST_ERR_INVAL );
+
+  /* The client can publish a full ring, then gets backpressured until
+     the consumer catches up */
+
+  ulong pub_seq = 0UL;
+  for( ulong i=0UL; i<DEPTH; i++ ) {
+    ulong sz = txn_gen( txn, pub_seq );
+    FD_TEST( fd_ingest_client_publish( client, txn, sz )==FD_INGEST_SUCCESS );
+    pub_seq++;
+  }
+  FD_TEST( fd_ingest_client_publish( client, txn, txn_gen( txn, pub_seq ) )==FD_INGEST_ERR_AGAIN );
+  FD_TEST( fd_mcache_seq_query( fd_mcache_seq_laddr( ring[ 0 ].mcache ) )==DEPTH );
+
+  FD_TEST( consume( wksp, &ring[ 0 ], DEPTH/8UL, 1 )==DEPTH/8UL );
+  FD_TEST( fd_ingest_client_publish( client, txn, txn_gen( txn, pub_seq ) )==FD_INGEST_ERR_AGAIN ); /* Below the resume threshold */
+  FD_TEST( consume( wksp, &ring[ 0 ], ULONG_MAX, 1 )==DEPTH-DEPTH/8UL );
+  FD_TEST( fd_ingest_client_publish( client, txn, txn_gen( txn, pub_seq ) )==FD_INGEST_SUCCESS );
+  pub_seq++;
+
+  /* Batches stop at the first transaction that can't be published */
+
+  uchar         batch_mem[ 8 ][ MTU ];
+  uchar const * batch_txn[ 8 ];
+  ulong         batch_sz [ 8 ];
+  for( ulong i=0UL; i<8UL; i++ ) {
+    batch_sz [ i ] = txn_gen( batch_mem[ i ], pub_seq+i );
+    batch_txn[ i ] = batch_mem[ i ];
+  }
+  batch_sz[ 5 ] = 0UL;
+  FD_TEST( fd_ingest_client_publish_batch( client, batch_txn, batch_sz, 8UL )==5UL );
+  pub_seq += 5UL;
+  FD_TEST( consume( wksp, &ring[ 0 ], ULONG_MAX, 1 )==6UL );
+
+  /* A new client resumes where the previous one left off, even if it
+     died before updating the sync */
+
+  ulong seq   = client->seq;
+  ulong chunk = client->chunk;
+  fd_ingest_client_leave( client );
+  FD_TEST( !ingest->ring[ 0 ].owner );
+  FD_TEST( fd_ingest_client_join( client, ingest, 0UL )==client );
+  FD_TEST( client->seq==seq && client->chunk==chunk );
+
+  FD_TEST( fd_ingest_client_publish( client, txn, txn_gen( txn, pub_seq ) )==FD_INGEST_SUCCESS );
+  pub_seq++;
+  seq   = client->seq;
+  chunk = client->chunk;
+  for( ulong i=0UL; i<2UL; i++ ) {
+    fd_mcache_seq_update( fd_mcache_seq_laddr( ring[ 0 ].mcache ), i ? 0UL : seq-1UL );
+    ingest->ring[ 0 ].owner = (ulong)child;
+    FD_TEST( fd_ingest_client_join( client, ingest, 0UL )==client );
+    FD_TEST( client->seq==seq && client->chunk==chunk );
+  }
+  FD_TEST( consume( wksp, &ring[ 0 ], ULONG_MAX, 1 )==1UL );
+
+  /* Rings are independent */
+
+  fd_ingest_client_t client1[1];
+  FD_TEST( fd_ingest_client_join( client1, ingest, 1UL )==client1 );
+  FD_TEST( fd_ingest_client_publish( client1, txn, txn_gen( txn, 0UL ) )==FD_INGEST_SUCCESS );
+  FD_TEST( consume( wksp, &ring[ 1 ], ULONG_MAX, 1 )==1UL );
+  FD_TEST( consume( wksp, &ring[ 0 ], ULONG_MAX, 1 )==0UL );
+  fd_ingest_client_leave( client1 );
+
+  /* Throughput of transactions through a ring.  With more than one tile
+     the consumer runs on its own core, like the ingest tile would. */
+
+  for( ulong i=0UL; i<8UL; i++ ) batch_sz[ i ] = 192UL; /* Typical size of a simple transfer */
+
+  ulong published = 0UL;
+  long  dt        = -fd_log_wallclock();
+  if( fd_tile_cnt()>1UL ) {
+    bench_wksp = wksp;
+    bench_ring = &ring[ 0 ];
+    fd_tile_exec_t * exec = fd_tile_exec_new( 1UL, bench_consumer, (int)(uint)txn_cnt, NULL );
+    FD_TEST( exec );
+    while( published<txn_cnt ) published += fd_ingest_client_publish_batch( client, batch_txn, batch_sz, fd_ulong_min( 8UL, txn_cnt-published ) );
+    FD_TEST( !fd_tile_exec_delete( exec, NULL ) );
+    FD_TEST( bench_consumer_total==txn_cnt );
+  } else {
+    while( published<txn_cnt ) {
+      published += fd_ingest_client_publish_batch( client, batch_txn, batch_sz, fd_ulong_min( 8UL, txn_cnt-published ) );
+      consume( wksp, &ring[ 0 ], 8UL, 0 );
+    }
+    consume( wksp, &ring[ 0 ], ULONG_MAX, 0 );
+  }
+  dt += fd_log_wallclock();
+  FD_LOG_NOTICE(( "shm ingest: %lu txns of 192 B in %.3f ms (%.3f Mtxn/s, %.3f ns/txn, %s)",
+                  txn_cnt, (double)dt/1e6, (double)txn_cnt*1e3/(double)dt, (double)dt/(double)txn_cnt,
+                  fd_tile_cnt()>1UL ? "producer and consumer on separate tiles" : "producer and consumer on one tile" ));
+  FD_TEST( ring[ 0 ].seq==client->seq );
+
+  fd_ingest_client_leave( client );
+  ingest_destroy( ingest, ring, RING_CNT );
+  fd_wksp_delete_anonymous( wksp );
+
+  FD_LOG_NOTICE(( "pass" ));
+  fd_halt();
+  return 0;
+}
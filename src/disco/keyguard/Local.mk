@@ -1,3 +1,4 @@
 $(call add-hdrs,fd_keyguard.h fd_keyload.h fd_keyguard_client.h)
 $(call add-objs,fd_keyguard_match fd_keyguard_client fd_keyload,fd_disco)
 $(call make-unit-test,test_keyload,test_keyload,fd_disco fd_util)
+$(call make-unit-test,bench_keyguard,bench_keyguard,fd_disco fd_tango fd_ballet fd_util)
@@ -0,0 +1,144 @@
+/* bench_keyguard measures the round trip of Merkle root signing
+   requests through a keyguard client, with and without batching.
+
+   A second tile plays the part of the sign tile: it copies each
+   request out, authorizes every payload for the leader role and signs
+   them with fd_ed25519_sign_batch, as fd_sign.c does.  Run with at
+   least two tiles, e.g. --tile-cpus 1,2. */
+
+#include "fd_keyguard.h"
+#include "fd_keyguard_client.h"
+#include "../../ballet/ed25519/fd_ed25519.h"
+#include "../../ballet/shred/fd_shred.h"
+
+#define DEPTH (128UL) /* hardcoded in fd_keyguard_client */
+
+static uchar request_mcache_mem [ FD_MCACHE_FOOTPRINT( DEPTH, 0UL ) ] __attribute__((aligned(FD_MCACHE_ALIGN)));
+static uchar response_mcache_mem[ FD_MCACHE_FOOTPRINT( DEPTH, 0UL ) ] __attribute__((aligned(FD_MCACHE_ALIGN)));
+static uchar request_data [ 32UL*FD_KEYGUARD_SIGN_BATCH_MAX ] __attribute__((aligned(128)));
+static uchar response_data[ 64UL*FD_KEYGUARD_SIGN_BATCH_MAX ] __attribute__((aligned(128)));
+
+static fd_frag_meta_t * request_mcache;
+static fd_frag_meta_t * response_mcache;
+
+static uchar private_key[ 32 ];
+static uchar public_key [ 32 ];
+
+static volatile int signer_halt;
+
+static uchar *
+rand_32( fd_rng_t * rng,
+         uchar *    b ) {
+  for( ulong i=0UL; i<32UL; i++ ) b[ i ] = fd_rng_uchar( rng );
+  return b;
+}
+
+static int
+signer_main( int     argc,
+             char ** argv ) {
+  (void)argc; (void)argv;
+
+  fd_sha512_t _sha[1]; fd_sha512_t * sha = fd_sha512_join( fd_sha512_new( _sha ) );
+  uchar data[ 32UL*FD_KEYGUARD_SIGN_BATCH_MAX ];
+
+  ulong seq = 0UL;
+  for(;;) {
+    fd_frag_meta_t const * mline = request_mcache + fd_mcache_line_idx( seq, DEPTH );
+    FD_COMPILER_MFENCE();
+    ulong seq_found = fd_frag_meta_seq_query( mline );
+    if( FD_UNLIKELY( fd_seq_ne( seq_found, seq ) ) ) {
+      if( FD_UNLIKELY( signer_halt ) ) break;
+      FD_SPIN_PAUSE();
+      continue;
+    }
+    ulong cnt = mline->sig;
+    ulong sz  = mline->sz;
+    FD_TEST( cnt>=1UL && cnt<=FD_KEYGUARD_SIGN_BATCH_MAX && sz==32UL*cnt );
+    fd_memcpy( data, request_data, sz );
+
+    uchar const * msgs   [ FD_KEYGUARD_SIGN_BATCH_MAX ];
+    ulong         msg_szs[ FD_KEYGUARD_SIGN_BATCH_MAX ];
+    for( ulong i=0UL; i<cnt; i++ ) {
+      msgs   [ i ] = data + 32UL*i;
+      msg_szs[ i ] = 32UL;
+      FD_TEST( fd_keyguard_payload_authorize( msgs[ i ], 32UL, FD_KEYGUARD_ROLE_LEADER ) );
+    }
+    fd_ed25519_sign_batch( response_data, msgs, msg_szs, cnt, public_key, private_key, sha );
+
+    fd_mcache_publish( response_mcache, DEPTH, seq, 0UL, 0UL, 64UL*cnt, 0UL, 0UL, 0UL );
+    seq = fd_seq_inc( seq, 1UL );
+  }
+
+  fd_sha512_delete( fd_sha512_leave( sha ) );
+  return 0;
+}
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+
+  ulong iter_cnt = fd_env_strip_cmdline_ulong( &argc, &argv, "--iter-cnt", NULL, 16384UL );
+
+  if( FD_UNLIKELY( fd_tile_cnt()<2UL ) ) FD_LOG_ERR(( "this benchmark requires at least 2 tiles" ));
+
+  fd_rng_t _rng[1]; fd_rng_t * rng = fd_rng_join( fd_rng_new( _rng, 0U, 0UL ) );
+  fd_sha512_t _sha[1]; fd_sha512_t * sha = fd_sha512_join( fd_sha512_new( _sha ) );
+
+  fd_ed25519_public_from_private( public_key, rand_32( rng, private_key ), sha );
+
+  request_mcache  = fd_mcache_join( fd_mcache_new( request_mcache_mem,  DEPTH, 0UL, 0UL ) );
+  response_mcache = fd_mcache_join( fd_mcache_new( response_mcache_mem, DEPTH, 0UL, 0UL ) );
+  FD_TEST( request_mcache && response_mcache );
+
+  fd_keyguard_client_t _client[1];
+  fd_keyguard_client_t * client = fd_keyguard_client_join( fd_keyguard_client_new( _client,
+      request_mcache, request_data, response_mcache, response_data ) );
+
+  fd_tile_exec_t * signer = fd_tile_exec_new( 1UL, signer_main, 0, NULL );
+  FD_TEST( signer );
+
+  uchar roots[ FD_KEYGUARD_SIGN_BATCH_MAX ][ 32 ];
+  uchar sigs [ FD_KEYGUARD_SIGN_BATCH_MAX ][ 64 ];
+  for( ulong i=0UL; i<FD_KEYGUARD_SIGN_BATCH_MAX; i++ ) rand_32( rng, roots[ i ] );
+
+  /* Single and batched requests give the same signatures */
+  for( ulong cnt=1UL; cnt<=FD_KEYGUARD_SIGN_BATCH_MAX; cnt++ ) {
+    fd_keyguard_client_sign_batch( client, sigs[ 0 ], roots[ 0 ], 32UL, cnt );
+    for( ulong i=0UL; i<cnt; i++ ) {
+      uchar sig[ 64 ];
+      fd_keyguard_client_sign( client, sig, roots[ i ], 32UL );
+      FD_TEST( fd_memeq( sig, sigs[ i ], 64UL ) );
+      FD_TEST( fd_ed25519_verify( roots[ i ], 32UL, sigs[ i ], public_key, sha )==FD_ED25519_SUCCESS );
+    }
+  }
+
+  /* A full block at the default limits is FD_SHRED_MAX_PER_SLOT data
+     shreds in 32 data shred FEC sets every 400 ms */
+  double fec_set_rate = (double)(FD_SHRED_MAX_PER_SLOT/32UL) / 0.4;
+  FD_LOG_NOTICE(( "leader block rate: %.0f FEC sets/s (%.1f us/FEC set)", fec_set_rate, 1e6/fec_set_rate ));
+
+  for( ulong cnt=1UL; cnt<=FD_KEYGUARD_SIGN_BATCH_MAX; cnt*=2UL ) {
+    ulong req_cnt = fd_ulong_max( iter_cnt/cnt, 1UL );
+    long  dt      = -fd_log_wallclock();
+    for( ulong rem=req_cnt; rem; rem-- ) fd_keyguard_client_sign_batch( client, sigs[ 0 ], roots[ 0 ], 32UL, cnt );
+    dt += fd_log_wallclock();
+    double ns_per_req = (double)dt / (double)req_cnt;
+    double ns_per_sig = ns_per_req / (double)cnt;
+    FD_LOG_NOTICE(( "batch %2lu: %8.1f us/request %8.1f us/FEC set %9.0f sigs/s", cnt, 1e-3*ns_per_req, 1e-3*ns_per_sig, 1e9/ns_per_sig ));
+  }
+
+  signer_halt = 1;
+  int ret;
+  FD_TEST( !fd_tile_exec_delete( signer, &ret ) );
+  FD_TEST( !ret );
+
+  fd_mcache_delete( fd_mcache_leave( response_mcache ) );
+  fd_mcache_delete( fd_mcache_leave( request_mcache  ) );
+  fd_sha512_delete( fd_sha512_leave( sha ) );
+  fd_rng_delete( fd_rng_leave( rng ) );
+
+  FD_LOG_NOTICE(( "pass" ));
+  fd_halt();
+  return 0;
+}
@@ -14,6 +14,14 @@ FD_PROTOTYPES_BEGIN
 
 #define FD_KEYGUARD_SIGN_REQ_MTU (2048UL)
 
+/* FD_KEYGUARD_SIGN_BATCH_MAX is the maximum number of payloads in a
+   single signing request (see fd_keyguard_client_sign_batch).  Only
+   roles with fixed size payloads (FD_KEYGUARD_ROLE_LEADER) accept more
+   than one, and the whole request must still fit in
+   FD_KEYGUARD_SIGN_REQ_MTU. */
+
+#define FD_KEYGUARD_SIGN_BATCH_MAX (16UL)
+
 /* Role definitions ***************************************************/
 
 #define FD_KEYGUARD_ROLE_VOTER   (0)  /* vote transaction sender */
@@ -18,13 +18,14 @@ fd_keyguard_client_new( void *         shmem,
 }
 
 void
-fd_keyguard_client_sign( fd_keyguard_client_t * client,
-                         uchar *                signature,
-                         uchar const *          sign_data,
-                         ulong                  sign_data_len ) {
-  fd_memcpy( client->request_data, sign_data, sign_data_len );
+fd_keyguard_client_sign_batch( fd_keyguard_client_t * client,
+                               uchar *                signatures,
+                               uchar const *          sign_data,
+                               ulong                  sign_data_len,
+                               ulong                  cnt ) {
+  fd_memcpy( client->request_data, sign_data, sign_data_len*cnt );
 
-  fd_mcache_publish( client->request, 128UL, client->request_seq, 0UL, 0UL, sign_data_len, 0UL, 0UL, 0UL );
+  fd_mcache_publish( client->request, 128UL, client->request_seq, cnt, 0UL, sign_data_len*cnt, 0UL, 0UL, 0UL );
   client->request_seq = fd_seq_inc( client->request_seq, 1UL );
 
   fd_frag_meta_t meta;
@@ -36,9 +37,17 @@ fd_keyguard_client_sign( fd_keyguard_client_t * client,
   if( FD_UNLIKELY( !poll_max ) ) FD_LOG_ERR(( "sign request timed out while polling" ));
   if( FD_UNLIKELY( seq_diff ) ) FD_LOG_ERR(( "sign request was overrun while polling" ));
 
-  fd_memcpy( signature, client->response_data, 64UL );
+  fd_memcpy( signatures, client->response_data, 64UL*cnt );
 
   seq_found = fd_frag_meta_seq_query( mline );
   if( FD_UNLIKELY( fd_seq_ne( seq_found, client->response_seq ) ) ) FD_LOG_ERR(( "sign request was overrun while reading" ));
   client->response_seq = fd_seq_inc( client->response_seq, 1UL );
 }
+
+void
+fd_keyguard_client_sign( fd_keyguard_client_t * client,
+                         uchar *                signature,
+                         uchar const *          sign_data,
+                         ulong                  sign_data_len ) {
+  fd_keyguard_client_sign_batch( client, signature, sign_data, sign_data_len, 1UL );
+}
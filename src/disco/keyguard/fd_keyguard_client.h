@@ -82,6 +82,25 @@ fd_keyguard_client_sign( fd_keyguard_client_t * client,
                          uchar const *          sign_data,
                          ulong                  sign_data_len );
 
+/* fd_keyguard_client_sign_batch is fd_keyguard_client_sign for cnt
+   payloads of sign_data_len bytes each, stored back to back at
+   sign_data, in a single round trip to the signing server.  The cnt
+   64 byte signatures are written back to back to signatures.  cnt
+   should be in [1,FD_KEYGUARD_SIGN_BATCH_MAX], and the role of the
+   receiving mcache must accept batches of that size, or the signing
+   server will drop the request and this hangs forever.
+
+   On the wire, a request is a single frag whose sig is the number of
+   payloads and whose sz is the total size of the payloads, and the
+   response holds the signatures in the same order. */
+
+void
+fd_keyguard_client_sign_batch( fd_keyguard_client_t * client,
+                               uchar *                signatures,
+                               uchar const *          sign_data,
+                               ulong                  sign_data_len,
+                               ulong                  cnt );
+
 FD_PROTOTYPES_END
 
 #endif /* HEADER_fd_src_disco_keyguard_fd_keyguard_client_h */
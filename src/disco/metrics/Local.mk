@@ -1,2 +1,4 @@
-$(call add-hdrs,fd_metrics.h)
-$(call add-objs,fd_metrics,fd_disco)
+$(call add-hdrs,fd_metrics.h fd_metrics_snap.h)
+$(call add-objs,fd_metrics fd_metrics_snap,fd_disco)
+$(call make-unit-test,test_metrics_snap,test_metrics_snap,fd_disco fd_tango fd_util)
+$(call run-unit-test,test_metrics_snap,)
@@ -10,6 +10,8 @@
 #include "generated/fd_metrics_poh.h"
 #include "generated/fd_metrics_store.h"
 #include "generated/fd_metrics_shred.h"
+#include "generated/fd_metrics_ingest.h"
+#include "generated/fd_metrics_metric.h"
 
 #include "../../tango/tempo/fd_tempo.h"
 
@@ -0,0 +1,250 @@
+#include "fd_metrics_snap.h"
+
+#define FD_METRICS_SNAP_MAGIC (0xf17eda2c3a5a9000UL) /* firedancer metrics snap ver 0 */
+
+ulong
+fd_metrics_snap_align( void ) {
+  return FD_METRICS_SNAP_ALIGN;
+}
+
+ulong
+fd_metrics_snap_footprint( ulong word_cnt ) {
+  if( FD_UNLIKELY( (!word_cnt) | (word_cnt>(ulong)UINT_MAX) ) ) return 0UL;
+  return FD_METRICS_SNAP_FOOTPRINT( word_cnt );
+}
+
+void *
+fd_metrics_snap_new( void * shmem,
+                     ulong  word_cnt ) {
+
+  if( FD_UNLIKELY( !shmem ) ) {
+    FD_LOG_WARNING(( "NULL shmem" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( !fd_ulong_is_aligned( (ulong)shmem, fd_metrics_snap_align() ) ) ) {
+    FD_LOG_WARNING(( "misaligned shmem" ));
+    return NULL;
+  }
+
+  ulong footprint = fd_metrics_snap_footprint( word_cnt );
+  if( FD_UNLIKELY( !footprint ) ) {
+    FD_LOG_WARNING(( "bad word_cnt" ));
+    return NULL;
+  }
+
+  fd_memset( shmem, 0, footprint );
+
+  fd_metrics_snap_t * snap = (fd_metrics_snap_t *)shmem;
+  snap->word_cnt = word_cnt;
+
+  FD_COMPILER_MFENCE();
+  FD_VOLATILE( snap->magic ) = FD_METRICS_SNAP_MAGIC;
+  FD_COMPILER_MFENCE();
+
+  return shmem;
+}
+
+fd_metrics_snap_t *
+fd_metrics_snap_join( void * shsnap ) {
+
+  if( FD_UNLIKELY( !shsnap ) ) {
+    FD_LOG_WARNING(( "NULL shsnap" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( !fd_ulong_is_aligned( (ulong)shsnap, fd_metrics_snap_align() ) ) ) {
+    FD_LOG_WARNING(( "misaligned shsnap" ));
+    return NULL;
+  }
+
+  fd_metrics_snap_t * snap = (fd_metrics_snap_t *)shsnap;
+
+  if( FD_UNLIKELY( snap->magic!=FD_METRICS_SNAP_MAGIC ) ) {
+    FD_LOG_WARNING(( "bad magic" ));
+    return NULL;
+  }
+
+  return snap;
+}
+
+void *
+fd_metrics_snap_leave( fd_metrics_snap_t const * snap ) {
+
+  if( FD_UNLIKELY( !snap ) ) {
+    FD_LOG_WARNING(( "NULL snap" ));
+    return NULL;
+  }
+
+  return (void *)snap;
+}
+
+void *
+fd_metrics_snap_delete( void * shsnap ) {
+
+  if( FD_UNLIKELY( !shsnap ) ) {
+    FD_LOG_WARNING(( "NULL shsnap" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( !fd_ulong_is_aligned( (ulong)shsnap, fd_metrics_snap_align() ) ) ) {
+    FD_LOG_WARNING(( "misaligned shsnap" ));
+    return NULL;
+  }
+
+  fd_metrics_snap_t * snap = (fd_metrics_snap_t *)shsnap;
+
+  if( FD_UNLIKELY( snap->magic!=FD_METRICS_SNAP_MAGIC ) ) {
+    FD_LOG_WARNING(( "bad magic" ));
+    return NULL;
+  }
+
+  FD_COMPILER_MFENCE();
+  FD_VOLATILE( snap->magic ) = 0UL;
+  FD_COMPILER_MFENCE();
+
+  return (void *)snap;
+}
+
+ulong
+fd_metrics_snap_read( fd_metrics_snap_t const * snap,
+                      ulong *                   out,
+                      long *                    opt_ts,
+                      long *                    opt_tick ) {
+  ulong word_cnt = snap->word_cnt;
+  for(;;) {
+    ulong seq = fd_metrics_snap_seq_query( snap );
+    if( FD_UNLIKELY( !seq ) ) return 0UL;
+
+    ulong const * buf = fd_metrics_snap_buf_const( snap, seq );
+    for( ulong i=0UL; i<word_cnt; i++ ) out[ i ] = FD_VOLATILE_CONST( buf[ i ] );
+    long ts   = FD_VOLATILE_CONST( snap->ts  [ seq&1UL ] );
+    long tick = FD_VOLATILE_CONST( snap->tick[ seq&1UL ] );
+
+    /* The writer only starts overwriting the buffer of snapshot seq
+       when it prepares snapshot seq+2. */
+
+    FD_COMPILER_MFENCE();
+    ulong wseq = FD_VOLATILE_CONST( snap->wseq );
+    FD_COMPILER_MFENCE();
+    if( FD_UNLIKELY( wseq>=seq+2UL ) ) {
+      FD_SPIN_PAUSE();
+      continue;
+    }
+
+    if( opt_ts   ) *opt_ts   = ts;
+    if( opt_tick ) *opt_tick = tick;
+    return seq;
+  }
+}
+
+static inline uchar *
+varint_enc( uchar * p,
+            ulong   x ) {
+  while( x>=0x80UL ) {
+    *p++ = (uchar)(x | 0x80UL);
+    x >>= 7;
+  }
+  *p++ = (uchar)x;
+  return p;
+}
+
+/* varint_dec decodes a varint at p, which is followed by end-p bytes.
+   Returns the byte after the varint, or NULL if it is truncated or
+   longer than a ulong. */
+
+static inline uchar const *
+varint_dec( uchar const * p,
+            uchar const * end,
+            ulong *       _x ) {
+  ulong x = 0UL;
+  for( ulong shift=0UL; shift<64UL; shift+=7UL ) {
+    if( FD_UNLIKELY( p>=end ) ) return NULL;
+    ulong b = (ulong)*p++;
+    x |= (b & 0x7fUL) << shift;
+    if( FD_LIKELY( !(b & 0x80UL) ) ) {
+      *_x = x;
+      return p;
+    }
+  }
+  return NULL;
+}
+
+ulong
+fd_metrics_snap_msg_encode( ulong const * prev,
+                            ulong const * cur,
+                            ulong         word_cnt,
+                            ulong         word_lo,
+                            ulong         seq,
+                            long          ts,
+                            long          tick,
+                            uchar *       out,
+                            ulong         out_max,
+                            ulong *       out_sz ) {
+  uchar * p   = out + sizeof(fd_metrics_snap_msg_hdr_t);
+  uchar * end = out + out_max - 20UL; /* Room for a worst case pair */
+
+  ulong next = word_lo; /* First word not yet covered by a pair */
+  ulong i    = word_lo;
+  for( ; i<word_cnt; i++ ) {
+    ulong delta = cur[ i ] - (prev ? prev[ i ] : 0UL);
+    if( FD_LIKELY( !delta ) ) continue;
+    if( FD_UNLIKELY( p>end ) ) break;
+
+    long d = (long)delta;
+    p = varint_enc( p, i-next );
+    p = varint_enc( p, ((ulong)d<<1) ^ (ulong)(d>>63) );
+    next = i+1UL;
+  }
+
+  fd_metrics_snap_msg_hdr_t * hdr = (fd_metrics_snap_msg_hdr_t *)out;
+  hdr->magic    = FD_METRICS_SNAP_MSG_MAGIC;
+  hdr->seq      = seq;
+  hdr->ts       = ts;
+  hdr->tick     = tick;
+  hdr->word_cnt = (uint)word_cnt;
+  hdr->word_lo  = (uint)word_lo;
+  hdr->word_hi  = (uint)i;
+  hdr->flags    = fd_uint_if( !prev,        FD_METRICS_SNAP_MSG_FLAG_KEY,  0U ) |
+                  fd_uint_if( i==word_cnt,  FD_METRICS_SNAP_MSG_FLAG_LAST, 0U );
+
+  *out_sz = (ulong)(p - out);
+  return i;
+}
+
+int
+fd_metrics_snap_msg_apply( uchar const *               msg,
+                           ulong                       sz,
+                           ulong *                     words,
+                           ulong                       word_cnt,
+                           fd_metrics_snap_msg_hdr_t * opt_hdr ) {
+  if( FD_UNLIKELY( sz<sizeof(fd_metrics_snap_msg_hdr_t) ) ) return -1;
+
+  fd_metrics_snap_msg_hdr_t hdr[1];
+  fd_memcpy( hdr, msg, sizeof(fd_metrics_snap_msg_hdr_t) );
+  if( FD_UNLIKELY( hdr->magic!=FD_METRICS_SNAP_MSG_MAGIC ) ) return -1;
+  if( FD_UNLIKELY( hdr->word_cnt!=word_cnt                ) ) return -1;
+  if( FD_UNLIKELY( hdr->word_lo>hdr->word_hi              ) ) return -1;
+  if( FD_UNLIKELY( hdr->word_hi>word_cnt                  ) ) return -1;
+
+  if( FD_UNLIKELY( hdr->flags & FD_METRICS_SNAP_MSG_FLAG_KEY ) ) {
+    fd_memset( words+hdr->word_lo, 0, (hdr->word_hi-hdr->word_lo)*sizeof(ulong) );
+  }
+
+  uchar const * p    = msg + sizeof(fd_metrics_snap_msg_hdr_t);
+  uchar const * end  = msg + sz;
+  ulong         next = hdr->word_lo;
+  while( p<end ) {
+    ulong gap, z;
+    p = varint_dec( p, end, &gap ); if( FD_UNLIKELY( !p ) ) return -1;
+    p = varint_dec( p, end, &z   ); if( FD_UNLIKELY( !p ) ) return -1;
+    if( FD_UNLIKELY( gap>=hdr->word_hi-next ) ) return -1;
+
+    ulong i = next+gap;
+    words[ i ] += (z>>1) ^ (-(z&1UL));
+    next = i+1UL;
+  }
+
+  if( opt_hdr ) *opt_hdr = *hdr;
+  return 0;
+}
@@ -1,2 +1,2 @@
 $(call add-hdrs,fd_metrics_all.h fd_metrics_quic.h)
-$(call add-objs,fd_metrics_all fd_metrics_quic fd_metrics_pack fd_metrics_bank fd_metrics_poh fd_metrics_store fd_metrics_shred,fd_disco)
+$(call add-objs,fd_metrics_all fd_metrics_quic fd_metrics_pack fd_metrics_bank fd_metrics_poh fd_metrics_store fd_metrics_shred fd_metrics_ingest fd_metrics_metric,fd_disco)
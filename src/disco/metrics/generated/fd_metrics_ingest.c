@@ -0,0 +1,7 @@
+/* THIS FILE IS GENERATED BY gen_metrics.py. DO NOT HAND EDIT. */
+#include "fd_metrics_ingest.h"
+
+const fd_metrics_meta_t FD_METRICS_INGEST[FD_METRICS_INGEST_TOTAL] = {
+    DECLARE_METRIC_COUNTER( INGEST_TILE, TRANSACTIONS_RECEIVED ),
+    DECLARE_METRIC_COUNTER( INGEST_TILE, TRANSACTIONS_DROPPED ),
+};
@@ -0,0 +1,17 @@
+/* THIS FILE IS GENERATED BY gen_metrics.py. DO NOT HAND EDIT. */
+
+#include "../fd_metrics_base.h"
+
+#define FD_METRICS_COUNTER_INGEST_TILE_TRANSACTIONS_RECEIVED_OFF  (174UL)
+#define FD_METRICS_COUNTER_INGEST_TILE_TRANSACTIONS_RECEIVED_NAME "ingest_tile_transactions_received"
+#define FD_METRICS_COUNTER_INGEST_TILE_TRANSACTIONS_RECEIVED_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_INGEST_TILE_TRANSACTIONS_RECEIVED_DESC "Count of transactions received from shared memory ingest clients and passed on to verify"
+
+#define FD_METRICS_COUNTER_INGEST_TILE_TRANSACTIONS_DROPPED_OFF  (175UL)
+#define FD_METRICS_COUNTER_INGEST_TILE_TRANSACTIONS_DROPPED_NAME "ingest_tile_transactions_dropped"
+#define FD_METRICS_COUNTER_INGEST_TILE_TRANSACTIONS_DROPPED_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_INGEST_TILE_TRANSACTIONS_DROPPED_DESC "Count of transactions dropped because the client published a fragment with a bad chunk or size"
+
+
+#define FD_METRICS_INGEST_TOTAL (2UL)
+extern const fd_metrics_meta_t FD_METRICS_INGEST[FD_METRICS_INGEST_TOTAL];
@@ -0,0 +1,12 @@
+/* THIS FILE IS GENERATED BY gen_metrics.py. DO NOT HAND EDIT. */
+#include "fd_metrics_metric.h"
+
+const fd_metrics_meta_t FD_METRICS_METRIC[FD_METRICS_METRIC_TOTAL] = {
+    DECLARE_METRIC_COUNTER( METRIC, SNAPSHOT_COUNT ),
+    DECLARE_METRIC_HISTOGRAM_SECONDS( METRIC, SNAPSHOT_COPY_DURATION_SECONDS ),
+    DECLARE_METRIC_HISTOGRAM_SECONDS( METRIC, SNAPSHOT_STREAM_DURATION_SECONDS ),
+    DECLARE_METRIC_GAUGE( METRIC, SNAPSHOT_STREAM_CLIENTS ),
+    DECLARE_METRIC_COUNTER( METRIC, SNAPSHOT_STREAM_BYTES ),
+    DECLARE_METRIC_COUNTER( METRIC, SNAPSHOT_STREAM_KEYFRAMES ),
+    DECLARE_METRIC_COUNTER( METRIC, SNAPSHOT_STREAM_RESYNC ),
+};
@@ -0,0 +1,48 @@
+/* THIS FILE IS GENERATED BY gen_metrics.py. DO NOT HAND EDIT. */
+
+#include "../fd_metrics_base.h"
+
+#define FD_METRICS_COUNTER_METRIC_SNAPSHOT_COUNT_OFF  (174UL)
+#define FD_METRICS_COUNTER_METRIC_SNAPSHOT_COUNT_NAME "metric_snapshot_count"
+#define FD_METRICS_COUNTER_METRIC_SNAPSHOT_COUNT_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_METRIC_SNAPSHOT_COUNT_DESC "Number of snapshots taken of the metrics of all tiles"
+
+#define FD_METRICS_HISTOGRAM_METRIC_SNAPSHOT_COPY_DURATION_SECONDS_OFF  (175UL)
+#define FD_METRICS_HISTOGRAM_METRIC_SNAPSHOT_COPY_DURATION_SECONDS_NAME "metric_snapshot_copy_duration_seconds"
+#define FD_METRICS_HISTOGRAM_METRIC_SNAPSHOT_COPY_DURATION_SECONDS_TYPE (FD_METRICS_TYPE_HISTOGRAM)
+#define FD_METRICS_HISTOGRAM_METRIC_SNAPSHOT_COPY_DURATION_SECONDS_DESC "Duration of copying the metrics of all tiles into a snapshot"
+#define FD_METRICS_HISTOGRAM_METRIC_SNAPSHOT_COPY_DURATION_SECONDS_MIN  (1e-07)
+#define FD_METRICS_HISTOGRAM_METRIC_SNAPSHOT_COPY_DURATION_SECONDS_MAX  (0.001)
+#define FD_METRICS_HISTOGRAM_METRIC_SNAPSHOT_COPY_DURATION_SECONDS_CVT  (FD_METRICS_CONVERTER_SECONDS)
+
+#define FD_METRICS_HISTOGRAM_METRIC_SNAPSHOT_STREAM_DURATION_SECONDS_OFF  (192UL)
+#define FD_METRICS_HISTOGRAM_METRIC_SNAPSHOT_STREAM_DURATION_SECONDS_NAME "metric_snapshot_stream_duration_seconds"
+#define FD_METRICS_HISTOGRAM_METRIC_SNAPSHOT_STREAM_DURATION_SECONDS_TYPE (FD_METRICS_TYPE_HISTOGRAM)
+#define FD_METRICS_HISTOGRAM_METRIC_SNAPSHOT_STREAM_DURATION_SECONDS_DESC "Duration of delta encoding a snapshot and sending it to the stream clients"
+#define FD_METRICS_HISTOGRAM_METRIC_SNAPSHOT_STREAM_DURATION_SECONDS_MIN  (1e-07)
+#define FD_METRICS_HISTOGRAM_METRIC_SNAPSHOT_STREAM_DURATION_SECONDS_MAX  (0.01)
+#define FD_METRICS_HISTOGRAM_METRIC_SNAPSHOT_STREAM_DURATION_SECONDS_CVT  (FD_METRICS_CONVERTER_SECONDS)
+
+#define FD_METRICS_GAUGE_METRIC_SNAPSHOT_STREAM_CLIENTS_OFF  (209UL)
+#define FD_METRICS_GAUGE_METRIC_SNAPSHOT_STREAM_CLIENTS_NAME "metric_snapshot_stream_clients"
+#define FD_METRICS_GAUGE_METRIC_SNAPSHOT_STREAM_CLIENTS_TYPE (FD_METRICS_TYPE_GAUGE)
+#define FD_METRICS_GAUGE_METRIC_SNAPSHOT_STREAM_CLIENTS_DESC "Number of clients connected to the snapshot stream"
+
+#define FD_METRICS_COUNTER_METRIC_SNAPSHOT_STREAM_BYTES_OFF  (210UL)
+#define FD_METRICS_COUNTER_METRIC_SNAPSHOT_STREAM_BYTES_NAME "metric_snapshot_stream_bytes"
+#define FD_METRICS_COUNTER_METRIC_SNAPSHOT_STREAM_BYTES_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_METRIC_SNAPSHOT_STREAM_BYTES_DESC "Total bytes of snapshot messages sent to stream clients"
+
+#define FD_METRICS_COUNTER_METRIC_SNAPSHOT_STREAM_KEYFRAMES_OFF  (211UL)
+#define FD_METRICS_COUNTER_METRIC_SNAPSHOT_STREAM_KEYFRAMES_NAME "metric_snapshot_stream_keyframes"
+#define FD_METRICS_COUNTER_METRIC_SNAPSHOT_STREAM_KEYFRAMES_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_METRIC_SNAPSHOT_STREAM_KEYFRAMES_DESC "Number of keyframes sent to stream clients"
+
+#define FD_METRICS_COUNTER_METRIC_SNAPSHOT_STREAM_RESYNC_OFF  (212UL)
+#define FD_METRICS_COUNTER_METRIC_SNAPSHOT_STREAM_RESYNC_NAME "metric_snapshot_stream_resync"
+#define FD_METRICS_COUNTER_METRIC_SNAPSHOT_STREAM_RESYNC_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_METRIC_SNAPSHOT_STREAM_RESYNC_DESC "Number of times a stream client could not keep up and was resynchronized with a keyframe"
+
+
+#define FD_METRICS_METRIC_TOTAL (7UL)
+extern const fd_metrics_meta_t FD_METRICS_METRIC[FD_METRICS_METRIC_TOTAL];
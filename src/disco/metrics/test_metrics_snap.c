@@ -0,0 +1,228 @@
+#include "fd_metrics_snap.h"
+
+FD_STATIC_ASSERT( FD_METRICS_SNAP_ALIGN==128UL,                            unit_test );
+FD_STATIC_ASSERT( FD_METRICS_SNAP_FOOTPRINT( 1000UL )==128UL+16000UL,      unit_test );
+FD_STATIC_ASSERT( sizeof(fd_metrics_snap_t)==128UL,                        unit_test );
+FD_STATIC_ASSERT( sizeof(fd_metrics_snap_msg_hdr_t)==48UL,                 unit_test );
+
+/* A topology shaped set of tiles: in and out link counts of each. */
+
+#define TILE_CNT (20UL)
+
+static ulong const tile_in [ TILE_CNT ] = { 3, 3, 2, 2, 2, 2, 6, 2, 5, 4, 4, 4, 4, 3, 2, 2, 1, 0, 1, 0 };
+static ulong const tile_out[ TILE_CNT ] = { 0, 0, 2, 2, 1, 1, 1, 1, 4, 1, 1, 1, 1, 1, 2, 1, 1, 0, 0, 0 };
+
+#define METRICS_MAX (FD_METRICS_FOOTPRINT( 6UL, 4UL ))
+#define WORD_MAX    (TILE_CNT*METRICS_MAX/sizeof(ulong))
+
+static uchar metrics_mem[ TILE_CNT ][ METRICS_MAX ] __attribute__((aligned(FD_METRICS_ALIGN)));
+static uchar snap_mem   [ FD_METRICS_SNAP_FOOTPRINT( WORD_MAX ) ] __attribute__((aligned(FD_METRICS_SNAP_ALIGN)));
+static uchar msg        [ 4096UL ];
+static ulong words      [ WORD_MAX ];
+static ulong out        [ WORD_MAX ];
+
+/* take copies the metrics of all tiles into a new snapshot. */
+
+static ulong
+take( fd_metrics_snap_t * snap,
+      ulong **            metrics,
+      long                ts ) {
+  ulong * dst = fd_metrics_snap_prepare( snap );
+  for( ulong i=0UL; i<TILE_CNT; i++ ) dst = fd_metrics_snap_copy( dst, metrics[ i ] );
+  FD_TEST( dst==fd_metrics_snap_buf( snap, snap->wseq )+fd_metrics_snap_word_cnt( snap ) );
+  return fd_metrics_snap_publish( snap, ts, ts+1L );
+}
+
+/* stream encodes the latest snapshot as messages of at most msg_max
+   bytes and applies them to words.  Returns the total size. */
+
+static ulong
+stream( fd_metrics_snap_t * snap,
+        int                 key,
+        ulong               msg_max ) {
+  ulong         seq      = fd_metrics_snap_seq_query( snap );
+  ulong         word_cnt = fd_metrics_snap_word_cnt( snap );
+  ulong const * cur      = fd_metrics_snap_buf( snap, seq     );
+  ulong const * prev     = fd_metrics_snap_buf( snap, seq-1UL );
+
+  ulong total = 0UL;
+  ulong lo    = 0UL;
+  do {
+    ulong sz;
+    ulong hi = fd_metrics_snap_msg_encode( key ? NULL : prev, cur, word_cnt, lo, seq, (long)seq, (long)seq+1L, msg, msg_max, &sz );
+    FD_TEST( hi>lo && hi<=word_cnt && sz<=msg_max );
+
+    fd_metrics_snap_msg_hdr_t hdr[1];
+    FD_TEST( !fd_metrics_snap_msg_apply( msg, sz, words, word_cnt, hdr ) );
+    FD_TEST( hdr->seq==seq && hdr->ts==(long)seq && hdr->tick==(long)seq+1L );
+    FD_TEST( hdr->word_lo==lo && hdr->word_hi==hi );
+    FD_TEST( !!(hdr->flags & FD_METRICS_SNAP_MSG_FLAG_KEY )==!!key         );
+    FD_TEST( !!(hdr->flags & FD_METRICS_SNAP_MSG_FLAG_LAST)==(hi==word_cnt) );
+
+    total += sz;
+    lo     = hi;
+  } while( lo<word_cnt );
+  return total;
+}
+
+/* mutate updates about one in 32 of the tile metrics of each tile the
+   way a running tile would: mostly counter increments, some gauges
+   going either way. */
+
+static void
+mutate( fd_rng_t * rng,
+        ulong **   metrics ) {
+  for( ulong i=0UL; i<TILE_CNT; i++ ) {
+    ulong cnt = FD_METRICS_SNAP_TILE_WORD_CNT( metrics[ i ][ 0 ], metrics[ i ][ 1 ] );
+    for( ulong j=2UL; j<cnt; j++ ) {
+      if( FD_LIKELY( fd_rng_uint_roll( rng, 32U ) ) ) continue;
+      if( FD_LIKELY( fd_rng_uint_roll( rng, 4U ) ) ) metrics[ i ][ j ] += fd_rng_ulong_roll( rng, 1000UL );
+      else                                           metrics[ i ][ j ]  = fd_rng_ulong( rng );
+    }
+  }
+}
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+
+  fd_rng_t _rng[1]; fd_rng_t * rng = fd_rng_join( fd_rng_new( _rng, 0U, 0UL ) );
+
+  ulong * metrics[ TILE_CNT ];
+  ulong   word_cnt = 0UL;
+  for( ulong i=0UL; i<TILE_CNT; i++ ) {
+    metrics[ i ] = fd_metrics_join( fd_metrics_new( metrics_mem[ i ], tile_in[ i ], tile_out[ i ] ) );
+    word_cnt += FD_METRICS_SNAP_TILE_WORD_CNT( tile_in[ i ], tile_out[ i ] );
+  }
+  FD_TEST( word_cnt<=WORD_MAX );
+
+  FD_TEST( fd_metrics_snap_align()==FD_METRICS_SNAP_ALIGN );
+  FD_TEST( !fd_metrics_snap_footprint( 0UL                  ) );
+  FD_TEST( !fd_metrics_snap_footprint( (ulong)UINT_MAX+1UL  ) );
+  FD_TEST( fd_metrics_snap_footprint( word_cnt )==FD_METRICS_SNAP_FOOTPRINT( word_cnt ) );
+
+  FD_TEST( !fd_metrics_snap_new( NULL,       word_cnt ) );
+  FD_TEST( !fd_metrics_snap_new( snap_mem+1, word_cnt ) );
+  FD_TEST( !fd_metrics_snap_new( snap_mem,   0UL      ) );
+
+  void *              shsnap = fd_metrics_snap_new( snap_mem, word_cnt ); FD_TEST( shsnap );
+  fd_metrics_snap_t * snap   = fd_metrics_snap_join( shsnap );          FD_TEST( snap );
+
+  FD_TEST( !fd_metrics_snap_join( NULL          ) );
+  FD_TEST( !fd_metrics_snap_join( (void *)0x1UL ) );
+
+  FD_TEST( fd_metrics_snap_word_cnt( snap )==word_cnt );
+  FD_TEST( !fd_metrics_snap_seq_query( snap ) );
+  FD_TEST( !fd_metrics_snap_read( snap, out, NULL, NULL ) );
+
+  /* Snapshots are exact copies of the regions, back to back, and
+     alternate between the buffers. */
+
+  for( ulong seq=1UL; seq<=4UL; seq++ ) {
+    mutate( rng, metrics );
+    FD_TEST( take( snap, metrics, (long)(100UL*seq) )==seq );
+    FD_TEST( fd_metrics_snap_seq_query( snap )==seq );
+
+    long ts, tick;
+    FD_TEST( fd_metrics_snap_read( snap, out, &ts, &tick )==seq );
+    FD_TEST( ts==(long)(100UL*seq) && tick==ts+1L );
+
+    ulong off = 0UL;
+    for( ulong i=0UL; i<TILE_CNT; i++ ) {
+      ulong cnt = FD_METRICS_SNAP_TILE_WORD_CNT( tile_in[ i ], tile_out[ i ] );
+      FD_TEST( out[ off ]==tile_in[ i ] && out[ off+1UL ]==tile_out[ i ] );
+      FD_TEST( !memcmp( out+off, metrics[ i ], cnt*sizeof(ulong) ) );
+      off += cnt;
+    }
+    FD_TEST( off==word_cnt );
+    FD_TEST( fd_metrics_snap_buf( snap, seq )==(ulong *)(snap+1)+(seq&1UL)*word_cnt );
+  }
+
+  /* A reader copying the latest snapshot while the writer has only
+     prepared the next one is not overrun. */
+
+  fd_metrics_snap_prepare( snap );
+  FD_TEST( fd_metrics_snap_read( snap, out, NULL, NULL )==4UL );
+  fd_metrics_snap_publish( snap, 500L, 501L );
+
+  /* Keyframes reconstruct the snapshot from any state, in one message
+     or split over many small ones. */
+
+  ulong msg_max[ 3 ] = { sizeof(msg), 512UL, FD_METRICS_SNAP_MSG_MIN };
+  for( ulong k=0UL; k<3UL; k++ ) {
+    for( ulong i=0UL; i<word_cnt; i++ ) words[ i ] = fd_rng_ulong( rng );
+    stream( snap, 1, msg_max[ k ] );
+    FD_TEST( !memcmp( words, fd_metrics_snap_buf( snap, 5UL ), word_cnt*sizeof(ulong) ) );
+  }
+
+  /* Deltas track a stream of snapshots. */
+
+  for( ulong iter=0UL; iter<64UL; iter++ ) {
+    mutate( rng, metrics );
+    take( snap, metrics, 0L );
+    stream( snap, 0, msg_max[ iter%3UL ] );
+    FD_TEST( !memcmp( words, fd_metrics_snap_buf( snap, fd_metrics_snap_seq_query( snap ) ), word_cnt*sizeof(ulong) ) );
+  }
+
+  /* An unchanged snapshot is just the headers. */
+
+  take( snap, metrics, 0L );
+  FD_TEST( stream( snap, 0, sizeof(msg) )==sizeof(fd_metrics_snap_msg_hdr_t) );
+
+  /* Malformed messages are rejected. */
+
+  ulong sz;
+  mutate( rng, metrics );
+  take( snap, metrics, 0L );
+  ulong seq = fd_metrics_snap_seq_query( snap );
+  FD_TEST( fd_metrics_snap_msg_encode( NULL, fd_metrics_snap_buf( snap, seq ), word_cnt, 0UL, seq, 0L, 0L, msg, 512UL, &sz )<word_cnt );
+  FD_TEST( !fd_metrics_snap_msg_apply( msg, sz, words, word_cnt, NULL ) );
+  FD_TEST(  fd_metrics_snap_msg_apply( msg, sz, words, word_cnt-1UL, NULL )==-1 );
+  FD_TEST(  fd_metrics_snap_msg_apply( msg, sizeof(fd_metrics_snap_msg_hdr_t)-1UL, words, word_cnt, NULL )==-1 );
+  msg[ sz-1UL ] |= (uchar)0x80; /* Truncated varint */
+  FD_TEST(  fd_metrics_snap_msg_apply( msg, sz, words, word_cnt, NULL )==-1 );
+  ((fd_metrics_snap_msg_hdr_t *)msg)->word_hi = 0U; /* Pairs past word_hi */
+  FD_TEST(  fd_metrics_snap_msg_apply( msg, sz, words, word_cnt, NULL )==-1 );
+  ((fd_metrics_snap_msg_hdr_t *)msg)->magic = 0UL;
+  FD_TEST(  fd_metrics_snap_msg_apply( msg, sz, words, word_cnt, NULL )==-1 );
+
+  /* Overhead of taking and delta encoding a snapshot of the whole
+     topology, as the metric tile does every period. */
+
+  ulong iter_cnt  = 1000UL;
+  long  copy_dt   = 0L;
+  long  encode_dt = 0L;
+  ulong bytes     = 0UL;
+  for( ulong iter=0UL; iter<iter_cnt; iter++ ) {
+    mutate( rng, metrics );
+    long t0 = fd_log_wallclock();
+    take( snap, metrics, 0L );
+    long t1 = fd_log_wallclock();
+
+    seq = fd_metrics_snap_seq_query( snap );
+    ulong lo = 0UL;
+    do {
+      lo = fd_metrics_snap_msg_encode( fd_metrics_snap_buf( snap, seq-1UL ), fd_metrics_snap_buf( snap, seq ), word_cnt, lo, seq, 0L, 0L, msg, sizeof(msg), &sz );
+      bytes += sz;
+    } while( lo<word_cnt );
+    long t2 = fd_log_wallclock();
+
+    copy_dt   += t1-t0;
+    encode_dt += t2-t1;
+  }
+  FD_LOG_NOTICE(( "%lu words (%lu KiB) per snapshot: copy %.1f us, delta encode %.1f us, %.1f KiB per delta (1/32 words changed)",
+                  word_cnt, word_cnt*sizeof(ulong)/1024UL,
+                  1e-3*(double)copy_dt/(double)iter_cnt, 1e-3*(double)encode_dt/(double)iter_cnt,
+                  (double)bytes/1024./(double)iter_cnt ));
+
+  FD_TEST( fd_metrics_snap_leave( snap )==shsnap );
+  FD_TEST( fd_metrics_snap_delete( shsnap )==snap_mem );
+  FD_TEST( !fd_metrics_snap_join( shsnap ) );
+
+  fd_rng_delete( fd_rng_leave( rng ) );
+
+  FD_LOG_NOTICE(( "pass" ));
+  fd_halt();
+  return 0;
+}
@@ -1,4 +1,20 @@
 #include "fd_mux.h"
+#include "../prof/fd_prof.h"
+
+/* FD_MUX_PROF_CALL invokes a user callback.  If the tile registered a
+   prof (see fd_prof.h), the TSC stamped enter / exit of the callback is
+   recorded.  When profiling is disabled, this costs a single well
+   predicted branch per callback. */
+
+#define FD_MUX_PROF_CALL( evt, in_idx, call ) do {                       \
+    if( FD_UNLIKELY( prof ) ) {                                          \
+      long _prof_t0 = fd_tickcount();                                    \
+      call;                                                              \
+      fd_prof_record( prof, (evt), (in_idx), _prof_t0, fd_tickcount() ); \
+    } else {                                                             \
+      call;                                                              \
+    }                                                                    \
+  } while(0)
 
 /* A fd_mux_tile_in has all the state needed for muxing frags from an
    in.  It fits on exactly one cache line. */
@@ -142,6 +158,9 @@ fd_mux_tile( fd_cnc_t *              cnc,
   fd_histf_t hist_fin_ticks[1];
   fd_histf_t hist_fin_frag_sz[1];
 
+  /* profiling state */
+  fd_prof_t * prof = fd_prof_tl; /* NULL if this tile is not being profiled */
+
   do {
 
     FD_LOG_INFO(( "Booting mux (in-cnt %lu, out-cnt %lu)", in_cnt, out_cnt ));
@@ -449,7 +468,7 @@ fd_mux_tile( fd_cnc_t *              cnc,
         FD_MHIST_COPY( STEM, FRAGMENT_FILTERED_SIZE_BYTES,                 hist_filter2_frag_sz );
         FD_MHIST_COPY( STEM, LOOP_FINISH_DURATION_SECONDS,                 hist_fin_ticks );
         FD_MHIST_COPY( STEM, FRAGMENT_HANDLED_SIZE_BYTES,                  hist_fin_frag_sz );
-        if( FD_LIKELY( callbacks->metrics_write ) ) callbacks->metrics_write( ctx );
+        if( FD_LIKELY( callbacks->metrics_write ) ) FD_MUX_PROF_CALL( FD_PROF_EVT_METRICS_WRITE, FD_PROF_IN_IDX_NONE, callbacks->metrics_write( ctx ) );
         FD_COMPILER_MFENCE();
         metric_backp_cnt = 0UL;
 
@@ -487,7 +506,7 @@ fd_mux_tile( fd_cnc_t *              cnc,
         }
 
         /* user callback */
-        if( FD_UNLIKELY( callbacks->during_housekeeping ) ) callbacks->during_housekeeping( ctx );
+        if( FD_UNLIKELY( callbacks->during_housekeeping ) ) FD_MUX_PROF_CALL( FD_PROF_EVT_DURING_HOUSEKEEPING, FD_PROF_IN_IDX_NONE, callbacks->during_housekeeping( ctx ) );
       }
 
       /* Select which event to do next (randomized round robin) and
@@ -523,6 +542,7 @@ fd_mux_tile( fd_cnc_t *              cnc,
       /* Reload housekeeping timer */
       long next = fd_tickcount();
       fd_histf_sample( hist_housekeeping_ticks, (ulong)(next - now) );
+      if( FD_UNLIKELY( prof ) ) fd_prof_record( prof, FD_PROF_EVT_HOUSEKEEPING, FD_PROF_IN_IDX_NONE, now, next );
       then = now + (long)fd_tempo_async_reload( rng, async_min );
       now = next;
     }
@@ -535,7 +555,7 @@ fd_mux_tile( fd_cnc_t *              cnc,
       .cr_decrement_amount = fd_ulong_if( out_cnt>0UL, 1UL, 0UL ),
     };
 
-    if( FD_LIKELY( callbacks->before_credit ) ) callbacks->before_credit( ctx, &mux );
+    if( FD_LIKELY( callbacks->before_credit ) ) FD_MUX_PROF_CALL( FD_PROF_EVT_BEFORE_CREDIT, FD_PROF_IN_IDX_NONE, callbacks->before_credit( ctx, &mux ) );
 
     /* Check if we are backpressured.  If so, count any transition into
        a backpressured regime and spin to wait for flow control credits
@@ -556,7 +576,7 @@ fd_mux_tile( fd_cnc_t *              cnc,
     }
     metric_in_backp = 0UL;
 
-    if( FD_LIKELY( callbacks->after_credit ) ) callbacks->after_credit( ctx, &mux );
+    if( FD_LIKELY( callbacks->after_credit ) ) FD_MUX_PROF_CALL( FD_PROF_EVT_AFTER_CREDIT, FD_PROF_IN_IDX_NONE, callbacks->after_credit( ctx, &mux ) );
 
     /* Select which in to poll next (randomized round robin) */
 
@@ -604,7 +624,7 @@ fd_mux_tile( fd_cnc_t *              cnc,
     ulong sig = fd_frag_meta_sse0_sig( seq_sig );
     if( FD_UNLIKELY( callbacks->before_frag ) ) {
       int filter = 0;
-      callbacks->before_frag( ctx, (ulong)this_in->idx, seq_found, sig, &filter );
+      FD_MUX_PROF_CALL( FD_PROF_EVT_BEFORE_FRAG, this_in->idx, callbacks->before_frag( ctx, (ulong)this_in->idx, seq_found, sig, &filter ) );
       if( FD_UNLIKELY( filter ) ) {
         if( FD_UNLIKELY( !(flags & FD_MUX_FLAG_COPY) ) ) cr_filt += (ulong)(cr_avail<cr_max);
         this_in_seq    = fd_seq_inc( this_in_seq, 1UL );
@@ -635,7 +655,7 @@ fd_mux_tile( fd_cnc_t *              cnc,
     FD_COMPILER_MFENCE();
 
     int filter = 0;
-    if( FD_LIKELY( callbacks->during_frag ) ) callbacks->during_frag( ctx, (ulong)this_in->idx, seq_found, sig, chunk, sz, &filter );
+    if( FD_LIKELY( callbacks->during_frag ) ) FD_MUX_PROF_CALL( FD_PROF_EVT_DURING_FRAG, this_in->idx, callbacks->during_frag( ctx, (ulong)this_in->idx, seq_found, sig, chunk, sz, &filter ) );
 
     if( FD_UNLIKELY( fd_seq_ne( seq_test, seq_found ) ) ) { /* Overrun while reading (impossible if this_in honoring our fctl) */
       this_in->seq = seq_test; /* Resume from here (probably reasonably current, could query in mcache sync instead) */
@@ -653,7 +673,7 @@ fd_mux_tile( fd_cnc_t *              cnc,
       /* We have successfully loaded the metadata.  Decide whether it
           is interesting downstream and publish or filter accordingly. */
 
-      if( FD_LIKELY( callbacks->after_frag ) ) callbacks->after_frag( ctx, (ulong)this_in->idx, seq_found, &sig, &chunk, &out_sz, &out_tsorig, &filter, &mux );
+      if( FD_LIKELY( callbacks->after_frag ) ) FD_MUX_PROF_CALL( FD_PROF_EVT_AFTER_FRAG, this_in->idx, callbacks->after_frag( ctx, (ulong)this_in->idx, seq_found, &sig, &chunk, &out_sz, &out_tsorig, &filter, &mux ) );
     }
 
     long next = fd_tickcount();
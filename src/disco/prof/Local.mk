@@ -0,0 +1,4 @@
+$(call add-hdrs,fd_prof.h)
+$(call add-objs,fd_prof,fd_disco)
+$(call make-unit-test,test_prof,test_prof,fd_disco fd_tango fd_util)
+$(call run-unit-test,test_prof,)
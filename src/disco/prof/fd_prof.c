@@ -0,0 +1,145 @@
+#include "fd_prof.h"
+
+#define FD_PROF_MAGIC (0xf17eda2c3770f000UL) /* firedancer prof ver 0 */
+
+FD_TL fd_prof_t * fd_prof_tl;
+
+ulong
+fd_prof_align( void ) {
+  return FD_PROF_ALIGN;
+}
+
+ulong
+fd_prof_footprint( ulong depth ) {
+  if( FD_UNLIKELY( (depth<FD_PROF_DEPTH_MIN) | !fd_ulong_is_pow2( depth ) ) ) return 0UL;
+  if( FD_UNLIKELY( depth>((ULONG_MAX-FD_PROF_FOOTPRINT( 0UL ))/sizeof(fd_prof_rec_t)) ) ) return 0UL;
+  return FD_PROF_FOOTPRINT( depth );
+}
+
+void *
+fd_prof_new( void * shmem,
+             ulong  depth ) {
+
+  if( FD_UNLIKELY( !shmem ) ) {
+    FD_LOG_WARNING(( "NULL shmem" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( !fd_ulong_is_aligned( (ulong)shmem, fd_prof_align() ) ) ) {
+    FD_LOG_WARNING(( "misaligned shmem" ));
+    return NULL;
+  }
+
+  ulong footprint = fd_prof_footprint( depth );
+  if( FD_UNLIKELY( !footprint ) ) {
+    FD_LOG_WARNING(( "bad depth" ));
+    return NULL;
+  }
+
+  fd_memset( shmem, 0, footprint );
+
+  fd_prof_t * prof = (fd_prof_t *)shmem;
+  prof->depth = depth;
+  prof->seq   = 0UL;
+
+  /* Mark every record as published long ago, so a reader polling for
+     seq in [0,depth) sees it as not yet published rather than as a
+     valid (zero) record. */
+
+  fd_prof_rec_t * rec = (fd_prof_rec_t *)(prof+1);
+  for( ulong i=0UL; i<depth; i++ ) rec[ i ].seq = fd_seq_dec( i, depth );
+
+  FD_COMPILER_MFENCE();
+  FD_VOLATILE( prof->magic ) = FD_PROF_MAGIC;
+  FD_COMPILER_MFENCE();
+
+  return shmem;
+}
+
+fd_prof_t *
+fd_prof_join( void * shprof ) {
+
+  if( FD_UNLIKELY( !shprof ) ) {
+    FD_LOG_WARNING(( "NULL shprof" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( !fd_ulong_is_aligned( (ulong)shprof, fd_prof_align() ) ) ) {
+    FD_LOG_WARNING(( "misaligned shprof" ));
+    return NULL;
+  }
+
+  fd_prof_t * prof = (fd_prof_t *)shprof;
+
+  if( FD_UNLIKELY( prof->magic!=FD_PROF_MAGIC ) ) {
+    FD_LOG_WARNING(( "bad magic" ));
+    return NULL;
+  }
+
+  return prof;
+}
+
+void *
+fd_prof_leave( fd_prof_t const * prof ) {
+
+  if( FD_UNLIKELY( !prof ) ) {
+    FD_LOG_WARNING(( "NULL prof" ));
+    return NULL;
+  }
+
+  return (void *)prof;
+}
+
+void *
+fd_prof_delete( void * shprof ) {
+
+  if( FD_UNLIKELY( !shprof ) ) {
+    FD_LOG_WARNING(( "NULL shprof" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( !fd_ulong_is_aligned( (ulong)shprof, fd_prof_align() ) ) ) {
+    FD_LOG_WARNING(( "misaligned shprof" ));
+    return NULL;
+  }
+
+  fd_prof_t * prof = (fd_prof_t *)shprof;
+
+  if( FD_UNLIKELY( prof->magic!=FD_PROF_MAGIC ) ) {
+    FD_LOG_WARNING(( "bad magic" ));
+    return NULL;
+  }
+
+  FD_COMPILER_MFENCE();
+  FD_VOLATILE( prof->magic ) = 0UL;
+  FD_COMPILER_MFENCE();
+
+  return (void *)prof;
+}
+
+fd_prof_t *
+fd_prof_register( fd_prof_t * prof ) {
+  fd_prof_tl = prof;
+  if( FD_LIKELY( prof ) ) {
+    FD_COMPILER_MFENCE();
+    FD_VOLATILE( prof->ts0 ) = fd_tickcount();
+    FD_COMPILER_MFENCE();
+  }
+  return prof;
+}
+
+char const *
+fd_prof_evt_cstr( ulong evt ) {
+  switch( evt ) {
+  case FD_PROF_EVT_HOUSEKEEPING:        return "housekeeping";
+  case FD_PROF_EVT_DURING_HOUSEKEEPING: return "during_housekeeping";
+  case FD_PROF_EVT_METRICS_WRITE:       return "metrics_write";
+  case FD_PROF_EVT_BEFORE_CREDIT:       return "before_credit";
+  case FD_PROF_EVT_AFTER_CREDIT:        return "after_credit";
+  case FD_PROF_EVT_BEFORE_FRAG:         return "before_frag";
+  case FD_PROF_EVT_DURING_FRAG:         return "during_frag";
+  case FD_PROF_EVT_AFTER_FRAG:          return "after_frag";
+  default: break;
+  }
+  return "unknown";
+}
@@ -0,0 +1,115 @@
+#include "fd_prof.h"
+
+FD_STATIC_ASSERT( FD_PROF_ALIGN==128UL, unit_test );
+FD_STATIC_ASSERT( FD_PROF_FOOTPRINT( 1024UL )==384UL+32UL*1024UL, unit_test );
+
+#define DEPTH (1024UL)
+
+static uchar shmem[ FD_PROF_FOOTPRINT( DEPTH ) ] __attribute__((aligned(FD_PROF_ALIGN)));
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+
+  fd_rng_t _rng[1]; fd_rng_t * rng = fd_rng_join( fd_rng_new( _rng, 0U, 0UL ) );
+
+  FD_TEST( fd_prof_align()==FD_PROF_ALIGN );
+  FD_TEST( !fd_prof_footprint( 0UL                   ) );
+  FD_TEST( !fd_prof_footprint( FD_PROF_DEPTH_MIN-1UL ) );
+  FD_TEST( !fd_prof_footprint( DEPTH+1UL             ) );
+  FD_TEST( fd_prof_footprint( DEPTH )==FD_PROF_FOOTPRINT( DEPTH ) );
+
+  FD_TEST( !fd_prof_new( NULL,    DEPTH ) );
+  FD_TEST( !fd_prof_new( shmem+1, DEPTH ) );
+  FD_TEST( !fd_prof_new( shmem,   3UL   ) );
+
+  void *      shprof = fd_prof_new( shmem, DEPTH ); FD_TEST( shprof );
+  fd_prof_t * prof   = fd_prof_join( shprof );      FD_TEST( prof );
+
+  FD_TEST( !fd_prof_join( NULL          ) );
+  FD_TEST( !fd_prof_join( (void *)0x1UL ) );
+
+  FD_TEST( fd_prof_depth( prof )==DEPTH );
+  FD_TEST( !fd_prof_ts0( prof ) );
+  FD_TEST( !fd_prof_seq_query( prof ) );
+
+  /* Nothing has been published yet */
+
+  fd_prof_rec_t rec[1];
+  for( ulong seq=0UL; seq<DEPTH; seq++ ) FD_TEST( fd_prof_read( prof, seq, rec )<0 );
+
+  FD_TEST( fd_prof_register( prof )==prof );
+  FD_TEST( fd_prof_tl==prof );
+  FD_TEST( fd_prof_ts0( prof ) );
+
+  /* Publish a couple of rings worth of events and check the totals,
+     the readable window and the overrun detection. */
+
+  ulong exp_cnt  [ FD_PROF_EVT_CNT ] = {0};
+  ulong exp_ticks[ FD_PROF_EVT_CNT ] = {0};
+
+  ulong evt_cnt = 3UL*DEPTH + 17UL;
+  long  ts      = 1000L;
+  for( ulong seq=0UL; seq<evt_cnt; seq++ ) {
+    ulong evt    = fd_rng_ulong_roll( rng, FD_PROF_EVT_CNT );
+    ulong in_idx = fd_rng_ulong_roll( rng, 8UL );
+    long  dur    = (long)fd_rng_ulong_roll( rng, 100000UL );
+    fd_prof_record( prof, evt, in_idx, ts, ts+dur );
+    exp_cnt  [ evt ]++;
+    exp_ticks[ evt ] += (ulong)dur;
+
+    FD_TEST( fd_prof_seq_query( prof )==seq+1UL );
+    FD_TEST( !fd_prof_read( prof, seq, rec ) );
+    FD_TEST( rec->seq==seq && rec->ts==ts && rec->dur==(ulong)dur && rec->evt==(uint)evt && rec->in_idx==(uint)in_idx );
+    FD_TEST( fd_prof_read( prof, seq+1UL, rec )<0 );
+    if( seq>=DEPTH ) FD_TEST( fd_prof_read( prof, seq-DEPTH, rec )>0 );
+
+    ts += dur;
+  }
+
+  ulong cnt  [ FD_PROF_EVT_CNT ];
+  ulong ticks[ FD_PROF_EVT_CNT ];
+  fd_prof_totals( prof, cnt, ticks );
+  for( ulong evt=0UL; evt<FD_PROF_EVT_CNT; evt++ ) {
+    FD_TEST( cnt  [ evt ]==exp_cnt  [ evt ] );
+    FD_TEST( ticks[ evt ]==exp_ticks[ evt ] );
+    FD_TEST( strcmp( fd_prof_evt_cstr( evt ), "unknown" ) );
+  }
+  FD_TEST( !strcmp( fd_prof_evt_cstr( FD_PROF_EVT_CNT ), "unknown" ) );
+
+  /* Negative durations (e.g. a tickcount that went backwards across a
+     core migration of an unpinned tile) are clamped to zero */
+
+  fd_prof_record( prof, FD_PROF_EVT_AFTER_FRAG, FD_PROF_IN_IDX_NONE, 10L, 5L );
+  FD_TEST( !fd_prof_read( prof, evt_cnt, rec ) );
+  FD_TEST( !rec->dur && rec->in_idx==FD_PROF_IN_IDX_NONE );
+
+  /* Bench the writer, which is what a profiled tile pays per callback */
+
+  ulong iter = 10000000UL;
+  long  dt   = -fd_log_wallclock();
+  for( ulong i=0UL; i<iter; i++ ) {
+    long now = fd_tickcount();
+    fd_prof_record( prof, i & 7UL, 0UL, now, now+1L );
+  }
+  dt += fd_log_wallclock();
+  FD_LOG_NOTICE(( "fd_prof_record: %.3f ns/evt", (double)dt/(double)iter ));
+
+  FD_TEST( !fd_prof_register( NULL ) );
+  FD_TEST( !fd_prof_tl );
+
+  FD_TEST( !fd_prof_leave( NULL ) );
+  FD_TEST( fd_prof_leave( prof )==shprof );
+
+  FD_TEST( !fd_prof_delete( NULL              ) );
+  FD_TEST( !fd_prof_delete( (char *)shprof+1UL ) );
+  FD_TEST( fd_prof_delete( shprof )==shmem );
+  FD_TEST( !fd_prof_join( shprof ) );
+
+  fd_rng_delete( fd_rng_leave( rng ) );
+
+  FD_LOG_NOTICE(( "pass" ));
+  fd_halt();
+  return 0;
+}
@@ -212,14 +212,20 @@ sample_unstaked( fd_shred_dest_t * sdest ) {
 }
 
 
-/* Returns 0 on success */
+/* compute_seeds computes the ChaCha20 seed of each shred, and the first
+   block of each of the corresponding ChaCha20 streams.  Most shreds only
+   need a handful of random values (compute_first needs just one), so
+   computing the first block of all the streams at once, several
+   streams per vector, is much cheaper than letting fd_chacha20rng_init
+   compute a full buffer for each of them.  Returns 0 on success. */
 static inline int
 compute_seeds( fd_shred_dest_t           * sdest,
                fd_shred_t  const * const * input_shreds,
                ulong                       shred_cnt,
                fd_pubkey_t       const   * leader,
                ulong                       slot,
-               uchar                       dest_hash_output[ FD_SHRED_DEST_MAX_SHRED_CNT ][ 32 ] ) {
+               uchar                       dest_hash_output[ FD_SHRED_DEST_MAX_SHRED_CNT ][ 32 ],
+               uchar                       rng_block0      [ FD_SHRED_DEST_MAX_SHRED_CNT ][ FD_CHACHA20_BLOCK_SZ ] ) {
 
   shred_dest_input_t dest_hash_inputs [ FD_SHRED_DEST_MAX_SHRED_CNT ];
   fd_sha256_batch_t * sha256 = fd_sha256_batch_init( sdest->_sha256_batch );
@@ -238,6 +244,8 @@ compute_seeds( fd_shred_dest_t           * sdest,
     fd_sha256_batch_add( sha256, dest_hash_inputs+i,   sizeof(shred_dest_input_t), dest_hash_output[ i ] );
   }
   fd_sha256_batch_fini( sha256 );
+
+  fd_chacha20rng_first_blocks( rng_block0, (uchar const (*)[ 32 ])dest_hash_output, shred_cnt );
   return 0;
 }
 
@@ -258,12 +266,13 @@ fd_shred_dest_compute_first( fd_shred_dest_t          * sdest,
   }
 
   uchar dest_hash_outputs[ FD_SHRED_DEST_MAX_SHRED_CNT ][ 32 ];
+  uchar rng_block0       [ FD_SHRED_DEST_MAX_SHRED_CNT ][ FD_CHACHA20_BLOCK_SZ ];
 
   ulong slot = input_shreds[0]->slot;
   fd_pubkey_t const * leader = fd_epoch_leaders_get( sdest->lsched, slot );
   if( FD_UNLIKELY( !leader ) ) return NULL;
 
-  if( FD_UNLIKELY( compute_seeds( sdest, input_shreds, shred_cnt, leader, slot, dest_hash_outputs ) ) ) return NULL;
+  if( FD_UNLIKELY( compute_seeds( sdest, input_shreds, shred_cnt, leader, slot, dest_hash_outputs, rng_block0 ) ) ) return NULL;
 
   /* If we're calling this, we must be the leader.  That means we had
      some stake when the leader schedule was created, but maybe not
@@ -275,7 +284,7 @@ fd_shred_dest_compute_first( fd_shred_dest_t          * sdest,
 
   int any_staked_candidates = sdest->staked_cnt > (ulong)source_validator_is_staked;
   for( ulong i=0UL; i<shred_cnt; i++ ) {
-    fd_wsample_seed_rng( fd_wsample_get_rng( sdest->staked ), dest_hash_outputs[ i ] );
+    fd_chacha20rng_init_prefilled( fd_wsample_get_rng( sdest->staked ), dest_hash_outputs[ i ], rng_block0[ i ] );
     if( FD_LIKELY( any_staked_candidates ) ) out[i] = (ushort)fd_wsample_sample( sdest->staked );
     else                                     out[i] = (ushort)sample_unstaked_noprepare( sdest, sdest->source_validator_orig_idx );
   }
@@ -328,9 +337,10 @@ fd_shred_dest_compute_children( fd_shred_dest_t          * sdest,
   }
 
   uchar dest_hash_outputs[ FD_SHRED_DEST_MAX_SHRED_CNT ][ 32 ];
+  uchar rng_block0       [ FD_SHRED_DEST_MAX_SHRED_CNT ][ FD_CHACHA20_BLOCK_SZ ];
 
 
-  if( FD_UNLIKELY( compute_seeds( sdest, input_shreds, shred_cnt, leader, slot, dest_hash_outputs ) ) ) return NULL;
+  if( FD_UNLIKELY( compute_seeds( sdest, input_shreds, shred_cnt, leader, slot, dest_hash_outputs, rng_block0 ) ) ) return NULL;
 
   ulong max_dest_cnt = 0UL;
 
@@ -342,7 +352,7 @@ fd_shred_dest_compute_children( fd_shred_dest_t          * sdest,
     if( FD_LIKELY( query && leader_is_staked ) ) fd_wsample_remove_idx( sdest->staked, leader_idx );
 
     ulong my_idx         = 0UL;
-    fd_wsample_seed_rng( fd_wsample_get_rng( sdest->staked ), dest_hash_outputs[ i ] ); /* Seeds both samplers since the rng is shared */
+    fd_chacha20rng_init_prefilled( fd_wsample_get_rng( sdest->staked ), dest_hash_outputs[ i ], rng_block0[ i ] ); /* Seeds both samplers since the rng is shared */
 
     if( FD_UNLIKELY( !i_am_staked ) ) {
       /* Quickly burn through all the staked nodes since I'll be in the
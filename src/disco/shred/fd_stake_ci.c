@@ -32,6 +32,8 @@ fd_stake_ci_new( void             * mem,
     ei->sdest  = fd_shred_dest_join   ( fd_shred_dest_new   ( ei->_sdest,  info->shred_dest, 1UL, ei->lsched, identity_key ) );
   }
   info->identity_key[ 0 ] = *identity_key;
+  info->pending->idx      = ULONG_MAX;
+  fd_chacha20rng_join( fd_chacha20rng_new( info->pending->rng, FD_CHACHA20RNG_MODE_MOD ) );
 
   return (void *)info;
 }
@@ -39,7 +41,12 @@ fd_stake_ci_new( void             * mem,
 fd_stake_ci_t * fd_stake_ci_join( void * mem ) { return (fd_stake_ci_t *)mem; }
 
 void * fd_stake_ci_leave ( fd_stake_ci_t * info ) { return (void *)info; }
-void * fd_stake_ci_delete( void          * mem  ) { return mem;          }
+void *
+fd_stake_ci_delete( void * mem ) {
+  fd_stake_ci_t * info = (fd_stake_ci_t *)mem;
+  fd_chacha20rng_delete( fd_chacha20rng_leave( info->pending->rng ) );
+  return mem;
+}
 
 
 void
@@ -52,6 +59,11 @@ fd_stake_ci_stake_msg_init( fd_stake_ci_t * info,
   ulong start_slot          = hdr[ 2 ];
   ulong slot_cnt            = hdr[ 3 ];
 
+  /* The schedule being precomputed reads stake_weight, which we're
+     about to overwrite, so it has to be completed first.  Stake
+     messages are rare enough that this shouldn't happen in practice. */
+  while( FD_UNLIKELY( fd_stake_ci_precompute( info ) ) );
+
   if( FD_UNLIKELY( staked_cnt > MAX_SHRED_DESTS ) )
     FD_LOG_ERR(( "The stakes -> Firedancer splice sent a malformed update with %lu stakes in it,"
                  " but the maximum allowed is %lu", staked_cnt, MAX_SHRED_DESTS ));
@@ -88,18 +100,47 @@ log_summary( char const * msg, fd_stake_ci_t * info ) {
 #include "../../util/tmpl/fd_set.c"
 
 void
-fd_stake_ci_stake_msg_fini( fd_stake_ci_t * info ) {
+fd_stake_ci_stake_msg_fini_async( fd_stake_ci_t * info ) {
+  ulong epoch      = info->scratch->epoch;
+  ulong staked_cnt = info->scratch->staked_cnt;
+
+  /* Clear the existing info.  Until fd_stake_ci_precompute publishes
+     the new epoch, slot_cnt==0 makes queries skip this entry. */
+  ulong                 idx    = epoch % 2UL;
+  fd_per_epoch_info_t * new_ei = info->epoch_info + idx;
+  new_ei->slot_cnt = 0UL;
+  fd_shred_dest_delete   ( fd_shred_dest_leave   ( new_ei->sdest  ) );
+  fd_epoch_leaders_delete( fd_epoch_leaders_leave( new_ei->lsched ) );
+  new_ei->sdest  = NULL;
+  new_ei->lsched = NULL;
+
+  /* Building the weighted sampler is linear in staked_cnt, which is
+     cheap relative to sampling the schedule, so do it right away. */
+  if( FD_UNLIKELY( !fd_epoch_leaders_new_init( new_ei->_lsched, epoch, info->scratch->start_slot, info->scratch->slot_cnt,
+                                               staked_cnt, info->stake_weight, info->pending->rng ) ) )
+    FD_LOG_ERR(( "fd_epoch_leaders_new_init failed for epoch %lu with %lu stakes", epoch, staked_cnt ));
+
+  info->pending->idx = idx;
+}
+
+/* fd_stake_ci_build_sdest finishes the pending epoch: it generates
+   weighted shred destinations from the new stake information and
+   whatever contact info we currently know, creates the sdest, and
+   publishes the epoch. */
+
+static void
+fd_stake_ci_build_sdest( fd_stake_ci_t * info ) {
   /* The grossness here is a sign our abstractions are wrong and need to
      be fixed instead of just patched.  We need to generate weighted
      shred destinations using a combination of the new stake information
      and whatever contact info we previously knew. */
+  ulong pending_idx            = info->pending->idx;
   ulong epoch                  = info->scratch->epoch;
   ulong staked_cnt             = info->scratch->staked_cnt;
 
-  /* Just take the first one arbitrarily because they both have the same
-     contact info, other than possibly some staked nodes with no contact
-     info. */
-  fd_shred_dest_t * existing_sdest    = info->epoch_info->sdest;
+  /* The other entry is the live one, and dest_add_fini has kept its
+     contact info current while this one was pending. */
+  fd_shred_dest_t * existing_sdest    = info->epoch_info[ pending_idx^1UL ].sdest;
   ulong             existing_dest_cnt = fd_shred_dest_cnt_all( existing_sdest );
 
   /* Keep track of the destinations in existing_sdest that are not
@@ -152,23 +193,39 @@ fd_stake_ci_stake_msg_fini( fd_stake_ci_t * info ) {
 
   /* Now we have a plausible shred_dest list. */
 
-  /* Clear the existing info */
-  fd_per_epoch_info_t * new_ei = info->epoch_info + (epoch % 2UL);
-  fd_shred_dest_delete   ( fd_shred_dest_leave   ( new_ei->sdest  ) );
-  fd_epoch_leaders_delete( fd_epoch_leaders_leave( new_ei->lsched ) );
+  fd_per_epoch_info_t * new_ei = info->epoch_info + pending_idx;
+  new_ei->lsched = fd_epoch_leaders_join( fd_epoch_leaders_new_fini( new_ei->_lsched, info->stake_weight ) );
+  new_ei->sdest  = fd_shred_dest_join   ( fd_shred_dest_new        ( new_ei->_sdest, info->shred_dest, j,
+                                                                     new_ei->lsched, info->identity_key ) );
 
-  /* And create the new one */
+  /* Publish.  slot_cnt goes last so that the entry doesn't match any
+     slot until everything else is in place. */
   new_ei->epoch      = epoch;
   new_ei->start_slot = info->scratch->start_slot;
+  FD_COMPILER_MFENCE();
   new_ei->slot_cnt   = info->scratch->slot_cnt;
 
-  new_ei->lsched = fd_epoch_leaders_join( fd_epoch_leaders_new( new_ei->_lsched, epoch, new_ei->start_slot, new_ei->slot_cnt,
-                                                                staked_cnt, info->stake_weight ) );
-  new_ei->sdest  = fd_shred_dest_join   ( fd_shred_dest_new   ( new_ei->_sdest, info->shred_dest, j,
-                                                                new_ei->lsched, info->identity_key ) );
+  info->pending->idx = ULONG_MAX;
   log_summary( "stake update", info );
 }
 
+int
+fd_stake_ci_precompute( fd_stake_ci_t * info ) {
+  ulong idx = info->pending->idx;
+  if( FD_LIKELY( idx==ULONG_MAX ) ) return 0;
+
+  if( FD_LIKELY( fd_epoch_leaders_new_sample( info->epoch_info[ idx ]._lsched, FD_STAKE_CI_PRECOMPUTE_ROTATIONS ) ) ) return 1;
+
+  fd_stake_ci_build_sdest( info );
+  return 0;
+}
+
+void
+fd_stake_ci_stake_msg_fini( fd_stake_ci_t * info ) {
+  fd_stake_ci_stake_msg_fini_async( info );
+  while( fd_stake_ci_precompute( info ) );
+}
+
 fd_shred_dest_weighted_t * fd_stake_ci_dest_add_init( fd_stake_ci_t * info ) { return info->shred_dest; }
 
 static inline void
@@ -249,9 +306,12 @@ fd_stake_ci_dest_add_fini( fd_stake_ci_t * info,
   fd_shred_dest_weighted_t self_dests[ 1 ] = {{ .pubkey = info->identity_key[ 0 ], .ip4 = SELF_DUMMY_IP }};
   info->shred_dest[ cnt++ ] = self_dests[ 0 ];
 
-  /* Update both of them */
-  fd_stake_ci_dest_add_fini_impl( info, cnt, info->epoch_info + 0UL );
-  fd_stake_ci_dest_add_fini_impl( info, cnt, info->epoch_info + 1UL );
+  /* Update both of them, except one that is still being precomputed,
+     which picks up the contact info from the other when it finishes. */
+  for( ulong i=0UL; i<2UL; i++ ) {
+    if( FD_UNLIKELY( i==info->pending->idx ) ) continue;
+    fd_stake_ci_dest_add_fini_impl( info, cnt, info->epoch_info + i );
+  }
 
   log_summary( "dest update", info );
 }
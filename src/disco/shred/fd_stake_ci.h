@@ -26,6 +26,13 @@
 
 #define FD_STAKE_CI_STAKE_MSG_SZ (32UL + MAX_SHRED_DESTS * 40UL)
 
+/* FD_STAKE_CI_PRECOMPUTE_ROTATIONS is the number of leader schedule
+   rotations sampled by each call to fd_stake_ci_precompute.  A full
+   epoch is MAX_SLOTS_PER_EPOCH/FD_EPOCH_SLOTS_PER_ROTATION=108000
+   rotations, so this keeps each call to around a hundred microseconds,
+   less than it takes to generate the shred destinations at the end. */
+#define FD_STAKE_CI_PRECOMPUTE_ROTATIONS 4096UL
+
 struct fd_per_epoch_info_private {
   /* Epoch, and [start_slot, start_slot+slot_cnt) refer to the time
      period for which lsched and sdest are valid. I.e. if you're
@@ -64,6 +71,16 @@ struct fd_stake_ci {
 
   fd_shred_dest_weighted_t shred_dest_temp[ MAX_SHRED_DESTS ];
 
+  /* pending describes the epoch being precomputed by
+     fd_stake_ci_precompute.  idx is its index in epoch_info, or
+     ULONG_MAX if nothing is pending.  rng is used by the leader
+     schedule while it's being sampled.  While an epoch is pending,
+     scratch and stake_weight hold its stake message. */
+  struct {
+    ulong            idx;
+    fd_chacha20rng_t rng[1];
+  } pending[1];
+
   /* The information to be used for epoch i can be found at
      epoch_info[ i%2 ] if it is known. */
   fd_per_epoch_info_t epoch_info[ 2 ];
@@ -151,6 +168,32 @@ void                       fd_stake_ci_stake_msg_fini( fd_stake_ci_t * info
 fd_shred_dest_weighted_t * fd_stake_ci_dest_add_init ( fd_stake_ci_t * info                            );
 void                       fd_stake_ci_dest_add_fini ( fd_stake_ci_t * info, ulong cnt                 );
 
+/* fd_stake_ci_stake_msg_fini generates the leader schedule and shred
+   destinations for the new epoch before returning, which takes tens of
+   milliseconds at mainnet sizes.  fd_stake_ci_stake_msg_fini_async is
+   a drop-in replacement for it that only does the cheap part of the
+   work and leaves the rest pending, to be completed incrementally by
+   calls to fd_stake_ci_precompute, e.g. from housekeeping.  The stake
+   message typically arrives an epoch before it's needed, so there's
+   plenty of time to finish.
+
+   fd_stake_ci_precompute does a bounded amount of work (about
+   FD_STAKE_CI_PRECOMPUTE_ROTATIONS rotations of the leader schedule, or
+   generating the shred destinations) on the pending epoch, and returns
+   1 if more work remains and 0 otherwise.  It's cheap to call when
+   nothing is pending.  When the last piece of work completes, the new
+   epoch is published all at once.
+
+   While an epoch is pending, the query functions return NULL for slots
+   in it (and in the epoch it's replacing, whose information is
+   discarded by _fini_async, just as with _fini), and return the same
+   values as before for slots in the other epoch.  Contact info updates
+   from dest_add_fini are applied to the pending epoch when it's
+   published.  Calling fd_stake_ci_stake_msg_init while an epoch is
+   pending completes the pending epoch first. */
+void fd_stake_ci_stake_msg_fini_async( fd_stake_ci_t * info );
+int  fd_stake_ci_precompute          ( fd_stake_ci_t * info );
+
 
 /* fd_stake_ci_get_{sdest, lsched}_for_slot respectively return a
    pointer to the fd_shred_dest_t and fd_epoch_leaders_t containing
@@ -379,6 +379,35 @@ test_performance( void ) {
   dt += fd_log_wallclock();
   FD_LOG_NOTICE(( "Compute children (16 shred/batch): %.2f ns/shred", (double)dt / (double)(16UL*TEST_CNT) ));
 #undef TEST_CNT
+
+  fd_shred_dest_delete( fd_shred_dest_leave( sdest ) );
+
+  /* Compute first, as the leader, for one FEC set (32 data + 32 parity
+     shreds) per batch.  A leader computes this for ~32k shreds/block. */
+  fd_pubkey_t const * leader = fd_epoch_leaders_get( lsched, 1UL );
+  sdest = fd_shred_dest_join( fd_shred_dest_new( _sd_footprint, info, cnt, lsched, leader ) );
+  FD_TEST( sdest );
+
+  fd_shred_t         fec      [ 64 ];
+  fd_shred_t const * fec_ptr  [ 64 ];
+  for( ulong j=0UL; j<64UL; j++ ) {
+    fec_ptr[j]     = fec+j;
+    fec[j].slot    = 1UL;
+    fec[j].variant = j<32UL ? FD_SHRED_TYPE_MERKLE_DATA : FD_SHRED_TYPE_MERKLE_CODE;
+  }
+  dt = -fd_log_wallclock();
+#define TEST_CNT 10000
+  for( ulong j=0UL; j<TEST_CNT; j++ ) {
+    for( ulong k=0UL; k<64UL; k++ ) fec[k].idx = (uint)(j*32UL+(k&31UL));
+    FD_TEST( fd_shred_dest_compute_first( sdest, fec_ptr, 64UL, result ) );
+  }
+  dt += fd_log_wallclock();
+  FD_LOG_NOTICE(( "Compute first (64 shred/batch): %.2f ns/shred, %.2f Mshred/s", (double)dt / (double)(64UL*TEST_CNT),
+                  1e3*(double)(64UL*TEST_CNT) / (double)dt ));
+#undef TEST_CNT
+
+  fd_shred_dest_delete( fd_shred_dest_leave( sdest ) );
+  fd_epoch_leaders_delete( fd_epoch_leaders_leave( lsched ) );
 }
 
 int
@@ -335,6 +335,152 @@ test_changing_contact_info( void ) {
   fd_stake_ci_delete( fd_stake_ci_leave( info ) );
 }
 
+static void
+test_precompute( void ) {
+  fd_stake_ci_t * info = fd_stake_ci_join( fd_stake_ci_new( _info, identity_key ) );
+
+  fd_stake_ci_stake_msg_init( info, generate_stake_msg( stake_msg, 0UL, "ABC"  ) );  fd_stake_ci_stake_msg_fini( info );
+  fd_stake_ci_dest_add_fini( info, generate_dest_add( fd_stake_ci_dest_add_init( info ), "ABCE" ) );
+  check_destinations( info, 0UL, "ABC",  "EI" );
+  FD_TEST( !fd_stake_ci_precompute( info ) );
+
+  /* Epoch 1 isn't visible until it's done, but epoch 0 is unaffected */
+  fd_stake_ci_stake_msg_init( info, generate_stake_msg( stake_msg, 1UL, "ABCD" ) );  fd_stake_ci_stake_msg_fini_async( info );
+  check_destinations( info, 0UL, "ABC",  "EI" );
+  check_destinations( info, 1UL, NULL,   NULL );
+
+  /* Contact info that arrives in the meantime is picked up */
+  fd_stake_ci_dest_add_fini( info, generate_dest_add( fd_stake_ci_dest_add_init( info ), "ABCF" ) );
+  check_destinations( info, 0UL, "ABC",  "FI" );
+  check_destinations( info, 1UL, NULL,   NULL );
+
+  while( fd_stake_ci_precompute( info ) );
+  check_destinations( info, 0UL, "ABC",  "FI" );
+  check_destinations( info, 1UL, "ABCD", "FI" );
+
+  /* A new stake message completes the pending one first */
+  fd_stake_ci_stake_msg_init( info, generate_stake_msg( stake_msg, 2UL, "AB"   ) );  fd_stake_ci_stake_msg_fini_async( info );
+  fd_stake_ci_stake_msg_init( info, generate_stake_msg( stake_msg, 3UL, "BC"   ) );
+  check_destinations( info, 2UL, "AB",   "CFI" );
+  fd_stake_ci_stake_msg_fini_async( info );
+  while( fd_stake_ci_precompute( info ) );
+  check_destinations( info, 2UL, "AB",   "CFI" );
+  check_destinations( info, 3UL, "BC",   "AFI" );
+
+  fd_stake_ci_delete( fd_stake_ci_leave( info ) );
+}
+
+/* test_epoch_stall measures how long the shred tile stalls when a
+   mainnet-sized stake message arrives, generating the new epoch all at
+   once in fd_stake_ci_stake_msg_fini vs. one fd_stake_ci_precompute
+   call per housekeeping, and checks that both produce the same leader
+   schedule. */
+
+#define STALL_STAKED_CNT   (4000UL)
+#define STALL_UNSTAKED_CNT (4000UL)
+#define STALL_SLOT_CNT     MAX_SLOTS_PER_EPOCH
+
+static fd_stake_ci_t _info2[1];
+static fd_pubkey_t   stall_keys[ STALL_STAKED_CNT+STALL_UNSTAKED_CNT ];
+static uchar __attribute__((aligned(FD_EPOCH_LEADERS_ALIGN))) stall_lsched[ FD_EPOCH_LEADERS_FOOTPRINT( STALL_STAKED_CNT, STALL_SLOT_CNT ) ];
+
+static uchar *
+generate_mainnet_stake_msg( uchar * _buf,
+                            ulong   epoch ) {
+  struct {
+    ulong epoch;
+    ulong staked_cnt;
+    ulong start_slot;
+    ulong slot_cnt;
+    fd_stake_weight_t weights[];
+  } *buf = (void *)_buf;
+
+  buf->epoch      = epoch;
+  buf->start_slot = epoch * STALL_SLOT_CNT;
+  buf->slot_cnt   = STALL_SLOT_CNT;
+  buf->staked_cnt = STALL_STAKED_CNT;
+
+  /* Strictly decreasing, so the pubkeys don't need to be sorted */
+  for( ulong i=0UL; i<STALL_STAKED_CNT; i++ ) {
+    buf->weights[i].key   = stall_keys[ i ];
+    buf->weights[i].stake = 1000000000000UL/(i+1UL) + STALL_STAKED_CNT - i;
+  }
+  return _buf;
+}
+
+static ulong
+generate_mainnet_dest_add( fd_shred_dest_weighted_t * buf ) {
+  for( ulong i=0UL; i<STALL_STAKED_CNT+STALL_UNSTAKED_CNT; i++ ) {
+    memset( buf+i, 0, sizeof(fd_shred_dest_weighted_t) );
+    buf[i].pubkey = stall_keys[ i ];
+    buf[i].ip4    = (uint)i+2U;
+    buf[i].port   = 8001;
+  }
+  return STALL_STAKED_CNT+STALL_UNSTAKED_CNT;
+}
+
+static void
+test_epoch_stall( fd_rng_t * rng ) {
+  for( ulong i=0UL; i<STALL_STAKED_CNT+STALL_UNSTAKED_CNT; i++ )
+    for( ulong j=0UL; j<32UL; j++ ) stall_keys[ i ].uc[ j ] = fd_rng_uchar( rng );
+
+  fd_stake_ci_t * sync  = fd_stake_ci_join( fd_stake_ci_new( _info,  identity_key ) );
+  fd_stake_ci_t * async = fd_stake_ci_join( fd_stake_ci_new( _info2, identity_key ) );
+
+  long  sync_max       = 0L;
+  long  async_max      = 0L;
+  ulong async_call_cnt = 0UL;
+  for( ulong epoch=0UL; epoch<4UL; epoch++ ) {
+    fd_stake_ci_dest_add_fini( sync,  generate_mainnet_dest_add( fd_stake_ci_dest_add_init( sync  ) ) );
+    fd_stake_ci_dest_add_fini( async, generate_mainnet_dest_add( fd_stake_ci_dest_add_init( async ) ) );
+
+    fd_stake_ci_stake_msg_init( sync, generate_mainnet_stake_msg( stake_msg, epoch ) );
+    long dt = -fd_log_wallclock();
+    fd_stake_ci_stake_msg_fini( sync );
+    dt += fd_log_wallclock();
+    sync_max = fd_long_max( sync_max, dt );
+
+    fd_stake_ci_stake_msg_init( async, generate_mainnet_stake_msg( stake_msg, epoch ) );
+    dt = -fd_log_wallclock();
+    fd_stake_ci_stake_msg_fini_async( async );
+    dt += fd_log_wallclock();
+    async_max = fd_long_max( async_max, dt );
+    for(;;) {
+      dt = -fd_log_wallclock();
+      int more = fd_stake_ci_precompute( async );
+      dt += fd_log_wallclock();
+      async_max = fd_long_max( async_max, dt );
+      async_call_cnt++;
+      if( !more ) break;
+    }
+
+    ulong slot = epoch * STALL_SLOT_CNT;
+    fd_epoch_leaders_t * l0 = fd_stake_ci_get_lsched_for_slot( sync,  slot );
+    fd_epoch_leaders_t * l1 = fd_stake_ci_get_lsched_for_slot( async, slot );
+    FD_TEST( l0 && l1 );
+    FD_TEST( l0->sched_cnt==l1->sched_cnt );
+    FD_TEST( fd_memeq( l0->sched, l1->sched, l0->sched_cnt*sizeof(uint) ) );
+    FD_TEST( fd_memeq( l0->pub,   l1->pub,   l0->pub_cnt  *sizeof(fd_pubkey_t) ) );
+
+    /* And both match a schedule generated from scratch */
+    fd_epoch_leaders_t * ref = fd_epoch_leaders_join( fd_epoch_leaders_new( stall_lsched, epoch, slot, STALL_SLOT_CNT,
+                                                                            STALL_STAKED_CNT, sync->stake_weight ) );
+    FD_TEST( fd_memeq( ref->sched, l0->sched, l0->sched_cnt*sizeof(uint) ) );
+    fd_epoch_leaders_delete( fd_epoch_leaders_leave( ref ) );
+
+    fd_shred_dest_t * s0 = fd_stake_ci_get_sdest_for_slot( sync,  slot );
+    fd_shred_dest_t * s1 = fd_stake_ci_get_sdest_for_slot( async, slot );
+    FD_TEST( fd_shred_dest_cnt_staked  ( s0 )==fd_shred_dest_cnt_staked  ( s1 ) );
+    FD_TEST( fd_shred_dest_cnt_unstaked( s0 )==fd_shred_dest_cnt_unstaked( s1 ) );
+  }
+
+  FD_LOG_NOTICE(( "max stall at epoch transition: fini %.3f ms, fini_async+precompute %.3f ms (%lu calls/epoch)",
+                  (double)sync_max*1e-6, (double)async_max*1e-6, async_call_cnt/4UL ));
+
+  fd_stake_ci_delete( fd_stake_ci_leave( async ) );
+  fd_stake_ci_delete( fd_stake_ci_leave( sync  ) );
+}
+
 int
 main( int     argc,
       char ** argv ) {
@@ -359,6 +505,11 @@ main( int     argc,
   test_ordering();
   test_destaking();
   test_changing_contact_info();
+  test_precompute();
+
+  fd_rng_t _rng[1]; fd_rng_t * rng = fd_rng_join( fd_rng_new( _rng, 0U, 0UL ) );
+  test_epoch_stall( rng );
+  fd_rng_delete( fd_rng_leave( rng ) );
 
   FD_LOG_NOTICE(( "pass" ));
   fd_halt();
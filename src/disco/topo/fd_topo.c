@@ -167,6 +167,11 @@ fd_topo_workspace_fill( fd_topo_t *      topo,
       FD_TEST( tile->metrics );
     }
 
+    if( FD_UNLIKELY( tile->prof_obj_id!=ULONG_MAX && topo->objs[ tile->prof_obj_id ].wksp_id==wksp->id ) ) {
+      tile->prof = fd_prof_join( fd_topo_obj_laddr( topo, tile->prof_obj_id ) );
+      FD_TEST( tile->prof );
+    }
+
     if( FD_LIKELY( topo->objs[ tile->cnc_obj_id ].wksp_id==wksp->id ) ) {
       tile->cnc = fd_cnc_join( fd_topo_obj_laddr( topo, tile->cnc_obj_id ) );
       FD_TEST( tile->cnc );
@@ -2,6 +2,9 @@
 #define HEADER_fd_src_disco_topo_fd_topo_h
 
 #include "../mux/fd_mux.h"
+#include "../metrics/fd_metrics_snap.h"
+#include "../ingest/fd_ingest.h"
+#include "../prof/fd_prof.h"
 #include "../quic/fd_tpu.h"
 #include "../../tango/fd_tango.h"
 
@@ -109,6 +112,7 @@ typedef struct {
   ulong tile_obj_id;
   ulong cnc_obj_id;
   ulong metrics_obj_id;
+  ulong prof_obj_id;            /* The object ID of the profiling ring of this tile, or ULONG_MAX if the tile is not profiled. */
   ulong in_link_fseq_obj_id[ FD_TOPO_MAX_TILE_IN_LINKS ];
 
   ulong uses_obj_cnt;
@@ -117,14 +121,15 @@ typedef struct {
 
   /* Computed fields.  These are not supplied as configuration but calculated as needed. */
   struct {
-    fd_cnc_t * cnc;
-    ulong *    metrics; /* The shared memory for metrics that this tile should write.  Consumer by monitoring and metrics writing tiles. */
+    fd_cnc_t *  cnc;
+    ulong *     metrics; /* The shared memory for metrics that this tile should write.  Consumer by monitoring and metrics writing tiles. */
+    fd_prof_t * prof;    /* The profiling ring this tile should record callbacks into, or NULL if the tile is not profiled. */
 
     /* The fseq of each link that this tile reads from.  Multiple fseqs
        may point to the link, if there are multiple consumers.  An fseq
        can be uniquely identified via (link_id, tile_id), or (link_kind,
        link_kind_id, tile_kind, tile_kind_id) */
-    ulong *    in_link_fseq[ FD_TOPO_MAX_TILE_IN_LINKS ];
+    ulong *     in_link_fseq[ FD_TOPO_MAX_TILE_IN_LINKS ];
   };
 
   /* Configuration fields.  These are required to be known by the topology so it can determine the
@@ -198,6 +203,8 @@ typedef struct {
 
     struct {
       ushort prometheus_listen_port;
+      uint   snapshot_hz;
+      char   snapshot_socket_path[ PATH_MAX ];
     } metric;
 
     struct {
@@ -217,6 +224,10 @@ typedef struct {
       ulong funk_rec_max;
     } replay;
 
+    struct {
+      ulong scratch_sz;
+    } thread;
+
     struct {
       ushort send_to_port;
       uint   send_to_ip_addr;
@@ -258,6 +269,7 @@ typedef struct {
 
     struct {
       char  identity_key_path[ PATH_MAX ];
+      int   stream_entry_batches;
     } store_int;
   };
 } fd_topo_tile_t;
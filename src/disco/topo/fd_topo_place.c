@@ -0,0 +1,454 @@
+#include "fd_topo_place.h"
+
+#include "fd_pod_format.h"
+#include "../metrics/fd_metrics.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+/* read_sysfs reads the sysfs file at path into buf as a cstr.  Returns
+   buf on success and NULL if the file does not exist or is empty. */
+
+static char *
+read_sysfs( char const * path,
+            char *       buf,
+            ulong        buf_sz ) {
+  int fd = open( path, O_RDONLY );
+  if( FD_UNLIKELY( -1==fd ) ) return NULL;
+  long sz = read( fd, buf, buf_sz-1UL );
+  if( FD_UNLIKELY( close( fd ) ) ) FD_LOG_WARNING(( "close(%s) failed (%i-%s)", path, errno, fd_io_strerror( errno ) ));
+  if( FD_UNLIKELY( sz<=0L ) ) return NULL;
+  buf[ sz ] = '\0';
+  return buf;
+}
+
+/* first_cpu returns the first CPU of a sysfs cpu list like "4-7,68-71"
+   or ULONG_MAX if the list is malformed. */
+
+static ulong
+first_cpu( char const * list ) {
+  if( FD_UNLIKELY( *list<'0' || *list>'9' ) ) return ULONG_MAX;
+  return strtoul( list, NULL, 10 );
+}
+
+/* parse_cpu_list sets set[ i ] to 1 for every CPU i<max in the sysfs cpu
+   list s.  Returns 0 on success and -1 if s is malformed. */
+
+static int
+parse_cpu_list( char const * s,
+                uchar *      set,
+                ulong        max ) {
+  while( *s && *s!='\n' ) {
+    char * end;
+    if( FD_UNLIKELY( *s<'0' || *s>'9' ) ) return -1;
+    ulong lo = strtoul( s, &end, 10 );
+    ulong hi = lo;
+    s = end;
+    if( *s=='-' ) {
+      s++;
+      if( FD_UNLIKELY( *s<'0' || *s>'9' ) ) return -1;
+      hi = strtoul( s, &end, 10 );
+      s = end;
+    }
+    for( ulong i=lo; i<=fd_ulong_min( hi, max-1UL ); i++ ) set[ i ] = 1;
+    if( *s==',' ) s++;
+  }
+  return 0;
+}
+
+fd_topo_cpus_t *
+fd_topo_cpus_init( fd_topo_cpus_t * cpus ) {
+  fd_memset( cpus, 0, sizeof(fd_topo_cpus_t) );
+
+  cpus->cpu_cnt  = fd_shmem_cpu_cnt();
+  cpus->numa_cnt = fd_shmem_numa_cnt();
+  if( FD_UNLIKELY( !cpus->cpu_cnt || !cpus->numa_cnt ) ) {
+    FD_LOG_WARNING(( "fd_shmem not booted" ));
+    return NULL;
+  }
+
+  char buf[ 4096 ];
+  uchar online[ FD_SHMEM_CPU_MAX ] = {0};
+  if( FD_UNLIKELY( !read_sysfs( "/sys/devices/system/cpu/online", buf, sizeof(buf) ) ||
+                   parse_cpu_list( buf, online, FD_SHMEM_CPU_MAX ) ) ) {
+    FD_LOG_WARNING(( "unable to read /sys/devices/system/cpu/online" ));
+    return NULL;
+  }
+
+  /* Each L3 cache domain is keyed by the first CPU sharing it.  If the
+     kernel does not expose the cache topology, it is keyed by the
+     first CPU of the NUMA node instead. */
+
+  ulong key_to_l3[ FD_SHMEM_CPU_MAX ];
+  for( ulong i=0UL; i<FD_SHMEM_CPU_MAX; i++ ) key_to_l3[ i ] = ULONG_MAX;
+
+  for( ulong i=0UL; i<cpus->cpu_cnt; i++ ) {
+    cpus->cpu[ i ].online   = online[ i ];
+    cpus->cpu[ i ].numa_idx = fd_shmem_numa_idx( i );
+    cpus->cpu[ i ].l3_idx   = ULONG_MAX;
+    cpus->cpu[ i ].core_idx = i;
+    if( FD_UNLIKELY( !online[ i ] ) ) continue;
+
+    char path[ 128 ];
+    ulong key = ULONG_MAX;
+    for( ulong j=0UL; j<16UL; j++ ) {
+      if( FD_UNLIKELY( !read_sysfs( fd_cstr_printf( path, sizeof(path), NULL, "/sys/devices/system/cpu/cpu%lu/cache/index%lu/level", i, j ), buf, sizeof(buf) ) ) ) break;
+      if( FD_LIKELY( strtoul( buf, NULL, 10 )!=3UL ) ) continue;
+      if( FD_LIKELY( read_sysfs( fd_cstr_printf( path, sizeof(path), NULL, "/sys/devices/system/cpu/cpu%lu/cache/index%lu/shared_cpu_list", i, j ), buf, sizeof(buf) ) ) ) key = first_cpu( buf );
+      break;
+    }
+    if( FD_UNLIKELY( key>=cpus->cpu_cnt ) ) {
+      for( key=0UL; key<i; key++ ) if( cpus->cpu[ key ].online && cpus->cpu[ key ].numa_idx==cpus->cpu[ i ].numa_idx ) break;
+    }
+
+    if( FD_UNLIKELY( key_to_l3[ key ]==ULONG_MAX ) ) key_to_l3[ key ] = cpus->l3_cnt++;
+    cpus->cpu[ i ].l3_idx = key_to_l3[ key ];
+
+    if( FD_LIKELY( read_sysfs( fd_cstr_printf( path, sizeof(path), NULL, "/sys/devices/system/cpu/cpu%lu/topology/thread_siblings_list", i ), buf, sizeof(buf) ) ) ) {
+      ulong core = first_cpu( buf );
+      if( FD_LIKELY( core<cpus->cpu_cnt ) ) cpus->cpu[ i ].core_idx = core;
+    }
+  }
+
+  return cpus;
+}
+
+ulong
+fd_topo_nic_numa_idx( char const * interface ) {
+  char path[ 128 ];
+  char buf[ 32 ];
+  if( FD_UNLIKELY( !fd_cstr_printf_check( path, sizeof(path), NULL, "/sys/class/net/%s/device/numa_node", interface ) ) ) return ULONG_MAX;
+  if( FD_UNLIKELY( !read_sysfs( path, buf, sizeof(buf) ) ) ) return ULONG_MAX;
+  long numa_idx = strtol( buf, NULL, 10 );
+  if( FD_UNLIKELY( numa_idx<0L || (ulong)numa_idx>=fd_shmem_numa_cnt() ) ) return ULONG_MAX;
+  return (ulong)numa_idx;
+}
+
+void
+fd_topo_place_bw_hint( fd_topo_place_t * place,
+                       fd_topo_t const * topo ) {
+  for( ulong i=0UL; i<topo->tile_cnt; i++ ) {
+    fd_topo_tile_t const * tile = &topo->tiles[ i ];
+    for( ulong j=0UL; j<tile->in_cnt; j++ ) {
+      fd_topo_link_t const * link = &topo->links[ tile->in_link_id[ j ] ];
+      ulong bw = fd_pod_queryf_ulong( topo->props, 0UL, "link.%lu.bw", link->id );
+      place->in_bw[ i ][ j ] = bw / fd_ulong_max( fd_topo_link_consumer_cnt( topo, link ), 1UL );
+    }
+  }
+}
+
+void
+fd_topo_place_bw_metrics( fd_topo_place_t * place,
+                          fd_topo_t const * topo ) {
+  fd_topo_place_bw_hint( place, topo );
+  for( ulong i=0UL; i<topo->tile_cnt; i++ ) {
+    fd_topo_tile_t const * tile = &topo->tiles[ i ];
+    if( FD_UNLIKELY( !tile->metrics ) ) FD_LOG_ERR(( "metrics of tile %s:%lu not joined", tile->name, tile->kind_id ));
+    for( ulong j=0UL; j<tile->in_cnt; j++ ) {
+      if( FD_UNLIKELY( !tile->in_link_poll[ j ] ) ) continue;
+      place->in_bw[ i ][ j ] = fd_metrics_link_in( tile->metrics, j )[ FD_METRICS_COUNTER_LINK_PUBLISHED_SIZE_BYTES_OFF ];
+    }
+  }
+}
+
+/* traffic_init fills the traffic matrix and the NIC traffic of each
+   tile from the in link traffic. */
+
+static void
+traffic_init( fd_topo_place_t * place,
+              fd_topo_t const * topo ) {
+  for( ulong i=0UL; i<topo->tile_cnt; i++ ) {
+    fd_memset( place->traffic[ i ], 0, topo->tile_cnt*sizeof(ulong) );
+    place->nic_traffic[ i ] = 0UL;
+  }
+
+  for( ulong i=0UL; i<topo->tile_cnt; i++ ) {
+    fd_topo_tile_t const * tile = &topo->tiles[ i ];
+    for( ulong j=0UL; j<tile->in_cnt; j++ ) {
+      ulong bw       = place->in_bw[ i ][ j ];
+      ulong producer = fd_topo_find_link_producer( topo, &topo->links[ tile->in_link_id[ j ] ] );
+      if( FD_UNLIKELY( producer==ULONG_MAX || producer==i ) ) continue;
+      place->traffic[ i ][ producer ] += bw;
+      place->traffic[ producer ][ i ] += bw;
+
+      /* Everything a net tile exchanges with other tiles also goes
+         through the network device. */
+      if( FD_UNLIKELY( !strcmp( tile->name, "net" ) ) ) place->nic_traffic[ i ] += bw;
+      if( FD_UNLIKELY( !strcmp( topo->tiles[ producer ].name, "net" ) ) ) place->nic_traffic[ producer ] += bw;
+    }
+  }
+}
+
+static inline ulong
+cpu_dist( fd_topo_cpus_t const * cpus,
+          ulong                  a,
+          ulong                  b ) {
+  if( FD_UNLIKELY( a==ULONG_MAX || b==ULONG_MAX ) ) return FD_TOPO_PLACE_COST_NUMA;
+  if( cpus->cpu[ a ].l3_idx==cpus->cpu[ b ].l3_idx ) return 0UL;
+  if( cpus->cpu[ a ].numa_idx==cpus->cpu[ b ].numa_idx ) return FD_TOPO_PLACE_COST_L3;
+  return FD_TOPO_PLACE_COST_NUMA;
+}
+
+static inline ulong
+nic_dist( fd_topo_place_t const * place,
+          ulong                   cpu ) {
+  if( FD_UNLIKELY( place->nic_numa_idx==ULONG_MAX ) ) return 0UL;
+  if( FD_UNLIKELY( cpu==ULONG_MAX || place->cpus.cpu[ cpu ].numa_idx!=place->nic_numa_idx ) ) return FD_TOPO_PLACE_COST_NUMA;
+  return 0UL;
+}
+
+/* tile_cost returns the cost of the traffic of tile t if it was on CPU
+   cpu, given the CPUs of the other tiles in assign.  Tiles which are
+   not assigned yet (assign ULONG_MAX and placed 0) are ignored. */
+
+static ulong
+tile_cost( fd_topo_place_t const * place,
+           ulong                   tile_cnt,
+           ulong const *           assign,
+           uchar const *           placed,
+           ulong                   t,
+           ulong                   cpu ) {
+  ulong cost = place->nic_traffic[ t ]*nic_dist( place, cpu );
+  for( ulong u=0UL; u<tile_cnt; u++ ) {
+    if( FD_UNLIKELY( u==t || !placed[ u ] || !place->traffic[ t ][ u ] ) ) continue;
+    cost += place->traffic[ t ][ u ]*cpu_dist( &place->cpus, cpu, assign[ u ] );
+  }
+  return cost;
+}
+
+ulong
+fd_topo_place_cost( fd_topo_place_t * place,
+                    fd_topo_t const * topo,
+                    ulong *           opt_l3,
+                    ulong *           opt_numa ) {
+  traffic_init( place, topo );
+
+  ulong cost = 0UL;
+  ulong l3   = 0UL;
+  ulong numa = 0UL;
+  for( ulong i=0UL; i<topo->tile_cnt; i++ ) {
+    ulong a = topo->tiles[ i ].cpu_idx;
+    if( FD_UNLIKELY( a!=ULONG_MAX && a>=place->cpus.cpu_cnt ) ) a = ULONG_MAX;
+
+    ulong nic = nic_dist( place, a );
+    cost += place->nic_traffic[ i ]*nic;
+    if( nic ) numa += place->nic_traffic[ i ];
+
+    for( ulong j=i+1UL; j<topo->tile_cnt; j++ ) {
+      ulong b = topo->tiles[ j ].cpu_idx;
+      if( FD_UNLIKELY( b!=ULONG_MAX && b>=place->cpus.cpu_cnt ) ) b = ULONG_MAX;
+
+      ulong d = cpu_dist( &place->cpus, a, b );
+      cost += place->traffic[ i ][ j ]*d;
+      if( d==FD_TOPO_PLACE_COST_L3   ) l3   += place->traffic[ i ][ j ];
+      if( d==FD_TOPO_PLACE_COST_NUMA ) numa += place->traffic[ i ][ j ];
+    }
+  }
+
+  if( opt_l3   ) *opt_l3   = l3;
+  if( opt_numa ) *opt_numa = numa;
+  return cost;
+}
+
+/* place_once places the tiles in order (order_cnt tiles sorted by
+   decreasing traffic) on the cpu_cnt CPUs in cpu_idx into assign, with
+   the first tile on CPU seed (or wherever is cheapest if seed is
+   ULONG_MAX), and returns the cost of the layout.
+
+   Greedy: each tile goes on the allowed CPU which is cheapest given the
+   tiles placed before it.  Ties go to CPUs on an unused core, then to
+   the lowest CPU index.
+
+   Refinement: apply improving swaps of two tiles and moves of a tile to
+   a free CPU until there are none.  Swapping a and b changes the cost
+   of a by cost_a(cb)-cost_a(ca) and likewise for b, except that both of
+   these count the a-b traffic as if a and b were on the same CPU, which
+   the last term corrects. */
+
+static ulong
+place_once( fd_topo_place_t const * place,
+            ulong                   tile_cnt,
+            ulong const *           order,
+            ulong                   order_cnt,
+            ulong const *           cpu_idx,
+            ulong                   cpu_cnt,
+            ulong                   seed,
+            ulong *                 assign ) {
+  fd_topo_cpus_t const * cpus = &place->cpus;
+
+  uchar placed   [ FD_TOPO_MAX_TILES ] = {0};
+  ulong tile_of  [ FD_SHMEM_CPU_MAX  ]; /* tile on each CPU, ULONG_MAX if free */
+  ulong core_used[ FD_SHMEM_CPU_MAX  ] = {0}; /* tiles on the SMT siblings of each core */
+  for( ulong i=0UL; i<FD_SHMEM_CPU_MAX; i++ ) tile_of[ i ] = ULONG_MAX;
+  for( ulong i=0UL; i<tile_cnt;         i++ ) assign [ i ] = ULONG_MAX;
+
+  for( ulong i=0UL; i<order_cnt; i++ ) {
+    ulong t = order[ i ];
+    ulong best_cpu  = ULONG_MAX;
+    ulong best_cost = ULONG_MAX;
+    ulong best_core = ULONG_MAX;
+    for( ulong j=0UL; j<cpu_cnt; j++ ) {
+      ulong c = cpu_idx[ j ];
+      if( FD_UNLIKELY( tile_of[ c ]!=ULONG_MAX ) ) continue;
+      if( FD_UNLIKELY( !i && seed!=ULONG_MAX && c!=seed ) ) continue;
+      ulong cost = tile_cost( place, tile_cnt, assign, placed, t, c );
+      ulong core = core_used[ cpus->cpu[ c ].core_idx ];
+      if( cost<best_cost || ( cost==best_cost && ( core<best_core || ( core==best_core && c<best_cpu ) ) ) ) {
+        best_cpu  = c;
+        best_cost = cost;
+        best_core = core;
+      }
+    }
+    assign [ t ] = best_cpu;
+    placed [ t ] = 1;
+    tile_of[ best_cpu ] = t;
+    core_used[ cpus->cpu[ best_cpu ].core_idx ]++;
+  }
+
+  for( ulong pass=0UL; pass<64UL; pass++ ) {
+    int improved = 0;
+
+    for( ulong i=0UL; i<order_cnt; i++ ) {
+      for( ulong j=i+1UL; j<order_cnt; j++ ) {
+        ulong a  = order[ i ];
+        ulong b  = order[ j ];
+        ulong ca = assign[ a ];
+        ulong cb = assign[ b ];
+        long delta = (long)tile_cost( place, tile_cnt, assign, placed, a, cb ) - (long)tile_cost( place, tile_cnt, assign, placed, a, ca )
+                   + (long)tile_cost( place, tile_cnt, assign, placed, b, ca ) - (long)tile_cost( place, tile_cnt, assign, placed, b, cb )
+                   + 2L*(long)( place->traffic[ a ][ b ]*cpu_dist( cpus, ca, cb ) );
+        if( FD_LIKELY( delta>=0L ) ) continue;
+        assign[ a ] = cb; tile_of[ cb ] = a;
+        assign[ b ] = ca; tile_of[ ca ] = b;
+        improved = 1;
+      }
+    }
+
+    for( ulong i=0UL; i<order_cnt; i++ ) {
+      ulong a  = order[ i ];
+      ulong ca = assign[ a ];
+      for( ulong j=0UL; j<cpu_cnt; j++ ) {
+        ulong c = cpu_idx[ j ];
+        if( FD_UNLIKELY( tile_of[ c ]!=ULONG_MAX ) ) continue;
+        /* Don't move onto a core which is more shared than the current */
+        ulong core_src = core_used[ cpus->cpu[ ca ].core_idx ] - 1UL;
+        ulong core_dst = core_used[ cpus->cpu[ c  ].core_idx ] - ( cpus->cpu[ c ].core_idx==cpus->cpu[ ca ].core_idx );
+        if( FD_UNLIKELY( core_dst>core_src ) ) continue;
+        long delta = (long)tile_cost( place, tile_cnt, assign, placed, a, c ) - (long)tile_cost( place, tile_cnt, assign, placed, a, ca );
+        if( FD_LIKELY( delta>=0L ) ) continue;
+        tile_of[ ca ] = ULONG_MAX;
+        tile_of[ c  ] = a;
+        core_used[ cpus->cpu[ ca ].core_idx ]--;
+        core_used[ cpus->cpu[ c  ].core_idx ]++;
+        assign[ a ] = ca = c;
+        improved = 1;
+      }
+    }
+
+    if( FD_LIKELY( !improved ) ) break;
+  }
+
+  /* Each pair is counted from both ends */
+  ulong cost = 0UL;
+  for( ulong i=0UL; i<order_cnt; i++ ) {
+    ulong t = order[ i ];
+    cost += tile_cost( place, tile_cnt, assign, placed, t, assign[ t ] ) + place->nic_traffic[ t ]*nic_dist( place, assign[ t ] );
+  }
+  return cost/2UL;
+}
+
+void
+fd_topo_place_tiles( fd_topo_place_t * place,
+                     fd_topo_t *       topo,
+                     ulong const *     cpu_idx,
+                     ulong             cpu_cnt ) {
+  fd_topo_cpus_t const * cpus = &place->cpus;
+
+  ulong tile_cnt = topo->tile_cnt;
+  if( FD_UNLIKELY( cpu_cnt<tile_cnt ) )
+    FD_LOG_ERR(( "topology has %lu tiles but only %lu CPUs are available to place them on", tile_cnt, cpu_cnt ));
+
+  uchar allowed[ FD_SHMEM_CPU_MAX ] = {0};
+  for( ulong i=0UL; i<cpu_cnt; i++ ) {
+    if( FD_UNLIKELY( cpu_idx[ i ]>=cpus->cpu_cnt || !cpus->cpu[ cpu_idx[ i ] ].online ) ) FD_LOG_ERR(( "CPU %lu is not online", cpu_idx[ i ] ));
+    if( FD_UNLIKELY( allowed[ cpu_idx[ i ] ] ) ) FD_LOG_ERR(( "CPU %lu is listed more than once", cpu_idx[ i ] ));
+    allowed[ cpu_idx[ i ] ] = 1;
+  }
+
+  if( FD_UNLIKELY( !tile_cnt ) ) return;
+  traffic_init( place, topo );
+
+  /* Tiles with the most traffic first (stable insertion sort) */
+
+  ulong order[ FD_TOPO_MAX_TILES ];
+  ulong total[ FD_TOPO_MAX_TILES ];
+  for( ulong i=0UL; i<tile_cnt; i++ ) {
+    order[ i ] = i;
+    total[ i ] = place->nic_traffic[ i ];
+    for( ulong j=0UL; j<tile_cnt; j++ ) total[ i ] += place->traffic[ i ][ j ];
+  }
+  for( ulong i=1UL; i<tile_cnt; i++ ) {
+    ulong t = order[ i ];
+    ulong j = i;
+    for( ; j && total[ order[ j-1UL ] ]<total[ t ]; j-- ) order[ j ] = order[ j-1UL ];
+    order[ j ] = t;
+  }
+
+  /* The greedy placement of the first tile decides which part of the
+     host the layout grows from, and the refinement only moves one or
+     two tiles at a time, so it cannot move a whole layout to a better
+     NUMA node.  Try seeding the first tile in each L3 cache domain and
+     keep the cheapest layout. */
+
+  ulong best[ FD_TOPO_MAX_TILES ];
+  ulong best_cost = place_once( place, tile_cnt, order, tile_cnt, cpu_idx, cpu_cnt, ULONG_MAX, best );
+
+  uchar seeded[ FD_SHMEM_CPU_MAX ] = {0};
+  for( ulong i=0UL; i<cpu_cnt; i++ ) {
+    ulong l3_idx = cpus->cpu[ cpu_idx[ i ] ].l3_idx;
+    if( FD_LIKELY( seeded[ l3_idx ] ) ) continue;
+    seeded[ l3_idx ] = 1;
+
+    ulong assign[ FD_TOPO_MAX_TILES ];
+    ulong cost = place_once( place, tile_cnt, order, tile_cnt, cpu_idx, cpu_cnt, cpu_idx[ i ], assign );
+    if( FD_LIKELY( cost>=best_cost ) ) continue;
+    best_cost = cost;
+    fd_memcpy( best, assign, tile_cnt*sizeof(ulong) );
+  }
+
+  for( ulong i=0UL; i<tile_cnt; i++ ) topo->tiles[ i ].cpu_idx = best[ i ];
+}
+
+void
+fd_topo_place_wksps( fd_topo_place_t * place,
+                     fd_topo_t *       topo ) {
+  for( ulong i=0UL; i<topo->wksp_cnt; i++ ) {
+    ulong numa_bw[ FD_SHMEM_NUMA_MAX ] = {0};
+    ulong total = 0UL;
+
+    for( ulong j=0UL; j<topo->tile_cnt; j++ ) {
+      fd_topo_tile_t const * tile = &topo->tiles[ j ];
+      for( ulong k=0UL; k<tile->in_cnt; k++ ) {
+        fd_topo_link_t const * link = &topo->links[ tile->in_link_id[ k ] ];
+        if( FD_LIKELY( topo->objs[ link->mcache_obj_id ].wksp_id!=i ) ) continue;
+
+        ulong bw       = place->in_bw[ j ][ k ];
+        ulong producer = fd_topo_find_link_producer( topo, link );
+        ulong ends[ 2 ] = { tile->cpu_idx, producer==ULONG_MAX ? ULONG_MAX : topo->tiles[ producer ].cpu_idx };
+        for( ulong l=0UL; l<2UL; l++ ) {
+          if( FD_UNLIKELY( ends[ l ]>=place->cpus.cpu_cnt ) ) continue;
+          ulong numa_idx = place->cpus.cpu[ ends[ l ] ].numa_idx;
+          if( FD_UNLIKELY( numa_idx>=FD_SHMEM_NUMA_MAX ) ) continue;
+          numa_bw[ numa_idx ] += bw;
+          total += bw;
+        }
+      }
+    }
+    if( FD_LIKELY( !total ) ) continue;
+
+    ulong best = 0UL;
+    for( ulong j=1UL; j<FD_SHMEM_NUMA_MAX; j++ ) if( numa_bw[ j ]>numa_bw[ best ] ) best = j;
+    topo->workspaces[ i ].numa_idx = best;
+  }
+}
@@ -0,0 +1,142 @@
+#ifndef HEADER_fd_src_disco_topo_fd_topo_place_h
+#define HEADER_fd_src_disco_topo_fd_topo_place_h
+
+/* fd_topo_place assigns the tiles of a topology to CPUs, and the
+   workspaces to NUMA nodes, so that the traffic between tiles crosses
+   as few L3 cache and NUMA boundaries as possible.
+
+   The traffic is described per tile in link, either from the expected
+   bandwidth hints given to the topology builder (fd_topob_link_bw), or
+   from the link metrics of a previous run.  Only relative values
+   matter.  The cost of a layout is the sum over all pairs of tiles of
+   the traffic between them, weighted by the distance of their CPUs: 0
+   if they share an L3 cache, FD_TOPO_PLACE_COST_L3 if they are on the
+   same NUMA node, and FD_TOPO_PLACE_COST_NUMA otherwise.  Tiles which
+   are not pinned to a CPU are assumed to be remote from every other
+   tile.  The traffic of net tiles additionally costs
+   FD_TOPO_PLACE_COST_NUMA when the tile is not on the NUMA node of the
+   network device.
+
+   The placement is a greedy assignment (tiles with the most traffic
+   first, each on the allowed CPU closest to its already placed peers)
+   followed by pairwise swap and move refinement until no improvement
+   is found, repeated with the first tile seeded in each L3 cache
+   domain.  It is deterministic for a given input. */
+
+#include "fd_topo.h"
+
+#define FD_TOPO_PLACE_COST_L3   (1UL)
+#define FD_TOPO_PLACE_COST_NUMA (4UL)
+
+/* fd_topo_cpus_t describes the CPU and cache topology of the host. */
+
+struct fd_topo_cpus {
+  ulong cpu_cnt;  /* CPUs are indexed [0,cpu_cnt) */
+  ulong numa_cnt;
+  ulong l3_cnt;   /* number of distinct L3 cache domains */
+
+  struct {
+    int   online;
+    ulong numa_idx;
+    ulong l3_idx;   /* L3 cache domain of the CPU in [0,l3_cnt) */
+    ulong core_idx; /* lowest index of the SMT siblings of the CPU */
+  } cpu[ FD_SHMEM_CPU_MAX ];
+};
+
+typedef struct fd_topo_cpus fd_topo_cpus_t;
+
+/* fd_topo_place_t holds the inputs and the scratch space of a
+   placement.  It is large (~1 MiB) and should not be put on the
+   stack. */
+
+struct fd_topo_place {
+  fd_topo_cpus_t cpus;
+
+  /* NUMA node of the network device, or ULONG_MAX if unknown. */
+
+  ulong nic_numa_idx;
+
+  /* in_bw[ t ][ i ] is the expected traffic on in link i of tile t, as
+     read by tile t. */
+
+  ulong in_bw[ FD_TOPO_MAX_TILES ][ FD_TOPO_MAX_TILE_IN_LINKS ];
+
+  /* Scratch: symmetric traffic matrix between tiles, and the traffic
+     of each tile through the network device. */
+
+  ulong traffic    [ FD_TOPO_MAX_TILES ][ FD_TOPO_MAX_TILES ];
+  ulong nic_traffic[ FD_TOPO_MAX_TILES ];
+};
+
+typedef struct fd_topo_place fd_topo_place_t;
+
+FD_PROTOTYPES_BEGIN
+
+/* fd_topo_cpus_init reads the CPU topology of the host from sysfs into
+   cpus.  Requires fd_shmem to be booted for NUMA information.  Returns
+   cpus on success, and NULL on failure (logs details).  If the L3
+   topology is not exposed by the kernel, every NUMA node is assumed
+   to be one L3 cache domain. */
+
+fd_topo_cpus_t *
+fd_topo_cpus_init( fd_topo_cpus_t * cpus );
+
+/* fd_topo_nic_numa_idx returns the NUMA node the network device with
+   the given interface name is attached to, or ULONG_MAX if it is not
+   known (e.g. a virtual device, or a host with only one node). */
+
+ulong
+fd_topo_nic_numa_idx( char const * interface );
+
+/* fd_topo_place_bw_hint fills place->in_bw from the bandwidth hints of
+   the topology (see fd_topob_link_bw).  The hinted traffic of a link
+   is split evenly between the tiles reading it.  Links without a hint
+   carry no traffic. */
+
+void
+fd_topo_place_bw_hint( fd_topo_place_t * place,
+                       fd_topo_t const * topo );
+
+/* fd_topo_place_bw_metrics fills place->in_bw from the in link metrics
+   of a running or previously run topology.  The metrics of all tiles
+   must be joined (see fd_topo_join_workspaces and fd_topo_fill).
+   Unpolled in links have no metrics, and use the hint instead. */
+
+void
+fd_topo_place_bw_metrics( fd_topo_place_t * place,
+                          fd_topo_t const * topo );
+
+/* fd_topo_place_cost returns the cost of the current CPU assignment of
+   the tiles of topo given the traffic in place (see above).  If
+   opt_l3 or opt_numa are non-NULL, they get the traffic crossing an L3
+   cache boundary within a NUMA node and crossing a NUMA boundary. */
+
+ulong
+fd_topo_place_cost( fd_topo_place_t * place,
+                    fd_topo_t const * topo,
+                    ulong *           opt_l3,
+                    ulong *           opt_numa );
+
+/* fd_topo_place_tiles assigns each tile of topo to one of the cpu_cnt
+   distinct CPUs in cpu_idx, minimizing the cost of the layout.  Logs an
+   error and exits if there are fewer CPUs than tiles, or if a CPU is
+   not online. */
+
+void
+fd_topo_place_tiles( fd_topo_place_t * place,
+                     fd_topo_t *       topo,
+                     ulong const *     cpu_idx,
+                     ulong             cpu_cnt );
+
+/* fd_topo_place_wksps assigns each workspace which links carry
+   traffic through to the NUMA node which the most of that traffic is
+   read or written from.  Other workspaces are left unchanged.  Must be
+   called after the tiles are placed. */
+
+void
+fd_topo_place_wksps( fd_topo_place_t * place,
+                     fd_topo_t *       topo );
+
+FD_PROTOTYPES_END
+
+#endif /* HEADER_fd_src_disco_topo_fd_topo_place_h */
@@ -111,6 +111,10 @@ fd_topo_run_tile( fd_topo_t *          topo,
   FD_TEST( tile->cnc );
   FD_TEST( tile->metrics );
   fd_metrics_register( tile->metrics );
+  if( FD_UNLIKELY( tile->prof_obj_id!=ULONG_MAX ) ) {
+    FD_TEST( tile->prof );
+    fd_prof_register( tile->prof );
+  }
 
   FD_MGAUGE_SET( TILE, PID, pid );
   FD_MGAUGE_SET( TILE, TID, tid );
@@ -1,6 +1,9 @@
 #include "fd_topob.h"
 
 #include "fd_pod_format.h"
+#include "../metrics/fd_metrics_snap.h"
+#include "../prof/fd_prof.h"
+#include "../../ballet/pack/fd_pack_shard.h"
 
 fd_topo_t *
 fd_topob_new( void * mem,
@@ -121,6 +124,21 @@ fd_topob_link( fd_topo_t *  topo,
   topo->link_cnt++;
 }
 
+void
+fd_topob_link_bw( fd_topo_t *  topo,
+                  char const * link_name,
+                  ulong        bw ) {
+  if( FD_UNLIKELY( !topo || !link_name ) ) FD_LOG_ERR(( "NULL args" ));
+
+  ulong found = 0UL;
+  for( ulong i=0UL; i<topo->link_cnt; i++ ) {
+    if( FD_LIKELY( strcmp( topo->links[ i ].name, link_name ) ) ) continue;
+    FD_TEST( fd_pod_insertf_ulong( topo->props, bw, "link.%lu.bw", i ) );
+    found++;
+  }
+  if( FD_UNLIKELY( !found ) ) FD_LOG_ERR(( "link not found: %s", link_name ));
+}
+
 void
 fd_topob_tile_uses( fd_topo_t *      topo,
                     fd_topo_tile_t * tile,
@@ -163,6 +181,7 @@ fd_topob_tile( fd_topo_t *    topo,
   tile->in_cnt              = 0UL;
   tile->out_cnt             = 0UL;
   tile->uses_obj_cnt        = 0UL;
+  tile->prof_obj_id         = ULONG_MAX;
   tile->out_link_id_primary = ULONG_MAX;
   if( FD_LIKELY( out_link ) ) {
     tile->out_link_id_primary = fd_topo_find_link( topo, out_link, out_link_kind_id );
@@ -276,6 +295,82 @@ fd_topob_tile_out( fd_topo_t *  topo,
   }
 }
 
+void
+fd_topob_tile_prof( fd_topo_t *      topo,
+                    fd_topo_tile_t * tile,
+                    char const *     prof_wksp,
+                    ulong            depth ) {
+  if( FD_UNLIKELY( !topo || !tile || !prof_wksp ) ) FD_LOG_ERR(( "NULL args" ));
+  if( FD_UNLIKELY( tile->prof_obj_id!=ULONG_MAX ) ) FD_LOG_ERR(( "tile `%s:%lu` already has a prof", tile->name, tile->kind_id ));
+  if( FD_UNLIKELY( !fd_prof_footprint( depth ) ) ) FD_LOG_ERR(( "invalid prof depth %lu for tile `%s:%lu`", depth, tile->name, tile->kind_id ));
+
+  fd_topo_obj_t * obj = fd_topob_obj( topo, "prof", prof_wksp );
+  tile->prof_obj_id = obj->id;
+  fd_topob_tile_uses( topo, tile, obj, FD_SHMEM_JOIN_MODE_READ_WRITE );
+  FD_TEST( fd_pod_insertf_ulong( topo->props, depth, "obj.%lu.depth", obj->id ) );
+}
+
+void
+fd_topob_metrics_snap( fd_topo_t *      topo,
+                       fd_topo_tile_t * tile,
+                       char const *     snap_wksp ) {
+  if( FD_UNLIKELY( !topo || !tile || !snap_wksp ) ) FD_LOG_ERR(( "NULL args" ));
+  if( FD_UNLIKELY( fd_pod_query_ulong( topo->props, "metrics_snap", ULONG_MAX )!=ULONG_MAX ) ) FD_LOG_ERR(( "topology already has a metrics snapshot" ));
+
+  ulong word_cnt = 0UL;
+  for( ulong i=0UL; i<topo->tile_cnt; i++ ) {
+    ulong metrics_obj_id = topo->tiles[ i ].metrics_obj_id;
+    ulong in_cnt  = fd_pod_queryf_ulong( topo->props, ULONG_MAX, "obj.%lu.in_cnt",  metrics_obj_id );
+    ulong out_cnt = fd_pod_queryf_ulong( topo->props, ULONG_MAX, "obj.%lu.out_cnt", metrics_obj_id );
+    FD_TEST( in_cnt!=ULONG_MAX && out_cnt!=ULONG_MAX );
+    word_cnt += FD_METRICS_SNAP_TILE_WORD_CNT( in_cnt, out_cnt );
+  }
+
+  fd_topo_obj_t * obj = fd_topob_obj( topo, "metrics_snap", snap_wksp );
+  fd_topob_tile_uses( topo, tile, obj, FD_SHMEM_JOIN_MODE_READ_WRITE );
+  FD_TEST( fd_pod_insertf_ulong( topo->props, word_cnt, "obj.%lu.word_cnt", obj->id ) );
+  FD_TEST( fd_pod_insert_ulong( topo->props, "metrics_snap", obj->id ) );
+}
+
+fd_topo_obj_t *
+fd_topob_ingest( fd_topo_t *  topo,
+                 char const * ingest_wksp,
+                 ulong        ring_cnt ) {
+  if( FD_UNLIKELY( !topo || !ingest_wksp ) ) FD_LOG_ERR(( "NULL args" ));
+  if( FD_UNLIKELY( !ring_cnt || ring_cnt>FD_INGEST_RING_MAX ) ) FD_LOG_ERR(( "invalid ingest ring_cnt %lu", ring_cnt ));
+  if( FD_UNLIKELY( fd_pod_query_ulong( topo->props, "ingest", ULONG_MAX )!=ULONG_MAX ) ) FD_LOG_ERR(( "topology already has an ingest" ));
+
+  ulong wksp_id = fd_topo_find_wksp( topo, ingest_wksp );
+  if( FD_UNLIKELY( wksp_id==ULONG_MAX ) ) FD_LOG_ERR(( "workspace not found: %s", ingest_wksp ));
+  for( ulong i=0UL; i<topo->obj_cnt; i++ ) {
+    if( FD_UNLIKELY( topo->objs[ i ].wksp_id==wksp_id ) ) FD_LOG_ERR(( "ingest must be the first object in workspace %s", ingest_wksp ));
+  }
+
+  fd_topo_obj_t * obj = fd_topob_obj( topo, "ingest", ingest_wksp );
+  FD_TEST( fd_pod_insertf_ulong( topo->props, ring_cnt, "obj.%lu.ring_cnt", obj->id ) );
+  FD_TEST( fd_pod_insert_ulong( topo->props, "ingest", obj->id ) );
+  return obj;
+}
+
+fd_topo_obj_t *
+fd_topob_pack_shard( fd_topo_t *  topo,
+                     char const * shard_wksp,
+                     ulong        shard_cnt,
+                     ulong        lg_bucket_cnt,
+                     ulong        max_write_cost_per_acct ) {
+  if( FD_UNLIKELY( !topo || !shard_wksp ) ) FD_LOG_ERR(( "NULL args" ));
+  if( FD_UNLIKELY( !shard_cnt || shard_cnt>FD_PACK_SHARD_MAX ) ) FD_LOG_ERR(( "invalid pack shard_cnt %lu", shard_cnt ));
+  if( FD_UNLIKELY( lg_bucket_cnt<FD_PACK_SHARD_LG_BUCKET_CNT_MIN || lg_bucket_cnt>FD_PACK_SHARD_LG_BUCKET_CNT_MAX ) ) FD_LOG_ERR(( "invalid pack shard lg_bucket_cnt %lu", lg_bucket_cnt ));
+  if( FD_UNLIKELY( fd_pod_query_ulong( topo->props, "pack_shard", ULONG_MAX )!=ULONG_MAX ) ) FD_LOG_ERR(( "topology already has a pack shard table" ));
+
+  fd_topo_obj_t * obj = fd_topob_obj( topo, "pack_shard", shard_wksp );
+  FD_TEST( fd_pod_insertf_ulong( topo->props, shard_cnt,               "obj.%lu.shard_cnt",      obj->id ) );
+  FD_TEST( fd_pod_insertf_ulong( topo->props, lg_bucket_cnt,           "obj.%lu.lg_bucket_cnt",  obj->id ) );
+  FD_TEST( fd_pod_insertf_ulong( topo->props, max_write_cost_per_acct, "obj.%lu.max_write_cost", obj->id ) );
+  FD_TEST( fd_pod_insert_ulong( topo->props, "pack_shard", obj->id ) );
+  return obj;
+}
+
 static void
 validate( fd_topo_t const * topo ) {
   /* Objects have valid wksp_ids */
@@ -389,6 +484,10 @@ validate( fd_topo_t const * topo ) {
 
   /* Each link has exactly one producer */
   for( ulong i=0UL; i<topo->link_cnt; i++ ) {
+    /* Ingest rings are published to by a client process outside of the
+       topology (see fd_ingest.h), so they have no producer tile. */
+    if( FD_UNLIKELY( !strcmp( topo->links[ i ].name, "ingest_ext" ) ) ) continue;
+
     ulong producer_cnt = 0;
     for( ulong j=0UL; j<topo->tile_cnt; j++ ) {
       for( ulong k=0UL; k<topo->tiles[ j ].out_cnt; k++ ) {
@@ -442,8 +541,13 @@ fd_topob_finish( fd_topo_t * topo,
        with an extra align of padding incase gaddr_lo is not aligned. */
     ulong total_wksp_footprint = fd_wksp_footprint( part_max, footprint + fd_topo_workspace_align() + loose_sz );
 
-    ulong page_sz = FD_SHMEM_GIGANTIC_PAGE_SZ;
-    if( FD_UNLIKELY( total_wksp_footprint < 4 * FD_SHMEM_HUGE_PAGE_SZ ) ) page_sz = FD_SHMEM_HUGE_PAGE_SZ;
+    /* The topology can ask for a page size with wksp.{id}.page_sz,
+       otherwise use gigantic pages unless the workspace is small. */
+    ulong page_sz = fd_pod_queryf_ulong( topo->props, 0UL, "wksp.%lu.page_sz", wksp->id );
+    if( FD_LIKELY( !page_sz ) ) {
+      page_sz = FD_SHMEM_GIGANTIC_PAGE_SZ;
+      if( FD_UNLIKELY( total_wksp_footprint < 4 * FD_SHMEM_HUGE_PAGE_SZ ) ) page_sz = FD_SHMEM_HUGE_PAGE_SZ;
+    }
 
     ulong wksp_aligned_footprint = fd_ulong_align_up( total_wksp_footprint, page_sz );
 
@@ -99,6 +99,18 @@ fd_topob_link( fd_topo_t *  topo,
                ulong        mtu,
                ulong        burst );
 
+/* Give the expected bandwidth of all links with the given name, which
+   must have been added already.  The bandwidth is the traffic
+   published to each such link in any unit (only the relative values
+   matter), and is used to place tiles which exchange a lot of data
+   close to each other (see fd_topo_place.h).  Links without a hint are
+   assumed to carry no significant traffic. */
+
+void
+fd_topob_link_bw( fd_topo_t *  topo,
+                  char const * link_name,
+                  ulong        bw );
+
 /* Add a tile to the topology.  This creates various objects needed for
    a standard tile, including a cnc object, tile scratch memory, metrics
    memory and so on.  These objects will be created and linked to the
@@ -154,6 +166,60 @@ fd_topob_tile_out( fd_topo_t *  topo,
                    char const * link_name,
                    ulong        link_kind_id );
 
+/* Add a profiling ring to the tile.  The tile will record every run
+   loop callback it executes into a ring of depth events (see
+   fd_prof.h) which can be read by an observer to attribute the tile's
+   CPU time to callbacks.  The ring is created in the provided
+   workspace, which should be one the observer can map. */
+
+void
+fd_topob_tile_prof( fd_topo_t *      topo,
+                    fd_topo_tile_t * tile,
+                    char const *     prof_wksp,
+                    ulong            depth );
+
+/* Add a metrics snapshot to the tile, which it can use to periodically
+   copy the metrics of every tile of the topology (see
+   fd_metrics_snap.h).  The snapshot is created in the provided
+   workspace, and its object ID is stored in the "metrics_snap"
+   property of the topology.  It is sized for the metrics of all the
+   tiles, so this must be called after all tiles and links have been
+   added. */
+
+void
+fd_topob_metrics_snap( fd_topo_t *      topo,
+                       fd_topo_tile_t * tile,
+                       char const *     snap_wksp );
+
+/* Add a shared memory ingest directory (see fd_ingest.h), through
+   which processes outside the topology can find and publish to the
+   ring_cnt "ingest_ext" links consumed by the ingest tile.  The
+   directory is created in the provided workspace, which must not have
+   any objects yet so that the directory is the first one and can be
+   found by clients, and its object ID is stored in the "ingest"
+   property of the topology.  The ingest tile should be given
+   READ_WRITE use of the returned object. */
+
+fd_topo_obj_t *
+fd_topob_ingest( fd_topo_t *  topo,
+                 char const * ingest_wksp,
+                 ulong        ring_cnt );
+
+/* Add a pack shard table (see fd_pack_shard.h) shared by shard_cnt
+   pack tiles, each scheduling the transactions of one shard for its own
+   subset of the bank tiles.  The table has 2^lg_bucket_cnt buckets and
+   is created in the provided workspace, and its object ID is stored in
+   the "pack_shard" property of the topology, which is how the pack
+   tiles find it.  Each pack tile should be given READ_WRITE use of the
+   returned object. */
+
+fd_topo_obj_t *
+fd_topob_pack_shard( fd_topo_t *  topo,
+                     char const * shard_wksp,
+                     ulong        shard_cnt,
+                     ulong        lg_bucket_cnt,
+                     ulong        max_write_cost_per_acct );
+
 /* Finish creating the topology.  Lays out all the objects in the
    given workspaces, and sizes everything correctly.  Also validates
    the topology before returning.
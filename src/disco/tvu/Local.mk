@@ -1,4 +1,11 @@
 ifdef FD_HAS_INT128
-$(call add-hdrs,fd_replay.h fd_tvu.h fd_store.h fd_pending_slots.h)
-$(call add-objs,fd_replay fd_tvu fd_store fd_pending_slots,fd_disco)
+$(call add-hdrs,fd_replay.h fd_tvu.h fd_store.h fd_pending_slots.h fd_replay_sched.h)
+$(call add-objs,fd_replay fd_tvu fd_store fd_pending_slots fd_replay_sched,fd_disco)
+$(call make-unit-test,test_replay_sched,test_replay_sched,fd_disco fd_ballet fd_util)
+$(call run-unit-test,test_replay_sched)
+$(call make-unit-test,bench_replay_tpool,bench_replay_tpool,fd_util)
+ifdef FD_HAS_SECP256K1
+$(call make-unit-test,test_store_stream,test_store_stream,fd_disco fd_flamenco fd_funk fd_ballet fd_util,$(SECP256K1_LIBS))
+$(call run-unit-test,test_store_stream)
+endif
 endif
@@ -0,0 +1,161 @@
+/* bench_replay_tpool measures how the NUMA placement of the replay
+   tpool worker scratch affects transaction execution throughput.
+
+   Each task models the scratch traffic of executing one transaction on
+   a tpool worker (see fd_runtime_execute_txns_in_waves_tpool): in a
+   scratch frame of its own, the transaction's accounts are copied from
+   a shared account store into scratch and then updated in place.  Most
+   accounts are token sized, some are vote accounts and a few are large
+   program accounts.
+
+   Worker scratch is placed either on the NUMA node of the worker's cpu
+   ("local", as the thread tiles of the firedancer topology do) or on
+   the next NUMA node ("remote", as a single replay workspace does for
+   workers on other nodes).  Run with one tile per worker spanning the
+   NUMA nodes of interest, e.g. --tile-cpus 1-8,33-40 on a two socket
+   host.  On a host with a single NUMA node both placements are the
+   same. */
+
+#include "../../util/fd_util.h"
+
+#define STORE_SZ       (32UL<<20)
+#define ACCT_SZ_TOKEN  (165UL)
+#define ACCT_SZ_VOTE   (3762UL)
+#define ACCT_SZ_LARGE  (1UL<<20)
+#define SUM_STRIDE     (8UL) /* one cache line per worker */
+
+static ulong fmem[ FD_TPOOL_WORKER_SCRATCH_DEPTH ] __attribute__((aligned(FD_SCRATCH_FMEM_ALIGN)));
+static ulong sum [ FD_TILE_MAX*SUM_STRIDE ]       __attribute__((aligned(128)));
+
+/* wksp_page_cnt returns the number of pages for an anonymous wksp that
+   can hold a single sz byte allocation, leaving room for the partition
+   info fd_wksp_new_anonymous sizes for 64KiB typical allocations. */
+
+static ulong
+wksp_page_cnt( ulong sz,
+               ulong page_sz ) {
+  return fd_ulong_align_up( fd_wksp_footprint( 2UL, sz + sz/16UL + 4096UL ), page_sz ) / page_sz;
+}
+
+static void
+txn_task( void * tpool,
+          ulong  t0,     ulong t1,
+          void * args,
+          void * reduce, ulong stride,
+          ulong  l0,     ulong l1,
+          ulong  m0,     ulong m1,
+          ulong  n0,     ulong n1 ) {
+  (void)tpool; (void)t0; (void)t1; (void)l0; (void)l1; (void)n1;
+  uchar const * store = (uchar const *)args;
+  ulong *       acc   = (ulong *)reduce + n0*stride;
+
+  for( ulong txn_idx=m0; txn_idx<m1; txn_idx++ ) {
+    fd_rng_t _rng[1]; fd_rng_t * rng = fd_rng_join( fd_rng_new( _rng, (uint)txn_idx, 0UL ) );
+    FD_SCRATCH_SCOPE_BEGIN {
+      ulong acct_cnt = 4UL + fd_rng_ulong_roll( rng, 13UL );
+      for( ulong i=0UL; i<acct_cnt; i++ ) {
+        ulong r  = fd_rng_ulong( rng );
+        ulong sz = fd_ulong_if( !(r&63UL), ACCT_SZ_LARGE, fd_ulong_if( !(r&7UL), ACCT_SZ_VOTE, ACCT_SZ_TOKEN ) );
+        ulong * data = (ulong *)fd_scratch_alloc( 8UL, fd_ulong_align_up( sz, 8UL ) );
+        fd_memcpy( data, store + (r>>8)%(STORE_SZ-sz), sz );
+        for( ulong j=0UL; j<sz/8UL; j++ ) {
+          data[ j ] = data[ j ]*0x9e3779b97f4a7c15UL + j;
+          *acc += data[ j ];
+        }
+      }
+    } FD_SCRATCH_SCOPE_END;
+    fd_rng_delete( fd_rng_leave( rng ) );
+  }
+}
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+
+  char const * _page_sz   = fd_env_strip_cmdline_cstr ( &argc, &argv, "--page-sz",    NULL,   "huge" );
+  ulong        scratch_mb = fd_env_strip_cmdline_ulong( &argc, &argv, "--scratch-mb", NULL,     64UL );
+  ulong        txn_cnt    = fd_env_strip_cmdline_ulong( &argc, &argv, "--txn-cnt",    NULL,  16384UL );
+  ulong        iter_cnt   = fd_env_strip_cmdline_ulong( &argc, &argv, "--iter-cnt",   NULL,      4UL );
+
+  ulong page_sz = fd_cstr_to_shmem_page_sz( _page_sz );
+  if( FD_UNLIKELY( !page_sz ) ) FD_LOG_ERR(( "unsupported --page-sz" ));
+
+  ulong tile_cnt   = fd_tile_cnt();
+  ulong numa_cnt   = fd_shmem_numa_cnt();
+  ulong scratch_sz = scratch_mb<<20;
+
+  FD_LOG_NOTICE(( "Using --page-sz %s --scratch-mb %lu --txn-cnt %lu --iter-cnt %lu on %lu tile(s) and %lu NUMA node(s)",
+                  _page_sz, scratch_mb, txn_cnt, iter_cnt, tile_cnt, numa_cnt ));
+  if( FD_UNLIKELY( numa_cnt<2UL ) ) FD_LOG_NOTICE(( "only one NUMA node, local and remote placement are the same" ));
+
+  /* The account store is on tile 0's NUMA node, like funk is on the
+     replay tile's */
+
+  ulong tile0_cpu = fd_tile_cpu_id( 0UL );
+  tile0_cpu = fd_ulong_if( tile0_cpu<fd_shmem_cpu_cnt(), tile0_cpu, 0UL );
+  fd_wksp_t * store_wksp = fd_wksp_new_anonymous( page_sz, wksp_page_cnt( STORE_SZ, page_sz ), tile0_cpu, "store", 0UL );
+  FD_TEST( store_wksp );
+  ulong * store = (ulong *)fd_wksp_alloc_laddr( store_wksp, 64UL, STORE_SZ, 1UL );
+  FD_TEST( store );
+  fd_rng_t _rng[1]; fd_rng_t * rng = fd_rng_join( fd_rng_new( _rng, 0U, 0UL ) );
+  for( ulong i=0UL; i<STORE_SZ/8UL; i++ ) store[ i ] = fd_rng_ulong( rng );
+
+  static uchar tpool_mem[ FD_TPOOL_FOOTPRINT( FD_TILE_MAX ) ] __attribute__((aligned(FD_TPOOL_ALIGN)));
+  fd_tpool_t * tpool = fd_tpool_init( tpool_mem, tile_cnt );
+  FD_TEST( tpool );
+
+  static fd_wksp_t * scratch_wksp[ FD_TILE_MAX ];
+  static uchar *     smem        [ FD_TILE_MAX ];
+
+  double ns_per_txn[ 2 ];
+  for( int remote=0; remote<2; remote++ ) {
+    for( ulong t=0UL; t<tile_cnt; t++ ) {
+      ulong cpu  = fd_tile_cpu_id( t );
+      ulong numa = fd_ulong_if( cpu<fd_shmem_cpu_cnt(), fd_shmem_numa_idx( cpu ), 0UL );
+      if( remote ) numa = (numa+1UL) % numa_cnt;
+      char name[ FD_SHMEM_NAME_MAX ];
+      scratch_wksp[ t ] = fd_wksp_new_anonymous( page_sz, wksp_page_cnt( scratch_sz, page_sz ), fd_shmem_cpu_idx( numa ),
+                                                 fd_cstr_printf( name, FD_SHMEM_NAME_MAX, NULL, "scratch%lu", t ), 0UL );
+      FD_TEST( scratch_wksp[ t ] );
+      smem[ t ] = (uchar *)fd_wksp_alloc_laddr( scratch_wksp[ t ], FD_SCRATCH_SMEM_ALIGN, scratch_sz, 1UL );
+      FD_TEST( smem[ t ] );
+      fd_memset( smem[ t ], 0, scratch_sz ); /* prefault */
+    }
+
+    fd_scratch_attach( smem[ 0 ], fmem, scratch_sz, FD_TPOOL_WORKER_SCRATCH_DEPTH );
+    for( ulong t=1UL; t<tile_cnt; t++ ) FD_TEST( fd_tpool_worker_push( tpool, t, smem[ t ], scratch_sz ) );
+
+    fd_tpool_exec_all_rrobin( tpool, 0UL, tile_cnt, txn_task, NULL, store, sum, SUM_STRIDE, 0UL, txn_cnt ); /* warmup */
+
+    long dt = -fd_log_wallclock();
+    for( ulong iter=0UL; iter<iter_cnt; iter++ )
+      fd_tpool_exec_all_rrobin( tpool, 0UL, tile_cnt, txn_task, NULL, store, sum, SUM_STRIDE, 0UL, txn_cnt );
+    dt += fd_log_wallclock();
+
+    ns_per_txn[ remote ] = (double)dt / (double)(iter_cnt*txn_cnt);
+    FD_LOG_NOTICE(( "%-6s scratch: %8.1f ns/txn %9.1f Ktxn/s", remote ? "remote" : "local",
+                    ns_per_txn[ remote ], 1e6/ns_per_txn[ remote ] ));
+
+    for( ulong t=1UL; t<tile_cnt; t++ ) FD_TEST( fd_tpool_worker_pop( tpool ) );
+    fd_scratch_detach( NULL );
+
+    for( ulong t=0UL; t<tile_cnt; t++ ) {
+      fd_wksp_free_laddr( smem[ t ] );
+      fd_wksp_delete_anonymous( scratch_wksp[ t ] );
+    }
+  }
+
+  ulong acc = 0UL;
+  for( ulong t=0UL; t<tile_cnt; t++ ) acc += sum[ t*SUM_STRIDE ];
+  FD_LOG_NOTICE(( "remote/local: %.3f (checksum %016lx)", ns_per_txn[ 1 ]/ns_per_txn[ 0 ], acc ));
+
+  fd_tpool_fini( tpool );
+  fd_rng_delete( fd_rng_leave( rng ) );
+  fd_wksp_free_laddr( store );
+  fd_wksp_delete_anonymous( store_wksp );
+
+  FD_LOG_NOTICE(( "pass" ));
+  fd_halt();
+  return 0;
+}
@@ -0,0 +1,408 @@
+#include "fd_replay_sched.h"
+
+#define FD_REPLAY_SCHED_MAGIC (0xf17eda2ce75c4ed0UL) /* firedancer replay sched ver 0 */
+
+FD_FN_CONST static inline fd_replay_sched_item_t *
+fd_replay_sched_private_item( fd_replay_sched_t const * sched ) {
+  return (fd_replay_sched_item_t *)fd_ulong_align_up( (ulong)(sched+1), alignof(fd_replay_sched_item_t) );
+}
+
+FD_FN_PURE static inline fd_txn_p_t *
+fd_replay_sched_private_txn( fd_replay_sched_t const * sched ) {
+  return (fd_txn_p_t *)fd_ulong_align_up( (ulong)(fd_replay_sched_private_item( sched ) + sched->item_max ), alignof(fd_txn_p_t) );
+}
+
+ulong
+fd_replay_sched_align( void ) {
+  return FD_REPLAY_SCHED_ALIGN;
+}
+
+ulong
+fd_replay_sched_footprint( ulong item_max,
+                           ulong txn_max ) {
+  if( FD_UNLIKELY( (!item_max) | (!fd_ulong_is_pow2( item_max )) | (item_max>(1UL<<20)) ) ) return 0UL;
+  if( FD_UNLIKELY( (!txn_max) | (txn_max>(1UL<<24)) ) ) return 0UL;
+  ulong l = FD_LAYOUT_INIT;
+  l = FD_LAYOUT_APPEND( l, FD_REPLAY_SCHED_ALIGN,          sizeof(fd_replay_sched_t)                );
+  l = FD_LAYOUT_APPEND( l, alignof(fd_replay_sched_item_t), item_max*sizeof(fd_replay_sched_item_t) );
+  l = FD_LAYOUT_APPEND( l, alignof(fd_txn_p_t),             txn_max*sizeof(fd_txn_p_t)              );
+  return FD_LAYOUT_FINI( l, FD_REPLAY_SCHED_ALIGN );
+}
+
+void *
+fd_replay_sched_new( void * shmem,
+                     ulong  item_max,
+                     ulong  txn_max,
+                     ulong  active_max ) {
+
+  if( FD_UNLIKELY( !shmem ) ) {
+    FD_LOG_WARNING(( "NULL shmem" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( !fd_ulong_is_aligned( (ulong)shmem, fd_replay_sched_align() ) ) ) {
+    FD_LOG_WARNING(( "misaligned shmem" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( !fd_replay_sched_footprint( item_max, txn_max ) ) ) {
+    FD_LOG_WARNING(( "bad item_max or txn_max" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( (!active_max) | (active_max>FD_REPLAY_SCHED_ACTIVE_MAX) ) ) {
+    FD_LOG_WARNING(( "bad active_max" ));
+    return NULL;
+  }
+
+  fd_replay_sched_t * sched = (fd_replay_sched_t *)shmem;
+  fd_memset( sched, 0, sizeof(fd_replay_sched_t) );
+
+  sched->item_max    = item_max;
+  sched->txn_max     = txn_max;
+  sched->active_max  = active_max;
+  sched->active_free = fd_ulong_mask_lsb( (int)active_max );
+
+  FD_COMPILER_MFENCE();
+  FD_VOLATILE( sched->magic ) = FD_REPLAY_SCHED_MAGIC;
+  FD_COMPILER_MFENCE();
+
+  return shmem;
+}
+
+fd_replay_sched_t *
+fd_replay_sched_join( void * shsched ) {
+
+  if( FD_UNLIKELY( !shsched ) ) {
+    FD_LOG_WARNING(( "NULL shsched" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( !fd_ulong_is_aligned( (ulong)shsched, fd_replay_sched_align() ) ) ) {
+    FD_LOG_WARNING(( "misaligned shsched" ));
+    return NULL;
+  }
+
+  fd_replay_sched_t * sched = (fd_replay_sched_t *)shsched;
+
+  if( FD_UNLIKELY( sched->magic!=FD_REPLAY_SCHED_MAGIC ) ) {
+    FD_LOG_WARNING(( "bad magic" ));
+    return NULL;
+  }
+
+  return sched;
+}
+
+void *
+fd_replay_sched_leave( fd_replay_sched_t const * sched ) {
+
+  if( FD_UNLIKELY( !sched ) ) {
+    FD_LOG_WARNING(( "NULL sched" ));
+    return NULL;
+  }
+
+  return (void *)sched;
+}
+
+void *
+fd_replay_sched_delete( void * shsched ) {
+
+  if( FD_UNLIKELY( !shsched ) ) {
+    FD_LOG_WARNING(( "NULL shsched" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( !fd_ulong_is_aligned( (ulong)shsched, fd_replay_sched_align() ) ) ) {
+    FD_LOG_WARNING(( "misaligned shsched" ));
+    return NULL;
+  }
+
+  fd_replay_sched_t * sched = (fd_replay_sched_t *)shsched;
+
+  if( FD_UNLIKELY( sched->magic!=FD_REPLAY_SCHED_MAGIC ) ) {
+    FD_LOG_WARNING(( "bad magic" ));
+    return NULL;
+  }
+
+  FD_COMPILER_MFENCE();
+  FD_VOLATILE( sched->magic ) = 0UL;
+  FD_COMPILER_MFENCE();
+
+  return shsched;
+}
+
+/* fd_replay_sched_private_slot_query returns the index of the entry of
+   open slot, or FD_REPLAY_SCHED_SLOT_MAX if slot is not open. */
+
+FD_FN_PURE static ulong
+fd_replay_sched_private_slot_query( fd_replay_sched_t const * sched,
+                                    ulong                     slot ) {
+  for( ulong i=0UL; i<FD_REPLAY_SCHED_SLOT_MAX; i++ ) {
+    if( sched->slot[ i ].open && sched->slot[ i ].slot==slot ) return i;
+  }
+  return FD_REPLAY_SCHED_SLOT_MAX;
+}
+
+/* fd_replay_sched_private_reclaim releases the oldest batches that are
+   done, along with their space in the arena. */
+
+static void
+fd_replay_sched_private_reclaim( fd_replay_sched_t * sched ) {
+  fd_replay_sched_item_t * item = fd_replay_sched_private_item( sched );
+  ulong mask = sched->item_max-1UL;
+  while( sched->item_head<sched->item_tail ) {
+    fd_replay_sched_item_t * oldest = item + (sched->item_head & mask);
+    if( oldest->state!=FD_REPLAY_SCHED_ITEM_STATE_DONE ) break;
+    sched->txn_head = oldest->txn_end;
+    sched->item_head++;
+  }
+}
+
+/* fd_replay_sched_private_slot_close closes the slot of entry idx and
+   drops its pending batches.  Returns the number of batches dropped. */
+
+static ulong
+fd_replay_sched_private_slot_close( fd_replay_sched_t * sched,
+                                    ulong               idx ) {
+  fd_replay_sched_slot_t * entry = sched->slot + idx;
+  fd_replay_sched_item_t * item  = fd_replay_sched_private_item( sched );
+  ulong mask = sched->item_max-1UL;
+
+  ulong drop_cnt = 0UL;
+  for( ulong i=sched->item_head; i<sched->item_tail; i++ ) {
+    fd_replay_sched_item_t * cur = item + (i & mask);
+    if( (cur->slot_idx!=idx) | (cur->state!=FD_REPLAY_SCHED_ITEM_STATE_PENDING) ) continue;
+    cur->state = FD_REPLAY_SCHED_ITEM_STATE_DONE;
+    sched->pending_cnt--;
+    drop_cnt++;
+  }
+
+  if( entry->started ) sched->active_free |= 1UL<<entry->active_idx;
+  entry->open = 0;
+  return drop_cnt;
+}
+
+long
+fd_replay_sched_oldest_ts( fd_replay_sched_t const * sched ) {
+  fd_replay_sched_item_t const * item = fd_replay_sched_private_item( sched );
+  ulong mask = sched->item_max-1UL;
+  for( ulong i=sched->item_head; i<sched->item_tail; i++ ) {
+    fd_replay_sched_item_t const * cur = item + (i & mask);
+    if( cur->state==FD_REPLAY_SCHED_ITEM_STATE_PENDING ) return cur->ts;
+  }
+  return LONG_MAX;
+}
+
+fd_replay_sched_item_t *
+fd_replay_sched_push( fd_replay_sched_t * sched,
+                      ulong               slot,
+                      ulong               parent_slot,
+                      int                 last,
+                      ulong               txn_cnt,
+                      long                now ) {
+
+  if( FD_UNLIKELY( sched->item_tail-sched->item_head>=sched->item_max ) ) return NULL;
+  if( FD_UNLIKELY( txn_cnt>sched->txn_max ) ) return NULL;
+
+  /* Batches are contiguous in the arena, so skip to the start of the
+     arena if the batch doesn't fit before the end. */
+
+  ulong off       = sched->txn_tail % sched->txn_max;
+  ulong txn_start = sched->txn_tail + fd_ulong_if( off+txn_cnt>sched->txn_max, sched->txn_max-off, 0UL );
+  ulong txn_end   = txn_start + txn_cnt;
+  if( FD_UNLIKELY( txn_end-sched->txn_head>sched->txn_max ) ) return NULL;
+
+  ulong idx = fd_replay_sched_private_slot_query( sched, slot );
+  if( idx==FD_REPLAY_SCHED_SLOT_MAX ) {
+    for( idx=0UL; idx<FD_REPLAY_SCHED_SLOT_MAX; idx++ ) if( !sched->slot[ idx ].open ) break;
+    if( FD_UNLIKELY( idx==FD_REPLAY_SCHED_SLOT_MAX ) ) return NULL;
+
+    fd_replay_sched_slot_t * entry = sched->slot + idx;
+    entry->slot        = slot;
+    entry->parent_slot = parent_slot;
+    entry->open        = 1;
+    entry->started     = 0;
+    entry->running     = 0;
+    entry->pending_cnt = 0UL;
+  }
+
+  fd_replay_sched_slot_t * entry = sched->slot + idx;
+  entry->pending_cnt++;
+  entry->ts = now;
+
+  fd_replay_sched_item_t * item = fd_replay_sched_private_item( sched ) + (sched->item_tail & (sched->item_max-1UL));
+  fd_memset( item, 0, sizeof(fd_replay_sched_item_t) );
+  item->slot        = slot;
+  item->parent_slot = parent_slot;
+  item->txn_cnt     = txn_cnt;
+  item->txns        = fd_replay_sched_private_txn( sched ) + (txn_start % sched->txn_max);
+  item->ts          = now;
+  item->last        = !!last;
+  item->state       = FD_REPLAY_SCHED_ITEM_STATE_PENDING;
+  item->slot_idx    = idx;
+  item->txn_end     = txn_end;
+
+  sched->item_tail++;
+  sched->txn_tail = txn_end;
+  sched->pending_cnt++;
+
+  return item;
+}
+
+int
+fd_replay_sched_is_open( fd_replay_sched_t const * sched,
+                         ulong                     slot ) {
+  return fd_replay_sched_private_slot_query( sched, slot )!=FD_REPLAY_SCHED_SLOT_MAX;
+}
+
+ulong
+fd_replay_sched_ready( fd_replay_sched_t *       sched,
+                       fd_replay_sched_item_t ** out,
+                       ulong                     out_max ) {
+  for( ulong i=0UL; i<FD_REPLAY_SCHED_SLOT_MAX; i++ ) sched->slot[ i ].mark = 0;
+
+  fd_replay_sched_item_t * item = fd_replay_sched_private_item( sched );
+  ulong mask       = sched->item_max-1UL;
+  ulong active_rem = (ulong)fd_ulong_popcnt( sched->active_free );
+  ulong out_cnt    = 0UL;
+
+  for( ulong i=sched->item_head; (i<sched->item_tail) & (out_cnt<out_max); i++ ) {
+    fd_replay_sched_item_t * cur = item + (i & mask);
+    if( cur->state!=FD_REPLAY_SCHED_ITEM_STATE_PENDING ) continue;
+
+    /* Only the oldest pending batch of a slot can be ready */
+
+    fd_replay_sched_slot_t * entry = sched->slot + cur->slot_idx;
+    if( entry->mark ) continue;
+    entry->mark = 1;
+    if( entry->running ) continue;
+
+    if( !entry->started ) {
+      if( fd_replay_sched_is_open( sched, entry->parent_slot ) ) continue;
+      if( !active_rem ) continue;
+      active_rem--;
+    }
+
+    out[ out_cnt++ ] = cur;
+  }
+
+  return out_cnt;
+}
+
+void
+fd_replay_sched_start( fd_replay_sched_t *      sched,
+                       fd_replay_sched_item_t * item ) {
+  fd_replay_sched_slot_t * entry = sched->slot + item->slot_idx;
+  if( !entry->started ) {
+    entry->started    = 1;
+    entry->active_idx = (ulong)fd_ulong_find_lsb( sched->active_free );
+    sched->active_free &= ~(1UL<<entry->active_idx);
+  }
+  entry->running   = 1;
+  item->state      = FD_REPLAY_SCHED_ITEM_STATE_RUNNING;
+  item->active_idx = entry->active_idx;
+  sched->pending_cnt--;
+}
+
+int
+fd_replay_sched_done( fd_replay_sched_t *      sched,
+                      fd_replay_sched_item_t * item ) {
+  fd_replay_sched_slot_t * entry = sched->slot + item->slot_idx;
+  item->state    = FD_REPLAY_SCHED_ITEM_STATE_DONE;
+  entry->running = 0;
+  entry->pending_cnt--;
+
+  int closed = item->last;
+  if( closed ) fd_replay_sched_private_slot_close( sched, item->slot_idx );
+
+  fd_replay_sched_private_reclaim( sched );
+  return closed;
+}
+
+ulong
+fd_replay_sched_cancel( fd_replay_sched_t * sched,
+                        ulong               slot ) {
+  ulong idx = fd_replay_sched_private_slot_query( sched, slot );
+  if( FD_UNLIKELY( idx==FD_REPLAY_SCHED_SLOT_MAX ) ) return 0UL;
+
+  /* Mark the slot and all open slots descending from it.  Open slots
+     form a forest with at most FD_REPLAY_SCHED_SLOT_MAX nodes, so this
+     converges after at most that many passes. */
+
+  for( ulong i=0UL; i<FD_REPLAY_SCHED_SLOT_MAX; i++ ) sched->slot[ i ].mark = 0;
+  sched->slot[ idx ].mark = 1;
+
+  for( int changed=1; changed; ) {
+    changed = 0;
+    for( ulong i=0UL; i<FD_REPLAY_SCHED_SLOT_MAX; i++ ) {
+      fd_replay_sched_slot_t * entry = sched->slot + i;
+      if( (!entry->open) | entry->mark ) continue;
+      ulong parent_idx = fd_replay_sched_private_slot_query( sched, entry->parent_slot );
+      if( (parent_idx!=FD_REPLAY_SCHED_SLOT_MAX) && sched->slot[ parent_idx ].mark ) {
+        entry->mark = 1;
+        changed     = 1;
+      }
+    }
+  }
+
+  ulong drop_cnt = 0UL;
+  for( ulong i=0UL; i<FD_REPLAY_SCHED_SLOT_MAX; i++ ) {
+    if( sched->slot[ i ].open & sched->slot[ i ].mark ) drop_cnt += fd_replay_sched_private_slot_close( sched, i );
+  }
+
+  fd_replay_sched_private_reclaim( sched );
+  return drop_cnt;
+}
+
+ulong
+fd_replay_sched_expire( fd_replay_sched_t * sched,
+                        long                now,
+                        long                ttl ) {
+  ulong expired_cnt = 0UL;
+  for( ulong i=0UL; i<FD_REPLAY_SCHED_SLOT_MAX; i++ ) {
+    fd_replay_sched_slot_t * entry = sched->slot + i;
+    if( (!entry->open) | entry->running ) continue;
+    if( FD_LIKELY( now-entry->ts<=ttl ) ) continue;
+    fd_replay_sched_cancel( sched, entry->slot );
+    expired_cnt++;
+  }
+  return expired_cnt;
+}
+
+ulong
+fd_replay_sched_plan( fd_replay_sched_item_t ** ready,
+                      ulong                     cnt,
+                      ulong                     worker_cnt,
+                      ulong                     lane_max,
+                      ulong *                   lane_t0 ) {
+  if( FD_UNLIKELY( !cnt ) ) return 0UL;
+
+  /* Stable insertion sort, cnt is small */
+
+  for( ulong i=1UL; i<cnt; i++ ) {
+    fd_replay_sched_item_t * cur = ready[ i ];
+    ulong j = i;
+    while( j ) {
+      fd_replay_sched_item_t * prv = ready[ j-1UL ];
+      int heavier = fd_int_if( cur->weight==prv->weight, cur->slot<prv->slot, cur->weight>prv->weight );
+      if( !heavier ) break;
+      ready[ j ] = prv;
+      j--;
+    }
+    ready[ j ] = cur;
+  }
+
+  worker_cnt = fd_ulong_max( worker_cnt, 1UL );
+  ulong lane_cnt = fd_ulong_min( fd_ulong_min( cnt, fd_ulong_max( lane_max, 1UL ) ), worker_cnt );
+  ulong base     = worker_cnt / lane_cnt;
+  ulong extra    = worker_cnt % lane_cnt;
+
+  ulong t = 0UL;
+  for( ulong i=0UL; i<lane_cnt; i++ ) {
+    lane_t0[ i ] = t;
+    t += base + (ulong)(i<extra);
+  }
+  lane_t0[ lane_cnt ] = worker_cnt;
+
+  return lane_cnt;
+}
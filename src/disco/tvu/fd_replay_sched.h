@@ -0,0 +1,243 @@
+#ifndef HEADER_fd_src_disco_tvu_fd_replay_sched_h
+#define HEADER_fd_src_disco_tvu_fd_replay_sched_h
+
+/* fd_replay_sched queues microblock batches received by the replay tile
+   and decides which of them can be executed concurrently.
+
+   Batches of the same slot are executed in order, one at a time, on
+   the fork (slot ctx + funk txn) of that slot.  The first batch of a
+   slot can only start once its parent slot is no longer open in the
+   scheduler, i.e. once the parent's last batch is done (or the parent
+   was never queued here, in which case it has either been replayed
+   already or the fork will be restored from funk as usual).  Batches of
+   distinct open slots whose parents are done are independent (they are
+   on distinct forks), so they can be executed concurrently, typically
+   on disjoint slices of the replay tpool (see fd_tpool_slice_init).
+
+   The number of slots that are started but not finished at any point
+   in time is bounded by active_max.  Each started slot is assigned an
+   index in [0,active_max) for its lifetime, which the caller can use to
+   give each concurrently executing fork its own per-fork state (e.g.
+   the latest vote deque).
+
+   Transactions of queued batches are copied into an arena owned by the
+   scheduler.  Space in the arena (and in the batch queue) is reclaimed
+   in queue order, as the oldest batches complete.
+
+   This is not thread safe, it is meant to be used by the replay tile
+   thread only (the execution of the batches is what is concurrent). */
+
+#include "../fd_disco_base.h"
+#include "../../ballet/pack/fd_microblock.h"
+
+#define FD_REPLAY_SCHED_ALIGN (128UL)
+
+/* FD_REPLAY_SCHED_SLOT_MAX is the max number of slots that can be open
+   in the scheduler at the same time.  FD_REPLAY_SCHED_ACTIVE_MAX is the
+   max number of slots that can be started at the same time.
+   FD_REPLAY_SCHED_LANE_MAX is the max number of batches that can be
+   planned for concurrent execution. */
+
+#define FD_REPLAY_SCHED_SLOT_MAX   (64UL)
+#define FD_REPLAY_SCHED_ACTIVE_MAX (4UL)
+#define FD_REPLAY_SCHED_LANE_MAX   FD_REPLAY_SCHED_ACTIVE_MAX
+
+#define FD_REPLAY_SCHED_ITEM_STATE_PENDING (0)
+#define FD_REPLAY_SCHED_ITEM_STATE_RUNNING (1)
+#define FD_REPLAY_SCHED_ITEM_STATE_DONE    (2)
+
+/* An fd_replay_sched_item_t describes a queued batch.  Fields in the
+   first group are owned by the caller (set after push, and the caller
+   can use them however it wants), the rest is owned by the scheduler. */
+
+struct fd_replay_sched_item {
+  ulong        flags;         /* REPLAY_FLAG_* */
+  ulong        seq;           /* in link seq of the batch */
+  ulong        tsorig;
+  uchar        blockhash[32];
+  ulong        weight;        /* used by fd_replay_sched_plan */
+
+  ulong        slot;
+  ulong        parent_slot;
+  ulong        txn_cnt;
+  fd_txn_p_t * txns;          /* points to txn_cnt txns in the arena */
+  long         ts;            /* when the batch was queued */
+  int          last;          /* non-zero if this is the last batch of the slot */
+  int          state;         /* FD_REPLAY_SCHED_ITEM_STATE_* */
+  ulong        active_idx;    /* valid while RUNNING */
+  ulong        slot_idx;      /* private, index of the slot's entry */
+  ulong        txn_end;       /* private, arena counter after this batch */
+};
+
+typedef struct fd_replay_sched_item fd_replay_sched_item_t;
+
+struct fd_replay_sched_slot {
+  ulong slot;
+  ulong parent_slot;
+  int   open;
+  int   started;
+  int   running;
+  int   mark;                 /* scratch used by ready and cancel */
+  ulong active_idx;           /* valid if started */
+  ulong pending_cnt;          /* queued batches that are not done */
+  long  ts;                   /* when the last batch was queued */
+};
+
+typedef struct fd_replay_sched_slot fd_replay_sched_slot_t;
+
+struct __attribute__((aligned(FD_REPLAY_SCHED_ALIGN))) fd_replay_sched_private {
+  ulong magic;                /* == FD_REPLAY_SCHED_MAGIC */
+
+  ulong item_max;             /* power of 2 */
+  ulong txn_max;
+  ulong active_max;           /* in [1,FD_REPLAY_SCHED_ACTIVE_MAX] */
+
+  ulong item_head;            /* oldest batch not yet reclaimed */
+  ulong item_tail;            /* next batch to be queued */
+  ulong txn_head;             /* arena counter of the oldest batch */
+  ulong txn_tail;             /* arena counter after the newest batch */
+
+  ulong active_free;          /* bit i set if active idx i is free */
+  ulong pending_cnt;
+
+  fd_replay_sched_slot_t slot[ FD_REPLAY_SCHED_SLOT_MAX ];
+
+  /* item_max fd_replay_sched_item_t follow here, followed by txn_max
+     fd_txn_p_t */
+};
+
+typedef struct fd_replay_sched_private fd_replay_sched_t;
+
+FD_PROTOTYPES_BEGIN
+
+/* fd_replay_sched_{align,footprint} return the alignment and footprint
+   of a memory region suitable for use as a scheduler that can hold up
+   to item_max batches (a power of 2) and txn_max txns.  footprint
+   returns 0 for bad arguments. */
+
+FD_FN_CONST ulong
+fd_replay_sched_align( void );
+
+FD_FN_CONST ulong
+fd_replay_sched_footprint( ulong item_max,
+                           ulong txn_max );
+
+/* fd_replay_sched_{new,join,leave,delete} have the usual local object
+   semantics.  active_max is the max number of slots that can be
+   started at the same time, in [1,FD_REPLAY_SCHED_ACTIVE_MAX]. */
+
+void *
+fd_replay_sched_new( void * shmem,
+                     ulong  item_max,
+                     ulong  txn_max,
+                     ulong  active_max );
+
+fd_replay_sched_t *
+fd_replay_sched_join( void * shsched );
+
+void *
+fd_replay_sched_leave( fd_replay_sched_t const * sched );
+
+void *
+fd_replay_sched_delete( void * shsched );
+
+FD_FN_PURE static inline ulong fd_replay_sched_txn_max    ( fd_replay_sched_t const * sched ) { return sched->txn_max;     }
+FD_FN_PURE static inline ulong fd_replay_sched_pending_cnt( fd_replay_sched_t const * sched ) { return sched->pending_cnt; }
+
+/* fd_replay_sched_oldest_ts returns the time the oldest pending batch
+   was queued, or LONG_MAX if there are no pending batches. */
+
+FD_FN_PURE long
+fd_replay_sched_oldest_ts( fd_replay_sched_t const * sched );
+
+/* fd_replay_sched_push queues a batch of txn_cnt txns for slot (child
+   of parent_slot) queued at time now.  last indicates the batch is the
+   last of the slot.  Returns the queued batch on success, the caller
+   should copy the txns into item->txns and fill in the caller owned
+   fields.  Returns NULL if there is no room for the batch right now
+   (too many batches, txns or open slots), in which case the caller
+   should execute what it can and try again.  Batches with more than
+   fd_replay_sched_txn_max txns can never be queued. */
+
+fd_replay_sched_item_t *
+fd_replay_sched_push( fd_replay_sched_t * sched,
+                      ulong               slot,
+                      ulong               parent_slot,
+                      int                 last,
+                      ulong               txn_cnt,
+                      long                now );
+
+/* fd_replay_sched_is_open returns 1 if slot is open (some of its
+   batches have been queued and its last batch is not done yet) and 0
+   otherwise. */
+
+FD_FN_PURE int
+fd_replay_sched_is_open( fd_replay_sched_t const * sched,
+                         ulong                     slot );
+
+/* fd_replay_sched_ready stores up to out_max batches that can be
+   started now in out, oldest first, and returns the number stored.
+   There is at most one batch per slot and starting all of them at the
+   same time is valid.  Does not change the state of any batch. */
+
+ulong
+fd_replay_sched_ready( fd_replay_sched_t *       sched,
+                       fd_replay_sched_item_t ** out,
+                       ulong                     out_max );
+
+/* fd_replay_sched_start marks item, as returned by ready, as running.
+   item->active_idx gives the active index of its slot. */
+
+void
+fd_replay_sched_start( fd_replay_sched_t *      sched,
+                       fd_replay_sched_item_t * item );
+
+/* fd_replay_sched_done marks running item as done and reclaims the
+   space of the oldest batches when possible.  Returns 1 if this was the
+   last batch of its slot (the slot is closed, which unblocks its
+   children) and 0 otherwise.  item should not be used after this. */
+
+int
+fd_replay_sched_done( fd_replay_sched_t *      sched,
+                      fd_replay_sched_item_t * item );
+
+/* fd_replay_sched_cancel closes slot and drops its pending batches, as
+   well as those of all open slots descending from it (e.g. because
+   slot turned out to be invalid).  slot should not be running.  Returns
+   the number of batches dropped. */
+
+ulong
+fd_replay_sched_cancel( fd_replay_sched_t * sched,
+                        ulong               slot );
+
+/* fd_replay_sched_expire cancels open slots that are not running and
+   for which no batch has been queued since now-ttl (e.g. slots that
+   were started but for which the rest of the block never arrived), so
+   they don't hold on to an active index forever.  Returns the number
+   of slots cancelled. */
+
+ulong
+fd_replay_sched_expire( fd_replay_sched_t * sched,
+                        long                now,
+                        long                ttl );
+
+/* fd_replay_sched_plan picks batches among the cnt ready batches in
+   ready to execute concurrently and splits worker_cnt tpool workers
+   between them.  ready is reordered heaviest first (by item->weight,
+   lower slot first on ties, which matches the choreo fork choice
+   rule).  Returns the number of lanes lane_cnt in [1,lane_max] (0 if
+   cnt is 0) and lane i should execute ready[i] on workers
+   [lane_t0[i],lane_t0[i+1]), so lane_t0 should have room for lane_max+1
+   entries.  Each lane gets at least one worker (lane_cnt is at most
+   worker_cnt) and spare workers go to the heaviest lanes. */
+
+ulong
+fd_replay_sched_plan( fd_replay_sched_item_t ** ready,
+                      ulong                     cnt,
+                      ulong                     worker_cnt,
+                      ulong                     lane_max,
+                      ulong *                   lane_t0 );
+
+FD_PROTOTYPES_END
+
+#endif /* HEADER_fd_src_disco_tvu_fd_replay_sched_h */
@@ -17,6 +17,7 @@ fd_store_new( void * mem, ulong lo_wmark_slot ) {
   fd_store_t * store = (fd_store_t *)mem;
   store->first_turbine_slot = FD_SLOT_NULL;
   store->curr_turbine_slot = FD_SLOT_NULL;
+  for( ulong i = 0; i < FD_STORE_STREAM_MAX; i++ ) store->stream[i].slot = FD_SLOT_NULL;
   store->pending_slots = fd_pending_slots_new( (uchar *)mem + fd_store_footprint(), lo_wmark_slot );
   if( FD_UNLIKELY( !store->pending_slots ) ) {    
     return NULL;
@@ -200,6 +201,128 @@ fd_store_shred_insert( fd_store_t * store,
   return rc;
 }
 
+/* Streams that have not streamed any batch for this long are reclaimed */
+#define FD_STORE_STREAM_TTL ( (long)10e9 )
+
+fd_store_stream_t *
+fd_store_slot_stream_query( fd_store_t * store,
+                            ulong        slot ) {
+  for( ulong i = 0; i < FD_STORE_STREAM_MAX; i++ ) {
+    if( store->stream[i].slot == slot ) return &store->stream[i];
+  }
+  return NULL;
+}
+
+/* fd_store_slot_stream_acquire returns a free stream, reclaiming the
+   streams of slots that were executed or rooted past.  Once a batch of
+   a slot was streamed, replay has started executing it, so the stream
+   must not be reclaimed before that (even if it stalls or turns out to
+   be invalid): the slot would otherwise be streamed again from its
+   first batch, or replayed as a whole block, and replay would execute
+   the batches it already has a second time.  A stream that did not
+   stream any batch yet is reclaimed once it stalls.  Returns NULL if
+   all the streams are busy. */
+
+static fd_store_stream_t *
+fd_store_slot_stream_acquire( fd_store_t * store ) {
+  fd_store_stream_t * free = NULL;
+  for( ulong i = 0; i < FD_STORE_STREAM_MAX; i++ ) {
+    fd_store_stream_t * stream = &store->stream[i];
+    if( stream->slot != FD_SLOT_NULL ) {
+      fd_block_t * block = fd_blockstore_block_query( store->blockstore, stream->slot );
+      int done = ( block && fd_uchar_extract_bit( block->flags, FD_BLOCK_FLAG_PROCESSED ) ) ||
+                 stream->slot < store->blockstore->smr ||
+                 ( !stream->batch_cnt && store->now - stream->ts > FD_STORE_STREAM_TTL );
+      if( !done ) continue;
+      stream->slot = FD_SLOT_NULL;
+    }
+    if( !free ) free = stream;
+  }
+  return free;
+}
+
+int
+fd_store_slot_stream( fd_store_t *       store,
+                      ulong              slot,
+                      uchar *            buf,
+                      ulong              buf_max,
+                      fd_valloc_t        valloc,
+                      fd_store_batch_t * out ) {
+  fd_blockstore_t * blockstore = store->blockstore;
+  int               rc         = FD_STORE_STREAM_NONE;
+
+  fd_blockstore_start_read( blockstore );
+
+  fd_store_stream_t * stream = fd_store_slot_stream_query( store, slot );
+  if( !stream ) {
+    /* Only start streaming blocks that are still incomplete and whose
+       parent was executed, so the poh chain can be verified from the
+       parent's block hash.  Slots rooted past are not streamed again
+       (their stream may have been reclaimed). */
+
+    if( slot < blockstore->smr ) goto end;
+    if( fd_blockstore_block_query( blockstore, slot ) ) goto end;
+    fd_slot_meta_t * slot_meta = fd_blockstore_slot_meta_query( blockstore, slot );
+    if( FD_UNLIKELY( !slot_meta || slot_meta->consumed == ULONG_MAX ) ) goto end;
+    fd_block_t * parent_block = fd_blockstore_block_query( blockstore, slot_meta->parent_slot );
+    if( !parent_block || !fd_uchar_extract_bit( parent_block->flags, FD_BLOCK_FLAG_PROCESSED ) ) goto end;
+    fd_hash_t const * parent_hash = fd_blockstore_block_hash_query( blockstore, slot_meta->parent_slot );
+    if( FD_UNLIKELY( !parent_hash ) ) goto end;
+
+    stream = fd_store_slot_stream_acquire( store );
+    if( FD_UNLIKELY( !stream ) ) goto end;
+    stream->slot        = slot;
+    stream->parent_slot = slot_meta->parent_slot;
+    stream->shred_idx   = 0;
+    stream->batch_cnt   = 0;
+    stream->poh         = *parent_hash;
+    stream->invalid     = 0;
+    stream->ts          = store->now;
+  }
+
+  if( FD_UNLIKELY( stream->invalid ) ) goto end;
+
+  ulong batch_sz;
+  uint  end_idx;
+  if( fd_blockstore_batch_query( blockstore, slot, stream->shred_idx, buf, buf_max, &batch_sz, &end_idx ) != FD_BLOCKSTORE_OK ) goto end;
+
+  fd_slot_meta_t * slot_meta = fd_blockstore_slot_meta_query( blockstore, slot );
+  out->slot        = slot;
+  out->parent_slot = stream->parent_slot;
+  out->batch_idx   = stream->batch_cnt;
+  out->last        = slot_meta->last_index == end_idx;
+
+  if( FD_UNLIKELY( fd_runtime_microblock_batch_prepare( buf, batch_sz, valloc, &out->info ) ||
+                   out->info.raw_microblock_batch_sz != batch_sz ||
+                   !out->info.microblock_cnt ) ) {
+    FD_LOG_WARNING(( "failed to parse entry batch %lu of slot %lu", stream->batch_cnt, slot ));
+    stream->invalid = 1;
+    rc = FD_STORE_STREAM_INVALID;
+    goto end;
+  }
+
+  out->poh = stream->poh;
+  for( ulong i = 0; i < out->info.microblock_cnt; i++ ) {
+    fd_hash_t in_poh = out->poh;
+    if( FD_UNLIKELY( fd_runtime_microblock_verify( &out->info.microblock_infos[i], &in_poh, &out->poh ) ) ) {
+      FD_LOG_WARNING(( "poh verification failed for entry batch %lu of slot %lu", stream->batch_cnt, slot ));
+      stream->invalid = 1;
+      rc = FD_STORE_STREAM_INVALID;
+      goto end;
+    }
+  }
+
+  stream->poh       = out->poh;
+  stream->shred_idx = end_idx + 1;
+  stream->batch_cnt++;
+  stream->ts        = store->now;
+  rc = FD_STORE_STREAM_BATCH;
+
+end:
+  fd_blockstore_end_read( blockstore );
+  return rc;
+}
+
 void
 fd_store_shred_update_with_shred_from_turbine( fd_store_t * store,
                                               fd_shred_t const * shred ) {
@@ -13,9 +13,44 @@
 #define FD_STORE_SLOT_PREPARE_NEED_PARENT_EXEC    (3)
 #define FD_STORE_SLOT_PREPARE_ALREADY_EXECUTED    (4)
 
+#define FD_STORE_STREAM_NONE    (0)
+#define FD_STORE_STREAM_BATCH   (1)
+#define FD_STORE_STREAM_INVALID (-1)
+
+/* The max number of slots that can be streamed at the same time */
+#define FD_STORE_STREAM_MAX (16UL)
+
 /* The standard amount of time that we wait before repeating a slot */
 #define FD_REPAIR_BACKOFF_TIME ( (long)150e6 )
 
+/* fd_store_stream_t tracks a slot whose entry batches are handed to
+   replay as soon as they are contiguous from the start of the slot,
+   instead of once the whole block has been received. */
+
+struct fd_store_stream {
+  ulong     slot;        /* FD_SLOT_NULL if unused */
+  ulong     parent_slot;
+  uint      shred_idx;   /* first data shred of the next batch */
+  ulong     batch_cnt;   /* number of batches streamed so far */
+  fd_hash_t poh;         /* poh hash after the last streamed batch */
+  int       invalid;     /* the slot failed to parse or verify */
+  long      ts;          /* when the stream started or the last batch was streamed */
+};
+typedef struct fd_store_stream fd_store_stream_t;
+
+/* fd_store_batch_t describes an entry batch returned by
+   fd_store_slot_stream. */
+
+struct fd_store_batch {
+  ulong                      slot;
+  ulong                      parent_slot;
+  ulong                      batch_idx;  /* index of the batch in the slot */
+  int                        last;       /* non-zero if this is the last batch of the slot */
+  fd_hash_t                  poh;        /* poh hash after this batch, the block hash if last */
+  fd_microblock_batch_info_t info;       /* parsed batch */
+};
+typedef struct fd_store_batch fd_store_batch_t;
+
 struct __attribute__((aligned(128UL))) fd_store {
   long now;            /* Current time */
 
@@ -31,6 +66,9 @@ struct __attribute__((aligned(128UL))) fd_store {
 
   /* internal joins */
   fd_pending_slots_t * pending_slots;
+
+  /* slots being streamed */
+  fd_store_stream_t stream[ FD_STORE_STREAM_MAX ];
 };
 typedef struct fd_store fd_store_t;
 
@@ -84,6 +122,36 @@ fd_store_slot_repair( fd_store_t * store,
                       fd_repair_request_t * out_repair_reqs,
                       ulong out_repair_reqs_sz );
 
+/* fd_store_slot_stream returns the next entry batch of slot if it is
+   contiguous from the start of the slot (or from the previous batch
+   returned for the slot).  The batch is copied to buf (buf_max bytes),
+   parsed into out->info using valloc and its poh chain is verified,
+   starting from the block hash of the parent.  Slots are only streamed
+   once their parent has been executed, and only if their first batch
+   is streamed before the block is complete (complete blocks that were
+   not streamed are replayed as a whole).  Returns
+   FD_STORE_STREAM_BATCH if out was filled in, FD_STORE_STREAM_NONE if
+   there is no batch to stream right now and FD_STORE_STREAM_INVALID if
+   the batch failed to parse or verify (the slot is not streamed any
+   further).  The stream of a slot that streamed a batch is kept until
+   the slot is executed or rooted past, so no batch is ever returned
+   twice. */
+
+int
+fd_store_slot_stream( fd_store_t *       store,
+                      ulong              slot,
+                      uchar *            buf,
+                      ulong              buf_max,
+                      fd_valloc_t        valloc,
+                      fd_store_batch_t * out );
+
+/* fd_store_slot_stream_query returns the stream of slot, or NULL if
+   slot is not being streamed. */
+
+fd_store_stream_t *
+fd_store_slot_stream_query( fd_store_t * store,
+                            ulong        slot );
+
 void
 fd_store_shred_update_with_shred_from_turbine( fd_store_t * store,
                                                fd_shred_t const * shred );
@@ -0,0 +1,346 @@
+#include "fd_replay_sched.h"
+#include "../../ballet/sha256/fd_sha256.h"
+
+#define ITEM_MAX (64UL)
+#define TXN_MAX  (512UL)
+
+static uchar sched_mem[ 2UL<<20 ] __attribute__((aligned(FD_REPLAY_SCHED_ALIGN)));
+
+/* Synthetic forked block set: FORK_CNT sibling forks off slot 0, each a
+   chain of SLOT_CNT slots, each slot made of BATCH_CNT batches, each
+   batch made of WAVE_CNT waves of WAVE_WIDTH conflict free txns.  Like
+   in real replay, a wave can only use as many workers as it has txns
+   and waves are separated by a sync, so a single fork can't keep a
+   large tpool busy but several forks can. */
+
+#define FORK_CNT   (4UL)
+#define SLOT_CNT   (4UL)
+#define BATCH_CNT  (4UL)
+#define WAVE_CNT   (8UL)
+#define WAVE_WIDTH (2UL)
+#define BATCH_TXN  (WAVE_CNT*WAVE_WIDTH)
+#define TOTAL_SLOT (FORK_CNT*SLOT_CNT)
+#define TOTAL_TXN  (TOTAL_SLOT*BATCH_CNT*BATCH_TXN)
+
+static ulong hash_iter = 500UL;
+
+static uchar out_serial    [ TOTAL_TXN ][ 32 ];
+static uchar out_concurrent[ TOTAL_TXN ][ 32 ];
+static ulong batch_done    [ 1UL+TOTAL_SLOT ];
+
+static inline ulong slot_of  ( ulong f, ulong s ) { return 1UL + f*SLOT_CNT + s; }
+static inline ulong parent_of( ulong f, ulong s ) { return s ? slot_of( f, s-1UL ) : 0UL; }
+
+typedef struct {
+  ulong   slot;
+  ulong   parent_slot;
+  ulong   batch_idx;
+  ulong   txn0;         /* id of first txn of the batch */
+  uchar (*out)[ 32 ];
+} batch_t;
+
+static batch_t batches[ TOTAL_SLOT*BATCH_CNT ];
+
+static void
+txn_exec( void * tpool,
+          ulong  t0,      ulong t1,
+          void * args,
+          void * reduce,  ulong stride,
+          ulong  l0,      ulong l1,
+          ulong  m0,      ulong m1,
+          ulong  n0,      ulong n1 ) {
+  (void)tpool; (void)t0; (void)t1; (void)reduce; (void)stride; (void)l0; (void)l1; (void)n0; (void)n1;
+  batch_t const * batch = (batch_t const *)args;
+  for( ulong i=m0; i<m1; i++ ) {
+    ulong txn_id = batch->txn0 + i;
+    uchar h[ 32 ];
+    fd_memset( h, 0, 32UL );
+    FD_STORE( ulong, h, txn_id );
+    for( ulong rem=hash_iter; rem; rem-- ) fd_sha256_hash( h, 32UL, h );
+    fd_memcpy( batch->out[ txn_id ], h, 32UL );
+  }
+}
+
+/* batch_exec executes batch on workers [0,worker_cnt) of tpool,
+   checking the batch runs after its predecessors in the slot and after
+   its parent slot completed. */
+
+static void
+batch_exec( batch_t const * batch,
+            fd_tpool_t *    tpool,
+            ulong           worker_cnt ) {
+  FD_TEST( batch_done[ batch->slot ]==batch->batch_idx );
+  if( batch->parent_slot ) FD_TEST( batch_done[ batch->parent_slot ]==BATCH_CNT );
+
+  for( ulong w=0UL; w<WAVE_CNT; w++ ) {
+    ulong l0 = w*WAVE_WIDTH;
+    fd_tpool_exec_all_block( tpool, 0UL, fd_ulong_min( worker_cnt, WAVE_WIDTH ), txn_exec, NULL,
+                             (void *)batch, NULL, 1UL, l0, l0+WAVE_WIDTH );
+  }
+
+  FD_COMPILER_MFENCE();
+  batch_done[ batch->slot ] = batch->batch_idx+1UL;
+}
+
+typedef struct {
+  batch_t const * batch;
+  fd_tpool_t *    tpool;
+  ulong           t0;
+  ulong           t1;
+  uchar           slice_mem[ FD_TPOOL_FOOTPRINT( FD_TILE_MAX ) ] __attribute__((aligned(FD_TPOOL_ALIGN)));
+} lane_t;
+
+static lane_t lanes[ FD_REPLAY_SCHED_LANE_MAX ];
+
+static void
+lane_exec( lane_t * lane ) {
+  fd_tpool_t * slice = fd_tpool_slice_init( lane->slice_mem, lane->tpool, lane->t0, lane->t1 );
+  FD_TEST( slice );
+  batch_exec( lane->batch, slice, lane->t1-lane->t0 );
+}
+
+static void
+lane_task( void * tpool,
+           ulong  t0,      ulong t1,
+           void * args,
+           void * reduce,  ulong stride,
+           ulong  l0,      ulong l1,
+           ulong  m0,      ulong m1,
+           ulong  n0,      ulong n1 ) {
+  (void)tpool; (void)t0; (void)t1; (void)reduce; (void)stride; (void)l0; (void)l1; (void)m0; (void)m1; (void)n0; (void)n1;
+  lane_exec( (lane_t *)args );
+}
+
+static void
+test_sched_basic( void ) {
+  ulong footprint = fd_replay_sched_footprint( ITEM_MAX, TXN_MAX );
+  FD_TEST( footprint && footprint<=sizeof(sched_mem) );
+  FD_TEST( !fd_replay_sched_footprint( 0UL,  TXN_MAX ) );
+  FD_TEST( !fd_replay_sched_footprint( 3UL,  TXN_MAX ) );
+  FD_TEST( !fd_replay_sched_footprint( 64UL, 0UL     ) );
+
+  FD_TEST( !fd_replay_sched_new( NULL,          ITEM_MAX, TXN_MAX, 2UL                            ) );
+  FD_TEST( !fd_replay_sched_new( sched_mem+1UL, ITEM_MAX, TXN_MAX, 2UL                            ) );
+  FD_TEST( !fd_replay_sched_new( sched_mem,     3UL,      TXN_MAX, 2UL                            ) );
+  FD_TEST( !fd_replay_sched_new( sched_mem,     ITEM_MAX, TXN_MAX, 0UL                            ) );
+  FD_TEST( !fd_replay_sched_new( sched_mem,     ITEM_MAX, TXN_MAX, FD_REPLAY_SCHED_ACTIVE_MAX+1UL ) );
+
+  fd_replay_sched_t * sched = fd_replay_sched_join( fd_replay_sched_new( sched_mem, ITEM_MAX, 16UL, 2UL ) );
+  FD_TEST( sched );
+  FD_TEST( fd_replay_sched_txn_max( sched )==16UL );
+  FD_TEST( fd_replay_sched_oldest_ts( sched )==LONG_MAX );
+
+  fd_replay_sched_item_t * ready[ FD_REPLAY_SCHED_SLOT_MAX ];
+
+  /* Slot 2 is a child of slot 1, slot 3 is a sibling of slot 1 */
+
+  fd_replay_sched_item_t * a0 = fd_replay_sched_push( sched, 1UL, 0UL, 0, 4UL, 10L ); FD_TEST( a0 );
+  fd_replay_sched_item_t * b0 = fd_replay_sched_push( sched, 2UL, 1UL, 1, 4UL, 11L ); FD_TEST( b0 );
+  fd_replay_sched_item_t * a1 = fd_replay_sched_push( sched, 1UL, 0UL, 1, 4UL, 12L ); FD_TEST( a1 );
+  fd_replay_sched_item_t * c0 = fd_replay_sched_push( sched, 3UL, 0UL, 1, 4UL, 13L ); FD_TEST( c0 );
+  FD_TEST( !fd_replay_sched_push( sched, 4UL, 0UL, 1, 1UL, 14L ) ); /* arena full */
+  FD_TEST( !fd_replay_sched_push( sched, 4UL, 0UL, 1, 17UL, 14L ) ); /* too large */
+  FD_TEST( fd_replay_sched_pending_cnt( sched )==4UL );
+  FD_TEST( fd_replay_sched_oldest_ts( sched )==10L );
+  FD_TEST( fd_replay_sched_is_open( sched, 1UL ) & fd_replay_sched_is_open( sched, 2UL ) & !fd_replay_sched_is_open( sched, 0UL ) );
+
+  FD_TEST( fd_replay_sched_ready( sched, ready, FD_REPLAY_SCHED_SLOT_MAX )==2UL );
+  FD_TEST( ready[0]==a0 && ready[1]==c0 );
+  FD_TEST( fd_replay_sched_ready( sched, ready, 1UL )==1UL && ready[0]==a0 );
+
+  fd_replay_sched_start( sched, a0 );
+  fd_replay_sched_start( sched, c0 );
+  FD_TEST( a0->active_idx!=c0->active_idx && a0->active_idx<2UL && c0->active_idx<2UL );
+  FD_TEST( fd_replay_sched_oldest_ts( sched )==11L );
+  FD_TEST( fd_replay_sched_ready( sched, ready, FD_REPLAY_SCHED_SLOT_MAX )==0UL ); /* slot 1 running, slot 2 blocked */
+
+  FD_TEST( !fd_replay_sched_done( sched, a0 ) );
+  FD_TEST( fd_replay_sched_ready( sched, ready, FD_REPLAY_SCHED_SLOT_MAX )==1UL && ready[0]==a1 );
+  fd_replay_sched_start( sched, a1 );
+  FD_TEST( a1->active_idx!=c0->active_idx );
+
+  /* Slot 2 can start once its parent is done */
+
+  FD_TEST( fd_replay_sched_done( sched, a1 ) );
+  FD_TEST( !fd_replay_sched_is_open( sched, 1UL ) );
+  FD_TEST( fd_replay_sched_ready( sched, ready, FD_REPLAY_SCHED_SLOT_MAX )==1UL && ready[0]==b0 );
+  fd_replay_sched_start( sched, b0 );
+  FD_TEST( fd_replay_sched_done( sched, c0 ) );
+  FD_TEST( fd_replay_sched_done( sched, b0 ) );
+  FD_TEST( !fd_replay_sched_pending_cnt( sched ) );
+
+  /* Space is reclaimed once done */
+
+  fd_replay_sched_item_t * d0 = fd_replay_sched_push( sched, 4UL, 0UL, 0, 16UL, 20L ); FD_TEST( d0 );
+  fd_replay_sched_item_t * e0 = fd_replay_sched_push( sched, 5UL, 4UL, 0, 0UL,  21L ); FD_TEST( e0 );
+  fd_replay_sched_item_t * f0 = fd_replay_sched_push( sched, 6UL, 5UL, 1, 0UL,  22L ); FD_TEST( f0 );
+  fd_replay_sched_item_t * g0 = fd_replay_sched_push( sched, 7UL, 0UL, 1, 0UL,  23L ); FD_TEST( g0 );
+
+  /* Cancelling a slot drops its descendants */
+
+  FD_TEST( fd_replay_sched_cancel( sched, 4UL )==3UL );
+  FD_TEST( !fd_replay_sched_is_open( sched, 5UL ) & !fd_replay_sched_is_open( sched, 6UL ) );
+  FD_TEST( fd_replay_sched_ready( sched, ready, FD_REPLAY_SCHED_SLOT_MAX )==1UL && ready[0]==g0 );
+
+  /* Expire slots that stopped receiving batches */
+
+  fd_replay_sched_item_t * h0 = fd_replay_sched_push( sched, 8UL, 0UL, 0, 1UL, 30L ); FD_TEST( h0 );
+  fd_replay_sched_start( sched, h0 );
+  FD_TEST( !fd_replay_sched_done( sched, h0 ) );
+  FD_TEST( fd_replay_sched_expire( sched, 35L, 20L )==0UL );
+  FD_TEST( fd_replay_sched_expire( sched, 45L, 10L )==2UL ); /* slots 7 and 8 */
+  FD_TEST( !fd_replay_sched_is_open( sched, 8UL ) );
+  FD_TEST( !fd_replay_sched_pending_cnt( sched ) );
+
+  /* Slot table full */
+
+  for( ulong i=0UL; i<FD_REPLAY_SCHED_SLOT_MAX; i++ ) FD_TEST( fd_replay_sched_push( sched, 100UL+i, 0UL, 1, 0UL, 40L ) );
+  FD_TEST( !fd_replay_sched_push( sched, 1000UL, 0UL, 1, 0UL, 40L ) );
+  FD_TEST( fd_replay_sched_ready( sched, ready, FD_REPLAY_SCHED_SLOT_MAX )==2UL ); /* bounded by active_max */
+
+  /* Plan: heaviest first, lower slot on ties, spare workers to the
+     heaviest lanes */
+
+  fd_replay_sched_item_t it[ 4 ];
+  fd_memset( it, 0, sizeof(it) );
+  it[0].slot = 10UL; it[0].weight = 5UL;
+  it[1].slot = 11UL; it[1].weight = 9UL;
+  it[2].slot = 12UL; it[2].weight = 5UL;
+  it[3].slot =  9UL; it[3].weight = 5UL;
+  fd_replay_sched_item_t * plan[ 4 ] = { it+0, it+1, it+2, it+3 };
+  ulong lane_t0[ FD_REPLAY_SCHED_LANE_MAX+1UL ];
+  FD_TEST( fd_replay_sched_plan( plan, 0UL, 8UL, 3UL, lane_t0 )==0UL );
+  FD_TEST( fd_replay_sched_plan( plan, 4UL, 8UL, 3UL, lane_t0 )==3UL );
+  FD_TEST( plan[0]==it+1 && plan[1]==it+3 && plan[2]==it+0 && plan[3]==it+2 );
+  FD_TEST( lane_t0[0]==0UL && lane_t0[1]==3UL && lane_t0[2]==6UL && lane_t0[3]==8UL );
+  FD_TEST( fd_replay_sched_plan( plan, 4UL, 2UL, 3UL, lane_t0 )==2UL );
+  FD_TEST( lane_t0[0]==0UL && lane_t0[1]==1UL && lane_t0[2]==2UL );
+
+  FD_TEST( fd_replay_sched_delete( fd_replay_sched_leave( sched ) )==sched_mem );
+}
+
+static long
+replay_serial( fd_tpool_t * tpool,
+               ulong        worker_cnt ) {
+  fd_memset( batch_done, 0, sizeof(batch_done) );
+  long dt = -fd_log_wallclock();
+  for( ulong i=0UL; i<TOTAL_SLOT*BATCH_CNT; i++ ) {
+    batches[ i ].out = out_serial;
+    batch_exec( &batches[ i ], tpool, worker_cnt );
+  }
+  dt += fd_log_wallclock();
+  return dt;
+}
+
+static long
+replay_concurrent( fd_tpool_t * tpool,
+                   ulong        worker_cnt,
+                   ulong        lane_max ) {
+  fd_memset( batch_done, 0, sizeof(batch_done) );
+
+  fd_replay_sched_t * sched = fd_replay_sched_join( fd_replay_sched_new( sched_mem, ITEM_MAX, TXN_MAX, FD_REPLAY_SCHED_ACTIVE_MAX ) );
+  FD_TEST( sched );
+
+  fd_replay_sched_item_t * ready[ FD_REPLAY_SCHED_SLOT_MAX ];
+  ulong lane_t0[ FD_REPLAY_SCHED_LANE_MAX+1UL ];
+  ulong next = 0UL;
+  ulong round_cnt = 0UL;
+
+  long dt = -fd_log_wallclock();
+  for(;;) {
+
+    /* Queue as many batches as possible, in arrival order */
+
+    while( next<TOTAL_SLOT*BATCH_CNT ) {
+      batch_t * batch = &batches[ next ];
+      fd_replay_sched_item_t * item = fd_replay_sched_push( sched, batch->slot, batch->parent_slot,
+                                                            batch->batch_idx==BATCH_CNT-1UL, BATCH_TXN, 0L );
+      if( !item ) break;
+      batch->out   = out_concurrent;
+      item->seq    = next;
+      item->weight = batch->slot % FORK_CNT;
+      next++;
+    }
+
+    ulong ready_cnt = fd_replay_sched_ready( sched, ready, FD_REPLAY_SCHED_SLOT_MAX );
+    if( !ready_cnt ) break;
+
+    ulong lane_cnt = fd_replay_sched_plan( ready, ready_cnt, worker_cnt, lane_max, lane_t0 );
+    for( ulong i=1UL; i<lane_cnt; i++ ) FD_TEST( ready[i-1UL]->weight>=ready[i]->weight );
+    for( ulong i=0UL; i<lane_cnt; i++ ) {
+      fd_replay_sched_start( sched, ready[ i ] );
+      lanes[ i ].batch = &batches[ ready[ i ]->seq ];
+      lanes[ i ].tpool = tpool;
+      lanes[ i ].t0    = lane_t0[ i   ];
+      lanes[ i ].t1    = lane_t0[ i+1 ];
+    }
+
+    for( ulong i=1UL; i<lane_cnt; i++ )
+      fd_tpool_exec( tpool, lane_t0[ i ], lane_task, NULL, 0UL, 1UL, &lanes[ i ], NULL, 0UL, 0UL, 0UL, 0UL, 1UL, 0UL, 1UL );
+    lane_exec( &lanes[ 0 ] );
+    for( ulong i=1UL; i<lane_cnt; i++ ) fd_tpool_wait( tpool, lane_t0[ i ] );
+
+    for( ulong i=0UL; i<lane_cnt; i++ ) fd_replay_sched_done( sched, ready[ i ] );
+    round_cnt++;
+  }
+  dt += fd_log_wallclock();
+
+  FD_TEST( next==TOTAL_SLOT*BATCH_CNT );
+  FD_TEST( !fd_replay_sched_pending_cnt( sched ) );
+  for( ulong slot=1UL; slot<=TOTAL_SLOT; slot++ ) FD_TEST( batch_done[ slot ]==BATCH_CNT );
+  FD_LOG_NOTICE(( "%lu rounds for %lu batches", round_cnt, TOTAL_SLOT*BATCH_CNT ));
+
+  fd_replay_sched_delete( fd_replay_sched_leave( sched ) );
+  return dt;
+}
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+
+  hash_iter = fd_env_strip_cmdline_ulong( &argc, &argv, "--hash-iter", NULL, hash_iter );
+
+  test_sched_basic();
+
+  /* Batches arrive interleaved across forks, like shreds of competing
+     forks do */
+
+  ulong b = 0UL;
+  for( ulong s=0UL; s<SLOT_CNT; s++ ) {
+    for( ulong batch_idx=0UL; batch_idx<BATCH_CNT; batch_idx++ ) {
+      for( ulong f=0UL; f<FORK_CNT; f++ ) {
+        batch_t * batch = &batches[ b++ ];
+        batch->slot        = slot_of  ( f, s );
+        batch->parent_slot = parent_of( f, s );
+        batch->batch_idx   = batch_idx;
+        batch->txn0        = ((batch->slot-1UL)*BATCH_CNT + batch_idx)*BATCH_TXN;
+      }
+    }
+  }
+
+  static uchar tpool_mem[ FD_TPOOL_FOOTPRINT( FD_TILE_MAX ) ] __attribute__((aligned(FD_TPOOL_ALIGN)));
+  ulong worker_cnt = fd_tile_cnt();
+  fd_tpool_t * tpool = fd_tpool_init( tpool_mem, worker_cnt );
+  FD_TEST( tpool );
+  for( ulong i=1UL; i<worker_cnt; i++ ) FD_TEST( fd_tpool_worker_push( tpool, i, NULL, 0UL ) );
+
+  FD_LOG_NOTICE(( "replaying %lu forks x %lu slots x %lu batches x %lu txns on %lu workers",
+                  FORK_CNT, SLOT_CNT, BATCH_CNT, BATCH_TXN, worker_cnt ));
+
+  long dt_serial = replay_serial( tpool, worker_cnt );
+  FD_LOG_NOTICE(( "serial replay:     %8.3f ms", (double)dt_serial/1e6 ));
+
+  for( ulong lane_max=1UL; lane_max<=fd_ulong_min( FD_REPLAY_SCHED_LANE_MAX, worker_cnt ); lane_max<<=1 ) {
+    long dt_concurrent = replay_concurrent( tpool, worker_cnt, lane_max );
+    FD_TEST( !memcmp( out_serial, out_concurrent, sizeof(out_serial) ) );
+    FD_LOG_NOTICE(( "concurrent replay: %8.3f ms (%lu lanes, %.2fx)",
+                    (double)dt_concurrent/1e6, lane_max, (double)dt_serial/(double)dt_concurrent ));
+  }
+
+  FD_TEST( fd_tpool_fini( tpool )==tpool_mem );
+
+  FD_LOG_NOTICE(( "pass" ));
+  fd_halt();
+  return 0;
+}
@@ -0,0 +1,492 @@
+#include "fd_store.h"
+#include "../../ballet/bmtree/fd_bmtree.h"
+#include "../../flamenco/txn/fd_txn_generate.h"
+
+/* Synthetic slot stream: BATCH_CNT entry batches, each made of
+   TXN_ENTRY_CNT entries of txn_per_entry txns followed by TICK_CNT
+   ticks of hashes_per_tick hashes, shredded into legacy data shreds
+   that arrive (mostly) in order, spread evenly over a slot time.  The
+   execution of a txn is modeled by exec_iter rounds of sha256 over its
+   signature and the bank hash by chaining the results of all the txns
+   of the slot. */
+
+#define BATCH_CNT      (32UL)
+#define TXN_ENTRY_CNT  (4UL)
+#define TICK_CNT       (2UL)
+#define ENTRY_CNT      (TXN_ENTRY_CNT+TICK_CNT)
+#define TXN_ENTRY_MAX  (64UL)
+#define SHRED_PAYLOAD  (1000UL)
+#define FEC_SHRED_CNT  (32UL)
+#define SHRED_MAX      (8192UL)
+#define BLOCK_MAX      (SHRED_MAX*SHRED_PAYLOAD)
+
+static ulong txn_per_entry   = 12UL;
+static ulong hashes_per_tick = 2500UL;
+static ulong exec_iter       = 50UL;
+static long  slot_ns         = 400000000L;
+
+static uchar scratch_smem[ 256UL<<20 ] __attribute__((aligned(FD_SCRATCH_SMEM_ALIGN)));
+static ulong scratch_fmem[ 16UL ];
+
+static uchar     block_buf[ BLOCK_MAX ];
+static ulong     block_sz;
+static ulong     batch_off  [ BATCH_CNT+1UL ];
+static fd_hash_t batch_poh  [ BATCH_CNT ];
+static ulong     batch_txns [ BATCH_CNT ];
+static ulong     batch_end  [ BATCH_CNT ]; /* idx of the last shred of each batch */
+
+static uchar shreds     [ SHRED_MAX ][ FD_SHRED_MAX_SZ ];
+static ulong shred_order[ SHRED_MAX ];
+static ulong shred_cnt;
+
+static uchar stream_buf[ BLOCK_MAX ];
+
+/* txn_template creates a transfer-like txn template in payload, returns
+   its size. */
+
+static ulong
+txn_template( uchar payload[ static FD_TXN_MTU ] ) {
+  uchar       meta[ FD_TXN_MAX_SZ ] __attribute__((aligned(alignof(fd_txn_t))));
+  fd_pubkey_t signer   = {0};
+  fd_pubkey_t dest     = {0};
+  fd_pubkey_t program  = {0};
+  fd_txn_accounts_t accts = {
+    .signature_cnt         = 1,
+    .readonly_signed_cnt   = 0,
+    .readonly_unsigned_cnt = 1,
+    .acct_cnt              = 3,
+    .signers_w             = &signer,
+    .signers_r             = NULL,
+    .non_signers_w         = &dest,
+    .non_signers_r         = &program
+  };
+  FD_TEST( fd_txn_base_generate( meta, payload, 1UL, &accts, NULL ) );
+  uchar instr_accts[ 2 ] = { 0, 1 };
+  uchar instr_data[ 12 ] = { 2, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0 };
+  return fd_txn_add_instr( meta, payload, 2, instr_accts, 2UL, instr_data, sizeof(instr_data) );
+}
+
+static void
+poh_mixin_sigs( fd_hash_t *  poh,
+                uchar const  sigs[][ 64 ],
+                ulong        sig_cnt ) {
+  fd_bmtree_commit_t commit_mem[1];
+  fd_bmtree_commit_t * tree = fd_bmtree_commit_init( commit_mem, 32UL, 1UL, 0UL );
+  for( ulong i=0UL; i<sig_cnt; i++ ) {
+    fd_bmtree_node_t leaf;
+    fd_bmtree_hash_leaf( &leaf, sigs[ i ], 64UL, 1UL );
+    fd_bmtree_commit_append( tree, &leaf, 1UL );
+  }
+  fd_poh_mixin( poh, fd_bmtree_commit_fini( tree ) );
+}
+
+/* build_block serializes the entry batches of a block chained off
+   parent_hash into block_buf.  If corrupt_batch is a valid batch idx,
+   the poh hash of its first entry is corrupted.  Returns the block
+   hash. */
+
+static fd_hash_t
+build_block( fd_rng_t *        rng,
+             fd_hash_t const * parent_hash,
+             ulong             corrupt_batch ) {
+  uchar tmpl[ FD_TXN_MTU ];
+  ulong txn_sz = txn_template( tmpl );
+
+  fd_hash_t poh = *parent_hash;
+  ulong     off = 0UL;
+  for( ulong b=0UL; b<BATCH_CNT; b++ ) {
+    batch_off[ b ] = off;
+    FD_STORE( ulong, block_buf+off, ENTRY_CNT ); off += sizeof(ulong);
+    for( ulong e=0UL; e<ENTRY_CNT; e++ ) {
+      int   is_tick = e>=TXN_ENTRY_CNT;
+      ulong txn_cnt = is_tick ? 0UL : txn_per_entry;
+      fd_microblock_hdr_t * hdr = (fd_microblock_hdr_t *)( block_buf+off );
+      off += sizeof(fd_microblock_hdr_t);
+
+      uchar sigs[ TXN_ENTRY_MAX ][ 64 ];
+      for( ulong t=0UL; t<txn_cnt; t++ ) {
+        uchar * txn = block_buf+off;
+        fd_memcpy( txn, tmpl, txn_sz );
+        for( ulong j=0UL; j<64UL; j++ ) sigs[ t ][ j ] = fd_rng_uchar( rng );
+        fd_memcpy( txn+1UL, sigs[ t ], 64UL );
+        off += txn_sz;
+      }
+
+      hdr->txn_cnt  = txn_cnt;
+      hdr->hash_cnt = is_tick ? hashes_per_tick : 1UL;
+      if( is_tick ) {
+        fd_poh_append( &poh, hdr->hash_cnt );
+      } else {
+        poh_mixin_sigs( &poh, (uchar const (*)[ 64 ])sigs, txn_cnt );
+      }
+      fd_memcpy( hdr->hash, poh.uc, 32UL );
+      if( b==corrupt_batch && !e ) hdr->hash[ 0 ] ^= (uchar)1;
+    }
+    batch_poh [ b ] = poh;
+    batch_txns[ b ] = TXN_ENTRY_CNT*txn_per_entry;
+  }
+  batch_off[ BATCH_CNT ] = off;
+  block_sz = off;
+  FD_TEST( block_sz<=BLOCK_MAX );
+  return poh;
+}
+
+/* shred_block shreds block_buf for slot into legacy data shreds and
+   picks an arrival order: shreds of an FEC set arrive in random order
+   (as they are recovered), FEC sets arrive in order. */
+
+static void
+shred_block( fd_rng_t * rng,
+             ulong      slot,
+             ulong      parent_slot ) {
+  shred_cnt = 0UL;
+  for( ulong b=0UL; b<BATCH_CNT; b++ ) {
+    for( ulong off=batch_off[ b ]; off<batch_off[ b+1UL ]; off+=SHRED_PAYLOAD ) {
+      FD_TEST( shred_cnt<SHRED_MAX );
+      ulong        sz    = fd_ulong_min( SHRED_PAYLOAD, batch_off[ b+1UL ]-off );
+      fd_shred_t * shred = (fd_shred_t *)shreds[ shred_cnt ];
+      fd_memset( shred, 0, FD_SHRED_DATA_HEADER_SZ );
+      shred->variant         = (uchar)( FD_SHRED_TYPE_LEGACY_DATA | 0x05 );
+      shred->slot            = slot;
+      shred->idx             = (uint)shred_cnt;
+      shred->fec_set_idx     = (uint)( shred_cnt - shred_cnt%FEC_SHRED_CNT );
+      shred->data.parent_off = (ushort)( slot-parent_slot );
+      shred->data.size       = (ushort)( FD_SHRED_DATA_HEADER_SZ + sz );
+      if( off+sz==batch_off[ b+1UL ] ) { shred->data.flags |= FD_SHRED_DATA_FLAG_DATA_COMPLETE; batch_end[ b ] = shred_cnt; }
+      if( off+sz==block_sz           ) shred->data.flags |= FD_SHRED_DATA_FLAG_SLOT_COMPLETE;
+      fd_memcpy( shreds[ shred_cnt ] + FD_SHRED_DATA_HEADER_SZ, block_buf+off, sz );
+      shred_cnt++;
+    }
+  }
+
+  for( ulong i=0UL; i<shred_cnt; i++ ) shred_order[ i ] = i;
+  for( ulong i0=0UL; i0<shred_cnt; i0+=FEC_SHRED_CNT ) {
+    ulong n = fd_ulong_min( FEC_SHRED_CNT, shred_cnt-i0 );
+    for( ulong i=n-1UL; i; i-- ) {
+      ulong j = fd_rng_ulong_roll( rng, i+1UL );
+      ulong t = shred_order[ i0+i ]; shred_order[ i0+i ] = shred_order[ i0+j ]; shred_order[ i0+j ] = t;
+    }
+  }
+}
+
+static void
+insert_shred( fd_blockstore_t * blockstore,
+              ulong             i ) {
+  fd_blockstore_start_write( blockstore );
+  FD_TEST( fd_blockstore_shred_insert( blockstore, (fd_shred_t const *)shreds[ i ] )>=FD_BLOCKSTORE_OK );
+  fd_blockstore_end_write( blockstore );
+}
+
+static void
+mark_processed( fd_blockstore_t * blockstore,
+                ulong             slot ) {
+  fd_block_t * block = fd_blockstore_block_query( blockstore, slot );
+  FD_TEST( block );
+  block->flags = fd_uchar_set_bit( block->flags, FD_BLOCK_FLAG_PROCESSED );
+}
+
+/* exec_txns "executes" txns, chaining their results into bank_hash. */
+
+static void
+exec_txns( fd_txn_p_t const * txns,
+           ulong              txn_cnt,
+           fd_hash_t *        bank_hash ) {
+  for( ulong i=0UL; i<txn_cnt; i++ ) {
+    uchar h[ 32 ];
+    fd_sha256_hash( txns[ i ].payload + TXN( &txns[ i ] )->signature_off, 64UL, h );
+    for( ulong rem=exec_iter; rem; rem-- ) fd_sha256_hash( h, 32UL, h );
+    fd_sha256_t sha[1];
+    fd_sha256_init( sha );
+    fd_sha256_append( sha, bank_hash->uc, 32UL );
+    fd_sha256_append( sha, h, 32UL );
+    fd_sha256_fini( sha, bank_hash->uc );
+  }
+}
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+
+  char const * _page_sz = fd_env_strip_cmdline_cstr ( &argc, &argv, "--page-sz",         NULL, "gigantic"      );
+  ulong        page_cnt = fd_env_strip_cmdline_ulong( &argc, &argv, "--page-cnt",        NULL, 1UL             );
+  txn_per_entry         = fd_env_strip_cmdline_ulong( &argc, &argv, "--txn-per-entry",   NULL, txn_per_entry   );
+  hashes_per_tick       = fd_env_strip_cmdline_ulong( &argc, &argv, "--hashes-per-tick", NULL, hashes_per_tick );
+  exec_iter             = fd_env_strip_cmdline_ulong( &argc, &argv, "--exec-iter",       NULL, exec_iter       );
+  slot_ns               = fd_env_strip_cmdline_long ( &argc, &argv, "--slot-ns",         NULL, slot_ns         );
+  FD_TEST( txn_per_entry && txn_per_entry<=TXN_ENTRY_MAX );
+
+  fd_rng_t _rng[1]; fd_rng_t * rng = fd_rng_join( fd_rng_new( _rng, 1234U, 0UL ) );
+
+  fd_wksp_t * wksp = fd_wksp_new_anonymous( fd_cstr_to_shmem_page_sz( _page_sz ), page_cnt, fd_log_cpu_id(), "wksp", 0UL );
+  if( FD_UNLIKELY( !wksp ) ) FD_LOG_ERR(( "Unable to attach to wksp" ));
+
+  fd_scratch_attach( scratch_smem, scratch_fmem, sizeof(scratch_smem), 16UL );
+
+  void * blockstore_mem = fd_wksp_alloc_laddr( wksp, fd_blockstore_align(), fd_blockstore_footprint(), 1UL );
+  fd_blockstore_t * blockstore = fd_blockstore_join( fd_blockstore_new( blockstore_mem, 1UL, 42UL, 1UL<<14, 1UL<<6, 16 ) );
+  FD_TEST( blockstore );
+
+  void * store_mem = fd_wksp_alloc_laddr( wksp, fd_store_align(), fd_store_footprint(), 1UL );
+  fd_store_t * store = fd_store_join( fd_store_new( store_mem, 1UL ) );
+  FD_TEST( store );
+  store->blockstore = blockstore;
+  store->now        = fd_log_wallclock();
+
+  fd_store_batch_t batch[1];
+
+  /* Parent block: built off a zero hash, received as a whole */
+
+  ulong     parent_slot = 10UL;
+  fd_hash_t zero_hash   = {0};
+  fd_hash_t parent_hash = build_block( rng, &zero_hash, ULONG_MAX );
+  shred_block( rng, parent_slot, parent_slot-1UL );
+  for( ulong i=0UL; i<shred_cnt; i++ ) insert_shred( blockstore, shred_order[ i ] );
+  FD_TEST( fd_blockstore_block_query( blockstore, parent_slot ) );
+  FD_TEST( !memcmp( fd_blockstore_block_hash_query( blockstore, parent_slot ), &parent_hash, 32UL ) );
+
+  /* Stream a slot as its shreds arrive */
+
+  do {
+    ulong     slot       = 11UL;
+    fd_hash_t block_hash = build_block( rng, &parent_hash, ULONG_MAX );
+    shred_block( rng, slot, parent_slot );
+
+    /* Nothing is streamed until the parent is executed */
+
+    static uchar received[ SHRED_MAX ];
+    for( ulong i=0UL; i<2UL*FEC_SHRED_CNT; i++ ) { insert_shred( blockstore, shred_order[ i ] ); received[ shred_order[ i ] ] = 1; }
+    FD_TEST( fd_store_slot_stream( store, slot, stream_buf, BLOCK_MAX, fd_scratch_virtual(), batch )==FD_STORE_STREAM_NONE );
+    FD_TEST( !fd_store_slot_stream_query( store, slot ) );
+    mark_processed( blockstore, parent_slot );
+
+    ulong batch_idx = 0UL;
+    for( ulong i=2UL*FEC_SHRED_CNT; i<=shred_cnt; i++ ) {
+      int rc;
+      FD_SCRATCH_SCOPE_BEGIN {
+        while( (rc = fd_store_slot_stream( store, slot, stream_buf, BLOCK_MAX, fd_scratch_virtual(), batch ))==FD_STORE_STREAM_BATCH ) {
+          FD_TEST( batch->slot==slot && batch->parent_slot==parent_slot );
+          FD_TEST( batch->batch_idx==batch_idx );
+          FD_TEST( batch->info.txn_cnt==batch_txns[ batch_idx ] );
+          FD_TEST( !memcmp( &batch->poh, &batch_poh[ batch_idx ], 32UL ) );
+          FD_TEST( batch->last==(batch_idx==BATCH_CNT-1UL) );
+          batch_idx++;
+        }
+      } FD_SCRATCH_SCOPE_END;
+      FD_TEST( rc==FD_STORE_STREAM_NONE );
+
+      /* All batches fully covered by the contiguous shreds received so
+         far were streamed */
+
+      ulong contiguous = 0UL;
+      while( contiguous<shred_cnt && received[ contiguous ] ) contiguous++;
+      ulong expected = 0UL;
+      while( expected<BATCH_CNT && batch_end[ expected ]<contiguous ) expected++;
+      FD_TEST( batch_idx==expected );
+
+      if( i<shred_cnt ) { insert_shred( blockstore, shred_order[ i ] ); received[ shred_order[ i ] ] = 1; }
+    }
+    FD_TEST( batch_idx==BATCH_CNT );
+    FD_TEST( !memcmp( fd_blockstore_block_hash_query( blockstore, slot ), &block_hash, 32UL ) );
+    FD_TEST( fd_store_slot_stream_query( store, slot ) );
+  } while(0);
+
+  /* A batch that fails poh verification stops the stream */
+
+  do {
+    ulong slot = 12UL;
+    build_block( rng, &parent_hash, 3UL );
+    shred_block( rng, slot, parent_slot );
+    for( ulong i=0UL; i<shred_cnt; i++ ) insert_shred( blockstore, i );
+    /* the block is complete now, so start the stream by hand */
+    FD_TEST( fd_store_slot_stream( store, slot, stream_buf, BLOCK_MAX, fd_scratch_virtual(), batch )==FD_STORE_STREAM_NONE );
+    FD_TEST( !fd_store_slot_stream_query( store, slot ) );
+  } while(0);
+
+  do {
+    ulong slot = 13UL;
+    build_block( rng, &parent_hash, 3UL );
+    shred_block( rng, slot, parent_slot );
+    ulong i = 0UL;
+    for( ; !( ((fd_shred_t *)shreds[ i ])->data.flags & FD_SHRED_DATA_FLAG_DATA_COMPLETE ); i++ ) insert_shred( blockstore, i );
+    insert_shred( blockstore, i++ );
+    ulong ok_cnt = 0UL;
+    int   rc;
+    FD_SCRATCH_SCOPE_BEGIN {
+      for( ; i<shred_cnt; i++ ) {
+        while( (rc = fd_store_slot_stream( store, slot, stream_buf, BLOCK_MAX, fd_scratch_virtual(), batch ))==FD_STORE_STREAM_BATCH ) ok_cnt++;
+        if( rc==FD_STORE_STREAM_INVALID ) break;
+        insert_shred( blockstore, i );
+      }
+    } FD_SCRATCH_SCOPE_END;
+    FD_TEST( rc==FD_STORE_STREAM_INVALID );
+    FD_TEST( ok_cnt==3UL );
+    FD_TEST( fd_store_slot_stream( store, slot, stream_buf, BLOCK_MAX, fd_scratch_virtual(), batch )==FD_STORE_STREAM_NONE );
+  } while(0);
+
+  /* A stream that stalls (e.g. waiting for repair) after it streamed
+     batches is kept, however long the stall, so the slot is not
+     streamed again from its first batch.  Streams that did not stream
+     any batch yet are reclaimed once they stall. */
+
+  do {
+    ulong slot = 14UL;
+    build_block( rng, &parent_hash, ULONG_MAX );
+    shred_block( rng, slot, parent_slot );
+    ulong i = 0UL;
+    for( ; i<=batch_end[ 1 ]; i++ ) insert_shred( blockstore, i );
+    ulong batch_idx = 0UL;
+    FD_SCRATCH_SCOPE_BEGIN {
+      while( fd_store_slot_stream( store, slot, stream_buf, BLOCK_MAX, fd_scratch_virtual(), batch )==FD_STORE_STREAM_BATCH ) {
+        FD_TEST( batch->batch_idx==batch_idx );
+        batch_idx++;
+      }
+    } FD_SCRATCH_SCOPE_END;
+    FD_TEST( batch_idx==2UL );
+
+    /* slot 15 starts a stream that does not stream any batch */
+
+    shred_block( rng, 15UL, parent_slot );
+    insert_shred( blockstore, 0UL );
+    FD_TEST( fd_store_slot_stream( store, 15UL, stream_buf, BLOCK_MAX, fd_scratch_virtual(), batch )==FD_STORE_STREAM_NONE );
+    FD_TEST( fd_store_slot_stream_query( store, 15UL ) );
+
+    /* Long after, slot 16 starts a stream */
+
+    store->now += (long)60e9;
+    shred_block( rng, 16UL, parent_slot );
+    insert_shred( blockstore, 0UL );
+    FD_TEST( fd_store_slot_stream( store, 16UL, stream_buf, BLOCK_MAX, fd_scratch_virtual(), batch )==FD_STORE_STREAM_NONE );
+    FD_TEST( fd_store_slot_stream_query( store, 16UL ) );
+    FD_TEST( !fd_store_slot_stream_query( store, 15UL ) );
+    FD_TEST(  fd_store_slot_stream_query( store, 13UL ) ); /* invalid, but it streamed batches */
+    FD_TEST(  fd_store_slot_stream_query( store, slot ) );
+
+    /* The rest of slot 14 arrives: every batch is streamed exactly once */
+
+    shred_block( rng, slot, parent_slot );
+    for( ; i<shred_cnt; i++ ) {
+      insert_shred( blockstore, i );
+      FD_SCRATCH_SCOPE_BEGIN {
+        while( fd_store_slot_stream( store, slot, stream_buf, BLOCK_MAX, fd_scratch_virtual(), batch )==FD_STORE_STREAM_BATCH ) {
+          FD_TEST( batch->batch_idx==batch_idx );
+          FD_TEST( !memcmp( &batch->poh, &batch_poh[ batch_idx ], 32UL ) );
+          batch_idx++;
+        }
+      } FD_SCRATCH_SCOPE_END;
+    }
+    FD_TEST( batch_idx==BATCH_CNT );
+
+    /* Once slots are rooted past, their streams are reclaimed and they
+       are not streamed again */
+
+    ulong smr = blockstore->smr;
+    blockstore->smr = 17UL;
+    shred_block( rng, 17UL, parent_slot );
+    insert_shred( blockstore, 0UL );
+    FD_TEST( fd_store_slot_stream( store, 17UL, stream_buf, BLOCK_MAX, fd_scratch_virtual(), batch )==FD_STORE_STREAM_NONE );
+    FD_TEST( fd_store_slot_stream_query( store, 17UL ) );
+    FD_TEST( !fd_store_slot_stream_query( store, slot ) );
+    FD_TEST( !fd_store_slot_stream_query( store, 16UL ) );
+    FD_TEST( fd_store_slot_stream( store, 16UL, stream_buf, BLOCK_MAX, fd_scratch_virtual(), batch )==FD_STORE_STREAM_NONE );
+    FD_TEST( !fd_store_slot_stream_query( store, 16UL ) );
+    blockstore->smr = smr;
+  } while(0);
+
+  /* Latency from the last shred received to the bank hash, replaying
+     the same slot as a whole block once it is complete and streaming
+     its batches as they become contiguous.  Shreds arrive evenly over
+     slot_ns.  In streaming mode, parsing and poh verification (store
+     tile) and execution (replay tile) of a batch are pipelined with the
+     arrival of the next shreds: the time each step actually takes is
+     measured and laid out on a simulated timeline. */
+
+  build_block( rng, &parent_hash, ULONG_MAX );
+
+  fd_hash_t whole_hash  = {0};
+  long      whole_lat;
+  do {
+    ulong slot = 20UL;
+    shred_block( rng, slot, parent_slot );
+    for( ulong i=0UL; i<shred_cnt; i++ ) insert_shred( blockstore, shred_order[ i ] );
+
+    long tic = fd_log_wallclock();
+    FD_SCRATCH_SCOPE_BEGIN {
+      fd_block_t * block = fd_blockstore_block_query( blockstore, slot );
+      FD_TEST( block );
+      fd_block_info_t block_info;
+      FD_TEST( !fd_runtime_block_prepare( fd_blockstore_block_data_laddr( blockstore, block ), block->data_sz, fd_scratch_virtual(), &block_info ) );
+      fd_hash_t poh = parent_hash;
+      for( ulong b=0UL; b<block_info.microblock_batch_cnt; b++ ) {
+        fd_microblock_batch_info_t const * batch_info = &block_info.microblock_batch_infos[ b ];
+        for( ulong m=0UL; m<batch_info->microblock_cnt; m++ ) {
+          fd_hash_t in_poh = poh;
+          FD_TEST( !fd_runtime_microblock_verify( &batch_info->microblock_infos[ m ], &in_poh, &poh ) );
+        }
+      }
+      fd_txn_p_t * txns = fd_scratch_alloc( alignof(fd_txn_p_t), block_info.txn_cnt*sizeof(fd_txn_p_t) );
+      ulong txn_cnt = fd_runtime_block_collect_txns( &block_info, txns );
+      exec_txns( txns, txn_cnt, &whole_hash );
+    } FD_SCRATCH_SCOPE_END;
+    whole_lat = fd_log_wallclock() - tic;
+  } while(0);
+
+  fd_hash_t stream_hash = {0};
+  long      stream_lat  = 0L;
+  long      verify_tot  = 0L;
+  long      exec_tot    = 0L;
+  do {
+    ulong slot = 21UL;
+    shred_block( rng, slot, parent_slot );
+
+    long store_free = 0L;   /* when the store tile is done with the previous batches */
+    long exec_free  = 0L;   /* when replay is done with the previous batches */
+    ulong batch_cnt = 0UL;
+    for( ulong i=0UL; i<shred_cnt; i++ ) {
+      long arrival = (long)i * slot_ns / (long)shred_cnt;
+      insert_shred( blockstore, shred_order[ i ] );
+      for(;;) {
+        int  rc;
+        long verify_ns, exec_ns = 0L;
+        FD_SCRATCH_SCOPE_BEGIN {
+          long tic = fd_log_wallclock();
+          rc = fd_store_slot_stream( store, slot, stream_buf, BLOCK_MAX, fd_scratch_virtual(), batch );
+          verify_ns = fd_log_wallclock() - tic;
+          if( rc==FD_STORE_STREAM_BATCH ) {
+            tic = fd_log_wallclock();
+            fd_txn_p_t * txns = fd_scratch_alloc( alignof(fd_txn_p_t), batch->info.txn_cnt*sizeof(fd_txn_p_t) );
+            ulong txn_cnt = fd_runtime_microblock_batch_collect_txns( &batch->info, txns );
+            exec_txns( txns, txn_cnt, &stream_hash );
+            exec_ns = fd_log_wallclock() - tic;
+          }
+        } FD_SCRATCH_SCOPE_END;
+        if( rc!=FD_STORE_STREAM_BATCH ) break;
+        verify_tot += verify_ns;
+        exec_tot   += exec_ns;
+        store_free  = fd_long_max( arrival, store_free ) + verify_ns;
+        exec_free   = fd_long_max( store_free, exec_free ) + exec_ns;
+        batch_cnt++;
+      }
+    }
+    FD_TEST( batch_cnt==BATCH_CNT );
+    long last_arrival = (long)(shred_cnt-1UL) * slot_ns / (long)shred_cnt;
+    stream_lat = exec_free - last_arrival;
+  } while(0);
+
+  FD_TEST( !memcmp( &whole_hash, &stream_hash, 32UL ) );
+
+  FD_LOG_NOTICE(( "slot: %lu batches, %lu txns, %lu shreds over %.1f ms (parse+poh verify %.3f ms, exec %.3f ms)",
+                  BATCH_CNT, BATCH_CNT*TXN_ENTRY_CNT*txn_per_entry, shred_cnt, (double)slot_ns/1e6,
+                  (double)verify_tot/1e6, (double)exec_tot/1e6 ));
+  FD_LOG_NOTICE(( "last shred to bank hash: whole block %.3f ms, streamed %.3f ms (%.1fx)",
+                  (double)whole_lat/1e6, (double)stream_lat/1e6, (double)whole_lat/(double)fd_long_max( stream_lat, 1L ) ));
+
+  fd_scratch_detach( NULL );
+  fd_store_delete( fd_store_leave( store ) );
+  fd_wksp_delete_anonymous( wksp );
+  fd_rng_delete( fd_rng_leave( rng ) );
+
+  FD_LOG_NOTICE(( "pass" ));
+  fd_halt();
+  return 0;
+}
@@ -17,13 +17,24 @@ fd_epoch_leaders_footprint( ulong pub_cnt,
   return FD_EPOCH_LEADERS_FOOTPRINT( pub_cnt, slot_cnt );
 }
 
+/* fd_epoch_leaders_wsample_laddr returns the location of the wsample
+   object used while leaders is under construction.  See the layout
+   comment in fd_epoch_leaders_new_init. */
+
+static inline ulong
+fd_epoch_leaders_wsample_laddr( fd_epoch_leaders_t const * leaders ) {
+  ulong sched_max = (leaders->slot_cnt+FD_EPOCH_SLOTS_PER_ROTATION-1UL)/FD_EPOCH_SLOTS_PER_ROTATION;
+  return fd_ulong_align_up( (ulong)(leaders->sched + sched_max), fd_ulong_max( sizeof(fd_pubkey_t), FD_WSAMPLE_ALIGN ) );
+}
+
 void *
-fd_epoch_leaders_new( void                    * shmem,
-                      ulong                     epoch,
-                      ulong                     slot0,
-                      ulong                     slot_cnt,
-                      ulong                     pub_cnt,
-                      fd_stake_weight_t const * stakes ) {
+fd_epoch_leaders_new_init( void                    * shmem,
+                           ulong                     epoch,
+                           ulong                     slot0,
+                           ulong                     slot_cnt,
+                           ulong                     pub_cnt,
+                           fd_stake_weight_t const * stakes,
+                           fd_chacha20rng_t        * rng ) {
   if( FD_UNLIKELY( !shmem ) ) {
     FD_LOG_WARNING(( "NULL shmem" ));
     return NULL;
@@ -51,54 +62,95 @@ fd_epoch_leaders_new( void                    * shmem,
      This works out because we can delay copying the pubkeys until we're
      done with the wsample object.  There's a lot of type punning going
      on here, so watch out. */
-  ulong sched_cnt = (slot_cnt+FD_EPOCH_SLOTS_PER_ROTATION-1UL)/FD_EPOCH_SLOTS_PER_ROTATION;
-
   fd_epoch_leaders_t * leaders = (fd_epoch_leaders_t *)fd_type_pun( (void *)laddr );
   laddr += sizeof(fd_epoch_leaders_t);
 
   laddr  = fd_ulong_align_up( laddr, alignof(uint) );
   uint * sched     = (uint *)fd_type_pun( (void *)laddr );
-  laddr += sizeof(uint)*sched_cnt;
 
-  laddr  = fd_ulong_align_up( laddr, fd_ulong_max( sizeof(fd_pubkey_t), FD_WSAMPLE_ALIGN ) );
+  /* Until fini, pub is NULL and sched_cnt counts the rotations sampled
+     so far. */
+  leaders->epoch     = epoch;
+  leaders->slot0     = slot0;
+  leaders->slot_cnt  = slot_cnt;
+  leaders->pub       = NULL;
+  leaders->pub_cnt   = pub_cnt;
+  leaders->sched     = sched;
+  leaders->sched_cnt = 0UL;
+
   /* These two alias, like a union.  We don't need pubkeys until we're
      done with wsample. */
-  void        * wsample_mem = (void        *)fd_type_pun( (void *)laddr );
-  fd_pubkey_t * pubkeys     = (fd_pubkey_t *)fd_type_pun( (void *)laddr );
+  void * wsample_mem = (void *)fd_epoch_leaders_wsample_laddr( leaders );
 
-  FD_TEST( laddr+fd_wsample_footprint( pub_cnt, 0 )<=(ulong)wsample_mem + fd_epoch_leaders_footprint( pub_cnt, slot_cnt ) );
+  FD_TEST( (ulong)wsample_mem+fd_wsample_footprint( pub_cnt, 0 )<=(ulong)shmem + fd_epoch_leaders_footprint( pub_cnt, slot_cnt ) );
 
-  /* Create and seed ChaCha20Rng */
-  fd_chacha20rng_t _rng[1];
-  fd_chacha20rng_t * rng = fd_chacha20rng_join( fd_chacha20rng_new( _rng, FD_CHACHA20RNG_MODE_MOD ) );
+  /* Seed ChaCha20Rng */
   uchar key[ 32 ] = {0};
   memcpy( key, &epoch, sizeof(ulong) );
   fd_chacha20rng_init( rng, key );
 
   void * _wsample = fd_wsample_new_init( wsample_mem, rng, pub_cnt, 0, FD_WSAMPLE_HINT_POWERLAW_NOREMOVE );
   for( ulong i=0UL; i<pub_cnt; i++ ) _wsample = fd_wsample_new_add( _wsample, stakes[i].stake );
-  fd_wsample_t * wsample = fd_wsample_join( fd_wsample_new_fini( _wsample ) );
+  if( FD_UNLIKELY( !fd_wsample_new_fini( _wsample ) ) ) return NULL;
 
-  /* Generate samples.  We need uints, so we can't use sample_many. */
-  for( ulong i=0UL; i<sched_cnt; i++ ) sched[ i ] = (uint)fd_wsample_sample( wsample );
+  return shmem;
+}
+
+ulong
+fd_epoch_leaders_new_sample( void * shmem,
+                             ulong  cnt ) {
+  fd_epoch_leaders_t * leaders = (fd_epoch_leaders_t *)shmem;
+  ulong sched_max = (leaders->slot_cnt+FD_EPOCH_SLOTS_PER_ROTATION-1UL)/FD_EPOCH_SLOTS_PER_ROTATION;
+  ulong sched_idx = leaders->sched_cnt;
+  ulong sched_end = sched_idx + fd_ulong_min( cnt, sched_max-sched_idx );
+
+  fd_wsample_t * wsample = fd_wsample_join( (void *)fd_epoch_leaders_wsample_laddr( leaders ) );
+
+  /* We need uints, so we can't use sample_many. */
+  for( ulong i=sched_idx; i<sched_end; i++ ) leaders->sched[ i ] = (uint)fd_wsample_sample( wsample );
+
+  fd_wsample_leave( wsample );
+  leaders->sched_cnt = sched_end;
+  return sched_max-sched_end;
+}
+
+void *
+fd_epoch_leaders_new_fini( void                    * shmem,
+                           fd_stake_weight_t const * stakes ) {
+  fd_epoch_leaders_t * leaders = (fd_epoch_leaders_t *)shmem;
+  ulong sched_max = (leaders->slot_cnt+FD_EPOCH_SLOTS_PER_ROTATION-1UL)/FD_EPOCH_SLOTS_PER_ROTATION;
+
+  /* Finish any rotations the caller did not get around to */
+  if( FD_UNLIKELY( leaders->sched_cnt<sched_max ) ) fd_epoch_leaders_new_sample( shmem, sched_max );
 
   /* Clean up the wsample object */
-  fd_wsample_delete( fd_wsample_leave( wsample ) );
-  fd_chacha20rng_delete( fd_chacha20rng_leave( rng ) );
+  void * wsample_mem = (void *)fd_epoch_leaders_wsample_laddr( leaders );
+  fd_wsample_delete( wsample_mem );
 
   /* Now we can use the space for the pubkeys */
-  for( ulong i=0UL; i<pub_cnt; i++ ) memcpy( pubkeys+i, &stakes[ i ].key, 32UL );
+  fd_pubkey_t * pubkeys = (fd_pubkey_t *)fd_type_pun( wsample_mem );
+  for( ulong i=0UL; i<leaders->pub_cnt; i++ ) memcpy( pubkeys+i, &stakes[ i ].key, 32UL );
 
-  /* Construct the final struct */
-  leaders->epoch     = epoch;
-  leaders->slot0     = slot0;
-  leaders->slot_cnt  = slot_cnt;
-  leaders->pub       = pubkeys;
-  leaders->pub_cnt   = pub_cnt;
-  leaders->sched     = sched;
-  leaders->sched_cnt = sched_cnt;
+  leaders->pub = pubkeys;
+  return shmem;
+}
 
-  return (void *)shmem;
+void *
+fd_epoch_leaders_new( void                    * shmem,
+                      ulong                     epoch,
+                      ulong                     slot0,
+                      ulong                     slot_cnt,
+                      ulong                     pub_cnt,
+                      fd_stake_weight_t const * stakes ) {
+  fd_chacha20rng_t _rng[1];
+  fd_chacha20rng_t * rng = fd_chacha20rng_join( fd_chacha20rng_new( _rng, FD_CHACHA20RNG_MODE_MOD ) );
+
+  if( FD_UNLIKELY( !fd_epoch_leaders_new_init( shmem, epoch, slot0, slot_cnt, pub_cnt, stakes, rng ) ) ) return NULL;
+  fd_epoch_leaders_new_sample( shmem, ULONG_MAX );
+  fd_epoch_leaders_new_fini( shmem, stakes );
+
+  fd_chacha20rng_delete( fd_chacha20rng_leave( rng ) );
+  return shmem;
 }
 
 fd_epoch_leaders_t *
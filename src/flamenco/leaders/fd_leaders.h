@@ -108,6 +108,42 @@ fd_epoch_leaders_new( void                    * shmem,
                       ulong                     pub_cnt,
                       fd_stake_weight_t const * stakes ); /* indexed [0, pub_cnt) */
 
+/* fd_epoch_leaders_new_{init,sample,fini} split fd_epoch_leaders_new
+   into steps, so that a caller that can't afford to stall for the
+   whole computation can spread the sampling out over time.  The caller
+   must call new_init, then new_sample zero or more times, and finally
+   new_fini.  The result is identical to fd_epoch_leaders_new with the
+   same arguments.
+
+   new_init takes the same arguments as fd_epoch_leaders_new along with
+   rng, a local join of a ChaCha20 RNG in FD_CHACHA20RNG_MODE_MOD mode.
+   The region retains a read/write interest in rng until new_fini
+   returns.  Returns shmem on success and NULL on failure.
+
+   new_sample samples up to cnt more rotations of the schedule and
+   returns the number of rotations that remain to be sampled.
+
+   new_fini samples any remaining rotations and completes formatting.
+   stakes must have the same contents that were passed to new_init.
+   Returns shmem.  Does NOT retain a read interest in stakes upon
+   return.  The caller is not joined to the object on return. */
+void *
+fd_epoch_leaders_new_init( void                    * shmem,
+                           ulong                     epoch,
+                           ulong                     slot0,
+                           ulong                     slot_cnt,
+                           ulong                     pub_cnt,
+                           fd_stake_weight_t const * stakes,
+                           fd_chacha20rng_t        * rng );
+
+ulong
+fd_epoch_leaders_new_sample( void * shmem,
+                             ulong  cnt );
+
+void *
+fd_epoch_leaders_new_fini( void                    * shmem,
+                           fd_stake_weight_t const * stakes );
+
 /* fd_epoch_leaders_join joins the caller to the leader schedule object.
    fd_epoch_leaders_leave undoes an existing join. */
 
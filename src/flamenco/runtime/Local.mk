@@ -19,6 +19,8 @@ $(call add-objs,fd_executor,fd_flamenco)
 
 $(call add-hdrs,fd_hashes.h)
 $(call add-objs,fd_hashes,fd_flamenco)
+$(call make-unit-test,test_hashes,test_hashes,fd_flamenco fd_funk fd_ballet fd_util,$(SECP256K1_LIBS))
+$(call run-unit-test,test_hashes,)
 
 $(call add-hdrs,fd_pubkey_utils.h)
 $(call add-objs,fd_pubkey_utils,fd_flamenco)
@@ -27,6 +29,10 @@ $(call add-hdrs,fd_rent_lists.h)
 
 $(call add-hdrs,fd_runtime.h fd_runtime_err.h)
 $(call add-objs,fd_runtime,fd_flamenco)
+ifdef FD_HAS_SECP256K1
+$(call make-unit-test,test_runtime_publish,test_runtime_publish,fd_flamenco fd_funk fd_ballet fd_util,$(SECP256K1_LIBS))
+$(call run-unit-test,test_runtime_publish,)
+endif
 
 ifdef FD_HAS_ZSTD
 $(call add-hdrs,fd_snapshot_loader.h)
@@ -846,6 +846,53 @@ fd_blockstore_shred_query_copy_data( fd_blockstore_t * blockstore, ulong slot, u
   return (long)FD_SHRED_MIN_SZ;
 }
 
+int
+fd_blockstore_batch_query( fd_blockstore_t * blockstore,
+                           ulong             slot,
+                           uint              shred_idx,
+                           uchar *           buf,
+                           ulong             buf_max,
+                           ulong *           batch_sz_out,
+                           uint *            end_idx_out ) {
+  fd_blockstore_slot_map_t * query =
+      fd_blockstore_slot_map_query( fd_blockstore_slot_map( blockstore ), &slot, NULL );
+  if( FD_UNLIKELY( !query ) ) return FD_BLOCKSTORE_ERR_SLOT_MISSING;
+
+  /* Once the block is assembled the shreds are no longer in the shred map, read the payloads
+     from the block data instead */
+
+  fd_wksp_t *        wksp   = fd_blockstore_wksp( blockstore );
+  fd_block_t *       blk    = query->block_gaddr ? fd_wksp_laddr_fast( wksp, query->block_gaddr ) : NULL;
+  fd_block_shred_t * shreds = blk ? fd_wksp_laddr_fast( wksp, blk->shreds_gaddr ) : NULL;
+  uchar const *      data   = blk ? fd_wksp_laddr_fast( wksp, blk->data_gaddr ) : NULL;
+
+  ulong sz = 0;
+  for( uint idx = shred_idx;; idx++ ) {
+    fd_shred_t const * hdr;
+    uchar const *      payload;
+    if( blk ) {
+      if( FD_UNLIKELY( idx >= blk->shreds_cnt ) ) return FD_BLOCKSTORE_ERR_SHRED_MISSING;
+      hdr     = &shreds[idx].hdr;
+      payload = data + shreds[idx].off;
+    } else {
+      hdr = fd_blockstore_shred_query( blockstore, slot, idx );
+      if( FD_UNLIKELY( !hdr ) ) return FD_BLOCKSTORE_ERR_SHRED_MISSING;
+      payload = fd_shred_data_payload( hdr );
+    }
+
+    ulong payload_sz = fd_shred_payload_sz( hdr );
+    if( FD_UNLIKELY( sz + payload_sz > buf_max ) ) return FD_BLOCKSTORE_ERR_NO_MEM;
+    fd_memcpy( buf + sz, payload, payload_sz );
+    sz += payload_sz;
+
+    if( hdr->data.flags & ( FD_SHRED_DATA_FLAG_DATA_COMPLETE | FD_SHRED_DATA_FLAG_SLOT_COMPLETE ) ) {
+      *batch_sz_out = sz;
+      *end_idx_out  = idx;
+      return FD_BLOCKSTORE_OK;
+    }
+  }
+}
+
 fd_block_t *
 fd_blockstore_block_query( fd_blockstore_t * blockstore, ulong slot ) {
   fd_blockstore_slot_map_t * query =
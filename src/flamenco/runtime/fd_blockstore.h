@@ -435,6 +435,25 @@ fd_blockstore_shred_query( fd_blockstore_t * blockstore, ulong slot, uint shred_
 long
 fd_blockstore_shred_query_copy_data( fd_blockstore_t * blockstore, ulong slot, uint shred_idx, void * buf, ulong buf_max );
 
+/* Query blockstore for the entry batch of slot starting at data shred shred_idx, ie. the
+ * contiguous data shreds from shred_idx up to and including the next shred with the
+ * FD_SHRED_DATA_FLAG_DATA_COMPLETE flag set. Copies the concatenated payloads of these shreds
+ * to buf, sets *batch_sz_out to their total size and *end_idx_out to the index of the last
+ * shred of the batch. Works for both incomplete and complete blocks. Returns FD_BLOCKSTORE_OK
+ * on success, FD_BLOCKSTORE_ERR_SHRED_MISSING if the batch is not contiguous yet and
+ * FD_BLOCKSTORE_ERR_NO_MEM if buf_max is too small.
+ *
+ * Callers should hold the read lock during the entirety of this call.
+ */
+int
+fd_blockstore_batch_query( fd_blockstore_t * blockstore,
+                           ulong             slot,
+                           uint              shred_idx,
+                           uchar *           buf,
+                           ulong             buf_max,
+                           ulong *           batch_sz_out,
+                           uint *            end_idx_out );
+
 /* Query blockstore for block at slot. Returns a pointer to the block or NULL if not in
  * blockstore. The returned pointer lifetime is until the block is removed. Check return value for
  * error info. */
@@ -183,6 +183,216 @@ fd_hash_account_deltas( fd_pubkey_hash_pair_t * pairs, ulong pairs_len, fd_hash_
   // If the level at the `height' was rolled into, do something about it
 }
 
+/* Thread parallel accounts delta hash.  The pairs are sorted with a
+   single pass MSD radix partition on the first pubkey byte (which is
+   the most significant byte of the sort order) followed by a
+   comparison sort of each of the 256 buckets, buckets being sorted
+   concurrently.  The merkle tree is then built level by level, each
+   level being split over the workers and hashed with the batched
+   SHA-256 API.  Pubkeys are uniformly distributed so the buckets are of
+   similar size. */
+
+#define FD_ACCOUNT_DELTAS_RADIX_CNT (256UL)
+
+/* Below this many pairs, dispatch overheads dominate and the work is
+   done by the calling thread only. */
+
+#define FD_ACCOUNT_DELTAS_PAR_MIN (2048UL)
+
+struct fd_hash_account_deltas_par {
+  fd_pubkey_hash_pair_t * pairs;
+  fd_pubkey_hash_pair_t * tmp;
+  ulong *                 cnt;     /* indexed [worker][radix], exclusive prefix sums after the histogram pass */
+  ulong *                 bkt;     /* bkt[b] is the offset of bucket b in tmp, indexed [0,RADIX_CNT] */
+  uchar const *           in;      /* contiguous hashes of the level being reduced, NULL for the leaves */
+  ulong                   in_cnt;
+  uchar *                 out;
+};
+
+typedef struct fd_hash_account_deltas_par fd_hash_account_deltas_par_t;
+
+static void
+fd_hash_account_deltas_hist_task( void * tpool FD_PARAM_UNUSED,
+                                  ulong t0, ulong t1 FD_PARAM_UNUSED,
+                                  void * args,
+                                  void * reduce FD_PARAM_UNUSED, ulong stride FD_PARAM_UNUSED,
+                                  ulong l0 FD_PARAM_UNUSED, ulong l1 FD_PARAM_UNUSED,
+                                  ulong m0, ulong m1,
+                                  ulong n0, ulong n1 FD_PARAM_UNUSED ) {
+  fd_hash_account_deltas_par_t * par = (fd_hash_account_deltas_par_t *)args;
+  ulong * cnt = par->cnt + (n0-t0)*FD_ACCOUNT_DELTAS_RADIX_CNT;
+  fd_memset( cnt, 0, FD_ACCOUNT_DELTAS_RADIX_CNT*sizeof(ulong) );
+  for( ulong i=m0; i<m1; i++ ) cnt[ par->pairs[ i ].pubkey->uc[ 0 ] ]++;
+}
+
+static void
+fd_hash_account_deltas_scatter_task( void * tpool FD_PARAM_UNUSED,
+                                     ulong t0, ulong t1 FD_PARAM_UNUSED,
+                                     void * args,
+                                     void * reduce FD_PARAM_UNUSED, ulong stride FD_PARAM_UNUSED,
+                                     ulong l0 FD_PARAM_UNUSED, ulong l1 FD_PARAM_UNUSED,
+                                     ulong m0, ulong m1,
+                                     ulong n0, ulong n1 FD_PARAM_UNUSED ) {
+  fd_hash_account_deltas_par_t * par = (fd_hash_account_deltas_par_t *)args;
+  ulong * off = par->cnt + (n0-t0)*FD_ACCOUNT_DELTAS_RADIX_CNT;
+  for( ulong i=m0; i<m1; i++ ) {
+    fd_pubkey_hash_pair_t const * pair = par->pairs + i;
+    par->tmp[ off[ pair->pubkey->uc[ 0 ] ]++ ] = *pair;
+  }
+}
+
+static void
+fd_hash_account_deltas_sort_task( void * tpool FD_PARAM_UNUSED,
+                                  ulong t0 FD_PARAM_UNUSED, ulong t1 FD_PARAM_UNUSED,
+                                  void * args,
+                                  void * reduce FD_PARAM_UNUSED, ulong stride FD_PARAM_UNUSED,
+                                  ulong l0 FD_PARAM_UNUSED, ulong l1 FD_PARAM_UNUSED,
+                                  ulong m0, ulong m1,
+                                  ulong n0 FD_PARAM_UNUSED, ulong n1 FD_PARAM_UNUSED ) {
+  fd_hash_account_deltas_par_t * par = (fd_hash_account_deltas_par_t *)args;
+  for( ulong b=m0; b<m1; b++ ) {
+    ulong j0 = par->bkt[ b     ];
+    ulong j1 = par->bkt[ b+1UL ];
+    sort_pubkey_hash_pair_inplace( par->tmp + j0, j1-j0 );
+    fd_memcpy( par->pairs + j0, par->tmp + j0, (j1-j0)*sizeof(fd_pubkey_hash_pair_t) );
+  }
+}
+
+/* fd_hash_account_deltas_level_task computes nodes [m0,m1) of the next
+   level up.  Node k is the hash of the concatenation of children
+   [16k,min(16k+16,in_cnt)).  Leaf hashes are scattered so they are
+   gathered into a local buffer first, interior levels are contiguous
+   and hashed in place. */
+
+static void
+fd_hash_account_deltas_level_task( void * tpool FD_PARAM_UNUSED,
+                                   ulong t0 FD_PARAM_UNUSED, ulong t1 FD_PARAM_UNUSED,
+                                   void * args,
+                                   void * reduce FD_PARAM_UNUSED, ulong stride FD_PARAM_UNUSED,
+                                   ulong l0 FD_PARAM_UNUSED, ulong l1 FD_PARAM_UNUSED,
+                                   ulong m0, ulong m1,
+                                   ulong n0 FD_PARAM_UNUSED, ulong n1 FD_PARAM_UNUSED ) {
+  fd_hash_account_deltas_par_t * par = (fd_hash_account_deltas_par_t *)args;
+  ulong in_cnt = par->in_cnt;
+
+  uchar batch_mem[ FD_SHA256_BATCH_FOOTPRINT ] __attribute__((aligned(FD_SHA256_BATCH_ALIGN)));
+  uchar gather[ FD_SHA256_BATCH_MAX ][ FD_ACCOUNT_DELTAS_MERKLE_FANOUT*sizeof(fd_hash_t) ];
+
+  for( ulong k0=m0; k0<m1; k0+=FD_SHA256_BATCH_MAX ) {
+    ulong k1 = fd_ulong_min( k0+FD_SHA256_BATCH_MAX, m1 );
+    fd_sha256_batch_t * batch = fd_sha256_batch_init( batch_mem );
+    for( ulong k=k0; k<k1; k++ ) {
+      ulong c0 = k*FD_ACCOUNT_DELTAS_MERKLE_FANOUT;
+      ulong c1 = fd_ulong_min( c0+FD_ACCOUNT_DELTAS_MERKLE_FANOUT, in_cnt );
+      uchar const * msg;
+      if( par->in ) {
+        msg = par->in + c0*sizeof(fd_hash_t);
+      } else {
+        uchar * g = gather[ k-k0 ];
+        for( ulong c=c0; c<c1; c++ ) fd_memcpy( g + (c-c0)*sizeof(fd_hash_t), par->pairs[ c ].hash->hash, sizeof(fd_hash_t) );
+        msg = g;
+      }
+      fd_sha256_batch_add( batch, msg, (c1-c0)*sizeof(fd_hash_t), par->out + k*sizeof(fd_hash_t) );
+    }
+    fd_sha256_batch_fini( batch );
+  }
+}
+
+ulong
+fd_hash_account_deltas_tpool_scratch_align( void ) {
+  return fd_ulong_max( FD_PUBKEY_HASH_PAIR_ALIGN, alignof(fd_hash_t) );
+}
+
+ulong
+fd_hash_account_deltas_tpool_scratch_footprint( ulong pairs_len,
+                                                ulong worker_cnt ) {
+  ulong l1_cnt = (pairs_len+FD_ACCOUNT_DELTAS_MERKLE_FANOUT-1UL) / FD_ACCOUNT_DELTAS_MERKLE_FANOUT;
+  ulong l2_cnt = (l1_cnt   +FD_ACCOUNT_DELTAS_MERKLE_FANOUT-1UL) / FD_ACCOUNT_DELTAS_MERKLE_FANOUT;
+  ulong l = FD_LAYOUT_INIT;
+  l = FD_LAYOUT_APPEND( l, FD_PUBKEY_HASH_PAIR_ALIGN, pairs_len*sizeof(fd_pubkey_hash_pair_t) );
+  l = FD_LAYOUT_APPEND( l, alignof(ulong),            worker_cnt*FD_ACCOUNT_DELTAS_RADIX_CNT*sizeof(ulong) );
+  l = FD_LAYOUT_APPEND( l, alignof(ulong),            (FD_ACCOUNT_DELTAS_RADIX_CNT+1UL)*sizeof(ulong) );
+  l = FD_LAYOUT_APPEND( l, alignof(fd_hash_t),        l1_cnt*sizeof(fd_hash_t) );
+  l = FD_LAYOUT_APPEND( l, alignof(fd_hash_t),        l2_cnt*sizeof(fd_hash_t) );
+  return FD_LAYOUT_FINI( l, fd_hash_account_deltas_tpool_scratch_align() );
+}
+
+void
+fd_hash_account_deltas_tpool( fd_pubkey_hash_pair_t * pairs,
+                              ulong                   pairs_len,
+                              fd_hash_t *             hash,
+                              void *                  scratch,
+                              fd_tpool_t *            tpool,
+                              ulong                   t0,
+                              ulong                   t1 ) {
+
+  if( FD_UNLIKELY( !pairs_len ) ) {
+    fd_sha256_hash( NULL, 0UL, hash->hash );
+    return;
+  }
+
+  if( FD_UNLIKELY( pairs_len<FD_ACCOUNT_DELTAS_PAR_MIN ) ) t1 = t0+1UL;
+  ulong worker_cnt = t1-t0;
+
+  ulong l1_cnt = (pairs_len+FD_ACCOUNT_DELTAS_MERKLE_FANOUT-1UL) / FD_ACCOUNT_DELTAS_MERKLE_FANOUT;
+  ulong l2_cnt = (l1_cnt   +FD_ACCOUNT_DELTAS_MERKLE_FANOUT-1UL) / FD_ACCOUNT_DELTAS_MERKLE_FANOUT;
+
+  fd_hash_account_deltas_par_t par[1];
+  FD_SCRATCH_ALLOC_INIT( l, scratch );
+  par->pairs = pairs;
+  par->tmp   = FD_SCRATCH_ALLOC_APPEND( l, FD_PUBKEY_HASH_PAIR_ALIGN, pairs_len*sizeof(fd_pubkey_hash_pair_t) );
+  par->cnt   = FD_SCRATCH_ALLOC_APPEND( l, alignof(ulong),            worker_cnt*FD_ACCOUNT_DELTAS_RADIX_CNT*sizeof(ulong) );
+  par->bkt   = FD_SCRATCH_ALLOC_APPEND( l, alignof(ulong),            (FD_ACCOUNT_DELTAS_RADIX_CNT+1UL)*sizeof(ulong) );
+  uchar * lvl[2];
+  lvl[0]     = FD_SCRATCH_ALLOC_APPEND( l, alignof(fd_hash_t),        l1_cnt*sizeof(fd_hash_t) );
+  lvl[1]     = FD_SCRATCH_ALLOC_APPEND( l, alignof(fd_hash_t),        l2_cnt*sizeof(fd_hash_t) );
+  FD_SCRATCH_ALLOC_FINI( l, fd_hash_account_deltas_tpool_scratch_align() );
+
+  /* Radix partition on the first byte.  The batch partitioning of
+     [0,pairs_len) is deterministic so each worker scatters the same
+     range it counted, which makes the partition stable. */
+
+  fd_tpool_exec_all_batch( tpool, t0, t1, fd_hash_account_deltas_hist_task, NULL, par, NULL, 1UL, 0UL, pairs_len );
+
+  ulong sum = 0UL;
+  for( ulong b=0UL; b<FD_ACCOUNT_DELTAS_RADIX_CNT; b++ ) {
+    par->bkt[ b ] = sum;
+    for( ulong w=0UL; w<worker_cnt; w++ ) {
+      ulong * c = par->cnt + w*FD_ACCOUNT_DELTAS_RADIX_CNT + b;
+      ulong   x = *c;
+      *c   = sum;
+      sum += x;
+    }
+  }
+  par->bkt[ FD_ACCOUNT_DELTAS_RADIX_CNT ] = sum;
+
+  fd_tpool_exec_all_batch( tpool, t0, t1, fd_hash_account_deltas_scatter_task, NULL, par, NULL, 1UL, 0UL, pairs_len          );
+  fd_tpool_exec_all_batch( tpool, t0, t1, fd_hash_account_deltas_sort_task,    NULL, par, NULL, 1UL, 0UL, FD_ACCOUNT_DELTAS_RADIX_CNT );
+
+  if( FD_UNLIKELY( pairs_len==1UL ) ) {
+    fd_memcpy( hash->hash, pairs[ 0 ].hash->hash, sizeof(fd_hash_t) );
+    return;
+  }
+
+  /* Reduce level by level until a single node is left, alternating
+     between the two level buffers (level i+2 overwrites level i, which
+     is no longer needed by then). */
+
+  par->in     = NULL;
+  par->in_cnt = pairs_len;
+  for( ulong i=0UL; ; i++ ) {
+    ulong out_cnt = (par->in_cnt+FD_ACCOUNT_DELTAS_MERKLE_FANOUT-1UL) / FD_ACCOUNT_DELTAS_MERKLE_FANOUT;
+    par->out = lvl[ i&1UL ];
+    fd_tpool_exec_all_batch( tpool, t0, fd_ulong_if( out_cnt<worker_cnt, t0+1UL, t1 ),
+                             fd_hash_account_deltas_level_task, NULL, par, NULL, 1UL, 0UL, out_cnt );
+    if( out_cnt==1UL ) break;
+    par->in     = par->out;
+    par->in_cnt = out_cnt;
+  }
+
+  fd_memcpy( hash->hash, par->out, sizeof(fd_hash_t) );
+}
+
 
 void
 fd_calculate_epoch_accounts_hash_values(fd_exec_slot_ctx_t * slot_ctx) {
@@ -272,16 +482,43 @@ fd_account_lthash( fd_lthash_value_t *       lthash_value,
   return;
 }
 
+/* fd_hash_account_deltas_auto computes the merkle root of pairs on
+   tpool workers [0,max_workers) when a tpool is given.  The tpool
+   variant roots a single pair differently, so that case (and the no
+   tpool case) is done serially. */
+
+static void
+fd_hash_account_deltas_auto( fd_exec_slot_ctx_t *    slot_ctx,
+                             fd_pubkey_hash_pair_t * pairs,
+                             ulong                   pairs_len,
+                             fd_hash_t *             hash,
+                             fd_tpool_t *            tpool,
+                             ulong                   max_workers ) {
+  if( tpool && pairs_len>1UL ) {
+    ulong  worker_cnt = fd_ulong_max( max_workers, 1UL );
+    void * scratch    = fd_valloc_malloc( slot_ctx->valloc,
+                                          fd_hash_account_deltas_tpool_scratch_align(),
+                                          fd_hash_account_deltas_tpool_scratch_footprint( pairs_len, worker_cnt ) );
+    FD_TEST( scratch );
+    fd_hash_account_deltas_tpool( pairs, pairs_len, hash, scratch, tpool, 0UL, worker_cnt );
+    fd_valloc_free( slot_ctx->valloc, scratch );
+  } else {
+    fd_hash_account_deltas( pairs, pairs_len, hash, slot_ctx );
+  }
+}
+
 // slot_ctx should be const.
 static void
 fd_hash_bank( fd_exec_slot_ctx_t * slot_ctx,
               fd_capture_ctx_t * capture_ctx,
               fd_hash_t * hash,
               fd_pubkey_hash_pair_t * dirty_keys,
-              ulong dirty_key_cnt ) {
+              ulong dirty_key_cnt,
+              fd_tpool_t * tpool,
+              ulong max_workers ) {
   slot_ctx->prev_banks_hash = slot_ctx->slot_bank.banks_hash;
 
-  fd_hash_account_deltas( dirty_keys, dirty_key_cnt, &slot_ctx->account_delta_hash, slot_ctx );
+  fd_hash_account_deltas_auto( slot_ctx, dirty_keys, dirty_key_cnt, &slot_ctx->account_delta_hash, tpool, max_workers );
 
   fd_sha256_t sha;
   fd_sha256_init( &sha );
@@ -535,7 +772,7 @@ fd_update_hash_bank_tpool( fd_exec_slot_ctx_t * slot_ctx,
   // FD_LOG_DEBUG(("slot %ld, dirty %ld", slot_ctx->slot_bank.slot, dirty_key_cnt));
 
   slot_ctx->signature_cnt = signature_cnt;
-  fd_hash_bank( slot_ctx, capture_ctx, hash, dirty_keys, dirty_key_cnt);
+  fd_hash_bank( slot_ctx, capture_ctx, hash, dirty_keys, dirty_key_cnt, tpool, max_workers );
 
 #ifdef _ENABLE_LTHASH
   // Sanity-check LT Hash
@@ -800,7 +1037,7 @@ fd_update_hash_bank( fd_exec_slot_ctx_t * slot_ctx,
   // FD_LOG_DEBUG(("slot %ld, dirty %ld", slot_ctx->slot_bank.slot, dirty_key_cnt));
 
   slot_ctx->signature_cnt = signature_cnt;
-  fd_hash_bank( slot_ctx, capture_ctx, hash, dirty_keys, dirty_key_cnt );
+  fd_hash_bank( slot_ctx, capture_ctx, hash, dirty_keys, dirty_key_cnt, NULL, 0UL );
 
 #ifdef _ENABLE_LTHASH
   // Sanity-check LT Hash
@@ -813,7 +1050,7 @@ fd_update_hash_bank( fd_exec_slot_ctx_t * slot_ctx,
   fd_epoch_bank_t * epoch_bank = fd_exec_epoch_ctx_epoch_bank( slot_ctx->epoch_ctx );
   if (slot_ctx->slot_bank.slot >= epoch_bank->eah_start_slot) {
     if (FD_FEATURE_ACTIVE(slot_ctx, epoch_accounts_hash)) {
-      fd_accounts_hash(slot_ctx, &slot_ctx->slot_bank.epoch_account_hash, NULL, 0, 0);
+      fd_accounts_hash(slot_ctx, &slot_ctx->slot_bank.epoch_account_hash, NULL, 0, 0, NULL, 0UL);
       epoch_bank->eah_start_slot = ULONG_MAX;
     }
   }
@@ -912,7 +1149,7 @@ typedef struct accounts_hash accounts_hash_t;
 #include "../../util/tmpl/fd_map_dynamic.c"
 
 int
-fd_accounts_hash( fd_exec_slot_ctx_t * slot_ctx, fd_hash_t *accounts_hash, fd_funk_txn_t * child_txn, ulong do_hash_verify, int with_dead ) {
+fd_accounts_hash( fd_exec_slot_ctx_t * slot_ctx, fd_hash_t *accounts_hash, fd_funk_txn_t * child_txn, ulong do_hash_verify, int with_dead, fd_tpool_t * tpool, ulong max_workers ) {
   FD_LOG_NOTICE(("accounts_hash start for txn %p, do_hash_verify=%s, with_dead=%s", (void *)child_txn, do_hash_verify ? "true" : "false", with_dead ? "true": "false"));
 
   fd_funk_t *     funk = slot_ctx->acc_mgr->funk;
@@ -976,7 +1213,7 @@ fd_accounts_hash( fd_exec_slot_ctx_t * slot_ctx, fd_hash_t *accounts_hash, fd_fu
     num_pairs++;
   }
 
-  fd_hash_account_deltas( pairs, num_pairs, accounts_hash, slot_ctx );
+  fd_hash_account_deltas_auto( slot_ctx, pairs, num_pairs, accounts_hash, tpool, max_workers );
 
   fd_valloc_free( slot_ctx->valloc, pairs );
   fd_scratch_pop();
@@ -987,13 +1224,13 @@ fd_accounts_hash( fd_exec_slot_ctx_t * slot_ctx, fd_hash_t *accounts_hash, fd_fu
 }
 
 int
-fd_snapshot_hash( fd_exec_slot_ctx_t * slot_ctx, fd_hash_t *accounts_hash, fd_funk_txn_t * child_txn, uint check_hash, int with_dead ) {
+fd_snapshot_hash( fd_exec_slot_ctx_t * slot_ctx, fd_hash_t *accounts_hash, fd_funk_txn_t * child_txn, uint check_hash, int with_dead, fd_tpool_t * tpool, ulong max_workers ) {
   if (FD_FEATURE_ACTIVE(slot_ctx, epoch_accounts_hash)) {
     if (fd_should_snapshot_include_epoch_accounts_hash (slot_ctx)) {
       FD_LOG_NOTICE(( "snapshot is including epoch account hash" ));
       fd_sha256_t h;
       fd_hash_t hash;
-      fd_accounts_hash(slot_ctx, &hash, child_txn, check_hash, with_dead);
+      fd_accounts_hash(slot_ctx, &hash, child_txn, check_hash, with_dead, tpool, max_workers);
 
       fd_sha256_init( &h );
       fd_sha256_append( &h, (uchar const *) hash.hash, sizeof( fd_hash_t ) );
@@ -1003,7 +1240,7 @@ fd_snapshot_hash( fd_exec_slot_ctx_t * slot_ctx, fd_hash_t *accounts_hash, fd_fu
       return 0;
     }
   }
-  return fd_accounts_hash(slot_ctx, accounts_hash, child_txn, check_hash, with_dead );
+  return fd_accounts_hash(slot_ctx, accounts_hash, child_txn, check_hash, with_dead, tpool, max_workers );
 }
 
 #ifdef _ENABLE_LTHASH
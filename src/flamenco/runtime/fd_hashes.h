@@ -17,6 +17,34 @@ FD_PROTOTYPES_BEGIN
 
 void fd_hash_account_deltas( fd_pubkey_hash_pair_t * pairs, ulong pairs_len, fd_hash_t * hash, fd_exec_slot_ctx_t * slot_ctx );
 
+/* fd_hash_account_deltas_tpool is a thread parallel equivalent of
+   fd_hash_account_deltas: pairs are sorted in place by pubkey and the
+   fanout 16 merkle root of their hashes is written to hash.  Work is
+   split over tpool workers [t0,t1) (the caller is t0, see
+   fd_tpool_exec_all; tpool may be NULL if t1==t0+1).  Small inputs are
+   done by the caller only.  Unlike fd_hash_account_deltas, a single
+   pair produces its own hash as the root.
+
+   scratch points to a region with alignment and footprint given by
+   fd_hash_account_deltas_tpool_scratch_{align,footprint}( pairs_len,
+   t1-t0 ), which is about 18 bytes per pair. */
+
+FD_FN_CONST ulong
+fd_hash_account_deltas_tpool_scratch_align( void );
+
+FD_FN_CONST ulong
+fd_hash_account_deltas_tpool_scratch_footprint( ulong pairs_len,
+                                                ulong worker_cnt );
+
+void
+fd_hash_account_deltas_tpool( fd_pubkey_hash_pair_t * pairs,
+                              ulong                   pairs_len,
+                              fd_hash_t *             hash,
+                              void *                  scratch,
+                              fd_tpool_t *            tpool,
+                              ulong                   t0,
+                              ulong                   t1 );
+
 int fd_update_hash_bank( fd_exec_slot_ctx_t * slot_ctx,
                          fd_capture_ctx_t * capture_ctx,
                          fd_hash_t * hash,
@@ -74,21 +102,28 @@ fd_hash_account_current( uchar                      hash  [ static 32 ],
                          uchar const *              data,
                          fd_exec_slot_ctx_t const * slot_ctx );
 
-/* Generate a complete accounts_hash of the entire account database. */
+/* Generate a complete accounts_hash of the entire account database.
+   The merkle root is computed on tpool workers [0,max_workers) if
+   tpool is non-NULL and serially otherwise. */
 int
 fd_accounts_hash( fd_exec_slot_ctx_t * slot_ctx,
                   fd_hash_t * accounts_hash,
                   fd_funk_txn_t * child_txn,
                   ulong do_hash_verify,
-                  int with_dead );
+                  int with_dead,
+                  fd_tpool_t * tpool,
+                  ulong max_workers );
 
-/* Generate a non-incremental hash of the entire account database. */
+/* Generate a non-incremental hash of the entire account database.
+   tpool and max_workers are as in fd_accounts_hash. */
 int
 fd_snapshot_hash( fd_exec_slot_ctx_t * slot_ctx,
                   fd_hash_t * accounts_hash,
                   fd_funk_txn_t * child_txn,
                   uint check_hash,
-                  int with_dead );
+                  int with_dead,
+                  fd_tpool_t * tpool,
+                  ulong max_workers );
 
 int
 fd_accounts_init_lthash( fd_exec_slot_ctx_t * slot_ctx );
@@ -2274,12 +2274,21 @@ fd_runtime_checkpt( fd_capture_ctx_t * capture_ctx,
 
 int
 fd_runtime_publish_old_txns( fd_exec_slot_ctx_t * slot_ctx,
-                             fd_capture_ctx_t * capture_ctx ) {
-  /* Publish any transaction older than 31 slots */
+                             fd_capture_ctx_t * capture_ctx,
+                             fd_tpool_t * tpool,
+                             ulong max_workers ) {
+  /* Publish any transaction older than 31 slots.  The funk txns of a
+     slot are keyed by the slot in xid.ul[0] and a block can span more
+     than one of them (e.g. a block streamed to the replay tile before
+     its block hash was known), so count slots, not txns.  The youngest
+     txn of the slot is published, which publishes the older ones too. */
   fd_funk_t * funk = slot_ctx->acc_mgr->funk;
   fd_funk_txn_t * txnmap = fd_funk_txn_map(funk, fd_funk_wksp(funk));
   uint depth = 0;
+  ulong prev_slot = ULONG_MAX;
   for( fd_funk_txn_t * txn = slot_ctx->funk_txn; txn; txn = fd_funk_txn_parent(txn, txnmap) ) {
+    if( txn->xid.ul[0]==prev_slot ) continue;
+    prev_slot = txn->xid.ul[0];
     /* TODO: tmp change */
     if (++depth == (FD_RUNTIME_NUM_ROOT_BLOCKS - 1) ) {
       FD_LOG_DEBUG(("publishing %32J (slot %ld)", &txn->xid, txn->xid.ul[0]));
@@ -2294,7 +2303,7 @@ fd_runtime_publish_old_txns( fd_exec_slot_ctx_t * slot_ctx,
       if (FD_FEATURE_ACTIVE(slot_ctx, epoch_accounts_hash)) {
         fd_epoch_bank_t * epoch_bank = fd_exec_epoch_ctx_epoch_bank( slot_ctx->epoch_ctx );
         if (txn->xid.ul[0] >= epoch_bank->eah_start_slot) {
-          fd_accounts_hash( slot_ctx, &slot_ctx->slot_bank.epoch_account_hash, NULL, 0, 0 );
+          fd_accounts_hash( slot_ctx, &slot_ctx->slot_bank.epoch_account_hash, NULL, 0, 0, tpool, max_workers );
           epoch_bank->eah_start_slot = ULONG_MAX;
         }
       }
@@ -2323,7 +2332,7 @@ fd_runtime_block_eval_tpool(fd_exec_slot_ctx_t *slot_ctx,
                                 ulong * txn_cnt ) {
   (void)scheduler;
 
-  int err = fd_runtime_publish_old_txns( slot_ctx, capture_ctx );
+  int err = fd_runtime_publish_old_txns( slot_ctx, capture_ctx, tpool, max_workers );
   if( err != 0 ) {
     return err;
   }
@@ -176,6 +176,16 @@ fd_runtime_block_verify_tpool( fd_block_info_t const * block_info,
                                fd_tpool_t * tpool,
                                ulong max_workers );
 
+int
+fd_runtime_microblock_batch_prepare( void const * buf,
+                                     ulong buf_sz,
+                                     fd_valloc_t valloc,
+                                     fd_microblock_batch_info_t * out_microblock_batch_info );
+
+ulong
+fd_runtime_microblock_batch_collect_txns( fd_microblock_batch_info_t const * microblock_batch_info,
+                                          fd_txn_p_t * out_txns );
+
 int
 fd_runtime_block_prepare( void const * buf,
                           ulong buf_sz,
@@ -188,7 +198,9 @@ fd_runtime_block_collect_txns( fd_block_info_t const * block_info,
 
 int
 fd_runtime_publish_old_txns( fd_exec_slot_ctx_t * slot_ctx,
-                             fd_capture_ctx_t * capture_ctx );
+                             fd_capture_ctx_t * capture_ctx,
+                             fd_tpool_t * tpool,
+                             ulong max_workers );
 
 int
 fd_runtime_block_eval_tpool( fd_exec_slot_ctx_t * slot_ctx,
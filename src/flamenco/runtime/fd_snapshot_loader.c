@@ -186,7 +186,7 @@ fd_snapshot_load( const char *         snapshotfile,
   if( verify_hash ) {
     if (snapshot_type == FD_SNAPSHOT_TYPE_FULL) {
       fd_hash_t accounts_hash;
-      fd_snapshot_hash(slot_ctx, &accounts_hash, child_txn, check_hash, 0);
+      fd_snapshot_hash(slot_ctx, &accounts_hash, child_txn, check_hash, 0, NULL, 0UL);
 
       if (memcmp(fhash.uc, accounts_hash.uc, 32) != 0)
         FD_LOG_ERR(("snapshot accounts_hash %32J != %32J", accounts_hash.hash, fhash.uc));
@@ -197,10 +197,10 @@ fd_snapshot_load( const char *         snapshotfile,
 
       if (FD_FEATURE_ACTIVE(slot_ctx, incremental_snapshot_only_incremental_hash_calculation)) {
         FD_LOG_NOTICE(( "hashing incremental snapshot with only deltas" ));
-        fd_snapshot_hash(slot_ctx, &accounts_hash, child_txn, check_hash, 1);
+        fd_snapshot_hash(slot_ctx, &accounts_hash, child_txn, check_hash, 1, NULL, 0UL);
       } else {
         FD_LOG_NOTICE(( "hashing incremental snapshot with all accounts" ));
-        fd_snapshot_hash(slot_ctx, &accounts_hash, NULL, check_hash, 0);
+        fd_snapshot_hash(slot_ctx, &accounts_hash, NULL, check_hash, 0, NULL, 0UL);
       }
 
       if (memcmp(fhash.uc, accounts_hash.uc, 32) != 0)
@@ -7,6 +7,7 @@ $(call add-objs,fd_builtin_programs,fd_flamenco)
 
 $(call add-hdrs,fd_bpf_loader_serialization.h)
 $(call add-objs,fd_bpf_loader_serialization,fd_flamenco)
+$(call make-unit-test,bench_bpf_loader_serialization,bench_bpf_loader_serialization,fd_flamenco fd_funk fd_ballet fd_util,$(SECP256K1_LIBS))
 
 $(call add-hdrs,fd_bpf_program_util.h)
 $(call add-objs,fd_bpf_program_util,fd_flamenco)
@@ -15,6 +16,10 @@ $(call add-objs,fd_bpf_program_util,fd_flamenco)
 
 $(call add-hdrs,fd_precompiles.h)
 $(call add-objs,fd_precompiles,fd_flamenco)
+ifdef FD_HAS_SECP256K1
+$(call make-unit-test,test_precompiles,test_precompiles,fd_flamenco fd_funk fd_ballet fd_util,$(SECP256K1_LIBS))
+$(call run-unit-test,test_precompiles)
+endif
 
 ### Native programs
 
@@ -0,0 +1,262 @@
+/* bench_bpf_loader_serialization measures the cost of passing large
+   accounts to sBPF programs, with the account data copied into the VM
+   input region (the aligned serialization) and direct mapped into it
+   (fd_bpf_loader_input_serialize_direct, used when
+   bpf_account_data_direct_mapping is active).
+
+   Each iteration runs a CPI chain of --depth instructions over the same
+   --acct-cnt writable accounts of --acct-sz bytes each.  Each
+   instruction serializes its input region, touches the first and last
+   words of every account's data through the VM address translation,
+   invokes the next instruction of the chain and deserializes its input
+   region.  The outermost instruction also grows the first account by
+   --realloc-sz bytes.  The account data sync of a CPI is modeled after
+   fd_vm_cpi_update_{callee,caller}_account: without direct mapping the
+   data is copied from the caller's input region into the account before
+   the callee runs and back afterwards, with direct mapping the caller's
+   data sub-regions are remapped.
+
+   Bytes copied counts the account data copied by the serialization and
+   CPIs plus the parameter buffer written, per instruction. */
+
+#include "fd_bpf_loader_serialization.h"
+#include "../fd_account.h"
+
+#define DEPTH_MAX (5UL) /* top level instruction plus max_invoke_depth CPIs */
+#define ACCT_MAX  (64UL)
+
+static fd_exec_epoch_ctx_t  epoch_ctx[1];
+static fd_exec_slot_ctx_t   slot_ctx [1];
+static fd_exec_txn_ctx_t    txn_ctx  [1];
+static fd_instr_info_t      instr    [1];
+static fd_vm_exec_context_t vm       [ DEPTH_MAX ];
+
+static uchar instr_data[ 8 ];
+
+/* data_off[ j ] is the offset of the data of account j in the input
+   region (the layout is the same in both modes) */
+
+static ulong data_off[ ACCT_MAX ];
+
+struct bench {
+  int   direct;
+  ulong depth;
+  ulong realloc_sz;
+  ulong copy_sz; /* bytes copied */
+};
+typedef struct bench bench_t;
+
+static ulong *
+vm_data( fd_vm_exec_context_t * ctx,
+         ulong                  off ) {
+  ulong * p = fd_vm_translate_vm_to_host( ctx, FD_VM_MEM_MAP_INPUT_REGION_START+off, sizeof(ulong), alignof(ulong) );
+  FD_TEST( p );
+  return p;
+}
+
+static void
+run_instr( bench_t *             bench,
+           fd_exec_instr_ctx_t * instr_ctx,
+           ulong                 level ) {
+  ulong acct_cnt = instr->acct_cnt;
+
+  ulong pre_lens[ 256UL ];
+  ulong input_sz = 0UL;
+  fd_vm_input_region_t * input_regions     = NULL;
+  ulong                  input_regions_cnt = 0UL;
+  uchar * input = bench->direct ?
+      fd_bpf_loader_input_serialize_direct ( *instr_ctx, &input_sz, pre_lens, &input_regions, &input_regions_cnt ) :
+      fd_bpf_loader_input_serialize_aligned( *instr_ctx, &input_sz, pre_lens );
+  FD_TEST( input );
+
+  ulong data_sz = 0UL;
+  for( ulong j=0UL; j<acct_cnt; j++ ) data_sz += pre_lens[ j ];
+  bench->copy_sz += bench->direct ? input_sz-data_sz : input_sz;
+
+  fd_vm_exec_context_t * ctx = vm + level;
+  ctx->input             = input;
+  ctx->input_sz          = input_sz;
+  ctx->input_regions     = input_regions;
+  ctx->input_regions_cnt = input_regions_cnt;
+
+  /* The program touches its accounts */
+
+  for( ulong j=0UL; j<acct_cnt; j++ ) {
+    ulong dlen = pre_lens[ j ];
+    *vm_data( ctx, data_off[ j ]                          ) += level+1UL;
+    *vm_data( ctx, data_off[ j ] + dlen - sizeof(ulong)   ) += level+1UL;
+  }
+
+  if( level+1UL<bench->depth ) {
+    /* CPI into the next instruction of the chain */
+    if( !bench->direct ) {
+      for( ulong j=0UL; j<acct_cnt; j++ ) {
+        fd_borrowed_account_t * acc = instr->borrowed_accounts[ j ];
+        ulong dlen = acc->const_meta->dlen;
+        fd_memcpy( acc->data, fd_vm_translate_vm_to_host( ctx, FD_VM_MEM_MAP_INPUT_REGION_START+data_off[ j ], dlen, 1UL ), dlen );
+        bench->copy_sz += dlen;
+      }
+    }
+    run_instr( bench, instr_ctx, level+1UL );
+    if( !bench->direct ) {
+      for( ulong j=0UL; j<acct_cnt; j++ ) {
+        fd_borrowed_account_t * acc = instr->borrowed_accounts[ j ];
+        ulong dlen = acc->const_meta->dlen;
+        fd_memcpy( fd_vm_translate_vm_to_host( ctx, FD_VM_MEM_MAP_INPUT_REGION_START+data_off[ j ], dlen, 1UL ), acc->data, dlen );
+        bench->copy_sz += dlen;
+      }
+    } else {
+      fd_vm_input_region_remap( ctx );
+    }
+  }
+
+  if( !level && bench->realloc_sz ) {
+    /* Grow the first account into the spare space */
+    ulong dlen = pre_lens[ 0 ];
+    *vm_data( ctx, data_off[ 0 ] - sizeof(ulong) ) = dlen + bench->realloc_sz;
+    uchar * grown = fd_vm_translate_vm_to_host( ctx, FD_VM_MEM_MAP_INPUT_REGION_START+data_off[ 0 ]+dlen, bench->realloc_sz, 1UL );
+    FD_TEST( grown );
+    fd_memset( grown, 0xa5, bench->realloc_sz );
+  }
+
+  /* Deserialization copies all the data of writable accounts without
+     direct mapping and only the grown data with */
+
+  int err = bench->direct ?
+      fd_bpf_loader_input_deserialize_direct ( *instr_ctx, pre_lens, input, input_sz ) :
+      fd_bpf_loader_input_deserialize_aligned( *instr_ctx, pre_lens, input, input_sz );
+  FD_TEST( !err );
+  for( ulong j=0UL; j<acct_cnt; j++ ) {
+    ulong post_len = instr->borrowed_accounts[ j ]->const_meta->dlen;
+    bench->copy_sz += bench->direct ? fd_ulong_sat_sub( post_len, pre_lens[ j ] ) : post_len;
+  }
+}
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+
+  ulong acct_cnt   = fd_env_strip_cmdline_ulong( &argc, &argv, "--acct-cnt",   NULL,                         2UL );
+  ulong acct_sz    = fd_env_strip_cmdline_ulong( &argc, &argv, "--acct-sz",    NULL, MAX_PERMITTED_DATA_LENGTH-8192UL );
+  ulong depth      = fd_env_strip_cmdline_ulong( &argc, &argv, "--depth",      NULL,                   DEPTH_MAX );
+  ulong realloc_sz = fd_env_strip_cmdline_ulong( &argc, &argv, "--realloc-sz", NULL,                      1024UL );
+  ulong iter_cnt   = fd_env_strip_cmdline_ulong( &argc, &argv, "--iter-cnt",   NULL,                        16UL );
+
+  if( FD_UNLIKELY( (!acct_cnt) | (acct_cnt>ACCT_MAX)               ) ) FD_LOG_ERR(( "--acct-cnt should be in [1,%lu]", ACCT_MAX ));
+  if( FD_UNLIKELY( (acct_sz<sizeof(ulong)) | (acct_sz&7UL)         ) ) FD_LOG_ERR(( "--acct-sz should be a positive multiple of 8" ));
+  if( FD_UNLIKELY( (!depth) | (depth>DEPTH_MAX)                    ) ) FD_LOG_ERR(( "--depth should be in [1,%lu]", DEPTH_MAX ));
+  if( FD_UNLIKELY( realloc_sz>MAX_PERMITTED_DATA_INCREASE          ) ) FD_LOG_ERR(( "--realloc-sz should be at most %lu", (ulong)MAX_PERMITTED_DATA_INCREASE ));
+  if( FD_UNLIKELY( acct_sz+realloc_sz>MAX_PERMITTED_DATA_LENGTH    ) ) FD_LOG_ERR(( "--acct-sz plus --realloc-sz is too large" ));
+
+  FD_LOG_NOTICE(( "Using --acct-cnt %lu --acct-sz %lu --depth %lu --realloc-sz %lu --iter-cnt %lu",
+                  acct_cnt, acct_sz, depth, realloc_sz, iter_cnt ));
+
+  fd_valloc_t valloc = fd_libc_alloc_virtual();
+
+  fd_features_disable_all( &epoch_ctx->features );
+  slot_ctx->epoch_ctx       = epoch_ctx;
+  slot_ctx->slot_bank.slot  = 1UL;
+  txn_ctx->epoch_ctx        = epoch_ctx;
+  txn_ctx->slot_ctx         = slot_ctx;
+  txn_ctx->valloc           = valloc;
+
+  fd_rng_t _rng[1]; fd_rng_t * rng = fd_rng_join( fd_rng_new( _rng, 0U, 0UL ) );
+
+  /* The transaction's accounts are the data accounts followed by the
+     program, which owns them */
+
+  fd_pubkey_t program_id;
+  for( ulong k=0UL; k<4UL; k++ ) program_id.ul[ k ] = fd_rng_ulong( rng );
+
+  txn_ctx->accounts_cnt = acct_cnt+1UL;
+  txn_ctx->accounts[ acct_cnt ] = program_id;
+  ulong off = sizeof(ulong);
+  for( ulong j=0UL; j<acct_cnt; j++ ) {
+    fd_pubkey_t * key = txn_ctx->accounts + j;
+    for( ulong k=0UL; k<4UL; k++ ) key->ul[ k ] = fd_rng_ulong( rng );
+
+    uchar * raw = fd_valloc_malloc( valloc, 8UL, sizeof(fd_account_meta_t) + acct_sz );
+    FD_TEST( raw );
+    fd_account_meta_t * meta = (fd_account_meta_t *)raw;
+    fd_account_meta_init( meta );
+    meta->dlen          = acct_sz;
+    meta->info.lamports = 1000000000UL;
+    fd_memcpy( meta->info.owner, program_id.uc, sizeof(fd_pubkey_t) );
+    for( ulong k=0UL; k<acct_sz/8UL; k++ ) ((ulong *)(raw+sizeof(fd_account_meta_t)))[ k ] = fd_rng_ulong( rng );
+
+    fd_borrowed_account_t * acc = fd_borrowed_account_init( txn_ctx->borrowed_accounts + j );
+    *acc->pubkey = *key;
+    acc->const_meta = acc->meta = meta;
+    acc->const_data = acc->data = raw + sizeof(fd_account_meta_t);
+
+    instr->acct_txn_idxs    [ j ] = (uchar)j;
+    instr->acct_flags       [ j ] = FD_INSTR_ACCT_FLAGS_IS_WRITABLE;
+    instr->acct_pubkeys     [ j ] = *key;
+    instr->borrowed_accounts[ j ] = acc;
+
+    off += 88UL; /* dup, flags, original_data_len, key, owner, lamports, data_len */
+    data_off[ j ] = off;
+    off += acct_sz + MAX_PERMITTED_DATA_INCREASE + sizeof(ulong);
+  }
+  instr->program_id        = (uchar)acct_cnt;
+  instr->program_id_pubkey = program_id;
+  instr->acct_cnt          = (ushort)acct_cnt;
+  instr->data              = instr_data;
+  instr->data_sz           = (ushort)sizeof(instr_data);
+
+  fd_exec_instr_ctx_t instr_ctx[1] = {{
+    .epoch_ctx = epoch_ctx,
+    .slot_ctx  = slot_ctx,
+    .txn_ctx   = txn_ctx,
+    .valloc    = valloc,
+    .instr     = instr
+  }};
+
+  double ns_per_instr[ 2 ];
+  ulong  check[ 2 ];
+  for( int direct=0; direct<2; direct++ ) {
+    bench_t bench = { .direct = direct, .depth = depth, .realloc_sz = realloc_sz };
+
+    long dt = 0L;
+    for( ulong iter=0UL; iter<iter_cnt+1UL; iter++ ) { /* first iteration is warmup */
+      ulong copy_sz = bench.copy_sz;
+      txn_ctx->accounts_resize_delta = 0UL;
+      dt -= fd_log_wallclock();
+      run_instr( &bench, instr_ctx, 0UL );
+      dt += fd_log_wallclock();
+      if( !iter ) { dt = 0L; bench.copy_sz = copy_sz; }
+
+      /* Check and undo the realloc */
+      fd_borrowed_account_t * acc = instr->borrowed_accounts[ 0 ];
+      FD_TEST( acc->const_meta->dlen==acct_sz+realloc_sz );
+      for( ulong k=0UL; k<realloc_sz; k++ ) FD_TEST( acc->const_data[ acct_sz+k ]==0xa5 );
+      acc->meta->dlen = acct_sz;
+    }
+
+    ulong instr_cnt = iter_cnt*depth;
+    ns_per_instr[ direct ] = (double)dt / (double)instr_cnt;
+    FD_LOG_NOTICE(( "%-6s: %10.1f us/instr %10.3f MiB copied/instr",
+                    direct ? "direct" : "copy", 1e-3*ns_per_instr[ direct ],
+                    (double)bench.copy_sz / (double)instr_cnt / (double)(1UL<<20) ));
+
+    check[ direct ] = 0UL;
+    for( ulong j=0UL; j<acct_cnt; j++ ) {
+      fd_borrowed_account_t * acc = instr->borrowed_accounts[ j ];
+      check[ direct ] += FD_LOAD( ulong, acc->const_data ) + FD_LOAD( ulong, acc->const_data + acct_sz - sizeof(ulong) );
+    }
+  }
+
+  /* Both modes made the same (non-zero) net changes to the accounts:
+     each iteration adds sum_{l<depth} (l+1) to two words per account */
+  FD_TEST( check[ 1 ]-check[ 0 ]==(iter_cnt+1UL)*depth*(depth+1UL)*acct_cnt );
+
+  FD_LOG_NOTICE(( "copy/direct: %.3f", ns_per_instr[ 0 ]/ns_per_instr[ 1 ] ));
+
+  for( ulong j=0UL; j<acct_cnt; j++ ) fd_valloc_free( valloc, txn_ctx->borrowed_accounts[ j ].meta );
+  fd_rng_delete( fd_rng_leave( rng ) );
+
+  FD_LOG_NOTICE(( "pass" ));
+  fd_halt();
+  return 0;
+}
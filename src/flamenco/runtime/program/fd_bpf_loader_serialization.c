@@ -359,6 +359,314 @@ fd_bpf_loader_input_deserialize_aligned( fd_exec_instr_ctx_t ctx,
   return 0;
 }
 
+/* Direct mapped variant of the aligned serialization.  The input
+   region has the same layout, but account data is not copied into the
+   parameter buffer.  Each account's data gets an input sub-region of
+   its own that points at the borrowed account and is writable only if
+   the program may change the account's data.  The realloc spare space
+   following the data stays in the parameter buffer, in a sub-region of
+   its own with the same writability as the data, and grown data is
+   moved from there into the account on deserialization. */
+
+static inline fd_vm_input_region_t *
+fd_bpf_loader_input_region_push( fd_vm_input_region_t *        region,
+                                 ulong                         vaddr_offset,
+                                 ulong                         haddr,
+                                 ulong                         region_sz,
+                                 int                           is_writable,
+                                 fd_borrowed_account_t const * acct ) {
+  region->vaddr_offset           = vaddr_offset;
+  region->haddr                  = haddr;
+  region->region_sz              = region_sz;
+  region->address_space_reserved = region_sz;
+  region->is_writable            = is_writable;
+  region->acct                   = acct;
+  return region + 1;
+}
+
+uchar *
+fd_bpf_loader_input_serialize_direct( fd_exec_instr_ctx_t      ctx,
+                                      ulong *                  sz,
+                                      ulong *                  pre_lens,
+                                      fd_vm_input_region_t * * input_regions,
+                                      ulong *                  input_regions_cnt ) {
+  uchar const * instr_acc_idxs = ctx.instr->acct_txn_idxs;
+  fd_pubkey_t * txn_accs = ctx.txn_ctx->accounts;
+
+  uchar acc_idx_seen[256];
+  ushort dup_acc_idx[256];
+  memset(acc_idx_seen, 0, sizeof(acc_idx_seen));
+  memset(dup_acc_idx, 0, sizeof(dup_acc_idx));
+
+  /* Size the parameter buffer (everything but the account data) and
+     count the account data sub-regions */
+
+  ulong buf_sz     = sizeof(ulong);
+  ulong data_sz    = 0UL;
+  ulong region_max = 1UL;
+  for( ushort i = 0; i < ctx.instr->acct_cnt; i++ ) {
+    uchar acc_idx = instr_acc_idxs[i];
+
+    buf_sz++; // dup byte
+    if( FD_UNLIKELY( acc_idx_seen[acc_idx] ) ) {
+      buf_sz += 7; // pad to 64-bit alignment
+      continue;
+    }
+    acc_idx_seen[acc_idx] = 1;
+    dup_acc_idx[acc_idx] = i;
+
+    fd_borrowed_account_t * view_acc = NULL;
+    int read_result = fd_instr_borrowed_account_view( &ctx, &txn_accs[acc_idx], &view_acc );
+    ulong acc_data_len = 0UL;
+    if( FD_LIKELY( read_result == FD_ACC_MGR_SUCCESS ) ) {
+      acc_data_len = view_acc->const_meta->dlen;
+    } else if( FD_UNLIKELY( read_result != FD_ACC_MGR_ERR_UNKNOWN_ACCOUNT ) ) {
+      return NULL;
+    }
+
+    buf_sz += sizeof(uchar)          // is_signer
+        + sizeof(uchar)              // is_writable
+        + sizeof(uchar)              // is_executable
+        + sizeof(uint)               // original_data_len
+        + sizeof(fd_pubkey_t)        // key
+        + sizeof(fd_pubkey_t)        // owner
+        + sizeof(ulong)              // lamports
+        + sizeof(ulong)              // data_len
+        + MAX_PERMITTED_DATA_INCREASE
+        + fd_ulong_align_up( acc_data_len, 8UL ) - acc_data_len
+        + sizeof(ulong);             // rent_epoch
+    data_sz    += acc_data_len;
+    region_max += fd_ulong_if( !!acc_data_len, 3UL, 2UL );
+  }
+
+  buf_sz += sizeof(ulong)
+      + ctx.instr->data_sz
+      + sizeof(fd_pubkey_t);
+
+  /* The sub-regions live at the end of the parameter buffer allocation
+     so they are freed with it */
+
+  ulong regions_off = fd_ulong_align_up( buf_sz, alignof(fd_vm_input_region_t) );
+  uchar * buf = fd_valloc_malloc( ctx.valloc, alignof(fd_vm_input_region_t), regions_off + region_max*sizeof(fd_vm_input_region_t) );
+  fd_vm_input_region_t * regions = (fd_vm_input_region_t *)( buf + regions_off );
+  fd_vm_input_region_t * region  = regions;
+
+  uchar * cur       = buf;
+  uchar * seg       = buf; /* Start of the current parameter buffer sub-region */
+  ulong   seg_vaddr = 0UL;
+
+  FD_STORE( ulong, cur, ctx.instr->acct_cnt );
+  cur += sizeof(ulong);
+
+  for( ushort i = 0; i < ctx.instr->acct_cnt; i++ ) {
+    uchar acc_idx = instr_acc_idxs[i];
+    fd_pubkey_t * acc = &txn_accs[acc_idx];
+
+    if( FD_UNLIKELY( dup_acc_idx[acc_idx] != i ) ) {
+      // Duplicate
+      FD_STORE( ulong, cur, 0 );
+      FD_STORE( uchar, cur, (uchar)dup_acc_idx[acc_idx] );
+      cur += sizeof(ulong);
+      continue;
+    }
+
+    FD_STORE( uchar, cur, 0xFF );
+    cur += sizeof(uchar);
+
+    fd_borrowed_account_t * view_acc = NULL;
+    int read_result = fd_instr_borrowed_account_view( &ctx, acc, &view_acc );
+    int known = read_result == FD_ACC_MGR_SUCCESS;
+    fd_account_meta_t const * metadata = view_acc->const_meta;
+
+    uchar is_signer = (uchar)fd_instr_acc_is_signer_idx( ctx.instr, (uchar)i );
+    FD_STORE( uchar, cur, is_signer );
+    cur += sizeof(uchar);
+
+    uchar is_writable = (uchar)fd_instr_acc_is_writable_idx( ctx.instr, (uchar)i );
+    if( known ) is_writable = (uchar)( is_writable && !fd_pubkey_is_sysvar_id( acc ) && !fd_pubkey_is_builtin_program( acc ) );
+    FD_STORE( uchar, cur, is_writable );
+    cur += sizeof(uchar);
+
+    uchar is_executable = known ? (uchar)metadata->info.executable : (uchar)0;
+    FD_STORE( uchar, cur, is_executable );
+    cur += sizeof(uchar);
+
+    FD_STORE( uint, cur, 0U ); // original_data_len
+    cur += sizeof(uint);
+
+    FD_STORE( fd_pubkey_t, cur, *acc );
+    cur += sizeof(fd_pubkey_t);
+
+    if( known ) FD_STORE( fd_pubkey_t, cur, *(fd_pubkey_t const *)metadata->info.owner );
+    else        fd_memset( cur, 0, sizeof(fd_pubkey_t) );
+    cur += sizeof(fd_pubkey_t);
+
+    FD_STORE( ulong, cur, known ? metadata->info.lamports : 0UL );
+    cur += sizeof(ulong);
+
+    ulong acc_data_len = known ? metadata->dlen : 0UL;
+    pre_lens[i] = acc_data_len;
+    FD_STORE( ulong, cur, acc_data_len );
+    cur += sizeof(ulong);
+
+    /* Close the parameter buffer sub-region, map the account data in
+       place and give the spare space a sub-region of its own, both
+       writable only if the program may change the account's data */
+    int err;
+    int data_writable = is_writable && view_acc->data!=NULL && fd_account_can_data_be_changed( ctx.instr, i, &err );
+    ulong vaddr = seg_vaddr + (ulong)( cur - seg );
+    region = fd_bpf_loader_input_region_push( region, seg_vaddr, (ulong)seg, (ulong)( cur - seg ), 1, NULL );
+    if( acc_data_len ) {
+      region = fd_bpf_loader_input_region_push( region, vaddr, (ulong)view_acc->const_data, acc_data_len, data_writable, view_acc );
+      vaddr += acc_data_len;
+    }
+
+    ulong spare_sz = MAX_PERMITTED_DATA_INCREASE + fd_ulong_align_up( acc_data_len, 8UL ) - acc_data_len;
+    fd_memset( cur, 0, spare_sz );
+    region = fd_bpf_loader_input_region_push( region, vaddr, (ulong)cur, spare_sz, data_writable, NULL );
+    cur += spare_sz;
+    seg       = cur;
+    seg_vaddr = vaddr + spare_sz;
+
+    ulong rent_epoch = known ? metadata->info.rent_epoch
+                             : fd_ulong_if( FD_FEATURE_ACTIVE( ctx.slot_ctx, set_exempt_rent_epoch_max ), ULONG_MAX, 0UL );
+    FD_STORE( ulong, cur, rent_epoch );
+    cur += sizeof(ulong);
+  }
+
+  ulong instr_data_len = ctx.instr->data_sz;
+  FD_STORE( ulong, cur, instr_data_len );
+  cur += sizeof(ulong);
+
+  fd_memcpy( cur, ctx.instr->data, instr_data_len );
+  cur += instr_data_len;
+
+  FD_STORE( fd_pubkey_t, cur, txn_accs[ctx.instr->program_id] );
+  cur += sizeof(fd_pubkey_t);
+  FD_TEST( cur == buf + buf_sz );
+
+  region = fd_bpf_loader_input_region_push( region, seg_vaddr, (ulong)seg, (ulong)( cur - seg ), 1, NULL );
+
+  *sz                = buf_sz + data_sz;
+  *input_regions     = regions;
+  *input_regions_cnt = (ulong)( region - regions );
+
+  return buf;
+}
+
+int
+fd_bpf_loader_input_deserialize_direct( fd_exec_instr_ctx_t ctx,
+                                        ulong const *       pre_lens,
+                                        uchar *             input,
+                                        ulong               input_sz ) {
+  uchar * input_cursor = input;
+
+  uchar acc_idx_seen[256];
+  memset(acc_idx_seen, 0, sizeof(acc_idx_seen));
+
+  uchar const * instr_acc_idxs = ctx.instr->acct_txn_idxs;
+  fd_pubkey_t * txn_accs =  ctx.txn_ctx->accounts;
+
+  input_cursor += sizeof(ulong);
+  for( ulong i = 0; i < ctx.instr->acct_cnt; i++ ) {
+    uchar acc_idx = instr_acc_idxs[i];
+    fd_pubkey_t * acc = &txn_accs[acc_idx];
+
+    input_cursor++;
+    if( FD_UNLIKELY( acc_idx_seen[acc_idx] ) ) {
+      input_cursor += 7;
+      continue;
+    }
+    acc_idx_seen[acc_idx] = 1;
+
+    input_cursor += sizeof(uchar) // is_signer
+        + sizeof(uchar)           // is_writable
+        + sizeof(uchar)           // executable
+        + sizeof(uint)            // original_data_len
+        + sizeof(fd_pubkey_t);    // key
+
+    fd_pubkey_t * owner = (fd_pubkey_t *)input_cursor;
+    input_cursor += sizeof(fd_pubkey_t);
+
+    ulong lamports = FD_LOAD(ulong, input_cursor);
+    input_cursor += sizeof(ulong);
+
+    ulong post_data_len = FD_LOAD(ulong, input_cursor);
+    input_cursor += sizeof(ulong);
+
+    /* The account data was mapped in place, the spare space follows */
+    ulong         pre_len = pre_lens[i];
+    uchar const * spare   = input_cursor;
+    input_cursor += MAX_PERMITTED_DATA_INCREASE + fd_ulong_align_up( pre_len, 8UL ) - pre_len;
+
+    input_cursor += sizeof(ulong); // rent_epoch
+
+    if( !fd_instr_acc_is_writable_idx( ctx.instr, (uchar)i ) || fd_pubkey_is_sysvar_id( acc ) ) {
+      continue;
+    }
+
+    fd_borrowed_account_t * view_acc = NULL;
+    fd_instr_borrowed_account_view( &ctx, acc, &view_acc );
+    if( FD_UNLIKELY( view_acc->const_meta == NULL ) ) {
+      continue;
+    }
+    if( view_acc->const_meta->info.executable &&
+        memcmp( view_acc->const_meta->info.owner, fd_solana_bpf_loader_upgradeable_program_id.key, sizeof(fd_pubkey_t) ) != 0 ) {
+      continue;
+    }
+
+    if( fd_ulong_sat_sub( post_data_len, pre_len ) > MAX_PERMITTED_DATA_INCREASE || post_data_len > MAX_PERMITTED_DATA_LENGTH ) {
+      return -1;
+    }
+
+    fd_borrowed_account_t * modify_acc = NULL;
+    int modify_err = fd_instr_borrowed_account_modify( &ctx, acc, 0UL, &modify_acc );
+    if( FD_UNLIKELY( modify_err != FD_ACC_MGR_SUCCESS || modify_acc->meta == NULL ) ) {
+      fd_valloc_free( ctx.valloc, input );
+      return -1;
+    }
+    fd_account_meta_t * metadata = modify_acc->meta;
+
+    int err;
+    if( fd_account_can_data_be_resized( &ctx, metadata, post_data_len, &err )
+        && fd_account_can_data_be_changed( ctx.instr, i, &err ) ) {
+      /* Data up to pre_len was modified in place.  Grown data is in the
+         spare space. */
+      if( post_data_len > metadata->dlen ) {
+        modify_err = fd_instr_borrowed_account_modify( &ctx, acc, post_data_len, &modify_acc );
+        if( FD_UNLIKELY( modify_err != FD_ACC_MGR_SUCCESS ) ) {
+          fd_valloc_free( ctx.valloc, input );
+          return -1;
+        }
+        metadata = modify_acc->meta;
+      }
+      if( post_data_len > pre_len ) {
+        fd_memcpy( modify_acc->data + pre_len, spare, post_data_len - pre_len );
+      }
+      metadata->dlen = post_data_len;
+    } else if( metadata->dlen != post_data_len ) {
+      /* The data sub-region was read-only, so only the length can have
+         been changed */
+      FD_LOG_DEBUG(("Data resize failed"));
+      return err;
+    }
+
+    metadata->info.lamports = lamports;
+    if( memcmp( metadata->info.owner, owner, sizeof(fd_pubkey_t) ) != 0 ) {
+      fd_account_set_owner( &ctx, i, owner );
+    }
+
+    // add to dirty list
+    metadata->slot = ctx.slot_ctx->slot_bank.slot;
+  }
+
+  FD_TEST( input_cursor <= input + input_sz );
+
+  fd_valloc_free( ctx.valloc, input );
+
+  return 0;
+}
+
 uchar *
 fd_bpf_loader_input_serialize_unaligned( fd_exec_instr_ctx_t ctx,
                                          ulong * sz,
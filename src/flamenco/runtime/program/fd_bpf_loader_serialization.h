@@ -4,6 +4,7 @@
 #include "../../fd_flamenco_base.h"
 #include "../fd_executor.h"
 #include "../fd_runtime.h"
+#include "../../vm/fd_vm_context.h"
 
 #define MAX_PERMITTED_DATA_INCREASE (10 * 1024)
 
@@ -15,6 +16,26 @@ fd_bpf_loader_input_serialize_aligned( fd_exec_instr_ctx_t ctx, ulong * sz, ulon
 int
 fd_bpf_loader_input_deserialize_aligned( fd_exec_instr_ctx_t ctx, ulong const * pre_lens, uchar * input, ulong input_sz );
 
+/* fd_bpf_loader_input_{serialize,deserialize}_direct are the direct
+   mapped variants of the aligned serialization (used when
+   bpf_account_data_direct_mapping is active).  Serialization writes
+   the parameter buffer without the account data and returns the input
+   sub-regions that map the account data in place in
+   *input_regions / *input_regions_cnt.  *sz is the size of the whole
+   input region.  The sub-regions are freed along with the returned
+   buffer, and deserialization frees the buffer like the aligned
+   variant. */
+
+uchar *
+fd_bpf_loader_input_serialize_direct( fd_exec_instr_ctx_t      ctx,
+                                      ulong *                  sz,
+                                      ulong *                  pre_lens,
+                                      fd_vm_input_region_t * * input_regions,
+                                      ulong *                  input_regions_cnt );
+
+int
+fd_bpf_loader_input_deserialize_direct( fd_exec_instr_ctx_t ctx, ulong const * pre_lens, uchar * input, ulong input_sz );
+
 uchar *
 fd_bpf_loader_input_serialize_unaligned( fd_exec_instr_ctx_t ctx, ulong * sz, ulong * pre_lens );
 
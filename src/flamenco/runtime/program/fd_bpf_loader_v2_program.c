@@ -93,8 +93,14 @@ fd_bpf_loader_v2_user_execute( fd_exec_instr_ctx_t ctx ) {
   ulong input_sz = 0;
   ulong pre_lens[256];
   uchar * input;
-  if (FD_UNLIKELY(memcmp(metadata->info.owner, fd_solana_bpf_loader_deprecated_program_id.key, sizeof(fd_pubkey_t)) == 0)) {
+  fd_vm_input_region_t * input_regions = NULL;
+  ulong input_regions_cnt = 0UL;
+  int is_deprecated  = memcmp(metadata->info.owner, fd_solana_bpf_loader_deprecated_program_id.key, sizeof(fd_pubkey_t)) == 0;
+  int direct_mapping = !is_deprecated && FD_FEATURE_ACTIVE( ctx.slot_ctx, bpf_account_data_direct_mapping );
+  if (FD_UNLIKELY(is_deprecated)) {
     input = fd_bpf_loader_input_serialize_unaligned(ctx, &input_sz, pre_lens);
+  } else if (direct_mapping) {
+    input = fd_bpf_loader_input_serialize_direct(ctx, &input_sz, pre_lens, &input_regions, &input_regions_cnt);
   } else {
     input = fd_bpf_loader_input_serialize_aligned(ctx, &input_sz, pre_lens);
   }
@@ -118,6 +124,8 @@ fd_bpf_loader_v2_user_execute( fd_exec_instr_ctx_t ctx ) {
     .calldests           = prog->calldests,
     .input               = input,
     .input_sz            = input_sz,
+    .input_regions       = input_regions,
+    .input_regions_cnt   = input_regions_cnt,
     .read_only           = (uchar *)fd_type_pun_const(prog->rodata),
     .read_only_sz        = prog->rodata_sz,
     .heap_sz = FD_VM_DEFAULT_HEAP_SZ,
@@ -276,9 +284,12 @@ if (memcmp(signature, sig, 64) == 0) {
     return -1;
   }
 
-  if (FD_UNLIKELY(memcmp(metadata->info.owner, fd_solana_bpf_loader_deprecated_program_id.key, sizeof(fd_pubkey_t)) == 0)) {
+  if (FD_UNLIKELY(is_deprecated)) {
     if(fd_bpf_loader_input_deserialize_unaligned(ctx, pre_lens, input, input_sz))
       return -1;
+  } else if (direct_mapping) {
+    if(fd_bpf_loader_input_deserialize_direct(ctx, pre_lens, input, input_sz))
+      return -1;
   } else {
     if(fd_bpf_loader_input_deserialize_aligned(ctx, pre_lens, input, input_sz))
       return -1;
@@ -338,9 +338,14 @@ execute( fd_exec_instr_ctx_t * instr_ctx, fd_sbpf_validated_program_t * prog ) {
   fd_vm_syscall_register_all( syscalls );
   
   /* https://github.com/anza-xyz/agave/blob/574bae8fefc0ed256b55340b9d87b7689bcdf222/programs/bpf_loader/src/lib.rs#L1362-L1368 */
+  int direct_mapping = FD_FEATURE_ACTIVE( instr_ctx->slot_ctx, bpf_account_data_direct_mapping );
   ulong input_sz = 0;
   ulong pre_lens[ 256UL ];
-  uchar * input = fd_bpf_loader_input_serialize_aligned( *instr_ctx, &input_sz, pre_lens );
+  fd_vm_input_region_t * input_regions     = NULL;
+  ulong                  input_regions_cnt = 0UL;
+  uchar * input = direct_mapping ?
+      fd_bpf_loader_input_serialize_direct ( *instr_ctx, &input_sz, pre_lens, &input_regions, &input_regions_cnt ) :
+      fd_bpf_loader_input_serialize_aligned( *instr_ctx, &input_sz, pre_lens );
   if( FD_UNLIKELY( input==NULL ) ) {
     return FD_EXECUTOR_INSTR_ERR_MISSING_ACC;
   }
@@ -358,6 +363,8 @@ execute( fd_exec_instr_ctx_t * instr_ctx, fd_sbpf_validated_program_t * prog ) {
     .calldests           = prog->calldests,
     .input               = input,
     .input_sz            = input_sz,
+    .input_regions       = input_regions,
+    .input_regions_cnt   = input_regions_cnt,
     .read_only           = fd_sbpf_validated_program_rodata( prog ),
     .read_only_sz        = prog->rodata_sz,
     /* TODO: configure heap allocator */
@@ -519,7 +526,10 @@ execute( fd_exec_instr_ctx_t * instr_ctx, fd_sbpf_validated_program_t * prog ) {
     return FD_EXECUTOR_INSTR_ERR_GENERIC_ERR;;
   }
 
-  if( FD_UNLIKELY( fd_bpf_loader_input_deserialize_aligned( *instr_ctx, pre_lens, input, input_sz )!=0 ) ) {
+  int deserialize_err = direct_mapping ?
+      fd_bpf_loader_input_deserialize_direct ( *instr_ctx, pre_lens, input, input_sz ) :
+      fd_bpf_loader_input_deserialize_aligned( *instr_ctx, pre_lens, input, input_sz );
+  if( FD_UNLIKELY( deserialize_err!=0 ) ) {
     return FD_EXECUTOR_INSTR_ERR_INVALID_ARG;
   }
 
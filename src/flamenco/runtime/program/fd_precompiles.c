@@ -145,6 +145,20 @@ fd_precompile_ed25519_verify( fd_exec_instr_ctx_t ctx ) {
     return FD_EXECUTOR_PRECOMPILE_ERR_INSTR_DATA_SIZE;
   }
 
+  /* Signatures are collected and verified FD_ED25519_VERIFY_BATCH_MAX
+     at a time with fd_ed25519_verify_batch_multi_msg, which gives the
+     same per-signature results as fd_ed25519_verify.  Agave checks the
+     offsets and the signature of one entry before moving on to the
+     next, so to return the same error when an entry has bad offsets,
+     the pending entries before it are verified first. */
+  uchar const * sigs   [ FD_ED25519_VERIFY_BATCH_MAX ];
+  uchar const * pubkeys[ FD_ED25519_VERIFY_BATCH_MAX ];
+  uchar const * msgs   [ FD_ED25519_VERIFY_BATCH_MAX ];
+  ulong         msg_szs[ FD_ED25519_VERIFY_BATCH_MAX ];
+  int           res    [ FD_ED25519_VERIFY_BATCH_MAX ];
+  ulong         cnt = 0UL;
+  fd_sha512_t   sha[1];
+
   ulong off = SIGNATURE_OFFSETS_START;
   for( ulong i = 0; i < sig_cnt; ++i ) {
     fd_ed25519_signature_offsets_t const * sigoffs = (const fd_ed25519_signature_offsets_t *) (data + off);
@@ -160,7 +174,6 @@ fd_precompile_ed25519_verify( fd_exec_instr_ctx_t ctx ) {
                                             sigoffs->sig_offset,
                                             SIGNATURE_SERIALIZED_SIZE,
                                             &sig );
-    if( FD_UNLIKELY( err ) ) return FD_EXECUTOR_PRECOMPILE_ERR_DATA_OFFSET;
 
     /* https://github.com/anza-xyz/agave/blob/v1.18.12/sdk/src/ed25519_instruction.rs#L123-L124
        Note: we parse the signature as part of fd_ed25519_verify.
@@ -168,12 +181,11 @@ fd_precompile_ed25519_verify( fd_exec_instr_ctx_t ctx ) {
 
     /* https://github.com/anza-xyz/agave/blob/v1.18.12/sdk/src/ed25519_instruction.rs#L126-L133 */
     uchar const * pubkey = NULL;
-    err = fd_precompile_get_instr_data( ctx,
-                                        sigoffs->pubkey_instr_idx,
-                                        sigoffs->pubkey_offset,
-                                        ED25519_PUBKEY_SERIALIZED_SIZE,
-                                        &pubkey );
-    if( FD_UNLIKELY( err ) ) return FD_EXECUTOR_PRECOMPILE_ERR_DATA_OFFSET;
+    if( FD_LIKELY( !err ) ) err = fd_precompile_get_instr_data( ctx,
+                                                                sigoffs->pubkey_instr_idx,
+                                                                sigoffs->pubkey_offset,
+                                                                ED25519_PUBKEY_SERIALIZED_SIZE,
+                                                                &pubkey );
 
     /* https://github.com/anza-xyz/agave/blob/v1.18.12/sdk/src/ed25519_instruction.rs#L135-L136
        Note: we parse the public key as part of fd_ed25519_verify.
@@ -182,18 +194,28 @@ fd_precompile_ed25519_verify( fd_exec_instr_ctx_t ctx ) {
     /* https://github.com/anza-xyz/agave/blob/v1.18.12/sdk/src/ed25519_instruction.rs#L138-L145 */
     uchar const * msg = NULL;
     ushort msg_sz = sigoffs->msg_data_sz;
-    err = fd_precompile_get_instr_data( ctx,
-                                        sigoffs->msg_instr_idx,
-                                        sigoffs->msg_offset,
-                                        msg_sz,
-                                        &msg );
-    if( FD_UNLIKELY( err ) ) return FD_EXECUTOR_PRECOMPILE_ERR_DATA_OFFSET;
+    if( FD_LIKELY( !err ) ) err = fd_precompile_get_instr_data( ctx,
+                                                                sigoffs->msg_instr_idx,
+                                                                sigoffs->msg_offset,
+                                                                msg_sz,
+                                                                &msg );
+
+    if( FD_UNLIKELY( err ) ) {
+      if( FD_UNLIKELY( cnt && fd_ed25519_verify_batch_multi_msg( msgs, msg_szs, sigs, pubkeys, res, cnt, sha )!=FD_ED25519_SUCCESS ) )
+        return FD_EXECUTOR_PRECOMPILE_ERR_SIGNATURE;
+      return FD_EXECUTOR_PRECOMPILE_ERR_DATA_OFFSET;
+    }
+
+    sigs[ cnt ] = sig; pubkeys[ cnt ] = pubkey; msgs[ cnt ] = msg; msg_szs[ cnt ] = msg_sz;
+    cnt++;
 
     /* https://github.com/anza-xyz/agave/blob/v1.18.12/sdk/src/ed25519_instruction.rs#L147-L149
        FIXME: Agave uses verify, not verify_strict. Fix Agave? */
-    fd_sha512_t sha[1];
-    if( FD_UNLIKELY( fd_ed25519_verify( msg, msg_sz, sig, pubkey, sha )!=FD_ED25519_SUCCESS ) )
-      return FD_EXECUTOR_PRECOMPILE_ERR_SIGNATURE;
+    if( cnt==FD_ED25519_VERIFY_BATCH_MAX || i==sig_cnt-1UL ) {
+      if( FD_UNLIKELY( fd_ed25519_verify_batch_multi_msg( msgs, msg_szs, sigs, pubkeys, res, cnt, sha )!=FD_ED25519_SUCCESS ) )
+        return FD_EXECUTOR_PRECOMPILE_ERR_SIGNATURE;
+      cnt = 0UL;
+    }
   }
 
   return FD_EXECUTOR_INSTR_SUCCESS;
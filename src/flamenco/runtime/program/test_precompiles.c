@@ -0,0 +1,155 @@
+#include "fd_precompiles.h"
+#include "../../../ballet/ed25519/fd_ed25519.h"
+
+/* test_precompiles checks the batched ed25519 precompile against a
+   reference that verifies one signature at a time (the previous
+   implementation), on synthetic instructions whose offsets all point
+   into the instruction itself, and benchmarks both. */
+
+#define SIG_MAX (64UL)
+#define MSG_SZ  (32UL)
+
+/* Instruction data layout: count, padding, SIG_MAX offset entries,
+   then one (sig,pubkey,msg) entry per signature. */
+
+#define ENTRY_SZ   (64UL+32UL+MSG_SZ)
+#define ENTRY_OFF  (2UL+14UL*SIG_MAX)
+#define DATA_MAX   (ENTRY_OFF+ENTRY_SZ*SIG_MAX)
+
+static void
+log_bench( char const * descr,
+           ulong        iter,
+           long         dt ) {
+  float khz = 1e6f *(float)iter/(float)dt;
+  float tau = (float)dt /(float)iter;
+  FD_LOG_NOTICE(( "%-40s %11.3fK/s/core %10.3f ns/call", descr, (double)khz, (double)tau ));
+}
+
+static void
+set_offsets( uchar * data,
+             ulong   i,
+             ushort  sig_off,
+             ushort  pubkey_off,
+             ushort  msg_off,
+             ushort  msg_sz ) {
+  ushort * o = (ushort *)( data + 2UL + 14UL*i );
+  o[0] = sig_off;    o[1] = USHORT_MAX;
+  o[2] = pubkey_off; o[3] = USHORT_MAX;
+  o[4] = msg_off;    o[5] = msg_sz; o[6] = USHORT_MAX;
+}
+
+/* make_instr builds an instruction with sig_cnt valid signatures */
+
+static ushort
+make_instr( uchar *       data,
+            ulong         sig_cnt,
+            fd_rng_t *    rng,
+            fd_sha512_t * sha ) {
+  data[0] = (uchar)sig_cnt;
+  data[1] = 0;
+  for( ulong i=0UL; i<sig_cnt; i++ ) {
+    ulong   off = 2UL + 14UL*sig_cnt + ENTRY_SZ*i;
+    uchar * sig = data + off;
+    uchar * pub = sig + 64UL;
+    uchar * msg = pub + 32UL;
+    uchar   prv[ 32 ];
+    for( ulong b=0UL; b<32UL;   b++ ) prv[ b ] = fd_rng_uchar( rng );
+    for( ulong b=0UL; b<MSG_SZ; b++ ) msg[ b ] = fd_rng_uchar( rng );
+    fd_ed25519_public_from_private( pub, prv, sha );
+    fd_ed25519_sign( sig, msg, MSG_SZ, pub, prv, sha );
+    set_offsets( data, i, (ushort)off, (ushort)(off+64UL), (ushort)(off+96UL), (ushort)MSG_SZ );
+  }
+  return (ushort)( 2UL + (14UL+ENTRY_SZ)*sig_cnt );
+}
+
+/* ref_ed25519_verify is fd_precompile_ed25519_verify for instructions
+   that only reference themselves, one signature at a time */
+
+static int
+ref_ed25519_verify( uchar const * data,
+                    ulong         data_sz ) {
+  ulong sig_cnt = data[0];
+  for( ulong i=0UL; i<sig_cnt; i++ ) {
+    ushort const * o = (ushort const *)( data + 2UL + 14UL*i );
+    if( (ulong)o[0]+64UL > data_sz ) return FD_EXECUTOR_PRECOMPILE_ERR_DATA_OFFSET;
+    if( (ulong)o[2]+32UL > data_sz ) return FD_EXECUTOR_PRECOMPILE_ERR_DATA_OFFSET;
+    if( (ulong)o[4]+o[5] > data_sz ) return FD_EXECUTOR_PRECOMPILE_ERR_DATA_OFFSET;
+    fd_sha512_t sha[1];
+    if( fd_ed25519_verify( data+o[4], o[5], data+o[0], data+o[2], sha )!=FD_ED25519_SUCCESS )
+      return FD_EXECUTOR_PRECOMPILE_ERR_SIGNATURE;
+  }
+  return FD_EXECUTOR_INSTR_SUCCESS;
+}
+
+static int
+run_ed25519( uchar * data,
+             ushort  data_sz ) {
+  fd_instr_info_t instr[1] = {{0}};
+  instr->data    = data;
+  instr->data_sz = data_sz;
+  fd_exec_instr_ctx_t ctx = { .instr = instr };
+  return fd_precompile_ed25519_verify( ctx );
+}
+
+static void
+test_ed25519( fd_rng_t *    rng,
+              fd_sha512_t * sha ) {
+  static uchar data[ DATA_MAX ];
+
+  for( ulong iter=0UL; iter<200UL; iter++ ) {
+    ulong  sig_cnt = 1UL + fd_rng_ulong_roll( rng, SIG_MAX );
+    ushort data_sz = make_instr( data, sig_cnt, rng, sha );
+    FD_TEST( run_ed25519( data, data_sz )==FD_EXECUTOR_INSTR_SUCCESS );
+
+    /* Corrupt a random signature, message or public key, and maybe the
+       offsets of another entry, before or after it */
+    ulong i   = fd_rng_ulong_roll( rng, sig_cnt );
+    ulong off = 2UL + 14UL*sig_cnt + ENTRY_SZ*i + fd_rng_ulong_roll( rng, ENTRY_SZ );
+    data[ off ] = (uchar)( data[ off ] ^ (1U<<fd_rng_uint_roll( rng, 8U )) );
+    if( fd_rng_uint_roll( rng, 2U ) ) {
+      ulong j = fd_rng_ulong_roll( rng, sig_cnt );
+      ushort * o = (ushort *)( data + 2UL + 14UL*j );
+      o[ 2UL*fd_rng_ulong_roll( rng, 3UL ) ] = (ushort)( data_sz - 1 );
+    }
+    FD_TEST( run_ed25519( data, data_sz )==ref_ed25519_verify( data, data_sz ) );
+  }
+  FD_LOG_NOTICE(( "ed25519: ok" ));
+
+  for( ulong sig_cnt=1UL; sig_cnt<=SIG_MAX; sig_cnt*=2UL ) {
+    ushort data_sz = make_instr( data, sig_cnt, rng, sha );
+    ulong  iter    = 4096UL / sig_cnt;
+    char   cstr[ 128 ];
+
+    long dt = fd_log_wallclock();
+    for( ulong rem=iter; rem; rem-- ) {
+      FD_COMPILER_FORGET( data_sz );
+      ref_ed25519_verify( data, data_sz );
+    }
+    dt = fd_log_wallclock() - dt;
+    log_bench( fd_cstr_printf( cstr, 128UL, NULL, "ed25519 precompile ref(%lu sigs)", sig_cnt ), iter, dt );
+
+    dt = fd_log_wallclock();
+    for( ulong rem=iter; rem; rem-- ) {
+      FD_COMPILER_FORGET( data_sz );
+      run_ed25519( data, data_sz );
+    }
+    dt = fd_log_wallclock() - dt;
+    log_bench( fd_cstr_printf( cstr, 128UL, NULL, "ed25519 precompile(%lu sigs)", sig_cnt ), iter, dt );
+  }
+}
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+  fd_rng_t _rng[1]; fd_rng_t * rng = fd_rng_join( fd_rng_new( _rng, 0U, 0UL ) );
+  fd_sha512_t _sha[1]; fd_sha512_t * sha = fd_sha512_join( fd_sha512_new( _sha ) );
+
+  test_ed25519( rng, sha );
+
+  fd_sha512_delete( fd_sha512_leave( sha ) );
+  fd_rng_delete( fd_rng_leave( rng ) );
+  FD_LOG_NOTICE(( "pass" ));
+  fd_halt();
+  return 0;
+}
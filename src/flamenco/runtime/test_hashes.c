@@ -0,0 +1,119 @@
+#include "fd_hashes.h"
+
+#define PAIR_MAX (1UL<<18)
+
+static fd_pubkey_t           pubkeys  [ PAIR_MAX ];
+static fd_hash_t             hashes   [ PAIR_MAX ];
+static fd_pubkey_hash_pair_t pairs    [ PAIR_MAX ];
+static fd_pubkey_hash_pair_t ref_pairs[ PAIR_MAX ];
+static uchar scratch[ 24UL*PAIR_MAX + FD_TILE_MAX*256UL*sizeof(ulong) ] __attribute__((aligned(64)));
+
+static uchar tpool_mem[ FD_TPOOL_FOOTPRINT(FD_TILE_MAX) ] __attribute__((aligned(FD_TPOOL_ALIGN)));
+
+static void
+fill( fd_rng_t * rng,
+      ulong      cnt ) {
+  for( ulong i=0UL; i<cnt; i++ ) {
+    for( ulong j=0UL; j<4UL; j++ ) {
+      pubkeys[ i ].ul[ j ] = fd_rng_ulong( rng );
+      hashes [ i ].ul[ j ] = fd_rng_ulong( rng );
+    }
+    /* Occasionally share a prefix with the previous key to exercise
+       the comparison past the radix byte */
+    if( i && !(fd_rng_uint( rng ) & 7U) ) pubkeys[ i ].ul[ 0 ] = pubkeys[ i-1UL ].ul[ 0 ];
+    pairs[ i ].pubkey = pubkeys + i;
+    pairs[ i ].hash   = hashes  + i;
+  }
+  fd_memcpy( ref_pairs, pairs, cnt*sizeof(fd_pubkey_hash_pair_t) );
+}
+
+static void
+test_match( fd_rng_t *   rng,
+            fd_tpool_t * tpool,
+            ulong        worker_cnt ) {
+  static ulong const cnts[] = { 2UL, 3UL, 15UL, 16UL, 17UL, 255UL, 256UL, 257UL, 4095UL, 4096UL, 4097UL,
+                                65535UL, 65536UL, 65537UL, 100000UL, PAIR_MAX };
+  for( ulong k=0UL; k<sizeof(cnts)/sizeof(cnts[0]); k++ ) {
+    ulong cnt = cnts[ k ];
+    FD_TEST( fd_hash_account_deltas_tpool_scratch_footprint( cnt, worker_cnt )<=sizeof(scratch) );
+    fill( rng, cnt );
+
+    fd_hash_t ref[1]; fd_hash_t par[1];
+    fd_hash_account_deltas      ( ref_pairs, cnt, ref, NULL );
+    fd_hash_account_deltas_tpool( pairs,     cnt, par, scratch, tpool, 0UL, worker_cnt );
+
+    FD_TEST( fd_memeq( ref, par, sizeof(fd_hash_t) ) );
+    for( ulong i=0UL; i<cnt; i++ ) FD_TEST( fd_memeq( ref_pairs[ i ].pubkey, pairs[ i ].pubkey, sizeof(fd_pubkey_t) ) );
+  }
+
+  /* Empty and single pair inputs */
+
+  fd_hash_t empty[1];
+  fd_sha256_hash( NULL, 0UL, empty );
+  fd_hash_t par[1];
+  fd_hash_account_deltas_tpool( pairs, 0UL, par, scratch, tpool, 0UL, worker_cnt );
+  FD_TEST( fd_memeq( par, empty, sizeof(fd_hash_t) ) );
+
+  fill( rng, 1UL );
+  fd_hash_account_deltas_tpool( pairs, 1UL, par, scratch, tpool, 0UL, worker_cnt );
+  FD_TEST( fd_memeq( par, hashes, sizeof(fd_hash_t) ) );
+}
+
+static void
+bench( fd_rng_t *   rng,
+       fd_tpool_t * tpool,
+       ulong        worker_cnt ) {
+  FD_LOG_NOTICE(( "pairs\tserial (ns/pair)\tparallel (ns/pair)\tworkers\tspeedup" ));
+  static ulong const cnts[] = { 1024UL, 16384UL, PAIR_MAX };
+  for( ulong k=0UL; k<sizeof(cnts)/sizeof(cnts[0]); k++ ) {
+    ulong cnt = cnts[ k ];
+    ulong iter_cnt = fd_ulong_max( 4UL, (1UL<<22)/cnt );
+    fill( rng, cnt );
+
+    fd_hash_t h[1];
+    long ref_dt = 0L;
+    for( ulong iter=0UL; iter<iter_cnt; iter++ ) {
+      fd_memcpy( ref_pairs, pairs, cnt*sizeof(fd_pubkey_hash_pair_t) );
+      ref_dt -= fd_log_wallclock();
+      fd_hash_account_deltas( ref_pairs, cnt, h, NULL );
+      ref_dt += fd_log_wallclock();
+    }
+
+    long par_dt = 0L;
+    for( ulong iter=0UL; iter<iter_cnt; iter++ ) {
+      fd_memcpy( ref_pairs, pairs, cnt*sizeof(fd_pubkey_hash_pair_t) );
+      par_dt -= fd_log_wallclock();
+      fd_hash_account_deltas_tpool( ref_pairs, cnt, h, scratch, tpool, 0UL, worker_cnt );
+      par_dt += fd_log_wallclock();
+    }
+
+    double norm = 1. / (double)(iter_cnt*cnt);
+    FD_LOG_NOTICE(( "%7lu\t%16.1f\t%18.1f\t%7lu\t%6.2fx",
+                    cnt, (double)ref_dt*norm, (double)par_dt*norm, worker_cnt, (double)ref_dt/(double)par_dt ));
+  }
+}
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+
+  fd_rng_t _rng[1]; fd_rng_t * rng = fd_rng_join( fd_rng_new( _rng, 0U, 0UL ) );
+
+  ulong worker_cnt = fd_tile_cnt();
+  fd_tpool_t * tpool = fd_tpool_init( tpool_mem, worker_cnt ); FD_TEST( tpool );
+  for( ulong i=1UL; i<worker_cnt; i++ ) FD_TEST( fd_tpool_worker_push( tpool, i, NULL, 0UL ) );
+
+  FD_LOG_NOTICE(( "Testing with %lu workers", worker_cnt ));
+
+  test_match( rng, NULL,  1UL        );
+  test_match( rng, tpool, worker_cnt );
+  bench     ( rng, tpool, worker_cnt );
+
+  fd_tpool_fini( tpool );
+  fd_rng_delete( fd_rng_leave( rng ) );
+
+  FD_LOG_NOTICE(( "pass" ));
+  fd_halt();
+  return 0;
+}
@@ -0,0 +1,112 @@
+#include "fd_runtime.h"
+#include "context/fd_exec_epoch_ctx.h"
+#include "context/fd_exec_slot_ctx.h"
+
+/* Streams a chain of slots through fd_runtime_publish_old_txns the way
+   the replay tile creates them: each slot is a funk txn keyed by the
+   poh hash of its first batch, with a child txn keyed by the block hash
+   once the block is finished.  Publishing must count slots, not txns. */
+
+#define SLOT_CNT (3UL*FD_RUNTIME_NUM_ROOT_BLOCKS)
+
+static fd_funk_txn_xid_t
+xid( ulong slot,
+     ulong tag ) {
+  fd_funk_txn_xid_t x;
+  x.ul[0] = slot;
+  x.ul[1] = tag;
+  x.ul[2] = ~slot;
+  x.ul[3] = ~tag;
+  return x;
+}
+
+static void
+test_publish( fd_exec_slot_ctx_t * slot_ctx,
+              int                  split ) {
+  fd_funk_t *     funk    = slot_ctx->acc_mgr->funk;
+  fd_funk_txn_t * txn_map = fd_funk_txn_map( funk, fd_funk_wksp( funk ) );
+
+  ulong slot0 = fd_funk_last_publish( funk )->ul[0];
+  slot_ctx->funk_txn = NULL;
+  for( ulong slot=slot0+1UL; slot<=slot0+SLOT_CNT; slot++ ) {
+    fd_funk_txn_xid_t poh_xid  = xid( slot, 1UL );
+    fd_funk_txn_xid_t hash_xid = xid( slot, 2UL );
+    fd_funk_start_write( funk );
+    slot_ctx->funk_txn = fd_funk_txn_prepare( funk, slot_ctx->funk_txn, &poh_xid, 1 );
+    FD_TEST( slot_ctx->funk_txn );
+    if( split ) {
+      slot_ctx->funk_txn = fd_funk_txn_prepare( funk, slot_ctx->funk_txn, &hash_xid, 1 );
+      FD_TEST( slot_ctx->funk_txn );
+    }
+    fd_funk_end_write( funk );
+
+    slot_ctx->slot_bank.slot = slot;
+    FD_TEST( !fd_runtime_publish_old_txns( slot_ctx, NULL, NULL, 0UL ) );
+
+    /* The FD_RUNTIME_NUM_ROOT_BLOCKS-2 youngest slots are never
+       published, everything older is */
+
+    ulong root_slot = fd_funk_last_publish( funk )->ul[0];
+    ulong keep_cnt  = FD_RUNTIME_NUM_ROOT_BLOCKS-2UL;
+    FD_TEST( root_slot==( slot-slot0>keep_cnt ? slot-keep_cnt : slot0 ) );
+
+    ulong txn_cnt = 0UL;
+    for( fd_funk_txn_t * txn=slot_ctx->funk_txn; txn; txn=fd_funk_txn_parent( txn, txn_map ) ) {
+      FD_TEST( txn->xid.ul[0]>root_slot );
+      txn_cnt++;
+    }
+    FD_TEST( txn_cnt==( slot-root_slot )*( split ? 2UL : 1UL ) );
+  }
+
+  fd_funk_start_write( funk );
+  fd_funk_txn_cancel_all( funk, 1 );
+  fd_funk_end_write( funk );
+}
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+
+  char const * _page_sz = fd_env_strip_cmdline_cstr ( &argc, &argv, "--page-sz",  NULL, "normal" );
+  ulong        page_cnt = fd_env_strip_cmdline_ulong( &argc, &argv, "--page-cnt", NULL, 65536UL  );
+  ulong        near_cpu = fd_env_strip_cmdline_ulong( &argc, &argv, "--near-cpu", NULL, fd_log_cpu_id() );
+
+  fd_wksp_t * wksp = fd_wksp_new_anonymous( fd_cstr_to_shmem_page_sz( _page_sz ), page_cnt, near_cpu, "wksp", 0UL );
+  FD_TEST( wksp );
+
+  ulong  txn_max   = 4UL*SLOT_CNT;
+  ulong  rec_max   = 1024UL;
+  void * funk_mem  = fd_wksp_alloc_laddr( wksp, fd_funk_align(), fd_funk_footprint(), 1UL );
+  fd_funk_t * funk = fd_funk_join( fd_funk_new( funk_mem, 1UL, 1234UL, txn_max, rec_max ) );
+  FD_TEST( funk );
+
+  fd_acc_mgr_t acc_mgr[1];
+  FD_TEST( fd_acc_mgr_new( acc_mgr, funk ) );
+
+  ulong  vote_acc_max  = 1UL;
+  void * epoch_ctx_mem = fd_wksp_alloc_laddr( wksp, fd_exec_epoch_ctx_align(), fd_exec_epoch_ctx_footprint( vote_acc_max ), 1UL );
+  fd_exec_epoch_ctx_t * epoch_ctx = fd_exec_epoch_ctx_join( fd_exec_epoch_ctx_new( epoch_ctx_mem, vote_acc_max ) );
+  FD_TEST( epoch_ctx );
+  fd_exec_epoch_ctx_epoch_bank( epoch_ctx )->eah_start_slot = ULONG_MAX; /* no epoch accounts hash */
+
+  fd_valloc_t valloc = fd_libc_alloc_virtual();
+  void * slot_ctx_mem = fd_wksp_alloc_laddr( wksp, FD_EXEC_SLOT_CTX_ALIGN, FD_EXEC_SLOT_CTX_FOOTPRINT, 1UL );
+  fd_exec_slot_ctx_t * slot_ctx = fd_exec_slot_ctx_join( fd_exec_slot_ctx_new( slot_ctx_mem, valloc ) );
+  FD_TEST( slot_ctx );
+  slot_ctx->epoch_ctx = epoch_ctx;
+  slot_ctx->acc_mgr   = acc_mgr;
+  slot_ctx->valloc    = valloc;
+
+  test_publish( slot_ctx, 0 );
+  test_publish( slot_ctx, 1 );
+
+  fd_wksp_free_laddr( fd_exec_slot_ctx_delete( fd_exec_slot_ctx_leave( slot_ctx ) ) );
+  fd_wksp_free_laddr( fd_exec_epoch_ctx_delete( fd_exec_epoch_ctx_leave( epoch_ctx ) ) );
+  fd_wksp_free_laddr( fd_funk_delete( fd_funk_leave( funk ) ) );
+  fd_wksp_delete_anonymous( wksp );
+
+  FD_LOG_NOTICE(( "pass" ));
+  fd_halt();
+  return 0;
+}
@@ -10,4 +10,10 @@ endif
 
 $(call make-unit-test,test_vm_cpi,test_vm_cpi,fd_util)
 $(call run-unit-test,test_vm_cpi)
+$(call make-unit-test,test_vm_context,test_vm_context,fd_flamenco fd_funk fd_ballet fd_util)
+$(call run-unit-test,test_vm_context)
+ifdef FD_HAS_SECP256K1
+$(call make-unit-test,test_vm_syscalls,test_vm_syscalls,fd_flamenco fd_funk fd_ballet fd_util,$(SECP256K1_LIBS))
+$(call run-unit-test,test_vm_syscalls)
+endif
 endif
@@ -160,6 +160,34 @@ fd_vm_context_validate( fd_vm_exec_context_t const * ctx ) {
   return FD_VM_SBPF_VALIDATE_SUCCESS;
 }
 
+fd_vm_input_region_t *
+fd_vm_input_region_query( fd_vm_exec_context_t const * ctx,
+                          ulong                        off ) {
+  /* Find the last sub-region starting at or before off */
+  fd_vm_input_region_t * regions = ctx->input_regions;
+  if( FD_UNLIKELY( !ctx->input_regions_cnt ) ) return NULL;
+  ulong lo = 0UL;
+  ulong hi = ctx->input_regions_cnt;
+  while( hi-lo>1UL ) {
+    ulong mid = lo + (hi-lo)/2UL;
+    if( regions[ mid ].vaddr_offset<=off ) lo = mid;
+    else                                   hi = mid;
+  }
+  if( FD_UNLIKELY( off<regions[ lo ].vaddr_offset                                          ) ) return NULL;
+  if( FD_UNLIKELY( off-regions[ lo ].vaddr_offset>=regions[ lo ].address_space_reserved ) ) return NULL;
+  return regions + lo;
+}
+
+void
+fd_vm_input_region_remap( fd_vm_exec_context_t * ctx ) {
+  for( ulong i=0UL; i<ctx->input_regions_cnt; i++ ) {
+    fd_vm_input_region_t * region = ctx->input_regions + i;
+    if( !region->acct ) continue;
+    region->haddr     = (ulong)region->acct->const_data;
+    region->region_sz = fd_ulong_min( region->acct->const_meta->dlen, region->address_space_reserved );
+  }
+}
+
 ulong
 fd_vm_translate_vm_to_host_private( fd_vm_exec_context_t *  ctx,
                                     ulong                   vm_addr,
@@ -246,6 +274,23 @@ fd_vm_translate_vm_to_host_private( fd_vm_exec_context_t *  ctx,
       if( FD_UNLIKELY( end_addr > ctx->input_sz ) ) {
         return 0UL;
       }
+
+      if( ctx->input_regions ) {
+        /* Direct mapped account data: the access must not cross into
+           another sub-region and writes are checked per sub-region */
+        fd_vm_input_region_t const * region = fd_vm_input_region_query( ctx, start_addr );
+        if( FD_UNLIKELY( !region ) ) {
+          return 0UL;
+        }
+        ulong region_off = start_addr - region->vaddr_offset;
+        if( FD_UNLIKELY( ( write && !region->is_writable          )
+                       | ( region_off > region->region_sz         )
+                       | ( sz > region->region_sz - region_off    ) ) ) {
+          return 0UL;
+        }
+        host_addr = region->haddr + region_off;
+        break;
+      }
       host_addr = (ulong)ctx->input + start_addr;
       break;
     default:
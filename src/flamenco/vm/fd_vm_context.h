@@ -55,6 +55,31 @@ typedef struct fd_vm_exec_context fd_vm_exec_context_t;
    value is a status code for the syscall. */
 typedef ulong (*fd_vm_syscall_fn_ptr_t)(fd_vm_exec_context_t * ctx, ulong arg0, ulong arg1, ulong arg2, ulong arg3, ulong arg4, ulong * ret);
 
+/* fd_vm_input_region_t describes a sub-region of the program input
+   memory region.  When account data is direct mapped (see
+   fd_bpf_loader_input_serialize_direct), the input region is a list of
+   sub-regions, sorted by vaddr_offset and tiling [0,input_sz), of the
+   serialized parameter buffer, of the data of the borrowed accounts
+   (accounts without data get no data sub-region) and of the realloc
+   spare space that follows each account's data in the parameter
+   buffer (writable only if the account's data is).  A sub-region
+   reserves address_space_reserved bytes of VM address space,
+   of which the first region_sz are mapped (an account data sub-region
+   shrinks when a CPI shrinks the account).  An access must lie within
+   the mapped part of a single sub-region and a write requires a
+   writable sub-region. */
+
+struct fd_vm_input_region {
+  ulong vaddr_offset;           /* Offset of the sub-region from the start of the input region */
+  ulong haddr;                  /* Host address of the first byte of the sub-region */
+  ulong region_sz;              /* Number of bytes mapped */
+  ulong address_space_reserved; /* Number of bytes of VM address space reserved, >=region_sz */
+  int   is_writable;            /* Non-zero if the sub-region can be written to */
+
+  fd_borrowed_account_t const * acct; /* The account whose data is mapped, NULL for parameter buffer sub-regions */
+};
+typedef struct fd_vm_input_region fd_vm_input_region_t;
+
 /* fd_vm_heap_allocator_t is the state of VM's native allocator backing
    the sol_alloc_free_ syscall.  Provides a naive bump allocator.
    Obviously, this feature is redundant.  The same allocation logic
@@ -133,6 +158,22 @@ struct fd_vm_exec_compute_budget {
     /// Number of compute units consumed for a multiscalar multiplication (msm) of ristretto points.
     /// The total cost is calculated as `msm_base_cost + (length - 1) * msm_incremental_cost`.
     ulong curve25519_ristretto_msm_incremental_cost;
+    /// Number of compute units consumed to call alt_bn128_addition
+    ulong alt_bn128_addition_cost;
+    /// Number of compute units consumed to call alt_bn128_multiplication
+    ulong alt_bn128_multiplication_cost;
+    /// Total cost will be alt_bn128_pairing_one_pair_cost_first
+    /// + alt_bn128_pairing_one_pair_cost_other * (num_elems - 1)
+    ulong alt_bn128_pairing_one_pair_cost_first;
+    ulong alt_bn128_pairing_one_pair_cost_other;
+    /// Coefficient `a` of the quadratic function which determines the number
+    /// of compute units consumed to call poseidon syscall for a given number
+    /// of inputs.
+    ulong poseidon_cost_coefficient_a;
+    /// Coefficient `c` of the quadratic function which determines the number
+    /// of compute units consumed to call poseidon syscall for a given number
+    /// of inputs.
+    ulong poseidon_cost_coefficient_c;
     /// Optional program heap region size, if `None` then loader default
     ulong heap_size;
     /// Number of compute units per additional 32k heap above the default (~.5
@@ -177,6 +218,12 @@ static const fd_vm_exec_compute_budget_t vm_compute_budget = {
   .curve25519_ristretto_multiply_cost = 2208,
   .curve25519_ristretto_msm_base_cost = 2303,
   .curve25519_ristretto_msm_incremental_cost = 788,
+  .alt_bn128_addition_cost = 334,
+  .alt_bn128_multiplication_cost = 3840,
+  .alt_bn128_pairing_one_pair_cost_first = 36364,
+  .alt_bn128_pairing_one_pair_cost_other = 12121,
+  .poseidon_cost_coefficient_a = 61,
+  .poseidon_cost_coefficient_c = 542,
   // .heap_size = NULL,
   .heap_cost = 8,
   .mem_op_base_cost = 10,
@@ -213,6 +260,8 @@ struct fd_vm_exec_context {
   ulong         read_only_sz;             /* The read-only memory region size */
   uchar *       input;                    /* The program input memory region */
   ulong         input_sz;                 /* The program input memory region size */
+  fd_vm_input_region_t * input_regions;   /* If non-NULL, the input region is made of these sub-regions instead of input */
+  ulong         input_regions_cnt;        /* The number of input sub-regions */
   fd_vm_stack_t stack;                    /* The sBPF call frame stack */
   ulong         heap_sz;                  /* The configured size of the heap */
   uchar         heap[FD_VM_MAX_HEAP_SZ];  /* The heap memory allocated by the bump allocator syscall */
@@ -240,6 +289,26 @@ fd_vm_consume_compute_meter( fd_vm_exec_context_t * ctx, ulong cost );
 FD_FN_PURE ulong
 fd_vm_context_validate( fd_vm_exec_context_t const * ctx );
 
+/* fd_vm_input_region_query returns the sub-region of the direct mapped
+   input region reserving the VM address space at offset off from the
+   start of the input region, or NULL if there is none.  The returned
+   sub-region may be updated by the caller (e.g. to remap an account
+   after a CPI).  Assumes ctx->input_regions is non-NULL. */
+
+fd_vm_input_region_t *
+fd_vm_input_region_query( fd_vm_exec_context_t const * ctx,
+                          ulong                        off );
+
+/* fd_vm_input_region_remap points the account data sub-regions of the
+   direct mapped input region back at their borrowed accounts, which
+   may have been reallocated or resized (e.g. by the callee of a CPI).
+   A sub-region maps at most the address space it reserves, the rest of
+   the data is in the spare space that follows it.  Assumes
+   ctx->input_regions is non-NULL. */
+
+void
+fd_vm_input_region_remap( fd_vm_exec_context_t * ctx );
+
 /* fd_vm_translate_vm_to_host{_const} translates a virtual memory area
    into the local address space.  ctx is the current execution context.
    vm_addr points to the region's first byte in VM address space.  sz is
@@ -40,6 +40,7 @@ struct fd_caller_account {
   ulong lamports;
   fd_pubkey_t owner;
   uchar * serialized_data;
+  ulong serialized_data_vaddr;
   ulong serialized_data_len;
   uchar executable;
   ulong rent_epoch;
@@ -193,6 +194,7 @@ fd_vm_syscall_register_ctx( fd_sbpf_syscalls_t *       syscalls,
   bool blake3_syscall_enabled               = false;
   bool curve25519_syscall_enabled           = false;
   bool enable_poseidon_syscall              = false;
+  bool enable_alt_bn128_syscall             = false;
   bool enable_alt_bn128_compression_syscall = false;
   /* disable */
   bool disable_fees_sysvar                  = false;
@@ -202,6 +204,7 @@ fd_vm_syscall_register_ctx( fd_sbpf_syscalls_t *       syscalls,
     blake3_syscall_enabled               = FD_FEATURE_ACTIVE( slot_ctx, blake3_syscall_enabled );
     curve25519_syscall_enabled           = FD_FEATURE_ACTIVE( slot_ctx, curve25519_syscall_enabled );
     enable_poseidon_syscall              = FD_FEATURE_ACTIVE( slot_ctx, enable_poseidon_syscall );
+    enable_alt_bn128_syscall             = FD_FEATURE_ACTIVE( slot_ctx, enable_alt_bn128_syscall );
     enable_alt_bn128_compression_syscall = FD_FEATURE_ACTIVE( slot_ctx, enable_alt_bn128_compression_syscall );
     /* disable */
     disable_fees_sysvar                  = !FD_FEATURE_ACTIVE( slot_ctx, disable_fees_sysvar );
@@ -211,6 +214,7 @@ fd_vm_syscall_register_ctx( fd_sbpf_syscalls_t *       syscalls,
     blake3_syscall_enabled               = true;
     curve25519_syscall_enabled           = true;
     enable_poseidon_syscall              = true;
+    enable_alt_bn128_syscall             = true;
     enable_alt_bn128_compression_syscall = true;
   }
 
@@ -260,7 +264,9 @@ fd_vm_syscall_register_ctx( fd_sbpf_syscalls_t *       syscalls,
   }
   // NOTE: sol_curve_pairing_map is defined but never implemented / used, we can ignore it for now
   // fd_vm_register_syscall( syscalls, "sol_curve_pairing_map",                 fd_vm_syscall_sol_curve_pairing_map );
-  fd_vm_register_syscall( syscalls, "sol_alt_bn128_group_op",                fd_vm_syscall_sol_alt_bn128_group_op );
+  if( enable_alt_bn128_syscall ) {
+    fd_vm_register_syscall( syscalls, "sol_alt_bn128_group_op",              fd_vm_syscall_sol_alt_bn128_group_op );
+  }
   // fd_vm_register_syscall( syscalls, "sol_big_mod_exp",                       fd_vm_syscall_sol_big_mod_exp );
   // fd_vm_register_syscall( syscalls, "sol_get_epoch_rewards_sysvar",          fd_vm_syscall_sol_get_epoch_rewards_sysvar );
   if( enable_poseidon_syscall ) {
@@ -483,6 +489,92 @@ fd_vm_syscall_sol_log_data(
 
 }
 
+/* With direct mapped account data (ctx->input_regions non-NULL), an
+   operand of a memory syscall in the input region may span several
+   sub-regions, e.g. the data of an account and its realloc spare
+   space.  These are not contiguous in host memory and may differ in
+   writability, so, like Agave's *_non_contiguous helpers, the syscalls
+   then process their operands in chunks that each lie within a single
+   sub-region, translating (and checking writability of) each chunk on
+   its own. */
+
+/* fd_vm_mem_chunk_sz returns the size of the first chunk of the n>0
+   byte area at vm_addr, i.e. the part of it that lies within a single
+   input sub-region.  Returns n if vm_addr is not in the mapped part of
+   an input sub-region, the translation of the area then decides
+   whether it is valid. */
+
+static ulong
+fd_vm_mem_chunk_sz( fd_vm_exec_context_t const * ctx,
+                    ulong                        vm_addr,
+                    ulong                        n ) {
+  if( (vm_addr & FD_VM_MEM_MAP_REGION_MASK)!=FD_VM_MEM_MAP_INPUT_REGION_START ) return n;
+  ulong off = vm_addr & FD_VM_MEM_MAP_REGION_SZ;
+  fd_vm_input_region_t const * region = fd_vm_input_region_query( ctx, off );
+  if( FD_UNLIKELY( !region ) ) return n;
+  ulong region_off = off - region->vaddr_offset;
+  if( FD_UNLIKELY( region_off>=region->region_sz ) ) return n;
+  return fd_ulong_min( n, region->region_sz - region_off );
+}
+
+/* fd_vm_mem_chunk_sz_rev returns the size of the last chunk of the n>0
+   byte area ending at vm_end (exclusive).  Same conventions as
+   fd_vm_mem_chunk_sz. */
+
+static ulong
+fd_vm_mem_chunk_sz_rev( fd_vm_exec_context_t const * ctx,
+                        ulong                        vm_end,
+                        ulong                        n ) {
+  ulong vm_last = vm_end - 1UL;
+  if( (vm_last & FD_VM_MEM_MAP_REGION_MASK)!=FD_VM_MEM_MAP_INPUT_REGION_START ) return n;
+  ulong off = vm_last & FD_VM_MEM_MAP_REGION_SZ;
+  fd_vm_input_region_t const * region = fd_vm_input_region_query( ctx, off );
+  if( FD_UNLIKELY( !region ) ) return n;
+  ulong region_off = off - region->vaddr_offset;
+  if( FD_UNLIKELY( region_off>=region->region_sz ) ) return n;
+  return fd_ulong_min( n, region_off+1UL );
+}
+
+/* fd_vm_memmove_non_contiguous copies the n byte area at src_vm_addr to
+   dst_vm_addr chunk by chunk.  If dst overlaps the end of src, the
+   chunks are copied from the end backwards. */
+
+static ulong
+fd_vm_memmove_non_contiguous( fd_vm_exec_context_t * ctx,
+                              ulong                  dst_vm_addr,
+                              ulong                  src_vm_addr,
+                              ulong                  n ) {
+  int reverse = dst_vm_addr - src_vm_addr < n;
+  while( n ) {
+    ulong chunk;
+    ulong dst_chunk_addr;
+    ulong src_chunk_addr;
+    if( reverse ) {
+      chunk = fd_ulong_min( fd_vm_mem_chunk_sz_rev( ctx, dst_vm_addr+n, n ),
+                            fd_vm_mem_chunk_sz_rev( ctx, src_vm_addr+n, n ) );
+      dst_chunk_addr = dst_vm_addr + n - chunk;
+      src_chunk_addr = src_vm_addr + n - chunk;
+    } else {
+      chunk = fd_ulong_min( fd_vm_mem_chunk_sz( ctx, dst_vm_addr, n ),
+                            fd_vm_mem_chunk_sz( ctx, src_vm_addr, n ) );
+      dst_chunk_addr = dst_vm_addr;
+      src_chunk_addr = src_vm_addr;
+      dst_vm_addr   += chunk;
+      src_vm_addr   += chunk;
+    }
+
+    void *       dst_host_addr = fd_vm_translate_vm_to_host      ( ctx, dst_chunk_addr, chunk, alignof(uchar) );
+    if( FD_UNLIKELY( !dst_host_addr ) ) return FD_VM_MEM_MAP_ERR_ACC_VIO;
+
+    void const * src_host_addr = fd_vm_translate_vm_to_host_const( ctx, src_chunk_addr, chunk, alignof(uchar) );
+    if( FD_UNLIKELY( !src_host_addr ) ) return FD_VM_MEM_MAP_ERR_ACC_VIO;
+
+    memmove( dst_host_addr, src_host_addr, chunk );
+    n -= chunk;
+  }
+  return FD_VM_SYSCALL_SUCCESS;
+}
+
 ulong
 fd_vm_syscall_sol_memcpy(
     void *  _ctx,
@@ -509,6 +601,13 @@ fd_vm_syscall_sol_memcpy(
     return FD_VM_SYSCALL_SUCCESS;
   }
 
+  if( ctx->input_regions ) {
+    err = fd_vm_memmove_non_contiguous( ctx, dst_vm_addr, src_vm_addr, n );
+    if( FD_UNLIKELY( err ) ) return err;
+    *pr0 = 0;
+    return FD_VM_SYSCALL_SUCCESS;
+  }
+
   void *       dst_host_addr =
       fd_vm_translate_vm_to_host      ( ctx, dst_vm_addr, n, alignof(uchar) );
   if( FD_UNLIKELY( !dst_host_addr ) ) return FD_VM_MEM_MAP_ERR_ACC_VIO;
@@ -538,6 +637,36 @@ fd_vm_syscall_sol_memcmp(
   ulong err = fd_vm_mem_op_consume(ctx, n);
   if ( FD_UNLIKELY( err ) ) return err;
 
+  if( ctx->input_regions ) {
+    int * cmp_result_host_addr =
+        fd_vm_translate_vm_to_host( ctx, cmp_result_vm_addr, sizeof(int), alignof(int) );
+    if ( FD_UNLIKELY( !cmp_result_host_addr ) ) return FD_VM_MEM_MAP_ERR_ACC_VIO;
+
+    *pr0 = 0;
+
+    while( n ) {
+      ulong chunk = fd_ulong_min( fd_vm_mem_chunk_sz( ctx, vm_addr1, n ),
+                                  fd_vm_mem_chunk_sz( ctx, vm_addr2, n ) );
+
+      uchar const * host_addr1 = fd_vm_translate_vm_to_host_const( ctx, vm_addr1, chunk, alignof(uchar) );
+      if( FD_UNLIKELY( !host_addr1 ) ) return FD_VM_MEM_MAP_ERR_ACC_VIO;
+
+      uchar const * host_addr2 = fd_vm_translate_vm_to_host_const( ctx, vm_addr2, chunk, alignof(uchar) );
+      if( FD_UNLIKELY( !host_addr2 ) ) return FD_VM_MEM_MAP_ERR_ACC_VIO;
+
+      for( ulong i = 0; i < chunk; i++ ) {
+        if( host_addr1[i] != host_addr2[i] ) {
+          *cmp_result_host_addr = (int)host_addr1[i] - (int)host_addr2[i];
+          return FD_VM_SYSCALL_SUCCESS;
+        }
+      }
+      vm_addr1 += chunk;
+      vm_addr2 += chunk;
+      n        -= chunk;
+    }
+    return FD_VM_SYSCALL_SUCCESS;
+  }
+
   uchar const * host_addr1 =
       fd_vm_translate_vm_to_host_const( ctx, vm_addr1, n, alignof(uchar) );
   if( FD_UNLIKELY( !host_addr1 ) ) return FD_VM_MEM_MAP_ERR_ACC_VIO;
@@ -583,6 +712,21 @@ fd_vm_syscall_sol_memset(
   ulong err = fd_vm_mem_op_consume(ctx, n);
   if ( FD_UNLIKELY( err ) ) return err;
 
+  if( ctx->input_regions ) {
+    while( n ) {
+      ulong chunk = fd_vm_mem_chunk_sz( ctx, dst_vm_addr, n );
+
+      void * dst_host_addr = fd_vm_translate_vm_to_host( ctx, dst_vm_addr, chunk, alignof(uchar) );
+      if( FD_UNLIKELY( !dst_host_addr ) ) return FD_VM_MEM_MAP_ERR_ACC_VIO;
+
+      fd_memset( dst_host_addr, (int)c, chunk );
+      dst_vm_addr += chunk;
+      n           -= chunk;
+    }
+    *ret = 0;
+    return FD_VM_SYSCALL_SUCCESS;
+  }
+
   void * dst_host_addr = fd_vm_translate_vm_to_host( ctx, dst_vm_addr, n, alignof(uchar) );
   if( FD_UNLIKELY( !dst_host_addr ) ) return FD_VM_MEM_MAP_ERR_ACC_VIO;
 
@@ -607,6 +751,13 @@ fd_vm_syscall_sol_memmove(
   ulong err = fd_vm_mem_op_consume(ctx, n);
   if ( FD_UNLIKELY( err ) ) return err;
 
+  if( ctx->input_regions ) {
+    err = fd_vm_memmove_non_contiguous( ctx, dst_vm_addr, src_vm_addr, n );
+    if( FD_UNLIKELY( err ) ) return err;
+    *ret = 0;
+    return FD_VM_SYSCALL_SUCCESS;
+  }
+
   void *       dst_host_addr = fd_vm_translate_vm_to_host      ( ctx, dst_vm_addr, n, alignof(uchar) );
   if( FD_UNLIKELY( !dst_host_addr ) ) return FD_VM_MEM_MAP_ERR_ACC_VIO;
 
@@ -1071,6 +1222,65 @@ fd_vm_syscall_cpi_derive_signers( fd_vm_exec_context_t * ctx,
   CROSS PROGRAM INVOCATION HELPERS
  **********************************************************************/
 
+/* With direct mapped account data (ctx->input_regions non-NULL), the
+   caller's account data is not copied on CPI when the account info
+   points at the account's data sub-region.  Only the data past the
+   sub-region, i.e. grown into the spare space that follows it in the
+   parameter buffer, is copied.  Otherwise the data must be in the
+   parameter buffer, where it is copied like without direct mapping
+   (the parameter buffer is never reallocated by the callee).
+
+   fd_vm_cpi_data_region returns the data sub-region of acc if it
+   starts at data_vaddr, or NULL otherwise. */
+
+static fd_vm_input_region_t *
+fd_vm_cpi_data_region( fd_vm_exec_context_t *        ctx,
+                       ulong                         data_vaddr,
+                       fd_borrowed_account_t const * acc ) {
+  if( FD_UNLIKELY( (data_vaddr & FD_VM_MEM_MAP_REGION_MASK)!=FD_VM_MEM_MAP_INPUT_REGION_START ) ) return NULL;
+  ulong off = data_vaddr & FD_VM_MEM_MAP_REGION_SZ;
+  fd_vm_input_region_t * region = fd_vm_input_region_query( ctx, off );
+  if( FD_UNLIKELY( !region || region->vaddr_offset!=off || region->acct!=acc ) ) return NULL;
+  return region;
+}
+
+/* fd_vm_cpi_translate_param translates a range of the input region
+   that must lie in the parameter buffer. */
+
+static uchar *
+fd_vm_cpi_translate_param( fd_vm_exec_context_t * ctx,
+                           ulong                  vaddr,
+                           ulong                  sz,
+                           int                    write ) {
+  if( FD_UNLIKELY( (vaddr & FD_VM_MEM_MAP_REGION_MASK)!=FD_VM_MEM_MAP_INPUT_REGION_START ) ) return NULL;
+  fd_vm_input_region_t const * region = fd_vm_input_region_query( ctx, vaddr & FD_VM_MEM_MAP_REGION_SZ );
+  if( FD_UNLIKELY( !region || region->acct ) ) return NULL;
+  return (uchar *)fd_vm_translate_vm_to_host_private( ctx, vaddr, sz, write );
+}
+
+/* fd_vm_cpi_update_caller_data_direct updates the caller's view of the
+   direct mapped data of callee_acc_rec after a CPI (the sub-regions
+   have already been remapped). */
+
+static ulong
+fd_vm_cpi_update_caller_data_direct( fd_vm_exec_context_t *        ctx,
+                                     ulong                         data_vaddr,
+                                     fd_borrowed_account_t const * callee_acc_rec,
+                                     ulong                         data_len ) {
+  fd_vm_input_region_t const * region = fd_vm_cpi_data_region( ctx, data_vaddr, callee_acc_rec );
+  ulong copy_off = region ? region->address_space_reserved : 0UL;
+  if( data_len>copy_off ) {
+    /* The runtime, not the program, writes the grown data into the
+       spare space, so it is translated for reading (the spare space is
+       not writable by the program if the caller may not change the
+       account's data) */
+    uchar * caller_acc_data = fd_vm_cpi_translate_param( ctx, data_vaddr+copy_off, data_len-copy_off, 0 );
+    if( FD_UNLIKELY( !caller_acc_data ) ) return FD_VM_MEM_MAP_ERR_ACC_VIO;
+    fd_memcpy( caller_acc_data, callee_acc_rec->const_data + copy_off, data_len-copy_off );
+  }
+  return 0;
+}
+
 static ulong
 fd_vm_cpi_update_caller_account_rust( fd_vm_exec_context_t * ctx,
                                  fd_vm_rust_account_info_t const * caller_acc_info,
@@ -1112,12 +1322,15 @@ fd_vm_cpi_update_caller_account_rust( fd_vm_exec_context_t * ctx,
     FD_VM_RC_REFCELL_ALIGN );
   if( FD_UNLIKELY( !caller_acc_data_box ) ) return FD_VM_MEM_MAP_ERR_ACC_VIO;
 
-  uchar * caller_acc_data = fd_vm_translate_vm_to_host(
-    ctx,
-    caller_acc_data_box->addr,
-    caller_acc_data_box->len,
-    alignof(uchar) );
-  if( FD_UNLIKELY( !caller_acc_data ) ) return FD_VM_MEM_MAP_ERR_ACC_VIO;
+  uchar * caller_acc_data = NULL;
+  if( !ctx->input_regions ) {
+    caller_acc_data = fd_vm_translate_vm_to_host(
+      ctx,
+      caller_acc_data_box->addr,
+      caller_acc_data_box->len,
+      alignof(uchar) );
+    if( FD_UNLIKELY( !caller_acc_data ) ) return FD_VM_MEM_MAP_ERR_ACC_VIO;
+  }
 
   uchar * caller_acc_owner = fd_vm_translate_vm_to_host(
     ctx,
@@ -1131,9 +1344,10 @@ fd_vm_cpi_update_caller_account_rust( fd_vm_exec_context_t * ctx,
   }
 
   // TODO: deal with all functionality in update_caller_account
-  if (data_len == 0) {
+  if (data_len == 0 && caller_acc_data) {
    fd_memset(caller_acc_data, 0, caller_acc_data_box->len);
   }
+  ulong data_vaddr = caller_acc_data_box->addr;
   if( caller_acc_data_box->len != data_len ) {
     FD_LOG_DEBUG(( "account size mismatch while updating CPI caller account - key: %32J, caller: %lu, callee: %lu", callee_acc_pubkey, caller_acc_data_box->len, data_len ));
 
@@ -1148,6 +1362,10 @@ fd_vm_cpi_update_caller_account_rust( fd_vm_exec_context_t * ctx,
     // TODO return instruction error account data size too small.
   }
 
+  if( ctx->input_regions ) {
+    return fd_vm_cpi_update_caller_data_direct( ctx, data_vaddr, callee_acc_rec, data_len );
+  }
+
   fd_memcpy( caller_acc_data, callee_acc_rec->const_data, data_len );
 
   return 0;
@@ -1180,13 +1398,16 @@ fd_vm_cpi_update_caller_account_c( fd_vm_exec_context_t * ctx,
   if( FD_UNLIKELY( !caller_acc_lamports ) ) return FD_VM_MEM_MAP_ERR_ACC_VIO;
   *caller_acc_lamports = updated_lamports;
 
-  uchar * caller_acc_data = fd_vm_translate_vm_to_host(
-    ctx,
-    caller_acc_info->data_addr,
-    caller_acc_info->data_sz,
-    alignof(uchar)
-  );
-  if( FD_UNLIKELY( !caller_acc_data ) ) return FD_VM_MEM_MAP_ERR_ACC_VIO;
+  uchar * caller_acc_data = NULL;
+  if( !ctx->input_regions ) {
+    caller_acc_data = fd_vm_translate_vm_to_host(
+      ctx,
+      caller_acc_info->data_addr,
+      caller_acc_info->data_sz,
+      alignof(uchar)
+    );
+    if( FD_UNLIKELY( !caller_acc_data ) ) return FD_VM_MEM_MAP_ERR_ACC_VIO;
+  }
 
   uchar * caller_acc_owner = fd_vm_translate_vm_to_host(
     ctx,
@@ -1200,7 +1421,7 @@ fd_vm_cpi_update_caller_account_c( fd_vm_exec_context_t * ctx,
   }
 
   // TODO: deal with all functionality in update_caller_account
-  if (data_len == 0) {
+  if (data_len == 0 && caller_acc_data) {
    fd_memset(caller_acc_data, 0, caller_acc_info->data_sz);
   }
   if( caller_acc_info->data_sz != data_len ) {
@@ -1216,6 +1437,10 @@ fd_vm_cpi_update_caller_account_c( fd_vm_exec_context_t * ctx,
     // TODO return instruction error account data size too small.
   }
 
+  if( ctx->input_regions ) {
+    return fd_vm_cpi_update_caller_data_direct( ctx, caller_acc_info->data_addr, callee_acc_rec, data_len );
+  }
+
   fd_memcpy( caller_acc_data, callee_acc_rec->const_data, data_len );
 
   return 0;
@@ -1282,13 +1507,34 @@ fd_vm_cpi_update_callee_account( fd_vm_exec_context_t * ctx,
     // if ( FD_UNLIKELY( err1 || err2 ) ) {
     //   return 1;
     // }
-    err1 = fd_instr_borrowed_account_modify(ctx->instr_ctx, callee_acc_pubkey, caller_account->serialized_data_len, &callee_acc);
-    if (err1 != FD_ACC_MGR_SUCCESS) {
-      return 1;
+    if( ctx->input_regions ) {
+      /* Direct mapped: data in the account's sub-region is already in
+         place, data grown past it is in the parameter buffer */
+      ulong len = caller_account->serialized_data_len;
+      fd_vm_input_region_t * region = fd_vm_cpi_data_region( ctx, caller_account->serialized_data_vaddr, callee_acc );
+      ulong copy_off = region ? region->address_space_reserved : 0UL;
+      uchar const * src = NULL;
+      if( len>copy_off ) {
+        src = fd_vm_cpi_translate_param( ctx, caller_account->serialized_data_vaddr+copy_off, len-copy_off, 0 );
+        if( FD_UNLIKELY( !src ) ) return 1;
+      }
+      err1 = fd_instr_borrowed_account_modify(ctx->instr_ctx, callee_acc_pubkey, len, &callee_acc);
+      if (err1 != FD_ACC_MGR_SUCCESS) {
+        return 1;
+      }
+      callee_acc_metadata = (fd_account_meta_t *)callee_acc->meta;
+      callee_acc->meta->dlen = len;
+      fd_vm_input_region_remap( ctx );
+      if( src ) fd_memcpy( callee_acc->data+copy_off, src, len-copy_off );
+    } else {
+      err1 = fd_instr_borrowed_account_modify(ctx->instr_ctx, callee_acc_pubkey, caller_account->serialized_data_len, &callee_acc);
+      if (err1 != FD_ACC_MGR_SUCCESS) {
+        return 1;
+      }
+      callee_acc_metadata = (fd_account_meta_t *)callee_acc->meta;
+      callee_acc->meta->dlen = caller_account->serialized_data_len;
+      fd_memcpy( callee_acc->data, caller_account->serialized_data, caller_account->serialized_data_len );
     }
-    callee_acc_metadata = (fd_account_meta_t *)callee_acc->meta;
-    callee_acc->meta->dlen = caller_account->serialized_data_len;
-    fd_memcpy( callee_acc->data, caller_account->serialized_data, caller_account->serialized_data_len );
   }
 
   if (!is_disable_cpi_setting_executable_and_rent_epoch_active &&
@@ -1377,14 +1623,19 @@ from_account_info_rust(
   ulong err = fd_vm_consume_compute_meter( ctx, caller_acc_data_box->len / vm_compute_budget.cpi_bytes_per_unit );
   if ( FD_UNLIKELY( err ) ) return err;
 
-  uchar * caller_acc_data = fd_vm_translate_vm_to_host(
-    ctx,
-    caller_acc_data_box->addr,
-    caller_acc_data_box->len,
-    alignof(uchar) );
-  if( FD_UNLIKELY( !caller_acc_data ) ) return FD_VM_MEM_MAP_ERR_ACC_VIO;
+  /* Direct mapped data is resolved in fd_vm_cpi_update_callee_account */
+  uchar * caller_acc_data = NULL;
+  if( !ctx->input_regions ) {
+    caller_acc_data = fd_vm_translate_vm_to_host(
+      ctx,
+      caller_acc_data_box->addr,
+      caller_acc_data_box->len,
+      alignof(uchar) );
+    if( FD_UNLIKELY( !caller_acc_data ) ) return FD_VM_MEM_MAP_ERR_ACC_VIO;
+  }
 
   out->serialized_data = caller_acc_data;
+  out->serialized_data_vaddr = caller_acc_data_box->addr;
   out->serialized_data_len = caller_acc_data_box->len;
   out->executable = FD_FEATURE_ACTIVE( ctx->instr_ctx->slot_ctx, disable_cpi_setting_executable_and_rent_epoch ) ? 0 : account_info->executable;
   out->rent_epoch = FD_FEATURE_ACTIVE( ctx->instr_ctx->slot_ctx, disable_cpi_setting_executable_and_rent_epoch ) ? 0 : account_info->rent_epoch;
@@ -1418,14 +1669,19 @@ from_account_info_c(
   ulong err = fd_vm_consume_compute_meter( ctx, account_info->data_sz / vm_compute_budget.cpi_bytes_per_unit );
   if ( FD_UNLIKELY( err ) ) return err;
 
-  uchar * caller_acc_data = fd_vm_translate_vm_to_host(
-    ctx,
-    account_info->data_addr,
-    account_info->data_sz,
-    alignof(uchar)
-  );
+  /* Direct mapped data is resolved in fd_vm_cpi_update_callee_account */
+  uchar * caller_acc_data = NULL;
+  if( !ctx->input_regions ) {
+    caller_acc_data = fd_vm_translate_vm_to_host(
+      ctx,
+      account_info->data_addr,
+      account_info->data_sz,
+      alignof(uchar)
+    );
+  }
 
   out->serialized_data = caller_acc_data;
+  out->serialized_data_vaddr = account_info->data_addr;
   out->serialized_data_len = account_info->data_sz;
   out->executable = FD_FEATURE_ACTIVE( ctx->instr_ctx->slot_ctx, disable_cpi_setting_executable_and_rent_epoch ) ? 0 : account_info->executable;
   out->rent_epoch = FD_FEATURE_ACTIVE( ctx->instr_ctx->slot_ctx, disable_cpi_setting_executable_and_rent_epoch ) ? 0 : account_info->rent_epoch;
@@ -1640,6 +1896,7 @@ fd_vm_syscall_cpi_c(
 
   ctx->instr_ctx->txn_ctx->compute_meter = ctx->compute_meter;
   err_exec = fd_execute_instr( ctx->instr_ctx->txn_ctx, cpi_instr );
+  if( ctx->input_regions ) fd_vm_input_region_remap( ctx );
   ulong instr_exec_res = (ulong)err_exec;
   // uchar * sig = (uchar *)ctx->instr_ctx->txn_ctx->_txn_raw->raw + ctx->instr_ctx->txn_ctx->txn_descriptor->signature_off;
   // FD_LOG_WARNING(( "CPI CUs CONSUMED: %lu %lu %lu %64J", ctx->compute_meter, ctx->instr_ctx->txn_ctx->compute_meter, ctx->compute_meter - ctx->instr_ctx->txn_ctx->compute_meter, sig));
@@ -1814,6 +2071,7 @@ fd_vm_syscall_cpi_rust(
   
   ctx->instr_ctx->txn_ctx->compute_meter = ctx->compute_meter;
   err_exec = fd_execute_instr( ctx->instr_ctx->txn_ctx, cpi_instr );
+  if( ctx->input_regions ) fd_vm_input_region_remap( ctx );
   ulong instr_exec_res = (ulong)err_exec;
   #ifdef VLOG
   uchar * sig = (uchar *)ctx->instr_ctx->txn_ctx->_txn_raw->raw + ctx->instr_ctx->txn_ctx->txn_descriptor->signature_off;
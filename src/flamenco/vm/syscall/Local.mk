@@ -7,4 +7,7 @@ $(call add-objs,fd_vm_secp256k1,fd_flamenco)
 
 $(call make-unit-test,test_vm_syscalls_curve25519,test_vm_syscalls_curve25519,fd_flamenco fd_funk fd_ballet fd_util)
 $(call run-unit-test,test_vm_syscalls_curve25519)
+
+$(call make-unit-test,test_vm_syscalls_alt_bn128,test_vm_syscalls_alt_bn128,fd_flamenco fd_funk fd_ballet fd_util)
+$(call run-unit-test,test_vm_syscalls_alt_bn128)
 endif
@@ -1,16 +1,118 @@
 #include "fd_vm_alt_bn128.h"
+#include "../../../ballet/bn254/fd_bn254.h"
+
+/* https://github.com/solana-labs/solana/blob/v1.17.17/sdk/program/src/alt_bn128/mod.rs */
+
+#define FD_VM_ALT_BN128_ADD     (0UL)
+#define FD_VM_ALT_BN128_SUB     (1UL)
+#define FD_VM_ALT_BN128_MUL     (2UL)
+#define FD_VM_ALT_BN128_PAIRING (3UL)
+
+#define FD_VM_ALT_BN128_ADDITION_INPUT_LEN        (128UL)
+#define FD_VM_ALT_BN128_MULTIPLICATION_INPUT_LEN  (128UL)
+#define FD_VM_ALT_BN128_ADDITION_OUTPUT_LEN       ( 64UL)
+#define FD_VM_ALT_BN128_MULTIPLICATION_OUTPUT_LEN ( 64UL)
+#define FD_VM_ALT_BN128_PAIRING_OUTPUT_LEN        ( 32UL)
+
+/* AltBn128Error::InvalidInputData, returned in r0 for any invalid
+   input (the syscall itself succeeds) */
+
+#define FD_VM_ALT_BN128_ERR_INVALID_INPUT_DATA (1UL)
 
 ulong
 fd_vm_syscall_sol_alt_bn128_group_op(
-    FD_PARAM_UNUSED void *  _ctx,
-    FD_PARAM_UNUSED ulong   params,
-    FD_PARAM_UNUSED ulong   endianness,
-    FD_PARAM_UNUSED ulong   vals_addr,
-    FD_PARAM_UNUSED ulong   vals_len,
-    FD_PARAM_UNUSED ulong   result_addr,
-    FD_PARAM_UNUSED ulong * pr0
+    void *  _ctx,
+    ulong   group_op,
+    ulong   input_addr,
+    ulong   input_sz,
+    ulong   result_addr,
+    FD_PARAM_UNUSED ulong r5,
+    ulong * pr0
 ) {
-  return FD_VM_SYSCALL_ERR_INVAL;
+
+  fd_vm_exec_context_t * ctx = (fd_vm_exec_context_t *) _ctx;
+
+  /* https://github.com/solana-labs/solana/blob/v1.17.17/programs/bpf_loader/src/syscalls/mod.rs#L1526-L1554 */
+
+  ulong cost;
+  ulong output_sz;
+  switch( group_op ) {
+  case FD_VM_ALT_BN128_ADD:
+    cost      = vm_compute_budget.alt_bn128_addition_cost;
+    output_sz = FD_VM_ALT_BN128_ADDITION_OUTPUT_LEN;
+    break;
+  case FD_VM_ALT_BN128_MUL:
+    cost      = vm_compute_budget.alt_bn128_multiplication_cost;
+    output_sz = FD_VM_ALT_BN128_MULTIPLICATION_OUTPUT_LEN;
+    break;
+  case FD_VM_ALT_BN128_PAIRING: {
+    ulong elem_cnt = input_sz / FD_BN254_PAIRING_ELEMENT_FOOTPRINT;
+    cost = fd_ulong_sat_add( vm_compute_budget.alt_bn128_pairing_one_pair_cost_first,
+           fd_ulong_sat_mul( vm_compute_budget.alt_bn128_pairing_one_pair_cost_other, fd_ulong_sat_sub( elem_cnt, 1UL ) ) );
+    cost = fd_ulong_sat_add( cost, vm_compute_budget.sha256_base_cost );
+    cost = fd_ulong_sat_add( cost, input_sz );
+    cost = fd_ulong_sat_add( cost, FD_VM_ALT_BN128_PAIRING_OUTPUT_LEN );
+    output_sz = FD_VM_ALT_BN128_PAIRING_OUTPUT_LEN;
+    break;
+  }
+  default:
+    /* SyscallError::InvalidAttribute (this includes the unimplemented
+       FD_VM_ALT_BN128_SUB) */
+    return FD_VM_SYSCALL_ERR_INVAL;
+  }
+
+  ulong err = fd_vm_consume_compute_meter( ctx, cost );
+  if( FD_UNLIKELY( err ) ) return err;
+
+  /* https://github.com/solana-labs/solana/blob/v1.17.17/programs/bpf_loader/src/syscalls/mod.rs#L1558-L1571 */
+
+  uchar const * input = fd_vm_translate_vm_to_host_const( ctx, input_addr, input_sz, alignof(uchar) );
+  if( FD_UNLIKELY( !input && input_sz ) ) return FD_VM_MEM_MAP_ERR_ACC_VIO;
+  uchar * result = fd_vm_translate_vm_to_host( ctx, result_addr, output_sz, alignof(uchar) );
+  if( FD_UNLIKELY( !result ) ) return FD_VM_MEM_MAP_ERR_ACC_VIO;
+
+  /* https://github.com/solana-labs/solana/blob/v1.17.17/sdk/program/src/alt_bn128/mod.rs#L150-L270
+
+     Short addition and multiplication inputs are zero padded.  The
+     result is only written on success. */
+
+  *pr0 = FD_VM_ALT_BN128_ERR_INVALID_INPUT_DATA;
+
+  switch( group_op ) {
+  case FD_VM_ALT_BN128_ADD: {
+    if( FD_UNLIKELY( input_sz>FD_VM_ALT_BN128_ADDITION_INPUT_LEN ) ) return FD_VM_SYSCALL_SUCCESS;
+    fd_bn254_point_g1_t x[2] = {0};
+    fd_memcpy( x, input, input_sz );
+    fd_bn254_point_g1_t z[1];
+    if( FD_UNLIKELY( !fd_bn254_g1_add( x, x+1, z ) ) ) return FD_VM_SYSCALL_SUCCESS;
+    fd_memcpy( result, z->v, FD_VM_ALT_BN128_ADDITION_OUTPUT_LEN );
+    break;
+  }
+  case FD_VM_ALT_BN128_MUL: {
+    if( FD_UNLIKELY( input_sz>FD_VM_ALT_BN128_MULTIPLICATION_INPUT_LEN ) ) return FD_VM_SYSCALL_SUCCESS;
+    uchar buf[ FD_VM_ALT_BN128_MULTIPLICATION_INPUT_LEN ] = {0};
+    fd_memcpy( buf, input, input_sz );
+    fd_bn254_point_g1_t x[1];
+    fd_bn254_bigint_t   s[1];
+    fd_memcpy( x->v, buf,                       FD_BN254_G1_FOOTPRINT     );
+    fd_memcpy( s->v, buf+FD_BN254_G1_FOOTPRINT, FD_BN254_BIGINT_FOOTPRINT );
+    fd_bn254_point_g1_t z[1];
+    if( FD_UNLIKELY( !fd_bn254_g1_mult( x, s, z ) ) ) return FD_VM_SYSCALL_SUCCESS;
+    fd_memcpy( result, z->v, FD_VM_ALT_BN128_MULTIPLICATION_OUTPUT_LEN );
+    break;
+  }
+  case FD_VM_ALT_BN128_PAIRING: {
+    /* Trailing bytes that do not form a whole element are ignored */
+    int res = fd_bn254_pairing_batch( input, input_sz / FD_BN254_PAIRING_ELEMENT_FOOTPRINT );
+    if( FD_UNLIKELY( res<0 ) ) return FD_VM_SYSCALL_SUCCESS;
+    fd_memset( result, 0, FD_VM_ALT_BN128_PAIRING_OUTPUT_LEN );
+    result[ FD_VM_ALT_BN128_PAIRING_OUTPUT_LEN-1UL ] = (uchar)res;
+    break;
+  }
+  }
+
+  *pr0 = 0UL;
+  return FD_VM_SYSCALL_SUCCESS;
 }
 
 ulong
@@ -1,8 +1,21 @@
 #include "fd_vm_poseidon.h"
+#include "../../../ballet/bn254/fd_poseidon.h"
+
+/* PoseidonSyscallError codes returned in r0 when the inputs cannot be
+   hashed (the syscall itself succeeds)
+   https://github.com/solana-labs/solana/blob/v1.17.17/sdk/program/src/poseidon.rs#L10-L36 */
+
+#define FD_VM_POSEIDON_ERR_EMPTY_INPUT               ( 4UL)
+#define FD_VM_POSEIDON_ERR_INVALID_INPUT_LENGTH      ( 5UL)
+#define FD_VM_POSEIDON_ERR_INPUT_LARGER_THAN_MODULUS ( 7UL)
+#define FD_VM_POSEIDON_ERR_INVALID_WIDTH_CIRCOM      (11UL)
+
+/* https://github.com/solana-labs/solana/blob/v1.17.17/program-runtime/src/compute_budget.rs#L281-L288 */
 
 static int
 poseidon_cost( ulong   input_cnt,
-               ulong   cost_coefficient,
+               ulong   cost_coefficient_a,
+               ulong   cost_coefficient_c,
                ulong * cost_out ) {
 
   ulong input_sq;
@@ -10,10 +23,10 @@ poseidon_cost( ulong   input_cnt,
     return 0;
 
   ulong mul_result;
-  if( FD_UNLIKELY( __builtin_umull_overflow( cost_coefficient, input_sq, &mul_result ) ) )
+  if( FD_UNLIKELY( __builtin_umull_overflow( cost_coefficient_a, input_sq, &mul_result ) ) )
     return 0;
 
-  if( FD_UNLIKELY( __builtin_uaddl_overflow( mul_result, input_cnt, cost_out ) ) )
+  if( FD_UNLIKELY( __builtin_uaddl_overflow( mul_result, cost_coefficient_c, cost_out ) ) )
     return 0;
 
   return 1;
@@ -64,7 +77,7 @@ fd_vm_syscall_sol_poseidon(
   /* https://github.com/solana-labs/solana/blob/v1.17.17/programs/bpf_loader/src/syscalls/mod.rs#L1743-L1750 */
 
   ulong cost;
-  if( FD_UNLIKELY( !poseidon_cost( vals_len, 1UL, &cost ) ) ) {
+  if( FD_UNLIKELY( !poseidon_cost( vals_len, vm_compute_budget.poseidon_cost_coefficient_a, vm_compute_budget.poseidon_cost_coefficient_c, &cost ) ) ) {
     /* TODO Log: "Overflow while calculating the compute cost" */
     return FD_VM_SYSCALL_ERR_INVAL;
   }
@@ -89,14 +102,44 @@ fd_vm_syscall_sol_poseidon(
       fd_vm_translate_vm_to_host_const( ctx, vals_addr, slices_sz, FD_VM_VEC_ALIGN );
   if( FD_UNLIKELY( !slices ) ) return FD_VM_MEM_MAP_ERR_ACC_VIO;
 
-  /* At this point, Solana Labs allocates a vector of translated slices.
-     Ideally, we'd do this in O(1) allocs by doing incremental hashing
-     and translating as we go (see sha256 syscall).  However, the
-     poseidon API in ballet doesn't support incremental hashing yet.
+  /* Translate every input before hashing, like Solana Labs does, so
+     that a bad slice is an access violation even if an earlier input
+     is invalid. */
+
+  uchar const * inputs[ FD_POSEIDON_MAX_INPUT_CNT ];
+  for( ulong i=0UL; i<vals_len; i++ ) {
+    inputs[ i ] = fd_vm_translate_vm_to_host_const( ctx, slices[ i ].addr, slices[ i ].len, alignof(uchar) );
+    if( FD_UNLIKELY( !inputs[ i ] && slices[ i ].len ) ) return FD_VM_MEM_MAP_ERR_ACC_VIO;
+  }
 
-     TODO Implement! */
+  /* https://github.com/solana-labs/solana/blob/v1.17.17/sdk/program/src/poseidon.rs#L250-L281
 
-  FD_LOG_WARNING(( "Poseidon input parsing not yet implemented" ));
+     Errors are returned in r0, in the order light-poseidon checks
+     them. */
+
+  if( FD_UNLIKELY( !vals_len ) ) {
+    *pr0 = FD_VM_POSEIDON_ERR_INVALID_WIDTH_CIRCOM;
+    return FD_VM_SYSCALL_SUCCESS;
+  }
+
+  fd_poseidon_t pos[1];
+  fd_poseidon_init( pos, endianness==0UL /* Endianness::BigEndian */ );
+  for( ulong i=0UL; i<vals_len; i++ ) {
+    ulong sz = slices[ i ].len;
+    if( FD_UNLIKELY( !sz ) ) {
+      *pr0 = FD_VM_POSEIDON_ERR_EMPTY_INPUT;
+      return FD_VM_SYSCALL_SUCCESS;
+    }
+    if( FD_UNLIKELY( sz>32UL ) ) {
+      *pr0 = FD_VM_POSEIDON_ERR_INVALID_INPUT_LENGTH;
+      return FD_VM_SYSCALL_SUCCESS;
+    }
+    if( FD_UNLIKELY( !fd_poseidon_append( pos, inputs[ i ], sz ) ) ) {
+      *pr0 = FD_VM_POSEIDON_ERR_INPUT_LARGER_THAN_MODULUS;
+      return FD_VM_SYSCALL_SUCCESS;
+    }
+  }
 
-  return FD_VM_SYSCALL_ERR_INVAL;
+  fd_poseidon_fini( pos, hash_result );
+  return FD_VM_SYSCALL_SUCCESS;
 }
@@ -0,0 +1,267 @@
+#include "../fd_vm_context.h"
+#include "../fd_vm_syscalls.h"
+#include "../fd_vm_cpi.h"
+#include "fd_vm_alt_bn128.h"
+#include "fd_vm_poseidon.h"
+#include "../../../ballet/bn254/fd_poseidon.h"
+
+#define HEAP_ADDR(off) (FD_VM_MEM_MAP_HEAP_REGION_START+(off))
+
+static void
+log_bench( char const * descr,
+           ulong        iter,
+           long         dt,
+           ulong        cu ) {
+  float khz = 1e6f *(float)iter/(float)dt;
+  float tau = (float)dt /(float)iter;
+  FD_LOG_NOTICE(( "%-31s %11.3fK/s/core %10.3f ns/call %6lu CU %8.3f ns/CU",
+                  descr, (double)khz, (double)tau, cu, (double)(tau/(float)cu) ));
+}
+
+/* test_alt_bn128 runs the group_op syscall on the sz bytes at input,
+   copied to the start of the heap, with the result right after it, and
+   checks the return code, r0, the CUs consumed and, on success, the
+   result. */
+
+static void
+test_alt_bn128( fd_vm_exec_context_t * vm_ctx,
+                ulong                  group_op,
+                uchar const *          input,
+                ulong                  input_sz,
+                ulong                  expected_syscall_ret,
+                ulong                  expected_ret_code,
+                ulong                  expected_cu,
+                uchar const *          expected_result,
+                ulong                  expected_result_sz ) {
+  fd_memcpy( vm_ctx->heap, input, input_sz );
+  fd_memset( vm_ctx->heap+input_sz, 0xaa, 64UL );
+  vm_ctx->compute_meter = 1000000UL;
+
+  ulong ret_code    = ULONG_MAX;
+  ulong syscall_ret = fd_vm_syscall_sol_alt_bn128_group_op( (void *)vm_ctx, group_op, HEAP_ADDR( 0UL ), input_sz, HEAP_ADDR( input_sz ), 0UL, &ret_code );
+  FD_TEST( syscall_ret==expected_syscall_ret );
+  if( syscall_ret ) return;
+  FD_TEST( ret_code==expected_ret_code );
+  FD_TEST( 1000000UL-vm_ctx->compute_meter==expected_cu );
+  if( !ret_code ) FD_TEST( fd_memeq( vm_ctx->heap+input_sz, expected_result, expected_result_sz ) );
+  else            FD_TEST( vm_ctx->heap[ input_sz ]==0xaa ); /* result untouched */
+}
+
+/* test_poseidon hashes the cnt inputs at input, each of sz[i] bytes,
+   with the poseidon syscall. */
+
+static void
+test_poseidon( fd_vm_exec_context_t * vm_ctx,
+               ulong                  endianness,
+               uchar const *          input,
+               ulong const *          sz,
+               ulong                  cnt,
+               ulong                  expected_ret_code,
+               uchar const *          expected_result ) {
+  fd_vm_vec_t * slices = (fd_vm_vec_t *)vm_ctx->heap;
+  ulong off = 512UL;
+  for( ulong i=0UL; i<cnt; i++ ) {
+    fd_memcpy( vm_ctx->heap+off, input, sz[ i ] );
+    slices[ i ].addr = HEAP_ADDR( off );
+    slices[ i ].len  = sz[ i ];
+    input += sz[ i ];
+    off   += sz[ i ];
+  }
+  vm_ctx->compute_meter = 1000000UL;
+
+  ulong ret_code    = ULONG_MAX;
+  ulong syscall_ret = fd_vm_syscall_sol_poseidon( (void *)vm_ctx, 0UL, endianness, HEAP_ADDR( 0UL ), cnt, HEAP_ADDR( off ), &ret_code );
+  FD_TEST( !syscall_ret );
+  FD_TEST( ret_code==expected_ret_code );
+  FD_TEST( 1000000UL-vm_ctx->compute_meter==61UL*cnt*cnt+542UL );
+  if( !ret_code ) FD_TEST( fd_memeq( vm_ctx->heap+off, expected_result, 32UL ) );
+}
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+
+  ulong const read_only_sz = 500UL;
+  uchar read_only_prog[read_only_sz];
+
+  static fd_vm_exec_context_t vm_ctx[1];
+  *vm_ctx = (fd_vm_exec_context_t) {
+    .read_only    = read_only_prog,
+    .read_only_sz = read_only_sz,
+    .heap_sz      = FD_VM_DEFAULT_HEAP_SZ,
+  };
+
+  /* Test vectors of test_bn254 */
+
+  static const uchar add_in[ 128 ] = {
+    24, 177, 138, 207, 180, 194, 195, 2, 118, 219, 84, 17, 54, 142, 113, 133,
+    179, 17, 221, 18, 70, 145, 97, 12, 93, 59, 116, 3, 78, 9, 61, 201,
+    6, 60, 144, 156, 71, 32, 132, 12, 181, 19, 76, 185, 245, 159, 167, 73,
+    117, 87, 150, 129, 150, 88, 211, 46, 252, 13, 40, 129, 152, 243, 114, 102,
+    7, 194, 183, 245, 138, 132, 189, 97, 69, 240, 12, 156, 43, 192, 187, 26,
+    24, 127, 32, 255, 44, 146, 150, 58, 136, 1, 158, 124, 106, 1, 78, 237,
+    6, 97, 78, 32, 193, 71, 233, 64, 242, 215, 13, 163, 247, 76, 154, 23,
+    223, 54, 23, 6, 164, 72, 92, 116, 43, 214, 120, 132, 120, 250, 23, 215,
+  };
+  static const uchar add_out[ 64 ] = {
+    34, 67, 82, 92, 94, 253, 75, 156, 61, 60, 69, 172, 12, 163, 254, 77,
+    216, 94, 131, 10, 76, 230, 182, 95, 161, 238, 174, 226, 2, 131, 151, 3,
+    48, 29, 29, 51, 190, 109, 168, 229, 9, 223, 33, 204, 53, 150, 71, 35,
+    24, 14, 237, 117, 50, 83, 125, 185, 174, 94, 125, 72, 241, 149, 201, 21,
+  };
+  static const uchar mul_in[ 96 ] = {
+    7, 10, 141, 106, 152, 33, 83, 202, 228, 190, 41, 212, 52, 232, 250, 239,
+    138, 71, 178, 116, 160, 83, 245, 164, 238, 42, 108, 156, 19, 195, 30, 92,
+    3, 27, 140, 233, 20, 235, 163, 169, 255, 185, 137, 249, 205, 213, 176, 240,
+    25, 67, 7, 75, 244, 240, 243, 21, 105, 14, 195, 206, 198, 152, 26, 252,
+    48, 100, 78, 114, 225, 49, 160, 41, 184, 80, 69, 182, 129, 129, 88, 93,
+    151, 129, 106, 145, 104, 113, 202, 141, 60, 32, 140, 22, 216, 124, 253, 70,
+  };
+  static const uchar mul_out[ 64 ] = {
+    2, 90, 111, 65, 129, 210, 180, 234, 139, 114, 66, 144, 255, 180, 1, 86,
+    235, 10, 219, 81, 76, 104, 133, 86, 235, 121, 205, 234, 7, 82, 194, 187,
+    46, 255, 63, 49, 222, 162, 21, 241, 235, 134, 2, 58, 19, 58, 153, 110,
+    182, 48, 11, 68, 218, 102, 77, 100, 37, 29, 5, 56, 27, 184, 160, 46,
+  };
+  static const uchar pairing_in[ 384 ] = {
+    28, 118, 71, 111, 77, 239, 75, 185, 69, 65, 213, 126, 187, 161, 25, 51,
+    129, 255, 167, 170, 118, 173, 166, 100, 221, 49, 193, 96, 36, 196, 63, 89,
+    48, 52, 221, 41, 32, 246, 115, 226, 4, 254, 226, 129, 28, 103, 135, 69,
+    252, 129, 155, 85, 211, 233, 210, 148, 228, 92, 155, 3, 167, 106, 239, 65,
+    32, 157, 209, 94, 191, 245, 212, 108, 75, 216, 136, 229, 26, 147, 207, 153,
+    167, 50, 150, 54, 198, 53, 20, 57, 107, 74, 69, 32, 3, 163, 91, 247,
+    4, 191, 17, 202, 1, 72, 59, 250, 139, 52, 180, 53, 97, 132, 141, 40,
+    144, 89, 96, 17, 76, 138, 192, 64, 73, 175, 75, 99, 21, 164, 22, 120,
+    43, 184, 50, 74, 246, 207, 201, 53, 55, 162, 173, 26, 68, 92, 253, 12,
+    162, 167, 26, 205, 122, 196, 31, 173, 191, 147, 60, 42, 81, 190, 52, 77,
+    18, 10, 42, 76, 243, 12, 27, 249, 132, 95, 32, 198, 254, 57, 224, 126,
+    162, 204, 230, 31, 12, 155, 176, 72, 22, 95, 229, 228, 222, 135, 117, 80,
+    17, 30, 18, 159, 28, 241, 9, 119, 16, 212, 28, 74, 199, 15, 205, 250,
+    91, 162, 2, 60, 111, 241, 203, 234, 195, 34, 222, 73, 209, 182, 223, 124,
+    32, 50, 198, 26, 131, 14, 60, 23, 40, 109, 233, 70, 43, 242, 66, 252,
+    162, 136, 53, 133, 185, 56, 112, 167, 56, 83, 250, 206, 106, 107, 244, 17,
+    25, 142, 147, 147, 146, 13, 72, 58, 114, 96, 191, 183, 49, 251, 93, 37,
+    241, 170, 73, 51, 53, 169, 231, 18, 151, 228, 133, 183, 174, 243, 18, 194,
+    24, 0, 222, 239, 18, 31, 30, 118, 66, 106, 0, 102, 94, 92, 68, 121,
+    103, 67, 34, 212, 247, 94, 218, 221, 70, 222, 189, 92, 217, 146, 246, 237,
+    9, 6, 137, 208, 88, 95, 240, 117, 236, 158, 153, 173, 105, 12, 51, 149,
+    188, 75, 49, 51, 112, 179, 142, 243, 85, 172, 218, 220, 209, 34, 151, 91,
+    18, 200, 94, 165, 219, 140, 109, 235, 74, 171, 113, 128, 141, 203, 64, 143,
+    227, 209, 231, 105, 12, 67, 211, 123, 76, 230, 204, 1, 102, 250, 125, 170,
+  };
+
+  uchar zero[ 32 ] = {0};
+  uchar one [ 32 ] = {0}; one[ 31 ] = 1;
+
+  /* https://github.com/solana-labs/solana/blob/v1.17.17/programs/bpf_loader/src/syscalls/mod.rs#L1526 */
+
+  test_alt_bn128( vm_ctx, 0UL, add_in, 128UL, 0UL, 0UL, 334UL, add_out, 64UL );
+  test_alt_bn128( vm_ctx, 0UL, add_in, 129UL, 0UL, 1UL, 334UL, NULL, 0UL );     /* input too long */
+  test_alt_bn128( vm_ctx, 0UL, add_in,  64UL, 0UL, 0UL, 334UL, add_in, 64UL );  /* x + 0 */
+  test_alt_bn128( vm_ctx, 0UL, add_in,   0UL, 0UL, 0UL, 334UL, zero, 32UL );    /* 0 + 0 */
+  test_alt_bn128( vm_ctx, 2UL, mul_in,  96UL, 0UL, 0UL, 3840UL, mul_out, 64UL );
+  test_alt_bn128( vm_ctx, 3UL, pairing_in, 384UL, 0UL, 0UL, 36364UL+12121UL+85UL+384UL+32UL, one, 32UL );
+  test_alt_bn128( vm_ctx, 3UL, pairing_in, 192UL, 0UL, 0UL, 36364UL+85UL+192UL+32UL, zero, 32UL );
+  test_alt_bn128( vm_ctx, 3UL, pairing_in,   0UL, 0UL, 0UL, 36364UL+85UL+32UL, one, 32UL );
+  /* Trailing bytes that do not form a whole element are ignored */
+  test_alt_bn128( vm_ctx, 3UL, pairing_in, 100UL, 0UL, 0UL, 36364UL+85UL+100UL+32UL, one, 32UL );
+  test_alt_bn128( vm_ctx, 3UL, pairing_in, 292UL, 0UL, 0UL, 36364UL+85UL+292UL+32UL, zero, 32UL );
+  test_alt_bn128( vm_ctx, 1UL, add_in, 128UL, FD_VM_SYSCALL_ERR_INVAL, 0UL, 0UL, NULL, 0UL ); /* sub is not a valid op */
+
+  uchar bad[ 384 ];
+  fd_memcpy( bad, pairing_in, 384UL );
+  bad[ 63 ] ^= 1; /* first G1 point not on the curve */
+  test_alt_bn128( vm_ctx, 0UL, bad, 128UL, 0UL, 1UL, 334UL, NULL, 0UL );
+  test_alt_bn128( vm_ctx, 2UL, bad,  96UL, 0UL, 1UL, 3840UL, NULL, 0UL );
+  test_alt_bn128( vm_ctx, 3UL, bad, 384UL, 0UL, 1UL, 36364UL+12121UL+85UL+384UL+32UL, NULL, 0UL );
+
+  /* Not enough CUs */
+
+  fd_memcpy( vm_ctx->heap, add_in, 128UL );
+  vm_ctx->compute_meter = 333UL;
+  ulong ret_code = 0UL;
+  FD_TEST( fd_vm_syscall_sol_alt_bn128_group_op( (void *)vm_ctx, 0UL, HEAP_ADDR( 0UL ), 128UL, HEAP_ADDR( 128UL ), 0UL, &ret_code ) );
+
+  /* Poseidon, test vectors of test_poseidon */
+
+  {
+    uchar in[ 64 ];
+    fd_memset( in, 1, 32UL ); fd_memset( in+32, 2, 32UL );
+    ulong sz[ 2 ] = { 32UL, 32UL };
+    static const uchar le[ 32 ] = {
+      230, 117, 27, 127, 210, 224, 145, 185, 157, 99, 172, 7, 132, 30, 241, 130, 136,
+      166, 99, 99, 197, 198, 25, 204, 119, 97, 238, 129, 229, 172, 191, 5
+    };
+    static const uchar be[ 32 ] = {
+      13, 84, 225, 147, 143, 138, 140, 28, 125, 235, 94, 3, 85, 242, 99, 25, 32, 123,
+      132, 254, 156, 162, 206, 27, 38, 231, 53, 200, 41, 130, 25, 144
+    };
+    test_poseidon( vm_ctx, 1UL, in, sz, 1UL, 0UL, le );
+    test_poseidon( vm_ctx, 0UL, in, sz, 2UL, 0UL, be );
+
+    /* Short inputs are zero extended: 1 == 0x01 */
+    static const uchar one_one[ 32 ] = {
+      0, 122, 243, 70, 226, 211, 4, 39, 158, 121, 224, 169, 243, 2, 63, 119, 18, 148,
+      167, 138, 203, 112, 231, 63, 144, 175, 226, 124, 173, 64, 30, 129
+    };
+    uchar in1[ 33 ] = {0};
+    in1[ 31 ] = 1; in1[ 32 ] = 1;
+    ulong sz1[ 2 ] = { 32UL, 1UL };
+    test_poseidon( vm_ctx, 0UL, in1, sz1, 2UL, 0UL, one_one );
+
+    ulong sz_empty[ 2 ] = { 32UL, 0UL };
+    test_poseidon( vm_ctx, 0UL, in, sz_empty, 2UL, 4UL, NULL );
+    ulong sz_long[ 1 ] = { 33UL };
+    test_poseidon( vm_ctx, 0UL, in, sz_long, 1UL, 5UL, NULL );
+    uchar big[ 32 ]; fd_memset( big, 0xff, 32UL );
+    test_poseidon( vm_ctx, 0UL, big, sz, 1UL, 7UL, NULL );
+    test_poseidon( vm_ctx, 0UL, in, sz, 0UL, 11UL, NULL );
+  }
+
+  /* Benchmarks, per syscall, including the input translation */
+
+  struct {
+    char const *  name;
+    ulong         op;
+    uchar const * in;
+    ulong         sz;
+    ulong         iter;
+  } const bench[] = {
+    { "sol_alt_bn128_group_op(add)",     0UL, add_in,     128UL, 1000UL },
+    { "sol_alt_bn128_group_op(mul)",     2UL, mul_in,      96UL,  100UL },
+    { "sol_alt_bn128_group_op(pair 2)",  3UL, pairing_in, 384UL,   10UL },
+  };
+  for( ulong b=0UL; b<sizeof(bench)/sizeof(bench[0]); b++ ) {
+    fd_memcpy( vm_ctx->heap, bench[ b ].in, bench[ b ].sz );
+    vm_ctx->compute_meter = ULONG_MAX;
+    long dt = fd_log_wallclock();
+    for( ulong rem=bench[ b ].iter; rem; rem-- ) {
+      FD_TEST( !fd_vm_syscall_sol_alt_bn128_group_op( (void *)vm_ctx, bench[ b ].op, HEAP_ADDR( 0UL ), bench[ b ].sz, HEAP_ADDR( 512UL ), 0UL, &ret_code ) );
+    }
+    dt = fd_log_wallclock() - dt;
+    log_bench( bench[ b ].name, bench[ b ].iter, dt, (ULONG_MAX-vm_ctx->compute_meter)/bench[ b ].iter );
+  }
+
+  for( ulong cnt=1UL; cnt<=FD_POSEIDON_MAX_INPUT_CNT; cnt+=cnt==1UL ? 1UL : 5UL ) {
+    fd_vm_vec_t * slices = (fd_vm_vec_t *)vm_ctx->heap;
+    for( ulong i=0UL; i<cnt; i++ ) {
+      fd_memset( vm_ctx->heap+512UL+32UL*i, (int)i, 32UL );
+      slices[ i ].addr = HEAP_ADDR( 512UL+32UL*i );
+      slices[ i ].len  = 32UL;
+    }
+    ulong iter = 100UL;
+    vm_ctx->compute_meter = ULONG_MAX;
+    long dt = fd_log_wallclock();
+    for( ulong rem=iter; rem; rem-- ) {
+      FD_TEST( !fd_vm_syscall_sol_poseidon( (void *)vm_ctx, 0UL, 0UL, HEAP_ADDR( 0UL ), cnt, HEAP_ADDR( 1024UL ), &ret_code ) );
+    }
+    dt = fd_log_wallclock() - dt;
+    char name[ 64 ];
+    log_bench( fd_cstr_printf( name, 64UL, NULL, "sol_poseidon(%lu)", cnt ), iter, dt, (ULONG_MAX-vm_ctx->compute_meter)/iter );
+  }
+
+  FD_LOG_NOTICE(( "pass" ));
+  fd_halt();
+  return 0;
+}
@@ -0,0 +1,115 @@
+#include "fd_vm_context.h"
+
+#define INPUT_ADDR(off) (FD_VM_MEM_MAP_INPUT_REGION_START+(off))
+
+/* Tests the translation of a direct mapped input region made of a
+   parameter buffer sub-region, an account data sub-region, the realloc
+   spare space of the account and a trailing parameter buffer
+   sub-region. */
+
+static void
+test_input_regions( void ) {
+  uchar param[ 64 ];
+  uchar data [ 32 ];
+  uchar moved[ 64 ];
+  for( ulong i=0UL; i<64UL; i++ ) param[ i ] = (uchar)i;
+  for( ulong i=0UL; i<32UL; i++ ) data [ i ] = (uchar)(0x80UL+i);
+  for( ulong i=0UL; i<64UL; i++ ) moved[ i ] = (uchar)(0xc0UL+i);
+
+  fd_account_meta_t meta[1];
+  memset( meta, 0, sizeof(fd_account_meta_t) );
+  meta->dlen = 32UL;
+
+  FD_BORROWED_ACCOUNT_DECL( acc );
+  acc->const_meta = meta;
+  acc->const_data = data;
+
+  /* [0,16) param, [16,48) data, [48,64) spare, [64,80) param */
+
+  fd_vm_input_region_t regions[ 4 ] = {
+    { .vaddr_offset= 0UL, .haddr=(ulong)param,      .region_sz=16UL, .address_space_reserved=16UL, .is_writable=1, .acct=NULL },
+    { .vaddr_offset=16UL, .haddr=(ulong)data,       .region_sz=32UL, .address_space_reserved=32UL, .is_writable=0, .acct=acc  },
+    { .vaddr_offset=48UL, .haddr=(ulong)(param+16), .region_sz=16UL, .address_space_reserved=16UL, .is_writable=0, .acct=NULL },
+    { .vaddr_offset=64UL, .haddr=(ulong)(param+32), .region_sz=16UL, .address_space_reserved=16UL, .is_writable=1, .acct=NULL },
+  };
+
+  fd_vm_exec_context_t ctx[1];
+  memset( ctx, 0, sizeof(fd_vm_exec_context_t) );
+  ctx->input             = param;
+  ctx->input_sz          = 80UL;
+  ctx->input_regions     = regions;
+  ctx->input_regions_cnt = 4UL;
+
+  /* Sub-region lookup */
+
+  FD_TEST( fd_vm_input_region_query( ctx,  0UL )==regions+0 );
+  FD_TEST( fd_vm_input_region_query( ctx, 15UL )==regions+0 );
+  FD_TEST( fd_vm_input_region_query( ctx, 16UL )==regions+1 );
+  FD_TEST( fd_vm_input_region_query( ctx, 47UL )==regions+1 );
+  FD_TEST( fd_vm_input_region_query( ctx, 48UL )==regions+2 );
+  FD_TEST( fd_vm_input_region_query( ctx, 79UL )==regions+3 );
+  FD_TEST( !fd_vm_input_region_query( ctx, 80UL ) );
+
+  /* Reads and writes within a sub-region go to its host memory */
+
+  FD_TEST( fd_vm_translate_vm_to_host      ( ctx, INPUT_ADDR(  8UL ), 8UL, 1UL )==param+8  );
+  FD_TEST( fd_vm_translate_vm_to_host_const( ctx, INPUT_ADDR( 16UL ), 32UL, 1UL )==data    );
+  FD_TEST( fd_vm_translate_vm_to_host_const( ctx, INPUT_ADDR( 40UL ), 8UL, 1UL )==data+24  );
+  FD_TEST( fd_vm_translate_vm_to_host_const( ctx, INPUT_ADDR( 48UL ), 16UL, 1UL )==param+16 );
+  FD_TEST( fd_vm_translate_vm_to_host      ( ctx, INPUT_ADDR( 72UL ), 8UL, 1UL )==param+40 );
+
+  /* Writes to read-only account data and to its spare space are
+     rejected */
+
+  FD_TEST( !fd_vm_translate_vm_to_host( ctx, INPUT_ADDR( 16UL ), 1UL, 1UL ) );
+  FD_TEST( !fd_vm_translate_vm_to_host( ctx, INPUT_ADDR( 40UL ), 8UL, 1UL ) );
+  FD_TEST( !fd_vm_translate_vm_to_host( ctx, INPUT_ADDR( 48UL ), 8UL, 1UL ) );
+
+  /* Accesses spanning two sub-regions are rejected, even when both are
+     readable, as are accesses past the end of the input region */
+
+  FD_TEST( !fd_vm_translate_vm_to_host_const( ctx, INPUT_ADDR(  8UL ), 16UL, 1UL ) );
+  FD_TEST( !fd_vm_translate_vm_to_host_const( ctx, INPUT_ADDR( 40UL ), 16UL, 1UL ) );
+  FD_TEST( !fd_vm_translate_vm_to_host_const( ctx, INPUT_ADDR( 60UL ),  8UL, 1UL ) );
+  FD_TEST( !fd_vm_translate_vm_to_host_const( ctx, INPUT_ADDR( 72UL ), 16UL, 1UL ) );
+
+  regions[ 1 ].is_writable = 1;
+  FD_TEST( fd_vm_translate_vm_to_host( ctx, INPUT_ADDR( 16UL ), 32UL, 1UL )==data );
+  FD_TEST( !fd_vm_translate_vm_to_host( ctx, INPUT_ADDR( 40UL ), 16UL, 1UL ) );
+
+  /* A CPI that moves and shrinks the account: the sub-region follows
+     the account and only maps its remaining data */
+
+  acc->const_data = moved;
+  meta->dlen      = 8UL;
+  fd_vm_input_region_remap( ctx );
+  FD_TEST( regions[ 1 ].haddr==(ulong)moved );
+  FD_TEST( regions[ 1 ].region_sz==8UL );
+  FD_TEST( regions[ 1 ].address_space_reserved==32UL );
+  FD_TEST( regions[ 0 ].haddr==(ulong)param && regions[ 2 ].haddr==(ulong)(param+16) );
+  FD_TEST( fd_vm_translate_vm_to_host( ctx, INPUT_ADDR( 16UL ), 8UL, 1UL )==moved );
+  FD_TEST( !fd_vm_translate_vm_to_host_const( ctx, INPUT_ADDR( 16UL ), 9UL, 1UL ) );
+  FD_TEST( !fd_vm_translate_vm_to_host_const( ctx, INPUT_ADDR( 24UL ), 1UL, 1UL ) );
+  FD_TEST( fd_vm_input_region_query( ctx, 24UL )==regions+1 ); /* still reserved */
+
+  /* A CPI that grows the account past the reserved address space: the
+     sub-region maps the reserved part, the rest is in the spare space */
+
+  meta->dlen = 48UL;
+  fd_vm_input_region_remap( ctx );
+  FD_TEST( regions[ 1 ].region_sz==32UL );
+  FD_TEST( fd_vm_translate_vm_to_host_const( ctx, INPUT_ADDR( 16UL ), 32UL, 1UL )==moved );
+  FD_TEST( fd_vm_translate_vm_to_host_const( ctx, INPUT_ADDR( 48UL ), 16UL, 1UL )==param+16 );
+}
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+
+  test_input_regions();
+
+  FD_LOG_NOTICE(( "pass" ));
+  fd_halt();
+  return 0;
+}
@@ -0,0 +1,110 @@
+#include "fd_vm_syscalls.h"
+
+#define INPUT_ADDR(off) (FD_VM_MEM_MAP_INPUT_REGION_START+(off))
+
+/* Tests the memory syscalls on operands spanning the data of a writable
+   account and its realloc spare space, which are separate sub-regions
+   of the direct mapped input region. */
+
+static void
+test_mem_syscalls( void ) {
+  uchar param[ 64 ];
+  uchar data [ 32 ];
+  for( ulong i=0UL; i<64UL; i++ ) param[ i ] = (uchar)i;
+  for( ulong i=0UL; i<32UL; i++ ) data [ i ] = (uchar)(0x80UL+i);
+
+  fd_account_meta_t meta[1];
+  memset( meta, 0, sizeof(fd_account_meta_t) );
+  meta->dlen = 32UL;
+
+  FD_BORROWED_ACCOUNT_DECL( acc );
+  acc->const_meta = meta;
+  acc->const_data = data;
+
+  /* [0,16) param, [16,48) data, [48,64) spare, [64,80) param */
+
+  fd_vm_input_region_t regions[ 4 ] = {
+    { .vaddr_offset= 0UL, .haddr=(ulong)param,      .region_sz=16UL, .address_space_reserved=16UL, .is_writable=1, .acct=NULL },
+    { .vaddr_offset=16UL, .haddr=(ulong)data,       .region_sz=32UL, .address_space_reserved=32UL, .is_writable=1, .acct=acc  },
+    { .vaddr_offset=48UL, .haddr=(ulong)(param+16), .region_sz=16UL, .address_space_reserved=16UL, .is_writable=1, .acct=NULL },
+    { .vaddr_offset=64UL, .haddr=(ulong)(param+32), .region_sz=16UL, .address_space_reserved=16UL, .is_writable=1, .acct=NULL },
+  };
+
+  fd_vm_exec_context_t ctx[1];
+  memset( ctx, 0, sizeof(fd_vm_exec_context_t) );
+  ctx->input             = param;
+  ctx->input_sz          = 80UL;
+  ctx->input_regions     = regions;
+  ctx->input_regions_cnt = 4UL;
+  ctx->compute_meter     = ULONG_MAX;
+
+  ulong ret = 1UL;
+
+  /* memcpy of [64,80) to [40,56): the last 8 bytes of the data and the
+     first 8 bytes of the spare space */
+
+  FD_TEST( !fd_vm_syscall_sol_memcpy( ctx, INPUT_ADDR( 40UL ), INPUT_ADDR( 64UL ), 16UL, 0UL, 0UL, &ret ) );
+  FD_TEST( !ret );
+  for( ulong i=0UL; i<8UL; i++ ) {
+    FD_TEST( data [ 24UL+i ]==(uchar)(32UL+i) );
+    FD_TEST( param[ 16UL+i ]==(uchar)(40UL+i) );
+  }
+  FD_TEST( data [ 23 ]==(uchar)(0x80UL+23UL) );
+  FD_TEST( param[ 24 ]==(uchar)24UL          );
+
+  /* memset of [44,52) */
+
+  ret = 1UL;
+  FD_TEST( !fd_vm_syscall_sol_memset( ctx, INPUT_ADDR( 44UL ), 0x5aUL, 8UL, 0UL, 0UL, &ret ) );
+  FD_TEST( !ret );
+  for( ulong i=0UL; i<4UL; i++ ) {
+    FD_TEST( data [ 28UL+i ]==(uchar)0x5a );
+    FD_TEST( param[ 16UL+i ]==(uchar)0x5a );
+  }
+  FD_TEST( data [ 27 ]==(uchar)35UL );
+  FD_TEST( param[ 20 ]==(uchar)44UL );
+
+  /* memmove of [40,52) to [44,56), overlapping and so copied backwards:
+     vaddr 40+i held the bytes below before the move */
+
+  uchar before[ 12 ];
+  for( ulong i=0UL; i<8UL; i++ ) before[ i ] = data[ 24UL+i ];
+  for( ulong i=0UL; i<4UL; i++ ) before[ 8UL+i ] = param[ 16UL+i ];
+  FD_TEST( !fd_vm_syscall_sol_memmove( ctx, INPUT_ADDR( 44UL ), INPUT_ADDR( 40UL ), 12UL, 0UL, 0UL, &ret ) );
+  for( ulong i=0UL; i<4UL; i++ ) FD_TEST( data [ 28UL+i ]==before[ i     ] );
+  for( ulong i=0UL; i<8UL; i++ ) FD_TEST( param[ 16UL+i ]==before[ 4UL+i ] );
+
+  /* memcmp of [40,52) with a copy of it in [64,76), the result goes to
+     vaddr 0 */
+
+  FD_TEST( !fd_vm_syscall_sol_memcpy( ctx, INPUT_ADDR( 64UL ), INPUT_ADDR( 40UL ), 12UL, 0UL, 0UL, &ret ) );
+  int cmp;
+  param[ 18 ]++; /* vaddr 50, in the spare space */
+  FD_TEST( !fd_vm_syscall_sol_memcmp( ctx, INPUT_ADDR( 40UL ), INPUT_ADDR( 64UL ), 12UL, INPUT_ADDR( 0UL ), 0UL, &ret ) );
+  memcpy( &cmp, param, sizeof(int) );
+  FD_TEST( cmp==1 );
+  data[ 26 ]--;  /* vaddr 42, in the data */
+  FD_TEST( !fd_vm_syscall_sol_memcmp( ctx, INPUT_ADDR( 40UL ), INPUT_ADDR( 64UL ), 12UL, INPUT_ADDR( 0UL ), 0UL, &ret ) );
+  memcpy( &cmp, param, sizeof(int) );
+  FD_TEST( cmp==-1 );
+
+  /* Without a writable spare space, the part of a memcpy or memset that
+     spills over from the data is rejected */
+
+  regions[ 2 ].is_writable = 0;
+  FD_TEST( fd_vm_syscall_sol_memcpy( ctx, INPUT_ADDR( 40UL ), INPUT_ADDR( 64UL ), 16UL, 0UL, 0UL, &ret )==FD_VM_MEM_MAP_ERR_ACC_VIO );
+  FD_TEST( fd_vm_syscall_sol_memset( ctx, INPUT_ADDR( 44UL ), 0UL, 8UL, 0UL, 0UL, &ret )==FD_VM_MEM_MAP_ERR_ACC_VIO );
+  FD_TEST( !fd_vm_syscall_sol_memset( ctx, INPUT_ADDR( 44UL ), 0UL, 4UL, 0UL, 0UL, &ret ) );
+}
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+
+  test_mem_syscalls();
+
+  FD_LOG_NOTICE(( "pass" ));
+  fd_halt();
+  return 0;
+}
@@ -409,15 +409,44 @@ fd_funk_log_mem_usage( fd_funk_t * funk ) {
                   fd_smart_size( fd_funk_partvec_footprint(0U), tmp1, sizeof(tmp1) ) ));
 }
 
+/* fd_funk_tl_{reader,writer} point to the funk the calling thread is
+   in a read / write section of (NULL if none). */
+
+static FD_TL fd_funk_t const * fd_funk_tl_reader = NULL;
+static FD_TL fd_funk_t const * fd_funk_tl_writer = NULL;
+
+static void
+fd_funk_private_read_acquire( fd_funk_t * funk ) {
+  for(;;) {
+    FD_ATOMIC_FETCH_AND_ADD( &funk->read_cnt, 1UL );
+    if( FD_LIKELY( !funk->write_cnt ) ) break;
+    /* A write section is in progress or pending, let it go first */
+    FD_ATOMIC_FETCH_AND_SUB( &funk->read_cnt, 1UL );
+    while( funk->write_cnt ) FD_SPIN_PAUSE();
+  }
+  FD_COMPILER_MFENCE();
+}
+
 void
 fd_funk_start_write( fd_funk_t * funk ) {
+  if( FD_UNLIKELY( fd_funk_tl_writer==funk ) ) FD_LOG_CRIT(( "attempt to lock funky when it is already locked by this thread" ));
+
+  /* Suspend our own read section, if any, see fd_funk_start_read */
+  if( fd_funk_tl_reader==funk ) {
+    FD_COMPILER_MFENCE();
+    FD_ATOMIC_FETCH_AND_SUB( &funk->read_cnt, 1UL );
+  }
+
+  FD_ATOMIC_FETCH_AND_ADD( &funk->write_cnt, 1UL );
   register ulong oldval;
   for(;;) {
     oldval = funk->write_lock;
-    if( FD_LIKELY( FD_ATOMIC_CAS( &funk->write_lock, oldval, oldval+1U) == oldval ) ) break;
+    if( FD_LIKELY( !(oldval&1UL) ) && FD_LIKELY( !funk->read_cnt ) &&
+        FD_LIKELY( FD_ATOMIC_CAS( &funk->write_lock, oldval, oldval+1U) == oldval ) ) break;
+    /* Funk is write locked or read by someone else, wait for it */
     FD_SPIN_PAUSE();
   }
-  if( FD_UNLIKELY(oldval&1UL) ) FD_LOG_CRIT(( "attempt to lock funky when it is already locked" ));
+  fd_funk_tl_writer = funk;
   FD_COMPILER_MFENCE();
 }
 
@@ -431,6 +460,28 @@ fd_funk_end_write( fd_funk_t * funk ) {
     FD_SPIN_PAUSE();
   }
   if( FD_UNLIKELY(!(oldval&1UL)) ) FD_LOG_CRIT(( "attempt to unlock funky when it is already unlocked" ));
+  fd_funk_tl_writer = NULL;
+  FD_ATOMIC_FETCH_AND_SUB( &funk->write_cnt, 1UL );
+
+  /* Resume our own read section, if any */
+  if( fd_funk_tl_reader==funk ) fd_funk_private_read_acquire( funk );
+}
+
+void
+fd_funk_start_read( fd_funk_t * funk ) {
+  if( FD_UNLIKELY( fd_funk_tl_reader ) ) FD_LOG_CRIT(( "attempt to start a funky read section when already in one" ));
+  if( FD_UNLIKELY( fd_funk_tl_writer==funk ) ) FD_LOG_CRIT(( "attempt to start a funky read section in a write section" ));
+  fd_funk_tl_reader = funk;
+  fd_funk_private_read_acquire( funk );
+}
+
+void
+fd_funk_end_read( fd_funk_t * funk ) {
+  if( FD_UNLIKELY( fd_funk_tl_reader!=funk ) ) FD_LOG_CRIT(( "missing call to fd_funk_start_read" ));
+  if( FD_UNLIKELY( fd_funk_tl_writer==funk ) ) FD_LOG_CRIT(( "attempt to end a funky read section in a write section" ));
+  FD_COMPILER_MFENCE();
+  FD_ATOMIC_FETCH_AND_SUB( &funk->read_cnt, 1UL );
+  fd_funk_tl_reader = NULL;
 }
 
 void
@@ -168,6 +168,8 @@ struct __attribute__((aligned(FD_FUNK_ALIGN))) fd_funk_private {
   ulong seed;       /* Seed for various hashing function used under the hood, arbitrary */
   ulong cycle_tag;  /* Next cycle_tag to use, used internally for various data integrity checks */
   volatile ulong write_lock; /* Incremented at the start of a write operation, and again at the end */
+  volatile ulong read_cnt;   /* Number of threads in a read section */
+  volatile ulong write_cnt;  /* Number of threads in or waiting for a write section */
 
   /* The funk transaction map stores the details about transactions
      in preparation and their relationships to each other.  This is a
@@ -499,11 +501,32 @@ fd_funk_log_mem_usage( fd_funk_t * funk );
 
 /* APIs for marking the start and end of an operation that modifies
    the database. These should be called by the application before and
-   after doing an update. */
+   after doing an update.  If another thread is in the middle of an
+   update, fd_funk_start_write waits for it to finish, so threads
+   updating the database concurrently (e.g. replay of distinct forks)
+   are serialized.  Write sections do not nest (it is a fatal error for
+   a thread to call fd_funk_start_write while in a write section). */
 
 void fd_funk_start_write( fd_funk_t * funk );
 void fd_funk_end_write( fd_funk_t * funk );
 
+/* APIs for marking the start and end of a read section, i.e. an
+   extended period during which the calling thread (and any tpool
+   workers it dispatches work to) queries and reads records directly
+   while other threads of the same process might update the database
+   (e.g. replay of distinct forks).  While any thread is in a read
+   section, write sections of other threads wait for it to end.
+
+   A thread in a read section can itself start a write section: its
+   read section is suspended for the duration of the write section
+   (the write section then runs with no other thread reading), and it
+   is resumed once all pending write sections are done.  Hence, the
+   data a thread reads stays consistent between two of its own write
+   sections but not across them.  Read sections do not nest. */
+
+void fd_funk_start_read( fd_funk_t * funk );
+void fd_funk_end_read( fd_funk_t * funk );
+
 /* Checks that we are inside a start_write/end_write block. Fails if
  * we are not. */
 
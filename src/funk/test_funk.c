@@ -91,6 +91,15 @@ main( int     argc,
 
   FD_TEST( !fd_funk_verify( funk ) );
 
+  /* A write section suspends the read section of the same thread */
+
+  FD_TEST( !funk->read_cnt && !funk->write_cnt && !(funk->write_lock&1UL) );
+  fd_funk_start_read ( funk ); FD_TEST(  funk->read_cnt==1UL && !funk->write_cnt     && !(funk->write_lock&1UL) );
+  fd_funk_start_write( funk ); FD_TEST( !funk->read_cnt      &&  funk->write_cnt==1UL &&  (funk->write_lock&1UL) );
+  fd_funk_check_write( funk );
+  fd_funk_end_write  ( funk ); FD_TEST(  funk->read_cnt==1UL && !funk->write_cnt     && !(funk->write_lock&1UL) );
+  fd_funk_end_read   ( funk ); FD_TEST( !funk->read_cnt      && !funk->write_cnt     && !(funk->write_lock&1UL) );
+
   FD_TEST( !fd_funk_leave( NULL )         ); /* Not a join */
   FD_TEST(  fd_funk_leave( funk )==shfunk );
 
@@ -164,9 +164,19 @@ void
 fd_tile_private_boot( int *    pargc,
                       char *** pargv );
 
+/* fd_tile_private_map_boot boots a thread group of tile_cnt tiles with
+   tile tile_idx running on cpu tile_to_cpu[ tile_idx ] (65535 for
+   floating).  If tile_stack is non-NULL and tile_stack[ tile_idx ] is
+   non-NULL for a tile_idx in [1,tile_cnt), that tile runs on the caller
+   provided stack of FD_TILE_PRIVATE_STACK_SZ bytes (e.g. one created
+   before the caller was sandboxed, which must have guard regions and
+   remain valid until the thread group is halted).  Otherwise, a stack
+   is created as described in fd_tile_private_stack_new. */
+
 void
-fd_tile_private_map_boot( ushort * tile_to_cpu,
-                          ulong    tile_cnt );
+fd_tile_private_map_boot( ushort *       tile_to_cpu,
+                          void * const * tile_stack,
+                          ulong          tile_cnt );
 
 void
 fd_tile_private_halt( void );
@@ -235,8 +235,9 @@ struct fd_tile_private_manager_args {
   ulong               id;
   ulong               idx;
   ulong               cpu_idx;
-  void *              stack;    /* NULL if pthread created, non-NULL if user created */
+  void *              stack;     /* NULL if pthread created, non-NULL if user created */
   ulong               stack_sz;
+  int                 stack_own; /* 1 if created by map_boot (deleted on halt), 0 otherwise */
   fd_tile_private_t * tile;
 };
 
@@ -262,10 +263,11 @@ fd_tile_private_manager( void * _args ) {
   }
 # endif /* !__GLIBC__ */
 
-  ulong  id       = args->id;
-  ulong  idx      = args->idx;
-  void * stack    = args->stack;
-  ulong  stack_sz = args->stack_sz;
+  ulong  id        = args->id;
+  ulong  idx       = args->idx;
+  void * stack     = args->stack;
+  ulong  stack_sz  = args->stack_sz;
+  int    stack_own = args->stack_own;
 
   if( FD_UNLIKELY( !( (id ==fd_log_thread_id()                                       ) &
                       (idx==(id-fd_tile_private_id0)                                 ) &
@@ -345,7 +347,7 @@ fd_tile_private_manager( void * _args ) {
 
   FD_COMPILER_MFENCE();
   FD_VOLATILE( tile->state ) = FD_TILE_PRIVATE_STATE_BOOT;
-  return stack;
+  return stack_own ? stack : NULL;
 }
 
 /* Dispatch side APIs ************************************************/
@@ -526,8 +528,9 @@ fd_tile_private_cpus_parse( char const * cstr,
 static fd_tile_private_cpu_config_t fd_tile_private_cpu_config_save[1];
 
 void
-fd_tile_private_map_boot( ushort * tile_to_cpu,
-                          ulong    tile_cnt ) {
+fd_tile_private_map_boot( ushort *       tile_to_cpu,
+                          void * const * tile_stack,
+                          ulong          tile_cnt ) {
   fd_tile_private_id0 = fd_log_thread_id();
   fd_tile_private_id1 = fd_tile_private_id0 + tile_cnt;
   fd_tile_private_cnt = tile_cnt;
@@ -593,13 +596,16 @@ fd_tile_private_map_boot( ushort * tile_to_cpu,
 
     int optimize = FD_HAS_X86 & fixed;
 
-    void * stack = fd_tile_private_stack_new( optimize, cpu_idx );
+    void * stack     = tile_stack ? tile_stack[ tile_idx ] : NULL;
+    int    stack_own = !stack;
+    if( stack_own ) stack = fd_tile_private_stack_new( optimize, cpu_idx );
     if( FD_LIKELY( stack ) ) {
       err = pthread_attr_setstack( attr, stack, FD_TILE_PRIVATE_STACK_SZ );
       if( FD_UNLIKELY( err ) ) {
         FD_LOG_WARNING(( "fd_tile: pthread_attr_setstack failed (%i-%s)\n\t", err, fd_io_strerror( err ) ));
-        fd_tile_private_stack_delete( stack );
-        stack = NULL;
+        if( stack_own ) fd_tile_private_stack_delete( stack );
+        stack     = NULL;
+        stack_own = 0;
       }
     }
 
@@ -618,12 +624,13 @@ fd_tile_private_map_boot( ushort * tile_to_cpu,
 
     fd_tile_private_manager_args_t args[1];
 
-    FD_VOLATILE( args->id       ) = fd_tile_private_id0 + tile_idx;
-    FD_VOLATILE( args->idx      ) = tile_idx;
-    FD_VOLATILE( args->cpu_idx  ) = cpu_idx;
-    FD_VOLATILE( args->stack    ) = stack;
-    FD_VOLATILE( args->stack_sz ) = stack_sz;
-    FD_VOLATILE( args->tile     ) = NULL;
+    FD_VOLATILE( args->id        ) = fd_tile_private_id0 + tile_idx;
+    FD_VOLATILE( args->idx       ) = tile_idx;
+    FD_VOLATILE( args->cpu_idx   ) = cpu_idx;
+    FD_VOLATILE( args->stack     ) = stack;
+    FD_VOLATILE( args->stack_sz  ) = stack_sz;
+    FD_VOLATILE( args->stack_own ) = stack_own;
+    FD_VOLATILE( args->tile      ) = NULL;
 
     FD_COMPILER_MFENCE();
 
@@ -740,7 +747,7 @@ fd_tile_private_boot_str( char const * cpus ) {
     tile_cnt       = 1UL;
   }
 
-  fd_tile_private_map_boot( tile_to_cpu, tile_cnt );
+  fd_tile_private_map_boot( tile_to_cpu, NULL, tile_cnt );
 }
 
 void
@@ -135,6 +135,34 @@ fd_tpool_init( void * mem,
   return tpool;
 }
 
+fd_tpool_t *
+fd_tpool_slice_init( void *             mem,
+                     fd_tpool_t const * tpool,
+                     ulong              t0,
+                     ulong              t1 ) {
+
+  if( FD_UNLIKELY( !tpool ) ) {
+    FD_LOG_WARNING(( "NULL tpool" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( !((t0<t1) & (t1<=tpool->worker_cnt)) ) ) {
+    FD_LOG_WARNING(( "bad worker range" ));
+    return NULL;
+  }
+
+  fd_tpool_t * slice = fd_tpool_init( mem, t1-t0 );
+  if( FD_UNLIKELY( !slice ) ) return NULL; /* logs details */
+
+  fd_tpool_private_worker_t * const * worker       = fd_tpool_private_worker( tpool );
+  fd_tpool_private_worker_t **        slice_worker = fd_tpool_private_worker( slice );
+  for( ulong t=t0+1UL; t<t1; t++ ) slice_worker[ t-t0 ] = worker[ t ];
+  slice->worker_cnt = t1-t0;
+
+  FD_COMPILER_MFENCE();
+  return slice;
+}
+
 void *
 fd_tpool_fini( fd_tpool_t * tpool ) {
 
@@ -385,6 +413,252 @@ FD_TPOOL_EXEC_ALL_IMPL_FTR
 #undef FD_TPOOL_EXEC_ALL_IMPL_FTR
 #undef FD_TPOOL_EXEC_ALL_IMPL_HDR
 
+#if FD_HAS_ATOMIC
+
+ulong
+fd_tpool_steal_align( void ) {
+  return FD_TPOOL_STEAL_ALIGN;
+}
+
+ulong
+fd_tpool_steal_footprint( ulong worker_max ) {
+  if( FD_UNLIKELY( !((1UL<=worker_max) & (worker_max<=FD_TILE_MAX)) ) ) return 0UL;
+  return FD_TPOOL_STEAL_FOOTPRINT( worker_max );
+}
+
+fd_tpool_steal_t *
+fd_tpool_steal_init( void * mem,
+                     ulong  worker_max ) {
+
+  if( FD_UNLIKELY( !mem ) ) {
+    FD_LOG_WARNING(( "NULL mem" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( !fd_ulong_is_aligned( (ulong)mem, fd_tpool_steal_align() ) ) ) {
+    FD_LOG_WARNING(( "bad alignment" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( !fd_tpool_steal_footprint( worker_max ) ) ) {
+    FD_LOG_WARNING(( "bad worker_max" ));
+    return NULL;
+  }
+
+  /* The deques are reset by each exec_all_steal so we only need to
+     clear the header here */
+
+  fd_tpool_steal_t * steal = (fd_tpool_steal_t *)mem;
+  fd_memset( steal, 0, sizeof(fd_tpool_steal_t) );
+  steal->worker_max = worker_max;
+
+  FD_COMPILER_MFENCE();
+  return steal;
+}
+
+void *
+fd_tpool_steal_fini( fd_tpool_steal_t * steal ) {
+
+  if( FD_UNLIKELY( !steal ) ) {
+    FD_LOG_WARNING(( "NULL steal" ));
+    return NULL;
+  }
+
+  return (void *)steal;
+}
+
+/* fd_tpool_private_steal_pop pops the most recently spawned task of
+   frame from worker worker_idx's deque into task.  Returns 1 on success
+   and 0 if there are no such tasks left (they have all been popped or
+   stolen). */
+
+static inline int
+fd_tpool_private_steal_pop( fd_tpool_private_steal_deque_t * deque,
+                            fd_tpool_steal_frame_t const *   frame,
+                            fd_tpool_private_steal_task_t *  task ) {
+  if( FD_UNLIKELY( deque->bottom<=frame->base ) ) return 0;
+
+  /* The atomic decrement is a full memory fence such that thieves see
+     the new bottom before we look at top. */
+
+  long b = FD_ATOMIC_SUB_AND_FETCH( &deque->bottom, 1L );
+  long t = FD_VOLATILE_CONST( deque->top );
+
+  if( FD_LIKELY( t<b ) ) { /* More than one task left, no race with thieves */
+    *task = deque->task[ (ulong)b & (FD_TPOOL_STEAL_DEPTH-1UL) ];
+    return 1;
+  }
+
+  int success = 0;
+  if( t==b ) { /* Last task, race thieves for it */
+    *task   = deque->task[ (ulong)b & (FD_TPOOL_STEAL_DEPTH-1UL) ];
+    success = FD_ATOMIC_CAS( &deque->top, t, t+1L )==t;
+  }
+  FD_COMPILER_MFENCE();
+  FD_VOLATILE( deque->bottom ) = b+1L;
+  FD_COMPILER_MFENCE();
+  return success;
+}
+
+/* fd_tpool_private_steal_one tries to steal a task from a random other
+   worker of the current exec_all_steal and runs it on worker
+   worker_idx.  Returns 1 if a task was run and 0 otherwise. */
+
+static int
+fd_tpool_private_steal_one( fd_tpool_steal_t * steal,
+                            ulong              worker_idx ) {
+  ulong t0    = steal->t0;
+  ulong t1    = steal->t1;
+  ulong t_cnt = t1 - t0;
+  if( FD_UNLIKELY( t_cnt<2UL ) ) return 0;
+
+  fd_tpool_private_steal_deque_t * self = fd_tpool_private_steal_deque( steal, worker_idx );
+  ulong victim_idx = t0 + fd_ulong_hash( self->seed++ ) % (t_cnt-1UL);
+  victim_idx += (ulong)(victim_idx>=worker_idx);
+
+  fd_tpool_private_steal_deque_t * victim = fd_tpool_private_steal_deque( steal, victim_idx );
+
+  FD_COMPILER_MFENCE();
+  long t = FD_VOLATILE_CONST( victim->top    );
+  FD_COMPILER_MFENCE();
+  long b = FD_VOLATILE_CONST( victim->bottom );
+  FD_COMPILER_MFENCE();
+  if( t>=b ) return 0;
+
+  /* The slot is only overwritten by the owner once top has moved past
+     it, in which case the CAS below fails and the copy is discarded */
+
+  fd_tpool_private_steal_task_t task[1];
+  *task = victim->task[ (ulong)t & (FD_TPOOL_STEAL_DEPTH-1UL) ];
+  FD_COMPILER_MFENCE();
+  if( FD_UNLIKELY( FD_ATOMIC_CAS( &victim->top, t, t+1L )!=t ) ) return 0;
+
+  task->task( steal, t0,t1, task->args, task->reduce,task->stride, task->l0,task->l1, task->m0,task->m1,
+              worker_idx,worker_idx+1UL );
+
+  FD_COMPILER_MFENCE();
+  FD_ATOMIC_FETCH_AND_ADD( &task->frame->done_cnt, 1UL );
+  return 1;
+}
+
+void
+fd_tpool_steal_sync( fd_tpool_steal_t *       steal,
+                     ulong                    worker_idx,
+                     fd_tpool_steal_frame_t * frame ) {
+  fd_tpool_private_steal_deque_t * deque = fd_tpool_private_steal_deque( steal, worker_idx );
+  ulong t0 = steal->t0;
+  ulong t1 = steal->t1;
+
+  /* Run the frame's tasks that have not been stolen, most recently
+     spawned first (these are the smallest and the most likely to be
+     hot in cache). */
+
+  fd_tpool_private_steal_task_t task[1];
+  while( fd_tpool_private_steal_pop( deque, frame, task ) ) {
+    task->task( steal, t0,t1, task->args, task->reduce,task->stride, task->l0,task->l1, task->m0,task->m1,
+                worker_idx,worker_idx+1UL );
+    frame->spawn_cnt--;
+  }
+
+  /* Help the other workers until the stolen ones are done */
+
+  for(;;) {
+    FD_COMPILER_MFENCE();
+    ulong done_cnt = FD_VOLATILE_CONST( frame->done_cnt );
+    FD_COMPILER_MFENCE();
+    if( FD_LIKELY( done_cnt==frame->spawn_cnt ) ) break;
+    if( !fd_tpool_private_steal_one( steal, worker_idx ) ) FD_SPIN_PAUSE();
+  }
+}
+
+/* fd_tpool_private_steal_range runs the user's task on each element of
+   [m0,m1).  Whenever the worker's deque is empty (e.g. a thief took the
+   previous split), the rest of the range is split in half and the upper
+   half is spawned such that thieves steal the largest ranges
+   (i.e. lazy binary splitting).  When nobody is stealing, this costs a
+   check per element. */
+
+static void
+fd_tpool_private_steal_range( void * _steal,
+                              ulong  t0,     ulong t1,
+                              void * args,
+                              void * reduce, ulong stride,
+                              ulong  l0,     ulong l1,
+                              ulong  m0,     ulong m1,
+                              ulong  n0,     ulong n1 ) {
+  fd_tpool_steal_t *               steal = (fd_tpool_steal_t *)_steal;
+  fd_tpool_private_steal_deque_t * deque = fd_tpool_private_steal_deque( steal, n0 );
+  fd_tpool_task_t                  task  = steal->task;
+
+  fd_tpool_steal_frame_t frame[1];
+  fd_tpool_steal_frame_init( steal, n0, frame );
+  while( m0<m1 ) {
+    if( FD_UNLIKELY( ((m1-m0)>1UL) & (FD_VOLATILE_CONST( deque->top )>=deque->bottom) ) ) {
+      ulong ms = m0 + ((m1-m0)>>1);
+      fd_tpool_steal_spawn( steal, n0, frame, fd_tpool_private_steal_range, args, reduce,stride, l0,l1, ms,m1 );
+      m1 = ms;
+    }
+    task( _steal, t0,t1, args, reduce,stride, l0,l1, m0,m0+1UL, n0,n1 );
+    m0++;
+  }
+  fd_tpool_steal_sync( steal, n0, frame );
+}
+
+/* fd_tpool_private_steal_worker is run on each worker of an
+   exec_all_steal by exec_all_raw */
+
+static void
+fd_tpool_private_steal_worker( void * _steal,
+                               ulong  t0,     ulong t1,
+                               void * args,
+                               void * reduce, ulong stride,
+                               ulong  l0,     ulong l1,
+                               ulong  m0,     ulong m1,
+                               ulong  n0,     ulong n1 ) {
+  (void)m0; (void)m1;
+  fd_tpool_steal_t * steal = (fd_tpool_steal_t *)_steal;
+
+  ulong w0; ulong w1; FD_TPOOL_PARTITION( l0,l1,1UL, n0-t0,t1-t0, w0,w1 );
+  if( FD_LIKELY( w0<w1 ) ) fd_tpool_private_steal_range( steal, t0,t1, args, reduce,stride, l0,l1, w0,w1, n0,n1 );
+
+  /* All tasks are done once every worker's initial block is */
+
+  FD_ATOMIC_FETCH_AND_SUB( &steal->root_rem, 1UL );
+  for(;;) {
+    FD_COMPILER_MFENCE();
+    ulong root_rem = FD_VOLATILE_CONST( steal->root_rem );
+    FD_COMPILER_MFENCE();
+    if( FD_LIKELY( !root_rem ) ) break;
+    if( !fd_tpool_private_steal_one( steal, n0 ) ) FD_SPIN_PAUSE();
+  }
+}
+
+void
+fd_tpool_exec_all_steal( fd_tpool_t *       tpool,
+                         ulong              t0,          ulong t1,
+                         fd_tpool_steal_t * steal,
+                         fd_tpool_task_t    task,
+                         void *             task_args,
+                         void *             task_reduce, ulong task_stride,
+                         ulong              task_l0,     ulong task_l1 ) {
+  for( ulong t=t0; t<t1; t++ ) {
+    fd_tpool_private_steal_deque_t * deque = fd_tpool_private_steal_deque( steal, t );
+    deque->top    = 0L;
+    deque->bottom = 0L;
+    deque->seed   = t;
+  }
+  steal->task     = task;
+  steal->t0       = t0;
+  steal->t1       = t1;
+  steal->root_rem = t1-t0;
+  FD_COMPILER_MFENCE();
+
+  fd_tpool_exec_all_raw( tpool,t0,t1, fd_tpool_private_steal_worker, steal, task_args, task_reduce,task_stride,
+                         task_l0,task_l1 );
+}
+
+#endif
+
 char const *
 fd_tpool_worker_state_cstr( int state ) {
   switch( state ) {
@@ -696,6 +696,30 @@ fd_tpool_worker_push( fd_tpool_t * tpool,
 fd_tpool_t *
 fd_tpool_worker_pop( fd_tpool_t * tpool );
 
+/* fd_tpool_slice_init formats a memory region mem with the appropriate
+   alignment and footprint for a tpool of t1-t0 workers as a view of
+   workers [t0,t1) of tpool.  Worker i>0 of the view is worker t0+i of
+   tpool and worker 0 of the view is whatever thread dispatches to the
+   view (typically tpool worker t0, running a task that was dispatched
+   to it, or the tpool's worker 0 if t0 is 0).  This allows splitting a
+   tpool into disjoint slices that independent operations written
+   against the usual [0,worker_cnt) worker range can run on
+   concurrently.  Assumes 0<=t0<t1<=fd_tpool_worker_cnt( tpool ).
+
+   A slice shares its worker threads with tpool, so while a slice is in
+   use, the corresponding workers of tpool should not be dispatched to
+   directly.  Workers cannot be pushed into or popped from a slice and
+   a slice should not be fini'd (the memory region can simply be
+   discarded or reused when done with it).  Slices become invalid if the
+   workers of tpool are modified.  Returns a handle for the slice on
+   success and NULL on failure (logs details). */
+
+fd_tpool_t *
+fd_tpool_slice_init( void *             mem,
+                     fd_tpool_t const * tpool,
+                     ulong              t0,
+                     ulong              t1 );
+
 /* Accessors.  As these are used in high performance contexts, these do
    no input argument checking.  Specifically, they assume tpool is valid
    and (if applicable) worker_idx in [0,worker_cnt).  worker 0 is
@@ -921,6 +945,216 @@ fd_tpool_exec_all_taskq( fd_tpool_t *    tpool,
 }
 #endif
 
+#if FD_HAS_ATOMIC
+
+/* Work stealing ******************************************************/
+
+/* fd_tpool_exec_all_steal is functionally equivalent to
+   fd_tpool_exec_all_taskq (with the task_tpool argument of each task
+   replaced by the steal handle described below) but balances the load
+   over the worker threads with per worker Chase-Lev work stealing
+   deques instead of a single shared task counter.  Each worker starts
+   on the block of tasks fd_tpool_exec_all_block would assign to it,
+   splitting off the upper half of what is left whenever there is
+   nothing left in its deque for idle workers to steal, and then steals
+   until all the tasks are done.  This
+   is a better fit than taskq when task execution times vary widely
+   and/or the number of tasks is not huge relative to the number of
+   workers: there is no contention between workers that are busy and
+   each worker mostly runs tasks close to each other in [l0,l1).
+
+   Further, a task running under fd_tpool_exec_all_steal can spawn
+   additional tasks and wait for them to complete, which allows
+   recursive algorithms (merkle trees, sorts, dependency graphs, ...)
+   to be written naturally.  A task that spawns looks like:
+
+     static void
+     my_task( void * _steal,
+              ulong  t0,     ulong t1,
+              void * args,
+              void * reduce, ulong stride,
+              ulong  l0,     ulong l1,
+              ulong  m0,     ulong m1,
+              ulong  n0,     ulong n1 ) {
+       fd_tpool_steal_t * steal = (fd_tpool_steal_t *)_steal;
+       if( m1-m0<=LEAF_MAX ) { ... do leaf [m0,m1) on worker n0 ...; return; }
+       ulong ms = m0 + ((m1-m0)>>1);
+       fd_tpool_steal_frame_t frame[1];
+       fd_tpool_steal_frame_init( steal, n0, frame );
+       fd_tpool_steal_spawn( steal, n0, frame, my_task, args, reduce,stride, l0,l1, ms,m1 );
+       my_task( _steal, t0,t1, args, reduce,stride, l0,l1, m0,ms, n0,n1 );
+       fd_tpool_steal_sync( steal, n0, frame );
+     }
+
+   A spawned task will be called as:
+
+     task( steal, t0,t1, args, reduce,stride, l0,l1, m0,m1, n,n+1 )
+
+   where [t0,t1) is the range of workers of the fd_tpool_exec_all_steal
+   and n is the worker that ends up running the task (not necessarily
+   the one that spawned it).  Every task that spawns must sync its
+   frame before returning.  While a worker is waiting in a sync for
+   tasks that were stolen from it, it will run other tasks.
+
+   A deque holds up to FD_TPOOL_STEAL_DEPTH tasks.  If a worker's deque
+   is full, fd_tpool_steal_spawn runs the task immediately instead.  As
+   such, memory usage is bounded and nothing is allocated at run time
+   (but, as usual, stack usage grows with the recursion depth).  Tasks
+   run under work stealing should not throw.
+
+   Same restrictions on the caller as the other exec_alls.  Further,
+   steal should be a valid work stealing state with worker_max>=t1 that
+   is not in use by another fd_tpool_exec_all_steal. */
+
+#define FD_TPOOL_STEAL_DEPTH (256UL) /* Power of two */
+
+struct fd_tpool_steal_frame {
+  ulong spawn_cnt; /* Number of tasks spawned in this frame and not run by its worker */
+  ulong done_cnt;  /* Number of those that have completed, atomically incremented */
+  long  base;      /* Deque bottom when the frame was created */
+};
+
+typedef struct fd_tpool_steal_frame fd_tpool_steal_frame_t;
+
+struct fd_tpool_private_steal_task {
+  fd_tpool_task_t          task;
+  void *                   args;
+  void *                   reduce; ulong stride;
+  ulong                    l0;     ulong l1;
+  ulong                    m0;     ulong m1;
+  fd_tpool_steal_frame_t * frame;
+};
+
+typedef struct fd_tpool_private_steal_task fd_tpool_private_steal_task_t;
+
+/* top and bottom are on their own cache lines as top is modified by
+   thieves and bottom by the owner.  Tasks in [top,bottom) are in the
+   deque, task i is at task[ i & (FD_TPOOL_STEAL_DEPTH-1) ]. */
+
+struct __attribute__((aligned(128))) fd_tpool_private_steal_deque {
+  long                          top    __attribute__((aligned(128)));
+  long                          bottom __attribute__((aligned(128)));
+  ulong                         seed;  /* Owner's victim selection state */
+  fd_tpool_private_steal_task_t task[ FD_TPOOL_STEAL_DEPTH ] __attribute__((aligned(128)));
+};
+
+typedef struct fd_tpool_private_steal_deque fd_tpool_private_steal_deque_t;
+
+struct __attribute__((aligned(128))) fd_tpool_private_steal {
+  ulong           worker_max;
+  fd_tpool_task_t task;                                /* Task of the current exec_all_steal */
+  ulong           t0;       ulong t1;                  /* Workers of the current exec_all_steal */
+  ulong           root_rem __attribute__((aligned(128))); /* Workers whose initial block is not done */
+
+  /* worker_max element fd_tpool_private_steal_deque_t array here,
+     indexed by worker idx */
+};
+
+typedef struct fd_tpool_private_steal fd_tpool_steal_t;
+
+/* FD_TPOOL_STEAL_{ALIGN,FOOTPRINT} return the alignment and footprint
+   required for a memory region to be used as work stealing state for
+   up to worker_max workers.  Like FD_TPOOL_{ALIGN,FOOTPRINT}, these
+   assume worker_max is valid. */
+
+#define FD_TPOOL_STEAL_ALIGN                   (128UL)
+#define FD_TPOOL_STEAL_FOOTPRINT( worker_max ) ( sizeof(fd_tpool_steal_t)                                        \
+                                               + ((ulong)(worker_max))*sizeof(fd_tpool_private_steal_deque_t) )
+
+FD_FN_CONST static inline fd_tpool_private_steal_deque_t *
+fd_tpool_private_steal_deque( fd_tpool_steal_t const * steal,
+                              ulong                    worker_idx ) {
+  return ((fd_tpool_private_steal_deque_t *)(steal+1)) + worker_idx;
+}
+
+/* fd_tpool_steal_{align,footprint} return FD_TPOOL_STEAL_ALIGN and
+   FD_TPOOL_STEAL_FOOTPRINT( worker_max ) if worker_max is in
+   [1,FD_TILE_MAX] (0 otherwise).  fd_tpool_steal_init formats a memory
+   region with the appropriate alignment and footprint as the work
+   stealing state for fd_tpool_exec_all_steal on tpools of up to
+   worker_max workers.  Returns a handle for it on success and NULL on
+   failure (logs details).  fd_tpool_steal_fini unformats it and returns
+   the memory region (NULL on failure, logs details).  The state can be
+   reused for any number of fd_tpool_exec_all_steal calls, one at a
+   time. */
+
+FD_FN_CONST ulong fd_tpool_steal_align( void );
+FD_FN_CONST ulong fd_tpool_steal_footprint( ulong worker_max );
+
+fd_tpool_steal_t *
+fd_tpool_steal_init( void * mem,
+                     ulong  worker_max );
+
+void *
+fd_tpool_steal_fini( fd_tpool_steal_t * steal );
+
+void
+fd_tpool_exec_all_steal( fd_tpool_t *       tpool,
+                         ulong              t0,          ulong t1,
+                         fd_tpool_steal_t * steal,
+                         fd_tpool_task_t    task,
+                         void *             task_args,
+                         void *             task_reduce, ulong task_stride,
+                         ulong              task_l0,     ulong task_l1 );
+
+/* fd_tpool_steal_frame_init starts a frame of tasks to be spawned by
+   a task running on worker worker_idx.  fd_tpool_steal_spawn spawns a
+   task in the frame (see above).  fd_tpool_steal_sync waits until all
+   the tasks spawned in the frame have completed, running tasks while it
+   does so.  These should only be used by tasks running under
+   fd_tpool_exec_all_steal on the worker they were called for (i.e.
+   worker_idx is the task's n0).  As these are used in high performance
+   contexts, these do no input argument checking. */
+
+static inline fd_tpool_steal_frame_t *
+fd_tpool_steal_frame_init( fd_tpool_steal_t const * steal,
+                           ulong                    worker_idx,
+                           fd_tpool_steal_frame_t * frame ) {
+  frame->spawn_cnt = 0UL;
+  frame->done_cnt  = 0UL;
+  frame->base      = fd_tpool_private_steal_deque( steal, worker_idx )->bottom;
+  return frame;
+}
+
+static inline void
+fd_tpool_steal_spawn( fd_tpool_steal_t *       steal,
+                      ulong                    worker_idx,
+                      fd_tpool_steal_frame_t * frame,
+                      fd_tpool_task_t          task,
+                      void *                   task_args,
+                      void *                   task_reduce, ulong task_stride,
+                      ulong                    task_l0,     ulong task_l1,
+                      ulong                    task_m0,     ulong task_m1 ) {
+  fd_tpool_private_steal_deque_t * deque = fd_tpool_private_steal_deque( steal, worker_idx );
+
+  long b = deque->bottom;
+  long t = FD_VOLATILE_CONST( deque->top );
+  if( FD_UNLIKELY( (ulong)(b-t)>=FD_TPOOL_STEAL_DEPTH ) ) { /* Deque full, run it now */
+    task( steal, steal->t0,steal->t1, task_args, task_reduce,task_stride, task_l0,task_l1, task_m0,task_m1,
+          worker_idx,worker_idx+1UL );
+    return;
+  }
+
+  fd_tpool_private_steal_task_t * slot = deque->task + ((ulong)b & (FD_TPOOL_STEAL_DEPTH-1UL));
+  slot->task   = task;
+  slot->args   = task_args;
+  slot->reduce = task_reduce; slot->stride = task_stride;
+  slot->l0     = task_l0;     slot->l1     = task_l1;
+  slot->m0     = task_m0;     slot->m1     = task_m1;
+  slot->frame  = frame;
+  frame->spawn_cnt++;
+  FD_COMPILER_MFENCE();
+  FD_VOLATILE( deque->bottom ) = b+1L;
+  FD_COMPILER_MFENCE();
+}
+
+void
+fd_tpool_steal_sync( fd_tpool_steal_t *       steal,
+                     ulong                    worker_idx,
+                     fd_tpool_steal_frame_t * frame );
+
+#endif
+
 #undef FD_TPOOL_EXEC_ALL_DECL
 
 /* fd_tpool_worker_state_cstr converts an FD_TPOOL_WORKER_STATE_* code
@@ -9,6 +9,11 @@ FD_STATIC_ASSERT( FD_TPOOL_WORKER_STATE_IDLE==1, unit_test );
 FD_STATIC_ASSERT( FD_TPOOL_WORKER_STATE_EXEC==2, unit_test );
 FD_STATIC_ASSERT( FD_TPOOL_WORKER_STATE_HALT==3, unit_test );
 
+#if FD_HAS_ATOMIC
+FD_STATIC_ASSERT( FD_TPOOL_STEAL_ALIGN==128UL,                               unit_test );
+FD_STATIC_ASSERT( !(FD_TPOOL_STEAL_DEPTH & (FD_TPOOL_STEAL_DEPTH-1UL)), unit_test );
+#endif
+
 static int
 tile_self_push_main( int     argc,
                      char ** argv ) {
@@ -119,6 +124,107 @@ worker_taskq( void * tpool,
 }
 #endif
 
+#if FD_HAS_ATOMIC
+static void
+worker_steal( void * tpool,
+              ulong  t0,     ulong t1,
+              void * args,
+              void * reduce, ulong stride,
+              ulong  l0,     ulong l1,
+              ulong  m0,     ulong m1,
+              ulong  n0,     ulong n1 ) {
+  FD_TEST( m0<FD_TILE_MAX ); FD_TEST( m1==m0+1UL );
+  FD_TEST( t0<=n0 ); FD_TEST( n1==n0+1UL ); FD_TEST( n1<=t1 ); /* these are otherwise non-deterministic for steal */
+  FD_COMPILER_MFENCE();
+  FD_VOLATILE( worker_rx[ m0 ].tpool  ) = tpool;
+  FD_VOLATILE( worker_rx[ m0 ].t0     ) = t0;     FD_VOLATILE( worker_rx[ m0 ].t1     ) = t1;
+  FD_VOLATILE( worker_rx[ m0 ].args   ) = args;
+  FD_VOLATILE( worker_rx[ m0 ].reduce ) = reduce; FD_VOLATILE( worker_rx[ m0 ].stride ) = stride;
+  FD_VOLATILE( worker_rx[ m0 ].l0     ) = l0;     FD_VOLATILE( worker_rx[ m0 ].l1     ) = l1;
+  FD_VOLATILE( worker_rx[ m0 ].m0     ) = m0;     FD_VOLATILE( worker_rx[ m0 ].m1     ) = m1;
+  FD_VOLATILE( worker_rx[ m0 ].n0     ) = 0UL;    FD_VOLATILE( worker_rx[ m0 ].n1     ) = 0UL;
+  FD_COMPILER_MFENCE();
+}
+
+/* worker_steal_root counts each element of [m0*root_sz,m1*root_sz) in
+   reduce once with worker_steal_tree, which splits ranges recursively
+   and spawns each element of small ranges as a task of its own.  A
+   range of wide_sz elements is instead spawned as that many tasks in a
+   single frame (wide_sz>FD_TPOOL_STEAL_DEPTH covers full deques). */
+
+struct steal_tree {
+  ulong root_sz;
+  ulong wide_sz;
+};
+
+typedef struct steal_tree steal_tree_t;
+
+static void
+worker_steal_tree( void * _steal,
+                   ulong  t0,     ulong t1,
+                   void * args,
+                   void * reduce, ulong stride,
+                   ulong  l0,     ulong l1,
+                   ulong  m0,     ulong m1,
+                   ulong  n0,     ulong n1 ) {
+  fd_tpool_steal_t *   steal = (fd_tpool_steal_t *)_steal;
+  steal_tree_t const * tree  = (steal_tree_t const *)args;
+  FD_TEST( t0<=n0 ); FD_TEST( n1==n0+1UL ); FD_TEST( n1<=t1 );
+
+  if( m1-m0==1UL ) {
+    FD_ATOMIC_FETCH_AND_ADD( (ulong *)reduce + m0*stride, 1UL );
+    return;
+  }
+
+  fd_tpool_steal_frame_t frame[1];
+  fd_tpool_steal_frame_init( steal, n0, frame );
+  if( (m1-m0<=8UL) | (m1-m0==tree->wide_sz) ) {
+    for( ulong m=m0; m<m1; m++ ) fd_tpool_steal_spawn( steal, n0, frame, worker_steal_tree, args, reduce,stride, l0,l1, m,m+1UL );
+  } else {
+    ulong ms = m0 + ((m1-m0)>>1);
+    fd_tpool_steal_spawn( steal, n0, frame, worker_steal_tree, args, reduce,stride, l0,l1, ms,m1 );
+    worker_steal_tree( _steal, t0,t1, args, reduce,stride, l0,l1, m0,ms, n0,n1 );
+  }
+  fd_tpool_steal_sync( steal, n0, frame );
+}
+
+static void
+worker_steal_root( void * _steal,
+                   ulong  t0,     ulong t1,
+                   void * args,
+                   void * reduce, ulong stride,
+                   ulong  l0,     ulong l1,
+                   ulong  m0,     ulong m1,
+                   ulong  n0,     ulong n1 ) {
+  ulong root_sz = ((steal_tree_t const *)args)->root_sz;
+  worker_steal_tree( _steal, t0,t1, args, reduce,stride, l0,l1, m0*root_sz,m1*root_sz, n0,n1 );
+}
+
+/* worker_irregular does a task whose cost is heavy tailed: most tasks
+   take one unit of work, 1 in 32 take 32 units and 1 in 1024 take 1024
+   units (a unit is a few tens of ns), a bit like transactions whose
+   execution times span orders of magnitude. */
+
+static void
+worker_irregular( void * tpool,
+                  ulong  t0,     ulong t1,
+                  void * args,
+                  void * reduce, ulong stride,
+                  ulong  l0,     ulong l1,
+                  ulong  m0,     ulong m1,
+                  ulong  n0,     ulong n1 ) {
+  (void)tpool; (void)t0; (void)t1; (void)args; (void)l0; (void)l1; (void)n1;
+  ulong acc = 0UL;
+  for( ulong m=m0; m<m1; m++ ) {
+    ulong h    = fd_ulong_hash( m );
+    ulong cost = fd_ulong_if( !(h & 1023UL), 1024UL, fd_ulong_if( !(h & 31UL), 32UL, 1UL ) );
+    for( ulong i=0UL; i<8UL*cost; i++ ) h = fd_ulong_hash( h );
+    acc += h;
+  }
+  ((ulong *)reduce)[ n0*stride ] += acc;
+}
+#endif
+
 static void
 worker_bench( void * tpool,
               ulong  t0,     ulong t1,
@@ -435,10 +541,123 @@ main( int     argc,
     fd_tpool_exec_all_taskq( tpool,job_t0,job_t1, worker_taskq, job_tpool, job_args, job_reduce,job_stride, job_l0,job_l1 );
     FD_TEST( !memcmp( worker_tx, worker_rx, FD_TILE_MAX*sizeof(test_args_t) ) );
   }
+
+  FD_LOG_NOTICE(( "Testing fd_tpool_steal_init and fini" ));
+
+  static uchar steal_mem[ FD_TPOOL_STEAL_FOOTPRINT(FD_TILE_MAX) ] __attribute__((aligned(FD_TPOOL_STEAL_ALIGN)));
+
+  FD_TEST( fd_tpool_steal_align()==FD_TPOOL_STEAL_ALIGN );
+  for( ulong iter=0UL; iter<1000000UL; iter++ ) {
+    ulong worker_cnt = fd_rng_ulong( rng ) >> (int)(fd_rng_uint( rng ) & 63U);
+    ulong footprint  = fd_tpool_steal_footprint( worker_cnt );
+    FD_TEST( !(footprint % FD_TPOOL_STEAL_ALIGN) );
+    FD_TEST( footprint==fd_ulong_if( ((1UL<=worker_cnt) & (worker_cnt<=FD_TILE_MAX)), FD_TPOOL_STEAL_FOOTPRINT( worker_cnt ), 0UL ) );
+  }
+
+  FD_TEST( !fd_tpool_steal_init( NULL,        1UL             ) ); /* NULL mem */
+  FD_TEST( !fd_tpool_steal_init( (void *)1UL, 1UL             ) ); /* misaligned mem */
+  FD_TEST( !fd_tpool_steal_init( steal_mem,   0UL             ) ); /* bad worker_max */
+  FD_TEST( !fd_tpool_steal_init( steal_mem,   FD_TILE_MAX+1UL ) ); /* bad worker_max */
+  FD_TEST( !fd_tpool_steal_fini( NULL ) );                         /* NULL steal */
+
+  fd_tpool_steal_t * steal = fd_tpool_steal_init( steal_mem, tile_cnt ); FD_TEST( steal );
+
+  FD_LOG_NOTICE(( "Testing fd_tpool_exec_all_steal" ));
+
+  for( ulong rem=10000UL; rem; rem-- ) {
+    ulong  tmp0       = fd_rng_ulong_roll( rng, tile_cnt );
+    ulong  tmp1       = fd_rng_ulong_roll( rng, tile_cnt );
+    ulong  job_t0     = fd_ulong_min( tmp0, tmp1 );
+    ulong  job_t1     = fd_ulong_max( tmp0, tmp1 ) + 1UL;
+    void * job_args   = (void *)fd_rng_ulong( rng );
+    void * job_reduce = (void *)fd_rng_ulong( rng ); ulong  job_stride = fd_rng_ulong( rng );
+    /**/   tmp0       = fd_rng_ulong_roll( rng, FD_TILE_MAX+1UL );
+    /**/   tmp1       = fd_rng_ulong_roll( rng, FD_TILE_MAX+1UL );
+    ulong  job_l0     = fd_ulong_min( tmp0, tmp1 );
+    ulong  job_l1     = fd_ulong_max( tmp0, tmp1 );
+
+    fd_memset( worker_tx, 0, FD_TILE_MAX*sizeof(test_args_t) );
+    fd_memset( worker_rx, 0, FD_TILE_MAX*sizeof(test_args_t) );
+    for( ulong l=job_l0; l<job_l1; l++ ) {
+      worker_tx[l].tpool  = steal;
+      worker_tx[l].t0     = job_t0;     worker_tx[l].t1     = job_t1;
+      worker_tx[l].args   = job_args;
+      worker_tx[l].reduce = job_reduce; worker_tx[l].stride = job_stride;
+      worker_tx[l].l0     = job_l0;     worker_tx[l].l1     = job_l1;
+      worker_tx[l].m0     = l;          worker_tx[l].m1     = l+1UL;
+      worker_tx[l].n0     = 0UL;        worker_tx[l].n1     = 0UL;
+    }
+    fd_tpool_exec_all_steal( tpool,job_t0,job_t1, steal, worker_steal, job_args, job_reduce,job_stride, job_l0,job_l1 );
+    FD_TEST( !memcmp( worker_tx, worker_rx, FD_TILE_MAX*sizeof(test_args_t) ) );
+  }
+
+  FD_LOG_NOTICE(( "Testing fd_tpool_steal_spawn and sync" ));
+
+  do {
+    static ulong hit[ 65536UL ];
+    for( ulong rem=1000UL; rem; rem-- ) {
+      ulong tmp0     = fd_rng_ulong_roll( rng, tile_cnt );
+      ulong tmp1     = fd_rng_ulong_roll( rng, tile_cnt );
+      ulong job_t0   = fd_ulong_min( tmp0, tmp1 );
+      ulong job_t1   = fd_ulong_max( tmp0, tmp1 ) + 1UL;
+      ulong root_cnt = 1UL + fd_rng_ulong_roll( rng, 16UL );
+      ulong root_sz  = 1UL + fd_rng_ulong_roll( rng, 4096UL );
+      if( fd_rng_uint_roll( rng, 4U )==0U ) root_sz = 4UL*FD_TPOOL_STEAL_DEPTH; /* full deques */
+
+      steal_tree_t tree[1] = {{ .root_sz = root_sz, .wide_sz = 4UL*FD_TPOOL_STEAL_DEPTH }};
+      fd_memset( hit, 0, root_cnt*root_sz*sizeof(ulong) );
+      fd_tpool_exec_all_steal( tpool,job_t0,job_t1, steal, worker_steal_root, tree, hit,1UL, 0UL,root_cnt );
+      for( ulong i=0UL; i<root_cnt*root_sz; i++ ) FD_TEST( hit[ i ]==1UL );
+    }
+  } while(0);
+
+  FD_TEST( fd_tpool_steal_fini( steal )==(void *)steal_mem );
 # endif
 
   FD_TEST( fd_tpool_fini( tpool )==(void *)tpool_mem );
 
+  FD_LOG_NOTICE(( "Testing fd_tpool_slice_init" ));
+
+  tpool = fd_tpool_init( tpool_mem, tile_cnt ); FD_TEST( tpool );
+  for( ulong tile_idx=1UL; tile_idx<tile_cnt; tile_idx++ ) FD_TEST( fd_tpool_worker_push( tpool, tile_idx, NULL, 0UL )==tpool );
+
+  do {
+    static uchar slice_mem[ FD_TPOOL_FOOTPRINT(FD_TILE_MAX) ] __attribute__((aligned(FD_TPOOL_ALIGN)));
+
+    FD_TEST( !fd_tpool_slice_init( slice_mem, NULL,  0UL, 1UL          ) ); /* NULL tpool */
+    FD_TEST( !fd_tpool_slice_init( slice_mem, tpool, 0UL, 0UL          ) ); /* empty range */
+    FD_TEST( !fd_tpool_slice_init( slice_mem, tpool, 0UL, tile_cnt+1UL ) ); /* too many workers */
+    FD_TEST( !fd_tpool_slice_init( NULL,      tpool, 0UL, 1UL          ) ); /* NULL mem */
+
+    for( ulong rem=10000UL; rem; rem-- ) {
+      ulong tmp0     = fd_rng_ulong_roll( rng, tile_cnt );
+      ulong tmp1     = fd_rng_ulong_roll( rng, tile_cnt );
+      ulong slice_t0 = fd_ulong_min( tmp0, tmp1 );
+      ulong slice_t1 = fd_ulong_max( tmp0, tmp1 ) + 1UL;
+      ulong slice_cnt = slice_t1 - slice_t0;
+
+      fd_tpool_t * slice = fd_tpool_slice_init( slice_mem, tpool, slice_t0, slice_t1 ); FD_TEST( slice );
+      FD_TEST( fd_tpool_worker_cnt( slice )==slice_cnt );
+      for( ulong t=1UL; t<slice_cnt; t++ )
+        FD_TEST( fd_tpool_worker_tile_idx( slice, t )==fd_tpool_worker_tile_idx( tpool, slice_t0+t ) );
+
+      /* Dispatch to the slice from the caller (i.e. the caller plays
+         the role of the slice's worker 0) */
+
+      fd_memset( worker_tx, 0, FD_TILE_MAX*sizeof(test_args_t) );
+      for( ulong t=0UL; t<slice_cnt; t++ ) {
+        worker_tx[t].tpool  = NULL;
+        worker_tx[t].t0     = 0UL;        worker_tx[t].t1     = slice_cnt;
+        worker_tx[t].n0     = t;          worker_tx[t].n1     = t+1UL;
+      }
+      fd_memset( worker_rx, 0, FD_TILE_MAX*sizeof(test_args_t) );
+      fd_tpool_exec_all_raw( slice,0UL,slice_cnt, worker_bulk, NULL, NULL, NULL,0UL, 0UL,0UL );
+      FD_TEST( !memcmp( worker_tx, worker_rx, FD_TILE_MAX*sizeof(test_args_t) ) );
+    }
+  } while(0);
+
+  FD_TEST( fd_tpool_fini( tpool )==(void *)tpool_mem );
+
   FD_LOG_NOTICE(( "Testing fd_tpool_worker_state_cstr" ));
 
   char const * cstr;
@@ -475,6 +694,39 @@ main( int     argc,
     }
   }
 
+# if FD_HAS_ATOMIC
+  FD_LOG_NOTICE(( "Benching irregular workloads" ));
+
+  do {
+    static ulong irregular_sum[ FD_TILE_MAX*8UL ] __attribute__((aligned(128)));
+    fd_tpool_steal_t * steal = fd_tpool_steal_init( steal_mem, tile_cnt ); FD_TEST( steal );
+
+    ulong task_cnt = 65536UL;
+    for( ulong worker_cnt=1UL; worker_cnt<=tile_cnt; worker_cnt++ ) {
+
+      /* warmup */
+      fd_tpool_exec_all_taskq( tpool,0UL,worker_cnt, worker_irregular, NULL,  NULL, irregular_sum,8UL, 0UL,task_cnt );
+      fd_tpool_exec_all_steal( tpool,0UL,worker_cnt, steal, worker_irregular, NULL, irregular_sum,8UL, 0UL,task_cnt );
+
+      /* for real */
+      long dt_taskq = -fd_log_wallclock();
+      for( ulong rem=8UL; rem; rem-- )
+        fd_tpool_exec_all_taskq( tpool,0UL,worker_cnt, worker_irregular, NULL,  NULL, irregular_sum,8UL, 0UL,task_cnt );
+      dt_taskq += fd_log_wallclock();
+
+      long dt_steal = -fd_log_wallclock();
+      for( ulong rem=8UL; rem; rem-- )
+        fd_tpool_exec_all_steal( tpool,0UL,worker_cnt, steal, worker_irregular, NULL, irregular_sum,8UL, 0UL,task_cnt );
+      dt_steal += fd_log_wallclock();
+
+      FD_LOG_NOTICE(( "%4lu workers taskq %9.3f ns/task steal %9.3f ns/task", worker_cnt,
+                      (double)dt_taskq/(double)(8UL*task_cnt), (double)dt_steal/(double)(8UL*task_cnt) ));
+    }
+
+    FD_TEST( fd_tpool_steal_fini( steal )==(void *)steal_mem );
+  } while(0);
+# endif
+
   FD_TEST( fd_tpool_fini( tpool )==(void *)tpool_mem );
 
   /* FIXME: better coverage of scratch attach / detach */
@@ -145,9 +145,19 @@
            by the used workspace partitions.  No compression or
            hashing is done of the workspace partitions.
 
+     PAGED - the file will have a page of workspace metadata, a table
+             of the used workspace partitions, a table of the chunks
+             (at most 1 MiB) the partitions are split into and the
+             chunk data at known file offsets.  Chunks can be written
+             and read in parallel (see fd_wksp_checkpt_tpool and
+             fd_wksp_restore_tpool) and each chunk is hashed so an
+             incremental checkpt only needs to write the chunks that
+             changed since a base checkpt.
+
      DEFAULT - the style to use when not specified by user. */
 
 #define FD_WKSP_CHECKPT_STYLE_RAW     (1)
+#define FD_WKSP_CHECKPT_STYLE_PAGED   (2)
 #define FD_WKSP_CHECKPT_STYLE_DEFAULT FD_WKSP_CHECKPT_STYLE_RAW
 
 /* A fd_wksp_t * is an opaque handle of a workspace */
@@ -155,6 +165,12 @@
 struct fd_wksp_private;
 typedef struct fd_wksp_private fd_wksp_t;
 
+/* Forward declaration of a fd_tpool_t (see fd_tpool.h) for the
+   parallel checkpt and restore APIs */
+
+struct fd_tpool_private;
+typedef struct fd_tpool_private fd_tpool_t;
+
 /* A fd_wksp_usage_t is used to return workspace usage stats. */
 
 struct fd_wksp_usage {
@@ -1014,6 +1030,57 @@ fd_wksp_restore( fd_wksp_t *  wksp,
                  char const * path,
                  uint         seed );
 
+/* fd_wksp_checkpt_tpool writes the wksp's state to a
+   FD_WKSP_CHECKPT_STYLE_PAGED checkpt at path (mode and uinfo as
+   described in fd_wksp_checkpt), using the calling thread and tpool
+   worker threads (t0,t1) to hash and write the partitions.  The
+   semantics for the caller and the workers are as described in
+   fd_tpool_exec_all_raw.  A NULL tpool does the checkpt on the calling
+   thread only (t0 and t1 are ignored).
+
+   If base is non-NULL, it should be the path of a previous PAGED
+   checkpt (full or incremental).  Chunks that have the same location,
+   size and hash as a chunk of base are not written and refer to where
+   base (or one of its bases) has them instead.  That is, the checkpt is
+   incremental with respect to base and it will need base and base's
+   bases at their current paths (as given) and unmodified to be
+   restored.  If base has already reached the maximum number of bases
+   (15), a full checkpt is written instead.  Hashes are 128-bit, with
+   a seed picked at random for each full checkpt and shared by the
+   incremental checkpts derived from it, so a chunk that changed has a
+   negligible chance of being treated as unchanged, even if the wksp
+   data was chosen adversarially without knowledge of the seed.
+
+   Returns FD_WKSP_SUCCESS (0) on success or a FD_WKSP_ERR_* on failure
+   (logs details).  Reasons for failure are as described in
+   fd_wksp_checkpt plus FAIL if base could not be used.  On failure,
+   this will make a best effort to clean up after any partially written
+   checkpt file. */
+
+int
+fd_wksp_checkpt_tpool( fd_tpool_t * tpool,
+                       ulong        t0,
+                       ulong        t1,
+                       fd_wksp_t *  wksp,
+                       char const * path,
+                       ulong        mode,
+                       char const * base,
+                       char const * uinfo );
+
+/* fd_wksp_restore_tpool is fd_wksp_restore using the calling thread
+   and tpool worker threads (t0,t1) to read partitions of a
+   FD_WKSP_CHECKPT_STYLE_PAGED checkpt (and its bases) directly into the
+   wksp.  Other checkpt styles are restored by the calling thread.  A
+   NULL tpool restores on the calling thread only. */
+
+int
+fd_wksp_restore_tpool( fd_tpool_t * tpool,
+                       ulong        t0,
+                       ulong        t1,
+                       fd_wksp_t *  wksp,
+                       char const * path,
+                       uint         seed );
+
 /* fd_wksp_restore_preview extracts key parameters from a checkpoint
    file. These can be used with fd_funk_new for a correct restore. */
 int
@@ -285,6 +285,23 @@ fprintf_checkpt( FILE *       file,
     break;
   } /* FD_WKSP_CHECKPT_STYLE_RAW */
 
+  case FD_WKSP_CHECKPT_STYLE_PAGED: {
+
+    /* Print out the checkpt metadata common to all styles (use restore
+       to validate the rest) */
+
+    ulong seed_ul;   RESTORE_ULONG( seed_ul   ); uint seed = (uint)seed_ul; TEST( seed_ul==(ulong)seed                    );
+    ulong part_max;  RESTORE_ULONG( part_max  );
+    ulong data_max;  RESTORE_ULONG( data_max  );                            TEST( fd_wksp_footprint( part_max, data_max ) );
+
+    if( verbose>0 ) TRAP( fprintf( file,
+                                   "\tseed           %-20u\n"
+                                   "\tpart_max       %-20lu\n"
+                                   "\tdata_max       %-20lu\n"
+                                   , seed, part_max, data_max ) );
+    break;
+  } /* FD_WKSP_CHECKPT_STYLE_PAGED */
+
   default:
     err_info = "unsupported style";
     goto stream_err;
@@ -180,6 +180,9 @@ fd_wksp_checkpt( fd_wksp_t *  wksp,
 
   } /* FD_WKSP_CHECKPT_STYLE_RAW */
 
+  case FD_WKSP_CHECKPT_STYLE_PAGED:
+    return fd_wksp_checkpt_tpool( NULL, 0UL, 1UL, wksp, path, mode, NULL, uinfo ); /* logs details */
+
   default:
     break;
   }
@@ -443,6 +446,10 @@ fd_wksp_restore( fd_wksp_t *  wksp,
 
   } /* FD_WKSP_CHECKPT_STYLE_RAW */
 
+  case FD_WKSP_CHECKPT_STYLE_PAGED:
+    err = fd_wksp_private_restore_paged( NULL, 0UL, 1UL, wksp, fd, path, new_seed, &wksp_dirty ); /* logs details */
+    break;
+
   default:
     err_info = "unsupported style";
     goto stream_err;
@@ -531,7 +538,8 @@ fd_wksp_restore_preview( char const * path,
   ulong style_ul; RESTORE_ULONG( style_ul ); int style = (int)(uint)style_ul;
 
   switch( style ) {
-  case FD_WKSP_CHECKPT_STYLE_RAW: {
+  case FD_WKSP_CHECKPT_STYLE_RAW:
+  case FD_WKSP_CHECKPT_STYLE_PAGED: { /* PAGED starts with the same fields */
     ulong tseed_ul;   RESTORE_ULONG( tseed_ul  ); *out_seed = (uint)tseed_ul;
     ulong tpart_max;  RESTORE_ULONG( tpart_max ); *out_part_max = tpart_max;
     ulong tdata_max;  RESTORE_ULONG( tdata_max ); *out_data_max = tdata_max;
@@ -0,0 +1,939 @@
+#define _GNU_SOURCE
+
+#include "fd_wksp_private.h"
+#include "../tpool/fd_tpool.h"
+
+#include <errno.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <sys/random.h>
+
+/* A FD_WKSP_CHECKPT_STYLE_PAGED checkpt file is laid out as:
+
+     [0,64)                 magic, style, seed, part_max and data_max,
+                            svw encoded as in the RAW style (so
+                            fd_wksp_restore and fd_wksp_restore_preview
+                            can tell the styles apart)
+     [64,64+sizeof(hdr))    fd_wksp_private_paged_hdr_t
+     [base_off,uinfo_off)   base_cnt fd_wksp_private_paged_base_t
+     [uinfo_off,part_off)   uinfo cstr
+     [part_off,chunk_off)   part_cnt fd_wksp_private_paged_part_t
+     [chunk_off,...)        chunk_cnt fd_wksp_private_paged_chunk_t
+     [data_off,file_sz)     data of the chunks this checkpt wrote
+
+   The metadata [0,data_off) is written last such that a checkpt that
+   was interrupted will not be mistaken for a valid one.  Partitions
+   are split into chunks of at most CHUNK_MAX bytes at fixed offsets
+   from the start of the partition.  A chunk's data is in file
+   file_idx at file_off, where file_idx base_cnt is this file and
+   file_idx in [0,base_cnt) is a base (a base's base table is a prefix
+   of the base table of a checkpt derived from it, so file indices do
+   not need to be remapped when deriving incremental checkpts).
+
+   A chunk is identified by a 128-bit hash of its data, made of two
+   fd_hash with seeds derived from hash_seed.  hash_seed is random for
+   a full checkpt and inherited from the base for an incremental one
+   (the hashes have to be comparable with the base's), so the data in a
+   wksp cannot be chosen to collide with a chunk it replaces. */
+
+#define PAGED_PREAMBLE_SZ (64UL)
+#define PAGED_HDR_SZ      (4096UL)
+#define PAGED_CHUNK_MAX   (1UL<<20)
+#define PAGED_BASE_MAX    (15UL)
+#define PAGED_PATH_MAX    (4096UL)
+#define PAGED_UINFO_MAX   (16384UL)
+#define PAGED_IO_MAX      (1UL<<30)
+
+struct fd_wksp_private_paged_hdr {
+  ulong id;        /* Unique id of this checkpt, recorded by checkpts that use it as a base */
+  long  ts;        /* Wallclock when this checkpt was written */
+  ulong base_cnt;  /* In [0,PAGED_BASE_MAX] */
+  ulong part_cnt;  /* In [0,part_max] */
+  ulong chunk_cnt;
+  ulong uinfo_sz;  /* In [0,PAGED_UINFO_MAX), excluding the '\0' */
+  ulong base_off;
+  ulong uinfo_off;
+  ulong part_off;
+  ulong chunk_off;
+  ulong data_off;  /* PAGED_HDR_SZ aligned */
+  ulong file_sz;
+  ulong meta_hash; /* Hash of [base_off,chunk_off+chunk_cnt*sizeof(chunk)) */
+  ulong hash_seed; /* Seed of the chunk hashes, shared by a chain of incremental checkpts */
+  char  name[ FD_SHMEM_NAME_MAX ];
+};
+
+typedef struct fd_wksp_private_paged_hdr fd_wksp_private_paged_hdr_t;
+
+struct fd_wksp_private_paged_base {
+  ulong id;
+  char  path[ PAGED_PATH_MAX ];
+};
+
+typedef struct fd_wksp_private_paged_base fd_wksp_private_paged_base_t;
+
+struct fd_wksp_private_paged_part {
+  ulong tag;
+  ulong gaddr_lo;
+  ulong gaddr_hi;
+};
+
+typedef struct fd_wksp_private_paged_part fd_wksp_private_paged_part_t;
+
+struct fd_wksp_private_paged_chunk {
+  ulong gaddr_lo;
+  ulong hash[2];
+  ulong file_off;
+  uint  sz;
+  uint  file_idx;
+};
+
+typedef struct fd_wksp_private_paged_chunk fd_wksp_private_paged_chunk_t;
+
+FD_STATIC_ASSERT( PAGED_PREAMBLE_SZ+sizeof(fd_wksp_private_paged_hdr_t)<=PAGED_HDR_SZ, layout );
+
+/* fd_wksp_private_paged_meta_t is a local view of the metadata of a
+   checkpt.  The metadata is held in an anonymous mapping of mem_sz
+   (==hdr->data_off) bytes. */
+
+struct fd_wksp_private_paged_meta {
+  uchar *                         mem;
+  ulong                           mem_sz;
+  uint                            seed;
+  ulong                           part_max;
+  ulong                           data_max;
+  fd_wksp_private_paged_hdr_t *   hdr;
+  fd_wksp_private_paged_base_t *  base;
+  char *                          uinfo;
+  fd_wksp_private_paged_part_t *  part;
+  fd_wksp_private_paged_chunk_t * chunk;
+};
+
+typedef struct fd_wksp_private_paged_meta fd_wksp_private_paged_meta_t;
+
+/* File I/O helpers.  These return 0 on success, a positive errno
+   compat error code on failure and -1 if a read hit EOF. */
+
+static int
+fd_wksp_private_paged_pread( int    fd,
+                             void * buf,
+                             ulong  sz,
+                             ulong  off ) {
+  uchar * p = (uchar *)buf;
+  while( sz ) {
+    long rsz = (long)pread( fd, p, fd_ulong_min( sz, PAGED_IO_MAX ), (off_t)off );
+    if( FD_UNLIKELY( rsz<=0L ) ) {
+      if( !rsz ) return -1;
+      if( errno==EINTR ) continue;
+      return errno;
+    }
+    p += rsz; off += (ulong)rsz; sz -= (ulong)rsz;
+  }
+  return 0;
+}
+
+static int
+fd_wksp_private_paged_pwrite( int          fd,
+                              void const * buf,
+                              ulong        sz,
+                              ulong        off ) {
+  uchar const * p = (uchar const *)buf;
+  while( sz ) {
+    long wsz = (long)pwrite( fd, p, fd_ulong_min( sz, PAGED_IO_MAX ), (off_t)off );
+    if( FD_UNLIKELY( wsz<=0L ) ) {
+      if( wsz<0L && errno==EINTR ) continue;
+      return wsz<0L ? errno : EIO;
+    }
+    p += wsz; off += (ulong)wsz; sz -= (ulong)wsz;
+  }
+  return 0;
+}
+
+/* fd_wksp_private_paged_layout computes the offsets of hdr's regions
+   from its counts.  Returns hdr. */
+
+static fd_wksp_private_paged_hdr_t *
+fd_wksp_private_paged_layout( fd_wksp_private_paged_hdr_t * hdr ) {
+  hdr->base_off  = PAGED_HDR_SZ;
+  hdr->uinfo_off = hdr->base_off  + hdr->base_cnt*sizeof(fd_wksp_private_paged_base_t);
+  hdr->part_off  = fd_ulong_align_up( hdr->uinfo_off + hdr->uinfo_sz + 1UL, 8UL );
+  hdr->chunk_off = hdr->part_off  + hdr->part_cnt*sizeof(fd_wksp_private_paged_part_t);
+  hdr->data_off  = fd_ulong_align_up( hdr->chunk_off + hdr->chunk_cnt*sizeof(fd_wksp_private_paged_chunk_t), PAGED_HDR_SZ );
+  return hdr;
+}
+
+static ulong
+fd_wksp_private_paged_meta_hash( fd_wksp_private_paged_meta_t const * meta ) {
+  fd_wksp_private_paged_hdr_t const * hdr = meta->hdr;
+  ulong meta_end = hdr->chunk_off + hdr->chunk_cnt*sizeof(fd_wksp_private_paged_chunk_t);
+  return fd_hash( hdr->id, meta->mem + hdr->base_off, meta_end - hdr->base_off );
+}
+
+/* fd_wksp_private_paged_meta_new maps the memory for a meta with the
+   layout given by hdr (hdr will be copied into it) and sets up the
+   local pointers.  Returns meta on success and NULL on failure (logs
+   details). */
+
+static fd_wksp_private_paged_meta_t *
+fd_wksp_private_paged_meta_new( fd_wksp_private_paged_meta_t *      meta,
+                                fd_wksp_private_paged_hdr_t const * hdr ) {
+  ulong mem_sz = hdr->data_off;
+  void * mem = mmap( NULL, mem_sz, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, (off_t)0 );
+  if( FD_UNLIKELY( mem==MAP_FAILED ) ) {
+    FD_LOG_WARNING(( "mmap(NULL,%lu KiB,PROT_READ|PROT_WRITE,MAP_PRIVATE|MAP_ANONYMOUS,-1,0) failed (%i-%s)",
+                     mem_sz>>10, errno, fd_io_strerror( errno ) ));
+    return NULL;
+  }
+  meta->mem    = (uchar *)mem;
+  meta->mem_sz = mem_sz;
+  meta->hdr    = (fd_wksp_private_paged_hdr_t   *)(meta->mem + PAGED_PREAMBLE_SZ);
+  meta->base   = (fd_wksp_private_paged_base_t  *)(meta->mem + hdr->base_off );
+  meta->uinfo  = (char                          *)(meta->mem + hdr->uinfo_off);
+  meta->part   = (fd_wksp_private_paged_part_t  *)(meta->mem + hdr->part_off );
+  meta->chunk  = (fd_wksp_private_paged_chunk_t *)(meta->mem + hdr->chunk_off);
+  *meta->hdr = *hdr;
+  return meta;
+}
+
+static void
+fd_wksp_private_paged_meta_delete( fd_wksp_private_paged_meta_t * meta ) {
+  if( FD_UNLIKELY( munmap( meta->mem, meta->mem_sz ) ) )
+    FD_LOG_WARNING(( "munmap failed (%i-%s); attempting to continue", errno, fd_io_strerror( errno ) ));
+}
+
+/* fd_wksp_private_paged_hdr_read reads and validates the preamble and
+   header of the PAGED checkpt open as fd at path.  Returns
+   FD_WKSP_SUCCESS on success (hdr, *_seed, *_part_max and *_data_max
+   will hold the header and preamble values) and FD_WKSP_ERR_FAIL on
+   failure (logs details). */
+
+static int
+fd_wksp_private_paged_hdr_read( int                           fd,
+                                char const *                  path,
+                                fd_wksp_private_paged_hdr_t * hdr,
+                                uint *                        _seed,
+                                ulong *                       _part_max,
+                                ulong *                       _data_max ) {
+  uchar page[ PAGED_PREAMBLE_SZ + sizeof(fd_wksp_private_paged_hdr_t) ] __attribute__((aligned(8)));
+  int err = fd_wksp_private_paged_pread( fd, page, sizeof(page), 0UL );
+  if( FD_UNLIKELY( err ) ) {
+    FD_LOG_WARNING(( "Checkpt \"%s\" header read failed (%i-%s)", path, err, err<0 ? "unexpected EOF" : fd_io_strerror( err ) ));
+    return FD_WKSP_ERR_FAIL;
+  }
+
+  char const * err_info;
+# define TEST(c) do { if( FD_UNLIKELY( !(c) ) ) { err_info = #c; goto stream_err; } } while(0)
+
+  ulong magic;    uchar const * p = fd_ulong_svw_dec( page, &magic );    TEST( magic==FD_WKSP_MAGIC );
+  ulong style;    p = fd_ulong_svw_dec( p, &style    );                  TEST( style==(ulong)FD_WKSP_CHECKPT_STYLE_PAGED );
+  ulong seed;     p = fd_ulong_svw_dec( p, &seed     );                  TEST( seed==(ulong)(uint)seed );
+  ulong part_max; p = fd_ulong_svw_dec( p, &part_max );
+  ulong data_max; p = fd_ulong_svw_dec( p, &data_max );                  TEST( fd_wksp_footprint( part_max, data_max ) );
+
+  fd_memcpy( hdr, page + PAGED_PREAMBLE_SZ, sizeof(fd_wksp_private_paged_hdr_t) );
+
+  TEST( hdr->base_cnt<=PAGED_BASE_MAX );
+  TEST( hdr->part_cnt<=part_max );
+  TEST( hdr->chunk_cnt<=hdr->part_cnt + data_max/PAGED_CHUNK_MAX );
+  TEST( hdr->uinfo_sz<PAGED_UINFO_MAX );
+  TEST( fd_cstr_nlen( hdr->name, FD_SHMEM_NAME_MAX )<FD_SHMEM_NAME_MAX );
+
+  fd_wksp_private_paged_hdr_t layout[1]; *layout = *hdr;
+  fd_wksp_private_paged_layout( layout );
+  TEST( (layout->base_off ==hdr->base_off ) & (layout->uinfo_off==hdr->uinfo_off) & (layout->part_off==hdr->part_off) &
+        (layout->chunk_off==hdr->chunk_off) & (layout->data_off ==hdr->data_off ) );
+  TEST( hdr->file_sz>=hdr->data_off );
+
+  struct stat st[1];
+  if( FD_UNLIKELY( fstat( fd, st ) ) ) {
+    FD_LOG_WARNING(( "fstat(\"%s\") failed (%i-%s)", path, errno, fd_io_strerror( errno ) ));
+    return FD_WKSP_ERR_FAIL;
+  }
+  TEST( (ulong)st->st_size>=hdr->file_sz );
+
+  *_seed     = (uint)seed;
+  *_part_max = part_max;
+  *_data_max = data_max;
+  return FD_WKSP_SUCCESS;
+
+stream_err:
+  FD_LOG_WARNING(( "Checkpt \"%s\" failed due to checkpt format error (%s)", path, err_info ));
+  return FD_WKSP_ERR_FAIL;
+
+# undef TEST
+}
+
+/* fd_wksp_private_paged_meta_read reads and validates all the metadata
+   of the PAGED checkpt open as fd at path into meta.  Returns
+   FD_WKSP_SUCCESS on success (the caller should delete meta when done
+   with it) and FD_WKSP_ERR_FAIL on failure (logs details). */
+
+static int
+fd_wksp_private_paged_meta_read( fd_wksp_private_paged_meta_t * meta,
+                                 int                            fd,
+                                 char const *                   path ) {
+  fd_wksp_private_paged_hdr_t hdr[1];
+  uint  seed;
+  ulong part_max;
+  ulong data_max;
+  int err = fd_wksp_private_paged_hdr_read( fd, path, hdr, &seed, &part_max, &data_max ); /* logs details */
+  if( FD_UNLIKELY( err ) ) return err;
+
+  if( FD_UNLIKELY( !fd_wksp_private_paged_meta_new( meta, hdr ) ) ) return FD_WKSP_ERR_FAIL; /* logs details */
+  meta->seed     = seed;
+  meta->part_max = part_max;
+  meta->data_max = data_max;
+
+  err = fd_wksp_private_paged_pread( fd, meta->mem + PAGED_HDR_SZ, meta->mem_sz - PAGED_HDR_SZ, PAGED_HDR_SZ );
+  if( FD_UNLIKELY( err ) ) {
+    FD_LOG_WARNING(( "Checkpt \"%s\" metadata read failed (%i-%s)", path, err, err<0 ? "unexpected EOF" : fd_io_strerror( err ) ));
+    fd_wksp_private_paged_meta_delete( meta );
+    return FD_WKSP_ERR_FAIL;
+  }
+
+  char const * err_info;
+# define TEST(c) do { if( FD_UNLIKELY( !(c) ) ) { err_info = #c; goto stream_err; } } while(0)
+
+  TEST( fd_wksp_private_paged_meta_hash( meta )==hdr->meta_hash );
+  TEST( strlen( meta->uinfo )==hdr->uinfo_sz );
+  for( ulong i=0UL; i<hdr->base_cnt; i++ ) TEST( fd_cstr_nlen( meta->base[ i ].path, PAGED_PATH_MAX )<PAGED_PATH_MAX );
+
+  return FD_WKSP_SUCCESS;
+
+stream_err:
+  FD_LOG_WARNING(( "Checkpt \"%s\" failed due to checkpt format error (%s)", path, err_info ));
+  fd_wksp_private_paged_meta_delete( meta );
+  return FD_WKSP_ERR_FAIL;
+
+# undef TEST
+}
+
+/* Parallel chunk processing *****************************************/
+
+#define PAGED_OP_HASH  (0)
+#define PAGED_OP_WRITE (1)
+#define PAGED_OP_READ  (2)
+
+/* fd_wksp_private_paged_args_t describes an operation on the chunks of
+   a checkpt.  Worker slot s processes chunks [split[s],split[s+1]).
+   Only chunks whose data is in file self_idx are written and read. */
+
+struct fd_wksp_private_paged_args {
+  int                             op;
+  fd_wksp_t *                     wksp;
+  fd_wksp_private_paged_chunk_t * chunk;
+  ulong                           hash_seed;
+  ulong                           self_idx;
+  int const *                     fd;      /* Indexed by file_idx */
+  ulong                           split[ FD_TILE_MAX+1UL ];
+  int                             err  [ FD_TILE_MAX     ];
+};
+
+typedef struct fd_wksp_private_paged_args fd_wksp_private_paged_args_t;
+
+static void
+fd_wksp_private_paged_task( void * tpool,
+                            ulong  t0,      ulong t1,
+                            void * _args,
+                            void * reduce,  ulong stride,
+                            ulong  l0,      ulong l1,
+                            ulong  m0,      ulong m1,
+                            ulong  n0,      ulong n1 ) {
+  (void)tpool; (void)t1; (void)reduce; (void)stride; (void)l0; (void)l1; (void)m0; (void)m1; (void)n1;
+
+  fd_wksp_private_paged_args_t *  args  = (fd_wksp_private_paged_args_t *)_args;
+  fd_wksp_t *                     wksp  = args->wksp;
+  fd_wksp_private_paged_chunk_t * chunk = args->chunk;
+  ulong                           slot  = n0 - t0;
+  ulong                           c0    = args->split[ slot     ];
+  ulong                           c1    = args->split[ slot+1UL ];
+
+  if( args->op==PAGED_OP_HASH ) {
+    ulong seed0 = args->hash_seed;
+    ulong seed1 = fd_ulong_hash( seed0 ^ 0x9e3779b97f4a7c15UL );
+    for( ulong c=c0; c<c1; c++ ) {
+      void const * laddr = fd_wksp_laddr_fast( wksp, chunk[ c ].gaddr_lo );
+      chunk[ c ].hash[0] = fd_hash( seed0, laddr, (ulong)chunk[ c ].sz );
+      chunk[ c ].hash[1] = fd_hash( seed1, laddr, (ulong)chunk[ c ].sz );
+    }
+    args->err[ slot ] = 0;
+    return;
+  }
+
+  /* Coalesce runs of chunks that are contiguous in both the wksp and
+     the file into large I/O operations */
+
+  int   err      = 0;
+  ulong run_sz   = 0UL;
+  ulong run_file = 0UL;
+  ulong run_off  = 0UL;
+  ulong run_lo   = 0UL;
+
+  for( ulong c=c0; c<=c1; c++ ) {
+    int   flush    = (c==c1);
+    ulong file_idx = 0UL;
+    if( FD_LIKELY( !flush ) ) {
+      file_idx = (ulong)chunk[ c ].file_idx;
+      if( args->op==PAGED_OP_WRITE && file_idx!=args->self_idx ) continue;
+      flush = (!!run_sz) && ( (file_idx!=run_file) | (chunk[ c ].file_off!=run_off+run_sz) |
+                              (chunk[ c ].gaddr_lo!=run_lo+run_sz) | (run_sz+chunk[ c ].sz>PAGED_IO_MAX) );
+    }
+
+    if( flush && run_sz ) {
+      void * laddr = fd_wksp_laddr_fast( wksp, run_lo );
+      if( args->op==PAGED_OP_WRITE ) err = fd_wksp_private_paged_pwrite( args->fd[ run_file ], laddr, run_sz, run_off );
+      else                           err = fd_wksp_private_paged_pread ( args->fd[ run_file ], laddr, run_sz, run_off );
+      if( FD_UNLIKELY( err ) ) break;
+      run_sz = 0UL;
+    }
+
+    if( c==c1 ) break;
+
+    if( !run_sz ) {
+      run_file = file_idx;
+      run_off  = chunk[ c ].file_off;
+      run_lo   = chunk[ c ].gaddr_lo;
+    }
+    run_sz += (ulong)chunk[ c ].sz;
+  }
+
+  args->err[ slot ] = err;
+}
+
+/* fd_wksp_private_paged_exec does op on the chunk_cnt chunks in args
+   using the calling thread and tpool workers (t0,t1) (or just the
+   calling thread if tpool is NULL).  The chunks are split between the
+   workers such that they get roughly the same number of bytes.
+   Returns 0 on success and the error of a failed worker otherwise. */
+
+static int
+fd_wksp_private_paged_exec( fd_tpool_t *                   tpool,
+                            ulong                          t0,
+                            ulong                          t1,
+                            fd_wksp_private_paged_args_t * args,
+                            ulong                          chunk_cnt ) {
+  if( !tpool ) { t0 = 0UL; t1 = 1UL; }
+  ulong worker_cnt = t1 - t0;
+
+  fd_wksp_private_paged_chunk_t const * chunk = args->chunk;
+  int write = (args->op==PAGED_OP_WRITE);
+
+  ulong tot = 0UL;
+  for( ulong c=0UL; c<chunk_cnt; c++ )
+    tot += fd_ulong_if( write & (chunk[ c ].file_idx!=args->self_idx), 0UL, (ulong)chunk[ c ].sz );
+
+  ulong c   = 0UL;
+  ulong acc = 0UL;
+  args->split[ 0 ] = 0UL;
+  for( ulong s=1UL; s<worker_cnt; s++ ) {
+    ulong target = (tot/worker_cnt)*s + ((tot%worker_cnt)*s)/worker_cnt;
+    while( (c<chunk_cnt) && (acc<target) ) {
+      acc += fd_ulong_if( write & (chunk[ c ].file_idx!=args->self_idx), 0UL, (ulong)chunk[ c ].sz );
+      c++;
+    }
+    args->split[ s ] = c;
+  }
+  args->split[ worker_cnt ] = chunk_cnt;
+
+  if( tpool ) fd_tpool_exec_all_raw( tpool, t0, t1, fd_wksp_private_paged_task, NULL, args, NULL, 0UL, 0UL, 0UL );
+  else        fd_wksp_private_paged_task( NULL, 0UL, 1UL, args, NULL, 0UL, 0UL, 0UL, 0UL, 0UL, 0UL, 1UL );
+
+  for( ulong s=0UL; s<worker_cnt; s++ ) if( FD_UNLIKELY( args->err[ s ] ) ) return args->err[ s ];
+  return 0;
+}
+
+/* Checkpt ***********************************************************/
+
+int
+fd_wksp_checkpt_tpool( fd_tpool_t * tpool,
+                       ulong        t0,
+                       ulong        t1,
+                       fd_wksp_t *  wksp,
+                       char const * path,
+                       ulong        mode,
+                       char const * base,
+                       char const * uinfo ) {
+
+  if( FD_UNLIKELY( !wksp ) ) {
+    FD_LOG_WARNING(( "NULL wksp" ));
+    return FD_WKSP_ERR_INVAL;
+  }
+
+  if( FD_UNLIKELY( !path ) ) {
+    FD_LOG_WARNING(( "NULL path" ));
+    return FD_WKSP_ERR_INVAL;
+  }
+
+  if( FD_UNLIKELY( mode!=(ulong)(mode_t)mode ) ) {
+    FD_LOG_WARNING(( "bad mode" ));
+    return FD_WKSP_ERR_INVAL;
+  }
+
+  if( FD_UNLIKELY( tpool && !((t0<t1) & ((t1-t0)<=FD_TILE_MAX)) ) ) {
+    FD_LOG_WARNING(( "bad t0 / t1" ));
+    return FD_WKSP_ERR_INVAL;
+  }
+
+  if( FD_UNLIKELY( base && fd_cstr_nlen( base, PAGED_PATH_MAX )>=PAGED_PATH_MAX ) ) {
+    FD_LOG_WARNING(( "base path too long" ));
+    return FD_WKSP_ERR_INVAL;
+  }
+
+  if( FD_UNLIKELY( !uinfo ) ) uinfo = "";
+
+  /* Load the base metadata */
+
+  fd_wksp_private_paged_meta_t base_meta[1];
+  if( base ) {
+    int base_fd = open( base, O_RDONLY, (mode_t)0 );
+    if( FD_UNLIKELY( base_fd==-1 ) ) {
+      FD_LOG_WARNING(( "open(\"%s\",O_RDONLY,0) failed (%i-%s)", base, errno, fd_io_strerror( errno ) ));
+      return FD_WKSP_ERR_FAIL;
+    }
+    int err = fd_wksp_private_paged_meta_read( base_meta, base_fd, base ); /* logs details */
+    if( FD_UNLIKELY( close( base_fd ) ) )
+      FD_LOG_WARNING(( "close(\"%s\") failed (%i-%s); attempting to continue", base, errno, fd_io_strerror( errno ) ));
+    if( FD_UNLIKELY( err ) ) return err;
+    if( FD_UNLIKELY( base_meta->hdr->base_cnt>=PAGED_BASE_MAX ) ) {
+      FD_LOG_NOTICE(( "Checkpt \"%s\" already has %lu bases; writing a full checkpt", base, base_meta->hdr->base_cnt ));
+      fd_wksp_private_paged_meta_delete( base_meta );
+      base = NULL;
+    }
+  }
+
+  mode_t old_mask = umask( (mode_t)0 );
+  int fd = open( path, O_CREAT|O_EXCL|O_WRONLY, (mode_t)mode );
+  umask( old_mask );
+  if( FD_UNLIKELY( fd==-1 ) ) {
+    FD_LOG_WARNING(( "open(\"%s\",O_CREAT|O_EXCL|O_WRONLY,0%03lo) failed (%i-%s)", path, mode, errno, fd_io_strerror( errno ) ));
+    if( base ) fd_wksp_private_paged_meta_delete( base_meta );
+    return FD_WKSP_ERR_FAIL;
+  }
+
+  fd_wksp_private_paged_meta_t meta[1];
+  int                          have_meta = 0;
+  int                          err;
+
+  err = fd_wksp_private_lock( wksp ); if( FD_UNLIKELY( err ) ) goto fini; /* logs details */
+
+  ulong data_lo = wksp->gaddr_lo;
+  ulong data_hi = wksp->gaddr_hi;
+  if( FD_UNLIKELY( !((0UL<data_lo) & (data_lo<=data_hi)) ) ) goto corrupt_wksp;
+
+  /* Count the allocated partitions and their chunks */
+
+  ulong                     part_max = wksp->part_max;
+  fd_wksp_private_pinfo_t * pinfo    = fd_wksp_private_pinfo( wksp );
+
+  ulong part_cnt  = 0UL;
+  ulong chunk_cnt = 0UL;
+
+  ulong cycle_tag  = wksp->cycle_tag++;
+  ulong gaddr_last = data_lo;
+
+  ulong i = fd_wksp_private_pinfo_idx( wksp->part_head_cidx );
+  while( !fd_wksp_private_pinfo_idx_is_null( i ) ) {
+    if( FD_UNLIKELY( i>=part_max ) || FD_UNLIKELY( pinfo[ i ].cycle_tag==cycle_tag ) ) goto corrupt_wksp;
+    pinfo[ i ].cycle_tag = cycle_tag; /* mark i as visited */
+
+    ulong gaddr_lo = pinfo[ i ].gaddr_lo;
+    ulong gaddr_hi = pinfo[ i ].gaddr_hi;
+    if( FD_UNLIKELY( !((gaddr_last==gaddr_lo) & (gaddr_lo<gaddr_hi) & (gaddr_hi<=data_hi)) ) ) goto corrupt_wksp;
+    gaddr_last = gaddr_hi;
+
+    if( pinfo[ i ].tag ) {
+      part_cnt++;
+      chunk_cnt += (gaddr_hi - gaddr_lo + PAGED_CHUNK_MAX - 1UL) / PAGED_CHUNK_MAX;
+    }
+
+    i = fd_wksp_private_pinfo_idx( pinfo[ i ].next_cidx );
+  }
+
+  /* Create the metadata */
+
+  fd_wksp_private_paged_hdr_t hdr[1];
+  memset( hdr, 0, sizeof(fd_wksp_private_paged_hdr_t) );
+  hdr->ts        = fd_log_wallclock();
+  hdr->id        = fd_ulong_hash( (ulong)hdr->ts ^ fd_ulong_hash( fd_log_tid() ^ fd_ulong_hash( fd_log_host_id() ) ) );
+  hdr->base_cnt  = base ? base_meta->hdr->base_cnt + 1UL : 0UL;
+  if( base ) hdr->hash_seed = base_meta->hdr->hash_seed;
+  else if( FD_UNLIKELY( getrandom( &hdr->hash_seed, sizeof(ulong), 0 )!=(long)sizeof(ulong) ) ) { err = errno; goto io_err; }
+  hdr->part_cnt  = part_cnt;
+  hdr->chunk_cnt = chunk_cnt;
+  hdr->uinfo_sz  = fd_cstr_nlen( uinfo, PAGED_UINFO_MAX-1UL );
+  fd_cstr_fini( fd_cstr_append_text( fd_cstr_init( hdr->name ), wksp->name, fd_shmem_name_len( wksp->name ) ) );
+  fd_wksp_private_paged_layout( hdr );
+
+  if( FD_UNLIKELY( !fd_wksp_private_paged_meta_new( meta, hdr ) ) ) { err = ENOMEM; goto io_err; } /* logs details */
+  have_meta = 1;
+
+  uchar * prep = meta->mem;
+  prep = fd_wksp_private_checkpt_ulong( prep, wksp->magic                                );
+  prep = fd_wksp_private_checkpt_ulong( prep, (ulong)(uint)FD_WKSP_CHECKPT_STYLE_PAGED   );
+  prep = fd_wksp_private_checkpt_ulong( prep, (ulong)wksp->seed                          );
+  prep = fd_wksp_private_checkpt_ulong( prep, wksp->part_max                             );
+  prep = fd_wksp_private_checkpt_ulong( prep, wksp->data_max                             );
+
+  if( base ) {
+    ulong base_cnt = base_meta->hdr->base_cnt;
+    fd_memcpy( meta->base, base_meta->base, base_cnt*sizeof(fd_wksp_private_paged_base_t) );
+    meta->base[ base_cnt ].id = base_meta->hdr->id;
+    strcpy( meta->base[ base_cnt ].path, base );
+  }
+
+  fd_memcpy( meta->uinfo, uinfo, hdr->uinfo_sz ); /* '\0' terminated by the mapping */
+
+  fd_wksp_private_paged_part_t *  part  = meta->part;
+  fd_wksp_private_paged_chunk_t * chunk = meta->chunk;
+
+  ulong part_idx  = 0UL;
+  ulong chunk_idx = 0UL;
+  i = fd_wksp_private_pinfo_idx( wksp->part_head_cidx );
+  while( !fd_wksp_private_pinfo_idx_is_null( i ) ) {
+    ulong tag = pinfo[ i ].tag;
+    if( tag ) {
+      ulong gaddr_lo = pinfo[ i ].gaddr_lo;
+      ulong gaddr_hi = pinfo[ i ].gaddr_hi;
+      part[ part_idx ].tag      = tag;
+      part[ part_idx ].gaddr_lo = gaddr_lo;
+      part[ part_idx ].gaddr_hi = gaddr_hi;
+      part_idx++;
+      for( ulong gaddr=gaddr_lo; gaddr<gaddr_hi; gaddr+=PAGED_CHUNK_MAX ) {
+        chunk[ chunk_idx ].gaddr_lo = gaddr;
+        chunk[ chunk_idx ].sz       = (uint)fd_ulong_min( PAGED_CHUNK_MAX, gaddr_hi - gaddr );
+        chunk_idx++;
+      }
+    }
+    i = fd_wksp_private_pinfo_idx( pinfo[ i ].next_cidx );
+  }
+
+  /* Hash the chunks and find the ones that need to be written (both
+     chunk tables are sorted by gaddr_lo) */
+
+  int file_fd[ PAGED_BASE_MAX+1UL ]; /* Only this file is written */
+  file_fd[ hdr->base_cnt ] = fd;
+
+  fd_wksp_private_paged_args_t args[1];
+  args->op        = PAGED_OP_HASH;
+  args->wksp      = wksp;
+  args->chunk     = chunk;
+  args->hash_seed = hdr->hash_seed;
+  args->self_idx  = hdr->base_cnt;
+  args->fd        = file_fd;
+
+  err = fd_wksp_private_paged_exec( tpool, t0, t1, args, chunk_cnt );
+  if( FD_UNLIKELY( err ) ) goto io_err;
+
+  fd_wksp_private_paged_chunk_t const * base_chunk     = base ? base_meta->chunk          : NULL;
+  ulong                                 base_chunk_cnt = base ? base_meta->hdr->chunk_cnt : 0UL;
+
+  ulong file_off = hdr->data_off;
+  ulong j        = 0UL;
+  for( ulong c=0UL; c<chunk_cnt; c++ ) {
+    while( (j<base_chunk_cnt) && (base_chunk[ j ].gaddr_lo<chunk[ c ].gaddr_lo) ) j++;
+    if( (j<base_chunk_cnt) && (base_chunk[ j ].gaddr_lo==chunk[ c ].gaddr_lo) &&
+        (base_chunk[ j ].sz==chunk[ c ].sz) &&
+        (base_chunk[ j ].hash[0]==chunk[ c ].hash[0]) && (base_chunk[ j ].hash[1]==chunk[ c ].hash[1]) ) {
+      chunk[ c ].file_idx = base_chunk[ j ].file_idx;
+      chunk[ c ].file_off = base_chunk[ j ].file_off;
+    } else {
+      chunk[ c ].file_idx = (uint)hdr->base_cnt;
+      chunk[ c ].file_off = file_off;
+      file_off += (ulong)chunk[ c ].sz;
+    }
+  }
+
+  meta->hdr->file_sz   = file_off;
+  meta->hdr->meta_hash = fd_wksp_private_paged_meta_hash( meta );
+
+  /* Write the changed chunks and then the metadata */
+
+  args->op = PAGED_OP_WRITE;
+  err = fd_wksp_private_paged_exec( tpool, t0, t1, args, chunk_cnt );
+  if( FD_UNLIKELY( err ) ) goto io_err;
+
+  fd_wksp_private_unlock( wksp );
+
+  err = fd_wksp_private_paged_pwrite( fd, meta->mem, meta->mem_sz, 0UL );
+  if( FD_UNLIKELY( err ) ) {
+    FD_LOG_WARNING(( "Checkpt wksp \"%s\" to \"%s\" failed due to I/O error (%i-%s)",
+                     wksp->name, path, err, fd_io_strerror( err ) ));
+    err = FD_WKSP_ERR_FAIL;
+  }
+
+  FD_LOG_INFO(( "Checkpt wksp \"%s\" to \"%s\": %lu partitions, %lu chunks, %lu bytes written (%lu bases)",
+                wksp->name, path, part_cnt, chunk_cnt, file_off - hdr->data_off, hdr->base_cnt ));
+
+fini: /* note: wksp unlocked at this point */
+  if( have_meta ) fd_wksp_private_paged_meta_delete( meta );
+  if( base      ) fd_wksp_private_paged_meta_delete( base_meta );
+  if( FD_UNLIKELY( err ) && FD_UNLIKELY( unlink( path ) ) )
+    FD_LOG_WARNING(( "unlink(\"%s\") failed (%i-%s); attempting to continue", path, errno, fd_io_strerror( errno ) ));
+  if( FD_UNLIKELY( close( fd ) ) )
+    FD_LOG_WARNING(( "close(\"%s\") failed (%i-%s); attempting to continue", path, errno, fd_io_strerror( errno ) ));
+  return err;
+
+io_err: /* Failed due to I/O error ... clean up and log (note: wksp locked at this point) */
+  fd_wksp_private_unlock( wksp );
+  FD_LOG_WARNING(( "Checkpt wksp \"%s\" to \"%s\" failed due to I/O error (%i-%s)",
+                   wksp->name, path, err, fd_io_strerror( err ) ));
+  err = FD_WKSP_ERR_FAIL;
+  goto fini;
+
+corrupt_wksp: /* Failed due to wksp corruption ... clean up and log (note: wksp locked at this point) */
+  fd_wksp_private_unlock( wksp );
+  FD_LOG_WARNING(( "Checkpt wksp \"%s\" to \"%s\" failed due to wksp corruption", wksp->name, path ));
+  err = FD_WKSP_ERR_CORRUPT;
+  goto fini;
+}
+
+/* Restore ***********************************************************/
+
+int
+fd_wksp_private_restore_paged( fd_tpool_t * tpool,
+                               ulong        t0,
+                               ulong        t1,
+                               fd_wksp_t *  wksp,
+                               int          fd,
+                               char const * path,
+                               uint         new_seed,
+                               int *        _dirty ) {
+  *_dirty = 0;
+
+  if( FD_UNLIKELY( tpool && !((t0<t1) & ((t1-t0)<=FD_TILE_MAX)) ) ) {
+    FD_LOG_WARNING(( "bad t0 / t1" ));
+    return FD_WKSP_ERR_INVAL;
+  }
+
+  fd_wksp_private_paged_meta_t meta[1];
+  int err = fd_wksp_private_paged_meta_read( meta, fd, path ); /* logs details */
+  if( FD_UNLIKELY( err ) ) return err;
+
+  fd_wksp_private_paged_hdr_t const *   hdr       = meta->hdr;
+  ulong                                 base_cnt  = hdr->base_cnt;
+  ulong                                 part_cnt  = hdr->part_cnt;
+  ulong                                 chunk_cnt = hdr->chunk_cnt;
+  fd_wksp_private_paged_part_t const *  part      = meta->part;
+  fd_wksp_private_paged_chunk_t *       chunk     = meta->chunk;
+
+  FD_LOG_INFO(( "checkpt_ts     %-20li",   hdr->ts        ));
+  FD_LOG_INFO(( "checkpt_info\n\t%s",      meta->uinfo    ));
+  FD_LOG_INFO(( "shmem_name     \"%s\"",   hdr->name      ));
+  FD_LOG_INFO(( "seed           %-20u",    meta->seed     ));
+  FD_LOG_INFO(( "part_max       %-20lu",   meta->part_max ));
+  FD_LOG_INFO(( "data_max       %-20lu",   meta->data_max ));
+  FD_LOG_INFO(( "part_cnt       %-20lu",   part_cnt       ));
+  FD_LOG_INFO(( "base_cnt       %-20lu",   base_cnt       ));
+
+  ulong                     wksp_part_max = wksp->part_max;
+  ulong                     wksp_data_lo  = wksp->gaddr_lo;
+  ulong                     wksp_data_hi  = wksp->gaddr_hi;
+  fd_wksp_private_pinfo_t * wksp_pinfo    = fd_wksp_private_pinfo( wksp );
+
+  int   file_fd    [ PAGED_BASE_MAX+1UL ];
+  ulong file_lo    [ PAGED_BASE_MAX+1UL ];
+  ulong file_hi    [ PAGED_BASE_MAX+1UL ];
+  int   file_used  [ PAGED_BASE_MAX+1UL ];
+  for( ulong f=0UL; f<=base_cnt; f++ ) { file_fd[ f ] = -1; file_used[ f ] = 0; }
+  file_fd[ base_cnt ] = fd;
+  file_lo[ base_cnt ] = hdr->data_off;
+  file_hi[ base_cnt ] = hdr->file_sz;
+
+  err = FD_WKSP_ERR_FAIL;
+
+  if( FD_UNLIKELY( part_cnt>wksp_part_max ) ) {
+    FD_LOG_WARNING(( "Restore \"%s\" to wksp \"%s\" failed because too few wksp partitions (part_cnt checkpt %lu, part_max wksp %lu)",
+                     path, wksp->name, part_cnt, wksp_part_max ));
+    goto done;
+  }
+
+  /* Validate the partitions and that their chunks tile them */
+
+  ulong data_lo    = fd_wksp_private_data_off( meta->part_max );
+  ulong data_hi    = data_lo + meta->data_max;
+  ulong gaddr_last = data_lo;
+  ulong c          = 0UL;
+  for( ulong p=0UL; p<part_cnt; p++ ) {
+    ulong gaddr_lo = part[ p ].gaddr_lo;
+    ulong gaddr_hi = part[ p ].gaddr_hi;
+
+    if( FD_UNLIKELY( !((gaddr_last<=gaddr_lo) & (gaddr_lo<gaddr_hi) & (gaddr_hi<=data_hi) & (!!part[ p ].tag)) ) ) {
+      FD_LOG_WARNING(( "Restore \"%s\" to wksp \"%s\" failed due to checkpt format error (bad partition %lu)", path, wksp->name, p ));
+      goto done;
+    }
+    gaddr_last = gaddr_hi;
+
+    if( FD_UNLIKELY( !((wksp_data_lo<=gaddr_lo) & (gaddr_hi<=wksp_data_hi)) ) ) {
+      FD_LOG_WARNING(( "Restore \"%s\" to wksp \"%s\" failed because checkpt partition [0x%016lx,0x%016lx) tag %lu "
+                       "does not fit into wksp data region [0x%016lx,0x%016lx) (data_max checkpt %lu, wksp %lu)",
+                       path, wksp->name, gaddr_lo, gaddr_hi, part[ p ].tag, wksp_data_lo, wksp_data_hi,
+                       meta->data_max, wksp->data_max ));
+      goto done;
+    }
+
+    for( ulong gaddr=gaddr_lo; gaddr<gaddr_hi; gaddr+=PAGED_CHUNK_MAX ) {
+      if( FD_UNLIKELY( c>=chunk_cnt                                                        ) ||
+          FD_UNLIKELY( chunk[ c ].gaddr_lo!=gaddr                                          ) ||
+          FD_UNLIKELY( (ulong)chunk[ c ].sz!=fd_ulong_min( PAGED_CHUNK_MAX, gaddr_hi-gaddr ) ) ||
+          FD_UNLIKELY( (ulong)chunk[ c ].file_idx>base_cnt                                 ) ) {
+        FD_LOG_WARNING(( "Restore \"%s\" to wksp \"%s\" failed due to checkpt format error (bad chunk %lu)", path, wksp->name, c ));
+        goto done;
+      }
+      file_used[ chunk[ c ].file_idx ] = 1;
+      c++;
+    }
+  }
+  if( FD_UNLIKELY( c!=chunk_cnt ) ) {
+    FD_LOG_WARNING(( "Restore \"%s\" to wksp \"%s\" failed due to checkpt format error (chunk_cnt)", path, wksp->name ));
+    goto done;
+  }
+
+  /* Open the bases this checkpt uses and check they are the ones it
+     was derived from */
+
+  for( ulong f=0UL; f<base_cnt; f++ ) {
+    if( !file_used[ f ] ) continue;
+    char const * base = meta->base[ f ].path;
+    file_fd[ f ] = open( base, O_RDONLY, (mode_t)0 );
+    if( FD_UNLIKELY( file_fd[ f ]==-1 ) ) {
+      FD_LOG_WARNING(( "Restore \"%s\" to wksp \"%s\" failed because open(\"%s\",O_RDONLY,0) failed (%i-%s)",
+                       path, wksp->name, base, errno, fd_io_strerror( errno ) ));
+      goto done;
+    }
+    fd_wksp_private_paged_hdr_t base_hdr[1];
+    uint  base_seed;
+    ulong base_part_max;
+    ulong base_data_max;
+    if( FD_UNLIKELY( fd_wksp_private_paged_hdr_read( file_fd[ f ], base, base_hdr, &base_seed, &base_part_max, &base_data_max ) ) )
+      goto done; /* logs details */
+    if( FD_UNLIKELY( base_hdr->id!=meta->base[ f ].id ) ) {
+      FD_LOG_WARNING(( "Restore \"%s\" to wksp \"%s\" failed because base \"%s\" was replaced", path, wksp->name, base ));
+      goto done;
+    }
+    file_lo[ f ] = base_hdr->data_off;
+    file_hi[ f ] = base_hdr->file_sz;
+  }
+
+  for( c=0UL; c<chunk_cnt; c++ ) {
+    ulong f   = (ulong)chunk[ c ].file_idx;
+    ulong off = chunk[ c ].file_off;
+    if( FD_UNLIKELY( !((file_lo[ f ]<=off) & (off<=file_hi[ f ]) & ((ulong)chunk[ c ].sz<=file_hi[ f ]-off)) ) ) {
+      FD_LOG_WARNING(( "Restore \"%s\" to wksp \"%s\" failed due to checkpt format error (bad chunk %lu data)", path, wksp->name, c ));
+      goto done;
+    }
+  }
+
+  /* Read the chunks into the wksp and record the allocations */
+
+  *_dirty = 1;
+
+# if FD_HAS_DEEPASAN
+  for( ulong p=0UL; p<part_cnt; p++ ) {
+    /* Poison the restored allocations as fd_wksp_restore does */
+    ulong laddr_lo = (ulong)fd_wksp_laddr_fast( wksp, part[ p ].gaddr_lo );
+    ulong laddr_hi = laddr_lo + (part[ p ].gaddr_hi - part[ p ].gaddr_lo);
+    ulong aligned_laddr_lo = fd_ulong_align_up( laddr_lo, FD_ASAN_ALIGN );
+    ulong aligned_laddr_hi = fd_ulong_align_dn( laddr_hi, FD_ASAN_ALIGN );
+    if( aligned_laddr_lo < aligned_laddr_hi ) {
+      fd_asan_poison( (void*)aligned_laddr_lo, aligned_laddr_hi - aligned_laddr_lo );
+    }
+  }
+# endif
+
+  fd_wksp_private_paged_args_t args[1];
+  args->op       = PAGED_OP_READ;
+  args->wksp     = wksp;
+  args->chunk    = chunk;
+  args->self_idx = base_cnt;
+  args->fd       = file_fd;
+
+  int io_err = fd_wksp_private_paged_exec( tpool, t0, t1, args, chunk_cnt );
+  if( FD_UNLIKELY( io_err ) ) {
+    FD_LOG_WARNING(( "Restore \"%s\" to wksp \"%s\" failed because of I/O error (%i-%s)",
+                     path, wksp->name, io_err, io_err<0 ? "unexpected EOF" : fd_io_strerror( io_err ) ));
+    goto done;
+  }
+
+  for( ulong p=0UL; p<part_cnt; p++ ) {
+    wksp_pinfo[ p ].gaddr_lo = part[ p ].gaddr_lo;
+    wksp_pinfo[ p ].gaddr_hi = part[ p ].gaddr_hi;
+    wksp_pinfo[ p ].tag      = part[ p ].tag;
+  }
+  for( ulong p=part_cnt; p<wksp_part_max; p++ ) wksp_pinfo[ p ].tag = 0UL; /* Remove all remaining old allocations */
+
+  if( FD_UNLIKELY( fd_wksp_rebuild( wksp, new_seed ) ) ) { /* logs details */
+    FD_LOG_WARNING(( "Restore \"%s\" to wksp \"%s\" failed because of rebuild error", path, wksp->name ));
+    goto done;
+  }
+
+  *_dirty = 0;
+  err     = FD_WKSP_SUCCESS;
+
+done:
+  for( ulong f=0UL; f<base_cnt; f++ )
+    if( file_fd[ f ]!=-1 && FD_UNLIKELY( close( file_fd[ f ] ) ) )
+      FD_LOG_WARNING(( "close(\"%s\") failed (%i-%s); attempting to continue", meta->base[ f ].path, errno, fd_io_strerror( errno ) ));
+  fd_wksp_private_paged_meta_delete( meta );
+  return err;
+}
+
+int
+fd_wksp_restore_tpool( fd_tpool_t * tpool,
+                       ulong        t0,
+                       ulong        t1,
+                       fd_wksp_t *  wksp,
+                       char const * path,
+                       uint         new_seed ) {
+
+  if( FD_UNLIKELY( !wksp ) ) {
+    FD_LOG_WARNING(( "NULL wksp" ));
+    return FD_WKSP_ERR_INVAL;
+  }
+
+  if( FD_UNLIKELY( !path ) ) {
+    FD_LOG_WARNING(( "NULL path" ));
+    return FD_WKSP_ERR_INVAL;
+  }
+
+  int fd = open( path, O_RDONLY, (mode_t)0 );
+  if( FD_UNLIKELY( fd==-1 ) ) {
+    FD_LOG_WARNING(( "open(\"%s\",O_RDONLY,0) failed (%i-%s)", path, errno, fd_io_strerror( errno ) ));
+    return FD_WKSP_ERR_FAIL;
+  }
+
+  /* Other styles are restored by fd_wksp_restore (which also handles
+     any errors reading the style) */
+
+  uchar preamble[ 18 ];
+  ulong magic = 0UL;
+  ulong style = 0UL;
+  if( !fd_wksp_private_paged_pread( fd, preamble, 18UL, 0UL ) ) fd_ulong_svw_dec( fd_ulong_svw_dec( preamble, &magic ), &style );
+
+  if( (magic!=FD_WKSP_MAGIC) | (style!=(ulong)FD_WKSP_CHECKPT_STYLE_PAGED) ) {
+    if( FD_UNLIKELY( close( fd ) ) )
+      FD_LOG_WARNING(( "close(\"%s\") failed (%i-%s); attempting to continue", path, errno, fd_io_strerror( errno ) ));
+    return fd_wksp_restore( wksp, path, new_seed );
+  }
+
+  FD_LOG_INFO(( "Restore checkpt \"%s\" into wksp \"%s\" (seed %u)", path, wksp->name, new_seed ));
+
+  int err = fd_wksp_private_lock( wksp ); /* logs details */
+  if( FD_LIKELY( !err ) ) {
+    int dirty;
+    err = fd_wksp_private_restore_paged( tpool, t0, t1, wksp, fd, path, new_seed, &dirty ); /* logs details */
+    if( dirty ) {
+      FD_LOG_WARNING(( "wksp \"%s\" dirty; attempting to reset it and continue", wksp->name ));
+      fd_wksp_private_pinfo_t * wksp_pinfo = fd_wksp_private_pinfo( wksp );
+      for( ulong i=0UL; i<wksp->part_max; i++ ) wksp_pinfo[ i ].tag = 0UL;
+      fd_wksp_rebuild( wksp, new_seed ); /* logs details */
+      err = FD_WKSP_ERR_CORRUPT;
+    }
+    fd_wksp_private_unlock( wksp );
+  }
+
+  if( FD_UNLIKELY( close( fd ) ) )
+    FD_LOG_WARNING(( "close(\"%s\") failed (%i-%s); attempting to continue", path, errno, fd_io_strerror( errno ) ));
+
+  return err;
+}
@@ -596,6 +596,24 @@ fd_wksp_private_restore_buf( fd_io_buffered_istream_t * in,
                              ulong                      buf_max,
                              ulong *                    _buf_sz );
 
+/* fd_wksp_private_restore_paged restores the FD_WKSP_CHECKPT_STYLE_PAGED
+   checkpt open as fd at path into wksp as described in
+   fd_wksp_restore_tpool.  Assumes the caller has the wksp lock and
+   tpool / t0 / t1 are as described there.  Returns FD_WKSP_SUCCESS on
+   success and a FD_WKSP_ERR_* on failure (logs details).  On return,
+   *_dirty will be non-zero if the wksp partitions were modified and
+   the restore failed (the caller should reset wksp in this case). */
+
+int
+fd_wksp_private_restore_paged( fd_tpool_t * tpool,
+                               ulong        t0,
+                               ulong        t1,
+                               fd_wksp_t *  wksp,
+                               int          fd,
+                               char const * path,
+                               uint         new_seed,
+                               int *        _dirty );
+
 FD_PROTOTYPES_END
 
 #endif /* HEADER_fd_src_util_wksp_fd_wksp_private_h */
@@ -0,0 +1,299 @@
+#include "../fd_util.h"
+
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+
+/* test_wksp_checkpt tests RAW and PAGED checkpts (full, incremental
+   and chains of incrementals) round trip through restore, that PAGED
+   restores detect replaced bases and benchmarks checkpt and restore
+   throughput.  Run with more tiles (e.g. --tile-cpus 1-8) to use a
+   tpool for the PAGED checkpts and restores.  Note that the files are
+   likely to stay in the page cache, so the benchmark mostly measures
+   the cost of the formats themselves. */
+
+#define ALLOC_MAX (4096UL)
+
+struct alloc {
+  ulong gaddr;
+  ulong sz;
+  ulong tag;
+  ulong seed;
+};
+
+typedef struct alloc alloc_t;
+
+struct state {
+  ulong   alloc_cnt;
+  alloc_t alloc[ ALLOC_MAX ];
+};
+
+typedef struct state state_t;
+
+static state_t state[ 3 ];
+
+static uchar tpool_mem[ FD_TPOOL_FOOTPRINT( FD_TILE_MAX ) ] __attribute__((aligned(FD_TPOOL_ALIGN)));
+
+static void
+fill( fd_wksp_t *     wksp,
+      alloc_t const * a ) {
+  ulong * p = (ulong *)fd_wksp_laddr_fast( wksp, a->gaddr );
+  for( ulong i=0UL; i<a->sz/8UL; i++ ) p[ i ] = a->seed + i*0x9e3779b97f4a7c15UL;
+}
+
+/* used_sz returns the number of bytes in allocated partitions */
+
+static ulong
+used_sz( fd_wksp_t * wksp ) {
+  fd_wksp_usage_t usage[1];
+  FD_TEST( fd_wksp_usage( wksp, NULL, 0UL, usage )==usage );
+  return usage->total_sz - usage->free_sz;
+}
+
+static void
+verify( fd_wksp_t *     wksp,
+        state_t const * s ) {
+  fd_wksp_usage_t usage[1];
+  FD_TEST( fd_wksp_usage( wksp, NULL, 0UL, usage )==usage );
+  FD_TEST( usage->total_cnt-usage->free_cnt==s->alloc_cnt );
+  FD_TEST( !fd_wksp_verify( wksp ) );
+  for( ulong j=0UL; j<s->alloc_cnt; j++ ) {
+    alloc_t const * a = s->alloc + j;
+    FD_TEST( fd_wksp_tag( wksp, a->gaddr )==a->tag );
+    ulong const * p = (ulong const *)fd_wksp_laddr_fast( wksp, a->gaddr );
+    for( ulong i=0UL; i<a->sz/8UL; i++ ) FD_TEST( p[ i ]==a->seed + i*0x9e3779b97f4a7c15UL );
+  }
+}
+
+static void
+alloc_new( fd_wksp_t * wksp,
+           state_t *   s,
+           fd_rng_t *  rng,
+           ulong       data_max ) {
+  ulong r  = fd_rng_ulong( rng );
+  ulong sz = 8UL*( 1UL + fd_rng_ulong_roll( rng, fd_ulong_if( !(r&63UL), (8UL<<20)/8UL, (64UL<<10)/8UL ) ) );
+  sz = fd_ulong_min( sz, data_max/16UL );
+  alloc_t * a = s->alloc + s->alloc_cnt;
+  a->gaddr = fd_wksp_alloc( wksp, 8UL, sz, 1UL + fd_rng_ulong_roll( rng, 1000UL ) );
+  if( !a->gaddr ) return;
+  a->sz   = sz;
+  a->tag  = fd_wksp_tag( wksp, a->gaddr );
+  a->seed = fd_rng_ulong( rng );
+  fill( wksp, a );
+  s->alloc_cnt++;
+}
+
+/* mutate changes about 5% of the allocations, frees a few and allocates
+   a few new ones */
+
+static void
+mutate( fd_wksp_t * wksp,
+        state_t *   s,
+        fd_rng_t *  rng,
+        ulong       data_max ) {
+  for( ulong j=0UL; j<s->alloc_cnt; j++ ) {
+    uint r = fd_rng_uint_roll( rng, 100U );
+    if( r<5U ) { s->alloc[ j ].seed = fd_rng_ulong( rng ); fill( wksp, s->alloc + j ); }
+    else if( r<6U ) { fd_wksp_free( wksp, s->alloc[ j ].gaddr ); s->alloc[ j ] = s->alloc[ --s->alloc_cnt ]; j--; }
+  }
+  for( ulong rem=s->alloc_cnt/50UL; rem && s->alloc_cnt<ALLOC_MAX; rem-- ) alloc_new( wksp, s, rng, data_max );
+}
+
+static ulong
+file_sz( char const * path ) {
+  struct stat st[1];
+  FD_TEST( !stat( path, st ) );
+  return (ulong)st->st_size;
+}
+
+static void
+log_bench( char const * op,
+           ulong        sz,
+           ulong        file_sz,
+           long         dt ) {
+  FD_LOG_NOTICE(( "%-36s %10.1f MiB in %8.3f ms (%8.1f MiB/s) file %10.1f MiB", op,
+                  (double)sz/(double)(1UL<<20), 1e-6*(double)dt, ((double)sz/(double)(1UL<<20)) / (1e-9*(double)dt),
+                  (double)file_sz/(double)(1UL<<20) ));
+}
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+
+  char const * _page_sz = fd_env_strip_cmdline_cstr ( &argc, &argv, "--page-sz",  NULL, "gigantic"                   );
+  ulong        page_cnt = fd_env_strip_cmdline_ulong( &argc, &argv, "--page-cnt", NULL, 1UL                          );
+  ulong        numa_idx = fd_env_strip_cmdline_ulong( &argc, &argv, "--numa-idx", NULL, fd_shmem_numa_idx( fd_log_cpu_id() ) );
+  ulong        data_mb  = fd_env_strip_cmdline_ulong( &argc, &argv, "--data-mb",  NULL, 64UL                         );
+  char const * prefix   = fd_env_strip_cmdline_cstr ( &argc, &argv, "--prefix",   NULL, "/tmp/test_wksp_checkpt"     );
+
+  ulong page_sz = fd_cstr_to_shmem_page_sz( _page_sz );
+  if( FD_UNLIKELY( !page_sz ) ) FD_LOG_ERR(( "unsupported --page-sz" ));
+
+  ulong data_max = data_mb<<20;
+  ulong part_max = fd_wksp_part_max_est( data_max, 4096UL );
+  page_cnt = fd_ulong_max( page_cnt, fd_ulong_align_up( fd_wksp_footprint( part_max, data_max ), page_sz ) / page_sz );
+
+  ulong tile_cnt = fd_tile_cnt();
+  FD_LOG_NOTICE(( "Testing with --page-sz %s --page-cnt %lu --numa-idx %lu --data-mb %lu --prefix %s on %lu tile(s)",
+                  _page_sz, page_cnt, numa_idx, data_mb, prefix, tile_cnt ));
+
+  fd_wksp_t * wksp = fd_wksp_new_anonymous( page_sz, page_cnt, fd_shmem_cpu_idx( numa_idx ), "wksp", part_max );
+  FD_TEST( wksp );
+
+  fd_tpool_t * tpool = NULL;
+  if( tile_cnt>1UL ) {
+    tpool = fd_tpool_init( tpool_mem, tile_cnt );
+    FD_TEST( tpool );
+    for( ulong t=1UL; t<tile_cnt; t++ ) FD_TEST( fd_tpool_worker_push( tpool, t, NULL, 0UL ) );
+  }
+
+  fd_rng_t _rng[1]; fd_rng_t * rng = fd_rng_join( fd_rng_new( _rng, 0U, 0UL ) );
+
+  char path_raw [ 256 ]; fd_cstr_printf( path_raw,  256UL, NULL, "%s.%lu.raw",   prefix, fd_log_group_id() );
+  char path_full[ 256 ]; fd_cstr_printf( path_full, 256UL, NULL, "%s.%lu.full",  prefix, fd_log_group_id() );
+  char path_inc1[ 256 ]; fd_cstr_printf( path_inc1, 256UL, NULL, "%s.%lu.inc1",  prefix, fd_log_group_id() );
+  char path_inc2[ 256 ]; fd_cstr_printf( path_inc2, 256UL, NULL, "%s.%lu.inc2",  prefix, fd_log_group_id() );
+  char path_tmp [ 256 ]; fd_cstr_printf( path_tmp,  256UL, NULL, "%s.%lu.tmp",   prefix, fd_log_group_id() );
+  unlink( path_raw ); unlink( path_full ); unlink( path_inc1 ); unlink( path_inc2 ); unlink( path_tmp );
+
+  /* Populate the wksp about half full */
+
+  state_t * s = state;
+  do {
+    alloc_new( wksp, s, rng, data_max );
+  } while( s->alloc_cnt<ALLOC_MAX && used_sz( wksp )<data_max/2UL );
+  verify( wksp, s );
+  ulong sz = used_sz( wksp );
+  FD_LOG_NOTICE(( "%lu allocations, %lu bytes", s->alloc_cnt, sz ));
+
+  long dt;
+
+  /* Full checkpts */
+
+  dt = -fd_log_wallclock();
+  FD_TEST( !fd_wksp_checkpt( wksp, path_raw, 0600UL, FD_WKSP_CHECKPT_STYLE_RAW, "raw" ) );
+  dt += fd_log_wallclock();
+  log_bench( "checkpt raw", sz, file_sz( path_raw ), dt );
+
+  dt = -fd_log_wallclock();
+  FD_TEST( !fd_wksp_checkpt( wksp, path_tmp, 0600UL, FD_WKSP_CHECKPT_STYLE_PAGED, "paged" ) );
+  dt += fd_log_wallclock();
+  log_bench( "checkpt paged (serial)", sz, file_sz( path_tmp ), dt );
+  FD_TEST( fd_wksp_checkpt( wksp, path_tmp, 0600UL, FD_WKSP_CHECKPT_STYLE_PAGED, "paged" )==FD_WKSP_ERR_FAIL ); /* exists */
+  FD_TEST( !unlink( path_tmp ) );
+
+  dt = -fd_log_wallclock();
+  FD_TEST( !fd_wksp_checkpt_tpool( tpool, 0UL, tile_cnt, wksp, path_full, 0600UL, NULL, "full" ) );
+  dt += fd_log_wallclock();
+  log_bench( "checkpt paged (tpool)", sz, file_sz( path_full ), dt );
+  FD_TEST( file_sz( path_full )>sz );
+
+  uint  seed;
+  ulong preview_part_max;
+  ulong preview_data_max;
+  FD_TEST( !fd_wksp_restore_preview( path_full, &seed, &preview_part_max, &preview_data_max ) );
+  FD_TEST( preview_part_max==fd_wksp_part_max( wksp ) );
+  FD_TEST( preview_data_max==fd_wksp_data_max( wksp ) );
+
+  /* Incremental checkpts */
+
+  state[ 1 ] = state[ 0 ];
+  s = state + 1;
+  mutate( wksp, s, rng, data_max );
+  verify( wksp, s );
+  sz = used_sz( wksp );
+
+  dt = -fd_log_wallclock();
+  FD_TEST( !fd_wksp_checkpt_tpool( tpool, 0UL, tile_cnt, wksp, path_inc1, 0600UL, path_full, "inc1" ) );
+  dt += fd_log_wallclock();
+  log_bench( "checkpt paged incremental (tpool)", sz, file_sz( path_inc1 ), dt );
+  FD_TEST( file_sz( path_inc1 )<file_sz( path_full ) );
+
+  state[ 2 ] = state[ 1 ];
+  s = state + 2;
+  mutate( wksp, s, rng, data_max );
+  verify( wksp, s );
+  sz = used_sz( wksp );
+
+  FD_TEST( !fd_wksp_checkpt_tpool( tpool, 0UL, tile_cnt, wksp, path_inc2, 0600UL, path_inc1, "inc2" ) );
+  FD_TEST( file_sz( path_inc2 )<file_sz( path_full ) );
+
+  /* An incremental checkpt of an unchanged wksp has no data */
+
+  FD_TEST( !fd_wksp_checkpt_tpool( tpool, 0UL, tile_cnt, wksp, path_tmp, 0600UL, path_inc2, NULL ) );
+  FD_TEST( fd_ulong_is_aligned( file_sz( path_tmp ), 4096UL ) );
+  FD_TEST( !fd_wksp_restore_tpool( tpool, 0UL, tile_cnt, wksp, path_tmp, 5678U ) );
+  verify( wksp, state + 2 );
+  FD_TEST( !unlink( path_tmp ) );
+
+  /* Restores (clobber the wksp between them) */
+
+  sz = 0UL;
+  for( ulong j=0UL; j<state[ 0 ].alloc_cnt; j++ ) sz += state[ 0 ].alloc[ j ].sz;
+
+  fd_wksp_reset( wksp, 1U );
+  dt = -fd_log_wallclock();
+  FD_TEST( !fd_wksp_restore( wksp, path_raw, 1234U ) );
+  dt += fd_log_wallclock();
+  log_bench( "restore raw", sz, file_sz( path_raw ), dt );
+  verify( wksp, state );
+
+  fd_wksp_reset( wksp, 1U );
+  dt = -fd_log_wallclock();
+  FD_TEST( !fd_wksp_restore( wksp, path_full, 1234U ) );
+  dt += fd_log_wallclock();
+  log_bench( "restore paged (serial)", sz, file_sz( path_full ), dt );
+  verify( wksp, state );
+
+  fd_wksp_reset( wksp, 1U );
+  dt = -fd_log_wallclock();
+  FD_TEST( !fd_wksp_restore_tpool( tpool, 0UL, tile_cnt, wksp, path_full, 1234U ) );
+  dt += fd_log_wallclock();
+  log_bench( "restore paged (tpool)", sz, file_sz( path_full ), dt );
+  verify( wksp, state );
+
+  FD_TEST( !fd_wksp_restore_tpool( tpool, 0UL, tile_cnt, wksp, path_raw, 2345U ) ); /* Other styles fall back */
+  verify( wksp, state );
+
+  sz = 0UL;
+  for( ulong j=0UL; j<state[ 2 ].alloc_cnt; j++ ) sz += state[ 2 ].alloc[ j ].sz;
+
+  fd_wksp_reset( wksp, 1U );
+  dt = -fd_log_wallclock();
+  FD_TEST( !fd_wksp_restore_tpool( tpool, 0UL, tile_cnt, wksp, path_inc2, 1234U ) );
+  dt += fd_log_wallclock();
+  log_bench( "restore paged incremental (tpool)", sz, file_sz( path_inc2 ), dt );
+  verify( wksp, state + 2 );
+
+  fd_wksp_reset( wksp, 1U );
+  FD_TEST( !fd_wksp_restore( wksp, path_inc1, 1234U ) );
+  verify( wksp, state + 1 );
+
+  /* Incompatible wksps and replaced bases fail without touching the
+     wksp */
+
+  fd_wksp_t * small = fd_wksp_new_anonymous( page_sz, 1UL, fd_shmem_cpu_idx( numa_idx ), "small", 4UL );
+  FD_TEST( small );
+  FD_TEST( fd_wksp_restore_tpool( tpool, 0UL, tile_cnt, small, path_inc1, 1234U )==FD_WKSP_ERR_FAIL );
+  fd_wksp_delete_anonymous( small );
+
+  FD_TEST( !truncate( path_inc2, (off_t)(file_sz( path_inc2 )-1UL) ) );
+  FD_TEST( fd_wksp_restore_tpool( tpool, 0UL, tile_cnt, wksp, path_inc2, 1234U )==FD_WKSP_ERR_FAIL );
+  verify( wksp, state + 1 );
+
+  FD_TEST( !unlink( path_full ) );
+  FD_TEST( !fd_wksp_checkpt_tpool( tpool, 0UL, tile_cnt, wksp, path_full, 0600UL, NULL, "replaced" ) );
+  FD_TEST( fd_wksp_restore_tpool( tpool, 0UL, tile_cnt, wksp, path_inc1, 1234U )==FD_WKSP_ERR_FAIL );
+  verify( wksp, state + 1 );
+
+  unlink( path_raw ); unlink( path_full ); unlink( path_inc1 ); unlink( path_inc2 );
+
+  fd_rng_delete( fd_rng_leave( rng ) );
+  if( tpool ) fd_tpool_fini( tpool );
+  fd_wksp_delete_anonymous( wksp );
+
+  FD_LOG_NOTICE(( "pass" ));
+  fd_halt();
+  return 0;
+}
@@ -1,6 +1,6 @@
 $(call make-lib,fd_quic)
 $(call add-objs,fd_quic fd_quic_conn fd_quic_conn_id fd_quic_conn_map fd_quic_proto \
  fd_quic_stream_pool   fd_quic_stream tls/fd_quic_tls crypto/fd_quic_crypto_suites templ/fd_quic_transport_params \
-  templ/fd_quic_parse_util fd_quic_pkt_meta,fd_quic)
+  templ/fd_quic_parse_util fd_quic_pkt_meta fd_quic_timer_wheel fd_quic_cc,fd_quic)
 $(call make-bin,fd_quic_ctl,fd_quic_ctl,fd_quic fd_tls fd_ballet fd_waltz fd_util)
 $(call add-test-scripts,test_quic_ctl)
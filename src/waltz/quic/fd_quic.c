@@ -27,12 +27,6 @@
 #define CONN_ID(CONN_ID) (CONN_ID)->conn_id[0], (CONN_ID)->conn_id[1], (CONN_ID)->conn_id[2], (CONN_ID)->conn_id[3],  \
                          (CONN_ID)->conn_id[4], (CONN_ID)->conn_id[5], (CONN_ID)->conn_id[6], (CONN_ID)->conn_id[7]
 
-/* Declare priority queue for time based processing */
-#define PRQ_NAME      service_queue
-#define PRQ_T         fd_quic_event_t
-#define PRQ_TIMEOUT_T ulong
-#include "../../util/tmpl/fd_prq.c"
-
 /* Declare map type for stream_id -> stream* */
 #define MAP_NAME              fd_quic_stream_map
 #define MAP_KEY               stream_id
@@ -72,7 +66,7 @@ struct fd_quic_layout {
   ulong conns_off;       /* offset of connection mem region  */
   ulong conn_footprint;  /* sizeof a conn                    */
   ulong conn_map_off;    /* offset of conn map mem region    */
-  ulong event_queue_off; /* offset of event queue mem region */
+  ulong svc_wheel_off;   /* offset of service timer wheel    */
   int   lg_slot_cnt;     /* see conn_map_new                 */
   ulong tls_off;         /* offset of fd_quic_tls_t          */
   ulong stream_pool_off; /* offset of the stream pool        */
@@ -135,12 +129,12 @@ fd_quic_footprint_ext( fd_quic_limits_t const * limits,
   if( FD_UNLIKELY( !conn_map_footprint ) ) { FD_LOG_WARNING(( "invalid fd_quic_conn_map_footprint" )); return 0UL; }
   offs                    += conn_map_footprint;
 
-  /* allocate space for events priority queue */
-  offs                        = fd_ulong_align_up( offs, service_queue_align() );
-  layout->event_queue_off     = offs;
-  ulong event_queue_footprint = service_queue_footprint( conn_cnt + 1 );
-  if( FD_UNLIKELY( !event_queue_footprint ) ) { FD_LOG_WARNING(( "invalid service_queue_footprint" )); return 0UL; }
-  offs                       += event_queue_footprint;
+  /* allocate space for the service timer wheel */
+  offs                      = fd_ulong_align_up( offs, fd_quic_timer_wheel_align() );
+  layout->svc_wheel_off     = offs;
+  ulong svc_wheel_footprint = fd_quic_timer_wheel_footprint( conn_cnt );
+  if( FD_UNLIKELY( !svc_wheel_footprint ) ) { FD_LOG_WARNING(( "invalid fd_quic_timer_wheel_footprint" )); return 0UL; }
+  offs                     += svc_wheel_footprint;
 
   /* allocate space for fd_quic_tls_t */
   offs                 = fd_ulong_align_up( offs, fd_quic_tls_align() );
@@ -360,6 +354,7 @@ fd_quic_init( fd_quic_t * quic ) {
 
   if( FD_UNLIKELY( !config->role          ) ) { FD_LOG_WARNING(( "cfg.role not set"      )); return NULL; }
   if( FD_UNLIKELY( !config->idle_timeout  ) ) { FD_LOG_WARNING(( "zero cfg.idle_timeout" )); return NULL; }
+  if( FD_UNLIKELY( (uint)config->cc_algo>=FD_QUIC_CC_ALGO_CNT ) ) { FD_LOG_WARNING(( "invalid cfg.cc_algo" )); return NULL; }
 
   do {
     ulong x = 0U;
@@ -445,13 +440,14 @@ fd_quic_init( fd_quic_t * quic ) {
     return NULL;
   }
 
-  /* State: Initialize service queue */
+  /* State: Initialize service timer wheel */
 
-  ulong  service_queue_laddr = (ulong)quic + layout.event_queue_off;
-  void * v_service_queue = service_queue_new( (void *)service_queue_laddr, limits->conn_cnt+1U );
-  state->service_queue = service_queue_join( v_service_queue );
-  if( FD_UNLIKELY( !state->service_queue ) ) {
-    FD_LOG_WARNING(( "NULL service_queue" ));
+  ulong  svc_wheel_laddr = (ulong)quic + layout.svc_wheel_off;
+  ulong  svc_wheel_now   = quic->cb.now ? fd_quic_now( quic ) : 0UL;
+  void * v_svc_wheel     = fd_quic_timer_wheel_new( (void *)svc_wheel_laddr, limits->conn_cnt, FD_QUIC_SVC_LG_TICK, svc_wheel_now );
+  state->svc_wheel = fd_quic_timer_wheel_join( v_svc_wheel );
+  if( FD_UNLIKELY( !state->svc_wheel ) ) {
+    FD_LOG_WARNING(( "NULL svc_wheel" ));
     return NULL;
   }
 
@@ -658,7 +654,8 @@ fd_quic_tx_enc_level( fd_quic_conn_t * conn, int acks ) {
         /* find stream data to send */
         fd_quic_stream_t * sentinel = conn->send_streams;
         fd_quic_stream_t * stream   = sentinel->next;
-        if( !stream->sentinel && stream->upd_pkt_number >= app_pkt_number ) {
+        if( !stream->sentinel && stream->upd_pkt_number >= app_pkt_number
+            && fd_quic_cc_can_send( &conn->cc, fd_quic_get_state( conn->quic )->now ) ) {
           return fd_quic_enc_level_appdata_id;
         }
       }
@@ -725,7 +722,8 @@ fd_quic_tx_enc_level( fd_quic_conn_t * conn, int acks ) {
   /* find stream data to send */
   fd_quic_stream_t * sentinel = conn->send_streams;
   fd_quic_stream_t * stream   = sentinel->next;
-  if( !stream->sentinel && stream->upd_pkt_number >= app_pkt_number ) {
+  if( !stream->sentinel && stream->upd_pkt_number >= app_pkt_number
+      && fd_quic_cc_can_send( &conn->cc, now ) ) {
     return fd_quic_enc_level_appdata_id;
   }
 
@@ -816,10 +814,10 @@ fd_quic_fini( fd_quic_t * quic ) {
 
   fd_quic_tls_delete( state->tls ); state->tls = NULL;
 
-  /* Delete service queue */
+  /* Delete service timer wheel */
 
-  service_queue_delete( service_queue_leave( state->service_queue ) );
-  state->service_queue = NULL;
+  fd_quic_timer_wheel_delete( fd_quic_timer_wheel_leave( state->svc_wheel ) );
+  state->svc_wheel = NULL;
 
   /* Delete conn ID map */
 
@@ -1101,6 +1099,9 @@ fd_quic_ack_enc_level( fd_quic_conn_t * conn, uint enc_level ) {
     while( pkt_meta ) {
       fd_quic_reclaim_pkt_meta( conn, pkt_meta, j );
 
+      /* no longer in flight, but says nothing about congestion */
+      fd_quic_cc_on_discard( &conn->cc, pkt_meta );
+
       /* remove from list */
       fd_quic_pkt_meta_remove( sent, prior, pkt_meta );
 
@@ -2257,37 +2258,10 @@ fd_quic_schedule_conn( fd_quic_conn_t * conn ) {
   fd_quic_t *       quic    = conn->quic;
   fd_quic_state_t * state   = fd_quic_get_state( quic );
 
-  ulong             timeout = conn->next_service_time;
-
-  /* scheduled? */
-  if( conn->in_service ) {
-    /* find conn in events, then remove, update, insert */
-    fd_quic_event_t * event     = NULL;
-    ulong             event_idx = 0;
-    ulong             cnt   = service_queue_cnt( state->service_queue );
-    for( ulong j = 0; j < cnt; ++j ) {
-      fd_quic_event_t * cur_event = state->service_queue + j;
-      if( cur_event->conn == conn ) {
-        event     = cur_event;
-        event_idx = j;
-        break;
-      }
-    }
+  ulong             timeout = fd_ulong_max( conn->next_service_time, state->now + 1UL );
 
-    if( FD_LIKELY( event ) ) {
-      /* remove key */
-      service_queue_remove( state->service_queue, event_idx );
-
-      /* TODO can use a priority queue key-reduce operation, which may be done more
-         quickly than remove, insert */
-    }
-  }
-
-  timeout = fd_ulong_max( timeout, state->now + 1UL );
-
-  /* insert key */
-  fd_quic_event_t event[1] = {{ .timeout = timeout, .conn = conn }};
-  service_queue_insert( state->service_queue, event );
+  /* (re)insert key, replacing the current deadline if scheduled */
+  fd_quic_timer_wheel_schedule( state->svc_wheel, conn->conn_idx, timeout );
 
   conn->sched_service_time = timeout;
   conn->next_service_time  = timeout;
@@ -2328,27 +2302,6 @@ fd_quic_reschedule_conn( fd_quic_conn_t * conn,
       return;
     }
 
-    /* find conn in events, then remove, update, insert */
-    fd_quic_event_t * event     = NULL;
-    ulong             event_idx = 0;
-    ulong             cnt   = service_queue_cnt( state->service_queue );
-    for( ulong j = 0; j < cnt; ++j ) {
-      fd_quic_event_t * cur_event = state->service_queue + j;
-      if( cur_event->conn == conn ) {
-        event     = cur_event;
-        event_idx = j;
-        break;
-      }
-    }
-
-    if( FD_LIKELY( event ) ) {
-      /* remove key */
-      service_queue_remove( state->service_queue, event_idx );
-
-      /* TODO can use a priority queue key-reduce operation, which may be done more
-         quickly than remove, insert */
-    }
-
     conn->next_service_time = timeout;
     fd_quic_schedule_conn( conn );
 
@@ -3339,24 +3292,19 @@ fd_quic_service( fd_quic_t * quic ) {
 
   /* service events */
   fd_quic_conn_t * conn = NULL;
-  while( service_queue_cnt( state->service_queue ) ) {
-    fd_quic_event_t * event = &state->service_queue[0];
-
-    /* copy before removing event */
-    conn = event->conn;
-
-    ulong service_time = event->timeout;
-    if( now < service_time ) {
+  for(;;) {
+    ulong conn_idx = fd_quic_timer_wheel_pop( state->svc_wheel, now );
+    if( conn_idx==FD_QUIC_TIMER_WHEEL_IDX_NULL ) {
       break;
     }
 
+    conn = fd_quic_conn_at_idx( state, conn_idx );
+
     /* set an initial next_service_time */
     conn->next_service_time = now + fd_quic_get_service_interval( quic );
 
-    /* remove event, later reinserted at new time */
-    service_queue_remove_min( state->service_queue );
-
-    /* unset "in service queue" */
+    /* unset "in service queue", event was removed by pop, later
+       reinserted at new time */
     conn->in_service = 0;
 
     if( FD_UNLIKELY( conn->state == FD_QUIC_CONN_STATE_INVALID ) ) {
@@ -4019,6 +3967,10 @@ fd_quic_conn_tx( fd_quic_t *      quic,
     /* payload_end leaves room for TAG */
     uchar * payload_end = payload_ptr + payload_sz - FD_QUIC_CRYPTO_TAG_SZ;
 
+    /* may this packet carry stream data?
+       (acks, handshake data and control frames are never held back) */
+    int cc_ok = fd_quic_cc_can_send( &conn->cc, now );
+
     /* put range of offsets into packet meta, so the data may be freed easily on
        ack */
 
@@ -4349,7 +4301,11 @@ fd_quic_conn_tx( fd_quic_t *      quic,
                                      | FD_QUIC_STREAM_FLAGS_TX_FIN;
 
               /* any stream data? */
-              if( FD_LIKELY( cur_stream->stream_flags & stream_flags_mask ) ) {
+              if( FD_UNLIKELY( !cc_ok && ( cur_stream->stream_flags & stream_flags_mask ) ) ) {
+                /* held back by congestion control, retry when the pacer
+                   allows (or when acks open the window) */
+                schedule = fd_ulong_min( schedule, fd_quic_cc_next_send( &conn->cc, now ) );
+              } else if( FD_LIKELY( cur_stream->stream_flags & stream_flags_mask ) ) {
 
                 /* how much data to send */
                 ulong stream_data_sz = cur_stream->tx_buf.head - cur_stream->tx_sent;
@@ -4572,6 +4528,8 @@ fd_quic_conn_tx( fd_quic_t *      quic,
     /* everything successful up to here
        encrypt into tx_ptr,tx_ptr+tx_sz */
 
+    uchar const * tx_pkt = conn->tx_ptr;
+
     /* TODO encrypt */
 #if FD_QUIC_DISABLE_CRYPTO
     ulong quic_pkt_sz = (ulong)( payload_ptr - cur_ptr );
@@ -4625,6 +4583,13 @@ fd_quic_conn_tx( fd_quic_t *      quic,
     pkt_meta->pn_space   = (uchar)pn_space;
     pkt_meta->enc_level  = (uchar)enc_level;
 
+    /* account for the packet in congestion control
+       ack-only packets are not counted in flight */
+    uint ack_eliciting = pkt_meta->flags & ~( FD_QUIC_PKT_META_FLAGS_ACK        |
+                                              FD_QUIC_PKT_META_FLAGS_KEY_UPDATE |
+                                              FD_QUIC_PKT_META_FLAGS_KEY_PHASE  );
+    fd_quic_cc_on_sent( &conn->cc, pkt_meta, (ulong)( conn->tx_ptr - tx_pkt ), !!ack_eliciting, now );
+
     /* update ack metadata */
     fd_quic_ack_t * cur_ack = conn->acks_tx[enc_level];
     while( cur_ack ) {
@@ -4879,11 +4844,10 @@ fd_quic_conn_free( fd_quic_t *      quic,
     }
   }
 
-  /* no need to remove this connection from the events queue
-     free is called from two places:
-       fini    - service will never be called again. All events are destroyed
-       service - removes event before calling free. Event only allowed to be
-       enqueued once */
+  /* remove from the service timer wheel (no-op when called from
+     service, which removes the deadline before calling free) */
+  fd_quic_timer_wheel_cancel( state->svc_wheel, conn->conn_idx );
+  conn->in_service = 0;
 
   /* remove all stream ids from map, and free stream */
 
@@ -5319,6 +5283,9 @@ fd_quic_conn_create( fd_quic_t *               quic,
   /* initial rtt */
   conn->rtt = (ulong)500e6;
 
+  /* congestion control */
+  fd_quic_cc_init( &conn->cc, config->cc_algo, conn->tx_max_datagram_sz );
+
   /* highest peer encryption level */
   conn->peer_enc_level = 0;
 
@@ -5350,12 +5317,7 @@ fd_quic_get_next_wakeup( fd_quic_t * quic ) {
     return state->now;
   }
 
-  ulong t = ~(ulong)0;
-  if( service_queue_cnt( state->service_queue ) ) {
-    t = state->service_queue[0].timeout;
-  }
-
-  return t;
+  return fd_quic_timer_wheel_next( state->svc_wheel );
 }
 
 /* frame handling function default definitions */
@@ -5491,6 +5453,9 @@ fd_quic_pkt_meta_retry( fd_quic_t *          quic,
                                 pkt_meta,
                                 enc_level );
 
+      /* no longer in flight, but says nothing about congestion */
+      fd_quic_cc_on_discard( &conn->cc, pkt_meta );
+
       /* remove from list */
       fd_quic_pkt_meta_remove( sent, prior, pkt_meta );
 
@@ -5504,6 +5469,9 @@ fd_quic_pkt_meta_retry( fd_quic_t *          quic,
 
     ulong pkt_number = pkt_meta->pkt_number;
 
+    /* the packet is considered lost */
+    fd_quic_cc_on_loss( &conn->cc, pkt_meta, now );
+
     /* set the data to retry */
     uint flags = pkt_meta->flags;
     if( flags & FD_QUIC_PKT_META_FLAGS_HS_DATA            ) {
@@ -6050,12 +6018,17 @@ fd_quic_process_lost( fd_quic_conn_t * conn, uint enc_level, ulong cnt ) {
 }
 
 /* process ack range
-   applies to pkt_number in [largest_ack - ack_range, largest_ack] */
+   applies to pkt_number in [largest_ack - ack_range, largest_ack]
+   rtt_sample is set for the first range of an ack frame, in which case
+   the ack of largest_ack (if newly acked) is used as an rtt sample */
 void
 fd_quic_process_ack_range( fd_quic_conn_t * conn,
                            uint             enc_level,
                            ulong            largest_ack,
-                           ulong            ack_range ) {
+                           ulong            ack_range,
+                           int              rtt_sample ) {
+  ulong now = fd_quic_get_state( conn->quic )->now;
+
   /* loop thru all packet metadata, and process individual metadata */
 
   /* inclusive range */
@@ -6081,6 +6054,12 @@ fd_quic_process_ack_range( fd_quic_conn_t * conn,
 
     /* packet number is in range, so reclaim the resources */
     if( pkt_meta->pkt_number <= hi ) {
+      if( FD_UNLIKELY( rtt_sample && pkt_meta->pkt_number == hi ) ) {
+        fd_quic_cc_rtt_sample( &conn->cc, pkt_meta, now );
+        if( conn->cc.algo != FD_QUIC_CC_ALGO_NONE ) conn->rtt = fd_quic_cc_rtt( &conn->cc );
+      }
+      fd_quic_cc_on_ack( &conn->cc, pkt_meta, now );
+
       fd_quic_reclaim_pkt_meta( conn,
                                 pkt_meta,
                                 enc_level );
@@ -6130,7 +6109,7 @@ fd_quic_frame_handle_ack_frame(
 
   /* process ack range
      applies to pkt_number in [largest_ack - first_ack_range, largest_ack] */
-  fd_quic_process_ack_range( context.conn, enc_level, data->largest_ack, data->first_ack_range );
+  fd_quic_process_ack_range( context.conn, enc_level, data->largest_ack, data->first_ack_range, 1 /* rtt_sample */ );
 
   uchar const * p_str = p;
   uchar const * p_end = p + p_sz;
@@ -6181,7 +6160,7 @@ fd_quic_frame_handle_ack_frame(
     low_ack_pkt_number = fd_ulong_min( low_ack_pkt_number, lo_pkt_number );
 
     /* process ack range */
-    fd_quic_process_ack_range( context.conn, enc_level, cur_pkt_number - skip, length );
+    fd_quic_process_ack_range( context.conn, enc_level, cur_pkt_number - skip, length, 0 );
 
     /* Find the next lowest processed and acknowledged packet number
        This should get us to the next lowest processed and acknowledged packet
@@ -6210,6 +6189,12 @@ fd_quic_frame_handle_ack_frame(
     }
   }
 
+  /* acks may have opened the congestion window for held back data */
+  if( context.conn->cc.algo != FD_QUIC_CC_ALGO_NONE ) {
+    ulong next_send = fd_quic_cc_next_send( &context.conn->cc, fd_quic_get_state( context.quic )->now );
+    if( next_send != ULONG_MAX ) fd_quic_reschedule_conn( context.conn, next_send );
+  }
+
   /* ECN counts
      we currently ignore them, but we must process them to get to the following bytes */
   if( data->type & 1U ) {
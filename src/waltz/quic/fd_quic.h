@@ -159,6 +159,11 @@ struct __attribute__((aligned(16UL))) fd_quic_config {
    /* retry: whether address validation using retry packets is enabled (RFC 9000, Section 8.1.2) */
   int retry;
 
+  /* cc_algo: congestion controller used by conns, one of
+     FD_QUIC_CC_ALGO_{NONE,NEWRENO,CUBIC,BBR}.  Mostly useful for
+     clients sending over lossy or congested links. */
+  int cc_algo;
+
   /* TLS config ********************************************/
 
   /* identity_key: Ed25519 public key of node identity */
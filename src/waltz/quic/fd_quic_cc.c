@@ -0,0 +1,275 @@
+#include "fd_quic_cc.h"
+
+#include <math.h>
+
+/* CUBIC constants (RFC 9438 Section 4) */
+
+#define CUBIC_C     (0.4)
+#define CUBIC_BETA  (0.7)
+#define CUBIC_ALPHA (3.0*(1.0-CUBIC_BETA)/(1.0+CUBIC_BETA))
+
+/* BBR gains */
+
+#define BBR_HIGH_GAIN (2.885) /* 2/ln(2) */
+
+static double const bbr_cycle_gain[ 8 ] = { 1.25, 0.75, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0 };
+
+void
+fd_quic_cc_init( fd_quic_cc_t * cc,
+                 int            algo,
+                 ulong          mss ) {
+  memset( cc, 0, sizeof(fd_quic_cc_t) );
+  cc->algo        = algo;
+  cc->mss         = mss;
+  cc->cwnd        = FD_QUIC_CC_INITIAL_WINDOW * mss;
+  cc->ssthresh    = ULONG_MAX;
+  cc->bbr_state   = FD_QUIC_CC_BBR_STATE_STARTUP;
+  cc->pacing_gain = BBR_HIGH_GAIN;
+  cc->cwnd_gain   = BBR_HIGH_GAIN;
+}
+
+/* fd_quic_cc_set_pace_rate derives the pacing rate from the current
+   window (NewReno, CUBIC) or bandwidth model (BBR). */
+
+static void
+fd_quic_cc_set_pace_rate( fd_quic_cc_t * cc ) {
+  double srtt = (double)( cc->srtt ? cc->srtt : FD_QUIC_CC_INITIAL_RTT );
+  if( cc->algo==FD_QUIC_CC_ALGO_BBR && cc->btl_bw>0.0 ) {
+    cc->pace_rate = cc->pacing_gain * cc->btl_bw;
+  } else {
+    double gain = cc->algo==FD_QUIC_CC_ALGO_BBR ? cc->pacing_gain : 1.25;
+    cc->pace_rate = gain * (double)cc->cwnd / srtt;
+  }
+}
+
+void
+fd_quic_cc_on_sent( fd_quic_cc_t *       cc,
+                    fd_quic_pkt_meta_t * pkt_meta,
+                    ulong                sz,
+                    int                  in_flight,
+                    ulong                now ) {
+  pkt_meta->tx_time = now;
+  pkt_meta->tx_sz   = 0UL;
+  if( FD_LIKELY( cc->algo==FD_QUIC_CC_ALGO_NONE ) | !in_flight ) return;
+
+  /* restart the delivery rate interval after an idle period */
+  if( !cc->inflight ) cc->delivered_time = now;
+
+  pkt_meta->tx_sz             = sz;
+  pkt_meta->tx_delivered      = cc->delivered;
+  pkt_meta->tx_delivered_time = cc->delivered_time;
+  cc->inflight               += sz;
+
+  if( FD_LIKELY( cc->pace_rate>0.0 ) ) {
+    /* allow a burst of FD_QUIC_CC_PACE_BURST packets after idling */
+    ulong burst = (ulong)( (double)( FD_QUIC_CC_PACE_BURST*cc->mss ) / cc->pace_rate );
+    ulong base  = fd_ulong_max( cc->pace_next, now - fd_ulong_min( burst, now ) );
+    cc->pace_next = base + (ulong)( (double)sz / cc->pace_rate );
+  }
+}
+
+void
+fd_quic_cc_rtt_sample( fd_quic_cc_t *             cc,
+                       fd_quic_pkt_meta_t const * pkt_meta,
+                       ulong                      now ) {
+  if( FD_LIKELY( cc->algo==FD_QUIC_CC_ALGO_NONE ) ) return;
+
+  /* The ack delay reported by the peer is not subtracted, so samples
+     include the peer's ack delay (fd_quic peers do not encode
+     ack_delay using the ack_delay_exponent). */
+  ulong latest = now - fd_ulong_min( pkt_meta->tx_time, now );
+  latest = fd_ulong_max( latest, 1UL );
+
+  if( FD_UNLIKELY( !cc->srtt ) ) {
+    cc->srtt         = latest;
+    cc->rttvar       = latest>>1;
+    cc->min_rtt      = latest;
+    cc->min_rtt_time = now;
+  } else {
+    if( latest<=cc->min_rtt || now-cc->min_rtt_time>FD_QUIC_CC_BBR_MIN_RTT_WIN ) {
+      cc->min_rtt      = latest;
+      cc->min_rtt_time = now;
+    }
+    ulong dev  = fd_ulong_max( cc->srtt, latest ) - fd_ulong_min( cc->srtt, latest );
+    cc->rttvar = ( 3UL*cc->rttvar + dev ) >> 2;
+    cc->srtt   = ( 7UL*cc->srtt + latest ) >> 3;
+  }
+
+  if( cc->algo!=FD_QUIC_CC_ALGO_BBR ) fd_quic_cc_set_pace_rate( cc );
+}
+
+/* fd_quic_cc_cubic_on_ack grows the window in congestion avoidance
+   according to RFC 9438 Section 4.2 - 4.4 */
+
+static void
+fd_quic_cc_cubic_on_ack( fd_quic_cc_t * cc,
+                         ulong          acked,
+                         ulong          now ) {
+  double mss  = (double)cc->mss;
+  double cwnd = (double)cc->cwnd;
+
+  if( !cc->epoch_start ) {
+    cc->epoch_start = now;
+    if( cwnd<cc->w_max ) {
+      cc->k = cbrt( ( cc->w_max - cwnd ) / mss / CUBIC_C );
+    } else {
+      cc->k     = 0.0;
+      cc->w_max = cwnd;
+    }
+    cc->w_est = cwnd;
+  }
+
+  double t      = (double)( now - cc->epoch_start + cc->srtt ) * 1e-9;
+  double dt     = t - cc->k;
+  double target = cc->w_max + CUBIC_C * dt*dt*dt * mss;
+  target = fmin( fmax( target, cwnd ), 1.5*cwnd );
+
+  /* Reno-friendly region */
+  cc->w_est += CUBIC_ALPHA * mss * (double)acked / cwnd;
+  target = fmax( target, cc->w_est );
+
+  cc->cwnd += (ulong)( ( target - cwnd ) * (double)acked / cwnd );
+}
+
+/* fd_quic_cc_bbr_on_ack updates the bandwidth model, the state machine
+   and the window from the ack of pkt_meta */
+
+static void
+fd_quic_cc_bbr_on_ack( fd_quic_cc_t *             cc,
+                       fd_quic_pkt_meta_t const * pkt_meta,
+                       ulong                      now ) {
+  /* round trip accounting: a round ends when a packet sent after the
+     start of the round is acked */
+  int round_start = 0;
+  if( pkt_meta->tx_delivered>=cc->round_delivered ) {
+    cc->round_delivered = cc->delivered;
+    cc->round_cnt++;
+    cc->bw[ cc->round_cnt % FD_QUIC_CC_BBR_BW_WIN ] = 0.0;
+    round_start = 1;
+  }
+
+  /* delivery rate sample */
+  ulong interval = now - fd_ulong_min( pkt_meta->tx_delivered_time, now );
+  if( FD_LIKELY( interval ) ) {
+    double rate = (double)( cc->delivered - pkt_meta->tx_delivered ) / (double)interval;
+    double * bw = &cc->bw[ cc->round_cnt % FD_QUIC_CC_BBR_BW_WIN ];
+    *bw = fmax( *bw, rate );
+  }
+  double btl_bw = 0.0;
+  for( ulong j=0UL; j<FD_QUIC_CC_BBR_BW_WIN; j++ ) btl_bw = fmax( btl_bw, cc->bw[ j ] );
+  cc->btl_bw = btl_bw;
+
+  double bdp = btl_bw * (double)cc->min_rtt;
+
+  /* state machine */
+  switch( cc->bbr_state ) {
+  case FD_QUIC_CC_BBR_STATE_STARTUP:
+    if( round_start ) {
+      if( btl_bw>=1.25*cc->full_bw ) {
+        cc->full_bw     = btl_bw;
+        cc->full_bw_cnt = 0UL;
+      } else if( ++cc->full_bw_cnt>=3UL ) {
+        cc->bbr_state   = FD_QUIC_CC_BBR_STATE_DRAIN;
+        cc->pacing_gain = 1.0 / BBR_HIGH_GAIN;
+      }
+    }
+    break;
+  case FD_QUIC_CC_BBR_STATE_DRAIN:
+    if( (double)cc->inflight<=bdp ) {
+      cc->bbr_state   = FD_QUIC_CC_BBR_STATE_PROBE_BW;
+      cc->cwnd_gain   = 2.0;
+      cc->cycle_idx   = 2UL;
+      cc->cycle_start = now;
+      cc->pacing_gain = bbr_cycle_gain[ cc->cycle_idx ];
+    }
+    break;
+  case FD_QUIC_CC_BBR_STATE_PROBE_BW:
+    if( now - cc->cycle_start > cc->min_rtt ) {
+      cc->cycle_idx   = ( cc->cycle_idx + 1UL ) & 7UL;
+      cc->cycle_start = now;
+      cc->pacing_gain = bbr_cycle_gain[ cc->cycle_idx ];
+    }
+    break;
+  }
+
+  /* window: grow towards cwnd_gain*bdp */
+  ulong min_cwnd = 4UL*cc->mss;
+  ulong target   = fd_ulong_max( (ulong)( cc->cwnd_gain * bdp ), min_cwnd );
+  if( cc->bbr_state==FD_QUIC_CC_BBR_STATE_STARTUP ) {
+    if( cc->cwnd<target || cc->delivered<FD_QUIC_CC_INITIAL_WINDOW*cc->mss ) cc->cwnd += pkt_meta->tx_sz;
+  } else {
+    cc->cwnd = fd_ulong_min( cc->cwnd + pkt_meta->tx_sz, target );
+  }
+  cc->cwnd = fd_ulong_max( cc->cwnd, min_cwnd );
+
+  fd_quic_cc_set_pace_rate( cc );
+}
+
+void
+fd_quic_cc_on_ack( fd_quic_cc_t *             cc,
+                   fd_quic_pkt_meta_t const * pkt_meta,
+                   ulong                      now ) {
+  ulong sz = pkt_meta->tx_sz;
+  if( !sz ) return;
+
+  ulong prior_inflight = cc->inflight;
+  cc->inflight      -= fd_ulong_min( sz, cc->inflight );
+  cc->delivered     += sz;
+  cc->delivered_time = now;
+
+  if( cc->algo==FD_QUIC_CC_ALGO_BBR ) {
+    fd_quic_cc_bbr_on_ack( cc, pkt_meta, now );
+    return;
+  }
+
+  /* no growth for packets sent before the last congestion event, or
+     while application limited */
+  if( cc->recovery && pkt_meta->tx_time<=cc->recovery_start ) return;
+  if( 2UL*prior_inflight<cc->cwnd ) return;
+
+  if( cc->cwnd<cc->ssthresh ) {
+    cc->cwnd += sz; /* slow start */
+  } else if( cc->algo==FD_QUIC_CC_ALGO_CUBIC ) {
+    fd_quic_cc_cubic_on_ack( cc, sz, now );
+  } else {
+    cc->ca_acked += sz;
+    if( cc->ca_acked>=cc->cwnd ) {
+      cc->ca_acked -= cc->cwnd;
+      cc->cwnd     += cc->mss;
+    }
+  }
+
+  fd_quic_cc_set_pace_rate( cc );
+}
+
+void
+fd_quic_cc_on_loss( fd_quic_cc_t *             cc,
+                    fd_quic_pkt_meta_t const * pkt_meta,
+                    ulong                      now ) {
+  ulong sz = pkt_meta->tx_sz;
+  if( !sz ) return;
+
+  cc->inflight -= fd_ulong_min( sz, cc->inflight );
+
+  if( cc->algo==FD_QUIC_CC_ALGO_BBR ) return;
+
+  /* at most one reduction per round trip */
+  if( cc->recovery && pkt_meta->tx_time<=cc->recovery_start ) return;
+  cc->recovery       = 1;
+  cc->recovery_start = now;
+  cc->ca_acked       = 0UL;
+
+  ulong min_cwnd = FD_QUIC_CC_MIN_WINDOW*cc->mss;
+  if( cc->algo==FD_QUIC_CC_ALGO_CUBIC ) {
+    double cwnd = (double)cc->cwnd;
+    /* fast convergence */
+    cc->w_max       = cwnd<cc->w_max ? cwnd*( 1.0+CUBIC_BETA )*0.5 : cwnd;
+    cc->cwnd        = fd_ulong_max( (ulong)( cwnd*CUBIC_BETA ), min_cwnd );
+    cc->epoch_start = 0UL;
+  } else {
+    cc->cwnd        = fd_ulong_max( cc->cwnd>>1, min_cwnd );
+  }
+  cc->ssthresh = cc->cwnd;
+
+  fd_quic_cc_set_pace_rate( cc );
+}
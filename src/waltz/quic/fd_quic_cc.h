@@ -0,0 +1,225 @@
+#ifndef HEADER_fd_src_waltz_quic_fd_quic_cc_h
+#define HEADER_fd_src_waltz_quic_fd_quic_cc_h
+
+/* fd_quic_cc_t is the congestion controller and pacer of a conn.
+
+   The algorithm is selected per fd_quic_t via fd_quic_config_t::cc_algo
+   (one of FD_QUIC_CC_ALGO_*).  All algorithms share the same hooks,
+   called by fd_quic:
+
+     fd_quic_cc_on_sent        after a packet was encrypted for tx
+     fd_quic_cc_on_ack         for every newly acknowledged packet
+     fd_quic_cc_on_loss        for every packet declared lost (expired
+                               or skipped by more than 3 later acks)
+     fd_quic_cc_on_discard     for packets dropped without being acked
+                               or lost (e.g. abandoned enc levels)
+     fd_quic_cc_rtt_sample     for the largest packet of an ack frame
+
+   and fd_quic_conn_tx consults fd_quic_cc_can_send before adding
+   stream data to a packet.  Acks, handshake data and control frames are
+   never held back.  With FD_QUIC_CC_ALGO_NONE, all hooks are no-ops and
+   conns behave as without congestion control (the default, suitable
+   for the TPU server, which only sends acks and control frames).
+
+   ### Window based (NewReno, CUBIC)
+
+   The congestion window (cwnd) limits the bytes in flight.  cwnd starts
+   at FD_QUIC_CC_INITIAL_WINDOW packets and grows in slow start by the
+   acked bytes until the first loss.  After that, NewReno adds one
+   packet per cwnd acked and CUBIC follows the cubic window function of
+   RFC 9438 (with the Reno-friendly estimate).  A loss reduces cwnd by
+   half (NewReno) or by 30% (CUBIC) at most once per round trip.  The
+   window does not grow while the conn is application limited (less
+   than half of cwnd in flight).  Packets are paced at 1.25 cwnd/srtt
+   (RFC 9002 Section 7.7).
+
+   ### Model based (BBR)
+
+   A simplified BBRv1.  Every ack produces a delivery rate sample; the
+   bottleneck bandwidth estimate (btl_bw) is the max over the last
+   FD_QUIC_CC_BBR_BW_WIN round trips and min_rtt is the min rtt sample
+   over the last FD_QUIC_CC_BBR_MIN_RTT_WIN ns.  Packets are paced at
+   pacing_gain*btl_bw and the window is capped at cwnd_gain*btl_bw*
+   min_rtt.  The gains follow the STARTUP (2.89 until btl_bw stops
+   growing by 25% for 3 rounds), DRAIN and PROBE_BW (8 phase cycle
+   1.25, 0.75, 1, ...) states.  PROBE_RTT is omitted (the min_rtt
+   estimate is replaced by the latest sample when it expires instead).
+   Losses only remove the packet from flight.
+
+   ### Time
+
+   All times are in the clock domain of the fd_quic_t (fd_quic_now_t,
+   ns).  The pacer needs a fine grained clock: tiles should drive it
+   with a tickcount based clock (see fd_tempo) rather than coarse
+   wallclock reads.
+
+   This is not thread safe. */
+
+#include "fd_quic_enum.h"
+#include "fd_quic_pkt_meta.h"
+
+/* FD_QUIC_CC_INITIAL_RTT is the rtt assumed before the first sample
+   (ns, RFC 9002 Section 6.2.2).  FD_QUIC_CC_GRANULARITY is the min rtt
+   variance used for loss timers (ns). */
+
+#define FD_QUIC_CC_INITIAL_RTT     (333000000UL)
+#define FD_QUIC_CC_GRANULARITY     (1000000UL)
+
+/* FD_QUIC_CC_{INITIAL,MIN}_WINDOW are the initial and min cwnd in
+   packets. */
+
+#define FD_QUIC_CC_INITIAL_WINDOW  (10UL)
+#define FD_QUIC_CC_MIN_WINDOW      (2UL)
+
+/* FD_QUIC_CC_PACE_BURST is the number of packets the pacer lets out
+   back to back after an idle period. */
+
+#define FD_QUIC_CC_PACE_BURST      (4UL)
+
+/* FD_QUIC_CC_BBR_* configure the BBR windowed filters (in round trips
+   and ns). */
+
+#define FD_QUIC_CC_BBR_BW_WIN      (10UL)
+#define FD_QUIC_CC_BBR_MIN_RTT_WIN (10000000000UL)
+
+/* FD_QUIC_CC_BBR_STATE_* are the states of the BBR state machine */
+
+#define FD_QUIC_CC_BBR_STATE_STARTUP  0
+#define FD_QUIC_CC_BBR_STATE_DRAIN    1
+#define FD_QUIC_CC_BBR_STATE_PROBE_BW 2
+
+struct fd_quic_cc {
+  int    algo;            /* FD_QUIC_CC_ALGO_* */
+  ulong  mss;             /* max datagram size in bytes */
+
+  /* window */
+  ulong  cwnd;            /* congestion window in bytes */
+  ulong  ssthresh;        /* slow start threshold in bytes */
+  ulong  inflight;        /* bytes of in flight packets */
+  ulong  ca_acked;        /* bytes acked since the last NewReno cwnd increase */
+  int    recovery;        /* 1 after the first congestion event */
+  ulong  recovery_start;  /* time of the last congestion event */
+
+  /* rtt estimator (RFC 9002 Section 5) */
+  ulong  srtt;            /* smoothed rtt, 0 if no sample yet */
+  ulong  rttvar;          /* rtt variation */
+  ulong  min_rtt;         /* min rtt sample in the min rtt window */
+  ulong  min_rtt_time;    /* time of the min rtt sample */
+
+  /* pacer */
+  double pace_rate;       /* bytes per ns, 0 if not pacing */
+  ulong  pace_next;       /* earliest tx time of the next packet */
+
+  /* CUBIC */
+  double w_max;           /* window before the last reduction (bytes) */
+  double k;               /* time to reach w_max (s) */
+  double w_est;           /* Reno-friendly window estimate (bytes) */
+  ulong  epoch_start;     /* start of the congestion avoidance epoch, 0 if none */
+
+  /* BBR */
+  int    bbr_state;       /* FD_QUIC_CC_BBR_STATE_* */
+  ulong  delivered;       /* total bytes acked */
+  ulong  delivered_time;  /* time of the last delivery */
+  ulong  round_cnt;       /* number of round trips */
+  ulong  round_delivered; /* delivered at the start of the current round */
+  double bw[ FD_QUIC_CC_BBR_BW_WIN ]; /* max delivery rate of the recent rounds (bytes/ns) */
+  double btl_bw;          /* bottleneck bandwidth estimate (bytes/ns) */
+  double full_bw;         /* btl_bw at the last 25% increase */
+  ulong  full_bw_cnt;     /* rounds without a 25% increase */
+  ulong  cycle_idx;       /* PROBE_BW gain cycle phase */
+  ulong  cycle_start;     /* start time of the PROBE_BW phase */
+  double pacing_gain;
+  double cwnd_gain;
+};
+
+typedef struct fd_quic_cc fd_quic_cc_t;
+
+FD_PROTOTYPES_BEGIN
+
+/* fd_quic_cc_init resets cc for a new conn using algo (one of
+   FD_QUIC_CC_ALGO_*) and mss (the max datagram size in bytes). */
+
+void
+fd_quic_cc_init( fd_quic_cc_t * cc,
+                 int            algo,
+                 ulong          mss );
+
+/* fd_quic_cc_can_send returns 1 if a packet carrying stream data may be
+   sent at time now, and 0 if it has to wait for acks (window full) or
+   for the pacer. */
+
+static inline int
+fd_quic_cc_can_send( fd_quic_cc_t const * cc,
+                     ulong                now ) {
+  if( FD_LIKELY( cc->algo==FD_QUIC_CC_ALGO_NONE ) ) return 1;
+  return ( cc->inflight<cc->cwnd ) & ( now>=cc->pace_next );
+}
+
+/* fd_quic_cc_next_send returns the time at which fd_quic_cc_can_send
+   returns 1 next, or ULONG_MAX if that depends on acks. */
+
+static inline ulong
+fd_quic_cc_next_send( fd_quic_cc_t const * cc,
+                      ulong                now ) {
+  if( FD_LIKELY( cc->algo==FD_QUIC_CC_ALGO_NONE ) ) return now;
+  if( cc->inflight>=cc->cwnd ) return ULONG_MAX;
+  return fd_ulong_max( cc->pace_next, now );
+}
+
+/* fd_quic_cc_rtt returns the rtt used for the retransmission timers of
+   the conn (ns).  Only meaningful if algo is not NONE. */
+
+static inline ulong
+fd_quic_cc_rtt( fd_quic_cc_t const * cc ) {
+  if( FD_UNLIKELY( !cc->srtt ) ) return FD_QUIC_CC_INITIAL_RTT;
+  return cc->srtt + fd_ulong_max( cc->rttvar, FD_QUIC_CC_GRANULARITY );
+}
+
+/* fd_quic_cc_on_sent records that the packet described by pkt_meta with
+   sz bytes was sent at time now.  in_flight is 0 for packets that are
+   not ack-eliciting (e.g. ack only), which are not counted against the
+   window. */
+
+void
+fd_quic_cc_on_sent( fd_quic_cc_t *       cc,
+                    fd_quic_pkt_meta_t * pkt_meta,
+                    ulong                sz,
+                    int                  in_flight,
+                    ulong                now );
+
+/* fd_quic_cc_on_ack processes the acknowledgement of the packet
+   described by pkt_meta at time now. */
+
+void
+fd_quic_cc_on_ack( fd_quic_cc_t *             cc,
+                   fd_quic_pkt_meta_t const * pkt_meta,
+                   ulong                      now );
+
+/* fd_quic_cc_on_loss processes the loss of the packet described by
+   pkt_meta, detected at time now. */
+
+void
+fd_quic_cc_on_loss( fd_quic_cc_t *             cc,
+                    fd_quic_pkt_meta_t const * pkt_meta,
+                    ulong                      now );
+
+/* fd_quic_cc_on_discard removes the packet described by pkt_meta from
+   flight without signaling congestion. */
+
+static inline void
+fd_quic_cc_on_discard( fd_quic_cc_t *             cc,
+                       fd_quic_pkt_meta_t const * pkt_meta ) {
+  cc->inflight -= fd_ulong_min( pkt_meta->tx_sz, cc->inflight );
+}
+
+/* fd_quic_cc_rtt_sample updates the rtt estimates with the ack at time
+   now of the packet described by pkt_meta. */
+
+void
+fd_quic_cc_rtt_sample( fd_quic_cc_t *             cc,
+                       fd_quic_pkt_meta_t const * pkt_meta,
+                       ulong                      now );
+
+FD_PROTOTYPES_END
+
+#endif /* HEADER_fd_src_waltz_quic_fd_quic_cc_h */
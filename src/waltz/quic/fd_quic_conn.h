@@ -7,6 +7,7 @@
 #include "crypto/fd_quic_crypto_suites.h"
 #include "templ/fd_quic_transport_params.h"
 #include "fd_quic_pkt_meta.h"
+#include "fd_quic_cc.h"
 #include "templ/fd_quic_union.h"
 
 #define FD_QUIC_CONN_STATE_INVALID            0 /* dead object / freed */
@@ -322,6 +323,9 @@ struct fd_quic_conn {
   /* current round-trip-time */
   ulong                rtt;
 
+  /* congestion controller and pacer */
+  fd_quic_cc_t         cc;
+
   /* highest peer encryption level */
   uchar                peer_enc_level;
 
@@ -58,6 +58,18 @@
 #define FD_QUIC_ROLE_CLIENT 1
 #define FD_QUIC_ROLE_SERVER 2
 
+/* FD_QUIC_CC_ALGO_* select the congestion controller of the conns of
+   an fd_quic_t (see fd_quic_config_t::cc_algo and fd_quic_cc.h).
+   ...NONE:    No congestion control or pacing (default)
+   ...NEWRENO: NewReno (RFC 9002 Section 7) with pacing
+   ...CUBIC:   CUBIC (RFC 9438) with pacing
+   ...BBR:     BBR-like model-based pacer (bottleneck bw, min rtt) */
+#define FD_QUIC_CC_ALGO_NONE    0
+#define FD_QUIC_CC_ALGO_NEWRENO 1
+#define FD_QUIC_CC_ALGO_CUBIC   2
+#define FD_QUIC_CC_ALGO_BBR     3
+#define FD_QUIC_CC_ALGO_CNT     4
+
 /* FD_QUIC_SEND_ERR_* are negative int error codes indicating a stream
    send failure.
    ...INVAL_STREAM: Not allowed to send for stream ID (e.g. not open)
@@ -123,6 +123,12 @@ struct fd_quic_pkt_meta {
   ulong                  expiry; /* time pkt_meta expires... this is the time the
                                   ack is expected by */
 
+  /* congestion control state of the packet (see fd_quic_cc.h) */
+  ulong                  tx_time;           /* time the packet was sent */
+  ulong                  tx_delivered;      /* cc delivered bytes when sent */
+  ulong                  tx_delivered_time; /* cc delivered time when sent */
+  ulong                  tx_sz;             /* bytes counted in flight, 0 if not in flight */
+
   fd_quic_pkt_meta_var_t var[FD_QUIC_PKT_META_VAR_MAX];
 
   fd_quic_pkt_meta_t *   next;   /* next in current list */
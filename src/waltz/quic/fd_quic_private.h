@@ -9,6 +9,7 @@
 #include "crypto/fd_quic_crypto_suites.h"
 #include "tls/fd_quic_tls.h"
 #include "fd_quic_stream_pool.h"
+#include "fd_quic_timer_wheel.h"
 
 #include "../../util/net/fd_eth.h"
 #include "../../util/net/fd_ip4.h"
@@ -36,14 +37,10 @@ enum {
 
 #define FD_QUIC_MAGIC (0xdadf8cfa01cc5460UL)
 
-/* events for time based processing */
-struct fd_quic_event {
-  ulong            timeout;
+/* FD_QUIC_SVC_LG_TICK is the log2 of the tick (in ns) of the
+   connection service timer wheel (~1us). */
 
-  fd_quic_conn_t * conn; /* connection or NULL */
-  /* possibly "type", etc., for other kinds of service */
-};
-typedef struct fd_quic_event fd_quic_event_t;
+#define FD_QUIC_SVC_LG_TICK (10)
 
 /* structure for a cummulative summation tree */
 struct fd_quic_cs_tree {
@@ -84,7 +81,7 @@ struct __attribute__((aligned(16UL))) fd_quic_state_private {
   fd_quic_conn_t *        conns;          /* free list of unused connections */
   ulong                   free_conns;     /* count of free connections */
   fd_quic_conn_map_t *    conn_map;       /* map connection ids -> connection */
-  fd_quic_event_t *       service_queue;  /* priority queue of connections by service time */
+  fd_quic_timer_wheel_t * svc_wheel;      /* connection service deadlines, by conn_idx */
   fd_quic_stream_pool_t * stream_pool;    /* stream pool */
 
   fd_quic_cs_tree_t *     cs_tree;        /* cummulative summation tree */
@@ -323,6 +320,13 @@ fd_quic_pkt_meta_retry( fd_quic_t *          quic,
                         int                  force,
                         uint                 arg_enc_level );
 
+/* fd_quic_ack_enc_level is called when the peer was seen using
+   enc_level.  All packets sent at lower enc levels are considered acked
+   and their keys are discarded. */
+void
+fd_quic_ack_enc_level( fd_quic_conn_t * conn,
+                       uint             enc_level );
+
 /* reclaim resources associated with packet metadata
    this is called in response to received acks */
 void
@@ -0,0 +1,311 @@
+#include "fd_quic_timer_wheel.h"
+
+#include "../../util/fd_util.h"
+
+#define LG_SLOT   FD_QUIC_TIMER_WHEEL_LG_SLOT
+#define SLOT_CNT  FD_QUIC_TIMER_WHEEL_SLOT
+#define LVL_CNT   FD_QUIC_TIMER_WHEEL_LVL_CNT
+#define IDX_NULL  FD_QUIC_TIMER_WHEEL_IDX_NULL
+#define OVERFLOW  FD_QUIC_TIMER_WHEEL_SLOT_OVERFLOW
+#define SLOT_NULL FD_QUIC_TIMER_WHEEL_SLOT_NULL
+
+FD_FN_CONST ulong
+fd_quic_timer_wheel_align( void ) {
+  return FD_QUIC_TIMER_WHEEL_ALIGN;
+}
+
+FD_FN_CONST ulong
+fd_quic_timer_wheel_footprint( ulong ele_max ) {
+  if( FD_UNLIKELY( !ele_max || ele_max>=(ulong)IDX_NULL ) ) return 0UL;
+  return fd_ulong_align_up( sizeof(fd_quic_timer_wheel_t) + ele_max*sizeof(fd_quic_timer_wheel_ele_t),
+                            FD_QUIC_TIMER_WHEEL_ALIGN );
+}
+
+void *
+fd_quic_timer_wheel_new( void * shmem,
+                         ulong  ele_max,
+                         int    lg_tick,
+                         ulong  now ) {
+  if( FD_UNLIKELY( !shmem ) ) {
+    FD_LOG_WARNING(( "NULL shmem" ));
+    return NULL;
+  }
+  if( FD_UNLIKELY( !fd_ulong_is_aligned( (ulong)shmem, fd_quic_timer_wheel_align() ) ) ) {
+    FD_LOG_WARNING(( "misaligned shmem" ));
+    return NULL;
+  }
+  if( FD_UNLIKELY( !fd_quic_timer_wheel_footprint( ele_max ) ) ) {
+    FD_LOG_WARNING(( "invalid ele_max %lu", ele_max ));
+    return NULL;
+  }
+  if( FD_UNLIKELY( lg_tick<0 || lg_tick>32 ) ) {
+    FD_LOG_WARNING(( "invalid lg_tick %d", lg_tick ));
+    return NULL;
+  }
+
+  fd_quic_timer_wheel_t * wheel = (fd_quic_timer_wheel_t *)shmem;
+  fd_memset( wheel, 0, sizeof(fd_quic_timer_wheel_t) );
+  wheel->ele_max = ele_max;
+  wheel->lg_tick = lg_tick;
+  wheel->cur     = now >> lg_tick;
+  wheel->cnt     = 0UL;
+  for( ulong i=0UL; i<LVL_CNT*SLOT_CNT+1UL; i++ ) wheel->head[ i ] = IDX_NULL;
+
+  fd_quic_timer_wheel_ele_t * ele = fd_quic_timer_wheel_private_ele( wheel );
+  for( ulong i=0UL; i<ele_max; i++ ) {
+    ele[ i ].timeout = 0UL;
+    ele[ i ].prev    = IDX_NULL;
+    ele[ i ].next    = IDX_NULL;
+    ele[ i ].slot    = SLOT_NULL;
+  }
+
+  FD_COMPILER_MFENCE();
+  FD_VOLATILE( wheel->magic ) = FD_QUIC_TIMER_WHEEL_MAGIC;
+  FD_COMPILER_MFENCE();
+
+  return shmem;
+}
+
+fd_quic_timer_wheel_t *
+fd_quic_timer_wheel_join( void * shwheel ) {
+  if( FD_UNLIKELY( !shwheel ) ) {
+    FD_LOG_WARNING(( "NULL shwheel" ));
+    return NULL;
+  }
+  fd_quic_timer_wheel_t * wheel = (fd_quic_timer_wheel_t *)shwheel;
+  if( FD_UNLIKELY( wheel->magic!=FD_QUIC_TIMER_WHEEL_MAGIC ) ) {
+    FD_LOG_WARNING(( "bad magic" ));
+    return NULL;
+  }
+  return wheel;
+}
+
+void *
+fd_quic_timer_wheel_leave( fd_quic_timer_wheel_t * wheel ) {
+  return (void *)wheel;
+}
+
+void *
+fd_quic_timer_wheel_delete( void * shwheel ) {
+  if( FD_UNLIKELY( !shwheel ) ) {
+    FD_LOG_WARNING(( "NULL shwheel" ));
+    return NULL;
+  }
+  fd_quic_timer_wheel_t * wheel = (fd_quic_timer_wheel_t *)shwheel;
+  if( FD_UNLIKELY( wheel->magic!=FD_QUIC_TIMER_WHEEL_MAGIC ) ) {
+    FD_LOG_WARNING(( "bad magic" ));
+    return NULL;
+  }
+  FD_COMPILER_MFENCE();
+  FD_VOLATILE( wheel->magic ) = 0UL;
+  FD_COMPILER_MFENCE();
+  return shwheel;
+}
+
+/* slot_mask_gt returns the mask of the slots after slot idx in a
+   level. */
+
+FD_FN_CONST static inline ulong
+slot_mask_gt( ulong idx ) {
+  return idx==SLOT_CNT-1UL ? 0UL : ( ~0UL << (idx+1UL) );
+}
+
+static inline void
+slot_push( fd_quic_timer_wheel_t *     wheel,
+           fd_quic_timer_wheel_ele_t * ele,
+           uint                        idx,
+           uint                        slot ) {
+  uint head = wheel->head[ slot ];
+  ele[ idx ].slot = slot;
+  ele[ idx ].prev = IDX_NULL;
+  ele[ idx ].next = head;
+  if( head!=IDX_NULL ) ele[ head ].prev = idx;
+  wheel->head[ slot ] = idx;
+  if( FD_LIKELY( slot<OVERFLOW ) ) wheel->mask[ slot>>LG_SLOT ] |= 1UL<<(slot&(SLOT_CNT-1UL));
+}
+
+static inline void
+slot_remove( fd_quic_timer_wheel_t *     wheel,
+             fd_quic_timer_wheel_ele_t * ele,
+             uint                        idx ) {
+  uint slot = ele[ idx ].slot;
+  uint prev = ele[ idx ].prev;
+  uint next = ele[ idx ].next;
+  if( prev!=IDX_NULL ) ele[ prev ].next = next;
+  else                 wheel->head[ slot ] = next;
+  if( next!=IDX_NULL ) ele[ next ].prev = prev;
+  if( wheel->head[ slot ]==IDX_NULL && FD_LIKELY( slot<OVERFLOW ) ) {
+    wheel->mask[ slot>>LG_SLOT ] &= ~( 1UL<<(slot&(SLOT_CNT-1UL)) );
+  }
+  ele[ idx ].slot = SLOT_NULL;
+  ele[ idx ].prev = IDX_NULL;
+  ele[ idx ].next = IDX_NULL;
+}
+
+/* insert files element idx in the slot matching its deadline, relative
+   to the current tick: the lowest level whose current block contains
+   the deadline tick (deadlines in the past go to the current slot). */
+
+static inline void
+insert( fd_quic_timer_wheel_t *     wheel,
+        fd_quic_timer_wheel_ele_t * ele,
+        uint                        idx ) {
+  ulong tick = ele[ idx ].timeout >> wheel->lg_tick;
+  ulong cur  = wheel->cur;
+  if( tick<=cur ) {
+    slot_push( wheel, ele, idx, (uint)( cur & (SLOT_CNT-1UL) ) );
+    return;
+  }
+  for( ulong lvl=0UL; lvl<LVL_CNT; lvl++ ) {
+    ulong shift = (lvl+1UL)*(ulong)LG_SLOT;
+    if( (tick>>shift)==(cur>>shift) ) {
+      slot_push( wheel, ele, idx, (uint)( lvl*SLOT_CNT + ((tick>>(lvl*(ulong)LG_SLOT)) & (SLOT_CNT-1UL)) ) );
+      return;
+    }
+  }
+  slot_push( wheel, ele, idx, OVERFLOW );
+}
+
+/* cascade refiles all the elements of slot relative to the current
+   tick. */
+
+static void
+cascade( fd_quic_timer_wheel_t *     wheel,
+         fd_quic_timer_wheel_ele_t * ele,
+         uint                        slot ) {
+  uint idx = wheel->head[ slot ];
+  wheel->head[ slot ] = IDX_NULL;
+  if( FD_LIKELY( slot<OVERFLOW ) ) wheel->mask[ slot>>LG_SLOT ] &= ~( 1UL<<(slot&(SLOT_CNT-1UL)) );
+  while( idx!=IDX_NULL ) {
+    uint next = ele[ idx ].next;
+    insert( wheel, ele, idx );
+    idx = next;
+  }
+}
+
+/* first_slot returns the first non-empty slot after the current one
+   and stores the first tick covered by that slot in *_tick.  Returns
+   SLOT_NULL if there is none.  Slots before the current one at each
+   level are always empty. */
+
+static uint
+first_slot( fd_quic_timer_wheel_t const * wheel,
+            ulong *                       _tick ) {
+  ulong cur = wheel->cur;
+  for( ulong lvl=0UL; lvl<LVL_CNT; lvl++ ) {
+    ulong shift = lvl*(ulong)LG_SLOT;
+    ulong m     = wheel->mask[ lvl ] & slot_mask_gt( (cur>>shift) & (SLOT_CNT-1UL) );
+    if( m ) {
+      ulong i  = (ulong)fd_ulong_find_lsb( m );
+      ulong up = shift + (ulong)LG_SLOT;
+      *_tick = ( (cur>>up)<<up ) | ( i<<shift );
+      return (uint)( lvl*SLOT_CNT + i );
+    }
+  }
+  if( wheel->head[ OVERFLOW ]!=IDX_NULL ) {
+    ulong up = LVL_CNT*(ulong)LG_SLOT;
+    *_tick = ( (cur>>up)+1UL )<<up;
+    return OVERFLOW;
+  }
+  return SLOT_NULL;
+}
+
+/* advance moves the current tick forward to tick, refiling the slots
+   it enters, top level first.  Assumes there is no element in the
+   slots between the current tick and tick. */
+
+static void
+advance( fd_quic_timer_wheel_t *     wheel,
+         fd_quic_timer_wheel_ele_t * ele,
+         ulong                       tick ) {
+  ulong old = wheel->cur;
+  wheel->cur = tick;
+  ulong top = LVL_CNT*(ulong)LG_SLOT;
+  if( (tick>>top)!=(old>>top) ) cascade( wheel, ele, OVERFLOW );
+  for( ulong lvl=LVL_CNT-1UL; lvl>0UL; lvl-- ) {
+    ulong shift = lvl*(ulong)LG_SLOT;
+    if( (tick>>shift)!=(old>>shift) ) {
+      cascade( wheel, ele, (uint)( lvl*SLOT_CNT + ((tick>>shift) & (SLOT_CNT-1UL)) ) );
+    }
+  }
+}
+
+void
+fd_quic_timer_wheel_schedule( fd_quic_timer_wheel_t * wheel,
+                              ulong                   idx,
+                              ulong                   timeout ) {
+  fd_quic_timer_wheel_ele_t * ele = fd_quic_timer_wheel_private_ele( wheel );
+  if( ele[ idx ].slot!=SLOT_NULL ) slot_remove( wheel, ele, (uint)idx );
+  else                             wheel->cnt++;
+  ele[ idx ].timeout = timeout;
+  insert( wheel, ele, (uint)idx );
+}
+
+void
+fd_quic_timer_wheel_cancel( fd_quic_timer_wheel_t * wheel,
+                            ulong                   idx ) {
+  fd_quic_timer_wheel_ele_t * ele = fd_quic_timer_wheel_private_ele( wheel );
+  if( ele[ idx ].slot==SLOT_NULL ) return;
+  slot_remove( wheel, ele, (uint)idx );
+  wheel->cnt--;
+}
+
+ulong
+fd_quic_timer_wheel_pop( fd_quic_timer_wheel_t * wheel,
+                         ulong                   now ) {
+  fd_quic_timer_wheel_ele_t * ele = fd_quic_timer_wheel_private_ele( wheel );
+  ulong now_tick = now >> wheel->lg_tick;
+
+  for(;;) {
+    ulong cur  = wheel->cur;
+    uint  slot = (uint)( cur & (SLOT_CNT-1UL) );
+    uint  idx  = wheel->head[ slot ];
+
+    if( cur<now_tick ) {
+      /* everything in the current slot is due */
+      if( idx!=IDX_NULL ) {
+        slot_remove( wheel, ele, idx );
+        wheel->cnt--;
+        return idx;
+      }
+    } else {
+      /* only some of the current slot might be due */
+      for( ; idx!=IDX_NULL; idx=ele[ idx ].next ) {
+        if( ele[ idx ].timeout<=now ) {
+          slot_remove( wheel, ele, idx );
+          wheel->cnt--;
+          return idx;
+        }
+      }
+      return IDX_NULL;
+    }
+
+    ulong tick;
+    uint  next = first_slot( wheel, &tick );
+    if( next==SLOT_NULL ) tick = now_tick;
+    advance( wheel, ele, fd_ulong_min( tick, now_tick ) );
+  }
+}
+
+FD_FN_PURE ulong
+fd_quic_timer_wheel_next( fd_quic_timer_wheel_t const * wheel ) {
+  fd_quic_timer_wheel_ele_t const * ele = fd_quic_timer_wheel_private_ele_const( wheel );
+
+  uint slot = (uint)( wheel->cur & (SLOT_CNT-1UL) );
+  if( wheel->head[ slot ]==IDX_NULL ) {
+    ulong tick;
+    slot = first_slot( wheel, &tick );
+    if( slot==SLOT_NULL ) return ULONG_MAX;
+  }
+
+  ulong t = ULONG_MAX;
+  for( uint idx=wheel->head[ slot ]; idx!=IDX_NULL; idx=ele[ idx ].next ) t = fd_ulong_min( t, ele[ idx ].timeout );
+  return t;
+}
+
+#undef LG_SLOT
+#undef SLOT_CNT
+#undef LVL_CNT
+#undef IDX_NULL
+#undef OVERFLOW
+#undef SLOT_NULL
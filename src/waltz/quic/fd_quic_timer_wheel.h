@@ -0,0 +1,168 @@
+#ifndef HEADER_fd_src_waltz_quic_fd_quic_timer_wheel_h
+#define HEADER_fd_src_waltz_quic_fd_quic_timer_wheel_h
+
+/* fd_quic_timer_wheel_t schedules deadlines for up to ele_max elements
+   (connections), identified by an index in [0,ele_max).  Each element
+   has at most one deadline.  Scheduling, rescheduling and cancelling a
+   deadline are O(1).
+
+   The wheel is hierarchical.  Time is divided into ticks of 2^lg_tick
+   time units.  Level 0 has one slot per tick for the current block of
+   64 ticks, level 1 has one slot per block of 64 ticks for the current
+   block of 64^2 ticks, and so on for FD_QUIC_TIMER_WHEEL_LVL_CNT
+   levels.  Deadlines beyond the range of the top level are kept in an
+   overflow list.  As time advances, the elements of a slot are moved
+   down to the lower levels once the current tick enters the range of
+   the slot, so each element is moved at most once per level.  Empty
+   slots are skipped over using per-level occupancy bit masks, so the
+   cost of advancing time does not depend on the elapsed time.
+
+   Deadlines are exact: fd_quic_timer_wheel_pop only returns elements
+   whose deadline is at or before now (the tick only determines in
+   which slot an element lives).  Elements with the same deadline are
+   returned in no particular order.
+
+   This is not thread safe. */
+
+#include "../../util/fd_util_base.h"
+
+#define FD_QUIC_TIMER_WHEEL_ALIGN   (64UL)
+#define FD_QUIC_TIMER_WHEEL_MAGIC   (0xf17eda2ce7ee1000UL) /* firedancer timer wheel version 0 */
+
+#define FD_QUIC_TIMER_WHEEL_LVL_CNT (5UL)
+#define FD_QUIC_TIMER_WHEEL_LG_SLOT (6)
+#define FD_QUIC_TIMER_WHEEL_SLOT    (64UL)
+
+/* FD_QUIC_TIMER_WHEEL_IDX_NULL is the null element index.
+   FD_QUIC_TIMER_WHEEL_SLOT_{OVERFLOW,NULL} are the slot of elements
+   in the overflow list and of elements that are not scheduled. */
+
+#define FD_QUIC_TIMER_WHEEL_IDX_NULL      (UINT_MAX)
+#define FD_QUIC_TIMER_WHEEL_SLOT_OVERFLOW ((uint)(FD_QUIC_TIMER_WHEEL_LVL_CNT*FD_QUIC_TIMER_WHEEL_SLOT))
+#define FD_QUIC_TIMER_WHEEL_SLOT_NULL     (UINT_MAX)
+
+struct fd_quic_timer_wheel_ele {
+  ulong timeout;
+  uint  prev;
+  uint  next;
+  uint  slot;     /* lvl*FD_QUIC_TIMER_WHEEL_SLOT + slot idx, or SLOT_{OVERFLOW,NULL} */
+};
+
+typedef struct fd_quic_timer_wheel_ele fd_quic_timer_wheel_ele_t;
+
+struct __attribute__((aligned(FD_QUIC_TIMER_WHEEL_ALIGN))) fd_quic_timer_wheel_private {
+  ulong magic;    /* ==FD_QUIC_TIMER_WHEEL_MAGIC */
+  ulong ele_max;
+  int   lg_tick;
+  ulong cur;      /* current tick */
+  ulong cnt;      /* number of scheduled elements */
+
+  ulong mask[ FD_QUIC_TIMER_WHEEL_LVL_CNT ];                             /* bit i set if slot i of the lvl is not empty */
+  uint  head[ FD_QUIC_TIMER_WHEEL_LVL_CNT*FD_QUIC_TIMER_WHEEL_SLOT+1UL ]; /* last one is the overflow list */
+
+  /* ele_max fd_quic_timer_wheel_ele_t follow here */
+};
+
+typedef struct fd_quic_timer_wheel_private fd_quic_timer_wheel_t;
+
+FD_PROTOTYPES_BEGIN
+
+/* fd_quic_timer_wheel_{align,footprint} return the alignment and
+   footprint required for a memory region to be used as a timer wheel
+   of up to ele_max elements.  footprint returns 0 if ele_max is 0 or
+   too large. */
+
+FD_FN_CONST ulong
+fd_quic_timer_wheel_align( void );
+
+FD_FN_CONST ulong
+fd_quic_timer_wheel_footprint( ulong ele_max );
+
+/* fd_quic_timer_wheel_new formats shmem as a timer wheel of up to
+   ele_max elements with ticks of 2^lg_tick time units, with the current
+   time set to now.  lg_tick is in [0,32].  Returns shmem on success and
+   NULL on failure (logs details).  fd_quic_timer_wheel_{join,leave,
+   delete} have the usual semantics. */
+
+void *
+fd_quic_timer_wheel_new( void * shmem,
+                         ulong  ele_max,
+                         int    lg_tick,
+                         ulong  now );
+
+fd_quic_timer_wheel_t *
+fd_quic_timer_wheel_join( void * shwheel );
+
+void *
+fd_quic_timer_wheel_leave( fd_quic_timer_wheel_t * wheel );
+
+void *
+fd_quic_timer_wheel_delete( void * shwheel );
+
+FD_FN_PURE static inline ulong
+fd_quic_timer_wheel_cnt( fd_quic_timer_wheel_t const * wheel ) {
+  return wheel->cnt;
+}
+
+FD_FN_CONST static inline fd_quic_timer_wheel_ele_t *
+fd_quic_timer_wheel_private_ele( fd_quic_timer_wheel_t * wheel ) {
+  return (fd_quic_timer_wheel_ele_t *)( wheel+1 );
+}
+
+FD_FN_CONST static inline fd_quic_timer_wheel_ele_t const *
+fd_quic_timer_wheel_private_ele_const( fd_quic_timer_wheel_t const * wheel ) {
+  return (fd_quic_timer_wheel_ele_t const *)( wheel+1 );
+}
+
+/* fd_quic_timer_wheel_is_scheduled returns 1 if element idx has a
+   deadline and 0 otherwise.  fd_quic_timer_wheel_timeout returns the
+   deadline of a scheduled element. */
+
+FD_FN_PURE static inline int
+fd_quic_timer_wheel_is_scheduled( fd_quic_timer_wheel_t const * wheel,
+                                  ulong                         idx ) {
+  return fd_quic_timer_wheel_private_ele_const( wheel )[ idx ].slot!=FD_QUIC_TIMER_WHEEL_SLOT_NULL;
+}
+
+FD_FN_PURE static inline ulong
+fd_quic_timer_wheel_timeout( fd_quic_timer_wheel_t const * wheel,
+                             ulong                         idx ) {
+  return fd_quic_timer_wheel_private_ele_const( wheel )[ idx ].timeout;
+}
+
+/* fd_quic_timer_wheel_schedule sets the deadline of element idx to
+   timeout, replacing its current deadline if it has one.  A deadline in
+   the past is due immediately. */
+
+void
+fd_quic_timer_wheel_schedule( fd_quic_timer_wheel_t * wheel,
+                              ulong                   idx,
+                              ulong                   timeout );
+
+/* fd_quic_timer_wheel_cancel removes the deadline of element idx, if
+   it has one. */
+
+void
+fd_quic_timer_wheel_cancel( fd_quic_timer_wheel_t * wheel,
+                            ulong                   idx );
+
+/* fd_quic_timer_wheel_pop advances the wheel to now and, if an element
+   is due (its deadline is at or before now), removes its deadline and
+   returns its index.  Returns FD_QUIC_TIMER_WHEEL_IDX_NULL if no
+   element is due.  now should not go backwards. */
+
+ulong
+fd_quic_timer_wheel_pop( fd_quic_timer_wheel_t * wheel,
+                         ulong                   now );
+
+/* fd_quic_timer_wheel_next returns the earliest deadline among the
+   scheduled elements, or ULONG_MAX if there are none.  Its cost is
+   proportional to the number of elements in the first non-empty slot
+   (this is meant for computing wakeup times, not for the fast path). */
+
+FD_FN_PURE ulong
+fd_quic_timer_wheel_next( fd_quic_timer_wheel_t const * wheel );
+
+FD_PROTOTYPES_END
+
+#endif /* HEADER_fd_src_waltz_quic_fd_quic_timer_wheel_h */
@@ -3,6 +3,7 @@
 
 #include "fd_quic_sandbox.h"
 #include "../fd_quic_proto.h"
+#include "../fd_quic_private.h"
 
 /* RFC 9000 Section 4.1. Data Flow Control
 
@@ -59,6 +60,70 @@ test_quic_stream_limit_enforcement( fd_quic_sandbox_t * sandbox,
   FD_TEST( conn->reason == FD_QUIC_CONN_REASON_STREAM_LIMIT_ERROR );
 }
 
+/* RFC 9002 Section 6.4. Discarding Keys and Packet State
+
+   > When Initial and Handshake packet protection keys are discarded
+   > (see Section 4.9 of [QUIC-TLS]), all packets that were sent with
+   > those keys can no longer be acknowledged because their
+   > acknowledgments cannot be processed.  The sender MUST discard all
+   > recovery state associated with those packets and MUST remove them
+   > from the count of bytes in flight. */
+
+static __attribute__ ((noinline)) void
+test_quic_discard_keys_inflight( fd_quic_sandbox_t * sandbox,
+                                 fd_rng_t *          rng ) {
+
+  fd_quic_sandbox_init( sandbox, FD_QUIC_ROLE_SERVER );
+  fd_quic_conn_t * conn = fd_quic_sandbox_new_conn_established( sandbox, rng );
+  fd_quic_cc_init( &conn->cc, FD_QUIC_CC_ALGO_NEWRENO, 1200UL );
+
+  /* Pretend the handshake is still in progress, with packets in flight
+     at every enc level */
+
+  conn->peer_enc_level = (uchar)fd_quic_enc_level_initial_id;
+  fd_quic_pkt_meta_pool_t * pool = &conn->pkt_meta_pool;
+  static struct { uint enc_level; uint pn_space; } const sent[] = {
+    { fd_quic_enc_level_initial_id,   0U },
+    { fd_quic_enc_level_handshake_id, 1U },
+    { fd_quic_enc_level_handshake_id, 1U },
+    { fd_quic_enc_level_appdata_id,   2U },
+  };
+  ulong pkt_number = 0UL;
+  for( ulong i=0UL; i<sizeof(sent)/sizeof(sent[0]); i++ ) {
+    uint enc_level = sent[ i ].enc_level;
+    fd_quic_pkt_meta_t * pkt_meta = fd_quic_pkt_meta_allocate( pool );
+    FD_TEST( pkt_meta );
+    memset( pkt_meta, 0, sizeof(fd_quic_pkt_meta_t) );
+    pkt_meta->pkt_number = pkt_number++;
+    pkt_meta->enc_level  = (uchar)enc_level;
+    pkt_meta->pn_space   = (uchar)sent[ i ].pn_space;
+    pkt_meta->status     = FD_QUIC_PKT_META_STATUS_SENT;
+    fd_quic_cc_on_sent( &conn->cc, pkt_meta, 1000UL+i, 1, 0UL );
+    fd_quic_pkt_meta_push_back( &pool->sent_pkt_meta[ enc_level ], pkt_meta );
+  }
+  FD_TEST( conn->cc.inflight==4006UL );
+
+  /* The peer uses the handshake keys, the initial ones are discarded */
+
+  fd_quic_ack_enc_level( conn, fd_quic_enc_level_handshake_id );
+  FD_TEST( !pool->sent_pkt_meta[ fd_quic_enc_level_initial_id ].head );
+  FD_TEST( conn->cc.inflight==3006UL );
+
+  /* The peer uses the 1-RTT keys, the handshake ones are discarded */
+
+  fd_quic_ack_enc_level( conn, fd_quic_enc_level_appdata_id );
+  FD_TEST( !pool->sent_pkt_meta[ fd_quic_enc_level_handshake_id ].head );
+  FD_TEST(  pool->sent_pkt_meta[ fd_quic_enc_level_appdata_id   ].head );
+  FD_TEST( conn->cc.inflight==1003UL );
+
+  /* Dropping the last packet in flight leaves nothing in flight */
+
+  fd_quic_pkt_meta_t * pkt_meta = fd_quic_pkt_meta_pop_front( &pool->sent_pkt_meta[ fd_quic_enc_level_appdata_id ] );
+  fd_quic_cc_on_discard( &conn->cc, pkt_meta );
+  fd_quic_pkt_meta_deallocate( pool, pkt_meta );
+  FD_TEST( !conn->cc.inflight );
+}
+
 int
 main( int     argc,
       char ** argv ) {
@@ -102,6 +167,7 @@ main( int     argc,
 
   test_quic_stream_data_limit_enforcement( sandbox, rng );
   test_quic_stream_limit_enforcement     ( sandbox, rng );
+  test_quic_discard_keys_inflight        ( sandbox, rng );
 
   /* Wind down */
 
@@ -450,6 +450,336 @@ server_fibre_fn( void * vp_arg ) {
 }
 
 
+/* Goodput ************************************************************/
+
+/* The goodput test measures the stream bytes a client delivers to a
+   server over an emulated network path within a fixed (virtual) time,
+   for each congestion controller (FD_QUIC_CC_ALGO_*).  Each stream
+   carries one message of msg_sz bytes (like a transaction), so every
+   lost packet costs one retransmission.  The path is configured with
+   --goodput-{drop,delay,rate,queue}. */
+
+/* netem_t emulates one direction of a network path: random loss with
+   probability drop, a bottleneck link of rate bytes/ns with a tail drop
+   queue of up to queue_sz bytes, and a one way propagation delay of
+   delay ns.  Packets are delivered by a fibre when due. */
+
+#define NETEM_DEPTH (4096UL)
+
+struct netem_pkt {
+  ulong due;
+  ulong sz;
+  uchar buf[ 2048 ];
+};
+typedef struct netem_pkt netem_pkt_t;
+
+struct netem {
+  fd_aio_t         local;
+  fd_aio_t const * dst;
+  fd_fibre_t *     fibre;     /* delivers due packets */
+  fd_fibre_t **    rx_fibre;  /* services the receiving quic, woken on delivery */
+
+  float            drop;
+  double           ns_per_byte;
+  ulong            queue_sz;
+  ulong            delay;
+
+  ulong            link_free; /* time the link finishes sending the queued packets */
+  ulong            head;
+  ulong            tail;
+  ulong            tx_cnt;
+  ulong            drop_cnt;
+  ulong            ovfl_cnt;
+
+  netem_pkt_t      q[ NETEM_DEPTH ];
+};
+typedef struct netem netem_t;
+
+static netem_t netem[2]; /* 0=client->server  1=server->client */
+
+int   goodput_done  = 0;
+ulong goodput_rcvd  = 0UL;
+ulong goodput_sent  = 0UL;
+
+fd_fibre_t * goodput_client_fibre = NULL;
+fd_fibre_t * goodput_server_fibre = NULL;
+
+static int
+netem_tx( void *                    ctx,
+          fd_aio_pkt_info_t const * batch,
+          ulong                     batch_cnt,
+          ulong *                   opt_batch_idx,
+          int                       flush ) {
+  (void)flush;
+  (void)opt_batch_idx;
+
+  netem_t * n = (netem_t *)ctx;
+
+  for( ulong j=0UL; j<batch_cnt; j++ ) {
+    ulong sz = batch[j].buf_sz;
+    n->tx_cnt++;
+
+    if( rnd() < n->drop ) {
+      n->drop_cnt++;
+      continue;
+    }
+
+    /* tail drop if the bottleneck queue is full */
+    ulong start   = fd_ulong_max( n->link_free, now );
+    ulong backlog = (ulong)( (double)( start - now ) / n->ns_per_byte );
+    if( backlog + sz > n->queue_sz || n->tail - n->head >= NETEM_DEPTH ) {
+      n->ovfl_cnt++;
+      continue;
+    }
+
+    n->link_free = start + (ulong)( (double)sz * n->ns_per_byte );
+
+    netem_pkt_t * pkt = &n->q[ n->tail % NETEM_DEPTH ];
+    pkt->due = n->link_free + n->delay;
+    pkt->sz  = sz;
+    fd_memcpy( pkt->buf, batch[j].buf, sz );
+    n->tail++;
+  }
+
+  fd_fibre_wake( n->fibre );
+
+  return FD_AIO_SUCCESS;
+}
+
+static void
+netem_fibre_fn( void * vp_arg ) {
+  netem_t * n = (netem_t *)vp_arg;
+
+  while( !goodput_done ) {
+    int delivered = 0;
+    while( n->head != n->tail && n->q[ n->head % NETEM_DEPTH ].due <= now ) {
+      netem_pkt_t * pkt = &n->q[ n->head % NETEM_DEPTH ];
+      fd_aio_pkt_info_t batch[1] = {{ .buf = pkt->buf, .buf_sz = (ushort)pkt->sz }};
+      fd_aio_send( n->dst, batch, 1UL, NULL, 1 );
+      n->head++;
+      delivered = 1;
+    }
+    if( delivered ) fd_fibre_wake( *n->rx_fibre );
+
+    /* sleep until the next packet is due, or until woken by netem_tx */
+    ulong wakeup = n->head != n->tail ? n->q[ n->head % NETEM_DEPTH ].due : now + (ulong)1e9;
+    fd_fibre_wait_until( (long)wakeup );
+  }
+}
+
+static void
+netem_link( fd_quic_t *   quic_a,
+            fd_quic_t *   quic_b,
+            netem_t *     n,
+            fd_fibre_t ** rx_fibre ) {
+  FD_TEST( fd_aio_join( fd_aio_new( &n->local, n, netem_tx ) ) );
+  n->dst      = fd_quic_get_aio_net_rx( quic_b );
+  n->rx_fibre = rx_fibre;
+  fd_quic_set_aio_net_tx( quic_a, &n->local );
+}
+
+void
+goodput_stream_receive_cb( fd_quic_stream_t * stream,
+                           void *             ctx,
+                           uchar const *      data,
+                           ulong              data_sz,
+                           ulong              offset,
+                           int                fin ) {
+  (void)stream; (void)ctx; (void)data; (void)offset; (void)fin;
+  goodput_rcvd += data_sz;
+}
+
+void
+goodput_conn_final( fd_quic_conn_t * conn,
+                    void *           context ) {
+  (void)context;
+  fd_quic_conn_t ** ppconn = (fd_quic_conn_t**)fd_quic_conn_get_context( conn );
+  if( ppconn ) *ppconn = NULL;
+}
+
+struct goodput_args {
+  fd_quic_t * quic;
+  fd_quic_t * server_quic;
+  ulong       duration;
+  ulong       msg_sz;
+  ulong       start;     /* out: time the transfer started */
+};
+typedef struct goodput_args goodput_args_t;
+
+void
+goodput_client_fibre_fn( void * vp_arg ) {
+  goodput_args_t * args = (goodput_args_t*)vp_arg;
+
+  fd_quic_t * quic        = args->quic;
+  fd_quic_t * server_quic = args->server_quic;
+
+  static uchar msg[ 2048 ];
+  fd_aio_pkt_info_t batch[1] = {{ .buf = msg, .buf_sz = (ushort)args->msg_sz }};
+
+  fd_quic_service( quic ); /* update the quic clock */
+
+  fd_quic_conn_t * conn = fd_quic_connect( quic,
+                                           server_quic->config.net.ip_addr,
+                                           server_quic->config.net.listen_udp_port,
+                                           server_quic->config.sni );
+  FD_TEST( conn );
+  fd_quic_conn_set_context( conn, &conn );
+
+  while( conn && conn->state != FD_QUIC_CONN_STATE_ACTIVE ) {
+    fd_quic_service( quic );
+    fd_fibre_wait_until( (long)fd_ulong_min( fd_quic_get_next_wakeup( quic ), now + (ulong)1e9 ) );
+  }
+  FD_TEST( conn );
+
+  args->start = now;
+  ulong end   = now + args->duration;
+
+  while( conn && now < end ) {
+    /* keep all the streams we are allowed to open busy */
+    for(;;) {
+      fd_quic_stream_t * stream = fd_quic_conn_new_stream( conn, FD_QUIC_TYPE_UNIDIR );
+      if( !stream ) break;
+      FD_TEST( fd_quic_stream_send( stream, batch, 1UL, 1 /* fin */ )==1 );
+      goodput_sent += args->msg_sz;
+    }
+
+    fd_quic_service( quic );
+    fd_fibre_wait_until( (long)fd_ulong_min( fd_quic_get_next_wakeup( quic ), end ) );
+  }
+  FD_TEST( conn ); /* the conn must survive the transfer */
+
+  goodput_done = 1;
+  fd_fibre_wake( goodput_server_fibre );
+}
+
+void
+goodput_server_fibre_fn( void * vp_arg ) {
+  fd_quic_t * quic = (fd_quic_t *)vp_arg;
+
+  while( !goodput_done ) {
+    fd_quic_service( quic );
+    fd_fibre_wait_until( (long)fd_ulong_min( fd_quic_get_next_wakeup( quic ), now + (ulong)1e9 ) );
+  }
+}
+
+static char const *
+cc_algo_str( int cc_algo ) {
+  switch( cc_algo ) {
+  case FD_QUIC_CC_ALGO_NONE:    return "none";
+  case FD_QUIC_CC_ALGO_NEWRENO: return "newreno";
+  case FD_QUIC_CC_ALGO_CUBIC:   return "cubic";
+  case FD_QUIC_CC_ALGO_BBR:     return "bbr";
+  default:                      return "unknown";
+  }
+}
+
+/* run_goodput runs the goodput test with the client using cc_algo and
+   returns the goodput in bytes/s */
+
+static double
+run_goodput( fd_wksp_t * wksp,
+             fd_rng_t *  rng,
+             int         cc_algo,
+             float       drop,
+             ulong       delay,
+             double      rate,
+             ulong       queue_sz,
+             ulong       duration,
+             ulong       msg_sz ) {
+  fd_quic_limits_t const quic_limits = {
+    .conn_cnt           = 10,
+    .conn_id_cnt        = 10,
+    .conn_id_sparsity   = 4.0,
+    .handshake_cnt      = 10,
+    .stream_cnt         = { 0, 0, 256, 0 },
+    .initial_stream_cnt = { 0, 0, 256, 0 },
+    .stream_pool_cnt    = 512,
+    .inflight_pkt_cnt   = 1024,
+    .tx_buf_sz          = 1<<12
+  };
+
+  fd_quic_t * server_quic = fd_quic_new_anonymous( wksp, &quic_limits, FD_QUIC_ROLE_SERVER, rng );
+  fd_quic_t * client_quic = fd_quic_new_anonymous( wksp, &quic_limits, FD_QUIC_ROLE_CLIENT, rng );
+  FD_TEST( server_quic && client_quic );
+
+  fd_quic_t * quics[2] = { client_quic, server_quic };
+  for( ulong j=0UL; j<2UL; j++ ) {
+    fd_quic_t * quic = quics[j];
+    quic->config.idle_timeout               = (ulong)5e9;
+    quic->config.service_interval           = (ulong)1e6;
+    quic->config.initial_rx_max_stream_data = 1<<15;
+    quic->cb.stream_receive                 = goodput_stream_receive_cb;
+    quic->cb.conn_final                     = goodput_conn_final;
+    quic->cb.now                            = test_clock;
+    quic->cb.now_ctx                        = NULL;
+  }
+  client_quic->config.cc_algo = cc_algo;
+
+  goodput_done = 0;
+  goodput_rcvd = 0UL;
+  goodput_sent = 0UL;
+
+  for( ulong j=0UL; j<2UL; j++ ) {
+    netem_t * n = &netem[j];
+    n->drop        = drop;
+    n->ns_per_byte = 1e9 / rate;
+    n->queue_sz    = queue_sz;
+    n->delay       = delay;
+    n->link_free   = now;
+    n->head = n->tail = 0UL;
+    n->tx_cnt = n->drop_cnt = n->ovfl_cnt = 0UL;
+  }
+  netem_link( client_quic, server_quic, &netem[0], &goodput_server_fibre );
+  netem_link( server_quic, client_quic, &netem[1], &goodput_client_fibre );
+
+  FD_TEST( fd_quic_init( client_quic ) );
+  FD_TEST( fd_quic_init( server_quic ) );
+
+  ulong stack_sz = 1<<20;
+  void * fibre_mem[4];
+  for( ulong j=0UL; j<4UL; j++ ) {
+    fibre_mem[j] = fd_wksp_alloc_laddr( wksp, fd_fibre_start_align(), fd_fibre_start_footprint( stack_sz ), 1UL );
+    FD_TEST( fibre_mem[j] );
+  }
+
+  goodput_args_t args[1] = {{ .quic = client_quic, .server_quic = server_quic, .duration = duration, .msg_sz = msg_sz }};
+  goodput_client_fibre = fd_fibre_start( fibre_mem[0], stack_sz, goodput_client_fibre_fn, args        );
+  goodput_server_fibre = fd_fibre_start( fibre_mem[1], stack_sz, goodput_server_fibre_fn, server_quic );
+  netem[0].fibre       = fd_fibre_start( fibre_mem[2], stack_sz, netem_fibre_fn,          &netem[0]   );
+  netem[1].fibre       = fd_fibre_start( fibre_mem[3], stack_sz, netem_fibre_fn,          &netem[1]   );
+  FD_TEST( goodput_client_fibre && goodput_server_fibre && netem[0].fibre && netem[1].fibre );
+
+  fd_fibre_schedule( goodput_client_fibre );
+  fd_fibre_schedule( goodput_server_fibre );
+  fd_fibre_schedule( netem[0].fibre );
+  fd_fibre_schedule( netem[1].fibre );
+
+  while(1) {
+    long timeout = fd_fibre_schedule_run();
+    if( timeout < 0 ) break;
+
+    now = (ulong)timeout;
+  }
+
+  double goodput = (double)goodput_rcvd * 1e9 / (double)duration;
+  FD_LOG_NOTICE(( "goodput %-8s %8.3f MB/s  (sent %lu B, rcvd %lu B, c2s pkts %lu dropped %lu overflowed %lu)",
+                  cc_algo_str( cc_algo ), goodput*1e-6, goodput_sent, goodput_rcvd,
+                  netem[0].tx_cnt, netem[0].drop_cnt, netem[0].ovfl_cnt ));
+  FD_TEST( goodput_rcvd>0UL && goodput_rcvd<=goodput_sent );
+
+  fd_fibre_free( goodput_client_fibre );
+  fd_fibre_free( goodput_server_fibre );
+  fd_fibre_free( netem[0].fibre );
+  fd_fibre_free( netem[1].fibre );
+  for( ulong j=0UL; j<4UL; j++ ) fd_wksp_free_laddr( fibre_mem[j] );
+  goodput_client_fibre = goodput_server_fibre = NULL;
+
+  fd_wksp_free_laddr( fd_quic_delete( fd_quic_leave( server_quic ) ) );
+  fd_wksp_free_laddr( fd_quic_delete( fd_quic_leave( client_quic ) ) );
+
+  return goodput;
+}
+
 int
 main( int argc, char ** argv ) {
 
@@ -465,6 +795,14 @@ main( int argc, char ** argv ) {
   ulong        page_cnt  = fd_env_strip_cmdline_ulong( &argc, &argv, "--page-cnt",  NULL, 2UL                          );
   ulong        numa_idx  = fd_env_strip_cmdline_ulong( &argc, &argv, "--numa-idx",  NULL, fd_shmem_numa_idx( cpu_idx ) );
 
+  /* goodput test network path */
+  float        gp_drop   = fd_env_strip_cmdline_float ( &argc, &argv, "--goodput-drop",     NULL, 0.01f        ); /* loss probability */
+  ulong        gp_delay  = fd_env_strip_cmdline_ulong ( &argc, &argv, "--goodput-delay",    NULL, (ulong)10e6  ); /* one way, ns */
+  double       gp_rate   = fd_env_strip_cmdline_double( &argc, &argv, "--goodput-rate",     NULL, 12.5e6       ); /* bytes/s */
+  ulong        gp_queue  = fd_env_strip_cmdline_ulong ( &argc, &argv, "--goodput-queue",    NULL, 1UL<<16      ); /* bytes */
+  ulong        gp_dur    = fd_env_strip_cmdline_ulong ( &argc, &argv, "--goodput-duration", NULL, (ulong)2e9   ); /* ns */
+  ulong        gp_msg_sz = fd_env_strip_cmdline_ulong ( &argc, &argv, "--goodput-msg-sz",   NULL, 1000UL       );
+
   ulong page_sz = fd_cstr_to_shmem_page_sz( _page_sz );
   if( FD_UNLIKELY( !page_sz ) ) FD_LOG_ERR(( "unsupported --page-sz" ));
 
@@ -588,6 +926,13 @@ main( int argc, char ** argv ) {
   FD_TEST( fd_aio_pcapng_leave( &pcap_client_to_server ) );
   FD_TEST( fd_aio_pcapng_leave( &pcap_server_to_client ) );
 
+  FD_LOG_NOTICE(( "Goodput (drop %.3f, delay %lu ns, rate %.1f MB/s, queue %lu B, duration %lu ns, msg %lu B)",
+                  (double)gp_drop, gp_delay, gp_rate*1e-6, gp_queue, gp_dur, gp_msg_sz ));
+  FD_TEST( gp_msg_sz>0UL && gp_msg_sz<=1000UL );
+  for( int cc_algo=0; cc_algo<FD_QUIC_CC_ALGO_CNT; cc_algo++ ) {
+    run_goodput( wksp, rng, cc_algo, gp_drop, gp_delay, gp_rate, gp_queue, gp_dur, gp_msg_sz );
+  }
+
   FD_LOG_NOTICE(( "Cleaning up" ));
   //fd_quic_virtual_pair_fini( &vp );
   // TODO clean up mitm_ctx and aio
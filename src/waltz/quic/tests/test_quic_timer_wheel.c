@@ -0,0 +1,221 @@
+#include "../fd_quic_timer_wheel.h"
+#include "../../../util/fd_util.h"
+
+/* The service queue fd_quic used before the timer wheel, for
+   comparison in the benchmark */
+
+struct event {
+  ulong timeout;
+  ulong conn_idx;
+};
+typedef struct event event_t;
+
+#define PRQ_NAME      eventq
+#define PRQ_T         event_t
+#define PRQ_TIMEOUT_T ulong
+#include "../../../util/tmpl/fd_prq.c"
+
+#define ELE_MAX (1024UL)
+
+static uchar wheel_mem[ sizeof(fd_quic_timer_wheel_t) + ELE_MAX*sizeof(fd_quic_timer_wheel_ele_t) ] __attribute__((aligned(FD_QUIC_TIMER_WHEEL_ALIGN)));
+
+static ulong ref_timeout  [ ELE_MAX ];
+static int   ref_scheduled[ ELE_MAX ];
+
+static ulong
+ref_next( void ) {
+  ulong t = ULONG_MAX;
+  for( ulong i=0UL; i<ELE_MAX; i++ ) if( ref_scheduled[ i ] ) t = fd_ulong_min( t, ref_timeout[ i ] );
+  return t;
+}
+
+/* test_wheel checks the wheel against a reference doing linear scans,
+   with time steps ranging from a fraction of a tick to beyond the range
+   of the top level. */
+
+static void
+test_wheel( fd_rng_t * rng,
+            int        lg_tick ) {
+  FD_TEST( fd_quic_timer_wheel_footprint( ELE_MAX )<=sizeof(wheel_mem) );
+  FD_TEST( !fd_quic_timer_wheel_footprint( 0UL ) );
+  FD_TEST( !fd_quic_timer_wheel_new( wheel_mem, ELE_MAX, 33, 0UL ) );
+
+  ulong now = fd_rng_ulong( rng ) >> 16;
+  fd_quic_timer_wheel_t * wheel = fd_quic_timer_wheel_join( fd_quic_timer_wheel_new( wheel_mem, ELE_MAX, lg_tick, now ) );
+  FD_TEST( wheel );
+  fd_memset( ref_scheduled, 0, sizeof(ref_scheduled) );
+
+  FD_TEST( fd_quic_timer_wheel_next( wheel )==ULONG_MAX );
+  FD_TEST( fd_quic_timer_wheel_pop( wheel, now )==FD_QUIC_TIMER_WHEEL_IDX_NULL );
+
+  ulong cnt = 0UL;
+  for( ulong iter=0UL; iter<1000000UL; iter++ ) {
+    uint r = fd_rng_uint( rng );
+    switch( r & 7U ) {
+    case 0: case 1: case 2: { /* schedule, deadline up to ~2^(lg_tick+36) ahead, sometimes in the past */
+      ulong idx   = fd_rng_ulong_roll( rng, ELE_MAX );
+      int   lg    = (int)fd_rng_uint_roll( rng, (uint)lg_tick+37U );
+      ulong delta = fd_rng_ulong( rng ) & ( (1UL<<lg)-1UL );
+      ulong t     = (r & 8U) ? now - fd_ulong_min( delta, now ) : now + delta;
+      cnt += (ulong)!ref_scheduled[ idx ];
+      fd_quic_timer_wheel_schedule( wheel, idx, t );
+      ref_timeout  [ idx ] = t;
+      ref_scheduled[ idx ] = 1;
+      break;
+    }
+    case 3: { /* cancel */
+      ulong idx = fd_rng_ulong_roll( rng, ELE_MAX );
+      cnt -= (ulong)ref_scheduled[ idx ];
+      fd_quic_timer_wheel_cancel( wheel, idx );
+      ref_scheduled[ idx ] = 0;
+      break;
+    }
+    case 4: case 5: { /* advance time */
+      int lg = (int)fd_rng_uint_roll( rng, (uint)lg_tick+37U );
+      now += fd_rng_ulong( rng ) & ( (1UL<<lg)-1UL );
+      break;
+    }
+    default: { /* pop everything due */
+      for(;;) {
+        ulong idx = fd_quic_timer_wheel_pop( wheel, now );
+        if( idx==FD_QUIC_TIMER_WHEEL_IDX_NULL ) break;
+        FD_TEST( idx<ELE_MAX );
+        FD_TEST( ref_scheduled[ idx ] );
+        FD_TEST( ref_timeout[ idx ]<=now );
+        FD_TEST( !fd_quic_timer_wheel_is_scheduled( wheel, idx ) );
+        ref_scheduled[ idx ] = 0;
+        cnt--;
+      }
+      FD_TEST( ref_next()>now );
+      break;
+    }
+    }
+    FD_TEST( fd_quic_timer_wheel_cnt( wheel )==cnt );
+    if( !(iter & 63UL) ) FD_TEST( fd_quic_timer_wheel_next( wheel )==ref_next() );
+  }
+
+  for( ulong i=0UL; i<ELE_MAX; i++ ) {
+    FD_TEST( fd_quic_timer_wheel_is_scheduled( wheel, i )==ref_scheduled[ i ] );
+    if( ref_scheduled[ i ] ) FD_TEST( fd_quic_timer_wheel_timeout( wheel, i )==ref_timeout[ i ] );
+  }
+
+  FD_TEST( fd_quic_timer_wheel_delete( fd_quic_timer_wheel_leave( wheel ) )==wheel_mem );
+}
+
+/* The benchmark models the service loop of a QUIC server with conn_cnt
+   mostly idle connections receiving one packet every pkt_ns.  Each
+   packet reschedules its connection for immediate service (like most
+   fd_quic_reschedule_conn calls do) and each service loop reschedules
+   the connections it services svc_ns later. */
+
+static void
+bench_wheel( fd_rng_t * rng,
+             ulong      conn_cnt,
+             ulong      pkt_cnt,
+             ulong      pkt_ns,
+             ulong      svc_ns ) {
+  void * mem = aligned_alloc( fd_quic_timer_wheel_align(), fd_quic_timer_wheel_footprint( conn_cnt ) );
+  FD_TEST( mem );
+  ulong now = (ulong)fd_log_wallclock();
+  fd_quic_timer_wheel_t * wheel = fd_quic_timer_wheel_join( fd_quic_timer_wheel_new( mem, conn_cnt, 10, now ) );
+  for( ulong i=0UL; i<conn_cnt; i++ ) fd_quic_timer_wheel_schedule( wheel, i, now + fd_rng_ulong_roll( rng, svc_ns ) );
+
+  ulong svc_cnt = 0UL;
+  long  dt      = -fd_log_wallclock();
+  for( ulong pkt=0UL; pkt<pkt_cnt; pkt++ ) {
+    now += pkt_ns;
+    ulong idx = fd_rng_ulong_roll( rng, conn_cnt );
+    if( fd_quic_timer_wheel_timeout( wheel, idx )>now+1UL ) fd_quic_timer_wheel_schedule( wheel, idx, now+1UL );
+    for(;;) {
+      ulong conn_idx = fd_quic_timer_wheel_pop( wheel, now );
+      if( conn_idx==FD_QUIC_TIMER_WHEEL_IDX_NULL ) break;
+      fd_quic_timer_wheel_schedule( wheel, conn_idx, now+svc_ns );
+      svc_cnt++;
+    }
+  }
+  dt += fd_log_wallclock();
+
+  FD_LOG_NOTICE(( "timer wheel:   %7lu conns, %.1f ns/pkt (%lu pkts, %lu services)",
+                  conn_cnt, (double)dt/(double)pkt_cnt, pkt_cnt, svc_cnt ));
+  free( fd_quic_timer_wheel_delete( fd_quic_timer_wheel_leave( wheel ) ) );
+}
+
+static void
+bench_prq( fd_rng_t * rng,
+           ulong      conn_cnt,
+           ulong      pkt_cnt,
+           ulong      pkt_ns,
+           ulong      svc_ns ) {
+  void * mem = aligned_alloc( eventq_align(), fd_ulong_align_up( eventq_footprint( conn_cnt+1UL ), eventq_align() ) );
+  FD_TEST( mem );
+  event_t * heap    = eventq_join( eventq_new( mem, conn_cnt+1UL ) );
+  ulong *   timeout = malloc( conn_cnt*sizeof(ulong) );
+  FD_TEST( timeout );
+  ulong now = (ulong)fd_log_wallclock();
+  for( ulong i=0UL; i<conn_cnt; i++ ) {
+    timeout[ i ] = now + fd_rng_ulong_roll( rng, svc_ns );
+    event_t ev[1] = {{ .timeout = timeout[ i ], .conn_idx = i }};
+    eventq_insert( heap, ev );
+  }
+
+  ulong svc_cnt = 0UL;
+  long  dt      = -fd_log_wallclock();
+  for( ulong pkt=0UL; pkt<pkt_cnt; pkt++ ) {
+    now += pkt_ns;
+    ulong idx = fd_rng_ulong_roll( rng, conn_cnt );
+    if( timeout[ idx ]>now+1UL ) {
+      /* find conn in events, then remove, insert (as fd_quic did) */
+      ulong cnt = eventq_cnt( heap );
+      for( ulong j=0UL; j<cnt; j++ ) {
+        if( heap[ j ].conn_idx==idx ) { eventq_remove( heap, j ); break; }
+      }
+      timeout[ idx ] = now+1UL;
+      event_t ev[1] = {{ .timeout = timeout[ idx ], .conn_idx = idx }};
+      eventq_insert( heap, ev );
+    }
+    while( eventq_cnt( heap ) && heap[0].timeout<=now ) {
+      ulong conn_idx = heap[0].conn_idx;
+      eventq_remove_min( heap );
+      timeout[ conn_idx ] = now+svc_ns;
+      event_t ev[1] = {{ .timeout = timeout[ conn_idx ], .conn_idx = conn_idx }};
+      eventq_insert( heap, ev );
+      svc_cnt++;
+    }
+  }
+  dt += fd_log_wallclock();
+
+  FD_LOG_NOTICE(( "service queue: %7lu conns, %.1f ns/pkt (%lu pkts, %lu services)",
+                  conn_cnt, (double)dt/(double)pkt_cnt, pkt_cnt, svc_cnt ));
+  free( timeout );
+  free( eventq_delete( eventq_leave( heap ) ) );
+}
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+
+  ulong conn_cnt = fd_env_strip_cmdline_ulong( &argc, &argv, "--conn-cnt", NULL, 65536UL   );
+  ulong pkt_cnt  = fd_env_strip_cmdline_ulong( &argc, &argv, "--pkt-cnt",  NULL, 1UL<<20   );
+  ulong pkt_ns   = fd_env_strip_cmdline_ulong( &argc, &argv, "--pkt-ns",   NULL, 1000UL    );
+  ulong svc_ns   = fd_env_strip_cmdline_ulong( &argc, &argv, "--svc-ns",   NULL, (ulong)10e6 );
+
+  fd_rng_t _rng[1]; fd_rng_t * rng = fd_rng_join( fd_rng_new( _rng, 0U, 0UL ) );
+
+  test_wheel( rng,  0 );
+  test_wheel( rng, 10 );
+  FD_LOG_NOTICE(( "wheel ok" ));
+
+  for( ulong n=1024UL; n<=conn_cnt; n<<=3 ) {
+    bench_wheel( rng, n, pkt_cnt, pkt_ns, svc_ns );
+    /* the linear scan of the service queue makes it O(conn_cnt) per
+       reschedule, run fewer packets */
+    bench_prq  ( rng, n, fd_ulong_max( pkt_cnt*1024UL/n, 1UL<<12 ), pkt_ns, svc_ns );
+  }
+
+  fd_rng_delete( fd_rng_leave( rng ) );
+
+  FD_LOG_NOTICE(( "pass" ));
+  fd_halt();
+  return 0;
+}